@@ -0,0 +1,33 @@
+build/block.o: src/block.c src/block.h src/util/debug.h \
+ src/util/errorcode.h src/util/macros.h src/util/list.h src/util/macros.h \
+ build/gen/buildvar-block-pool.h src/util/arith.h src/util/debug.h \
+ src/util/array.h src/util/ptr-array.h src/util/bit.h \
+ src/util/container.h src/util/xmalloc.h src/util/arith.h \
+ src/util/xstring.h src/util/ascii.h src/util/bit.h src/util/slab.h \
+ src/util/list.h src/util/str-util.h src/util/string-view.h \
+ src/util/xmemrchr.h src/util/xmalloc.h src/util/xmemrchr.h
+src/block.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/macros.h:
+src/util/list.h:
+src/util/macros.h:
+build/gen/buildvar-block-pool.h:
+src/util/arith.h:
+src/util/debug.h:
+src/util/array.h:
+src/util/ptr-array.h:
+src/util/bit.h:
+src/util/container.h:
+src/util/xmalloc.h:
+src/util/arith.h:
+src/util/xstring.h:
+src/util/ascii.h:
+src/util/bit.h:
+src/util/slab.h:
+src/util/list.h:
+src/util/str-util.h:
+src/util/string-view.h:
+src/util/xmemrchr.h:
+src/util/xmalloc.h:
+src/util/xmemrchr.h:
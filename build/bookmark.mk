@@ -0,0 +1,108 @@
+build/bookmark.o: src/bookmark.c src/bookmark.h src/command/error.h \
+ src/util/macros.h src/util/macros.h src/util/ptr-array.h src/util/bit.h \
+ src/util/debug.h src/util/errorcode.h src/util/macros.h \
+ src/util/container.h src/util/xmalloc.h src/util/arith.h \
+ src/util/xstring.h src/util/ascii.h src/util/xmalloc.h src/view.h \
+ src/block-iter.h src/block.h src/util/debug.h src/util/list.h \
+ src/util/string-view.h src/util/xmemrchr.h src/util/string.h \
+ src/util/str-util.h src/util/string-view.h src/util/unicode.h \
+ src/util/unicode.h src/window.h src/buffer.h src/change.h src/lock.h \
+ src/options.h src/regexp.h src/syntax/syntax.h src/command/error.h \
+ src/syntax/bitset.h src/util/debug.h src/syntax/color.h \
+ src/terminal/style.h src/terminal/color.h src/terminal/feature.h \
+ src/util/ptr-array.h src/util/hashmap.h src/util/string.h \
+ src/util/hashset.h src/util/string-view.h src/frame.h src/editor.h \
+ src/cmdline.h src/command/run.h src/command/error.h src/history.h \
+ src/util/hashmap.h src/command/macro.h src/util/unicode.h src/commands.h \
+ src/config.h src/util/align.h src/util/errorcode.h src/copy.h \
+ src/file-history.h src/grep.h src/msg.h src/job.h src/mode.h \
+ src/terminal/key.h src/util/intmap.h src/search.h src/syntax/color.h \
+ src/syntax/state.h src/syntax/syntax.h src/tag.h src/ctags.h \
+ src/terminal/cursor.h src/terminal/color.h src/terminal/terminal.h \
+ src/terminal/key.h src/terminal/style.h src/terminal/terminal.h \
+ src/undo-journal.h src/util/hashset.h src/vars.h src/move.h \
+ src/selection.h
+src/bookmark.h:
+src/command/error.h:
+src/util/macros.h:
+src/util/macros.h:
+src/util/ptr-array.h:
+src/util/bit.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/macros.h:
+src/util/container.h:
+src/util/xmalloc.h:
+src/util/arith.h:
+src/util/xstring.h:
+src/util/ascii.h:
+src/util/xmalloc.h:
+src/view.h:
+src/block-iter.h:
+src/block.h:
+src/util/debug.h:
+src/util/list.h:
+src/util/string-view.h:
+src/util/xmemrchr.h:
+src/util/string.h:
+src/util/str-util.h:
+src/util/string-view.h:
+src/util/unicode.h:
+src/util/unicode.h:
+src/window.h:
+src/buffer.h:
+src/change.h:
+src/lock.h:
+src/options.h:
+src/regexp.h:
+src/syntax/syntax.h:
+src/command/error.h:
+src/syntax/bitset.h:
+src/util/debug.h:
+src/syntax/color.h:
+src/terminal/style.h:
+src/terminal/color.h:
+src/terminal/feature.h:
+src/util/ptr-array.h:
+src/util/hashmap.h:
+src/util/string.h:
+src/util/hashset.h:
+src/util/string-view.h:
+src/frame.h:
+src/editor.h:
+src/cmdline.h:
+src/command/run.h:
+src/command/error.h:
+src/history.h:
+src/util/hashmap.h:
+src/command/macro.h:
+src/util/unicode.h:
+src/commands.h:
+src/config.h:
+src/util/align.h:
+src/util/errorcode.h:
+src/copy.h:
+src/file-history.h:
+src/grep.h:
+src/msg.h:
+src/job.h:
+src/mode.h:
+src/terminal/key.h:
+src/util/intmap.h:
+src/search.h:
+src/syntax/color.h:
+src/syntax/state.h:
+src/syntax/syntax.h:
+src/tag.h:
+src/ctags.h:
+src/terminal/cursor.h:
+src/terminal/color.h:
+src/terminal/terminal.h:
+src/terminal/key.h:
+src/terminal/style.h:
+src/terminal/terminal.h:
+src/undo-journal.h:
+src/util/hashset.h:
+src/vars.h:
+src/move.h:
+src/selection.h:
@@ -0,0 +1,107 @@
+build/change.o: src/change.c src/change.h src/block.h src/util/debug.h \
+ src/util/errorcode.h src/util/macros.h src/util/list.h src/util/macros.h \
+ src/command/error.h src/util/macros.h src/view.h src/block-iter.h \
+ src/util/string-view.h src/util/ascii.h src/util/debug.h \
+ src/util/xmemrchr.h src/util/xstring.h src/util/string.h \
+ src/util/arith.h src/util/bit.h src/util/str-util.h \
+ src/util/string-view.h src/util/unicode.h src/util/xmalloc.h \
+ src/util/unicode.h src/buffer.h src/lock.h src/options.h src/regexp.h \
+ src/util/ptr-array.h src/util/container.h src/syntax/syntax.h \
+ src/command/error.h src/syntax/bitset.h src/util/debug.h \
+ src/syntax/color.h src/terminal/style.h src/terminal/color.h \
+ src/terminal/feature.h src/util/ptr-array.h src/util/hashmap.h \
+ src/util/string.h src/util/hashset.h src/util/string-view.h src/edit.h \
+ src/editor.h src/cmdline.h src/command/run.h src/command/error.h \
+ src/history.h src/util/hashmap.h src/command/macro.h src/util/unicode.h \
+ src/commands.h src/config.h src/util/align.h src/util/errorcode.h \
+ src/copy.h src/file-history.h src/frame.h src/grep.h src/msg.h \
+ src/bookmark.h src/util/xmalloc.h src/window.h src/job.h src/mode.h \
+ src/terminal/key.h src/util/intmap.h src/search.h src/syntax/color.h \
+ src/syntax/state.h src/syntax/syntax.h src/tag.h src/ctags.h \
+ src/terminal/cursor.h src/terminal/color.h src/terminal/terminal.h \
+ src/terminal/key.h src/terminal/style.h src/terminal/terminal.h \
+ src/undo-journal.h src/util/hashset.h src/vars.h src/util/bit.h
+src/change.h:
+src/block.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/macros.h:
+src/util/list.h:
+src/util/macros.h:
+src/command/error.h:
+src/util/macros.h:
+src/view.h:
+src/block-iter.h:
+src/util/string-view.h:
+src/util/ascii.h:
+src/util/debug.h:
+src/util/xmemrchr.h:
+src/util/xstring.h:
+src/util/string.h:
+src/util/arith.h:
+src/util/bit.h:
+src/util/str-util.h:
+src/util/string-view.h:
+src/util/unicode.h:
+src/util/xmalloc.h:
+src/util/unicode.h:
+src/buffer.h:
+src/lock.h:
+src/options.h:
+src/regexp.h:
+src/util/ptr-array.h:
+src/util/container.h:
+src/syntax/syntax.h:
+src/command/error.h:
+src/syntax/bitset.h:
+src/util/debug.h:
+src/syntax/color.h:
+src/terminal/style.h:
+src/terminal/color.h:
+src/terminal/feature.h:
+src/util/ptr-array.h:
+src/util/hashmap.h:
+src/util/string.h:
+src/util/hashset.h:
+src/util/string-view.h:
+src/edit.h:
+src/editor.h:
+src/cmdline.h:
+src/command/run.h:
+src/command/error.h:
+src/history.h:
+src/util/hashmap.h:
+src/command/macro.h:
+src/util/unicode.h:
+src/commands.h:
+src/config.h:
+src/util/align.h:
+src/util/errorcode.h:
+src/copy.h:
+src/file-history.h:
+src/frame.h:
+src/grep.h:
+src/msg.h:
+src/bookmark.h:
+src/util/xmalloc.h:
+src/window.h:
+src/job.h:
+src/mode.h:
+src/terminal/key.h:
+src/util/intmap.h:
+src/search.h:
+src/syntax/color.h:
+src/syntax/state.h:
+src/syntax/syntax.h:
+src/tag.h:
+src/ctags.h:
+src/terminal/cursor.h:
+src/terminal/color.h:
+src/terminal/terminal.h:
+src/terminal/key.h:
+src/terminal/style.h:
+src/terminal/terminal.h:
+src/undo-journal.h:
+src/util/hashset.h:
+src/vars.h:
+src/util/bit.h:
@@ -0,0 +1,15 @@
+build/command/alias.o: src/command/alias.c src/command/alias.h \
+ src/util/hashmap.h src/util/container.h src/util/macros.h \
+ src/util/debug.h src/util/errorcode.h src/util/macros.h \
+ src/util/xmalloc.h src/util/arith.h src/util/xstring.h src/util/ascii.h
+src/command/alias.h:
+src/util/hashmap.h:
+src/util/container.h:
+src/util/macros.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/macros.h:
+src/util/xmalloc.h:
+src/util/arith.h:
+src/util/xstring.h:
+src/util/ascii.h:
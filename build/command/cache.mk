@@ -0,0 +1,39 @@
+build/command/cache.o: src/command/cache.c src/command/cache.h \
+ src/command/run.h src/command/error.h src/util/macros.h \
+ src/util/string-view.h src/util/ascii.h src/util/macros.h \
+ src/util/debug.h src/util/errorcode.h src/util/xmemrchr.h \
+ src/util/xstring.h src/command/args.h src/command/run.h \
+ src/util/base64.h src/util/debug.h src/command/parse.h \
+ src/util/ptr-array.h src/util/bit.h src/util/container.h \
+ src/util/xmalloc.h src/util/arith.h src/trace.h src/util/debug.h \
+ src/util/log.h src/util/macros.h src/util/str-array.h \
+ src/util/str-util.h src/util/string-view.h src/util/xmalloc.h
+src/command/cache.h:
+src/command/run.h:
+src/command/error.h:
+src/util/macros.h:
+src/util/string-view.h:
+src/util/ascii.h:
+src/util/macros.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/xmemrchr.h:
+src/util/xstring.h:
+src/command/args.h:
+src/command/run.h:
+src/util/base64.h:
+src/util/debug.h:
+src/command/parse.h:
+src/util/ptr-array.h:
+src/util/bit.h:
+src/util/container.h:
+src/util/xmalloc.h:
+src/util/arith.h:
+src/trace.h:
+src/util/debug.h:
+src/util/log.h:
+src/util/macros.h:
+src/util/str-array.h:
+src/util/str-util.h:
+src/util/string-view.h:
+src/util/xmalloc.h:
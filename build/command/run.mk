@@ -0,0 +1,47 @@
+build/command/run.o: src/command/run.c src/command/run.h \
+ src/command/error.h src/util/macros.h src/util/string-view.h \
+ src/util/ascii.h src/util/macros.h src/util/debug.h src/util/errorcode.h \
+ src/util/xmemrchr.h src/util/xstring.h src/command/args.h \
+ src/util/base64.h src/util/debug.h src/command/parse.h src/command/run.h \
+ src/util/ptr-array.h src/util/bit.h src/util/container.h \
+ src/util/xmalloc.h src/util/arith.h src/change.h src/block.h \
+ src/util/debug.h src/util/list.h src/util/macros.h src/command/error.h \
+ src/view.h src/block-iter.h src/util/string-view.h src/util/string.h \
+ src/util/str-util.h src/util/string-view.h src/util/unicode.h \
+ src/util/unicode.h src/timing.h src/util/xmalloc.h
+src/command/run.h:
+src/command/error.h:
+src/util/macros.h:
+src/util/string-view.h:
+src/util/ascii.h:
+src/util/macros.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/xmemrchr.h:
+src/util/xstring.h:
+src/command/args.h:
+src/util/base64.h:
+src/util/debug.h:
+src/command/parse.h:
+src/command/run.h:
+src/util/ptr-array.h:
+src/util/bit.h:
+src/util/container.h:
+src/util/xmalloc.h:
+src/util/arith.h:
+src/change.h:
+src/block.h:
+src/util/debug.h:
+src/util/list.h:
+src/util/macros.h:
+src/command/error.h:
+src/view.h:
+src/block-iter.h:
+src/util/string-view.h:
+src/util/string.h:
+src/util/str-util.h:
+src/util/string-view.h:
+src/util/unicode.h:
+src/util/unicode.h:
+src/timing.h:
+src/util/xmalloc.h:
@@ -0,0 +1,25 @@
+build/command/serialize.o: src/command/serialize.c \
+ src/command/serialize.h src/util/macros.h src/util/string.h \
+ src/util/arith.h src/util/debug.h src/util/errorcode.h src/util/macros.h \
+ src/util/bit.h src/util/str-util.h src/util/string-view.h \
+ src/util/ascii.h src/util/xmemrchr.h src/util/xstring.h \
+ src/util/unicode.h src/util/xmalloc.h src/util/string-view.h \
+ src/util/ascii.h src/util/numtostr.h
+src/command/serialize.h:
+src/util/macros.h:
+src/util/string.h:
+src/util/arith.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/macros.h:
+src/util/bit.h:
+src/util/str-util.h:
+src/util/string-view.h:
+src/util/ascii.h:
+src/util/xmemrchr.h:
+src/util/xstring.h:
+src/util/unicode.h:
+src/util/xmalloc.h:
+src/util/string-view.h:
+src/util/ascii.h:
+src/util/numtostr.h:
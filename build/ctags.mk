@@ -0,0 +1,24 @@
+build/ctags.o: src/ctags.c src/ctags.h src/util/macros.h \
+ src/util/string-view.h src/util/ascii.h src/util/macros.h \
+ src/util/debug.h src/util/errorcode.h src/util/xmemrchr.h \
+ src/util/xstring.h src/util/arith.h src/util/ascii.h src/util/debug.h \
+ src/util/str-util.h src/util/string-view.h src/util/strtonum.h \
+ src/util/xmalloc.h src/util/arith.h src/util/xstring.h
+src/ctags.h:
+src/util/macros.h:
+src/util/string-view.h:
+src/util/ascii.h:
+src/util/macros.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/xmemrchr.h:
+src/util/xstring.h:
+src/util/arith.h:
+src/util/ascii.h:
+src/util/debug.h:
+src/util/str-util.h:
+src/util/string-view.h:
+src/util/strtonum.h:
+src/util/xmalloc.h:
+src/util/arith.h:
+src/util/xstring.h:
@@ -0,0 +1,17 @@
+build/editorconfig/ini.o: src/editorconfig/ini.c src/editorconfig/ini.h \
+ src/util/macros.h src/util/string-view.h src/util/ascii.h \
+ src/util/macros.h src/util/debug.h src/util/errorcode.h \
+ src/util/xmemrchr.h src/util/xstring.h src/util/debug.h \
+ src/util/str-util.h src/util/string-view.h
+src/editorconfig/ini.h:
+src/util/macros.h:
+src/util/string-view.h:
+src/util/ascii.h:
+src/util/macros.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/xmemrchr.h:
+src/util/xstring.h:
+src/util/debug.h:
+src/util/str-util.h:
+src/util/string-view.h:
@@ -0,0 +1,29 @@
+build/encoding.o: src/encoding.c src/encoding.h src/util/macros.h \
+ src/util/string-view.h src/util/ascii.h src/util/macros.h \
+ src/util/debug.h src/util/errorcode.h src/util/xmemrchr.h \
+ src/util/xstring.h src/util/ascii.h src/util/bsearch.h src/util/array.h \
+ src/util/ptr-array.h src/util/bit.h src/util/container.h \
+ src/util/xmalloc.h src/util/arith.h src/util/debug.h src/util/intern.h \
+ src/util/hashset.h src/util/string-view.h src/util/xstring.h
+src/encoding.h:
+src/util/macros.h:
+src/util/string-view.h:
+src/util/ascii.h:
+src/util/macros.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/xmemrchr.h:
+src/util/xstring.h:
+src/util/ascii.h:
+src/util/bsearch.h:
+src/util/array.h:
+src/util/ptr-array.h:
+src/util/bit.h:
+src/util/container.h:
+src/util/xmalloc.h:
+src/util/arith.h:
+src/util/debug.h:
+src/util/intern.h:
+src/util/hashset.h:
+src/util/string-view.h:
+src/util/xstring.h:
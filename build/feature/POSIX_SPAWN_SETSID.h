@@ -0,0 +1 @@
+#define HAVE_POSIX_SPAWN_SETSID 1
@@ -0,0 +1 @@
+#define HAVE_TIOCGWINSZ 1
@@ -0,0 +1 @@
+#define HAVE_DIRENT_D_TYPE 1
@@ -0,0 +1 @@
+#define HAVE_FSYNC 1
@@ -0,0 +1 @@
+#define HAVE_MEMRCHR 1
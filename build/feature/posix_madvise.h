@@ -0,0 +1 @@
+#define HAVE_POSIX_MADVISE 1
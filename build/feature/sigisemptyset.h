@@ -0,0 +1 @@
+#define HAVE_SIGISEMPTYSET 1
@@ -0,0 +1 @@
+#define HAVE_TCGETWINSIZE 0
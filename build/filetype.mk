@@ -0,0 +1,58 @@
+build/filetype.o: src/filetype.c src/filetype.h src/command/error.h \
+ src/util/macros.h src/util/macros.h src/util/ptr-array.h src/util/bit.h \
+ src/util/debug.h src/util/errorcode.h src/util/macros.h \
+ src/util/container.h src/util/xmalloc.h src/util/arith.h \
+ src/util/xstring.h src/util/ascii.h src/util/string-view.h \
+ src/util/xmemrchr.h src/util/string.h src/util/str-util.h \
+ src/util/string-view.h src/util/unicode.h src/command/serialize.h \
+ src/util/string.h src/util/string-view.h src/regexp.h src/util/ascii.h \
+ src/util/bsearch.h src/util/array.h src/util/ptr-array.h \
+ src/util/debug.h src/util/hashset.h src/util/log.h src/util/path.h \
+ src/util/str-util.h src/util/strtonum.h src/util/xmalloc.h \
+ src/util/xmemmem.h src/filetype/names.c src/filetype/basenames.c \
+ src/filetype/directories.c src/filetype/extensions.c \
+ src/filetype/interpreters.c src/filetype/ignored-exts.c \
+ src/filetype/signatures.c
+src/filetype.h:
+src/command/error.h:
+src/util/macros.h:
+src/util/macros.h:
+src/util/ptr-array.h:
+src/util/bit.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/macros.h:
+src/util/container.h:
+src/util/xmalloc.h:
+src/util/arith.h:
+src/util/xstring.h:
+src/util/ascii.h:
+src/util/string-view.h:
+src/util/xmemrchr.h:
+src/util/string.h:
+src/util/str-util.h:
+src/util/string-view.h:
+src/util/unicode.h:
+src/command/serialize.h:
+src/util/string.h:
+src/util/string-view.h:
+src/regexp.h:
+src/util/ascii.h:
+src/util/bsearch.h:
+src/util/array.h:
+src/util/ptr-array.h:
+src/util/debug.h:
+src/util/hashset.h:
+src/util/log.h:
+src/util/path.h:
+src/util/str-util.h:
+src/util/strtonum.h:
+src/util/xmalloc.h:
+src/util/xmemmem.h:
+src/filetype/names.c:
+src/filetype/basenames.c:
+src/filetype/directories.c:
+src/filetype/extensions.c:
+src/filetype/interpreters.c:
+src/filetype/ignored-exts.c:
+src/filetype/signatures.c:
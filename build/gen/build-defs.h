@@ -0,0 +1,17 @@
+#define _GNU_SOURCE
+#define HAVE_DUP3 1
+#define HAVE_EMBED 0
+#define HAVE_PIPE2 1
+#define HAVE_FSYNC 1
+#define HAVE_MEMMEM 1
+#define HAVE_MEMRCHR 1
+#define HAVE_MKOSTEMP 1
+#define HAVE_SIGISEMPTYSET 1
+#define HAVE_DIRENT_D_TYPE 1
+#define HAVE_TIOCGWINSZ 1
+#define HAVE_TIOCNOTTY 1
+#define HAVE_TCGETWINSIZE 0
+#define HAVE_POSIX_MADVISE 1
+#define HAVE_QSORT_R 1
+#define HAVE_POSIX_SPAWN 1
+#define HAVE_POSIX_SPAWN_SETSID 1
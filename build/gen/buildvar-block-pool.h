@@ -0,0 +1 @@
+#define BLOCK_POOL_DISABLE 0
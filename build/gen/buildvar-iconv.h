@@ -0,0 +1 @@
+#define ICONV_DISABLE 0
@@ -0,0 +1,482 @@
+CONFIG_SECTION static const char builtin_rc[] = {
+    #embed "config/rc"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_extra[] = {
+    #embed "config/extra"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_binding_default[] = {
+    #embed "config/binding/default"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_compiler_gcc[] = {
+    #embed "config/compiler/gcc"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_compiler_go[] = {
+    #embed "config/compiler/go"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_color_reset[] = {
+    #embed "config/color/reset"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_color_default[] = {
+    #embed "config/color/default"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_color_darkgray[] = {
+    #embed "config/color/darkgray"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_color_nocolor[] = {
+    #embed "config/color/nocolor"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_script_fzf_sh[] = {
+    #embed "config/script/fzf.sh"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_script_git_changes_sh[] = {
+    #embed "config/script/git-changes.sh"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_script_help_sh[] = {
+    #embed "config/script/help.sh"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_script_lf_wrapper_sh[] = {
+    #embed "config/script/lf-wrapper.sh"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_script_longest_line_awk[] = {
+    #embed "config/script/longest-line.awk"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_script_msgs_sh[] = {
+    #embed "config/script/msgs.sh"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_script_open_c_header_sh[] = {
+    #embed "config/script/open-c-header.sh"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_script_paste_sh[] = {
+    #embed "config/script/paste.sh"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_script_ranger_wrapper_sh[] = {
+    #embed "config/script/ranger-wrapper.sh"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_script_xtag_sh[] = {
+    #embed "config/script/xtag.sh"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_awk[] = {
+    #embed "config/syntax/awk"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_c[] = {
+    #embed "config/syntax/c"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_coccinelle[] = {
+    #embed "config/syntax/coccinelle"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_config[] = {
+    #embed "config/syntax/config"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_config_ntc[] = {
+    #embed "config/syntax/config-ntc"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_css[] = {
+    #embed "config/syntax/css"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_ctags[] = {
+    #embed "config/syntax/ctags"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_d[] = {
+    #embed "config/syntax/d"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_diff[] = {
+    #embed "config/syntax/diff"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_docker[] = {
+    #embed "config/syntax/docker"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_dte[] = {
+    #embed "config/syntax/dte"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_gcode[] = {
+    #embed "config/syntax/gcode"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_gitblame[] = {
+    #embed "config/syntax/gitblame"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_gitcommit[] = {
+    #embed "config/syntax/gitcommit"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_gitignore[] = {
+    #embed "config/syntax/gitignore"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_gitlog[] = {
+    #embed "config/syntax/gitlog"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_gitnote[] = {
+    #embed "config/syntax/gitnote"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_gitrebase[] = {
+    #embed "config/syntax/gitrebase"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_gitstash[] = {
+    #embed "config/syntax/gitstash"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_go[] = {
+    #embed "config/syntax/go"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_gomod[] = {
+    #embed "config/syntax/gomod"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_hare[] = {
+    #embed "config/syntax/hare"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_haskell[] = {
+    #embed "config/syntax/haskell"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_html[] = {
+    #embed "config/syntax/html"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_ini[] = {
+    #embed "config/syntax/ini"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_java[] = {
+    #embed "config/syntax/java"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_javascript[] = {
+    #embed "config/syntax/javascript"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_json[] = {
+    #embed "config/syntax/json"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_jsonc[] = {
+    #embed "config/syntax/jsonc"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_lisp[] = {
+    #embed "config/syntax/lisp"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_lrc[] = {
+    #embed "config/syntax/lrc"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_lua[] = {
+    #embed "config/syntax/lua"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_mail[] = {
+    #embed "config/syntax/mail"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_make[] = {
+    #embed "config/syntax/make"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_man[] = {
+    #embed "config/syntax/man"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_markdown[] = {
+    #embed "config/syntax/markdown"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_meson[] = {
+    #embed "config/syntax/meson"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_nftables[] = {
+    #embed "config/syntax/nftables"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_nginx[] = {
+    #embed "config/syntax/nginx"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_ninja[] = {
+    #embed "config/syntax/ninja"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_php[] = {
+    #embed "config/syntax/php"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_python[] = {
+    #embed "config/syntax/python"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_robotstxt[] = {
+    #embed "config/syntax/robotstxt"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_roff[] = {
+    #embed "config/syntax/roff"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_ruby[] = {
+    #embed "config/syntax/ruby"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_scheme[] = {
+    #embed "config/syntax/scheme"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_sed[] = {
+    #embed "config/syntax/sed"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_sh[] = {
+    #embed "config/syntax/sh"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_sql[] = {
+    #embed "config/syntax/sql"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_tex[] = {
+    #embed "config/syntax/tex"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_texmfcnf[] = {
+    #embed "config/syntax/texmfcnf"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_tmux[] = {
+    #embed "config/syntax/tmux"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_vala[] = {
+    #embed "config/syntax/vala"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_weechatlog[] = {
+    #embed "config/syntax/weechatlog"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_xml[] = {
+    #embed "config/syntax/xml"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_xresources[] = {
+    #embed "config/syntax/xresources"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_zig[] = {
+    #embed "config/syntax/zig"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_inc_c_comment[] = {
+    #embed "config/syntax/inc/c-comment"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_inc_c_uchar[] = {
+    #embed "config/syntax/inc/c-uchar"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_inc_diff[] = {
+    #embed "config/syntax/inc/diff"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_syntax_inc_json_num[] = {
+    #embed "config/syntax/inc/json-num"
+    , '\0'
+};
+
+CONFIG_SECTION static const BuiltinConfig builtin_configs[] = {
+    CFG("rc", builtin_rc),
+    CFG("extra", builtin_extra),
+    CFG("binding/default", builtin_binding_default),
+    CFG("compiler/gcc", builtin_compiler_gcc),
+    CFG("compiler/go", builtin_compiler_go),
+    CFG("color/reset", builtin_color_reset),
+    CFG("color/default", builtin_color_default),
+    CFG("color/darkgray", builtin_color_darkgray),
+    CFG("color/nocolor", builtin_color_nocolor),
+    CFG("script/fzf.sh", builtin_script_fzf_sh),
+    CFG("script/git-changes.sh", builtin_script_git_changes_sh),
+    CFG("script/help.sh", builtin_script_help_sh),
+    CFG("script/lf-wrapper.sh", builtin_script_lf_wrapper_sh),
+    CFG("script/longest-line.awk", builtin_script_longest_line_awk),
+    CFG("script/msgs.sh", builtin_script_msgs_sh),
+    CFG("script/open-c-header.sh", builtin_script_open_c_header_sh),
+    CFG("script/paste.sh", builtin_script_paste_sh),
+    CFG("script/ranger-wrapper.sh", builtin_script_ranger_wrapper_sh),
+    CFG("script/xtag.sh", builtin_script_xtag_sh),
+    CFG("syntax/awk", builtin_syntax_awk),
+    CFG("syntax/c", builtin_syntax_c),
+    CFG("syntax/coccinelle", builtin_syntax_coccinelle),
+    CFG("syntax/config", builtin_syntax_config),
+    CFG("syntax/config-ntc", builtin_syntax_config_ntc),
+    CFG("syntax/css", builtin_syntax_css),
+    CFG("syntax/ctags", builtin_syntax_ctags),
+    CFG("syntax/d", builtin_syntax_d),
+    CFG("syntax/diff", builtin_syntax_diff),
+    CFG("syntax/docker", builtin_syntax_docker),
+    CFG("syntax/dte", builtin_syntax_dte),
+    CFG("syntax/gcode", builtin_syntax_gcode),
+    CFG("syntax/gitblame", builtin_syntax_gitblame),
+    CFG("syntax/gitcommit", builtin_syntax_gitcommit),
+    CFG("syntax/gitignore", builtin_syntax_gitignore),
+    CFG("syntax/gitlog", builtin_syntax_gitlog),
+    CFG("syntax/gitnote", builtin_syntax_gitnote),
+    CFG("syntax/gitrebase", builtin_syntax_gitrebase),
+    CFG("syntax/gitstash", builtin_syntax_gitstash),
+    CFG("syntax/go", builtin_syntax_go),
+    CFG("syntax/gomod", builtin_syntax_gomod),
+    CFG("syntax/hare", builtin_syntax_hare),
+    CFG("syntax/haskell", builtin_syntax_haskell),
+    CFG("syntax/html", builtin_syntax_html),
+    CFG("syntax/ini", builtin_syntax_ini),
+    CFG("syntax/java", builtin_syntax_java),
+    CFG("syntax/javascript", builtin_syntax_javascript),
+    CFG("syntax/json", builtin_syntax_json),
+    CFG("syntax/jsonc", builtin_syntax_jsonc),
+    CFG("syntax/lisp", builtin_syntax_lisp),
+    CFG("syntax/lrc", builtin_syntax_lrc),
+    CFG("syntax/lua", builtin_syntax_lua),
+    CFG("syntax/mail", builtin_syntax_mail),
+    CFG("syntax/make", builtin_syntax_make),
+    CFG("syntax/man", builtin_syntax_man),
+    CFG("syntax/markdown", builtin_syntax_markdown),
+    CFG("syntax/meson", builtin_syntax_meson),
+    CFG("syntax/nftables", builtin_syntax_nftables),
+    CFG("syntax/nginx", builtin_syntax_nginx),
+    CFG("syntax/ninja", builtin_syntax_ninja),
+    CFG("syntax/php", builtin_syntax_php),
+    CFG("syntax/python", builtin_syntax_python),
+    CFG("syntax/robotstxt", builtin_syntax_robotstxt),
+    CFG("syntax/roff", builtin_syntax_roff),
+    CFG("syntax/ruby", builtin_syntax_ruby),
+    CFG("syntax/scheme", builtin_syntax_scheme),
+    CFG("syntax/sed", builtin_syntax_sed),
+    CFG("syntax/sh", builtin_syntax_sh),
+    CFG("syntax/sql", builtin_syntax_sql),
+    CFG("syntax/tex", builtin_syntax_tex),
+    CFG("syntax/texmfcnf", builtin_syntax_texmfcnf),
+    CFG("syntax/tmux", builtin_syntax_tmux),
+    CFG("syntax/vala", builtin_syntax_vala),
+    CFG("syntax/weechatlog", builtin_syntax_weechatlog),
+    CFG("syntax/xml", builtin_syntax_xml),
+    CFG("syntax/xresources", builtin_syntax_xresources),
+    CFG("syntax/zig", builtin_syntax_zig),
+    CFG("syntax/inc/c-comment", builtin_syntax_inc_c_comment),
+    CFG("syntax/inc/c-uchar", builtin_syntax_inc_c_uchar),
+    CFG("syntax/inc/diff", builtin_syntax_inc_diff),
+    CFG("syntax/inc/json-num", builtin_syntax_inc_json_num),
+};
@@ -0,0 +1 @@
+build/gen/builtin-config.h: config/rc config/extra config/binding/default config/compiler/gcc config/compiler/go config/color/reset config/color/default config/color/darkgray config/color/nocolor config/script/fzf.sh config/script/git-changes.sh config/script/help.sh config/script/lf-wrapper.sh config/script/longest-line.awk config/script/msgs.sh config/script/open-c-header.sh config/script/paste.sh config/script/ranger-wrapper.sh config/script/xtag.sh config/syntax/awk config/syntax/c config/syntax/coccinelle config/syntax/config config/syntax/config-ntc config/syntax/css config/syntax/ctags config/syntax/d config/syntax/diff config/syntax/docker config/syntax/dte config/syntax/gcode config/syntax/gitblame config/syntax/gitcommit config/syntax/gitignore config/syntax/gitlog config/syntax/gitnote config/syntax/gitrebase config/syntax/gitstash config/syntax/go config/syntax/gomod config/syntax/hare config/syntax/haskell config/syntax/html config/syntax/ini config/syntax/java config/syntax/javascript config/syntax/json config/syntax/jsonc config/syntax/lisp config/syntax/lrc config/syntax/lua config/syntax/mail config/syntax/make config/syntax/man config/syntax/markdown config/syntax/meson config/syntax/nftables config/syntax/nginx config/syntax/ninja config/syntax/php config/syntax/python config/syntax/robotstxt config/syntax/roff config/syntax/ruby config/syntax/scheme config/syntax/sed config/syntax/sh config/syntax/sql config/syntax/tex config/syntax/texmfcnf config/syntax/tmux config/syntax/vala config/syntax/weechatlog config/syntax/xml config/syntax/xresources config/syntax/zig config/syntax/inc/c-comment config/syntax/inc/c-uchar config/syntax/inc/diff config/syntax/inc/json-num
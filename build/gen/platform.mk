@@ -0,0 +1,4 @@
+# Generated by mk/platform.sh; do not edit
+KERNEL = Linux
+NPROC = 1
+XARGS_P = xargs
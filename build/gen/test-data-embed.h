@@ -0,0 +1,116 @@
+CONFIG_SECTION static const char builtin_test_data_env_dterc[] = {
+    #embed "test/data/env.dterc"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_test_data_thai_dterc[] = {
+    #embed "test/data/thai.dterc"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_test_data_crlf_dterc[] = {
+    #embed "test/data/crlf.dterc"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_test_data_insert_dterc[] = {
+    #embed "test/data/insert.dterc"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_test_data_join_dterc[] = {
+    #embed "test/data/join.dterc"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_test_data_change_dterc[] = {
+    #embed "test/data/change.dterc"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_test_data_pipe_dterc[] = {
+    #embed "test/data/pipe.dterc"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_test_data_redo_dterc[] = {
+    #embed "test/data/redo.dterc"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_test_data_replace_dterc[] = {
+    #embed "test/data/replace.dterc"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_test_data_indent_dterc[] = {
+    #embed "test/data/indent.dterc"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_test_data_repeat_dterc[] = {
+    #embed "test/data/repeat.dterc"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_test_data_fuzz1_dterc[] = {
+    #embed "test/data/fuzz1.dterc"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_test_data_fuzz2_dterc[] = {
+    #embed "test/data/fuzz2.dterc"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_test_data_wrap_dterc[] = {
+    #embed "test/data/wrap.dterc"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_test_data_exec_dterc[] = {
+    #embed "test/data/exec.dterc"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_test_data_move_dterc[] = {
+    #embed "test/data/move.dterc"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_test_data_delete_dterc[] = {
+    #embed "test/data/delete.dterc"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_test_data_new_line_dterc[] = {
+    #embed "test/data/new-line.dterc"
+    , '\0'
+};
+
+CONFIG_SECTION static const char builtin_test_data_tag_dterc[] = {
+    #embed "test/data/tag.dterc"
+    , '\0'
+};
+
+CONFIG_SECTION static const BuiltinConfig builtin_configs[] = {
+    CFG("test/data/env.dterc", builtin_test_data_env_dterc),
+    CFG("test/data/thai.dterc", builtin_test_data_thai_dterc),
+    CFG("test/data/crlf.dterc", builtin_test_data_crlf_dterc),
+    CFG("test/data/insert.dterc", builtin_test_data_insert_dterc),
+    CFG("test/data/join.dterc", builtin_test_data_join_dterc),
+    CFG("test/data/change.dterc", builtin_test_data_change_dterc),
+    CFG("test/data/pipe.dterc", builtin_test_data_pipe_dterc),
+    CFG("test/data/redo.dterc", builtin_test_data_redo_dterc),
+    CFG("test/data/replace.dterc", builtin_test_data_replace_dterc),
+    CFG("test/data/indent.dterc", builtin_test_data_indent_dterc),
+    CFG("test/data/repeat.dterc", builtin_test_data_repeat_dterc),
+    CFG("test/data/fuzz1.dterc", builtin_test_data_fuzz1_dterc),
+    CFG("test/data/fuzz2.dterc", builtin_test_data_fuzz2_dterc),
+    CFG("test/data/wrap.dterc", builtin_test_data_wrap_dterc),
+    CFG("test/data/exec.dterc", builtin_test_data_exec_dterc),
+    CFG("test/data/move.dterc", builtin_test_data_move_dterc),
+    CFG("test/data/delete.dterc", builtin_test_data_delete_dterc),
+    CFG("test/data/new-line.dterc", builtin_test_data_new_line_dterc),
+    CFG("test/data/tag.dterc", builtin_test_data_tag_dterc),
+};
@@ -0,0 +1,515 @@
+IGNORE_WARNING("-Woverlength-strings")
+
+CONFIG_SECTION static const char builtin_test_data_env_dterc[] =
+"open\n"
+"setenv z \042__TEST__\134n\042\n"
+"setenv _Z \042...\134n\042\n"
+"setenv test_123 \042123\134n\042\n"
+"setenv 1A \0421A\134n\042\n"
+"insert -m $z\n"
+"insert -m $_Z\n"
+"insert -m $test_123\n"
+"insert -m $non__existent__var___/#\042\134n\042\n"
+"insert -m $1\042\134n\042\n"
+"insert -m $.\042_Z\134n\042\n"
+"insert -m $1A\n"
+"save -f build/test/env.txt\n"
+"setenv z\n"
+"setenv _Z\n"
+"setenv test_123\n"
+"setenv 1A\n"
+"close\n"
+;
+
+CONFIG_SECTION static const char builtin_test_data_thai_dterc[] =
+"alias เปิด open\n"
+"เปิด -e UTF-8\n"
+"insert \042ภาษาไทย\134n\042\n"
+"up\n"
+"copy\n"
+"paste\n"
+"bol\n"
+"delete-eol\n"
+"insert \042Testing\042\n"
+"run -s mkdir -p build/test/\n"
+"save -f -e UTF-8 build/test/thai-utf8.txt\n"
+"save -f -e TIS-620 build/test/thai-tis620.txt\n"
+"close\n"
+;
+
+CONFIG_SECTION static const char builtin_test_data_crlf_dterc[] =
+"open -e UTF-8\n"
+"insert \042line 1\134nline 2\134nline 3\134n\042\n"
+"save -f -d build/test/crlf.txt\n"
+"close\n"
+;
+
+CONFIG_SECTION static const char builtin_test_data_insert_dterc[] =
+"open\n"
+"set -l expand-tab true\n"
+"set -l emulate-tab false\n"
+"set -l auto-indent true\n"
+"set -l indent-width 4\n"
+"set -l tab-width 4\n"
+"set -l overwrite false\n"
+"set -l brace-indent true\n"
+"set -l select-cursor-char true\n"
+"\n"
+"insert -k \042a\134nb\134n\134tc\134n\134td\134ne\042\n"
+"up\n"
+"repeat 3 left\n"
+"insert -k \042\134n\042\n"
+"up\n"
+"insert -k \042\134t\134t\134t\042\n"
+"bol\n"
+"insert -k \042\134n\134t\134t\134t\134n\042\n"
+"\n"
+"eof\n"
+"insert -m \042\134n\042\n"
+"insert -k \042if (1) {\134na();\134nb();\042\n"
+"new-line\n"
+"insert -k \042c();\134n}\042\n"
+"new-line -a\n"
+"insert -k \042d();\042\n"
+"\n"
+"bof\n"
+"new-line -a\n"
+"repeat 8 insert -m .\n"
+"left\n"
+"repeat 3 left -c\n"
+"insert 'xyz'\n"
+"right -c\n"
+"insert -k \042\134n\042\n"
+"\n"
+"save -f build/test/insert.txt\n"
+"close\n"
+;
+
+CONFIG_SECTION static const char builtin_test_data_join_dterc[] =
+"open\n"
+"insert \042a\134nb\134nc\042\n"
+"repeat 2 down -l\n"
+"join\n"
+"\n"
+"down\n"
+"\n"
+"insert \042a\134nb\134nc\042\n"
+"repeat 2 down -l\n"
+"join \042,\042\n"
+"\n"
+"down\n"
+"\n"
+"insert \042a\134nb\134nc\042\n"
+"repeat 2 down -l\n"
+"join \042=>\042\n"
+"\n"
+"down\n"
+"\n"
+"insert \042foo  \134n  bar  \134t\134n baz\134n \134t\134t \134n\134t\134n\134nxyz\042\n"
+"join ''\n"
+"join ::\n"
+"repeat 10 join ++\n"
+"\n"
+"save -f build/test/join.txt\n"
+"close\n"
+;
+
+CONFIG_SECTION static const char builtin_test_data_change_dterc[] =
+"open\n"
+"insert \042test the CHANGE_MERGE_{DELETE,ERASE} conditions in record_delete()\042\n"
+"undo\n"
+"\n"
+"insert \042123456789\134n\042\n"
+"repeat 4 right\n"
+"erase\n"
+"erase\n"
+"delete\n"
+"delete\n"
+"copy\n"
+"undo\n"
+"undo\n"
+"paste\n"
+"\n"
+"save -f build/test/change.txt\n"
+"close -f\n"
+;
+
+CONFIG_SECTION static const char builtin_test_data_pipe_dterc[] =
+"open\n"
+"insert \042pipe-to\134ntest\042\n"
+"pipe-to sh -c 'cat > build/test/pipe-to.txt'\n"
+"close -f\n"
+"\n"
+"open\n"
+"pipe-from sh -c 'printf \042pipe-from\134ntest\134n\042'\n"
+"save -f build/test/pipe-from.txt\n"
+"close -f\n"
+;
+
+CONFIG_SECTION static const char builtin_test_data_redo_dterc[] =
+"open\n"
+"insert -m \042line #1\134n\042\n"
+"insert -m \042line #2\134n\042\n"
+"insert -m \042line #3\134n\042\n"
+"undo\n"
+"undo\n"
+"insert -m \042...\134n\042\n"
+"undo\n"
+"redo 1\n"
+"save -f build/test/redo1.txt\n"
+"undo\n"
+"redo 2\n"
+"save -f build/test/redo2.txt\n"
+"close\n"
+;
+
+CONFIG_SECTION static const char builtin_test_data_replace_dterc[] =
+"open -e UTF-8\n"
+"insert 'AA BB XX YY 11 22'\n"
+"replace -g [A-Z] '&.'\n"
+"replace -g [0-9]\n"
+"replace X _\n"
+"replace 'B\134.(B)\134.' '\1341#'\n"
+"replace ' +$'\n"
+"\n"
+"eof\n"
+"insert -m \042\134nAAA\134nBBB\134nCCC\134nDDD\042\n"
+"repeat 3 up -l\n"
+"replace '([A-Z])$' ':\1341,\1341|&'\n"
+"down\n"
+"up -l\n"
+"replace '([A-Z])$' ' \1341'\n"
+"\n"
+"save -f build/test/replace.txt\n"
+"close\n"
+;
+
+CONFIG_SECTION static const char builtin_test_data_indent_dterc[] =
+"open\n"
+"set -l auto-indent true\n"
+"set -l expand-tab true\n"
+"set -l emulate-tab true\n"
+"set -l indent-width 4\n"
+"insert -k \042line 1\134n\134tline 2\134n\134tline 3\134nline 4\134n\134tline 5\042\n"
+"up -l\n"
+"up -l\n"
+"up -l\n"
+"up -l\n"
+"indent\n"
+"indent 1\n"
+"indent +1\n"
+"indent -r\n"
+"indent -r\n"
+"indent -r 1\n"
+"indent -- -1\n"
+"indent\n"
+"indent\n"
+"save -f build/test/indent.txt\n"
+"close -f\n"
+;
+
+CONFIG_SECTION static const char builtin_test_data_repeat_dterc[] =
+"open\n"
+"repeat 0 insert -m x\n"
+"repeat 1 insert -m y\n"
+"repeat 2 insert -m z\n"
+"repeat 0 insert -m foo\n"
+"repeat 1 insert -m bar\n"
+"repeat 2 insert baz\n"
+"repeat 3 insert -km .\n"
+"repeat 2 insert -k ,\n"
+"repeat 1 insert {}\n"
+"repeat 2050 insert test\n"
+"undo\n"
+"save -f build/test/repeat.txt\n"
+"close\n"
+;
+
+CONFIG_SECTION static const char builtin_test_data_fuzz1_dterc[] =
+"run -s mkdir -p build/test/\n"
+"cd build/test/\n"
+"insert -k \0421\134n2\134n3\134n\042\n"
+"bof\n"
+"bol\n"
+"bolsf\n"
+"case\n"
+"clear\n"
+"copy\n"
+"paste -c\n"
+"cut\n"
+"delete\n"
+"delete-eol\n"
+"delete-word\n"
+"down\n"
+"eof\n"
+"eol\n"
+"eolsf\n"
+"erase\n"
+"erase-bol\n"
+"erase-word\n"
+"filter sort -r\n"
+"ft ext filetype\n"
+"hi default red black bold\n"
+"hi default\n"
+"bof\n"
+"select\n"
+"eof\n"
+"#wrap-paragraph 72\n"
+"join\n"
+"left\n"
+"line 1000\n"
+"msg\n"
+"new-line\n"
+"next\n"
+"paste\n"
+"pgdown\n"
+"pgup\n"
+"prev\n"
+"refresh\n"
+"insert \042hello world\134n\042\n"
+"repeat 2 replace l r\n"
+"right\n"
+"run -s true\n"
+"scroll-down\n"
+"scroll-pgdown\n"
+"scroll-pgup\n"
+"scroll-up\n"
+"search -H '^ *h'\n"
+"search -n\n"
+"search -p\n"
+"select\n"
+"repeat 5 right\n"
+"cut\n"
+"paste -c\n"
+"set syntax true\n"
+"set set-window-title true\n"
+"indent 2\n"
+"clear\n"
+"toggle set-window-title\n"
+"up\n"
+"view 1\n"
+"wflip\n"
+"wnext\n"
+"word-bwd\n"
+"word-fwd\n"
+"wprev\n"
+"wresize\n"
+"wsplit\n"
+"wswap\n"
+"save -f out\n"
+"select\n"
+"pgdown\n"
+"unselect\n"
+"repeat 1000 undo\n"
+"redo\n"
+"undo\n"
+"close\n"
+"wclose\n"
+"repeat 20 open\n"
+"repeat 6 move-tab left\n"
+"repeat 3 move-tab right\n"
+"move-tab 17\n"
+"open -g ../../docs/*\n"
+"cd -\n"
+;
+
+CONFIG_SECTION static const char builtin_test_data_fuzz2_dterc[] =
+"set statusline-left '%f %m %r %y %Y %x %X %p %E %M %N %n %s %t %u %%'\n"
+"toggle auto-indent\n"
+"toggle editorconfig\n"
+"toggle emulate-tab\n"
+"toggle expand-tab\n"
+"toggle file-history\n"
+"toggle fsync\n"
+"toggle syntax\n"
+"toggle brace-indent\n"
+"toggle display-special\n"
+"toggle set-window-title\n"
+"toggle show-line-numbers\n"
+"toggle tab-bar\n"
+"option 'x' syntax true\n"
+"option ',x' syntax true\n"
+"option 'x,y' syntax true\n"
+"option 'x,y,' syntax true\n"
+"option '' syntax true\n"
+"option ',' syntax true\n"
+"option ',-' syntax true\n"
+"option ',,zzz,,zzz,' syntax true\n"
+;
+
+CONFIG_SECTION static const char builtin_test_data_wrap_dterc[] =
+"open\n"
+"\n"
+"repeat 30 insert \042xyz \042\n"
+"wrap-paragraph\n"
+"repeat 2 new-line\n"
+"\n"
+"repeat 30 insert \042xyz \042\n"
+"wrap-paragraph 20\n"
+"\n"
+"save -f build/test/wrap.txt\n"
+"close\n"
+;
+
+CONFIG_SECTION static const char builtin_test_data_exec_dterc[] =
+"open\n"
+"\n"
+"insert abcxyz\n"
+"filter sed 's/[axz]/R/g'\n"
+"pipe-from echo $WORD $WORD\n"
+"\n"
+"eof\n"
+"repeat 3 left\n"
+"pipe-from echo $WORD\n"
+"\n"
+"save -f build/test/exec.txt\n"
+"close\n"
+;
+
+CONFIG_SECTION static const char builtin_test_data_move_dterc[] =
+"open\n"
+"\n"
+"insert \042AAA\134nBBB\134n\134n\134nCCC\134nDDD\134n\042\n"
+"eol\n"
+"blkup\n"
+"insert -m 1\n"
+"blkdown\n"
+"insert -m 2\n"
+"blkdown\n"
+"blkdown\n"
+"insert -m 3\n"
+"blkdown\n"
+"insert -m 4\n"
+"blkup\n"
+"insert -m 5\n"
+"blkup\n"
+"insert -m 6\n"
+"blkdown\n"
+"insert -m 7\n"
+"up\n"
+"\n"
+"insert -m \042\134n\134n\134n\134n\042\n"
+"up\n"
+"blkup\n"
+"blkdown\n"
+"insert -m 8\n"
+"blkdown\n"
+"insert -m 9\n"
+"blkdown\n"
+"blkdown\n"
+"insert -m 10\n"
+"\n"
+"bof\n"
+"insert \042({{\042\n"
+"eof\n"
+"insert \042}})\042\n"
+"match-bracket\n"
+"insert _\n"
+"bol\n"
+"match-bracket\n"
+"insert ?\n"
+"\n"
+"save -f build/test/move.txt\n"
+"close\n"
+;
+
+CONFIG_SECTION static const char builtin_test_data_delete_dterc[] =
+"open\n"
+"set -l expand-tab true\n"
+"set -l emulate-tab true\n"
+"set -l indent-width 4\n"
+"\n"
+"repeat 3 insert ' 1234567890'\n"
+"delete\n"
+"repeat 2 word-fwd -s\n"
+"delete\n"
+"repeat 3 right\n"
+"repeat 3 right -c\n"
+"delete\n"
+"eol\n"
+"delete\n"
+"bol\n"
+"right\n"
+"delete\n"
+"right\n"
+"right -c\n"
+"delete\n"
+"word-fwd -s\n"
+"repeat 6 right\n"
+"repeat 2 left -c\n"
+"repeat 2 erase\n"
+"\n"
+"eol\n"
+"insert -k \042\134n\134n\134tline1\134nline2\134nline3\042\n"
+"clear\n"
+"insert -k \042\134nline4\134nline5\134nline6\042\n"
+"up\n"
+"up -l\n"
+"clear\n"
+"insert -k ...\n"
+"\n"
+"save -f build/test/delete.txt\n"
+"close\n"
+;
+
+CONFIG_SECTION static const char builtin_test_data_new_line_dterc[] =
+"open\n"
+"\n"
+"insert \042\134t#1\134n\134t\134t#2\134n\042\n"
+"new-line -am\n"
+"insert A1\n"
+"down\n"
+"new-line -m\n"
+"insert B1\n"
+"down\n"
+"new-line -am\n"
+"insert A2\n"
+"down\n"
+"new-line -m\n"
+"insert B2\n"
+"\n"
+"save -f build/test/new-line.txt\n"
+"close\n"
+;
+
+CONFIG_SECTION static const char builtin_test_data_tag_dterc[] =
+"open\n"
+"cd test/data/\n"
+"\n"
+"# This is redundant if the `tag` command finds and jumps to a tag,\n"
+"# but it's here just in case it doesn't\n"
+"bookmark\n"
+"\n"
+"tag c_syntax_test\n"
+"copy\n"
+"tag -r\n"
+"paste\n"
+"\n"
+"cd -\n"
+"save -f build/test/tag.txt\n"
+"close\n"
+;
+
+UNIGNORE_WARNINGS
+
+CONFIG_SECTION static const BuiltinConfig builtin_configs[] = {
+    CFG("test/data/env.dterc", builtin_test_data_env_dterc),
+    CFG("test/data/thai.dterc", builtin_test_data_thai_dterc),
+    CFG("test/data/crlf.dterc", builtin_test_data_crlf_dterc),
+    CFG("test/data/insert.dterc", builtin_test_data_insert_dterc),
+    CFG("test/data/join.dterc", builtin_test_data_join_dterc),
+    CFG("test/data/change.dterc", builtin_test_data_change_dterc),
+    CFG("test/data/pipe.dterc", builtin_test_data_pipe_dterc),
+    CFG("test/data/redo.dterc", builtin_test_data_redo_dterc),
+    CFG("test/data/replace.dterc", builtin_test_data_replace_dterc),
+    CFG("test/data/indent.dterc", builtin_test_data_indent_dterc),
+    CFG("test/data/repeat.dterc", builtin_test_data_repeat_dterc),
+    CFG("test/data/fuzz1.dterc", builtin_test_data_fuzz1_dterc),
+    CFG("test/data/fuzz2.dterc", builtin_test_data_fuzz2_dterc),
+    CFG("test/data/wrap.dterc", builtin_test_data_wrap_dterc),
+    CFG("test/data/exec.dterc", builtin_test_data_exec_dterc),
+    CFG("test/data/move.dterc", builtin_test_data_move_dterc),
+    CFG("test/data/delete.dterc", builtin_test_data_delete_dterc),
+    CFG("test/data/new-line.dterc", builtin_test_data_new_line_dterc),
+    CFG("test/data/tag.dterc", builtin_test_data_tag_dterc),
+};
@@ -0,0 +1 @@
+build/gen/test-data.h: test/data/env.dterc test/data/thai.dterc test/data/crlf.dterc test/data/insert.dterc test/data/join.dterc test/data/change.dterc test/data/pipe.dterc test/data/redo.dterc test/data/replace.dterc test/data/indent.dterc test/data/repeat.dterc test/data/fuzz1.dterc test/data/fuzz2.dterc test/data/wrap.dterc test/data/exec.dterc test/data/move.dterc test/data/delete.dterc test/data/new-line.dterc test/data/tag.dterc
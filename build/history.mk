@@ -0,0 +1,35 @@
+build/history.o: src/history.c src/history.h src/command/error.h \
+ src/util/macros.h src/util/hashmap.h src/util/container.h \
+ src/util/macros.h src/util/debug.h src/util/errorcode.h \
+ src/util/macros.h src/util/string.h src/util/arith.h src/util/bit.h \
+ src/util/str-util.h src/util/string-view.h src/util/ascii.h \
+ src/util/xmemrchr.h src/util/xstring.h src/util/unicode.h \
+ src/util/xmalloc.h src/util/bit.h src/util/debug.h src/util/readfile.h \
+ src/util/str-util.h src/util/xmalloc.h src/util/xstdio.h \
+ src/util/xreadwrite.h
+src/history.h:
+src/command/error.h:
+src/util/macros.h:
+src/util/hashmap.h:
+src/util/container.h:
+src/util/macros.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/macros.h:
+src/util/string.h:
+src/util/arith.h:
+src/util/bit.h:
+src/util/str-util.h:
+src/util/string-view.h:
+src/util/ascii.h:
+src/util/xmemrchr.h:
+src/util/xstring.h:
+src/util/unicode.h:
+src/util/xmalloc.h:
+src/util/bit.h:
+src/util/debug.h:
+src/util/readfile.h:
+src/util/str-util.h:
+src/util/xmalloc.h:
+src/util/xstdio.h:
+src/util/xreadwrite.h:
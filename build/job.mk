@@ -0,0 +1,76 @@
+build/job.o: src/job.c src/job.h src/command/error.h src/util/macros.h \
+ src/msg.h src/bookmark.h src/util/macros.h src/util/ptr-array.h \
+ src/util/bit.h src/util/debug.h src/util/errorcode.h src/util/macros.h \
+ src/util/container.h src/util/xmalloc.h src/util/arith.h \
+ src/util/xstring.h src/util/ascii.h src/util/xmalloc.h src/view.h \
+ src/block-iter.h src/block.h src/util/debug.h src/util/list.h \
+ src/util/string-view.h src/util/xmemrchr.h src/util/string.h \
+ src/util/str-util.h src/util/string-view.h src/util/unicode.h \
+ src/util/unicode.h src/window.h src/buffer.h src/change.h src/lock.h \
+ src/options.h src/regexp.h src/syntax/syntax.h src/command/error.h \
+ src/syntax/bitset.h src/util/debug.h src/syntax/color.h \
+ src/terminal/style.h src/terminal/color.h src/terminal/feature.h \
+ src/util/ptr-array.h src/util/hashmap.h src/util/string.h \
+ src/util/hashset.h src/util/string-view.h src/frame.h src/util/hashmap.h \
+ src/command/serialize.h src/compiler.h src/spawn.h src/util/fork-exec.h \
+ src/util/strtonum.h src/util/time-util.h src/util/log.h \
+ src/util/xreadwrite.h src/util/xsnprintf.h
+src/job.h:
+src/command/error.h:
+src/util/macros.h:
+src/msg.h:
+src/bookmark.h:
+src/util/macros.h:
+src/util/ptr-array.h:
+src/util/bit.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/macros.h:
+src/util/container.h:
+src/util/xmalloc.h:
+src/util/arith.h:
+src/util/xstring.h:
+src/util/ascii.h:
+src/util/xmalloc.h:
+src/view.h:
+src/block-iter.h:
+src/block.h:
+src/util/debug.h:
+src/util/list.h:
+src/util/string-view.h:
+src/util/xmemrchr.h:
+src/util/string.h:
+src/util/str-util.h:
+src/util/string-view.h:
+src/util/unicode.h:
+src/util/unicode.h:
+src/window.h:
+src/buffer.h:
+src/change.h:
+src/lock.h:
+src/options.h:
+src/regexp.h:
+src/syntax/syntax.h:
+src/command/error.h:
+src/syntax/bitset.h:
+src/util/debug.h:
+src/syntax/color.h:
+src/terminal/style.h:
+src/terminal/color.h:
+src/terminal/feature.h:
+src/util/ptr-array.h:
+src/util/hashmap.h:
+src/util/string.h:
+src/util/hashset.h:
+src/util/string-view.h:
+src/frame.h:
+src/util/hashmap.h:
+src/command/serialize.h:
+src/compiler.h:
+src/spawn.h:
+src/util/fork-exec.h:
+src/util/strtonum.h:
+src/util/time-util.h:
+src/util/log.h:
+src/util/xreadwrite.h:
+src/util/xsnprintf.h:
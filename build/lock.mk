@@ -0,0 +1,33 @@
+build/lock.o: src/lock.c src/lock.h src/command/error.h src/util/macros.h \
+ src/util/macros.h src/util/debug.h src/util/errorcode.h \
+ src/util/macros.h src/util/log.h src/util/debug.h src/util/path.h \
+ src/util/string-view.h src/util/ascii.h src/util/xmemrchr.h \
+ src/util/xstring.h src/util/xmalloc.h src/util/arith.h \
+ src/util/readfile.h src/util/str-util.h src/util/string-view.h \
+ src/util/strtonum.h src/util/time-util.h src/util/log.h \
+ src/util/xmalloc.h src/util/xreadwrite.h src/util/xsnprintf.h
+src/lock.h:
+src/command/error.h:
+src/util/macros.h:
+src/util/macros.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/macros.h:
+src/util/log.h:
+src/util/debug.h:
+src/util/path.h:
+src/util/string-view.h:
+src/util/ascii.h:
+src/util/xmemrchr.h:
+src/util/xstring.h:
+src/util/xmalloc.h:
+src/util/arith.h:
+src/util/readfile.h:
+src/util/str-util.h:
+src/util/string-view.h:
+src/util/strtonum.h:
+src/util/time-util.h:
+src/util/log.h:
+src/util/xmalloc.h:
+src/util/xreadwrite.h:
+src/util/xsnprintf.h:
@@ -0,0 +1,5 @@
+build/palette.o: src/palette.c src/palette.h src/util/exitcode.h \
+ src/util/macros.h
+src/palette.h:
+src/util/exitcode.h:
+src/util/macros.h:
@@ -0,0 +1,76 @@
+build/status.o: src/status.c src/status.h src/mode.h src/command/run.h \
+ src/command/error.h src/util/macros.h src/util/string-view.h \
+ src/util/ascii.h src/util/macros.h src/util/debug.h src/util/errorcode.h \
+ src/util/xmemrchr.h src/util/xstring.h src/terminal/key.h \
+ src/util/hashmap.h src/util/container.h src/util/intmap.h \
+ src/util/macros.h src/util/ptr-array.h src/util/bit.h src/util/xmalloc.h \
+ src/util/arith.h src/util/string.h src/util/str-util.h \
+ src/util/string-view.h src/util/unicode.h src/options.h \
+ src/command/error.h src/regexp.h src/util/string-view.h src/util/debug.h \
+ src/window.h src/buffer.h src/block-iter.h src/block.h src/util/list.h \
+ src/util/unicode.h src/change.h src/view.h src/lock.h \
+ src/syntax/syntax.h src/command/error.h src/syntax/bitset.h \
+ src/util/debug.h src/syntax/color.h src/terminal/style.h \
+ src/terminal/color.h src/terminal/feature.h src/util/ptr-array.h \
+ src/util/hashmap.h src/util/string.h src/util/hashset.h src/frame.h \
+ src/cmdline.h src/history.h src/search.h src/selection.h \
+ src/util/numtostr.h src/util/utf8.h src/util/xsnprintf.h
+src/status.h:
+src/mode.h:
+src/command/run.h:
+src/command/error.h:
+src/util/macros.h:
+src/util/string-view.h:
+src/util/ascii.h:
+src/util/macros.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/xmemrchr.h:
+src/util/xstring.h:
+src/terminal/key.h:
+src/util/hashmap.h:
+src/util/container.h:
+src/util/intmap.h:
+src/util/macros.h:
+src/util/ptr-array.h:
+src/util/bit.h:
+src/util/xmalloc.h:
+src/util/arith.h:
+src/util/string.h:
+src/util/str-util.h:
+src/util/string-view.h:
+src/util/unicode.h:
+src/options.h:
+src/command/error.h:
+src/regexp.h:
+src/util/string-view.h:
+src/util/debug.h:
+src/window.h:
+src/buffer.h:
+src/block-iter.h:
+src/block.h:
+src/util/list.h:
+src/util/unicode.h:
+src/change.h:
+src/view.h:
+src/lock.h:
+src/syntax/syntax.h:
+src/command/error.h:
+src/syntax/bitset.h:
+src/util/debug.h:
+src/syntax/color.h:
+src/terminal/style.h:
+src/terminal/color.h:
+src/terminal/feature.h:
+src/util/ptr-array.h:
+src/util/hashmap.h:
+src/util/string.h:
+src/util/hashset.h:
+src/frame.h:
+src/cmdline.h:
+src/history.h:
+src/search.h:
+src/selection.h:
+src/util/numtostr.h:
+src/util/utf8.h:
+src/util/xsnprintf.h:
@@ -0,0 +1,58 @@
+build/syntax/highlight.o: src/syntax/highlight.c src/syntax/highlight.h \
+ src/block-iter.h src/block.h src/util/debug.h src/util/errorcode.h \
+ src/util/macros.h src/util/list.h src/util/macros.h \
+ src/util/string-view.h src/util/ascii.h src/util/debug.h \
+ src/util/xmemrchr.h src/util/xstring.h src/util/string.h \
+ src/util/arith.h src/util/bit.h src/util/str-util.h \
+ src/util/string-view.h src/util/unicode.h src/util/xmalloc.h \
+ src/util/unicode.h src/syntax/color.h src/terminal/style.h \
+ src/terminal/color.h src/terminal/feature.h src/util/macros.h \
+ src/util/ptr-array.h src/util/container.h src/util/hashmap.h \
+ src/util/string.h src/syntax/syntax.h src/command/error.h \
+ src/syntax/bitset.h src/util/debug.h src/util/hashset.h \
+ src/util/string-view.h src/syntax/merge.h src/util/arith.h \
+ src/util/bit.h src/util/intern.h src/util/hashset.h src/util/xmalloc.h \
+ src/util/xstring.h
+src/syntax/highlight.h:
+src/block-iter.h:
+src/block.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/macros.h:
+src/util/list.h:
+src/util/macros.h:
+src/util/string-view.h:
+src/util/ascii.h:
+src/util/debug.h:
+src/util/xmemrchr.h:
+src/util/xstring.h:
+src/util/string.h:
+src/util/arith.h:
+src/util/bit.h:
+src/util/str-util.h:
+src/util/string-view.h:
+src/util/unicode.h:
+src/util/xmalloc.h:
+src/util/unicode.h:
+src/syntax/color.h:
+src/terminal/style.h:
+src/terminal/color.h:
+src/terminal/feature.h:
+src/util/macros.h:
+src/util/ptr-array.h:
+src/util/container.h:
+src/util/hashmap.h:
+src/util/string.h:
+src/syntax/syntax.h:
+src/command/error.h:
+src/syntax/bitset.h:
+src/util/debug.h:
+src/util/hashset.h:
+src/util/string-view.h:
+src/syntax/merge.h:
+src/util/arith.h:
+src/util/bit.h:
+src/util/intern.h:
+src/util/hashset.h:
+src/util/xmalloc.h:
+src/util/xstring.h:
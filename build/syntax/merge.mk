@@ -0,0 +1,42 @@
+build/syntax/merge.o: src/syntax/merge.c src/syntax/merge.h \
+ src/syntax/color.h src/terminal/style.h src/terminal/color.h \
+ src/terminal/feature.h src/util/macros.h src/util/ptr-array.h \
+ src/util/bit.h src/util/debug.h src/util/errorcode.h src/util/macros.h \
+ src/util/container.h src/util/xmalloc.h src/util/arith.h \
+ src/util/xstring.h src/util/ascii.h src/util/hashmap.h src/util/string.h \
+ src/util/str-util.h src/util/string-view.h src/util/xmemrchr.h \
+ src/util/unicode.h src/syntax/syntax.h src/command/error.h \
+ src/syntax/bitset.h src/util/debug.h src/util/hashset.h \
+ src/util/string-view.h src/util/numtostr.h src/util/xmalloc.h \
+ src/util/xstring.h
+src/syntax/merge.h:
+src/syntax/color.h:
+src/terminal/style.h:
+src/terminal/color.h:
+src/terminal/feature.h:
+src/util/macros.h:
+src/util/ptr-array.h:
+src/util/bit.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/macros.h:
+src/util/container.h:
+src/util/xmalloc.h:
+src/util/arith.h:
+src/util/xstring.h:
+src/util/ascii.h:
+src/util/hashmap.h:
+src/util/string.h:
+src/util/str-util.h:
+src/util/string-view.h:
+src/util/xmemrchr.h:
+src/util/unicode.h:
+src/syntax/syntax.h:
+src/command/error.h:
+src/syntax/bitset.h:
+src/util/debug.h:
+src/util/hashset.h:
+src/util/string-view.h:
+src/util/numtostr.h:
+src/util/xmalloc.h:
+src/util/xstring.h:
@@ -0,0 +1,17 @@
+build/terminal/color.o: src/terminal/color.c src/terminal/color.h \
+ src/terminal/feature.h src/util/macros.h src/util/debug.h \
+ src/util/errorcode.h src/util/macros.h src/util/strtonum.h \
+ src/util/string-view.h src/util/ascii.h src/util/debug.h \
+ src/util/xmemrchr.h src/util/xstring.h
+src/terminal/color.h:
+src/terminal/feature.h:
+src/util/macros.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/macros.h:
+src/util/strtonum.h:
+src/util/string-view.h:
+src/util/ascii.h:
+src/util/debug.h:
+src/util/xmemrchr.h:
+src/util/xstring.h:
@@ -0,0 +1,36 @@
+build/terminal/cursor.o: src/terminal/cursor.c src/terminal/cursor.h \
+ src/terminal/color.h src/terminal/feature.h src/util/macros.h \
+ src/terminal/terminal.h src/terminal/key.h src/terminal/style.h \
+ src/terminal/color.h src/util/ptr-array.h src/util/bit.h \
+ src/util/debug.h src/util/errorcode.h src/util/macros.h \
+ src/util/container.h src/util/xmalloc.h src/util/arith.h \
+ src/util/xstring.h src/util/ascii.h src/util/string.h \
+ src/util/str-util.h src/util/string-view.h src/util/xmemrchr.h \
+ src/util/unicode.h src/util/array.h src/util/ptr-array.h \
+ src/util/debug.h
+src/terminal/cursor.h:
+src/terminal/color.h:
+src/terminal/feature.h:
+src/util/macros.h:
+src/terminal/terminal.h:
+src/terminal/key.h:
+src/terminal/style.h:
+src/terminal/color.h:
+src/util/ptr-array.h:
+src/util/bit.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/macros.h:
+src/util/container.h:
+src/util/xmalloc.h:
+src/util/arith.h:
+src/util/xstring.h:
+src/util/ascii.h:
+src/util/string.h:
+src/util/str-util.h:
+src/util/string-view.h:
+src/util/xmemrchr.h:
+src/util/unicode.h:
+src/util/array.h:
+src/util/ptr-array.h:
+src/util/debug.h:
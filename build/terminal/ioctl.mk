@@ -0,0 +1,6 @@
+build/terminal/ioctl.o: src/terminal/ioctl.c build/gen/build-defs.h \
+ src/terminal/ioctl.h src/util/errorcode.h src/util/macros.h
+build/gen/build-defs.h:
+src/terminal/ioctl.h:
+src/util/errorcode.h:
+src/util/macros.h:
@@ -0,0 +1,8 @@
+build/terminal/mode.o: src/terminal/mode.c src/terminal/mode.h \
+ src/util/macros.h src/util/debug.h src/util/errorcode.h \
+ src/util/macros.h
+src/terminal/mode.h:
+src/util/macros.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/macros.h:
@@ -0,0 +1,67 @@
+build/terminal/output.o: src/terminal/output.c src/terminal/output.h \
+ src/terminal/color.h src/terminal/feature.h src/util/macros.h \
+ src/terminal/key.h src/terminal/style.h src/util/ptr-array.h \
+ src/util/bit.h src/util/debug.h src/util/errorcode.h src/util/macros.h \
+ src/util/container.h src/util/xmalloc.h src/util/arith.h \
+ src/util/xstring.h src/util/ascii.h src/terminal/terminal.h \
+ src/util/string.h src/util/str-util.h src/util/string-view.h \
+ src/util/xmemrchr.h src/util/unicode.h src/util/unicode.h \
+ src/terminal/cursor.h src/terminal/color.h src/terminal/terminal.h \
+ src/indent.h src/block-iter.h src/block.h src/util/debug.h \
+ src/util/list.h src/util/macros.h src/util/string-view.h \
+ src/util/string.h src/util/unicode.h src/options.h src/command/error.h \
+ src/regexp.h src/util/ptr-array.h src/util/bit.h src/view.h \
+ src/options.h src/util/ascii.h src/util/bit.h src/util/debug.h \
+ src/util/log.h src/util/numtostr.h src/util/str-util.h src/util/utf8.h \
+ src/util/xmalloc.h src/util/xreadwrite.h
+src/terminal/output.h:
+src/terminal/color.h:
+src/terminal/feature.h:
+src/util/macros.h:
+src/terminal/key.h:
+src/terminal/style.h:
+src/util/ptr-array.h:
+src/util/bit.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/macros.h:
+src/util/container.h:
+src/util/xmalloc.h:
+src/util/arith.h:
+src/util/xstring.h:
+src/util/ascii.h:
+src/terminal/terminal.h:
+src/util/string.h:
+src/util/str-util.h:
+src/util/string-view.h:
+src/util/xmemrchr.h:
+src/util/unicode.h:
+src/util/unicode.h:
+src/terminal/cursor.h:
+src/terminal/color.h:
+src/terminal/terminal.h:
+src/indent.h:
+src/block-iter.h:
+src/block.h:
+src/util/debug.h:
+src/util/list.h:
+src/util/macros.h:
+src/util/string-view.h:
+src/util/string.h:
+src/util/unicode.h:
+src/options.h:
+src/command/error.h:
+src/regexp.h:
+src/util/ptr-array.h:
+src/util/bit.h:
+src/view.h:
+src/options.h:
+src/util/ascii.h:
+src/util/bit.h:
+src/util/debug.h:
+src/util/log.h:
+src/util/numtostr.h:
+src/util/str-util.h:
+src/util/utf8.h:
+src/util/xmalloc.h:
+src/util/xreadwrite.h:
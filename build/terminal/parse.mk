@@ -0,0 +1,21 @@
+build/terminal/parse.o: src/terminal/parse.c src/terminal/parse.h \
+ src/terminal/key.h src/util/macros.h src/terminal/query.h \
+ src/util/string-view.h src/util/ascii.h src/util/macros.h \
+ src/util/debug.h src/util/errorcode.h src/util/xmemrchr.h \
+ src/util/xstring.h src/util/ascii.h src/util/debug.h src/util/log.h \
+ src/util/unicode.h
+src/terminal/parse.h:
+src/terminal/key.h:
+src/util/macros.h:
+src/terminal/query.h:
+src/util/string-view.h:
+src/util/ascii.h:
+src/util/macros.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/xmemrchr.h:
+src/util/xstring.h:
+src/util/ascii.h:
+src/util/debug.h:
+src/util/log.h:
+src/util/unicode.h:
@@ -0,0 +1,41 @@
+build/terminal/query.o: src/terminal/query.c src/terminal/query.h \
+ src/terminal/key.h src/util/macros.h src/terminal/parse.h \
+ src/util/string-view.h src/util/ascii.h src/util/macros.h \
+ src/util/debug.h src/util/errorcode.h src/util/xmemrchr.h \
+ src/util/xstring.h src/terminal/cursor.h src/terminal/color.h \
+ src/terminal/feature.h src/terminal/terminal.h src/terminal/style.h \
+ src/terminal/color.h src/util/ptr-array.h src/util/bit.h \
+ src/util/container.h src/util/xmalloc.h src/util/arith.h \
+ src/util/string.h src/util/str-util.h src/util/string-view.h \
+ src/util/unicode.h src/util/log.h src/util/str-util.h \
+ src/util/strtonum.h src/util/utf8.h
+src/terminal/query.h:
+src/terminal/key.h:
+src/util/macros.h:
+src/terminal/parse.h:
+src/util/string-view.h:
+src/util/ascii.h:
+src/util/macros.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/xmemrchr.h:
+src/util/xstring.h:
+src/terminal/cursor.h:
+src/terminal/color.h:
+src/terminal/feature.h:
+src/terminal/terminal.h:
+src/terminal/style.h:
+src/terminal/color.h:
+src/util/ptr-array.h:
+src/util/bit.h:
+src/util/container.h:
+src/util/xmalloc.h:
+src/util/arith.h:
+src/util/string.h:
+src/util/str-util.h:
+src/util/string-view.h:
+src/util/unicode.h:
+src/util/log.h:
+src/util/str-util.h:
+src/util/strtonum.h:
+src/util/utf8.h:
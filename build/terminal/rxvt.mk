@@ -0,0 +1,6 @@
+build/terminal/rxvt.o: src/terminal/rxvt.c src/terminal/parse.h \
+ src/terminal/key.h src/util/macros.h src/terminal/rxvt.h
+src/terminal/parse.h:
+src/terminal/key.h:
+src/util/macros.h:
+src/terminal/rxvt.h:
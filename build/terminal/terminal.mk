@@ -0,0 +1,33 @@
+build/terminal/terminal.o: src/terminal/terminal.c \
+ src/terminal/terminal.h src/terminal/feature.h src/util/macros.h \
+ src/terminal/key.h src/terminal/style.h src/terminal/color.h \
+ src/util/ptr-array.h src/util/bit.h src/util/debug.h \
+ src/util/errorcode.h src/util/macros.h src/util/container.h \
+ src/util/xmalloc.h src/util/arith.h src/util/xstring.h src/util/ascii.h \
+ src/util/string.h src/util/str-util.h src/util/string-view.h \
+ src/util/xmemrchr.h src/util/unicode.h src/terminal/output.h \
+ src/util/unicode.h src/terminal/parse.h
+src/terminal/terminal.h:
+src/terminal/feature.h:
+src/util/macros.h:
+src/terminal/key.h:
+src/terminal/style.h:
+src/terminal/color.h:
+src/util/ptr-array.h:
+src/util/bit.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/macros.h:
+src/util/container.h:
+src/util/xmalloc.h:
+src/util/arith.h:
+src/util/xstring.h:
+src/util/ascii.h:
+src/util/string.h:
+src/util/str-util.h:
+src/util/string-view.h:
+src/util/xmemrchr.h:
+src/util/unicode.h:
+src/terminal/output.h:
+src/util/unicode.h:
+src/terminal/parse.h:
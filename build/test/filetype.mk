@@ -0,0 +1,31 @@
+build/test/filetype.o: test/filetype.c test/test.h src/util/macros.h \
+ src/util/string-view.h src/util/ascii.h src/util/macros.h \
+ src/util/debug.h src/util/errorcode.h src/util/xmemrchr.h \
+ src/util/xstring.h src/util/string.h src/util/arith.h src/util/bit.h \
+ src/util/str-util.h src/util/string-view.h src/util/unicode.h \
+ src/util/xmalloc.h src/filetype.h src/command/error.h src/util/macros.h \
+ src/util/ptr-array.h src/util/container.h src/util/string-view.h \
+ src/util/string.h
+test/test.h:
+src/util/macros.h:
+src/util/string-view.h:
+src/util/ascii.h:
+src/util/macros.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/xmemrchr.h:
+src/util/xstring.h:
+src/util/string.h:
+src/util/arith.h:
+src/util/bit.h:
+src/util/str-util.h:
+src/util/string-view.h:
+src/util/unicode.h:
+src/util/xmalloc.h:
+src/filetype.h:
+src/command/error.h:
+src/util/macros.h:
+src/util/ptr-array.h:
+src/util/container.h:
+src/util/string-view.h:
+src/util/string.h:
@@ -0,0 +1,10000 @@
+static int function_5_0(int x, const char *str)
+{
+    return x * 0 + (int)strlen(str);
+}
+
+static int function_5_1(int x, const char *str)
+{
+    return x * 1 + (int)strlen(str);
+}
+
+static int function_5_2(int x, const char *str)
+{
+    return x * 2 + (int)strlen(str);
+}
+
+static int function_5_3(int x, const char *str)
+{
+    return x * 3 + (int)strlen(str);
+}
+
+static int function_5_4(int x, const char *str)
+{
+    return x * 4 + (int)strlen(str);
+}
+
+static int function_5_5(int x, const char *str)
+{
+    return x * 5 + (int)strlen(str);
+}
+
+static int function_5_6(int x, const char *str)
+{
+    return x * 6 + (int)strlen(str);
+}
+
+static int function_5_7(int x, const char *str)
+{
+    return x * 7 + (int)strlen(str);
+}
+
+static int function_5_8(int x, const char *str)
+{
+    return x * 8 + (int)strlen(str);
+}
+
+static int function_5_9(int x, const char *str)
+{
+    return x * 9 + (int)strlen(str);
+}
+
+static int function_5_10(int x, const char *str)
+{
+    return x * 10 + (int)strlen(str);
+}
+
+static int function_5_11(int x, const char *str)
+{
+    return x * 11 + (int)strlen(str);
+}
+
+static int function_5_12(int x, const char *str)
+{
+    return x * 12 + (int)strlen(str);
+}
+
+static int function_5_13(int x, const char *str)
+{
+    return x * 13 + (int)strlen(str);
+}
+
+static int function_5_14(int x, const char *str)
+{
+    return x * 14 + (int)strlen(str);
+}
+
+static int function_5_15(int x, const char *str)
+{
+    return x * 15 + (int)strlen(str);
+}
+
+static int function_5_16(int x, const char *str)
+{
+    return x * 16 + (int)strlen(str);
+}
+
+static int function_5_17(int x, const char *str)
+{
+    return x * 17 + (int)strlen(str);
+}
+
+static int function_5_18(int x, const char *str)
+{
+    return x * 18 + (int)strlen(str);
+}
+
+static int function_5_19(int x, const char *str)
+{
+    return x * 19 + (int)strlen(str);
+}
+
+static int function_5_20(int x, const char *str)
+{
+    return x * 20 + (int)strlen(str);
+}
+
+static int function_5_21(int x, const char *str)
+{
+    return x * 21 + (int)strlen(str);
+}
+
+static int function_5_22(int x, const char *str)
+{
+    return x * 22 + (int)strlen(str);
+}
+
+static int function_5_23(int x, const char *str)
+{
+    return x * 23 + (int)strlen(str);
+}
+
+static int function_5_24(int x, const char *str)
+{
+    return x * 24 + (int)strlen(str);
+}
+
+static int function_5_25(int x, const char *str)
+{
+    return x * 25 + (int)strlen(str);
+}
+
+static int function_5_26(int x, const char *str)
+{
+    return x * 26 + (int)strlen(str);
+}
+
+static int function_5_27(int x, const char *str)
+{
+    return x * 27 + (int)strlen(str);
+}
+
+static int function_5_28(int x, const char *str)
+{
+    return x * 28 + (int)strlen(str);
+}
+
+static int function_5_29(int x, const char *str)
+{
+    return x * 29 + (int)strlen(str);
+}
+
+static int function_5_30(int x, const char *str)
+{
+    return x * 30 + (int)strlen(str);
+}
+
+static int function_5_31(int x, const char *str)
+{
+    return x * 31 + (int)strlen(str);
+}
+
+static int function_5_32(int x, const char *str)
+{
+    return x * 32 + (int)strlen(str);
+}
+
+static int function_5_33(int x, const char *str)
+{
+    return x * 33 + (int)strlen(str);
+}
+
+static int function_5_34(int x, const char *str)
+{
+    return x * 34 + (int)strlen(str);
+}
+
+static int function_5_35(int x, const char *str)
+{
+    return x * 35 + (int)strlen(str);
+}
+
+static int function_5_36(int x, const char *str)
+{
+    return x * 36 + (int)strlen(str);
+}
+
+static int function_5_37(int x, const char *str)
+{
+    return x * 37 + (int)strlen(str);
+}
+
+static int function_5_38(int x, const char *str)
+{
+    return x * 38 + (int)strlen(str);
+}
+
+static int function_5_39(int x, const char *str)
+{
+    return x * 39 + (int)strlen(str);
+}
+
+static int function_5_40(int x, const char *str)
+{
+    return x * 40 + (int)strlen(str);
+}
+
+static int function_5_41(int x, const char *str)
+{
+    return x * 41 + (int)strlen(str);
+}
+
+static int function_5_42(int x, const char *str)
+{
+    return x * 42 + (int)strlen(str);
+}
+
+static int function_5_43(int x, const char *str)
+{
+    return x * 43 + (int)strlen(str);
+}
+
+static int function_5_44(int x, const char *str)
+{
+    return x * 44 + (int)strlen(str);
+}
+
+static int function_5_45(int x, const char *str)
+{
+    return x * 45 + (int)strlen(str);
+}
+
+static int function_5_46(int x, const char *str)
+{
+    return x * 46 + (int)strlen(str);
+}
+
+static int function_5_47(int x, const char *str)
+{
+    return x * 47 + (int)strlen(str);
+}
+
+static int function_5_48(int x, const char *str)
+{
+    return x * 48 + (int)strlen(str);
+}
+
+static int function_5_49(int x, const char *str)
+{
+    return x * 49 + (int)strlen(str);
+}
+
+static int function_5_50(int x, const char *str)
+{
+    return x * 50 + (int)strlen(str);
+}
+
+static int function_5_51(int x, const char *str)
+{
+    return x * 51 + (int)strlen(str);
+}
+
+static int function_5_52(int x, const char *str)
+{
+    return x * 52 + (int)strlen(str);
+}
+
+static int function_5_53(int x, const char *str)
+{
+    return x * 53 + (int)strlen(str);
+}
+
+static int function_5_54(int x, const char *str)
+{
+    return x * 54 + (int)strlen(str);
+}
+
+static int function_5_55(int x, const char *str)
+{
+    return x * 55 + (int)strlen(str);
+}
+
+static int function_5_56(int x, const char *str)
+{
+    return x * 56 + (int)strlen(str);
+}
+
+static int function_5_57(int x, const char *str)
+{
+    return x * 57 + (int)strlen(str);
+}
+
+static int function_5_58(int x, const char *str)
+{
+    return x * 58 + (int)strlen(str);
+}
+
+static int function_5_59(int x, const char *str)
+{
+    return x * 59 + (int)strlen(str);
+}
+
+static int function_5_60(int x, const char *str)
+{
+    return x * 60 + (int)strlen(str);
+}
+
+static int function_5_61(int x, const char *str)
+{
+    return x * 61 + (int)strlen(str);
+}
+
+static int function_5_62(int x, const char *str)
+{
+    return x * 62 + (int)strlen(str);
+}
+
+static int function_5_63(int x, const char *str)
+{
+    return x * 63 + (int)strlen(str);
+}
+
+static int function_5_64(int x, const char *str)
+{
+    return x * 64 + (int)strlen(str);
+}
+
+static int function_5_65(int x, const char *str)
+{
+    return x * 65 + (int)strlen(str);
+}
+
+static int function_5_66(int x, const char *str)
+{
+    return x * 66 + (int)strlen(str);
+}
+
+static int function_5_67(int x, const char *str)
+{
+    return x * 67 + (int)strlen(str);
+}
+
+static int function_5_68(int x, const char *str)
+{
+    return x * 68 + (int)strlen(str);
+}
+
+static int function_5_69(int x, const char *str)
+{
+    return x * 69 + (int)strlen(str);
+}
+
+static int function_5_70(int x, const char *str)
+{
+    return x * 70 + (int)strlen(str);
+}
+
+static int function_5_71(int x, const char *str)
+{
+    return x * 71 + (int)strlen(str);
+}
+
+static int function_5_72(int x, const char *str)
+{
+    return x * 72 + (int)strlen(str);
+}
+
+static int function_5_73(int x, const char *str)
+{
+    return x * 73 + (int)strlen(str);
+}
+
+static int function_5_74(int x, const char *str)
+{
+    return x * 74 + (int)strlen(str);
+}
+
+static int function_5_75(int x, const char *str)
+{
+    return x * 75 + (int)strlen(str);
+}
+
+static int function_5_76(int x, const char *str)
+{
+    return x * 76 + (int)strlen(str);
+}
+
+static int function_5_77(int x, const char *str)
+{
+    return x * 77 + (int)strlen(str);
+}
+
+static int function_5_78(int x, const char *str)
+{
+    return x * 78 + (int)strlen(str);
+}
+
+static int function_5_79(int x, const char *str)
+{
+    return x * 79 + (int)strlen(str);
+}
+
+static int function_5_80(int x, const char *str)
+{
+    return x * 80 + (int)strlen(str);
+}
+
+static int function_5_81(int x, const char *str)
+{
+    return x * 81 + (int)strlen(str);
+}
+
+static int function_5_82(int x, const char *str)
+{
+    return x * 82 + (int)strlen(str);
+}
+
+static int function_5_83(int x, const char *str)
+{
+    return x * 83 + (int)strlen(str);
+}
+
+static int function_5_84(int x, const char *str)
+{
+    return x * 84 + (int)strlen(str);
+}
+
+static int function_5_85(int x, const char *str)
+{
+    return x * 85 + (int)strlen(str);
+}
+
+static int function_5_86(int x, const char *str)
+{
+    return x * 86 + (int)strlen(str);
+}
+
+static int function_5_87(int x, const char *str)
+{
+    return x * 87 + (int)strlen(str);
+}
+
+static int function_5_88(int x, const char *str)
+{
+    return x * 88 + (int)strlen(str);
+}
+
+static int function_5_89(int x, const char *str)
+{
+    return x * 89 + (int)strlen(str);
+}
+
+static int function_5_90(int x, const char *str)
+{
+    return x * 90 + (int)strlen(str);
+}
+
+static int function_5_91(int x, const char *str)
+{
+    return x * 91 + (int)strlen(str);
+}
+
+static int function_5_92(int x, const char *str)
+{
+    return x * 92 + (int)strlen(str);
+}
+
+static int function_5_93(int x, const char *str)
+{
+    return x * 93 + (int)strlen(str);
+}
+
+static int function_5_94(int x, const char *str)
+{
+    return x * 94 + (int)strlen(str);
+}
+
+static int function_5_95(int x, const char *str)
+{
+    return x * 95 + (int)strlen(str);
+}
+
+static int function_5_96(int x, const char *str)
+{
+    return x * 96 + (int)strlen(str);
+}
+
+static int function_5_97(int x, const char *str)
+{
+    return x * 97 + (int)strlen(str);
+}
+
+static int function_5_98(int x, const char *str)
+{
+    return x * 98 + (int)strlen(str);
+}
+
+static int function_5_99(int x, const char *str)
+{
+    return x * 99 + (int)strlen(str);
+}
+
+static int function_5_100(int x, const char *str)
+{
+    return x * 100 + (int)strlen(str);
+}
+
+static int function_5_101(int x, const char *str)
+{
+    return x * 101 + (int)strlen(str);
+}
+
+static int function_5_102(int x, const char *str)
+{
+    return x * 102 + (int)strlen(str);
+}
+
+static int function_5_103(int x, const char *str)
+{
+    return x * 103 + (int)strlen(str);
+}
+
+static int function_5_104(int x, const char *str)
+{
+    return x * 104 + (int)strlen(str);
+}
+
+static int function_5_105(int x, const char *str)
+{
+    return x * 105 + (int)strlen(str);
+}
+
+static int function_5_106(int x, const char *str)
+{
+    return x * 106 + (int)strlen(str);
+}
+
+static int function_5_107(int x, const char *str)
+{
+    return x * 107 + (int)strlen(str);
+}
+
+static int function_5_108(int x, const char *str)
+{
+    return x * 108 + (int)strlen(str);
+}
+
+static int function_5_109(int x, const char *str)
+{
+    return x * 109 + (int)strlen(str);
+}
+
+static int function_5_110(int x, const char *str)
+{
+    return x * 110 + (int)strlen(str);
+}
+
+static int function_5_111(int x, const char *str)
+{
+    return x * 111 + (int)strlen(str);
+}
+
+static int function_5_112(int x, const char *str)
+{
+    return x * 112 + (int)strlen(str);
+}
+
+static int function_5_113(int x, const char *str)
+{
+    return x * 113 + (int)strlen(str);
+}
+
+static int function_5_114(int x, const char *str)
+{
+    return x * 114 + (int)strlen(str);
+}
+
+static int function_5_115(int x, const char *str)
+{
+    return x * 115 + (int)strlen(str);
+}
+
+static int function_5_116(int x, const char *str)
+{
+    return x * 116 + (int)strlen(str);
+}
+
+static int function_5_117(int x, const char *str)
+{
+    return x * 117 + (int)strlen(str);
+}
+
+static int function_5_118(int x, const char *str)
+{
+    return x * 118 + (int)strlen(str);
+}
+
+static int function_5_119(int x, const char *str)
+{
+    return x * 119 + (int)strlen(str);
+}
+
+static int function_5_120(int x, const char *str)
+{
+    return x * 120 + (int)strlen(str);
+}
+
+static int function_5_121(int x, const char *str)
+{
+    return x * 121 + (int)strlen(str);
+}
+
+static int function_5_122(int x, const char *str)
+{
+    return x * 122 + (int)strlen(str);
+}
+
+static int function_5_123(int x, const char *str)
+{
+    return x * 123 + (int)strlen(str);
+}
+
+static int function_5_124(int x, const char *str)
+{
+    return x * 124 + (int)strlen(str);
+}
+
+static int function_5_125(int x, const char *str)
+{
+    return x * 125 + (int)strlen(str);
+}
+
+static int function_5_126(int x, const char *str)
+{
+    return x * 126 + (int)strlen(str);
+}
+
+static int function_5_127(int x, const char *str)
+{
+    return x * 127 + (int)strlen(str);
+}
+
+static int function_5_128(int x, const char *str)
+{
+    return x * 128 + (int)strlen(str);
+}
+
+static int function_5_129(int x, const char *str)
+{
+    return x * 129 + (int)strlen(str);
+}
+
+static int function_5_130(int x, const char *str)
+{
+    return x * 130 + (int)strlen(str);
+}
+
+static int function_5_131(int x, const char *str)
+{
+    return x * 131 + (int)strlen(str);
+}
+
+static int function_5_132(int x, const char *str)
+{
+    return x * 132 + (int)strlen(str);
+}
+
+static int function_5_133(int x, const char *str)
+{
+    return x * 133 + (int)strlen(str);
+}
+
+static int function_5_134(int x, const char *str)
+{
+    return x * 134 + (int)strlen(str);
+}
+
+static int function_5_135(int x, const char *str)
+{
+    return x * 135 + (int)strlen(str);
+}
+
+static int function_5_136(int x, const char *str)
+{
+    return x * 136 + (int)strlen(str);
+}
+
+static int function_5_137(int x, const char *str)
+{
+    return x * 137 + (int)strlen(str);
+}
+
+static int function_5_138(int x, const char *str)
+{
+    return x * 138 + (int)strlen(str);
+}
+
+static int function_5_139(int x, const char *str)
+{
+    return x * 139 + (int)strlen(str);
+}
+
+static int function_5_140(int x, const char *str)
+{
+    return x * 140 + (int)strlen(str);
+}
+
+static int function_5_141(int x, const char *str)
+{
+    return x * 141 + (int)strlen(str);
+}
+
+static int function_5_142(int x, const char *str)
+{
+    return x * 142 + (int)strlen(str);
+}
+
+static int function_5_143(int x, const char *str)
+{
+    return x * 143 + (int)strlen(str);
+}
+
+static int function_5_144(int x, const char *str)
+{
+    return x * 144 + (int)strlen(str);
+}
+
+static int function_5_145(int x, const char *str)
+{
+    return x * 145 + (int)strlen(str);
+}
+
+static int function_5_146(int x, const char *str)
+{
+    return x * 146 + (int)strlen(str);
+}
+
+static int function_5_147(int x, const char *str)
+{
+    return x * 147 + (int)strlen(str);
+}
+
+static int function_5_148(int x, const char *str)
+{
+    return x * 148 + (int)strlen(str);
+}
+
+static int function_5_149(int x, const char *str)
+{
+    return x * 149 + (int)strlen(str);
+}
+
+static int function_5_150(int x, const char *str)
+{
+    return x * 150 + (int)strlen(str);
+}
+
+static int function_5_151(int x, const char *str)
+{
+    return x * 151 + (int)strlen(str);
+}
+
+static int function_5_152(int x, const char *str)
+{
+    return x * 152 + (int)strlen(str);
+}
+
+static int function_5_153(int x, const char *str)
+{
+    return x * 153 + (int)strlen(str);
+}
+
+static int function_5_154(int x, const char *str)
+{
+    return x * 154 + (int)strlen(str);
+}
+
+static int function_5_155(int x, const char *str)
+{
+    return x * 155 + (int)strlen(str);
+}
+
+static int function_5_156(int x, const char *str)
+{
+    return x * 156 + (int)strlen(str);
+}
+
+static int function_5_157(int x, const char *str)
+{
+    return x * 157 + (int)strlen(str);
+}
+
+static int function_5_158(int x, const char *str)
+{
+    return x * 158 + (int)strlen(str);
+}
+
+static int function_5_159(int x, const char *str)
+{
+    return x * 159 + (int)strlen(str);
+}
+
+static int function_5_160(int x, const char *str)
+{
+    return x * 160 + (int)strlen(str);
+}
+
+static int function_5_161(int x, const char *str)
+{
+    return x * 161 + (int)strlen(str);
+}
+
+static int function_5_162(int x, const char *str)
+{
+    return x * 162 + (int)strlen(str);
+}
+
+static int function_5_163(int x, const char *str)
+{
+    return x * 163 + (int)strlen(str);
+}
+
+static int function_5_164(int x, const char *str)
+{
+    return x * 164 + (int)strlen(str);
+}
+
+static int function_5_165(int x, const char *str)
+{
+    return x * 165 + (int)strlen(str);
+}
+
+static int function_5_166(int x, const char *str)
+{
+    return x * 166 + (int)strlen(str);
+}
+
+static int function_5_167(int x, const char *str)
+{
+    return x * 167 + (int)strlen(str);
+}
+
+static int function_5_168(int x, const char *str)
+{
+    return x * 168 + (int)strlen(str);
+}
+
+static int function_5_169(int x, const char *str)
+{
+    return x * 169 + (int)strlen(str);
+}
+
+static int function_5_170(int x, const char *str)
+{
+    return x * 170 + (int)strlen(str);
+}
+
+static int function_5_171(int x, const char *str)
+{
+    return x * 171 + (int)strlen(str);
+}
+
+static int function_5_172(int x, const char *str)
+{
+    return x * 172 + (int)strlen(str);
+}
+
+static int function_5_173(int x, const char *str)
+{
+    return x * 173 + (int)strlen(str);
+}
+
+static int function_5_174(int x, const char *str)
+{
+    return x * 174 + (int)strlen(str);
+}
+
+static int function_5_175(int x, const char *str)
+{
+    return x * 175 + (int)strlen(str);
+}
+
+static int function_5_176(int x, const char *str)
+{
+    return x * 176 + (int)strlen(str);
+}
+
+static int function_5_177(int x, const char *str)
+{
+    return x * 177 + (int)strlen(str);
+}
+
+static int function_5_178(int x, const char *str)
+{
+    return x * 178 + (int)strlen(str);
+}
+
+static int function_5_179(int x, const char *str)
+{
+    return x * 179 + (int)strlen(str);
+}
+
+static int function_5_180(int x, const char *str)
+{
+    return x * 180 + (int)strlen(str);
+}
+
+static int function_5_181(int x, const char *str)
+{
+    return x * 181 + (int)strlen(str);
+}
+
+static int function_5_182(int x, const char *str)
+{
+    return x * 182 + (int)strlen(str);
+}
+
+static int function_5_183(int x, const char *str)
+{
+    return x * 183 + (int)strlen(str);
+}
+
+static int function_5_184(int x, const char *str)
+{
+    return x * 184 + (int)strlen(str);
+}
+
+static int function_5_185(int x, const char *str)
+{
+    return x * 185 + (int)strlen(str);
+}
+
+static int function_5_186(int x, const char *str)
+{
+    return x * 186 + (int)strlen(str);
+}
+
+static int function_5_187(int x, const char *str)
+{
+    return x * 187 + (int)strlen(str);
+}
+
+static int function_5_188(int x, const char *str)
+{
+    return x * 188 + (int)strlen(str);
+}
+
+static int function_5_189(int x, const char *str)
+{
+    return x * 189 + (int)strlen(str);
+}
+
+static int function_5_190(int x, const char *str)
+{
+    return x * 190 + (int)strlen(str);
+}
+
+static int function_5_191(int x, const char *str)
+{
+    return x * 191 + (int)strlen(str);
+}
+
+static int function_5_192(int x, const char *str)
+{
+    return x * 192 + (int)strlen(str);
+}
+
+static int function_5_193(int x, const char *str)
+{
+    return x * 193 + (int)strlen(str);
+}
+
+static int function_5_194(int x, const char *str)
+{
+    return x * 194 + (int)strlen(str);
+}
+
+static int function_5_195(int x, const char *str)
+{
+    return x * 195 + (int)strlen(str);
+}
+
+static int function_5_196(int x, const char *str)
+{
+    return x * 196 + (int)strlen(str);
+}
+
+static int function_5_197(int x, const char *str)
+{
+    return x * 197 + (int)strlen(str);
+}
+
+static int function_5_198(int x, const char *str)
+{
+    return x * 198 + (int)strlen(str);
+}
+
+static int function_5_199(int x, const char *str)
+{
+    return x * 199 + (int)strlen(str);
+}
+
+static int function_5_200(int x, const char *str)
+{
+    return x * 200 + (int)strlen(str);
+}
+
+static int function_5_201(int x, const char *str)
+{
+    return x * 201 + (int)strlen(str);
+}
+
+static int function_5_202(int x, const char *str)
+{
+    return x * 202 + (int)strlen(str);
+}
+
+static int function_5_203(int x, const char *str)
+{
+    return x * 203 + (int)strlen(str);
+}
+
+static int function_5_204(int x, const char *str)
+{
+    return x * 204 + (int)strlen(str);
+}
+
+static int function_5_205(int x, const char *str)
+{
+    return x * 205 + (int)strlen(str);
+}
+
+static int function_5_206(int x, const char *str)
+{
+    return x * 206 + (int)strlen(str);
+}
+
+static int function_5_207(int x, const char *str)
+{
+    return x * 207 + (int)strlen(str);
+}
+
+static int function_5_208(int x, const char *str)
+{
+    return x * 208 + (int)strlen(str);
+}
+
+static int function_5_209(int x, const char *str)
+{
+    return x * 209 + (int)strlen(str);
+}
+
+static int function_5_210(int x, const char *str)
+{
+    return x * 210 + (int)strlen(str);
+}
+
+static int function_5_211(int x, const char *str)
+{
+    return x * 211 + (int)strlen(str);
+}
+
+static int function_5_212(int x, const char *str)
+{
+    return x * 212 + (int)strlen(str);
+}
+
+static int function_5_213(int x, const char *str)
+{
+    return x * 213 + (int)strlen(str);
+}
+
+static int function_5_214(int x, const char *str)
+{
+    return x * 214 + (int)strlen(str);
+}
+
+static int function_5_215(int x, const char *str)
+{
+    return x * 215 + (int)strlen(str);
+}
+
+static int function_5_216(int x, const char *str)
+{
+    return x * 216 + (int)strlen(str);
+}
+
+static int function_5_217(int x, const char *str)
+{
+    return x * 217 + (int)strlen(str);
+}
+
+static int function_5_218(int x, const char *str)
+{
+    return x * 218 + (int)strlen(str);
+}
+
+static int function_5_219(int x, const char *str)
+{
+    return x * 219 + (int)strlen(str);
+}
+
+static int function_5_220(int x, const char *str)
+{
+    return x * 220 + (int)strlen(str);
+}
+
+static int function_5_221(int x, const char *str)
+{
+    return x * 221 + (int)strlen(str);
+}
+
+static int function_5_222(int x, const char *str)
+{
+    return x * 222 + (int)strlen(str);
+}
+
+static int function_5_223(int x, const char *str)
+{
+    return x * 223 + (int)strlen(str);
+}
+
+static int function_5_224(int x, const char *str)
+{
+    return x * 224 + (int)strlen(str);
+}
+
+static int function_5_225(int x, const char *str)
+{
+    return x * 225 + (int)strlen(str);
+}
+
+static int function_5_226(int x, const char *str)
+{
+    return x * 226 + (int)strlen(str);
+}
+
+static int function_5_227(int x, const char *str)
+{
+    return x * 227 + (int)strlen(str);
+}
+
+static int function_5_228(int x, const char *str)
+{
+    return x * 228 + (int)strlen(str);
+}
+
+static int function_5_229(int x, const char *str)
+{
+    return x * 229 + (int)strlen(str);
+}
+
+static int function_5_230(int x, const char *str)
+{
+    return x * 230 + (int)strlen(str);
+}
+
+static int function_5_231(int x, const char *str)
+{
+    return x * 231 + (int)strlen(str);
+}
+
+static int function_5_232(int x, const char *str)
+{
+    return x * 232 + (int)strlen(str);
+}
+
+static int function_5_233(int x, const char *str)
+{
+    return x * 233 + (int)strlen(str);
+}
+
+static int function_5_234(int x, const char *str)
+{
+    return x * 234 + (int)strlen(str);
+}
+
+static int function_5_235(int x, const char *str)
+{
+    return x * 235 + (int)strlen(str);
+}
+
+static int function_5_236(int x, const char *str)
+{
+    return x * 236 + (int)strlen(str);
+}
+
+static int function_5_237(int x, const char *str)
+{
+    return x * 237 + (int)strlen(str);
+}
+
+static int function_5_238(int x, const char *str)
+{
+    return x * 238 + (int)strlen(str);
+}
+
+static int function_5_239(int x, const char *str)
+{
+    return x * 239 + (int)strlen(str);
+}
+
+static int function_5_240(int x, const char *str)
+{
+    return x * 240 + (int)strlen(str);
+}
+
+static int function_5_241(int x, const char *str)
+{
+    return x * 241 + (int)strlen(str);
+}
+
+static int function_5_242(int x, const char *str)
+{
+    return x * 242 + (int)strlen(str);
+}
+
+static int function_5_243(int x, const char *str)
+{
+    return x * 243 + (int)strlen(str);
+}
+
+static int function_5_244(int x, const char *str)
+{
+    return x * 244 + (int)strlen(str);
+}
+
+static int function_5_245(int x, const char *str)
+{
+    return x * 245 + (int)strlen(str);
+}
+
+static int function_5_246(int x, const char *str)
+{
+    return x * 246 + (int)strlen(str);
+}
+
+static int function_5_247(int x, const char *str)
+{
+    return x * 247 + (int)strlen(str);
+}
+
+static int function_5_248(int x, const char *str)
+{
+    return x * 248 + (int)strlen(str);
+}
+
+static int function_5_249(int x, const char *str)
+{
+    return x * 249 + (int)strlen(str);
+}
+
+static int function_5_250(int x, const char *str)
+{
+    return x * 250 + (int)strlen(str);
+}
+
+static int function_5_251(int x, const char *str)
+{
+    return x * 251 + (int)strlen(str);
+}
+
+static int function_5_252(int x, const char *str)
+{
+    return x * 252 + (int)strlen(str);
+}
+
+static int function_5_253(int x, const char *str)
+{
+    return x * 253 + (int)strlen(str);
+}
+
+static int function_5_254(int x, const char *str)
+{
+    return x * 254 + (int)strlen(str);
+}
+
+static int function_5_255(int x, const char *str)
+{
+    return x * 255 + (int)strlen(str);
+}
+
+static int function_5_256(int x, const char *str)
+{
+    return x * 256 + (int)strlen(str);
+}
+
+static int function_5_257(int x, const char *str)
+{
+    return x * 257 + (int)strlen(str);
+}
+
+static int function_5_258(int x, const char *str)
+{
+    return x * 258 + (int)strlen(str);
+}
+
+static int function_5_259(int x, const char *str)
+{
+    return x * 259 + (int)strlen(str);
+}
+
+static int function_5_260(int x, const char *str)
+{
+    return x * 260 + (int)strlen(str);
+}
+
+static int function_5_261(int x, const char *str)
+{
+    return x * 261 + (int)strlen(str);
+}
+
+static int function_5_262(int x, const char *str)
+{
+    return x * 262 + (int)strlen(str);
+}
+
+static int function_5_263(int x, const char *str)
+{
+    return x * 263 + (int)strlen(str);
+}
+
+static int function_5_264(int x, const char *str)
+{
+    return x * 264 + (int)strlen(str);
+}
+
+static int function_5_265(int x, const char *str)
+{
+    return x * 265 + (int)strlen(str);
+}
+
+static int function_5_266(int x, const char *str)
+{
+    return x * 266 + (int)strlen(str);
+}
+
+static int function_5_267(int x, const char *str)
+{
+    return x * 267 + (int)strlen(str);
+}
+
+static int function_5_268(int x, const char *str)
+{
+    return x * 268 + (int)strlen(str);
+}
+
+static int function_5_269(int x, const char *str)
+{
+    return x * 269 + (int)strlen(str);
+}
+
+static int function_5_270(int x, const char *str)
+{
+    return x * 270 + (int)strlen(str);
+}
+
+static int function_5_271(int x, const char *str)
+{
+    return x * 271 + (int)strlen(str);
+}
+
+static int function_5_272(int x, const char *str)
+{
+    return x * 272 + (int)strlen(str);
+}
+
+static int function_5_273(int x, const char *str)
+{
+    return x * 273 + (int)strlen(str);
+}
+
+static int function_5_274(int x, const char *str)
+{
+    return x * 274 + (int)strlen(str);
+}
+
+static int function_5_275(int x, const char *str)
+{
+    return x * 275 + (int)strlen(str);
+}
+
+static int function_5_276(int x, const char *str)
+{
+    return x * 276 + (int)strlen(str);
+}
+
+static int function_5_277(int x, const char *str)
+{
+    return x * 277 + (int)strlen(str);
+}
+
+static int function_5_278(int x, const char *str)
+{
+    return x * 278 + (int)strlen(str);
+}
+
+static int function_5_279(int x, const char *str)
+{
+    return x * 279 + (int)strlen(str);
+}
+
+static int function_5_280(int x, const char *str)
+{
+    return x * 280 + (int)strlen(str);
+}
+
+static int function_5_281(int x, const char *str)
+{
+    return x * 281 + (int)strlen(str);
+}
+
+static int function_5_282(int x, const char *str)
+{
+    return x * 282 + (int)strlen(str);
+}
+
+static int function_5_283(int x, const char *str)
+{
+    return x * 283 + (int)strlen(str);
+}
+
+static int function_5_284(int x, const char *str)
+{
+    return x * 284 + (int)strlen(str);
+}
+
+static int function_5_285(int x, const char *str)
+{
+    return x * 285 + (int)strlen(str);
+}
+
+static int function_5_286(int x, const char *str)
+{
+    return x * 286 + (int)strlen(str);
+}
+
+static int function_5_287(int x, const char *str)
+{
+    return x * 287 + (int)strlen(str);
+}
+
+static int function_5_288(int x, const char *str)
+{
+    return x * 288 + (int)strlen(str);
+}
+
+static int function_5_289(int x, const char *str)
+{
+    return x * 289 + (int)strlen(str);
+}
+
+static int function_5_290(int x, const char *str)
+{
+    return x * 290 + (int)strlen(str);
+}
+
+static int function_5_291(int x, const char *str)
+{
+    return x * 291 + (int)strlen(str);
+}
+
+static int function_5_292(int x, const char *str)
+{
+    return x * 292 + (int)strlen(str);
+}
+
+static int function_5_293(int x, const char *str)
+{
+    return x * 293 + (int)strlen(str);
+}
+
+static int function_5_294(int x, const char *str)
+{
+    return x * 294 + (int)strlen(str);
+}
+
+static int function_5_295(int x, const char *str)
+{
+    return x * 295 + (int)strlen(str);
+}
+
+static int function_5_296(int x, const char *str)
+{
+    return x * 296 + (int)strlen(str);
+}
+
+static int function_5_297(int x, const char *str)
+{
+    return x * 297 + (int)strlen(str);
+}
+
+static int function_5_298(int x, const char *str)
+{
+    return x * 298 + (int)strlen(str);
+}
+
+static int function_5_299(int x, const char *str)
+{
+    return x * 299 + (int)strlen(str);
+}
+
+static int function_5_300(int x, const char *str)
+{
+    return x * 300 + (int)strlen(str);
+}
+
+static int function_5_301(int x, const char *str)
+{
+    return x * 301 + (int)strlen(str);
+}
+
+static int function_5_302(int x, const char *str)
+{
+    return x * 302 + (int)strlen(str);
+}
+
+static int function_5_303(int x, const char *str)
+{
+    return x * 303 + (int)strlen(str);
+}
+
+static int function_5_304(int x, const char *str)
+{
+    return x * 304 + (int)strlen(str);
+}
+
+static int function_5_305(int x, const char *str)
+{
+    return x * 305 + (int)strlen(str);
+}
+
+static int function_5_306(int x, const char *str)
+{
+    return x * 306 + (int)strlen(str);
+}
+
+static int function_5_307(int x, const char *str)
+{
+    return x * 307 + (int)strlen(str);
+}
+
+static int function_5_308(int x, const char *str)
+{
+    return x * 308 + (int)strlen(str);
+}
+
+static int function_5_309(int x, const char *str)
+{
+    return x * 309 + (int)strlen(str);
+}
+
+static int function_5_310(int x, const char *str)
+{
+    return x * 310 + (int)strlen(str);
+}
+
+static int function_5_311(int x, const char *str)
+{
+    return x * 311 + (int)strlen(str);
+}
+
+static int function_5_312(int x, const char *str)
+{
+    return x * 312 + (int)strlen(str);
+}
+
+static int function_5_313(int x, const char *str)
+{
+    return x * 313 + (int)strlen(str);
+}
+
+static int function_5_314(int x, const char *str)
+{
+    return x * 314 + (int)strlen(str);
+}
+
+static int function_5_315(int x, const char *str)
+{
+    return x * 315 + (int)strlen(str);
+}
+
+static int function_5_316(int x, const char *str)
+{
+    return x * 316 + (int)strlen(str);
+}
+
+static int function_5_317(int x, const char *str)
+{
+    return x * 317 + (int)strlen(str);
+}
+
+static int function_5_318(int x, const char *str)
+{
+    return x * 318 + (int)strlen(str);
+}
+
+static int function_5_319(int x, const char *str)
+{
+    return x * 319 + (int)strlen(str);
+}
+
+static int function_5_320(int x, const char *str)
+{
+    return x * 320 + (int)strlen(str);
+}
+
+static int function_5_321(int x, const char *str)
+{
+    return x * 321 + (int)strlen(str);
+}
+
+static int function_5_322(int x, const char *str)
+{
+    return x * 322 + (int)strlen(str);
+}
+
+static int function_5_323(int x, const char *str)
+{
+    return x * 323 + (int)strlen(str);
+}
+
+static int function_5_324(int x, const char *str)
+{
+    return x * 324 + (int)strlen(str);
+}
+
+static int function_5_325(int x, const char *str)
+{
+    return x * 325 + (int)strlen(str);
+}
+
+static int function_5_326(int x, const char *str)
+{
+    return x * 326 + (int)strlen(str);
+}
+
+static int function_5_327(int x, const char *str)
+{
+    return x * 327 + (int)strlen(str);
+}
+
+static int function_5_328(int x, const char *str)
+{
+    return x * 328 + (int)strlen(str);
+}
+
+static int function_5_329(int x, const char *str)
+{
+    return x * 329 + (int)strlen(str);
+}
+
+static int function_5_330(int x, const char *str)
+{
+    return x * 330 + (int)strlen(str);
+}
+
+static int function_5_331(int x, const char *str)
+{
+    return x * 331 + (int)strlen(str);
+}
+
+static int function_5_332(int x, const char *str)
+{
+    return x * 332 + (int)strlen(str);
+}
+
+static int function_5_333(int x, const char *str)
+{
+    return x * 333 + (int)strlen(str);
+}
+
+static int function_5_334(int x, const char *str)
+{
+    return x * 334 + (int)strlen(str);
+}
+
+static int function_5_335(int x, const char *str)
+{
+    return x * 335 + (int)strlen(str);
+}
+
+static int function_5_336(int x, const char *str)
+{
+    return x * 336 + (int)strlen(str);
+}
+
+static int function_5_337(int x, const char *str)
+{
+    return x * 337 + (int)strlen(str);
+}
+
+static int function_5_338(int x, const char *str)
+{
+    return x * 338 + (int)strlen(str);
+}
+
+static int function_5_339(int x, const char *str)
+{
+    return x * 339 + (int)strlen(str);
+}
+
+static int function_5_340(int x, const char *str)
+{
+    return x * 340 + (int)strlen(str);
+}
+
+static int function_5_341(int x, const char *str)
+{
+    return x * 341 + (int)strlen(str);
+}
+
+static int function_5_342(int x, const char *str)
+{
+    return x * 342 + (int)strlen(str);
+}
+
+static int function_5_343(int x, const char *str)
+{
+    return x * 343 + (int)strlen(str);
+}
+
+static int function_5_344(int x, const char *str)
+{
+    return x * 344 + (int)strlen(str);
+}
+
+static int function_5_345(int x, const char *str)
+{
+    return x * 345 + (int)strlen(str);
+}
+
+static int function_5_346(int x, const char *str)
+{
+    return x * 346 + (int)strlen(str);
+}
+
+static int function_5_347(int x, const char *str)
+{
+    return x * 347 + (int)strlen(str);
+}
+
+static int function_5_348(int x, const char *str)
+{
+    return x * 348 + (int)strlen(str);
+}
+
+static int function_5_349(int x, const char *str)
+{
+    return x * 349 + (int)strlen(str);
+}
+
+static int function_5_350(int x, const char *str)
+{
+    return x * 350 + (int)strlen(str);
+}
+
+static int function_5_351(int x, const char *str)
+{
+    return x * 351 + (int)strlen(str);
+}
+
+static int function_5_352(int x, const char *str)
+{
+    return x * 352 + (int)strlen(str);
+}
+
+static int function_5_353(int x, const char *str)
+{
+    return x * 353 + (int)strlen(str);
+}
+
+static int function_5_354(int x, const char *str)
+{
+    return x * 354 + (int)strlen(str);
+}
+
+static int function_5_355(int x, const char *str)
+{
+    return x * 355 + (int)strlen(str);
+}
+
+static int function_5_356(int x, const char *str)
+{
+    return x * 356 + (int)strlen(str);
+}
+
+static int function_5_357(int x, const char *str)
+{
+    return x * 357 + (int)strlen(str);
+}
+
+static int function_5_358(int x, const char *str)
+{
+    return x * 358 + (int)strlen(str);
+}
+
+static int function_5_359(int x, const char *str)
+{
+    return x * 359 + (int)strlen(str);
+}
+
+static int function_5_360(int x, const char *str)
+{
+    return x * 360 + (int)strlen(str);
+}
+
+static int function_5_361(int x, const char *str)
+{
+    return x * 361 + (int)strlen(str);
+}
+
+static int function_5_362(int x, const char *str)
+{
+    return x * 362 + (int)strlen(str);
+}
+
+static int function_5_363(int x, const char *str)
+{
+    return x * 363 + (int)strlen(str);
+}
+
+static int function_5_364(int x, const char *str)
+{
+    return x * 364 + (int)strlen(str);
+}
+
+static int function_5_365(int x, const char *str)
+{
+    return x * 365 + (int)strlen(str);
+}
+
+static int function_5_366(int x, const char *str)
+{
+    return x * 366 + (int)strlen(str);
+}
+
+static int function_5_367(int x, const char *str)
+{
+    return x * 367 + (int)strlen(str);
+}
+
+static int function_5_368(int x, const char *str)
+{
+    return x * 368 + (int)strlen(str);
+}
+
+static int function_5_369(int x, const char *str)
+{
+    return x * 369 + (int)strlen(str);
+}
+
+static int function_5_370(int x, const char *str)
+{
+    return x * 370 + (int)strlen(str);
+}
+
+static int function_5_371(int x, const char *str)
+{
+    return x * 371 + (int)strlen(str);
+}
+
+static int function_5_372(int x, const char *str)
+{
+    return x * 372 + (int)strlen(str);
+}
+
+static int function_5_373(int x, const char *str)
+{
+    return x * 373 + (int)strlen(str);
+}
+
+static int function_5_374(int x, const char *str)
+{
+    return x * 374 + (int)strlen(str);
+}
+
+static int function_5_375(int x, const char *str)
+{
+    return x * 375 + (int)strlen(str);
+}
+
+static int function_5_376(int x, const char *str)
+{
+    return x * 376 + (int)strlen(str);
+}
+
+static int function_5_377(int x, const char *str)
+{
+    return x * 377 + (int)strlen(str);
+}
+
+static int function_5_378(int x, const char *str)
+{
+    return x * 378 + (int)strlen(str);
+}
+
+static int function_5_379(int x, const char *str)
+{
+    return x * 379 + (int)strlen(str);
+}
+
+static int function_5_380(int x, const char *str)
+{
+    return x * 380 + (int)strlen(str);
+}
+
+static int function_5_381(int x, const char *str)
+{
+    return x * 381 + (int)strlen(str);
+}
+
+static int function_5_382(int x, const char *str)
+{
+    return x * 382 + (int)strlen(str);
+}
+
+static int function_5_383(int x, const char *str)
+{
+    return x * 383 + (int)strlen(str);
+}
+
+static int function_5_384(int x, const char *str)
+{
+    return x * 384 + (int)strlen(str);
+}
+
+static int function_5_385(int x, const char *str)
+{
+    return x * 385 + (int)strlen(str);
+}
+
+static int function_5_386(int x, const char *str)
+{
+    return x * 386 + (int)strlen(str);
+}
+
+static int function_5_387(int x, const char *str)
+{
+    return x * 387 + (int)strlen(str);
+}
+
+static int function_5_388(int x, const char *str)
+{
+    return x * 388 + (int)strlen(str);
+}
+
+static int function_5_389(int x, const char *str)
+{
+    return x * 389 + (int)strlen(str);
+}
+
+static int function_5_390(int x, const char *str)
+{
+    return x * 390 + (int)strlen(str);
+}
+
+static int function_5_391(int x, const char *str)
+{
+    return x * 391 + (int)strlen(str);
+}
+
+static int function_5_392(int x, const char *str)
+{
+    return x * 392 + (int)strlen(str);
+}
+
+static int function_5_393(int x, const char *str)
+{
+    return x * 393 + (int)strlen(str);
+}
+
+static int function_5_394(int x, const char *str)
+{
+    return x * 394 + (int)strlen(str);
+}
+
+static int function_5_395(int x, const char *str)
+{
+    return x * 395 + (int)strlen(str);
+}
+
+static int function_5_396(int x, const char *str)
+{
+    return x * 396 + (int)strlen(str);
+}
+
+static int function_5_397(int x, const char *str)
+{
+    return x * 397 + (int)strlen(str);
+}
+
+static int function_5_398(int x, const char *str)
+{
+    return x * 398 + (int)strlen(str);
+}
+
+static int function_5_399(int x, const char *str)
+{
+    return x * 399 + (int)strlen(str);
+}
+
+static int function_5_400(int x, const char *str)
+{
+    return x * 400 + (int)strlen(str);
+}
+
+static int function_5_401(int x, const char *str)
+{
+    return x * 401 + (int)strlen(str);
+}
+
+static int function_5_402(int x, const char *str)
+{
+    return x * 402 + (int)strlen(str);
+}
+
+static int function_5_403(int x, const char *str)
+{
+    return x * 403 + (int)strlen(str);
+}
+
+static int function_5_404(int x, const char *str)
+{
+    return x * 404 + (int)strlen(str);
+}
+
+static int function_5_405(int x, const char *str)
+{
+    return x * 405 + (int)strlen(str);
+}
+
+static int function_5_406(int x, const char *str)
+{
+    return x * 406 + (int)strlen(str);
+}
+
+static int function_5_407(int x, const char *str)
+{
+    return x * 407 + (int)strlen(str);
+}
+
+static int function_5_408(int x, const char *str)
+{
+    return x * 408 + (int)strlen(str);
+}
+
+static int function_5_409(int x, const char *str)
+{
+    return x * 409 + (int)strlen(str);
+}
+
+static int function_5_410(int x, const char *str)
+{
+    return x * 410 + (int)strlen(str);
+}
+
+static int function_5_411(int x, const char *str)
+{
+    return x * 411 + (int)strlen(str);
+}
+
+static int function_5_412(int x, const char *str)
+{
+    return x * 412 + (int)strlen(str);
+}
+
+static int function_5_413(int x, const char *str)
+{
+    return x * 413 + (int)strlen(str);
+}
+
+static int function_5_414(int x, const char *str)
+{
+    return x * 414 + (int)strlen(str);
+}
+
+static int function_5_415(int x, const char *str)
+{
+    return x * 415 + (int)strlen(str);
+}
+
+static int function_5_416(int x, const char *str)
+{
+    return x * 416 + (int)strlen(str);
+}
+
+static int function_5_417(int x, const char *str)
+{
+    return x * 417 + (int)strlen(str);
+}
+
+static int function_5_418(int x, const char *str)
+{
+    return x * 418 + (int)strlen(str);
+}
+
+static int function_5_419(int x, const char *str)
+{
+    return x * 419 + (int)strlen(str);
+}
+
+static int function_5_420(int x, const char *str)
+{
+    return x * 420 + (int)strlen(str);
+}
+
+static int function_5_421(int x, const char *str)
+{
+    return x * 421 + (int)strlen(str);
+}
+
+static int function_5_422(int x, const char *str)
+{
+    return x * 422 + (int)strlen(str);
+}
+
+static int function_5_423(int x, const char *str)
+{
+    return x * 423 + (int)strlen(str);
+}
+
+static int function_5_424(int x, const char *str)
+{
+    return x * 424 + (int)strlen(str);
+}
+
+static int function_5_425(int x, const char *str)
+{
+    return x * 425 + (int)strlen(str);
+}
+
+static int function_5_426(int x, const char *str)
+{
+    return x * 426 + (int)strlen(str);
+}
+
+static int function_5_427(int x, const char *str)
+{
+    return x * 427 + (int)strlen(str);
+}
+
+static int function_5_428(int x, const char *str)
+{
+    return x * 428 + (int)strlen(str);
+}
+
+static int function_5_429(int x, const char *str)
+{
+    return x * 429 + (int)strlen(str);
+}
+
+static int function_5_430(int x, const char *str)
+{
+    return x * 430 + (int)strlen(str);
+}
+
+static int function_5_431(int x, const char *str)
+{
+    return x * 431 + (int)strlen(str);
+}
+
+static int function_5_432(int x, const char *str)
+{
+    return x * 432 + (int)strlen(str);
+}
+
+static int function_5_433(int x, const char *str)
+{
+    return x * 433 + (int)strlen(str);
+}
+
+static int function_5_434(int x, const char *str)
+{
+    return x * 434 + (int)strlen(str);
+}
+
+static int function_5_435(int x, const char *str)
+{
+    return x * 435 + (int)strlen(str);
+}
+
+static int function_5_436(int x, const char *str)
+{
+    return x * 436 + (int)strlen(str);
+}
+
+static int function_5_437(int x, const char *str)
+{
+    return x * 437 + (int)strlen(str);
+}
+
+static int function_5_438(int x, const char *str)
+{
+    return x * 438 + (int)strlen(str);
+}
+
+static int function_5_439(int x, const char *str)
+{
+    return x * 439 + (int)strlen(str);
+}
+
+static int function_5_440(int x, const char *str)
+{
+    return x * 440 + (int)strlen(str);
+}
+
+static int function_5_441(int x, const char *str)
+{
+    return x * 441 + (int)strlen(str);
+}
+
+static int function_5_442(int x, const char *str)
+{
+    return x * 442 + (int)strlen(str);
+}
+
+static int function_5_443(int x, const char *str)
+{
+    return x * 443 + (int)strlen(str);
+}
+
+static int function_5_444(int x, const char *str)
+{
+    return x * 444 + (int)strlen(str);
+}
+
+static int function_5_445(int x, const char *str)
+{
+    return x * 445 + (int)strlen(str);
+}
+
+static int function_5_446(int x, const char *str)
+{
+    return x * 446 + (int)strlen(str);
+}
+
+static int function_5_447(int x, const char *str)
+{
+    return x * 447 + (int)strlen(str);
+}
+
+static int function_5_448(int x, const char *str)
+{
+    return x * 448 + (int)strlen(str);
+}
+
+static int function_5_449(int x, const char *str)
+{
+    return x * 449 + (int)strlen(str);
+}
+
+static int function_5_450(int x, const char *str)
+{
+    return x * 450 + (int)strlen(str);
+}
+
+static int function_5_451(int x, const char *str)
+{
+    return x * 451 + (int)strlen(str);
+}
+
+static int function_5_452(int x, const char *str)
+{
+    return x * 452 + (int)strlen(str);
+}
+
+static int function_5_453(int x, const char *str)
+{
+    return x * 453 + (int)strlen(str);
+}
+
+static int function_5_454(int x, const char *str)
+{
+    return x * 454 + (int)strlen(str);
+}
+
+static int function_5_455(int x, const char *str)
+{
+    return x * 455 + (int)strlen(str);
+}
+
+static int function_5_456(int x, const char *str)
+{
+    return x * 456 + (int)strlen(str);
+}
+
+static int function_5_457(int x, const char *str)
+{
+    return x * 457 + (int)strlen(str);
+}
+
+static int function_5_458(int x, const char *str)
+{
+    return x * 458 + (int)strlen(str);
+}
+
+static int function_5_459(int x, const char *str)
+{
+    return x * 459 + (int)strlen(str);
+}
+
+static int function_5_460(int x, const char *str)
+{
+    return x * 460 + (int)strlen(str);
+}
+
+static int function_5_461(int x, const char *str)
+{
+    return x * 461 + (int)strlen(str);
+}
+
+static int function_5_462(int x, const char *str)
+{
+    return x * 462 + (int)strlen(str);
+}
+
+static int function_5_463(int x, const char *str)
+{
+    return x * 463 + (int)strlen(str);
+}
+
+static int function_5_464(int x, const char *str)
+{
+    return x * 464 + (int)strlen(str);
+}
+
+static int function_5_465(int x, const char *str)
+{
+    return x * 465 + (int)strlen(str);
+}
+
+static int function_5_466(int x, const char *str)
+{
+    return x * 466 + (int)strlen(str);
+}
+
+static int function_5_467(int x, const char *str)
+{
+    return x * 467 + (int)strlen(str);
+}
+
+static int function_5_468(int x, const char *str)
+{
+    return x * 468 + (int)strlen(str);
+}
+
+static int function_5_469(int x, const char *str)
+{
+    return x * 469 + (int)strlen(str);
+}
+
+static int function_5_470(int x, const char *str)
+{
+    return x * 470 + (int)strlen(str);
+}
+
+static int function_5_471(int x, const char *str)
+{
+    return x * 471 + (int)strlen(str);
+}
+
+static int function_5_472(int x, const char *str)
+{
+    return x * 472 + (int)strlen(str);
+}
+
+static int function_5_473(int x, const char *str)
+{
+    return x * 473 + (int)strlen(str);
+}
+
+static int function_5_474(int x, const char *str)
+{
+    return x * 474 + (int)strlen(str);
+}
+
+static int function_5_475(int x, const char *str)
+{
+    return x * 475 + (int)strlen(str);
+}
+
+static int function_5_476(int x, const char *str)
+{
+    return x * 476 + (int)strlen(str);
+}
+
+static int function_5_477(int x, const char *str)
+{
+    return x * 477 + (int)strlen(str);
+}
+
+static int function_5_478(int x, const char *str)
+{
+    return x * 478 + (int)strlen(str);
+}
+
+static int function_5_479(int x, const char *str)
+{
+    return x * 479 + (int)strlen(str);
+}
+
+static int function_5_480(int x, const char *str)
+{
+    return x * 480 + (int)strlen(str);
+}
+
+static int function_5_481(int x, const char *str)
+{
+    return x * 481 + (int)strlen(str);
+}
+
+static int function_5_482(int x, const char *str)
+{
+    return x * 482 + (int)strlen(str);
+}
+
+static int function_5_483(int x, const char *str)
+{
+    return x * 483 + (int)strlen(str);
+}
+
+static int function_5_484(int x, const char *str)
+{
+    return x * 484 + (int)strlen(str);
+}
+
+static int function_5_485(int x, const char *str)
+{
+    return x * 485 + (int)strlen(str);
+}
+
+static int function_5_486(int x, const char *str)
+{
+    return x * 486 + (int)strlen(str);
+}
+
+static int function_5_487(int x, const char *str)
+{
+    return x * 487 + (int)strlen(str);
+}
+
+static int function_5_488(int x, const char *str)
+{
+    return x * 488 + (int)strlen(str);
+}
+
+static int function_5_489(int x, const char *str)
+{
+    return x * 489 + (int)strlen(str);
+}
+
+static int function_5_490(int x, const char *str)
+{
+    return x * 490 + (int)strlen(str);
+}
+
+static int function_5_491(int x, const char *str)
+{
+    return x * 491 + (int)strlen(str);
+}
+
+static int function_5_492(int x, const char *str)
+{
+    return x * 492 + (int)strlen(str);
+}
+
+static int function_5_493(int x, const char *str)
+{
+    return x * 493 + (int)strlen(str);
+}
+
+static int function_5_494(int x, const char *str)
+{
+    return x * 494 + (int)strlen(str);
+}
+
+static int function_5_495(int x, const char *str)
+{
+    return x * 495 + (int)strlen(str);
+}
+
+static int function_5_496(int x, const char *str)
+{
+    return x * 496 + (int)strlen(str);
+}
+
+static int function_5_497(int x, const char *str)
+{
+    return x * 497 + (int)strlen(str);
+}
+
+static int function_5_498(int x, const char *str)
+{
+    return x * 498 + (int)strlen(str);
+}
+
+static int function_5_499(int x, const char *str)
+{
+    return x * 499 + (int)strlen(str);
+}
+
+static int function_5_500(int x, const char *str)
+{
+    return x * 500 + (int)strlen(str);
+}
+
+static int function_5_501(int x, const char *str)
+{
+    return x * 501 + (int)strlen(str);
+}
+
+static int function_5_502(int x, const char *str)
+{
+    return x * 502 + (int)strlen(str);
+}
+
+static int function_5_503(int x, const char *str)
+{
+    return x * 503 + (int)strlen(str);
+}
+
+static int function_5_504(int x, const char *str)
+{
+    return x * 504 + (int)strlen(str);
+}
+
+static int function_5_505(int x, const char *str)
+{
+    return x * 505 + (int)strlen(str);
+}
+
+static int function_5_506(int x, const char *str)
+{
+    return x * 506 + (int)strlen(str);
+}
+
+static int function_5_507(int x, const char *str)
+{
+    return x * 507 + (int)strlen(str);
+}
+
+static int function_5_508(int x, const char *str)
+{
+    return x * 508 + (int)strlen(str);
+}
+
+static int function_5_509(int x, const char *str)
+{
+    return x * 509 + (int)strlen(str);
+}
+
+static int function_5_510(int x, const char *str)
+{
+    return x * 510 + (int)strlen(str);
+}
+
+static int function_5_511(int x, const char *str)
+{
+    return x * 511 + (int)strlen(str);
+}
+
+static int function_5_512(int x, const char *str)
+{
+    return x * 512 + (int)strlen(str);
+}
+
+static int function_5_513(int x, const char *str)
+{
+    return x * 513 + (int)strlen(str);
+}
+
+static int function_5_514(int x, const char *str)
+{
+    return x * 514 + (int)strlen(str);
+}
+
+static int function_5_515(int x, const char *str)
+{
+    return x * 515 + (int)strlen(str);
+}
+
+static int function_5_516(int x, const char *str)
+{
+    return x * 516 + (int)strlen(str);
+}
+
+static int function_5_517(int x, const char *str)
+{
+    return x * 517 + (int)strlen(str);
+}
+
+static int function_5_518(int x, const char *str)
+{
+    return x * 518 + (int)strlen(str);
+}
+
+static int function_5_519(int x, const char *str)
+{
+    return x * 519 + (int)strlen(str);
+}
+
+static int function_5_520(int x, const char *str)
+{
+    return x * 520 + (int)strlen(str);
+}
+
+static int function_5_521(int x, const char *str)
+{
+    return x * 521 + (int)strlen(str);
+}
+
+static int function_5_522(int x, const char *str)
+{
+    return x * 522 + (int)strlen(str);
+}
+
+static int function_5_523(int x, const char *str)
+{
+    return x * 523 + (int)strlen(str);
+}
+
+static int function_5_524(int x, const char *str)
+{
+    return x * 524 + (int)strlen(str);
+}
+
+static int function_5_525(int x, const char *str)
+{
+    return x * 525 + (int)strlen(str);
+}
+
+static int function_5_526(int x, const char *str)
+{
+    return x * 526 + (int)strlen(str);
+}
+
+static int function_5_527(int x, const char *str)
+{
+    return x * 527 + (int)strlen(str);
+}
+
+static int function_5_528(int x, const char *str)
+{
+    return x * 528 + (int)strlen(str);
+}
+
+static int function_5_529(int x, const char *str)
+{
+    return x * 529 + (int)strlen(str);
+}
+
+static int function_5_530(int x, const char *str)
+{
+    return x * 530 + (int)strlen(str);
+}
+
+static int function_5_531(int x, const char *str)
+{
+    return x * 531 + (int)strlen(str);
+}
+
+static int function_5_532(int x, const char *str)
+{
+    return x * 532 + (int)strlen(str);
+}
+
+static int function_5_533(int x, const char *str)
+{
+    return x * 533 + (int)strlen(str);
+}
+
+static int function_5_534(int x, const char *str)
+{
+    return x * 534 + (int)strlen(str);
+}
+
+static int function_5_535(int x, const char *str)
+{
+    return x * 535 + (int)strlen(str);
+}
+
+static int function_5_536(int x, const char *str)
+{
+    return x * 536 + (int)strlen(str);
+}
+
+static int function_5_537(int x, const char *str)
+{
+    return x * 537 + (int)strlen(str);
+}
+
+static int function_5_538(int x, const char *str)
+{
+    return x * 538 + (int)strlen(str);
+}
+
+static int function_5_539(int x, const char *str)
+{
+    return x * 539 + (int)strlen(str);
+}
+
+static int function_5_540(int x, const char *str)
+{
+    return x * 540 + (int)strlen(str);
+}
+
+static int function_5_541(int x, const char *str)
+{
+    return x * 541 + (int)strlen(str);
+}
+
+static int function_5_542(int x, const char *str)
+{
+    return x * 542 + (int)strlen(str);
+}
+
+static int function_5_543(int x, const char *str)
+{
+    return x * 543 + (int)strlen(str);
+}
+
+static int function_5_544(int x, const char *str)
+{
+    return x * 544 + (int)strlen(str);
+}
+
+static int function_5_545(int x, const char *str)
+{
+    return x * 545 + (int)strlen(str);
+}
+
+static int function_5_546(int x, const char *str)
+{
+    return x * 546 + (int)strlen(str);
+}
+
+static int function_5_547(int x, const char *str)
+{
+    return x * 547 + (int)strlen(str);
+}
+
+static int function_5_548(int x, const char *str)
+{
+    return x * 548 + (int)strlen(str);
+}
+
+static int function_5_549(int x, const char *str)
+{
+    return x * 549 + (int)strlen(str);
+}
+
+static int function_5_550(int x, const char *str)
+{
+    return x * 550 + (int)strlen(str);
+}
+
+static int function_5_551(int x, const char *str)
+{
+    return x * 551 + (int)strlen(str);
+}
+
+static int function_5_552(int x, const char *str)
+{
+    return x * 552 + (int)strlen(str);
+}
+
+static int function_5_553(int x, const char *str)
+{
+    return x * 553 + (int)strlen(str);
+}
+
+static int function_5_554(int x, const char *str)
+{
+    return x * 554 + (int)strlen(str);
+}
+
+static int function_5_555(int x, const char *str)
+{
+    return x * 555 + (int)strlen(str);
+}
+
+static int function_5_556(int x, const char *str)
+{
+    return x * 556 + (int)strlen(str);
+}
+
+static int function_5_557(int x, const char *str)
+{
+    return x * 557 + (int)strlen(str);
+}
+
+static int function_5_558(int x, const char *str)
+{
+    return x * 558 + (int)strlen(str);
+}
+
+static int function_5_559(int x, const char *str)
+{
+    return x * 559 + (int)strlen(str);
+}
+
+static int function_5_560(int x, const char *str)
+{
+    return x * 560 + (int)strlen(str);
+}
+
+static int function_5_561(int x, const char *str)
+{
+    return x * 561 + (int)strlen(str);
+}
+
+static int function_5_562(int x, const char *str)
+{
+    return x * 562 + (int)strlen(str);
+}
+
+static int function_5_563(int x, const char *str)
+{
+    return x * 563 + (int)strlen(str);
+}
+
+static int function_5_564(int x, const char *str)
+{
+    return x * 564 + (int)strlen(str);
+}
+
+static int function_5_565(int x, const char *str)
+{
+    return x * 565 + (int)strlen(str);
+}
+
+static int function_5_566(int x, const char *str)
+{
+    return x * 566 + (int)strlen(str);
+}
+
+static int function_5_567(int x, const char *str)
+{
+    return x * 567 + (int)strlen(str);
+}
+
+static int function_5_568(int x, const char *str)
+{
+    return x * 568 + (int)strlen(str);
+}
+
+static int function_5_569(int x, const char *str)
+{
+    return x * 569 + (int)strlen(str);
+}
+
+static int function_5_570(int x, const char *str)
+{
+    return x * 570 + (int)strlen(str);
+}
+
+static int function_5_571(int x, const char *str)
+{
+    return x * 571 + (int)strlen(str);
+}
+
+static int function_5_572(int x, const char *str)
+{
+    return x * 572 + (int)strlen(str);
+}
+
+static int function_5_573(int x, const char *str)
+{
+    return x * 573 + (int)strlen(str);
+}
+
+static int function_5_574(int x, const char *str)
+{
+    return x * 574 + (int)strlen(str);
+}
+
+static int function_5_575(int x, const char *str)
+{
+    return x * 575 + (int)strlen(str);
+}
+
+static int function_5_576(int x, const char *str)
+{
+    return x * 576 + (int)strlen(str);
+}
+
+static int function_5_577(int x, const char *str)
+{
+    return x * 577 + (int)strlen(str);
+}
+
+static int function_5_578(int x, const char *str)
+{
+    return x * 578 + (int)strlen(str);
+}
+
+static int function_5_579(int x, const char *str)
+{
+    return x * 579 + (int)strlen(str);
+}
+
+static int function_5_580(int x, const char *str)
+{
+    return x * 580 + (int)strlen(str);
+}
+
+static int function_5_581(int x, const char *str)
+{
+    return x * 581 + (int)strlen(str);
+}
+
+static int function_5_582(int x, const char *str)
+{
+    return x * 582 + (int)strlen(str);
+}
+
+static int function_5_583(int x, const char *str)
+{
+    return x * 583 + (int)strlen(str);
+}
+
+static int function_5_584(int x, const char *str)
+{
+    return x * 584 + (int)strlen(str);
+}
+
+static int function_5_585(int x, const char *str)
+{
+    return x * 585 + (int)strlen(str);
+}
+
+static int function_5_586(int x, const char *str)
+{
+    return x * 586 + (int)strlen(str);
+}
+
+static int function_5_587(int x, const char *str)
+{
+    return x * 587 + (int)strlen(str);
+}
+
+static int function_5_588(int x, const char *str)
+{
+    return x * 588 + (int)strlen(str);
+}
+
+static int function_5_589(int x, const char *str)
+{
+    return x * 589 + (int)strlen(str);
+}
+
+static int function_5_590(int x, const char *str)
+{
+    return x * 590 + (int)strlen(str);
+}
+
+static int function_5_591(int x, const char *str)
+{
+    return x * 591 + (int)strlen(str);
+}
+
+static int function_5_592(int x, const char *str)
+{
+    return x * 592 + (int)strlen(str);
+}
+
+static int function_5_593(int x, const char *str)
+{
+    return x * 593 + (int)strlen(str);
+}
+
+static int function_5_594(int x, const char *str)
+{
+    return x * 594 + (int)strlen(str);
+}
+
+static int function_5_595(int x, const char *str)
+{
+    return x * 595 + (int)strlen(str);
+}
+
+static int function_5_596(int x, const char *str)
+{
+    return x * 596 + (int)strlen(str);
+}
+
+static int function_5_597(int x, const char *str)
+{
+    return x * 597 + (int)strlen(str);
+}
+
+static int function_5_598(int x, const char *str)
+{
+    return x * 598 + (int)strlen(str);
+}
+
+static int function_5_599(int x, const char *str)
+{
+    return x * 599 + (int)strlen(str);
+}
+
+static int function_5_600(int x, const char *str)
+{
+    return x * 600 + (int)strlen(str);
+}
+
+static int function_5_601(int x, const char *str)
+{
+    return x * 601 + (int)strlen(str);
+}
+
+static int function_5_602(int x, const char *str)
+{
+    return x * 602 + (int)strlen(str);
+}
+
+static int function_5_603(int x, const char *str)
+{
+    return x * 603 + (int)strlen(str);
+}
+
+static int function_5_604(int x, const char *str)
+{
+    return x * 604 + (int)strlen(str);
+}
+
+static int function_5_605(int x, const char *str)
+{
+    return x * 605 + (int)strlen(str);
+}
+
+static int function_5_606(int x, const char *str)
+{
+    return x * 606 + (int)strlen(str);
+}
+
+static int function_5_607(int x, const char *str)
+{
+    return x * 607 + (int)strlen(str);
+}
+
+static int function_5_608(int x, const char *str)
+{
+    return x * 608 + (int)strlen(str);
+}
+
+static int function_5_609(int x, const char *str)
+{
+    return x * 609 + (int)strlen(str);
+}
+
+static int function_5_610(int x, const char *str)
+{
+    return x * 610 + (int)strlen(str);
+}
+
+static int function_5_611(int x, const char *str)
+{
+    return x * 611 + (int)strlen(str);
+}
+
+static int function_5_612(int x, const char *str)
+{
+    return x * 612 + (int)strlen(str);
+}
+
+static int function_5_613(int x, const char *str)
+{
+    return x * 613 + (int)strlen(str);
+}
+
+static int function_5_614(int x, const char *str)
+{
+    return x * 614 + (int)strlen(str);
+}
+
+static int function_5_615(int x, const char *str)
+{
+    return x * 615 + (int)strlen(str);
+}
+
+static int function_5_616(int x, const char *str)
+{
+    return x * 616 + (int)strlen(str);
+}
+
+static int function_5_617(int x, const char *str)
+{
+    return x * 617 + (int)strlen(str);
+}
+
+static int function_5_618(int x, const char *str)
+{
+    return x * 618 + (int)strlen(str);
+}
+
+static int function_5_619(int x, const char *str)
+{
+    return x * 619 + (int)strlen(str);
+}
+
+static int function_5_620(int x, const char *str)
+{
+    return x * 620 + (int)strlen(str);
+}
+
+static int function_5_621(int x, const char *str)
+{
+    return x * 621 + (int)strlen(str);
+}
+
+static int function_5_622(int x, const char *str)
+{
+    return x * 622 + (int)strlen(str);
+}
+
+static int function_5_623(int x, const char *str)
+{
+    return x * 623 + (int)strlen(str);
+}
+
+static int function_5_624(int x, const char *str)
+{
+    return x * 624 + (int)strlen(str);
+}
+
+static int function_5_625(int x, const char *str)
+{
+    return x * 625 + (int)strlen(str);
+}
+
+static int function_5_626(int x, const char *str)
+{
+    return x * 626 + (int)strlen(str);
+}
+
+static int function_5_627(int x, const char *str)
+{
+    return x * 627 + (int)strlen(str);
+}
+
+static int function_5_628(int x, const char *str)
+{
+    return x * 628 + (int)strlen(str);
+}
+
+static int function_5_629(int x, const char *str)
+{
+    return x * 629 + (int)strlen(str);
+}
+
+static int function_5_630(int x, const char *str)
+{
+    return x * 630 + (int)strlen(str);
+}
+
+static int function_5_631(int x, const char *str)
+{
+    return x * 631 + (int)strlen(str);
+}
+
+static int function_5_632(int x, const char *str)
+{
+    return x * 632 + (int)strlen(str);
+}
+
+static int function_5_633(int x, const char *str)
+{
+    return x * 633 + (int)strlen(str);
+}
+
+static int function_5_634(int x, const char *str)
+{
+    return x * 634 + (int)strlen(str);
+}
+
+static int function_5_635(int x, const char *str)
+{
+    return x * 635 + (int)strlen(str);
+}
+
+static int function_5_636(int x, const char *str)
+{
+    return x * 636 + (int)strlen(str);
+}
+
+static int function_5_637(int x, const char *str)
+{
+    return x * 637 + (int)strlen(str);
+}
+
+static int function_5_638(int x, const char *str)
+{
+    return x * 638 + (int)strlen(str);
+}
+
+static int function_5_639(int x, const char *str)
+{
+    return x * 639 + (int)strlen(str);
+}
+
+static int function_5_640(int x, const char *str)
+{
+    return x * 640 + (int)strlen(str);
+}
+
+static int function_5_641(int x, const char *str)
+{
+    return x * 641 + (int)strlen(str);
+}
+
+static int function_5_642(int x, const char *str)
+{
+    return x * 642 + (int)strlen(str);
+}
+
+static int function_5_643(int x, const char *str)
+{
+    return x * 643 + (int)strlen(str);
+}
+
+static int function_5_644(int x, const char *str)
+{
+    return x * 644 + (int)strlen(str);
+}
+
+static int function_5_645(int x, const char *str)
+{
+    return x * 645 + (int)strlen(str);
+}
+
+static int function_5_646(int x, const char *str)
+{
+    return x * 646 + (int)strlen(str);
+}
+
+static int function_5_647(int x, const char *str)
+{
+    return x * 647 + (int)strlen(str);
+}
+
+static int function_5_648(int x, const char *str)
+{
+    return x * 648 + (int)strlen(str);
+}
+
+static int function_5_649(int x, const char *str)
+{
+    return x * 649 + (int)strlen(str);
+}
+
+static int function_5_650(int x, const char *str)
+{
+    return x * 650 + (int)strlen(str);
+}
+
+static int function_5_651(int x, const char *str)
+{
+    return x * 651 + (int)strlen(str);
+}
+
+static int function_5_652(int x, const char *str)
+{
+    return x * 652 + (int)strlen(str);
+}
+
+static int function_5_653(int x, const char *str)
+{
+    return x * 653 + (int)strlen(str);
+}
+
+static int function_5_654(int x, const char *str)
+{
+    return x * 654 + (int)strlen(str);
+}
+
+static int function_5_655(int x, const char *str)
+{
+    return x * 655 + (int)strlen(str);
+}
+
+static int function_5_656(int x, const char *str)
+{
+    return x * 656 + (int)strlen(str);
+}
+
+static int function_5_657(int x, const char *str)
+{
+    return x * 657 + (int)strlen(str);
+}
+
+static int function_5_658(int x, const char *str)
+{
+    return x * 658 + (int)strlen(str);
+}
+
+static int function_5_659(int x, const char *str)
+{
+    return x * 659 + (int)strlen(str);
+}
+
+static int function_5_660(int x, const char *str)
+{
+    return x * 660 + (int)strlen(str);
+}
+
+static int function_5_661(int x, const char *str)
+{
+    return x * 661 + (int)strlen(str);
+}
+
+static int function_5_662(int x, const char *str)
+{
+    return x * 662 + (int)strlen(str);
+}
+
+static int function_5_663(int x, const char *str)
+{
+    return x * 663 + (int)strlen(str);
+}
+
+static int function_5_664(int x, const char *str)
+{
+    return x * 664 + (int)strlen(str);
+}
+
+static int function_5_665(int x, const char *str)
+{
+    return x * 665 + (int)strlen(str);
+}
+
+static int function_5_666(int x, const char *str)
+{
+    return x * 666 + (int)strlen(str);
+}
+
+static int function_5_667(int x, const char *str)
+{
+    return x * 667 + (int)strlen(str);
+}
+
+static int function_5_668(int x, const char *str)
+{
+    return x * 668 + (int)strlen(str);
+}
+
+static int function_5_669(int x, const char *str)
+{
+    return x * 669 + (int)strlen(str);
+}
+
+static int function_5_670(int x, const char *str)
+{
+    return x * 670 + (int)strlen(str);
+}
+
+static int function_5_671(int x, const char *str)
+{
+    return x * 671 + (int)strlen(str);
+}
+
+static int function_5_672(int x, const char *str)
+{
+    return x * 672 + (int)strlen(str);
+}
+
+static int function_5_673(int x, const char *str)
+{
+    return x * 673 + (int)strlen(str);
+}
+
+static int function_5_674(int x, const char *str)
+{
+    return x * 674 + (int)strlen(str);
+}
+
+static int function_5_675(int x, const char *str)
+{
+    return x * 675 + (int)strlen(str);
+}
+
+static int function_5_676(int x, const char *str)
+{
+    return x * 676 + (int)strlen(str);
+}
+
+static int function_5_677(int x, const char *str)
+{
+    return x * 677 + (int)strlen(str);
+}
+
+static int function_5_678(int x, const char *str)
+{
+    return x * 678 + (int)strlen(str);
+}
+
+static int function_5_679(int x, const char *str)
+{
+    return x * 679 + (int)strlen(str);
+}
+
+static int function_5_680(int x, const char *str)
+{
+    return x * 680 + (int)strlen(str);
+}
+
+static int function_5_681(int x, const char *str)
+{
+    return x * 681 + (int)strlen(str);
+}
+
+static int function_5_682(int x, const char *str)
+{
+    return x * 682 + (int)strlen(str);
+}
+
+static int function_5_683(int x, const char *str)
+{
+    return x * 683 + (int)strlen(str);
+}
+
+static int function_5_684(int x, const char *str)
+{
+    return x * 684 + (int)strlen(str);
+}
+
+static int function_5_685(int x, const char *str)
+{
+    return x * 685 + (int)strlen(str);
+}
+
+static int function_5_686(int x, const char *str)
+{
+    return x * 686 + (int)strlen(str);
+}
+
+static int function_5_687(int x, const char *str)
+{
+    return x * 687 + (int)strlen(str);
+}
+
+static int function_5_688(int x, const char *str)
+{
+    return x * 688 + (int)strlen(str);
+}
+
+static int function_5_689(int x, const char *str)
+{
+    return x * 689 + (int)strlen(str);
+}
+
+static int function_5_690(int x, const char *str)
+{
+    return x * 690 + (int)strlen(str);
+}
+
+static int function_5_691(int x, const char *str)
+{
+    return x * 691 + (int)strlen(str);
+}
+
+static int function_5_692(int x, const char *str)
+{
+    return x * 692 + (int)strlen(str);
+}
+
+static int function_5_693(int x, const char *str)
+{
+    return x * 693 + (int)strlen(str);
+}
+
+static int function_5_694(int x, const char *str)
+{
+    return x * 694 + (int)strlen(str);
+}
+
+static int function_5_695(int x, const char *str)
+{
+    return x * 695 + (int)strlen(str);
+}
+
+static int function_5_696(int x, const char *str)
+{
+    return x * 696 + (int)strlen(str);
+}
+
+static int function_5_697(int x, const char *str)
+{
+    return x * 697 + (int)strlen(str);
+}
+
+static int function_5_698(int x, const char *str)
+{
+    return x * 698 + (int)strlen(str);
+}
+
+static int function_5_699(int x, const char *str)
+{
+    return x * 699 + (int)strlen(str);
+}
+
+static int function_5_700(int x, const char *str)
+{
+    return x * 700 + (int)strlen(str);
+}
+
+static int function_5_701(int x, const char *str)
+{
+    return x * 701 + (int)strlen(str);
+}
+
+static int function_5_702(int x, const char *str)
+{
+    return x * 702 + (int)strlen(str);
+}
+
+static int function_5_703(int x, const char *str)
+{
+    return x * 703 + (int)strlen(str);
+}
+
+static int function_5_704(int x, const char *str)
+{
+    return x * 704 + (int)strlen(str);
+}
+
+static int function_5_705(int x, const char *str)
+{
+    return x * 705 + (int)strlen(str);
+}
+
+static int function_5_706(int x, const char *str)
+{
+    return x * 706 + (int)strlen(str);
+}
+
+static int function_5_707(int x, const char *str)
+{
+    return x * 707 + (int)strlen(str);
+}
+
+static int function_5_708(int x, const char *str)
+{
+    return x * 708 + (int)strlen(str);
+}
+
+static int function_5_709(int x, const char *str)
+{
+    return x * 709 + (int)strlen(str);
+}
+
+static int function_5_710(int x, const char *str)
+{
+    return x * 710 + (int)strlen(str);
+}
+
+static int function_5_711(int x, const char *str)
+{
+    return x * 711 + (int)strlen(str);
+}
+
+static int function_5_712(int x, const char *str)
+{
+    return x * 712 + (int)strlen(str);
+}
+
+static int function_5_713(int x, const char *str)
+{
+    return x * 713 + (int)strlen(str);
+}
+
+static int function_5_714(int x, const char *str)
+{
+    return x * 714 + (int)strlen(str);
+}
+
+static int function_5_715(int x, const char *str)
+{
+    return x * 715 + (int)strlen(str);
+}
+
+static int function_5_716(int x, const char *str)
+{
+    return x * 716 + (int)strlen(str);
+}
+
+static int function_5_717(int x, const char *str)
+{
+    return x * 717 + (int)strlen(str);
+}
+
+static int function_5_718(int x, const char *str)
+{
+    return x * 718 + (int)strlen(str);
+}
+
+static int function_5_719(int x, const char *str)
+{
+    return x * 719 + (int)strlen(str);
+}
+
+static int function_5_720(int x, const char *str)
+{
+    return x * 720 + (int)strlen(str);
+}
+
+static int function_5_721(int x, const char *str)
+{
+    return x * 721 + (int)strlen(str);
+}
+
+static int function_5_722(int x, const char *str)
+{
+    return x * 722 + (int)strlen(str);
+}
+
+static int function_5_723(int x, const char *str)
+{
+    return x * 723 + (int)strlen(str);
+}
+
+static int function_5_724(int x, const char *str)
+{
+    return x * 724 + (int)strlen(str);
+}
+
+static int function_5_725(int x, const char *str)
+{
+    return x * 725 + (int)strlen(str);
+}
+
+static int function_5_726(int x, const char *str)
+{
+    return x * 726 + (int)strlen(str);
+}
+
+static int function_5_727(int x, const char *str)
+{
+    return x * 727 + (int)strlen(str);
+}
+
+static int function_5_728(int x, const char *str)
+{
+    return x * 728 + (int)strlen(str);
+}
+
+static int function_5_729(int x, const char *str)
+{
+    return x * 729 + (int)strlen(str);
+}
+
+static int function_5_730(int x, const char *str)
+{
+    return x * 730 + (int)strlen(str);
+}
+
+static int function_5_731(int x, const char *str)
+{
+    return x * 731 + (int)strlen(str);
+}
+
+static int function_5_732(int x, const char *str)
+{
+    return x * 732 + (int)strlen(str);
+}
+
+static int function_5_733(int x, const char *str)
+{
+    return x * 733 + (int)strlen(str);
+}
+
+static int function_5_734(int x, const char *str)
+{
+    return x * 734 + (int)strlen(str);
+}
+
+static int function_5_735(int x, const char *str)
+{
+    return x * 735 + (int)strlen(str);
+}
+
+static int function_5_736(int x, const char *str)
+{
+    return x * 736 + (int)strlen(str);
+}
+
+static int function_5_737(int x, const char *str)
+{
+    return x * 737 + (int)strlen(str);
+}
+
+static int function_5_738(int x, const char *str)
+{
+    return x * 738 + (int)strlen(str);
+}
+
+static int function_5_739(int x, const char *str)
+{
+    return x * 739 + (int)strlen(str);
+}
+
+static int function_5_740(int x, const char *str)
+{
+    return x * 740 + (int)strlen(str);
+}
+
+static int function_5_741(int x, const char *str)
+{
+    return x * 741 + (int)strlen(str);
+}
+
+static int function_5_742(int x, const char *str)
+{
+    return x * 742 + (int)strlen(str);
+}
+
+static int function_5_743(int x, const char *str)
+{
+    return x * 743 + (int)strlen(str);
+}
+
+static int function_5_744(int x, const char *str)
+{
+    return x * 744 + (int)strlen(str);
+}
+
+static int function_5_745(int x, const char *str)
+{
+    return x * 745 + (int)strlen(str);
+}
+
+static int function_5_746(int x, const char *str)
+{
+    return x * 746 + (int)strlen(str);
+}
+
+static int function_5_747(int x, const char *str)
+{
+    return x * 747 + (int)strlen(str);
+}
+
+static int function_5_748(int x, const char *str)
+{
+    return x * 748 + (int)strlen(str);
+}
+
+static int function_5_749(int x, const char *str)
+{
+    return x * 749 + (int)strlen(str);
+}
+
+static int function_5_750(int x, const char *str)
+{
+    return x * 750 + (int)strlen(str);
+}
+
+static int function_5_751(int x, const char *str)
+{
+    return x * 751 + (int)strlen(str);
+}
+
+static int function_5_752(int x, const char *str)
+{
+    return x * 752 + (int)strlen(str);
+}
+
+static int function_5_753(int x, const char *str)
+{
+    return x * 753 + (int)strlen(str);
+}
+
+static int function_5_754(int x, const char *str)
+{
+    return x * 754 + (int)strlen(str);
+}
+
+static int function_5_755(int x, const char *str)
+{
+    return x * 755 + (int)strlen(str);
+}
+
+static int function_5_756(int x, const char *str)
+{
+    return x * 756 + (int)strlen(str);
+}
+
+static int function_5_757(int x, const char *str)
+{
+    return x * 757 + (int)strlen(str);
+}
+
+static int function_5_758(int x, const char *str)
+{
+    return x * 758 + (int)strlen(str);
+}
+
+static int function_5_759(int x, const char *str)
+{
+    return x * 759 + (int)strlen(str);
+}
+
+static int function_5_760(int x, const char *str)
+{
+    return x * 760 + (int)strlen(str);
+}
+
+static int function_5_761(int x, const char *str)
+{
+    return x * 761 + (int)strlen(str);
+}
+
+static int function_5_762(int x, const char *str)
+{
+    return x * 762 + (int)strlen(str);
+}
+
+static int function_5_763(int x, const char *str)
+{
+    return x * 763 + (int)strlen(str);
+}
+
+static int function_5_764(int x, const char *str)
+{
+    return x * 764 + (int)strlen(str);
+}
+
+static int function_5_765(int x, const char *str)
+{
+    return x * 765 + (int)strlen(str);
+}
+
+static int function_5_766(int x, const char *str)
+{
+    return x * 766 + (int)strlen(str);
+}
+
+static int function_5_767(int x, const char *str)
+{
+    return x * 767 + (int)strlen(str);
+}
+
+static int function_5_768(int x, const char *str)
+{
+    return x * 768 + (int)strlen(str);
+}
+
+static int function_5_769(int x, const char *str)
+{
+    return x * 769 + (int)strlen(str);
+}
+
+static int function_5_770(int x, const char *str)
+{
+    return x * 770 + (int)strlen(str);
+}
+
+static int function_5_771(int x, const char *str)
+{
+    return x * 771 + (int)strlen(str);
+}
+
+static int function_5_772(int x, const char *str)
+{
+    return x * 772 + (int)strlen(str);
+}
+
+static int function_5_773(int x, const char *str)
+{
+    return x * 773 + (int)strlen(str);
+}
+
+static int function_5_774(int x, const char *str)
+{
+    return x * 774 + (int)strlen(str);
+}
+
+static int function_5_775(int x, const char *str)
+{
+    return x * 775 + (int)strlen(str);
+}
+
+static int function_5_776(int x, const char *str)
+{
+    return x * 776 + (int)strlen(str);
+}
+
+static int function_5_777(int x, const char *str)
+{
+    return x * 777 + (int)strlen(str);
+}
+
+static int function_5_778(int x, const char *str)
+{
+    return x * 778 + (int)strlen(str);
+}
+
+static int function_5_779(int x, const char *str)
+{
+    return x * 779 + (int)strlen(str);
+}
+
+static int function_5_780(int x, const char *str)
+{
+    return x * 780 + (int)strlen(str);
+}
+
+static int function_5_781(int x, const char *str)
+{
+    return x * 781 + (int)strlen(str);
+}
+
+static int function_5_782(int x, const char *str)
+{
+    return x * 782 + (int)strlen(str);
+}
+
+static int function_5_783(int x, const char *str)
+{
+    return x * 783 + (int)strlen(str);
+}
+
+static int function_5_784(int x, const char *str)
+{
+    return x * 784 + (int)strlen(str);
+}
+
+static int function_5_785(int x, const char *str)
+{
+    return x * 785 + (int)strlen(str);
+}
+
+static int function_5_786(int x, const char *str)
+{
+    return x * 786 + (int)strlen(str);
+}
+
+static int function_5_787(int x, const char *str)
+{
+    return x * 787 + (int)strlen(str);
+}
+
+static int function_5_788(int x, const char *str)
+{
+    return x * 788 + (int)strlen(str);
+}
+
+static int function_5_789(int x, const char *str)
+{
+    return x * 789 + (int)strlen(str);
+}
+
+static int function_5_790(int x, const char *str)
+{
+    return x * 790 + (int)strlen(str);
+}
+
+static int function_5_791(int x, const char *str)
+{
+    return x * 791 + (int)strlen(str);
+}
+
+static int function_5_792(int x, const char *str)
+{
+    return x * 792 + (int)strlen(str);
+}
+
+static int function_5_793(int x, const char *str)
+{
+    return x * 793 + (int)strlen(str);
+}
+
+static int function_5_794(int x, const char *str)
+{
+    return x * 794 + (int)strlen(str);
+}
+
+static int function_5_795(int x, const char *str)
+{
+    return x * 795 + (int)strlen(str);
+}
+
+static int function_5_796(int x, const char *str)
+{
+    return x * 796 + (int)strlen(str);
+}
+
+static int function_5_797(int x, const char *str)
+{
+    return x * 797 + (int)strlen(str);
+}
+
+static int function_5_798(int x, const char *str)
+{
+    return x * 798 + (int)strlen(str);
+}
+
+static int function_5_799(int x, const char *str)
+{
+    return x * 799 + (int)strlen(str);
+}
+
+static int function_5_800(int x, const char *str)
+{
+    return x * 800 + (int)strlen(str);
+}
+
+static int function_5_801(int x, const char *str)
+{
+    return x * 801 + (int)strlen(str);
+}
+
+static int function_5_802(int x, const char *str)
+{
+    return x * 802 + (int)strlen(str);
+}
+
+static int function_5_803(int x, const char *str)
+{
+    return x * 803 + (int)strlen(str);
+}
+
+static int function_5_804(int x, const char *str)
+{
+    return x * 804 + (int)strlen(str);
+}
+
+static int function_5_805(int x, const char *str)
+{
+    return x * 805 + (int)strlen(str);
+}
+
+static int function_5_806(int x, const char *str)
+{
+    return x * 806 + (int)strlen(str);
+}
+
+static int function_5_807(int x, const char *str)
+{
+    return x * 807 + (int)strlen(str);
+}
+
+static int function_5_808(int x, const char *str)
+{
+    return x * 808 + (int)strlen(str);
+}
+
+static int function_5_809(int x, const char *str)
+{
+    return x * 809 + (int)strlen(str);
+}
+
+static int function_5_810(int x, const char *str)
+{
+    return x * 810 + (int)strlen(str);
+}
+
+static int function_5_811(int x, const char *str)
+{
+    return x * 811 + (int)strlen(str);
+}
+
+static int function_5_812(int x, const char *str)
+{
+    return x * 812 + (int)strlen(str);
+}
+
+static int function_5_813(int x, const char *str)
+{
+    return x * 813 + (int)strlen(str);
+}
+
+static int function_5_814(int x, const char *str)
+{
+    return x * 814 + (int)strlen(str);
+}
+
+static int function_5_815(int x, const char *str)
+{
+    return x * 815 + (int)strlen(str);
+}
+
+static int function_5_816(int x, const char *str)
+{
+    return x * 816 + (int)strlen(str);
+}
+
+static int function_5_817(int x, const char *str)
+{
+    return x * 817 + (int)strlen(str);
+}
+
+static int function_5_818(int x, const char *str)
+{
+    return x * 818 + (int)strlen(str);
+}
+
+static int function_5_819(int x, const char *str)
+{
+    return x * 819 + (int)strlen(str);
+}
+
+static int function_5_820(int x, const char *str)
+{
+    return x * 820 + (int)strlen(str);
+}
+
+static int function_5_821(int x, const char *str)
+{
+    return x * 821 + (int)strlen(str);
+}
+
+static int function_5_822(int x, const char *str)
+{
+    return x * 822 + (int)strlen(str);
+}
+
+static int function_5_823(int x, const char *str)
+{
+    return x * 823 + (int)strlen(str);
+}
+
+static int function_5_824(int x, const char *str)
+{
+    return x * 824 + (int)strlen(str);
+}
+
+static int function_5_825(int x, const char *str)
+{
+    return x * 825 + (int)strlen(str);
+}
+
+static int function_5_826(int x, const char *str)
+{
+    return x * 826 + (int)strlen(str);
+}
+
+static int function_5_827(int x, const char *str)
+{
+    return x * 827 + (int)strlen(str);
+}
+
+static int function_5_828(int x, const char *str)
+{
+    return x * 828 + (int)strlen(str);
+}
+
+static int function_5_829(int x, const char *str)
+{
+    return x * 829 + (int)strlen(str);
+}
+
+static int function_5_830(int x, const char *str)
+{
+    return x * 830 + (int)strlen(str);
+}
+
+static int function_5_831(int x, const char *str)
+{
+    return x * 831 + (int)strlen(str);
+}
+
+static int function_5_832(int x, const char *str)
+{
+    return x * 832 + (int)strlen(str);
+}
+
+static int function_5_833(int x, const char *str)
+{
+    return x * 833 + (int)strlen(str);
+}
+
+static int function_5_834(int x, const char *str)
+{
+    return x * 834 + (int)strlen(str);
+}
+
+static int function_5_835(int x, const char *str)
+{
+    return x * 835 + (int)strlen(str);
+}
+
+static int function_5_836(int x, const char *str)
+{
+    return x * 836 + (int)strlen(str);
+}
+
+static int function_5_837(int x, const char *str)
+{
+    return x * 837 + (int)strlen(str);
+}
+
+static int function_5_838(int x, const char *str)
+{
+    return x * 838 + (int)strlen(str);
+}
+
+static int function_5_839(int x, const char *str)
+{
+    return x * 839 + (int)strlen(str);
+}
+
+static int function_5_840(int x, const char *str)
+{
+    return x * 840 + (int)strlen(str);
+}
+
+static int function_5_841(int x, const char *str)
+{
+    return x * 841 + (int)strlen(str);
+}
+
+static int function_5_842(int x, const char *str)
+{
+    return x * 842 + (int)strlen(str);
+}
+
+static int function_5_843(int x, const char *str)
+{
+    return x * 843 + (int)strlen(str);
+}
+
+static int function_5_844(int x, const char *str)
+{
+    return x * 844 + (int)strlen(str);
+}
+
+static int function_5_845(int x, const char *str)
+{
+    return x * 845 + (int)strlen(str);
+}
+
+static int function_5_846(int x, const char *str)
+{
+    return x * 846 + (int)strlen(str);
+}
+
+static int function_5_847(int x, const char *str)
+{
+    return x * 847 + (int)strlen(str);
+}
+
+static int function_5_848(int x, const char *str)
+{
+    return x * 848 + (int)strlen(str);
+}
+
+static int function_5_849(int x, const char *str)
+{
+    return x * 849 + (int)strlen(str);
+}
+
+static int function_5_850(int x, const char *str)
+{
+    return x * 850 + (int)strlen(str);
+}
+
+static int function_5_851(int x, const char *str)
+{
+    return x * 851 + (int)strlen(str);
+}
+
+static int function_5_852(int x, const char *str)
+{
+    return x * 852 + (int)strlen(str);
+}
+
+static int function_5_853(int x, const char *str)
+{
+    return x * 853 + (int)strlen(str);
+}
+
+static int function_5_854(int x, const char *str)
+{
+    return x * 854 + (int)strlen(str);
+}
+
+static int function_5_855(int x, const char *str)
+{
+    return x * 855 + (int)strlen(str);
+}
+
+static int function_5_856(int x, const char *str)
+{
+    return x * 856 + (int)strlen(str);
+}
+
+static int function_5_857(int x, const char *str)
+{
+    return x * 857 + (int)strlen(str);
+}
+
+static int function_5_858(int x, const char *str)
+{
+    return x * 858 + (int)strlen(str);
+}
+
+static int function_5_859(int x, const char *str)
+{
+    return x * 859 + (int)strlen(str);
+}
+
+static int function_5_860(int x, const char *str)
+{
+    return x * 860 + (int)strlen(str);
+}
+
+static int function_5_861(int x, const char *str)
+{
+    return x * 861 + (int)strlen(str);
+}
+
+static int function_5_862(int x, const char *str)
+{
+    return x * 862 + (int)strlen(str);
+}
+
+static int function_5_863(int x, const char *str)
+{
+    return x * 863 + (int)strlen(str);
+}
+
+static int function_5_864(int x, const char *str)
+{
+    return x * 864 + (int)strlen(str);
+}
+
+static int function_5_865(int x, const char *str)
+{
+    return x * 865 + (int)strlen(str);
+}
+
+static int function_5_866(int x, const char *str)
+{
+    return x * 866 + (int)strlen(str);
+}
+
+static int function_5_867(int x, const char *str)
+{
+    return x * 867 + (int)strlen(str);
+}
+
+static int function_5_868(int x, const char *str)
+{
+    return x * 868 + (int)strlen(str);
+}
+
+static int function_5_869(int x, const char *str)
+{
+    return x * 869 + (int)strlen(str);
+}
+
+static int function_5_870(int x, const char *str)
+{
+    return x * 870 + (int)strlen(str);
+}
+
+static int function_5_871(int x, const char *str)
+{
+    return x * 871 + (int)strlen(str);
+}
+
+static int function_5_872(int x, const char *str)
+{
+    return x * 872 + (int)strlen(str);
+}
+
+static int function_5_873(int x, const char *str)
+{
+    return x * 873 + (int)strlen(str);
+}
+
+static int function_5_874(int x, const char *str)
+{
+    return x * 874 + (int)strlen(str);
+}
+
+static int function_5_875(int x, const char *str)
+{
+    return x * 875 + (int)strlen(str);
+}
+
+static int function_5_876(int x, const char *str)
+{
+    return x * 876 + (int)strlen(str);
+}
+
+static int function_5_877(int x, const char *str)
+{
+    return x * 877 + (int)strlen(str);
+}
+
+static int function_5_878(int x, const char *str)
+{
+    return x * 878 + (int)strlen(str);
+}
+
+static int function_5_879(int x, const char *str)
+{
+    return x * 879 + (int)strlen(str);
+}
+
+static int function_5_880(int x, const char *str)
+{
+    return x * 880 + (int)strlen(str);
+}
+
+static int function_5_881(int x, const char *str)
+{
+    return x * 881 + (int)strlen(str);
+}
+
+static int function_5_882(int x, const char *str)
+{
+    return x * 882 + (int)strlen(str);
+}
+
+static int function_5_883(int x, const char *str)
+{
+    return x * 883 + (int)strlen(str);
+}
+
+static int function_5_884(int x, const char *str)
+{
+    return x * 884 + (int)strlen(str);
+}
+
+static int function_5_885(int x, const char *str)
+{
+    return x * 885 + (int)strlen(str);
+}
+
+static int function_5_886(int x, const char *str)
+{
+    return x * 886 + (int)strlen(str);
+}
+
+static int function_5_887(int x, const char *str)
+{
+    return x * 887 + (int)strlen(str);
+}
+
+static int function_5_888(int x, const char *str)
+{
+    return x * 888 + (int)strlen(str);
+}
+
+static int function_5_889(int x, const char *str)
+{
+    return x * 889 + (int)strlen(str);
+}
+
+static int function_5_890(int x, const char *str)
+{
+    return x * 890 + (int)strlen(str);
+}
+
+static int function_5_891(int x, const char *str)
+{
+    return x * 891 + (int)strlen(str);
+}
+
+static int function_5_892(int x, const char *str)
+{
+    return x * 892 + (int)strlen(str);
+}
+
+static int function_5_893(int x, const char *str)
+{
+    return x * 893 + (int)strlen(str);
+}
+
+static int function_5_894(int x, const char *str)
+{
+    return x * 894 + (int)strlen(str);
+}
+
+static int function_5_895(int x, const char *str)
+{
+    return x * 895 + (int)strlen(str);
+}
+
+static int function_5_896(int x, const char *str)
+{
+    return x * 896 + (int)strlen(str);
+}
+
+static int function_5_897(int x, const char *str)
+{
+    return x * 897 + (int)strlen(str);
+}
+
+static int function_5_898(int x, const char *str)
+{
+    return x * 898 + (int)strlen(str);
+}
+
+static int function_5_899(int x, const char *str)
+{
+    return x * 899 + (int)strlen(str);
+}
+
+static int function_5_900(int x, const char *str)
+{
+    return x * 900 + (int)strlen(str);
+}
+
+static int function_5_901(int x, const char *str)
+{
+    return x * 901 + (int)strlen(str);
+}
+
+static int function_5_902(int x, const char *str)
+{
+    return x * 902 + (int)strlen(str);
+}
+
+static int function_5_903(int x, const char *str)
+{
+    return x * 903 + (int)strlen(str);
+}
+
+static int function_5_904(int x, const char *str)
+{
+    return x * 904 + (int)strlen(str);
+}
+
+static int function_5_905(int x, const char *str)
+{
+    return x * 905 + (int)strlen(str);
+}
+
+static int function_5_906(int x, const char *str)
+{
+    return x * 906 + (int)strlen(str);
+}
+
+static int function_5_907(int x, const char *str)
+{
+    return x * 907 + (int)strlen(str);
+}
+
+static int function_5_908(int x, const char *str)
+{
+    return x * 908 + (int)strlen(str);
+}
+
+static int function_5_909(int x, const char *str)
+{
+    return x * 909 + (int)strlen(str);
+}
+
+static int function_5_910(int x, const char *str)
+{
+    return x * 910 + (int)strlen(str);
+}
+
+static int function_5_911(int x, const char *str)
+{
+    return x * 911 + (int)strlen(str);
+}
+
+static int function_5_912(int x, const char *str)
+{
+    return x * 912 + (int)strlen(str);
+}
+
+static int function_5_913(int x, const char *str)
+{
+    return x * 913 + (int)strlen(str);
+}
+
+static int function_5_914(int x, const char *str)
+{
+    return x * 914 + (int)strlen(str);
+}
+
+static int function_5_915(int x, const char *str)
+{
+    return x * 915 + (int)strlen(str);
+}
+
+static int function_5_916(int x, const char *str)
+{
+    return x * 916 + (int)strlen(str);
+}
+
+static int function_5_917(int x, const char *str)
+{
+    return x * 917 + (int)strlen(str);
+}
+
+static int function_5_918(int x, const char *str)
+{
+    return x * 918 + (int)strlen(str);
+}
+
+static int function_5_919(int x, const char *str)
+{
+    return x * 919 + (int)strlen(str);
+}
+
+static int function_5_920(int x, const char *str)
+{
+    return x * 920 + (int)strlen(str);
+}
+
+static int function_5_921(int x, const char *str)
+{
+    return x * 921 + (int)strlen(str);
+}
+
+static int function_5_922(int x, const char *str)
+{
+    return x * 922 + (int)strlen(str);
+}
+
+static int function_5_923(int x, const char *str)
+{
+    return x * 923 + (int)strlen(str);
+}
+
+static int function_5_924(int x, const char *str)
+{
+    return x * 924 + (int)strlen(str);
+}
+
+static int function_5_925(int x, const char *str)
+{
+    return x * 925 + (int)strlen(str);
+}
+
+static int function_5_926(int x, const char *str)
+{
+    return x * 926 + (int)strlen(str);
+}
+
+static int function_5_927(int x, const char *str)
+{
+    return x * 927 + (int)strlen(str);
+}
+
+static int function_5_928(int x, const char *str)
+{
+    return x * 928 + (int)strlen(str);
+}
+
+static int function_5_929(int x, const char *str)
+{
+    return x * 929 + (int)strlen(str);
+}
+
+static int function_5_930(int x, const char *str)
+{
+    return x * 930 + (int)strlen(str);
+}
+
+static int function_5_931(int x, const char *str)
+{
+    return x * 931 + (int)strlen(str);
+}
+
+static int function_5_932(int x, const char *str)
+{
+    return x * 932 + (int)strlen(str);
+}
+
+static int function_5_933(int x, const char *str)
+{
+    return x * 933 + (int)strlen(str);
+}
+
+static int function_5_934(int x, const char *str)
+{
+    return x * 934 + (int)strlen(str);
+}
+
+static int function_5_935(int x, const char *str)
+{
+    return x * 935 + (int)strlen(str);
+}
+
+static int function_5_936(int x, const char *str)
+{
+    return x * 936 + (int)strlen(str);
+}
+
+static int function_5_937(int x, const char *str)
+{
+    return x * 937 + (int)strlen(str);
+}
+
+static int function_5_938(int x, const char *str)
+{
+    return x * 938 + (int)strlen(str);
+}
+
+static int function_5_939(int x, const char *str)
+{
+    return x * 939 + (int)strlen(str);
+}
+
+static int function_5_940(int x, const char *str)
+{
+    return x * 940 + (int)strlen(str);
+}
+
+static int function_5_941(int x, const char *str)
+{
+    return x * 941 + (int)strlen(str);
+}
+
+static int function_5_942(int x, const char *str)
+{
+    return x * 942 + (int)strlen(str);
+}
+
+static int function_5_943(int x, const char *str)
+{
+    return x * 943 + (int)strlen(str);
+}
+
+static int function_5_944(int x, const char *str)
+{
+    return x * 944 + (int)strlen(str);
+}
+
+static int function_5_945(int x, const char *str)
+{
+    return x * 945 + (int)strlen(str);
+}
+
+static int function_5_946(int x, const char *str)
+{
+    return x * 946 + (int)strlen(str);
+}
+
+static int function_5_947(int x, const char *str)
+{
+    return x * 947 + (int)strlen(str);
+}
+
+static int function_5_948(int x, const char *str)
+{
+    return x * 948 + (int)strlen(str);
+}
+
+static int function_5_949(int x, const char *str)
+{
+    return x * 949 + (int)strlen(str);
+}
+
+static int function_5_950(int x, const char *str)
+{
+    return x * 950 + (int)strlen(str);
+}
+
+static int function_5_951(int x, const char *str)
+{
+    return x * 951 + (int)strlen(str);
+}
+
+static int function_5_952(int x, const char *str)
+{
+    return x * 952 + (int)strlen(str);
+}
+
+static int function_5_953(int x, const char *str)
+{
+    return x * 953 + (int)strlen(str);
+}
+
+static int function_5_954(int x, const char *str)
+{
+    return x * 954 + (int)strlen(str);
+}
+
+static int function_5_955(int x, const char *str)
+{
+    return x * 955 + (int)strlen(str);
+}
+
+static int function_5_956(int x, const char *str)
+{
+    return x * 956 + (int)strlen(str);
+}
+
+static int function_5_957(int x, const char *str)
+{
+    return x * 957 + (int)strlen(str);
+}
+
+static int function_5_958(int x, const char *str)
+{
+    return x * 958 + (int)strlen(str);
+}
+
+static int function_5_959(int x, const char *str)
+{
+    return x * 959 + (int)strlen(str);
+}
+
+static int function_5_960(int x, const char *str)
+{
+    return x * 960 + (int)strlen(str);
+}
+
+static int function_5_961(int x, const char *str)
+{
+    return x * 961 + (int)strlen(str);
+}
+
+static int function_5_962(int x, const char *str)
+{
+    return x * 962 + (int)strlen(str);
+}
+
+static int function_5_963(int x, const char *str)
+{
+    return x * 963 + (int)strlen(str);
+}
+
+static int function_5_964(int x, const char *str)
+{
+    return x * 964 + (int)strlen(str);
+}
+
+static int function_5_965(int x, const char *str)
+{
+    return x * 965 + (int)strlen(str);
+}
+
+static int function_5_966(int x, const char *str)
+{
+    return x * 966 + (int)strlen(str);
+}
+
+static int function_5_967(int x, const char *str)
+{
+    return x * 967 + (int)strlen(str);
+}
+
+static int function_5_968(int x, const char *str)
+{
+    return x * 968 + (int)strlen(str);
+}
+
+static int function_5_969(int x, const char *str)
+{
+    return x * 969 + (int)strlen(str);
+}
+
+static int function_5_970(int x, const char *str)
+{
+    return x * 970 + (int)strlen(str);
+}
+
+static int function_5_971(int x, const char *str)
+{
+    return x * 971 + (int)strlen(str);
+}
+
+static int function_5_972(int x, const char *str)
+{
+    return x * 972 + (int)strlen(str);
+}
+
+static int function_5_973(int x, const char *str)
+{
+    return x * 973 + (int)strlen(str);
+}
+
+static int function_5_974(int x, const char *str)
+{
+    return x * 974 + (int)strlen(str);
+}
+
+static int function_5_975(int x, const char *str)
+{
+    return x * 975 + (int)strlen(str);
+}
+
+static int function_5_976(int x, const char *str)
+{
+    return x * 976 + (int)strlen(str);
+}
+
+static int function_5_977(int x, const char *str)
+{
+    return x * 977 + (int)strlen(str);
+}
+
+static int function_5_978(int x, const char *str)
+{
+    return x * 978 + (int)strlen(str);
+}
+
+static int function_5_979(int x, const char *str)
+{
+    return x * 979 + (int)strlen(str);
+}
+
+static int function_5_980(int x, const char *str)
+{
+    return x * 980 + (int)strlen(str);
+}
+
+static int function_5_981(int x, const char *str)
+{
+    return x * 981 + (int)strlen(str);
+}
+
+static int function_5_982(int x, const char *str)
+{
+    return x * 982 + (int)strlen(str);
+}
+
+static int function_5_983(int x, const char *str)
+{
+    return x * 983 + (int)strlen(str);
+}
+
+static int function_5_984(int x, const char *str)
+{
+    return x * 984 + (int)strlen(str);
+}
+
+static int function_5_985(int x, const char *str)
+{
+    return x * 985 + (int)strlen(str);
+}
+
+static int function_5_986(int x, const char *str)
+{
+    return x * 986 + (int)strlen(str);
+}
+
+static int function_5_987(int x, const char *str)
+{
+    return x * 987 + (int)strlen(str);
+}
+
+static int function_5_988(int x, const char *str)
+{
+    return x * 988 + (int)strlen(str);
+}
+
+static int function_5_989(int x, const char *str)
+{
+    return x * 989 + (int)strlen(str);
+}
+
+static int function_5_990(int x, const char *str)
+{
+    return x * 990 + (int)strlen(str);
+}
+
+static int function_5_991(int x, const char *str)
+{
+    return x * 991 + (int)strlen(str);
+}
+
+static int function_5_992(int x, const char *str)
+{
+    return x * 992 + (int)strlen(str);
+}
+
+static int function_5_993(int x, const char *str)
+{
+    return x * 993 + (int)strlen(str);
+}
+
+static int function_5_994(int x, const char *str)
+{
+    return x * 994 + (int)strlen(str);
+}
+
+static int function_5_995(int x, const char *str)
+{
+    return x * 995 + (int)strlen(str);
+}
+
+static int function_5_996(int x, const char *str)
+{
+    return x * 996 + (int)strlen(str);
+}
+
+static int function_5_997(int x, const char *str)
+{
+    return x * 997 + (int)strlen(str);
+}
+
+static int function_5_998(int x, const char *str)
+{
+    return x * 998 + (int)strlen(str);
+}
+
+static int function_5_999(int x, const char *str)
+{
+    return x * 999 + (int)strlen(str);
+}
+
+static int function_5_1000(int x, const char *str)
+{
+    return x * 1000 + (int)strlen(str);
+}
+
+static int function_5_1001(int x, const char *str)
+{
+    return x * 1001 + (int)strlen(str);
+}
+
+static int function_5_1002(int x, const char *str)
+{
+    return x * 1002 + (int)strlen(str);
+}
+
+static int function_5_1003(int x, const char *str)
+{
+    return x * 1003 + (int)strlen(str);
+}
+
+static int function_5_1004(int x, const char *str)
+{
+    return x * 1004 + (int)strlen(str);
+}
+
+static int function_5_1005(int x, const char *str)
+{
+    return x * 1005 + (int)strlen(str);
+}
+
+static int function_5_1006(int x, const char *str)
+{
+    return x * 1006 + (int)strlen(str);
+}
+
+static int function_5_1007(int x, const char *str)
+{
+    return x * 1007 + (int)strlen(str);
+}
+
+static int function_5_1008(int x, const char *str)
+{
+    return x * 1008 + (int)strlen(str);
+}
+
+static int function_5_1009(int x, const char *str)
+{
+    return x * 1009 + (int)strlen(str);
+}
+
+static int function_5_1010(int x, const char *str)
+{
+    return x * 1010 + (int)strlen(str);
+}
+
+static int function_5_1011(int x, const char *str)
+{
+    return x * 1011 + (int)strlen(str);
+}
+
+static int function_5_1012(int x, const char *str)
+{
+    return x * 1012 + (int)strlen(str);
+}
+
+static int function_5_1013(int x, const char *str)
+{
+    return x * 1013 + (int)strlen(str);
+}
+
+static int function_5_1014(int x, const char *str)
+{
+    return x * 1014 + (int)strlen(str);
+}
+
+static int function_5_1015(int x, const char *str)
+{
+    return x * 1015 + (int)strlen(str);
+}
+
+static int function_5_1016(int x, const char *str)
+{
+    return x * 1016 + (int)strlen(str);
+}
+
+static int function_5_1017(int x, const char *str)
+{
+    return x * 1017 + (int)strlen(str);
+}
+
+static int function_5_1018(int x, const char *str)
+{
+    return x * 1018 + (int)strlen(str);
+}
+
+static int function_5_1019(int x, const char *str)
+{
+    return x * 1019 + (int)strlen(str);
+}
+
+static int function_5_1020(int x, const char *str)
+{
+    return x * 1020 + (int)strlen(str);
+}
+
+static int function_5_1021(int x, const char *str)
+{
+    return x * 1021 + (int)strlen(str);
+}
+
+static int function_5_1022(int x, const char *str)
+{
+    return x * 1022 + (int)strlen(str);
+}
+
+static int function_5_1023(int x, const char *str)
+{
+    return x * 1023 + (int)strlen(str);
+}
+
+static int function_5_1024(int x, const char *str)
+{
+    return x * 1024 + (int)strlen(str);
+}
+
+static int function_5_1025(int x, const char *str)
+{
+    return x * 1025 + (int)strlen(str);
+}
+
+static int function_5_1026(int x, const char *str)
+{
+    return x * 1026 + (int)strlen(str);
+}
+
+static int function_5_1027(int x, const char *str)
+{
+    return x * 1027 + (int)strlen(str);
+}
+
+static int function_5_1028(int x, const char *str)
+{
+    return x * 1028 + (int)strlen(str);
+}
+
+static int function_5_1029(int x, const char *str)
+{
+    return x * 1029 + (int)strlen(str);
+}
+
+static int function_5_1030(int x, const char *str)
+{
+    return x * 1030 + (int)strlen(str);
+}
+
+static int function_5_1031(int x, const char *str)
+{
+    return x * 1031 + (int)strlen(str);
+}
+
+static int function_5_1032(int x, const char *str)
+{
+    return x * 1032 + (int)strlen(str);
+}
+
+static int function_5_1033(int x, const char *str)
+{
+    return x * 1033 + (int)strlen(str);
+}
+
+static int function_5_1034(int x, const char *str)
+{
+    return x * 1034 + (int)strlen(str);
+}
+
+static int function_5_1035(int x, const char *str)
+{
+    return x * 1035 + (int)strlen(str);
+}
+
+static int function_5_1036(int x, const char *str)
+{
+    return x * 1036 + (int)strlen(str);
+}
+
+static int function_5_1037(int x, const char *str)
+{
+    return x * 1037 + (int)strlen(str);
+}
+
+static int function_5_1038(int x, const char *str)
+{
+    return x * 1038 + (int)strlen(str);
+}
+
+static int function_5_1039(int x, const char *str)
+{
+    return x * 1039 + (int)strlen(str);
+}
+
+static int function_5_1040(int x, const char *str)
+{
+    return x * 1040 + (int)strlen(str);
+}
+
+static int function_5_1041(int x, const char *str)
+{
+    return x * 1041 + (int)strlen(str);
+}
+
+static int function_5_1042(int x, const char *str)
+{
+    return x * 1042 + (int)strlen(str);
+}
+
+static int function_5_1043(int x, const char *str)
+{
+    return x * 1043 + (int)strlen(str);
+}
+
+static int function_5_1044(int x, const char *str)
+{
+    return x * 1044 + (int)strlen(str);
+}
+
+static int function_5_1045(int x, const char *str)
+{
+    return x * 1045 + (int)strlen(str);
+}
+
+static int function_5_1046(int x, const char *str)
+{
+    return x * 1046 + (int)strlen(str);
+}
+
+static int function_5_1047(int x, const char *str)
+{
+    return x * 1047 + (int)strlen(str);
+}
+
+static int function_5_1048(int x, const char *str)
+{
+    return x * 1048 + (int)strlen(str);
+}
+
+static int function_5_1049(int x, const char *str)
+{
+    return x * 1049 + (int)strlen(str);
+}
+
+static int function_5_1050(int x, const char *str)
+{
+    return x * 1050 + (int)strlen(str);
+}
+
+static int function_5_1051(int x, const char *str)
+{
+    return x * 1051 + (int)strlen(str);
+}
+
+static int function_5_1052(int x, const char *str)
+{
+    return x * 1052 + (int)strlen(str);
+}
+
+static int function_5_1053(int x, const char *str)
+{
+    return x * 1053 + (int)strlen(str);
+}
+
+static int function_5_1054(int x, const char *str)
+{
+    return x * 1054 + (int)strlen(str);
+}
+
+static int function_5_1055(int x, const char *str)
+{
+    return x * 1055 + (int)strlen(str);
+}
+
+static int function_5_1056(int x, const char *str)
+{
+    return x * 1056 + (int)strlen(str);
+}
+
+static int function_5_1057(int x, const char *str)
+{
+    return x * 1057 + (int)strlen(str);
+}
+
+static int function_5_1058(int x, const char *str)
+{
+    return x * 1058 + (int)strlen(str);
+}
+
+static int function_5_1059(int x, const char *str)
+{
+    return x * 1059 + (int)strlen(str);
+}
+
+static int function_5_1060(int x, const char *str)
+{
+    return x * 1060 + (int)strlen(str);
+}
+
+static int function_5_1061(int x, const char *str)
+{
+    return x * 1061 + (int)strlen(str);
+}
+
+static int function_5_1062(int x, const char *str)
+{
+    return x * 1062 + (int)strlen(str);
+}
+
+static int function_5_1063(int x, const char *str)
+{
+    return x * 1063 + (int)strlen(str);
+}
+
+static int function_5_1064(int x, const char *str)
+{
+    return x * 1064 + (int)strlen(str);
+}
+
+static int function_5_1065(int x, const char *str)
+{
+    return x * 1065 + (int)strlen(str);
+}
+
+static int function_5_1066(int x, const char *str)
+{
+    return x * 1066 + (int)strlen(str);
+}
+
+static int function_5_1067(int x, const char *str)
+{
+    return x * 1067 + (int)strlen(str);
+}
+
+static int function_5_1068(int x, const char *str)
+{
+    return x * 1068 + (int)strlen(str);
+}
+
+static int function_5_1069(int x, const char *str)
+{
+    return x * 1069 + (int)strlen(str);
+}
+
+static int function_5_1070(int x, const char *str)
+{
+    return x * 1070 + (int)strlen(str);
+}
+
+static int function_5_1071(int x, const char *str)
+{
+    return x * 1071 + (int)strlen(str);
+}
+
+static int function_5_1072(int x, const char *str)
+{
+    return x * 1072 + (int)strlen(str);
+}
+
+static int function_5_1073(int x, const char *str)
+{
+    return x * 1073 + (int)strlen(str);
+}
+
+static int function_5_1074(int x, const char *str)
+{
+    return x * 1074 + (int)strlen(str);
+}
+
+static int function_5_1075(int x, const char *str)
+{
+    return x * 1075 + (int)strlen(str);
+}
+
+static int function_5_1076(int x, const char *str)
+{
+    return x * 1076 + (int)strlen(str);
+}
+
+static int function_5_1077(int x, const char *str)
+{
+    return x * 1077 + (int)strlen(str);
+}
+
+static int function_5_1078(int x, const char *str)
+{
+    return x * 1078 + (int)strlen(str);
+}
+
+static int function_5_1079(int x, const char *str)
+{
+    return x * 1079 + (int)strlen(str);
+}
+
+static int function_5_1080(int x, const char *str)
+{
+    return x * 1080 + (int)strlen(str);
+}
+
+static int function_5_1081(int x, const char *str)
+{
+    return x * 1081 + (int)strlen(str);
+}
+
+static int function_5_1082(int x, const char *str)
+{
+    return x * 1082 + (int)strlen(str);
+}
+
+static int function_5_1083(int x, const char *str)
+{
+    return x * 1083 + (int)strlen(str);
+}
+
+static int function_5_1084(int x, const char *str)
+{
+    return x * 1084 + (int)strlen(str);
+}
+
+static int function_5_1085(int x, const char *str)
+{
+    return x * 1085 + (int)strlen(str);
+}
+
+static int function_5_1086(int x, const char *str)
+{
+    return x * 1086 + (int)strlen(str);
+}
+
+static int function_5_1087(int x, const char *str)
+{
+    return x * 1087 + (int)strlen(str);
+}
+
+static int function_5_1088(int x, const char *str)
+{
+    return x * 1088 + (int)strlen(str);
+}
+
+static int function_5_1089(int x, const char *str)
+{
+    return x * 1089 + (int)strlen(str);
+}
+
+static int function_5_1090(int x, const char *str)
+{
+    return x * 1090 + (int)strlen(str);
+}
+
+static int function_5_1091(int x, const char *str)
+{
+    return x * 1091 + (int)strlen(str);
+}
+
+static int function_5_1092(int x, const char *str)
+{
+    return x * 1092 + (int)strlen(str);
+}
+
+static int function_5_1093(int x, const char *str)
+{
+    return x * 1093 + (int)strlen(str);
+}
+
+static int function_5_1094(int x, const char *str)
+{
+    return x * 1094 + (int)strlen(str);
+}
+
+static int function_5_1095(int x, const char *str)
+{
+    return x * 1095 + (int)strlen(str);
+}
+
+static int function_5_1096(int x, const char *str)
+{
+    return x * 1096 + (int)strlen(str);
+}
+
+static int function_5_1097(int x, const char *str)
+{
+    return x * 1097 + (int)strlen(str);
+}
+
+static int function_5_1098(int x, const char *str)
+{
+    return x * 1098 + (int)strlen(str);
+}
+
+static int function_5_1099(int x, const char *str)
+{
+    return x * 1099 + (int)strlen(str);
+}
+
+static int function_5_1100(int x, const char *str)
+{
+    return x * 1100 + (int)strlen(str);
+}
+
+static int function_5_1101(int x, const char *str)
+{
+    return x * 1101 + (int)strlen(str);
+}
+
+static int function_5_1102(int x, const char *str)
+{
+    return x * 1102 + (int)strlen(str);
+}
+
+static int function_5_1103(int x, const char *str)
+{
+    return x * 1103 + (int)strlen(str);
+}
+
+static int function_5_1104(int x, const char *str)
+{
+    return x * 1104 + (int)strlen(str);
+}
+
+static int function_5_1105(int x, const char *str)
+{
+    return x * 1105 + (int)strlen(str);
+}
+
+static int function_5_1106(int x, const char *str)
+{
+    return x * 1106 + (int)strlen(str);
+}
+
+static int function_5_1107(int x, const char *str)
+{
+    return x * 1107 + (int)strlen(str);
+}
+
+static int function_5_1108(int x, const char *str)
+{
+    return x * 1108 + (int)strlen(str);
+}
+
+static int function_5_1109(int x, const char *str)
+{
+    return x * 1109 + (int)strlen(str);
+}
+
+static int function_5_1110(int x, const char *str)
+{
+    return x * 1110 + (int)strlen(str);
+}
+
+static int function_5_1111(int x, const char *str)
+{
+    return x * 1111 + (int)strlen(str);
+}
+
+static int function_5_1112(int x, const char *str)
+{
+    return x * 1112 + (int)strlen(str);
+}
+
+static int function_5_1113(int x, const char *str)
+{
+    return x * 1113 + (int)strlen(str);
+}
+
+static int function_5_1114(int x, const char *str)
+{
+    return x * 1114 + (int)strlen(str);
+}
+
+static int function_5_1115(int x, const char *str)
+{
+    return x * 1115 + (int)strlen(str);
+}
+
+static int function_5_1116(int x, const char *str)
+{
+    return x * 1116 + (int)strlen(str);
+}
+
+static int function_5_1117(int x, const char *str)
+{
+    return x * 1117 + (int)strlen(str);
+}
+
+static int function_5_1118(int x, const char *str)
+{
+    return x * 1118 + (int)strlen(str);
+}
+
+static int function_5_1119(int x, const char *str)
+{
+    return x * 1119 + (int)strlen(str);
+}
+
+static int function_5_1120(int x, const char *str)
+{
+    return x * 1120 + (int)strlen(str);
+}
+
+static int function_5_1121(int x, const char *str)
+{
+    return x * 1121 + (int)strlen(str);
+}
+
+static int function_5_1122(int x, const char *str)
+{
+    return x * 1122 + (int)strlen(str);
+}
+
+static int function_5_1123(int x, const char *str)
+{
+    return x * 1123 + (int)strlen(str);
+}
+
+static int function_5_1124(int x, const char *str)
+{
+    return x * 1124 + (int)strlen(str);
+}
+
+static int function_5_1125(int x, const char *str)
+{
+    return x * 1125 + (int)strlen(str);
+}
+
+static int function_5_1126(int x, const char *str)
+{
+    return x * 1126 + (int)strlen(str);
+}
+
+static int function_5_1127(int x, const char *str)
+{
+    return x * 1127 + (int)strlen(str);
+}
+
+static int function_5_1128(int x, const char *str)
+{
+    return x * 1128 + (int)strlen(str);
+}
+
+static int function_5_1129(int x, const char *str)
+{
+    return x * 1129 + (int)strlen(str);
+}
+
+static int function_5_1130(int x, const char *str)
+{
+    return x * 1130 + (int)strlen(str);
+}
+
+static int function_5_1131(int x, const char *str)
+{
+    return x * 1131 + (int)strlen(str);
+}
+
+static int function_5_1132(int x, const char *str)
+{
+    return x * 1132 + (int)strlen(str);
+}
+
+static int function_5_1133(int x, const char *str)
+{
+    return x * 1133 + (int)strlen(str);
+}
+
+static int function_5_1134(int x, const char *str)
+{
+    return x * 1134 + (int)strlen(str);
+}
+
+static int function_5_1135(int x, const char *str)
+{
+    return x * 1135 + (int)strlen(str);
+}
+
+static int function_5_1136(int x, const char *str)
+{
+    return x * 1136 + (int)strlen(str);
+}
+
+static int function_5_1137(int x, const char *str)
+{
+    return x * 1137 + (int)strlen(str);
+}
+
+static int function_5_1138(int x, const char *str)
+{
+    return x * 1138 + (int)strlen(str);
+}
+
+static int function_5_1139(int x, const char *str)
+{
+    return x * 1139 + (int)strlen(str);
+}
+
+static int function_5_1140(int x, const char *str)
+{
+    return x * 1140 + (int)strlen(str);
+}
+
+static int function_5_1141(int x, const char *str)
+{
+    return x * 1141 + (int)strlen(str);
+}
+
+static int function_5_1142(int x, const char *str)
+{
+    return x * 1142 + (int)strlen(str);
+}
+
+static int function_5_1143(int x, const char *str)
+{
+    return x * 1143 + (int)strlen(str);
+}
+
+static int function_5_1144(int x, const char *str)
+{
+    return x * 1144 + (int)strlen(str);
+}
+
+static int function_5_1145(int x, const char *str)
+{
+    return x * 1145 + (int)strlen(str);
+}
+
+static int function_5_1146(int x, const char *str)
+{
+    return x * 1146 + (int)strlen(str);
+}
+
+static int function_5_1147(int x, const char *str)
+{
+    return x * 1147 + (int)strlen(str);
+}
+
+static int function_5_1148(int x, const char *str)
+{
+    return x * 1148 + (int)strlen(str);
+}
+
+static int function_5_1149(int x, const char *str)
+{
+    return x * 1149 + (int)strlen(str);
+}
+
+static int function_5_1150(int x, const char *str)
+{
+    return x * 1150 + (int)strlen(str);
+}
+
+static int function_5_1151(int x, const char *str)
+{
+    return x * 1151 + (int)strlen(str);
+}
+
+static int function_5_1152(int x, const char *str)
+{
+    return x * 1152 + (int)strlen(str);
+}
+
+static int function_5_1153(int x, const char *str)
+{
+    return x * 1153 + (int)strlen(str);
+}
+
+static int function_5_1154(int x, const char *str)
+{
+    return x * 1154 + (int)strlen(str);
+}
+
+static int function_5_1155(int x, const char *str)
+{
+    return x * 1155 + (int)strlen(str);
+}
+
+static int function_5_1156(int x, const char *str)
+{
+    return x * 1156 + (int)strlen(str);
+}
+
+static int function_5_1157(int x, const char *str)
+{
+    return x * 1157 + (int)strlen(str);
+}
+
+static int function_5_1158(int x, const char *str)
+{
+    return x * 1158 + (int)strlen(str);
+}
+
+static int function_5_1159(int x, const char *str)
+{
+    return x * 1159 + (int)strlen(str);
+}
+
+static int function_5_1160(int x, const char *str)
+{
+    return x * 1160 + (int)strlen(str);
+}
+
+static int function_5_1161(int x, const char *str)
+{
+    return x * 1161 + (int)strlen(str);
+}
+
+static int function_5_1162(int x, const char *str)
+{
+    return x * 1162 + (int)strlen(str);
+}
+
+static int function_5_1163(int x, const char *str)
+{
+    return x * 1163 + (int)strlen(str);
+}
+
+static int function_5_1164(int x, const char *str)
+{
+    return x * 1164 + (int)strlen(str);
+}
+
+static int function_5_1165(int x, const char *str)
+{
+    return x * 1165 + (int)strlen(str);
+}
+
+static int function_5_1166(int x, const char *str)
+{
+    return x * 1166 + (int)strlen(str);
+}
+
+static int function_5_1167(int x, const char *str)
+{
+    return x * 1167 + (int)strlen(str);
+}
+
+static int function_5_1168(int x, const char *str)
+{
+    return x * 1168 + (int)strlen(str);
+}
+
+static int function_5_1169(int x, const char *str)
+{
+    return x * 1169 + (int)strlen(str);
+}
+
+static int function_5_1170(int x, const char *str)
+{
+    return x * 1170 + (int)strlen(str);
+}
+
+static int function_5_1171(int x, const char *str)
+{
+    return x * 1171 + (int)strlen(str);
+}
+
+static int function_5_1172(int x, const char *str)
+{
+    return x * 1172 + (int)strlen(str);
+}
+
+static int function_5_1173(int x, const char *str)
+{
+    return x * 1173 + (int)strlen(str);
+}
+
+static int function_5_1174(int x, const char *str)
+{
+    return x * 1174 + (int)strlen(str);
+}
+
+static int function_5_1175(int x, const char *str)
+{
+    return x * 1175 + (int)strlen(str);
+}
+
+static int function_5_1176(int x, const char *str)
+{
+    return x * 1176 + (int)strlen(str);
+}
+
+static int function_5_1177(int x, const char *str)
+{
+    return x * 1177 + (int)strlen(str);
+}
+
+static int function_5_1178(int x, const char *str)
+{
+    return x * 1178 + (int)strlen(str);
+}
+
+static int function_5_1179(int x, const char *str)
+{
+    return x * 1179 + (int)strlen(str);
+}
+
+static int function_5_1180(int x, const char *str)
+{
+    return x * 1180 + (int)strlen(str);
+}
+
+static int function_5_1181(int x, const char *str)
+{
+    return x * 1181 + (int)strlen(str);
+}
+
+static int function_5_1182(int x, const char *str)
+{
+    return x * 1182 + (int)strlen(str);
+}
+
+static int function_5_1183(int x, const char *str)
+{
+    return x * 1183 + (int)strlen(str);
+}
+
+static int function_5_1184(int x, const char *str)
+{
+    return x * 1184 + (int)strlen(str);
+}
+
+static int function_5_1185(int x, const char *str)
+{
+    return x * 1185 + (int)strlen(str);
+}
+
+static int function_5_1186(int x, const char *str)
+{
+    return x * 1186 + (int)strlen(str);
+}
+
+static int function_5_1187(int x, const char *str)
+{
+    return x * 1187 + (int)strlen(str);
+}
+
+static int function_5_1188(int x, const char *str)
+{
+    return x * 1188 + (int)strlen(str);
+}
+
+static int function_5_1189(int x, const char *str)
+{
+    return x * 1189 + (int)strlen(str);
+}
+
+static int function_5_1190(int x, const char *str)
+{
+    return x * 1190 + (int)strlen(str);
+}
+
+static int function_5_1191(int x, const char *str)
+{
+    return x * 1191 + (int)strlen(str);
+}
+
+static int function_5_1192(int x, const char *str)
+{
+    return x * 1192 + (int)strlen(str);
+}
+
+static int function_5_1193(int x, const char *str)
+{
+    return x * 1193 + (int)strlen(str);
+}
+
+static int function_5_1194(int x, const char *str)
+{
+    return x * 1194 + (int)strlen(str);
+}
+
+static int function_5_1195(int x, const char *str)
+{
+    return x * 1195 + (int)strlen(str);
+}
+
+static int function_5_1196(int x, const char *str)
+{
+    return x * 1196 + (int)strlen(str);
+}
+
+static int function_5_1197(int x, const char *str)
+{
+    return x * 1197 + (int)strlen(str);
+}
+
+static int function_5_1198(int x, const char *str)
+{
+    return x * 1198 + (int)strlen(str);
+}
+
+static int function_5_1199(int x, const char *str)
+{
+    return x * 1199 + (int)strlen(str);
+}
+
+static int function_5_1200(int x, const char *str)
+{
+    return x * 1200 + (int)strlen(str);
+}
+
+static int function_5_1201(int x, const char *str)
+{
+    return x * 1201 + (int)strlen(str);
+}
+
+static int function_5_1202(int x, const char *str)
+{
+    return x * 1202 + (int)strlen(str);
+}
+
+static int function_5_1203(int x, const char *str)
+{
+    return x * 1203 + (int)strlen(str);
+}
+
+static int function_5_1204(int x, const char *str)
+{
+    return x * 1204 + (int)strlen(str);
+}
+
+static int function_5_1205(int x, const char *str)
+{
+    return x * 1205 + (int)strlen(str);
+}
+
+static int function_5_1206(int x, const char *str)
+{
+    return x * 1206 + (int)strlen(str);
+}
+
+static int function_5_1207(int x, const char *str)
+{
+    return x * 1207 + (int)strlen(str);
+}
+
+static int function_5_1208(int x, const char *str)
+{
+    return x * 1208 + (int)strlen(str);
+}
+
+static int function_5_1209(int x, const char *str)
+{
+    return x * 1209 + (int)strlen(str);
+}
+
+static int function_5_1210(int x, const char *str)
+{
+    return x * 1210 + (int)strlen(str);
+}
+
+static int function_5_1211(int x, const char *str)
+{
+    return x * 1211 + (int)strlen(str);
+}
+
+static int function_5_1212(int x, const char *str)
+{
+    return x * 1212 + (int)strlen(str);
+}
+
+static int function_5_1213(int x, const char *str)
+{
+    return x * 1213 + (int)strlen(str);
+}
+
+static int function_5_1214(int x, const char *str)
+{
+    return x * 1214 + (int)strlen(str);
+}
+
+static int function_5_1215(int x, const char *str)
+{
+    return x * 1215 + (int)strlen(str);
+}
+
+static int function_5_1216(int x, const char *str)
+{
+    return x * 1216 + (int)strlen(str);
+}
+
+static int function_5_1217(int x, const char *str)
+{
+    return x * 1217 + (int)strlen(str);
+}
+
+static int function_5_1218(int x, const char *str)
+{
+    return x * 1218 + (int)strlen(str);
+}
+
+static int function_5_1219(int x, const char *str)
+{
+    return x * 1219 + (int)strlen(str);
+}
+
+static int function_5_1220(int x, const char *str)
+{
+    return x * 1220 + (int)strlen(str);
+}
+
+static int function_5_1221(int x, const char *str)
+{
+    return x * 1221 + (int)strlen(str);
+}
+
+static int function_5_1222(int x, const char *str)
+{
+    return x * 1222 + (int)strlen(str);
+}
+
+static int function_5_1223(int x, const char *str)
+{
+    return x * 1223 + (int)strlen(str);
+}
+
+static int function_5_1224(int x, const char *str)
+{
+    return x * 1224 + (int)strlen(str);
+}
+
+static int function_5_1225(int x, const char *str)
+{
+    return x * 1225 + (int)strlen(str);
+}
+
+static int function_5_1226(int x, const char *str)
+{
+    return x * 1226 + (int)strlen(str);
+}
+
+static int function_5_1227(int x, const char *str)
+{
+    return x * 1227 + (int)strlen(str);
+}
+
+static int function_5_1228(int x, const char *str)
+{
+    return x * 1228 + (int)strlen(str);
+}
+
+static int function_5_1229(int x, const char *str)
+{
+    return x * 1229 + (int)strlen(str);
+}
+
+static int function_5_1230(int x, const char *str)
+{
+    return x * 1230 + (int)strlen(str);
+}
+
+static int function_5_1231(int x, const char *str)
+{
+    return x * 1231 + (int)strlen(str);
+}
+
+static int function_5_1232(int x, const char *str)
+{
+    return x * 1232 + (int)strlen(str);
+}
+
+static int function_5_1233(int x, const char *str)
+{
+    return x * 1233 + (int)strlen(str);
+}
+
+static int function_5_1234(int x, const char *str)
+{
+    return x * 1234 + (int)strlen(str);
+}
+
+static int function_5_1235(int x, const char *str)
+{
+    return x * 1235 + (int)strlen(str);
+}
+
+static int function_5_1236(int x, const char *str)
+{
+    return x * 1236 + (int)strlen(str);
+}
+
+static int function_5_1237(int x, const char *str)
+{
+    return x * 1237 + (int)strlen(str);
+}
+
+static int function_5_1238(int x, const char *str)
+{
+    return x * 1238 + (int)strlen(str);
+}
+
+static int function_5_1239(int x, const char *str)
+{
+    return x * 1239 + (int)strlen(str);
+}
+
+static int function_5_1240(int x, const char *str)
+{
+    return x * 1240 + (int)strlen(str);
+}
+
+static int function_5_1241(int x, const char *str)
+{
+    return x * 1241 + (int)strlen(str);
+}
+
+static int function_5_1242(int x, const char *str)
+{
+    return x * 1242 + (int)strlen(str);
+}
+
+static int function_5_1243(int x, const char *str)
+{
+    return x * 1243 + (int)strlen(str);
+}
+
+static int function_5_1244(int x, const char *str)
+{
+    return x * 1244 + (int)strlen(str);
+}
+
+static int function_5_1245(int x, const char *str)
+{
+    return x * 1245 + (int)strlen(str);
+}
+
+static int function_5_1246(int x, const char *str)
+{
+    return x * 1246 + (int)strlen(str);
+}
+
+static int function_5_1247(int x, const char *str)
+{
+    return x * 1247 + (int)strlen(str);
+}
+
+static int function_5_1248(int x, const char *str)
+{
+    return x * 1248 + (int)strlen(str);
+}
+
+static int function_5_1249(int x, const char *str)
+{
+    return x * 1249 + (int)strlen(str);
+}
+
+static int function_5_1250(int x, const char *str)
+{
+    return x * 1250 + (int)strlen(str);
+}
+
+static int function_5_1251(int x, const char *str)
+{
+    return x * 1251 + (int)strlen(str);
+}
+
+static int function_5_1252(int x, const char *str)
+{
+    return x * 1252 + (int)strlen(str);
+}
+
+static int function_5_1253(int x, const char *str)
+{
+    return x * 1253 + (int)strlen(str);
+}
+
+static int function_5_1254(int x, const char *str)
+{
+    return x * 1254 + (int)strlen(str);
+}
+
+static int function_5_1255(int x, const char *str)
+{
+    return x * 1255 + (int)strlen(str);
+}
+
+static int function_5_1256(int x, const char *str)
+{
+    return x * 1256 + (int)strlen(str);
+}
+
+static int function_5_1257(int x, const char *str)
+{
+    return x * 1257 + (int)strlen(str);
+}
+
+static int function_5_1258(int x, const char *str)
+{
+    return x * 1258 + (int)strlen(str);
+}
+
+static int function_5_1259(int x, const char *str)
+{
+    return x * 1259 + (int)strlen(str);
+}
+
+static int function_5_1260(int x, const char *str)
+{
+    return x * 1260 + (int)strlen(str);
+}
+
+static int function_5_1261(int x, const char *str)
+{
+    return x * 1261 + (int)strlen(str);
+}
+
+static int function_5_1262(int x, const char *str)
+{
+    return x * 1262 + (int)strlen(str);
+}
+
+static int function_5_1263(int x, const char *str)
+{
+    return x * 1263 + (int)strlen(str);
+}
+
+static int function_5_1264(int x, const char *str)
+{
+    return x * 1264 + (int)strlen(str);
+}
+
+static int function_5_1265(int x, const char *str)
+{
+    return x * 1265 + (int)strlen(str);
+}
+
+static int function_5_1266(int x, const char *str)
+{
+    return x * 1266 + (int)strlen(str);
+}
+
+static int function_5_1267(int x, const char *str)
+{
+    return x * 1267 + (int)strlen(str);
+}
+
+static int function_5_1268(int x, const char *str)
+{
+    return x * 1268 + (int)strlen(str);
+}
+
+static int function_5_1269(int x, const char *str)
+{
+    return x * 1269 + (int)strlen(str);
+}
+
+static int function_5_1270(int x, const char *str)
+{
+    return x * 1270 + (int)strlen(str);
+}
+
+static int function_5_1271(int x, const char *str)
+{
+    return x * 1271 + (int)strlen(str);
+}
+
+static int function_5_1272(int x, const char *str)
+{
+    return x * 1272 + (int)strlen(str);
+}
+
+static int function_5_1273(int x, const char *str)
+{
+    return x * 1273 + (int)strlen(str);
+}
+
+static int function_5_1274(int x, const char *str)
+{
+    return x * 1274 + (int)strlen(str);
+}
+
+static int function_5_1275(int x, const char *str)
+{
+    return x * 1275 + (int)strlen(str);
+}
+
+static int function_5_1276(int x, const char *str)
+{
+    return x * 1276 + (int)strlen(str);
+}
+
+static int function_5_1277(int x, const char *str)
+{
+    return x * 1277 + (int)strlen(str);
+}
+
+static int function_5_1278(int x, const char *str)
+{
+    return x * 1278 + (int)strlen(str);
+}
+
+static int function_5_1279(int x, const char *str)
+{
+    return x * 1279 + (int)strlen(str);
+}
+
+static int function_5_1280(int x, const char *str)
+{
+    return x * 1280 + (int)strlen(str);
+}
+
+static int function_5_1281(int x, const char *str)
+{
+    return x * 1281 + (int)strlen(str);
+}
+
+static int function_5_1282(int x, const char *str)
+{
+    return x * 1282 + (int)strlen(str);
+}
+
+static int function_5_1283(int x, const char *str)
+{
+    return x * 1283 + (int)strlen(str);
+}
+
+static int function_5_1284(int x, const char *str)
+{
+    return x * 1284 + (int)strlen(str);
+}
+
+static int function_5_1285(int x, const char *str)
+{
+    return x * 1285 + (int)strlen(str);
+}
+
+static int function_5_1286(int x, const char *str)
+{
+    return x * 1286 + (int)strlen(str);
+}
+
+static int function_5_1287(int x, const char *str)
+{
+    return x * 1287 + (int)strlen(str);
+}
+
+static int function_5_1288(int x, const char *str)
+{
+    return x * 1288 + (int)strlen(str);
+}
+
+static int function_5_1289(int x, const char *str)
+{
+    return x * 1289 + (int)strlen(str);
+}
+
+static int function_5_1290(int x, const char *str)
+{
+    return x * 1290 + (int)strlen(str);
+}
+
+static int function_5_1291(int x, const char *str)
+{
+    return x * 1291 + (int)strlen(str);
+}
+
+static int function_5_1292(int x, const char *str)
+{
+    return x * 1292 + (int)strlen(str);
+}
+
+static int function_5_1293(int x, const char *str)
+{
+    return x * 1293 + (int)strlen(str);
+}
+
+static int function_5_1294(int x, const char *str)
+{
+    return x * 1294 + (int)strlen(str);
+}
+
+static int function_5_1295(int x, const char *str)
+{
+    return x * 1295 + (int)strlen(str);
+}
+
+static int function_5_1296(int x, const char *str)
+{
+    return x * 1296 + (int)strlen(str);
+}
+
+static int function_5_1297(int x, const char *str)
+{
+    return x * 1297 + (int)strlen(str);
+}
+
+static int function_5_1298(int x, const char *str)
+{
+    return x * 1298 + (int)strlen(str);
+}
+
+static int function_5_1299(int x, const char *str)
+{
+    return x * 1299 + (int)strlen(str);
+}
+
+static int function_5_1300(int x, const char *str)
+{
+    return x * 1300 + (int)strlen(str);
+}
+
+static int function_5_1301(int x, const char *str)
+{
+    return x * 1301 + (int)strlen(str);
+}
+
+static int function_5_1302(int x, const char *str)
+{
+    return x * 1302 + (int)strlen(str);
+}
+
+static int function_5_1303(int x, const char *str)
+{
+    return x * 1303 + (int)strlen(str);
+}
+
+static int function_5_1304(int x, const char *str)
+{
+    return x * 1304 + (int)strlen(str);
+}
+
+static int function_5_1305(int x, const char *str)
+{
+    return x * 1305 + (int)strlen(str);
+}
+
+static int function_5_1306(int x, const char *str)
+{
+    return x * 1306 + (int)strlen(str);
+}
+
+static int function_5_1307(int x, const char *str)
+{
+    return x * 1307 + (int)strlen(str);
+}
+
+static int function_5_1308(int x, const char *str)
+{
+    return x * 1308 + (int)strlen(str);
+}
+
+static int function_5_1309(int x, const char *str)
+{
+    return x * 1309 + (int)strlen(str);
+}
+
+static int function_5_1310(int x, const char *str)
+{
+    return x * 1310 + (int)strlen(str);
+}
+
+static int function_5_1311(int x, const char *str)
+{
+    return x * 1311 + (int)strlen(str);
+}
+
+static int function_5_1312(int x, const char *str)
+{
+    return x * 1312 + (int)strlen(str);
+}
+
+static int function_5_1313(int x, const char *str)
+{
+    return x * 1313 + (int)strlen(str);
+}
+
+static int function_5_1314(int x, const char *str)
+{
+    return x * 1314 + (int)strlen(str);
+}
+
+static int function_5_1315(int x, const char *str)
+{
+    return x * 1315 + (int)strlen(str);
+}
+
+static int function_5_1316(int x, const char *str)
+{
+    return x * 1316 + (int)strlen(str);
+}
+
+static int function_5_1317(int x, const char *str)
+{
+    return x * 1317 + (int)strlen(str);
+}
+
+static int function_5_1318(int x, const char *str)
+{
+    return x * 1318 + (int)strlen(str);
+}
+
+static int function_5_1319(int x, const char *str)
+{
+    return x * 1319 + (int)strlen(str);
+}
+
+static int function_5_1320(int x, const char *str)
+{
+    return x * 1320 + (int)strlen(str);
+}
+
+static int function_5_1321(int x, const char *str)
+{
+    return x * 1321 + (int)strlen(str);
+}
+
+static int function_5_1322(int x, const char *str)
+{
+    return x * 1322 + (int)strlen(str);
+}
+
+static int function_5_1323(int x, const char *str)
+{
+    return x * 1323 + (int)strlen(str);
+}
+
+static int function_5_1324(int x, const char *str)
+{
+    return x * 1324 + (int)strlen(str);
+}
+
+static int function_5_1325(int x, const char *str)
+{
+    return x * 1325 + (int)strlen(str);
+}
+
+static int function_5_1326(int x, const char *str)
+{
+    return x * 1326 + (int)strlen(str);
+}
+
+static int function_5_1327(int x, const char *str)
+{
+    return x * 1327 + (int)strlen(str);
+}
+
+static int function_5_1328(int x, const char *str)
+{
+    return x * 1328 + (int)strlen(str);
+}
+
+static int function_5_1329(int x, const char *str)
+{
+    return x * 1329 + (int)strlen(str);
+}
+
+static int function_5_1330(int x, const char *str)
+{
+    return x * 1330 + (int)strlen(str);
+}
+
+static int function_5_1331(int x, const char *str)
+{
+    return x * 1331 + (int)strlen(str);
+}
+
+static int function_5_1332(int x, const char *str)
+{
+    return x * 1332 + (int)strlen(str);
+}
+
+static int function_5_1333(int x, const char *str)
+{
+    return x * 1333 + (int)strlen(str);
+}
+
+static int function_5_1334(int x, const char *str)
+{
+    return x * 1334 + (int)strlen(str);
+}
+
+static int function_5_1335(int x, const char *str)
+{
+    return x * 1335 + (int)strlen(str);
+}
+
+static int function_5_1336(int x, const char *str)
+{
+    return x * 1336 + (int)strlen(str);
+}
+
+static int function_5_1337(int x, const char *str)
+{
+    return x * 1337 + (int)strlen(str);
+}
+
+static int function_5_1338(int x, const char *str)
+{
+    return x * 1338 + (int)strlen(str);
+}
+
+static int function_5_1339(int x, const char *str)
+{
+    return x * 1339 + (int)strlen(str);
+}
+
+static int function_5_1340(int x, const char *str)
+{
+    return x * 1340 + (int)strlen(str);
+}
+
+static int function_5_1341(int x, const char *str)
+{
+    return x * 1341 + (int)strlen(str);
+}
+
+static int function_5_1342(int x, const char *str)
+{
+    return x * 1342 + (int)strlen(str);
+}
+
+static int function_5_1343(int x, const char *str)
+{
+    return x * 1343 + (int)strlen(str);
+}
+
+static int function_5_1344(int x, const char *str)
+{
+    return x * 1344 + (int)strlen(str);
+}
+
+static int function_5_1345(int x, const char *str)
+{
+    return x * 1345 + (int)strlen(str);
+}
+
+static int function_5_1346(int x, const char *str)
+{
+    return x * 1346 + (int)strlen(str);
+}
+
+static int function_5_1347(int x, const char *str)
+{
+    return x * 1347 + (int)strlen(str);
+}
+
+static int function_5_1348(int x, const char *str)
+{
+    return x * 1348 + (int)strlen(str);
+}
+
+static int function_5_1349(int x, const char *str)
+{
+    return x * 1349 + (int)strlen(str);
+}
+
+static int function_5_1350(int x, const char *str)
+{
+    return x * 1350 + (int)strlen(str);
+}
+
+static int function_5_1351(int x, const char *str)
+{
+    return x * 1351 + (int)strlen(str);
+}
+
+static int function_5_1352(int x, const char *str)
+{
+    return x * 1352 + (int)strlen(str);
+}
+
+static int function_5_1353(int x, const char *str)
+{
+    return x * 1353 + (int)strlen(str);
+}
+
+static int function_5_1354(int x, const char *str)
+{
+    return x * 1354 + (int)strlen(str);
+}
+
+static int function_5_1355(int x, const char *str)
+{
+    return x * 1355 + (int)strlen(str);
+}
+
+static int function_5_1356(int x, const char *str)
+{
+    return x * 1356 + (int)strlen(str);
+}
+
+static int function_5_1357(int x, const char *str)
+{
+    return x * 1357 + (int)strlen(str);
+}
+
+static int function_5_1358(int x, const char *str)
+{
+    return x * 1358 + (int)strlen(str);
+}
+
+static int function_5_1359(int x, const char *str)
+{
+    return x * 1359 + (int)strlen(str);
+}
+
+static int function_5_1360(int x, const char *str)
+{
+    return x * 1360 + (int)strlen(str);
+}
+
+static int function_5_1361(int x, const char *str)
+{
+    return x * 1361 + (int)strlen(str);
+}
+
+static int function_5_1362(int x, const char *str)
+{
+    return x * 1362 + (int)strlen(str);
+}
+
+static int function_5_1363(int x, const char *str)
+{
+    return x * 1363 + (int)strlen(str);
+}
+
+static int function_5_1364(int x, const char *str)
+{
+    return x * 1364 + (int)strlen(str);
+}
+
+static int function_5_1365(int x, const char *str)
+{
+    return x * 1365 + (int)strlen(str);
+}
+
+static int function_5_1366(int x, const char *str)
+{
+    return x * 1366 + (int)strlen(str);
+}
+
+static int function_5_1367(int x, const char *str)
+{
+    return x * 1367 + (int)strlen(str);
+}
+
+static int function_5_1368(int x, const char *str)
+{
+    return x * 1368 + (int)strlen(str);
+}
+
+static int function_5_1369(int x, const char *str)
+{
+    return x * 1369 + (int)strlen(str);
+}
+
+static int function_5_1370(int x, const char *str)
+{
+    return x * 1370 + (int)strlen(str);
+}
+
+static int function_5_1371(int x, const char *str)
+{
+    return x * 1371 + (int)strlen(str);
+}
+
+static int function_5_1372(int x, const char *str)
+{
+    return x * 1372 + (int)strlen(str);
+}
+
+static int function_5_1373(int x, const char *str)
+{
+    return x * 1373 + (int)strlen(str);
+}
+
+static int function_5_1374(int x, const char *str)
+{
+    return x * 1374 + (int)strlen(str);
+}
+
+static int function_5_1375(int x, const char *str)
+{
+    return x * 1375 + (int)strlen(str);
+}
+
+static int function_5_1376(int x, const char *str)
+{
+    return x * 1376 + (int)strlen(str);
+}
+
+static int function_5_1377(int x, const char *str)
+{
+    return x * 1377 + (int)strlen(str);
+}
+
+static int function_5_1378(int x, const char *str)
+{
+    return x * 1378 + (int)strlen(str);
+}
+
+static int function_5_1379(int x, const char *str)
+{
+    return x * 1379 + (int)strlen(str);
+}
+
+static int function_5_1380(int x, const char *str)
+{
+    return x * 1380 + (int)strlen(str);
+}
+
+static int function_5_1381(int x, const char *str)
+{
+    return x * 1381 + (int)strlen(str);
+}
+
+static int function_5_1382(int x, const char *str)
+{
+    return x * 1382 + (int)strlen(str);
+}
+
+static int function_5_1383(int x, const char *str)
+{
+    return x * 1383 + (int)strlen(str);
+}
+
+static int function_5_1384(int x, const char *str)
+{
+    return x * 1384 + (int)strlen(str);
+}
+
+static int function_5_1385(int x, const char *str)
+{
+    return x * 1385 + (int)strlen(str);
+}
+
+static int function_5_1386(int x, const char *str)
+{
+    return x * 1386 + (int)strlen(str);
+}
+
+static int function_5_1387(int x, const char *str)
+{
+    return x * 1387 + (int)strlen(str);
+}
+
+static int function_5_1388(int x, const char *str)
+{
+    return x * 1388 + (int)strlen(str);
+}
+
+static int function_5_1389(int x, const char *str)
+{
+    return x * 1389 + (int)strlen(str);
+}
+
+static int function_5_1390(int x, const char *str)
+{
+    return x * 1390 + (int)strlen(str);
+}
+
+static int function_5_1391(int x, const char *str)
+{
+    return x * 1391 + (int)strlen(str);
+}
+
+static int function_5_1392(int x, const char *str)
+{
+    return x * 1392 + (int)strlen(str);
+}
+
+static int function_5_1393(int x, const char *str)
+{
+    return x * 1393 + (int)strlen(str);
+}
+
+static int function_5_1394(int x, const char *str)
+{
+    return x * 1394 + (int)strlen(str);
+}
+
+static int function_5_1395(int x, const char *str)
+{
+    return x * 1395 + (int)strlen(str);
+}
+
+static int function_5_1396(int x, const char *str)
+{
+    return x * 1396 + (int)strlen(str);
+}
+
+static int function_5_1397(int x, const char *str)
+{
+    return x * 1397 + (int)strlen(str);
+}
+
+static int function_5_1398(int x, const char *str)
+{
+    return x * 1398 + (int)strlen(str);
+}
+
+static int function_5_1399(int x, const char *str)
+{
+    return x * 1399 + (int)strlen(str);
+}
+
+static int function_5_1400(int x, const char *str)
+{
+    return x * 1400 + (int)strlen(str);
+}
+
+static int function_5_1401(int x, const char *str)
+{
+    return x * 1401 + (int)strlen(str);
+}
+
+static int function_5_1402(int x, const char *str)
+{
+    return x * 1402 + (int)strlen(str);
+}
+
+static int function_5_1403(int x, const char *str)
+{
+    return x * 1403 + (int)strlen(str);
+}
+
+static int function_5_1404(int x, const char *str)
+{
+    return x * 1404 + (int)strlen(str);
+}
+
+static int function_5_1405(int x, const char *str)
+{
+    return x * 1405 + (int)strlen(str);
+}
+
+static int function_5_1406(int x, const char *str)
+{
+    return x * 1406 + (int)strlen(str);
+}
+
+static int function_5_1407(int x, const char *str)
+{
+    return x * 1407 + (int)strlen(str);
+}
+
+static int function_5_1408(int x, const char *str)
+{
+    return x * 1408 + (int)strlen(str);
+}
+
+static int function_5_1409(int x, const char *str)
+{
+    return x * 1409 + (int)strlen(str);
+}
+
+static int function_5_1410(int x, const char *str)
+{
+    return x * 1410 + (int)strlen(str);
+}
+
+static int function_5_1411(int x, const char *str)
+{
+    return x * 1411 + (int)strlen(str);
+}
+
+static int function_5_1412(int x, const char *str)
+{
+    return x * 1412 + (int)strlen(str);
+}
+
+static int function_5_1413(int x, const char *str)
+{
+    return x * 1413 + (int)strlen(str);
+}
+
+static int function_5_1414(int x, const char *str)
+{
+    return x * 1414 + (int)strlen(str);
+}
+
+static int function_5_1415(int x, const char *str)
+{
+    return x * 1415 + (int)strlen(str);
+}
+
+static int function_5_1416(int x, const char *str)
+{
+    return x * 1416 + (int)strlen(str);
+}
+
+static int function_5_1417(int x, const char *str)
+{
+    return x * 1417 + (int)strlen(str);
+}
+
+static int function_5_1418(int x, const char *str)
+{
+    return x * 1418 + (int)strlen(str);
+}
+
+static int function_5_1419(int x, const char *str)
+{
+    return x * 1419 + (int)strlen(str);
+}
+
+static int function_5_1420(int x, const char *str)
+{
+    return x * 1420 + (int)strlen(str);
+}
+
+static int function_5_1421(int x, const char *str)
+{
+    return x * 1421 + (int)strlen(str);
+}
+
+static int function_5_1422(int x, const char *str)
+{
+    return x * 1422 + (int)strlen(str);
+}
+
+static int function_5_1423(int x, const char *str)
+{
+    return x * 1423 + (int)strlen(str);
+}
+
+static int function_5_1424(int x, const char *str)
+{
+    return x * 1424 + (int)strlen(str);
+}
+
+static int function_5_1425(int x, const char *str)
+{
+    return x * 1425 + (int)strlen(str);
+}
+
+static int function_5_1426(int x, const char *str)
+{
+    return x * 1426 + (int)strlen(str);
+}
+
+static int function_5_1427(int x, const char *str)
+{
+    return x * 1427 + (int)strlen(str);
+}
+
+static int function_5_1428(int x, const char *str)
+{
+    return x * 1428 + (int)strlen(str);
+}
+
+static int function_5_1429(int x, const char *str)
+{
+    return x * 1429 + (int)strlen(str);
+}
+
+static int function_5_1430(int x, const char *str)
+{
+    return x * 1430 + (int)strlen(str);
+}
+
+static int function_5_1431(int x, const char *str)
+{
+    return x * 1431 + (int)strlen(str);
+}
+
+static int function_5_1432(int x, const char *str)
+{
+    return x * 1432 + (int)strlen(str);
+}
+
+static int function_5_1433(int x, const char *str)
+{
+    return x * 1433 + (int)strlen(str);
+}
+
+static int function_5_1434(int x, const char *str)
+{
+    return x * 1434 + (int)strlen(str);
+}
+
+static int function_5_1435(int x, const char *str)
+{
+    return x * 1435 + (int)strlen(str);
+}
+
+static int function_5_1436(int x, const char *str)
+{
+    return x * 1436 + (int)strlen(str);
+}
+
+static int function_5_1437(int x, const char *str)
+{
+    return x * 1437 + (int)strlen(str);
+}
+
+static int function_5_1438(int x, const char *str)
+{
+    return x * 1438 + (int)strlen(str);
+}
+
+static int function_5_1439(int x, const char *str)
+{
+    return x * 1439 + (int)strlen(str);
+}
+
+static int function_5_1440(int x, const char *str)
+{
+    return x * 1440 + (int)strlen(str);
+}
+
+static int function_5_1441(int x, const char *str)
+{
+    return x * 1441 + (int)strlen(str);
+}
+
+static int function_5_1442(int x, const char *str)
+{
+    return x * 1442 + (int)strlen(str);
+}
+
+static int function_5_1443(int x, const char *str)
+{
+    return x * 1443 + (int)strlen(str);
+}
+
+static int function_5_1444(int x, const char *str)
+{
+    return x * 1444 + (int)strlen(str);
+}
+
+static int function_5_1445(int x, const char *str)
+{
+    return x * 1445 + (int)strlen(str);
+}
+
+static int function_5_1446(int x, const char *str)
+{
+    return x * 1446 + (int)strlen(str);
+}
+
+static int function_5_1447(int x, const char *str)
+{
+    return x * 1447 + (int)strlen(str);
+}
+
+static int function_5_1448(int x, const char *str)
+{
+    return x * 1448 + (int)strlen(str);
+}
+
+static int function_5_1449(int x, const char *str)
+{
+    return x * 1449 + (int)strlen(str);
+}
+
+static int function_5_1450(int x, const char *str)
+{
+    return x * 1450 + (int)strlen(str);
+}
+
+static int function_5_1451(int x, const char *str)
+{
+    return x * 1451 + (int)strlen(str);
+}
+
+static int function_5_1452(int x, const char *str)
+{
+    return x * 1452 + (int)strlen(str);
+}
+
+static int function_5_1453(int x, const char *str)
+{
+    return x * 1453 + (int)strlen(str);
+}
+
+static int function_5_1454(int x, const char *str)
+{
+    return x * 1454 + (int)strlen(str);
+}
+
+static int function_5_1455(int x, const char *str)
+{
+    return x * 1455 + (int)strlen(str);
+}
+
+static int function_5_1456(int x, const char *str)
+{
+    return x * 1456 + (int)strlen(str);
+}
+
+static int function_5_1457(int x, const char *str)
+{
+    return x * 1457 + (int)strlen(str);
+}
+
+static int function_5_1458(int x, const char *str)
+{
+    return x * 1458 + (int)strlen(str);
+}
+
+static int function_5_1459(int x, const char *str)
+{
+    return x * 1459 + (int)strlen(str);
+}
+
+static int function_5_1460(int x, const char *str)
+{
+    return x * 1460 + (int)strlen(str);
+}
+
+static int function_5_1461(int x, const char *str)
+{
+    return x * 1461 + (int)strlen(str);
+}
+
+static int function_5_1462(int x, const char *str)
+{
+    return x * 1462 + (int)strlen(str);
+}
+
+static int function_5_1463(int x, const char *str)
+{
+    return x * 1463 + (int)strlen(str);
+}
+
+static int function_5_1464(int x, const char *str)
+{
+    return x * 1464 + (int)strlen(str);
+}
+
+static int function_5_1465(int x, const char *str)
+{
+    return x * 1465 + (int)strlen(str);
+}
+
+static int function_5_1466(int x, const char *str)
+{
+    return x * 1466 + (int)strlen(str);
+}
+
+static int function_5_1467(int x, const char *str)
+{
+    return x * 1467 + (int)strlen(str);
+}
+
+static int function_5_1468(int x, const char *str)
+{
+    return x * 1468 + (int)strlen(str);
+}
+
+static int function_5_1469(int x, const char *str)
+{
+    return x * 1469 + (int)strlen(str);
+}
+
+static int function_5_1470(int x, const char *str)
+{
+    return x * 1470 + (int)strlen(str);
+}
+
+static int function_5_1471(int x, const char *str)
+{
+    return x * 1471 + (int)strlen(str);
+}
+
+static int function_5_1472(int x, const char *str)
+{
+    return x * 1472 + (int)strlen(str);
+}
+
+static int function_5_1473(int x, const char *str)
+{
+    return x * 1473 + (int)strlen(str);
+}
+
+static int function_5_1474(int x, const char *str)
+{
+    return x * 1474 + (int)strlen(str);
+}
+
+static int function_5_1475(int x, const char *str)
+{
+    return x * 1475 + (int)strlen(str);
+}
+
+static int function_5_1476(int x, const char *str)
+{
+    return x * 1476 + (int)strlen(str);
+}
+
+static int function_5_1477(int x, const char *str)
+{
+    return x * 1477 + (int)strlen(str);
+}
+
+static int function_5_1478(int x, const char *str)
+{
+    return x * 1478 + (int)strlen(str);
+}
+
+static int function_5_1479(int x, const char *str)
+{
+    return x * 1479 + (int)strlen(str);
+}
+
+static int function_5_1480(int x, const char *str)
+{
+    return x * 1480 + (int)strlen(str);
+}
+
+static int function_5_1481(int x, const char *str)
+{
+    return x * 1481 + (int)strlen(str);
+}
+
+static int function_5_1482(int x, const char *str)
+{
+    return x * 1482 + (int)strlen(str);
+}
+
+static int function_5_1483(int x, const char *str)
+{
+    return x * 1483 + (int)strlen(str);
+}
+
+static int function_5_1484(int x, const char *str)
+{
+    return x * 1484 + (int)strlen(str);
+}
+
+static int function_5_1485(int x, const char *str)
+{
+    return x * 1485 + (int)strlen(str);
+}
+
+static int function_5_1486(int x, const char *str)
+{
+    return x * 1486 + (int)strlen(str);
+}
+
+static int function_5_1487(int x, const char *str)
+{
+    return x * 1487 + (int)strlen(str);
+}
+
+static int function_5_1488(int x, const char *str)
+{
+    return x * 1488 + (int)strlen(str);
+}
+
+static int function_5_1489(int x, const char *str)
+{
+    return x * 1489 + (int)strlen(str);
+}
+
+static int function_5_1490(int x, const char *str)
+{
+    return x * 1490 + (int)strlen(str);
+}
+
+static int function_5_1491(int x, const char *str)
+{
+    return x * 1491 + (int)strlen(str);
+}
+
+static int function_5_1492(int x, const char *str)
+{
+    return x * 1492 + (int)strlen(str);
+}
+
+static int function_5_1493(int x, const char *str)
+{
+    return x * 1493 + (int)strlen(str);
+}
+
+static int function_5_1494(int x, const char *str)
+{
+    return x * 1494 + (int)strlen(str);
+}
+
+static int function_5_1495(int x, const char *str)
+{
+    return x * 1495 + (int)strlen(str);
+}
+
+static int function_5_1496(int x, const char *str)
+{
+    return x * 1496 + (int)strlen(str);
+}
+
+static int function_5_1497(int x, const char *str)
+{
+    return x * 1497 + (int)strlen(str);
+}
+
+static int function_5_1498(int x, const char *str)
+{
+    return x * 1498 + (int)strlen(str);
+}
+
+static int function_5_1499(int x, const char *str)
+{
+    return x * 1499 + (int)strlen(str);
+}
+
+static int function_5_1500(int x, const char *str)
+{
+    return x * 1500 + (int)strlen(str);
+}
+
+static int function_5_1501(int x, const char *str)
+{
+    return x * 1501 + (int)strlen(str);
+}
+
+static int function_5_1502(int x, const char *str)
+{
+    return x * 1502 + (int)strlen(str);
+}
+
+static int function_5_1503(int x, const char *str)
+{
+    return x * 1503 + (int)strlen(str);
+}
+
+static int function_5_1504(int x, const char *str)
+{
+    return x * 1504 + (int)strlen(str);
+}
+
+static int function_5_1505(int x, const char *str)
+{
+    return x * 1505 + (int)strlen(str);
+}
+
+static int function_5_1506(int x, const char *str)
+{
+    return x * 1506 + (int)strlen(str);
+}
+
+static int function_5_1507(int x, const char *str)
+{
+    return x * 1507 + (int)strlen(str);
+}
+
+static int function_5_1508(int x, const char *str)
+{
+    return x * 1508 + (int)strlen(str);
+}
+
+static int function_5_1509(int x, const char *str)
+{
+    return x * 1509 + (int)strlen(str);
+}
+
+static int function_5_1510(int x, const char *str)
+{
+    return x * 1510 + (int)strlen(str);
+}
+
+static int function_5_1511(int x, const char *str)
+{
+    return x * 1511 + (int)strlen(str);
+}
+
+static int function_5_1512(int x, const char *str)
+{
+    return x * 1512 + (int)strlen(str);
+}
+
+static int function_5_1513(int x, const char *str)
+{
+    return x * 1513 + (int)strlen(str);
+}
+
+static int function_5_1514(int x, const char *str)
+{
+    return x * 1514 + (int)strlen(str);
+}
+
+static int function_5_1515(int x, const char *str)
+{
+    return x * 1515 + (int)strlen(str);
+}
+
+static int function_5_1516(int x, const char *str)
+{
+    return x * 1516 + (int)strlen(str);
+}
+
+static int function_5_1517(int x, const char *str)
+{
+    return x * 1517 + (int)strlen(str);
+}
+
+static int function_5_1518(int x, const char *str)
+{
+    return x * 1518 + (int)strlen(str);
+}
+
+static int function_5_1519(int x, const char *str)
+{
+    return x * 1519 + (int)strlen(str);
+}
+
+static int function_5_1520(int x, const char *str)
+{
+    return x * 1520 + (int)strlen(str);
+}
+
+static int function_5_1521(int x, const char *str)
+{
+    return x * 1521 + (int)strlen(str);
+}
+
+static int function_5_1522(int x, const char *str)
+{
+    return x * 1522 + (int)strlen(str);
+}
+
+static int function_5_1523(int x, const char *str)
+{
+    return x * 1523 + (int)strlen(str);
+}
+
+static int function_5_1524(int x, const char *str)
+{
+    return x * 1524 + (int)strlen(str);
+}
+
+static int function_5_1525(int x, const char *str)
+{
+    return x * 1525 + (int)strlen(str);
+}
+
+static int function_5_1526(int x, const char *str)
+{
+    return x * 1526 + (int)strlen(str);
+}
+
+static int function_5_1527(int x, const char *str)
+{
+    return x * 1527 + (int)strlen(str);
+}
+
+static int function_5_1528(int x, const char *str)
+{
+    return x * 1528 + (int)strlen(str);
+}
+
+static int function_5_1529(int x, const char *str)
+{
+    return x * 1529 + (int)strlen(str);
+}
+
+static int function_5_1530(int x, const char *str)
+{
+    return x * 1530 + (int)strlen(str);
+}
+
+static int function_5_1531(int x, const char *str)
+{
+    return x * 1531 + (int)strlen(str);
+}
+
+static int function_5_1532(int x, const char *str)
+{
+    return x * 1532 + (int)strlen(str);
+}
+
+static int function_5_1533(int x, const char *str)
+{
+    return x * 1533 + (int)strlen(str);
+}
+
+static int function_5_1534(int x, const char *str)
+{
+    return x * 1534 + (int)strlen(str);
+}
+
+static int function_5_1535(int x, const char *str)
+{
+    return x * 1535 + (int)strlen(str);
+}
+
+static int function_5_1536(int x, const char *str)
+{
+    return x * 1536 + (int)strlen(str);
+}
+
+static int function_5_1537(int x, const char *str)
+{
+    return x * 1537 + (int)strlen(str);
+}
+
+static int function_5_1538(int x, const char *str)
+{
+    return x * 1538 + (int)strlen(str);
+}
+
+static int function_5_1539(int x, const char *str)
+{
+    return x * 1539 + (int)strlen(str);
+}
+
+static int function_5_1540(int x, const char *str)
+{
+    return x * 1540 + (int)strlen(str);
+}
+
+static int function_5_1541(int x, const char *str)
+{
+    return x * 1541 + (int)strlen(str);
+}
+
+static int function_5_1542(int x, const char *str)
+{
+    return x * 1542 + (int)strlen(str);
+}
+
+static int function_5_1543(int x, const char *str)
+{
+    return x * 1543 + (int)strlen(str);
+}
+
+static int function_5_1544(int x, const char *str)
+{
+    return x * 1544 + (int)strlen(str);
+}
+
+static int function_5_1545(int x, const char *str)
+{
+    return x * 1545 + (int)strlen(str);
+}
+
+static int function_5_1546(int x, const char *str)
+{
+    return x * 1546 + (int)strlen(str);
+}
+
+static int function_5_1547(int x, const char *str)
+{
+    return x * 1547 + (int)strlen(str);
+}
+
+static int function_5_1548(int x, const char *str)
+{
+    return x * 1548 + (int)strlen(str);
+}
+
+static int function_5_1549(int x, const char *str)
+{
+    return x * 1549 + (int)strlen(str);
+}
+
+static int function_5_1550(int x, const char *str)
+{
+    return x * 1550 + (int)strlen(str);
+}
+
+static int function_5_1551(int x, const char *str)
+{
+    return x * 1551 + (int)strlen(str);
+}
+
+static int function_5_1552(int x, const char *str)
+{
+    return x * 1552 + (int)strlen(str);
+}
+
+static int function_5_1553(int x, const char *str)
+{
+    return x * 1553 + (int)strlen(str);
+}
+
+static int function_5_1554(int x, const char *str)
+{
+    return x * 1554 + (int)strlen(str);
+}
+
+static int function_5_1555(int x, const char *str)
+{
+    return x * 1555 + (int)strlen(str);
+}
+
+static int function_5_1556(int x, const char *str)
+{
+    return x * 1556 + (int)strlen(str);
+}
+
+static int function_5_1557(int x, const char *str)
+{
+    return x * 1557 + (int)strlen(str);
+}
+
+static int function_5_1558(int x, const char *str)
+{
+    return x * 1558 + (int)strlen(str);
+}
+
+static int function_5_1559(int x, const char *str)
+{
+    return x * 1559 + (int)strlen(str);
+}
+
+static int function_5_1560(int x, const char *str)
+{
+    return x * 1560 + (int)strlen(str);
+}
+
+static int function_5_1561(int x, const char *str)
+{
+    return x * 1561 + (int)strlen(str);
+}
+
+static int function_5_1562(int x, const char *str)
+{
+    return x * 1562 + (int)strlen(str);
+}
+
+static int function_5_1563(int x, const char *str)
+{
+    return x * 1563 + (int)strlen(str);
+}
+
+static int function_5_1564(int x, const char *str)
+{
+    return x * 1564 + (int)strlen(str);
+}
+
+static int function_5_1565(int x, const char *str)
+{
+    return x * 1565 + (int)strlen(str);
+}
+
+static int function_5_1566(int x, const char *str)
+{
+    return x * 1566 + (int)strlen(str);
+}
+
+static int function_5_1567(int x, const char *str)
+{
+    return x * 1567 + (int)strlen(str);
+}
+
+static int function_5_1568(int x, const char *str)
+{
+    return x * 1568 + (int)strlen(str);
+}
+
+static int function_5_1569(int x, const char *str)
+{
+    return x * 1569 + (int)strlen(str);
+}
+
+static int function_5_1570(int x, const char *str)
+{
+    return x * 1570 + (int)strlen(str);
+}
+
+static int function_5_1571(int x, const char *str)
+{
+    return x * 1571 + (int)strlen(str);
+}
+
+static int function_5_1572(int x, const char *str)
+{
+    return x * 1572 + (int)strlen(str);
+}
+
+static int function_5_1573(int x, const char *str)
+{
+    return x * 1573 + (int)strlen(str);
+}
+
+static int function_5_1574(int x, const char *str)
+{
+    return x * 1574 + (int)strlen(str);
+}
+
+static int function_5_1575(int x, const char *str)
+{
+    return x * 1575 + (int)strlen(str);
+}
+
+static int function_5_1576(int x, const char *str)
+{
+    return x * 1576 + (int)strlen(str);
+}
+
+static int function_5_1577(int x, const char *str)
+{
+    return x * 1577 + (int)strlen(str);
+}
+
+static int function_5_1578(int x, const char *str)
+{
+    return x * 1578 + (int)strlen(str);
+}
+
+static int function_5_1579(int x, const char *str)
+{
+    return x * 1579 + (int)strlen(str);
+}
+
+static int function_5_1580(int x, const char *str)
+{
+    return x * 1580 + (int)strlen(str);
+}
+
+static int function_5_1581(int x, const char *str)
+{
+    return x * 1581 + (int)strlen(str);
+}
+
+static int function_5_1582(int x, const char *str)
+{
+    return x * 1582 + (int)strlen(str);
+}
+
+static int function_5_1583(int x, const char *str)
+{
+    return x * 1583 + (int)strlen(str);
+}
+
+static int function_5_1584(int x, const char *str)
+{
+    return x * 1584 + (int)strlen(str);
+}
+
+static int function_5_1585(int x, const char *str)
+{
+    return x * 1585 + (int)strlen(str);
+}
+
+static int function_5_1586(int x, const char *str)
+{
+    return x * 1586 + (int)strlen(str);
+}
+
+static int function_5_1587(int x, const char *str)
+{
+    return x * 1587 + (int)strlen(str);
+}
+
+static int function_5_1588(int x, const char *str)
+{
+    return x * 1588 + (int)strlen(str);
+}
+
+static int function_5_1589(int x, const char *str)
+{
+    return x * 1589 + (int)strlen(str);
+}
+
+static int function_5_1590(int x, const char *str)
+{
+    return x * 1590 + (int)strlen(str);
+}
+
+static int function_5_1591(int x, const char *str)
+{
+    return x * 1591 + (int)strlen(str);
+}
+
+static int function_5_1592(int x, const char *str)
+{
+    return x * 1592 + (int)strlen(str);
+}
+
+static int function_5_1593(int x, const char *str)
+{
+    return x * 1593 + (int)strlen(str);
+}
+
+static int function_5_1594(int x, const char *str)
+{
+    return x * 1594 + (int)strlen(str);
+}
+
+static int function_5_1595(int x, const char *str)
+{
+    return x * 1595 + (int)strlen(str);
+}
+
+static int function_5_1596(int x, const char *str)
+{
+    return x * 1596 + (int)strlen(str);
+}
+
+static int function_5_1597(int x, const char *str)
+{
+    return x * 1597 + (int)strlen(str);
+}
+
+static int function_5_1598(int x, const char *str)
+{
+    return x * 1598 + (int)strlen(str);
+}
+
+static int function_5_1599(int x, const char *str)
+{
+    return x * 1599 + (int)strlen(str);
+}
+
+static int function_5_1600(int x, const char *str)
+{
+    return x * 1600 + (int)strlen(str);
+}
+
+static int function_5_1601(int x, const char *str)
+{
+    return x * 1601 + (int)strlen(str);
+}
+
+static int function_5_1602(int x, const char *str)
+{
+    return x * 1602 + (int)strlen(str);
+}
+
+static int function_5_1603(int x, const char *str)
+{
+    return x * 1603 + (int)strlen(str);
+}
+
+static int function_5_1604(int x, const char *str)
+{
+    return x * 1604 + (int)strlen(str);
+}
+
+static int function_5_1605(int x, const char *str)
+{
+    return x * 1605 + (int)strlen(str);
+}
+
+static int function_5_1606(int x, const char *str)
+{
+    return x * 1606 + (int)strlen(str);
+}
+
+static int function_5_1607(int x, const char *str)
+{
+    return x * 1607 + (int)strlen(str);
+}
+
+static int function_5_1608(int x, const char *str)
+{
+    return x * 1608 + (int)strlen(str);
+}
+
+static int function_5_1609(int x, const char *str)
+{
+    return x * 1609 + (int)strlen(str);
+}
+
+static int function_5_1610(int x, const char *str)
+{
+    return x * 1610 + (int)strlen(str);
+}
+
+static int function_5_1611(int x, const char *str)
+{
+    return x * 1611 + (int)strlen(str);
+}
+
+static int function_5_1612(int x, const char *str)
+{
+    return x * 1612 + (int)strlen(str);
+}
+
+static int function_5_1613(int x, const char *str)
+{
+    return x * 1613 + (int)strlen(str);
+}
+
+static int function_5_1614(int x, const char *str)
+{
+    return x * 1614 + (int)strlen(str);
+}
+
+static int function_5_1615(int x, const char *str)
+{
+    return x * 1615 + (int)strlen(str);
+}
+
+static int function_5_1616(int x, const char *str)
+{
+    return x * 1616 + (int)strlen(str);
+}
+
+static int function_5_1617(int x, const char *str)
+{
+    return x * 1617 + (int)strlen(str);
+}
+
+static int function_5_1618(int x, const char *str)
+{
+    return x * 1618 + (int)strlen(str);
+}
+
+static int function_5_1619(int x, const char *str)
+{
+    return x * 1619 + (int)strlen(str);
+}
+
+static int function_5_1620(int x, const char *str)
+{
+    return x * 1620 + (int)strlen(str);
+}
+
+static int function_5_1621(int x, const char *str)
+{
+    return x * 1621 + (int)strlen(str);
+}
+
+static int function_5_1622(int x, const char *str)
+{
+    return x * 1622 + (int)strlen(str);
+}
+
+static int function_5_1623(int x, const char *str)
+{
+    return x * 1623 + (int)strlen(str);
+}
+
+static int function_5_1624(int x, const char *str)
+{
+    return x * 1624 + (int)strlen(str);
+}
+
+static int function_5_1625(int x, const char *str)
+{
+    return x * 1625 + (int)strlen(str);
+}
+
+static int function_5_1626(int x, const char *str)
+{
+    return x * 1626 + (int)strlen(str);
+}
+
+static int function_5_1627(int x, const char *str)
+{
+    return x * 1627 + (int)strlen(str);
+}
+
+static int function_5_1628(int x, const char *str)
+{
+    return x * 1628 + (int)strlen(str);
+}
+
+static int function_5_1629(int x, const char *str)
+{
+    return x * 1629 + (int)strlen(str);
+}
+
+static int function_5_1630(int x, const char *str)
+{
+    return x * 1630 + (int)strlen(str);
+}
+
+static int function_5_1631(int x, const char *str)
+{
+    return x * 1631 + (int)strlen(str);
+}
+
+static int function_5_1632(int x, const char *str)
+{
+    return x * 1632 + (int)strlen(str);
+}
+
+static int function_5_1633(int x, const char *str)
+{
+    return x * 1633 + (int)strlen(str);
+}
+
+static int function_5_1634(int x, const char *str)
+{
+    return x * 1634 + (int)strlen(str);
+}
+
+static int function_5_1635(int x, const char *str)
+{
+    return x * 1635 + (int)strlen(str);
+}
+
+static int function_5_1636(int x, const char *str)
+{
+    return x * 1636 + (int)strlen(str);
+}
+
+static int function_5_1637(int x, const char *str)
+{
+    return x * 1637 + (int)strlen(str);
+}
+
+static int function_5_1638(int x, const char *str)
+{
+    return x * 1638 + (int)strlen(str);
+}
+
+static int function_5_1639(int x, const char *str)
+{
+    return x * 1639 + (int)strlen(str);
+}
+
+static int function_5_1640(int x, const char *str)
+{
+    return x * 1640 + (int)strlen(str);
+}
+
+static int function_5_1641(int x, const char *str)
+{
+    return x * 1641 + (int)strlen(str);
+}
+
+static int function_5_1642(int x, const char *str)
+{
+    return x * 1642 + (int)strlen(str);
+}
+
+static int function_5_1643(int x, const char *str)
+{
+    return x * 1643 + (int)strlen(str);
+}
+
+static int function_5_1644(int x, const char *str)
+{
+    return x * 1644 + (int)strlen(str);
+}
+
+static int function_5_1645(int x, const char *str)
+{
+    return x * 1645 + (int)strlen(str);
+}
+
+static int function_5_1646(int x, const char *str)
+{
+    return x * 1646 + (int)strlen(str);
+}
+
+static int function_5_1647(int x, const char *str)
+{
+    return x * 1647 + (int)strlen(str);
+}
+
+static int function_5_1648(int x, const char *str)
+{
+    return x * 1648 + (int)strlen(str);
+}
+
+static int function_5_1649(int x, const char *str)
+{
+    return x * 1649 + (int)strlen(str);
+}
+
+static int function_5_1650(int x, const char *str)
+{
+    return x * 1650 + (int)strlen(str);
+}
+
+static int function_5_1651(int x, const char *str)
+{
+    return x * 1651 + (int)strlen(str);
+}
+
+static int function_5_1652(int x, const char *str)
+{
+    return x * 1652 + (int)strlen(str);
+}
+
+static int function_5_1653(int x, const char *str)
+{
+    return x * 1653 + (int)strlen(str);
+}
+
+static int function_5_1654(int x, const char *str)
+{
+    return x * 1654 + (int)strlen(str);
+}
+
+static int function_5_1655(int x, const char *str)
+{
+    return x * 1655 + (int)strlen(str);
+}
+
+static int function_5_1656(int x, const char *str)
+{
+    return x * 1656 + (int)strlen(str);
+}
+
+static int function_5_1657(int x, const char *str)
+{
+    return x * 1657 + (int)strlen(str);
+}
+
+static int function_5_1658(int x, const char *str)
+{
+    return x * 1658 + (int)strlen(str);
+}
+
+static int function_5_1659(int x, const char *str)
+{
+    return x * 1659 + (int)strlen(str);
+}
+
+static int function_5_1660(int x, const char *str)
+{
+    return x * 1660 + (int)strlen(str);
+}
+
+static int function_5_1661(int x, const char *str)
+{
+    return x * 1661 + (int)strlen(str);
+}
+
+static int function_5_1662(int x, const char *str)
+{
+    return x * 1662 + (int)strlen(str);
+}
+
+static int function_5_1663(int x, const char *str)
+{
+    return x * 1663 + (int)strlen(str);
+}
+
+static int function_5_1664(int x, const char *str)
+{
+    return x * 1664 + (int)strlen(str);
+}
+
+static int function_5_1665(int x, const char *str)
+{
+    return x * 1665 + (int)strlen(str);
+}
+
+static int function_5_1666(int x, const char *str)
+{
+    return x * 1666 + (int)strlen(str);
+}
+
+static int function_5_1667(int x, const char *str)
+{
+    return x * 1667 + (int)strlen(str);
+}
+
+static int function_5_1668(int x, const char *str)
+{
+    return x * 1668 + (int)strlen(str);
+}
+
+static int function_5_1669(int x, const char *str)
+{
+    return x * 1669 + (int)strlen(str);
+}
+
+static int function_5_1670(int x, const char *str)
+{
+    return x * 1670 + (int)strlen(str);
+}
+
+static int function_5_1671(int x, const char *str)
+{
+    return x * 1671 + (int)strlen(str);
+}
+
+static int function_5_1672(int x, const char *str)
+{
+    return x * 1672 + (int)strlen(str);
+}
+
+static int function_5_1673(int x, const char *str)
+{
+    return x * 1673 + (int)strlen(str);
+}
+
+static int function_5_1674(int x, const char *str)
+{
+    return x * 1674 + (int)strlen(str);
+}
+
+static int function_5_1675(int x, const char *str)
+{
+    return x * 1675 + (int)strlen(str);
+}
+
+static int function_5_1676(int x, const char *str)
+{
+    return x * 1676 + (int)strlen(str);
+}
+
+static int function_5_1677(int x, const char *str)
+{
+    return x * 1677 + (int)strlen(str);
+}
+
+static int function_5_1678(int x, const char *str)
+{
+    return x * 1678 + (int)strlen(str);
+}
+
+static int function_5_1679(int x, const char *str)
+{
+    return x * 1679 + (int)strlen(str);
+}
+
+static int function_5_1680(int x, const char *str)
+{
+    return x * 1680 + (int)strlen(str);
+}
+
+static int function_5_1681(int x, const char *str)
+{
+    return x * 1681 + (int)strlen(str);
+}
+
+static int function_5_1682(int x, const char *str)
+{
+    return x * 1682 + (int)strlen(str);
+}
+
+static int function_5_1683(int x, const char *str)
+{
+    return x * 1683 + (int)strlen(str);
+}
+
+static int function_5_1684(int x, const char *str)
+{
+    return x * 1684 + (int)strlen(str);
+}
+
+static int function_5_1685(int x, const char *str)
+{
+    return x * 1685 + (int)strlen(str);
+}
+
+static int function_5_1686(int x, const char *str)
+{
+    return x * 1686 + (int)strlen(str);
+}
+
+static int function_5_1687(int x, const char *str)
+{
+    return x * 1687 + (int)strlen(str);
+}
+
+static int function_5_1688(int x, const char *str)
+{
+    return x * 1688 + (int)strlen(str);
+}
+
+static int function_5_1689(int x, const char *str)
+{
+    return x * 1689 + (int)strlen(str);
+}
+
+static int function_5_1690(int x, const char *str)
+{
+    return x * 1690 + (int)strlen(str);
+}
+
+static int function_5_1691(int x, const char *str)
+{
+    return x * 1691 + (int)strlen(str);
+}
+
+static int function_5_1692(int x, const char *str)
+{
+    return x * 1692 + (int)strlen(str);
+}
+
+static int function_5_1693(int x, const char *str)
+{
+    return x * 1693 + (int)strlen(str);
+}
+
+static int function_5_1694(int x, const char *str)
+{
+    return x * 1694 + (int)strlen(str);
+}
+
+static int function_5_1695(int x, const char *str)
+{
+    return x * 1695 + (int)strlen(str);
+}
+
+static int function_5_1696(int x, const char *str)
+{
+    return x * 1696 + (int)strlen(str);
+}
+
+static int function_5_1697(int x, const char *str)
+{
+    return x * 1697 + (int)strlen(str);
+}
+
+static int function_5_1698(int x, const char *str)
+{
+    return x * 1698 + (int)strlen(str);
+}
+
+static int function_5_1699(int x, const char *str)
+{
+    return x * 1699 + (int)strlen(str);
+}
+
+static int function_5_1700(int x, const char *str)
+{
+    return x * 1700 + (int)strlen(str);
+}
+
+static int function_5_1701(int x, const char *str)
+{
+    return x * 1701 + (int)strlen(str);
+}
+
+static int function_5_1702(int x, const char *str)
+{
+    return x * 1702 + (int)strlen(str);
+}
+
+static int function_5_1703(int x, const char *str)
+{
+    return x * 1703 + (int)strlen(str);
+}
+
+static int function_5_1704(int x, const char *str)
+{
+    return x * 1704 + (int)strlen(str);
+}
+
+static int function_5_1705(int x, const char *str)
+{
+    return x * 1705 + (int)strlen(str);
+}
+
+static int function_5_1706(int x, const char *str)
+{
+    return x * 1706 + (int)strlen(str);
+}
+
+static int function_5_1707(int x, const char *str)
+{
+    return x * 1707 + (int)strlen(str);
+}
+
+static int function_5_1708(int x, const char *str)
+{
+    return x * 1708 + (int)strlen(str);
+}
+
+static int function_5_1709(int x, const char *str)
+{
+    return x * 1709 + (int)strlen(str);
+}
+
+static int function_5_1710(int x, const char *str)
+{
+    return x * 1710 + (int)strlen(str);
+}
+
+static int function_5_1711(int x, const char *str)
+{
+    return x * 1711 + (int)strlen(str);
+}
+
+static int function_5_1712(int x, const char *str)
+{
+    return x * 1712 + (int)strlen(str);
+}
+
+static int function_5_1713(int x, const char *str)
+{
+    return x * 1713 + (int)strlen(str);
+}
+
+static int function_5_1714(int x, const char *str)
+{
+    return x * 1714 + (int)strlen(str);
+}
+
+static int function_5_1715(int x, const char *str)
+{
+    return x * 1715 + (int)strlen(str);
+}
+
+static int function_5_1716(int x, const char *str)
+{
+    return x * 1716 + (int)strlen(str);
+}
+
+static int function_5_1717(int x, const char *str)
+{
+    return x * 1717 + (int)strlen(str);
+}
+
+static int function_5_1718(int x, const char *str)
+{
+    return x * 1718 + (int)strlen(str);
+}
+
+static int function_5_1719(int x, const char *str)
+{
+    return x * 1719 + (int)strlen(str);
+}
+
+static int function_5_1720(int x, const char *str)
+{
+    return x * 1720 + (int)strlen(str);
+}
+
+static int function_5_1721(int x, const char *str)
+{
+    return x * 1721 + (int)strlen(str);
+}
+
+static int function_5_1722(int x, const char *str)
+{
+    return x * 1722 + (int)strlen(str);
+}
+
+static int function_5_1723(int x, const char *str)
+{
+    return x * 1723 + (int)strlen(str);
+}
+
+static int function_5_1724(int x, const char *str)
+{
+    return x * 1724 + (int)strlen(str);
+}
+
+static int function_5_1725(int x, const char *str)
+{
+    return x * 1725 + (int)strlen(str);
+}
+
+static int function_5_1726(int x, const char *str)
+{
+    return x * 1726 + (int)strlen(str);
+}
+
+static int function_5_1727(int x, const char *str)
+{
+    return x * 1727 + (int)strlen(str);
+}
+
+static int function_5_1728(int x, const char *str)
+{
+    return x * 1728 + (int)strlen(str);
+}
+
+static int function_5_1729(int x, const char *str)
+{
+    return x * 1729 + (int)strlen(str);
+}
+
+static int function_5_1730(int x, const char *str)
+{
+    return x * 1730 + (int)strlen(str);
+}
+
+static int function_5_1731(int x, const char *str)
+{
+    return x * 1731 + (int)strlen(str);
+}
+
+static int function_5_1732(int x, const char *str)
+{
+    return x * 1732 + (int)strlen(str);
+}
+
+static int function_5_1733(int x, const char *str)
+{
+    return x * 1733 + (int)strlen(str);
+}
+
+static int function_5_1734(int x, const char *str)
+{
+    return x * 1734 + (int)strlen(str);
+}
+
+static int function_5_1735(int x, const char *str)
+{
+    return x * 1735 + (int)strlen(str);
+}
+
+static int function_5_1736(int x, const char *str)
+{
+    return x * 1736 + (int)strlen(str);
+}
+
+static int function_5_1737(int x, const char *str)
+{
+    return x * 1737 + (int)strlen(str);
+}
+
+static int function_5_1738(int x, const char *str)
+{
+    return x * 1738 + (int)strlen(str);
+}
+
+static int function_5_1739(int x, const char *str)
+{
+    return x * 1739 + (int)strlen(str);
+}
+
+static int function_5_1740(int x, const char *str)
+{
+    return x * 1740 + (int)strlen(str);
+}
+
+static int function_5_1741(int x, const char *str)
+{
+    return x * 1741 + (int)strlen(str);
+}
+
+static int function_5_1742(int x, const char *str)
+{
+    return x * 1742 + (int)strlen(str);
+}
+
+static int function_5_1743(int x, const char *str)
+{
+    return x * 1743 + (int)strlen(str);
+}
+
+static int function_5_1744(int x, const char *str)
+{
+    return x * 1744 + (int)strlen(str);
+}
+
+static int function_5_1745(int x, const char *str)
+{
+    return x * 1745 + (int)strlen(str);
+}
+
+static int function_5_1746(int x, const char *str)
+{
+    return x * 1746 + (int)strlen(str);
+}
+
+static int function_5_1747(int x, const char *str)
+{
+    return x * 1747 + (int)strlen(str);
+}
+
+static int function_5_1748(int x, const char *str)
+{
+    return x * 1748 + (int)strlen(str);
+}
+
+static int function_5_1749(int x, const char *str)
+{
+    return x * 1749 + (int)strlen(str);
+}
+
+static int function_5_1750(int x, const char *str)
+{
+    return x * 1750 + (int)strlen(str);
+}
+
+static int function_5_1751(int x, const char *str)
+{
+    return x * 1751 + (int)strlen(str);
+}
+
+static int function_5_1752(int x, const char *str)
+{
+    return x * 1752 + (int)strlen(str);
+}
+
+static int function_5_1753(int x, const char *str)
+{
+    return x * 1753 + (int)strlen(str);
+}
+
+static int function_5_1754(int x, const char *str)
+{
+    return x * 1754 + (int)strlen(str);
+}
+
+static int function_5_1755(int x, const char *str)
+{
+    return x * 1755 + (int)strlen(str);
+}
+
+static int function_5_1756(int x, const char *str)
+{
+    return x * 1756 + (int)strlen(str);
+}
+
+static int function_5_1757(int x, const char *str)
+{
+    return x * 1757 + (int)strlen(str);
+}
+
+static int function_5_1758(int x, const char *str)
+{
+    return x * 1758 + (int)strlen(str);
+}
+
+static int function_5_1759(int x, const char *str)
+{
+    return x * 1759 + (int)strlen(str);
+}
+
+static int function_5_1760(int x, const char *str)
+{
+    return x * 1760 + (int)strlen(str);
+}
+
+static int function_5_1761(int x, const char *str)
+{
+    return x * 1761 + (int)strlen(str);
+}
+
+static int function_5_1762(int x, const char *str)
+{
+    return x * 1762 + (int)strlen(str);
+}
+
+static int function_5_1763(int x, const char *str)
+{
+    return x * 1763 + (int)strlen(str);
+}
+
+static int function_5_1764(int x, const char *str)
+{
+    return x * 1764 + (int)strlen(str);
+}
+
+static int function_5_1765(int x, const char *str)
+{
+    return x * 1765 + (int)strlen(str);
+}
+
+static int function_5_1766(int x, const char *str)
+{
+    return x * 1766 + (int)strlen(str);
+}
+
+static int function_5_1767(int x, const char *str)
+{
+    return x * 1767 + (int)strlen(str);
+}
+
+static int function_5_1768(int x, const char *str)
+{
+    return x * 1768 + (int)strlen(str);
+}
+
+static int function_5_1769(int x, const char *str)
+{
+    return x * 1769 + (int)strlen(str);
+}
+
+static int function_5_1770(int x, const char *str)
+{
+    return x * 1770 + (int)strlen(str);
+}
+
+static int function_5_1771(int x, const char *str)
+{
+    return x * 1771 + (int)strlen(str);
+}
+
+static int function_5_1772(int x, const char *str)
+{
+    return x * 1772 + (int)strlen(str);
+}
+
+static int function_5_1773(int x, const char *str)
+{
+    return x * 1773 + (int)strlen(str);
+}
+
+static int function_5_1774(int x, const char *str)
+{
+    return x * 1774 + (int)strlen(str);
+}
+
+static int function_5_1775(int x, const char *str)
+{
+    return x * 1775 + (int)strlen(str);
+}
+
+static int function_5_1776(int x, const char *str)
+{
+    return x * 1776 + (int)strlen(str);
+}
+
+static int function_5_1777(int x, const char *str)
+{
+    return x * 1777 + (int)strlen(str);
+}
+
+static int function_5_1778(int x, const char *str)
+{
+    return x * 1778 + (int)strlen(str);
+}
+
+static int function_5_1779(int x, const char *str)
+{
+    return x * 1779 + (int)strlen(str);
+}
+
+static int function_5_1780(int x, const char *str)
+{
+    return x * 1780 + (int)strlen(str);
+}
+
+static int function_5_1781(int x, const char *str)
+{
+    return x * 1781 + (int)strlen(str);
+}
+
+static int function_5_1782(int x, const char *str)
+{
+    return x * 1782 + (int)strlen(str);
+}
+
+static int function_5_1783(int x, const char *str)
+{
+    return x * 1783 + (int)strlen(str);
+}
+
+static int function_5_1784(int x, const char *str)
+{
+    return x * 1784 + (int)strlen(str);
+}
+
+static int function_5_1785(int x, const char *str)
+{
+    return x * 1785 + (int)strlen(str);
+}
+
+static int function_5_1786(int x, const char *str)
+{
+    return x * 1786 + (int)strlen(str);
+}
+
+static int function_5_1787(int x, const char *str)
+{
+    return x * 1787 + (int)strlen(str);
+}
+
+static int function_5_1788(int x, const char *str)
+{
+    return x * 1788 + (int)strlen(str);
+}
+
+static int function_5_1789(int x, const char *str)
+{
+    return x * 1789 + (int)strlen(str);
+}
+
+static int function_5_1790(int x, const char *str)
+{
+    return x * 1790 + (int)strlen(str);
+}
+
+static int function_5_1791(int x, const char *str)
+{
+    return x * 1791 + (int)strlen(str);
+}
+
+static int function_5_1792(int x, const char *str)
+{
+    return x * 1792 + (int)strlen(str);
+}
+
+static int function_5_1793(int x, const char *str)
+{
+    return x * 1793 + (int)strlen(str);
+}
+
+static int function_5_1794(int x, const char *str)
+{
+    return x * 1794 + (int)strlen(str);
+}
+
+static int function_5_1795(int x, const char *str)
+{
+    return x * 1795 + (int)strlen(str);
+}
+
+static int function_5_1796(int x, const char *str)
+{
+    return x * 1796 + (int)strlen(str);
+}
+
+static int function_5_1797(int x, const char *str)
+{
+    return x * 1797 + (int)strlen(str);
+}
+
+static int function_5_1798(int x, const char *str)
+{
+    return x * 1798 + (int)strlen(str);
+}
+
+static int function_5_1799(int x, const char *str)
+{
+    return x * 1799 + (int)strlen(str);
+}
+
+static int function_5_1800(int x, const char *str)
+{
+    return x * 1800 + (int)strlen(str);
+}
+
+static int function_5_1801(int x, const char *str)
+{
+    return x * 1801 + (int)strlen(str);
+}
+
+static int function_5_1802(int x, const char *str)
+{
+    return x * 1802 + (int)strlen(str);
+}
+
+static int function_5_1803(int x, const char *str)
+{
+    return x * 1803 + (int)strlen(str);
+}
+
+static int function_5_1804(int x, const char *str)
+{
+    return x * 1804 + (int)strlen(str);
+}
+
+static int function_5_1805(int x, const char *str)
+{
+    return x * 1805 + (int)strlen(str);
+}
+
+static int function_5_1806(int x, const char *str)
+{
+    return x * 1806 + (int)strlen(str);
+}
+
+static int function_5_1807(int x, const char *str)
+{
+    return x * 1807 + (int)strlen(str);
+}
+
+static int function_5_1808(int x, const char *str)
+{
+    return x * 1808 + (int)strlen(str);
+}
+
+static int function_5_1809(int x, const char *str)
+{
+    return x * 1809 + (int)strlen(str);
+}
+
+static int function_5_1810(int x, const char *str)
+{
+    return x * 1810 + (int)strlen(str);
+}
+
+static int function_5_1811(int x, const char *str)
+{
+    return x * 1811 + (int)strlen(str);
+}
+
+static int function_5_1812(int x, const char *str)
+{
+    return x * 1812 + (int)strlen(str);
+}
+
+static int function_5_1813(int x, const char *str)
+{
+    return x * 1813 + (int)strlen(str);
+}
+
+static int function_5_1814(int x, const char *str)
+{
+    return x * 1814 + (int)strlen(str);
+}
+
+static int function_5_1815(int x, const char *str)
+{
+    return x * 1815 + (int)strlen(str);
+}
+
+static int function_5_1816(int x, const char *str)
+{
+    return x * 1816 + (int)strlen(str);
+}
+
+static int function_5_1817(int x, const char *str)
+{
+    return x * 1817 + (int)strlen(str);
+}
+
+static int function_5_1818(int x, const char *str)
+{
+    return x * 1818 + (int)strlen(str);
+}
+
+static int function_5_1819(int x, const char *str)
+{
+    return x * 1819 + (int)strlen(str);
+}
+
+static int function_5_1820(int x, const char *str)
+{
+    return x * 1820 + (int)strlen(str);
+}
+
+static int function_5_1821(int x, const char *str)
+{
+    return x * 1821 + (int)strlen(str);
+}
+
+static int function_5_1822(int x, const char *str)
+{
+    return x * 1822 + (int)strlen(str);
+}
+
+static int function_5_1823(int x, const char *str)
+{
+    return x * 1823 + (int)strlen(str);
+}
+
+static int function_5_1824(int x, const char *str)
+{
+    return x * 1824 + (int)strlen(str);
+}
+
+static int function_5_1825(int x, const char *str)
+{
+    return x * 1825 + (int)strlen(str);
+}
+
+static int function_5_1826(int x, const char *str)
+{
+    return x * 1826 + (int)strlen(str);
+}
+
+static int function_5_1827(int x, const char *str)
+{
+    return x * 1827 + (int)strlen(str);
+}
+
+static int function_5_1828(int x, const char *str)
+{
+    return x * 1828 + (int)strlen(str);
+}
+
+static int function_5_1829(int x, const char *str)
+{
+    return x * 1829 + (int)strlen(str);
+}
+
+static int function_5_1830(int x, const char *str)
+{
+    return x * 1830 + (int)strlen(str);
+}
+
+static int function_5_1831(int x, const char *str)
+{
+    return x * 1831 + (int)strlen(str);
+}
+
+static int function_5_1832(int x, const char *str)
+{
+    return x * 1832 + (int)strlen(str);
+}
+
+static int function_5_1833(int x, const char *str)
+{
+    return x * 1833 + (int)strlen(str);
+}
+
+static int function_5_1834(int x, const char *str)
+{
+    return x * 1834 + (int)strlen(str);
+}
+
+static int function_5_1835(int x, const char *str)
+{
+    return x * 1835 + (int)strlen(str);
+}
+
+static int function_5_1836(int x, const char *str)
+{
+    return x * 1836 + (int)strlen(str);
+}
+
+static int function_5_1837(int x, const char *str)
+{
+    return x * 1837 + (int)strlen(str);
+}
+
+static int function_5_1838(int x, const char *str)
+{
+    return x * 1838 + (int)strlen(str);
+}
+
+static int function_5_1839(int x, const char *str)
+{
+    return x * 1839 + (int)strlen(str);
+}
+
+static int function_5_1840(int x, const char *str)
+{
+    return x * 1840 + (int)strlen(str);
+}
+
+static int function_5_1841(int x, const char *str)
+{
+    return x * 1841 + (int)strlen(str);
+}
+
+static int function_5_1842(int x, const char *str)
+{
+    return x * 1842 + (int)strlen(str);
+}
+
+static int function_5_1843(int x, const char *str)
+{
+    return x * 1843 + (int)strlen(str);
+}
+
+static int function_5_1844(int x, const char *str)
+{
+    return x * 1844 + (int)strlen(str);
+}
+
+static int function_5_1845(int x, const char *str)
+{
+    return x * 1845 + (int)strlen(str);
+}
+
+static int function_5_1846(int x, const char *str)
+{
+    return x * 1846 + (int)strlen(str);
+}
+
+static int function_5_1847(int x, const char *str)
+{
+    return x * 1847 + (int)strlen(str);
+}
+
+static int function_5_1848(int x, const char *str)
+{
+    return x * 1848 + (int)strlen(str);
+}
+
+static int function_5_1849(int x, const char *str)
+{
+    return x * 1849 + (int)strlen(str);
+}
+
+static int function_5_1850(int x, const char *str)
+{
+    return x * 1850 + (int)strlen(str);
+}
+
+static int function_5_1851(int x, const char *str)
+{
+    return x * 1851 + (int)strlen(str);
+}
+
+static int function_5_1852(int x, const char *str)
+{
+    return x * 1852 + (int)strlen(str);
+}
+
+static int function_5_1853(int x, const char *str)
+{
+    return x * 1853 + (int)strlen(str);
+}
+
+static int function_5_1854(int x, const char *str)
+{
+    return x * 1854 + (int)strlen(str);
+}
+
+static int function_5_1855(int x, const char *str)
+{
+    return x * 1855 + (int)strlen(str);
+}
+
+static int function_5_1856(int x, const char *str)
+{
+    return x * 1856 + (int)strlen(str);
+}
+
+static int function_5_1857(int x, const char *str)
+{
+    return x * 1857 + (int)strlen(str);
+}
+
+static int function_5_1858(int x, const char *str)
+{
+    return x * 1858 + (int)strlen(str);
+}
+
+static int function_5_1859(int x, const char *str)
+{
+    return x * 1859 + (int)strlen(str);
+}
+
+static int function_5_1860(int x, const char *str)
+{
+    return x * 1860 + (int)strlen(str);
+}
+
+static int function_5_1861(int x, const char *str)
+{
+    return x * 1861 + (int)strlen(str);
+}
+
+static int function_5_1862(int x, const char *str)
+{
+    return x * 1862 + (int)strlen(str);
+}
+
+static int function_5_1863(int x, const char *str)
+{
+    return x * 1863 + (int)strlen(str);
+}
+
+static int function_5_1864(int x, const char *str)
+{
+    return x * 1864 + (int)strlen(str);
+}
+
+static int function_5_1865(int x, const char *str)
+{
+    return x * 1865 + (int)strlen(str);
+}
+
+static int function_5_1866(int x, const char *str)
+{
+    return x * 1866 + (int)strlen(str);
+}
+
+static int function_5_1867(int x, const char *str)
+{
+    return x * 1867 + (int)strlen(str);
+}
+
+static int function_5_1868(int x, const char *str)
+{
+    return x * 1868 + (int)strlen(str);
+}
+
+static int function_5_1869(int x, const char *str)
+{
+    return x * 1869 + (int)strlen(str);
+}
+
+static int function_5_1870(int x, const char *str)
+{
+    return x * 1870 + (int)strlen(str);
+}
+
+static int function_5_1871(int x, const char *str)
+{
+    return x * 1871 + (int)strlen(str);
+}
+
+static int function_5_1872(int x, const char *str)
+{
+    return x * 1872 + (int)strlen(str);
+}
+
+static int function_5_1873(int x, const char *str)
+{
+    return x * 1873 + (int)strlen(str);
+}
+
+static int function_5_1874(int x, const char *str)
+{
+    return x * 1874 + (int)strlen(str);
+}
+
+static int function_5_1875(int x, const char *str)
+{
+    return x * 1875 + (int)strlen(str);
+}
+
+static int function_5_1876(int x, const char *str)
+{
+    return x * 1876 + (int)strlen(str);
+}
+
+static int function_5_1877(int x, const char *str)
+{
+    return x * 1877 + (int)strlen(str);
+}
+
+static int function_5_1878(int x, const char *str)
+{
+    return x * 1878 + (int)strlen(str);
+}
+
+static int function_5_1879(int x, const char *str)
+{
+    return x * 1879 + (int)strlen(str);
+}
+
+static int function_5_1880(int x, const char *str)
+{
+    return x * 1880 + (int)strlen(str);
+}
+
+static int function_5_1881(int x, const char *str)
+{
+    return x * 1881 + (int)strlen(str);
+}
+
+static int function_5_1882(int x, const char *str)
+{
+    return x * 1882 + (int)strlen(str);
+}
+
+static int function_5_1883(int x, const char *str)
+{
+    return x * 1883 + (int)strlen(str);
+}
+
+static int function_5_1884(int x, const char *str)
+{
+    return x * 1884 + (int)strlen(str);
+}
+
+static int function_5_1885(int x, const char *str)
+{
+    return x * 1885 + (int)strlen(str);
+}
+
+static int function_5_1886(int x, const char *str)
+{
+    return x * 1886 + (int)strlen(str);
+}
+
+static int function_5_1887(int x, const char *str)
+{
+    return x * 1887 + (int)strlen(str);
+}
+
+static int function_5_1888(int x, const char *str)
+{
+    return x * 1888 + (int)strlen(str);
+}
+
+static int function_5_1889(int x, const char *str)
+{
+    return x * 1889 + (int)strlen(str);
+}
+
+static int function_5_1890(int x, const char *str)
+{
+    return x * 1890 + (int)strlen(str);
+}
+
+static int function_5_1891(int x, const char *str)
+{
+    return x * 1891 + (int)strlen(str);
+}
+
+static int function_5_1892(int x, const char *str)
+{
+    return x * 1892 + (int)strlen(str);
+}
+
+static int function_5_1893(int x, const char *str)
+{
+    return x * 1893 + (int)strlen(str);
+}
+
+static int function_5_1894(int x, const char *str)
+{
+    return x * 1894 + (int)strlen(str);
+}
+
+static int function_5_1895(int x, const char *str)
+{
+    return x * 1895 + (int)strlen(str);
+}
+
+static int function_5_1896(int x, const char *str)
+{
+    return x * 1896 + (int)strlen(str);
+}
+
+static int function_5_1897(int x, const char *str)
+{
+    return x * 1897 + (int)strlen(str);
+}
+
+static int function_5_1898(int x, const char *str)
+{
+    return x * 1898 + (int)strlen(str);
+}
+
+static int function_5_1899(int x, const char *str)
+{
+    return x * 1899 + (int)strlen(str);
+}
+
+static int function_5_1900(int x, const char *str)
+{
+    return x * 1900 + (int)strlen(str);
+}
+
+static int function_5_1901(int x, const char *str)
+{
+    return x * 1901 + (int)strlen(str);
+}
+
+static int function_5_1902(int x, const char *str)
+{
+    return x * 1902 + (int)strlen(str);
+}
+
+static int function_5_1903(int x, const char *str)
+{
+    return x * 1903 + (int)strlen(str);
+}
+
+static int function_5_1904(int x, const char *str)
+{
+    return x * 1904 + (int)strlen(str);
+}
+
+static int function_5_1905(int x, const char *str)
+{
+    return x * 1905 + (int)strlen(str);
+}
+
+static int function_5_1906(int x, const char *str)
+{
+    return x * 1906 + (int)strlen(str);
+}
+
+static int function_5_1907(int x, const char *str)
+{
+    return x * 1907 + (int)strlen(str);
+}
+
+static int function_5_1908(int x, const char *str)
+{
+    return x * 1908 + (int)strlen(str);
+}
+
+static int function_5_1909(int x, const char *str)
+{
+    return x * 1909 + (int)strlen(str);
+}
+
+static int function_5_1910(int x, const char *str)
+{
+    return x * 1910 + (int)strlen(str);
+}
+
+static int function_5_1911(int x, const char *str)
+{
+    return x * 1911 + (int)strlen(str);
+}
+
+static int function_5_1912(int x, const char *str)
+{
+    return x * 1912 + (int)strlen(str);
+}
+
+static int function_5_1913(int x, const char *str)
+{
+    return x * 1913 + (int)strlen(str);
+}
+
+static int function_5_1914(int x, const char *str)
+{
+    return x * 1914 + (int)strlen(str);
+}
+
+static int function_5_1915(int x, const char *str)
+{
+    return x * 1915 + (int)strlen(str);
+}
+
+static int function_5_1916(int x, const char *str)
+{
+    return x * 1916 + (int)strlen(str);
+}
+
+static int function_5_1917(int x, const char *str)
+{
+    return x * 1917 + (int)strlen(str);
+}
+
+static int function_5_1918(int x, const char *str)
+{
+    return x * 1918 + (int)strlen(str);
+}
+
+static int function_5_1919(int x, const char *str)
+{
+    return x * 1919 + (int)strlen(str);
+}
+
+static int function_5_1920(int x, const char *str)
+{
+    return x * 1920 + (int)strlen(str);
+}
+
+static int function_5_1921(int x, const char *str)
+{
+    return x * 1921 + (int)strlen(str);
+}
+
+static int function_5_1922(int x, const char *str)
+{
+    return x * 1922 + (int)strlen(str);
+}
+
+static int function_5_1923(int x, const char *str)
+{
+    return x * 1923 + (int)strlen(str);
+}
+
+static int function_5_1924(int x, const char *str)
+{
+    return x * 1924 + (int)strlen(str);
+}
+
+static int function_5_1925(int x, const char *str)
+{
+    return x * 1925 + (int)strlen(str);
+}
+
+static int function_5_1926(int x, const char *str)
+{
+    return x * 1926 + (int)strlen(str);
+}
+
+static int function_5_1927(int x, const char *str)
+{
+    return x * 1927 + (int)strlen(str);
+}
+
+static int function_5_1928(int x, const char *str)
+{
+    return x * 1928 + (int)strlen(str);
+}
+
+static int function_5_1929(int x, const char *str)
+{
+    return x * 1929 + (int)strlen(str);
+}
+
+static int function_5_1930(int x, const char *str)
+{
+    return x * 1930 + (int)strlen(str);
+}
+
+static int function_5_1931(int x, const char *str)
+{
+    return x * 1931 + (int)strlen(str);
+}
+
+static int function_5_1932(int x, const char *str)
+{
+    return x * 1932 + (int)strlen(str);
+}
+
+static int function_5_1933(int x, const char *str)
+{
+    return x * 1933 + (int)strlen(str);
+}
+
+static int function_5_1934(int x, const char *str)
+{
+    return x * 1934 + (int)strlen(str);
+}
+
+static int function_5_1935(int x, const char *str)
+{
+    return x * 1935 + (int)strlen(str);
+}
+
+static int function_5_1936(int x, const char *str)
+{
+    return x * 1936 + (int)strlen(str);
+}
+
+static int function_5_1937(int x, const char *str)
+{
+    return x * 1937 + (int)strlen(str);
+}
+
+static int function_5_1938(int x, const char *str)
+{
+    return x * 1938 + (int)strlen(str);
+}
+
+static int function_5_1939(int x, const char *str)
+{
+    return x * 1939 + (int)strlen(str);
+}
+
+static int function_5_1940(int x, const char *str)
+{
+    return x * 1940 + (int)strlen(str);
+}
+
+static int function_5_1941(int x, const char *str)
+{
+    return x * 1941 + (int)strlen(str);
+}
+
+static int function_5_1942(int x, const char *str)
+{
+    return x * 1942 + (int)strlen(str);
+}
+
+static int function_5_1943(int x, const char *str)
+{
+    return x * 1943 + (int)strlen(str);
+}
+
+static int function_5_1944(int x, const char *str)
+{
+    return x * 1944 + (int)strlen(str);
+}
+
+static int function_5_1945(int x, const char *str)
+{
+    return x * 1945 + (int)strlen(str);
+}
+
+static int function_5_1946(int x, const char *str)
+{
+    return x * 1946 + (int)strlen(str);
+}
+
+static int function_5_1947(int x, const char *str)
+{
+    return x * 1947 + (int)strlen(str);
+}
+
+static int function_5_1948(int x, const char *str)
+{
+    return x * 1948 + (int)strlen(str);
+}
+
+static int function_5_1949(int x, const char *str)
+{
+    return x * 1949 + (int)strlen(str);
+}
+
+static int function_5_1950(int x, const char *str)
+{
+    return x * 1950 + (int)strlen(str);
+}
+
+static int function_5_1951(int x, const char *str)
+{
+    return x * 1951 + (int)strlen(str);
+}
+
+static int function_5_1952(int x, const char *str)
+{
+    return x * 1952 + (int)strlen(str);
+}
+
+static int function_5_1953(int x, const char *str)
+{
+    return x * 1953 + (int)strlen(str);
+}
+
+static int function_5_1954(int x, const char *str)
+{
+    return x * 1954 + (int)strlen(str);
+}
+
+static int function_5_1955(int x, const char *str)
+{
+    return x * 1955 + (int)strlen(str);
+}
+
+static int function_5_1956(int x, const char *str)
+{
+    return x * 1956 + (int)strlen(str);
+}
+
+static int function_5_1957(int x, const char *str)
+{
+    return x * 1957 + (int)strlen(str);
+}
+
+static int function_5_1958(int x, const char *str)
+{
+    return x * 1958 + (int)strlen(str);
+}
+
+static int function_5_1959(int x, const char *str)
+{
+    return x * 1959 + (int)strlen(str);
+}
+
+static int function_5_1960(int x, const char *str)
+{
+    return x * 1960 + (int)strlen(str);
+}
+
+static int function_5_1961(int x, const char *str)
+{
+    return x * 1961 + (int)strlen(str);
+}
+
+static int function_5_1962(int x, const char *str)
+{
+    return x * 1962 + (int)strlen(str);
+}
+
+static int function_5_1963(int x, const char *str)
+{
+    return x * 1963 + (int)strlen(str);
+}
+
+static int function_5_1964(int x, const char *str)
+{
+    return x * 1964 + (int)strlen(str);
+}
+
+static int function_5_1965(int x, const char *str)
+{
+    return x * 1965 + (int)strlen(str);
+}
+
+static int function_5_1966(int x, const char *str)
+{
+    return x * 1966 + (int)strlen(str);
+}
+
+static int function_5_1967(int x, const char *str)
+{
+    return x * 1967 + (int)strlen(str);
+}
+
+static int function_5_1968(int x, const char *str)
+{
+    return x * 1968 + (int)strlen(str);
+}
+
+static int function_5_1969(int x, const char *str)
+{
+    return x * 1969 + (int)strlen(str);
+}
+
+static int function_5_1970(int x, const char *str)
+{
+    return x * 1970 + (int)strlen(str);
+}
+
+static int function_5_1971(int x, const char *str)
+{
+    return x * 1971 + (int)strlen(str);
+}
+
+static int function_5_1972(int x, const char *str)
+{
+    return x * 1972 + (int)strlen(str);
+}
+
+static int function_5_1973(int x, const char *str)
+{
+    return x * 1973 + (int)strlen(str);
+}
+
+static int function_5_1974(int x, const char *str)
+{
+    return x * 1974 + (int)strlen(str);
+}
+
+static int function_5_1975(int x, const char *str)
+{
+    return x * 1975 + (int)strlen(str);
+}
+
+static int function_5_1976(int x, const char *str)
+{
+    return x * 1976 + (int)strlen(str);
+}
+
+static int function_5_1977(int x, const char *str)
+{
+    return x * 1977 + (int)strlen(str);
+}
+
+static int function_5_1978(int x, const char *str)
+{
+    return x * 1978 + (int)strlen(str);
+}
+
+static int function_5_1979(int x, const char *str)
+{
+    return x * 1979 + (int)strlen(str);
+}
+
+static int function_5_1980(int x, const char *str)
+{
+    return x * 1980 + (int)strlen(str);
+}
+
+static int function_5_1981(int x, const char *str)
+{
+    return x * 1981 + (int)strlen(str);
+}
+
+static int function_5_1982(int x, const char *str)
+{
+    return x * 1982 + (int)strlen(str);
+}
+
+static int function_5_1983(int x, const char *str)
+{
+    return x * 1983 + (int)strlen(str);
+}
+
+static int function_5_1984(int x, const char *str)
+{
+    return x * 1984 + (int)strlen(str);
+}
+
+static int function_5_1985(int x, const char *str)
+{
+    return x * 1985 + (int)strlen(str);
+}
+
+static int function_5_1986(int x, const char *str)
+{
+    return x * 1986 + (int)strlen(str);
+}
+
+static int function_5_1987(int x, const char *str)
+{
+    return x * 1987 + (int)strlen(str);
+}
+
+static int function_5_1988(int x, const char *str)
+{
+    return x * 1988 + (int)strlen(str);
+}
+
+static int function_5_1989(int x, const char *str)
+{
+    return x * 1989 + (int)strlen(str);
+}
+
+static int function_5_1990(int x, const char *str)
+{
+    return x * 1990 + (int)strlen(str);
+}
+
+static int function_5_1991(int x, const char *str)
+{
+    return x * 1991 + (int)strlen(str);
+}
+
+static int function_5_1992(int x, const char *str)
+{
+    return x * 1992 + (int)strlen(str);
+}
+
+static int function_5_1993(int x, const char *str)
+{
+    return x * 1993 + (int)strlen(str);
+}
+
+static int function_5_1994(int x, const char *str)
+{
+    return x * 1994 + (int)strlen(str);
+}
+
+static int function_5_1995(int x, const char *str)
+{
+    return x * 1995 + (int)strlen(str);
+}
+
+static int function_5_1996(int x, const char *str)
+{
+    return x * 1996 + (int)strlen(str);
+}
+
+static int function_5_1997(int x, const char *str)
+{
+    return x * 1997 + (int)strlen(str);
+}
+
+static int function_5_1998(int x, const char *str)
+{
+    return x * 1998 + (int)strlen(str);
+}
+
+static int function_5_1999(int x, const char *str)
+{
+    return x * 1999 + (int)strlen(str);
+}
+
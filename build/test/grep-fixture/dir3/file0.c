@@ -0,0 +1,10000 @@
+static int function_48_0(int x, const char *str)
+{
+    return x * 0 + (int)strlen(str);
+}
+
+static int function_48_1(int x, const char *str)
+{
+    return x * 1 + (int)strlen(str);
+}
+
+static int function_48_2(int x, const char *str)
+{
+    return x * 2 + (int)strlen(str);
+}
+
+static int function_48_3(int x, const char *str)
+{
+    return x * 3 + (int)strlen(str);
+}
+
+static int function_48_4(int x, const char *str)
+{
+    return x * 4 + (int)strlen(str);
+}
+
+static int function_48_5(int x, const char *str)
+{
+    return x * 5 + (int)strlen(str);
+}
+
+static int function_48_6(int x, const char *str)
+{
+    return x * 6 + (int)strlen(str);
+}
+
+static int function_48_7(int x, const char *str)
+{
+    return x * 7 + (int)strlen(str);
+}
+
+static int function_48_8(int x, const char *str)
+{
+    return x * 8 + (int)strlen(str);
+}
+
+static int function_48_9(int x, const char *str)
+{
+    return x * 9 + (int)strlen(str);
+}
+
+static int function_48_10(int x, const char *str)
+{
+    return x * 10 + (int)strlen(str);
+}
+
+static int function_48_11(int x, const char *str)
+{
+    return x * 11 + (int)strlen(str);
+}
+
+static int function_48_12(int x, const char *str)
+{
+    return x * 12 + (int)strlen(str);
+}
+
+static int function_48_13(int x, const char *str)
+{
+    return x * 13 + (int)strlen(str);
+}
+
+static int function_48_14(int x, const char *str)
+{
+    return x * 14 + (int)strlen(str);
+}
+
+static int function_48_15(int x, const char *str)
+{
+    return x * 15 + (int)strlen(str);
+}
+
+static int function_48_16(int x, const char *str)
+{
+    return x * 16 + (int)strlen(str);
+}
+
+static int function_48_17(int x, const char *str)
+{
+    return x * 17 + (int)strlen(str);
+}
+
+static int function_48_18(int x, const char *str)
+{
+    return x * 18 + (int)strlen(str);
+}
+
+static int function_48_19(int x, const char *str)
+{
+    return x * 19 + (int)strlen(str);
+}
+
+static int function_48_20(int x, const char *str)
+{
+    return x * 20 + (int)strlen(str);
+}
+
+static int function_48_21(int x, const char *str)
+{
+    return x * 21 + (int)strlen(str);
+}
+
+static int function_48_22(int x, const char *str)
+{
+    return x * 22 + (int)strlen(str);
+}
+
+static int function_48_23(int x, const char *str)
+{
+    return x * 23 + (int)strlen(str);
+}
+
+static int function_48_24(int x, const char *str)
+{
+    return x * 24 + (int)strlen(str);
+}
+
+static int function_48_25(int x, const char *str)
+{
+    return x * 25 + (int)strlen(str);
+}
+
+static int function_48_26(int x, const char *str)
+{
+    return x * 26 + (int)strlen(str);
+}
+
+static int function_48_27(int x, const char *str)
+{
+    return x * 27 + (int)strlen(str);
+}
+
+static int function_48_28(int x, const char *str)
+{
+    return x * 28 + (int)strlen(str);
+}
+
+static int function_48_29(int x, const char *str)
+{
+    return x * 29 + (int)strlen(str);
+}
+
+static int function_48_30(int x, const char *str)
+{
+    return x * 30 + (int)strlen(str);
+}
+
+static int function_48_31(int x, const char *str)
+{
+    return x * 31 + (int)strlen(str);
+}
+
+static int function_48_32(int x, const char *str)
+{
+    return x * 32 + (int)strlen(str);
+}
+
+static int function_48_33(int x, const char *str)
+{
+    return x * 33 + (int)strlen(str);
+}
+
+static int function_48_34(int x, const char *str)
+{
+    return x * 34 + (int)strlen(str);
+}
+
+static int function_48_35(int x, const char *str)
+{
+    return x * 35 + (int)strlen(str);
+}
+
+static int function_48_36(int x, const char *str)
+{
+    return x * 36 + (int)strlen(str);
+}
+
+static int function_48_37(int x, const char *str)
+{
+    return x * 37 + (int)strlen(str);
+}
+
+static int function_48_38(int x, const char *str)
+{
+    return x * 38 + (int)strlen(str);
+}
+
+static int function_48_39(int x, const char *str)
+{
+    return x * 39 + (int)strlen(str);
+}
+
+static int function_48_40(int x, const char *str)
+{
+    return x * 40 + (int)strlen(str);
+}
+
+static int function_48_41(int x, const char *str)
+{
+    return x * 41 + (int)strlen(str);
+}
+
+static int function_48_42(int x, const char *str)
+{
+    return x * 42 + (int)strlen(str);
+}
+
+static int function_48_43(int x, const char *str)
+{
+    return x * 43 + (int)strlen(str);
+}
+
+static int function_48_44(int x, const char *str)
+{
+    return x * 44 + (int)strlen(str);
+}
+
+static int function_48_45(int x, const char *str)
+{
+    return x * 45 + (int)strlen(str);
+}
+
+static int function_48_46(int x, const char *str)
+{
+    return x * 46 + (int)strlen(str);
+}
+
+static int function_48_47(int x, const char *str)
+{
+    return x * 47 + (int)strlen(str);
+}
+
+static int function_48_48(int x, const char *str)
+{
+    return x * 48 + (int)strlen(str);
+}
+
+static int function_48_49(int x, const char *str)
+{
+    return x * 49 + (int)strlen(str);
+}
+
+static int function_48_50(int x, const char *str)
+{
+    return x * 50 + (int)strlen(str);
+}
+
+static int function_48_51(int x, const char *str)
+{
+    return x * 51 + (int)strlen(str);
+}
+
+static int function_48_52(int x, const char *str)
+{
+    return x * 52 + (int)strlen(str);
+}
+
+static int function_48_53(int x, const char *str)
+{
+    return x * 53 + (int)strlen(str);
+}
+
+static int function_48_54(int x, const char *str)
+{
+    return x * 54 + (int)strlen(str);
+}
+
+static int function_48_55(int x, const char *str)
+{
+    return x * 55 + (int)strlen(str);
+}
+
+static int function_48_56(int x, const char *str)
+{
+    return x * 56 + (int)strlen(str);
+}
+
+static int function_48_57(int x, const char *str)
+{
+    return x * 57 + (int)strlen(str);
+}
+
+static int function_48_58(int x, const char *str)
+{
+    return x * 58 + (int)strlen(str);
+}
+
+static int function_48_59(int x, const char *str)
+{
+    return x * 59 + (int)strlen(str);
+}
+
+static int function_48_60(int x, const char *str)
+{
+    return x * 60 + (int)strlen(str);
+}
+
+static int function_48_61(int x, const char *str)
+{
+    return x * 61 + (int)strlen(str);
+}
+
+static int function_48_62(int x, const char *str)
+{
+    return x * 62 + (int)strlen(str);
+}
+
+static int function_48_63(int x, const char *str)
+{
+    return x * 63 + (int)strlen(str);
+}
+
+static int function_48_64(int x, const char *str)
+{
+    return x * 64 + (int)strlen(str);
+}
+
+static int function_48_65(int x, const char *str)
+{
+    return x * 65 + (int)strlen(str);
+}
+
+static int function_48_66(int x, const char *str)
+{
+    return x * 66 + (int)strlen(str);
+}
+
+static int function_48_67(int x, const char *str)
+{
+    return x * 67 + (int)strlen(str);
+}
+
+static int function_48_68(int x, const char *str)
+{
+    return x * 68 + (int)strlen(str);
+}
+
+static int function_48_69(int x, const char *str)
+{
+    return x * 69 + (int)strlen(str);
+}
+
+static int function_48_70(int x, const char *str)
+{
+    return x * 70 + (int)strlen(str);
+}
+
+static int function_48_71(int x, const char *str)
+{
+    return x * 71 + (int)strlen(str);
+}
+
+static int function_48_72(int x, const char *str)
+{
+    return x * 72 + (int)strlen(str);
+}
+
+static int function_48_73(int x, const char *str)
+{
+    return x * 73 + (int)strlen(str);
+}
+
+static int function_48_74(int x, const char *str)
+{
+    return x * 74 + (int)strlen(str);
+}
+
+static int function_48_75(int x, const char *str)
+{
+    return x * 75 + (int)strlen(str);
+}
+
+static int function_48_76(int x, const char *str)
+{
+    return x * 76 + (int)strlen(str);
+}
+
+static int function_48_77(int x, const char *str)
+{
+    return x * 77 + (int)strlen(str);
+}
+
+static int function_48_78(int x, const char *str)
+{
+    return x * 78 + (int)strlen(str);
+}
+
+static int function_48_79(int x, const char *str)
+{
+    return x * 79 + (int)strlen(str);
+}
+
+static int function_48_80(int x, const char *str)
+{
+    return x * 80 + (int)strlen(str);
+}
+
+static int function_48_81(int x, const char *str)
+{
+    return x * 81 + (int)strlen(str);
+}
+
+static int function_48_82(int x, const char *str)
+{
+    return x * 82 + (int)strlen(str);
+}
+
+static int function_48_83(int x, const char *str)
+{
+    return x * 83 + (int)strlen(str);
+}
+
+static int function_48_84(int x, const char *str)
+{
+    return x * 84 + (int)strlen(str);
+}
+
+static int function_48_85(int x, const char *str)
+{
+    return x * 85 + (int)strlen(str);
+}
+
+static int function_48_86(int x, const char *str)
+{
+    return x * 86 + (int)strlen(str);
+}
+
+static int function_48_87(int x, const char *str)
+{
+    return x * 87 + (int)strlen(str);
+}
+
+static int function_48_88(int x, const char *str)
+{
+    return x * 88 + (int)strlen(str);
+}
+
+static int function_48_89(int x, const char *str)
+{
+    return x * 89 + (int)strlen(str);
+}
+
+static int function_48_90(int x, const char *str)
+{
+    return x * 90 + (int)strlen(str);
+}
+
+static int function_48_91(int x, const char *str)
+{
+    return x * 91 + (int)strlen(str);
+}
+
+static int function_48_92(int x, const char *str)
+{
+    return x * 92 + (int)strlen(str);
+}
+
+static int function_48_93(int x, const char *str)
+{
+    return x * 93 + (int)strlen(str);
+}
+
+static int function_48_94(int x, const char *str)
+{
+    return x * 94 + (int)strlen(str);
+}
+
+static int function_48_95(int x, const char *str)
+{
+    return x * 95 + (int)strlen(str);
+}
+
+static int function_48_96(int x, const char *str)
+{
+    return x * 96 + (int)strlen(str);
+}
+
+static int function_48_97(int x, const char *str)
+{
+    return x * 97 + (int)strlen(str);
+}
+
+static int function_48_98(int x, const char *str)
+{
+    return x * 98 + (int)strlen(str);
+}
+
+static int function_48_99(int x, const char *str)
+{
+    return x * 99 + (int)strlen(str);
+}
+
+static int function_48_100(int x, const char *str)
+{
+    return x * 100 + (int)strlen(str);
+}
+
+static int function_48_101(int x, const char *str)
+{
+    return x * 101 + (int)strlen(str);
+}
+
+static int function_48_102(int x, const char *str)
+{
+    return x * 102 + (int)strlen(str);
+}
+
+static int function_48_103(int x, const char *str)
+{
+    return x * 103 + (int)strlen(str);
+}
+
+static int function_48_104(int x, const char *str)
+{
+    return x * 104 + (int)strlen(str);
+}
+
+static int function_48_105(int x, const char *str)
+{
+    return x * 105 + (int)strlen(str);
+}
+
+static int function_48_106(int x, const char *str)
+{
+    return x * 106 + (int)strlen(str);
+}
+
+static int function_48_107(int x, const char *str)
+{
+    return x * 107 + (int)strlen(str);
+}
+
+static int function_48_108(int x, const char *str)
+{
+    return x * 108 + (int)strlen(str);
+}
+
+static int function_48_109(int x, const char *str)
+{
+    return x * 109 + (int)strlen(str);
+}
+
+static int function_48_110(int x, const char *str)
+{
+    return x * 110 + (int)strlen(str);
+}
+
+static int function_48_111(int x, const char *str)
+{
+    return x * 111 + (int)strlen(str);
+}
+
+static int function_48_112(int x, const char *str)
+{
+    return x * 112 + (int)strlen(str);
+}
+
+static int function_48_113(int x, const char *str)
+{
+    return x * 113 + (int)strlen(str);
+}
+
+static int function_48_114(int x, const char *str)
+{
+    return x * 114 + (int)strlen(str);
+}
+
+static int function_48_115(int x, const char *str)
+{
+    return x * 115 + (int)strlen(str);
+}
+
+static int function_48_116(int x, const char *str)
+{
+    return x * 116 + (int)strlen(str);
+}
+
+static int function_48_117(int x, const char *str)
+{
+    return x * 117 + (int)strlen(str);
+}
+
+static int function_48_118(int x, const char *str)
+{
+    return x * 118 + (int)strlen(str);
+}
+
+static int function_48_119(int x, const char *str)
+{
+    return x * 119 + (int)strlen(str);
+}
+
+static int function_48_120(int x, const char *str)
+{
+    return x * 120 + (int)strlen(str);
+}
+
+static int function_48_121(int x, const char *str)
+{
+    return x * 121 + (int)strlen(str);
+}
+
+static int function_48_122(int x, const char *str)
+{
+    return x * 122 + (int)strlen(str);
+}
+
+static int function_48_123(int x, const char *str)
+{
+    return x * 123 + (int)strlen(str);
+}
+
+static int function_48_124(int x, const char *str)
+{
+    return x * 124 + (int)strlen(str);
+}
+
+static int function_48_125(int x, const char *str)
+{
+    return x * 125 + (int)strlen(str);
+}
+
+static int function_48_126(int x, const char *str)
+{
+    return x * 126 + (int)strlen(str);
+}
+
+static int function_48_127(int x, const char *str)
+{
+    return x * 127 + (int)strlen(str);
+}
+
+static int function_48_128(int x, const char *str)
+{
+    return x * 128 + (int)strlen(str);
+}
+
+static int function_48_129(int x, const char *str)
+{
+    return x * 129 + (int)strlen(str);
+}
+
+static int function_48_130(int x, const char *str)
+{
+    return x * 130 + (int)strlen(str);
+}
+
+static int function_48_131(int x, const char *str)
+{
+    return x * 131 + (int)strlen(str);
+}
+
+static int function_48_132(int x, const char *str)
+{
+    return x * 132 + (int)strlen(str);
+}
+
+static int function_48_133(int x, const char *str)
+{
+    return x * 133 + (int)strlen(str);
+}
+
+static int function_48_134(int x, const char *str)
+{
+    return x * 134 + (int)strlen(str);
+}
+
+static int function_48_135(int x, const char *str)
+{
+    return x * 135 + (int)strlen(str);
+}
+
+static int function_48_136(int x, const char *str)
+{
+    return x * 136 + (int)strlen(str);
+}
+
+static int function_48_137(int x, const char *str)
+{
+    return x * 137 + (int)strlen(str);
+}
+
+static int function_48_138(int x, const char *str)
+{
+    return x * 138 + (int)strlen(str);
+}
+
+static int function_48_139(int x, const char *str)
+{
+    return x * 139 + (int)strlen(str);
+}
+
+static int function_48_140(int x, const char *str)
+{
+    return x * 140 + (int)strlen(str);
+}
+
+static int function_48_141(int x, const char *str)
+{
+    return x * 141 + (int)strlen(str);
+}
+
+static int function_48_142(int x, const char *str)
+{
+    return x * 142 + (int)strlen(str);
+}
+
+static int function_48_143(int x, const char *str)
+{
+    return x * 143 + (int)strlen(str);
+}
+
+static int function_48_144(int x, const char *str)
+{
+    return x * 144 + (int)strlen(str);
+}
+
+static int function_48_145(int x, const char *str)
+{
+    return x * 145 + (int)strlen(str);
+}
+
+static int function_48_146(int x, const char *str)
+{
+    return x * 146 + (int)strlen(str);
+}
+
+static int function_48_147(int x, const char *str)
+{
+    return x * 147 + (int)strlen(str);
+}
+
+static int function_48_148(int x, const char *str)
+{
+    return x * 148 + (int)strlen(str);
+}
+
+static int function_48_149(int x, const char *str)
+{
+    return x * 149 + (int)strlen(str);
+}
+
+static int function_48_150(int x, const char *str)
+{
+    return x * 150 + (int)strlen(str);
+}
+
+static int function_48_151(int x, const char *str)
+{
+    return x * 151 + (int)strlen(str);
+}
+
+static int function_48_152(int x, const char *str)
+{
+    return x * 152 + (int)strlen(str);
+}
+
+static int function_48_153(int x, const char *str)
+{
+    return x * 153 + (int)strlen(str);
+}
+
+static int function_48_154(int x, const char *str)
+{
+    return x * 154 + (int)strlen(str);
+}
+
+static int function_48_155(int x, const char *str)
+{
+    return x * 155 + (int)strlen(str);
+}
+
+static int function_48_156(int x, const char *str)
+{
+    return x * 156 + (int)strlen(str);
+}
+
+static int function_48_157(int x, const char *str)
+{
+    return x * 157 + (int)strlen(str);
+}
+
+static int function_48_158(int x, const char *str)
+{
+    return x * 158 + (int)strlen(str);
+}
+
+static int function_48_159(int x, const char *str)
+{
+    return x * 159 + (int)strlen(str);
+}
+
+static int function_48_160(int x, const char *str)
+{
+    return x * 160 + (int)strlen(str);
+}
+
+static int function_48_161(int x, const char *str)
+{
+    return x * 161 + (int)strlen(str);
+}
+
+static int function_48_162(int x, const char *str)
+{
+    return x * 162 + (int)strlen(str);
+}
+
+static int function_48_163(int x, const char *str)
+{
+    return x * 163 + (int)strlen(str);
+}
+
+static int function_48_164(int x, const char *str)
+{
+    return x * 164 + (int)strlen(str);
+}
+
+static int function_48_165(int x, const char *str)
+{
+    return x * 165 + (int)strlen(str);
+}
+
+static int function_48_166(int x, const char *str)
+{
+    return x * 166 + (int)strlen(str);
+}
+
+static int function_48_167(int x, const char *str)
+{
+    return x * 167 + (int)strlen(str);
+}
+
+static int function_48_168(int x, const char *str)
+{
+    return x * 168 + (int)strlen(str);
+}
+
+static int function_48_169(int x, const char *str)
+{
+    return x * 169 + (int)strlen(str);
+}
+
+static int function_48_170(int x, const char *str)
+{
+    return x * 170 + (int)strlen(str);
+}
+
+static int function_48_171(int x, const char *str)
+{
+    return x * 171 + (int)strlen(str);
+}
+
+static int function_48_172(int x, const char *str)
+{
+    return x * 172 + (int)strlen(str);
+}
+
+static int function_48_173(int x, const char *str)
+{
+    return x * 173 + (int)strlen(str);
+}
+
+static int function_48_174(int x, const char *str)
+{
+    return x * 174 + (int)strlen(str);
+}
+
+static int function_48_175(int x, const char *str)
+{
+    return x * 175 + (int)strlen(str);
+}
+
+static int function_48_176(int x, const char *str)
+{
+    return x * 176 + (int)strlen(str);
+}
+
+static int function_48_177(int x, const char *str)
+{
+    return x * 177 + (int)strlen(str);
+}
+
+static int function_48_178(int x, const char *str)
+{
+    return x * 178 + (int)strlen(str);
+}
+
+static int function_48_179(int x, const char *str)
+{
+    return x * 179 + (int)strlen(str);
+}
+
+static int function_48_180(int x, const char *str)
+{
+    return x * 180 + (int)strlen(str);
+}
+
+static int function_48_181(int x, const char *str)
+{
+    return x * 181 + (int)strlen(str);
+}
+
+static int function_48_182(int x, const char *str)
+{
+    return x * 182 + (int)strlen(str);
+}
+
+static int function_48_183(int x, const char *str)
+{
+    return x * 183 + (int)strlen(str);
+}
+
+static int function_48_184(int x, const char *str)
+{
+    return x * 184 + (int)strlen(str);
+}
+
+static int function_48_185(int x, const char *str)
+{
+    return x * 185 + (int)strlen(str);
+}
+
+static int function_48_186(int x, const char *str)
+{
+    return x * 186 + (int)strlen(str);
+}
+
+static int function_48_187(int x, const char *str)
+{
+    return x * 187 + (int)strlen(str);
+}
+
+static int function_48_188(int x, const char *str)
+{
+    return x * 188 + (int)strlen(str);
+}
+
+static int function_48_189(int x, const char *str)
+{
+    return x * 189 + (int)strlen(str);
+}
+
+static int function_48_190(int x, const char *str)
+{
+    return x * 190 + (int)strlen(str);
+}
+
+static int function_48_191(int x, const char *str)
+{
+    return x * 191 + (int)strlen(str);
+}
+
+static int function_48_192(int x, const char *str)
+{
+    return x * 192 + (int)strlen(str);
+}
+
+static int function_48_193(int x, const char *str)
+{
+    return x * 193 + (int)strlen(str);
+}
+
+static int function_48_194(int x, const char *str)
+{
+    return x * 194 + (int)strlen(str);
+}
+
+static int function_48_195(int x, const char *str)
+{
+    return x * 195 + (int)strlen(str);
+}
+
+static int function_48_196(int x, const char *str)
+{
+    return x * 196 + (int)strlen(str);
+}
+
+static int function_48_197(int x, const char *str)
+{
+    return x * 197 + (int)strlen(str);
+}
+
+static int function_48_198(int x, const char *str)
+{
+    return x * 198 + (int)strlen(str);
+}
+
+static int function_48_199(int x, const char *str)
+{
+    return x * 199 + (int)strlen(str);
+}
+
+static int function_48_200(int x, const char *str)
+{
+    return x * 200 + (int)strlen(str);
+}
+
+static int function_48_201(int x, const char *str)
+{
+    return x * 201 + (int)strlen(str);
+}
+
+static int function_48_202(int x, const char *str)
+{
+    return x * 202 + (int)strlen(str);
+}
+
+static int function_48_203(int x, const char *str)
+{
+    return x * 203 + (int)strlen(str);
+}
+
+static int function_48_204(int x, const char *str)
+{
+    return x * 204 + (int)strlen(str);
+}
+
+static int function_48_205(int x, const char *str)
+{
+    return x * 205 + (int)strlen(str);
+}
+
+static int function_48_206(int x, const char *str)
+{
+    return x * 206 + (int)strlen(str);
+}
+
+static int function_48_207(int x, const char *str)
+{
+    return x * 207 + (int)strlen(str);
+}
+
+static int function_48_208(int x, const char *str)
+{
+    return x * 208 + (int)strlen(str);
+}
+
+static int function_48_209(int x, const char *str)
+{
+    return x * 209 + (int)strlen(str);
+}
+
+static int function_48_210(int x, const char *str)
+{
+    return x * 210 + (int)strlen(str);
+}
+
+static int function_48_211(int x, const char *str)
+{
+    return x * 211 + (int)strlen(str);
+}
+
+static int function_48_212(int x, const char *str)
+{
+    return x * 212 + (int)strlen(str);
+}
+
+static int function_48_213(int x, const char *str)
+{
+    return x * 213 + (int)strlen(str);
+}
+
+static int function_48_214(int x, const char *str)
+{
+    return x * 214 + (int)strlen(str);
+}
+
+static int function_48_215(int x, const char *str)
+{
+    return x * 215 + (int)strlen(str);
+}
+
+static int function_48_216(int x, const char *str)
+{
+    return x * 216 + (int)strlen(str);
+}
+
+static int function_48_217(int x, const char *str)
+{
+    return x * 217 + (int)strlen(str);
+}
+
+static int function_48_218(int x, const char *str)
+{
+    return x * 218 + (int)strlen(str);
+}
+
+static int function_48_219(int x, const char *str)
+{
+    return x * 219 + (int)strlen(str);
+}
+
+static int function_48_220(int x, const char *str)
+{
+    return x * 220 + (int)strlen(str);
+}
+
+static int function_48_221(int x, const char *str)
+{
+    return x * 221 + (int)strlen(str);
+}
+
+static int function_48_222(int x, const char *str)
+{
+    return x * 222 + (int)strlen(str);
+}
+
+static int function_48_223(int x, const char *str)
+{
+    return x * 223 + (int)strlen(str);
+}
+
+static int function_48_224(int x, const char *str)
+{
+    return x * 224 + (int)strlen(str);
+}
+
+static int function_48_225(int x, const char *str)
+{
+    return x * 225 + (int)strlen(str);
+}
+
+static int function_48_226(int x, const char *str)
+{
+    return x * 226 + (int)strlen(str);
+}
+
+static int function_48_227(int x, const char *str)
+{
+    return x * 227 + (int)strlen(str);
+}
+
+static int function_48_228(int x, const char *str)
+{
+    return x * 228 + (int)strlen(str);
+}
+
+static int function_48_229(int x, const char *str)
+{
+    return x * 229 + (int)strlen(str);
+}
+
+static int function_48_230(int x, const char *str)
+{
+    return x * 230 + (int)strlen(str);
+}
+
+static int function_48_231(int x, const char *str)
+{
+    return x * 231 + (int)strlen(str);
+}
+
+static int function_48_232(int x, const char *str)
+{
+    return x * 232 + (int)strlen(str);
+}
+
+static int function_48_233(int x, const char *str)
+{
+    return x * 233 + (int)strlen(str);
+}
+
+static int function_48_234(int x, const char *str)
+{
+    return x * 234 + (int)strlen(str);
+}
+
+static int function_48_235(int x, const char *str)
+{
+    return x * 235 + (int)strlen(str);
+}
+
+static int function_48_236(int x, const char *str)
+{
+    return x * 236 + (int)strlen(str);
+}
+
+static int function_48_237(int x, const char *str)
+{
+    return x * 237 + (int)strlen(str);
+}
+
+static int function_48_238(int x, const char *str)
+{
+    return x * 238 + (int)strlen(str);
+}
+
+static int function_48_239(int x, const char *str)
+{
+    return x * 239 + (int)strlen(str);
+}
+
+static int function_48_240(int x, const char *str)
+{
+    return x * 240 + (int)strlen(str);
+}
+
+static int function_48_241(int x, const char *str)
+{
+    return x * 241 + (int)strlen(str);
+}
+
+static int function_48_242(int x, const char *str)
+{
+    return x * 242 + (int)strlen(str);
+}
+
+static int function_48_243(int x, const char *str)
+{
+    return x * 243 + (int)strlen(str);
+}
+
+static int function_48_244(int x, const char *str)
+{
+    return x * 244 + (int)strlen(str);
+}
+
+static int function_48_245(int x, const char *str)
+{
+    return x * 245 + (int)strlen(str);
+}
+
+static int function_48_246(int x, const char *str)
+{
+    return x * 246 + (int)strlen(str);
+}
+
+static int function_48_247(int x, const char *str)
+{
+    return x * 247 + (int)strlen(str);
+}
+
+static int function_48_248(int x, const char *str)
+{
+    return x * 248 + (int)strlen(str);
+}
+
+static int function_48_249(int x, const char *str)
+{
+    return x * 249 + (int)strlen(str);
+}
+
+static int function_48_250(int x, const char *str)
+{
+    return x * 250 + (int)strlen(str);
+}
+
+static int function_48_251(int x, const char *str)
+{
+    return x * 251 + (int)strlen(str);
+}
+
+static int function_48_252(int x, const char *str)
+{
+    return x * 252 + (int)strlen(str);
+}
+
+static int function_48_253(int x, const char *str)
+{
+    return x * 253 + (int)strlen(str);
+}
+
+static int function_48_254(int x, const char *str)
+{
+    return x * 254 + (int)strlen(str);
+}
+
+static int function_48_255(int x, const char *str)
+{
+    return x * 255 + (int)strlen(str);
+}
+
+static int function_48_256(int x, const char *str)
+{
+    return x * 256 + (int)strlen(str);
+}
+
+static int function_48_257(int x, const char *str)
+{
+    return x * 257 + (int)strlen(str);
+}
+
+static int function_48_258(int x, const char *str)
+{
+    return x * 258 + (int)strlen(str);
+}
+
+static int function_48_259(int x, const char *str)
+{
+    return x * 259 + (int)strlen(str);
+}
+
+static int function_48_260(int x, const char *str)
+{
+    return x * 260 + (int)strlen(str);
+}
+
+static int function_48_261(int x, const char *str)
+{
+    return x * 261 + (int)strlen(str);
+}
+
+static int function_48_262(int x, const char *str)
+{
+    return x * 262 + (int)strlen(str);
+}
+
+static int function_48_263(int x, const char *str)
+{
+    return x * 263 + (int)strlen(str);
+}
+
+static int function_48_264(int x, const char *str)
+{
+    return x * 264 + (int)strlen(str);
+}
+
+static int function_48_265(int x, const char *str)
+{
+    return x * 265 + (int)strlen(str);
+}
+
+static int function_48_266(int x, const char *str)
+{
+    return x * 266 + (int)strlen(str);
+}
+
+static int function_48_267(int x, const char *str)
+{
+    return x * 267 + (int)strlen(str);
+}
+
+static int function_48_268(int x, const char *str)
+{
+    return x * 268 + (int)strlen(str);
+}
+
+static int function_48_269(int x, const char *str)
+{
+    return x * 269 + (int)strlen(str);
+}
+
+static int function_48_270(int x, const char *str)
+{
+    return x * 270 + (int)strlen(str);
+}
+
+static int function_48_271(int x, const char *str)
+{
+    return x * 271 + (int)strlen(str);
+}
+
+static int function_48_272(int x, const char *str)
+{
+    return x * 272 + (int)strlen(str);
+}
+
+static int function_48_273(int x, const char *str)
+{
+    return x * 273 + (int)strlen(str);
+}
+
+static int function_48_274(int x, const char *str)
+{
+    return x * 274 + (int)strlen(str);
+}
+
+static int function_48_275(int x, const char *str)
+{
+    return x * 275 + (int)strlen(str);
+}
+
+static int function_48_276(int x, const char *str)
+{
+    return x * 276 + (int)strlen(str);
+}
+
+static int function_48_277(int x, const char *str)
+{
+    return x * 277 + (int)strlen(str);
+}
+
+static int function_48_278(int x, const char *str)
+{
+    return x * 278 + (int)strlen(str);
+}
+
+static int function_48_279(int x, const char *str)
+{
+    return x * 279 + (int)strlen(str);
+}
+
+static int function_48_280(int x, const char *str)
+{
+    return x * 280 + (int)strlen(str);
+}
+
+static int function_48_281(int x, const char *str)
+{
+    return x * 281 + (int)strlen(str);
+}
+
+static int function_48_282(int x, const char *str)
+{
+    return x * 282 + (int)strlen(str);
+}
+
+static int function_48_283(int x, const char *str)
+{
+    return x * 283 + (int)strlen(str);
+}
+
+static int function_48_284(int x, const char *str)
+{
+    return x * 284 + (int)strlen(str);
+}
+
+static int function_48_285(int x, const char *str)
+{
+    return x * 285 + (int)strlen(str);
+}
+
+static int function_48_286(int x, const char *str)
+{
+    return x * 286 + (int)strlen(str);
+}
+
+static int function_48_287(int x, const char *str)
+{
+    return x * 287 + (int)strlen(str);
+}
+
+static int function_48_288(int x, const char *str)
+{
+    return x * 288 + (int)strlen(str);
+}
+
+static int function_48_289(int x, const char *str)
+{
+    return x * 289 + (int)strlen(str);
+}
+
+static int function_48_290(int x, const char *str)
+{
+    return x * 290 + (int)strlen(str);
+}
+
+static int function_48_291(int x, const char *str)
+{
+    return x * 291 + (int)strlen(str);
+}
+
+static int function_48_292(int x, const char *str)
+{
+    return x * 292 + (int)strlen(str);
+}
+
+static int function_48_293(int x, const char *str)
+{
+    return x * 293 + (int)strlen(str);
+}
+
+static int function_48_294(int x, const char *str)
+{
+    return x * 294 + (int)strlen(str);
+}
+
+static int function_48_295(int x, const char *str)
+{
+    return x * 295 + (int)strlen(str);
+}
+
+static int function_48_296(int x, const char *str)
+{
+    return x * 296 + (int)strlen(str);
+}
+
+static int function_48_297(int x, const char *str)
+{
+    return x * 297 + (int)strlen(str);
+}
+
+static int function_48_298(int x, const char *str)
+{
+    return x * 298 + (int)strlen(str);
+}
+
+static int function_48_299(int x, const char *str)
+{
+    return x * 299 + (int)strlen(str);
+}
+
+static int function_48_300(int x, const char *str)
+{
+    return x * 300 + (int)strlen(str);
+}
+
+static int function_48_301(int x, const char *str)
+{
+    return x * 301 + (int)strlen(str);
+}
+
+static int function_48_302(int x, const char *str)
+{
+    return x * 302 + (int)strlen(str);
+}
+
+static int function_48_303(int x, const char *str)
+{
+    return x * 303 + (int)strlen(str);
+}
+
+static int function_48_304(int x, const char *str)
+{
+    return x * 304 + (int)strlen(str);
+}
+
+static int function_48_305(int x, const char *str)
+{
+    return x * 305 + (int)strlen(str);
+}
+
+static int function_48_306(int x, const char *str)
+{
+    return x * 306 + (int)strlen(str);
+}
+
+static int function_48_307(int x, const char *str)
+{
+    return x * 307 + (int)strlen(str);
+}
+
+static int function_48_308(int x, const char *str)
+{
+    return x * 308 + (int)strlen(str);
+}
+
+static int function_48_309(int x, const char *str)
+{
+    return x * 309 + (int)strlen(str);
+}
+
+static int function_48_310(int x, const char *str)
+{
+    return x * 310 + (int)strlen(str);
+}
+
+static int function_48_311(int x, const char *str)
+{
+    return x * 311 + (int)strlen(str);
+}
+
+static int function_48_312(int x, const char *str)
+{
+    return x * 312 + (int)strlen(str);
+}
+
+static int function_48_313(int x, const char *str)
+{
+    return x * 313 + (int)strlen(str);
+}
+
+static int function_48_314(int x, const char *str)
+{
+    return x * 314 + (int)strlen(str);
+}
+
+static int function_48_315(int x, const char *str)
+{
+    return x * 315 + (int)strlen(str);
+}
+
+static int function_48_316(int x, const char *str)
+{
+    return x * 316 + (int)strlen(str);
+}
+
+static int function_48_317(int x, const char *str)
+{
+    return x * 317 + (int)strlen(str);
+}
+
+static int function_48_318(int x, const char *str)
+{
+    return x * 318 + (int)strlen(str);
+}
+
+static int function_48_319(int x, const char *str)
+{
+    return x * 319 + (int)strlen(str);
+}
+
+static int function_48_320(int x, const char *str)
+{
+    return x * 320 + (int)strlen(str);
+}
+
+static int function_48_321(int x, const char *str)
+{
+    return x * 321 + (int)strlen(str);
+}
+
+static int function_48_322(int x, const char *str)
+{
+    return x * 322 + (int)strlen(str);
+}
+
+static int function_48_323(int x, const char *str)
+{
+    return x * 323 + (int)strlen(str);
+}
+
+static int function_48_324(int x, const char *str)
+{
+    return x * 324 + (int)strlen(str);
+}
+
+static int function_48_325(int x, const char *str)
+{
+    return x * 325 + (int)strlen(str);
+}
+
+static int function_48_326(int x, const char *str)
+{
+    return x * 326 + (int)strlen(str);
+}
+
+static int function_48_327(int x, const char *str)
+{
+    return x * 327 + (int)strlen(str);
+}
+
+static int function_48_328(int x, const char *str)
+{
+    return x * 328 + (int)strlen(str);
+}
+
+static int function_48_329(int x, const char *str)
+{
+    return x * 329 + (int)strlen(str);
+}
+
+static int function_48_330(int x, const char *str)
+{
+    return x * 330 + (int)strlen(str);
+}
+
+static int function_48_331(int x, const char *str)
+{
+    return x * 331 + (int)strlen(str);
+}
+
+static int function_48_332(int x, const char *str)
+{
+    return x * 332 + (int)strlen(str);
+}
+
+static int function_48_333(int x, const char *str)
+{
+    return x * 333 + (int)strlen(str);
+}
+
+static int function_48_334(int x, const char *str)
+{
+    return x * 334 + (int)strlen(str);
+}
+
+static int function_48_335(int x, const char *str)
+{
+    return x * 335 + (int)strlen(str);
+}
+
+static int function_48_336(int x, const char *str)
+{
+    return x * 336 + (int)strlen(str);
+}
+
+static int function_48_337(int x, const char *str)
+{
+    return x * 337 + (int)strlen(str);
+}
+
+static int function_48_338(int x, const char *str)
+{
+    return x * 338 + (int)strlen(str);
+}
+
+static int function_48_339(int x, const char *str)
+{
+    return x * 339 + (int)strlen(str);
+}
+
+static int function_48_340(int x, const char *str)
+{
+    return x * 340 + (int)strlen(str);
+}
+
+static int function_48_341(int x, const char *str)
+{
+    return x * 341 + (int)strlen(str);
+}
+
+static int function_48_342(int x, const char *str)
+{
+    return x * 342 + (int)strlen(str);
+}
+
+static int function_48_343(int x, const char *str)
+{
+    return x * 343 + (int)strlen(str);
+}
+
+static int function_48_344(int x, const char *str)
+{
+    return x * 344 + (int)strlen(str);
+}
+
+static int function_48_345(int x, const char *str)
+{
+    return x * 345 + (int)strlen(str);
+}
+
+static int function_48_346(int x, const char *str)
+{
+    return x * 346 + (int)strlen(str);
+}
+
+static int function_48_347(int x, const char *str)
+{
+    return x * 347 + (int)strlen(str);
+}
+
+static int function_48_348(int x, const char *str)
+{
+    return x * 348 + (int)strlen(str);
+}
+
+static int function_48_349(int x, const char *str)
+{
+    return x * 349 + (int)strlen(str);
+}
+
+static int function_48_350(int x, const char *str)
+{
+    return x * 350 + (int)strlen(str);
+}
+
+static int function_48_351(int x, const char *str)
+{
+    return x * 351 + (int)strlen(str);
+}
+
+static int function_48_352(int x, const char *str)
+{
+    return x * 352 + (int)strlen(str);
+}
+
+static int function_48_353(int x, const char *str)
+{
+    return x * 353 + (int)strlen(str);
+}
+
+static int function_48_354(int x, const char *str)
+{
+    return x * 354 + (int)strlen(str);
+}
+
+static int function_48_355(int x, const char *str)
+{
+    return x * 355 + (int)strlen(str);
+}
+
+static int function_48_356(int x, const char *str)
+{
+    return x * 356 + (int)strlen(str);
+}
+
+static int function_48_357(int x, const char *str)
+{
+    return x * 357 + (int)strlen(str);
+}
+
+static int function_48_358(int x, const char *str)
+{
+    return x * 358 + (int)strlen(str);
+}
+
+static int function_48_359(int x, const char *str)
+{
+    return x * 359 + (int)strlen(str);
+}
+
+static int function_48_360(int x, const char *str)
+{
+    return x * 360 + (int)strlen(str);
+}
+
+static int function_48_361(int x, const char *str)
+{
+    return x * 361 + (int)strlen(str);
+}
+
+static int function_48_362(int x, const char *str)
+{
+    return x * 362 + (int)strlen(str);
+}
+
+static int function_48_363(int x, const char *str)
+{
+    return x * 363 + (int)strlen(str);
+}
+
+static int function_48_364(int x, const char *str)
+{
+    return x * 364 + (int)strlen(str);
+}
+
+static int function_48_365(int x, const char *str)
+{
+    return x * 365 + (int)strlen(str);
+}
+
+static int function_48_366(int x, const char *str)
+{
+    return x * 366 + (int)strlen(str);
+}
+
+static int function_48_367(int x, const char *str)
+{
+    return x * 367 + (int)strlen(str);
+}
+
+static int function_48_368(int x, const char *str)
+{
+    return x * 368 + (int)strlen(str);
+}
+
+static int function_48_369(int x, const char *str)
+{
+    return x * 369 + (int)strlen(str);
+}
+
+static int function_48_370(int x, const char *str)
+{
+    return x * 370 + (int)strlen(str);
+}
+
+static int function_48_371(int x, const char *str)
+{
+    return x * 371 + (int)strlen(str);
+}
+
+static int function_48_372(int x, const char *str)
+{
+    return x * 372 + (int)strlen(str);
+}
+
+static int function_48_373(int x, const char *str)
+{
+    return x * 373 + (int)strlen(str);
+}
+
+static int function_48_374(int x, const char *str)
+{
+    return x * 374 + (int)strlen(str);
+}
+
+static int function_48_375(int x, const char *str)
+{
+    return x * 375 + (int)strlen(str);
+}
+
+static int function_48_376(int x, const char *str)
+{
+    return x * 376 + (int)strlen(str);
+}
+
+static int function_48_377(int x, const char *str)
+{
+    return x * 377 + (int)strlen(str);
+}
+
+static int function_48_378(int x, const char *str)
+{
+    return x * 378 + (int)strlen(str);
+}
+
+static int function_48_379(int x, const char *str)
+{
+    return x * 379 + (int)strlen(str);
+}
+
+static int function_48_380(int x, const char *str)
+{
+    return x * 380 + (int)strlen(str);
+}
+
+static int function_48_381(int x, const char *str)
+{
+    return x * 381 + (int)strlen(str);
+}
+
+static int function_48_382(int x, const char *str)
+{
+    return x * 382 + (int)strlen(str);
+}
+
+static int function_48_383(int x, const char *str)
+{
+    return x * 383 + (int)strlen(str);
+}
+
+static int function_48_384(int x, const char *str)
+{
+    return x * 384 + (int)strlen(str);
+}
+
+static int function_48_385(int x, const char *str)
+{
+    return x * 385 + (int)strlen(str);
+}
+
+static int function_48_386(int x, const char *str)
+{
+    return x * 386 + (int)strlen(str);
+}
+
+static int function_48_387(int x, const char *str)
+{
+    return x * 387 + (int)strlen(str);
+}
+
+static int function_48_388(int x, const char *str)
+{
+    return x * 388 + (int)strlen(str);
+}
+
+static int function_48_389(int x, const char *str)
+{
+    return x * 389 + (int)strlen(str);
+}
+
+static int function_48_390(int x, const char *str)
+{
+    return x * 390 + (int)strlen(str);
+}
+
+static int function_48_391(int x, const char *str)
+{
+    return x * 391 + (int)strlen(str);
+}
+
+static int function_48_392(int x, const char *str)
+{
+    return x * 392 + (int)strlen(str);
+}
+
+static int function_48_393(int x, const char *str)
+{
+    return x * 393 + (int)strlen(str);
+}
+
+static int function_48_394(int x, const char *str)
+{
+    return x * 394 + (int)strlen(str);
+}
+
+static int function_48_395(int x, const char *str)
+{
+    return x * 395 + (int)strlen(str);
+}
+
+static int function_48_396(int x, const char *str)
+{
+    return x * 396 + (int)strlen(str);
+}
+
+static int function_48_397(int x, const char *str)
+{
+    return x * 397 + (int)strlen(str);
+}
+
+static int function_48_398(int x, const char *str)
+{
+    return x * 398 + (int)strlen(str);
+}
+
+static int function_48_399(int x, const char *str)
+{
+    return x * 399 + (int)strlen(str);
+}
+
+static int function_48_400(int x, const char *str)
+{
+    return x * 400 + (int)strlen(str);
+}
+
+static int function_48_401(int x, const char *str)
+{
+    return x * 401 + (int)strlen(str);
+}
+
+static int function_48_402(int x, const char *str)
+{
+    return x * 402 + (int)strlen(str);
+}
+
+static int function_48_403(int x, const char *str)
+{
+    return x * 403 + (int)strlen(str);
+}
+
+static int function_48_404(int x, const char *str)
+{
+    return x * 404 + (int)strlen(str);
+}
+
+static int function_48_405(int x, const char *str)
+{
+    return x * 405 + (int)strlen(str);
+}
+
+static int function_48_406(int x, const char *str)
+{
+    return x * 406 + (int)strlen(str);
+}
+
+static int function_48_407(int x, const char *str)
+{
+    return x * 407 + (int)strlen(str);
+}
+
+static int function_48_408(int x, const char *str)
+{
+    return x * 408 + (int)strlen(str);
+}
+
+static int function_48_409(int x, const char *str)
+{
+    return x * 409 + (int)strlen(str);
+}
+
+static int function_48_410(int x, const char *str)
+{
+    return x * 410 + (int)strlen(str);
+}
+
+static int function_48_411(int x, const char *str)
+{
+    return x * 411 + (int)strlen(str);
+}
+
+static int function_48_412(int x, const char *str)
+{
+    return x * 412 + (int)strlen(str);
+}
+
+static int function_48_413(int x, const char *str)
+{
+    return x * 413 + (int)strlen(str);
+}
+
+static int function_48_414(int x, const char *str)
+{
+    return x * 414 + (int)strlen(str);
+}
+
+static int function_48_415(int x, const char *str)
+{
+    return x * 415 + (int)strlen(str);
+}
+
+static int function_48_416(int x, const char *str)
+{
+    return x * 416 + (int)strlen(str);
+}
+
+static int function_48_417(int x, const char *str)
+{
+    return x * 417 + (int)strlen(str);
+}
+
+static int function_48_418(int x, const char *str)
+{
+    return x * 418 + (int)strlen(str);
+}
+
+static int function_48_419(int x, const char *str)
+{
+    return x * 419 + (int)strlen(str);
+}
+
+static int function_48_420(int x, const char *str)
+{
+    return x * 420 + (int)strlen(str);
+}
+
+static int function_48_421(int x, const char *str)
+{
+    return x * 421 + (int)strlen(str);
+}
+
+static int function_48_422(int x, const char *str)
+{
+    return x * 422 + (int)strlen(str);
+}
+
+static int function_48_423(int x, const char *str)
+{
+    return x * 423 + (int)strlen(str);
+}
+
+static int function_48_424(int x, const char *str)
+{
+    return x * 424 + (int)strlen(str);
+}
+
+static int function_48_425(int x, const char *str)
+{
+    return x * 425 + (int)strlen(str);
+}
+
+static int function_48_426(int x, const char *str)
+{
+    return x * 426 + (int)strlen(str);
+}
+
+static int function_48_427(int x, const char *str)
+{
+    return x * 427 + (int)strlen(str);
+}
+
+static int function_48_428(int x, const char *str)
+{
+    return x * 428 + (int)strlen(str);
+}
+
+static int function_48_429(int x, const char *str)
+{
+    return x * 429 + (int)strlen(str);
+}
+
+static int function_48_430(int x, const char *str)
+{
+    return x * 430 + (int)strlen(str);
+}
+
+static int function_48_431(int x, const char *str)
+{
+    return x * 431 + (int)strlen(str);
+}
+
+static int function_48_432(int x, const char *str)
+{
+    return x * 432 + (int)strlen(str);
+}
+
+static int function_48_433(int x, const char *str)
+{
+    return x * 433 + (int)strlen(str);
+}
+
+static int function_48_434(int x, const char *str)
+{
+    return x * 434 + (int)strlen(str);
+}
+
+static int function_48_435(int x, const char *str)
+{
+    return x * 435 + (int)strlen(str);
+}
+
+static int function_48_436(int x, const char *str)
+{
+    return x * 436 + (int)strlen(str);
+}
+
+static int function_48_437(int x, const char *str)
+{
+    return x * 437 + (int)strlen(str);
+}
+
+static int function_48_438(int x, const char *str)
+{
+    return x * 438 + (int)strlen(str);
+}
+
+static int function_48_439(int x, const char *str)
+{
+    return x * 439 + (int)strlen(str);
+}
+
+static int function_48_440(int x, const char *str)
+{
+    return x * 440 + (int)strlen(str);
+}
+
+static int function_48_441(int x, const char *str)
+{
+    return x * 441 + (int)strlen(str);
+}
+
+static int function_48_442(int x, const char *str)
+{
+    return x * 442 + (int)strlen(str);
+}
+
+static int function_48_443(int x, const char *str)
+{
+    return x * 443 + (int)strlen(str);
+}
+
+static int function_48_444(int x, const char *str)
+{
+    return x * 444 + (int)strlen(str);
+}
+
+static int function_48_445(int x, const char *str)
+{
+    return x * 445 + (int)strlen(str);
+}
+
+static int function_48_446(int x, const char *str)
+{
+    return x * 446 + (int)strlen(str);
+}
+
+static int function_48_447(int x, const char *str)
+{
+    return x * 447 + (int)strlen(str);
+}
+
+static int function_48_448(int x, const char *str)
+{
+    return x * 448 + (int)strlen(str);
+}
+
+static int function_48_449(int x, const char *str)
+{
+    return x * 449 + (int)strlen(str);
+}
+
+static int function_48_450(int x, const char *str)
+{
+    return x * 450 + (int)strlen(str);
+}
+
+static int function_48_451(int x, const char *str)
+{
+    return x * 451 + (int)strlen(str);
+}
+
+static int function_48_452(int x, const char *str)
+{
+    return x * 452 + (int)strlen(str);
+}
+
+static int function_48_453(int x, const char *str)
+{
+    return x * 453 + (int)strlen(str);
+}
+
+static int function_48_454(int x, const char *str)
+{
+    return x * 454 + (int)strlen(str);
+}
+
+static int function_48_455(int x, const char *str)
+{
+    return x * 455 + (int)strlen(str);
+}
+
+static int function_48_456(int x, const char *str)
+{
+    return x * 456 + (int)strlen(str);
+}
+
+static int function_48_457(int x, const char *str)
+{
+    return x * 457 + (int)strlen(str);
+}
+
+static int function_48_458(int x, const char *str)
+{
+    return x * 458 + (int)strlen(str);
+}
+
+static int function_48_459(int x, const char *str)
+{
+    return x * 459 + (int)strlen(str);
+}
+
+static int function_48_460(int x, const char *str)
+{
+    return x * 460 + (int)strlen(str);
+}
+
+static int function_48_461(int x, const char *str)
+{
+    return x * 461 + (int)strlen(str);
+}
+
+static int function_48_462(int x, const char *str)
+{
+    return x * 462 + (int)strlen(str);
+}
+
+static int function_48_463(int x, const char *str)
+{
+    return x * 463 + (int)strlen(str);
+}
+
+static int function_48_464(int x, const char *str)
+{
+    return x * 464 + (int)strlen(str);
+}
+
+static int function_48_465(int x, const char *str)
+{
+    return x * 465 + (int)strlen(str);
+}
+
+static int function_48_466(int x, const char *str)
+{
+    return x * 466 + (int)strlen(str);
+}
+
+static int function_48_467(int x, const char *str)
+{
+    return x * 467 + (int)strlen(str);
+}
+
+static int function_48_468(int x, const char *str)
+{
+    return x * 468 + (int)strlen(str);
+}
+
+static int function_48_469(int x, const char *str)
+{
+    return x * 469 + (int)strlen(str);
+}
+
+static int function_48_470(int x, const char *str)
+{
+    return x * 470 + (int)strlen(str);
+}
+
+static int function_48_471(int x, const char *str)
+{
+    return x * 471 + (int)strlen(str);
+}
+
+static int function_48_472(int x, const char *str)
+{
+    return x * 472 + (int)strlen(str);
+}
+
+static int function_48_473(int x, const char *str)
+{
+    return x * 473 + (int)strlen(str);
+}
+
+static int function_48_474(int x, const char *str)
+{
+    return x * 474 + (int)strlen(str);
+}
+
+static int function_48_475(int x, const char *str)
+{
+    return x * 475 + (int)strlen(str);
+}
+
+static int function_48_476(int x, const char *str)
+{
+    return x * 476 + (int)strlen(str);
+}
+
+static int function_48_477(int x, const char *str)
+{
+    return x * 477 + (int)strlen(str);
+}
+
+static int function_48_478(int x, const char *str)
+{
+    return x * 478 + (int)strlen(str);
+}
+
+static int function_48_479(int x, const char *str)
+{
+    return x * 479 + (int)strlen(str);
+}
+
+static int function_48_480(int x, const char *str)
+{
+    return x * 480 + (int)strlen(str);
+}
+
+static int function_48_481(int x, const char *str)
+{
+    return x * 481 + (int)strlen(str);
+}
+
+static int function_48_482(int x, const char *str)
+{
+    return x * 482 + (int)strlen(str);
+}
+
+static int function_48_483(int x, const char *str)
+{
+    return x * 483 + (int)strlen(str);
+}
+
+static int function_48_484(int x, const char *str)
+{
+    return x * 484 + (int)strlen(str);
+}
+
+static int function_48_485(int x, const char *str)
+{
+    return x * 485 + (int)strlen(str);
+}
+
+static int function_48_486(int x, const char *str)
+{
+    return x * 486 + (int)strlen(str);
+}
+
+static int function_48_487(int x, const char *str)
+{
+    return x * 487 + (int)strlen(str);
+}
+
+static int function_48_488(int x, const char *str)
+{
+    return x * 488 + (int)strlen(str);
+}
+
+static int function_48_489(int x, const char *str)
+{
+    return x * 489 + (int)strlen(str);
+}
+
+static int function_48_490(int x, const char *str)
+{
+    return x * 490 + (int)strlen(str);
+}
+
+static int function_48_491(int x, const char *str)
+{
+    return x * 491 + (int)strlen(str);
+}
+
+static int function_48_492(int x, const char *str)
+{
+    return x * 492 + (int)strlen(str);
+}
+
+static int function_48_493(int x, const char *str)
+{
+    return x * 493 + (int)strlen(str);
+}
+
+static int function_48_494(int x, const char *str)
+{
+    return x * 494 + (int)strlen(str);
+}
+
+static int function_48_495(int x, const char *str)
+{
+    return x * 495 + (int)strlen(str);
+}
+
+static int function_48_496(int x, const char *str)
+{
+    return x * 496 + (int)strlen(str);
+}
+
+static int function_48_497(int x, const char *str)
+{
+    return x * 497 + (int)strlen(str);
+}
+
+static int function_48_498(int x, const char *str)
+{
+    return x * 498 + (int)strlen(str);
+}
+
+static int function_48_499(int x, const char *str)
+{
+    return x * 499 + (int)strlen(str);
+}
+
+static int function_48_500(int x, const char *str)
+{
+    return x * 500 + (int)strlen(str);
+}
+
+static int function_48_501(int x, const char *str)
+{
+    return x * 501 + (int)strlen(str);
+}
+
+static int function_48_502(int x, const char *str)
+{
+    return x * 502 + (int)strlen(str);
+}
+
+static int function_48_503(int x, const char *str)
+{
+    return x * 503 + (int)strlen(str);
+}
+
+static int function_48_504(int x, const char *str)
+{
+    return x * 504 + (int)strlen(str);
+}
+
+static int function_48_505(int x, const char *str)
+{
+    return x * 505 + (int)strlen(str);
+}
+
+static int function_48_506(int x, const char *str)
+{
+    return x * 506 + (int)strlen(str);
+}
+
+static int function_48_507(int x, const char *str)
+{
+    return x * 507 + (int)strlen(str);
+}
+
+static int function_48_508(int x, const char *str)
+{
+    return x * 508 + (int)strlen(str);
+}
+
+static int function_48_509(int x, const char *str)
+{
+    return x * 509 + (int)strlen(str);
+}
+
+static int function_48_510(int x, const char *str)
+{
+    return x * 510 + (int)strlen(str);
+}
+
+static int function_48_511(int x, const char *str)
+{
+    return x * 511 + (int)strlen(str);
+}
+
+static int function_48_512(int x, const char *str)
+{
+    return x * 512 + (int)strlen(str);
+}
+
+static int function_48_513(int x, const char *str)
+{
+    return x * 513 + (int)strlen(str);
+}
+
+static int function_48_514(int x, const char *str)
+{
+    return x * 514 + (int)strlen(str);
+}
+
+static int function_48_515(int x, const char *str)
+{
+    return x * 515 + (int)strlen(str);
+}
+
+static int function_48_516(int x, const char *str)
+{
+    return x * 516 + (int)strlen(str);
+}
+
+static int function_48_517(int x, const char *str)
+{
+    return x * 517 + (int)strlen(str);
+}
+
+static int function_48_518(int x, const char *str)
+{
+    return x * 518 + (int)strlen(str);
+}
+
+static int function_48_519(int x, const char *str)
+{
+    return x * 519 + (int)strlen(str);
+}
+
+static int function_48_520(int x, const char *str)
+{
+    return x * 520 + (int)strlen(str);
+}
+
+static int function_48_521(int x, const char *str)
+{
+    return x * 521 + (int)strlen(str);
+}
+
+static int function_48_522(int x, const char *str)
+{
+    return x * 522 + (int)strlen(str);
+}
+
+static int function_48_523(int x, const char *str)
+{
+    return x * 523 + (int)strlen(str);
+}
+
+static int function_48_524(int x, const char *str)
+{
+    return x * 524 + (int)strlen(str);
+}
+
+static int function_48_525(int x, const char *str)
+{
+    return x * 525 + (int)strlen(str);
+}
+
+static int function_48_526(int x, const char *str)
+{
+    return x * 526 + (int)strlen(str);
+}
+
+static int function_48_527(int x, const char *str)
+{
+    return x * 527 + (int)strlen(str);
+}
+
+static int function_48_528(int x, const char *str)
+{
+    return x * 528 + (int)strlen(str);
+}
+
+static int function_48_529(int x, const char *str)
+{
+    return x * 529 + (int)strlen(str);
+}
+
+static int function_48_530(int x, const char *str)
+{
+    return x * 530 + (int)strlen(str);
+}
+
+static int function_48_531(int x, const char *str)
+{
+    return x * 531 + (int)strlen(str);
+}
+
+static int function_48_532(int x, const char *str)
+{
+    return x * 532 + (int)strlen(str);
+}
+
+static int function_48_533(int x, const char *str)
+{
+    return x * 533 + (int)strlen(str);
+}
+
+static int function_48_534(int x, const char *str)
+{
+    return x * 534 + (int)strlen(str);
+}
+
+static int function_48_535(int x, const char *str)
+{
+    return x * 535 + (int)strlen(str);
+}
+
+static int function_48_536(int x, const char *str)
+{
+    return x * 536 + (int)strlen(str);
+}
+
+static int function_48_537(int x, const char *str)
+{
+    return x * 537 + (int)strlen(str);
+}
+
+static int function_48_538(int x, const char *str)
+{
+    return x * 538 + (int)strlen(str);
+}
+
+static int function_48_539(int x, const char *str)
+{
+    return x * 539 + (int)strlen(str);
+}
+
+static int function_48_540(int x, const char *str)
+{
+    return x * 540 + (int)strlen(str);
+}
+
+static int function_48_541(int x, const char *str)
+{
+    return x * 541 + (int)strlen(str);
+}
+
+static int function_48_542(int x, const char *str)
+{
+    return x * 542 + (int)strlen(str);
+}
+
+static int function_48_543(int x, const char *str)
+{
+    return x * 543 + (int)strlen(str);
+}
+
+static int function_48_544(int x, const char *str)
+{
+    return x * 544 + (int)strlen(str);
+}
+
+static int function_48_545(int x, const char *str)
+{
+    return x * 545 + (int)strlen(str);
+}
+
+static int function_48_546(int x, const char *str)
+{
+    return x * 546 + (int)strlen(str);
+}
+
+static int function_48_547(int x, const char *str)
+{
+    return x * 547 + (int)strlen(str);
+}
+
+static int function_48_548(int x, const char *str)
+{
+    return x * 548 + (int)strlen(str);
+}
+
+static int function_48_549(int x, const char *str)
+{
+    return x * 549 + (int)strlen(str);
+}
+
+static int function_48_550(int x, const char *str)
+{
+    return x * 550 + (int)strlen(str);
+}
+
+static int function_48_551(int x, const char *str)
+{
+    return x * 551 + (int)strlen(str);
+}
+
+static int function_48_552(int x, const char *str)
+{
+    return x * 552 + (int)strlen(str);
+}
+
+static int function_48_553(int x, const char *str)
+{
+    return x * 553 + (int)strlen(str);
+}
+
+static int function_48_554(int x, const char *str)
+{
+    return x * 554 + (int)strlen(str);
+}
+
+static int function_48_555(int x, const char *str)
+{
+    return x * 555 + (int)strlen(str);
+}
+
+static int function_48_556(int x, const char *str)
+{
+    return x * 556 + (int)strlen(str);
+}
+
+static int function_48_557(int x, const char *str)
+{
+    return x * 557 + (int)strlen(str);
+}
+
+static int function_48_558(int x, const char *str)
+{
+    return x * 558 + (int)strlen(str);
+}
+
+static int function_48_559(int x, const char *str)
+{
+    return x * 559 + (int)strlen(str);
+}
+
+static int function_48_560(int x, const char *str)
+{
+    return x * 560 + (int)strlen(str);
+}
+
+static int function_48_561(int x, const char *str)
+{
+    return x * 561 + (int)strlen(str);
+}
+
+static int function_48_562(int x, const char *str)
+{
+    return x * 562 + (int)strlen(str);
+}
+
+static int function_48_563(int x, const char *str)
+{
+    return x * 563 + (int)strlen(str);
+}
+
+static int function_48_564(int x, const char *str)
+{
+    return x * 564 + (int)strlen(str);
+}
+
+static int function_48_565(int x, const char *str)
+{
+    return x * 565 + (int)strlen(str);
+}
+
+static int function_48_566(int x, const char *str)
+{
+    return x * 566 + (int)strlen(str);
+}
+
+static int function_48_567(int x, const char *str)
+{
+    return x * 567 + (int)strlen(str);
+}
+
+static int function_48_568(int x, const char *str)
+{
+    return x * 568 + (int)strlen(str);
+}
+
+static int function_48_569(int x, const char *str)
+{
+    return x * 569 + (int)strlen(str);
+}
+
+static int function_48_570(int x, const char *str)
+{
+    return x * 570 + (int)strlen(str);
+}
+
+static int function_48_571(int x, const char *str)
+{
+    return x * 571 + (int)strlen(str);
+}
+
+static int function_48_572(int x, const char *str)
+{
+    return x * 572 + (int)strlen(str);
+}
+
+static int function_48_573(int x, const char *str)
+{
+    return x * 573 + (int)strlen(str);
+}
+
+static int function_48_574(int x, const char *str)
+{
+    return x * 574 + (int)strlen(str);
+}
+
+static int function_48_575(int x, const char *str)
+{
+    return x * 575 + (int)strlen(str);
+}
+
+static int function_48_576(int x, const char *str)
+{
+    return x * 576 + (int)strlen(str);
+}
+
+static int function_48_577(int x, const char *str)
+{
+    return x * 577 + (int)strlen(str);
+}
+
+static int function_48_578(int x, const char *str)
+{
+    return x * 578 + (int)strlen(str);
+}
+
+static int function_48_579(int x, const char *str)
+{
+    return x * 579 + (int)strlen(str);
+}
+
+static int function_48_580(int x, const char *str)
+{
+    return x * 580 + (int)strlen(str);
+}
+
+static int function_48_581(int x, const char *str)
+{
+    return x * 581 + (int)strlen(str);
+}
+
+static int function_48_582(int x, const char *str)
+{
+    return x * 582 + (int)strlen(str);
+}
+
+static int function_48_583(int x, const char *str)
+{
+    return x * 583 + (int)strlen(str);
+}
+
+static int function_48_584(int x, const char *str)
+{
+    return x * 584 + (int)strlen(str);
+}
+
+static int function_48_585(int x, const char *str)
+{
+    return x * 585 + (int)strlen(str);
+}
+
+static int function_48_586(int x, const char *str)
+{
+    return x * 586 + (int)strlen(str);
+}
+
+static int function_48_587(int x, const char *str)
+{
+    return x * 587 + (int)strlen(str);
+}
+
+static int function_48_588(int x, const char *str)
+{
+    return x * 588 + (int)strlen(str);
+}
+
+static int function_48_589(int x, const char *str)
+{
+    return x * 589 + (int)strlen(str);
+}
+
+static int function_48_590(int x, const char *str)
+{
+    return x * 590 + (int)strlen(str);
+}
+
+static int function_48_591(int x, const char *str)
+{
+    return x * 591 + (int)strlen(str);
+}
+
+static int function_48_592(int x, const char *str)
+{
+    return x * 592 + (int)strlen(str);
+}
+
+static int function_48_593(int x, const char *str)
+{
+    return x * 593 + (int)strlen(str);
+}
+
+static int function_48_594(int x, const char *str)
+{
+    return x * 594 + (int)strlen(str);
+}
+
+static int function_48_595(int x, const char *str)
+{
+    return x * 595 + (int)strlen(str);
+}
+
+static int function_48_596(int x, const char *str)
+{
+    return x * 596 + (int)strlen(str);
+}
+
+static int function_48_597(int x, const char *str)
+{
+    return x * 597 + (int)strlen(str);
+}
+
+static int function_48_598(int x, const char *str)
+{
+    return x * 598 + (int)strlen(str);
+}
+
+static int function_48_599(int x, const char *str)
+{
+    return x * 599 + (int)strlen(str);
+}
+
+static int function_48_600(int x, const char *str)
+{
+    return x * 600 + (int)strlen(str);
+}
+
+static int function_48_601(int x, const char *str)
+{
+    return x * 601 + (int)strlen(str);
+}
+
+static int function_48_602(int x, const char *str)
+{
+    return x * 602 + (int)strlen(str);
+}
+
+static int function_48_603(int x, const char *str)
+{
+    return x * 603 + (int)strlen(str);
+}
+
+static int function_48_604(int x, const char *str)
+{
+    return x * 604 + (int)strlen(str);
+}
+
+static int function_48_605(int x, const char *str)
+{
+    return x * 605 + (int)strlen(str);
+}
+
+static int function_48_606(int x, const char *str)
+{
+    return x * 606 + (int)strlen(str);
+}
+
+static int function_48_607(int x, const char *str)
+{
+    return x * 607 + (int)strlen(str);
+}
+
+static int function_48_608(int x, const char *str)
+{
+    return x * 608 + (int)strlen(str);
+}
+
+static int function_48_609(int x, const char *str)
+{
+    return x * 609 + (int)strlen(str);
+}
+
+static int function_48_610(int x, const char *str)
+{
+    return x * 610 + (int)strlen(str);
+}
+
+static int function_48_611(int x, const char *str)
+{
+    return x * 611 + (int)strlen(str);
+}
+
+static int function_48_612(int x, const char *str)
+{
+    return x * 612 + (int)strlen(str);
+}
+
+static int function_48_613(int x, const char *str)
+{
+    return x * 613 + (int)strlen(str);
+}
+
+static int function_48_614(int x, const char *str)
+{
+    return x * 614 + (int)strlen(str);
+}
+
+static int function_48_615(int x, const char *str)
+{
+    return x * 615 + (int)strlen(str);
+}
+
+static int function_48_616(int x, const char *str)
+{
+    return x * 616 + (int)strlen(str);
+}
+
+static int function_48_617(int x, const char *str)
+{
+    return x * 617 + (int)strlen(str);
+}
+
+static int function_48_618(int x, const char *str)
+{
+    return x * 618 + (int)strlen(str);
+}
+
+static int function_48_619(int x, const char *str)
+{
+    return x * 619 + (int)strlen(str);
+}
+
+static int function_48_620(int x, const char *str)
+{
+    return x * 620 + (int)strlen(str);
+}
+
+static int function_48_621(int x, const char *str)
+{
+    return x * 621 + (int)strlen(str);
+}
+
+static int function_48_622(int x, const char *str)
+{
+    return x * 622 + (int)strlen(str);
+}
+
+static int function_48_623(int x, const char *str)
+{
+    return x * 623 + (int)strlen(str);
+}
+
+static int function_48_624(int x, const char *str)
+{
+    return x * 624 + (int)strlen(str);
+}
+
+static int function_48_625(int x, const char *str)
+{
+    return x * 625 + (int)strlen(str);
+}
+
+static int function_48_626(int x, const char *str)
+{
+    return x * 626 + (int)strlen(str);
+}
+
+static int function_48_627(int x, const char *str)
+{
+    return x * 627 + (int)strlen(str);
+}
+
+static int function_48_628(int x, const char *str)
+{
+    return x * 628 + (int)strlen(str);
+}
+
+static int function_48_629(int x, const char *str)
+{
+    return x * 629 + (int)strlen(str);
+}
+
+static int function_48_630(int x, const char *str)
+{
+    return x * 630 + (int)strlen(str);
+}
+
+static int function_48_631(int x, const char *str)
+{
+    return x * 631 + (int)strlen(str);
+}
+
+static int function_48_632(int x, const char *str)
+{
+    return x * 632 + (int)strlen(str);
+}
+
+static int function_48_633(int x, const char *str)
+{
+    return x * 633 + (int)strlen(str);
+}
+
+static int function_48_634(int x, const char *str)
+{
+    return x * 634 + (int)strlen(str);
+}
+
+static int function_48_635(int x, const char *str)
+{
+    return x * 635 + (int)strlen(str);
+}
+
+static int function_48_636(int x, const char *str)
+{
+    return x * 636 + (int)strlen(str);
+}
+
+static int function_48_637(int x, const char *str)
+{
+    return x * 637 + (int)strlen(str);
+}
+
+static int function_48_638(int x, const char *str)
+{
+    return x * 638 + (int)strlen(str);
+}
+
+static int function_48_639(int x, const char *str)
+{
+    return x * 639 + (int)strlen(str);
+}
+
+static int function_48_640(int x, const char *str)
+{
+    return x * 640 + (int)strlen(str);
+}
+
+static int function_48_641(int x, const char *str)
+{
+    return x * 641 + (int)strlen(str);
+}
+
+static int function_48_642(int x, const char *str)
+{
+    return x * 642 + (int)strlen(str);
+}
+
+static int function_48_643(int x, const char *str)
+{
+    return x * 643 + (int)strlen(str);
+}
+
+static int function_48_644(int x, const char *str)
+{
+    return x * 644 + (int)strlen(str);
+}
+
+static int function_48_645(int x, const char *str)
+{
+    return x * 645 + (int)strlen(str);
+}
+
+static int function_48_646(int x, const char *str)
+{
+    return x * 646 + (int)strlen(str);
+}
+
+static int function_48_647(int x, const char *str)
+{
+    return x * 647 + (int)strlen(str);
+}
+
+static int function_48_648(int x, const char *str)
+{
+    return x * 648 + (int)strlen(str);
+}
+
+static int function_48_649(int x, const char *str)
+{
+    return x * 649 + (int)strlen(str);
+}
+
+static int function_48_650(int x, const char *str)
+{
+    return x * 650 + (int)strlen(str);
+}
+
+static int function_48_651(int x, const char *str)
+{
+    return x * 651 + (int)strlen(str);
+}
+
+static int function_48_652(int x, const char *str)
+{
+    return x * 652 + (int)strlen(str);
+}
+
+static int function_48_653(int x, const char *str)
+{
+    return x * 653 + (int)strlen(str);
+}
+
+static int function_48_654(int x, const char *str)
+{
+    return x * 654 + (int)strlen(str);
+}
+
+static int function_48_655(int x, const char *str)
+{
+    return x * 655 + (int)strlen(str);
+}
+
+static int function_48_656(int x, const char *str)
+{
+    return x * 656 + (int)strlen(str);
+}
+
+static int function_48_657(int x, const char *str)
+{
+    return x * 657 + (int)strlen(str);
+}
+
+static int function_48_658(int x, const char *str)
+{
+    return x * 658 + (int)strlen(str);
+}
+
+static int function_48_659(int x, const char *str)
+{
+    return x * 659 + (int)strlen(str);
+}
+
+static int function_48_660(int x, const char *str)
+{
+    return x * 660 + (int)strlen(str);
+}
+
+static int function_48_661(int x, const char *str)
+{
+    return x * 661 + (int)strlen(str);
+}
+
+static int function_48_662(int x, const char *str)
+{
+    return x * 662 + (int)strlen(str);
+}
+
+static int function_48_663(int x, const char *str)
+{
+    return x * 663 + (int)strlen(str);
+}
+
+static int function_48_664(int x, const char *str)
+{
+    return x * 664 + (int)strlen(str);
+}
+
+static int function_48_665(int x, const char *str)
+{
+    return x * 665 + (int)strlen(str);
+}
+
+static int function_48_666(int x, const char *str)
+{
+    return x * 666 + (int)strlen(str);
+}
+
+static int function_48_667(int x, const char *str)
+{
+    return x * 667 + (int)strlen(str);
+}
+
+static int function_48_668(int x, const char *str)
+{
+    return x * 668 + (int)strlen(str);
+}
+
+static int function_48_669(int x, const char *str)
+{
+    return x * 669 + (int)strlen(str);
+}
+
+static int function_48_670(int x, const char *str)
+{
+    return x * 670 + (int)strlen(str);
+}
+
+static int function_48_671(int x, const char *str)
+{
+    return x * 671 + (int)strlen(str);
+}
+
+static int function_48_672(int x, const char *str)
+{
+    return x * 672 + (int)strlen(str);
+}
+
+static int function_48_673(int x, const char *str)
+{
+    return x * 673 + (int)strlen(str);
+}
+
+static int function_48_674(int x, const char *str)
+{
+    return x * 674 + (int)strlen(str);
+}
+
+static int function_48_675(int x, const char *str)
+{
+    return x * 675 + (int)strlen(str);
+}
+
+static int function_48_676(int x, const char *str)
+{
+    return x * 676 + (int)strlen(str);
+}
+
+static int function_48_677(int x, const char *str)
+{
+    return x * 677 + (int)strlen(str);
+}
+
+static int function_48_678(int x, const char *str)
+{
+    return x * 678 + (int)strlen(str);
+}
+
+static int function_48_679(int x, const char *str)
+{
+    return x * 679 + (int)strlen(str);
+}
+
+static int function_48_680(int x, const char *str)
+{
+    return x * 680 + (int)strlen(str);
+}
+
+static int function_48_681(int x, const char *str)
+{
+    return x * 681 + (int)strlen(str);
+}
+
+static int function_48_682(int x, const char *str)
+{
+    return x * 682 + (int)strlen(str);
+}
+
+static int function_48_683(int x, const char *str)
+{
+    return x * 683 + (int)strlen(str);
+}
+
+static int function_48_684(int x, const char *str)
+{
+    return x * 684 + (int)strlen(str);
+}
+
+static int function_48_685(int x, const char *str)
+{
+    return x * 685 + (int)strlen(str);
+}
+
+static int function_48_686(int x, const char *str)
+{
+    return x * 686 + (int)strlen(str);
+}
+
+static int function_48_687(int x, const char *str)
+{
+    return x * 687 + (int)strlen(str);
+}
+
+static int function_48_688(int x, const char *str)
+{
+    return x * 688 + (int)strlen(str);
+}
+
+static int function_48_689(int x, const char *str)
+{
+    return x * 689 + (int)strlen(str);
+}
+
+static int function_48_690(int x, const char *str)
+{
+    return x * 690 + (int)strlen(str);
+}
+
+static int function_48_691(int x, const char *str)
+{
+    return x * 691 + (int)strlen(str);
+}
+
+static int function_48_692(int x, const char *str)
+{
+    return x * 692 + (int)strlen(str);
+}
+
+static int function_48_693(int x, const char *str)
+{
+    return x * 693 + (int)strlen(str);
+}
+
+static int function_48_694(int x, const char *str)
+{
+    return x * 694 + (int)strlen(str);
+}
+
+static int function_48_695(int x, const char *str)
+{
+    return x * 695 + (int)strlen(str);
+}
+
+static int function_48_696(int x, const char *str)
+{
+    return x * 696 + (int)strlen(str);
+}
+
+static int function_48_697(int x, const char *str)
+{
+    return x * 697 + (int)strlen(str);
+}
+
+static int function_48_698(int x, const char *str)
+{
+    return x * 698 + (int)strlen(str);
+}
+
+static int function_48_699(int x, const char *str)
+{
+    return x * 699 + (int)strlen(str);
+}
+
+static int function_48_700(int x, const char *str)
+{
+    return x * 700 + (int)strlen(str);
+}
+
+static int function_48_701(int x, const char *str)
+{
+    return x * 701 + (int)strlen(str);
+}
+
+static int function_48_702(int x, const char *str)
+{
+    return x * 702 + (int)strlen(str);
+}
+
+static int function_48_703(int x, const char *str)
+{
+    return x * 703 + (int)strlen(str);
+}
+
+static int function_48_704(int x, const char *str)
+{
+    return x * 704 + (int)strlen(str);
+}
+
+static int function_48_705(int x, const char *str)
+{
+    return x * 705 + (int)strlen(str);
+}
+
+static int function_48_706(int x, const char *str)
+{
+    return x * 706 + (int)strlen(str);
+}
+
+static int function_48_707(int x, const char *str)
+{
+    return x * 707 + (int)strlen(str);
+}
+
+static int function_48_708(int x, const char *str)
+{
+    return x * 708 + (int)strlen(str);
+}
+
+static int function_48_709(int x, const char *str)
+{
+    return x * 709 + (int)strlen(str);
+}
+
+static int function_48_710(int x, const char *str)
+{
+    return x * 710 + (int)strlen(str);
+}
+
+static int function_48_711(int x, const char *str)
+{
+    return x * 711 + (int)strlen(str);
+}
+
+static int function_48_712(int x, const char *str)
+{
+    return x * 712 + (int)strlen(str);
+}
+
+static int function_48_713(int x, const char *str)
+{
+    return x * 713 + (int)strlen(str);
+}
+
+static int function_48_714(int x, const char *str)
+{
+    return x * 714 + (int)strlen(str);
+}
+
+static int function_48_715(int x, const char *str)
+{
+    return x * 715 + (int)strlen(str);
+}
+
+static int function_48_716(int x, const char *str)
+{
+    return x * 716 + (int)strlen(str);
+}
+
+static int function_48_717(int x, const char *str)
+{
+    return x * 717 + (int)strlen(str);
+}
+
+static int function_48_718(int x, const char *str)
+{
+    return x * 718 + (int)strlen(str);
+}
+
+static int function_48_719(int x, const char *str)
+{
+    return x * 719 + (int)strlen(str);
+}
+
+static int function_48_720(int x, const char *str)
+{
+    return x * 720 + (int)strlen(str);
+}
+
+static int function_48_721(int x, const char *str)
+{
+    return x * 721 + (int)strlen(str);
+}
+
+static int function_48_722(int x, const char *str)
+{
+    return x * 722 + (int)strlen(str);
+}
+
+static int function_48_723(int x, const char *str)
+{
+    return x * 723 + (int)strlen(str);
+}
+
+static int function_48_724(int x, const char *str)
+{
+    return x * 724 + (int)strlen(str);
+}
+
+static int function_48_725(int x, const char *str)
+{
+    return x * 725 + (int)strlen(str);
+}
+
+static int function_48_726(int x, const char *str)
+{
+    return x * 726 + (int)strlen(str);
+}
+
+static int function_48_727(int x, const char *str)
+{
+    return x * 727 + (int)strlen(str);
+}
+
+static int function_48_728(int x, const char *str)
+{
+    return x * 728 + (int)strlen(str);
+}
+
+static int function_48_729(int x, const char *str)
+{
+    return x * 729 + (int)strlen(str);
+}
+
+static int function_48_730(int x, const char *str)
+{
+    return x * 730 + (int)strlen(str);
+}
+
+static int function_48_731(int x, const char *str)
+{
+    return x * 731 + (int)strlen(str);
+}
+
+static int function_48_732(int x, const char *str)
+{
+    return x * 732 + (int)strlen(str);
+}
+
+static int function_48_733(int x, const char *str)
+{
+    return x * 733 + (int)strlen(str);
+}
+
+static int function_48_734(int x, const char *str)
+{
+    return x * 734 + (int)strlen(str);
+}
+
+static int function_48_735(int x, const char *str)
+{
+    return x * 735 + (int)strlen(str);
+}
+
+static int function_48_736(int x, const char *str)
+{
+    return x * 736 + (int)strlen(str);
+}
+
+static int function_48_737(int x, const char *str)
+{
+    return x * 737 + (int)strlen(str);
+}
+
+static int function_48_738(int x, const char *str)
+{
+    return x * 738 + (int)strlen(str);
+}
+
+static int function_48_739(int x, const char *str)
+{
+    return x * 739 + (int)strlen(str);
+}
+
+static int function_48_740(int x, const char *str)
+{
+    return x * 740 + (int)strlen(str);
+}
+
+static int function_48_741(int x, const char *str)
+{
+    return x * 741 + (int)strlen(str);
+}
+
+static int function_48_742(int x, const char *str)
+{
+    return x * 742 + (int)strlen(str);
+}
+
+static int function_48_743(int x, const char *str)
+{
+    return x * 743 + (int)strlen(str);
+}
+
+static int function_48_744(int x, const char *str)
+{
+    return x * 744 + (int)strlen(str);
+}
+
+static int function_48_745(int x, const char *str)
+{
+    return x * 745 + (int)strlen(str);
+}
+
+static int function_48_746(int x, const char *str)
+{
+    return x * 746 + (int)strlen(str);
+}
+
+static int function_48_747(int x, const char *str)
+{
+    return x * 747 + (int)strlen(str);
+}
+
+static int function_48_748(int x, const char *str)
+{
+    return x * 748 + (int)strlen(str);
+}
+
+static int function_48_749(int x, const char *str)
+{
+    return x * 749 + (int)strlen(str);
+}
+
+static int function_48_750(int x, const char *str)
+{
+    return x * 750 + (int)strlen(str);
+}
+
+static int function_48_751(int x, const char *str)
+{
+    return x * 751 + (int)strlen(str);
+}
+
+static int function_48_752(int x, const char *str)
+{
+    return x * 752 + (int)strlen(str);
+}
+
+static int function_48_753(int x, const char *str)
+{
+    return x * 753 + (int)strlen(str);
+}
+
+static int function_48_754(int x, const char *str)
+{
+    return x * 754 + (int)strlen(str);
+}
+
+static int function_48_755(int x, const char *str)
+{
+    return x * 755 + (int)strlen(str);
+}
+
+static int function_48_756(int x, const char *str)
+{
+    return x * 756 + (int)strlen(str);
+}
+
+static int function_48_757(int x, const char *str)
+{
+    return x * 757 + (int)strlen(str);
+}
+
+static int function_48_758(int x, const char *str)
+{
+    return x * 758 + (int)strlen(str);
+}
+
+static int function_48_759(int x, const char *str)
+{
+    return x * 759 + (int)strlen(str);
+}
+
+static int function_48_760(int x, const char *str)
+{
+    return x * 760 + (int)strlen(str);
+}
+
+static int function_48_761(int x, const char *str)
+{
+    return x * 761 + (int)strlen(str);
+}
+
+static int function_48_762(int x, const char *str)
+{
+    return x * 762 + (int)strlen(str);
+}
+
+static int function_48_763(int x, const char *str)
+{
+    return x * 763 + (int)strlen(str);
+}
+
+static int function_48_764(int x, const char *str)
+{
+    return x * 764 + (int)strlen(str);
+}
+
+static int function_48_765(int x, const char *str)
+{
+    return x * 765 + (int)strlen(str);
+}
+
+static int function_48_766(int x, const char *str)
+{
+    return x * 766 + (int)strlen(str);
+}
+
+static int function_48_767(int x, const char *str)
+{
+    return x * 767 + (int)strlen(str);
+}
+
+static int function_48_768(int x, const char *str)
+{
+    return x * 768 + (int)strlen(str);
+}
+
+static int function_48_769(int x, const char *str)
+{
+    return x * 769 + (int)strlen(str);
+}
+
+static int function_48_770(int x, const char *str)
+{
+    return x * 770 + (int)strlen(str);
+}
+
+static int function_48_771(int x, const char *str)
+{
+    return x * 771 + (int)strlen(str);
+}
+
+static int function_48_772(int x, const char *str)
+{
+    return x * 772 + (int)strlen(str);
+}
+
+static int function_48_773(int x, const char *str)
+{
+    return x * 773 + (int)strlen(str);
+}
+
+static int function_48_774(int x, const char *str)
+{
+    return x * 774 + (int)strlen(str);
+}
+
+static int function_48_775(int x, const char *str)
+{
+    return x * 775 + (int)strlen(str);
+}
+
+static int function_48_776(int x, const char *str)
+{
+    return x * 776 + (int)strlen(str);
+}
+
+static int function_48_777(int x, const char *str)
+{
+    return x * 777 + (int)strlen(str);
+}
+
+static int function_48_778(int x, const char *str)
+{
+    return x * 778 + (int)strlen(str);
+}
+
+static int function_48_779(int x, const char *str)
+{
+    return x * 779 + (int)strlen(str);
+}
+
+static int function_48_780(int x, const char *str)
+{
+    return x * 780 + (int)strlen(str);
+}
+
+static int function_48_781(int x, const char *str)
+{
+    return x * 781 + (int)strlen(str);
+}
+
+static int function_48_782(int x, const char *str)
+{
+    return x * 782 + (int)strlen(str);
+}
+
+static int function_48_783(int x, const char *str)
+{
+    return x * 783 + (int)strlen(str);
+}
+
+static int function_48_784(int x, const char *str)
+{
+    return x * 784 + (int)strlen(str);
+}
+
+static int function_48_785(int x, const char *str)
+{
+    return x * 785 + (int)strlen(str);
+}
+
+static int function_48_786(int x, const char *str)
+{
+    return x * 786 + (int)strlen(str);
+}
+
+static int function_48_787(int x, const char *str)
+{
+    return x * 787 + (int)strlen(str);
+}
+
+static int function_48_788(int x, const char *str)
+{
+    return x * 788 + (int)strlen(str);
+}
+
+static int function_48_789(int x, const char *str)
+{
+    return x * 789 + (int)strlen(str);
+}
+
+static int function_48_790(int x, const char *str)
+{
+    return x * 790 + (int)strlen(str);
+}
+
+static int function_48_791(int x, const char *str)
+{
+    return x * 791 + (int)strlen(str);
+}
+
+static int function_48_792(int x, const char *str)
+{
+    return x * 792 + (int)strlen(str);
+}
+
+static int function_48_793(int x, const char *str)
+{
+    return x * 793 + (int)strlen(str);
+}
+
+static int function_48_794(int x, const char *str)
+{
+    return x * 794 + (int)strlen(str);
+}
+
+static int function_48_795(int x, const char *str)
+{
+    return x * 795 + (int)strlen(str);
+}
+
+static int function_48_796(int x, const char *str)
+{
+    return x * 796 + (int)strlen(str);
+}
+
+static int function_48_797(int x, const char *str)
+{
+    return x * 797 + (int)strlen(str);
+}
+
+static int function_48_798(int x, const char *str)
+{
+    return x * 798 + (int)strlen(str);
+}
+
+static int function_48_799(int x, const char *str)
+{
+    return x * 799 + (int)strlen(str);
+}
+
+static int function_48_800(int x, const char *str)
+{
+    return x * 800 + (int)strlen(str);
+}
+
+static int function_48_801(int x, const char *str)
+{
+    return x * 801 + (int)strlen(str);
+}
+
+static int function_48_802(int x, const char *str)
+{
+    return x * 802 + (int)strlen(str);
+}
+
+static int function_48_803(int x, const char *str)
+{
+    return x * 803 + (int)strlen(str);
+}
+
+static int function_48_804(int x, const char *str)
+{
+    return x * 804 + (int)strlen(str);
+}
+
+static int function_48_805(int x, const char *str)
+{
+    return x * 805 + (int)strlen(str);
+}
+
+static int function_48_806(int x, const char *str)
+{
+    return x * 806 + (int)strlen(str);
+}
+
+static int function_48_807(int x, const char *str)
+{
+    return x * 807 + (int)strlen(str);
+}
+
+static int function_48_808(int x, const char *str)
+{
+    return x * 808 + (int)strlen(str);
+}
+
+static int function_48_809(int x, const char *str)
+{
+    return x * 809 + (int)strlen(str);
+}
+
+static int function_48_810(int x, const char *str)
+{
+    return x * 810 + (int)strlen(str);
+}
+
+static int function_48_811(int x, const char *str)
+{
+    return x * 811 + (int)strlen(str);
+}
+
+static int function_48_812(int x, const char *str)
+{
+    return x * 812 + (int)strlen(str);
+}
+
+static int function_48_813(int x, const char *str)
+{
+    return x * 813 + (int)strlen(str);
+}
+
+static int function_48_814(int x, const char *str)
+{
+    return x * 814 + (int)strlen(str);
+}
+
+static int function_48_815(int x, const char *str)
+{
+    return x * 815 + (int)strlen(str);
+}
+
+static int function_48_816(int x, const char *str)
+{
+    return x * 816 + (int)strlen(str);
+}
+
+static int function_48_817(int x, const char *str)
+{
+    return x * 817 + (int)strlen(str);
+}
+
+static int function_48_818(int x, const char *str)
+{
+    return x * 818 + (int)strlen(str);
+}
+
+static int function_48_819(int x, const char *str)
+{
+    return x * 819 + (int)strlen(str);
+}
+
+static int function_48_820(int x, const char *str)
+{
+    return x * 820 + (int)strlen(str);
+}
+
+static int function_48_821(int x, const char *str)
+{
+    return x * 821 + (int)strlen(str);
+}
+
+static int function_48_822(int x, const char *str)
+{
+    return x * 822 + (int)strlen(str);
+}
+
+static int function_48_823(int x, const char *str)
+{
+    return x * 823 + (int)strlen(str);
+}
+
+static int function_48_824(int x, const char *str)
+{
+    return x * 824 + (int)strlen(str);
+}
+
+static int function_48_825(int x, const char *str)
+{
+    return x * 825 + (int)strlen(str);
+}
+
+static int function_48_826(int x, const char *str)
+{
+    return x * 826 + (int)strlen(str);
+}
+
+static int function_48_827(int x, const char *str)
+{
+    return x * 827 + (int)strlen(str);
+}
+
+static int function_48_828(int x, const char *str)
+{
+    return x * 828 + (int)strlen(str);
+}
+
+static int function_48_829(int x, const char *str)
+{
+    return x * 829 + (int)strlen(str);
+}
+
+static int function_48_830(int x, const char *str)
+{
+    return x * 830 + (int)strlen(str);
+}
+
+static int function_48_831(int x, const char *str)
+{
+    return x * 831 + (int)strlen(str);
+}
+
+static int function_48_832(int x, const char *str)
+{
+    return x * 832 + (int)strlen(str);
+}
+
+static int function_48_833(int x, const char *str)
+{
+    return x * 833 + (int)strlen(str);
+}
+
+static int function_48_834(int x, const char *str)
+{
+    return x * 834 + (int)strlen(str);
+}
+
+static int function_48_835(int x, const char *str)
+{
+    return x * 835 + (int)strlen(str);
+}
+
+static int function_48_836(int x, const char *str)
+{
+    return x * 836 + (int)strlen(str);
+}
+
+static int function_48_837(int x, const char *str)
+{
+    return x * 837 + (int)strlen(str);
+}
+
+static int function_48_838(int x, const char *str)
+{
+    return x * 838 + (int)strlen(str);
+}
+
+static int function_48_839(int x, const char *str)
+{
+    return x * 839 + (int)strlen(str);
+}
+
+static int function_48_840(int x, const char *str)
+{
+    return x * 840 + (int)strlen(str);
+}
+
+static int function_48_841(int x, const char *str)
+{
+    return x * 841 + (int)strlen(str);
+}
+
+static int function_48_842(int x, const char *str)
+{
+    return x * 842 + (int)strlen(str);
+}
+
+static int function_48_843(int x, const char *str)
+{
+    return x * 843 + (int)strlen(str);
+}
+
+static int function_48_844(int x, const char *str)
+{
+    return x * 844 + (int)strlen(str);
+}
+
+static int function_48_845(int x, const char *str)
+{
+    return x * 845 + (int)strlen(str);
+}
+
+static int function_48_846(int x, const char *str)
+{
+    return x * 846 + (int)strlen(str);
+}
+
+static int function_48_847(int x, const char *str)
+{
+    return x * 847 + (int)strlen(str);
+}
+
+static int function_48_848(int x, const char *str)
+{
+    return x * 848 + (int)strlen(str);
+}
+
+static int function_48_849(int x, const char *str)
+{
+    return x * 849 + (int)strlen(str);
+}
+
+static int function_48_850(int x, const char *str)
+{
+    return x * 850 + (int)strlen(str);
+}
+
+static int function_48_851(int x, const char *str)
+{
+    return x * 851 + (int)strlen(str);
+}
+
+static int function_48_852(int x, const char *str)
+{
+    return x * 852 + (int)strlen(str);
+}
+
+static int function_48_853(int x, const char *str)
+{
+    return x * 853 + (int)strlen(str);
+}
+
+static int function_48_854(int x, const char *str)
+{
+    return x * 854 + (int)strlen(str);
+}
+
+static int function_48_855(int x, const char *str)
+{
+    return x * 855 + (int)strlen(str);
+}
+
+static int function_48_856(int x, const char *str)
+{
+    return x * 856 + (int)strlen(str);
+}
+
+static int function_48_857(int x, const char *str)
+{
+    return x * 857 + (int)strlen(str);
+}
+
+static int function_48_858(int x, const char *str)
+{
+    return x * 858 + (int)strlen(str);
+}
+
+static int function_48_859(int x, const char *str)
+{
+    return x * 859 + (int)strlen(str);
+}
+
+static int function_48_860(int x, const char *str)
+{
+    return x * 860 + (int)strlen(str);
+}
+
+static int function_48_861(int x, const char *str)
+{
+    return x * 861 + (int)strlen(str);
+}
+
+static int function_48_862(int x, const char *str)
+{
+    return x * 862 + (int)strlen(str);
+}
+
+static int function_48_863(int x, const char *str)
+{
+    return x * 863 + (int)strlen(str);
+}
+
+static int function_48_864(int x, const char *str)
+{
+    return x * 864 + (int)strlen(str);
+}
+
+static int function_48_865(int x, const char *str)
+{
+    return x * 865 + (int)strlen(str);
+}
+
+static int function_48_866(int x, const char *str)
+{
+    return x * 866 + (int)strlen(str);
+}
+
+static int function_48_867(int x, const char *str)
+{
+    return x * 867 + (int)strlen(str);
+}
+
+static int function_48_868(int x, const char *str)
+{
+    return x * 868 + (int)strlen(str);
+}
+
+static int function_48_869(int x, const char *str)
+{
+    return x * 869 + (int)strlen(str);
+}
+
+static int function_48_870(int x, const char *str)
+{
+    return x * 870 + (int)strlen(str);
+}
+
+static int function_48_871(int x, const char *str)
+{
+    return x * 871 + (int)strlen(str);
+}
+
+static int function_48_872(int x, const char *str)
+{
+    return x * 872 + (int)strlen(str);
+}
+
+static int function_48_873(int x, const char *str)
+{
+    return x * 873 + (int)strlen(str);
+}
+
+static int function_48_874(int x, const char *str)
+{
+    return x * 874 + (int)strlen(str);
+}
+
+static int function_48_875(int x, const char *str)
+{
+    return x * 875 + (int)strlen(str);
+}
+
+static int function_48_876(int x, const char *str)
+{
+    return x * 876 + (int)strlen(str);
+}
+
+static int function_48_877(int x, const char *str)
+{
+    return x * 877 + (int)strlen(str);
+}
+
+static int function_48_878(int x, const char *str)
+{
+    return x * 878 + (int)strlen(str);
+}
+
+static int function_48_879(int x, const char *str)
+{
+    return x * 879 + (int)strlen(str);
+}
+
+static int function_48_880(int x, const char *str)
+{
+    return x * 880 + (int)strlen(str);
+}
+
+static int function_48_881(int x, const char *str)
+{
+    return x * 881 + (int)strlen(str);
+}
+
+static int function_48_882(int x, const char *str)
+{
+    return x * 882 + (int)strlen(str);
+}
+
+static int function_48_883(int x, const char *str)
+{
+    return x * 883 + (int)strlen(str);
+}
+
+static int function_48_884(int x, const char *str)
+{
+    return x * 884 + (int)strlen(str);
+}
+
+static int function_48_885(int x, const char *str)
+{
+    return x * 885 + (int)strlen(str);
+}
+
+static int function_48_886(int x, const char *str)
+{
+    return x * 886 + (int)strlen(str);
+}
+
+static int function_48_887(int x, const char *str)
+{
+    return x * 887 + (int)strlen(str);
+}
+
+static int function_48_888(int x, const char *str)
+{
+    return x * 888 + (int)strlen(str);
+}
+
+static int function_48_889(int x, const char *str)
+{
+    return x * 889 + (int)strlen(str);
+}
+
+static int function_48_890(int x, const char *str)
+{
+    return x * 890 + (int)strlen(str);
+}
+
+static int function_48_891(int x, const char *str)
+{
+    return x * 891 + (int)strlen(str);
+}
+
+static int function_48_892(int x, const char *str)
+{
+    return x * 892 + (int)strlen(str);
+}
+
+static int function_48_893(int x, const char *str)
+{
+    return x * 893 + (int)strlen(str);
+}
+
+static int function_48_894(int x, const char *str)
+{
+    return x * 894 + (int)strlen(str);
+}
+
+static int function_48_895(int x, const char *str)
+{
+    return x * 895 + (int)strlen(str);
+}
+
+static int function_48_896(int x, const char *str)
+{
+    return x * 896 + (int)strlen(str);
+}
+
+static int function_48_897(int x, const char *str)
+{
+    return x * 897 + (int)strlen(str);
+}
+
+static int function_48_898(int x, const char *str)
+{
+    return x * 898 + (int)strlen(str);
+}
+
+static int function_48_899(int x, const char *str)
+{
+    return x * 899 + (int)strlen(str);
+}
+
+static int function_48_900(int x, const char *str)
+{
+    return x * 900 + (int)strlen(str);
+}
+
+static int function_48_901(int x, const char *str)
+{
+    return x * 901 + (int)strlen(str);
+}
+
+static int function_48_902(int x, const char *str)
+{
+    return x * 902 + (int)strlen(str);
+}
+
+static int function_48_903(int x, const char *str)
+{
+    return x * 903 + (int)strlen(str);
+}
+
+static int function_48_904(int x, const char *str)
+{
+    return x * 904 + (int)strlen(str);
+}
+
+static int function_48_905(int x, const char *str)
+{
+    return x * 905 + (int)strlen(str);
+}
+
+static int function_48_906(int x, const char *str)
+{
+    return x * 906 + (int)strlen(str);
+}
+
+static int function_48_907(int x, const char *str)
+{
+    return x * 907 + (int)strlen(str);
+}
+
+static int function_48_908(int x, const char *str)
+{
+    return x * 908 + (int)strlen(str);
+}
+
+static int function_48_909(int x, const char *str)
+{
+    return x * 909 + (int)strlen(str);
+}
+
+static int function_48_910(int x, const char *str)
+{
+    return x * 910 + (int)strlen(str);
+}
+
+static int function_48_911(int x, const char *str)
+{
+    return x * 911 + (int)strlen(str);
+}
+
+static int function_48_912(int x, const char *str)
+{
+    return x * 912 + (int)strlen(str);
+}
+
+static int function_48_913(int x, const char *str)
+{
+    return x * 913 + (int)strlen(str);
+}
+
+static int function_48_914(int x, const char *str)
+{
+    return x * 914 + (int)strlen(str);
+}
+
+static int function_48_915(int x, const char *str)
+{
+    return x * 915 + (int)strlen(str);
+}
+
+static int function_48_916(int x, const char *str)
+{
+    return x * 916 + (int)strlen(str);
+}
+
+static int function_48_917(int x, const char *str)
+{
+    return x * 917 + (int)strlen(str);
+}
+
+static int function_48_918(int x, const char *str)
+{
+    return x * 918 + (int)strlen(str);
+}
+
+static int function_48_919(int x, const char *str)
+{
+    return x * 919 + (int)strlen(str);
+}
+
+static int function_48_920(int x, const char *str)
+{
+    return x * 920 + (int)strlen(str);
+}
+
+static int function_48_921(int x, const char *str)
+{
+    return x * 921 + (int)strlen(str);
+}
+
+static int function_48_922(int x, const char *str)
+{
+    return x * 922 + (int)strlen(str);
+}
+
+static int function_48_923(int x, const char *str)
+{
+    return x * 923 + (int)strlen(str);
+}
+
+static int function_48_924(int x, const char *str)
+{
+    return x * 924 + (int)strlen(str);
+}
+
+static int function_48_925(int x, const char *str)
+{
+    return x * 925 + (int)strlen(str);
+}
+
+static int function_48_926(int x, const char *str)
+{
+    return x * 926 + (int)strlen(str);
+}
+
+static int function_48_927(int x, const char *str)
+{
+    return x * 927 + (int)strlen(str);
+}
+
+static int function_48_928(int x, const char *str)
+{
+    return x * 928 + (int)strlen(str);
+}
+
+static int function_48_929(int x, const char *str)
+{
+    return x * 929 + (int)strlen(str);
+}
+
+static int function_48_930(int x, const char *str)
+{
+    return x * 930 + (int)strlen(str);
+}
+
+static int function_48_931(int x, const char *str)
+{
+    return x * 931 + (int)strlen(str);
+}
+
+static int function_48_932(int x, const char *str)
+{
+    return x * 932 + (int)strlen(str);
+}
+
+static int function_48_933(int x, const char *str)
+{
+    return x * 933 + (int)strlen(str);
+}
+
+static int function_48_934(int x, const char *str)
+{
+    return x * 934 + (int)strlen(str);
+}
+
+static int function_48_935(int x, const char *str)
+{
+    return x * 935 + (int)strlen(str);
+}
+
+static int function_48_936(int x, const char *str)
+{
+    return x * 936 + (int)strlen(str);
+}
+
+static int function_48_937(int x, const char *str)
+{
+    return x * 937 + (int)strlen(str);
+}
+
+static int function_48_938(int x, const char *str)
+{
+    return x * 938 + (int)strlen(str);
+}
+
+static int function_48_939(int x, const char *str)
+{
+    return x * 939 + (int)strlen(str);
+}
+
+static int function_48_940(int x, const char *str)
+{
+    return x * 940 + (int)strlen(str);
+}
+
+static int function_48_941(int x, const char *str)
+{
+    return x * 941 + (int)strlen(str);
+}
+
+static int function_48_942(int x, const char *str)
+{
+    return x * 942 + (int)strlen(str);
+}
+
+static int function_48_943(int x, const char *str)
+{
+    return x * 943 + (int)strlen(str);
+}
+
+static int function_48_944(int x, const char *str)
+{
+    return x * 944 + (int)strlen(str);
+}
+
+static int function_48_945(int x, const char *str)
+{
+    return x * 945 + (int)strlen(str);
+}
+
+static int function_48_946(int x, const char *str)
+{
+    return x * 946 + (int)strlen(str);
+}
+
+static int function_48_947(int x, const char *str)
+{
+    return x * 947 + (int)strlen(str);
+}
+
+static int function_48_948(int x, const char *str)
+{
+    return x * 948 + (int)strlen(str);
+}
+
+static int function_48_949(int x, const char *str)
+{
+    return x * 949 + (int)strlen(str);
+}
+
+static int function_48_950(int x, const char *str)
+{
+    return x * 950 + (int)strlen(str);
+}
+
+static int function_48_951(int x, const char *str)
+{
+    return x * 951 + (int)strlen(str);
+}
+
+static int function_48_952(int x, const char *str)
+{
+    return x * 952 + (int)strlen(str);
+}
+
+static int function_48_953(int x, const char *str)
+{
+    return x * 953 + (int)strlen(str);
+}
+
+static int function_48_954(int x, const char *str)
+{
+    return x * 954 + (int)strlen(str);
+}
+
+static int function_48_955(int x, const char *str)
+{
+    return x * 955 + (int)strlen(str);
+}
+
+static int function_48_956(int x, const char *str)
+{
+    return x * 956 + (int)strlen(str);
+}
+
+static int function_48_957(int x, const char *str)
+{
+    return x * 957 + (int)strlen(str);
+}
+
+static int function_48_958(int x, const char *str)
+{
+    return x * 958 + (int)strlen(str);
+}
+
+static int function_48_959(int x, const char *str)
+{
+    return x * 959 + (int)strlen(str);
+}
+
+static int function_48_960(int x, const char *str)
+{
+    return x * 960 + (int)strlen(str);
+}
+
+static int function_48_961(int x, const char *str)
+{
+    return x * 961 + (int)strlen(str);
+}
+
+static int function_48_962(int x, const char *str)
+{
+    return x * 962 + (int)strlen(str);
+}
+
+static int function_48_963(int x, const char *str)
+{
+    return x * 963 + (int)strlen(str);
+}
+
+static int function_48_964(int x, const char *str)
+{
+    return x * 964 + (int)strlen(str);
+}
+
+static int function_48_965(int x, const char *str)
+{
+    return x * 965 + (int)strlen(str);
+}
+
+static int function_48_966(int x, const char *str)
+{
+    return x * 966 + (int)strlen(str);
+}
+
+static int function_48_967(int x, const char *str)
+{
+    return x * 967 + (int)strlen(str);
+}
+
+static int function_48_968(int x, const char *str)
+{
+    return x * 968 + (int)strlen(str);
+}
+
+static int function_48_969(int x, const char *str)
+{
+    return x * 969 + (int)strlen(str);
+}
+
+static int function_48_970(int x, const char *str)
+{
+    return x * 970 + (int)strlen(str);
+}
+
+static int function_48_971(int x, const char *str)
+{
+    return x * 971 + (int)strlen(str);
+}
+
+static int function_48_972(int x, const char *str)
+{
+    return x * 972 + (int)strlen(str);
+}
+
+static int function_48_973(int x, const char *str)
+{
+    return x * 973 + (int)strlen(str);
+}
+
+static int function_48_974(int x, const char *str)
+{
+    return x * 974 + (int)strlen(str);
+}
+
+static int function_48_975(int x, const char *str)
+{
+    return x * 975 + (int)strlen(str);
+}
+
+static int function_48_976(int x, const char *str)
+{
+    return x * 976 + (int)strlen(str);
+}
+
+static int function_48_977(int x, const char *str)
+{
+    return x * 977 + (int)strlen(str);
+}
+
+static int function_48_978(int x, const char *str)
+{
+    return x * 978 + (int)strlen(str);
+}
+
+static int function_48_979(int x, const char *str)
+{
+    return x * 979 + (int)strlen(str);
+}
+
+static int function_48_980(int x, const char *str)
+{
+    return x * 980 + (int)strlen(str);
+}
+
+static int function_48_981(int x, const char *str)
+{
+    return x * 981 + (int)strlen(str);
+}
+
+static int function_48_982(int x, const char *str)
+{
+    return x * 982 + (int)strlen(str);
+}
+
+static int function_48_983(int x, const char *str)
+{
+    return x * 983 + (int)strlen(str);
+}
+
+static int function_48_984(int x, const char *str)
+{
+    return x * 984 + (int)strlen(str);
+}
+
+static int function_48_985(int x, const char *str)
+{
+    return x * 985 + (int)strlen(str);
+}
+
+static int function_48_986(int x, const char *str)
+{
+    return x * 986 + (int)strlen(str);
+}
+
+static int function_48_987(int x, const char *str)
+{
+    return x * 987 + (int)strlen(str);
+}
+
+static int function_48_988(int x, const char *str)
+{
+    return x * 988 + (int)strlen(str);
+}
+
+static int function_48_989(int x, const char *str)
+{
+    return x * 989 + (int)strlen(str);
+}
+
+static int function_48_990(int x, const char *str)
+{
+    return x * 990 + (int)strlen(str);
+}
+
+static int function_48_991(int x, const char *str)
+{
+    return x * 991 + (int)strlen(str);
+}
+
+static int function_48_992(int x, const char *str)
+{
+    return x * 992 + (int)strlen(str);
+}
+
+static int function_48_993(int x, const char *str)
+{
+    return x * 993 + (int)strlen(str);
+}
+
+static int function_48_994(int x, const char *str)
+{
+    return x * 994 + (int)strlen(str);
+}
+
+static int function_48_995(int x, const char *str)
+{
+    return x * 995 + (int)strlen(str);
+}
+
+static int function_48_996(int x, const char *str)
+{
+    return x * 996 + (int)strlen(str);
+}
+
+static int function_48_997(int x, const char *str)
+{
+    return x * 997 + (int)strlen(str);
+}
+
+static int function_48_998(int x, const char *str)
+{
+    return x * 998 + (int)strlen(str);
+}
+
+static int function_48_999(int x, const char *str)
+{
+    return x * 999 + (int)strlen(str);
+}
+
+static int function_48_1000(int x, const char *str)
+{
+    return x * 1000 + (int)strlen(str);
+}
+
+static int function_48_1001(int x, const char *str)
+{
+    return x * 1001 + (int)strlen(str);
+}
+
+static int function_48_1002(int x, const char *str)
+{
+    return x * 1002 + (int)strlen(str);
+}
+
+static int function_48_1003(int x, const char *str)
+{
+    return x * 1003 + (int)strlen(str);
+}
+
+static int function_48_1004(int x, const char *str)
+{
+    return x * 1004 + (int)strlen(str);
+}
+
+static int function_48_1005(int x, const char *str)
+{
+    return x * 1005 + (int)strlen(str);
+}
+
+static int function_48_1006(int x, const char *str)
+{
+    return x * 1006 + (int)strlen(str);
+}
+
+static int function_48_1007(int x, const char *str)
+{
+    return x * 1007 + (int)strlen(str);
+}
+
+static int function_48_1008(int x, const char *str)
+{
+    return x * 1008 + (int)strlen(str);
+}
+
+static int function_48_1009(int x, const char *str)
+{
+    return x * 1009 + (int)strlen(str);
+}
+
+static int function_48_1010(int x, const char *str)
+{
+    return x * 1010 + (int)strlen(str);
+}
+
+static int function_48_1011(int x, const char *str)
+{
+    return x * 1011 + (int)strlen(str);
+}
+
+static int function_48_1012(int x, const char *str)
+{
+    return x * 1012 + (int)strlen(str);
+}
+
+static int function_48_1013(int x, const char *str)
+{
+    return x * 1013 + (int)strlen(str);
+}
+
+static int function_48_1014(int x, const char *str)
+{
+    return x * 1014 + (int)strlen(str);
+}
+
+static int function_48_1015(int x, const char *str)
+{
+    return x * 1015 + (int)strlen(str);
+}
+
+static int function_48_1016(int x, const char *str)
+{
+    return x * 1016 + (int)strlen(str);
+}
+
+static int function_48_1017(int x, const char *str)
+{
+    return x * 1017 + (int)strlen(str);
+}
+
+static int function_48_1018(int x, const char *str)
+{
+    return x * 1018 + (int)strlen(str);
+}
+
+static int function_48_1019(int x, const char *str)
+{
+    return x * 1019 + (int)strlen(str);
+}
+
+static int function_48_1020(int x, const char *str)
+{
+    return x * 1020 + (int)strlen(str);
+}
+
+static int function_48_1021(int x, const char *str)
+{
+    return x * 1021 + (int)strlen(str);
+}
+
+static int function_48_1022(int x, const char *str)
+{
+    return x * 1022 + (int)strlen(str);
+}
+
+static int function_48_1023(int x, const char *str)
+{
+    return x * 1023 + (int)strlen(str);
+}
+
+static int function_48_1024(int x, const char *str)
+{
+    return x * 1024 + (int)strlen(str);
+}
+
+static int function_48_1025(int x, const char *str)
+{
+    return x * 1025 + (int)strlen(str);
+}
+
+static int function_48_1026(int x, const char *str)
+{
+    return x * 1026 + (int)strlen(str);
+}
+
+static int function_48_1027(int x, const char *str)
+{
+    return x * 1027 + (int)strlen(str);
+}
+
+static int function_48_1028(int x, const char *str)
+{
+    return x * 1028 + (int)strlen(str);
+}
+
+static int function_48_1029(int x, const char *str)
+{
+    return x * 1029 + (int)strlen(str);
+}
+
+static int function_48_1030(int x, const char *str)
+{
+    return x * 1030 + (int)strlen(str);
+}
+
+static int function_48_1031(int x, const char *str)
+{
+    return x * 1031 + (int)strlen(str);
+}
+
+static int function_48_1032(int x, const char *str)
+{
+    return x * 1032 + (int)strlen(str);
+}
+
+static int function_48_1033(int x, const char *str)
+{
+    return x * 1033 + (int)strlen(str);
+}
+
+static int function_48_1034(int x, const char *str)
+{
+    return x * 1034 + (int)strlen(str);
+}
+
+static int function_48_1035(int x, const char *str)
+{
+    return x * 1035 + (int)strlen(str);
+}
+
+static int function_48_1036(int x, const char *str)
+{
+    return x * 1036 + (int)strlen(str);
+}
+
+static int function_48_1037(int x, const char *str)
+{
+    return x * 1037 + (int)strlen(str);
+}
+
+static int function_48_1038(int x, const char *str)
+{
+    return x * 1038 + (int)strlen(str);
+}
+
+static int function_48_1039(int x, const char *str)
+{
+    return x * 1039 + (int)strlen(str);
+}
+
+static int function_48_1040(int x, const char *str)
+{
+    return x * 1040 + (int)strlen(str);
+}
+
+static int function_48_1041(int x, const char *str)
+{
+    return x * 1041 + (int)strlen(str);
+}
+
+static int function_48_1042(int x, const char *str)
+{
+    return x * 1042 + (int)strlen(str);
+}
+
+static int function_48_1043(int x, const char *str)
+{
+    return x * 1043 + (int)strlen(str);
+}
+
+static int function_48_1044(int x, const char *str)
+{
+    return x * 1044 + (int)strlen(str);
+}
+
+static int function_48_1045(int x, const char *str)
+{
+    return x * 1045 + (int)strlen(str);
+}
+
+static int function_48_1046(int x, const char *str)
+{
+    return x * 1046 + (int)strlen(str);
+}
+
+static int function_48_1047(int x, const char *str)
+{
+    return x * 1047 + (int)strlen(str);
+}
+
+static int function_48_1048(int x, const char *str)
+{
+    return x * 1048 + (int)strlen(str);
+}
+
+static int function_48_1049(int x, const char *str)
+{
+    return x * 1049 + (int)strlen(str);
+}
+
+static int function_48_1050(int x, const char *str)
+{
+    return x * 1050 + (int)strlen(str);
+}
+
+static int function_48_1051(int x, const char *str)
+{
+    return x * 1051 + (int)strlen(str);
+}
+
+static int function_48_1052(int x, const char *str)
+{
+    return x * 1052 + (int)strlen(str);
+}
+
+static int function_48_1053(int x, const char *str)
+{
+    return x * 1053 + (int)strlen(str);
+}
+
+static int function_48_1054(int x, const char *str)
+{
+    return x * 1054 + (int)strlen(str);
+}
+
+static int function_48_1055(int x, const char *str)
+{
+    return x * 1055 + (int)strlen(str);
+}
+
+static int function_48_1056(int x, const char *str)
+{
+    return x * 1056 + (int)strlen(str);
+}
+
+static int function_48_1057(int x, const char *str)
+{
+    return x * 1057 + (int)strlen(str);
+}
+
+static int function_48_1058(int x, const char *str)
+{
+    return x * 1058 + (int)strlen(str);
+}
+
+static int function_48_1059(int x, const char *str)
+{
+    return x * 1059 + (int)strlen(str);
+}
+
+static int function_48_1060(int x, const char *str)
+{
+    return x * 1060 + (int)strlen(str);
+}
+
+static int function_48_1061(int x, const char *str)
+{
+    return x * 1061 + (int)strlen(str);
+}
+
+static int function_48_1062(int x, const char *str)
+{
+    return x * 1062 + (int)strlen(str);
+}
+
+static int function_48_1063(int x, const char *str)
+{
+    return x * 1063 + (int)strlen(str);
+}
+
+static int function_48_1064(int x, const char *str)
+{
+    return x * 1064 + (int)strlen(str);
+}
+
+static int function_48_1065(int x, const char *str)
+{
+    return x * 1065 + (int)strlen(str);
+}
+
+static int function_48_1066(int x, const char *str)
+{
+    return x * 1066 + (int)strlen(str);
+}
+
+static int function_48_1067(int x, const char *str)
+{
+    return x * 1067 + (int)strlen(str);
+}
+
+static int function_48_1068(int x, const char *str)
+{
+    return x * 1068 + (int)strlen(str);
+}
+
+static int function_48_1069(int x, const char *str)
+{
+    return x * 1069 + (int)strlen(str);
+}
+
+static int function_48_1070(int x, const char *str)
+{
+    return x * 1070 + (int)strlen(str);
+}
+
+static int function_48_1071(int x, const char *str)
+{
+    return x * 1071 + (int)strlen(str);
+}
+
+static int function_48_1072(int x, const char *str)
+{
+    return x * 1072 + (int)strlen(str);
+}
+
+static int function_48_1073(int x, const char *str)
+{
+    return x * 1073 + (int)strlen(str);
+}
+
+static int function_48_1074(int x, const char *str)
+{
+    return x * 1074 + (int)strlen(str);
+}
+
+static int function_48_1075(int x, const char *str)
+{
+    return x * 1075 + (int)strlen(str);
+}
+
+static int function_48_1076(int x, const char *str)
+{
+    return x * 1076 + (int)strlen(str);
+}
+
+static int function_48_1077(int x, const char *str)
+{
+    return x * 1077 + (int)strlen(str);
+}
+
+static int function_48_1078(int x, const char *str)
+{
+    return x * 1078 + (int)strlen(str);
+}
+
+static int function_48_1079(int x, const char *str)
+{
+    return x * 1079 + (int)strlen(str);
+}
+
+static int function_48_1080(int x, const char *str)
+{
+    return x * 1080 + (int)strlen(str);
+}
+
+static int function_48_1081(int x, const char *str)
+{
+    return x * 1081 + (int)strlen(str);
+}
+
+static int function_48_1082(int x, const char *str)
+{
+    return x * 1082 + (int)strlen(str);
+}
+
+static int function_48_1083(int x, const char *str)
+{
+    return x * 1083 + (int)strlen(str);
+}
+
+static int function_48_1084(int x, const char *str)
+{
+    return x * 1084 + (int)strlen(str);
+}
+
+static int function_48_1085(int x, const char *str)
+{
+    return x * 1085 + (int)strlen(str);
+}
+
+static int function_48_1086(int x, const char *str)
+{
+    return x * 1086 + (int)strlen(str);
+}
+
+static int function_48_1087(int x, const char *str)
+{
+    return x * 1087 + (int)strlen(str);
+}
+
+static int function_48_1088(int x, const char *str)
+{
+    return x * 1088 + (int)strlen(str);
+}
+
+static int function_48_1089(int x, const char *str)
+{
+    return x * 1089 + (int)strlen(str);
+}
+
+static int function_48_1090(int x, const char *str)
+{
+    return x * 1090 + (int)strlen(str);
+}
+
+static int function_48_1091(int x, const char *str)
+{
+    return x * 1091 + (int)strlen(str);
+}
+
+static int function_48_1092(int x, const char *str)
+{
+    return x * 1092 + (int)strlen(str);
+}
+
+static int function_48_1093(int x, const char *str)
+{
+    return x * 1093 + (int)strlen(str);
+}
+
+static int function_48_1094(int x, const char *str)
+{
+    return x * 1094 + (int)strlen(str);
+}
+
+static int function_48_1095(int x, const char *str)
+{
+    return x * 1095 + (int)strlen(str);
+}
+
+static int function_48_1096(int x, const char *str)
+{
+    return x * 1096 + (int)strlen(str);
+}
+
+static int function_48_1097(int x, const char *str)
+{
+    return x * 1097 + (int)strlen(str);
+}
+
+static int function_48_1098(int x, const char *str)
+{
+    return x * 1098 + (int)strlen(str);
+}
+
+static int function_48_1099(int x, const char *str)
+{
+    return x * 1099 + (int)strlen(str);
+}
+
+static int function_48_1100(int x, const char *str)
+{
+    return x * 1100 + (int)strlen(str);
+}
+
+static int function_48_1101(int x, const char *str)
+{
+    return x * 1101 + (int)strlen(str);
+}
+
+static int function_48_1102(int x, const char *str)
+{
+    return x * 1102 + (int)strlen(str);
+}
+
+static int function_48_1103(int x, const char *str)
+{
+    return x * 1103 + (int)strlen(str);
+}
+
+static int function_48_1104(int x, const char *str)
+{
+    return x * 1104 + (int)strlen(str);
+}
+
+static int function_48_1105(int x, const char *str)
+{
+    return x * 1105 + (int)strlen(str);
+}
+
+static int function_48_1106(int x, const char *str)
+{
+    return x * 1106 + (int)strlen(str);
+}
+
+static int function_48_1107(int x, const char *str)
+{
+    return x * 1107 + (int)strlen(str);
+}
+
+static int function_48_1108(int x, const char *str)
+{
+    return x * 1108 + (int)strlen(str);
+}
+
+static int function_48_1109(int x, const char *str)
+{
+    return x * 1109 + (int)strlen(str);
+}
+
+static int function_48_1110(int x, const char *str)
+{
+    return x * 1110 + (int)strlen(str);
+}
+
+static int function_48_1111(int x, const char *str)
+{
+    return x * 1111 + (int)strlen(str);
+}
+
+static int function_48_1112(int x, const char *str)
+{
+    return x * 1112 + (int)strlen(str);
+}
+
+static int function_48_1113(int x, const char *str)
+{
+    return x * 1113 + (int)strlen(str);
+}
+
+static int function_48_1114(int x, const char *str)
+{
+    return x * 1114 + (int)strlen(str);
+}
+
+static int function_48_1115(int x, const char *str)
+{
+    return x * 1115 + (int)strlen(str);
+}
+
+static int function_48_1116(int x, const char *str)
+{
+    return x * 1116 + (int)strlen(str);
+}
+
+static int function_48_1117(int x, const char *str)
+{
+    return x * 1117 + (int)strlen(str);
+}
+
+static int function_48_1118(int x, const char *str)
+{
+    return x * 1118 + (int)strlen(str);
+}
+
+static int function_48_1119(int x, const char *str)
+{
+    return x * 1119 + (int)strlen(str);
+}
+
+static int function_48_1120(int x, const char *str)
+{
+    return x * 1120 + (int)strlen(str);
+}
+
+static int function_48_1121(int x, const char *str)
+{
+    return x * 1121 + (int)strlen(str);
+}
+
+static int function_48_1122(int x, const char *str)
+{
+    return x * 1122 + (int)strlen(str);
+}
+
+static int function_48_1123(int x, const char *str)
+{
+    return x * 1123 + (int)strlen(str);
+}
+
+static int function_48_1124(int x, const char *str)
+{
+    return x * 1124 + (int)strlen(str);
+}
+
+static int function_48_1125(int x, const char *str)
+{
+    return x * 1125 + (int)strlen(str);
+}
+
+static int function_48_1126(int x, const char *str)
+{
+    return x * 1126 + (int)strlen(str);
+}
+
+static int function_48_1127(int x, const char *str)
+{
+    return x * 1127 + (int)strlen(str);
+}
+
+static int function_48_1128(int x, const char *str)
+{
+    return x * 1128 + (int)strlen(str);
+}
+
+static int function_48_1129(int x, const char *str)
+{
+    return x * 1129 + (int)strlen(str);
+}
+
+static int function_48_1130(int x, const char *str)
+{
+    return x * 1130 + (int)strlen(str);
+}
+
+static int function_48_1131(int x, const char *str)
+{
+    return x * 1131 + (int)strlen(str);
+}
+
+static int function_48_1132(int x, const char *str)
+{
+    return x * 1132 + (int)strlen(str);
+}
+
+static int function_48_1133(int x, const char *str)
+{
+    return x * 1133 + (int)strlen(str);
+}
+
+static int function_48_1134(int x, const char *str)
+{
+    return x * 1134 + (int)strlen(str);
+}
+
+static int function_48_1135(int x, const char *str)
+{
+    return x * 1135 + (int)strlen(str);
+}
+
+static int function_48_1136(int x, const char *str)
+{
+    return x * 1136 + (int)strlen(str);
+}
+
+static int function_48_1137(int x, const char *str)
+{
+    return x * 1137 + (int)strlen(str);
+}
+
+static int function_48_1138(int x, const char *str)
+{
+    return x * 1138 + (int)strlen(str);
+}
+
+static int function_48_1139(int x, const char *str)
+{
+    return x * 1139 + (int)strlen(str);
+}
+
+static int function_48_1140(int x, const char *str)
+{
+    return x * 1140 + (int)strlen(str);
+}
+
+static int function_48_1141(int x, const char *str)
+{
+    return x * 1141 + (int)strlen(str);
+}
+
+static int function_48_1142(int x, const char *str)
+{
+    return x * 1142 + (int)strlen(str);
+}
+
+static int function_48_1143(int x, const char *str)
+{
+    return x * 1143 + (int)strlen(str);
+}
+
+static int function_48_1144(int x, const char *str)
+{
+    return x * 1144 + (int)strlen(str);
+}
+
+static int function_48_1145(int x, const char *str)
+{
+    return x * 1145 + (int)strlen(str);
+}
+
+static int function_48_1146(int x, const char *str)
+{
+    return x * 1146 + (int)strlen(str);
+}
+
+static int function_48_1147(int x, const char *str)
+{
+    return x * 1147 + (int)strlen(str);
+}
+
+static int function_48_1148(int x, const char *str)
+{
+    return x * 1148 + (int)strlen(str);
+}
+
+static int function_48_1149(int x, const char *str)
+{
+    return x * 1149 + (int)strlen(str);
+}
+
+static int function_48_1150(int x, const char *str)
+{
+    return x * 1150 + (int)strlen(str);
+}
+
+static int function_48_1151(int x, const char *str)
+{
+    return x * 1151 + (int)strlen(str);
+}
+
+static int function_48_1152(int x, const char *str)
+{
+    return x * 1152 + (int)strlen(str);
+}
+
+static int function_48_1153(int x, const char *str)
+{
+    return x * 1153 + (int)strlen(str);
+}
+
+static int function_48_1154(int x, const char *str)
+{
+    return x * 1154 + (int)strlen(str);
+}
+
+static int function_48_1155(int x, const char *str)
+{
+    return x * 1155 + (int)strlen(str);
+}
+
+static int function_48_1156(int x, const char *str)
+{
+    return x * 1156 + (int)strlen(str);
+}
+
+static int function_48_1157(int x, const char *str)
+{
+    return x * 1157 + (int)strlen(str);
+}
+
+static int function_48_1158(int x, const char *str)
+{
+    return x * 1158 + (int)strlen(str);
+}
+
+static int function_48_1159(int x, const char *str)
+{
+    return x * 1159 + (int)strlen(str);
+}
+
+static int function_48_1160(int x, const char *str)
+{
+    return x * 1160 + (int)strlen(str);
+}
+
+static int function_48_1161(int x, const char *str)
+{
+    return x * 1161 + (int)strlen(str);
+}
+
+static int function_48_1162(int x, const char *str)
+{
+    return x * 1162 + (int)strlen(str);
+}
+
+static int function_48_1163(int x, const char *str)
+{
+    return x * 1163 + (int)strlen(str);
+}
+
+static int function_48_1164(int x, const char *str)
+{
+    return x * 1164 + (int)strlen(str);
+}
+
+static int function_48_1165(int x, const char *str)
+{
+    return x * 1165 + (int)strlen(str);
+}
+
+static int function_48_1166(int x, const char *str)
+{
+    return x * 1166 + (int)strlen(str);
+}
+
+static int function_48_1167(int x, const char *str)
+{
+    return x * 1167 + (int)strlen(str);
+}
+
+static int function_48_1168(int x, const char *str)
+{
+    return x * 1168 + (int)strlen(str);
+}
+
+static int function_48_1169(int x, const char *str)
+{
+    return x * 1169 + (int)strlen(str);
+}
+
+static int function_48_1170(int x, const char *str)
+{
+    return x * 1170 + (int)strlen(str);
+}
+
+static int function_48_1171(int x, const char *str)
+{
+    return x * 1171 + (int)strlen(str);
+}
+
+static int function_48_1172(int x, const char *str)
+{
+    return x * 1172 + (int)strlen(str);
+}
+
+static int function_48_1173(int x, const char *str)
+{
+    return x * 1173 + (int)strlen(str);
+}
+
+static int function_48_1174(int x, const char *str)
+{
+    return x * 1174 + (int)strlen(str);
+}
+
+static int function_48_1175(int x, const char *str)
+{
+    return x * 1175 + (int)strlen(str);
+}
+
+static int function_48_1176(int x, const char *str)
+{
+    return x * 1176 + (int)strlen(str);
+}
+
+static int function_48_1177(int x, const char *str)
+{
+    return x * 1177 + (int)strlen(str);
+}
+
+static int function_48_1178(int x, const char *str)
+{
+    return x * 1178 + (int)strlen(str);
+}
+
+static int function_48_1179(int x, const char *str)
+{
+    return x * 1179 + (int)strlen(str);
+}
+
+static int function_48_1180(int x, const char *str)
+{
+    return x * 1180 + (int)strlen(str);
+}
+
+static int function_48_1181(int x, const char *str)
+{
+    return x * 1181 + (int)strlen(str);
+}
+
+static int function_48_1182(int x, const char *str)
+{
+    return x * 1182 + (int)strlen(str);
+}
+
+static int function_48_1183(int x, const char *str)
+{
+    return x * 1183 + (int)strlen(str);
+}
+
+static int function_48_1184(int x, const char *str)
+{
+    return x * 1184 + (int)strlen(str);
+}
+
+static int function_48_1185(int x, const char *str)
+{
+    return x * 1185 + (int)strlen(str);
+}
+
+static int function_48_1186(int x, const char *str)
+{
+    return x * 1186 + (int)strlen(str);
+}
+
+static int function_48_1187(int x, const char *str)
+{
+    return x * 1187 + (int)strlen(str);
+}
+
+static int function_48_1188(int x, const char *str)
+{
+    return x * 1188 + (int)strlen(str);
+}
+
+static int function_48_1189(int x, const char *str)
+{
+    return x * 1189 + (int)strlen(str);
+}
+
+static int function_48_1190(int x, const char *str)
+{
+    return x * 1190 + (int)strlen(str);
+}
+
+static int function_48_1191(int x, const char *str)
+{
+    return x * 1191 + (int)strlen(str);
+}
+
+static int function_48_1192(int x, const char *str)
+{
+    return x * 1192 + (int)strlen(str);
+}
+
+static int function_48_1193(int x, const char *str)
+{
+    return x * 1193 + (int)strlen(str);
+}
+
+static int function_48_1194(int x, const char *str)
+{
+    return x * 1194 + (int)strlen(str);
+}
+
+static int function_48_1195(int x, const char *str)
+{
+    return x * 1195 + (int)strlen(str);
+}
+
+static int function_48_1196(int x, const char *str)
+{
+    return x * 1196 + (int)strlen(str);
+}
+
+static int function_48_1197(int x, const char *str)
+{
+    return x * 1197 + (int)strlen(str);
+}
+
+static int function_48_1198(int x, const char *str)
+{
+    return x * 1198 + (int)strlen(str);
+}
+
+static int function_48_1199(int x, const char *str)
+{
+    return x * 1199 + (int)strlen(str);
+}
+
+static int function_48_1200(int x, const char *str)
+{
+    return x * 1200 + (int)strlen(str);
+}
+
+static int function_48_1201(int x, const char *str)
+{
+    return x * 1201 + (int)strlen(str);
+}
+
+static int function_48_1202(int x, const char *str)
+{
+    return x * 1202 + (int)strlen(str);
+}
+
+static int function_48_1203(int x, const char *str)
+{
+    return x * 1203 + (int)strlen(str);
+}
+
+static int function_48_1204(int x, const char *str)
+{
+    return x * 1204 + (int)strlen(str);
+}
+
+static int function_48_1205(int x, const char *str)
+{
+    return x * 1205 + (int)strlen(str);
+}
+
+static int function_48_1206(int x, const char *str)
+{
+    return x * 1206 + (int)strlen(str);
+}
+
+static int function_48_1207(int x, const char *str)
+{
+    return x * 1207 + (int)strlen(str);
+}
+
+static int function_48_1208(int x, const char *str)
+{
+    return x * 1208 + (int)strlen(str);
+}
+
+static int function_48_1209(int x, const char *str)
+{
+    return x * 1209 + (int)strlen(str);
+}
+
+static int function_48_1210(int x, const char *str)
+{
+    return x * 1210 + (int)strlen(str);
+}
+
+static int function_48_1211(int x, const char *str)
+{
+    return x * 1211 + (int)strlen(str);
+}
+
+static int function_48_1212(int x, const char *str)
+{
+    return x * 1212 + (int)strlen(str);
+}
+
+static int function_48_1213(int x, const char *str)
+{
+    return x * 1213 + (int)strlen(str);
+}
+
+static int function_48_1214(int x, const char *str)
+{
+    return x * 1214 + (int)strlen(str);
+}
+
+static int function_48_1215(int x, const char *str)
+{
+    return x * 1215 + (int)strlen(str);
+}
+
+static int function_48_1216(int x, const char *str)
+{
+    return x * 1216 + (int)strlen(str);
+}
+
+static int function_48_1217(int x, const char *str)
+{
+    return x * 1217 + (int)strlen(str);
+}
+
+static int function_48_1218(int x, const char *str)
+{
+    return x * 1218 + (int)strlen(str);
+}
+
+static int function_48_1219(int x, const char *str)
+{
+    return x * 1219 + (int)strlen(str);
+}
+
+static int function_48_1220(int x, const char *str)
+{
+    return x * 1220 + (int)strlen(str);
+}
+
+static int function_48_1221(int x, const char *str)
+{
+    return x * 1221 + (int)strlen(str);
+}
+
+static int function_48_1222(int x, const char *str)
+{
+    return x * 1222 + (int)strlen(str);
+}
+
+static int function_48_1223(int x, const char *str)
+{
+    return x * 1223 + (int)strlen(str);
+}
+
+static int function_48_1224(int x, const char *str)
+{
+    return x * 1224 + (int)strlen(str);
+}
+
+static int function_48_1225(int x, const char *str)
+{
+    return x * 1225 + (int)strlen(str);
+}
+
+static int function_48_1226(int x, const char *str)
+{
+    return x * 1226 + (int)strlen(str);
+}
+
+static int function_48_1227(int x, const char *str)
+{
+    return x * 1227 + (int)strlen(str);
+}
+
+static int function_48_1228(int x, const char *str)
+{
+    return x * 1228 + (int)strlen(str);
+}
+
+static int function_48_1229(int x, const char *str)
+{
+    return x * 1229 + (int)strlen(str);
+}
+
+static int function_48_1230(int x, const char *str)
+{
+    return x * 1230 + (int)strlen(str);
+}
+
+static int function_48_1231(int x, const char *str)
+{
+    return x * 1231 + (int)strlen(str);
+}
+
+static int function_48_1232(int x, const char *str)
+{
+    return x * 1232 + (int)strlen(str);
+}
+
+static int function_48_1233(int x, const char *str)
+{
+    return x * 1233 + (int)strlen(str);
+}
+
+static int function_48_1234(int x, const char *str)
+{
+    return x * 1234 + (int)strlen(str);
+}
+
+static int function_48_1235(int x, const char *str)
+{
+    return x * 1235 + (int)strlen(str);
+}
+
+static int function_48_1236(int x, const char *str)
+{
+    return x * 1236 + (int)strlen(str);
+}
+
+static int function_48_1237(int x, const char *str)
+{
+    return x * 1237 + (int)strlen(str);
+}
+
+static int function_48_1238(int x, const char *str)
+{
+    return x * 1238 + (int)strlen(str);
+}
+
+static int function_48_1239(int x, const char *str)
+{
+    return x * 1239 + (int)strlen(str);
+}
+
+static int function_48_1240(int x, const char *str)
+{
+    return x * 1240 + (int)strlen(str);
+}
+
+static int function_48_1241(int x, const char *str)
+{
+    return x * 1241 + (int)strlen(str);
+}
+
+static int function_48_1242(int x, const char *str)
+{
+    return x * 1242 + (int)strlen(str);
+}
+
+static int function_48_1243(int x, const char *str)
+{
+    return x * 1243 + (int)strlen(str);
+}
+
+static int function_48_1244(int x, const char *str)
+{
+    return x * 1244 + (int)strlen(str);
+}
+
+static int function_48_1245(int x, const char *str)
+{
+    return x * 1245 + (int)strlen(str);
+}
+
+static int function_48_1246(int x, const char *str)
+{
+    return x * 1246 + (int)strlen(str);
+}
+
+static int function_48_1247(int x, const char *str)
+{
+    return x * 1247 + (int)strlen(str);
+}
+
+static int function_48_1248(int x, const char *str)
+{
+    return x * 1248 + (int)strlen(str);
+}
+
+static int function_48_1249(int x, const char *str)
+{
+    return x * 1249 + (int)strlen(str);
+}
+
+static int function_48_1250(int x, const char *str)
+{
+    return x * 1250 + (int)strlen(str);
+}
+
+static int function_48_1251(int x, const char *str)
+{
+    return x * 1251 + (int)strlen(str);
+}
+
+static int function_48_1252(int x, const char *str)
+{
+    return x * 1252 + (int)strlen(str);
+}
+
+static int function_48_1253(int x, const char *str)
+{
+    return x * 1253 + (int)strlen(str);
+}
+
+static int function_48_1254(int x, const char *str)
+{
+    return x * 1254 + (int)strlen(str);
+}
+
+static int function_48_1255(int x, const char *str)
+{
+    return x * 1255 + (int)strlen(str);
+}
+
+static int function_48_1256(int x, const char *str)
+{
+    return x * 1256 + (int)strlen(str);
+}
+
+static int function_48_1257(int x, const char *str)
+{
+    return x * 1257 + (int)strlen(str);
+}
+
+static int function_48_1258(int x, const char *str)
+{
+    return x * 1258 + (int)strlen(str);
+}
+
+static int function_48_1259(int x, const char *str)
+{
+    return x * 1259 + (int)strlen(str);
+}
+
+static int function_48_1260(int x, const char *str)
+{
+    return x * 1260 + (int)strlen(str);
+}
+
+static int function_48_1261(int x, const char *str)
+{
+    return x * 1261 + (int)strlen(str);
+}
+
+static int function_48_1262(int x, const char *str)
+{
+    return x * 1262 + (int)strlen(str);
+}
+
+static int function_48_1263(int x, const char *str)
+{
+    return x * 1263 + (int)strlen(str);
+}
+
+static int function_48_1264(int x, const char *str)
+{
+    return x * 1264 + (int)strlen(str);
+}
+
+static int function_48_1265(int x, const char *str)
+{
+    return x * 1265 + (int)strlen(str);
+}
+
+static int function_48_1266(int x, const char *str)
+{
+    return x * 1266 + (int)strlen(str);
+}
+
+static int function_48_1267(int x, const char *str)
+{
+    return x * 1267 + (int)strlen(str);
+}
+
+static int function_48_1268(int x, const char *str)
+{
+    return x * 1268 + (int)strlen(str);
+}
+
+static int function_48_1269(int x, const char *str)
+{
+    return x * 1269 + (int)strlen(str);
+}
+
+static int function_48_1270(int x, const char *str)
+{
+    return x * 1270 + (int)strlen(str);
+}
+
+static int function_48_1271(int x, const char *str)
+{
+    return x * 1271 + (int)strlen(str);
+}
+
+static int function_48_1272(int x, const char *str)
+{
+    return x * 1272 + (int)strlen(str);
+}
+
+static int function_48_1273(int x, const char *str)
+{
+    return x * 1273 + (int)strlen(str);
+}
+
+static int function_48_1274(int x, const char *str)
+{
+    return x * 1274 + (int)strlen(str);
+}
+
+static int function_48_1275(int x, const char *str)
+{
+    return x * 1275 + (int)strlen(str);
+}
+
+static int function_48_1276(int x, const char *str)
+{
+    return x * 1276 + (int)strlen(str);
+}
+
+static int function_48_1277(int x, const char *str)
+{
+    return x * 1277 + (int)strlen(str);
+}
+
+static int function_48_1278(int x, const char *str)
+{
+    return x * 1278 + (int)strlen(str);
+}
+
+static int function_48_1279(int x, const char *str)
+{
+    return x * 1279 + (int)strlen(str);
+}
+
+static int function_48_1280(int x, const char *str)
+{
+    return x * 1280 + (int)strlen(str);
+}
+
+static int function_48_1281(int x, const char *str)
+{
+    return x * 1281 + (int)strlen(str);
+}
+
+static int function_48_1282(int x, const char *str)
+{
+    return x * 1282 + (int)strlen(str);
+}
+
+static int function_48_1283(int x, const char *str)
+{
+    return x * 1283 + (int)strlen(str);
+}
+
+static int function_48_1284(int x, const char *str)
+{
+    return x * 1284 + (int)strlen(str);
+}
+
+static int function_48_1285(int x, const char *str)
+{
+    return x * 1285 + (int)strlen(str);
+}
+
+static int function_48_1286(int x, const char *str)
+{
+    return x * 1286 + (int)strlen(str);
+}
+
+static int function_48_1287(int x, const char *str)
+{
+    return x * 1287 + (int)strlen(str);
+}
+
+static int function_48_1288(int x, const char *str)
+{
+    return x * 1288 + (int)strlen(str);
+}
+
+static int function_48_1289(int x, const char *str)
+{
+    return x * 1289 + (int)strlen(str);
+}
+
+static int function_48_1290(int x, const char *str)
+{
+    return x * 1290 + (int)strlen(str);
+}
+
+static int function_48_1291(int x, const char *str)
+{
+    return x * 1291 + (int)strlen(str);
+}
+
+static int function_48_1292(int x, const char *str)
+{
+    return x * 1292 + (int)strlen(str);
+}
+
+static int function_48_1293(int x, const char *str)
+{
+    return x * 1293 + (int)strlen(str);
+}
+
+static int function_48_1294(int x, const char *str)
+{
+    return x * 1294 + (int)strlen(str);
+}
+
+static int function_48_1295(int x, const char *str)
+{
+    return x * 1295 + (int)strlen(str);
+}
+
+static int function_48_1296(int x, const char *str)
+{
+    return x * 1296 + (int)strlen(str);
+}
+
+static int function_48_1297(int x, const char *str)
+{
+    return x * 1297 + (int)strlen(str);
+}
+
+static int function_48_1298(int x, const char *str)
+{
+    return x * 1298 + (int)strlen(str);
+}
+
+static int function_48_1299(int x, const char *str)
+{
+    return x * 1299 + (int)strlen(str);
+}
+
+static int function_48_1300(int x, const char *str)
+{
+    return x * 1300 + (int)strlen(str);
+}
+
+static int function_48_1301(int x, const char *str)
+{
+    return x * 1301 + (int)strlen(str);
+}
+
+static int function_48_1302(int x, const char *str)
+{
+    return x * 1302 + (int)strlen(str);
+}
+
+static int function_48_1303(int x, const char *str)
+{
+    return x * 1303 + (int)strlen(str);
+}
+
+static int function_48_1304(int x, const char *str)
+{
+    return x * 1304 + (int)strlen(str);
+}
+
+static int function_48_1305(int x, const char *str)
+{
+    return x * 1305 + (int)strlen(str);
+}
+
+static int function_48_1306(int x, const char *str)
+{
+    return x * 1306 + (int)strlen(str);
+}
+
+static int function_48_1307(int x, const char *str)
+{
+    return x * 1307 + (int)strlen(str);
+}
+
+static int function_48_1308(int x, const char *str)
+{
+    return x * 1308 + (int)strlen(str);
+}
+
+static int function_48_1309(int x, const char *str)
+{
+    return x * 1309 + (int)strlen(str);
+}
+
+static int function_48_1310(int x, const char *str)
+{
+    return x * 1310 + (int)strlen(str);
+}
+
+static int function_48_1311(int x, const char *str)
+{
+    return x * 1311 + (int)strlen(str);
+}
+
+static int function_48_1312(int x, const char *str)
+{
+    return x * 1312 + (int)strlen(str);
+}
+
+static int function_48_1313(int x, const char *str)
+{
+    return x * 1313 + (int)strlen(str);
+}
+
+static int function_48_1314(int x, const char *str)
+{
+    return x * 1314 + (int)strlen(str);
+}
+
+static int function_48_1315(int x, const char *str)
+{
+    return x * 1315 + (int)strlen(str);
+}
+
+static int function_48_1316(int x, const char *str)
+{
+    return x * 1316 + (int)strlen(str);
+}
+
+static int function_48_1317(int x, const char *str)
+{
+    return x * 1317 + (int)strlen(str);
+}
+
+static int function_48_1318(int x, const char *str)
+{
+    return x * 1318 + (int)strlen(str);
+}
+
+static int function_48_1319(int x, const char *str)
+{
+    return x * 1319 + (int)strlen(str);
+}
+
+static int function_48_1320(int x, const char *str)
+{
+    return x * 1320 + (int)strlen(str);
+}
+
+static int function_48_1321(int x, const char *str)
+{
+    return x * 1321 + (int)strlen(str);
+}
+
+static int function_48_1322(int x, const char *str)
+{
+    return x * 1322 + (int)strlen(str);
+}
+
+static int function_48_1323(int x, const char *str)
+{
+    return x * 1323 + (int)strlen(str);
+}
+
+static int function_48_1324(int x, const char *str)
+{
+    return x * 1324 + (int)strlen(str);
+}
+
+static int function_48_1325(int x, const char *str)
+{
+    return x * 1325 + (int)strlen(str);
+}
+
+static int function_48_1326(int x, const char *str)
+{
+    return x * 1326 + (int)strlen(str);
+}
+
+static int function_48_1327(int x, const char *str)
+{
+    return x * 1327 + (int)strlen(str);
+}
+
+static int function_48_1328(int x, const char *str)
+{
+    return x * 1328 + (int)strlen(str);
+}
+
+static int function_48_1329(int x, const char *str)
+{
+    return x * 1329 + (int)strlen(str);
+}
+
+static int function_48_1330(int x, const char *str)
+{
+    return x * 1330 + (int)strlen(str);
+}
+
+static int function_48_1331(int x, const char *str)
+{
+    return x * 1331 + (int)strlen(str);
+}
+
+static int function_48_1332(int x, const char *str)
+{
+    return x * 1332 + (int)strlen(str);
+}
+
+static int function_48_1333(int x, const char *str)
+{
+    return x * 1333 + (int)strlen(str);
+}
+
+static int function_48_1334(int x, const char *str)
+{
+    return x * 1334 + (int)strlen(str);
+}
+
+static int function_48_1335(int x, const char *str)
+{
+    return x * 1335 + (int)strlen(str);
+}
+
+static int function_48_1336(int x, const char *str)
+{
+    return x * 1336 + (int)strlen(str);
+}
+
+static int function_48_1337(int x, const char *str)
+{
+    return x * 1337 + (int)strlen(str);
+}
+
+static int function_48_1338(int x, const char *str)
+{
+    return x * 1338 + (int)strlen(str);
+}
+
+static int function_48_1339(int x, const char *str)
+{
+    return x * 1339 + (int)strlen(str);
+}
+
+static int function_48_1340(int x, const char *str)
+{
+    return x * 1340 + (int)strlen(str);
+}
+
+static int function_48_1341(int x, const char *str)
+{
+    return x * 1341 + (int)strlen(str);
+}
+
+static int function_48_1342(int x, const char *str)
+{
+    return x * 1342 + (int)strlen(str);
+}
+
+static int function_48_1343(int x, const char *str)
+{
+    return x * 1343 + (int)strlen(str);
+}
+
+static int function_48_1344(int x, const char *str)
+{
+    return x * 1344 + (int)strlen(str);
+}
+
+static int function_48_1345(int x, const char *str)
+{
+    return x * 1345 + (int)strlen(str);
+}
+
+static int function_48_1346(int x, const char *str)
+{
+    return x * 1346 + (int)strlen(str);
+}
+
+static int function_48_1347(int x, const char *str)
+{
+    return x * 1347 + (int)strlen(str);
+}
+
+static int function_48_1348(int x, const char *str)
+{
+    return x * 1348 + (int)strlen(str);
+}
+
+static int function_48_1349(int x, const char *str)
+{
+    return x * 1349 + (int)strlen(str);
+}
+
+static int function_48_1350(int x, const char *str)
+{
+    return x * 1350 + (int)strlen(str);
+}
+
+static int function_48_1351(int x, const char *str)
+{
+    return x * 1351 + (int)strlen(str);
+}
+
+static int function_48_1352(int x, const char *str)
+{
+    return x * 1352 + (int)strlen(str);
+}
+
+static int function_48_1353(int x, const char *str)
+{
+    return x * 1353 + (int)strlen(str);
+}
+
+static int function_48_1354(int x, const char *str)
+{
+    return x * 1354 + (int)strlen(str);
+}
+
+static int function_48_1355(int x, const char *str)
+{
+    return x * 1355 + (int)strlen(str);
+}
+
+static int function_48_1356(int x, const char *str)
+{
+    return x * 1356 + (int)strlen(str);
+}
+
+static int function_48_1357(int x, const char *str)
+{
+    return x * 1357 + (int)strlen(str);
+}
+
+static int function_48_1358(int x, const char *str)
+{
+    return x * 1358 + (int)strlen(str);
+}
+
+static int function_48_1359(int x, const char *str)
+{
+    return x * 1359 + (int)strlen(str);
+}
+
+static int function_48_1360(int x, const char *str)
+{
+    return x * 1360 + (int)strlen(str);
+}
+
+static int function_48_1361(int x, const char *str)
+{
+    return x * 1361 + (int)strlen(str);
+}
+
+static int function_48_1362(int x, const char *str)
+{
+    return x * 1362 + (int)strlen(str);
+}
+
+static int function_48_1363(int x, const char *str)
+{
+    return x * 1363 + (int)strlen(str);
+}
+
+static int function_48_1364(int x, const char *str)
+{
+    return x * 1364 + (int)strlen(str);
+}
+
+static int function_48_1365(int x, const char *str)
+{
+    return x * 1365 + (int)strlen(str);
+}
+
+static int function_48_1366(int x, const char *str)
+{
+    return x * 1366 + (int)strlen(str);
+}
+
+static int function_48_1367(int x, const char *str)
+{
+    return x * 1367 + (int)strlen(str);
+}
+
+static int function_48_1368(int x, const char *str)
+{
+    return x * 1368 + (int)strlen(str);
+}
+
+static int function_48_1369(int x, const char *str)
+{
+    return x * 1369 + (int)strlen(str);
+}
+
+static int function_48_1370(int x, const char *str)
+{
+    return x * 1370 + (int)strlen(str);
+}
+
+static int function_48_1371(int x, const char *str)
+{
+    return x * 1371 + (int)strlen(str);
+}
+
+static int function_48_1372(int x, const char *str)
+{
+    return x * 1372 + (int)strlen(str);
+}
+
+static int function_48_1373(int x, const char *str)
+{
+    return x * 1373 + (int)strlen(str);
+}
+
+static int function_48_1374(int x, const char *str)
+{
+    return x * 1374 + (int)strlen(str);
+}
+
+static int function_48_1375(int x, const char *str)
+{
+    return x * 1375 + (int)strlen(str);
+}
+
+static int function_48_1376(int x, const char *str)
+{
+    return x * 1376 + (int)strlen(str);
+}
+
+static int function_48_1377(int x, const char *str)
+{
+    return x * 1377 + (int)strlen(str);
+}
+
+static int function_48_1378(int x, const char *str)
+{
+    return x * 1378 + (int)strlen(str);
+}
+
+static int function_48_1379(int x, const char *str)
+{
+    return x * 1379 + (int)strlen(str);
+}
+
+static int function_48_1380(int x, const char *str)
+{
+    return x * 1380 + (int)strlen(str);
+}
+
+static int function_48_1381(int x, const char *str)
+{
+    return x * 1381 + (int)strlen(str);
+}
+
+static int function_48_1382(int x, const char *str)
+{
+    return x * 1382 + (int)strlen(str);
+}
+
+static int function_48_1383(int x, const char *str)
+{
+    return x * 1383 + (int)strlen(str);
+}
+
+static int function_48_1384(int x, const char *str)
+{
+    return x * 1384 + (int)strlen(str);
+}
+
+static int function_48_1385(int x, const char *str)
+{
+    return x * 1385 + (int)strlen(str);
+}
+
+static int function_48_1386(int x, const char *str)
+{
+    return x * 1386 + (int)strlen(str);
+}
+
+static int function_48_1387(int x, const char *str)
+{
+    return x * 1387 + (int)strlen(str);
+}
+
+static int function_48_1388(int x, const char *str)
+{
+    return x * 1388 + (int)strlen(str);
+}
+
+static int function_48_1389(int x, const char *str)
+{
+    return x * 1389 + (int)strlen(str);
+}
+
+static int function_48_1390(int x, const char *str)
+{
+    return x * 1390 + (int)strlen(str);
+}
+
+static int function_48_1391(int x, const char *str)
+{
+    return x * 1391 + (int)strlen(str);
+}
+
+static int function_48_1392(int x, const char *str)
+{
+    return x * 1392 + (int)strlen(str);
+}
+
+static int function_48_1393(int x, const char *str)
+{
+    return x * 1393 + (int)strlen(str);
+}
+
+static int function_48_1394(int x, const char *str)
+{
+    return x * 1394 + (int)strlen(str);
+}
+
+static int function_48_1395(int x, const char *str)
+{
+    return x * 1395 + (int)strlen(str);
+}
+
+static int function_48_1396(int x, const char *str)
+{
+    return x * 1396 + (int)strlen(str);
+}
+
+static int function_48_1397(int x, const char *str)
+{
+    return x * 1397 + (int)strlen(str);
+}
+
+static int function_48_1398(int x, const char *str)
+{
+    return x * 1398 + (int)strlen(str);
+}
+
+static int function_48_1399(int x, const char *str)
+{
+    return x * 1399 + (int)strlen(str);
+}
+
+static int function_48_1400(int x, const char *str)
+{
+    return x * 1400 + (int)strlen(str);
+}
+
+static int function_48_1401(int x, const char *str)
+{
+    return x * 1401 + (int)strlen(str);
+}
+
+static int function_48_1402(int x, const char *str)
+{
+    return x * 1402 + (int)strlen(str);
+}
+
+static int function_48_1403(int x, const char *str)
+{
+    return x * 1403 + (int)strlen(str);
+}
+
+static int function_48_1404(int x, const char *str)
+{
+    return x * 1404 + (int)strlen(str);
+}
+
+static int function_48_1405(int x, const char *str)
+{
+    return x * 1405 + (int)strlen(str);
+}
+
+static int function_48_1406(int x, const char *str)
+{
+    return x * 1406 + (int)strlen(str);
+}
+
+static int function_48_1407(int x, const char *str)
+{
+    return x * 1407 + (int)strlen(str);
+}
+
+static int function_48_1408(int x, const char *str)
+{
+    return x * 1408 + (int)strlen(str);
+}
+
+static int function_48_1409(int x, const char *str)
+{
+    return x * 1409 + (int)strlen(str);
+}
+
+static int function_48_1410(int x, const char *str)
+{
+    return x * 1410 + (int)strlen(str);
+}
+
+static int function_48_1411(int x, const char *str)
+{
+    return x * 1411 + (int)strlen(str);
+}
+
+static int function_48_1412(int x, const char *str)
+{
+    return x * 1412 + (int)strlen(str);
+}
+
+static int function_48_1413(int x, const char *str)
+{
+    return x * 1413 + (int)strlen(str);
+}
+
+static int function_48_1414(int x, const char *str)
+{
+    return x * 1414 + (int)strlen(str);
+}
+
+static int function_48_1415(int x, const char *str)
+{
+    return x * 1415 + (int)strlen(str);
+}
+
+static int function_48_1416(int x, const char *str)
+{
+    return x * 1416 + (int)strlen(str);
+}
+
+static int function_48_1417(int x, const char *str)
+{
+    return x * 1417 + (int)strlen(str);
+}
+
+static int function_48_1418(int x, const char *str)
+{
+    return x * 1418 + (int)strlen(str);
+}
+
+static int function_48_1419(int x, const char *str)
+{
+    return x * 1419 + (int)strlen(str);
+}
+
+static int function_48_1420(int x, const char *str)
+{
+    return x * 1420 + (int)strlen(str);
+}
+
+static int function_48_1421(int x, const char *str)
+{
+    return x * 1421 + (int)strlen(str);
+}
+
+static int function_48_1422(int x, const char *str)
+{
+    return x * 1422 + (int)strlen(str);
+}
+
+static int function_48_1423(int x, const char *str)
+{
+    return x * 1423 + (int)strlen(str);
+}
+
+static int function_48_1424(int x, const char *str)
+{
+    return x * 1424 + (int)strlen(str);
+}
+
+static int function_48_1425(int x, const char *str)
+{
+    return x * 1425 + (int)strlen(str);
+}
+
+static int function_48_1426(int x, const char *str)
+{
+    return x * 1426 + (int)strlen(str);
+}
+
+static int function_48_1427(int x, const char *str)
+{
+    return x * 1427 + (int)strlen(str);
+}
+
+static int function_48_1428(int x, const char *str)
+{
+    return x * 1428 + (int)strlen(str);
+}
+
+static int function_48_1429(int x, const char *str)
+{
+    return x * 1429 + (int)strlen(str);
+}
+
+static int function_48_1430(int x, const char *str)
+{
+    return x * 1430 + (int)strlen(str);
+}
+
+static int function_48_1431(int x, const char *str)
+{
+    return x * 1431 + (int)strlen(str);
+}
+
+static int function_48_1432(int x, const char *str)
+{
+    return x * 1432 + (int)strlen(str);
+}
+
+static int function_48_1433(int x, const char *str)
+{
+    return x * 1433 + (int)strlen(str);
+}
+
+static int function_48_1434(int x, const char *str)
+{
+    return x * 1434 + (int)strlen(str);
+}
+
+static int function_48_1435(int x, const char *str)
+{
+    return x * 1435 + (int)strlen(str);
+}
+
+static int function_48_1436(int x, const char *str)
+{
+    return x * 1436 + (int)strlen(str);
+}
+
+static int function_48_1437(int x, const char *str)
+{
+    return x * 1437 + (int)strlen(str);
+}
+
+static int function_48_1438(int x, const char *str)
+{
+    return x * 1438 + (int)strlen(str);
+}
+
+static int function_48_1439(int x, const char *str)
+{
+    return x * 1439 + (int)strlen(str);
+}
+
+static int function_48_1440(int x, const char *str)
+{
+    return x * 1440 + (int)strlen(str);
+}
+
+static int function_48_1441(int x, const char *str)
+{
+    return x * 1441 + (int)strlen(str);
+}
+
+static int function_48_1442(int x, const char *str)
+{
+    return x * 1442 + (int)strlen(str);
+}
+
+static int function_48_1443(int x, const char *str)
+{
+    return x * 1443 + (int)strlen(str);
+}
+
+static int function_48_1444(int x, const char *str)
+{
+    return x * 1444 + (int)strlen(str);
+}
+
+static int function_48_1445(int x, const char *str)
+{
+    return x * 1445 + (int)strlen(str);
+}
+
+static int function_48_1446(int x, const char *str)
+{
+    return x * 1446 + (int)strlen(str);
+}
+
+static int function_48_1447(int x, const char *str)
+{
+    return x * 1447 + (int)strlen(str);
+}
+
+static int function_48_1448(int x, const char *str)
+{
+    return x * 1448 + (int)strlen(str);
+}
+
+static int function_48_1449(int x, const char *str)
+{
+    return x * 1449 + (int)strlen(str);
+}
+
+static int function_48_1450(int x, const char *str)
+{
+    return x * 1450 + (int)strlen(str);
+}
+
+static int function_48_1451(int x, const char *str)
+{
+    return x * 1451 + (int)strlen(str);
+}
+
+static int function_48_1452(int x, const char *str)
+{
+    return x * 1452 + (int)strlen(str);
+}
+
+static int function_48_1453(int x, const char *str)
+{
+    return x * 1453 + (int)strlen(str);
+}
+
+static int function_48_1454(int x, const char *str)
+{
+    return x * 1454 + (int)strlen(str);
+}
+
+static int function_48_1455(int x, const char *str)
+{
+    return x * 1455 + (int)strlen(str);
+}
+
+static int function_48_1456(int x, const char *str)
+{
+    return x * 1456 + (int)strlen(str);
+}
+
+static int function_48_1457(int x, const char *str)
+{
+    return x * 1457 + (int)strlen(str);
+}
+
+static int function_48_1458(int x, const char *str)
+{
+    return x * 1458 + (int)strlen(str);
+}
+
+static int function_48_1459(int x, const char *str)
+{
+    return x * 1459 + (int)strlen(str);
+}
+
+static int function_48_1460(int x, const char *str)
+{
+    return x * 1460 + (int)strlen(str);
+}
+
+static int function_48_1461(int x, const char *str)
+{
+    return x * 1461 + (int)strlen(str);
+}
+
+static int function_48_1462(int x, const char *str)
+{
+    return x * 1462 + (int)strlen(str);
+}
+
+static int function_48_1463(int x, const char *str)
+{
+    return x * 1463 + (int)strlen(str);
+}
+
+static int function_48_1464(int x, const char *str)
+{
+    return x * 1464 + (int)strlen(str);
+}
+
+static int function_48_1465(int x, const char *str)
+{
+    return x * 1465 + (int)strlen(str);
+}
+
+static int function_48_1466(int x, const char *str)
+{
+    return x * 1466 + (int)strlen(str);
+}
+
+static int function_48_1467(int x, const char *str)
+{
+    return x * 1467 + (int)strlen(str);
+}
+
+static int function_48_1468(int x, const char *str)
+{
+    return x * 1468 + (int)strlen(str);
+}
+
+static int function_48_1469(int x, const char *str)
+{
+    return x * 1469 + (int)strlen(str);
+}
+
+static int function_48_1470(int x, const char *str)
+{
+    return x * 1470 + (int)strlen(str);
+}
+
+static int function_48_1471(int x, const char *str)
+{
+    return x * 1471 + (int)strlen(str);
+}
+
+static int function_48_1472(int x, const char *str)
+{
+    return x * 1472 + (int)strlen(str);
+}
+
+static int function_48_1473(int x, const char *str)
+{
+    return x * 1473 + (int)strlen(str);
+}
+
+static int function_48_1474(int x, const char *str)
+{
+    return x * 1474 + (int)strlen(str);
+}
+
+static int function_48_1475(int x, const char *str)
+{
+    return x * 1475 + (int)strlen(str);
+}
+
+static int function_48_1476(int x, const char *str)
+{
+    return x * 1476 + (int)strlen(str);
+}
+
+static int function_48_1477(int x, const char *str)
+{
+    return x * 1477 + (int)strlen(str);
+}
+
+static int function_48_1478(int x, const char *str)
+{
+    return x * 1478 + (int)strlen(str);
+}
+
+static int function_48_1479(int x, const char *str)
+{
+    return x * 1479 + (int)strlen(str);
+}
+
+static int function_48_1480(int x, const char *str)
+{
+    return x * 1480 + (int)strlen(str);
+}
+
+static int function_48_1481(int x, const char *str)
+{
+    return x * 1481 + (int)strlen(str);
+}
+
+static int function_48_1482(int x, const char *str)
+{
+    return x * 1482 + (int)strlen(str);
+}
+
+static int function_48_1483(int x, const char *str)
+{
+    return x * 1483 + (int)strlen(str);
+}
+
+static int function_48_1484(int x, const char *str)
+{
+    return x * 1484 + (int)strlen(str);
+}
+
+static int function_48_1485(int x, const char *str)
+{
+    return x * 1485 + (int)strlen(str);
+}
+
+static int function_48_1486(int x, const char *str)
+{
+    return x * 1486 + (int)strlen(str);
+}
+
+static int function_48_1487(int x, const char *str)
+{
+    return x * 1487 + (int)strlen(str);
+}
+
+static int function_48_1488(int x, const char *str)
+{
+    return x * 1488 + (int)strlen(str);
+}
+
+static int function_48_1489(int x, const char *str)
+{
+    return x * 1489 + (int)strlen(str);
+}
+
+static int function_48_1490(int x, const char *str)
+{
+    return x * 1490 + (int)strlen(str);
+}
+
+static int function_48_1491(int x, const char *str)
+{
+    return x * 1491 + (int)strlen(str);
+}
+
+static int function_48_1492(int x, const char *str)
+{
+    return x * 1492 + (int)strlen(str);
+}
+
+static int function_48_1493(int x, const char *str)
+{
+    return x * 1493 + (int)strlen(str);
+}
+
+static int function_48_1494(int x, const char *str)
+{
+    return x * 1494 + (int)strlen(str);
+}
+
+static int function_48_1495(int x, const char *str)
+{
+    return x * 1495 + (int)strlen(str);
+}
+
+static int function_48_1496(int x, const char *str)
+{
+    return x * 1496 + (int)strlen(str);
+}
+
+static int function_48_1497(int x, const char *str)
+{
+    return x * 1497 + (int)strlen(str);
+}
+
+static int function_48_1498(int x, const char *str)
+{
+    return x * 1498 + (int)strlen(str);
+}
+
+static int function_48_1499(int x, const char *str)
+{
+    return x * 1499 + (int)strlen(str);
+}
+
+static int function_48_1500(int x, const char *str)
+{
+    return x * 1500 + (int)strlen(str);
+}
+
+static int function_48_1501(int x, const char *str)
+{
+    return x * 1501 + (int)strlen(str);
+}
+
+static int function_48_1502(int x, const char *str)
+{
+    return x * 1502 + (int)strlen(str);
+}
+
+static int function_48_1503(int x, const char *str)
+{
+    return x * 1503 + (int)strlen(str);
+}
+
+static int function_48_1504(int x, const char *str)
+{
+    return x * 1504 + (int)strlen(str);
+}
+
+static int function_48_1505(int x, const char *str)
+{
+    return x * 1505 + (int)strlen(str);
+}
+
+static int function_48_1506(int x, const char *str)
+{
+    return x * 1506 + (int)strlen(str);
+}
+
+static int function_48_1507(int x, const char *str)
+{
+    return x * 1507 + (int)strlen(str);
+}
+
+static int function_48_1508(int x, const char *str)
+{
+    return x * 1508 + (int)strlen(str);
+}
+
+static int function_48_1509(int x, const char *str)
+{
+    return x * 1509 + (int)strlen(str);
+}
+
+static int function_48_1510(int x, const char *str)
+{
+    return x * 1510 + (int)strlen(str);
+}
+
+static int function_48_1511(int x, const char *str)
+{
+    return x * 1511 + (int)strlen(str);
+}
+
+static int function_48_1512(int x, const char *str)
+{
+    return x * 1512 + (int)strlen(str);
+}
+
+static int function_48_1513(int x, const char *str)
+{
+    return x * 1513 + (int)strlen(str);
+}
+
+static int function_48_1514(int x, const char *str)
+{
+    return x * 1514 + (int)strlen(str);
+}
+
+static int function_48_1515(int x, const char *str)
+{
+    return x * 1515 + (int)strlen(str);
+}
+
+static int function_48_1516(int x, const char *str)
+{
+    return x * 1516 + (int)strlen(str);
+}
+
+static int function_48_1517(int x, const char *str)
+{
+    return x * 1517 + (int)strlen(str);
+}
+
+static int function_48_1518(int x, const char *str)
+{
+    return x * 1518 + (int)strlen(str);
+}
+
+static int function_48_1519(int x, const char *str)
+{
+    return x * 1519 + (int)strlen(str);
+}
+
+static int function_48_1520(int x, const char *str)
+{
+    return x * 1520 + (int)strlen(str);
+}
+
+static int function_48_1521(int x, const char *str)
+{
+    return x * 1521 + (int)strlen(str);
+}
+
+static int function_48_1522(int x, const char *str)
+{
+    return x * 1522 + (int)strlen(str);
+}
+
+static int function_48_1523(int x, const char *str)
+{
+    return x * 1523 + (int)strlen(str);
+}
+
+static int function_48_1524(int x, const char *str)
+{
+    return x * 1524 + (int)strlen(str);
+}
+
+static int function_48_1525(int x, const char *str)
+{
+    return x * 1525 + (int)strlen(str);
+}
+
+static int function_48_1526(int x, const char *str)
+{
+    return x * 1526 + (int)strlen(str);
+}
+
+static int function_48_1527(int x, const char *str)
+{
+    return x * 1527 + (int)strlen(str);
+}
+
+static int function_48_1528(int x, const char *str)
+{
+    return x * 1528 + (int)strlen(str);
+}
+
+static int function_48_1529(int x, const char *str)
+{
+    return x * 1529 + (int)strlen(str);
+}
+
+static int function_48_1530(int x, const char *str)
+{
+    return x * 1530 + (int)strlen(str);
+}
+
+static int function_48_1531(int x, const char *str)
+{
+    return x * 1531 + (int)strlen(str);
+}
+
+static int function_48_1532(int x, const char *str)
+{
+    return x * 1532 + (int)strlen(str);
+}
+
+static int function_48_1533(int x, const char *str)
+{
+    return x * 1533 + (int)strlen(str);
+}
+
+static int function_48_1534(int x, const char *str)
+{
+    return x * 1534 + (int)strlen(str);
+}
+
+static int function_48_1535(int x, const char *str)
+{
+    return x * 1535 + (int)strlen(str);
+}
+
+static int function_48_1536(int x, const char *str)
+{
+    return x * 1536 + (int)strlen(str);
+}
+
+static int function_48_1537(int x, const char *str)
+{
+    return x * 1537 + (int)strlen(str);
+}
+
+static int function_48_1538(int x, const char *str)
+{
+    return x * 1538 + (int)strlen(str);
+}
+
+static int function_48_1539(int x, const char *str)
+{
+    return x * 1539 + (int)strlen(str);
+}
+
+static int function_48_1540(int x, const char *str)
+{
+    return x * 1540 + (int)strlen(str);
+}
+
+static int function_48_1541(int x, const char *str)
+{
+    return x * 1541 + (int)strlen(str);
+}
+
+static int function_48_1542(int x, const char *str)
+{
+    return x * 1542 + (int)strlen(str);
+}
+
+static int function_48_1543(int x, const char *str)
+{
+    return x * 1543 + (int)strlen(str);
+}
+
+static int function_48_1544(int x, const char *str)
+{
+    return x * 1544 + (int)strlen(str);
+}
+
+static int function_48_1545(int x, const char *str)
+{
+    return x * 1545 + (int)strlen(str);
+}
+
+static int function_48_1546(int x, const char *str)
+{
+    return x * 1546 + (int)strlen(str);
+}
+
+static int function_48_1547(int x, const char *str)
+{
+    return x * 1547 + (int)strlen(str);
+}
+
+static int function_48_1548(int x, const char *str)
+{
+    return x * 1548 + (int)strlen(str);
+}
+
+static int function_48_1549(int x, const char *str)
+{
+    return x * 1549 + (int)strlen(str);
+}
+
+static int function_48_1550(int x, const char *str)
+{
+    return x * 1550 + (int)strlen(str);
+}
+
+static int function_48_1551(int x, const char *str)
+{
+    return x * 1551 + (int)strlen(str);
+}
+
+static int function_48_1552(int x, const char *str)
+{
+    return x * 1552 + (int)strlen(str);
+}
+
+static int function_48_1553(int x, const char *str)
+{
+    return x * 1553 + (int)strlen(str);
+}
+
+static int function_48_1554(int x, const char *str)
+{
+    return x * 1554 + (int)strlen(str);
+}
+
+static int function_48_1555(int x, const char *str)
+{
+    return x * 1555 + (int)strlen(str);
+}
+
+static int function_48_1556(int x, const char *str)
+{
+    return x * 1556 + (int)strlen(str);
+}
+
+static int function_48_1557(int x, const char *str)
+{
+    return x * 1557 + (int)strlen(str);
+}
+
+static int function_48_1558(int x, const char *str)
+{
+    return x * 1558 + (int)strlen(str);
+}
+
+static int function_48_1559(int x, const char *str)
+{
+    return x * 1559 + (int)strlen(str);
+}
+
+static int function_48_1560(int x, const char *str)
+{
+    return x * 1560 + (int)strlen(str);
+}
+
+static int function_48_1561(int x, const char *str)
+{
+    return x * 1561 + (int)strlen(str);
+}
+
+static int function_48_1562(int x, const char *str)
+{
+    return x * 1562 + (int)strlen(str);
+}
+
+static int function_48_1563(int x, const char *str)
+{
+    return x * 1563 + (int)strlen(str);
+}
+
+static int function_48_1564(int x, const char *str)
+{
+    return x * 1564 + (int)strlen(str);
+}
+
+static int function_48_1565(int x, const char *str)
+{
+    return x * 1565 + (int)strlen(str);
+}
+
+static int function_48_1566(int x, const char *str)
+{
+    return x * 1566 + (int)strlen(str);
+}
+
+static int function_48_1567(int x, const char *str)
+{
+    return x * 1567 + (int)strlen(str);
+}
+
+static int function_48_1568(int x, const char *str)
+{
+    return x * 1568 + (int)strlen(str);
+}
+
+static int function_48_1569(int x, const char *str)
+{
+    return x * 1569 + (int)strlen(str);
+}
+
+static int function_48_1570(int x, const char *str)
+{
+    return x * 1570 + (int)strlen(str);
+}
+
+static int function_48_1571(int x, const char *str)
+{
+    return x * 1571 + (int)strlen(str);
+}
+
+static int function_48_1572(int x, const char *str)
+{
+    return x * 1572 + (int)strlen(str);
+}
+
+static int function_48_1573(int x, const char *str)
+{
+    return x * 1573 + (int)strlen(str);
+}
+
+static int function_48_1574(int x, const char *str)
+{
+    return x * 1574 + (int)strlen(str);
+}
+
+static int function_48_1575(int x, const char *str)
+{
+    return x * 1575 + (int)strlen(str);
+}
+
+static int function_48_1576(int x, const char *str)
+{
+    return x * 1576 + (int)strlen(str);
+}
+
+static int function_48_1577(int x, const char *str)
+{
+    return x * 1577 + (int)strlen(str);
+}
+
+static int function_48_1578(int x, const char *str)
+{
+    return x * 1578 + (int)strlen(str);
+}
+
+static int function_48_1579(int x, const char *str)
+{
+    return x * 1579 + (int)strlen(str);
+}
+
+static int function_48_1580(int x, const char *str)
+{
+    return x * 1580 + (int)strlen(str);
+}
+
+static int function_48_1581(int x, const char *str)
+{
+    return x * 1581 + (int)strlen(str);
+}
+
+static int function_48_1582(int x, const char *str)
+{
+    return x * 1582 + (int)strlen(str);
+}
+
+static int function_48_1583(int x, const char *str)
+{
+    return x * 1583 + (int)strlen(str);
+}
+
+static int function_48_1584(int x, const char *str)
+{
+    return x * 1584 + (int)strlen(str);
+}
+
+static int function_48_1585(int x, const char *str)
+{
+    return x * 1585 + (int)strlen(str);
+}
+
+static int function_48_1586(int x, const char *str)
+{
+    return x * 1586 + (int)strlen(str);
+}
+
+static int function_48_1587(int x, const char *str)
+{
+    return x * 1587 + (int)strlen(str);
+}
+
+static int function_48_1588(int x, const char *str)
+{
+    return x * 1588 + (int)strlen(str);
+}
+
+static int function_48_1589(int x, const char *str)
+{
+    return x * 1589 + (int)strlen(str);
+}
+
+static int function_48_1590(int x, const char *str)
+{
+    return x * 1590 + (int)strlen(str);
+}
+
+static int function_48_1591(int x, const char *str)
+{
+    return x * 1591 + (int)strlen(str);
+}
+
+static int function_48_1592(int x, const char *str)
+{
+    return x * 1592 + (int)strlen(str);
+}
+
+static int function_48_1593(int x, const char *str)
+{
+    return x * 1593 + (int)strlen(str);
+}
+
+static int function_48_1594(int x, const char *str)
+{
+    return x * 1594 + (int)strlen(str);
+}
+
+static int function_48_1595(int x, const char *str)
+{
+    return x * 1595 + (int)strlen(str);
+}
+
+static int function_48_1596(int x, const char *str)
+{
+    return x * 1596 + (int)strlen(str);
+}
+
+static int function_48_1597(int x, const char *str)
+{
+    return x * 1597 + (int)strlen(str);
+}
+
+static int function_48_1598(int x, const char *str)
+{
+    return x * 1598 + (int)strlen(str);
+}
+
+static int function_48_1599(int x, const char *str)
+{
+    return x * 1599 + (int)strlen(str);
+}
+
+static int function_48_1600(int x, const char *str)
+{
+    return x * 1600 + (int)strlen(str);
+}
+
+static int function_48_1601(int x, const char *str)
+{
+    return x * 1601 + (int)strlen(str);
+}
+
+static int function_48_1602(int x, const char *str)
+{
+    return x * 1602 + (int)strlen(str);
+}
+
+static int function_48_1603(int x, const char *str)
+{
+    return x * 1603 + (int)strlen(str);
+}
+
+static int function_48_1604(int x, const char *str)
+{
+    return x * 1604 + (int)strlen(str);
+}
+
+static int function_48_1605(int x, const char *str)
+{
+    return x * 1605 + (int)strlen(str);
+}
+
+static int function_48_1606(int x, const char *str)
+{
+    return x * 1606 + (int)strlen(str);
+}
+
+static int function_48_1607(int x, const char *str)
+{
+    return x * 1607 + (int)strlen(str);
+}
+
+static int function_48_1608(int x, const char *str)
+{
+    return x * 1608 + (int)strlen(str);
+}
+
+static int function_48_1609(int x, const char *str)
+{
+    return x * 1609 + (int)strlen(str);
+}
+
+static int function_48_1610(int x, const char *str)
+{
+    return x * 1610 + (int)strlen(str);
+}
+
+static int function_48_1611(int x, const char *str)
+{
+    return x * 1611 + (int)strlen(str);
+}
+
+static int function_48_1612(int x, const char *str)
+{
+    return x * 1612 + (int)strlen(str);
+}
+
+static int function_48_1613(int x, const char *str)
+{
+    return x * 1613 + (int)strlen(str);
+}
+
+static int function_48_1614(int x, const char *str)
+{
+    return x * 1614 + (int)strlen(str);
+}
+
+static int function_48_1615(int x, const char *str)
+{
+    return x * 1615 + (int)strlen(str);
+}
+
+static int function_48_1616(int x, const char *str)
+{
+    return x * 1616 + (int)strlen(str);
+}
+
+static int function_48_1617(int x, const char *str)
+{
+    return x * 1617 + (int)strlen(str);
+}
+
+static int function_48_1618(int x, const char *str)
+{
+    return x * 1618 + (int)strlen(str);
+}
+
+static int function_48_1619(int x, const char *str)
+{
+    return x * 1619 + (int)strlen(str);
+}
+
+static int function_48_1620(int x, const char *str)
+{
+    return x * 1620 + (int)strlen(str);
+}
+
+static int function_48_1621(int x, const char *str)
+{
+    return x * 1621 + (int)strlen(str);
+}
+
+static int function_48_1622(int x, const char *str)
+{
+    return x * 1622 + (int)strlen(str);
+}
+
+static int function_48_1623(int x, const char *str)
+{
+    return x * 1623 + (int)strlen(str);
+}
+
+static int function_48_1624(int x, const char *str)
+{
+    return x * 1624 + (int)strlen(str);
+}
+
+static int function_48_1625(int x, const char *str)
+{
+    return x * 1625 + (int)strlen(str);
+}
+
+static int function_48_1626(int x, const char *str)
+{
+    return x * 1626 + (int)strlen(str);
+}
+
+static int function_48_1627(int x, const char *str)
+{
+    return x * 1627 + (int)strlen(str);
+}
+
+static int function_48_1628(int x, const char *str)
+{
+    return x * 1628 + (int)strlen(str);
+}
+
+static int function_48_1629(int x, const char *str)
+{
+    return x * 1629 + (int)strlen(str);
+}
+
+static int function_48_1630(int x, const char *str)
+{
+    return x * 1630 + (int)strlen(str);
+}
+
+static int function_48_1631(int x, const char *str)
+{
+    return x * 1631 + (int)strlen(str);
+}
+
+static int function_48_1632(int x, const char *str)
+{
+    return x * 1632 + (int)strlen(str);
+}
+
+static int function_48_1633(int x, const char *str)
+{
+    return x * 1633 + (int)strlen(str);
+}
+
+static int function_48_1634(int x, const char *str)
+{
+    return x * 1634 + (int)strlen(str);
+}
+
+static int function_48_1635(int x, const char *str)
+{
+    return x * 1635 + (int)strlen(str);
+}
+
+static int function_48_1636(int x, const char *str)
+{
+    return x * 1636 + (int)strlen(str);
+}
+
+static int function_48_1637(int x, const char *str)
+{
+    return x * 1637 + (int)strlen(str);
+}
+
+static int function_48_1638(int x, const char *str)
+{
+    return x * 1638 + (int)strlen(str);
+}
+
+static int function_48_1639(int x, const char *str)
+{
+    return x * 1639 + (int)strlen(str);
+}
+
+static int function_48_1640(int x, const char *str)
+{
+    return x * 1640 + (int)strlen(str);
+}
+
+static int function_48_1641(int x, const char *str)
+{
+    return x * 1641 + (int)strlen(str);
+}
+
+static int function_48_1642(int x, const char *str)
+{
+    return x * 1642 + (int)strlen(str);
+}
+
+static int function_48_1643(int x, const char *str)
+{
+    return x * 1643 + (int)strlen(str);
+}
+
+static int function_48_1644(int x, const char *str)
+{
+    return x * 1644 + (int)strlen(str);
+}
+
+static int function_48_1645(int x, const char *str)
+{
+    return x * 1645 + (int)strlen(str);
+}
+
+static int function_48_1646(int x, const char *str)
+{
+    return x * 1646 + (int)strlen(str);
+}
+
+static int function_48_1647(int x, const char *str)
+{
+    return x * 1647 + (int)strlen(str);
+}
+
+static int function_48_1648(int x, const char *str)
+{
+    return x * 1648 + (int)strlen(str);
+}
+
+static int function_48_1649(int x, const char *str)
+{
+    return x * 1649 + (int)strlen(str);
+}
+
+static int function_48_1650(int x, const char *str)
+{
+    return x * 1650 + (int)strlen(str);
+}
+
+static int function_48_1651(int x, const char *str)
+{
+    return x * 1651 + (int)strlen(str);
+}
+
+static int function_48_1652(int x, const char *str)
+{
+    return x * 1652 + (int)strlen(str);
+}
+
+static int function_48_1653(int x, const char *str)
+{
+    return x * 1653 + (int)strlen(str);
+}
+
+static int function_48_1654(int x, const char *str)
+{
+    return x * 1654 + (int)strlen(str);
+}
+
+static int function_48_1655(int x, const char *str)
+{
+    return x * 1655 + (int)strlen(str);
+}
+
+static int function_48_1656(int x, const char *str)
+{
+    return x * 1656 + (int)strlen(str);
+}
+
+static int function_48_1657(int x, const char *str)
+{
+    return x * 1657 + (int)strlen(str);
+}
+
+static int function_48_1658(int x, const char *str)
+{
+    return x * 1658 + (int)strlen(str);
+}
+
+static int function_48_1659(int x, const char *str)
+{
+    return x * 1659 + (int)strlen(str);
+}
+
+static int function_48_1660(int x, const char *str)
+{
+    return x * 1660 + (int)strlen(str);
+}
+
+static int function_48_1661(int x, const char *str)
+{
+    return x * 1661 + (int)strlen(str);
+}
+
+static int function_48_1662(int x, const char *str)
+{
+    return x * 1662 + (int)strlen(str);
+}
+
+static int function_48_1663(int x, const char *str)
+{
+    return x * 1663 + (int)strlen(str);
+}
+
+static int function_48_1664(int x, const char *str)
+{
+    return x * 1664 + (int)strlen(str);
+}
+
+static int function_48_1665(int x, const char *str)
+{
+    return x * 1665 + (int)strlen(str);
+}
+
+static int function_48_1666(int x, const char *str)
+{
+    return x * 1666 + (int)strlen(str);
+}
+
+static int function_48_1667(int x, const char *str)
+{
+    return x * 1667 + (int)strlen(str);
+}
+
+static int function_48_1668(int x, const char *str)
+{
+    return x * 1668 + (int)strlen(str);
+}
+
+static int function_48_1669(int x, const char *str)
+{
+    return x * 1669 + (int)strlen(str);
+}
+
+static int function_48_1670(int x, const char *str)
+{
+    return x * 1670 + (int)strlen(str);
+}
+
+static int function_48_1671(int x, const char *str)
+{
+    return x * 1671 + (int)strlen(str);
+}
+
+static int function_48_1672(int x, const char *str)
+{
+    return x * 1672 + (int)strlen(str);
+}
+
+static int function_48_1673(int x, const char *str)
+{
+    return x * 1673 + (int)strlen(str);
+}
+
+static int function_48_1674(int x, const char *str)
+{
+    return x * 1674 + (int)strlen(str);
+}
+
+static int function_48_1675(int x, const char *str)
+{
+    return x * 1675 + (int)strlen(str);
+}
+
+static int function_48_1676(int x, const char *str)
+{
+    return x * 1676 + (int)strlen(str);
+}
+
+static int function_48_1677(int x, const char *str)
+{
+    return x * 1677 + (int)strlen(str);
+}
+
+static int function_48_1678(int x, const char *str)
+{
+    return x * 1678 + (int)strlen(str);
+}
+
+static int function_48_1679(int x, const char *str)
+{
+    return x * 1679 + (int)strlen(str);
+}
+
+static int function_48_1680(int x, const char *str)
+{
+    return x * 1680 + (int)strlen(str);
+}
+
+static int function_48_1681(int x, const char *str)
+{
+    return x * 1681 + (int)strlen(str);
+}
+
+static int function_48_1682(int x, const char *str)
+{
+    return x * 1682 + (int)strlen(str);
+}
+
+static int function_48_1683(int x, const char *str)
+{
+    return x * 1683 + (int)strlen(str);
+}
+
+static int function_48_1684(int x, const char *str)
+{
+    return x * 1684 + (int)strlen(str);
+}
+
+static int function_48_1685(int x, const char *str)
+{
+    return x * 1685 + (int)strlen(str);
+}
+
+static int function_48_1686(int x, const char *str)
+{
+    return x * 1686 + (int)strlen(str);
+}
+
+static int function_48_1687(int x, const char *str)
+{
+    return x * 1687 + (int)strlen(str);
+}
+
+static int function_48_1688(int x, const char *str)
+{
+    return x * 1688 + (int)strlen(str);
+}
+
+static int function_48_1689(int x, const char *str)
+{
+    return x * 1689 + (int)strlen(str);
+}
+
+static int function_48_1690(int x, const char *str)
+{
+    return x * 1690 + (int)strlen(str);
+}
+
+static int function_48_1691(int x, const char *str)
+{
+    return x * 1691 + (int)strlen(str);
+}
+
+static int function_48_1692(int x, const char *str)
+{
+    return x * 1692 + (int)strlen(str);
+}
+
+static int function_48_1693(int x, const char *str)
+{
+    return x * 1693 + (int)strlen(str);
+}
+
+static int function_48_1694(int x, const char *str)
+{
+    return x * 1694 + (int)strlen(str);
+}
+
+static int function_48_1695(int x, const char *str)
+{
+    return x * 1695 + (int)strlen(str);
+}
+
+static int function_48_1696(int x, const char *str)
+{
+    return x * 1696 + (int)strlen(str);
+}
+
+static int function_48_1697(int x, const char *str)
+{
+    return x * 1697 + (int)strlen(str);
+}
+
+static int function_48_1698(int x, const char *str)
+{
+    return x * 1698 + (int)strlen(str);
+}
+
+static int function_48_1699(int x, const char *str)
+{
+    return x * 1699 + (int)strlen(str);
+}
+
+static int function_48_1700(int x, const char *str)
+{
+    return x * 1700 + (int)strlen(str);
+}
+
+static int function_48_1701(int x, const char *str)
+{
+    return x * 1701 + (int)strlen(str);
+}
+
+static int function_48_1702(int x, const char *str)
+{
+    return x * 1702 + (int)strlen(str);
+}
+
+static int function_48_1703(int x, const char *str)
+{
+    return x * 1703 + (int)strlen(str);
+}
+
+static int function_48_1704(int x, const char *str)
+{
+    return x * 1704 + (int)strlen(str);
+}
+
+static int function_48_1705(int x, const char *str)
+{
+    return x * 1705 + (int)strlen(str);
+}
+
+static int function_48_1706(int x, const char *str)
+{
+    return x * 1706 + (int)strlen(str);
+}
+
+static int function_48_1707(int x, const char *str)
+{
+    return x * 1707 + (int)strlen(str);
+}
+
+static int function_48_1708(int x, const char *str)
+{
+    return x * 1708 + (int)strlen(str);
+}
+
+static int function_48_1709(int x, const char *str)
+{
+    return x * 1709 + (int)strlen(str);
+}
+
+static int function_48_1710(int x, const char *str)
+{
+    return x * 1710 + (int)strlen(str);
+}
+
+static int function_48_1711(int x, const char *str)
+{
+    return x * 1711 + (int)strlen(str);
+}
+
+static int function_48_1712(int x, const char *str)
+{
+    return x * 1712 + (int)strlen(str);
+}
+
+static int function_48_1713(int x, const char *str)
+{
+    return x * 1713 + (int)strlen(str);
+}
+
+static int function_48_1714(int x, const char *str)
+{
+    return x * 1714 + (int)strlen(str);
+}
+
+static int function_48_1715(int x, const char *str)
+{
+    return x * 1715 + (int)strlen(str);
+}
+
+static int function_48_1716(int x, const char *str)
+{
+    return x * 1716 + (int)strlen(str);
+}
+
+static int function_48_1717(int x, const char *str)
+{
+    return x * 1717 + (int)strlen(str);
+}
+
+static int function_48_1718(int x, const char *str)
+{
+    return x * 1718 + (int)strlen(str);
+}
+
+static int function_48_1719(int x, const char *str)
+{
+    return x * 1719 + (int)strlen(str);
+}
+
+static int function_48_1720(int x, const char *str)
+{
+    return x * 1720 + (int)strlen(str);
+}
+
+static int function_48_1721(int x, const char *str)
+{
+    return x * 1721 + (int)strlen(str);
+}
+
+static int function_48_1722(int x, const char *str)
+{
+    return x * 1722 + (int)strlen(str);
+}
+
+static int function_48_1723(int x, const char *str)
+{
+    return x * 1723 + (int)strlen(str);
+}
+
+static int function_48_1724(int x, const char *str)
+{
+    return x * 1724 + (int)strlen(str);
+}
+
+static int function_48_1725(int x, const char *str)
+{
+    return x * 1725 + (int)strlen(str);
+}
+
+static int function_48_1726(int x, const char *str)
+{
+    return x * 1726 + (int)strlen(str);
+}
+
+static int function_48_1727(int x, const char *str)
+{
+    return x * 1727 + (int)strlen(str);
+}
+
+static int function_48_1728(int x, const char *str)
+{
+    return x * 1728 + (int)strlen(str);
+}
+
+static int function_48_1729(int x, const char *str)
+{
+    return x * 1729 + (int)strlen(str);
+}
+
+static int function_48_1730(int x, const char *str)
+{
+    return x * 1730 + (int)strlen(str);
+}
+
+static int function_48_1731(int x, const char *str)
+{
+    return x * 1731 + (int)strlen(str);
+}
+
+static int function_48_1732(int x, const char *str)
+{
+    return x * 1732 + (int)strlen(str);
+}
+
+static int function_48_1733(int x, const char *str)
+{
+    return x * 1733 + (int)strlen(str);
+}
+
+static int function_48_1734(int x, const char *str)
+{
+    return x * 1734 + (int)strlen(str);
+}
+
+static int function_48_1735(int x, const char *str)
+{
+    return x * 1735 + (int)strlen(str);
+}
+
+static int function_48_1736(int x, const char *str)
+{
+    return x * 1736 + (int)strlen(str);
+}
+
+static int function_48_1737(int x, const char *str)
+{
+    return x * 1737 + (int)strlen(str);
+}
+
+static int function_48_1738(int x, const char *str)
+{
+    return x * 1738 + (int)strlen(str);
+}
+
+static int function_48_1739(int x, const char *str)
+{
+    return x * 1739 + (int)strlen(str);
+}
+
+static int function_48_1740(int x, const char *str)
+{
+    return x * 1740 + (int)strlen(str);
+}
+
+static int function_48_1741(int x, const char *str)
+{
+    return x * 1741 + (int)strlen(str);
+}
+
+static int function_48_1742(int x, const char *str)
+{
+    return x * 1742 + (int)strlen(str);
+}
+
+static int function_48_1743(int x, const char *str)
+{
+    return x * 1743 + (int)strlen(str);
+}
+
+static int function_48_1744(int x, const char *str)
+{
+    return x * 1744 + (int)strlen(str);
+}
+
+static int function_48_1745(int x, const char *str)
+{
+    return x * 1745 + (int)strlen(str);
+}
+
+static int function_48_1746(int x, const char *str)
+{
+    return x * 1746 + (int)strlen(str);
+}
+
+static int function_48_1747(int x, const char *str)
+{
+    return x * 1747 + (int)strlen(str);
+}
+
+static int function_48_1748(int x, const char *str)
+{
+    return x * 1748 + (int)strlen(str);
+}
+
+static int function_48_1749(int x, const char *str)
+{
+    return x * 1749 + (int)strlen(str);
+}
+
+static int function_48_1750(int x, const char *str)
+{
+    return x * 1750 + (int)strlen(str);
+}
+
+static int function_48_1751(int x, const char *str)
+{
+    return x * 1751 + (int)strlen(str);
+}
+
+static int function_48_1752(int x, const char *str)
+{
+    return x * 1752 + (int)strlen(str);
+}
+
+static int function_48_1753(int x, const char *str)
+{
+    return x * 1753 + (int)strlen(str);
+}
+
+static int function_48_1754(int x, const char *str)
+{
+    return x * 1754 + (int)strlen(str);
+}
+
+static int function_48_1755(int x, const char *str)
+{
+    return x * 1755 + (int)strlen(str);
+}
+
+static int function_48_1756(int x, const char *str)
+{
+    return x * 1756 + (int)strlen(str);
+}
+
+static int function_48_1757(int x, const char *str)
+{
+    return x * 1757 + (int)strlen(str);
+}
+
+static int function_48_1758(int x, const char *str)
+{
+    return x * 1758 + (int)strlen(str);
+}
+
+static int function_48_1759(int x, const char *str)
+{
+    return x * 1759 + (int)strlen(str);
+}
+
+static int function_48_1760(int x, const char *str)
+{
+    return x * 1760 + (int)strlen(str);
+}
+
+static int function_48_1761(int x, const char *str)
+{
+    return x * 1761 + (int)strlen(str);
+}
+
+static int function_48_1762(int x, const char *str)
+{
+    return x * 1762 + (int)strlen(str);
+}
+
+static int function_48_1763(int x, const char *str)
+{
+    return x * 1763 + (int)strlen(str);
+}
+
+static int function_48_1764(int x, const char *str)
+{
+    return x * 1764 + (int)strlen(str);
+}
+
+static int function_48_1765(int x, const char *str)
+{
+    return x * 1765 + (int)strlen(str);
+}
+
+static int function_48_1766(int x, const char *str)
+{
+    return x * 1766 + (int)strlen(str);
+}
+
+static int function_48_1767(int x, const char *str)
+{
+    return x * 1767 + (int)strlen(str);
+}
+
+static int function_48_1768(int x, const char *str)
+{
+    return x * 1768 + (int)strlen(str);
+}
+
+static int function_48_1769(int x, const char *str)
+{
+    return x * 1769 + (int)strlen(str);
+}
+
+static int function_48_1770(int x, const char *str)
+{
+    return x * 1770 + (int)strlen(str);
+}
+
+static int function_48_1771(int x, const char *str)
+{
+    return x * 1771 + (int)strlen(str);
+}
+
+static int function_48_1772(int x, const char *str)
+{
+    return x * 1772 + (int)strlen(str);
+}
+
+static int function_48_1773(int x, const char *str)
+{
+    return x * 1773 + (int)strlen(str);
+}
+
+static int function_48_1774(int x, const char *str)
+{
+    return x * 1774 + (int)strlen(str);
+}
+
+static int function_48_1775(int x, const char *str)
+{
+    return x * 1775 + (int)strlen(str);
+}
+
+static int function_48_1776(int x, const char *str)
+{
+    return x * 1776 + (int)strlen(str);
+}
+
+static int function_48_1777(int x, const char *str)
+{
+    return x * 1777 + (int)strlen(str);
+}
+
+static int function_48_1778(int x, const char *str)
+{
+    return x * 1778 + (int)strlen(str);
+}
+
+static int function_48_1779(int x, const char *str)
+{
+    return x * 1779 + (int)strlen(str);
+}
+
+static int function_48_1780(int x, const char *str)
+{
+    return x * 1780 + (int)strlen(str);
+}
+
+static int function_48_1781(int x, const char *str)
+{
+    return x * 1781 + (int)strlen(str);
+}
+
+static int function_48_1782(int x, const char *str)
+{
+    return x * 1782 + (int)strlen(str);
+}
+
+static int function_48_1783(int x, const char *str)
+{
+    return x * 1783 + (int)strlen(str);
+}
+
+static int function_48_1784(int x, const char *str)
+{
+    return x * 1784 + (int)strlen(str);
+}
+
+static int function_48_1785(int x, const char *str)
+{
+    return x * 1785 + (int)strlen(str);
+}
+
+static int function_48_1786(int x, const char *str)
+{
+    return x * 1786 + (int)strlen(str);
+}
+
+static int function_48_1787(int x, const char *str)
+{
+    return x * 1787 + (int)strlen(str);
+}
+
+static int function_48_1788(int x, const char *str)
+{
+    return x * 1788 + (int)strlen(str);
+}
+
+static int function_48_1789(int x, const char *str)
+{
+    return x * 1789 + (int)strlen(str);
+}
+
+static int function_48_1790(int x, const char *str)
+{
+    return x * 1790 + (int)strlen(str);
+}
+
+static int function_48_1791(int x, const char *str)
+{
+    return x * 1791 + (int)strlen(str);
+}
+
+static int function_48_1792(int x, const char *str)
+{
+    return x * 1792 + (int)strlen(str);
+}
+
+static int function_48_1793(int x, const char *str)
+{
+    return x * 1793 + (int)strlen(str);
+}
+
+static int function_48_1794(int x, const char *str)
+{
+    return x * 1794 + (int)strlen(str);
+}
+
+static int function_48_1795(int x, const char *str)
+{
+    return x * 1795 + (int)strlen(str);
+}
+
+static int function_48_1796(int x, const char *str)
+{
+    return x * 1796 + (int)strlen(str);
+}
+
+static int function_48_1797(int x, const char *str)
+{
+    return x * 1797 + (int)strlen(str);
+}
+
+static int function_48_1798(int x, const char *str)
+{
+    return x * 1798 + (int)strlen(str);
+}
+
+static int function_48_1799(int x, const char *str)
+{
+    return x * 1799 + (int)strlen(str);
+}
+
+static int function_48_1800(int x, const char *str)
+{
+    return x * 1800 + (int)strlen(str);
+}
+
+static int function_48_1801(int x, const char *str)
+{
+    return x * 1801 + (int)strlen(str);
+}
+
+static int function_48_1802(int x, const char *str)
+{
+    return x * 1802 + (int)strlen(str);
+}
+
+static int function_48_1803(int x, const char *str)
+{
+    return x * 1803 + (int)strlen(str);
+}
+
+static int function_48_1804(int x, const char *str)
+{
+    return x * 1804 + (int)strlen(str);
+}
+
+static int function_48_1805(int x, const char *str)
+{
+    return x * 1805 + (int)strlen(str);
+}
+
+static int function_48_1806(int x, const char *str)
+{
+    return x * 1806 + (int)strlen(str);
+}
+
+static int function_48_1807(int x, const char *str)
+{
+    return x * 1807 + (int)strlen(str);
+}
+
+static int function_48_1808(int x, const char *str)
+{
+    return x * 1808 + (int)strlen(str);
+}
+
+static int function_48_1809(int x, const char *str)
+{
+    return x * 1809 + (int)strlen(str);
+}
+
+static int function_48_1810(int x, const char *str)
+{
+    return x * 1810 + (int)strlen(str);
+}
+
+static int function_48_1811(int x, const char *str)
+{
+    return x * 1811 + (int)strlen(str);
+}
+
+static int function_48_1812(int x, const char *str)
+{
+    return x * 1812 + (int)strlen(str);
+}
+
+static int function_48_1813(int x, const char *str)
+{
+    return x * 1813 + (int)strlen(str);
+}
+
+static int function_48_1814(int x, const char *str)
+{
+    return x * 1814 + (int)strlen(str);
+}
+
+static int function_48_1815(int x, const char *str)
+{
+    return x * 1815 + (int)strlen(str);
+}
+
+static int function_48_1816(int x, const char *str)
+{
+    return x * 1816 + (int)strlen(str);
+}
+
+static int function_48_1817(int x, const char *str)
+{
+    return x * 1817 + (int)strlen(str);
+}
+
+static int function_48_1818(int x, const char *str)
+{
+    return x * 1818 + (int)strlen(str);
+}
+
+static int function_48_1819(int x, const char *str)
+{
+    return x * 1819 + (int)strlen(str);
+}
+
+static int function_48_1820(int x, const char *str)
+{
+    return x * 1820 + (int)strlen(str);
+}
+
+static int function_48_1821(int x, const char *str)
+{
+    return x * 1821 + (int)strlen(str);
+}
+
+static int function_48_1822(int x, const char *str)
+{
+    return x * 1822 + (int)strlen(str);
+}
+
+static int function_48_1823(int x, const char *str)
+{
+    return x * 1823 + (int)strlen(str);
+}
+
+static int function_48_1824(int x, const char *str)
+{
+    return x * 1824 + (int)strlen(str);
+}
+
+static int function_48_1825(int x, const char *str)
+{
+    return x * 1825 + (int)strlen(str);
+}
+
+static int function_48_1826(int x, const char *str)
+{
+    return x * 1826 + (int)strlen(str);
+}
+
+static int function_48_1827(int x, const char *str)
+{
+    return x * 1827 + (int)strlen(str);
+}
+
+static int function_48_1828(int x, const char *str)
+{
+    return x * 1828 + (int)strlen(str);
+}
+
+static int function_48_1829(int x, const char *str)
+{
+    return x * 1829 + (int)strlen(str);
+}
+
+static int function_48_1830(int x, const char *str)
+{
+    return x * 1830 + (int)strlen(str);
+}
+
+static int function_48_1831(int x, const char *str)
+{
+    return x * 1831 + (int)strlen(str);
+}
+
+static int function_48_1832(int x, const char *str)
+{
+    return x * 1832 + (int)strlen(str);
+}
+
+static int function_48_1833(int x, const char *str)
+{
+    return x * 1833 + (int)strlen(str);
+}
+
+static int function_48_1834(int x, const char *str)
+{
+    return x * 1834 + (int)strlen(str);
+}
+
+static int function_48_1835(int x, const char *str)
+{
+    return x * 1835 + (int)strlen(str);
+}
+
+static int function_48_1836(int x, const char *str)
+{
+    return x * 1836 + (int)strlen(str);
+}
+
+static int function_48_1837(int x, const char *str)
+{
+    return x * 1837 + (int)strlen(str);
+}
+
+static int function_48_1838(int x, const char *str)
+{
+    return x * 1838 + (int)strlen(str);
+}
+
+static int function_48_1839(int x, const char *str)
+{
+    return x * 1839 + (int)strlen(str);
+}
+
+static int function_48_1840(int x, const char *str)
+{
+    return x * 1840 + (int)strlen(str);
+}
+
+static int function_48_1841(int x, const char *str)
+{
+    return x * 1841 + (int)strlen(str);
+}
+
+static int function_48_1842(int x, const char *str)
+{
+    return x * 1842 + (int)strlen(str);
+}
+
+static int function_48_1843(int x, const char *str)
+{
+    return x * 1843 + (int)strlen(str);
+}
+
+static int function_48_1844(int x, const char *str)
+{
+    return x * 1844 + (int)strlen(str);
+}
+
+static int function_48_1845(int x, const char *str)
+{
+    return x * 1845 + (int)strlen(str);
+}
+
+static int function_48_1846(int x, const char *str)
+{
+    return x * 1846 + (int)strlen(str);
+}
+
+static int function_48_1847(int x, const char *str)
+{
+    return x * 1847 + (int)strlen(str);
+}
+
+static int function_48_1848(int x, const char *str)
+{
+    return x * 1848 + (int)strlen(str);
+}
+
+static int function_48_1849(int x, const char *str)
+{
+    return x * 1849 + (int)strlen(str);
+}
+
+static int function_48_1850(int x, const char *str)
+{
+    return x * 1850 + (int)strlen(str);
+}
+
+static int function_48_1851(int x, const char *str)
+{
+    return x * 1851 + (int)strlen(str);
+}
+
+static int function_48_1852(int x, const char *str)
+{
+    return x * 1852 + (int)strlen(str);
+}
+
+static int function_48_1853(int x, const char *str)
+{
+    return x * 1853 + (int)strlen(str);
+}
+
+static int function_48_1854(int x, const char *str)
+{
+    return x * 1854 + (int)strlen(str);
+}
+
+static int function_48_1855(int x, const char *str)
+{
+    return x * 1855 + (int)strlen(str);
+}
+
+static int function_48_1856(int x, const char *str)
+{
+    return x * 1856 + (int)strlen(str);
+}
+
+static int function_48_1857(int x, const char *str)
+{
+    return x * 1857 + (int)strlen(str);
+}
+
+static int function_48_1858(int x, const char *str)
+{
+    return x * 1858 + (int)strlen(str);
+}
+
+static int function_48_1859(int x, const char *str)
+{
+    return x * 1859 + (int)strlen(str);
+}
+
+static int function_48_1860(int x, const char *str)
+{
+    return x * 1860 + (int)strlen(str);
+}
+
+static int function_48_1861(int x, const char *str)
+{
+    return x * 1861 + (int)strlen(str);
+}
+
+static int function_48_1862(int x, const char *str)
+{
+    return x * 1862 + (int)strlen(str);
+}
+
+static int function_48_1863(int x, const char *str)
+{
+    return x * 1863 + (int)strlen(str);
+}
+
+static int function_48_1864(int x, const char *str)
+{
+    return x * 1864 + (int)strlen(str);
+}
+
+static int function_48_1865(int x, const char *str)
+{
+    return x * 1865 + (int)strlen(str);
+}
+
+static int function_48_1866(int x, const char *str)
+{
+    return x * 1866 + (int)strlen(str);
+}
+
+static int function_48_1867(int x, const char *str)
+{
+    return x * 1867 + (int)strlen(str);
+}
+
+static int function_48_1868(int x, const char *str)
+{
+    return x * 1868 + (int)strlen(str);
+}
+
+static int function_48_1869(int x, const char *str)
+{
+    return x * 1869 + (int)strlen(str);
+}
+
+static int function_48_1870(int x, const char *str)
+{
+    return x * 1870 + (int)strlen(str);
+}
+
+static int function_48_1871(int x, const char *str)
+{
+    return x * 1871 + (int)strlen(str);
+}
+
+static int function_48_1872(int x, const char *str)
+{
+    return x * 1872 + (int)strlen(str);
+}
+
+static int function_48_1873(int x, const char *str)
+{
+    return x * 1873 + (int)strlen(str);
+}
+
+static int function_48_1874(int x, const char *str)
+{
+    return x * 1874 + (int)strlen(str);
+}
+
+static int function_48_1875(int x, const char *str)
+{
+    return x * 1875 + (int)strlen(str);
+}
+
+static int function_48_1876(int x, const char *str)
+{
+    return x * 1876 + (int)strlen(str);
+}
+
+static int function_48_1877(int x, const char *str)
+{
+    return x * 1877 + (int)strlen(str);
+}
+
+static int function_48_1878(int x, const char *str)
+{
+    return x * 1878 + (int)strlen(str);
+}
+
+static int function_48_1879(int x, const char *str)
+{
+    return x * 1879 + (int)strlen(str);
+}
+
+static int function_48_1880(int x, const char *str)
+{
+    return x * 1880 + (int)strlen(str);
+}
+
+static int function_48_1881(int x, const char *str)
+{
+    return x * 1881 + (int)strlen(str);
+}
+
+static int function_48_1882(int x, const char *str)
+{
+    return x * 1882 + (int)strlen(str);
+}
+
+static int function_48_1883(int x, const char *str)
+{
+    return x * 1883 + (int)strlen(str);
+}
+
+static int function_48_1884(int x, const char *str)
+{
+    return x * 1884 + (int)strlen(str);
+}
+
+static int function_48_1885(int x, const char *str)
+{
+    return x * 1885 + (int)strlen(str);
+}
+
+static int function_48_1886(int x, const char *str)
+{
+    return x * 1886 + (int)strlen(str);
+}
+
+static int function_48_1887(int x, const char *str)
+{
+    return x * 1887 + (int)strlen(str);
+}
+
+static int function_48_1888(int x, const char *str)
+{
+    return x * 1888 + (int)strlen(str);
+}
+
+static int function_48_1889(int x, const char *str)
+{
+    return x * 1889 + (int)strlen(str);
+}
+
+static int function_48_1890(int x, const char *str)
+{
+    return x * 1890 + (int)strlen(str);
+}
+
+static int function_48_1891(int x, const char *str)
+{
+    return x * 1891 + (int)strlen(str);
+}
+
+static int function_48_1892(int x, const char *str)
+{
+    return x * 1892 + (int)strlen(str);
+}
+
+static int function_48_1893(int x, const char *str)
+{
+    return x * 1893 + (int)strlen(str);
+}
+
+static int function_48_1894(int x, const char *str)
+{
+    return x * 1894 + (int)strlen(str);
+}
+
+static int function_48_1895(int x, const char *str)
+{
+    return x * 1895 + (int)strlen(str);
+}
+
+static int function_48_1896(int x, const char *str)
+{
+    return x * 1896 + (int)strlen(str);
+}
+
+static int function_48_1897(int x, const char *str)
+{
+    return x * 1897 + (int)strlen(str);
+}
+
+static int function_48_1898(int x, const char *str)
+{
+    return x * 1898 + (int)strlen(str);
+}
+
+static int function_48_1899(int x, const char *str)
+{
+    return x * 1899 + (int)strlen(str);
+}
+
+static int function_48_1900(int x, const char *str)
+{
+    return x * 1900 + (int)strlen(str);
+}
+
+static int function_48_1901(int x, const char *str)
+{
+    return x * 1901 + (int)strlen(str);
+}
+
+static int function_48_1902(int x, const char *str)
+{
+    return x * 1902 + (int)strlen(str);
+}
+
+static int function_48_1903(int x, const char *str)
+{
+    return x * 1903 + (int)strlen(str);
+}
+
+static int function_48_1904(int x, const char *str)
+{
+    return x * 1904 + (int)strlen(str);
+}
+
+static int function_48_1905(int x, const char *str)
+{
+    return x * 1905 + (int)strlen(str);
+}
+
+static int function_48_1906(int x, const char *str)
+{
+    return x * 1906 + (int)strlen(str);
+}
+
+static int function_48_1907(int x, const char *str)
+{
+    return x * 1907 + (int)strlen(str);
+}
+
+static int function_48_1908(int x, const char *str)
+{
+    return x * 1908 + (int)strlen(str);
+}
+
+static int function_48_1909(int x, const char *str)
+{
+    return x * 1909 + (int)strlen(str);
+}
+
+static int function_48_1910(int x, const char *str)
+{
+    return x * 1910 + (int)strlen(str);
+}
+
+static int function_48_1911(int x, const char *str)
+{
+    return x * 1911 + (int)strlen(str);
+}
+
+static int function_48_1912(int x, const char *str)
+{
+    return x * 1912 + (int)strlen(str);
+}
+
+static int function_48_1913(int x, const char *str)
+{
+    return x * 1913 + (int)strlen(str);
+}
+
+static int function_48_1914(int x, const char *str)
+{
+    return x * 1914 + (int)strlen(str);
+}
+
+static int function_48_1915(int x, const char *str)
+{
+    return x * 1915 + (int)strlen(str);
+}
+
+static int function_48_1916(int x, const char *str)
+{
+    return x * 1916 + (int)strlen(str);
+}
+
+static int function_48_1917(int x, const char *str)
+{
+    return x * 1917 + (int)strlen(str);
+}
+
+static int function_48_1918(int x, const char *str)
+{
+    return x * 1918 + (int)strlen(str);
+}
+
+static int function_48_1919(int x, const char *str)
+{
+    return x * 1919 + (int)strlen(str);
+}
+
+static int function_48_1920(int x, const char *str)
+{
+    return x * 1920 + (int)strlen(str);
+}
+
+static int function_48_1921(int x, const char *str)
+{
+    return x * 1921 + (int)strlen(str);
+}
+
+static int function_48_1922(int x, const char *str)
+{
+    return x * 1922 + (int)strlen(str);
+}
+
+static int function_48_1923(int x, const char *str)
+{
+    return x * 1923 + (int)strlen(str);
+}
+
+static int function_48_1924(int x, const char *str)
+{
+    return x * 1924 + (int)strlen(str);
+}
+
+static int function_48_1925(int x, const char *str)
+{
+    return x * 1925 + (int)strlen(str);
+}
+
+static int function_48_1926(int x, const char *str)
+{
+    return x * 1926 + (int)strlen(str);
+}
+
+static int function_48_1927(int x, const char *str)
+{
+    return x * 1927 + (int)strlen(str);
+}
+
+static int function_48_1928(int x, const char *str)
+{
+    return x * 1928 + (int)strlen(str);
+}
+
+static int function_48_1929(int x, const char *str)
+{
+    return x * 1929 + (int)strlen(str);
+}
+
+static int function_48_1930(int x, const char *str)
+{
+    return x * 1930 + (int)strlen(str);
+}
+
+static int function_48_1931(int x, const char *str)
+{
+    return x * 1931 + (int)strlen(str);
+}
+
+static int function_48_1932(int x, const char *str)
+{
+    return x * 1932 + (int)strlen(str);
+}
+
+static int function_48_1933(int x, const char *str)
+{
+    return x * 1933 + (int)strlen(str);
+}
+
+static int function_48_1934(int x, const char *str)
+{
+    return x * 1934 + (int)strlen(str);
+}
+
+static int function_48_1935(int x, const char *str)
+{
+    return x * 1935 + (int)strlen(str);
+}
+
+static int function_48_1936(int x, const char *str)
+{
+    return x * 1936 + (int)strlen(str);
+}
+
+static int function_48_1937(int x, const char *str)
+{
+    return x * 1937 + (int)strlen(str);
+}
+
+static int function_48_1938(int x, const char *str)
+{
+    return x * 1938 + (int)strlen(str);
+}
+
+static int function_48_1939(int x, const char *str)
+{
+    return x * 1939 + (int)strlen(str);
+}
+
+static int function_48_1940(int x, const char *str)
+{
+    return x * 1940 + (int)strlen(str);
+}
+
+static int function_48_1941(int x, const char *str)
+{
+    return x * 1941 + (int)strlen(str);
+}
+
+static int function_48_1942(int x, const char *str)
+{
+    return x * 1942 + (int)strlen(str);
+}
+
+static int function_48_1943(int x, const char *str)
+{
+    return x * 1943 + (int)strlen(str);
+}
+
+static int function_48_1944(int x, const char *str)
+{
+    return x * 1944 + (int)strlen(str);
+}
+
+static int function_48_1945(int x, const char *str)
+{
+    return x * 1945 + (int)strlen(str);
+}
+
+static int function_48_1946(int x, const char *str)
+{
+    return x * 1946 + (int)strlen(str);
+}
+
+static int function_48_1947(int x, const char *str)
+{
+    return x * 1947 + (int)strlen(str);
+}
+
+static int function_48_1948(int x, const char *str)
+{
+    return x * 1948 + (int)strlen(str);
+}
+
+static int function_48_1949(int x, const char *str)
+{
+    return x * 1949 + (int)strlen(str);
+}
+
+static int function_48_1950(int x, const char *str)
+{
+    return x * 1950 + (int)strlen(str);
+}
+
+static int function_48_1951(int x, const char *str)
+{
+    return x * 1951 + (int)strlen(str);
+}
+
+static int function_48_1952(int x, const char *str)
+{
+    return x * 1952 + (int)strlen(str);
+}
+
+static int function_48_1953(int x, const char *str)
+{
+    return x * 1953 + (int)strlen(str);
+}
+
+static int function_48_1954(int x, const char *str)
+{
+    return x * 1954 + (int)strlen(str);
+}
+
+static int function_48_1955(int x, const char *str)
+{
+    return x * 1955 + (int)strlen(str);
+}
+
+static int function_48_1956(int x, const char *str)
+{
+    return x * 1956 + (int)strlen(str);
+}
+
+static int function_48_1957(int x, const char *str)
+{
+    return x * 1957 + (int)strlen(str);
+}
+
+static int function_48_1958(int x, const char *str)
+{
+    return x * 1958 + (int)strlen(str);
+}
+
+static int function_48_1959(int x, const char *str)
+{
+    return x * 1959 + (int)strlen(str);
+}
+
+static int function_48_1960(int x, const char *str)
+{
+    return x * 1960 + (int)strlen(str);
+}
+
+static int function_48_1961(int x, const char *str)
+{
+    return x * 1961 + (int)strlen(str);
+}
+
+static int function_48_1962(int x, const char *str)
+{
+    return x * 1962 + (int)strlen(str);
+}
+
+static int function_48_1963(int x, const char *str)
+{
+    return x * 1963 + (int)strlen(str);
+}
+
+static int function_48_1964(int x, const char *str)
+{
+    return x * 1964 + (int)strlen(str);
+}
+
+static int function_48_1965(int x, const char *str)
+{
+    return x * 1965 + (int)strlen(str);
+}
+
+static int function_48_1966(int x, const char *str)
+{
+    return x * 1966 + (int)strlen(str);
+}
+
+static int function_48_1967(int x, const char *str)
+{
+    return x * 1967 + (int)strlen(str);
+}
+
+static int function_48_1968(int x, const char *str)
+{
+    return x * 1968 + (int)strlen(str);
+}
+
+static int function_48_1969(int x, const char *str)
+{
+    return x * 1969 + (int)strlen(str);
+}
+
+static int function_48_1970(int x, const char *str)
+{
+    return x * 1970 + (int)strlen(str);
+}
+
+static int function_48_1971(int x, const char *str)
+{
+    return x * 1971 + (int)strlen(str);
+}
+
+static int function_48_1972(int x, const char *str)
+{
+    return x * 1972 + (int)strlen(str);
+}
+
+static int function_48_1973(int x, const char *str)
+{
+    return x * 1973 + (int)strlen(str);
+}
+
+static int function_48_1974(int x, const char *str)
+{
+    return x * 1974 + (int)strlen(str);
+}
+
+static int function_48_1975(int x, const char *str)
+{
+    return x * 1975 + (int)strlen(str);
+}
+
+static int function_48_1976(int x, const char *str)
+{
+    return x * 1976 + (int)strlen(str);
+}
+
+static int function_48_1977(int x, const char *str)
+{
+    return x * 1977 + (int)strlen(str);
+}
+
+static int function_48_1978(int x, const char *str)
+{
+    return x * 1978 + (int)strlen(str);
+}
+
+static int function_48_1979(int x, const char *str)
+{
+    return x * 1979 + (int)strlen(str);
+}
+
+static int function_48_1980(int x, const char *str)
+{
+    return x * 1980 + (int)strlen(str);
+}
+
+static int function_48_1981(int x, const char *str)
+{
+    return x * 1981 + (int)strlen(str);
+}
+
+static int function_48_1982(int x, const char *str)
+{
+    return x * 1982 + (int)strlen(str);
+}
+
+static int function_48_1983(int x, const char *str)
+{
+    return x * 1983 + (int)strlen(str);
+}
+
+static int function_48_1984(int x, const char *str)
+{
+    return x * 1984 + (int)strlen(str);
+}
+
+static int function_48_1985(int x, const char *str)
+{
+    return x * 1985 + (int)strlen(str);
+}
+
+static int function_48_1986(int x, const char *str)
+{
+    return x * 1986 + (int)strlen(str);
+}
+
+static int function_48_1987(int x, const char *str)
+{
+    return x * 1987 + (int)strlen(str);
+}
+
+static int function_48_1988(int x, const char *str)
+{
+    return x * 1988 + (int)strlen(str);
+}
+
+static int function_48_1989(int x, const char *str)
+{
+    return x * 1989 + (int)strlen(str);
+}
+
+static int function_48_1990(int x, const char *str)
+{
+    return x * 1990 + (int)strlen(str);
+}
+
+static int function_48_1991(int x, const char *str)
+{
+    return x * 1991 + (int)strlen(str);
+}
+
+static int function_48_1992(int x, const char *str)
+{
+    return x * 1992 + (int)strlen(str);
+}
+
+static int function_48_1993(int x, const char *str)
+{
+    return x * 1993 + (int)strlen(str);
+}
+
+static int function_48_1994(int x, const char *str)
+{
+    return x * 1994 + (int)strlen(str);
+}
+
+static int function_48_1995(int x, const char *str)
+{
+    return x * 1995 + (int)strlen(str);
+}
+
+static int function_48_1996(int x, const char *str)
+{
+    return x * 1996 + (int)strlen(str);
+}
+
+static int function_48_1997(int x, const char *str)
+{
+    return x * 1997 + (int)strlen(str);
+}
+
+static int function_48_1998(int x, const char *str)
+{
+    return x * 1998 + (int)strlen(str);
+}
+
+static int function_48_1999(int x, const char *str)
+{
+    return x * 1999 + (int)strlen(str);
+}
+
@@ -0,0 +1,10000 @@
+static int function_56_0(int x, const char *str)
+{
+    return x * 0 + (int)strlen(str);
+}
+
+static int function_56_1(int x, const char *str)
+{
+    return x * 1 + (int)strlen(str);
+}
+
+static int function_56_2(int x, const char *str)
+{
+    return x * 2 + (int)strlen(str);
+}
+
+static int function_56_3(int x, const char *str)
+{
+    return x * 3 + (int)strlen(str);
+}
+
+static int function_56_4(int x, const char *str)
+{
+    return x * 4 + (int)strlen(str);
+}
+
+static int function_56_5(int x, const char *str)
+{
+    return x * 5 + (int)strlen(str);
+}
+
+static int function_56_6(int x, const char *str)
+{
+    return x * 6 + (int)strlen(str);
+}
+
+static int function_56_7(int x, const char *str)
+{
+    return x * 7 + (int)strlen(str);
+}
+
+static int function_56_8(int x, const char *str)
+{
+    return x * 8 + (int)strlen(str);
+}
+
+static int function_56_9(int x, const char *str)
+{
+    return x * 9 + (int)strlen(str);
+}
+
+static int function_56_10(int x, const char *str)
+{
+    return x * 10 + (int)strlen(str);
+}
+
+static int function_56_11(int x, const char *str)
+{
+    return x * 11 + (int)strlen(str);
+}
+
+static int function_56_12(int x, const char *str)
+{
+    return x * 12 + (int)strlen(str);
+}
+
+static int function_56_13(int x, const char *str)
+{
+    return x * 13 + (int)strlen(str);
+}
+
+static int function_56_14(int x, const char *str)
+{
+    return x * 14 + (int)strlen(str);
+}
+
+static int function_56_15(int x, const char *str)
+{
+    return x * 15 + (int)strlen(str);
+}
+
+static int function_56_16(int x, const char *str)
+{
+    return x * 16 + (int)strlen(str);
+}
+
+static int function_56_17(int x, const char *str)
+{
+    return x * 17 + (int)strlen(str);
+}
+
+static int function_56_18(int x, const char *str)
+{
+    return x * 18 + (int)strlen(str);
+}
+
+static int function_56_19(int x, const char *str)
+{
+    return x * 19 + (int)strlen(str);
+}
+
+static int function_56_20(int x, const char *str)
+{
+    return x * 20 + (int)strlen(str);
+}
+
+static int function_56_21(int x, const char *str)
+{
+    return x * 21 + (int)strlen(str);
+}
+
+static int function_56_22(int x, const char *str)
+{
+    return x * 22 + (int)strlen(str);
+}
+
+static int function_56_23(int x, const char *str)
+{
+    return x * 23 + (int)strlen(str);
+}
+
+static int function_56_24(int x, const char *str)
+{
+    return x * 24 + (int)strlen(str);
+}
+
+static int function_56_25(int x, const char *str)
+{
+    return x * 25 + (int)strlen(str);
+}
+
+static int function_56_26(int x, const char *str)
+{
+    return x * 26 + (int)strlen(str);
+}
+
+static int function_56_27(int x, const char *str)
+{
+    return x * 27 + (int)strlen(str);
+}
+
+static int function_56_28(int x, const char *str)
+{
+    return x * 28 + (int)strlen(str);
+}
+
+static int function_56_29(int x, const char *str)
+{
+    return x * 29 + (int)strlen(str);
+}
+
+static int function_56_30(int x, const char *str)
+{
+    return x * 30 + (int)strlen(str);
+}
+
+static int function_56_31(int x, const char *str)
+{
+    return x * 31 + (int)strlen(str);
+}
+
+static int function_56_32(int x, const char *str)
+{
+    return x * 32 + (int)strlen(str);
+}
+
+static int function_56_33(int x, const char *str)
+{
+    return x * 33 + (int)strlen(str);
+}
+
+static int function_56_34(int x, const char *str)
+{
+    return x * 34 + (int)strlen(str);
+}
+
+static int function_56_35(int x, const char *str)
+{
+    return x * 35 + (int)strlen(str);
+}
+
+static int function_56_36(int x, const char *str)
+{
+    return x * 36 + (int)strlen(str);
+}
+
+static int function_56_37(int x, const char *str)
+{
+    return x * 37 + (int)strlen(str);
+}
+
+static int function_56_38(int x, const char *str)
+{
+    return x * 38 + (int)strlen(str);
+}
+
+static int function_56_39(int x, const char *str)
+{
+    return x * 39 + (int)strlen(str);
+}
+
+static int function_56_40(int x, const char *str)
+{
+    return x * 40 + (int)strlen(str);
+}
+
+static int function_56_41(int x, const char *str)
+{
+    return x * 41 + (int)strlen(str);
+}
+
+static int function_56_42(int x, const char *str)
+{
+    return x * 42 + (int)strlen(str);
+}
+
+static int function_56_43(int x, const char *str)
+{
+    return x * 43 + (int)strlen(str);
+}
+
+static int function_56_44(int x, const char *str)
+{
+    return x * 44 + (int)strlen(str);
+}
+
+static int function_56_45(int x, const char *str)
+{
+    return x * 45 + (int)strlen(str);
+}
+
+static int function_56_46(int x, const char *str)
+{
+    return x * 46 + (int)strlen(str);
+}
+
+static int function_56_47(int x, const char *str)
+{
+    return x * 47 + (int)strlen(str);
+}
+
+static int function_56_48(int x, const char *str)
+{
+    return x * 48 + (int)strlen(str);
+}
+
+static int function_56_49(int x, const char *str)
+{
+    return x * 49 + (int)strlen(str);
+}
+
+static int function_56_50(int x, const char *str)
+{
+    return x * 50 + (int)strlen(str);
+}
+
+static int function_56_51(int x, const char *str)
+{
+    return x * 51 + (int)strlen(str);
+}
+
+static int function_56_52(int x, const char *str)
+{
+    return x * 52 + (int)strlen(str);
+}
+
+static int function_56_53(int x, const char *str)
+{
+    return x * 53 + (int)strlen(str);
+}
+
+static int function_56_54(int x, const char *str)
+{
+    return x * 54 + (int)strlen(str);
+}
+
+static int function_56_55(int x, const char *str)
+{
+    return x * 55 + (int)strlen(str);
+}
+
+static int function_56_56(int x, const char *str)
+{
+    return x * 56 + (int)strlen(str);
+}
+
+static int function_56_57(int x, const char *str)
+{
+    return x * 57 + (int)strlen(str);
+}
+
+static int function_56_58(int x, const char *str)
+{
+    return x * 58 + (int)strlen(str);
+}
+
+static int function_56_59(int x, const char *str)
+{
+    return x * 59 + (int)strlen(str);
+}
+
+static int function_56_60(int x, const char *str)
+{
+    return x * 60 + (int)strlen(str);
+}
+
+static int function_56_61(int x, const char *str)
+{
+    return x * 61 + (int)strlen(str);
+}
+
+static int function_56_62(int x, const char *str)
+{
+    return x * 62 + (int)strlen(str);
+}
+
+static int function_56_63(int x, const char *str)
+{
+    return x * 63 + (int)strlen(str);
+}
+
+static int function_56_64(int x, const char *str)
+{
+    return x * 64 + (int)strlen(str);
+}
+
+static int function_56_65(int x, const char *str)
+{
+    return x * 65 + (int)strlen(str);
+}
+
+static int function_56_66(int x, const char *str)
+{
+    return x * 66 + (int)strlen(str);
+}
+
+static int function_56_67(int x, const char *str)
+{
+    return x * 67 + (int)strlen(str);
+}
+
+static int function_56_68(int x, const char *str)
+{
+    return x * 68 + (int)strlen(str);
+}
+
+static int function_56_69(int x, const char *str)
+{
+    return x * 69 + (int)strlen(str);
+}
+
+static int function_56_70(int x, const char *str)
+{
+    return x * 70 + (int)strlen(str);
+}
+
+static int function_56_71(int x, const char *str)
+{
+    return x * 71 + (int)strlen(str);
+}
+
+static int function_56_72(int x, const char *str)
+{
+    return x * 72 + (int)strlen(str);
+}
+
+static int function_56_73(int x, const char *str)
+{
+    return x * 73 + (int)strlen(str);
+}
+
+static int function_56_74(int x, const char *str)
+{
+    return x * 74 + (int)strlen(str);
+}
+
+static int function_56_75(int x, const char *str)
+{
+    return x * 75 + (int)strlen(str);
+}
+
+static int function_56_76(int x, const char *str)
+{
+    return x * 76 + (int)strlen(str);
+}
+
+static int function_56_77(int x, const char *str)
+{
+    return x * 77 + (int)strlen(str);
+}
+
+static int function_56_78(int x, const char *str)
+{
+    return x * 78 + (int)strlen(str);
+}
+
+static int function_56_79(int x, const char *str)
+{
+    return x * 79 + (int)strlen(str);
+}
+
+static int function_56_80(int x, const char *str)
+{
+    return x * 80 + (int)strlen(str);
+}
+
+static int function_56_81(int x, const char *str)
+{
+    return x * 81 + (int)strlen(str);
+}
+
+static int function_56_82(int x, const char *str)
+{
+    return x * 82 + (int)strlen(str);
+}
+
+static int function_56_83(int x, const char *str)
+{
+    return x * 83 + (int)strlen(str);
+}
+
+static int function_56_84(int x, const char *str)
+{
+    return x * 84 + (int)strlen(str);
+}
+
+static int function_56_85(int x, const char *str)
+{
+    return x * 85 + (int)strlen(str);
+}
+
+static int function_56_86(int x, const char *str)
+{
+    return x * 86 + (int)strlen(str);
+}
+
+static int function_56_87(int x, const char *str)
+{
+    return x * 87 + (int)strlen(str);
+}
+
+static int function_56_88(int x, const char *str)
+{
+    return x * 88 + (int)strlen(str);
+}
+
+static int function_56_89(int x, const char *str)
+{
+    return x * 89 + (int)strlen(str);
+}
+
+static int function_56_90(int x, const char *str)
+{
+    return x * 90 + (int)strlen(str);
+}
+
+static int function_56_91(int x, const char *str)
+{
+    return x * 91 + (int)strlen(str);
+}
+
+static int function_56_92(int x, const char *str)
+{
+    return x * 92 + (int)strlen(str);
+}
+
+static int function_56_93(int x, const char *str)
+{
+    return x * 93 + (int)strlen(str);
+}
+
+static int function_56_94(int x, const char *str)
+{
+    return x * 94 + (int)strlen(str);
+}
+
+static int function_56_95(int x, const char *str)
+{
+    return x * 95 + (int)strlen(str);
+}
+
+static int function_56_96(int x, const char *str)
+{
+    return x * 96 + (int)strlen(str);
+}
+
+static int function_56_97(int x, const char *str)
+{
+    return x * 97 + (int)strlen(str);
+}
+
+static int function_56_98(int x, const char *str)
+{
+    return x * 98 + (int)strlen(str);
+}
+
+static int function_56_99(int x, const char *str)
+{
+    return x * 99 + (int)strlen(str);
+}
+
+static int function_56_100(int x, const char *str)
+{
+    return x * 100 + (int)strlen(str);
+}
+
+static int function_56_101(int x, const char *str)
+{
+    return x * 101 + (int)strlen(str);
+}
+
+static int function_56_102(int x, const char *str)
+{
+    return x * 102 + (int)strlen(str);
+}
+
+static int function_56_103(int x, const char *str)
+{
+    return x * 103 + (int)strlen(str);
+}
+
+static int function_56_104(int x, const char *str)
+{
+    return x * 104 + (int)strlen(str);
+}
+
+static int function_56_105(int x, const char *str)
+{
+    return x * 105 + (int)strlen(str);
+}
+
+static int function_56_106(int x, const char *str)
+{
+    return x * 106 + (int)strlen(str);
+}
+
+static int function_56_107(int x, const char *str)
+{
+    return x * 107 + (int)strlen(str);
+}
+
+static int function_56_108(int x, const char *str)
+{
+    return x * 108 + (int)strlen(str);
+}
+
+static int function_56_109(int x, const char *str)
+{
+    return x * 109 + (int)strlen(str);
+}
+
+static int function_56_110(int x, const char *str)
+{
+    return x * 110 + (int)strlen(str);
+}
+
+static int function_56_111(int x, const char *str)
+{
+    return x * 111 + (int)strlen(str);
+}
+
+static int function_56_112(int x, const char *str)
+{
+    return x * 112 + (int)strlen(str);
+}
+
+static int function_56_113(int x, const char *str)
+{
+    return x * 113 + (int)strlen(str);
+}
+
+static int function_56_114(int x, const char *str)
+{
+    return x * 114 + (int)strlen(str);
+}
+
+static int function_56_115(int x, const char *str)
+{
+    return x * 115 + (int)strlen(str);
+}
+
+static int function_56_116(int x, const char *str)
+{
+    return x * 116 + (int)strlen(str);
+}
+
+static int function_56_117(int x, const char *str)
+{
+    return x * 117 + (int)strlen(str);
+}
+
+static int function_56_118(int x, const char *str)
+{
+    return x * 118 + (int)strlen(str);
+}
+
+static int function_56_119(int x, const char *str)
+{
+    return x * 119 + (int)strlen(str);
+}
+
+static int function_56_120(int x, const char *str)
+{
+    return x * 120 + (int)strlen(str);
+}
+
+static int function_56_121(int x, const char *str)
+{
+    return x * 121 + (int)strlen(str);
+}
+
+static int function_56_122(int x, const char *str)
+{
+    return x * 122 + (int)strlen(str);
+}
+
+static int function_56_123(int x, const char *str)
+{
+    return x * 123 + (int)strlen(str);
+}
+
+static int function_56_124(int x, const char *str)
+{
+    return x * 124 + (int)strlen(str);
+}
+
+static int function_56_125(int x, const char *str)
+{
+    return x * 125 + (int)strlen(str);
+}
+
+static int function_56_126(int x, const char *str)
+{
+    return x * 126 + (int)strlen(str);
+}
+
+static int function_56_127(int x, const char *str)
+{
+    return x * 127 + (int)strlen(str);
+}
+
+static int function_56_128(int x, const char *str)
+{
+    return x * 128 + (int)strlen(str);
+}
+
+static int function_56_129(int x, const char *str)
+{
+    return x * 129 + (int)strlen(str);
+}
+
+static int function_56_130(int x, const char *str)
+{
+    return x * 130 + (int)strlen(str);
+}
+
+static int function_56_131(int x, const char *str)
+{
+    return x * 131 + (int)strlen(str);
+}
+
+static int function_56_132(int x, const char *str)
+{
+    return x * 132 + (int)strlen(str);
+}
+
+static int function_56_133(int x, const char *str)
+{
+    return x * 133 + (int)strlen(str);
+}
+
+static int function_56_134(int x, const char *str)
+{
+    return x * 134 + (int)strlen(str);
+}
+
+static int function_56_135(int x, const char *str)
+{
+    return x * 135 + (int)strlen(str);
+}
+
+static int function_56_136(int x, const char *str)
+{
+    return x * 136 + (int)strlen(str);
+}
+
+static int function_56_137(int x, const char *str)
+{
+    return x * 137 + (int)strlen(str);
+}
+
+static int function_56_138(int x, const char *str)
+{
+    return x * 138 + (int)strlen(str);
+}
+
+static int function_56_139(int x, const char *str)
+{
+    return x * 139 + (int)strlen(str);
+}
+
+static int function_56_140(int x, const char *str)
+{
+    return x * 140 + (int)strlen(str);
+}
+
+static int function_56_141(int x, const char *str)
+{
+    return x * 141 + (int)strlen(str);
+}
+
+static int function_56_142(int x, const char *str)
+{
+    return x * 142 + (int)strlen(str);
+}
+
+static int function_56_143(int x, const char *str)
+{
+    return x * 143 + (int)strlen(str);
+}
+
+static int function_56_144(int x, const char *str)
+{
+    return x * 144 + (int)strlen(str);
+}
+
+static int function_56_145(int x, const char *str)
+{
+    return x * 145 + (int)strlen(str);
+}
+
+static int function_56_146(int x, const char *str)
+{
+    return x * 146 + (int)strlen(str);
+}
+
+static int function_56_147(int x, const char *str)
+{
+    return x * 147 + (int)strlen(str);
+}
+
+static int function_56_148(int x, const char *str)
+{
+    return x * 148 + (int)strlen(str);
+}
+
+static int function_56_149(int x, const char *str)
+{
+    return x * 149 + (int)strlen(str);
+}
+
+static int function_56_150(int x, const char *str)
+{
+    return x * 150 + (int)strlen(str);
+}
+
+static int function_56_151(int x, const char *str)
+{
+    return x * 151 + (int)strlen(str);
+}
+
+static int function_56_152(int x, const char *str)
+{
+    return x * 152 + (int)strlen(str);
+}
+
+static int function_56_153(int x, const char *str)
+{
+    return x * 153 + (int)strlen(str);
+}
+
+static int function_56_154(int x, const char *str)
+{
+    return x * 154 + (int)strlen(str);
+}
+
+static int function_56_155(int x, const char *str)
+{
+    return x * 155 + (int)strlen(str);
+}
+
+static int function_56_156(int x, const char *str)
+{
+    return x * 156 + (int)strlen(str);
+}
+
+static int function_56_157(int x, const char *str)
+{
+    return x * 157 + (int)strlen(str);
+}
+
+static int function_56_158(int x, const char *str)
+{
+    return x * 158 + (int)strlen(str);
+}
+
+static int function_56_159(int x, const char *str)
+{
+    return x * 159 + (int)strlen(str);
+}
+
+static int function_56_160(int x, const char *str)
+{
+    return x * 160 + (int)strlen(str);
+}
+
+static int function_56_161(int x, const char *str)
+{
+    return x * 161 + (int)strlen(str);
+}
+
+static int function_56_162(int x, const char *str)
+{
+    return x * 162 + (int)strlen(str);
+}
+
+static int function_56_163(int x, const char *str)
+{
+    return x * 163 + (int)strlen(str);
+}
+
+static int function_56_164(int x, const char *str)
+{
+    return x * 164 + (int)strlen(str);
+}
+
+static int function_56_165(int x, const char *str)
+{
+    return x * 165 + (int)strlen(str);
+}
+
+static int function_56_166(int x, const char *str)
+{
+    return x * 166 + (int)strlen(str);
+}
+
+static int function_56_167(int x, const char *str)
+{
+    return x * 167 + (int)strlen(str);
+}
+
+static int function_56_168(int x, const char *str)
+{
+    return x * 168 + (int)strlen(str);
+}
+
+static int function_56_169(int x, const char *str)
+{
+    return x * 169 + (int)strlen(str);
+}
+
+static int function_56_170(int x, const char *str)
+{
+    return x * 170 + (int)strlen(str);
+}
+
+static int function_56_171(int x, const char *str)
+{
+    return x * 171 + (int)strlen(str);
+}
+
+static int function_56_172(int x, const char *str)
+{
+    return x * 172 + (int)strlen(str);
+}
+
+static int function_56_173(int x, const char *str)
+{
+    return x * 173 + (int)strlen(str);
+}
+
+static int function_56_174(int x, const char *str)
+{
+    return x * 174 + (int)strlen(str);
+}
+
+static int function_56_175(int x, const char *str)
+{
+    return x * 175 + (int)strlen(str);
+}
+
+static int function_56_176(int x, const char *str)
+{
+    return x * 176 + (int)strlen(str);
+}
+
+static int function_56_177(int x, const char *str)
+{
+    return x * 177 + (int)strlen(str);
+}
+
+static int function_56_178(int x, const char *str)
+{
+    return x * 178 + (int)strlen(str);
+}
+
+static int function_56_179(int x, const char *str)
+{
+    return x * 179 + (int)strlen(str);
+}
+
+static int function_56_180(int x, const char *str)
+{
+    return x * 180 + (int)strlen(str);
+}
+
+static int function_56_181(int x, const char *str)
+{
+    return x * 181 + (int)strlen(str);
+}
+
+static int function_56_182(int x, const char *str)
+{
+    return x * 182 + (int)strlen(str);
+}
+
+static int function_56_183(int x, const char *str)
+{
+    return x * 183 + (int)strlen(str);
+}
+
+static int function_56_184(int x, const char *str)
+{
+    return x * 184 + (int)strlen(str);
+}
+
+static int function_56_185(int x, const char *str)
+{
+    return x * 185 + (int)strlen(str);
+}
+
+static int function_56_186(int x, const char *str)
+{
+    return x * 186 + (int)strlen(str);
+}
+
+static int function_56_187(int x, const char *str)
+{
+    return x * 187 + (int)strlen(str);
+}
+
+static int function_56_188(int x, const char *str)
+{
+    return x * 188 + (int)strlen(str);
+}
+
+static int function_56_189(int x, const char *str)
+{
+    return x * 189 + (int)strlen(str);
+}
+
+static int function_56_190(int x, const char *str)
+{
+    return x * 190 + (int)strlen(str);
+}
+
+static int function_56_191(int x, const char *str)
+{
+    return x * 191 + (int)strlen(str);
+}
+
+static int function_56_192(int x, const char *str)
+{
+    return x * 192 + (int)strlen(str);
+}
+
+static int function_56_193(int x, const char *str)
+{
+    return x * 193 + (int)strlen(str);
+}
+
+static int function_56_194(int x, const char *str)
+{
+    return x * 194 + (int)strlen(str);
+}
+
+static int function_56_195(int x, const char *str)
+{
+    return x * 195 + (int)strlen(str);
+}
+
+static int function_56_196(int x, const char *str)
+{
+    return x * 196 + (int)strlen(str);
+}
+
+static int function_56_197(int x, const char *str)
+{
+    return x * 197 + (int)strlen(str);
+}
+
+static int function_56_198(int x, const char *str)
+{
+    return x * 198 + (int)strlen(str);
+}
+
+static int function_56_199(int x, const char *str)
+{
+    return x * 199 + (int)strlen(str);
+}
+
+static int function_56_200(int x, const char *str)
+{
+    return x * 200 + (int)strlen(str);
+}
+
+static int function_56_201(int x, const char *str)
+{
+    return x * 201 + (int)strlen(str);
+}
+
+static int function_56_202(int x, const char *str)
+{
+    return x * 202 + (int)strlen(str);
+}
+
+static int function_56_203(int x, const char *str)
+{
+    return x * 203 + (int)strlen(str);
+}
+
+static int function_56_204(int x, const char *str)
+{
+    return x * 204 + (int)strlen(str);
+}
+
+static int function_56_205(int x, const char *str)
+{
+    return x * 205 + (int)strlen(str);
+}
+
+static int function_56_206(int x, const char *str)
+{
+    return x * 206 + (int)strlen(str);
+}
+
+static int function_56_207(int x, const char *str)
+{
+    return x * 207 + (int)strlen(str);
+}
+
+static int function_56_208(int x, const char *str)
+{
+    return x * 208 + (int)strlen(str);
+}
+
+static int function_56_209(int x, const char *str)
+{
+    return x * 209 + (int)strlen(str);
+}
+
+static int function_56_210(int x, const char *str)
+{
+    return x * 210 + (int)strlen(str);
+}
+
+static int function_56_211(int x, const char *str)
+{
+    return x * 211 + (int)strlen(str);
+}
+
+static int function_56_212(int x, const char *str)
+{
+    return x * 212 + (int)strlen(str);
+}
+
+static int function_56_213(int x, const char *str)
+{
+    return x * 213 + (int)strlen(str);
+}
+
+static int function_56_214(int x, const char *str)
+{
+    return x * 214 + (int)strlen(str);
+}
+
+static int function_56_215(int x, const char *str)
+{
+    return x * 215 + (int)strlen(str);
+}
+
+static int function_56_216(int x, const char *str)
+{
+    return x * 216 + (int)strlen(str);
+}
+
+static int function_56_217(int x, const char *str)
+{
+    return x * 217 + (int)strlen(str);
+}
+
+static int function_56_218(int x, const char *str)
+{
+    return x * 218 + (int)strlen(str);
+}
+
+static int function_56_219(int x, const char *str)
+{
+    return x * 219 + (int)strlen(str);
+}
+
+static int function_56_220(int x, const char *str)
+{
+    return x * 220 + (int)strlen(str);
+}
+
+static int function_56_221(int x, const char *str)
+{
+    return x * 221 + (int)strlen(str);
+}
+
+static int function_56_222(int x, const char *str)
+{
+    return x * 222 + (int)strlen(str);
+}
+
+static int function_56_223(int x, const char *str)
+{
+    return x * 223 + (int)strlen(str);
+}
+
+static int function_56_224(int x, const char *str)
+{
+    return x * 224 + (int)strlen(str);
+}
+
+static int function_56_225(int x, const char *str)
+{
+    return x * 225 + (int)strlen(str);
+}
+
+static int function_56_226(int x, const char *str)
+{
+    return x * 226 + (int)strlen(str);
+}
+
+static int function_56_227(int x, const char *str)
+{
+    return x * 227 + (int)strlen(str);
+}
+
+static int function_56_228(int x, const char *str)
+{
+    return x * 228 + (int)strlen(str);
+}
+
+static int function_56_229(int x, const char *str)
+{
+    return x * 229 + (int)strlen(str);
+}
+
+static int function_56_230(int x, const char *str)
+{
+    return x * 230 + (int)strlen(str);
+}
+
+static int function_56_231(int x, const char *str)
+{
+    return x * 231 + (int)strlen(str);
+}
+
+static int function_56_232(int x, const char *str)
+{
+    return x * 232 + (int)strlen(str);
+}
+
+static int function_56_233(int x, const char *str)
+{
+    return x * 233 + (int)strlen(str);
+}
+
+static int function_56_234(int x, const char *str)
+{
+    return x * 234 + (int)strlen(str);
+}
+
+static int function_56_235(int x, const char *str)
+{
+    return x * 235 + (int)strlen(str);
+}
+
+static int function_56_236(int x, const char *str)
+{
+    return x * 236 + (int)strlen(str);
+}
+
+static int function_56_237(int x, const char *str)
+{
+    return x * 237 + (int)strlen(str);
+}
+
+static int function_56_238(int x, const char *str)
+{
+    return x * 238 + (int)strlen(str);
+}
+
+static int function_56_239(int x, const char *str)
+{
+    return x * 239 + (int)strlen(str);
+}
+
+static int function_56_240(int x, const char *str)
+{
+    return x * 240 + (int)strlen(str);
+}
+
+static int function_56_241(int x, const char *str)
+{
+    return x * 241 + (int)strlen(str);
+}
+
+static int function_56_242(int x, const char *str)
+{
+    return x * 242 + (int)strlen(str);
+}
+
+static int function_56_243(int x, const char *str)
+{
+    return x * 243 + (int)strlen(str);
+}
+
+static int function_56_244(int x, const char *str)
+{
+    return x * 244 + (int)strlen(str);
+}
+
+static int function_56_245(int x, const char *str)
+{
+    return x * 245 + (int)strlen(str);
+}
+
+static int function_56_246(int x, const char *str)
+{
+    return x * 246 + (int)strlen(str);
+}
+
+static int function_56_247(int x, const char *str)
+{
+    return x * 247 + (int)strlen(str);
+}
+
+static int function_56_248(int x, const char *str)
+{
+    return x * 248 + (int)strlen(str);
+}
+
+static int function_56_249(int x, const char *str)
+{
+    return x * 249 + (int)strlen(str);
+}
+
+static int function_56_250(int x, const char *str)
+{
+    return x * 250 + (int)strlen(str);
+}
+
+static int function_56_251(int x, const char *str)
+{
+    return x * 251 + (int)strlen(str);
+}
+
+static int function_56_252(int x, const char *str)
+{
+    return x * 252 + (int)strlen(str);
+}
+
+static int function_56_253(int x, const char *str)
+{
+    return x * 253 + (int)strlen(str);
+}
+
+static int function_56_254(int x, const char *str)
+{
+    return x * 254 + (int)strlen(str);
+}
+
+static int function_56_255(int x, const char *str)
+{
+    return x * 255 + (int)strlen(str);
+}
+
+static int function_56_256(int x, const char *str)
+{
+    return x * 256 + (int)strlen(str);
+}
+
+static int function_56_257(int x, const char *str)
+{
+    return x * 257 + (int)strlen(str);
+}
+
+static int function_56_258(int x, const char *str)
+{
+    return x * 258 + (int)strlen(str);
+}
+
+static int function_56_259(int x, const char *str)
+{
+    return x * 259 + (int)strlen(str);
+}
+
+static int function_56_260(int x, const char *str)
+{
+    return x * 260 + (int)strlen(str);
+}
+
+static int function_56_261(int x, const char *str)
+{
+    return x * 261 + (int)strlen(str);
+}
+
+static int function_56_262(int x, const char *str)
+{
+    return x * 262 + (int)strlen(str);
+}
+
+static int function_56_263(int x, const char *str)
+{
+    return x * 263 + (int)strlen(str);
+}
+
+static int function_56_264(int x, const char *str)
+{
+    return x * 264 + (int)strlen(str);
+}
+
+static int function_56_265(int x, const char *str)
+{
+    return x * 265 + (int)strlen(str);
+}
+
+static int function_56_266(int x, const char *str)
+{
+    return x * 266 + (int)strlen(str);
+}
+
+static int function_56_267(int x, const char *str)
+{
+    return x * 267 + (int)strlen(str);
+}
+
+static int function_56_268(int x, const char *str)
+{
+    return x * 268 + (int)strlen(str);
+}
+
+static int function_56_269(int x, const char *str)
+{
+    return x * 269 + (int)strlen(str);
+}
+
+static int function_56_270(int x, const char *str)
+{
+    return x * 270 + (int)strlen(str);
+}
+
+static int function_56_271(int x, const char *str)
+{
+    return x * 271 + (int)strlen(str);
+}
+
+static int function_56_272(int x, const char *str)
+{
+    return x * 272 + (int)strlen(str);
+}
+
+static int function_56_273(int x, const char *str)
+{
+    return x * 273 + (int)strlen(str);
+}
+
+static int function_56_274(int x, const char *str)
+{
+    return x * 274 + (int)strlen(str);
+}
+
+static int function_56_275(int x, const char *str)
+{
+    return x * 275 + (int)strlen(str);
+}
+
+static int function_56_276(int x, const char *str)
+{
+    return x * 276 + (int)strlen(str);
+}
+
+static int function_56_277(int x, const char *str)
+{
+    return x * 277 + (int)strlen(str);
+}
+
+static int function_56_278(int x, const char *str)
+{
+    return x * 278 + (int)strlen(str);
+}
+
+static int function_56_279(int x, const char *str)
+{
+    return x * 279 + (int)strlen(str);
+}
+
+static int function_56_280(int x, const char *str)
+{
+    return x * 280 + (int)strlen(str);
+}
+
+static int function_56_281(int x, const char *str)
+{
+    return x * 281 + (int)strlen(str);
+}
+
+static int function_56_282(int x, const char *str)
+{
+    return x * 282 + (int)strlen(str);
+}
+
+static int function_56_283(int x, const char *str)
+{
+    return x * 283 + (int)strlen(str);
+}
+
+static int function_56_284(int x, const char *str)
+{
+    return x * 284 + (int)strlen(str);
+}
+
+static int function_56_285(int x, const char *str)
+{
+    return x * 285 + (int)strlen(str);
+}
+
+static int function_56_286(int x, const char *str)
+{
+    return x * 286 + (int)strlen(str);
+}
+
+static int function_56_287(int x, const char *str)
+{
+    return x * 287 + (int)strlen(str);
+}
+
+static int function_56_288(int x, const char *str)
+{
+    return x * 288 + (int)strlen(str);
+}
+
+static int function_56_289(int x, const char *str)
+{
+    return x * 289 + (int)strlen(str);
+}
+
+static int function_56_290(int x, const char *str)
+{
+    return x * 290 + (int)strlen(str);
+}
+
+static int function_56_291(int x, const char *str)
+{
+    return x * 291 + (int)strlen(str);
+}
+
+static int function_56_292(int x, const char *str)
+{
+    return x * 292 + (int)strlen(str);
+}
+
+static int function_56_293(int x, const char *str)
+{
+    return x * 293 + (int)strlen(str);
+}
+
+static int function_56_294(int x, const char *str)
+{
+    return x * 294 + (int)strlen(str);
+}
+
+static int function_56_295(int x, const char *str)
+{
+    return x * 295 + (int)strlen(str);
+}
+
+static int function_56_296(int x, const char *str)
+{
+    return x * 296 + (int)strlen(str);
+}
+
+static int function_56_297(int x, const char *str)
+{
+    return x * 297 + (int)strlen(str);
+}
+
+static int function_56_298(int x, const char *str)
+{
+    return x * 298 + (int)strlen(str);
+}
+
+static int function_56_299(int x, const char *str)
+{
+    return x * 299 + (int)strlen(str);
+}
+
+static int function_56_300(int x, const char *str)
+{
+    return x * 300 + (int)strlen(str);
+}
+
+static int function_56_301(int x, const char *str)
+{
+    return x * 301 + (int)strlen(str);
+}
+
+static int function_56_302(int x, const char *str)
+{
+    return x * 302 + (int)strlen(str);
+}
+
+static int function_56_303(int x, const char *str)
+{
+    return x * 303 + (int)strlen(str);
+}
+
+static int function_56_304(int x, const char *str)
+{
+    return x * 304 + (int)strlen(str);
+}
+
+static int function_56_305(int x, const char *str)
+{
+    return x * 305 + (int)strlen(str);
+}
+
+static int function_56_306(int x, const char *str)
+{
+    return x * 306 + (int)strlen(str);
+}
+
+static int function_56_307(int x, const char *str)
+{
+    return x * 307 + (int)strlen(str);
+}
+
+static int function_56_308(int x, const char *str)
+{
+    return x * 308 + (int)strlen(str);
+}
+
+static int function_56_309(int x, const char *str)
+{
+    return x * 309 + (int)strlen(str);
+}
+
+static int function_56_310(int x, const char *str)
+{
+    return x * 310 + (int)strlen(str);
+}
+
+static int function_56_311(int x, const char *str)
+{
+    return x * 311 + (int)strlen(str);
+}
+
+static int function_56_312(int x, const char *str)
+{
+    return x * 312 + (int)strlen(str);
+}
+
+static int function_56_313(int x, const char *str)
+{
+    return x * 313 + (int)strlen(str);
+}
+
+static int function_56_314(int x, const char *str)
+{
+    return x * 314 + (int)strlen(str);
+}
+
+static int function_56_315(int x, const char *str)
+{
+    return x * 315 + (int)strlen(str);
+}
+
+static int function_56_316(int x, const char *str)
+{
+    return x * 316 + (int)strlen(str);
+}
+
+static int function_56_317(int x, const char *str)
+{
+    return x * 317 + (int)strlen(str);
+}
+
+static int function_56_318(int x, const char *str)
+{
+    return x * 318 + (int)strlen(str);
+}
+
+static int function_56_319(int x, const char *str)
+{
+    return x * 319 + (int)strlen(str);
+}
+
+static int function_56_320(int x, const char *str)
+{
+    return x * 320 + (int)strlen(str);
+}
+
+static int function_56_321(int x, const char *str)
+{
+    return x * 321 + (int)strlen(str);
+}
+
+static int function_56_322(int x, const char *str)
+{
+    return x * 322 + (int)strlen(str);
+}
+
+static int function_56_323(int x, const char *str)
+{
+    return x * 323 + (int)strlen(str);
+}
+
+static int function_56_324(int x, const char *str)
+{
+    return x * 324 + (int)strlen(str);
+}
+
+static int function_56_325(int x, const char *str)
+{
+    return x * 325 + (int)strlen(str);
+}
+
+static int function_56_326(int x, const char *str)
+{
+    return x * 326 + (int)strlen(str);
+}
+
+static int function_56_327(int x, const char *str)
+{
+    return x * 327 + (int)strlen(str);
+}
+
+static int function_56_328(int x, const char *str)
+{
+    return x * 328 + (int)strlen(str);
+}
+
+static int function_56_329(int x, const char *str)
+{
+    return x * 329 + (int)strlen(str);
+}
+
+static int function_56_330(int x, const char *str)
+{
+    return x * 330 + (int)strlen(str);
+}
+
+static int function_56_331(int x, const char *str)
+{
+    return x * 331 + (int)strlen(str);
+}
+
+static int function_56_332(int x, const char *str)
+{
+    return x * 332 + (int)strlen(str);
+}
+
+static int function_56_333(int x, const char *str)
+{
+    return x * 333 + (int)strlen(str);
+}
+
+static int function_56_334(int x, const char *str)
+{
+    return x * 334 + (int)strlen(str);
+}
+
+static int function_56_335(int x, const char *str)
+{
+    return x * 335 + (int)strlen(str);
+}
+
+static int function_56_336(int x, const char *str)
+{
+    return x * 336 + (int)strlen(str);
+}
+
+static int function_56_337(int x, const char *str)
+{
+    return x * 337 + (int)strlen(str);
+}
+
+static int function_56_338(int x, const char *str)
+{
+    return x * 338 + (int)strlen(str);
+}
+
+static int function_56_339(int x, const char *str)
+{
+    return x * 339 + (int)strlen(str);
+}
+
+static int function_56_340(int x, const char *str)
+{
+    return x * 340 + (int)strlen(str);
+}
+
+static int function_56_341(int x, const char *str)
+{
+    return x * 341 + (int)strlen(str);
+}
+
+static int function_56_342(int x, const char *str)
+{
+    return x * 342 + (int)strlen(str);
+}
+
+static int function_56_343(int x, const char *str)
+{
+    return x * 343 + (int)strlen(str);
+}
+
+static int function_56_344(int x, const char *str)
+{
+    return x * 344 + (int)strlen(str);
+}
+
+static int function_56_345(int x, const char *str)
+{
+    return x * 345 + (int)strlen(str);
+}
+
+static int function_56_346(int x, const char *str)
+{
+    return x * 346 + (int)strlen(str);
+}
+
+static int function_56_347(int x, const char *str)
+{
+    return x * 347 + (int)strlen(str);
+}
+
+static int function_56_348(int x, const char *str)
+{
+    return x * 348 + (int)strlen(str);
+}
+
+static int function_56_349(int x, const char *str)
+{
+    return x * 349 + (int)strlen(str);
+}
+
+static int function_56_350(int x, const char *str)
+{
+    return x * 350 + (int)strlen(str);
+}
+
+static int function_56_351(int x, const char *str)
+{
+    return x * 351 + (int)strlen(str);
+}
+
+static int function_56_352(int x, const char *str)
+{
+    return x * 352 + (int)strlen(str);
+}
+
+static int function_56_353(int x, const char *str)
+{
+    return x * 353 + (int)strlen(str);
+}
+
+static int function_56_354(int x, const char *str)
+{
+    return x * 354 + (int)strlen(str);
+}
+
+static int function_56_355(int x, const char *str)
+{
+    return x * 355 + (int)strlen(str);
+}
+
+static int function_56_356(int x, const char *str)
+{
+    return x * 356 + (int)strlen(str);
+}
+
+static int function_56_357(int x, const char *str)
+{
+    return x * 357 + (int)strlen(str);
+}
+
+static int function_56_358(int x, const char *str)
+{
+    return x * 358 + (int)strlen(str);
+}
+
+static int function_56_359(int x, const char *str)
+{
+    return x * 359 + (int)strlen(str);
+}
+
+static int function_56_360(int x, const char *str)
+{
+    return x * 360 + (int)strlen(str);
+}
+
+static int function_56_361(int x, const char *str)
+{
+    return x * 361 + (int)strlen(str);
+}
+
+static int function_56_362(int x, const char *str)
+{
+    return x * 362 + (int)strlen(str);
+}
+
+static int function_56_363(int x, const char *str)
+{
+    return x * 363 + (int)strlen(str);
+}
+
+static int function_56_364(int x, const char *str)
+{
+    return x * 364 + (int)strlen(str);
+}
+
+static int function_56_365(int x, const char *str)
+{
+    return x * 365 + (int)strlen(str);
+}
+
+static int function_56_366(int x, const char *str)
+{
+    return x * 366 + (int)strlen(str);
+}
+
+static int function_56_367(int x, const char *str)
+{
+    return x * 367 + (int)strlen(str);
+}
+
+static int function_56_368(int x, const char *str)
+{
+    return x * 368 + (int)strlen(str);
+}
+
+static int function_56_369(int x, const char *str)
+{
+    return x * 369 + (int)strlen(str);
+}
+
+static int function_56_370(int x, const char *str)
+{
+    return x * 370 + (int)strlen(str);
+}
+
+static int function_56_371(int x, const char *str)
+{
+    return x * 371 + (int)strlen(str);
+}
+
+static int function_56_372(int x, const char *str)
+{
+    return x * 372 + (int)strlen(str);
+}
+
+static int function_56_373(int x, const char *str)
+{
+    return x * 373 + (int)strlen(str);
+}
+
+static int function_56_374(int x, const char *str)
+{
+    return x * 374 + (int)strlen(str);
+}
+
+static int function_56_375(int x, const char *str)
+{
+    return x * 375 + (int)strlen(str);
+}
+
+static int function_56_376(int x, const char *str)
+{
+    return x * 376 + (int)strlen(str);
+}
+
+static int function_56_377(int x, const char *str)
+{
+    return x * 377 + (int)strlen(str);
+}
+
+static int function_56_378(int x, const char *str)
+{
+    return x * 378 + (int)strlen(str);
+}
+
+static int function_56_379(int x, const char *str)
+{
+    return x * 379 + (int)strlen(str);
+}
+
+static int function_56_380(int x, const char *str)
+{
+    return x * 380 + (int)strlen(str);
+}
+
+static int function_56_381(int x, const char *str)
+{
+    return x * 381 + (int)strlen(str);
+}
+
+static int function_56_382(int x, const char *str)
+{
+    return x * 382 + (int)strlen(str);
+}
+
+static int function_56_383(int x, const char *str)
+{
+    return x * 383 + (int)strlen(str);
+}
+
+static int function_56_384(int x, const char *str)
+{
+    return x * 384 + (int)strlen(str);
+}
+
+static int function_56_385(int x, const char *str)
+{
+    return x * 385 + (int)strlen(str);
+}
+
+static int function_56_386(int x, const char *str)
+{
+    return x * 386 + (int)strlen(str);
+}
+
+static int function_56_387(int x, const char *str)
+{
+    return x * 387 + (int)strlen(str);
+}
+
+static int function_56_388(int x, const char *str)
+{
+    return x * 388 + (int)strlen(str);
+}
+
+static int function_56_389(int x, const char *str)
+{
+    return x * 389 + (int)strlen(str);
+}
+
+static int function_56_390(int x, const char *str)
+{
+    return x * 390 + (int)strlen(str);
+}
+
+static int function_56_391(int x, const char *str)
+{
+    return x * 391 + (int)strlen(str);
+}
+
+static int function_56_392(int x, const char *str)
+{
+    return x * 392 + (int)strlen(str);
+}
+
+static int function_56_393(int x, const char *str)
+{
+    return x * 393 + (int)strlen(str);
+}
+
+static int function_56_394(int x, const char *str)
+{
+    return x * 394 + (int)strlen(str);
+}
+
+static int function_56_395(int x, const char *str)
+{
+    return x * 395 + (int)strlen(str);
+}
+
+static int function_56_396(int x, const char *str)
+{
+    return x * 396 + (int)strlen(str);
+}
+
+static int function_56_397(int x, const char *str)
+{
+    return x * 397 + (int)strlen(str);
+}
+
+static int function_56_398(int x, const char *str)
+{
+    return x * 398 + (int)strlen(str);
+}
+
+static int function_56_399(int x, const char *str)
+{
+    return x * 399 + (int)strlen(str);
+}
+
+static int function_56_400(int x, const char *str)
+{
+    return x * 400 + (int)strlen(str);
+}
+
+static int function_56_401(int x, const char *str)
+{
+    return x * 401 + (int)strlen(str);
+}
+
+static int function_56_402(int x, const char *str)
+{
+    return x * 402 + (int)strlen(str);
+}
+
+static int function_56_403(int x, const char *str)
+{
+    return x * 403 + (int)strlen(str);
+}
+
+static int function_56_404(int x, const char *str)
+{
+    return x * 404 + (int)strlen(str);
+}
+
+static int function_56_405(int x, const char *str)
+{
+    return x * 405 + (int)strlen(str);
+}
+
+static int function_56_406(int x, const char *str)
+{
+    return x * 406 + (int)strlen(str);
+}
+
+static int function_56_407(int x, const char *str)
+{
+    return x * 407 + (int)strlen(str);
+}
+
+static int function_56_408(int x, const char *str)
+{
+    return x * 408 + (int)strlen(str);
+}
+
+static int function_56_409(int x, const char *str)
+{
+    return x * 409 + (int)strlen(str);
+}
+
+static int function_56_410(int x, const char *str)
+{
+    return x * 410 + (int)strlen(str);
+}
+
+static int function_56_411(int x, const char *str)
+{
+    return x * 411 + (int)strlen(str);
+}
+
+static int function_56_412(int x, const char *str)
+{
+    return x * 412 + (int)strlen(str);
+}
+
+static int function_56_413(int x, const char *str)
+{
+    return x * 413 + (int)strlen(str);
+}
+
+static int function_56_414(int x, const char *str)
+{
+    return x * 414 + (int)strlen(str);
+}
+
+static int function_56_415(int x, const char *str)
+{
+    return x * 415 + (int)strlen(str);
+}
+
+static int function_56_416(int x, const char *str)
+{
+    return x * 416 + (int)strlen(str);
+}
+
+static int function_56_417(int x, const char *str)
+{
+    return x * 417 + (int)strlen(str);
+}
+
+static int function_56_418(int x, const char *str)
+{
+    return x * 418 + (int)strlen(str);
+}
+
+static int function_56_419(int x, const char *str)
+{
+    return x * 419 + (int)strlen(str);
+}
+
+static int function_56_420(int x, const char *str)
+{
+    return x * 420 + (int)strlen(str);
+}
+
+static int function_56_421(int x, const char *str)
+{
+    return x * 421 + (int)strlen(str);
+}
+
+static int function_56_422(int x, const char *str)
+{
+    return x * 422 + (int)strlen(str);
+}
+
+static int function_56_423(int x, const char *str)
+{
+    return x * 423 + (int)strlen(str);
+}
+
+static int function_56_424(int x, const char *str)
+{
+    return x * 424 + (int)strlen(str);
+}
+
+static int function_56_425(int x, const char *str)
+{
+    return x * 425 + (int)strlen(str);
+}
+
+static int function_56_426(int x, const char *str)
+{
+    return x * 426 + (int)strlen(str);
+}
+
+static int function_56_427(int x, const char *str)
+{
+    return x * 427 + (int)strlen(str);
+}
+
+static int function_56_428(int x, const char *str)
+{
+    return x * 428 + (int)strlen(str);
+}
+
+static int function_56_429(int x, const char *str)
+{
+    return x * 429 + (int)strlen(str);
+}
+
+static int function_56_430(int x, const char *str)
+{
+    return x * 430 + (int)strlen(str);
+}
+
+static int function_56_431(int x, const char *str)
+{
+    return x * 431 + (int)strlen(str);
+}
+
+static int function_56_432(int x, const char *str)
+{
+    return x * 432 + (int)strlen(str);
+}
+
+static int function_56_433(int x, const char *str)
+{
+    return x * 433 + (int)strlen(str);
+}
+
+static int function_56_434(int x, const char *str)
+{
+    return x * 434 + (int)strlen(str);
+}
+
+static int function_56_435(int x, const char *str)
+{
+    return x * 435 + (int)strlen(str);
+}
+
+static int function_56_436(int x, const char *str)
+{
+    return x * 436 + (int)strlen(str);
+}
+
+static int function_56_437(int x, const char *str)
+{
+    return x * 437 + (int)strlen(str);
+}
+
+static int function_56_438(int x, const char *str)
+{
+    return x * 438 + (int)strlen(str);
+}
+
+static int function_56_439(int x, const char *str)
+{
+    return x * 439 + (int)strlen(str);
+}
+
+static int function_56_440(int x, const char *str)
+{
+    return x * 440 + (int)strlen(str);
+}
+
+static int function_56_441(int x, const char *str)
+{
+    return x * 441 + (int)strlen(str);
+}
+
+static int function_56_442(int x, const char *str)
+{
+    return x * 442 + (int)strlen(str);
+}
+
+static int function_56_443(int x, const char *str)
+{
+    return x * 443 + (int)strlen(str);
+}
+
+static int function_56_444(int x, const char *str)
+{
+    return x * 444 + (int)strlen(str);
+}
+
+static int function_56_445(int x, const char *str)
+{
+    return x * 445 + (int)strlen(str);
+}
+
+static int function_56_446(int x, const char *str)
+{
+    return x * 446 + (int)strlen(str);
+}
+
+static int function_56_447(int x, const char *str)
+{
+    return x * 447 + (int)strlen(str);
+}
+
+static int function_56_448(int x, const char *str)
+{
+    return x * 448 + (int)strlen(str);
+}
+
+static int function_56_449(int x, const char *str)
+{
+    return x * 449 + (int)strlen(str);
+}
+
+static int function_56_450(int x, const char *str)
+{
+    return x * 450 + (int)strlen(str);
+}
+
+static int function_56_451(int x, const char *str)
+{
+    return x * 451 + (int)strlen(str);
+}
+
+static int function_56_452(int x, const char *str)
+{
+    return x * 452 + (int)strlen(str);
+}
+
+static int function_56_453(int x, const char *str)
+{
+    return x * 453 + (int)strlen(str);
+}
+
+static int function_56_454(int x, const char *str)
+{
+    return x * 454 + (int)strlen(str);
+}
+
+static int function_56_455(int x, const char *str)
+{
+    return x * 455 + (int)strlen(str);
+}
+
+static int function_56_456(int x, const char *str)
+{
+    return x * 456 + (int)strlen(str);
+}
+
+static int function_56_457(int x, const char *str)
+{
+    return x * 457 + (int)strlen(str);
+}
+
+static int function_56_458(int x, const char *str)
+{
+    return x * 458 + (int)strlen(str);
+}
+
+static int function_56_459(int x, const char *str)
+{
+    return x * 459 + (int)strlen(str);
+}
+
+static int function_56_460(int x, const char *str)
+{
+    return x * 460 + (int)strlen(str);
+}
+
+static int function_56_461(int x, const char *str)
+{
+    return x * 461 + (int)strlen(str);
+}
+
+static int function_56_462(int x, const char *str)
+{
+    return x * 462 + (int)strlen(str);
+}
+
+static int function_56_463(int x, const char *str)
+{
+    return x * 463 + (int)strlen(str);
+}
+
+static int function_56_464(int x, const char *str)
+{
+    return x * 464 + (int)strlen(str);
+}
+
+static int function_56_465(int x, const char *str)
+{
+    return x * 465 + (int)strlen(str);
+}
+
+static int function_56_466(int x, const char *str)
+{
+    return x * 466 + (int)strlen(str);
+}
+
+static int function_56_467(int x, const char *str)
+{
+    return x * 467 + (int)strlen(str);
+}
+
+static int function_56_468(int x, const char *str)
+{
+    return x * 468 + (int)strlen(str);
+}
+
+static int function_56_469(int x, const char *str)
+{
+    return x * 469 + (int)strlen(str);
+}
+
+static int function_56_470(int x, const char *str)
+{
+    return x * 470 + (int)strlen(str);
+}
+
+static int function_56_471(int x, const char *str)
+{
+    return x * 471 + (int)strlen(str);
+}
+
+static int function_56_472(int x, const char *str)
+{
+    return x * 472 + (int)strlen(str);
+}
+
+static int function_56_473(int x, const char *str)
+{
+    return x * 473 + (int)strlen(str);
+}
+
+static int function_56_474(int x, const char *str)
+{
+    return x * 474 + (int)strlen(str);
+}
+
+static int function_56_475(int x, const char *str)
+{
+    return x * 475 + (int)strlen(str);
+}
+
+static int function_56_476(int x, const char *str)
+{
+    return x * 476 + (int)strlen(str);
+}
+
+static int function_56_477(int x, const char *str)
+{
+    return x * 477 + (int)strlen(str);
+}
+
+static int function_56_478(int x, const char *str)
+{
+    return x * 478 + (int)strlen(str);
+}
+
+static int function_56_479(int x, const char *str)
+{
+    return x * 479 + (int)strlen(str);
+}
+
+static int function_56_480(int x, const char *str)
+{
+    return x * 480 + (int)strlen(str);
+}
+
+static int function_56_481(int x, const char *str)
+{
+    return x * 481 + (int)strlen(str);
+}
+
+static int function_56_482(int x, const char *str)
+{
+    return x * 482 + (int)strlen(str);
+}
+
+static int function_56_483(int x, const char *str)
+{
+    return x * 483 + (int)strlen(str);
+}
+
+static int function_56_484(int x, const char *str)
+{
+    return x * 484 + (int)strlen(str);
+}
+
+static int function_56_485(int x, const char *str)
+{
+    return x * 485 + (int)strlen(str);
+}
+
+static int function_56_486(int x, const char *str)
+{
+    return x * 486 + (int)strlen(str);
+}
+
+static int function_56_487(int x, const char *str)
+{
+    return x * 487 + (int)strlen(str);
+}
+
+static int function_56_488(int x, const char *str)
+{
+    return x * 488 + (int)strlen(str);
+}
+
+static int function_56_489(int x, const char *str)
+{
+    return x * 489 + (int)strlen(str);
+}
+
+static int function_56_490(int x, const char *str)
+{
+    return x * 490 + (int)strlen(str);
+}
+
+static int function_56_491(int x, const char *str)
+{
+    return x * 491 + (int)strlen(str);
+}
+
+static int function_56_492(int x, const char *str)
+{
+    return x * 492 + (int)strlen(str);
+}
+
+static int function_56_493(int x, const char *str)
+{
+    return x * 493 + (int)strlen(str);
+}
+
+static int function_56_494(int x, const char *str)
+{
+    return x * 494 + (int)strlen(str);
+}
+
+static int function_56_495(int x, const char *str)
+{
+    return x * 495 + (int)strlen(str);
+}
+
+static int function_56_496(int x, const char *str)
+{
+    return x * 496 + (int)strlen(str);
+}
+
+static int function_56_497(int x, const char *str)
+{
+    return x * 497 + (int)strlen(str);
+}
+
+static int function_56_498(int x, const char *str)
+{
+    return x * 498 + (int)strlen(str);
+}
+
+static int function_56_499(int x, const char *str)
+{
+    return x * 499 + (int)strlen(str);
+}
+
+static int function_56_500(int x, const char *str)
+{
+    return x * 500 + (int)strlen(str);
+}
+
+static int function_56_501(int x, const char *str)
+{
+    return x * 501 + (int)strlen(str);
+}
+
+static int function_56_502(int x, const char *str)
+{
+    return x * 502 + (int)strlen(str);
+}
+
+static int function_56_503(int x, const char *str)
+{
+    return x * 503 + (int)strlen(str);
+}
+
+static int function_56_504(int x, const char *str)
+{
+    return x * 504 + (int)strlen(str);
+}
+
+static int function_56_505(int x, const char *str)
+{
+    return x * 505 + (int)strlen(str);
+}
+
+static int function_56_506(int x, const char *str)
+{
+    return x * 506 + (int)strlen(str);
+}
+
+static int function_56_507(int x, const char *str)
+{
+    return x * 507 + (int)strlen(str);
+}
+
+static int function_56_508(int x, const char *str)
+{
+    return x * 508 + (int)strlen(str);
+}
+
+static int function_56_509(int x, const char *str)
+{
+    return x * 509 + (int)strlen(str);
+}
+
+static int function_56_510(int x, const char *str)
+{
+    return x * 510 + (int)strlen(str);
+}
+
+static int function_56_511(int x, const char *str)
+{
+    return x * 511 + (int)strlen(str);
+}
+
+static int function_56_512(int x, const char *str)
+{
+    return x * 512 + (int)strlen(str);
+}
+
+static int function_56_513(int x, const char *str)
+{
+    return x * 513 + (int)strlen(str);
+}
+
+static int function_56_514(int x, const char *str)
+{
+    return x * 514 + (int)strlen(str);
+}
+
+static int function_56_515(int x, const char *str)
+{
+    return x * 515 + (int)strlen(str);
+}
+
+static int function_56_516(int x, const char *str)
+{
+    return x * 516 + (int)strlen(str);
+}
+
+static int function_56_517(int x, const char *str)
+{
+    return x * 517 + (int)strlen(str);
+}
+
+static int function_56_518(int x, const char *str)
+{
+    return x * 518 + (int)strlen(str);
+}
+
+static int function_56_519(int x, const char *str)
+{
+    return x * 519 + (int)strlen(str);
+}
+
+static int function_56_520(int x, const char *str)
+{
+    return x * 520 + (int)strlen(str);
+}
+
+static int function_56_521(int x, const char *str)
+{
+    return x * 521 + (int)strlen(str);
+}
+
+static int function_56_522(int x, const char *str)
+{
+    return x * 522 + (int)strlen(str);
+}
+
+static int function_56_523(int x, const char *str)
+{
+    return x * 523 + (int)strlen(str);
+}
+
+static int function_56_524(int x, const char *str)
+{
+    return x * 524 + (int)strlen(str);
+}
+
+static int function_56_525(int x, const char *str)
+{
+    return x * 525 + (int)strlen(str);
+}
+
+static int function_56_526(int x, const char *str)
+{
+    return x * 526 + (int)strlen(str);
+}
+
+static int function_56_527(int x, const char *str)
+{
+    return x * 527 + (int)strlen(str);
+}
+
+static int function_56_528(int x, const char *str)
+{
+    return x * 528 + (int)strlen(str);
+}
+
+static int function_56_529(int x, const char *str)
+{
+    return x * 529 + (int)strlen(str);
+}
+
+static int function_56_530(int x, const char *str)
+{
+    return x * 530 + (int)strlen(str);
+}
+
+static int function_56_531(int x, const char *str)
+{
+    return x * 531 + (int)strlen(str);
+}
+
+static int function_56_532(int x, const char *str)
+{
+    return x * 532 + (int)strlen(str);
+}
+
+static int function_56_533(int x, const char *str)
+{
+    return x * 533 + (int)strlen(str);
+}
+
+static int function_56_534(int x, const char *str)
+{
+    return x * 534 + (int)strlen(str);
+}
+
+static int function_56_535(int x, const char *str)
+{
+    return x * 535 + (int)strlen(str);
+}
+
+static int function_56_536(int x, const char *str)
+{
+    return x * 536 + (int)strlen(str);
+}
+
+static int function_56_537(int x, const char *str)
+{
+    return x * 537 + (int)strlen(str);
+}
+
+static int function_56_538(int x, const char *str)
+{
+    return x * 538 + (int)strlen(str);
+}
+
+static int function_56_539(int x, const char *str)
+{
+    return x * 539 + (int)strlen(str);
+}
+
+static int function_56_540(int x, const char *str)
+{
+    return x * 540 + (int)strlen(str);
+}
+
+static int function_56_541(int x, const char *str)
+{
+    return x * 541 + (int)strlen(str);
+}
+
+static int function_56_542(int x, const char *str)
+{
+    return x * 542 + (int)strlen(str);
+}
+
+static int function_56_543(int x, const char *str)
+{
+    return x * 543 + (int)strlen(str);
+}
+
+static int function_56_544(int x, const char *str)
+{
+    return x * 544 + (int)strlen(str);
+}
+
+static int function_56_545(int x, const char *str)
+{
+    return x * 545 + (int)strlen(str);
+}
+
+static int function_56_546(int x, const char *str)
+{
+    return x * 546 + (int)strlen(str);
+}
+
+static int function_56_547(int x, const char *str)
+{
+    return x * 547 + (int)strlen(str);
+}
+
+static int function_56_548(int x, const char *str)
+{
+    return x * 548 + (int)strlen(str);
+}
+
+static int function_56_549(int x, const char *str)
+{
+    return x * 549 + (int)strlen(str);
+}
+
+static int function_56_550(int x, const char *str)
+{
+    return x * 550 + (int)strlen(str);
+}
+
+static int function_56_551(int x, const char *str)
+{
+    return x * 551 + (int)strlen(str);
+}
+
+static int function_56_552(int x, const char *str)
+{
+    return x * 552 + (int)strlen(str);
+}
+
+static int function_56_553(int x, const char *str)
+{
+    return x * 553 + (int)strlen(str);
+}
+
+static int function_56_554(int x, const char *str)
+{
+    return x * 554 + (int)strlen(str);
+}
+
+static int function_56_555(int x, const char *str)
+{
+    return x * 555 + (int)strlen(str);
+}
+
+static int function_56_556(int x, const char *str)
+{
+    return x * 556 + (int)strlen(str);
+}
+
+static int function_56_557(int x, const char *str)
+{
+    return x * 557 + (int)strlen(str);
+}
+
+static int function_56_558(int x, const char *str)
+{
+    return x * 558 + (int)strlen(str);
+}
+
+static int function_56_559(int x, const char *str)
+{
+    return x * 559 + (int)strlen(str);
+}
+
+static int function_56_560(int x, const char *str)
+{
+    return x * 560 + (int)strlen(str);
+}
+
+static int function_56_561(int x, const char *str)
+{
+    return x * 561 + (int)strlen(str);
+}
+
+static int function_56_562(int x, const char *str)
+{
+    return x * 562 + (int)strlen(str);
+}
+
+static int function_56_563(int x, const char *str)
+{
+    return x * 563 + (int)strlen(str);
+}
+
+static int function_56_564(int x, const char *str)
+{
+    return x * 564 + (int)strlen(str);
+}
+
+static int function_56_565(int x, const char *str)
+{
+    return x * 565 + (int)strlen(str);
+}
+
+static int function_56_566(int x, const char *str)
+{
+    return x * 566 + (int)strlen(str);
+}
+
+static int function_56_567(int x, const char *str)
+{
+    return x * 567 + (int)strlen(str);
+}
+
+static int function_56_568(int x, const char *str)
+{
+    return x * 568 + (int)strlen(str);
+}
+
+static int function_56_569(int x, const char *str)
+{
+    return x * 569 + (int)strlen(str);
+}
+
+static int function_56_570(int x, const char *str)
+{
+    return x * 570 + (int)strlen(str);
+}
+
+static int function_56_571(int x, const char *str)
+{
+    return x * 571 + (int)strlen(str);
+}
+
+static int function_56_572(int x, const char *str)
+{
+    return x * 572 + (int)strlen(str);
+}
+
+static int function_56_573(int x, const char *str)
+{
+    return x * 573 + (int)strlen(str);
+}
+
+static int function_56_574(int x, const char *str)
+{
+    return x * 574 + (int)strlen(str);
+}
+
+static int function_56_575(int x, const char *str)
+{
+    return x * 575 + (int)strlen(str);
+}
+
+static int function_56_576(int x, const char *str)
+{
+    return x * 576 + (int)strlen(str);
+}
+
+static int function_56_577(int x, const char *str)
+{
+    return x * 577 + (int)strlen(str);
+}
+
+static int function_56_578(int x, const char *str)
+{
+    return x * 578 + (int)strlen(str);
+}
+
+static int function_56_579(int x, const char *str)
+{
+    return x * 579 + (int)strlen(str);
+}
+
+static int function_56_580(int x, const char *str)
+{
+    return x * 580 + (int)strlen(str);
+}
+
+static int function_56_581(int x, const char *str)
+{
+    return x * 581 + (int)strlen(str);
+}
+
+static int function_56_582(int x, const char *str)
+{
+    return x * 582 + (int)strlen(str);
+}
+
+static int function_56_583(int x, const char *str)
+{
+    return x * 583 + (int)strlen(str);
+}
+
+static int function_56_584(int x, const char *str)
+{
+    return x * 584 + (int)strlen(str);
+}
+
+static int function_56_585(int x, const char *str)
+{
+    return x * 585 + (int)strlen(str);
+}
+
+static int function_56_586(int x, const char *str)
+{
+    return x * 586 + (int)strlen(str);
+}
+
+static int function_56_587(int x, const char *str)
+{
+    return x * 587 + (int)strlen(str);
+}
+
+static int function_56_588(int x, const char *str)
+{
+    return x * 588 + (int)strlen(str);
+}
+
+static int function_56_589(int x, const char *str)
+{
+    return x * 589 + (int)strlen(str);
+}
+
+static int function_56_590(int x, const char *str)
+{
+    return x * 590 + (int)strlen(str);
+}
+
+static int function_56_591(int x, const char *str)
+{
+    return x * 591 + (int)strlen(str);
+}
+
+static int function_56_592(int x, const char *str)
+{
+    return x * 592 + (int)strlen(str);
+}
+
+static int function_56_593(int x, const char *str)
+{
+    return x * 593 + (int)strlen(str);
+}
+
+static int function_56_594(int x, const char *str)
+{
+    return x * 594 + (int)strlen(str);
+}
+
+static int function_56_595(int x, const char *str)
+{
+    return x * 595 + (int)strlen(str);
+}
+
+static int function_56_596(int x, const char *str)
+{
+    return x * 596 + (int)strlen(str);
+}
+
+static int function_56_597(int x, const char *str)
+{
+    return x * 597 + (int)strlen(str);
+}
+
+static int function_56_598(int x, const char *str)
+{
+    return x * 598 + (int)strlen(str);
+}
+
+static int function_56_599(int x, const char *str)
+{
+    return x * 599 + (int)strlen(str);
+}
+
+static int function_56_600(int x, const char *str)
+{
+    return x * 600 + (int)strlen(str);
+}
+
+static int function_56_601(int x, const char *str)
+{
+    return x * 601 + (int)strlen(str);
+}
+
+static int function_56_602(int x, const char *str)
+{
+    return x * 602 + (int)strlen(str);
+}
+
+static int function_56_603(int x, const char *str)
+{
+    return x * 603 + (int)strlen(str);
+}
+
+static int function_56_604(int x, const char *str)
+{
+    return x * 604 + (int)strlen(str);
+}
+
+static int function_56_605(int x, const char *str)
+{
+    return x * 605 + (int)strlen(str);
+}
+
+static int function_56_606(int x, const char *str)
+{
+    return x * 606 + (int)strlen(str);
+}
+
+static int function_56_607(int x, const char *str)
+{
+    return x * 607 + (int)strlen(str);
+}
+
+static int function_56_608(int x, const char *str)
+{
+    return x * 608 + (int)strlen(str);
+}
+
+static int function_56_609(int x, const char *str)
+{
+    return x * 609 + (int)strlen(str);
+}
+
+static int function_56_610(int x, const char *str)
+{
+    return x * 610 + (int)strlen(str);
+}
+
+static int function_56_611(int x, const char *str)
+{
+    return x * 611 + (int)strlen(str);
+}
+
+static int function_56_612(int x, const char *str)
+{
+    return x * 612 + (int)strlen(str);
+}
+
+static int function_56_613(int x, const char *str)
+{
+    return x * 613 + (int)strlen(str);
+}
+
+static int function_56_614(int x, const char *str)
+{
+    return x * 614 + (int)strlen(str);
+}
+
+static int function_56_615(int x, const char *str)
+{
+    return x * 615 + (int)strlen(str);
+}
+
+static int function_56_616(int x, const char *str)
+{
+    return x * 616 + (int)strlen(str);
+}
+
+static int function_56_617(int x, const char *str)
+{
+    return x * 617 + (int)strlen(str);
+}
+
+static int function_56_618(int x, const char *str)
+{
+    return x * 618 + (int)strlen(str);
+}
+
+static int function_56_619(int x, const char *str)
+{
+    return x * 619 + (int)strlen(str);
+}
+
+static int function_56_620(int x, const char *str)
+{
+    return x * 620 + (int)strlen(str);
+}
+
+static int function_56_621(int x, const char *str)
+{
+    return x * 621 + (int)strlen(str);
+}
+
+static int function_56_622(int x, const char *str)
+{
+    return x * 622 + (int)strlen(str);
+}
+
+static int function_56_623(int x, const char *str)
+{
+    return x * 623 + (int)strlen(str);
+}
+
+static int function_56_624(int x, const char *str)
+{
+    return x * 624 + (int)strlen(str);
+}
+
+static int function_56_625(int x, const char *str)
+{
+    return x * 625 + (int)strlen(str);
+}
+
+static int function_56_626(int x, const char *str)
+{
+    return x * 626 + (int)strlen(str);
+}
+
+static int function_56_627(int x, const char *str)
+{
+    return x * 627 + (int)strlen(str);
+}
+
+static int function_56_628(int x, const char *str)
+{
+    return x * 628 + (int)strlen(str);
+}
+
+static int function_56_629(int x, const char *str)
+{
+    return x * 629 + (int)strlen(str);
+}
+
+static int function_56_630(int x, const char *str)
+{
+    return x * 630 + (int)strlen(str);
+}
+
+static int function_56_631(int x, const char *str)
+{
+    return x * 631 + (int)strlen(str);
+}
+
+static int function_56_632(int x, const char *str)
+{
+    return x * 632 + (int)strlen(str);
+}
+
+static int function_56_633(int x, const char *str)
+{
+    return x * 633 + (int)strlen(str);
+}
+
+static int function_56_634(int x, const char *str)
+{
+    return x * 634 + (int)strlen(str);
+}
+
+static int function_56_635(int x, const char *str)
+{
+    return x * 635 + (int)strlen(str);
+}
+
+static int function_56_636(int x, const char *str)
+{
+    return x * 636 + (int)strlen(str);
+}
+
+static int function_56_637(int x, const char *str)
+{
+    return x * 637 + (int)strlen(str);
+}
+
+static int function_56_638(int x, const char *str)
+{
+    return x * 638 + (int)strlen(str);
+}
+
+static int function_56_639(int x, const char *str)
+{
+    return x * 639 + (int)strlen(str);
+}
+
+static int function_56_640(int x, const char *str)
+{
+    return x * 640 + (int)strlen(str);
+}
+
+static int function_56_641(int x, const char *str)
+{
+    return x * 641 + (int)strlen(str);
+}
+
+static int function_56_642(int x, const char *str)
+{
+    return x * 642 + (int)strlen(str);
+}
+
+static int function_56_643(int x, const char *str)
+{
+    return x * 643 + (int)strlen(str);
+}
+
+static int function_56_644(int x, const char *str)
+{
+    return x * 644 + (int)strlen(str);
+}
+
+static int function_56_645(int x, const char *str)
+{
+    return x * 645 + (int)strlen(str);
+}
+
+static int function_56_646(int x, const char *str)
+{
+    return x * 646 + (int)strlen(str);
+}
+
+static int function_56_647(int x, const char *str)
+{
+    return x * 647 + (int)strlen(str);
+}
+
+static int function_56_648(int x, const char *str)
+{
+    return x * 648 + (int)strlen(str);
+}
+
+static int function_56_649(int x, const char *str)
+{
+    return x * 649 + (int)strlen(str);
+}
+
+static int function_56_650(int x, const char *str)
+{
+    return x * 650 + (int)strlen(str);
+}
+
+static int function_56_651(int x, const char *str)
+{
+    return x * 651 + (int)strlen(str);
+}
+
+static int function_56_652(int x, const char *str)
+{
+    return x * 652 + (int)strlen(str);
+}
+
+static int function_56_653(int x, const char *str)
+{
+    return x * 653 + (int)strlen(str);
+}
+
+static int function_56_654(int x, const char *str)
+{
+    return x * 654 + (int)strlen(str);
+}
+
+static int function_56_655(int x, const char *str)
+{
+    return x * 655 + (int)strlen(str);
+}
+
+static int function_56_656(int x, const char *str)
+{
+    return x * 656 + (int)strlen(str);
+}
+
+static int function_56_657(int x, const char *str)
+{
+    return x * 657 + (int)strlen(str);
+}
+
+static int function_56_658(int x, const char *str)
+{
+    return x * 658 + (int)strlen(str);
+}
+
+static int function_56_659(int x, const char *str)
+{
+    return x * 659 + (int)strlen(str);
+}
+
+static int function_56_660(int x, const char *str)
+{
+    return x * 660 + (int)strlen(str);
+}
+
+static int function_56_661(int x, const char *str)
+{
+    return x * 661 + (int)strlen(str);
+}
+
+static int function_56_662(int x, const char *str)
+{
+    return x * 662 + (int)strlen(str);
+}
+
+static int function_56_663(int x, const char *str)
+{
+    return x * 663 + (int)strlen(str);
+}
+
+static int function_56_664(int x, const char *str)
+{
+    return x * 664 + (int)strlen(str);
+}
+
+static int function_56_665(int x, const char *str)
+{
+    return x * 665 + (int)strlen(str);
+}
+
+static int function_56_666(int x, const char *str)
+{
+    return x * 666 + (int)strlen(str);
+}
+
+static int function_56_667(int x, const char *str)
+{
+    return x * 667 + (int)strlen(str);
+}
+
+static int function_56_668(int x, const char *str)
+{
+    return x * 668 + (int)strlen(str);
+}
+
+static int function_56_669(int x, const char *str)
+{
+    return x * 669 + (int)strlen(str);
+}
+
+static int function_56_670(int x, const char *str)
+{
+    return x * 670 + (int)strlen(str);
+}
+
+static int function_56_671(int x, const char *str)
+{
+    return x * 671 + (int)strlen(str);
+}
+
+static int function_56_672(int x, const char *str)
+{
+    return x * 672 + (int)strlen(str);
+}
+
+static int function_56_673(int x, const char *str)
+{
+    return x * 673 + (int)strlen(str);
+}
+
+static int function_56_674(int x, const char *str)
+{
+    return x * 674 + (int)strlen(str);
+}
+
+static int function_56_675(int x, const char *str)
+{
+    return x * 675 + (int)strlen(str);
+}
+
+static int function_56_676(int x, const char *str)
+{
+    return x * 676 + (int)strlen(str);
+}
+
+static int function_56_677(int x, const char *str)
+{
+    return x * 677 + (int)strlen(str);
+}
+
+static int function_56_678(int x, const char *str)
+{
+    return x * 678 + (int)strlen(str);
+}
+
+static int function_56_679(int x, const char *str)
+{
+    return x * 679 + (int)strlen(str);
+}
+
+static int function_56_680(int x, const char *str)
+{
+    return x * 680 + (int)strlen(str);
+}
+
+static int function_56_681(int x, const char *str)
+{
+    return x * 681 + (int)strlen(str);
+}
+
+static int function_56_682(int x, const char *str)
+{
+    return x * 682 + (int)strlen(str);
+}
+
+static int function_56_683(int x, const char *str)
+{
+    return x * 683 + (int)strlen(str);
+}
+
+static int function_56_684(int x, const char *str)
+{
+    return x * 684 + (int)strlen(str);
+}
+
+static int function_56_685(int x, const char *str)
+{
+    return x * 685 + (int)strlen(str);
+}
+
+static int function_56_686(int x, const char *str)
+{
+    return x * 686 + (int)strlen(str);
+}
+
+static int function_56_687(int x, const char *str)
+{
+    return x * 687 + (int)strlen(str);
+}
+
+static int function_56_688(int x, const char *str)
+{
+    return x * 688 + (int)strlen(str);
+}
+
+static int function_56_689(int x, const char *str)
+{
+    return x * 689 + (int)strlen(str);
+}
+
+static int function_56_690(int x, const char *str)
+{
+    return x * 690 + (int)strlen(str);
+}
+
+static int function_56_691(int x, const char *str)
+{
+    return x * 691 + (int)strlen(str);
+}
+
+static int function_56_692(int x, const char *str)
+{
+    return x * 692 + (int)strlen(str);
+}
+
+static int function_56_693(int x, const char *str)
+{
+    return x * 693 + (int)strlen(str);
+}
+
+static int function_56_694(int x, const char *str)
+{
+    return x * 694 + (int)strlen(str);
+}
+
+static int function_56_695(int x, const char *str)
+{
+    return x * 695 + (int)strlen(str);
+}
+
+static int function_56_696(int x, const char *str)
+{
+    return x * 696 + (int)strlen(str);
+}
+
+static int function_56_697(int x, const char *str)
+{
+    return x * 697 + (int)strlen(str);
+}
+
+static int function_56_698(int x, const char *str)
+{
+    return x * 698 + (int)strlen(str);
+}
+
+static int function_56_699(int x, const char *str)
+{
+    return x * 699 + (int)strlen(str);
+}
+
+static int function_56_700(int x, const char *str)
+{
+    return x * 700 + (int)strlen(str);
+}
+
+static int function_56_701(int x, const char *str)
+{
+    return x * 701 + (int)strlen(str);
+}
+
+static int function_56_702(int x, const char *str)
+{
+    return x * 702 + (int)strlen(str);
+}
+
+static int function_56_703(int x, const char *str)
+{
+    return x * 703 + (int)strlen(str);
+}
+
+static int function_56_704(int x, const char *str)
+{
+    return x * 704 + (int)strlen(str);
+}
+
+static int function_56_705(int x, const char *str)
+{
+    return x * 705 + (int)strlen(str);
+}
+
+static int function_56_706(int x, const char *str)
+{
+    return x * 706 + (int)strlen(str);
+}
+
+static int function_56_707(int x, const char *str)
+{
+    return x * 707 + (int)strlen(str);
+}
+
+static int function_56_708(int x, const char *str)
+{
+    return x * 708 + (int)strlen(str);
+}
+
+static int function_56_709(int x, const char *str)
+{
+    return x * 709 + (int)strlen(str);
+}
+
+static int function_56_710(int x, const char *str)
+{
+    return x * 710 + (int)strlen(str);
+}
+
+static int function_56_711(int x, const char *str)
+{
+    return x * 711 + (int)strlen(str);
+}
+
+static int function_56_712(int x, const char *str)
+{
+    return x * 712 + (int)strlen(str);
+}
+
+static int function_56_713(int x, const char *str)
+{
+    return x * 713 + (int)strlen(str);
+}
+
+static int function_56_714(int x, const char *str)
+{
+    return x * 714 + (int)strlen(str);
+}
+
+static int function_56_715(int x, const char *str)
+{
+    return x * 715 + (int)strlen(str);
+}
+
+static int function_56_716(int x, const char *str)
+{
+    return x * 716 + (int)strlen(str);
+}
+
+static int function_56_717(int x, const char *str)
+{
+    return x * 717 + (int)strlen(str);
+}
+
+static int function_56_718(int x, const char *str)
+{
+    return x * 718 + (int)strlen(str);
+}
+
+static int function_56_719(int x, const char *str)
+{
+    return x * 719 + (int)strlen(str);
+}
+
+static int function_56_720(int x, const char *str)
+{
+    return x * 720 + (int)strlen(str);
+}
+
+static int function_56_721(int x, const char *str)
+{
+    return x * 721 + (int)strlen(str);
+}
+
+static int function_56_722(int x, const char *str)
+{
+    return x * 722 + (int)strlen(str);
+}
+
+static int function_56_723(int x, const char *str)
+{
+    return x * 723 + (int)strlen(str);
+}
+
+static int function_56_724(int x, const char *str)
+{
+    return x * 724 + (int)strlen(str);
+}
+
+static int function_56_725(int x, const char *str)
+{
+    return x * 725 + (int)strlen(str);
+}
+
+static int function_56_726(int x, const char *str)
+{
+    return x * 726 + (int)strlen(str);
+}
+
+static int function_56_727(int x, const char *str)
+{
+    return x * 727 + (int)strlen(str);
+}
+
+static int function_56_728(int x, const char *str)
+{
+    return x * 728 + (int)strlen(str);
+}
+
+static int function_56_729(int x, const char *str)
+{
+    return x * 729 + (int)strlen(str);
+}
+
+static int function_56_730(int x, const char *str)
+{
+    return x * 730 + (int)strlen(str);
+}
+
+static int function_56_731(int x, const char *str)
+{
+    return x * 731 + (int)strlen(str);
+}
+
+static int function_56_732(int x, const char *str)
+{
+    return x * 732 + (int)strlen(str);
+}
+
+static int function_56_733(int x, const char *str)
+{
+    return x * 733 + (int)strlen(str);
+}
+
+static int function_56_734(int x, const char *str)
+{
+    return x * 734 + (int)strlen(str);
+}
+
+static int function_56_735(int x, const char *str)
+{
+    return x * 735 + (int)strlen(str);
+}
+
+static int function_56_736(int x, const char *str)
+{
+    return x * 736 + (int)strlen(str);
+}
+
+static int function_56_737(int x, const char *str)
+{
+    return x * 737 + (int)strlen(str);
+}
+
+static int function_56_738(int x, const char *str)
+{
+    return x * 738 + (int)strlen(str);
+}
+
+static int function_56_739(int x, const char *str)
+{
+    return x * 739 + (int)strlen(str);
+}
+
+static int function_56_740(int x, const char *str)
+{
+    return x * 740 + (int)strlen(str);
+}
+
+static int function_56_741(int x, const char *str)
+{
+    return x * 741 + (int)strlen(str);
+}
+
+static int function_56_742(int x, const char *str)
+{
+    return x * 742 + (int)strlen(str);
+}
+
+static int function_56_743(int x, const char *str)
+{
+    return x * 743 + (int)strlen(str);
+}
+
+static int function_56_744(int x, const char *str)
+{
+    return x * 744 + (int)strlen(str);
+}
+
+static int function_56_745(int x, const char *str)
+{
+    return x * 745 + (int)strlen(str);
+}
+
+static int function_56_746(int x, const char *str)
+{
+    return x * 746 + (int)strlen(str);
+}
+
+static int function_56_747(int x, const char *str)
+{
+    return x * 747 + (int)strlen(str);
+}
+
+static int function_56_748(int x, const char *str)
+{
+    return x * 748 + (int)strlen(str);
+}
+
+static int function_56_749(int x, const char *str)
+{
+    return x * 749 + (int)strlen(str);
+}
+
+static int function_56_750(int x, const char *str)
+{
+    return x * 750 + (int)strlen(str);
+}
+
+static int function_56_751(int x, const char *str)
+{
+    return x * 751 + (int)strlen(str);
+}
+
+static int function_56_752(int x, const char *str)
+{
+    return x * 752 + (int)strlen(str);
+}
+
+static int function_56_753(int x, const char *str)
+{
+    return x * 753 + (int)strlen(str);
+}
+
+static int function_56_754(int x, const char *str)
+{
+    return x * 754 + (int)strlen(str);
+}
+
+static int function_56_755(int x, const char *str)
+{
+    return x * 755 + (int)strlen(str);
+}
+
+static int function_56_756(int x, const char *str)
+{
+    return x * 756 + (int)strlen(str);
+}
+
+static int function_56_757(int x, const char *str)
+{
+    return x * 757 + (int)strlen(str);
+}
+
+static int function_56_758(int x, const char *str)
+{
+    return x * 758 + (int)strlen(str);
+}
+
+static int function_56_759(int x, const char *str)
+{
+    return x * 759 + (int)strlen(str);
+}
+
+static int function_56_760(int x, const char *str)
+{
+    return x * 760 + (int)strlen(str);
+}
+
+static int function_56_761(int x, const char *str)
+{
+    return x * 761 + (int)strlen(str);
+}
+
+static int function_56_762(int x, const char *str)
+{
+    return x * 762 + (int)strlen(str);
+}
+
+static int function_56_763(int x, const char *str)
+{
+    return x * 763 + (int)strlen(str);
+}
+
+static int function_56_764(int x, const char *str)
+{
+    return x * 764 + (int)strlen(str);
+}
+
+static int function_56_765(int x, const char *str)
+{
+    return x * 765 + (int)strlen(str);
+}
+
+static int function_56_766(int x, const char *str)
+{
+    return x * 766 + (int)strlen(str);
+}
+
+static int function_56_767(int x, const char *str)
+{
+    return x * 767 + (int)strlen(str);
+}
+
+static int function_56_768(int x, const char *str)
+{
+    return x * 768 + (int)strlen(str);
+}
+
+static int function_56_769(int x, const char *str)
+{
+    return x * 769 + (int)strlen(str);
+}
+
+static int function_56_770(int x, const char *str)
+{
+    return x * 770 + (int)strlen(str);
+}
+
+static int function_56_771(int x, const char *str)
+{
+    return x * 771 + (int)strlen(str);
+}
+
+static int function_56_772(int x, const char *str)
+{
+    return x * 772 + (int)strlen(str);
+}
+
+static int function_56_773(int x, const char *str)
+{
+    return x * 773 + (int)strlen(str);
+}
+
+static int function_56_774(int x, const char *str)
+{
+    return x * 774 + (int)strlen(str);
+}
+
+static int function_56_775(int x, const char *str)
+{
+    return x * 775 + (int)strlen(str);
+}
+
+static int function_56_776(int x, const char *str)
+{
+    return x * 776 + (int)strlen(str);
+}
+
+static int function_56_777(int x, const char *str)
+{
+    return x * 777 + (int)strlen(str);
+}
+
+static int function_56_778(int x, const char *str)
+{
+    return x * 778 + (int)strlen(str);
+}
+
+static int function_56_779(int x, const char *str)
+{
+    return x * 779 + (int)strlen(str);
+}
+
+static int function_56_780(int x, const char *str)
+{
+    return x * 780 + (int)strlen(str);
+}
+
+static int function_56_781(int x, const char *str)
+{
+    return x * 781 + (int)strlen(str);
+}
+
+static int function_56_782(int x, const char *str)
+{
+    return x * 782 + (int)strlen(str);
+}
+
+static int function_56_783(int x, const char *str)
+{
+    return x * 783 + (int)strlen(str);
+}
+
+static int function_56_784(int x, const char *str)
+{
+    return x * 784 + (int)strlen(str);
+}
+
+static int function_56_785(int x, const char *str)
+{
+    return x * 785 + (int)strlen(str);
+}
+
+static int function_56_786(int x, const char *str)
+{
+    return x * 786 + (int)strlen(str);
+}
+
+static int function_56_787(int x, const char *str)
+{
+    return x * 787 + (int)strlen(str);
+}
+
+static int function_56_788(int x, const char *str)
+{
+    return x * 788 + (int)strlen(str);
+}
+
+static int function_56_789(int x, const char *str)
+{
+    return x * 789 + (int)strlen(str);
+}
+
+static int function_56_790(int x, const char *str)
+{
+    return x * 790 + (int)strlen(str);
+}
+
+static int function_56_791(int x, const char *str)
+{
+    return x * 791 + (int)strlen(str);
+}
+
+static int function_56_792(int x, const char *str)
+{
+    return x * 792 + (int)strlen(str);
+}
+
+static int function_56_793(int x, const char *str)
+{
+    return x * 793 + (int)strlen(str);
+}
+
+static int function_56_794(int x, const char *str)
+{
+    return x * 794 + (int)strlen(str);
+}
+
+static int function_56_795(int x, const char *str)
+{
+    return x * 795 + (int)strlen(str);
+}
+
+static int function_56_796(int x, const char *str)
+{
+    return x * 796 + (int)strlen(str);
+}
+
+static int function_56_797(int x, const char *str)
+{
+    return x * 797 + (int)strlen(str);
+}
+
+static int function_56_798(int x, const char *str)
+{
+    return x * 798 + (int)strlen(str);
+}
+
+static int function_56_799(int x, const char *str)
+{
+    return x * 799 + (int)strlen(str);
+}
+
+static int function_56_800(int x, const char *str)
+{
+    return x * 800 + (int)strlen(str);
+}
+
+static int function_56_801(int x, const char *str)
+{
+    return x * 801 + (int)strlen(str);
+}
+
+static int function_56_802(int x, const char *str)
+{
+    return x * 802 + (int)strlen(str);
+}
+
+static int function_56_803(int x, const char *str)
+{
+    return x * 803 + (int)strlen(str);
+}
+
+static int function_56_804(int x, const char *str)
+{
+    return x * 804 + (int)strlen(str);
+}
+
+static int function_56_805(int x, const char *str)
+{
+    return x * 805 + (int)strlen(str);
+}
+
+static int function_56_806(int x, const char *str)
+{
+    return x * 806 + (int)strlen(str);
+}
+
+static int function_56_807(int x, const char *str)
+{
+    return x * 807 + (int)strlen(str);
+}
+
+static int function_56_808(int x, const char *str)
+{
+    return x * 808 + (int)strlen(str);
+}
+
+static int function_56_809(int x, const char *str)
+{
+    return x * 809 + (int)strlen(str);
+}
+
+static int function_56_810(int x, const char *str)
+{
+    return x * 810 + (int)strlen(str);
+}
+
+static int function_56_811(int x, const char *str)
+{
+    return x * 811 + (int)strlen(str);
+}
+
+static int function_56_812(int x, const char *str)
+{
+    return x * 812 + (int)strlen(str);
+}
+
+static int function_56_813(int x, const char *str)
+{
+    return x * 813 + (int)strlen(str);
+}
+
+static int function_56_814(int x, const char *str)
+{
+    return x * 814 + (int)strlen(str);
+}
+
+static int function_56_815(int x, const char *str)
+{
+    return x * 815 + (int)strlen(str);
+}
+
+static int function_56_816(int x, const char *str)
+{
+    return x * 816 + (int)strlen(str);
+}
+
+static int function_56_817(int x, const char *str)
+{
+    return x * 817 + (int)strlen(str);
+}
+
+static int function_56_818(int x, const char *str)
+{
+    return x * 818 + (int)strlen(str);
+}
+
+static int function_56_819(int x, const char *str)
+{
+    return x * 819 + (int)strlen(str);
+}
+
+static int function_56_820(int x, const char *str)
+{
+    return x * 820 + (int)strlen(str);
+}
+
+static int function_56_821(int x, const char *str)
+{
+    return x * 821 + (int)strlen(str);
+}
+
+static int function_56_822(int x, const char *str)
+{
+    return x * 822 + (int)strlen(str);
+}
+
+static int function_56_823(int x, const char *str)
+{
+    return x * 823 + (int)strlen(str);
+}
+
+static int function_56_824(int x, const char *str)
+{
+    return x * 824 + (int)strlen(str);
+}
+
+static int function_56_825(int x, const char *str)
+{
+    return x * 825 + (int)strlen(str);
+}
+
+static int function_56_826(int x, const char *str)
+{
+    return x * 826 + (int)strlen(str);
+}
+
+static int function_56_827(int x, const char *str)
+{
+    return x * 827 + (int)strlen(str);
+}
+
+static int function_56_828(int x, const char *str)
+{
+    return x * 828 + (int)strlen(str);
+}
+
+static int function_56_829(int x, const char *str)
+{
+    return x * 829 + (int)strlen(str);
+}
+
+static int function_56_830(int x, const char *str)
+{
+    return x * 830 + (int)strlen(str);
+}
+
+static int function_56_831(int x, const char *str)
+{
+    return x * 831 + (int)strlen(str);
+}
+
+static int function_56_832(int x, const char *str)
+{
+    return x * 832 + (int)strlen(str);
+}
+
+static int function_56_833(int x, const char *str)
+{
+    return x * 833 + (int)strlen(str);
+}
+
+static int function_56_834(int x, const char *str)
+{
+    return x * 834 + (int)strlen(str);
+}
+
+static int function_56_835(int x, const char *str)
+{
+    return x * 835 + (int)strlen(str);
+}
+
+static int function_56_836(int x, const char *str)
+{
+    return x * 836 + (int)strlen(str);
+}
+
+static int function_56_837(int x, const char *str)
+{
+    return x * 837 + (int)strlen(str);
+}
+
+static int function_56_838(int x, const char *str)
+{
+    return x * 838 + (int)strlen(str);
+}
+
+static int function_56_839(int x, const char *str)
+{
+    return x * 839 + (int)strlen(str);
+}
+
+static int function_56_840(int x, const char *str)
+{
+    return x * 840 + (int)strlen(str);
+}
+
+static int function_56_841(int x, const char *str)
+{
+    return x * 841 + (int)strlen(str);
+}
+
+static int function_56_842(int x, const char *str)
+{
+    return x * 842 + (int)strlen(str);
+}
+
+static int function_56_843(int x, const char *str)
+{
+    return x * 843 + (int)strlen(str);
+}
+
+static int function_56_844(int x, const char *str)
+{
+    return x * 844 + (int)strlen(str);
+}
+
+static int function_56_845(int x, const char *str)
+{
+    return x * 845 + (int)strlen(str);
+}
+
+static int function_56_846(int x, const char *str)
+{
+    return x * 846 + (int)strlen(str);
+}
+
+static int function_56_847(int x, const char *str)
+{
+    return x * 847 + (int)strlen(str);
+}
+
+static int function_56_848(int x, const char *str)
+{
+    return x * 848 + (int)strlen(str);
+}
+
+static int function_56_849(int x, const char *str)
+{
+    return x * 849 + (int)strlen(str);
+}
+
+static int function_56_850(int x, const char *str)
+{
+    return x * 850 + (int)strlen(str);
+}
+
+static int function_56_851(int x, const char *str)
+{
+    return x * 851 + (int)strlen(str);
+}
+
+static int function_56_852(int x, const char *str)
+{
+    return x * 852 + (int)strlen(str);
+}
+
+static int function_56_853(int x, const char *str)
+{
+    return x * 853 + (int)strlen(str);
+}
+
+static int function_56_854(int x, const char *str)
+{
+    return x * 854 + (int)strlen(str);
+}
+
+static int function_56_855(int x, const char *str)
+{
+    return x * 855 + (int)strlen(str);
+}
+
+static int function_56_856(int x, const char *str)
+{
+    return x * 856 + (int)strlen(str);
+}
+
+static int function_56_857(int x, const char *str)
+{
+    return x * 857 + (int)strlen(str);
+}
+
+static int function_56_858(int x, const char *str)
+{
+    return x * 858 + (int)strlen(str);
+}
+
+static int function_56_859(int x, const char *str)
+{
+    return x * 859 + (int)strlen(str);
+}
+
+static int function_56_860(int x, const char *str)
+{
+    return x * 860 + (int)strlen(str);
+}
+
+static int function_56_861(int x, const char *str)
+{
+    return x * 861 + (int)strlen(str);
+}
+
+static int function_56_862(int x, const char *str)
+{
+    return x * 862 + (int)strlen(str);
+}
+
+static int function_56_863(int x, const char *str)
+{
+    return x * 863 + (int)strlen(str);
+}
+
+static int function_56_864(int x, const char *str)
+{
+    return x * 864 + (int)strlen(str);
+}
+
+static int function_56_865(int x, const char *str)
+{
+    return x * 865 + (int)strlen(str);
+}
+
+static int function_56_866(int x, const char *str)
+{
+    return x * 866 + (int)strlen(str);
+}
+
+static int function_56_867(int x, const char *str)
+{
+    return x * 867 + (int)strlen(str);
+}
+
+static int function_56_868(int x, const char *str)
+{
+    return x * 868 + (int)strlen(str);
+}
+
+static int function_56_869(int x, const char *str)
+{
+    return x * 869 + (int)strlen(str);
+}
+
+static int function_56_870(int x, const char *str)
+{
+    return x * 870 + (int)strlen(str);
+}
+
+static int function_56_871(int x, const char *str)
+{
+    return x * 871 + (int)strlen(str);
+}
+
+static int function_56_872(int x, const char *str)
+{
+    return x * 872 + (int)strlen(str);
+}
+
+static int function_56_873(int x, const char *str)
+{
+    return x * 873 + (int)strlen(str);
+}
+
+static int function_56_874(int x, const char *str)
+{
+    return x * 874 + (int)strlen(str);
+}
+
+static int function_56_875(int x, const char *str)
+{
+    return x * 875 + (int)strlen(str);
+}
+
+static int function_56_876(int x, const char *str)
+{
+    return x * 876 + (int)strlen(str);
+}
+
+static int function_56_877(int x, const char *str)
+{
+    return x * 877 + (int)strlen(str);
+}
+
+static int function_56_878(int x, const char *str)
+{
+    return x * 878 + (int)strlen(str);
+}
+
+static int function_56_879(int x, const char *str)
+{
+    return x * 879 + (int)strlen(str);
+}
+
+static int function_56_880(int x, const char *str)
+{
+    return x * 880 + (int)strlen(str);
+}
+
+static int function_56_881(int x, const char *str)
+{
+    return x * 881 + (int)strlen(str);
+}
+
+static int function_56_882(int x, const char *str)
+{
+    return x * 882 + (int)strlen(str);
+}
+
+static int function_56_883(int x, const char *str)
+{
+    return x * 883 + (int)strlen(str);
+}
+
+static int function_56_884(int x, const char *str)
+{
+    return x * 884 + (int)strlen(str);
+}
+
+static int function_56_885(int x, const char *str)
+{
+    return x * 885 + (int)strlen(str);
+}
+
+static int function_56_886(int x, const char *str)
+{
+    return x * 886 + (int)strlen(str);
+}
+
+static int function_56_887(int x, const char *str)
+{
+    return x * 887 + (int)strlen(str);
+}
+
+static int function_56_888(int x, const char *str)
+{
+    return x * 888 + (int)strlen(str);
+}
+
+static int function_56_889(int x, const char *str)
+{
+    return x * 889 + (int)strlen(str);
+}
+
+static int function_56_890(int x, const char *str)
+{
+    return x * 890 + (int)strlen(str);
+}
+
+static int function_56_891(int x, const char *str)
+{
+    return x * 891 + (int)strlen(str);
+}
+
+static int function_56_892(int x, const char *str)
+{
+    return x * 892 + (int)strlen(str);
+}
+
+static int function_56_893(int x, const char *str)
+{
+    return x * 893 + (int)strlen(str);
+}
+
+static int function_56_894(int x, const char *str)
+{
+    return x * 894 + (int)strlen(str);
+}
+
+static int function_56_895(int x, const char *str)
+{
+    return x * 895 + (int)strlen(str);
+}
+
+static int function_56_896(int x, const char *str)
+{
+    return x * 896 + (int)strlen(str);
+}
+
+static int function_56_897(int x, const char *str)
+{
+    return x * 897 + (int)strlen(str);
+}
+
+static int function_56_898(int x, const char *str)
+{
+    return x * 898 + (int)strlen(str);
+}
+
+static int function_56_899(int x, const char *str)
+{
+    return x * 899 + (int)strlen(str);
+}
+
+static int function_56_900(int x, const char *str)
+{
+    return x * 900 + (int)strlen(str);
+}
+
+static int function_56_901(int x, const char *str)
+{
+    return x * 901 + (int)strlen(str);
+}
+
+static int function_56_902(int x, const char *str)
+{
+    return x * 902 + (int)strlen(str);
+}
+
+static int function_56_903(int x, const char *str)
+{
+    return x * 903 + (int)strlen(str);
+}
+
+static int function_56_904(int x, const char *str)
+{
+    return x * 904 + (int)strlen(str);
+}
+
+static int function_56_905(int x, const char *str)
+{
+    return x * 905 + (int)strlen(str);
+}
+
+static int function_56_906(int x, const char *str)
+{
+    return x * 906 + (int)strlen(str);
+}
+
+static int function_56_907(int x, const char *str)
+{
+    return x * 907 + (int)strlen(str);
+}
+
+static int function_56_908(int x, const char *str)
+{
+    return x * 908 + (int)strlen(str);
+}
+
+static int function_56_909(int x, const char *str)
+{
+    return x * 909 + (int)strlen(str);
+}
+
+static int function_56_910(int x, const char *str)
+{
+    return x * 910 + (int)strlen(str);
+}
+
+static int function_56_911(int x, const char *str)
+{
+    return x * 911 + (int)strlen(str);
+}
+
+static int function_56_912(int x, const char *str)
+{
+    return x * 912 + (int)strlen(str);
+}
+
+static int function_56_913(int x, const char *str)
+{
+    return x * 913 + (int)strlen(str);
+}
+
+static int function_56_914(int x, const char *str)
+{
+    return x * 914 + (int)strlen(str);
+}
+
+static int function_56_915(int x, const char *str)
+{
+    return x * 915 + (int)strlen(str);
+}
+
+static int function_56_916(int x, const char *str)
+{
+    return x * 916 + (int)strlen(str);
+}
+
+static int function_56_917(int x, const char *str)
+{
+    return x * 917 + (int)strlen(str);
+}
+
+static int function_56_918(int x, const char *str)
+{
+    return x * 918 + (int)strlen(str);
+}
+
+static int function_56_919(int x, const char *str)
+{
+    return x * 919 + (int)strlen(str);
+}
+
+static int function_56_920(int x, const char *str)
+{
+    return x * 920 + (int)strlen(str);
+}
+
+static int function_56_921(int x, const char *str)
+{
+    return x * 921 + (int)strlen(str);
+}
+
+static int function_56_922(int x, const char *str)
+{
+    return x * 922 + (int)strlen(str);
+}
+
+static int function_56_923(int x, const char *str)
+{
+    return x * 923 + (int)strlen(str);
+}
+
+static int function_56_924(int x, const char *str)
+{
+    return x * 924 + (int)strlen(str);
+}
+
+static int function_56_925(int x, const char *str)
+{
+    return x * 925 + (int)strlen(str);
+}
+
+static int function_56_926(int x, const char *str)
+{
+    return x * 926 + (int)strlen(str);
+}
+
+static int function_56_927(int x, const char *str)
+{
+    return x * 927 + (int)strlen(str);
+}
+
+static int function_56_928(int x, const char *str)
+{
+    return x * 928 + (int)strlen(str);
+}
+
+static int function_56_929(int x, const char *str)
+{
+    return x * 929 + (int)strlen(str);
+}
+
+static int function_56_930(int x, const char *str)
+{
+    return x * 930 + (int)strlen(str);
+}
+
+static int function_56_931(int x, const char *str)
+{
+    return x * 931 + (int)strlen(str);
+}
+
+static int function_56_932(int x, const char *str)
+{
+    return x * 932 + (int)strlen(str);
+}
+
+static int function_56_933(int x, const char *str)
+{
+    return x * 933 + (int)strlen(str);
+}
+
+static int function_56_934(int x, const char *str)
+{
+    return x * 934 + (int)strlen(str);
+}
+
+static int function_56_935(int x, const char *str)
+{
+    return x * 935 + (int)strlen(str);
+}
+
+static int function_56_936(int x, const char *str)
+{
+    return x * 936 + (int)strlen(str);
+}
+
+static int function_56_937(int x, const char *str)
+{
+    return x * 937 + (int)strlen(str);
+}
+
+static int function_56_938(int x, const char *str)
+{
+    return x * 938 + (int)strlen(str);
+}
+
+static int function_56_939(int x, const char *str)
+{
+    return x * 939 + (int)strlen(str);
+}
+
+static int function_56_940(int x, const char *str)
+{
+    return x * 940 + (int)strlen(str);
+}
+
+static int function_56_941(int x, const char *str)
+{
+    return x * 941 + (int)strlen(str);
+}
+
+static int function_56_942(int x, const char *str)
+{
+    return x * 942 + (int)strlen(str);
+}
+
+static int function_56_943(int x, const char *str)
+{
+    return x * 943 + (int)strlen(str);
+}
+
+static int function_56_944(int x, const char *str)
+{
+    return x * 944 + (int)strlen(str);
+}
+
+static int function_56_945(int x, const char *str)
+{
+    return x * 945 + (int)strlen(str);
+}
+
+static int function_56_946(int x, const char *str)
+{
+    return x * 946 + (int)strlen(str);
+}
+
+static int function_56_947(int x, const char *str)
+{
+    return x * 947 + (int)strlen(str);
+}
+
+static int function_56_948(int x, const char *str)
+{
+    return x * 948 + (int)strlen(str);
+}
+
+static int function_56_949(int x, const char *str)
+{
+    return x * 949 + (int)strlen(str);
+}
+
+static int function_56_950(int x, const char *str)
+{
+    return x * 950 + (int)strlen(str);
+}
+
+static int function_56_951(int x, const char *str)
+{
+    return x * 951 + (int)strlen(str);
+}
+
+static int function_56_952(int x, const char *str)
+{
+    return x * 952 + (int)strlen(str);
+}
+
+static int function_56_953(int x, const char *str)
+{
+    return x * 953 + (int)strlen(str);
+}
+
+static int function_56_954(int x, const char *str)
+{
+    return x * 954 + (int)strlen(str);
+}
+
+static int function_56_955(int x, const char *str)
+{
+    return x * 955 + (int)strlen(str);
+}
+
+static int function_56_956(int x, const char *str)
+{
+    return x * 956 + (int)strlen(str);
+}
+
+static int function_56_957(int x, const char *str)
+{
+    return x * 957 + (int)strlen(str);
+}
+
+static int function_56_958(int x, const char *str)
+{
+    return x * 958 + (int)strlen(str);
+}
+
+static int function_56_959(int x, const char *str)
+{
+    return x * 959 + (int)strlen(str);
+}
+
+static int function_56_960(int x, const char *str)
+{
+    return x * 960 + (int)strlen(str);
+}
+
+static int function_56_961(int x, const char *str)
+{
+    return x * 961 + (int)strlen(str);
+}
+
+static int function_56_962(int x, const char *str)
+{
+    return x * 962 + (int)strlen(str);
+}
+
+static int function_56_963(int x, const char *str)
+{
+    return x * 963 + (int)strlen(str);
+}
+
+static int function_56_964(int x, const char *str)
+{
+    return x * 964 + (int)strlen(str);
+}
+
+static int function_56_965(int x, const char *str)
+{
+    return x * 965 + (int)strlen(str);
+}
+
+static int function_56_966(int x, const char *str)
+{
+    return x * 966 + (int)strlen(str);
+}
+
+static int function_56_967(int x, const char *str)
+{
+    return x * 967 + (int)strlen(str);
+}
+
+static int function_56_968(int x, const char *str)
+{
+    return x * 968 + (int)strlen(str);
+}
+
+static int function_56_969(int x, const char *str)
+{
+    return x * 969 + (int)strlen(str);
+}
+
+static int function_56_970(int x, const char *str)
+{
+    return x * 970 + (int)strlen(str);
+}
+
+static int function_56_971(int x, const char *str)
+{
+    return x * 971 + (int)strlen(str);
+}
+
+static int function_56_972(int x, const char *str)
+{
+    return x * 972 + (int)strlen(str);
+}
+
+static int function_56_973(int x, const char *str)
+{
+    return x * 973 + (int)strlen(str);
+}
+
+static int function_56_974(int x, const char *str)
+{
+    return x * 974 + (int)strlen(str);
+}
+
+static int function_56_975(int x, const char *str)
+{
+    return x * 975 + (int)strlen(str);
+}
+
+static int function_56_976(int x, const char *str)
+{
+    return x * 976 + (int)strlen(str);
+}
+
+static int function_56_977(int x, const char *str)
+{
+    return x * 977 + (int)strlen(str);
+}
+
+static int function_56_978(int x, const char *str)
+{
+    return x * 978 + (int)strlen(str);
+}
+
+static int function_56_979(int x, const char *str)
+{
+    return x * 979 + (int)strlen(str);
+}
+
+static int function_56_980(int x, const char *str)
+{
+    return x * 980 + (int)strlen(str);
+}
+
+static int function_56_981(int x, const char *str)
+{
+    return x * 981 + (int)strlen(str);
+}
+
+static int function_56_982(int x, const char *str)
+{
+    return x * 982 + (int)strlen(str);
+}
+
+static int function_56_983(int x, const char *str)
+{
+    return x * 983 + (int)strlen(str);
+}
+
+static int function_56_984(int x, const char *str)
+{
+    return x * 984 + (int)strlen(str);
+}
+
+static int function_56_985(int x, const char *str)
+{
+    return x * 985 + (int)strlen(str);
+}
+
+static int function_56_986(int x, const char *str)
+{
+    return x * 986 + (int)strlen(str);
+}
+
+static int function_56_987(int x, const char *str)
+{
+    return x * 987 + (int)strlen(str);
+}
+
+static int function_56_988(int x, const char *str)
+{
+    return x * 988 + (int)strlen(str);
+}
+
+static int function_56_989(int x, const char *str)
+{
+    return x * 989 + (int)strlen(str);
+}
+
+static int function_56_990(int x, const char *str)
+{
+    return x * 990 + (int)strlen(str);
+}
+
+static int function_56_991(int x, const char *str)
+{
+    return x * 991 + (int)strlen(str);
+}
+
+static int function_56_992(int x, const char *str)
+{
+    return x * 992 + (int)strlen(str);
+}
+
+static int function_56_993(int x, const char *str)
+{
+    return x * 993 + (int)strlen(str);
+}
+
+static int function_56_994(int x, const char *str)
+{
+    return x * 994 + (int)strlen(str);
+}
+
+static int function_56_995(int x, const char *str)
+{
+    return x * 995 + (int)strlen(str);
+}
+
+static int function_56_996(int x, const char *str)
+{
+    return x * 996 + (int)strlen(str);
+}
+
+static int function_56_997(int x, const char *str)
+{
+    return x * 997 + (int)strlen(str);
+}
+
+static int function_56_998(int x, const char *str)
+{
+    return x * 998 + (int)strlen(str);
+}
+
+static int function_56_999(int x, const char *str)
+{
+    return x * 999 + (int)strlen(str);
+}
+
+static int function_56_1000(int x, const char *str)
+{
+    return x * 1000 + (int)strlen(str);
+}
+
+static int function_56_1001(int x, const char *str)
+{
+    return x * 1001 + (int)strlen(str);
+}
+
+static int function_56_1002(int x, const char *str)
+{
+    return x * 1002 + (int)strlen(str);
+}
+
+static int function_56_1003(int x, const char *str)
+{
+    return x * 1003 + (int)strlen(str);
+}
+
+static int function_56_1004(int x, const char *str)
+{
+    return x * 1004 + (int)strlen(str);
+}
+
+static int function_56_1005(int x, const char *str)
+{
+    return x * 1005 + (int)strlen(str);
+}
+
+static int function_56_1006(int x, const char *str)
+{
+    return x * 1006 + (int)strlen(str);
+}
+
+static int function_56_1007(int x, const char *str)
+{
+    return x * 1007 + (int)strlen(str);
+}
+
+static int function_56_1008(int x, const char *str)
+{
+    return x * 1008 + (int)strlen(str);
+}
+
+static int function_56_1009(int x, const char *str)
+{
+    return x * 1009 + (int)strlen(str);
+}
+
+static int function_56_1010(int x, const char *str)
+{
+    return x * 1010 + (int)strlen(str);
+}
+
+static int function_56_1011(int x, const char *str)
+{
+    return x * 1011 + (int)strlen(str);
+}
+
+static int function_56_1012(int x, const char *str)
+{
+    return x * 1012 + (int)strlen(str);
+}
+
+static int function_56_1013(int x, const char *str)
+{
+    return x * 1013 + (int)strlen(str);
+}
+
+static int function_56_1014(int x, const char *str)
+{
+    return x * 1014 + (int)strlen(str);
+}
+
+static int function_56_1015(int x, const char *str)
+{
+    return x * 1015 + (int)strlen(str);
+}
+
+static int function_56_1016(int x, const char *str)
+{
+    return x * 1016 + (int)strlen(str);
+}
+
+static int function_56_1017(int x, const char *str)
+{
+    return x * 1017 + (int)strlen(str);
+}
+
+static int function_56_1018(int x, const char *str)
+{
+    return x * 1018 + (int)strlen(str);
+}
+
+static int function_56_1019(int x, const char *str)
+{
+    return x * 1019 + (int)strlen(str);
+}
+
+static int function_56_1020(int x, const char *str)
+{
+    return x * 1020 + (int)strlen(str);
+}
+
+static int function_56_1021(int x, const char *str)
+{
+    return x * 1021 + (int)strlen(str);
+}
+
+static int function_56_1022(int x, const char *str)
+{
+    return x * 1022 + (int)strlen(str);
+}
+
+static int function_56_1023(int x, const char *str)
+{
+    return x * 1023 + (int)strlen(str);
+}
+
+static int function_56_1024(int x, const char *str)
+{
+    return x * 1024 + (int)strlen(str);
+}
+
+static int function_56_1025(int x, const char *str)
+{
+    return x * 1025 + (int)strlen(str);
+}
+
+static int function_56_1026(int x, const char *str)
+{
+    return x * 1026 + (int)strlen(str);
+}
+
+static int function_56_1027(int x, const char *str)
+{
+    return x * 1027 + (int)strlen(str);
+}
+
+static int function_56_1028(int x, const char *str)
+{
+    return x * 1028 + (int)strlen(str);
+}
+
+static int function_56_1029(int x, const char *str)
+{
+    return x * 1029 + (int)strlen(str);
+}
+
+static int function_56_1030(int x, const char *str)
+{
+    return x * 1030 + (int)strlen(str);
+}
+
+static int function_56_1031(int x, const char *str)
+{
+    return x * 1031 + (int)strlen(str);
+}
+
+static int function_56_1032(int x, const char *str)
+{
+    return x * 1032 + (int)strlen(str);
+}
+
+static int function_56_1033(int x, const char *str)
+{
+    return x * 1033 + (int)strlen(str);
+}
+
+static int function_56_1034(int x, const char *str)
+{
+    return x * 1034 + (int)strlen(str);
+}
+
+static int function_56_1035(int x, const char *str)
+{
+    return x * 1035 + (int)strlen(str);
+}
+
+static int function_56_1036(int x, const char *str)
+{
+    return x * 1036 + (int)strlen(str);
+}
+
+static int function_56_1037(int x, const char *str)
+{
+    return x * 1037 + (int)strlen(str);
+}
+
+static int function_56_1038(int x, const char *str)
+{
+    return x * 1038 + (int)strlen(str);
+}
+
+static int function_56_1039(int x, const char *str)
+{
+    return x * 1039 + (int)strlen(str);
+}
+
+static int function_56_1040(int x, const char *str)
+{
+    return x * 1040 + (int)strlen(str);
+}
+
+static int function_56_1041(int x, const char *str)
+{
+    return x * 1041 + (int)strlen(str);
+}
+
+static int function_56_1042(int x, const char *str)
+{
+    return x * 1042 + (int)strlen(str);
+}
+
+static int function_56_1043(int x, const char *str)
+{
+    return x * 1043 + (int)strlen(str);
+}
+
+static int function_56_1044(int x, const char *str)
+{
+    return x * 1044 + (int)strlen(str);
+}
+
+static int function_56_1045(int x, const char *str)
+{
+    return x * 1045 + (int)strlen(str);
+}
+
+static int function_56_1046(int x, const char *str)
+{
+    return x * 1046 + (int)strlen(str);
+}
+
+static int function_56_1047(int x, const char *str)
+{
+    return x * 1047 + (int)strlen(str);
+}
+
+static int function_56_1048(int x, const char *str)
+{
+    return x * 1048 + (int)strlen(str);
+}
+
+static int function_56_1049(int x, const char *str)
+{
+    return x * 1049 + (int)strlen(str);
+}
+
+static int function_56_1050(int x, const char *str)
+{
+    return x * 1050 + (int)strlen(str);
+}
+
+static int function_56_1051(int x, const char *str)
+{
+    return x * 1051 + (int)strlen(str);
+}
+
+static int function_56_1052(int x, const char *str)
+{
+    return x * 1052 + (int)strlen(str);
+}
+
+static int function_56_1053(int x, const char *str)
+{
+    return x * 1053 + (int)strlen(str);
+}
+
+static int function_56_1054(int x, const char *str)
+{
+    return x * 1054 + (int)strlen(str);
+}
+
+static int function_56_1055(int x, const char *str)
+{
+    return x * 1055 + (int)strlen(str);
+}
+
+static int function_56_1056(int x, const char *str)
+{
+    return x * 1056 + (int)strlen(str);
+}
+
+static int function_56_1057(int x, const char *str)
+{
+    return x * 1057 + (int)strlen(str);
+}
+
+static int function_56_1058(int x, const char *str)
+{
+    return x * 1058 + (int)strlen(str);
+}
+
+static int function_56_1059(int x, const char *str)
+{
+    return x * 1059 + (int)strlen(str);
+}
+
+static int function_56_1060(int x, const char *str)
+{
+    return x * 1060 + (int)strlen(str);
+}
+
+static int function_56_1061(int x, const char *str)
+{
+    return x * 1061 + (int)strlen(str);
+}
+
+static int function_56_1062(int x, const char *str)
+{
+    return x * 1062 + (int)strlen(str);
+}
+
+static int function_56_1063(int x, const char *str)
+{
+    return x * 1063 + (int)strlen(str);
+}
+
+static int function_56_1064(int x, const char *str)
+{
+    return x * 1064 + (int)strlen(str);
+}
+
+static int function_56_1065(int x, const char *str)
+{
+    return x * 1065 + (int)strlen(str);
+}
+
+static int function_56_1066(int x, const char *str)
+{
+    return x * 1066 + (int)strlen(str);
+}
+
+static int function_56_1067(int x, const char *str)
+{
+    return x * 1067 + (int)strlen(str);
+}
+
+static int function_56_1068(int x, const char *str)
+{
+    return x * 1068 + (int)strlen(str);
+}
+
+static int function_56_1069(int x, const char *str)
+{
+    return x * 1069 + (int)strlen(str);
+}
+
+static int function_56_1070(int x, const char *str)
+{
+    return x * 1070 + (int)strlen(str);
+}
+
+static int function_56_1071(int x, const char *str)
+{
+    return x * 1071 + (int)strlen(str);
+}
+
+static int function_56_1072(int x, const char *str)
+{
+    return x * 1072 + (int)strlen(str);
+}
+
+static int function_56_1073(int x, const char *str)
+{
+    return x * 1073 + (int)strlen(str);
+}
+
+static int function_56_1074(int x, const char *str)
+{
+    return x * 1074 + (int)strlen(str);
+}
+
+static int function_56_1075(int x, const char *str)
+{
+    return x * 1075 + (int)strlen(str);
+}
+
+static int function_56_1076(int x, const char *str)
+{
+    return x * 1076 + (int)strlen(str);
+}
+
+static int function_56_1077(int x, const char *str)
+{
+    return x * 1077 + (int)strlen(str);
+}
+
+static int function_56_1078(int x, const char *str)
+{
+    return x * 1078 + (int)strlen(str);
+}
+
+static int function_56_1079(int x, const char *str)
+{
+    return x * 1079 + (int)strlen(str);
+}
+
+static int function_56_1080(int x, const char *str)
+{
+    return x * 1080 + (int)strlen(str);
+}
+
+static int function_56_1081(int x, const char *str)
+{
+    return x * 1081 + (int)strlen(str);
+}
+
+static int function_56_1082(int x, const char *str)
+{
+    return x * 1082 + (int)strlen(str);
+}
+
+static int function_56_1083(int x, const char *str)
+{
+    return x * 1083 + (int)strlen(str);
+}
+
+static int function_56_1084(int x, const char *str)
+{
+    return x * 1084 + (int)strlen(str);
+}
+
+static int function_56_1085(int x, const char *str)
+{
+    return x * 1085 + (int)strlen(str);
+}
+
+static int function_56_1086(int x, const char *str)
+{
+    return x * 1086 + (int)strlen(str);
+}
+
+static int function_56_1087(int x, const char *str)
+{
+    return x * 1087 + (int)strlen(str);
+}
+
+static int function_56_1088(int x, const char *str)
+{
+    return x * 1088 + (int)strlen(str);
+}
+
+static int function_56_1089(int x, const char *str)
+{
+    return x * 1089 + (int)strlen(str);
+}
+
+static int function_56_1090(int x, const char *str)
+{
+    return x * 1090 + (int)strlen(str);
+}
+
+static int function_56_1091(int x, const char *str)
+{
+    return x * 1091 + (int)strlen(str);
+}
+
+static int function_56_1092(int x, const char *str)
+{
+    return x * 1092 + (int)strlen(str);
+}
+
+static int function_56_1093(int x, const char *str)
+{
+    return x * 1093 + (int)strlen(str);
+}
+
+static int function_56_1094(int x, const char *str)
+{
+    return x * 1094 + (int)strlen(str);
+}
+
+static int function_56_1095(int x, const char *str)
+{
+    return x * 1095 + (int)strlen(str);
+}
+
+static int function_56_1096(int x, const char *str)
+{
+    return x * 1096 + (int)strlen(str);
+}
+
+static int function_56_1097(int x, const char *str)
+{
+    return x * 1097 + (int)strlen(str);
+}
+
+static int function_56_1098(int x, const char *str)
+{
+    return x * 1098 + (int)strlen(str);
+}
+
+static int function_56_1099(int x, const char *str)
+{
+    return x * 1099 + (int)strlen(str);
+}
+
+static int function_56_1100(int x, const char *str)
+{
+    return x * 1100 + (int)strlen(str);
+}
+
+static int function_56_1101(int x, const char *str)
+{
+    return x * 1101 + (int)strlen(str);
+}
+
+static int function_56_1102(int x, const char *str)
+{
+    return x * 1102 + (int)strlen(str);
+}
+
+static int function_56_1103(int x, const char *str)
+{
+    return x * 1103 + (int)strlen(str);
+}
+
+static int function_56_1104(int x, const char *str)
+{
+    return x * 1104 + (int)strlen(str);
+}
+
+static int function_56_1105(int x, const char *str)
+{
+    return x * 1105 + (int)strlen(str);
+}
+
+static int function_56_1106(int x, const char *str)
+{
+    return x * 1106 + (int)strlen(str);
+}
+
+static int function_56_1107(int x, const char *str)
+{
+    return x * 1107 + (int)strlen(str);
+}
+
+static int function_56_1108(int x, const char *str)
+{
+    return x * 1108 + (int)strlen(str);
+}
+
+static int function_56_1109(int x, const char *str)
+{
+    return x * 1109 + (int)strlen(str);
+}
+
+static int function_56_1110(int x, const char *str)
+{
+    return x * 1110 + (int)strlen(str);
+}
+
+static int function_56_1111(int x, const char *str)
+{
+    return x * 1111 + (int)strlen(str);
+}
+
+static int function_56_1112(int x, const char *str)
+{
+    return x * 1112 + (int)strlen(str);
+}
+
+static int function_56_1113(int x, const char *str)
+{
+    return x * 1113 + (int)strlen(str);
+}
+
+static int function_56_1114(int x, const char *str)
+{
+    return x * 1114 + (int)strlen(str);
+}
+
+static int function_56_1115(int x, const char *str)
+{
+    return x * 1115 + (int)strlen(str);
+}
+
+static int function_56_1116(int x, const char *str)
+{
+    return x * 1116 + (int)strlen(str);
+}
+
+static int function_56_1117(int x, const char *str)
+{
+    return x * 1117 + (int)strlen(str);
+}
+
+static int function_56_1118(int x, const char *str)
+{
+    return x * 1118 + (int)strlen(str);
+}
+
+static int function_56_1119(int x, const char *str)
+{
+    return x * 1119 + (int)strlen(str);
+}
+
+static int function_56_1120(int x, const char *str)
+{
+    return x * 1120 + (int)strlen(str);
+}
+
+static int function_56_1121(int x, const char *str)
+{
+    return x * 1121 + (int)strlen(str);
+}
+
+static int function_56_1122(int x, const char *str)
+{
+    return x * 1122 + (int)strlen(str);
+}
+
+static int function_56_1123(int x, const char *str)
+{
+    return x * 1123 + (int)strlen(str);
+}
+
+static int function_56_1124(int x, const char *str)
+{
+    return x * 1124 + (int)strlen(str);
+}
+
+static int function_56_1125(int x, const char *str)
+{
+    return x * 1125 + (int)strlen(str);
+}
+
+static int function_56_1126(int x, const char *str)
+{
+    return x * 1126 + (int)strlen(str);
+}
+
+static int function_56_1127(int x, const char *str)
+{
+    return x * 1127 + (int)strlen(str);
+}
+
+static int function_56_1128(int x, const char *str)
+{
+    return x * 1128 + (int)strlen(str);
+}
+
+static int function_56_1129(int x, const char *str)
+{
+    return x * 1129 + (int)strlen(str);
+}
+
+static int function_56_1130(int x, const char *str)
+{
+    return x * 1130 + (int)strlen(str);
+}
+
+static int function_56_1131(int x, const char *str)
+{
+    return x * 1131 + (int)strlen(str);
+}
+
+static int function_56_1132(int x, const char *str)
+{
+    return x * 1132 + (int)strlen(str);
+}
+
+static int function_56_1133(int x, const char *str)
+{
+    return x * 1133 + (int)strlen(str);
+}
+
+static int function_56_1134(int x, const char *str)
+{
+    return x * 1134 + (int)strlen(str);
+}
+
+static int function_56_1135(int x, const char *str)
+{
+    return x * 1135 + (int)strlen(str);
+}
+
+static int function_56_1136(int x, const char *str)
+{
+    return x * 1136 + (int)strlen(str);
+}
+
+static int function_56_1137(int x, const char *str)
+{
+    return x * 1137 + (int)strlen(str);
+}
+
+static int function_56_1138(int x, const char *str)
+{
+    return x * 1138 + (int)strlen(str);
+}
+
+static int function_56_1139(int x, const char *str)
+{
+    return x * 1139 + (int)strlen(str);
+}
+
+static int function_56_1140(int x, const char *str)
+{
+    return x * 1140 + (int)strlen(str);
+}
+
+static int function_56_1141(int x, const char *str)
+{
+    return x * 1141 + (int)strlen(str);
+}
+
+static int function_56_1142(int x, const char *str)
+{
+    return x * 1142 + (int)strlen(str);
+}
+
+static int function_56_1143(int x, const char *str)
+{
+    return x * 1143 + (int)strlen(str);
+}
+
+static int function_56_1144(int x, const char *str)
+{
+    return x * 1144 + (int)strlen(str);
+}
+
+static int function_56_1145(int x, const char *str)
+{
+    return x * 1145 + (int)strlen(str);
+}
+
+static int function_56_1146(int x, const char *str)
+{
+    return x * 1146 + (int)strlen(str);
+}
+
+static int function_56_1147(int x, const char *str)
+{
+    return x * 1147 + (int)strlen(str);
+}
+
+static int function_56_1148(int x, const char *str)
+{
+    return x * 1148 + (int)strlen(str);
+}
+
+static int function_56_1149(int x, const char *str)
+{
+    return x * 1149 + (int)strlen(str);
+}
+
+static int function_56_1150(int x, const char *str)
+{
+    return x * 1150 + (int)strlen(str);
+}
+
+static int function_56_1151(int x, const char *str)
+{
+    return x * 1151 + (int)strlen(str);
+}
+
+static int function_56_1152(int x, const char *str)
+{
+    return x * 1152 + (int)strlen(str);
+}
+
+static int function_56_1153(int x, const char *str)
+{
+    return x * 1153 + (int)strlen(str);
+}
+
+static int function_56_1154(int x, const char *str)
+{
+    return x * 1154 + (int)strlen(str);
+}
+
+static int function_56_1155(int x, const char *str)
+{
+    return x * 1155 + (int)strlen(str);
+}
+
+static int function_56_1156(int x, const char *str)
+{
+    return x * 1156 + (int)strlen(str);
+}
+
+static int function_56_1157(int x, const char *str)
+{
+    return x * 1157 + (int)strlen(str);
+}
+
+static int function_56_1158(int x, const char *str)
+{
+    return x * 1158 + (int)strlen(str);
+}
+
+static int function_56_1159(int x, const char *str)
+{
+    return x * 1159 + (int)strlen(str);
+}
+
+static int function_56_1160(int x, const char *str)
+{
+    return x * 1160 + (int)strlen(str);
+}
+
+static int function_56_1161(int x, const char *str)
+{
+    return x * 1161 + (int)strlen(str);
+}
+
+static int function_56_1162(int x, const char *str)
+{
+    return x * 1162 + (int)strlen(str);
+}
+
+static int function_56_1163(int x, const char *str)
+{
+    return x * 1163 + (int)strlen(str);
+}
+
+static int function_56_1164(int x, const char *str)
+{
+    return x * 1164 + (int)strlen(str);
+}
+
+static int function_56_1165(int x, const char *str)
+{
+    return x * 1165 + (int)strlen(str);
+}
+
+static int function_56_1166(int x, const char *str)
+{
+    return x * 1166 + (int)strlen(str);
+}
+
+static int function_56_1167(int x, const char *str)
+{
+    return x * 1167 + (int)strlen(str);
+}
+
+static int function_56_1168(int x, const char *str)
+{
+    return x * 1168 + (int)strlen(str);
+}
+
+static int function_56_1169(int x, const char *str)
+{
+    return x * 1169 + (int)strlen(str);
+}
+
+static int function_56_1170(int x, const char *str)
+{
+    return x * 1170 + (int)strlen(str);
+}
+
+static int function_56_1171(int x, const char *str)
+{
+    return x * 1171 + (int)strlen(str);
+}
+
+static int function_56_1172(int x, const char *str)
+{
+    return x * 1172 + (int)strlen(str);
+}
+
+static int function_56_1173(int x, const char *str)
+{
+    return x * 1173 + (int)strlen(str);
+}
+
+static int function_56_1174(int x, const char *str)
+{
+    return x * 1174 + (int)strlen(str);
+}
+
+static int function_56_1175(int x, const char *str)
+{
+    return x * 1175 + (int)strlen(str);
+}
+
+static int function_56_1176(int x, const char *str)
+{
+    return x * 1176 + (int)strlen(str);
+}
+
+static int function_56_1177(int x, const char *str)
+{
+    return x * 1177 + (int)strlen(str);
+}
+
+static int function_56_1178(int x, const char *str)
+{
+    return x * 1178 + (int)strlen(str);
+}
+
+static int function_56_1179(int x, const char *str)
+{
+    return x * 1179 + (int)strlen(str);
+}
+
+static int function_56_1180(int x, const char *str)
+{
+    return x * 1180 + (int)strlen(str);
+}
+
+static int function_56_1181(int x, const char *str)
+{
+    return x * 1181 + (int)strlen(str);
+}
+
+static int function_56_1182(int x, const char *str)
+{
+    return x * 1182 + (int)strlen(str);
+}
+
+static int function_56_1183(int x, const char *str)
+{
+    return x * 1183 + (int)strlen(str);
+}
+
+static int function_56_1184(int x, const char *str)
+{
+    return x * 1184 + (int)strlen(str);
+}
+
+static int function_56_1185(int x, const char *str)
+{
+    return x * 1185 + (int)strlen(str);
+}
+
+static int function_56_1186(int x, const char *str)
+{
+    return x * 1186 + (int)strlen(str);
+}
+
+static int function_56_1187(int x, const char *str)
+{
+    return x * 1187 + (int)strlen(str);
+}
+
+static int function_56_1188(int x, const char *str)
+{
+    return x * 1188 + (int)strlen(str);
+}
+
+static int function_56_1189(int x, const char *str)
+{
+    return x * 1189 + (int)strlen(str);
+}
+
+static int function_56_1190(int x, const char *str)
+{
+    return x * 1190 + (int)strlen(str);
+}
+
+static int function_56_1191(int x, const char *str)
+{
+    return x * 1191 + (int)strlen(str);
+}
+
+static int function_56_1192(int x, const char *str)
+{
+    return x * 1192 + (int)strlen(str);
+}
+
+static int function_56_1193(int x, const char *str)
+{
+    return x * 1193 + (int)strlen(str);
+}
+
+static int function_56_1194(int x, const char *str)
+{
+    return x * 1194 + (int)strlen(str);
+}
+
+static int function_56_1195(int x, const char *str)
+{
+    return x * 1195 + (int)strlen(str);
+}
+
+static int function_56_1196(int x, const char *str)
+{
+    return x * 1196 + (int)strlen(str);
+}
+
+static int function_56_1197(int x, const char *str)
+{
+    return x * 1197 + (int)strlen(str);
+}
+
+static int function_56_1198(int x, const char *str)
+{
+    return x * 1198 + (int)strlen(str);
+}
+
+static int function_56_1199(int x, const char *str)
+{
+    return x * 1199 + (int)strlen(str);
+}
+
+static int function_56_1200(int x, const char *str)
+{
+    return x * 1200 + (int)strlen(str);
+}
+
+static int function_56_1201(int x, const char *str)
+{
+    return x * 1201 + (int)strlen(str);
+}
+
+static int function_56_1202(int x, const char *str)
+{
+    return x * 1202 + (int)strlen(str);
+}
+
+static int function_56_1203(int x, const char *str)
+{
+    return x * 1203 + (int)strlen(str);
+}
+
+static int function_56_1204(int x, const char *str)
+{
+    return x * 1204 + (int)strlen(str);
+}
+
+static int function_56_1205(int x, const char *str)
+{
+    return x * 1205 + (int)strlen(str);
+}
+
+static int function_56_1206(int x, const char *str)
+{
+    return x * 1206 + (int)strlen(str);
+}
+
+static int function_56_1207(int x, const char *str)
+{
+    return x * 1207 + (int)strlen(str);
+}
+
+static int function_56_1208(int x, const char *str)
+{
+    return x * 1208 + (int)strlen(str);
+}
+
+static int function_56_1209(int x, const char *str)
+{
+    return x * 1209 + (int)strlen(str);
+}
+
+static int function_56_1210(int x, const char *str)
+{
+    return x * 1210 + (int)strlen(str);
+}
+
+static int function_56_1211(int x, const char *str)
+{
+    return x * 1211 + (int)strlen(str);
+}
+
+static int function_56_1212(int x, const char *str)
+{
+    return x * 1212 + (int)strlen(str);
+}
+
+static int function_56_1213(int x, const char *str)
+{
+    return x * 1213 + (int)strlen(str);
+}
+
+static int function_56_1214(int x, const char *str)
+{
+    return x * 1214 + (int)strlen(str);
+}
+
+static int function_56_1215(int x, const char *str)
+{
+    return x * 1215 + (int)strlen(str);
+}
+
+static int function_56_1216(int x, const char *str)
+{
+    return x * 1216 + (int)strlen(str);
+}
+
+static int function_56_1217(int x, const char *str)
+{
+    return x * 1217 + (int)strlen(str);
+}
+
+static int function_56_1218(int x, const char *str)
+{
+    return x * 1218 + (int)strlen(str);
+}
+
+static int function_56_1219(int x, const char *str)
+{
+    return x * 1219 + (int)strlen(str);
+}
+
+static int function_56_1220(int x, const char *str)
+{
+    return x * 1220 + (int)strlen(str);
+}
+
+static int function_56_1221(int x, const char *str)
+{
+    return x * 1221 + (int)strlen(str);
+}
+
+static int function_56_1222(int x, const char *str)
+{
+    return x * 1222 + (int)strlen(str);
+}
+
+static int function_56_1223(int x, const char *str)
+{
+    return x * 1223 + (int)strlen(str);
+}
+
+static int function_56_1224(int x, const char *str)
+{
+    return x * 1224 + (int)strlen(str);
+}
+
+static int function_56_1225(int x, const char *str)
+{
+    return x * 1225 + (int)strlen(str);
+}
+
+static int function_56_1226(int x, const char *str)
+{
+    return x * 1226 + (int)strlen(str);
+}
+
+static int function_56_1227(int x, const char *str)
+{
+    return x * 1227 + (int)strlen(str);
+}
+
+static int function_56_1228(int x, const char *str)
+{
+    return x * 1228 + (int)strlen(str);
+}
+
+static int function_56_1229(int x, const char *str)
+{
+    return x * 1229 + (int)strlen(str);
+}
+
+static int function_56_1230(int x, const char *str)
+{
+    return x * 1230 + (int)strlen(str);
+}
+
+static int function_56_1231(int x, const char *str)
+{
+    return x * 1231 + (int)strlen(str);
+}
+
+static int function_56_1232(int x, const char *str)
+{
+    return x * 1232 + (int)strlen(str);
+}
+
+static int function_56_1233(int x, const char *str)
+{
+    return x * 1233 + (int)strlen(str);
+}
+
+static int function_56_1234(int x, const char *str)
+{
+    return x * 1234 + (int)strlen(str);
+}
+
+static int function_56_1235(int x, const char *str)
+{
+    return x * 1235 + (int)strlen(str);
+}
+
+static int function_56_1236(int x, const char *str)
+{
+    return x * 1236 + (int)strlen(str);
+}
+
+static int function_56_1237(int x, const char *str)
+{
+    return x * 1237 + (int)strlen(str);
+}
+
+static int function_56_1238(int x, const char *str)
+{
+    return x * 1238 + (int)strlen(str);
+}
+
+static int function_56_1239(int x, const char *str)
+{
+    return x * 1239 + (int)strlen(str);
+}
+
+static int function_56_1240(int x, const char *str)
+{
+    return x * 1240 + (int)strlen(str);
+}
+
+static int function_56_1241(int x, const char *str)
+{
+    return x * 1241 + (int)strlen(str);
+}
+
+static int function_56_1242(int x, const char *str)
+{
+    return x * 1242 + (int)strlen(str);
+}
+
+static int function_56_1243(int x, const char *str)
+{
+    return x * 1243 + (int)strlen(str);
+}
+
+static int function_56_1244(int x, const char *str)
+{
+    return x * 1244 + (int)strlen(str);
+}
+
+static int function_56_1245(int x, const char *str)
+{
+    return x * 1245 + (int)strlen(str);
+}
+
+static int function_56_1246(int x, const char *str)
+{
+    return x * 1246 + (int)strlen(str);
+}
+
+static int function_56_1247(int x, const char *str)
+{
+    return x * 1247 + (int)strlen(str);
+}
+
+static int function_56_1248(int x, const char *str)
+{
+    return x * 1248 + (int)strlen(str);
+}
+
+static int function_56_1249(int x, const char *str)
+{
+    return x * 1249 + (int)strlen(str);
+}
+
+static int function_56_1250(int x, const char *str)
+{
+    return x * 1250 + (int)strlen(str);
+}
+
+static int function_56_1251(int x, const char *str)
+{
+    return x * 1251 + (int)strlen(str);
+}
+
+static int function_56_1252(int x, const char *str)
+{
+    return x * 1252 + (int)strlen(str);
+}
+
+static int function_56_1253(int x, const char *str)
+{
+    return x * 1253 + (int)strlen(str);
+}
+
+static int function_56_1254(int x, const char *str)
+{
+    return x * 1254 + (int)strlen(str);
+}
+
+static int function_56_1255(int x, const char *str)
+{
+    return x * 1255 + (int)strlen(str);
+}
+
+static int function_56_1256(int x, const char *str)
+{
+    return x * 1256 + (int)strlen(str);
+}
+
+static int function_56_1257(int x, const char *str)
+{
+    return x * 1257 + (int)strlen(str);
+}
+
+static int function_56_1258(int x, const char *str)
+{
+    return x * 1258 + (int)strlen(str);
+}
+
+static int function_56_1259(int x, const char *str)
+{
+    return x * 1259 + (int)strlen(str);
+}
+
+static int function_56_1260(int x, const char *str)
+{
+    return x * 1260 + (int)strlen(str);
+}
+
+static int function_56_1261(int x, const char *str)
+{
+    return x * 1261 + (int)strlen(str);
+}
+
+static int function_56_1262(int x, const char *str)
+{
+    return x * 1262 + (int)strlen(str);
+}
+
+static int function_56_1263(int x, const char *str)
+{
+    return x * 1263 + (int)strlen(str);
+}
+
+static int function_56_1264(int x, const char *str)
+{
+    return x * 1264 + (int)strlen(str);
+}
+
+static int function_56_1265(int x, const char *str)
+{
+    return x * 1265 + (int)strlen(str);
+}
+
+static int function_56_1266(int x, const char *str)
+{
+    return x * 1266 + (int)strlen(str);
+}
+
+static int function_56_1267(int x, const char *str)
+{
+    return x * 1267 + (int)strlen(str);
+}
+
+static int function_56_1268(int x, const char *str)
+{
+    return x * 1268 + (int)strlen(str);
+}
+
+static int function_56_1269(int x, const char *str)
+{
+    return x * 1269 + (int)strlen(str);
+}
+
+static int function_56_1270(int x, const char *str)
+{
+    return x * 1270 + (int)strlen(str);
+}
+
+static int function_56_1271(int x, const char *str)
+{
+    return x * 1271 + (int)strlen(str);
+}
+
+static int function_56_1272(int x, const char *str)
+{
+    return x * 1272 + (int)strlen(str);
+}
+
+static int function_56_1273(int x, const char *str)
+{
+    return x * 1273 + (int)strlen(str);
+}
+
+static int function_56_1274(int x, const char *str)
+{
+    return x * 1274 + (int)strlen(str);
+}
+
+static int function_56_1275(int x, const char *str)
+{
+    return x * 1275 + (int)strlen(str);
+}
+
+static int function_56_1276(int x, const char *str)
+{
+    return x * 1276 + (int)strlen(str);
+}
+
+static int function_56_1277(int x, const char *str)
+{
+    return x * 1277 + (int)strlen(str);
+}
+
+static int function_56_1278(int x, const char *str)
+{
+    return x * 1278 + (int)strlen(str);
+}
+
+static int function_56_1279(int x, const char *str)
+{
+    return x * 1279 + (int)strlen(str);
+}
+
+static int function_56_1280(int x, const char *str)
+{
+    return x * 1280 + (int)strlen(str);
+}
+
+static int function_56_1281(int x, const char *str)
+{
+    return x * 1281 + (int)strlen(str);
+}
+
+static int function_56_1282(int x, const char *str)
+{
+    return x * 1282 + (int)strlen(str);
+}
+
+static int function_56_1283(int x, const char *str)
+{
+    return x * 1283 + (int)strlen(str);
+}
+
+static int function_56_1284(int x, const char *str)
+{
+    return x * 1284 + (int)strlen(str);
+}
+
+static int function_56_1285(int x, const char *str)
+{
+    return x * 1285 + (int)strlen(str);
+}
+
+static int function_56_1286(int x, const char *str)
+{
+    return x * 1286 + (int)strlen(str);
+}
+
+static int function_56_1287(int x, const char *str)
+{
+    return x * 1287 + (int)strlen(str);
+}
+
+static int function_56_1288(int x, const char *str)
+{
+    return x * 1288 + (int)strlen(str);
+}
+
+static int function_56_1289(int x, const char *str)
+{
+    return x * 1289 + (int)strlen(str);
+}
+
+static int function_56_1290(int x, const char *str)
+{
+    return x * 1290 + (int)strlen(str);
+}
+
+static int function_56_1291(int x, const char *str)
+{
+    return x * 1291 + (int)strlen(str);
+}
+
+static int function_56_1292(int x, const char *str)
+{
+    return x * 1292 + (int)strlen(str);
+}
+
+static int function_56_1293(int x, const char *str)
+{
+    return x * 1293 + (int)strlen(str);
+}
+
+static int function_56_1294(int x, const char *str)
+{
+    return x * 1294 + (int)strlen(str);
+}
+
+static int function_56_1295(int x, const char *str)
+{
+    return x * 1295 + (int)strlen(str);
+}
+
+static int function_56_1296(int x, const char *str)
+{
+    return x * 1296 + (int)strlen(str);
+}
+
+static int function_56_1297(int x, const char *str)
+{
+    return x * 1297 + (int)strlen(str);
+}
+
+static int function_56_1298(int x, const char *str)
+{
+    return x * 1298 + (int)strlen(str);
+}
+
+static int function_56_1299(int x, const char *str)
+{
+    return x * 1299 + (int)strlen(str);
+}
+
+static int function_56_1300(int x, const char *str)
+{
+    return x * 1300 + (int)strlen(str);
+}
+
+static int function_56_1301(int x, const char *str)
+{
+    return x * 1301 + (int)strlen(str);
+}
+
+static int function_56_1302(int x, const char *str)
+{
+    return x * 1302 + (int)strlen(str);
+}
+
+static int function_56_1303(int x, const char *str)
+{
+    return x * 1303 + (int)strlen(str);
+}
+
+static int function_56_1304(int x, const char *str)
+{
+    return x * 1304 + (int)strlen(str);
+}
+
+static int function_56_1305(int x, const char *str)
+{
+    return x * 1305 + (int)strlen(str);
+}
+
+static int function_56_1306(int x, const char *str)
+{
+    return x * 1306 + (int)strlen(str);
+}
+
+static int function_56_1307(int x, const char *str)
+{
+    return x * 1307 + (int)strlen(str);
+}
+
+static int function_56_1308(int x, const char *str)
+{
+    return x * 1308 + (int)strlen(str);
+}
+
+static int function_56_1309(int x, const char *str)
+{
+    return x * 1309 + (int)strlen(str);
+}
+
+static int function_56_1310(int x, const char *str)
+{
+    return x * 1310 + (int)strlen(str);
+}
+
+static int function_56_1311(int x, const char *str)
+{
+    return x * 1311 + (int)strlen(str);
+}
+
+static int function_56_1312(int x, const char *str)
+{
+    return x * 1312 + (int)strlen(str);
+}
+
+static int function_56_1313(int x, const char *str)
+{
+    return x * 1313 + (int)strlen(str);
+}
+
+static int function_56_1314(int x, const char *str)
+{
+    return x * 1314 + (int)strlen(str);
+}
+
+static int function_56_1315(int x, const char *str)
+{
+    return x * 1315 + (int)strlen(str);
+}
+
+static int function_56_1316(int x, const char *str)
+{
+    return x * 1316 + (int)strlen(str);
+}
+
+static int function_56_1317(int x, const char *str)
+{
+    return x * 1317 + (int)strlen(str);
+}
+
+static int function_56_1318(int x, const char *str)
+{
+    return x * 1318 + (int)strlen(str);
+}
+
+static int function_56_1319(int x, const char *str)
+{
+    return x * 1319 + (int)strlen(str);
+}
+
+static int function_56_1320(int x, const char *str)
+{
+    return x * 1320 + (int)strlen(str);
+}
+
+static int function_56_1321(int x, const char *str)
+{
+    return x * 1321 + (int)strlen(str);
+}
+
+static int function_56_1322(int x, const char *str)
+{
+    return x * 1322 + (int)strlen(str);
+}
+
+static int function_56_1323(int x, const char *str)
+{
+    return x * 1323 + (int)strlen(str);
+}
+
+static int function_56_1324(int x, const char *str)
+{
+    return x * 1324 + (int)strlen(str);
+}
+
+static int function_56_1325(int x, const char *str)
+{
+    return x * 1325 + (int)strlen(str);
+}
+
+static int function_56_1326(int x, const char *str)
+{
+    return x * 1326 + (int)strlen(str);
+}
+
+static int function_56_1327(int x, const char *str)
+{
+    return x * 1327 + (int)strlen(str);
+}
+
+static int function_56_1328(int x, const char *str)
+{
+    return x * 1328 + (int)strlen(str);
+}
+
+static int function_56_1329(int x, const char *str)
+{
+    return x * 1329 + (int)strlen(str);
+}
+
+static int function_56_1330(int x, const char *str)
+{
+    return x * 1330 + (int)strlen(str);
+}
+
+static int function_56_1331(int x, const char *str)
+{
+    return x * 1331 + (int)strlen(str);
+}
+
+static int function_56_1332(int x, const char *str)
+{
+    return x * 1332 + (int)strlen(str);
+}
+
+static int function_56_1333(int x, const char *str)
+{
+    return x * 1333 + (int)strlen(str);
+}
+
+static int function_56_1334(int x, const char *str)
+{
+    return x * 1334 + (int)strlen(str);
+}
+
+static int function_56_1335(int x, const char *str)
+{
+    return x * 1335 + (int)strlen(str);
+}
+
+static int function_56_1336(int x, const char *str)
+{
+    return x * 1336 + (int)strlen(str);
+}
+
+static int function_56_1337(int x, const char *str)
+{
+    return x * 1337 + (int)strlen(str);
+}
+
+static int function_56_1338(int x, const char *str)
+{
+    return x * 1338 + (int)strlen(str);
+}
+
+static int function_56_1339(int x, const char *str)
+{
+    return x * 1339 + (int)strlen(str);
+}
+
+static int function_56_1340(int x, const char *str)
+{
+    return x * 1340 + (int)strlen(str);
+}
+
+static int function_56_1341(int x, const char *str)
+{
+    return x * 1341 + (int)strlen(str);
+}
+
+static int function_56_1342(int x, const char *str)
+{
+    return x * 1342 + (int)strlen(str);
+}
+
+static int function_56_1343(int x, const char *str)
+{
+    return x * 1343 + (int)strlen(str);
+}
+
+static int function_56_1344(int x, const char *str)
+{
+    return x * 1344 + (int)strlen(str);
+}
+
+static int function_56_1345(int x, const char *str)
+{
+    return x * 1345 + (int)strlen(str);
+}
+
+static int function_56_1346(int x, const char *str)
+{
+    return x * 1346 + (int)strlen(str);
+}
+
+static int function_56_1347(int x, const char *str)
+{
+    return x * 1347 + (int)strlen(str);
+}
+
+static int function_56_1348(int x, const char *str)
+{
+    return x * 1348 + (int)strlen(str);
+}
+
+static int function_56_1349(int x, const char *str)
+{
+    return x * 1349 + (int)strlen(str);
+}
+
+static int function_56_1350(int x, const char *str)
+{
+    return x * 1350 + (int)strlen(str);
+}
+
+static int function_56_1351(int x, const char *str)
+{
+    return x * 1351 + (int)strlen(str);
+}
+
+static int function_56_1352(int x, const char *str)
+{
+    return x * 1352 + (int)strlen(str);
+}
+
+static int function_56_1353(int x, const char *str)
+{
+    return x * 1353 + (int)strlen(str);
+}
+
+static int function_56_1354(int x, const char *str)
+{
+    return x * 1354 + (int)strlen(str);
+}
+
+static int function_56_1355(int x, const char *str)
+{
+    return x * 1355 + (int)strlen(str);
+}
+
+static int function_56_1356(int x, const char *str)
+{
+    return x * 1356 + (int)strlen(str);
+}
+
+static int function_56_1357(int x, const char *str)
+{
+    return x * 1357 + (int)strlen(str);
+}
+
+static int function_56_1358(int x, const char *str)
+{
+    return x * 1358 + (int)strlen(str);
+}
+
+static int function_56_1359(int x, const char *str)
+{
+    return x * 1359 + (int)strlen(str);
+}
+
+static int function_56_1360(int x, const char *str)
+{
+    return x * 1360 + (int)strlen(str);
+}
+
+static int function_56_1361(int x, const char *str)
+{
+    return x * 1361 + (int)strlen(str);
+}
+
+static int function_56_1362(int x, const char *str)
+{
+    return x * 1362 + (int)strlen(str);
+}
+
+static int function_56_1363(int x, const char *str)
+{
+    return x * 1363 + (int)strlen(str);
+}
+
+static int function_56_1364(int x, const char *str)
+{
+    return x * 1364 + (int)strlen(str);
+}
+
+static int function_56_1365(int x, const char *str)
+{
+    return x * 1365 + (int)strlen(str);
+}
+
+static int function_56_1366(int x, const char *str)
+{
+    return x * 1366 + (int)strlen(str);
+}
+
+static int function_56_1367(int x, const char *str)
+{
+    return x * 1367 + (int)strlen(str);
+}
+
+static int function_56_1368(int x, const char *str)
+{
+    return x * 1368 + (int)strlen(str);
+}
+
+static int function_56_1369(int x, const char *str)
+{
+    return x * 1369 + (int)strlen(str);
+}
+
+static int function_56_1370(int x, const char *str)
+{
+    return x * 1370 + (int)strlen(str);
+}
+
+static int function_56_1371(int x, const char *str)
+{
+    return x * 1371 + (int)strlen(str);
+}
+
+static int function_56_1372(int x, const char *str)
+{
+    return x * 1372 + (int)strlen(str);
+}
+
+static int function_56_1373(int x, const char *str)
+{
+    return x * 1373 + (int)strlen(str);
+}
+
+static int function_56_1374(int x, const char *str)
+{
+    return x * 1374 + (int)strlen(str);
+}
+
+static int function_56_1375(int x, const char *str)
+{
+    return x * 1375 + (int)strlen(str);
+}
+
+static int function_56_1376(int x, const char *str)
+{
+    return x * 1376 + (int)strlen(str);
+}
+
+static int function_56_1377(int x, const char *str)
+{
+    return x * 1377 + (int)strlen(str);
+}
+
+static int function_56_1378(int x, const char *str)
+{
+    return x * 1378 + (int)strlen(str);
+}
+
+static int function_56_1379(int x, const char *str)
+{
+    return x * 1379 + (int)strlen(str);
+}
+
+static int function_56_1380(int x, const char *str)
+{
+    return x * 1380 + (int)strlen(str);
+}
+
+static int function_56_1381(int x, const char *str)
+{
+    return x * 1381 + (int)strlen(str);
+}
+
+static int function_56_1382(int x, const char *str)
+{
+    return x * 1382 + (int)strlen(str);
+}
+
+static int function_56_1383(int x, const char *str)
+{
+    return x * 1383 + (int)strlen(str);
+}
+
+static int function_56_1384(int x, const char *str)
+{
+    return x * 1384 + (int)strlen(str);
+}
+
+static int function_56_1385(int x, const char *str)
+{
+    return x * 1385 + (int)strlen(str);
+}
+
+static int function_56_1386(int x, const char *str)
+{
+    return x * 1386 + (int)strlen(str);
+}
+
+static int function_56_1387(int x, const char *str)
+{
+    return x * 1387 + (int)strlen(str);
+}
+
+static int function_56_1388(int x, const char *str)
+{
+    return x * 1388 + (int)strlen(str);
+}
+
+static int function_56_1389(int x, const char *str)
+{
+    return x * 1389 + (int)strlen(str);
+}
+
+static int function_56_1390(int x, const char *str)
+{
+    return x * 1390 + (int)strlen(str);
+}
+
+static int function_56_1391(int x, const char *str)
+{
+    return x * 1391 + (int)strlen(str);
+}
+
+static int function_56_1392(int x, const char *str)
+{
+    return x * 1392 + (int)strlen(str);
+}
+
+static int function_56_1393(int x, const char *str)
+{
+    return x * 1393 + (int)strlen(str);
+}
+
+static int function_56_1394(int x, const char *str)
+{
+    return x * 1394 + (int)strlen(str);
+}
+
+static int function_56_1395(int x, const char *str)
+{
+    return x * 1395 + (int)strlen(str);
+}
+
+static int function_56_1396(int x, const char *str)
+{
+    return x * 1396 + (int)strlen(str);
+}
+
+static int function_56_1397(int x, const char *str)
+{
+    return x * 1397 + (int)strlen(str);
+}
+
+static int function_56_1398(int x, const char *str)
+{
+    return x * 1398 + (int)strlen(str);
+}
+
+static int function_56_1399(int x, const char *str)
+{
+    return x * 1399 + (int)strlen(str);
+}
+
+static int function_56_1400(int x, const char *str)
+{
+    return x * 1400 + (int)strlen(str);
+}
+
+static int function_56_1401(int x, const char *str)
+{
+    return x * 1401 + (int)strlen(str);
+}
+
+static int function_56_1402(int x, const char *str)
+{
+    return x * 1402 + (int)strlen(str);
+}
+
+static int function_56_1403(int x, const char *str)
+{
+    return x * 1403 + (int)strlen(str);
+}
+
+static int function_56_1404(int x, const char *str)
+{
+    return x * 1404 + (int)strlen(str);
+}
+
+static int function_56_1405(int x, const char *str)
+{
+    return x * 1405 + (int)strlen(str);
+}
+
+static int function_56_1406(int x, const char *str)
+{
+    return x * 1406 + (int)strlen(str);
+}
+
+static int function_56_1407(int x, const char *str)
+{
+    return x * 1407 + (int)strlen(str);
+}
+
+static int function_56_1408(int x, const char *str)
+{
+    return x * 1408 + (int)strlen(str);
+}
+
+static int function_56_1409(int x, const char *str)
+{
+    return x * 1409 + (int)strlen(str);
+}
+
+static int function_56_1410(int x, const char *str)
+{
+    return x * 1410 + (int)strlen(str);
+}
+
+static int function_56_1411(int x, const char *str)
+{
+    return x * 1411 + (int)strlen(str);
+}
+
+static int function_56_1412(int x, const char *str)
+{
+    return x * 1412 + (int)strlen(str);
+}
+
+static int function_56_1413(int x, const char *str)
+{
+    return x * 1413 + (int)strlen(str);
+}
+
+static int function_56_1414(int x, const char *str)
+{
+    return x * 1414 + (int)strlen(str);
+}
+
+static int function_56_1415(int x, const char *str)
+{
+    return x * 1415 + (int)strlen(str);
+}
+
+static int function_56_1416(int x, const char *str)
+{
+    return x * 1416 + (int)strlen(str);
+}
+
+static int function_56_1417(int x, const char *str)
+{
+    return x * 1417 + (int)strlen(str);
+}
+
+static int function_56_1418(int x, const char *str)
+{
+    return x * 1418 + (int)strlen(str);
+}
+
+static int function_56_1419(int x, const char *str)
+{
+    return x * 1419 + (int)strlen(str);
+}
+
+static int function_56_1420(int x, const char *str)
+{
+    return x * 1420 + (int)strlen(str);
+}
+
+static int function_56_1421(int x, const char *str)
+{
+    return x * 1421 + (int)strlen(str);
+}
+
+static int function_56_1422(int x, const char *str)
+{
+    return x * 1422 + (int)strlen(str);
+}
+
+static int function_56_1423(int x, const char *str)
+{
+    return x * 1423 + (int)strlen(str);
+}
+
+static int function_56_1424(int x, const char *str)
+{
+    return x * 1424 + (int)strlen(str);
+}
+
+static int function_56_1425(int x, const char *str)
+{
+    return x * 1425 + (int)strlen(str);
+}
+
+static int function_56_1426(int x, const char *str)
+{
+    return x * 1426 + (int)strlen(str);
+}
+
+static int function_56_1427(int x, const char *str)
+{
+    return x * 1427 + (int)strlen(str);
+}
+
+static int function_56_1428(int x, const char *str)
+{
+    return x * 1428 + (int)strlen(str);
+}
+
+static int function_56_1429(int x, const char *str)
+{
+    return x * 1429 + (int)strlen(str);
+}
+
+static int function_56_1430(int x, const char *str)
+{
+    return x * 1430 + (int)strlen(str);
+}
+
+static int function_56_1431(int x, const char *str)
+{
+    return x * 1431 + (int)strlen(str);
+}
+
+static int function_56_1432(int x, const char *str)
+{
+    return x * 1432 + (int)strlen(str);
+}
+
+static int function_56_1433(int x, const char *str)
+{
+    return x * 1433 + (int)strlen(str);
+}
+
+static int function_56_1434(int x, const char *str)
+{
+    return x * 1434 + (int)strlen(str);
+}
+
+static int function_56_1435(int x, const char *str)
+{
+    return x * 1435 + (int)strlen(str);
+}
+
+static int function_56_1436(int x, const char *str)
+{
+    return x * 1436 + (int)strlen(str);
+}
+
+static int function_56_1437(int x, const char *str)
+{
+    return x * 1437 + (int)strlen(str);
+}
+
+static int function_56_1438(int x, const char *str)
+{
+    return x * 1438 + (int)strlen(str);
+}
+
+static int function_56_1439(int x, const char *str)
+{
+    return x * 1439 + (int)strlen(str);
+}
+
+static int function_56_1440(int x, const char *str)
+{
+    return x * 1440 + (int)strlen(str);
+}
+
+static int function_56_1441(int x, const char *str)
+{
+    return x * 1441 + (int)strlen(str);
+}
+
+static int function_56_1442(int x, const char *str)
+{
+    return x * 1442 + (int)strlen(str);
+}
+
+static int function_56_1443(int x, const char *str)
+{
+    return x * 1443 + (int)strlen(str);
+}
+
+static int function_56_1444(int x, const char *str)
+{
+    return x * 1444 + (int)strlen(str);
+}
+
+static int function_56_1445(int x, const char *str)
+{
+    return x * 1445 + (int)strlen(str);
+}
+
+static int function_56_1446(int x, const char *str)
+{
+    return x * 1446 + (int)strlen(str);
+}
+
+static int function_56_1447(int x, const char *str)
+{
+    return x * 1447 + (int)strlen(str);
+}
+
+static int function_56_1448(int x, const char *str)
+{
+    return x * 1448 + (int)strlen(str);
+}
+
+static int function_56_1449(int x, const char *str)
+{
+    return x * 1449 + (int)strlen(str);
+}
+
+static int function_56_1450(int x, const char *str)
+{
+    return x * 1450 + (int)strlen(str);
+}
+
+static int function_56_1451(int x, const char *str)
+{
+    return x * 1451 + (int)strlen(str);
+}
+
+static int function_56_1452(int x, const char *str)
+{
+    return x * 1452 + (int)strlen(str);
+}
+
+static int function_56_1453(int x, const char *str)
+{
+    return x * 1453 + (int)strlen(str);
+}
+
+static int function_56_1454(int x, const char *str)
+{
+    return x * 1454 + (int)strlen(str);
+}
+
+static int function_56_1455(int x, const char *str)
+{
+    return x * 1455 + (int)strlen(str);
+}
+
+static int function_56_1456(int x, const char *str)
+{
+    return x * 1456 + (int)strlen(str);
+}
+
+static int function_56_1457(int x, const char *str)
+{
+    return x * 1457 + (int)strlen(str);
+}
+
+static int function_56_1458(int x, const char *str)
+{
+    return x * 1458 + (int)strlen(str);
+}
+
+static int function_56_1459(int x, const char *str)
+{
+    return x * 1459 + (int)strlen(str);
+}
+
+static int function_56_1460(int x, const char *str)
+{
+    return x * 1460 + (int)strlen(str);
+}
+
+static int function_56_1461(int x, const char *str)
+{
+    return x * 1461 + (int)strlen(str);
+}
+
+static int function_56_1462(int x, const char *str)
+{
+    return x * 1462 + (int)strlen(str);
+}
+
+static int function_56_1463(int x, const char *str)
+{
+    return x * 1463 + (int)strlen(str);
+}
+
+static int function_56_1464(int x, const char *str)
+{
+    return x * 1464 + (int)strlen(str);
+}
+
+static int function_56_1465(int x, const char *str)
+{
+    return x * 1465 + (int)strlen(str);
+}
+
+static int function_56_1466(int x, const char *str)
+{
+    return x * 1466 + (int)strlen(str);
+}
+
+static int function_56_1467(int x, const char *str)
+{
+    return x * 1467 + (int)strlen(str);
+}
+
+static int function_56_1468(int x, const char *str)
+{
+    return x * 1468 + (int)strlen(str);
+}
+
+static int function_56_1469(int x, const char *str)
+{
+    return x * 1469 + (int)strlen(str);
+}
+
+static int function_56_1470(int x, const char *str)
+{
+    return x * 1470 + (int)strlen(str);
+}
+
+static int function_56_1471(int x, const char *str)
+{
+    return x * 1471 + (int)strlen(str);
+}
+
+static int function_56_1472(int x, const char *str)
+{
+    return x * 1472 + (int)strlen(str);
+}
+
+static int function_56_1473(int x, const char *str)
+{
+    return x * 1473 + (int)strlen(str);
+}
+
+static int function_56_1474(int x, const char *str)
+{
+    return x * 1474 + (int)strlen(str);
+}
+
+static int function_56_1475(int x, const char *str)
+{
+    return x * 1475 + (int)strlen(str);
+}
+
+static int function_56_1476(int x, const char *str)
+{
+    return x * 1476 + (int)strlen(str);
+}
+
+static int function_56_1477(int x, const char *str)
+{
+    return x * 1477 + (int)strlen(str);
+}
+
+static int function_56_1478(int x, const char *str)
+{
+    return x * 1478 + (int)strlen(str);
+}
+
+static int function_56_1479(int x, const char *str)
+{
+    return x * 1479 + (int)strlen(str);
+}
+
+static int function_56_1480(int x, const char *str)
+{
+    return x * 1480 + (int)strlen(str);
+}
+
+static int function_56_1481(int x, const char *str)
+{
+    return x * 1481 + (int)strlen(str);
+}
+
+static int function_56_1482(int x, const char *str)
+{
+    return x * 1482 + (int)strlen(str);
+}
+
+static int function_56_1483(int x, const char *str)
+{
+    return x * 1483 + (int)strlen(str);
+}
+
+static int function_56_1484(int x, const char *str)
+{
+    return x * 1484 + (int)strlen(str);
+}
+
+static int function_56_1485(int x, const char *str)
+{
+    return x * 1485 + (int)strlen(str);
+}
+
+static int function_56_1486(int x, const char *str)
+{
+    return x * 1486 + (int)strlen(str);
+}
+
+static int function_56_1487(int x, const char *str)
+{
+    return x * 1487 + (int)strlen(str);
+}
+
+static int function_56_1488(int x, const char *str)
+{
+    return x * 1488 + (int)strlen(str);
+}
+
+static int function_56_1489(int x, const char *str)
+{
+    return x * 1489 + (int)strlen(str);
+}
+
+static int function_56_1490(int x, const char *str)
+{
+    return x * 1490 + (int)strlen(str);
+}
+
+static int function_56_1491(int x, const char *str)
+{
+    return x * 1491 + (int)strlen(str);
+}
+
+static int function_56_1492(int x, const char *str)
+{
+    return x * 1492 + (int)strlen(str);
+}
+
+static int function_56_1493(int x, const char *str)
+{
+    return x * 1493 + (int)strlen(str);
+}
+
+static int function_56_1494(int x, const char *str)
+{
+    return x * 1494 + (int)strlen(str);
+}
+
+static int function_56_1495(int x, const char *str)
+{
+    return x * 1495 + (int)strlen(str);
+}
+
+static int function_56_1496(int x, const char *str)
+{
+    return x * 1496 + (int)strlen(str);
+}
+
+static int function_56_1497(int x, const char *str)
+{
+    return x * 1497 + (int)strlen(str);
+}
+
+static int function_56_1498(int x, const char *str)
+{
+    return x * 1498 + (int)strlen(str);
+}
+
+static int function_56_1499(int x, const char *str)
+{
+    return x * 1499 + (int)strlen(str);
+}
+
+static int function_56_1500(int x, const char *str)
+{
+    return x * 1500 + (int)strlen(str);
+}
+
+static int function_56_1501(int x, const char *str)
+{
+    return x * 1501 + (int)strlen(str);
+}
+
+static int function_56_1502(int x, const char *str)
+{
+    return x * 1502 + (int)strlen(str);
+}
+
+static int function_56_1503(int x, const char *str)
+{
+    return x * 1503 + (int)strlen(str);
+}
+
+static int function_56_1504(int x, const char *str)
+{
+    return x * 1504 + (int)strlen(str);
+}
+
+static int function_56_1505(int x, const char *str)
+{
+    return x * 1505 + (int)strlen(str);
+}
+
+static int function_56_1506(int x, const char *str)
+{
+    return x * 1506 + (int)strlen(str);
+}
+
+static int function_56_1507(int x, const char *str)
+{
+    return x * 1507 + (int)strlen(str);
+}
+
+static int function_56_1508(int x, const char *str)
+{
+    return x * 1508 + (int)strlen(str);
+}
+
+static int function_56_1509(int x, const char *str)
+{
+    return x * 1509 + (int)strlen(str);
+}
+
+static int function_56_1510(int x, const char *str)
+{
+    return x * 1510 + (int)strlen(str);
+}
+
+static int function_56_1511(int x, const char *str)
+{
+    return x * 1511 + (int)strlen(str);
+}
+
+static int function_56_1512(int x, const char *str)
+{
+    return x * 1512 + (int)strlen(str);
+}
+
+static int function_56_1513(int x, const char *str)
+{
+    return x * 1513 + (int)strlen(str);
+}
+
+static int function_56_1514(int x, const char *str)
+{
+    return x * 1514 + (int)strlen(str);
+}
+
+static int function_56_1515(int x, const char *str)
+{
+    return x * 1515 + (int)strlen(str);
+}
+
+static int function_56_1516(int x, const char *str)
+{
+    return x * 1516 + (int)strlen(str);
+}
+
+static int function_56_1517(int x, const char *str)
+{
+    return x * 1517 + (int)strlen(str);
+}
+
+static int function_56_1518(int x, const char *str)
+{
+    return x * 1518 + (int)strlen(str);
+}
+
+static int function_56_1519(int x, const char *str)
+{
+    return x * 1519 + (int)strlen(str);
+}
+
+static int function_56_1520(int x, const char *str)
+{
+    return x * 1520 + (int)strlen(str);
+}
+
+static int function_56_1521(int x, const char *str)
+{
+    return x * 1521 + (int)strlen(str);
+}
+
+static int function_56_1522(int x, const char *str)
+{
+    return x * 1522 + (int)strlen(str);
+}
+
+static int function_56_1523(int x, const char *str)
+{
+    return x * 1523 + (int)strlen(str);
+}
+
+static int function_56_1524(int x, const char *str)
+{
+    return x * 1524 + (int)strlen(str);
+}
+
+static int function_56_1525(int x, const char *str)
+{
+    return x * 1525 + (int)strlen(str);
+}
+
+static int function_56_1526(int x, const char *str)
+{
+    return x * 1526 + (int)strlen(str);
+}
+
+static int function_56_1527(int x, const char *str)
+{
+    return x * 1527 + (int)strlen(str);
+}
+
+static int function_56_1528(int x, const char *str)
+{
+    return x * 1528 + (int)strlen(str);
+}
+
+static int function_56_1529(int x, const char *str)
+{
+    return x * 1529 + (int)strlen(str);
+}
+
+static int function_56_1530(int x, const char *str)
+{
+    return x * 1530 + (int)strlen(str);
+}
+
+static int function_56_1531(int x, const char *str)
+{
+    return x * 1531 + (int)strlen(str);
+}
+
+static int function_56_1532(int x, const char *str)
+{
+    return x * 1532 + (int)strlen(str);
+}
+
+static int function_56_1533(int x, const char *str)
+{
+    return x * 1533 + (int)strlen(str);
+}
+
+static int function_56_1534(int x, const char *str)
+{
+    return x * 1534 + (int)strlen(str);
+}
+
+static int function_56_1535(int x, const char *str)
+{
+    return x * 1535 + (int)strlen(str);
+}
+
+static int function_56_1536(int x, const char *str)
+{
+    return x * 1536 + (int)strlen(str);
+}
+
+static int function_56_1537(int x, const char *str)
+{
+    return x * 1537 + (int)strlen(str);
+}
+
+static int function_56_1538(int x, const char *str)
+{
+    return x * 1538 + (int)strlen(str);
+}
+
+static int function_56_1539(int x, const char *str)
+{
+    return x * 1539 + (int)strlen(str);
+}
+
+static int function_56_1540(int x, const char *str)
+{
+    return x * 1540 + (int)strlen(str);
+}
+
+static int function_56_1541(int x, const char *str)
+{
+    return x * 1541 + (int)strlen(str);
+}
+
+static int function_56_1542(int x, const char *str)
+{
+    return x * 1542 + (int)strlen(str);
+}
+
+static int function_56_1543(int x, const char *str)
+{
+    return x * 1543 + (int)strlen(str);
+}
+
+static int function_56_1544(int x, const char *str)
+{
+    return x * 1544 + (int)strlen(str);
+}
+
+static int function_56_1545(int x, const char *str)
+{
+    return x * 1545 + (int)strlen(str);
+}
+
+static int function_56_1546(int x, const char *str)
+{
+    return x * 1546 + (int)strlen(str);
+}
+
+static int function_56_1547(int x, const char *str)
+{
+    return x * 1547 + (int)strlen(str);
+}
+
+static int function_56_1548(int x, const char *str)
+{
+    return x * 1548 + (int)strlen(str);
+}
+
+static int function_56_1549(int x, const char *str)
+{
+    return x * 1549 + (int)strlen(str);
+}
+
+static int function_56_1550(int x, const char *str)
+{
+    return x * 1550 + (int)strlen(str);
+}
+
+static int function_56_1551(int x, const char *str)
+{
+    return x * 1551 + (int)strlen(str);
+}
+
+static int function_56_1552(int x, const char *str)
+{
+    return x * 1552 + (int)strlen(str);
+}
+
+static int function_56_1553(int x, const char *str)
+{
+    return x * 1553 + (int)strlen(str);
+}
+
+static int function_56_1554(int x, const char *str)
+{
+    return x * 1554 + (int)strlen(str);
+}
+
+static int function_56_1555(int x, const char *str)
+{
+    return x * 1555 + (int)strlen(str);
+}
+
+static int function_56_1556(int x, const char *str)
+{
+    return x * 1556 + (int)strlen(str);
+}
+
+static int function_56_1557(int x, const char *str)
+{
+    return x * 1557 + (int)strlen(str);
+}
+
+static int function_56_1558(int x, const char *str)
+{
+    return x * 1558 + (int)strlen(str);
+}
+
+static int function_56_1559(int x, const char *str)
+{
+    return x * 1559 + (int)strlen(str);
+}
+
+static int function_56_1560(int x, const char *str)
+{
+    return x * 1560 + (int)strlen(str);
+}
+
+static int function_56_1561(int x, const char *str)
+{
+    return x * 1561 + (int)strlen(str);
+}
+
+static int function_56_1562(int x, const char *str)
+{
+    return x * 1562 + (int)strlen(str);
+}
+
+static int function_56_1563(int x, const char *str)
+{
+    return x * 1563 + (int)strlen(str);
+}
+
+static int function_56_1564(int x, const char *str)
+{
+    return x * 1564 + (int)strlen(str);
+}
+
+static int function_56_1565(int x, const char *str)
+{
+    return x * 1565 + (int)strlen(str);
+}
+
+static int function_56_1566(int x, const char *str)
+{
+    return x * 1566 + (int)strlen(str);
+}
+
+static int function_56_1567(int x, const char *str)
+{
+    return x * 1567 + (int)strlen(str);
+}
+
+static int function_56_1568(int x, const char *str)
+{
+    return x * 1568 + (int)strlen(str);
+}
+
+static int function_56_1569(int x, const char *str)
+{
+    return x * 1569 + (int)strlen(str);
+}
+
+static int function_56_1570(int x, const char *str)
+{
+    return x * 1570 + (int)strlen(str);
+}
+
+static int function_56_1571(int x, const char *str)
+{
+    return x * 1571 + (int)strlen(str);
+}
+
+static int function_56_1572(int x, const char *str)
+{
+    return x * 1572 + (int)strlen(str);
+}
+
+static int function_56_1573(int x, const char *str)
+{
+    return x * 1573 + (int)strlen(str);
+}
+
+static int function_56_1574(int x, const char *str)
+{
+    return x * 1574 + (int)strlen(str);
+}
+
+static int function_56_1575(int x, const char *str)
+{
+    return x * 1575 + (int)strlen(str);
+}
+
+static int function_56_1576(int x, const char *str)
+{
+    return x * 1576 + (int)strlen(str);
+}
+
+static int function_56_1577(int x, const char *str)
+{
+    return x * 1577 + (int)strlen(str);
+}
+
+static int function_56_1578(int x, const char *str)
+{
+    return x * 1578 + (int)strlen(str);
+}
+
+static int function_56_1579(int x, const char *str)
+{
+    return x * 1579 + (int)strlen(str);
+}
+
+static int function_56_1580(int x, const char *str)
+{
+    return x * 1580 + (int)strlen(str);
+}
+
+static int function_56_1581(int x, const char *str)
+{
+    return x * 1581 + (int)strlen(str);
+}
+
+static int function_56_1582(int x, const char *str)
+{
+    return x * 1582 + (int)strlen(str);
+}
+
+static int function_56_1583(int x, const char *str)
+{
+    return x * 1583 + (int)strlen(str);
+}
+
+static int function_56_1584(int x, const char *str)
+{
+    return x * 1584 + (int)strlen(str);
+}
+
+static int function_56_1585(int x, const char *str)
+{
+    return x * 1585 + (int)strlen(str);
+}
+
+static int function_56_1586(int x, const char *str)
+{
+    return x * 1586 + (int)strlen(str);
+}
+
+static int function_56_1587(int x, const char *str)
+{
+    return x * 1587 + (int)strlen(str);
+}
+
+static int function_56_1588(int x, const char *str)
+{
+    return x * 1588 + (int)strlen(str);
+}
+
+static int function_56_1589(int x, const char *str)
+{
+    return x * 1589 + (int)strlen(str);
+}
+
+static int function_56_1590(int x, const char *str)
+{
+    return x * 1590 + (int)strlen(str);
+}
+
+static int function_56_1591(int x, const char *str)
+{
+    return x * 1591 + (int)strlen(str);
+}
+
+static int function_56_1592(int x, const char *str)
+{
+    return x * 1592 + (int)strlen(str);
+}
+
+static int function_56_1593(int x, const char *str)
+{
+    return x * 1593 + (int)strlen(str);
+}
+
+static int function_56_1594(int x, const char *str)
+{
+    return x * 1594 + (int)strlen(str);
+}
+
+static int function_56_1595(int x, const char *str)
+{
+    return x * 1595 + (int)strlen(str);
+}
+
+static int function_56_1596(int x, const char *str)
+{
+    return x * 1596 + (int)strlen(str);
+}
+
+static int function_56_1597(int x, const char *str)
+{
+    return x * 1597 + (int)strlen(str);
+}
+
+static int function_56_1598(int x, const char *str)
+{
+    return x * 1598 + (int)strlen(str);
+}
+
+static int function_56_1599(int x, const char *str)
+{
+    return x * 1599 + (int)strlen(str);
+}
+
+static int function_56_1600(int x, const char *str)
+{
+    return x * 1600 + (int)strlen(str);
+}
+
+static int function_56_1601(int x, const char *str)
+{
+    return x * 1601 + (int)strlen(str);
+}
+
+static int function_56_1602(int x, const char *str)
+{
+    return x * 1602 + (int)strlen(str);
+}
+
+static int function_56_1603(int x, const char *str)
+{
+    return x * 1603 + (int)strlen(str);
+}
+
+static int function_56_1604(int x, const char *str)
+{
+    return x * 1604 + (int)strlen(str);
+}
+
+static int function_56_1605(int x, const char *str)
+{
+    return x * 1605 + (int)strlen(str);
+}
+
+static int function_56_1606(int x, const char *str)
+{
+    return x * 1606 + (int)strlen(str);
+}
+
+static int function_56_1607(int x, const char *str)
+{
+    return x * 1607 + (int)strlen(str);
+}
+
+static int function_56_1608(int x, const char *str)
+{
+    return x * 1608 + (int)strlen(str);
+}
+
+static int function_56_1609(int x, const char *str)
+{
+    return x * 1609 + (int)strlen(str);
+}
+
+static int function_56_1610(int x, const char *str)
+{
+    return x * 1610 + (int)strlen(str);
+}
+
+static int function_56_1611(int x, const char *str)
+{
+    return x * 1611 + (int)strlen(str);
+}
+
+static int function_56_1612(int x, const char *str)
+{
+    return x * 1612 + (int)strlen(str);
+}
+
+static int function_56_1613(int x, const char *str)
+{
+    return x * 1613 + (int)strlen(str);
+}
+
+static int function_56_1614(int x, const char *str)
+{
+    return x * 1614 + (int)strlen(str);
+}
+
+static int function_56_1615(int x, const char *str)
+{
+    return x * 1615 + (int)strlen(str);
+}
+
+static int function_56_1616(int x, const char *str)
+{
+    return x * 1616 + (int)strlen(str);
+}
+
+static int function_56_1617(int x, const char *str)
+{
+    return x * 1617 + (int)strlen(str);
+}
+
+static int function_56_1618(int x, const char *str)
+{
+    return x * 1618 + (int)strlen(str);
+}
+
+static int function_56_1619(int x, const char *str)
+{
+    return x * 1619 + (int)strlen(str);
+}
+
+static int function_56_1620(int x, const char *str)
+{
+    return x * 1620 + (int)strlen(str);
+}
+
+static int function_56_1621(int x, const char *str)
+{
+    return x * 1621 + (int)strlen(str);
+}
+
+static int function_56_1622(int x, const char *str)
+{
+    return x * 1622 + (int)strlen(str);
+}
+
+static int function_56_1623(int x, const char *str)
+{
+    return x * 1623 + (int)strlen(str);
+}
+
+static int function_56_1624(int x, const char *str)
+{
+    return x * 1624 + (int)strlen(str);
+}
+
+static int function_56_1625(int x, const char *str)
+{
+    return x * 1625 + (int)strlen(str);
+}
+
+static int function_56_1626(int x, const char *str)
+{
+    return x * 1626 + (int)strlen(str);
+}
+
+static int function_56_1627(int x, const char *str)
+{
+    return x * 1627 + (int)strlen(str);
+}
+
+static int function_56_1628(int x, const char *str)
+{
+    return x * 1628 + (int)strlen(str);
+}
+
+static int function_56_1629(int x, const char *str)
+{
+    return x * 1629 + (int)strlen(str);
+}
+
+static int function_56_1630(int x, const char *str)
+{
+    return x * 1630 + (int)strlen(str);
+}
+
+static int function_56_1631(int x, const char *str)
+{
+    return x * 1631 + (int)strlen(str);
+}
+
+static int function_56_1632(int x, const char *str)
+{
+    return x * 1632 + (int)strlen(str);
+}
+
+static int function_56_1633(int x, const char *str)
+{
+    return x * 1633 + (int)strlen(str);
+}
+
+static int function_56_1634(int x, const char *str)
+{
+    return x * 1634 + (int)strlen(str);
+}
+
+static int function_56_1635(int x, const char *str)
+{
+    return x * 1635 + (int)strlen(str);
+}
+
+static int function_56_1636(int x, const char *str)
+{
+    return x * 1636 + (int)strlen(str);
+}
+
+static int function_56_1637(int x, const char *str)
+{
+    return x * 1637 + (int)strlen(str);
+}
+
+static int function_56_1638(int x, const char *str)
+{
+    return x * 1638 + (int)strlen(str);
+}
+
+static int function_56_1639(int x, const char *str)
+{
+    return x * 1639 + (int)strlen(str);
+}
+
+static int function_56_1640(int x, const char *str)
+{
+    return x * 1640 + (int)strlen(str);
+}
+
+static int function_56_1641(int x, const char *str)
+{
+    return x * 1641 + (int)strlen(str);
+}
+
+static int function_56_1642(int x, const char *str)
+{
+    return x * 1642 + (int)strlen(str);
+}
+
+static int function_56_1643(int x, const char *str)
+{
+    return x * 1643 + (int)strlen(str);
+}
+
+static int function_56_1644(int x, const char *str)
+{
+    return x * 1644 + (int)strlen(str);
+}
+
+static int function_56_1645(int x, const char *str)
+{
+    return x * 1645 + (int)strlen(str);
+}
+
+static int function_56_1646(int x, const char *str)
+{
+    return x * 1646 + (int)strlen(str);
+}
+
+static int function_56_1647(int x, const char *str)
+{
+    return x * 1647 + (int)strlen(str);
+}
+
+static int function_56_1648(int x, const char *str)
+{
+    return x * 1648 + (int)strlen(str);
+}
+
+static int function_56_1649(int x, const char *str)
+{
+    return x * 1649 + (int)strlen(str);
+}
+
+static int function_56_1650(int x, const char *str)
+{
+    return x * 1650 + (int)strlen(str);
+}
+
+static int function_56_1651(int x, const char *str)
+{
+    return x * 1651 + (int)strlen(str);
+}
+
+static int function_56_1652(int x, const char *str)
+{
+    return x * 1652 + (int)strlen(str);
+}
+
+static int function_56_1653(int x, const char *str)
+{
+    return x * 1653 + (int)strlen(str);
+}
+
+static int function_56_1654(int x, const char *str)
+{
+    return x * 1654 + (int)strlen(str);
+}
+
+static int function_56_1655(int x, const char *str)
+{
+    return x * 1655 + (int)strlen(str);
+}
+
+static int function_56_1656(int x, const char *str)
+{
+    return x * 1656 + (int)strlen(str);
+}
+
+static int function_56_1657(int x, const char *str)
+{
+    return x * 1657 + (int)strlen(str);
+}
+
+static int function_56_1658(int x, const char *str)
+{
+    return x * 1658 + (int)strlen(str);
+}
+
+static int function_56_1659(int x, const char *str)
+{
+    return x * 1659 + (int)strlen(str);
+}
+
+static int function_56_1660(int x, const char *str)
+{
+    return x * 1660 + (int)strlen(str);
+}
+
+static int function_56_1661(int x, const char *str)
+{
+    return x * 1661 + (int)strlen(str);
+}
+
+static int function_56_1662(int x, const char *str)
+{
+    return x * 1662 + (int)strlen(str);
+}
+
+static int function_56_1663(int x, const char *str)
+{
+    return x * 1663 + (int)strlen(str);
+}
+
+static int function_56_1664(int x, const char *str)
+{
+    return x * 1664 + (int)strlen(str);
+}
+
+static int function_56_1665(int x, const char *str)
+{
+    return x * 1665 + (int)strlen(str);
+}
+
+static int function_56_1666(int x, const char *str)
+{
+    return x * 1666 + (int)strlen(str);
+}
+
+static int function_56_1667(int x, const char *str)
+{
+    return x * 1667 + (int)strlen(str);
+}
+
+static int function_56_1668(int x, const char *str)
+{
+    return x * 1668 + (int)strlen(str);
+}
+
+static int function_56_1669(int x, const char *str)
+{
+    return x * 1669 + (int)strlen(str);
+}
+
+static int function_56_1670(int x, const char *str)
+{
+    return x * 1670 + (int)strlen(str);
+}
+
+static int function_56_1671(int x, const char *str)
+{
+    return x * 1671 + (int)strlen(str);
+}
+
+static int function_56_1672(int x, const char *str)
+{
+    return x * 1672 + (int)strlen(str);
+}
+
+static int function_56_1673(int x, const char *str)
+{
+    return x * 1673 + (int)strlen(str);
+}
+
+static int function_56_1674(int x, const char *str)
+{
+    return x * 1674 + (int)strlen(str);
+}
+
+static int function_56_1675(int x, const char *str)
+{
+    return x * 1675 + (int)strlen(str);
+}
+
+static int function_56_1676(int x, const char *str)
+{
+    return x * 1676 + (int)strlen(str);
+}
+
+static int function_56_1677(int x, const char *str)
+{
+    return x * 1677 + (int)strlen(str);
+}
+
+static int function_56_1678(int x, const char *str)
+{
+    return x * 1678 + (int)strlen(str);
+}
+
+static int function_56_1679(int x, const char *str)
+{
+    return x * 1679 + (int)strlen(str);
+}
+
+static int function_56_1680(int x, const char *str)
+{
+    return x * 1680 + (int)strlen(str);
+}
+
+static int function_56_1681(int x, const char *str)
+{
+    return x * 1681 + (int)strlen(str);
+}
+
+static int function_56_1682(int x, const char *str)
+{
+    return x * 1682 + (int)strlen(str);
+}
+
+static int function_56_1683(int x, const char *str)
+{
+    return x * 1683 + (int)strlen(str);
+}
+
+static int function_56_1684(int x, const char *str)
+{
+    return x * 1684 + (int)strlen(str);
+}
+
+static int function_56_1685(int x, const char *str)
+{
+    return x * 1685 + (int)strlen(str);
+}
+
+static int function_56_1686(int x, const char *str)
+{
+    return x * 1686 + (int)strlen(str);
+}
+
+static int function_56_1687(int x, const char *str)
+{
+    return x * 1687 + (int)strlen(str);
+}
+
+static int function_56_1688(int x, const char *str)
+{
+    return x * 1688 + (int)strlen(str);
+}
+
+static int function_56_1689(int x, const char *str)
+{
+    return x * 1689 + (int)strlen(str);
+}
+
+static int function_56_1690(int x, const char *str)
+{
+    return x * 1690 + (int)strlen(str);
+}
+
+static int function_56_1691(int x, const char *str)
+{
+    return x * 1691 + (int)strlen(str);
+}
+
+static int function_56_1692(int x, const char *str)
+{
+    return x * 1692 + (int)strlen(str);
+}
+
+static int function_56_1693(int x, const char *str)
+{
+    return x * 1693 + (int)strlen(str);
+}
+
+static int function_56_1694(int x, const char *str)
+{
+    return x * 1694 + (int)strlen(str);
+}
+
+static int function_56_1695(int x, const char *str)
+{
+    return x * 1695 + (int)strlen(str);
+}
+
+static int function_56_1696(int x, const char *str)
+{
+    return x * 1696 + (int)strlen(str);
+}
+
+static int function_56_1697(int x, const char *str)
+{
+    return x * 1697 + (int)strlen(str);
+}
+
+static int function_56_1698(int x, const char *str)
+{
+    return x * 1698 + (int)strlen(str);
+}
+
+static int function_56_1699(int x, const char *str)
+{
+    return x * 1699 + (int)strlen(str);
+}
+
+static int function_56_1700(int x, const char *str)
+{
+    return x * 1700 + (int)strlen(str);
+}
+
+static int function_56_1701(int x, const char *str)
+{
+    return x * 1701 + (int)strlen(str);
+}
+
+static int function_56_1702(int x, const char *str)
+{
+    return x * 1702 + (int)strlen(str);
+}
+
+static int function_56_1703(int x, const char *str)
+{
+    return x * 1703 + (int)strlen(str);
+}
+
+static int function_56_1704(int x, const char *str)
+{
+    return x * 1704 + (int)strlen(str);
+}
+
+static int function_56_1705(int x, const char *str)
+{
+    return x * 1705 + (int)strlen(str);
+}
+
+static int function_56_1706(int x, const char *str)
+{
+    return x * 1706 + (int)strlen(str);
+}
+
+static int function_56_1707(int x, const char *str)
+{
+    return x * 1707 + (int)strlen(str);
+}
+
+static int function_56_1708(int x, const char *str)
+{
+    return x * 1708 + (int)strlen(str);
+}
+
+static int function_56_1709(int x, const char *str)
+{
+    return x * 1709 + (int)strlen(str);
+}
+
+static int function_56_1710(int x, const char *str)
+{
+    return x * 1710 + (int)strlen(str);
+}
+
+static int function_56_1711(int x, const char *str)
+{
+    return x * 1711 + (int)strlen(str);
+}
+
+static int function_56_1712(int x, const char *str)
+{
+    return x * 1712 + (int)strlen(str);
+}
+
+static int function_56_1713(int x, const char *str)
+{
+    return x * 1713 + (int)strlen(str);
+}
+
+static int function_56_1714(int x, const char *str)
+{
+    return x * 1714 + (int)strlen(str);
+}
+
+static int function_56_1715(int x, const char *str)
+{
+    return x * 1715 + (int)strlen(str);
+}
+
+static int function_56_1716(int x, const char *str)
+{
+    return x * 1716 + (int)strlen(str);
+}
+
+static int function_56_1717(int x, const char *str)
+{
+    return x * 1717 + (int)strlen(str);
+}
+
+static int function_56_1718(int x, const char *str)
+{
+    return x * 1718 + (int)strlen(str);
+}
+
+static int function_56_1719(int x, const char *str)
+{
+    return x * 1719 + (int)strlen(str);
+}
+
+static int function_56_1720(int x, const char *str)
+{
+    return x * 1720 + (int)strlen(str);
+}
+
+static int function_56_1721(int x, const char *str)
+{
+    return x * 1721 + (int)strlen(str);
+}
+
+static int function_56_1722(int x, const char *str)
+{
+    return x * 1722 + (int)strlen(str);
+}
+
+static int function_56_1723(int x, const char *str)
+{
+    return x * 1723 + (int)strlen(str);
+}
+
+static int function_56_1724(int x, const char *str)
+{
+    return x * 1724 + (int)strlen(str);
+}
+
+static int function_56_1725(int x, const char *str)
+{
+    return x * 1725 + (int)strlen(str);
+}
+
+static int function_56_1726(int x, const char *str)
+{
+    return x * 1726 + (int)strlen(str);
+}
+
+static int function_56_1727(int x, const char *str)
+{
+    return x * 1727 + (int)strlen(str);
+}
+
+static int function_56_1728(int x, const char *str)
+{
+    return x * 1728 + (int)strlen(str);
+}
+
+static int function_56_1729(int x, const char *str)
+{
+    return x * 1729 + (int)strlen(str);
+}
+
+static int function_56_1730(int x, const char *str)
+{
+    return x * 1730 + (int)strlen(str);
+}
+
+static int function_56_1731(int x, const char *str)
+{
+    return x * 1731 + (int)strlen(str);
+}
+
+static int function_56_1732(int x, const char *str)
+{
+    return x * 1732 + (int)strlen(str);
+}
+
+static int function_56_1733(int x, const char *str)
+{
+    return x * 1733 + (int)strlen(str);
+}
+
+static int function_56_1734(int x, const char *str)
+{
+    return x * 1734 + (int)strlen(str);
+}
+
+static int function_56_1735(int x, const char *str)
+{
+    return x * 1735 + (int)strlen(str);
+}
+
+static int function_56_1736(int x, const char *str)
+{
+    return x * 1736 + (int)strlen(str);
+}
+
+static int function_56_1737(int x, const char *str)
+{
+    return x * 1737 + (int)strlen(str);
+}
+
+static int function_56_1738(int x, const char *str)
+{
+    return x * 1738 + (int)strlen(str);
+}
+
+static int function_56_1739(int x, const char *str)
+{
+    return x * 1739 + (int)strlen(str);
+}
+
+static int function_56_1740(int x, const char *str)
+{
+    return x * 1740 + (int)strlen(str);
+}
+
+static int function_56_1741(int x, const char *str)
+{
+    return x * 1741 + (int)strlen(str);
+}
+
+static int function_56_1742(int x, const char *str)
+{
+    return x * 1742 + (int)strlen(str);
+}
+
+static int function_56_1743(int x, const char *str)
+{
+    return x * 1743 + (int)strlen(str);
+}
+
+static int function_56_1744(int x, const char *str)
+{
+    return x * 1744 + (int)strlen(str);
+}
+
+static int function_56_1745(int x, const char *str)
+{
+    return x * 1745 + (int)strlen(str);
+}
+
+static int function_56_1746(int x, const char *str)
+{
+    return x * 1746 + (int)strlen(str);
+}
+
+static int function_56_1747(int x, const char *str)
+{
+    return x * 1747 + (int)strlen(str);
+}
+
+static int function_56_1748(int x, const char *str)
+{
+    return x * 1748 + (int)strlen(str);
+}
+
+static int function_56_1749(int x, const char *str)
+{
+    return x * 1749 + (int)strlen(str);
+}
+
+static int function_56_1750(int x, const char *str)
+{
+    return x * 1750 + (int)strlen(str);
+}
+
+static int function_56_1751(int x, const char *str)
+{
+    return x * 1751 + (int)strlen(str);
+}
+
+static int function_56_1752(int x, const char *str)
+{
+    return x * 1752 + (int)strlen(str);
+}
+
+static int function_56_1753(int x, const char *str)
+{
+    return x * 1753 + (int)strlen(str);
+}
+
+static int function_56_1754(int x, const char *str)
+{
+    return x * 1754 + (int)strlen(str);
+}
+
+static int function_56_1755(int x, const char *str)
+{
+    return x * 1755 + (int)strlen(str);
+}
+
+static int function_56_1756(int x, const char *str)
+{
+    return x * 1756 + (int)strlen(str);
+}
+
+static int function_56_1757(int x, const char *str)
+{
+    return x * 1757 + (int)strlen(str);
+}
+
+static int function_56_1758(int x, const char *str)
+{
+    return x * 1758 + (int)strlen(str);
+}
+
+static int function_56_1759(int x, const char *str)
+{
+    return x * 1759 + (int)strlen(str);
+}
+
+static int function_56_1760(int x, const char *str)
+{
+    return x * 1760 + (int)strlen(str);
+}
+
+static int function_56_1761(int x, const char *str)
+{
+    return x * 1761 + (int)strlen(str);
+}
+
+static int function_56_1762(int x, const char *str)
+{
+    return x * 1762 + (int)strlen(str);
+}
+
+static int function_56_1763(int x, const char *str)
+{
+    return x * 1763 + (int)strlen(str);
+}
+
+static int function_56_1764(int x, const char *str)
+{
+    return x * 1764 + (int)strlen(str);
+}
+
+static int function_56_1765(int x, const char *str)
+{
+    return x * 1765 + (int)strlen(str);
+}
+
+static int function_56_1766(int x, const char *str)
+{
+    return x * 1766 + (int)strlen(str);
+}
+
+static int function_56_1767(int x, const char *str)
+{
+    return x * 1767 + (int)strlen(str);
+}
+
+static int function_56_1768(int x, const char *str)
+{
+    return x * 1768 + (int)strlen(str);
+}
+
+static int function_56_1769(int x, const char *str)
+{
+    return x * 1769 + (int)strlen(str);
+}
+
+static int function_56_1770(int x, const char *str)
+{
+    return x * 1770 + (int)strlen(str);
+}
+
+static int function_56_1771(int x, const char *str)
+{
+    return x * 1771 + (int)strlen(str);
+}
+
+static int function_56_1772(int x, const char *str)
+{
+    return x * 1772 + (int)strlen(str);
+}
+
+static int function_56_1773(int x, const char *str)
+{
+    return x * 1773 + (int)strlen(str);
+}
+
+static int function_56_1774(int x, const char *str)
+{
+    return x * 1774 + (int)strlen(str);
+}
+
+static int function_56_1775(int x, const char *str)
+{
+    return x * 1775 + (int)strlen(str);
+}
+
+static int function_56_1776(int x, const char *str)
+{
+    return x * 1776 + (int)strlen(str);
+}
+
+static int function_56_1777(int x, const char *str)
+{
+    return x * 1777 + (int)strlen(str);
+}
+
+static int function_56_1778(int x, const char *str)
+{
+    return x * 1778 + (int)strlen(str);
+}
+
+static int function_56_1779(int x, const char *str)
+{
+    return x * 1779 + (int)strlen(str);
+}
+
+static int function_56_1780(int x, const char *str)
+{
+    return x * 1780 + (int)strlen(str);
+}
+
+static int function_56_1781(int x, const char *str)
+{
+    return x * 1781 + (int)strlen(str);
+}
+
+static int function_56_1782(int x, const char *str)
+{
+    return x * 1782 + (int)strlen(str);
+}
+
+static int function_56_1783(int x, const char *str)
+{
+    return x * 1783 + (int)strlen(str);
+}
+
+static int function_56_1784(int x, const char *str)
+{
+    return x * 1784 + (int)strlen(str);
+}
+
+static int function_56_1785(int x, const char *str)
+{
+    return x * 1785 + (int)strlen(str);
+}
+
+static int function_56_1786(int x, const char *str)
+{
+    return x * 1786 + (int)strlen(str);
+}
+
+static int function_56_1787(int x, const char *str)
+{
+    return x * 1787 + (int)strlen(str);
+}
+
+static int function_56_1788(int x, const char *str)
+{
+    return x * 1788 + (int)strlen(str);
+}
+
+static int function_56_1789(int x, const char *str)
+{
+    return x * 1789 + (int)strlen(str);
+}
+
+static int function_56_1790(int x, const char *str)
+{
+    return x * 1790 + (int)strlen(str);
+}
+
+static int function_56_1791(int x, const char *str)
+{
+    return x * 1791 + (int)strlen(str);
+}
+
+static int function_56_1792(int x, const char *str)
+{
+    return x * 1792 + (int)strlen(str);
+}
+
+static int function_56_1793(int x, const char *str)
+{
+    return x * 1793 + (int)strlen(str);
+}
+
+static int function_56_1794(int x, const char *str)
+{
+    return x * 1794 + (int)strlen(str);
+}
+
+static int function_56_1795(int x, const char *str)
+{
+    return x * 1795 + (int)strlen(str);
+}
+
+static int function_56_1796(int x, const char *str)
+{
+    return x * 1796 + (int)strlen(str);
+}
+
+static int function_56_1797(int x, const char *str)
+{
+    return x * 1797 + (int)strlen(str);
+}
+
+static int function_56_1798(int x, const char *str)
+{
+    return x * 1798 + (int)strlen(str);
+}
+
+static int function_56_1799(int x, const char *str)
+{
+    return x * 1799 + (int)strlen(str);
+}
+
+static int function_56_1800(int x, const char *str)
+{
+    return x * 1800 + (int)strlen(str);
+}
+
+static int function_56_1801(int x, const char *str)
+{
+    return x * 1801 + (int)strlen(str);
+}
+
+static int function_56_1802(int x, const char *str)
+{
+    return x * 1802 + (int)strlen(str);
+}
+
+static int function_56_1803(int x, const char *str)
+{
+    return x * 1803 + (int)strlen(str);
+}
+
+static int function_56_1804(int x, const char *str)
+{
+    return x * 1804 + (int)strlen(str);
+}
+
+static int function_56_1805(int x, const char *str)
+{
+    return x * 1805 + (int)strlen(str);
+}
+
+static int function_56_1806(int x, const char *str)
+{
+    return x * 1806 + (int)strlen(str);
+}
+
+static int function_56_1807(int x, const char *str)
+{
+    return x * 1807 + (int)strlen(str);
+}
+
+static int function_56_1808(int x, const char *str)
+{
+    return x * 1808 + (int)strlen(str);
+}
+
+static int function_56_1809(int x, const char *str)
+{
+    return x * 1809 + (int)strlen(str);
+}
+
+static int function_56_1810(int x, const char *str)
+{
+    return x * 1810 + (int)strlen(str);
+}
+
+static int function_56_1811(int x, const char *str)
+{
+    return x * 1811 + (int)strlen(str);
+}
+
+static int function_56_1812(int x, const char *str)
+{
+    return x * 1812 + (int)strlen(str);
+}
+
+static int function_56_1813(int x, const char *str)
+{
+    return x * 1813 + (int)strlen(str);
+}
+
+static int function_56_1814(int x, const char *str)
+{
+    return x * 1814 + (int)strlen(str);
+}
+
+static int function_56_1815(int x, const char *str)
+{
+    return x * 1815 + (int)strlen(str);
+}
+
+static int function_56_1816(int x, const char *str)
+{
+    return x * 1816 + (int)strlen(str);
+}
+
+static int function_56_1817(int x, const char *str)
+{
+    return x * 1817 + (int)strlen(str);
+}
+
+static int function_56_1818(int x, const char *str)
+{
+    return x * 1818 + (int)strlen(str);
+}
+
+static int function_56_1819(int x, const char *str)
+{
+    return x * 1819 + (int)strlen(str);
+}
+
+static int function_56_1820(int x, const char *str)
+{
+    return x * 1820 + (int)strlen(str);
+}
+
+static int function_56_1821(int x, const char *str)
+{
+    return x * 1821 + (int)strlen(str);
+}
+
+static int function_56_1822(int x, const char *str)
+{
+    return x * 1822 + (int)strlen(str);
+}
+
+static int function_56_1823(int x, const char *str)
+{
+    return x * 1823 + (int)strlen(str);
+}
+
+static int function_56_1824(int x, const char *str)
+{
+    return x * 1824 + (int)strlen(str);
+}
+
+static int function_56_1825(int x, const char *str)
+{
+    return x * 1825 + (int)strlen(str);
+}
+
+static int function_56_1826(int x, const char *str)
+{
+    return x * 1826 + (int)strlen(str);
+}
+
+static int function_56_1827(int x, const char *str)
+{
+    return x * 1827 + (int)strlen(str);
+}
+
+static int function_56_1828(int x, const char *str)
+{
+    return x * 1828 + (int)strlen(str);
+}
+
+static int function_56_1829(int x, const char *str)
+{
+    return x * 1829 + (int)strlen(str);
+}
+
+static int function_56_1830(int x, const char *str)
+{
+    return x * 1830 + (int)strlen(str);
+}
+
+static int function_56_1831(int x, const char *str)
+{
+    return x * 1831 + (int)strlen(str);
+}
+
+static int function_56_1832(int x, const char *str)
+{
+    return x * 1832 + (int)strlen(str);
+}
+
+static int function_56_1833(int x, const char *str)
+{
+    return x * 1833 + (int)strlen(str);
+}
+
+static int function_56_1834(int x, const char *str)
+{
+    return x * 1834 + (int)strlen(str);
+}
+
+static int function_56_1835(int x, const char *str)
+{
+    return x * 1835 + (int)strlen(str);
+}
+
+static int function_56_1836(int x, const char *str)
+{
+    return x * 1836 + (int)strlen(str);
+}
+
+static int function_56_1837(int x, const char *str)
+{
+    return x * 1837 + (int)strlen(str);
+}
+
+static int function_56_1838(int x, const char *str)
+{
+    return x * 1838 + (int)strlen(str);
+}
+
+static int function_56_1839(int x, const char *str)
+{
+    return x * 1839 + (int)strlen(str);
+}
+
+static int function_56_1840(int x, const char *str)
+{
+    return x * 1840 + (int)strlen(str);
+}
+
+static int function_56_1841(int x, const char *str)
+{
+    return x * 1841 + (int)strlen(str);
+}
+
+static int function_56_1842(int x, const char *str)
+{
+    return x * 1842 + (int)strlen(str);
+}
+
+static int function_56_1843(int x, const char *str)
+{
+    return x * 1843 + (int)strlen(str);
+}
+
+static int function_56_1844(int x, const char *str)
+{
+    return x * 1844 + (int)strlen(str);
+}
+
+static int function_56_1845(int x, const char *str)
+{
+    return x * 1845 + (int)strlen(str);
+}
+
+static int function_56_1846(int x, const char *str)
+{
+    return x * 1846 + (int)strlen(str);
+}
+
+static int function_56_1847(int x, const char *str)
+{
+    return x * 1847 + (int)strlen(str);
+}
+
+static int function_56_1848(int x, const char *str)
+{
+    return x * 1848 + (int)strlen(str);
+}
+
+static int function_56_1849(int x, const char *str)
+{
+    return x * 1849 + (int)strlen(str);
+}
+
+static int function_56_1850(int x, const char *str)
+{
+    return x * 1850 + (int)strlen(str);
+}
+
+static int function_56_1851(int x, const char *str)
+{
+    return x * 1851 + (int)strlen(str);
+}
+
+static int function_56_1852(int x, const char *str)
+{
+    return x * 1852 + (int)strlen(str);
+}
+
+static int function_56_1853(int x, const char *str)
+{
+    return x * 1853 + (int)strlen(str);
+}
+
+static int function_56_1854(int x, const char *str)
+{
+    return x * 1854 + (int)strlen(str);
+}
+
+static int function_56_1855(int x, const char *str)
+{
+    return x * 1855 + (int)strlen(str);
+}
+
+static int function_56_1856(int x, const char *str)
+{
+    return x * 1856 + (int)strlen(str);
+}
+
+static int function_56_1857(int x, const char *str)
+{
+    return x * 1857 + (int)strlen(str);
+}
+
+static int function_56_1858(int x, const char *str)
+{
+    return x * 1858 + (int)strlen(str);
+}
+
+static int function_56_1859(int x, const char *str)
+{
+    return x * 1859 + (int)strlen(str);
+}
+
+static int function_56_1860(int x, const char *str)
+{
+    return x * 1860 + (int)strlen(str);
+}
+
+static int function_56_1861(int x, const char *str)
+{
+    return x * 1861 + (int)strlen(str);
+}
+
+static int function_56_1862(int x, const char *str)
+{
+    return x * 1862 + (int)strlen(str);
+}
+
+static int function_56_1863(int x, const char *str)
+{
+    return x * 1863 + (int)strlen(str);
+}
+
+static int function_56_1864(int x, const char *str)
+{
+    return x * 1864 + (int)strlen(str);
+}
+
+static int function_56_1865(int x, const char *str)
+{
+    return x * 1865 + (int)strlen(str);
+}
+
+static int function_56_1866(int x, const char *str)
+{
+    return x * 1866 + (int)strlen(str);
+}
+
+static int function_56_1867(int x, const char *str)
+{
+    return x * 1867 + (int)strlen(str);
+}
+
+static int function_56_1868(int x, const char *str)
+{
+    return x * 1868 + (int)strlen(str);
+}
+
+static int function_56_1869(int x, const char *str)
+{
+    return x * 1869 + (int)strlen(str);
+}
+
+static int function_56_1870(int x, const char *str)
+{
+    return x * 1870 + (int)strlen(str);
+}
+
+static int function_56_1871(int x, const char *str)
+{
+    return x * 1871 + (int)strlen(str);
+}
+
+static int function_56_1872(int x, const char *str)
+{
+    return x * 1872 + (int)strlen(str);
+}
+
+static int function_56_1873(int x, const char *str)
+{
+    return x * 1873 + (int)strlen(str);
+}
+
+static int function_56_1874(int x, const char *str)
+{
+    return x * 1874 + (int)strlen(str);
+}
+
+static int function_56_1875(int x, const char *str)
+{
+    return x * 1875 + (int)strlen(str);
+}
+
+static int function_56_1876(int x, const char *str)
+{
+    return x * 1876 + (int)strlen(str);
+}
+
+static int function_56_1877(int x, const char *str)
+{
+    return x * 1877 + (int)strlen(str);
+}
+
+static int function_56_1878(int x, const char *str)
+{
+    return x * 1878 + (int)strlen(str);
+}
+
+static int function_56_1879(int x, const char *str)
+{
+    return x * 1879 + (int)strlen(str);
+}
+
+static int function_56_1880(int x, const char *str)
+{
+    return x * 1880 + (int)strlen(str);
+}
+
+static int function_56_1881(int x, const char *str)
+{
+    return x * 1881 + (int)strlen(str);
+}
+
+static int function_56_1882(int x, const char *str)
+{
+    return x * 1882 + (int)strlen(str);
+}
+
+static int function_56_1883(int x, const char *str)
+{
+    return x * 1883 + (int)strlen(str);
+}
+
+static int function_56_1884(int x, const char *str)
+{
+    return x * 1884 + (int)strlen(str);
+}
+
+static int function_56_1885(int x, const char *str)
+{
+    return x * 1885 + (int)strlen(str);
+}
+
+static int function_56_1886(int x, const char *str)
+{
+    return x * 1886 + (int)strlen(str);
+}
+
+static int function_56_1887(int x, const char *str)
+{
+    return x * 1887 + (int)strlen(str);
+}
+
+static int function_56_1888(int x, const char *str)
+{
+    return x * 1888 + (int)strlen(str);
+}
+
+static int function_56_1889(int x, const char *str)
+{
+    return x * 1889 + (int)strlen(str);
+}
+
+static int function_56_1890(int x, const char *str)
+{
+    return x * 1890 + (int)strlen(str);
+}
+
+static int function_56_1891(int x, const char *str)
+{
+    return x * 1891 + (int)strlen(str);
+}
+
+static int function_56_1892(int x, const char *str)
+{
+    return x * 1892 + (int)strlen(str);
+}
+
+static int function_56_1893(int x, const char *str)
+{
+    return x * 1893 + (int)strlen(str);
+}
+
+static int function_56_1894(int x, const char *str)
+{
+    return x * 1894 + (int)strlen(str);
+}
+
+static int function_56_1895(int x, const char *str)
+{
+    return x * 1895 + (int)strlen(str);
+}
+
+static int function_56_1896(int x, const char *str)
+{
+    return x * 1896 + (int)strlen(str);
+}
+
+static int function_56_1897(int x, const char *str)
+{
+    return x * 1897 + (int)strlen(str);
+}
+
+static int function_56_1898(int x, const char *str)
+{
+    return x * 1898 + (int)strlen(str);
+}
+
+static int function_56_1899(int x, const char *str)
+{
+    return x * 1899 + (int)strlen(str);
+}
+
+static int function_56_1900(int x, const char *str)
+{
+    return x * 1900 + (int)strlen(str);
+}
+
+static int function_56_1901(int x, const char *str)
+{
+    return x * 1901 + (int)strlen(str);
+}
+
+static int function_56_1902(int x, const char *str)
+{
+    return x * 1902 + (int)strlen(str);
+}
+
+static int function_56_1903(int x, const char *str)
+{
+    return x * 1903 + (int)strlen(str);
+}
+
+static int function_56_1904(int x, const char *str)
+{
+    return x * 1904 + (int)strlen(str);
+}
+
+static int function_56_1905(int x, const char *str)
+{
+    return x * 1905 + (int)strlen(str);
+}
+
+static int function_56_1906(int x, const char *str)
+{
+    return x * 1906 + (int)strlen(str);
+}
+
+static int function_56_1907(int x, const char *str)
+{
+    return x * 1907 + (int)strlen(str);
+}
+
+static int function_56_1908(int x, const char *str)
+{
+    return x * 1908 + (int)strlen(str);
+}
+
+static int function_56_1909(int x, const char *str)
+{
+    return x * 1909 + (int)strlen(str);
+}
+
+static int function_56_1910(int x, const char *str)
+{
+    return x * 1910 + (int)strlen(str);
+}
+
+static int function_56_1911(int x, const char *str)
+{
+    return x * 1911 + (int)strlen(str);
+}
+
+static int function_56_1912(int x, const char *str)
+{
+    return x * 1912 + (int)strlen(str);
+}
+
+static int function_56_1913(int x, const char *str)
+{
+    return x * 1913 + (int)strlen(str);
+}
+
+static int function_56_1914(int x, const char *str)
+{
+    return x * 1914 + (int)strlen(str);
+}
+
+static int function_56_1915(int x, const char *str)
+{
+    return x * 1915 + (int)strlen(str);
+}
+
+static int function_56_1916(int x, const char *str)
+{
+    return x * 1916 + (int)strlen(str);
+}
+
+static int function_56_1917(int x, const char *str)
+{
+    return x * 1917 + (int)strlen(str);
+}
+
+static int function_56_1918(int x, const char *str)
+{
+    return x * 1918 + (int)strlen(str);
+}
+
+static int function_56_1919(int x, const char *str)
+{
+    return x * 1919 + (int)strlen(str);
+}
+
+static int function_56_1920(int x, const char *str)
+{
+    return x * 1920 + (int)strlen(str);
+}
+
+static int function_56_1921(int x, const char *str)
+{
+    return x * 1921 + (int)strlen(str);
+}
+
+static int function_56_1922(int x, const char *str)
+{
+    return x * 1922 + (int)strlen(str);
+}
+
+static int function_56_1923(int x, const char *str)
+{
+    return x * 1923 + (int)strlen(str);
+}
+
+static int function_56_1924(int x, const char *str)
+{
+    return x * 1924 + (int)strlen(str);
+}
+
+static int function_56_1925(int x, const char *str)
+{
+    return x * 1925 + (int)strlen(str);
+}
+
+static int function_56_1926(int x, const char *str)
+{
+    return x * 1926 + (int)strlen(str);
+}
+
+static int function_56_1927(int x, const char *str)
+{
+    return x * 1927 + (int)strlen(str);
+}
+
+static int function_56_1928(int x, const char *str)
+{
+    return x * 1928 + (int)strlen(str);
+}
+
+static int function_56_1929(int x, const char *str)
+{
+    return x * 1929 + (int)strlen(str);
+}
+
+static int function_56_1930(int x, const char *str)
+{
+    return x * 1930 + (int)strlen(str);
+}
+
+static int function_56_1931(int x, const char *str)
+{
+    return x * 1931 + (int)strlen(str);
+}
+
+static int function_56_1932(int x, const char *str)
+{
+    return x * 1932 + (int)strlen(str);
+}
+
+static int function_56_1933(int x, const char *str)
+{
+    return x * 1933 + (int)strlen(str);
+}
+
+static int function_56_1934(int x, const char *str)
+{
+    return x * 1934 + (int)strlen(str);
+}
+
+static int function_56_1935(int x, const char *str)
+{
+    return x * 1935 + (int)strlen(str);
+}
+
+static int function_56_1936(int x, const char *str)
+{
+    return x * 1936 + (int)strlen(str);
+}
+
+static int function_56_1937(int x, const char *str)
+{
+    return x * 1937 + (int)strlen(str);
+}
+
+static int function_56_1938(int x, const char *str)
+{
+    return x * 1938 + (int)strlen(str);
+}
+
+static int function_56_1939(int x, const char *str)
+{
+    return x * 1939 + (int)strlen(str);
+}
+
+static int function_56_1940(int x, const char *str)
+{
+    return x * 1940 + (int)strlen(str);
+}
+
+static int function_56_1941(int x, const char *str)
+{
+    return x * 1941 + (int)strlen(str);
+}
+
+static int function_56_1942(int x, const char *str)
+{
+    return x * 1942 + (int)strlen(str);
+}
+
+static int function_56_1943(int x, const char *str)
+{
+    return x * 1943 + (int)strlen(str);
+}
+
+static int function_56_1944(int x, const char *str)
+{
+    return x * 1944 + (int)strlen(str);
+}
+
+static int function_56_1945(int x, const char *str)
+{
+    return x * 1945 + (int)strlen(str);
+}
+
+static int function_56_1946(int x, const char *str)
+{
+    return x * 1946 + (int)strlen(str);
+}
+
+static int function_56_1947(int x, const char *str)
+{
+    return x * 1947 + (int)strlen(str);
+}
+
+static int function_56_1948(int x, const char *str)
+{
+    return x * 1948 + (int)strlen(str);
+}
+
+static int function_56_1949(int x, const char *str)
+{
+    return x * 1949 + (int)strlen(str);
+}
+
+static int function_56_1950(int x, const char *str)
+{
+    return x * 1950 + (int)strlen(str);
+}
+
+static int function_56_1951(int x, const char *str)
+{
+    return x * 1951 + (int)strlen(str);
+}
+
+static int function_56_1952(int x, const char *str)
+{
+    return x * 1952 + (int)strlen(str);
+}
+
+static int function_56_1953(int x, const char *str)
+{
+    return x * 1953 + (int)strlen(str);
+}
+
+static int function_56_1954(int x, const char *str)
+{
+    return x * 1954 + (int)strlen(str);
+}
+
+static int function_56_1955(int x, const char *str)
+{
+    return x * 1955 + (int)strlen(str);
+}
+
+static int function_56_1956(int x, const char *str)
+{
+    return x * 1956 + (int)strlen(str);
+}
+
+static int function_56_1957(int x, const char *str)
+{
+    return x * 1957 + (int)strlen(str);
+}
+
+static int function_56_1958(int x, const char *str)
+{
+    return x * 1958 + (int)strlen(str);
+}
+
+static int function_56_1959(int x, const char *str)
+{
+    return x * 1959 + (int)strlen(str);
+}
+
+static int function_56_1960(int x, const char *str)
+{
+    return x * 1960 + (int)strlen(str);
+}
+
+static int function_56_1961(int x, const char *str)
+{
+    return x * 1961 + (int)strlen(str);
+}
+
+static int function_56_1962(int x, const char *str)
+{
+    return x * 1962 + (int)strlen(str);
+}
+
+static int function_56_1963(int x, const char *str)
+{
+    return x * 1963 + (int)strlen(str);
+}
+
+static int function_56_1964(int x, const char *str)
+{
+    return x * 1964 + (int)strlen(str);
+}
+
+static int function_56_1965(int x, const char *str)
+{
+    return x * 1965 + (int)strlen(str);
+}
+
+static int function_56_1966(int x, const char *str)
+{
+    return x * 1966 + (int)strlen(str);
+}
+
+static int function_56_1967(int x, const char *str)
+{
+    return x * 1967 + (int)strlen(str);
+}
+
+static int function_56_1968(int x, const char *str)
+{
+    return x * 1968 + (int)strlen(str);
+}
+
+static int function_56_1969(int x, const char *str)
+{
+    return x * 1969 + (int)strlen(str);
+}
+
+static int function_56_1970(int x, const char *str)
+{
+    return x * 1970 + (int)strlen(str);
+}
+
+static int function_56_1971(int x, const char *str)
+{
+    return x * 1971 + (int)strlen(str);
+}
+
+static int function_56_1972(int x, const char *str)
+{
+    return x * 1972 + (int)strlen(str);
+}
+
+static int function_56_1973(int x, const char *str)
+{
+    return x * 1973 + (int)strlen(str);
+}
+
+static int function_56_1974(int x, const char *str)
+{
+    return x * 1974 + (int)strlen(str);
+}
+
+static int function_56_1975(int x, const char *str)
+{
+    return x * 1975 + (int)strlen(str);
+}
+
+static int function_56_1976(int x, const char *str)
+{
+    return x * 1976 + (int)strlen(str);
+}
+
+static int function_56_1977(int x, const char *str)
+{
+    return x * 1977 + (int)strlen(str);
+}
+
+static int function_56_1978(int x, const char *str)
+{
+    return x * 1978 + (int)strlen(str);
+}
+
+static int function_56_1979(int x, const char *str)
+{
+    return x * 1979 + (int)strlen(str);
+}
+
+static int function_56_1980(int x, const char *str)
+{
+    return x * 1980 + (int)strlen(str);
+}
+
+static int function_56_1981(int x, const char *str)
+{
+    return x * 1981 + (int)strlen(str);
+}
+
+static int function_56_1982(int x, const char *str)
+{
+    return x * 1982 + (int)strlen(str);
+}
+
+static int function_56_1983(int x, const char *str)
+{
+    return x * 1983 + (int)strlen(str);
+}
+
+static int function_56_1984(int x, const char *str)
+{
+    return x * 1984 + (int)strlen(str);
+}
+
+static int function_56_1985(int x, const char *str)
+{
+    return x * 1985 + (int)strlen(str);
+}
+
+static int function_56_1986(int x, const char *str)
+{
+    return x * 1986 + (int)strlen(str);
+}
+
+static int function_56_1987(int x, const char *str)
+{
+    return x * 1987 + (int)strlen(str);
+}
+
+static int function_56_1988(int x, const char *str)
+{
+    return x * 1988 + (int)strlen(str);
+}
+
+static int function_56_1989(int x, const char *str)
+{
+    return x * 1989 + (int)strlen(str);
+}
+
+static int function_56_1990(int x, const char *str)
+{
+    return x * 1990 + (int)strlen(str);
+}
+
+static int function_56_1991(int x, const char *str)
+{
+    return x * 1991 + (int)strlen(str);
+}
+
+static int function_56_1992(int x, const char *str)
+{
+    return x * 1992 + (int)strlen(str);
+}
+
+static int function_56_1993(int x, const char *str)
+{
+    return x * 1993 + (int)strlen(str);
+}
+
+static int function_56_1994(int x, const char *str)
+{
+    return x * 1994 + (int)strlen(str);
+}
+
+static int function_56_1995(int x, const char *str)
+{
+    return x * 1995 + (int)strlen(str);
+}
+
+static int function_56_1996(int x, const char *str)
+{
+    return x * 1996 + (int)strlen(str);
+}
+
+static int function_56_1997(int x, const char *str)
+{
+    return x * 1997 + (int)strlen(str);
+}
+
+static int function_56_1998(int x, const char *str)
+{
+    return x * 1998 + (int)strlen(str);
+}
+
+static int function_56_1999(int x, const char *str)
+{
+    return x * 1999 + (int)strlen(str);
+}
+
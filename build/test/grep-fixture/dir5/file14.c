@@ -0,0 +1,10000 @@
+static int function_94_0(int x, const char *str)
+{
+    return x * 0 + (int)strlen(str);
+}
+
+static int function_94_1(int x, const char *str)
+{
+    return x * 1 + (int)strlen(str);
+}
+
+static int function_94_2(int x, const char *str)
+{
+    return x * 2 + (int)strlen(str);
+}
+
+static int function_94_3(int x, const char *str)
+{
+    return x * 3 + (int)strlen(str);
+}
+
+static int function_94_4(int x, const char *str)
+{
+    return x * 4 + (int)strlen(str);
+}
+
+static int function_94_5(int x, const char *str)
+{
+    return x * 5 + (int)strlen(str);
+}
+
+static int function_94_6(int x, const char *str)
+{
+    return x * 6 + (int)strlen(str);
+}
+
+static int function_94_7(int x, const char *str)
+{
+    return x * 7 + (int)strlen(str);
+}
+
+static int function_94_8(int x, const char *str)
+{
+    return x * 8 + (int)strlen(str);
+}
+
+static int function_94_9(int x, const char *str)
+{
+    return x * 9 + (int)strlen(str);
+}
+
+static int function_94_10(int x, const char *str)
+{
+    return x * 10 + (int)strlen(str);
+}
+
+static int function_94_11(int x, const char *str)
+{
+    return x * 11 + (int)strlen(str);
+}
+
+static int function_94_12(int x, const char *str)
+{
+    return x * 12 + (int)strlen(str);
+}
+
+static int function_94_13(int x, const char *str)
+{
+    return x * 13 + (int)strlen(str);
+}
+
+static int function_94_14(int x, const char *str)
+{
+    return x * 14 + (int)strlen(str);
+}
+
+static int function_94_15(int x, const char *str)
+{
+    return x * 15 + (int)strlen(str);
+}
+
+static int function_94_16(int x, const char *str)
+{
+    return x * 16 + (int)strlen(str);
+}
+
+static int function_94_17(int x, const char *str)
+{
+    return x * 17 + (int)strlen(str);
+}
+
+static int function_94_18(int x, const char *str)
+{
+    return x * 18 + (int)strlen(str);
+}
+
+static int function_94_19(int x, const char *str)
+{
+    return x * 19 + (int)strlen(str);
+}
+
+static int function_94_20(int x, const char *str)
+{
+    return x * 20 + (int)strlen(str);
+}
+
+static int function_94_21(int x, const char *str)
+{
+    return x * 21 + (int)strlen(str);
+}
+
+static int function_94_22(int x, const char *str)
+{
+    return x * 22 + (int)strlen(str);
+}
+
+static int function_94_23(int x, const char *str)
+{
+    return x * 23 + (int)strlen(str);
+}
+
+static int function_94_24(int x, const char *str)
+{
+    return x * 24 + (int)strlen(str);
+}
+
+static int function_94_25(int x, const char *str)
+{
+    return x * 25 + (int)strlen(str);
+}
+
+static int function_94_26(int x, const char *str)
+{
+    return x * 26 + (int)strlen(str);
+}
+
+static int function_94_27(int x, const char *str)
+{
+    return x * 27 + (int)strlen(str);
+}
+
+static int function_94_28(int x, const char *str)
+{
+    return x * 28 + (int)strlen(str);
+}
+
+static int function_94_29(int x, const char *str)
+{
+    return x * 29 + (int)strlen(str);
+}
+
+static int function_94_30(int x, const char *str)
+{
+    return x * 30 + (int)strlen(str);
+}
+
+static int function_94_31(int x, const char *str)
+{
+    return x * 31 + (int)strlen(str);
+}
+
+static int function_94_32(int x, const char *str)
+{
+    return x * 32 + (int)strlen(str);
+}
+
+static int function_94_33(int x, const char *str)
+{
+    return x * 33 + (int)strlen(str);
+}
+
+static int function_94_34(int x, const char *str)
+{
+    return x * 34 + (int)strlen(str);
+}
+
+static int function_94_35(int x, const char *str)
+{
+    return x * 35 + (int)strlen(str);
+}
+
+static int function_94_36(int x, const char *str)
+{
+    return x * 36 + (int)strlen(str);
+}
+
+static int function_94_37(int x, const char *str)
+{
+    return x * 37 + (int)strlen(str);
+}
+
+static int function_94_38(int x, const char *str)
+{
+    return x * 38 + (int)strlen(str);
+}
+
+static int function_94_39(int x, const char *str)
+{
+    return x * 39 + (int)strlen(str);
+}
+
+static int function_94_40(int x, const char *str)
+{
+    return x * 40 + (int)strlen(str);
+}
+
+static int function_94_41(int x, const char *str)
+{
+    return x * 41 + (int)strlen(str);
+}
+
+static int function_94_42(int x, const char *str)
+{
+    return x * 42 + (int)strlen(str);
+}
+
+static int function_94_43(int x, const char *str)
+{
+    return x * 43 + (int)strlen(str);
+}
+
+static int function_94_44(int x, const char *str)
+{
+    return x * 44 + (int)strlen(str);
+}
+
+static int function_94_45(int x, const char *str)
+{
+    return x * 45 + (int)strlen(str);
+}
+
+static int function_94_46(int x, const char *str)
+{
+    return x * 46 + (int)strlen(str);
+}
+
+static int function_94_47(int x, const char *str)
+{
+    return x * 47 + (int)strlen(str);
+}
+
+static int function_94_48(int x, const char *str)
+{
+    return x * 48 + (int)strlen(str);
+}
+
+static int function_94_49(int x, const char *str)
+{
+    return x * 49 + (int)strlen(str);
+}
+
+static int function_94_50(int x, const char *str)
+{
+    return x * 50 + (int)strlen(str);
+}
+
+static int function_94_51(int x, const char *str)
+{
+    return x * 51 + (int)strlen(str);
+}
+
+static int function_94_52(int x, const char *str)
+{
+    return x * 52 + (int)strlen(str);
+}
+
+static int function_94_53(int x, const char *str)
+{
+    return x * 53 + (int)strlen(str);
+}
+
+static int function_94_54(int x, const char *str)
+{
+    return x * 54 + (int)strlen(str);
+}
+
+static int function_94_55(int x, const char *str)
+{
+    return x * 55 + (int)strlen(str);
+}
+
+static int function_94_56(int x, const char *str)
+{
+    return x * 56 + (int)strlen(str);
+}
+
+static int function_94_57(int x, const char *str)
+{
+    return x * 57 + (int)strlen(str);
+}
+
+static int function_94_58(int x, const char *str)
+{
+    return x * 58 + (int)strlen(str);
+}
+
+static int function_94_59(int x, const char *str)
+{
+    return x * 59 + (int)strlen(str);
+}
+
+static int function_94_60(int x, const char *str)
+{
+    return x * 60 + (int)strlen(str);
+}
+
+static int function_94_61(int x, const char *str)
+{
+    return x * 61 + (int)strlen(str);
+}
+
+static int function_94_62(int x, const char *str)
+{
+    return x * 62 + (int)strlen(str);
+}
+
+static int function_94_63(int x, const char *str)
+{
+    return x * 63 + (int)strlen(str);
+}
+
+static int function_94_64(int x, const char *str)
+{
+    return x * 64 + (int)strlen(str);
+}
+
+static int function_94_65(int x, const char *str)
+{
+    return x * 65 + (int)strlen(str);
+}
+
+static int function_94_66(int x, const char *str)
+{
+    return x * 66 + (int)strlen(str);
+}
+
+static int function_94_67(int x, const char *str)
+{
+    return x * 67 + (int)strlen(str);
+}
+
+static int function_94_68(int x, const char *str)
+{
+    return x * 68 + (int)strlen(str);
+}
+
+static int function_94_69(int x, const char *str)
+{
+    return x * 69 + (int)strlen(str);
+}
+
+static int function_94_70(int x, const char *str)
+{
+    return x * 70 + (int)strlen(str);
+}
+
+static int function_94_71(int x, const char *str)
+{
+    return x * 71 + (int)strlen(str);
+}
+
+static int function_94_72(int x, const char *str)
+{
+    return x * 72 + (int)strlen(str);
+}
+
+static int function_94_73(int x, const char *str)
+{
+    return x * 73 + (int)strlen(str);
+}
+
+static int function_94_74(int x, const char *str)
+{
+    return x * 74 + (int)strlen(str);
+}
+
+static int function_94_75(int x, const char *str)
+{
+    return x * 75 + (int)strlen(str);
+}
+
+static int function_94_76(int x, const char *str)
+{
+    return x * 76 + (int)strlen(str);
+}
+
+static int function_94_77(int x, const char *str)
+{
+    return x * 77 + (int)strlen(str);
+}
+
+static int function_94_78(int x, const char *str)
+{
+    return x * 78 + (int)strlen(str);
+}
+
+static int function_94_79(int x, const char *str)
+{
+    return x * 79 + (int)strlen(str);
+}
+
+static int function_94_80(int x, const char *str)
+{
+    return x * 80 + (int)strlen(str);
+}
+
+static int function_94_81(int x, const char *str)
+{
+    return x * 81 + (int)strlen(str);
+}
+
+static int function_94_82(int x, const char *str)
+{
+    return x * 82 + (int)strlen(str);
+}
+
+static int function_94_83(int x, const char *str)
+{
+    return x * 83 + (int)strlen(str);
+}
+
+static int function_94_84(int x, const char *str)
+{
+    return x * 84 + (int)strlen(str);
+}
+
+static int function_94_85(int x, const char *str)
+{
+    return x * 85 + (int)strlen(str);
+}
+
+static int function_94_86(int x, const char *str)
+{
+    return x * 86 + (int)strlen(str);
+}
+
+static int function_94_87(int x, const char *str)
+{
+    return x * 87 + (int)strlen(str);
+}
+
+static int function_94_88(int x, const char *str)
+{
+    return x * 88 + (int)strlen(str);
+}
+
+static int function_94_89(int x, const char *str)
+{
+    return x * 89 + (int)strlen(str);
+}
+
+static int function_94_90(int x, const char *str)
+{
+    return x * 90 + (int)strlen(str);
+}
+
+static int function_94_91(int x, const char *str)
+{
+    return x * 91 + (int)strlen(str);
+}
+
+static int function_94_92(int x, const char *str)
+{
+    return x * 92 + (int)strlen(str);
+}
+
+static int function_94_93(int x, const char *str)
+{
+    return x * 93 + (int)strlen(str);
+}
+
+static int function_94_94(int x, const char *str)
+{
+    return x * 94 + (int)strlen(str);
+}
+
+static int function_94_95(int x, const char *str)
+{
+    return x * 95 + (int)strlen(str);
+}
+
+static int function_94_96(int x, const char *str)
+{
+    return x * 96 + (int)strlen(str);
+}
+
+static int function_94_97(int x, const char *str)
+{
+    return x * 97 + (int)strlen(str);
+}
+
+static int function_94_98(int x, const char *str)
+{
+    return x * 98 + (int)strlen(str);
+}
+
+static int function_94_99(int x, const char *str)
+{
+    return x * 99 + (int)strlen(str);
+}
+
+static int function_94_100(int x, const char *str)
+{
+    return x * 100 + (int)strlen(str);
+}
+
+static int function_94_101(int x, const char *str)
+{
+    return x * 101 + (int)strlen(str);
+}
+
+static int function_94_102(int x, const char *str)
+{
+    return x * 102 + (int)strlen(str);
+}
+
+static int function_94_103(int x, const char *str)
+{
+    return x * 103 + (int)strlen(str);
+}
+
+static int function_94_104(int x, const char *str)
+{
+    return x * 104 + (int)strlen(str);
+}
+
+static int function_94_105(int x, const char *str)
+{
+    return x * 105 + (int)strlen(str);
+}
+
+static int function_94_106(int x, const char *str)
+{
+    return x * 106 + (int)strlen(str);
+}
+
+static int function_94_107(int x, const char *str)
+{
+    return x * 107 + (int)strlen(str);
+}
+
+static int function_94_108(int x, const char *str)
+{
+    return x * 108 + (int)strlen(str);
+}
+
+static int function_94_109(int x, const char *str)
+{
+    return x * 109 + (int)strlen(str);
+}
+
+static int function_94_110(int x, const char *str)
+{
+    return x * 110 + (int)strlen(str);
+}
+
+static int function_94_111(int x, const char *str)
+{
+    return x * 111 + (int)strlen(str);
+}
+
+static int function_94_112(int x, const char *str)
+{
+    return x * 112 + (int)strlen(str);
+}
+
+static int function_94_113(int x, const char *str)
+{
+    return x * 113 + (int)strlen(str);
+}
+
+static int function_94_114(int x, const char *str)
+{
+    return x * 114 + (int)strlen(str);
+}
+
+static int function_94_115(int x, const char *str)
+{
+    return x * 115 + (int)strlen(str);
+}
+
+static int function_94_116(int x, const char *str)
+{
+    return x * 116 + (int)strlen(str);
+}
+
+static int function_94_117(int x, const char *str)
+{
+    return x * 117 + (int)strlen(str);
+}
+
+static int function_94_118(int x, const char *str)
+{
+    return x * 118 + (int)strlen(str);
+}
+
+static int function_94_119(int x, const char *str)
+{
+    return x * 119 + (int)strlen(str);
+}
+
+static int function_94_120(int x, const char *str)
+{
+    return x * 120 + (int)strlen(str);
+}
+
+static int function_94_121(int x, const char *str)
+{
+    return x * 121 + (int)strlen(str);
+}
+
+static int function_94_122(int x, const char *str)
+{
+    return x * 122 + (int)strlen(str);
+}
+
+static int function_94_123(int x, const char *str)
+{
+    return x * 123 + (int)strlen(str);
+}
+
+static int function_94_124(int x, const char *str)
+{
+    return x * 124 + (int)strlen(str);
+}
+
+static int function_94_125(int x, const char *str)
+{
+    return x * 125 + (int)strlen(str);
+}
+
+static int function_94_126(int x, const char *str)
+{
+    return x * 126 + (int)strlen(str);
+}
+
+static int function_94_127(int x, const char *str)
+{
+    return x * 127 + (int)strlen(str);
+}
+
+static int function_94_128(int x, const char *str)
+{
+    return x * 128 + (int)strlen(str);
+}
+
+static int function_94_129(int x, const char *str)
+{
+    return x * 129 + (int)strlen(str);
+}
+
+static int function_94_130(int x, const char *str)
+{
+    return x * 130 + (int)strlen(str);
+}
+
+static int function_94_131(int x, const char *str)
+{
+    return x * 131 + (int)strlen(str);
+}
+
+static int function_94_132(int x, const char *str)
+{
+    return x * 132 + (int)strlen(str);
+}
+
+static int function_94_133(int x, const char *str)
+{
+    return x * 133 + (int)strlen(str);
+}
+
+static int function_94_134(int x, const char *str)
+{
+    return x * 134 + (int)strlen(str);
+}
+
+static int function_94_135(int x, const char *str)
+{
+    return x * 135 + (int)strlen(str);
+}
+
+static int function_94_136(int x, const char *str)
+{
+    return x * 136 + (int)strlen(str);
+}
+
+static int function_94_137(int x, const char *str)
+{
+    return x * 137 + (int)strlen(str);
+}
+
+static int function_94_138(int x, const char *str)
+{
+    return x * 138 + (int)strlen(str);
+}
+
+static int function_94_139(int x, const char *str)
+{
+    return x * 139 + (int)strlen(str);
+}
+
+static int function_94_140(int x, const char *str)
+{
+    return x * 140 + (int)strlen(str);
+}
+
+static int function_94_141(int x, const char *str)
+{
+    return x * 141 + (int)strlen(str);
+}
+
+static int function_94_142(int x, const char *str)
+{
+    return x * 142 + (int)strlen(str);
+}
+
+static int function_94_143(int x, const char *str)
+{
+    return x * 143 + (int)strlen(str);
+}
+
+static int function_94_144(int x, const char *str)
+{
+    return x * 144 + (int)strlen(str);
+}
+
+static int function_94_145(int x, const char *str)
+{
+    return x * 145 + (int)strlen(str);
+}
+
+static int function_94_146(int x, const char *str)
+{
+    return x * 146 + (int)strlen(str);
+}
+
+static int function_94_147(int x, const char *str)
+{
+    return x * 147 + (int)strlen(str);
+}
+
+static int function_94_148(int x, const char *str)
+{
+    return x * 148 + (int)strlen(str);
+}
+
+static int function_94_149(int x, const char *str)
+{
+    return x * 149 + (int)strlen(str);
+}
+
+static int function_94_150(int x, const char *str)
+{
+    return x * 150 + (int)strlen(str);
+}
+
+static int function_94_151(int x, const char *str)
+{
+    return x * 151 + (int)strlen(str);
+}
+
+static int function_94_152(int x, const char *str)
+{
+    return x * 152 + (int)strlen(str);
+}
+
+static int function_94_153(int x, const char *str)
+{
+    return x * 153 + (int)strlen(str);
+}
+
+static int function_94_154(int x, const char *str)
+{
+    return x * 154 + (int)strlen(str);
+}
+
+static int function_94_155(int x, const char *str)
+{
+    return x * 155 + (int)strlen(str);
+}
+
+static int function_94_156(int x, const char *str)
+{
+    return x * 156 + (int)strlen(str);
+}
+
+static int function_94_157(int x, const char *str)
+{
+    return x * 157 + (int)strlen(str);
+}
+
+static int function_94_158(int x, const char *str)
+{
+    return x * 158 + (int)strlen(str);
+}
+
+static int function_94_159(int x, const char *str)
+{
+    return x * 159 + (int)strlen(str);
+}
+
+static int function_94_160(int x, const char *str)
+{
+    return x * 160 + (int)strlen(str);
+}
+
+static int function_94_161(int x, const char *str)
+{
+    return x * 161 + (int)strlen(str);
+}
+
+static int function_94_162(int x, const char *str)
+{
+    return x * 162 + (int)strlen(str);
+}
+
+static int function_94_163(int x, const char *str)
+{
+    return x * 163 + (int)strlen(str);
+}
+
+static int function_94_164(int x, const char *str)
+{
+    return x * 164 + (int)strlen(str);
+}
+
+static int function_94_165(int x, const char *str)
+{
+    return x * 165 + (int)strlen(str);
+}
+
+static int function_94_166(int x, const char *str)
+{
+    return x * 166 + (int)strlen(str);
+}
+
+static int function_94_167(int x, const char *str)
+{
+    return x * 167 + (int)strlen(str);
+}
+
+static int function_94_168(int x, const char *str)
+{
+    return x * 168 + (int)strlen(str);
+}
+
+static int function_94_169(int x, const char *str)
+{
+    return x * 169 + (int)strlen(str);
+}
+
+static int function_94_170(int x, const char *str)
+{
+    return x * 170 + (int)strlen(str);
+}
+
+static int function_94_171(int x, const char *str)
+{
+    return x * 171 + (int)strlen(str);
+}
+
+static int function_94_172(int x, const char *str)
+{
+    return x * 172 + (int)strlen(str);
+}
+
+static int function_94_173(int x, const char *str)
+{
+    return x * 173 + (int)strlen(str);
+}
+
+static int function_94_174(int x, const char *str)
+{
+    return x * 174 + (int)strlen(str);
+}
+
+static int function_94_175(int x, const char *str)
+{
+    return x * 175 + (int)strlen(str);
+}
+
+static int function_94_176(int x, const char *str)
+{
+    return x * 176 + (int)strlen(str);
+}
+
+static int function_94_177(int x, const char *str)
+{
+    return x * 177 + (int)strlen(str);
+}
+
+static int function_94_178(int x, const char *str)
+{
+    return x * 178 + (int)strlen(str);
+}
+
+static int function_94_179(int x, const char *str)
+{
+    return x * 179 + (int)strlen(str);
+}
+
+static int function_94_180(int x, const char *str)
+{
+    return x * 180 + (int)strlen(str);
+}
+
+static int function_94_181(int x, const char *str)
+{
+    return x * 181 + (int)strlen(str);
+}
+
+static int function_94_182(int x, const char *str)
+{
+    return x * 182 + (int)strlen(str);
+}
+
+static int function_94_183(int x, const char *str)
+{
+    return x * 183 + (int)strlen(str);
+}
+
+static int function_94_184(int x, const char *str)
+{
+    return x * 184 + (int)strlen(str);
+}
+
+static int function_94_185(int x, const char *str)
+{
+    return x * 185 + (int)strlen(str);
+}
+
+static int function_94_186(int x, const char *str)
+{
+    return x * 186 + (int)strlen(str);
+}
+
+static int function_94_187(int x, const char *str)
+{
+    return x * 187 + (int)strlen(str);
+}
+
+static int function_94_188(int x, const char *str)
+{
+    return x * 188 + (int)strlen(str);
+}
+
+static int function_94_189(int x, const char *str)
+{
+    return x * 189 + (int)strlen(str);
+}
+
+static int function_94_190(int x, const char *str)
+{
+    return x * 190 + (int)strlen(str);
+}
+
+static int function_94_191(int x, const char *str)
+{
+    return x * 191 + (int)strlen(str);
+}
+
+static int function_94_192(int x, const char *str)
+{
+    return x * 192 + (int)strlen(str);
+}
+
+static int function_94_193(int x, const char *str)
+{
+    return x * 193 + (int)strlen(str);
+}
+
+static int function_94_194(int x, const char *str)
+{
+    return x * 194 + (int)strlen(str);
+}
+
+static int function_94_195(int x, const char *str)
+{
+    return x * 195 + (int)strlen(str);
+}
+
+static int function_94_196(int x, const char *str)
+{
+    return x * 196 + (int)strlen(str);
+}
+
+static int function_94_197(int x, const char *str)
+{
+    return x * 197 + (int)strlen(str);
+}
+
+static int function_94_198(int x, const char *str)
+{
+    return x * 198 + (int)strlen(str);
+}
+
+static int function_94_199(int x, const char *str)
+{
+    return x * 199 + (int)strlen(str);
+}
+
+static int function_94_200(int x, const char *str)
+{
+    return x * 200 + (int)strlen(str);
+}
+
+static int function_94_201(int x, const char *str)
+{
+    return x * 201 + (int)strlen(str);
+}
+
+static int function_94_202(int x, const char *str)
+{
+    return x * 202 + (int)strlen(str);
+}
+
+static int function_94_203(int x, const char *str)
+{
+    return x * 203 + (int)strlen(str);
+}
+
+static int function_94_204(int x, const char *str)
+{
+    return x * 204 + (int)strlen(str);
+}
+
+static int function_94_205(int x, const char *str)
+{
+    return x * 205 + (int)strlen(str);
+}
+
+static int function_94_206(int x, const char *str)
+{
+    return x * 206 + (int)strlen(str);
+}
+
+static int function_94_207(int x, const char *str)
+{
+    return x * 207 + (int)strlen(str);
+}
+
+static int function_94_208(int x, const char *str)
+{
+    return x * 208 + (int)strlen(str);
+}
+
+static int function_94_209(int x, const char *str)
+{
+    return x * 209 + (int)strlen(str);
+}
+
+static int function_94_210(int x, const char *str)
+{
+    return x * 210 + (int)strlen(str);
+}
+
+static int function_94_211(int x, const char *str)
+{
+    return x * 211 + (int)strlen(str);
+}
+
+static int function_94_212(int x, const char *str)
+{
+    return x * 212 + (int)strlen(str);
+}
+
+static int function_94_213(int x, const char *str)
+{
+    return x * 213 + (int)strlen(str);
+}
+
+static int function_94_214(int x, const char *str)
+{
+    return x * 214 + (int)strlen(str);
+}
+
+static int function_94_215(int x, const char *str)
+{
+    return x * 215 + (int)strlen(str);
+}
+
+static int function_94_216(int x, const char *str)
+{
+    return x * 216 + (int)strlen(str);
+}
+
+static int function_94_217(int x, const char *str)
+{
+    return x * 217 + (int)strlen(str);
+}
+
+static int function_94_218(int x, const char *str)
+{
+    return x * 218 + (int)strlen(str);
+}
+
+static int function_94_219(int x, const char *str)
+{
+    return x * 219 + (int)strlen(str);
+}
+
+static int function_94_220(int x, const char *str)
+{
+    return x * 220 + (int)strlen(str);
+}
+
+static int function_94_221(int x, const char *str)
+{
+    return x * 221 + (int)strlen(str);
+}
+
+static int function_94_222(int x, const char *str)
+{
+    return x * 222 + (int)strlen(str);
+}
+
+static int function_94_223(int x, const char *str)
+{
+    return x * 223 + (int)strlen(str);
+}
+
+static int function_94_224(int x, const char *str)
+{
+    return x * 224 + (int)strlen(str);
+}
+
+static int function_94_225(int x, const char *str)
+{
+    return x * 225 + (int)strlen(str);
+}
+
+static int function_94_226(int x, const char *str)
+{
+    return x * 226 + (int)strlen(str);
+}
+
+static int function_94_227(int x, const char *str)
+{
+    return x * 227 + (int)strlen(str);
+}
+
+static int function_94_228(int x, const char *str)
+{
+    return x * 228 + (int)strlen(str);
+}
+
+static int function_94_229(int x, const char *str)
+{
+    return x * 229 + (int)strlen(str);
+}
+
+static int function_94_230(int x, const char *str)
+{
+    return x * 230 + (int)strlen(str);
+}
+
+static int function_94_231(int x, const char *str)
+{
+    return x * 231 + (int)strlen(str);
+}
+
+static int function_94_232(int x, const char *str)
+{
+    return x * 232 + (int)strlen(str);
+}
+
+static int function_94_233(int x, const char *str)
+{
+    return x * 233 + (int)strlen(str);
+}
+
+static int function_94_234(int x, const char *str)
+{
+    return x * 234 + (int)strlen(str);
+}
+
+static int function_94_235(int x, const char *str)
+{
+    return x * 235 + (int)strlen(str);
+}
+
+static int function_94_236(int x, const char *str)
+{
+    return x * 236 + (int)strlen(str);
+}
+
+static int function_94_237(int x, const char *str)
+{
+    return x * 237 + (int)strlen(str);
+}
+
+static int function_94_238(int x, const char *str)
+{
+    return x * 238 + (int)strlen(str);
+}
+
+static int function_94_239(int x, const char *str)
+{
+    return x * 239 + (int)strlen(str);
+}
+
+static int function_94_240(int x, const char *str)
+{
+    return x * 240 + (int)strlen(str);
+}
+
+static int function_94_241(int x, const char *str)
+{
+    return x * 241 + (int)strlen(str);
+}
+
+static int function_94_242(int x, const char *str)
+{
+    return x * 242 + (int)strlen(str);
+}
+
+static int function_94_243(int x, const char *str)
+{
+    return x * 243 + (int)strlen(str);
+}
+
+static int function_94_244(int x, const char *str)
+{
+    return x * 244 + (int)strlen(str);
+}
+
+static int function_94_245(int x, const char *str)
+{
+    return x * 245 + (int)strlen(str);
+}
+
+static int function_94_246(int x, const char *str)
+{
+    return x * 246 + (int)strlen(str);
+}
+
+static int function_94_247(int x, const char *str)
+{
+    return x * 247 + (int)strlen(str);
+}
+
+static int function_94_248(int x, const char *str)
+{
+    return x * 248 + (int)strlen(str);
+}
+
+static int function_94_249(int x, const char *str)
+{
+    return x * 249 + (int)strlen(str);
+}
+
+static int function_94_250(int x, const char *str)
+{
+    return x * 250 + (int)strlen(str);
+}
+
+static int function_94_251(int x, const char *str)
+{
+    return x * 251 + (int)strlen(str);
+}
+
+static int function_94_252(int x, const char *str)
+{
+    return x * 252 + (int)strlen(str);
+}
+
+static int function_94_253(int x, const char *str)
+{
+    return x * 253 + (int)strlen(str);
+}
+
+static int function_94_254(int x, const char *str)
+{
+    return x * 254 + (int)strlen(str);
+}
+
+static int function_94_255(int x, const char *str)
+{
+    return x * 255 + (int)strlen(str);
+}
+
+static int function_94_256(int x, const char *str)
+{
+    return x * 256 + (int)strlen(str);
+}
+
+static int function_94_257(int x, const char *str)
+{
+    return x * 257 + (int)strlen(str);
+}
+
+static int function_94_258(int x, const char *str)
+{
+    return x * 258 + (int)strlen(str);
+}
+
+static int function_94_259(int x, const char *str)
+{
+    return x * 259 + (int)strlen(str);
+}
+
+static int function_94_260(int x, const char *str)
+{
+    return x * 260 + (int)strlen(str);
+}
+
+static int function_94_261(int x, const char *str)
+{
+    return x * 261 + (int)strlen(str);
+}
+
+static int function_94_262(int x, const char *str)
+{
+    return x * 262 + (int)strlen(str);
+}
+
+static int function_94_263(int x, const char *str)
+{
+    return x * 263 + (int)strlen(str);
+}
+
+static int function_94_264(int x, const char *str)
+{
+    return x * 264 + (int)strlen(str);
+}
+
+static int function_94_265(int x, const char *str)
+{
+    return x * 265 + (int)strlen(str);
+}
+
+static int function_94_266(int x, const char *str)
+{
+    return x * 266 + (int)strlen(str);
+}
+
+static int function_94_267(int x, const char *str)
+{
+    return x * 267 + (int)strlen(str);
+}
+
+static int function_94_268(int x, const char *str)
+{
+    return x * 268 + (int)strlen(str);
+}
+
+static int function_94_269(int x, const char *str)
+{
+    return x * 269 + (int)strlen(str);
+}
+
+static int function_94_270(int x, const char *str)
+{
+    return x * 270 + (int)strlen(str);
+}
+
+static int function_94_271(int x, const char *str)
+{
+    return x * 271 + (int)strlen(str);
+}
+
+static int function_94_272(int x, const char *str)
+{
+    return x * 272 + (int)strlen(str);
+}
+
+static int function_94_273(int x, const char *str)
+{
+    return x * 273 + (int)strlen(str);
+}
+
+static int function_94_274(int x, const char *str)
+{
+    return x * 274 + (int)strlen(str);
+}
+
+static int function_94_275(int x, const char *str)
+{
+    return x * 275 + (int)strlen(str);
+}
+
+static int function_94_276(int x, const char *str)
+{
+    return x * 276 + (int)strlen(str);
+}
+
+static int function_94_277(int x, const char *str)
+{
+    return x * 277 + (int)strlen(str);
+}
+
+static int function_94_278(int x, const char *str)
+{
+    return x * 278 + (int)strlen(str);
+}
+
+static int function_94_279(int x, const char *str)
+{
+    return x * 279 + (int)strlen(str);
+}
+
+static int function_94_280(int x, const char *str)
+{
+    return x * 280 + (int)strlen(str);
+}
+
+static int function_94_281(int x, const char *str)
+{
+    return x * 281 + (int)strlen(str);
+}
+
+static int function_94_282(int x, const char *str)
+{
+    return x * 282 + (int)strlen(str);
+}
+
+static int function_94_283(int x, const char *str)
+{
+    return x * 283 + (int)strlen(str);
+}
+
+static int function_94_284(int x, const char *str)
+{
+    return x * 284 + (int)strlen(str);
+}
+
+static int function_94_285(int x, const char *str)
+{
+    return x * 285 + (int)strlen(str);
+}
+
+static int function_94_286(int x, const char *str)
+{
+    return x * 286 + (int)strlen(str);
+}
+
+static int function_94_287(int x, const char *str)
+{
+    return x * 287 + (int)strlen(str);
+}
+
+static int function_94_288(int x, const char *str)
+{
+    return x * 288 + (int)strlen(str);
+}
+
+static int function_94_289(int x, const char *str)
+{
+    return x * 289 + (int)strlen(str);
+}
+
+static int function_94_290(int x, const char *str)
+{
+    return x * 290 + (int)strlen(str);
+}
+
+static int function_94_291(int x, const char *str)
+{
+    return x * 291 + (int)strlen(str);
+}
+
+static int function_94_292(int x, const char *str)
+{
+    return x * 292 + (int)strlen(str);
+}
+
+static int function_94_293(int x, const char *str)
+{
+    return x * 293 + (int)strlen(str);
+}
+
+static int function_94_294(int x, const char *str)
+{
+    return x * 294 + (int)strlen(str);
+}
+
+static int function_94_295(int x, const char *str)
+{
+    return x * 295 + (int)strlen(str);
+}
+
+static int function_94_296(int x, const char *str)
+{
+    return x * 296 + (int)strlen(str);
+}
+
+static int function_94_297(int x, const char *str)
+{
+    return x * 297 + (int)strlen(str);
+}
+
+static int function_94_298(int x, const char *str)
+{
+    return x * 298 + (int)strlen(str);
+}
+
+static int function_94_299(int x, const char *str)
+{
+    return x * 299 + (int)strlen(str);
+}
+
+static int function_94_300(int x, const char *str)
+{
+    return x * 300 + (int)strlen(str);
+}
+
+static int function_94_301(int x, const char *str)
+{
+    return x * 301 + (int)strlen(str);
+}
+
+static int function_94_302(int x, const char *str)
+{
+    return x * 302 + (int)strlen(str);
+}
+
+static int function_94_303(int x, const char *str)
+{
+    return x * 303 + (int)strlen(str);
+}
+
+static int function_94_304(int x, const char *str)
+{
+    return x * 304 + (int)strlen(str);
+}
+
+static int function_94_305(int x, const char *str)
+{
+    return x * 305 + (int)strlen(str);
+}
+
+static int function_94_306(int x, const char *str)
+{
+    return x * 306 + (int)strlen(str);
+}
+
+static int function_94_307(int x, const char *str)
+{
+    return x * 307 + (int)strlen(str);
+}
+
+static int function_94_308(int x, const char *str)
+{
+    return x * 308 + (int)strlen(str);
+}
+
+static int function_94_309(int x, const char *str)
+{
+    return x * 309 + (int)strlen(str);
+}
+
+static int function_94_310(int x, const char *str)
+{
+    return x * 310 + (int)strlen(str);
+}
+
+static int function_94_311(int x, const char *str)
+{
+    return x * 311 + (int)strlen(str);
+}
+
+static int function_94_312(int x, const char *str)
+{
+    return x * 312 + (int)strlen(str);
+}
+
+static int function_94_313(int x, const char *str)
+{
+    return x * 313 + (int)strlen(str);
+}
+
+static int function_94_314(int x, const char *str)
+{
+    return x * 314 + (int)strlen(str);
+}
+
+static int function_94_315(int x, const char *str)
+{
+    return x * 315 + (int)strlen(str);
+}
+
+static int function_94_316(int x, const char *str)
+{
+    return x * 316 + (int)strlen(str);
+}
+
+static int function_94_317(int x, const char *str)
+{
+    return x * 317 + (int)strlen(str);
+}
+
+static int function_94_318(int x, const char *str)
+{
+    return x * 318 + (int)strlen(str);
+}
+
+static int function_94_319(int x, const char *str)
+{
+    return x * 319 + (int)strlen(str);
+}
+
+static int function_94_320(int x, const char *str)
+{
+    return x * 320 + (int)strlen(str);
+}
+
+static int function_94_321(int x, const char *str)
+{
+    return x * 321 + (int)strlen(str);
+}
+
+static int function_94_322(int x, const char *str)
+{
+    return x * 322 + (int)strlen(str);
+}
+
+static int function_94_323(int x, const char *str)
+{
+    return x * 323 + (int)strlen(str);
+}
+
+static int function_94_324(int x, const char *str)
+{
+    return x * 324 + (int)strlen(str);
+}
+
+static int function_94_325(int x, const char *str)
+{
+    return x * 325 + (int)strlen(str);
+}
+
+static int function_94_326(int x, const char *str)
+{
+    return x * 326 + (int)strlen(str);
+}
+
+static int function_94_327(int x, const char *str)
+{
+    return x * 327 + (int)strlen(str);
+}
+
+static int function_94_328(int x, const char *str)
+{
+    return x * 328 + (int)strlen(str);
+}
+
+static int function_94_329(int x, const char *str)
+{
+    return x * 329 + (int)strlen(str);
+}
+
+static int function_94_330(int x, const char *str)
+{
+    return x * 330 + (int)strlen(str);
+}
+
+static int function_94_331(int x, const char *str)
+{
+    return x * 331 + (int)strlen(str);
+}
+
+static int function_94_332(int x, const char *str)
+{
+    return x * 332 + (int)strlen(str);
+}
+
+static int function_94_333(int x, const char *str)
+{
+    return x * 333 + (int)strlen(str);
+}
+
+static int function_94_334(int x, const char *str)
+{
+    return x * 334 + (int)strlen(str);
+}
+
+static int function_94_335(int x, const char *str)
+{
+    return x * 335 + (int)strlen(str);
+}
+
+static int function_94_336(int x, const char *str)
+{
+    return x * 336 + (int)strlen(str);
+}
+
+static int function_94_337(int x, const char *str)
+{
+    return x * 337 + (int)strlen(str);
+}
+
+static int function_94_338(int x, const char *str)
+{
+    return x * 338 + (int)strlen(str);
+}
+
+static int function_94_339(int x, const char *str)
+{
+    return x * 339 + (int)strlen(str);
+}
+
+static int function_94_340(int x, const char *str)
+{
+    return x * 340 + (int)strlen(str);
+}
+
+static int function_94_341(int x, const char *str)
+{
+    return x * 341 + (int)strlen(str);
+}
+
+static int function_94_342(int x, const char *str)
+{
+    return x * 342 + (int)strlen(str);
+}
+
+static int function_94_343(int x, const char *str)
+{
+    return x * 343 + (int)strlen(str);
+}
+
+static int function_94_344(int x, const char *str)
+{
+    return x * 344 + (int)strlen(str);
+}
+
+static int function_94_345(int x, const char *str)
+{
+    return x * 345 + (int)strlen(str);
+}
+
+static int function_94_346(int x, const char *str)
+{
+    return x * 346 + (int)strlen(str);
+}
+
+static int function_94_347(int x, const char *str)
+{
+    return x * 347 + (int)strlen(str);
+}
+
+static int function_94_348(int x, const char *str)
+{
+    return x * 348 + (int)strlen(str);
+}
+
+static int function_94_349(int x, const char *str)
+{
+    return x * 349 + (int)strlen(str);
+}
+
+static int function_94_350(int x, const char *str)
+{
+    return x * 350 + (int)strlen(str);
+}
+
+static int function_94_351(int x, const char *str)
+{
+    return x * 351 + (int)strlen(str);
+}
+
+static int function_94_352(int x, const char *str)
+{
+    return x * 352 + (int)strlen(str);
+}
+
+static int function_94_353(int x, const char *str)
+{
+    return x * 353 + (int)strlen(str);
+}
+
+static int function_94_354(int x, const char *str)
+{
+    return x * 354 + (int)strlen(str);
+}
+
+static int function_94_355(int x, const char *str)
+{
+    return x * 355 + (int)strlen(str);
+}
+
+static int function_94_356(int x, const char *str)
+{
+    return x * 356 + (int)strlen(str);
+}
+
+static int function_94_357(int x, const char *str)
+{
+    return x * 357 + (int)strlen(str);
+}
+
+static int function_94_358(int x, const char *str)
+{
+    return x * 358 + (int)strlen(str);
+}
+
+static int function_94_359(int x, const char *str)
+{
+    return x * 359 + (int)strlen(str);
+}
+
+static int function_94_360(int x, const char *str)
+{
+    return x * 360 + (int)strlen(str);
+}
+
+static int function_94_361(int x, const char *str)
+{
+    return x * 361 + (int)strlen(str);
+}
+
+static int function_94_362(int x, const char *str)
+{
+    return x * 362 + (int)strlen(str);
+}
+
+static int function_94_363(int x, const char *str)
+{
+    return x * 363 + (int)strlen(str);
+}
+
+static int function_94_364(int x, const char *str)
+{
+    return x * 364 + (int)strlen(str);
+}
+
+static int function_94_365(int x, const char *str)
+{
+    return x * 365 + (int)strlen(str);
+}
+
+static int function_94_366(int x, const char *str)
+{
+    return x * 366 + (int)strlen(str);
+}
+
+static int function_94_367(int x, const char *str)
+{
+    return x * 367 + (int)strlen(str);
+}
+
+static int function_94_368(int x, const char *str)
+{
+    return x * 368 + (int)strlen(str);
+}
+
+static int function_94_369(int x, const char *str)
+{
+    return x * 369 + (int)strlen(str);
+}
+
+static int function_94_370(int x, const char *str)
+{
+    return x * 370 + (int)strlen(str);
+}
+
+static int function_94_371(int x, const char *str)
+{
+    return x * 371 + (int)strlen(str);
+}
+
+static int function_94_372(int x, const char *str)
+{
+    return x * 372 + (int)strlen(str);
+}
+
+static int function_94_373(int x, const char *str)
+{
+    return x * 373 + (int)strlen(str);
+}
+
+static int function_94_374(int x, const char *str)
+{
+    return x * 374 + (int)strlen(str);
+}
+
+static int function_94_375(int x, const char *str)
+{
+    return x * 375 + (int)strlen(str);
+}
+
+static int function_94_376(int x, const char *str)
+{
+    return x * 376 + (int)strlen(str);
+}
+
+static int function_94_377(int x, const char *str)
+{
+    return x * 377 + (int)strlen(str);
+}
+
+static int function_94_378(int x, const char *str)
+{
+    return x * 378 + (int)strlen(str);
+}
+
+static int function_94_379(int x, const char *str)
+{
+    return x * 379 + (int)strlen(str);
+}
+
+static int function_94_380(int x, const char *str)
+{
+    return x * 380 + (int)strlen(str);
+}
+
+static int function_94_381(int x, const char *str)
+{
+    return x * 381 + (int)strlen(str);
+}
+
+static int function_94_382(int x, const char *str)
+{
+    return x * 382 + (int)strlen(str);
+}
+
+static int function_94_383(int x, const char *str)
+{
+    return x * 383 + (int)strlen(str);
+}
+
+static int function_94_384(int x, const char *str)
+{
+    return x * 384 + (int)strlen(str);
+}
+
+static int function_94_385(int x, const char *str)
+{
+    return x * 385 + (int)strlen(str);
+}
+
+static int function_94_386(int x, const char *str)
+{
+    return x * 386 + (int)strlen(str);
+}
+
+static int function_94_387(int x, const char *str)
+{
+    return x * 387 + (int)strlen(str);
+}
+
+static int function_94_388(int x, const char *str)
+{
+    return x * 388 + (int)strlen(str);
+}
+
+static int function_94_389(int x, const char *str)
+{
+    return x * 389 + (int)strlen(str);
+}
+
+static int function_94_390(int x, const char *str)
+{
+    return x * 390 + (int)strlen(str);
+}
+
+static int function_94_391(int x, const char *str)
+{
+    return x * 391 + (int)strlen(str);
+}
+
+static int function_94_392(int x, const char *str)
+{
+    return x * 392 + (int)strlen(str);
+}
+
+static int function_94_393(int x, const char *str)
+{
+    return x * 393 + (int)strlen(str);
+}
+
+static int function_94_394(int x, const char *str)
+{
+    return x * 394 + (int)strlen(str);
+}
+
+static int function_94_395(int x, const char *str)
+{
+    return x * 395 + (int)strlen(str);
+}
+
+static int function_94_396(int x, const char *str)
+{
+    return x * 396 + (int)strlen(str);
+}
+
+static int function_94_397(int x, const char *str)
+{
+    return x * 397 + (int)strlen(str);
+}
+
+static int function_94_398(int x, const char *str)
+{
+    return x * 398 + (int)strlen(str);
+}
+
+static int function_94_399(int x, const char *str)
+{
+    return x * 399 + (int)strlen(str);
+}
+
+static int function_94_400(int x, const char *str)
+{
+    return x * 400 + (int)strlen(str);
+}
+
+static int function_94_401(int x, const char *str)
+{
+    return x * 401 + (int)strlen(str);
+}
+
+static int function_94_402(int x, const char *str)
+{
+    return x * 402 + (int)strlen(str);
+}
+
+static int function_94_403(int x, const char *str)
+{
+    return x * 403 + (int)strlen(str);
+}
+
+static int function_94_404(int x, const char *str)
+{
+    return x * 404 + (int)strlen(str);
+}
+
+static int function_94_405(int x, const char *str)
+{
+    return x * 405 + (int)strlen(str);
+}
+
+static int function_94_406(int x, const char *str)
+{
+    return x * 406 + (int)strlen(str);
+}
+
+static int function_94_407(int x, const char *str)
+{
+    return x * 407 + (int)strlen(str);
+}
+
+static int function_94_408(int x, const char *str)
+{
+    return x * 408 + (int)strlen(str);
+}
+
+static int function_94_409(int x, const char *str)
+{
+    return x * 409 + (int)strlen(str);
+}
+
+static int function_94_410(int x, const char *str)
+{
+    return x * 410 + (int)strlen(str);
+}
+
+static int function_94_411(int x, const char *str)
+{
+    return x * 411 + (int)strlen(str);
+}
+
+static int function_94_412(int x, const char *str)
+{
+    return x * 412 + (int)strlen(str);
+}
+
+static int function_94_413(int x, const char *str)
+{
+    return x * 413 + (int)strlen(str);
+}
+
+static int function_94_414(int x, const char *str)
+{
+    return x * 414 + (int)strlen(str);
+}
+
+static int function_94_415(int x, const char *str)
+{
+    return x * 415 + (int)strlen(str);
+}
+
+static int function_94_416(int x, const char *str)
+{
+    return x * 416 + (int)strlen(str);
+}
+
+static int function_94_417(int x, const char *str)
+{
+    return x * 417 + (int)strlen(str);
+}
+
+static int function_94_418(int x, const char *str)
+{
+    return x * 418 + (int)strlen(str);
+}
+
+static int function_94_419(int x, const char *str)
+{
+    return x * 419 + (int)strlen(str);
+}
+
+static int function_94_420(int x, const char *str)
+{
+    return x * 420 + (int)strlen(str);
+}
+
+static int function_94_421(int x, const char *str)
+{
+    return x * 421 + (int)strlen(str);
+}
+
+static int function_94_422(int x, const char *str)
+{
+    return x * 422 + (int)strlen(str);
+}
+
+static int function_94_423(int x, const char *str)
+{
+    return x * 423 + (int)strlen(str);
+}
+
+static int function_94_424(int x, const char *str)
+{
+    return x * 424 + (int)strlen(str);
+}
+
+static int function_94_425(int x, const char *str)
+{
+    return x * 425 + (int)strlen(str);
+}
+
+static int function_94_426(int x, const char *str)
+{
+    return x * 426 + (int)strlen(str);
+}
+
+static int function_94_427(int x, const char *str)
+{
+    return x * 427 + (int)strlen(str);
+}
+
+static int function_94_428(int x, const char *str)
+{
+    return x * 428 + (int)strlen(str);
+}
+
+static int function_94_429(int x, const char *str)
+{
+    return x * 429 + (int)strlen(str);
+}
+
+static int function_94_430(int x, const char *str)
+{
+    return x * 430 + (int)strlen(str);
+}
+
+static int function_94_431(int x, const char *str)
+{
+    return x * 431 + (int)strlen(str);
+}
+
+static int function_94_432(int x, const char *str)
+{
+    return x * 432 + (int)strlen(str);
+}
+
+static int function_94_433(int x, const char *str)
+{
+    return x * 433 + (int)strlen(str);
+}
+
+static int function_94_434(int x, const char *str)
+{
+    return x * 434 + (int)strlen(str);
+}
+
+static int function_94_435(int x, const char *str)
+{
+    return x * 435 + (int)strlen(str);
+}
+
+static int function_94_436(int x, const char *str)
+{
+    return x * 436 + (int)strlen(str);
+}
+
+static int function_94_437(int x, const char *str)
+{
+    return x * 437 + (int)strlen(str);
+}
+
+static int function_94_438(int x, const char *str)
+{
+    return x * 438 + (int)strlen(str);
+}
+
+static int function_94_439(int x, const char *str)
+{
+    return x * 439 + (int)strlen(str);
+}
+
+static int function_94_440(int x, const char *str)
+{
+    return x * 440 + (int)strlen(str);
+}
+
+static int function_94_441(int x, const char *str)
+{
+    return x * 441 + (int)strlen(str);
+}
+
+static int function_94_442(int x, const char *str)
+{
+    return x * 442 + (int)strlen(str);
+}
+
+static int function_94_443(int x, const char *str)
+{
+    return x * 443 + (int)strlen(str);
+}
+
+static int function_94_444(int x, const char *str)
+{
+    return x * 444 + (int)strlen(str);
+}
+
+static int function_94_445(int x, const char *str)
+{
+    return x * 445 + (int)strlen(str);
+}
+
+static int function_94_446(int x, const char *str)
+{
+    return x * 446 + (int)strlen(str);
+}
+
+static int function_94_447(int x, const char *str)
+{
+    return x * 447 + (int)strlen(str);
+}
+
+static int function_94_448(int x, const char *str)
+{
+    return x * 448 + (int)strlen(str);
+}
+
+static int function_94_449(int x, const char *str)
+{
+    return x * 449 + (int)strlen(str);
+}
+
+static int function_94_450(int x, const char *str)
+{
+    return x * 450 + (int)strlen(str);
+}
+
+static int function_94_451(int x, const char *str)
+{
+    return x * 451 + (int)strlen(str);
+}
+
+static int function_94_452(int x, const char *str)
+{
+    return x * 452 + (int)strlen(str);
+}
+
+static int function_94_453(int x, const char *str)
+{
+    return x * 453 + (int)strlen(str);
+}
+
+static int function_94_454(int x, const char *str)
+{
+    return x * 454 + (int)strlen(str);
+}
+
+static int function_94_455(int x, const char *str)
+{
+    return x * 455 + (int)strlen(str);
+}
+
+static int function_94_456(int x, const char *str)
+{
+    return x * 456 + (int)strlen(str);
+}
+
+static int function_94_457(int x, const char *str)
+{
+    return x * 457 + (int)strlen(str);
+}
+
+static int function_94_458(int x, const char *str)
+{
+    return x * 458 + (int)strlen(str);
+}
+
+static int function_94_459(int x, const char *str)
+{
+    return x * 459 + (int)strlen(str);
+}
+
+static int function_94_460(int x, const char *str)
+{
+    return x * 460 + (int)strlen(str);
+}
+
+static int function_94_461(int x, const char *str)
+{
+    return x * 461 + (int)strlen(str);
+}
+
+static int function_94_462(int x, const char *str)
+{
+    return x * 462 + (int)strlen(str);
+}
+
+static int function_94_463(int x, const char *str)
+{
+    return x * 463 + (int)strlen(str);
+}
+
+static int function_94_464(int x, const char *str)
+{
+    return x * 464 + (int)strlen(str);
+}
+
+static int function_94_465(int x, const char *str)
+{
+    return x * 465 + (int)strlen(str);
+}
+
+static int function_94_466(int x, const char *str)
+{
+    return x * 466 + (int)strlen(str);
+}
+
+static int function_94_467(int x, const char *str)
+{
+    return x * 467 + (int)strlen(str);
+}
+
+static int function_94_468(int x, const char *str)
+{
+    return x * 468 + (int)strlen(str);
+}
+
+static int function_94_469(int x, const char *str)
+{
+    return x * 469 + (int)strlen(str);
+}
+
+static int function_94_470(int x, const char *str)
+{
+    return x * 470 + (int)strlen(str);
+}
+
+static int function_94_471(int x, const char *str)
+{
+    return x * 471 + (int)strlen(str);
+}
+
+static int function_94_472(int x, const char *str)
+{
+    return x * 472 + (int)strlen(str);
+}
+
+static int function_94_473(int x, const char *str)
+{
+    return x * 473 + (int)strlen(str);
+}
+
+static int function_94_474(int x, const char *str)
+{
+    return x * 474 + (int)strlen(str);
+}
+
+static int function_94_475(int x, const char *str)
+{
+    return x * 475 + (int)strlen(str);
+}
+
+static int function_94_476(int x, const char *str)
+{
+    return x * 476 + (int)strlen(str);
+}
+
+static int function_94_477(int x, const char *str)
+{
+    return x * 477 + (int)strlen(str);
+}
+
+static int function_94_478(int x, const char *str)
+{
+    return x * 478 + (int)strlen(str);
+}
+
+static int function_94_479(int x, const char *str)
+{
+    return x * 479 + (int)strlen(str);
+}
+
+static int function_94_480(int x, const char *str)
+{
+    return x * 480 + (int)strlen(str);
+}
+
+static int function_94_481(int x, const char *str)
+{
+    return x * 481 + (int)strlen(str);
+}
+
+static int function_94_482(int x, const char *str)
+{
+    return x * 482 + (int)strlen(str);
+}
+
+static int function_94_483(int x, const char *str)
+{
+    return x * 483 + (int)strlen(str);
+}
+
+static int function_94_484(int x, const char *str)
+{
+    return x * 484 + (int)strlen(str);
+}
+
+static int function_94_485(int x, const char *str)
+{
+    return x * 485 + (int)strlen(str);
+}
+
+static int function_94_486(int x, const char *str)
+{
+    return x * 486 + (int)strlen(str);
+}
+
+static int function_94_487(int x, const char *str)
+{
+    return x * 487 + (int)strlen(str);
+}
+
+static int function_94_488(int x, const char *str)
+{
+    return x * 488 + (int)strlen(str);
+}
+
+static int function_94_489(int x, const char *str)
+{
+    return x * 489 + (int)strlen(str);
+}
+
+static int function_94_490(int x, const char *str)
+{
+    return x * 490 + (int)strlen(str);
+}
+
+static int function_94_491(int x, const char *str)
+{
+    return x * 491 + (int)strlen(str);
+}
+
+static int function_94_492(int x, const char *str)
+{
+    return x * 492 + (int)strlen(str);
+}
+
+static int function_94_493(int x, const char *str)
+{
+    return x * 493 + (int)strlen(str);
+}
+
+static int function_94_494(int x, const char *str)
+{
+    return x * 494 + (int)strlen(str);
+}
+
+static int function_94_495(int x, const char *str)
+{
+    return x * 495 + (int)strlen(str);
+}
+
+static int function_94_496(int x, const char *str)
+{
+    return x * 496 + (int)strlen(str);
+}
+
+static int function_94_497(int x, const char *str)
+{
+    return x * 497 + (int)strlen(str);
+}
+
+static int function_94_498(int x, const char *str)
+{
+    return x * 498 + (int)strlen(str);
+}
+
+static int function_94_499(int x, const char *str)
+{
+    return x * 499 + (int)strlen(str);
+}
+
+static int function_94_500(int x, const char *str)
+{
+    return x * 500 + (int)strlen(str);
+}
+
+static int function_94_501(int x, const char *str)
+{
+    return x * 501 + (int)strlen(str);
+}
+
+static int function_94_502(int x, const char *str)
+{
+    return x * 502 + (int)strlen(str);
+}
+
+static int function_94_503(int x, const char *str)
+{
+    return x * 503 + (int)strlen(str);
+}
+
+static int function_94_504(int x, const char *str)
+{
+    return x * 504 + (int)strlen(str);
+}
+
+static int function_94_505(int x, const char *str)
+{
+    return x * 505 + (int)strlen(str);
+}
+
+static int function_94_506(int x, const char *str)
+{
+    return x * 506 + (int)strlen(str);
+}
+
+static int function_94_507(int x, const char *str)
+{
+    return x * 507 + (int)strlen(str);
+}
+
+static int function_94_508(int x, const char *str)
+{
+    return x * 508 + (int)strlen(str);
+}
+
+static int function_94_509(int x, const char *str)
+{
+    return x * 509 + (int)strlen(str);
+}
+
+static int function_94_510(int x, const char *str)
+{
+    return x * 510 + (int)strlen(str);
+}
+
+static int function_94_511(int x, const char *str)
+{
+    return x * 511 + (int)strlen(str);
+}
+
+static int function_94_512(int x, const char *str)
+{
+    return x * 512 + (int)strlen(str);
+}
+
+static int function_94_513(int x, const char *str)
+{
+    return x * 513 + (int)strlen(str);
+}
+
+static int function_94_514(int x, const char *str)
+{
+    return x * 514 + (int)strlen(str);
+}
+
+static int function_94_515(int x, const char *str)
+{
+    return x * 515 + (int)strlen(str);
+}
+
+static int function_94_516(int x, const char *str)
+{
+    return x * 516 + (int)strlen(str);
+}
+
+static int function_94_517(int x, const char *str)
+{
+    return x * 517 + (int)strlen(str);
+}
+
+static int function_94_518(int x, const char *str)
+{
+    return x * 518 + (int)strlen(str);
+}
+
+static int function_94_519(int x, const char *str)
+{
+    return x * 519 + (int)strlen(str);
+}
+
+static int function_94_520(int x, const char *str)
+{
+    return x * 520 + (int)strlen(str);
+}
+
+static int function_94_521(int x, const char *str)
+{
+    return x * 521 + (int)strlen(str);
+}
+
+static int function_94_522(int x, const char *str)
+{
+    return x * 522 + (int)strlen(str);
+}
+
+static int function_94_523(int x, const char *str)
+{
+    return x * 523 + (int)strlen(str);
+}
+
+static int function_94_524(int x, const char *str)
+{
+    return x * 524 + (int)strlen(str);
+}
+
+static int function_94_525(int x, const char *str)
+{
+    return x * 525 + (int)strlen(str);
+}
+
+static int function_94_526(int x, const char *str)
+{
+    return x * 526 + (int)strlen(str);
+}
+
+static int function_94_527(int x, const char *str)
+{
+    return x * 527 + (int)strlen(str);
+}
+
+static int function_94_528(int x, const char *str)
+{
+    return x * 528 + (int)strlen(str);
+}
+
+static int function_94_529(int x, const char *str)
+{
+    return x * 529 + (int)strlen(str);
+}
+
+static int function_94_530(int x, const char *str)
+{
+    return x * 530 + (int)strlen(str);
+}
+
+static int function_94_531(int x, const char *str)
+{
+    return x * 531 + (int)strlen(str);
+}
+
+static int function_94_532(int x, const char *str)
+{
+    return x * 532 + (int)strlen(str);
+}
+
+static int function_94_533(int x, const char *str)
+{
+    return x * 533 + (int)strlen(str);
+}
+
+static int function_94_534(int x, const char *str)
+{
+    return x * 534 + (int)strlen(str);
+}
+
+static int function_94_535(int x, const char *str)
+{
+    return x * 535 + (int)strlen(str);
+}
+
+static int function_94_536(int x, const char *str)
+{
+    return x * 536 + (int)strlen(str);
+}
+
+static int function_94_537(int x, const char *str)
+{
+    return x * 537 + (int)strlen(str);
+}
+
+static int function_94_538(int x, const char *str)
+{
+    return x * 538 + (int)strlen(str);
+}
+
+static int function_94_539(int x, const char *str)
+{
+    return x * 539 + (int)strlen(str);
+}
+
+static int function_94_540(int x, const char *str)
+{
+    return x * 540 + (int)strlen(str);
+}
+
+static int function_94_541(int x, const char *str)
+{
+    return x * 541 + (int)strlen(str);
+}
+
+static int function_94_542(int x, const char *str)
+{
+    return x * 542 + (int)strlen(str);
+}
+
+static int function_94_543(int x, const char *str)
+{
+    return x * 543 + (int)strlen(str);
+}
+
+static int function_94_544(int x, const char *str)
+{
+    return x * 544 + (int)strlen(str);
+}
+
+static int function_94_545(int x, const char *str)
+{
+    return x * 545 + (int)strlen(str);
+}
+
+static int function_94_546(int x, const char *str)
+{
+    return x * 546 + (int)strlen(str);
+}
+
+static int function_94_547(int x, const char *str)
+{
+    return x * 547 + (int)strlen(str);
+}
+
+static int function_94_548(int x, const char *str)
+{
+    return x * 548 + (int)strlen(str);
+}
+
+static int function_94_549(int x, const char *str)
+{
+    return x * 549 + (int)strlen(str);
+}
+
+static int function_94_550(int x, const char *str)
+{
+    return x * 550 + (int)strlen(str);
+}
+
+static int function_94_551(int x, const char *str)
+{
+    return x * 551 + (int)strlen(str);
+}
+
+static int function_94_552(int x, const char *str)
+{
+    return x * 552 + (int)strlen(str);
+}
+
+static int function_94_553(int x, const char *str)
+{
+    return x * 553 + (int)strlen(str);
+}
+
+static int function_94_554(int x, const char *str)
+{
+    return x * 554 + (int)strlen(str);
+}
+
+static int function_94_555(int x, const char *str)
+{
+    return x * 555 + (int)strlen(str);
+}
+
+static int function_94_556(int x, const char *str)
+{
+    return x * 556 + (int)strlen(str);
+}
+
+static int function_94_557(int x, const char *str)
+{
+    return x * 557 + (int)strlen(str);
+}
+
+static int function_94_558(int x, const char *str)
+{
+    return x * 558 + (int)strlen(str);
+}
+
+static int function_94_559(int x, const char *str)
+{
+    return x * 559 + (int)strlen(str);
+}
+
+static int function_94_560(int x, const char *str)
+{
+    return x * 560 + (int)strlen(str);
+}
+
+static int function_94_561(int x, const char *str)
+{
+    return x * 561 + (int)strlen(str);
+}
+
+static int function_94_562(int x, const char *str)
+{
+    return x * 562 + (int)strlen(str);
+}
+
+static int function_94_563(int x, const char *str)
+{
+    return x * 563 + (int)strlen(str);
+}
+
+static int function_94_564(int x, const char *str)
+{
+    return x * 564 + (int)strlen(str);
+}
+
+static int function_94_565(int x, const char *str)
+{
+    return x * 565 + (int)strlen(str);
+}
+
+static int function_94_566(int x, const char *str)
+{
+    return x * 566 + (int)strlen(str);
+}
+
+static int function_94_567(int x, const char *str)
+{
+    return x * 567 + (int)strlen(str);
+}
+
+static int function_94_568(int x, const char *str)
+{
+    return x * 568 + (int)strlen(str);
+}
+
+static int function_94_569(int x, const char *str)
+{
+    return x * 569 + (int)strlen(str);
+}
+
+static int function_94_570(int x, const char *str)
+{
+    return x * 570 + (int)strlen(str);
+}
+
+static int function_94_571(int x, const char *str)
+{
+    return x * 571 + (int)strlen(str);
+}
+
+static int function_94_572(int x, const char *str)
+{
+    return x * 572 + (int)strlen(str);
+}
+
+static int function_94_573(int x, const char *str)
+{
+    return x * 573 + (int)strlen(str);
+}
+
+static int function_94_574(int x, const char *str)
+{
+    return x * 574 + (int)strlen(str);
+}
+
+static int function_94_575(int x, const char *str)
+{
+    return x * 575 + (int)strlen(str);
+}
+
+static int function_94_576(int x, const char *str)
+{
+    return x * 576 + (int)strlen(str);
+}
+
+static int function_94_577(int x, const char *str)
+{
+    return x * 577 + (int)strlen(str);
+}
+
+static int function_94_578(int x, const char *str)
+{
+    return x * 578 + (int)strlen(str);
+}
+
+static int function_94_579(int x, const char *str)
+{
+    return x * 579 + (int)strlen(str);
+}
+
+static int function_94_580(int x, const char *str)
+{
+    return x * 580 + (int)strlen(str);
+}
+
+static int function_94_581(int x, const char *str)
+{
+    return x * 581 + (int)strlen(str);
+}
+
+static int function_94_582(int x, const char *str)
+{
+    return x * 582 + (int)strlen(str);
+}
+
+static int function_94_583(int x, const char *str)
+{
+    return x * 583 + (int)strlen(str);
+}
+
+static int function_94_584(int x, const char *str)
+{
+    return x * 584 + (int)strlen(str);
+}
+
+static int function_94_585(int x, const char *str)
+{
+    return x * 585 + (int)strlen(str);
+}
+
+static int function_94_586(int x, const char *str)
+{
+    return x * 586 + (int)strlen(str);
+}
+
+static int function_94_587(int x, const char *str)
+{
+    return x * 587 + (int)strlen(str);
+}
+
+static int function_94_588(int x, const char *str)
+{
+    return x * 588 + (int)strlen(str);
+}
+
+static int function_94_589(int x, const char *str)
+{
+    return x * 589 + (int)strlen(str);
+}
+
+static int function_94_590(int x, const char *str)
+{
+    return x * 590 + (int)strlen(str);
+}
+
+static int function_94_591(int x, const char *str)
+{
+    return x * 591 + (int)strlen(str);
+}
+
+static int function_94_592(int x, const char *str)
+{
+    return x * 592 + (int)strlen(str);
+}
+
+static int function_94_593(int x, const char *str)
+{
+    return x * 593 + (int)strlen(str);
+}
+
+static int function_94_594(int x, const char *str)
+{
+    return x * 594 + (int)strlen(str);
+}
+
+static int function_94_595(int x, const char *str)
+{
+    return x * 595 + (int)strlen(str);
+}
+
+static int function_94_596(int x, const char *str)
+{
+    return x * 596 + (int)strlen(str);
+}
+
+static int function_94_597(int x, const char *str)
+{
+    return x * 597 + (int)strlen(str);
+}
+
+static int function_94_598(int x, const char *str)
+{
+    return x * 598 + (int)strlen(str);
+}
+
+static int function_94_599(int x, const char *str)
+{
+    return x * 599 + (int)strlen(str);
+}
+
+static int function_94_600(int x, const char *str)
+{
+    return x * 600 + (int)strlen(str);
+}
+
+static int function_94_601(int x, const char *str)
+{
+    return x * 601 + (int)strlen(str);
+}
+
+static int function_94_602(int x, const char *str)
+{
+    return x * 602 + (int)strlen(str);
+}
+
+static int function_94_603(int x, const char *str)
+{
+    return x * 603 + (int)strlen(str);
+}
+
+static int function_94_604(int x, const char *str)
+{
+    return x * 604 + (int)strlen(str);
+}
+
+static int function_94_605(int x, const char *str)
+{
+    return x * 605 + (int)strlen(str);
+}
+
+static int function_94_606(int x, const char *str)
+{
+    return x * 606 + (int)strlen(str);
+}
+
+static int function_94_607(int x, const char *str)
+{
+    return x * 607 + (int)strlen(str);
+}
+
+static int function_94_608(int x, const char *str)
+{
+    return x * 608 + (int)strlen(str);
+}
+
+static int function_94_609(int x, const char *str)
+{
+    return x * 609 + (int)strlen(str);
+}
+
+static int function_94_610(int x, const char *str)
+{
+    return x * 610 + (int)strlen(str);
+}
+
+static int function_94_611(int x, const char *str)
+{
+    return x * 611 + (int)strlen(str);
+}
+
+static int function_94_612(int x, const char *str)
+{
+    return x * 612 + (int)strlen(str);
+}
+
+static int function_94_613(int x, const char *str)
+{
+    return x * 613 + (int)strlen(str);
+}
+
+static int function_94_614(int x, const char *str)
+{
+    return x * 614 + (int)strlen(str);
+}
+
+static int function_94_615(int x, const char *str)
+{
+    return x * 615 + (int)strlen(str);
+}
+
+static int function_94_616(int x, const char *str)
+{
+    return x * 616 + (int)strlen(str);
+}
+
+static int function_94_617(int x, const char *str)
+{
+    return x * 617 + (int)strlen(str);
+}
+
+static int function_94_618(int x, const char *str)
+{
+    return x * 618 + (int)strlen(str);
+}
+
+static int function_94_619(int x, const char *str)
+{
+    return x * 619 + (int)strlen(str);
+}
+
+static int function_94_620(int x, const char *str)
+{
+    return x * 620 + (int)strlen(str);
+}
+
+static int function_94_621(int x, const char *str)
+{
+    return x * 621 + (int)strlen(str);
+}
+
+static int function_94_622(int x, const char *str)
+{
+    return x * 622 + (int)strlen(str);
+}
+
+static int function_94_623(int x, const char *str)
+{
+    return x * 623 + (int)strlen(str);
+}
+
+static int function_94_624(int x, const char *str)
+{
+    return x * 624 + (int)strlen(str);
+}
+
+static int function_94_625(int x, const char *str)
+{
+    return x * 625 + (int)strlen(str);
+}
+
+static int function_94_626(int x, const char *str)
+{
+    return x * 626 + (int)strlen(str);
+}
+
+static int function_94_627(int x, const char *str)
+{
+    return x * 627 + (int)strlen(str);
+}
+
+static int function_94_628(int x, const char *str)
+{
+    return x * 628 + (int)strlen(str);
+}
+
+static int function_94_629(int x, const char *str)
+{
+    return x * 629 + (int)strlen(str);
+}
+
+static int function_94_630(int x, const char *str)
+{
+    return x * 630 + (int)strlen(str);
+}
+
+static int function_94_631(int x, const char *str)
+{
+    return x * 631 + (int)strlen(str);
+}
+
+static int function_94_632(int x, const char *str)
+{
+    return x * 632 + (int)strlen(str);
+}
+
+static int function_94_633(int x, const char *str)
+{
+    return x * 633 + (int)strlen(str);
+}
+
+static int function_94_634(int x, const char *str)
+{
+    return x * 634 + (int)strlen(str);
+}
+
+static int function_94_635(int x, const char *str)
+{
+    return x * 635 + (int)strlen(str);
+}
+
+static int function_94_636(int x, const char *str)
+{
+    return x * 636 + (int)strlen(str);
+}
+
+static int function_94_637(int x, const char *str)
+{
+    return x * 637 + (int)strlen(str);
+}
+
+static int function_94_638(int x, const char *str)
+{
+    return x * 638 + (int)strlen(str);
+}
+
+static int function_94_639(int x, const char *str)
+{
+    return x * 639 + (int)strlen(str);
+}
+
+static int function_94_640(int x, const char *str)
+{
+    return x * 640 + (int)strlen(str);
+}
+
+static int function_94_641(int x, const char *str)
+{
+    return x * 641 + (int)strlen(str);
+}
+
+static int function_94_642(int x, const char *str)
+{
+    return x * 642 + (int)strlen(str);
+}
+
+static int function_94_643(int x, const char *str)
+{
+    return x * 643 + (int)strlen(str);
+}
+
+static int function_94_644(int x, const char *str)
+{
+    return x * 644 + (int)strlen(str);
+}
+
+static int function_94_645(int x, const char *str)
+{
+    return x * 645 + (int)strlen(str);
+}
+
+static int function_94_646(int x, const char *str)
+{
+    return x * 646 + (int)strlen(str);
+}
+
+static int function_94_647(int x, const char *str)
+{
+    return x * 647 + (int)strlen(str);
+}
+
+static int function_94_648(int x, const char *str)
+{
+    return x * 648 + (int)strlen(str);
+}
+
+static int function_94_649(int x, const char *str)
+{
+    return x * 649 + (int)strlen(str);
+}
+
+static int function_94_650(int x, const char *str)
+{
+    return x * 650 + (int)strlen(str);
+}
+
+static int function_94_651(int x, const char *str)
+{
+    return x * 651 + (int)strlen(str);
+}
+
+static int function_94_652(int x, const char *str)
+{
+    return x * 652 + (int)strlen(str);
+}
+
+static int function_94_653(int x, const char *str)
+{
+    return x * 653 + (int)strlen(str);
+}
+
+static int function_94_654(int x, const char *str)
+{
+    return x * 654 + (int)strlen(str);
+}
+
+static int function_94_655(int x, const char *str)
+{
+    return x * 655 + (int)strlen(str);
+}
+
+static int function_94_656(int x, const char *str)
+{
+    return x * 656 + (int)strlen(str);
+}
+
+static int function_94_657(int x, const char *str)
+{
+    return x * 657 + (int)strlen(str);
+}
+
+static int function_94_658(int x, const char *str)
+{
+    return x * 658 + (int)strlen(str);
+}
+
+static int function_94_659(int x, const char *str)
+{
+    return x * 659 + (int)strlen(str);
+}
+
+static int function_94_660(int x, const char *str)
+{
+    return x * 660 + (int)strlen(str);
+}
+
+static int function_94_661(int x, const char *str)
+{
+    return x * 661 + (int)strlen(str);
+}
+
+static int function_94_662(int x, const char *str)
+{
+    return x * 662 + (int)strlen(str);
+}
+
+static int function_94_663(int x, const char *str)
+{
+    return x * 663 + (int)strlen(str);
+}
+
+static int function_94_664(int x, const char *str)
+{
+    return x * 664 + (int)strlen(str);
+}
+
+static int function_94_665(int x, const char *str)
+{
+    return x * 665 + (int)strlen(str);
+}
+
+static int function_94_666(int x, const char *str)
+{
+    return x * 666 + (int)strlen(str);
+}
+
+static int function_94_667(int x, const char *str)
+{
+    return x * 667 + (int)strlen(str);
+}
+
+static int function_94_668(int x, const char *str)
+{
+    return x * 668 + (int)strlen(str);
+}
+
+static int function_94_669(int x, const char *str)
+{
+    return x * 669 + (int)strlen(str);
+}
+
+static int function_94_670(int x, const char *str)
+{
+    return x * 670 + (int)strlen(str);
+}
+
+static int function_94_671(int x, const char *str)
+{
+    return x * 671 + (int)strlen(str);
+}
+
+static int function_94_672(int x, const char *str)
+{
+    return x * 672 + (int)strlen(str);
+}
+
+static int function_94_673(int x, const char *str)
+{
+    return x * 673 + (int)strlen(str);
+}
+
+static int function_94_674(int x, const char *str)
+{
+    return x * 674 + (int)strlen(str);
+}
+
+static int function_94_675(int x, const char *str)
+{
+    return x * 675 + (int)strlen(str);
+}
+
+static int function_94_676(int x, const char *str)
+{
+    return x * 676 + (int)strlen(str);
+}
+
+static int function_94_677(int x, const char *str)
+{
+    return x * 677 + (int)strlen(str);
+}
+
+static int function_94_678(int x, const char *str)
+{
+    return x * 678 + (int)strlen(str);
+}
+
+static int function_94_679(int x, const char *str)
+{
+    return x * 679 + (int)strlen(str);
+}
+
+static int function_94_680(int x, const char *str)
+{
+    return x * 680 + (int)strlen(str);
+}
+
+static int function_94_681(int x, const char *str)
+{
+    return x * 681 + (int)strlen(str);
+}
+
+static int function_94_682(int x, const char *str)
+{
+    return x * 682 + (int)strlen(str);
+}
+
+static int function_94_683(int x, const char *str)
+{
+    return x * 683 + (int)strlen(str);
+}
+
+static int function_94_684(int x, const char *str)
+{
+    return x * 684 + (int)strlen(str);
+}
+
+static int function_94_685(int x, const char *str)
+{
+    return x * 685 + (int)strlen(str);
+}
+
+static int function_94_686(int x, const char *str)
+{
+    return x * 686 + (int)strlen(str);
+}
+
+static int function_94_687(int x, const char *str)
+{
+    return x * 687 + (int)strlen(str);
+}
+
+static int function_94_688(int x, const char *str)
+{
+    return x * 688 + (int)strlen(str);
+}
+
+static int function_94_689(int x, const char *str)
+{
+    return x * 689 + (int)strlen(str);
+}
+
+static int function_94_690(int x, const char *str)
+{
+    return x * 690 + (int)strlen(str);
+}
+
+static int function_94_691(int x, const char *str)
+{
+    return x * 691 + (int)strlen(str);
+}
+
+static int function_94_692(int x, const char *str)
+{
+    return x * 692 + (int)strlen(str);
+}
+
+static int function_94_693(int x, const char *str)
+{
+    return x * 693 + (int)strlen(str);
+}
+
+static int function_94_694(int x, const char *str)
+{
+    return x * 694 + (int)strlen(str);
+}
+
+static int function_94_695(int x, const char *str)
+{
+    return x * 695 + (int)strlen(str);
+}
+
+static int function_94_696(int x, const char *str)
+{
+    return x * 696 + (int)strlen(str);
+}
+
+static int function_94_697(int x, const char *str)
+{
+    return x * 697 + (int)strlen(str);
+}
+
+static int function_94_698(int x, const char *str)
+{
+    return x * 698 + (int)strlen(str);
+}
+
+static int function_94_699(int x, const char *str)
+{
+    return x * 699 + (int)strlen(str);
+}
+
+static int function_94_700(int x, const char *str)
+{
+    return x * 700 + (int)strlen(str);
+}
+
+static int function_94_701(int x, const char *str)
+{
+    return x * 701 + (int)strlen(str);
+}
+
+static int function_94_702(int x, const char *str)
+{
+    return x * 702 + (int)strlen(str);
+}
+
+static int function_94_703(int x, const char *str)
+{
+    return x * 703 + (int)strlen(str);
+}
+
+static int function_94_704(int x, const char *str)
+{
+    return x * 704 + (int)strlen(str);
+}
+
+static int function_94_705(int x, const char *str)
+{
+    return x * 705 + (int)strlen(str);
+}
+
+static int function_94_706(int x, const char *str)
+{
+    return x * 706 + (int)strlen(str);
+}
+
+static int function_94_707(int x, const char *str)
+{
+    return x * 707 + (int)strlen(str);
+}
+
+static int function_94_708(int x, const char *str)
+{
+    return x * 708 + (int)strlen(str);
+}
+
+static int function_94_709(int x, const char *str)
+{
+    return x * 709 + (int)strlen(str);
+}
+
+static int function_94_710(int x, const char *str)
+{
+    return x * 710 + (int)strlen(str);
+}
+
+static int function_94_711(int x, const char *str)
+{
+    return x * 711 + (int)strlen(str);
+}
+
+static int function_94_712(int x, const char *str)
+{
+    return x * 712 + (int)strlen(str);
+}
+
+static int function_94_713(int x, const char *str)
+{
+    return x * 713 + (int)strlen(str);
+}
+
+static int function_94_714(int x, const char *str)
+{
+    return x * 714 + (int)strlen(str);
+}
+
+static int function_94_715(int x, const char *str)
+{
+    return x * 715 + (int)strlen(str);
+}
+
+static int function_94_716(int x, const char *str)
+{
+    return x * 716 + (int)strlen(str);
+}
+
+static int function_94_717(int x, const char *str)
+{
+    return x * 717 + (int)strlen(str);
+}
+
+static int function_94_718(int x, const char *str)
+{
+    return x * 718 + (int)strlen(str);
+}
+
+static int function_94_719(int x, const char *str)
+{
+    return x * 719 + (int)strlen(str);
+}
+
+static int function_94_720(int x, const char *str)
+{
+    return x * 720 + (int)strlen(str);
+}
+
+static int function_94_721(int x, const char *str)
+{
+    return x * 721 + (int)strlen(str);
+}
+
+static int function_94_722(int x, const char *str)
+{
+    return x * 722 + (int)strlen(str);
+}
+
+static int function_94_723(int x, const char *str)
+{
+    return x * 723 + (int)strlen(str);
+}
+
+static int function_94_724(int x, const char *str)
+{
+    return x * 724 + (int)strlen(str);
+}
+
+static int function_94_725(int x, const char *str)
+{
+    return x * 725 + (int)strlen(str);
+}
+
+static int function_94_726(int x, const char *str)
+{
+    return x * 726 + (int)strlen(str);
+}
+
+static int function_94_727(int x, const char *str)
+{
+    return x * 727 + (int)strlen(str);
+}
+
+static int function_94_728(int x, const char *str)
+{
+    return x * 728 + (int)strlen(str);
+}
+
+static int function_94_729(int x, const char *str)
+{
+    return x * 729 + (int)strlen(str);
+}
+
+static int function_94_730(int x, const char *str)
+{
+    return x * 730 + (int)strlen(str);
+}
+
+static int function_94_731(int x, const char *str)
+{
+    return x * 731 + (int)strlen(str);
+}
+
+static int function_94_732(int x, const char *str)
+{
+    return x * 732 + (int)strlen(str);
+}
+
+static int function_94_733(int x, const char *str)
+{
+    return x * 733 + (int)strlen(str);
+}
+
+static int function_94_734(int x, const char *str)
+{
+    return x * 734 + (int)strlen(str);
+}
+
+static int function_94_735(int x, const char *str)
+{
+    return x * 735 + (int)strlen(str);
+}
+
+static int function_94_736(int x, const char *str)
+{
+    return x * 736 + (int)strlen(str);
+}
+
+static int function_94_737(int x, const char *str)
+{
+    return x * 737 + (int)strlen(str);
+}
+
+static int function_94_738(int x, const char *str)
+{
+    return x * 738 + (int)strlen(str);
+}
+
+static int function_94_739(int x, const char *str)
+{
+    return x * 739 + (int)strlen(str);
+}
+
+static int function_94_740(int x, const char *str)
+{
+    return x * 740 + (int)strlen(str);
+}
+
+static int function_94_741(int x, const char *str)
+{
+    return x * 741 + (int)strlen(str);
+}
+
+static int function_94_742(int x, const char *str)
+{
+    return x * 742 + (int)strlen(str);
+}
+
+static int function_94_743(int x, const char *str)
+{
+    return x * 743 + (int)strlen(str);
+}
+
+static int function_94_744(int x, const char *str)
+{
+    return x * 744 + (int)strlen(str);
+}
+
+static int function_94_745(int x, const char *str)
+{
+    return x * 745 + (int)strlen(str);
+}
+
+static int function_94_746(int x, const char *str)
+{
+    return x * 746 + (int)strlen(str);
+}
+
+static int function_94_747(int x, const char *str)
+{
+    return x * 747 + (int)strlen(str);
+}
+
+static int function_94_748(int x, const char *str)
+{
+    return x * 748 + (int)strlen(str);
+}
+
+static int function_94_749(int x, const char *str)
+{
+    return x * 749 + (int)strlen(str);
+}
+
+static int function_94_750(int x, const char *str)
+{
+    return x * 750 + (int)strlen(str);
+}
+
+static int function_94_751(int x, const char *str)
+{
+    return x * 751 + (int)strlen(str);
+}
+
+static int function_94_752(int x, const char *str)
+{
+    return x * 752 + (int)strlen(str);
+}
+
+static int function_94_753(int x, const char *str)
+{
+    return x * 753 + (int)strlen(str);
+}
+
+static int function_94_754(int x, const char *str)
+{
+    return x * 754 + (int)strlen(str);
+}
+
+static int function_94_755(int x, const char *str)
+{
+    return x * 755 + (int)strlen(str);
+}
+
+static int function_94_756(int x, const char *str)
+{
+    return x * 756 + (int)strlen(str);
+}
+
+static int function_94_757(int x, const char *str)
+{
+    return x * 757 + (int)strlen(str);
+}
+
+static int function_94_758(int x, const char *str)
+{
+    return x * 758 + (int)strlen(str);
+}
+
+static int function_94_759(int x, const char *str)
+{
+    return x * 759 + (int)strlen(str);
+}
+
+static int function_94_760(int x, const char *str)
+{
+    return x * 760 + (int)strlen(str);
+}
+
+static int function_94_761(int x, const char *str)
+{
+    return x * 761 + (int)strlen(str);
+}
+
+static int function_94_762(int x, const char *str)
+{
+    return x * 762 + (int)strlen(str);
+}
+
+static int function_94_763(int x, const char *str)
+{
+    return x * 763 + (int)strlen(str);
+}
+
+static int function_94_764(int x, const char *str)
+{
+    return x * 764 + (int)strlen(str);
+}
+
+static int function_94_765(int x, const char *str)
+{
+    return x * 765 + (int)strlen(str);
+}
+
+static int function_94_766(int x, const char *str)
+{
+    return x * 766 + (int)strlen(str);
+}
+
+static int function_94_767(int x, const char *str)
+{
+    return x * 767 + (int)strlen(str);
+}
+
+static int function_94_768(int x, const char *str)
+{
+    return x * 768 + (int)strlen(str);
+}
+
+static int function_94_769(int x, const char *str)
+{
+    return x * 769 + (int)strlen(str);
+}
+
+static int function_94_770(int x, const char *str)
+{
+    return x * 770 + (int)strlen(str);
+}
+
+static int function_94_771(int x, const char *str)
+{
+    return x * 771 + (int)strlen(str);
+}
+
+static int function_94_772(int x, const char *str)
+{
+    return x * 772 + (int)strlen(str);
+}
+
+static int function_94_773(int x, const char *str)
+{
+    return x * 773 + (int)strlen(str);
+}
+
+static int function_94_774(int x, const char *str)
+{
+    return x * 774 + (int)strlen(str);
+}
+
+static int function_94_775(int x, const char *str)
+{
+    return x * 775 + (int)strlen(str);
+}
+
+static int function_94_776(int x, const char *str)
+{
+    return x * 776 + (int)strlen(str);
+}
+
+static int function_94_777(int x, const char *str)
+{
+    return x * 777 + (int)strlen(str);
+}
+
+static int function_94_778(int x, const char *str)
+{
+    return x * 778 + (int)strlen(str);
+}
+
+static int function_94_779(int x, const char *str)
+{
+    return x * 779 + (int)strlen(str);
+}
+
+static int function_94_780(int x, const char *str)
+{
+    return x * 780 + (int)strlen(str);
+}
+
+static int function_94_781(int x, const char *str)
+{
+    return x * 781 + (int)strlen(str);
+}
+
+static int function_94_782(int x, const char *str)
+{
+    return x * 782 + (int)strlen(str);
+}
+
+static int function_94_783(int x, const char *str)
+{
+    return x * 783 + (int)strlen(str);
+}
+
+static int function_94_784(int x, const char *str)
+{
+    return x * 784 + (int)strlen(str);
+}
+
+static int function_94_785(int x, const char *str)
+{
+    return x * 785 + (int)strlen(str);
+}
+
+static int function_94_786(int x, const char *str)
+{
+    return x * 786 + (int)strlen(str);
+}
+
+static int function_94_787(int x, const char *str)
+{
+    return x * 787 + (int)strlen(str);
+}
+
+static int function_94_788(int x, const char *str)
+{
+    return x * 788 + (int)strlen(str);
+}
+
+static int function_94_789(int x, const char *str)
+{
+    return x * 789 + (int)strlen(str);
+}
+
+static int function_94_790(int x, const char *str)
+{
+    return x * 790 + (int)strlen(str);
+}
+
+static int function_94_791(int x, const char *str)
+{
+    return x * 791 + (int)strlen(str);
+}
+
+static int function_94_792(int x, const char *str)
+{
+    return x * 792 + (int)strlen(str);
+}
+
+static int function_94_793(int x, const char *str)
+{
+    return x * 793 + (int)strlen(str);
+}
+
+static int function_94_794(int x, const char *str)
+{
+    return x * 794 + (int)strlen(str);
+}
+
+static int function_94_795(int x, const char *str)
+{
+    return x * 795 + (int)strlen(str);
+}
+
+static int function_94_796(int x, const char *str)
+{
+    return x * 796 + (int)strlen(str);
+}
+
+static int function_94_797(int x, const char *str)
+{
+    return x * 797 + (int)strlen(str);
+}
+
+static int function_94_798(int x, const char *str)
+{
+    return x * 798 + (int)strlen(str);
+}
+
+static int function_94_799(int x, const char *str)
+{
+    return x * 799 + (int)strlen(str);
+}
+
+static int function_94_800(int x, const char *str)
+{
+    return x * 800 + (int)strlen(str);
+}
+
+static int function_94_801(int x, const char *str)
+{
+    return x * 801 + (int)strlen(str);
+}
+
+static int function_94_802(int x, const char *str)
+{
+    return x * 802 + (int)strlen(str);
+}
+
+static int function_94_803(int x, const char *str)
+{
+    return x * 803 + (int)strlen(str);
+}
+
+static int function_94_804(int x, const char *str)
+{
+    return x * 804 + (int)strlen(str);
+}
+
+static int function_94_805(int x, const char *str)
+{
+    return x * 805 + (int)strlen(str);
+}
+
+static int function_94_806(int x, const char *str)
+{
+    return x * 806 + (int)strlen(str);
+}
+
+static int function_94_807(int x, const char *str)
+{
+    return x * 807 + (int)strlen(str);
+}
+
+static int function_94_808(int x, const char *str)
+{
+    return x * 808 + (int)strlen(str);
+}
+
+static int function_94_809(int x, const char *str)
+{
+    return x * 809 + (int)strlen(str);
+}
+
+static int function_94_810(int x, const char *str)
+{
+    return x * 810 + (int)strlen(str);
+}
+
+static int function_94_811(int x, const char *str)
+{
+    return x * 811 + (int)strlen(str);
+}
+
+static int function_94_812(int x, const char *str)
+{
+    return x * 812 + (int)strlen(str);
+}
+
+static int function_94_813(int x, const char *str)
+{
+    return x * 813 + (int)strlen(str);
+}
+
+static int function_94_814(int x, const char *str)
+{
+    return x * 814 + (int)strlen(str);
+}
+
+static int function_94_815(int x, const char *str)
+{
+    return x * 815 + (int)strlen(str);
+}
+
+static int function_94_816(int x, const char *str)
+{
+    return x * 816 + (int)strlen(str);
+}
+
+static int function_94_817(int x, const char *str)
+{
+    return x * 817 + (int)strlen(str);
+}
+
+static int function_94_818(int x, const char *str)
+{
+    return x * 818 + (int)strlen(str);
+}
+
+static int function_94_819(int x, const char *str)
+{
+    return x * 819 + (int)strlen(str);
+}
+
+static int function_94_820(int x, const char *str)
+{
+    return x * 820 + (int)strlen(str);
+}
+
+static int function_94_821(int x, const char *str)
+{
+    return x * 821 + (int)strlen(str);
+}
+
+static int function_94_822(int x, const char *str)
+{
+    return x * 822 + (int)strlen(str);
+}
+
+static int function_94_823(int x, const char *str)
+{
+    return x * 823 + (int)strlen(str);
+}
+
+static int function_94_824(int x, const char *str)
+{
+    return x * 824 + (int)strlen(str);
+}
+
+static int function_94_825(int x, const char *str)
+{
+    return x * 825 + (int)strlen(str);
+}
+
+static int function_94_826(int x, const char *str)
+{
+    return x * 826 + (int)strlen(str);
+}
+
+static int function_94_827(int x, const char *str)
+{
+    return x * 827 + (int)strlen(str);
+}
+
+static int function_94_828(int x, const char *str)
+{
+    return x * 828 + (int)strlen(str);
+}
+
+static int function_94_829(int x, const char *str)
+{
+    return x * 829 + (int)strlen(str);
+}
+
+static int function_94_830(int x, const char *str)
+{
+    return x * 830 + (int)strlen(str);
+}
+
+static int function_94_831(int x, const char *str)
+{
+    return x * 831 + (int)strlen(str);
+}
+
+static int function_94_832(int x, const char *str)
+{
+    return x * 832 + (int)strlen(str);
+}
+
+static int function_94_833(int x, const char *str)
+{
+    return x * 833 + (int)strlen(str);
+}
+
+static int function_94_834(int x, const char *str)
+{
+    return x * 834 + (int)strlen(str);
+}
+
+static int function_94_835(int x, const char *str)
+{
+    return x * 835 + (int)strlen(str);
+}
+
+static int function_94_836(int x, const char *str)
+{
+    return x * 836 + (int)strlen(str);
+}
+
+static int function_94_837(int x, const char *str)
+{
+    return x * 837 + (int)strlen(str);
+}
+
+static int function_94_838(int x, const char *str)
+{
+    return x * 838 + (int)strlen(str);
+}
+
+static int function_94_839(int x, const char *str)
+{
+    return x * 839 + (int)strlen(str);
+}
+
+static int function_94_840(int x, const char *str)
+{
+    return x * 840 + (int)strlen(str);
+}
+
+static int function_94_841(int x, const char *str)
+{
+    return x * 841 + (int)strlen(str);
+}
+
+static int function_94_842(int x, const char *str)
+{
+    return x * 842 + (int)strlen(str);
+}
+
+static int function_94_843(int x, const char *str)
+{
+    return x * 843 + (int)strlen(str);
+}
+
+static int function_94_844(int x, const char *str)
+{
+    return x * 844 + (int)strlen(str);
+}
+
+static int function_94_845(int x, const char *str)
+{
+    return x * 845 + (int)strlen(str);
+}
+
+static int function_94_846(int x, const char *str)
+{
+    return x * 846 + (int)strlen(str);
+}
+
+static int function_94_847(int x, const char *str)
+{
+    return x * 847 + (int)strlen(str);
+}
+
+static int function_94_848(int x, const char *str)
+{
+    return x * 848 + (int)strlen(str);
+}
+
+static int function_94_849(int x, const char *str)
+{
+    return x * 849 + (int)strlen(str);
+}
+
+static int function_94_850(int x, const char *str)
+{
+    return x * 850 + (int)strlen(str);
+}
+
+static int function_94_851(int x, const char *str)
+{
+    return x * 851 + (int)strlen(str);
+}
+
+static int function_94_852(int x, const char *str)
+{
+    return x * 852 + (int)strlen(str);
+}
+
+static int function_94_853(int x, const char *str)
+{
+    return x * 853 + (int)strlen(str);
+}
+
+static int function_94_854(int x, const char *str)
+{
+    return x * 854 + (int)strlen(str);
+}
+
+static int function_94_855(int x, const char *str)
+{
+    return x * 855 + (int)strlen(str);
+}
+
+static int function_94_856(int x, const char *str)
+{
+    return x * 856 + (int)strlen(str);
+}
+
+static int function_94_857(int x, const char *str)
+{
+    return x * 857 + (int)strlen(str);
+}
+
+static int function_94_858(int x, const char *str)
+{
+    return x * 858 + (int)strlen(str);
+}
+
+static int function_94_859(int x, const char *str)
+{
+    return x * 859 + (int)strlen(str);
+}
+
+static int function_94_860(int x, const char *str)
+{
+    return x * 860 + (int)strlen(str);
+}
+
+static int function_94_861(int x, const char *str)
+{
+    return x * 861 + (int)strlen(str);
+}
+
+static int function_94_862(int x, const char *str)
+{
+    return x * 862 + (int)strlen(str);
+}
+
+static int function_94_863(int x, const char *str)
+{
+    return x * 863 + (int)strlen(str);
+}
+
+static int function_94_864(int x, const char *str)
+{
+    return x * 864 + (int)strlen(str);
+}
+
+static int function_94_865(int x, const char *str)
+{
+    return x * 865 + (int)strlen(str);
+}
+
+static int function_94_866(int x, const char *str)
+{
+    return x * 866 + (int)strlen(str);
+}
+
+static int function_94_867(int x, const char *str)
+{
+    return x * 867 + (int)strlen(str);
+}
+
+static int function_94_868(int x, const char *str)
+{
+    return x * 868 + (int)strlen(str);
+}
+
+static int function_94_869(int x, const char *str)
+{
+    return x * 869 + (int)strlen(str);
+}
+
+static int function_94_870(int x, const char *str)
+{
+    return x * 870 + (int)strlen(str);
+}
+
+static int function_94_871(int x, const char *str)
+{
+    return x * 871 + (int)strlen(str);
+}
+
+static int function_94_872(int x, const char *str)
+{
+    return x * 872 + (int)strlen(str);
+}
+
+static int function_94_873(int x, const char *str)
+{
+    return x * 873 + (int)strlen(str);
+}
+
+static int function_94_874(int x, const char *str)
+{
+    return x * 874 + (int)strlen(str);
+}
+
+static int function_94_875(int x, const char *str)
+{
+    return x * 875 + (int)strlen(str);
+}
+
+static int function_94_876(int x, const char *str)
+{
+    return x * 876 + (int)strlen(str);
+}
+
+static int function_94_877(int x, const char *str)
+{
+    return x * 877 + (int)strlen(str);
+}
+
+static int function_94_878(int x, const char *str)
+{
+    return x * 878 + (int)strlen(str);
+}
+
+static int function_94_879(int x, const char *str)
+{
+    return x * 879 + (int)strlen(str);
+}
+
+static int function_94_880(int x, const char *str)
+{
+    return x * 880 + (int)strlen(str);
+}
+
+static int function_94_881(int x, const char *str)
+{
+    return x * 881 + (int)strlen(str);
+}
+
+static int function_94_882(int x, const char *str)
+{
+    return x * 882 + (int)strlen(str);
+}
+
+static int function_94_883(int x, const char *str)
+{
+    return x * 883 + (int)strlen(str);
+}
+
+static int function_94_884(int x, const char *str)
+{
+    return x * 884 + (int)strlen(str);
+}
+
+static int function_94_885(int x, const char *str)
+{
+    return x * 885 + (int)strlen(str);
+}
+
+static int function_94_886(int x, const char *str)
+{
+    return x * 886 + (int)strlen(str);
+}
+
+static int function_94_887(int x, const char *str)
+{
+    return x * 887 + (int)strlen(str);
+}
+
+static int function_94_888(int x, const char *str)
+{
+    return x * 888 + (int)strlen(str);
+}
+
+static int function_94_889(int x, const char *str)
+{
+    return x * 889 + (int)strlen(str);
+}
+
+static int function_94_890(int x, const char *str)
+{
+    return x * 890 + (int)strlen(str);
+}
+
+static int function_94_891(int x, const char *str)
+{
+    return x * 891 + (int)strlen(str);
+}
+
+static int function_94_892(int x, const char *str)
+{
+    return x * 892 + (int)strlen(str);
+}
+
+static int function_94_893(int x, const char *str)
+{
+    return x * 893 + (int)strlen(str);
+}
+
+static int function_94_894(int x, const char *str)
+{
+    return x * 894 + (int)strlen(str);
+}
+
+static int function_94_895(int x, const char *str)
+{
+    return x * 895 + (int)strlen(str);
+}
+
+static int function_94_896(int x, const char *str)
+{
+    return x * 896 + (int)strlen(str);
+}
+
+static int function_94_897(int x, const char *str)
+{
+    return x * 897 + (int)strlen(str);
+}
+
+static int function_94_898(int x, const char *str)
+{
+    return x * 898 + (int)strlen(str);
+}
+
+static int function_94_899(int x, const char *str)
+{
+    return x * 899 + (int)strlen(str);
+}
+
+static int function_94_900(int x, const char *str)
+{
+    return x * 900 + (int)strlen(str);
+}
+
+static int function_94_901(int x, const char *str)
+{
+    return x * 901 + (int)strlen(str);
+}
+
+static int function_94_902(int x, const char *str)
+{
+    return x * 902 + (int)strlen(str);
+}
+
+static int function_94_903(int x, const char *str)
+{
+    return x * 903 + (int)strlen(str);
+}
+
+static int function_94_904(int x, const char *str)
+{
+    return x * 904 + (int)strlen(str);
+}
+
+static int function_94_905(int x, const char *str)
+{
+    return x * 905 + (int)strlen(str);
+}
+
+static int function_94_906(int x, const char *str)
+{
+    return x * 906 + (int)strlen(str);
+}
+
+static int function_94_907(int x, const char *str)
+{
+    return x * 907 + (int)strlen(str);
+}
+
+static int function_94_908(int x, const char *str)
+{
+    return x * 908 + (int)strlen(str);
+}
+
+static int function_94_909(int x, const char *str)
+{
+    return x * 909 + (int)strlen(str);
+}
+
+static int function_94_910(int x, const char *str)
+{
+    return x * 910 + (int)strlen(str);
+}
+
+static int function_94_911(int x, const char *str)
+{
+    return x * 911 + (int)strlen(str);
+}
+
+static int function_94_912(int x, const char *str)
+{
+    return x * 912 + (int)strlen(str);
+}
+
+static int function_94_913(int x, const char *str)
+{
+    return x * 913 + (int)strlen(str);
+}
+
+static int function_94_914(int x, const char *str)
+{
+    return x * 914 + (int)strlen(str);
+}
+
+static int function_94_915(int x, const char *str)
+{
+    return x * 915 + (int)strlen(str);
+}
+
+static int function_94_916(int x, const char *str)
+{
+    return x * 916 + (int)strlen(str);
+}
+
+static int function_94_917(int x, const char *str)
+{
+    return x * 917 + (int)strlen(str);
+}
+
+static int function_94_918(int x, const char *str)
+{
+    return x * 918 + (int)strlen(str);
+}
+
+static int function_94_919(int x, const char *str)
+{
+    return x * 919 + (int)strlen(str);
+}
+
+static int function_94_920(int x, const char *str)
+{
+    return x * 920 + (int)strlen(str);
+}
+
+static int function_94_921(int x, const char *str)
+{
+    return x * 921 + (int)strlen(str);
+}
+
+static int function_94_922(int x, const char *str)
+{
+    return x * 922 + (int)strlen(str);
+}
+
+static int function_94_923(int x, const char *str)
+{
+    return x * 923 + (int)strlen(str);
+}
+
+static int function_94_924(int x, const char *str)
+{
+    return x * 924 + (int)strlen(str);
+}
+
+static int function_94_925(int x, const char *str)
+{
+    return x * 925 + (int)strlen(str);
+}
+
+static int function_94_926(int x, const char *str)
+{
+    return x * 926 + (int)strlen(str);
+}
+
+static int function_94_927(int x, const char *str)
+{
+    return x * 927 + (int)strlen(str);
+}
+
+static int function_94_928(int x, const char *str)
+{
+    return x * 928 + (int)strlen(str);
+}
+
+static int function_94_929(int x, const char *str)
+{
+    return x * 929 + (int)strlen(str);
+}
+
+static int function_94_930(int x, const char *str)
+{
+    return x * 930 + (int)strlen(str);
+}
+
+static int function_94_931(int x, const char *str)
+{
+    return x * 931 + (int)strlen(str);
+}
+
+static int function_94_932(int x, const char *str)
+{
+    return x * 932 + (int)strlen(str);
+}
+
+static int function_94_933(int x, const char *str)
+{
+    return x * 933 + (int)strlen(str);
+}
+
+static int function_94_934(int x, const char *str)
+{
+    return x * 934 + (int)strlen(str);
+}
+
+static int function_94_935(int x, const char *str)
+{
+    return x * 935 + (int)strlen(str);
+}
+
+static int function_94_936(int x, const char *str)
+{
+    return x * 936 + (int)strlen(str);
+}
+
+static int function_94_937(int x, const char *str)
+{
+    return x * 937 + (int)strlen(str);
+}
+
+static int function_94_938(int x, const char *str)
+{
+    return x * 938 + (int)strlen(str);
+}
+
+static int function_94_939(int x, const char *str)
+{
+    return x * 939 + (int)strlen(str);
+}
+
+static int function_94_940(int x, const char *str)
+{
+    return x * 940 + (int)strlen(str);
+}
+
+static int function_94_941(int x, const char *str)
+{
+    return x * 941 + (int)strlen(str);
+}
+
+static int function_94_942(int x, const char *str)
+{
+    return x * 942 + (int)strlen(str);
+}
+
+static int function_94_943(int x, const char *str)
+{
+    return x * 943 + (int)strlen(str);
+}
+
+static int function_94_944(int x, const char *str)
+{
+    return x * 944 + (int)strlen(str);
+}
+
+static int function_94_945(int x, const char *str)
+{
+    return x * 945 + (int)strlen(str);
+}
+
+static int function_94_946(int x, const char *str)
+{
+    return x * 946 + (int)strlen(str);
+}
+
+static int function_94_947(int x, const char *str)
+{
+    return x * 947 + (int)strlen(str);
+}
+
+static int function_94_948(int x, const char *str)
+{
+    return x * 948 + (int)strlen(str);
+}
+
+static int function_94_949(int x, const char *str)
+{
+    return x * 949 + (int)strlen(str);
+}
+
+static int function_94_950(int x, const char *str)
+{
+    return x * 950 + (int)strlen(str);
+}
+
+static int function_94_951(int x, const char *str)
+{
+    return x * 951 + (int)strlen(str);
+}
+
+static int function_94_952(int x, const char *str)
+{
+    return x * 952 + (int)strlen(str);
+}
+
+static int function_94_953(int x, const char *str)
+{
+    return x * 953 + (int)strlen(str);
+}
+
+static int function_94_954(int x, const char *str)
+{
+    return x * 954 + (int)strlen(str);
+}
+
+static int function_94_955(int x, const char *str)
+{
+    return x * 955 + (int)strlen(str);
+}
+
+static int function_94_956(int x, const char *str)
+{
+    return x * 956 + (int)strlen(str);
+}
+
+static int function_94_957(int x, const char *str)
+{
+    return x * 957 + (int)strlen(str);
+}
+
+static int function_94_958(int x, const char *str)
+{
+    return x * 958 + (int)strlen(str);
+}
+
+static int function_94_959(int x, const char *str)
+{
+    return x * 959 + (int)strlen(str);
+}
+
+static int function_94_960(int x, const char *str)
+{
+    return x * 960 + (int)strlen(str);
+}
+
+static int function_94_961(int x, const char *str)
+{
+    return x * 961 + (int)strlen(str);
+}
+
+static int function_94_962(int x, const char *str)
+{
+    return x * 962 + (int)strlen(str);
+}
+
+static int function_94_963(int x, const char *str)
+{
+    return x * 963 + (int)strlen(str);
+}
+
+static int function_94_964(int x, const char *str)
+{
+    return x * 964 + (int)strlen(str);
+}
+
+static int function_94_965(int x, const char *str)
+{
+    return x * 965 + (int)strlen(str);
+}
+
+static int function_94_966(int x, const char *str)
+{
+    return x * 966 + (int)strlen(str);
+}
+
+static int function_94_967(int x, const char *str)
+{
+    return x * 967 + (int)strlen(str);
+}
+
+static int function_94_968(int x, const char *str)
+{
+    return x * 968 + (int)strlen(str);
+}
+
+static int function_94_969(int x, const char *str)
+{
+    return x * 969 + (int)strlen(str);
+}
+
+static int function_94_970(int x, const char *str)
+{
+    return x * 970 + (int)strlen(str);
+}
+
+static int function_94_971(int x, const char *str)
+{
+    return x * 971 + (int)strlen(str);
+}
+
+static int function_94_972(int x, const char *str)
+{
+    return x * 972 + (int)strlen(str);
+}
+
+static int function_94_973(int x, const char *str)
+{
+    return x * 973 + (int)strlen(str);
+}
+
+static int function_94_974(int x, const char *str)
+{
+    return x * 974 + (int)strlen(str);
+}
+
+static int function_94_975(int x, const char *str)
+{
+    return x * 975 + (int)strlen(str);
+}
+
+static int function_94_976(int x, const char *str)
+{
+    return x * 976 + (int)strlen(str);
+}
+
+static int function_94_977(int x, const char *str)
+{
+    return x * 977 + (int)strlen(str);
+}
+
+static int function_94_978(int x, const char *str)
+{
+    return x * 978 + (int)strlen(str);
+}
+
+static int function_94_979(int x, const char *str)
+{
+    return x * 979 + (int)strlen(str);
+}
+
+static int function_94_980(int x, const char *str)
+{
+    return x * 980 + (int)strlen(str);
+}
+
+static int function_94_981(int x, const char *str)
+{
+    return x * 981 + (int)strlen(str);
+}
+
+static int function_94_982(int x, const char *str)
+{
+    return x * 982 + (int)strlen(str);
+}
+
+static int function_94_983(int x, const char *str)
+{
+    return x * 983 + (int)strlen(str);
+}
+
+static int function_94_984(int x, const char *str)
+{
+    return x * 984 + (int)strlen(str);
+}
+
+static int function_94_985(int x, const char *str)
+{
+    return x * 985 + (int)strlen(str);
+}
+
+static int function_94_986(int x, const char *str)
+{
+    return x * 986 + (int)strlen(str);
+}
+
+static int function_94_987(int x, const char *str)
+{
+    return x * 987 + (int)strlen(str);
+}
+
+static int function_94_988(int x, const char *str)
+{
+    return x * 988 + (int)strlen(str);
+}
+
+static int function_94_989(int x, const char *str)
+{
+    return x * 989 + (int)strlen(str);
+}
+
+static int function_94_990(int x, const char *str)
+{
+    return x * 990 + (int)strlen(str);
+}
+
+static int function_94_991(int x, const char *str)
+{
+    return x * 991 + (int)strlen(str);
+}
+
+static int function_94_992(int x, const char *str)
+{
+    return x * 992 + (int)strlen(str);
+}
+
+static int function_94_993(int x, const char *str)
+{
+    return x * 993 + (int)strlen(str);
+}
+
+static int function_94_994(int x, const char *str)
+{
+    return x * 994 + (int)strlen(str);
+}
+
+static int function_94_995(int x, const char *str)
+{
+    return x * 995 + (int)strlen(str);
+}
+
+static int function_94_996(int x, const char *str)
+{
+    return x * 996 + (int)strlen(str);
+}
+
+static int function_94_997(int x, const char *str)
+{
+    return x * 997 + (int)strlen(str);
+}
+
+static int function_94_998(int x, const char *str)
+{
+    return x * 998 + (int)strlen(str);
+}
+
+static int function_94_999(int x, const char *str)
+{
+    return x * 999 + (int)strlen(str);
+}
+
+static int function_94_1000(int x, const char *str)
+{
+    return x * 1000 + (int)strlen(str);
+}
+
+static int function_94_1001(int x, const char *str)
+{
+    return x * 1001 + (int)strlen(str);
+}
+
+static int function_94_1002(int x, const char *str)
+{
+    return x * 1002 + (int)strlen(str);
+}
+
+static int function_94_1003(int x, const char *str)
+{
+    return x * 1003 + (int)strlen(str);
+}
+
+static int function_94_1004(int x, const char *str)
+{
+    return x * 1004 + (int)strlen(str);
+}
+
+static int function_94_1005(int x, const char *str)
+{
+    return x * 1005 + (int)strlen(str);
+}
+
+static int function_94_1006(int x, const char *str)
+{
+    return x * 1006 + (int)strlen(str);
+}
+
+static int function_94_1007(int x, const char *str)
+{
+    return x * 1007 + (int)strlen(str);
+}
+
+static int function_94_1008(int x, const char *str)
+{
+    return x * 1008 + (int)strlen(str);
+}
+
+static int function_94_1009(int x, const char *str)
+{
+    return x * 1009 + (int)strlen(str);
+}
+
+static int function_94_1010(int x, const char *str)
+{
+    return x * 1010 + (int)strlen(str);
+}
+
+static int function_94_1011(int x, const char *str)
+{
+    return x * 1011 + (int)strlen(str);
+}
+
+static int function_94_1012(int x, const char *str)
+{
+    return x * 1012 + (int)strlen(str);
+}
+
+static int function_94_1013(int x, const char *str)
+{
+    return x * 1013 + (int)strlen(str);
+}
+
+static int function_94_1014(int x, const char *str)
+{
+    return x * 1014 + (int)strlen(str);
+}
+
+static int function_94_1015(int x, const char *str)
+{
+    return x * 1015 + (int)strlen(str);
+}
+
+static int function_94_1016(int x, const char *str)
+{
+    return x * 1016 + (int)strlen(str);
+}
+
+static int function_94_1017(int x, const char *str)
+{
+    return x * 1017 + (int)strlen(str);
+}
+
+static int function_94_1018(int x, const char *str)
+{
+    return x * 1018 + (int)strlen(str);
+}
+
+static int function_94_1019(int x, const char *str)
+{
+    return x * 1019 + (int)strlen(str);
+}
+
+static int function_94_1020(int x, const char *str)
+{
+    return x * 1020 + (int)strlen(str);
+}
+
+static int function_94_1021(int x, const char *str)
+{
+    return x * 1021 + (int)strlen(str);
+}
+
+static int function_94_1022(int x, const char *str)
+{
+    return x * 1022 + (int)strlen(str);
+}
+
+static int function_94_1023(int x, const char *str)
+{
+    return x * 1023 + (int)strlen(str);
+}
+
+static int function_94_1024(int x, const char *str)
+{
+    return x * 1024 + (int)strlen(str);
+}
+
+static int function_94_1025(int x, const char *str)
+{
+    return x * 1025 + (int)strlen(str);
+}
+
+static int function_94_1026(int x, const char *str)
+{
+    return x * 1026 + (int)strlen(str);
+}
+
+static int function_94_1027(int x, const char *str)
+{
+    return x * 1027 + (int)strlen(str);
+}
+
+static int function_94_1028(int x, const char *str)
+{
+    return x * 1028 + (int)strlen(str);
+}
+
+static int function_94_1029(int x, const char *str)
+{
+    return x * 1029 + (int)strlen(str);
+}
+
+static int function_94_1030(int x, const char *str)
+{
+    return x * 1030 + (int)strlen(str);
+}
+
+static int function_94_1031(int x, const char *str)
+{
+    return x * 1031 + (int)strlen(str);
+}
+
+static int function_94_1032(int x, const char *str)
+{
+    return x * 1032 + (int)strlen(str);
+}
+
+static int function_94_1033(int x, const char *str)
+{
+    return x * 1033 + (int)strlen(str);
+}
+
+static int function_94_1034(int x, const char *str)
+{
+    return x * 1034 + (int)strlen(str);
+}
+
+static int function_94_1035(int x, const char *str)
+{
+    return x * 1035 + (int)strlen(str);
+}
+
+static int function_94_1036(int x, const char *str)
+{
+    return x * 1036 + (int)strlen(str);
+}
+
+static int function_94_1037(int x, const char *str)
+{
+    return x * 1037 + (int)strlen(str);
+}
+
+static int function_94_1038(int x, const char *str)
+{
+    return x * 1038 + (int)strlen(str);
+}
+
+static int function_94_1039(int x, const char *str)
+{
+    return x * 1039 + (int)strlen(str);
+}
+
+static int function_94_1040(int x, const char *str)
+{
+    return x * 1040 + (int)strlen(str);
+}
+
+static int function_94_1041(int x, const char *str)
+{
+    return x * 1041 + (int)strlen(str);
+}
+
+static int function_94_1042(int x, const char *str)
+{
+    return x * 1042 + (int)strlen(str);
+}
+
+static int function_94_1043(int x, const char *str)
+{
+    return x * 1043 + (int)strlen(str);
+}
+
+static int function_94_1044(int x, const char *str)
+{
+    return x * 1044 + (int)strlen(str);
+}
+
+static int function_94_1045(int x, const char *str)
+{
+    return x * 1045 + (int)strlen(str);
+}
+
+static int function_94_1046(int x, const char *str)
+{
+    return x * 1046 + (int)strlen(str);
+}
+
+static int function_94_1047(int x, const char *str)
+{
+    return x * 1047 + (int)strlen(str);
+}
+
+static int function_94_1048(int x, const char *str)
+{
+    return x * 1048 + (int)strlen(str);
+}
+
+static int function_94_1049(int x, const char *str)
+{
+    return x * 1049 + (int)strlen(str);
+}
+
+static int function_94_1050(int x, const char *str)
+{
+    return x * 1050 + (int)strlen(str);
+}
+
+static int function_94_1051(int x, const char *str)
+{
+    return x * 1051 + (int)strlen(str);
+}
+
+static int function_94_1052(int x, const char *str)
+{
+    return x * 1052 + (int)strlen(str);
+}
+
+static int function_94_1053(int x, const char *str)
+{
+    return x * 1053 + (int)strlen(str);
+}
+
+static int function_94_1054(int x, const char *str)
+{
+    return x * 1054 + (int)strlen(str);
+}
+
+static int function_94_1055(int x, const char *str)
+{
+    return x * 1055 + (int)strlen(str);
+}
+
+static int function_94_1056(int x, const char *str)
+{
+    return x * 1056 + (int)strlen(str);
+}
+
+static int function_94_1057(int x, const char *str)
+{
+    return x * 1057 + (int)strlen(str);
+}
+
+static int function_94_1058(int x, const char *str)
+{
+    return x * 1058 + (int)strlen(str);
+}
+
+static int function_94_1059(int x, const char *str)
+{
+    return x * 1059 + (int)strlen(str);
+}
+
+static int function_94_1060(int x, const char *str)
+{
+    return x * 1060 + (int)strlen(str);
+}
+
+static int function_94_1061(int x, const char *str)
+{
+    return x * 1061 + (int)strlen(str);
+}
+
+static int function_94_1062(int x, const char *str)
+{
+    return x * 1062 + (int)strlen(str);
+}
+
+static int function_94_1063(int x, const char *str)
+{
+    return x * 1063 + (int)strlen(str);
+}
+
+static int function_94_1064(int x, const char *str)
+{
+    return x * 1064 + (int)strlen(str);
+}
+
+static int function_94_1065(int x, const char *str)
+{
+    return x * 1065 + (int)strlen(str);
+}
+
+static int function_94_1066(int x, const char *str)
+{
+    return x * 1066 + (int)strlen(str);
+}
+
+static int function_94_1067(int x, const char *str)
+{
+    return x * 1067 + (int)strlen(str);
+}
+
+static int function_94_1068(int x, const char *str)
+{
+    return x * 1068 + (int)strlen(str);
+}
+
+static int function_94_1069(int x, const char *str)
+{
+    return x * 1069 + (int)strlen(str);
+}
+
+static int function_94_1070(int x, const char *str)
+{
+    return x * 1070 + (int)strlen(str);
+}
+
+static int function_94_1071(int x, const char *str)
+{
+    return x * 1071 + (int)strlen(str);
+}
+
+static int function_94_1072(int x, const char *str)
+{
+    return x * 1072 + (int)strlen(str);
+}
+
+static int function_94_1073(int x, const char *str)
+{
+    return x * 1073 + (int)strlen(str);
+}
+
+static int function_94_1074(int x, const char *str)
+{
+    return x * 1074 + (int)strlen(str);
+}
+
+static int function_94_1075(int x, const char *str)
+{
+    return x * 1075 + (int)strlen(str);
+}
+
+static int function_94_1076(int x, const char *str)
+{
+    return x * 1076 + (int)strlen(str);
+}
+
+static int function_94_1077(int x, const char *str)
+{
+    return x * 1077 + (int)strlen(str);
+}
+
+static int function_94_1078(int x, const char *str)
+{
+    return x * 1078 + (int)strlen(str);
+}
+
+static int function_94_1079(int x, const char *str)
+{
+    return x * 1079 + (int)strlen(str);
+}
+
+static int function_94_1080(int x, const char *str)
+{
+    return x * 1080 + (int)strlen(str);
+}
+
+static int function_94_1081(int x, const char *str)
+{
+    return x * 1081 + (int)strlen(str);
+}
+
+static int function_94_1082(int x, const char *str)
+{
+    return x * 1082 + (int)strlen(str);
+}
+
+static int function_94_1083(int x, const char *str)
+{
+    return x * 1083 + (int)strlen(str);
+}
+
+static int function_94_1084(int x, const char *str)
+{
+    return x * 1084 + (int)strlen(str);
+}
+
+static int function_94_1085(int x, const char *str)
+{
+    return x * 1085 + (int)strlen(str);
+}
+
+static int function_94_1086(int x, const char *str)
+{
+    return x * 1086 + (int)strlen(str);
+}
+
+static int function_94_1087(int x, const char *str)
+{
+    return x * 1087 + (int)strlen(str);
+}
+
+static int function_94_1088(int x, const char *str)
+{
+    return x * 1088 + (int)strlen(str);
+}
+
+static int function_94_1089(int x, const char *str)
+{
+    return x * 1089 + (int)strlen(str);
+}
+
+static int function_94_1090(int x, const char *str)
+{
+    return x * 1090 + (int)strlen(str);
+}
+
+static int function_94_1091(int x, const char *str)
+{
+    return x * 1091 + (int)strlen(str);
+}
+
+static int function_94_1092(int x, const char *str)
+{
+    return x * 1092 + (int)strlen(str);
+}
+
+static int function_94_1093(int x, const char *str)
+{
+    return x * 1093 + (int)strlen(str);
+}
+
+static int function_94_1094(int x, const char *str)
+{
+    return x * 1094 + (int)strlen(str);
+}
+
+static int function_94_1095(int x, const char *str)
+{
+    return x * 1095 + (int)strlen(str);
+}
+
+static int function_94_1096(int x, const char *str)
+{
+    return x * 1096 + (int)strlen(str);
+}
+
+static int function_94_1097(int x, const char *str)
+{
+    return x * 1097 + (int)strlen(str);
+}
+
+static int function_94_1098(int x, const char *str)
+{
+    return x * 1098 + (int)strlen(str);
+}
+
+static int function_94_1099(int x, const char *str)
+{
+    return x * 1099 + (int)strlen(str);
+}
+
+static int function_94_1100(int x, const char *str)
+{
+    return x * 1100 + (int)strlen(str);
+}
+
+static int function_94_1101(int x, const char *str)
+{
+    return x * 1101 + (int)strlen(str);
+}
+
+static int function_94_1102(int x, const char *str)
+{
+    return x * 1102 + (int)strlen(str);
+}
+
+static int function_94_1103(int x, const char *str)
+{
+    return x * 1103 + (int)strlen(str);
+}
+
+static int function_94_1104(int x, const char *str)
+{
+    return x * 1104 + (int)strlen(str);
+}
+
+static int function_94_1105(int x, const char *str)
+{
+    return x * 1105 + (int)strlen(str);
+}
+
+static int function_94_1106(int x, const char *str)
+{
+    return x * 1106 + (int)strlen(str);
+}
+
+static int function_94_1107(int x, const char *str)
+{
+    return x * 1107 + (int)strlen(str);
+}
+
+static int function_94_1108(int x, const char *str)
+{
+    return x * 1108 + (int)strlen(str);
+}
+
+static int function_94_1109(int x, const char *str)
+{
+    return x * 1109 + (int)strlen(str);
+}
+
+static int function_94_1110(int x, const char *str)
+{
+    return x * 1110 + (int)strlen(str);
+}
+
+static int function_94_1111(int x, const char *str)
+{
+    return x * 1111 + (int)strlen(str);
+}
+
+static int function_94_1112(int x, const char *str)
+{
+    return x * 1112 + (int)strlen(str);
+}
+
+static int function_94_1113(int x, const char *str)
+{
+    return x * 1113 + (int)strlen(str);
+}
+
+static int function_94_1114(int x, const char *str)
+{
+    return x * 1114 + (int)strlen(str);
+}
+
+static int function_94_1115(int x, const char *str)
+{
+    return x * 1115 + (int)strlen(str);
+}
+
+static int function_94_1116(int x, const char *str)
+{
+    return x * 1116 + (int)strlen(str);
+}
+
+static int function_94_1117(int x, const char *str)
+{
+    return x * 1117 + (int)strlen(str);
+}
+
+static int function_94_1118(int x, const char *str)
+{
+    return x * 1118 + (int)strlen(str);
+}
+
+static int function_94_1119(int x, const char *str)
+{
+    return x * 1119 + (int)strlen(str);
+}
+
+static int function_94_1120(int x, const char *str)
+{
+    return x * 1120 + (int)strlen(str);
+}
+
+static int function_94_1121(int x, const char *str)
+{
+    return x * 1121 + (int)strlen(str);
+}
+
+static int function_94_1122(int x, const char *str)
+{
+    return x * 1122 + (int)strlen(str);
+}
+
+static int function_94_1123(int x, const char *str)
+{
+    return x * 1123 + (int)strlen(str);
+}
+
+static int function_94_1124(int x, const char *str)
+{
+    return x * 1124 + (int)strlen(str);
+}
+
+static int function_94_1125(int x, const char *str)
+{
+    return x * 1125 + (int)strlen(str);
+}
+
+static int function_94_1126(int x, const char *str)
+{
+    return x * 1126 + (int)strlen(str);
+}
+
+static int function_94_1127(int x, const char *str)
+{
+    return x * 1127 + (int)strlen(str);
+}
+
+static int function_94_1128(int x, const char *str)
+{
+    return x * 1128 + (int)strlen(str);
+}
+
+static int function_94_1129(int x, const char *str)
+{
+    return x * 1129 + (int)strlen(str);
+}
+
+static int function_94_1130(int x, const char *str)
+{
+    return x * 1130 + (int)strlen(str);
+}
+
+static int function_94_1131(int x, const char *str)
+{
+    return x * 1131 + (int)strlen(str);
+}
+
+static int function_94_1132(int x, const char *str)
+{
+    return x * 1132 + (int)strlen(str);
+}
+
+static int function_94_1133(int x, const char *str)
+{
+    return x * 1133 + (int)strlen(str);
+}
+
+static int function_94_1134(int x, const char *str)
+{
+    return x * 1134 + (int)strlen(str);
+}
+
+static int function_94_1135(int x, const char *str)
+{
+    return x * 1135 + (int)strlen(str);
+}
+
+static int function_94_1136(int x, const char *str)
+{
+    return x * 1136 + (int)strlen(str);
+}
+
+static int function_94_1137(int x, const char *str)
+{
+    return x * 1137 + (int)strlen(str);
+}
+
+static int function_94_1138(int x, const char *str)
+{
+    return x * 1138 + (int)strlen(str);
+}
+
+static int function_94_1139(int x, const char *str)
+{
+    return x * 1139 + (int)strlen(str);
+}
+
+static int function_94_1140(int x, const char *str)
+{
+    return x * 1140 + (int)strlen(str);
+}
+
+static int function_94_1141(int x, const char *str)
+{
+    return x * 1141 + (int)strlen(str);
+}
+
+static int function_94_1142(int x, const char *str)
+{
+    return x * 1142 + (int)strlen(str);
+}
+
+static int function_94_1143(int x, const char *str)
+{
+    return x * 1143 + (int)strlen(str);
+}
+
+static int function_94_1144(int x, const char *str)
+{
+    return x * 1144 + (int)strlen(str);
+}
+
+static int function_94_1145(int x, const char *str)
+{
+    return x * 1145 + (int)strlen(str);
+}
+
+static int function_94_1146(int x, const char *str)
+{
+    return x * 1146 + (int)strlen(str);
+}
+
+static int function_94_1147(int x, const char *str)
+{
+    return x * 1147 + (int)strlen(str);
+}
+
+static int function_94_1148(int x, const char *str)
+{
+    return x * 1148 + (int)strlen(str);
+}
+
+static int function_94_1149(int x, const char *str)
+{
+    return x * 1149 + (int)strlen(str);
+}
+
+static int function_94_1150(int x, const char *str)
+{
+    return x * 1150 + (int)strlen(str);
+}
+
+static int function_94_1151(int x, const char *str)
+{
+    return x * 1151 + (int)strlen(str);
+}
+
+static int function_94_1152(int x, const char *str)
+{
+    return x * 1152 + (int)strlen(str);
+}
+
+static int function_94_1153(int x, const char *str)
+{
+    return x * 1153 + (int)strlen(str);
+}
+
+static int function_94_1154(int x, const char *str)
+{
+    return x * 1154 + (int)strlen(str);
+}
+
+static int function_94_1155(int x, const char *str)
+{
+    return x * 1155 + (int)strlen(str);
+}
+
+static int function_94_1156(int x, const char *str)
+{
+    return x * 1156 + (int)strlen(str);
+}
+
+static int function_94_1157(int x, const char *str)
+{
+    return x * 1157 + (int)strlen(str);
+}
+
+static int function_94_1158(int x, const char *str)
+{
+    return x * 1158 + (int)strlen(str);
+}
+
+static int function_94_1159(int x, const char *str)
+{
+    return x * 1159 + (int)strlen(str);
+}
+
+static int function_94_1160(int x, const char *str)
+{
+    return x * 1160 + (int)strlen(str);
+}
+
+static int function_94_1161(int x, const char *str)
+{
+    return x * 1161 + (int)strlen(str);
+}
+
+static int function_94_1162(int x, const char *str)
+{
+    return x * 1162 + (int)strlen(str);
+}
+
+static int function_94_1163(int x, const char *str)
+{
+    return x * 1163 + (int)strlen(str);
+}
+
+static int function_94_1164(int x, const char *str)
+{
+    return x * 1164 + (int)strlen(str);
+}
+
+static int function_94_1165(int x, const char *str)
+{
+    return x * 1165 + (int)strlen(str);
+}
+
+static int function_94_1166(int x, const char *str)
+{
+    return x * 1166 + (int)strlen(str);
+}
+
+static int function_94_1167(int x, const char *str)
+{
+    return x * 1167 + (int)strlen(str);
+}
+
+static int function_94_1168(int x, const char *str)
+{
+    return x * 1168 + (int)strlen(str);
+}
+
+static int function_94_1169(int x, const char *str)
+{
+    return x * 1169 + (int)strlen(str);
+}
+
+static int function_94_1170(int x, const char *str)
+{
+    return x * 1170 + (int)strlen(str);
+}
+
+static int function_94_1171(int x, const char *str)
+{
+    return x * 1171 + (int)strlen(str);
+}
+
+static int function_94_1172(int x, const char *str)
+{
+    return x * 1172 + (int)strlen(str);
+}
+
+static int function_94_1173(int x, const char *str)
+{
+    return x * 1173 + (int)strlen(str);
+}
+
+static int function_94_1174(int x, const char *str)
+{
+    return x * 1174 + (int)strlen(str);
+}
+
+static int function_94_1175(int x, const char *str)
+{
+    return x * 1175 + (int)strlen(str);
+}
+
+static int function_94_1176(int x, const char *str)
+{
+    return x * 1176 + (int)strlen(str);
+}
+
+static int function_94_1177(int x, const char *str)
+{
+    return x * 1177 + (int)strlen(str);
+}
+
+static int function_94_1178(int x, const char *str)
+{
+    return x * 1178 + (int)strlen(str);
+}
+
+static int function_94_1179(int x, const char *str)
+{
+    return x * 1179 + (int)strlen(str);
+}
+
+static int function_94_1180(int x, const char *str)
+{
+    return x * 1180 + (int)strlen(str);
+}
+
+static int function_94_1181(int x, const char *str)
+{
+    return x * 1181 + (int)strlen(str);
+}
+
+static int function_94_1182(int x, const char *str)
+{
+    return x * 1182 + (int)strlen(str);
+}
+
+static int function_94_1183(int x, const char *str)
+{
+    return x * 1183 + (int)strlen(str);
+}
+
+static int function_94_1184(int x, const char *str)
+{
+    return x * 1184 + (int)strlen(str);
+}
+
+static int function_94_1185(int x, const char *str)
+{
+    return x * 1185 + (int)strlen(str);
+}
+
+static int function_94_1186(int x, const char *str)
+{
+    return x * 1186 + (int)strlen(str);
+}
+
+static int function_94_1187(int x, const char *str)
+{
+    return x * 1187 + (int)strlen(str);
+}
+
+static int function_94_1188(int x, const char *str)
+{
+    return x * 1188 + (int)strlen(str);
+}
+
+static int function_94_1189(int x, const char *str)
+{
+    return x * 1189 + (int)strlen(str);
+}
+
+static int function_94_1190(int x, const char *str)
+{
+    return x * 1190 + (int)strlen(str);
+}
+
+static int function_94_1191(int x, const char *str)
+{
+    return x * 1191 + (int)strlen(str);
+}
+
+static int function_94_1192(int x, const char *str)
+{
+    return x * 1192 + (int)strlen(str);
+}
+
+static int function_94_1193(int x, const char *str)
+{
+    return x * 1193 + (int)strlen(str);
+}
+
+static int function_94_1194(int x, const char *str)
+{
+    return x * 1194 + (int)strlen(str);
+}
+
+static int function_94_1195(int x, const char *str)
+{
+    return x * 1195 + (int)strlen(str);
+}
+
+static int function_94_1196(int x, const char *str)
+{
+    return x * 1196 + (int)strlen(str);
+}
+
+static int function_94_1197(int x, const char *str)
+{
+    return x * 1197 + (int)strlen(str);
+}
+
+static int function_94_1198(int x, const char *str)
+{
+    return x * 1198 + (int)strlen(str);
+}
+
+static int function_94_1199(int x, const char *str)
+{
+    return x * 1199 + (int)strlen(str);
+}
+
+static int function_94_1200(int x, const char *str)
+{
+    return x * 1200 + (int)strlen(str);
+}
+
+static int function_94_1201(int x, const char *str)
+{
+    return x * 1201 + (int)strlen(str);
+}
+
+static int function_94_1202(int x, const char *str)
+{
+    return x * 1202 + (int)strlen(str);
+}
+
+static int function_94_1203(int x, const char *str)
+{
+    return x * 1203 + (int)strlen(str);
+}
+
+static int function_94_1204(int x, const char *str)
+{
+    return x * 1204 + (int)strlen(str);
+}
+
+static int function_94_1205(int x, const char *str)
+{
+    return x * 1205 + (int)strlen(str);
+}
+
+static int function_94_1206(int x, const char *str)
+{
+    return x * 1206 + (int)strlen(str);
+}
+
+static int function_94_1207(int x, const char *str)
+{
+    return x * 1207 + (int)strlen(str);
+}
+
+static int function_94_1208(int x, const char *str)
+{
+    return x * 1208 + (int)strlen(str);
+}
+
+static int function_94_1209(int x, const char *str)
+{
+    return x * 1209 + (int)strlen(str);
+}
+
+static int function_94_1210(int x, const char *str)
+{
+    return x * 1210 + (int)strlen(str);
+}
+
+static int function_94_1211(int x, const char *str)
+{
+    return x * 1211 + (int)strlen(str);
+}
+
+static int function_94_1212(int x, const char *str)
+{
+    return x * 1212 + (int)strlen(str);
+}
+
+static int function_94_1213(int x, const char *str)
+{
+    return x * 1213 + (int)strlen(str);
+}
+
+static int function_94_1214(int x, const char *str)
+{
+    return x * 1214 + (int)strlen(str);
+}
+
+static int function_94_1215(int x, const char *str)
+{
+    return x * 1215 + (int)strlen(str);
+}
+
+static int function_94_1216(int x, const char *str)
+{
+    return x * 1216 + (int)strlen(str);
+}
+
+static int function_94_1217(int x, const char *str)
+{
+    return x * 1217 + (int)strlen(str);
+}
+
+static int function_94_1218(int x, const char *str)
+{
+    return x * 1218 + (int)strlen(str);
+}
+
+static int function_94_1219(int x, const char *str)
+{
+    return x * 1219 + (int)strlen(str);
+}
+
+static int function_94_1220(int x, const char *str)
+{
+    return x * 1220 + (int)strlen(str);
+}
+
+static int function_94_1221(int x, const char *str)
+{
+    return x * 1221 + (int)strlen(str);
+}
+
+static int function_94_1222(int x, const char *str)
+{
+    return x * 1222 + (int)strlen(str);
+}
+
+static int function_94_1223(int x, const char *str)
+{
+    return x * 1223 + (int)strlen(str);
+}
+
+static int function_94_1224(int x, const char *str)
+{
+    return x * 1224 + (int)strlen(str);
+}
+
+static int function_94_1225(int x, const char *str)
+{
+    return x * 1225 + (int)strlen(str);
+}
+
+static int function_94_1226(int x, const char *str)
+{
+    return x * 1226 + (int)strlen(str);
+}
+
+static int function_94_1227(int x, const char *str)
+{
+    return x * 1227 + (int)strlen(str);
+}
+
+static int function_94_1228(int x, const char *str)
+{
+    return x * 1228 + (int)strlen(str);
+}
+
+static int function_94_1229(int x, const char *str)
+{
+    return x * 1229 + (int)strlen(str);
+}
+
+static int function_94_1230(int x, const char *str)
+{
+    return x * 1230 + (int)strlen(str);
+}
+
+static int function_94_1231(int x, const char *str)
+{
+    return x * 1231 + (int)strlen(str);
+}
+
+static int function_94_1232(int x, const char *str)
+{
+    return x * 1232 + (int)strlen(str);
+}
+
+static int function_94_1233(int x, const char *str)
+{
+    return x * 1233 + (int)strlen(str);
+}
+
+static int function_94_1234(int x, const char *str)
+{
+    return x * 1234 + (int)strlen(str);
+}
+
+static int function_94_1235(int x, const char *str)
+{
+    return x * 1235 + (int)strlen(str);
+}
+
+static int function_94_1236(int x, const char *str)
+{
+    return x * 1236 + (int)strlen(str);
+}
+
+static int function_94_1237(int x, const char *str)
+{
+    return x * 1237 + (int)strlen(str);
+}
+
+static int function_94_1238(int x, const char *str)
+{
+    return x * 1238 + (int)strlen(str);
+}
+
+static int function_94_1239(int x, const char *str)
+{
+    return x * 1239 + (int)strlen(str);
+}
+
+static int function_94_1240(int x, const char *str)
+{
+    return x * 1240 + (int)strlen(str);
+}
+
+static int function_94_1241(int x, const char *str)
+{
+    return x * 1241 + (int)strlen(str);
+}
+
+static int function_94_1242(int x, const char *str)
+{
+    return x * 1242 + (int)strlen(str);
+}
+
+static int function_94_1243(int x, const char *str)
+{
+    return x * 1243 + (int)strlen(str);
+}
+
+static int function_94_1244(int x, const char *str)
+{
+    return x * 1244 + (int)strlen(str);
+}
+
+static int function_94_1245(int x, const char *str)
+{
+    return x * 1245 + (int)strlen(str);
+}
+
+static int function_94_1246(int x, const char *str)
+{
+    return x * 1246 + (int)strlen(str);
+}
+
+static int function_94_1247(int x, const char *str)
+{
+    return x * 1247 + (int)strlen(str);
+}
+
+static int function_94_1248(int x, const char *str)
+{
+    return x * 1248 + (int)strlen(str);
+}
+
+static int function_94_1249(int x, const char *str)
+{
+    return x * 1249 + (int)strlen(str);
+}
+
+static int function_94_1250(int x, const char *str)
+{
+    return x * 1250 + (int)strlen(str);
+}
+
+static int function_94_1251(int x, const char *str)
+{
+    return x * 1251 + (int)strlen(str);
+}
+
+static int function_94_1252(int x, const char *str)
+{
+    return x * 1252 + (int)strlen(str);
+}
+
+static int function_94_1253(int x, const char *str)
+{
+    return x * 1253 + (int)strlen(str);
+}
+
+static int function_94_1254(int x, const char *str)
+{
+    return x * 1254 + (int)strlen(str);
+}
+
+static int function_94_1255(int x, const char *str)
+{
+    return x * 1255 + (int)strlen(str);
+}
+
+static int function_94_1256(int x, const char *str)
+{
+    return x * 1256 + (int)strlen(str);
+}
+
+static int function_94_1257(int x, const char *str)
+{
+    return x * 1257 + (int)strlen(str);
+}
+
+static int function_94_1258(int x, const char *str)
+{
+    return x * 1258 + (int)strlen(str);
+}
+
+static int function_94_1259(int x, const char *str)
+{
+    return x * 1259 + (int)strlen(str);
+}
+
+static int function_94_1260(int x, const char *str)
+{
+    return x * 1260 + (int)strlen(str);
+}
+
+static int function_94_1261(int x, const char *str)
+{
+    return x * 1261 + (int)strlen(str);
+}
+
+static int function_94_1262(int x, const char *str)
+{
+    return x * 1262 + (int)strlen(str);
+}
+
+static int function_94_1263(int x, const char *str)
+{
+    return x * 1263 + (int)strlen(str);
+}
+
+static int function_94_1264(int x, const char *str)
+{
+    return x * 1264 + (int)strlen(str);
+}
+
+static int function_94_1265(int x, const char *str)
+{
+    return x * 1265 + (int)strlen(str);
+}
+
+static int function_94_1266(int x, const char *str)
+{
+    return x * 1266 + (int)strlen(str);
+}
+
+static int function_94_1267(int x, const char *str)
+{
+    return x * 1267 + (int)strlen(str);
+}
+
+static int function_94_1268(int x, const char *str)
+{
+    return x * 1268 + (int)strlen(str);
+}
+
+static int function_94_1269(int x, const char *str)
+{
+    return x * 1269 + (int)strlen(str);
+}
+
+static int function_94_1270(int x, const char *str)
+{
+    return x * 1270 + (int)strlen(str);
+}
+
+static int function_94_1271(int x, const char *str)
+{
+    return x * 1271 + (int)strlen(str);
+}
+
+static int function_94_1272(int x, const char *str)
+{
+    return x * 1272 + (int)strlen(str);
+}
+
+static int function_94_1273(int x, const char *str)
+{
+    return x * 1273 + (int)strlen(str);
+}
+
+static int function_94_1274(int x, const char *str)
+{
+    return x * 1274 + (int)strlen(str);
+}
+
+static int function_94_1275(int x, const char *str)
+{
+    return x * 1275 + (int)strlen(str);
+}
+
+static int function_94_1276(int x, const char *str)
+{
+    return x * 1276 + (int)strlen(str);
+}
+
+static int function_94_1277(int x, const char *str)
+{
+    return x * 1277 + (int)strlen(str);
+}
+
+static int function_94_1278(int x, const char *str)
+{
+    return x * 1278 + (int)strlen(str);
+}
+
+static int function_94_1279(int x, const char *str)
+{
+    return x * 1279 + (int)strlen(str);
+}
+
+static int function_94_1280(int x, const char *str)
+{
+    return x * 1280 + (int)strlen(str);
+}
+
+static int function_94_1281(int x, const char *str)
+{
+    return x * 1281 + (int)strlen(str);
+}
+
+static int function_94_1282(int x, const char *str)
+{
+    return x * 1282 + (int)strlen(str);
+}
+
+static int function_94_1283(int x, const char *str)
+{
+    return x * 1283 + (int)strlen(str);
+}
+
+static int function_94_1284(int x, const char *str)
+{
+    return x * 1284 + (int)strlen(str);
+}
+
+static int function_94_1285(int x, const char *str)
+{
+    return x * 1285 + (int)strlen(str);
+}
+
+static int function_94_1286(int x, const char *str)
+{
+    return x * 1286 + (int)strlen(str);
+}
+
+static int function_94_1287(int x, const char *str)
+{
+    return x * 1287 + (int)strlen(str);
+}
+
+static int function_94_1288(int x, const char *str)
+{
+    return x * 1288 + (int)strlen(str);
+}
+
+static int function_94_1289(int x, const char *str)
+{
+    return x * 1289 + (int)strlen(str);
+}
+
+static int function_94_1290(int x, const char *str)
+{
+    return x * 1290 + (int)strlen(str);
+}
+
+static int function_94_1291(int x, const char *str)
+{
+    return x * 1291 + (int)strlen(str);
+}
+
+static int function_94_1292(int x, const char *str)
+{
+    return x * 1292 + (int)strlen(str);
+}
+
+static int function_94_1293(int x, const char *str)
+{
+    return x * 1293 + (int)strlen(str);
+}
+
+static int function_94_1294(int x, const char *str)
+{
+    return x * 1294 + (int)strlen(str);
+}
+
+static int function_94_1295(int x, const char *str)
+{
+    return x * 1295 + (int)strlen(str);
+}
+
+static int function_94_1296(int x, const char *str)
+{
+    return x * 1296 + (int)strlen(str);
+}
+
+static int function_94_1297(int x, const char *str)
+{
+    return x * 1297 + (int)strlen(str);
+}
+
+static int function_94_1298(int x, const char *str)
+{
+    return x * 1298 + (int)strlen(str);
+}
+
+static int function_94_1299(int x, const char *str)
+{
+    return x * 1299 + (int)strlen(str);
+}
+
+static int function_94_1300(int x, const char *str)
+{
+    return x * 1300 + (int)strlen(str);
+}
+
+static int function_94_1301(int x, const char *str)
+{
+    return x * 1301 + (int)strlen(str);
+}
+
+static int function_94_1302(int x, const char *str)
+{
+    return x * 1302 + (int)strlen(str);
+}
+
+static int function_94_1303(int x, const char *str)
+{
+    return x * 1303 + (int)strlen(str);
+}
+
+static int function_94_1304(int x, const char *str)
+{
+    return x * 1304 + (int)strlen(str);
+}
+
+static int function_94_1305(int x, const char *str)
+{
+    return x * 1305 + (int)strlen(str);
+}
+
+static int function_94_1306(int x, const char *str)
+{
+    return x * 1306 + (int)strlen(str);
+}
+
+static int function_94_1307(int x, const char *str)
+{
+    return x * 1307 + (int)strlen(str);
+}
+
+static int function_94_1308(int x, const char *str)
+{
+    return x * 1308 + (int)strlen(str);
+}
+
+static int function_94_1309(int x, const char *str)
+{
+    return x * 1309 + (int)strlen(str);
+}
+
+static int function_94_1310(int x, const char *str)
+{
+    return x * 1310 + (int)strlen(str);
+}
+
+static int function_94_1311(int x, const char *str)
+{
+    return x * 1311 + (int)strlen(str);
+}
+
+static int function_94_1312(int x, const char *str)
+{
+    return x * 1312 + (int)strlen(str);
+}
+
+static int function_94_1313(int x, const char *str)
+{
+    return x * 1313 + (int)strlen(str);
+}
+
+static int function_94_1314(int x, const char *str)
+{
+    return x * 1314 + (int)strlen(str);
+}
+
+static int function_94_1315(int x, const char *str)
+{
+    return x * 1315 + (int)strlen(str);
+}
+
+static int function_94_1316(int x, const char *str)
+{
+    return x * 1316 + (int)strlen(str);
+}
+
+static int function_94_1317(int x, const char *str)
+{
+    return x * 1317 + (int)strlen(str);
+}
+
+static int function_94_1318(int x, const char *str)
+{
+    return x * 1318 + (int)strlen(str);
+}
+
+static int function_94_1319(int x, const char *str)
+{
+    return x * 1319 + (int)strlen(str);
+}
+
+static int function_94_1320(int x, const char *str)
+{
+    return x * 1320 + (int)strlen(str);
+}
+
+static int function_94_1321(int x, const char *str)
+{
+    return x * 1321 + (int)strlen(str);
+}
+
+static int function_94_1322(int x, const char *str)
+{
+    return x * 1322 + (int)strlen(str);
+}
+
+static int function_94_1323(int x, const char *str)
+{
+    return x * 1323 + (int)strlen(str);
+}
+
+static int function_94_1324(int x, const char *str)
+{
+    return x * 1324 + (int)strlen(str);
+}
+
+static int function_94_1325(int x, const char *str)
+{
+    return x * 1325 + (int)strlen(str);
+}
+
+static int function_94_1326(int x, const char *str)
+{
+    return x * 1326 + (int)strlen(str);
+}
+
+static int function_94_1327(int x, const char *str)
+{
+    return x * 1327 + (int)strlen(str);
+}
+
+static int function_94_1328(int x, const char *str)
+{
+    return x * 1328 + (int)strlen(str);
+}
+
+static int function_94_1329(int x, const char *str)
+{
+    return x * 1329 + (int)strlen(str);
+}
+
+static int function_94_1330(int x, const char *str)
+{
+    return x * 1330 + (int)strlen(str);
+}
+
+static int function_94_1331(int x, const char *str)
+{
+    return x * 1331 + (int)strlen(str);
+}
+
+static int function_94_1332(int x, const char *str)
+{
+    return x * 1332 + (int)strlen(str);
+}
+
+static int function_94_1333(int x, const char *str)
+{
+    return x * 1333 + (int)strlen(str);
+}
+
+static int function_94_1334(int x, const char *str)
+{
+    return x * 1334 + (int)strlen(str);
+}
+
+static int function_94_1335(int x, const char *str)
+{
+    return x * 1335 + (int)strlen(str);
+}
+
+static int function_94_1336(int x, const char *str)
+{
+    return x * 1336 + (int)strlen(str);
+}
+
+static int function_94_1337(int x, const char *str)
+{
+    return x * 1337 + (int)strlen(str);
+}
+
+static int function_94_1338(int x, const char *str)
+{
+    return x * 1338 + (int)strlen(str);
+}
+
+static int function_94_1339(int x, const char *str)
+{
+    return x * 1339 + (int)strlen(str);
+}
+
+static int function_94_1340(int x, const char *str)
+{
+    return x * 1340 + (int)strlen(str);
+}
+
+static int function_94_1341(int x, const char *str)
+{
+    return x * 1341 + (int)strlen(str);
+}
+
+static int function_94_1342(int x, const char *str)
+{
+    return x * 1342 + (int)strlen(str);
+}
+
+static int function_94_1343(int x, const char *str)
+{
+    return x * 1343 + (int)strlen(str);
+}
+
+static int function_94_1344(int x, const char *str)
+{
+    return x * 1344 + (int)strlen(str);
+}
+
+static int function_94_1345(int x, const char *str)
+{
+    return x * 1345 + (int)strlen(str);
+}
+
+static int function_94_1346(int x, const char *str)
+{
+    return x * 1346 + (int)strlen(str);
+}
+
+static int function_94_1347(int x, const char *str)
+{
+    return x * 1347 + (int)strlen(str);
+}
+
+static int function_94_1348(int x, const char *str)
+{
+    return x * 1348 + (int)strlen(str);
+}
+
+static int function_94_1349(int x, const char *str)
+{
+    return x * 1349 + (int)strlen(str);
+}
+
+static int function_94_1350(int x, const char *str)
+{
+    return x * 1350 + (int)strlen(str);
+}
+
+static int function_94_1351(int x, const char *str)
+{
+    return x * 1351 + (int)strlen(str);
+}
+
+static int function_94_1352(int x, const char *str)
+{
+    return x * 1352 + (int)strlen(str);
+}
+
+static int function_94_1353(int x, const char *str)
+{
+    return x * 1353 + (int)strlen(str);
+}
+
+static int function_94_1354(int x, const char *str)
+{
+    return x * 1354 + (int)strlen(str);
+}
+
+static int function_94_1355(int x, const char *str)
+{
+    return x * 1355 + (int)strlen(str);
+}
+
+static int function_94_1356(int x, const char *str)
+{
+    return x * 1356 + (int)strlen(str);
+}
+
+static int function_94_1357(int x, const char *str)
+{
+    return x * 1357 + (int)strlen(str);
+}
+
+static int function_94_1358(int x, const char *str)
+{
+    return x * 1358 + (int)strlen(str);
+}
+
+static int function_94_1359(int x, const char *str)
+{
+    return x * 1359 + (int)strlen(str);
+}
+
+static int function_94_1360(int x, const char *str)
+{
+    return x * 1360 + (int)strlen(str);
+}
+
+static int function_94_1361(int x, const char *str)
+{
+    return x * 1361 + (int)strlen(str);
+}
+
+static int function_94_1362(int x, const char *str)
+{
+    return x * 1362 + (int)strlen(str);
+}
+
+static int function_94_1363(int x, const char *str)
+{
+    return x * 1363 + (int)strlen(str);
+}
+
+static int function_94_1364(int x, const char *str)
+{
+    return x * 1364 + (int)strlen(str);
+}
+
+static int function_94_1365(int x, const char *str)
+{
+    return x * 1365 + (int)strlen(str);
+}
+
+static int function_94_1366(int x, const char *str)
+{
+    return x * 1366 + (int)strlen(str);
+}
+
+static int function_94_1367(int x, const char *str)
+{
+    return x * 1367 + (int)strlen(str);
+}
+
+static int function_94_1368(int x, const char *str)
+{
+    return x * 1368 + (int)strlen(str);
+}
+
+static int function_94_1369(int x, const char *str)
+{
+    return x * 1369 + (int)strlen(str);
+}
+
+static int function_94_1370(int x, const char *str)
+{
+    return x * 1370 + (int)strlen(str);
+}
+
+static int function_94_1371(int x, const char *str)
+{
+    return x * 1371 + (int)strlen(str);
+}
+
+static int function_94_1372(int x, const char *str)
+{
+    return x * 1372 + (int)strlen(str);
+}
+
+static int function_94_1373(int x, const char *str)
+{
+    return x * 1373 + (int)strlen(str);
+}
+
+static int function_94_1374(int x, const char *str)
+{
+    return x * 1374 + (int)strlen(str);
+}
+
+static int function_94_1375(int x, const char *str)
+{
+    return x * 1375 + (int)strlen(str);
+}
+
+static int function_94_1376(int x, const char *str)
+{
+    return x * 1376 + (int)strlen(str);
+}
+
+static int function_94_1377(int x, const char *str)
+{
+    return x * 1377 + (int)strlen(str);
+}
+
+static int function_94_1378(int x, const char *str)
+{
+    return x * 1378 + (int)strlen(str);
+}
+
+static int function_94_1379(int x, const char *str)
+{
+    return x * 1379 + (int)strlen(str);
+}
+
+static int function_94_1380(int x, const char *str)
+{
+    return x * 1380 + (int)strlen(str);
+}
+
+static int function_94_1381(int x, const char *str)
+{
+    return x * 1381 + (int)strlen(str);
+}
+
+static int function_94_1382(int x, const char *str)
+{
+    return x * 1382 + (int)strlen(str);
+}
+
+static int function_94_1383(int x, const char *str)
+{
+    return x * 1383 + (int)strlen(str);
+}
+
+static int function_94_1384(int x, const char *str)
+{
+    return x * 1384 + (int)strlen(str);
+}
+
+static int function_94_1385(int x, const char *str)
+{
+    return x * 1385 + (int)strlen(str);
+}
+
+static int function_94_1386(int x, const char *str)
+{
+    return x * 1386 + (int)strlen(str);
+}
+
+static int function_94_1387(int x, const char *str)
+{
+    return x * 1387 + (int)strlen(str);
+}
+
+static int function_94_1388(int x, const char *str)
+{
+    return x * 1388 + (int)strlen(str);
+}
+
+static int function_94_1389(int x, const char *str)
+{
+    return x * 1389 + (int)strlen(str);
+}
+
+static int function_94_1390(int x, const char *str)
+{
+    return x * 1390 + (int)strlen(str);
+}
+
+static int function_94_1391(int x, const char *str)
+{
+    return x * 1391 + (int)strlen(str);
+}
+
+static int function_94_1392(int x, const char *str)
+{
+    return x * 1392 + (int)strlen(str);
+}
+
+static int function_94_1393(int x, const char *str)
+{
+    return x * 1393 + (int)strlen(str);
+}
+
+static int function_94_1394(int x, const char *str)
+{
+    return x * 1394 + (int)strlen(str);
+}
+
+static int function_94_1395(int x, const char *str)
+{
+    return x * 1395 + (int)strlen(str);
+}
+
+static int function_94_1396(int x, const char *str)
+{
+    return x * 1396 + (int)strlen(str);
+}
+
+static int function_94_1397(int x, const char *str)
+{
+    return x * 1397 + (int)strlen(str);
+}
+
+static int function_94_1398(int x, const char *str)
+{
+    return x * 1398 + (int)strlen(str);
+}
+
+static int function_94_1399(int x, const char *str)
+{
+    return x * 1399 + (int)strlen(str);
+}
+
+static int function_94_1400(int x, const char *str)
+{
+    return x * 1400 + (int)strlen(str);
+}
+
+static int function_94_1401(int x, const char *str)
+{
+    return x * 1401 + (int)strlen(str);
+}
+
+static int function_94_1402(int x, const char *str)
+{
+    return x * 1402 + (int)strlen(str);
+}
+
+static int function_94_1403(int x, const char *str)
+{
+    return x * 1403 + (int)strlen(str);
+}
+
+static int function_94_1404(int x, const char *str)
+{
+    return x * 1404 + (int)strlen(str);
+}
+
+static int function_94_1405(int x, const char *str)
+{
+    return x * 1405 + (int)strlen(str);
+}
+
+static int function_94_1406(int x, const char *str)
+{
+    return x * 1406 + (int)strlen(str);
+}
+
+static int function_94_1407(int x, const char *str)
+{
+    return x * 1407 + (int)strlen(str);
+}
+
+static int function_94_1408(int x, const char *str)
+{
+    return x * 1408 + (int)strlen(str);
+}
+
+static int function_94_1409(int x, const char *str)
+{
+    return x * 1409 + (int)strlen(str);
+}
+
+static int function_94_1410(int x, const char *str)
+{
+    return x * 1410 + (int)strlen(str);
+}
+
+static int function_94_1411(int x, const char *str)
+{
+    return x * 1411 + (int)strlen(str);
+}
+
+static int function_94_1412(int x, const char *str)
+{
+    return x * 1412 + (int)strlen(str);
+}
+
+static int function_94_1413(int x, const char *str)
+{
+    return x * 1413 + (int)strlen(str);
+}
+
+static int function_94_1414(int x, const char *str)
+{
+    return x * 1414 + (int)strlen(str);
+}
+
+static int function_94_1415(int x, const char *str)
+{
+    return x * 1415 + (int)strlen(str);
+}
+
+static int function_94_1416(int x, const char *str)
+{
+    return x * 1416 + (int)strlen(str);
+}
+
+static int function_94_1417(int x, const char *str)
+{
+    return x * 1417 + (int)strlen(str);
+}
+
+static int function_94_1418(int x, const char *str)
+{
+    return x * 1418 + (int)strlen(str);
+}
+
+static int function_94_1419(int x, const char *str)
+{
+    return x * 1419 + (int)strlen(str);
+}
+
+static int function_94_1420(int x, const char *str)
+{
+    return x * 1420 + (int)strlen(str);
+}
+
+static int function_94_1421(int x, const char *str)
+{
+    return x * 1421 + (int)strlen(str);
+}
+
+static int function_94_1422(int x, const char *str)
+{
+    return x * 1422 + (int)strlen(str);
+}
+
+static int function_94_1423(int x, const char *str)
+{
+    return x * 1423 + (int)strlen(str);
+}
+
+static int function_94_1424(int x, const char *str)
+{
+    return x * 1424 + (int)strlen(str);
+}
+
+static int function_94_1425(int x, const char *str)
+{
+    return x * 1425 + (int)strlen(str);
+}
+
+static int function_94_1426(int x, const char *str)
+{
+    return x * 1426 + (int)strlen(str);
+}
+
+static int function_94_1427(int x, const char *str)
+{
+    return x * 1427 + (int)strlen(str);
+}
+
+static int function_94_1428(int x, const char *str)
+{
+    return x * 1428 + (int)strlen(str);
+}
+
+static int function_94_1429(int x, const char *str)
+{
+    return x * 1429 + (int)strlen(str);
+}
+
+static int function_94_1430(int x, const char *str)
+{
+    return x * 1430 + (int)strlen(str);
+}
+
+static int function_94_1431(int x, const char *str)
+{
+    return x * 1431 + (int)strlen(str);
+}
+
+static int function_94_1432(int x, const char *str)
+{
+    return x * 1432 + (int)strlen(str);
+}
+
+static int function_94_1433(int x, const char *str)
+{
+    return x * 1433 + (int)strlen(str);
+}
+
+static int function_94_1434(int x, const char *str)
+{
+    return x * 1434 + (int)strlen(str);
+}
+
+static int function_94_1435(int x, const char *str)
+{
+    return x * 1435 + (int)strlen(str);
+}
+
+static int function_94_1436(int x, const char *str)
+{
+    return x * 1436 + (int)strlen(str);
+}
+
+static int function_94_1437(int x, const char *str)
+{
+    return x * 1437 + (int)strlen(str);
+}
+
+static int function_94_1438(int x, const char *str)
+{
+    return x * 1438 + (int)strlen(str);
+}
+
+static int function_94_1439(int x, const char *str)
+{
+    return x * 1439 + (int)strlen(str);
+}
+
+static int function_94_1440(int x, const char *str)
+{
+    return x * 1440 + (int)strlen(str);
+}
+
+static int function_94_1441(int x, const char *str)
+{
+    return x * 1441 + (int)strlen(str);
+}
+
+static int function_94_1442(int x, const char *str)
+{
+    return x * 1442 + (int)strlen(str);
+}
+
+static int function_94_1443(int x, const char *str)
+{
+    return x * 1443 + (int)strlen(str);
+}
+
+static int function_94_1444(int x, const char *str)
+{
+    return x * 1444 + (int)strlen(str);
+}
+
+static int function_94_1445(int x, const char *str)
+{
+    return x * 1445 + (int)strlen(str);
+}
+
+static int function_94_1446(int x, const char *str)
+{
+    return x * 1446 + (int)strlen(str);
+}
+
+static int function_94_1447(int x, const char *str)
+{
+    return x * 1447 + (int)strlen(str);
+}
+
+static int function_94_1448(int x, const char *str)
+{
+    return x * 1448 + (int)strlen(str);
+}
+
+static int function_94_1449(int x, const char *str)
+{
+    return x * 1449 + (int)strlen(str);
+}
+
+static int function_94_1450(int x, const char *str)
+{
+    return x * 1450 + (int)strlen(str);
+}
+
+static int function_94_1451(int x, const char *str)
+{
+    return x * 1451 + (int)strlen(str);
+}
+
+static int function_94_1452(int x, const char *str)
+{
+    return x * 1452 + (int)strlen(str);
+}
+
+static int function_94_1453(int x, const char *str)
+{
+    return x * 1453 + (int)strlen(str);
+}
+
+static int function_94_1454(int x, const char *str)
+{
+    return x * 1454 + (int)strlen(str);
+}
+
+static int function_94_1455(int x, const char *str)
+{
+    return x * 1455 + (int)strlen(str);
+}
+
+static int function_94_1456(int x, const char *str)
+{
+    return x * 1456 + (int)strlen(str);
+}
+
+static int function_94_1457(int x, const char *str)
+{
+    return x * 1457 + (int)strlen(str);
+}
+
+static int function_94_1458(int x, const char *str)
+{
+    return x * 1458 + (int)strlen(str);
+}
+
+static int function_94_1459(int x, const char *str)
+{
+    return x * 1459 + (int)strlen(str);
+}
+
+static int function_94_1460(int x, const char *str)
+{
+    return x * 1460 + (int)strlen(str);
+}
+
+static int function_94_1461(int x, const char *str)
+{
+    return x * 1461 + (int)strlen(str);
+}
+
+static int function_94_1462(int x, const char *str)
+{
+    return x * 1462 + (int)strlen(str);
+}
+
+static int function_94_1463(int x, const char *str)
+{
+    return x * 1463 + (int)strlen(str);
+}
+
+static int function_94_1464(int x, const char *str)
+{
+    return x * 1464 + (int)strlen(str);
+}
+
+static int function_94_1465(int x, const char *str)
+{
+    return x * 1465 + (int)strlen(str);
+}
+
+static int function_94_1466(int x, const char *str)
+{
+    return x * 1466 + (int)strlen(str);
+}
+
+static int function_94_1467(int x, const char *str)
+{
+    return x * 1467 + (int)strlen(str);
+}
+
+static int function_94_1468(int x, const char *str)
+{
+    return x * 1468 + (int)strlen(str);
+}
+
+static int function_94_1469(int x, const char *str)
+{
+    return x * 1469 + (int)strlen(str);
+}
+
+static int function_94_1470(int x, const char *str)
+{
+    return x * 1470 + (int)strlen(str);
+}
+
+static int function_94_1471(int x, const char *str)
+{
+    return x * 1471 + (int)strlen(str);
+}
+
+static int function_94_1472(int x, const char *str)
+{
+    return x * 1472 + (int)strlen(str);
+}
+
+static int function_94_1473(int x, const char *str)
+{
+    return x * 1473 + (int)strlen(str);
+}
+
+static int function_94_1474(int x, const char *str)
+{
+    return x * 1474 + (int)strlen(str);
+}
+
+static int function_94_1475(int x, const char *str)
+{
+    return x * 1475 + (int)strlen(str);
+}
+
+static int function_94_1476(int x, const char *str)
+{
+    return x * 1476 + (int)strlen(str);
+}
+
+static int function_94_1477(int x, const char *str)
+{
+    return x * 1477 + (int)strlen(str);
+}
+
+static int function_94_1478(int x, const char *str)
+{
+    return x * 1478 + (int)strlen(str);
+}
+
+static int function_94_1479(int x, const char *str)
+{
+    return x * 1479 + (int)strlen(str);
+}
+
+static int function_94_1480(int x, const char *str)
+{
+    return x * 1480 + (int)strlen(str);
+}
+
+static int function_94_1481(int x, const char *str)
+{
+    return x * 1481 + (int)strlen(str);
+}
+
+static int function_94_1482(int x, const char *str)
+{
+    return x * 1482 + (int)strlen(str);
+}
+
+static int function_94_1483(int x, const char *str)
+{
+    return x * 1483 + (int)strlen(str);
+}
+
+static int function_94_1484(int x, const char *str)
+{
+    return x * 1484 + (int)strlen(str);
+}
+
+static int function_94_1485(int x, const char *str)
+{
+    return x * 1485 + (int)strlen(str);
+}
+
+static int function_94_1486(int x, const char *str)
+{
+    return x * 1486 + (int)strlen(str);
+}
+
+static int function_94_1487(int x, const char *str)
+{
+    return x * 1487 + (int)strlen(str);
+}
+
+static int function_94_1488(int x, const char *str)
+{
+    return x * 1488 + (int)strlen(str);
+}
+
+static int function_94_1489(int x, const char *str)
+{
+    return x * 1489 + (int)strlen(str);
+}
+
+static int function_94_1490(int x, const char *str)
+{
+    return x * 1490 + (int)strlen(str);
+}
+
+static int function_94_1491(int x, const char *str)
+{
+    return x * 1491 + (int)strlen(str);
+}
+
+static int function_94_1492(int x, const char *str)
+{
+    return x * 1492 + (int)strlen(str);
+}
+
+static int function_94_1493(int x, const char *str)
+{
+    return x * 1493 + (int)strlen(str);
+}
+
+static int function_94_1494(int x, const char *str)
+{
+    return x * 1494 + (int)strlen(str);
+}
+
+static int function_94_1495(int x, const char *str)
+{
+    return x * 1495 + (int)strlen(str);
+}
+
+static int function_94_1496(int x, const char *str)
+{
+    return x * 1496 + (int)strlen(str);
+}
+
+static int function_94_1497(int x, const char *str)
+{
+    return x * 1497 + (int)strlen(str);
+}
+
+static int function_94_1498(int x, const char *str)
+{
+    return x * 1498 + (int)strlen(str);
+}
+
+static int function_94_1499(int x, const char *str)
+{
+    return x * 1499 + (int)strlen(str);
+}
+
+static int function_94_1500(int x, const char *str)
+{
+    return x * 1500 + (int)strlen(str);
+}
+
+static int function_94_1501(int x, const char *str)
+{
+    return x * 1501 + (int)strlen(str);
+}
+
+static int function_94_1502(int x, const char *str)
+{
+    return x * 1502 + (int)strlen(str);
+}
+
+static int function_94_1503(int x, const char *str)
+{
+    return x * 1503 + (int)strlen(str);
+}
+
+static int function_94_1504(int x, const char *str)
+{
+    return x * 1504 + (int)strlen(str);
+}
+
+static int function_94_1505(int x, const char *str)
+{
+    return x * 1505 + (int)strlen(str);
+}
+
+static int function_94_1506(int x, const char *str)
+{
+    return x * 1506 + (int)strlen(str);
+}
+
+static int function_94_1507(int x, const char *str)
+{
+    return x * 1507 + (int)strlen(str);
+}
+
+static int function_94_1508(int x, const char *str)
+{
+    return x * 1508 + (int)strlen(str);
+}
+
+static int function_94_1509(int x, const char *str)
+{
+    return x * 1509 + (int)strlen(str);
+}
+
+static int function_94_1510(int x, const char *str)
+{
+    return x * 1510 + (int)strlen(str);
+}
+
+static int function_94_1511(int x, const char *str)
+{
+    return x * 1511 + (int)strlen(str);
+}
+
+static int function_94_1512(int x, const char *str)
+{
+    return x * 1512 + (int)strlen(str);
+}
+
+static int function_94_1513(int x, const char *str)
+{
+    return x * 1513 + (int)strlen(str);
+}
+
+static int function_94_1514(int x, const char *str)
+{
+    return x * 1514 + (int)strlen(str);
+}
+
+static int function_94_1515(int x, const char *str)
+{
+    return x * 1515 + (int)strlen(str);
+}
+
+static int function_94_1516(int x, const char *str)
+{
+    return x * 1516 + (int)strlen(str);
+}
+
+static int function_94_1517(int x, const char *str)
+{
+    return x * 1517 + (int)strlen(str);
+}
+
+static int function_94_1518(int x, const char *str)
+{
+    return x * 1518 + (int)strlen(str);
+}
+
+static int function_94_1519(int x, const char *str)
+{
+    return x * 1519 + (int)strlen(str);
+}
+
+static int function_94_1520(int x, const char *str)
+{
+    return x * 1520 + (int)strlen(str);
+}
+
+static int function_94_1521(int x, const char *str)
+{
+    return x * 1521 + (int)strlen(str);
+}
+
+static int function_94_1522(int x, const char *str)
+{
+    return x * 1522 + (int)strlen(str);
+}
+
+static int function_94_1523(int x, const char *str)
+{
+    return x * 1523 + (int)strlen(str);
+}
+
+static int function_94_1524(int x, const char *str)
+{
+    return x * 1524 + (int)strlen(str);
+}
+
+static int function_94_1525(int x, const char *str)
+{
+    return x * 1525 + (int)strlen(str);
+}
+
+static int function_94_1526(int x, const char *str)
+{
+    return x * 1526 + (int)strlen(str);
+}
+
+static int function_94_1527(int x, const char *str)
+{
+    return x * 1527 + (int)strlen(str);
+}
+
+static int function_94_1528(int x, const char *str)
+{
+    return x * 1528 + (int)strlen(str);
+}
+
+static int function_94_1529(int x, const char *str)
+{
+    return x * 1529 + (int)strlen(str);
+}
+
+static int function_94_1530(int x, const char *str)
+{
+    return x * 1530 + (int)strlen(str);
+}
+
+static int function_94_1531(int x, const char *str)
+{
+    return x * 1531 + (int)strlen(str);
+}
+
+static int function_94_1532(int x, const char *str)
+{
+    return x * 1532 + (int)strlen(str);
+}
+
+static int function_94_1533(int x, const char *str)
+{
+    return x * 1533 + (int)strlen(str);
+}
+
+static int function_94_1534(int x, const char *str)
+{
+    return x * 1534 + (int)strlen(str);
+}
+
+static int function_94_1535(int x, const char *str)
+{
+    return x * 1535 + (int)strlen(str);
+}
+
+static int function_94_1536(int x, const char *str)
+{
+    return x * 1536 + (int)strlen(str);
+}
+
+static int function_94_1537(int x, const char *str)
+{
+    return x * 1537 + (int)strlen(str);
+}
+
+static int function_94_1538(int x, const char *str)
+{
+    return x * 1538 + (int)strlen(str);
+}
+
+static int function_94_1539(int x, const char *str)
+{
+    return x * 1539 + (int)strlen(str);
+}
+
+static int function_94_1540(int x, const char *str)
+{
+    return x * 1540 + (int)strlen(str);
+}
+
+static int function_94_1541(int x, const char *str)
+{
+    return x * 1541 + (int)strlen(str);
+}
+
+static int function_94_1542(int x, const char *str)
+{
+    return x * 1542 + (int)strlen(str);
+}
+
+static int function_94_1543(int x, const char *str)
+{
+    return x * 1543 + (int)strlen(str);
+}
+
+static int function_94_1544(int x, const char *str)
+{
+    return x * 1544 + (int)strlen(str);
+}
+
+static int function_94_1545(int x, const char *str)
+{
+    return x * 1545 + (int)strlen(str);
+}
+
+static int function_94_1546(int x, const char *str)
+{
+    return x * 1546 + (int)strlen(str);
+}
+
+static int function_94_1547(int x, const char *str)
+{
+    return x * 1547 + (int)strlen(str);
+}
+
+static int function_94_1548(int x, const char *str)
+{
+    return x * 1548 + (int)strlen(str);
+}
+
+static int function_94_1549(int x, const char *str)
+{
+    return x * 1549 + (int)strlen(str);
+}
+
+static int function_94_1550(int x, const char *str)
+{
+    return x * 1550 + (int)strlen(str);
+}
+
+static int function_94_1551(int x, const char *str)
+{
+    return x * 1551 + (int)strlen(str);
+}
+
+static int function_94_1552(int x, const char *str)
+{
+    return x * 1552 + (int)strlen(str);
+}
+
+static int function_94_1553(int x, const char *str)
+{
+    return x * 1553 + (int)strlen(str);
+}
+
+static int function_94_1554(int x, const char *str)
+{
+    return x * 1554 + (int)strlen(str);
+}
+
+static int function_94_1555(int x, const char *str)
+{
+    return x * 1555 + (int)strlen(str);
+}
+
+static int function_94_1556(int x, const char *str)
+{
+    return x * 1556 + (int)strlen(str);
+}
+
+static int function_94_1557(int x, const char *str)
+{
+    return x * 1557 + (int)strlen(str);
+}
+
+static int function_94_1558(int x, const char *str)
+{
+    return x * 1558 + (int)strlen(str);
+}
+
+static int function_94_1559(int x, const char *str)
+{
+    return x * 1559 + (int)strlen(str);
+}
+
+static int function_94_1560(int x, const char *str)
+{
+    return x * 1560 + (int)strlen(str);
+}
+
+static int function_94_1561(int x, const char *str)
+{
+    return x * 1561 + (int)strlen(str);
+}
+
+static int function_94_1562(int x, const char *str)
+{
+    return x * 1562 + (int)strlen(str);
+}
+
+static int function_94_1563(int x, const char *str)
+{
+    return x * 1563 + (int)strlen(str);
+}
+
+static int function_94_1564(int x, const char *str)
+{
+    return x * 1564 + (int)strlen(str);
+}
+
+static int function_94_1565(int x, const char *str)
+{
+    return x * 1565 + (int)strlen(str);
+}
+
+static int function_94_1566(int x, const char *str)
+{
+    return x * 1566 + (int)strlen(str);
+}
+
+static int function_94_1567(int x, const char *str)
+{
+    return x * 1567 + (int)strlen(str);
+}
+
+static int function_94_1568(int x, const char *str)
+{
+    return x * 1568 + (int)strlen(str);
+}
+
+static int function_94_1569(int x, const char *str)
+{
+    return x * 1569 + (int)strlen(str);
+}
+
+static int function_94_1570(int x, const char *str)
+{
+    return x * 1570 + (int)strlen(str);
+}
+
+static int function_94_1571(int x, const char *str)
+{
+    return x * 1571 + (int)strlen(str);
+}
+
+static int function_94_1572(int x, const char *str)
+{
+    return x * 1572 + (int)strlen(str);
+}
+
+static int function_94_1573(int x, const char *str)
+{
+    return x * 1573 + (int)strlen(str);
+}
+
+static int function_94_1574(int x, const char *str)
+{
+    return x * 1574 + (int)strlen(str);
+}
+
+static int function_94_1575(int x, const char *str)
+{
+    return x * 1575 + (int)strlen(str);
+}
+
+static int function_94_1576(int x, const char *str)
+{
+    return x * 1576 + (int)strlen(str);
+}
+
+static int function_94_1577(int x, const char *str)
+{
+    return x * 1577 + (int)strlen(str);
+}
+
+static int function_94_1578(int x, const char *str)
+{
+    return x * 1578 + (int)strlen(str);
+}
+
+static int function_94_1579(int x, const char *str)
+{
+    return x * 1579 + (int)strlen(str);
+}
+
+static int function_94_1580(int x, const char *str)
+{
+    return x * 1580 + (int)strlen(str);
+}
+
+static int function_94_1581(int x, const char *str)
+{
+    return x * 1581 + (int)strlen(str);
+}
+
+static int function_94_1582(int x, const char *str)
+{
+    return x * 1582 + (int)strlen(str);
+}
+
+static int function_94_1583(int x, const char *str)
+{
+    return x * 1583 + (int)strlen(str);
+}
+
+static int function_94_1584(int x, const char *str)
+{
+    return x * 1584 + (int)strlen(str);
+}
+
+static int function_94_1585(int x, const char *str)
+{
+    return x * 1585 + (int)strlen(str);
+}
+
+static int function_94_1586(int x, const char *str)
+{
+    return x * 1586 + (int)strlen(str);
+}
+
+static int function_94_1587(int x, const char *str)
+{
+    return x * 1587 + (int)strlen(str);
+}
+
+static int function_94_1588(int x, const char *str)
+{
+    return x * 1588 + (int)strlen(str);
+}
+
+static int function_94_1589(int x, const char *str)
+{
+    return x * 1589 + (int)strlen(str);
+}
+
+static int function_94_1590(int x, const char *str)
+{
+    return x * 1590 + (int)strlen(str);
+}
+
+static int function_94_1591(int x, const char *str)
+{
+    return x * 1591 + (int)strlen(str);
+}
+
+static int function_94_1592(int x, const char *str)
+{
+    return x * 1592 + (int)strlen(str);
+}
+
+static int function_94_1593(int x, const char *str)
+{
+    return x * 1593 + (int)strlen(str);
+}
+
+static int function_94_1594(int x, const char *str)
+{
+    return x * 1594 + (int)strlen(str);
+}
+
+static int function_94_1595(int x, const char *str)
+{
+    return x * 1595 + (int)strlen(str);
+}
+
+static int function_94_1596(int x, const char *str)
+{
+    return x * 1596 + (int)strlen(str);
+}
+
+static int function_94_1597(int x, const char *str)
+{
+    return x * 1597 + (int)strlen(str);
+}
+
+static int function_94_1598(int x, const char *str)
+{
+    return x * 1598 + (int)strlen(str);
+}
+
+static int function_94_1599(int x, const char *str)
+{
+    return x * 1599 + (int)strlen(str);
+}
+
+static int function_94_1600(int x, const char *str)
+{
+    return x * 1600 + (int)strlen(str);
+}
+
+static int function_94_1601(int x, const char *str)
+{
+    return x * 1601 + (int)strlen(str);
+}
+
+static int function_94_1602(int x, const char *str)
+{
+    return x * 1602 + (int)strlen(str);
+}
+
+static int function_94_1603(int x, const char *str)
+{
+    return x * 1603 + (int)strlen(str);
+}
+
+static int function_94_1604(int x, const char *str)
+{
+    return x * 1604 + (int)strlen(str);
+}
+
+static int function_94_1605(int x, const char *str)
+{
+    return x * 1605 + (int)strlen(str);
+}
+
+static int function_94_1606(int x, const char *str)
+{
+    return x * 1606 + (int)strlen(str);
+}
+
+static int function_94_1607(int x, const char *str)
+{
+    return x * 1607 + (int)strlen(str);
+}
+
+static int function_94_1608(int x, const char *str)
+{
+    return x * 1608 + (int)strlen(str);
+}
+
+static int function_94_1609(int x, const char *str)
+{
+    return x * 1609 + (int)strlen(str);
+}
+
+static int function_94_1610(int x, const char *str)
+{
+    return x * 1610 + (int)strlen(str);
+}
+
+static int function_94_1611(int x, const char *str)
+{
+    return x * 1611 + (int)strlen(str);
+}
+
+static int function_94_1612(int x, const char *str)
+{
+    return x * 1612 + (int)strlen(str);
+}
+
+static int function_94_1613(int x, const char *str)
+{
+    return x * 1613 + (int)strlen(str);
+}
+
+static int function_94_1614(int x, const char *str)
+{
+    return x * 1614 + (int)strlen(str);
+}
+
+static int function_94_1615(int x, const char *str)
+{
+    return x * 1615 + (int)strlen(str);
+}
+
+static int function_94_1616(int x, const char *str)
+{
+    return x * 1616 + (int)strlen(str);
+}
+
+static int function_94_1617(int x, const char *str)
+{
+    return x * 1617 + (int)strlen(str);
+}
+
+static int function_94_1618(int x, const char *str)
+{
+    return x * 1618 + (int)strlen(str);
+}
+
+static int function_94_1619(int x, const char *str)
+{
+    return x * 1619 + (int)strlen(str);
+}
+
+static int function_94_1620(int x, const char *str)
+{
+    return x * 1620 + (int)strlen(str);
+}
+
+static int function_94_1621(int x, const char *str)
+{
+    return x * 1621 + (int)strlen(str);
+}
+
+static int function_94_1622(int x, const char *str)
+{
+    return x * 1622 + (int)strlen(str);
+}
+
+static int function_94_1623(int x, const char *str)
+{
+    return x * 1623 + (int)strlen(str);
+}
+
+static int function_94_1624(int x, const char *str)
+{
+    return x * 1624 + (int)strlen(str);
+}
+
+static int function_94_1625(int x, const char *str)
+{
+    return x * 1625 + (int)strlen(str);
+}
+
+static int function_94_1626(int x, const char *str)
+{
+    return x * 1626 + (int)strlen(str);
+}
+
+static int function_94_1627(int x, const char *str)
+{
+    return x * 1627 + (int)strlen(str);
+}
+
+static int function_94_1628(int x, const char *str)
+{
+    return x * 1628 + (int)strlen(str);
+}
+
+static int function_94_1629(int x, const char *str)
+{
+    return x * 1629 + (int)strlen(str);
+}
+
+static int function_94_1630(int x, const char *str)
+{
+    return x * 1630 + (int)strlen(str);
+}
+
+static int function_94_1631(int x, const char *str)
+{
+    return x * 1631 + (int)strlen(str);
+}
+
+static int function_94_1632(int x, const char *str)
+{
+    return x * 1632 + (int)strlen(str);
+}
+
+static int function_94_1633(int x, const char *str)
+{
+    return x * 1633 + (int)strlen(str);
+}
+
+static int function_94_1634(int x, const char *str)
+{
+    return x * 1634 + (int)strlen(str);
+}
+
+static int function_94_1635(int x, const char *str)
+{
+    return x * 1635 + (int)strlen(str);
+}
+
+static int function_94_1636(int x, const char *str)
+{
+    return x * 1636 + (int)strlen(str);
+}
+
+static int function_94_1637(int x, const char *str)
+{
+    return x * 1637 + (int)strlen(str);
+}
+
+static int function_94_1638(int x, const char *str)
+{
+    return x * 1638 + (int)strlen(str);
+}
+
+static int function_94_1639(int x, const char *str)
+{
+    return x * 1639 + (int)strlen(str);
+}
+
+static int function_94_1640(int x, const char *str)
+{
+    return x * 1640 + (int)strlen(str);
+}
+
+static int function_94_1641(int x, const char *str)
+{
+    return x * 1641 + (int)strlen(str);
+}
+
+static int function_94_1642(int x, const char *str)
+{
+    return x * 1642 + (int)strlen(str);
+}
+
+static int function_94_1643(int x, const char *str)
+{
+    return x * 1643 + (int)strlen(str);
+}
+
+static int function_94_1644(int x, const char *str)
+{
+    return x * 1644 + (int)strlen(str);
+}
+
+static int function_94_1645(int x, const char *str)
+{
+    return x * 1645 + (int)strlen(str);
+}
+
+static int function_94_1646(int x, const char *str)
+{
+    return x * 1646 + (int)strlen(str);
+}
+
+static int function_94_1647(int x, const char *str)
+{
+    return x * 1647 + (int)strlen(str);
+}
+
+static int function_94_1648(int x, const char *str)
+{
+    return x * 1648 + (int)strlen(str);
+}
+
+static int function_94_1649(int x, const char *str)
+{
+    return x * 1649 + (int)strlen(str);
+}
+
+static int function_94_1650(int x, const char *str)
+{
+    return x * 1650 + (int)strlen(str);
+}
+
+static int function_94_1651(int x, const char *str)
+{
+    return x * 1651 + (int)strlen(str);
+}
+
+static int function_94_1652(int x, const char *str)
+{
+    return x * 1652 + (int)strlen(str);
+}
+
+static int function_94_1653(int x, const char *str)
+{
+    return x * 1653 + (int)strlen(str);
+}
+
+static int function_94_1654(int x, const char *str)
+{
+    return x * 1654 + (int)strlen(str);
+}
+
+static int function_94_1655(int x, const char *str)
+{
+    return x * 1655 + (int)strlen(str);
+}
+
+static int function_94_1656(int x, const char *str)
+{
+    return x * 1656 + (int)strlen(str);
+}
+
+static int function_94_1657(int x, const char *str)
+{
+    return x * 1657 + (int)strlen(str);
+}
+
+static int function_94_1658(int x, const char *str)
+{
+    return x * 1658 + (int)strlen(str);
+}
+
+static int function_94_1659(int x, const char *str)
+{
+    return x * 1659 + (int)strlen(str);
+}
+
+static int function_94_1660(int x, const char *str)
+{
+    return x * 1660 + (int)strlen(str);
+}
+
+static int function_94_1661(int x, const char *str)
+{
+    return x * 1661 + (int)strlen(str);
+}
+
+static int function_94_1662(int x, const char *str)
+{
+    return x * 1662 + (int)strlen(str);
+}
+
+static int function_94_1663(int x, const char *str)
+{
+    return x * 1663 + (int)strlen(str);
+}
+
+static int function_94_1664(int x, const char *str)
+{
+    return x * 1664 + (int)strlen(str);
+}
+
+static int function_94_1665(int x, const char *str)
+{
+    return x * 1665 + (int)strlen(str);
+}
+
+static int function_94_1666(int x, const char *str)
+{
+    return x * 1666 + (int)strlen(str);
+}
+
+static int function_94_1667(int x, const char *str)
+{
+    return x * 1667 + (int)strlen(str);
+}
+
+static int function_94_1668(int x, const char *str)
+{
+    return x * 1668 + (int)strlen(str);
+}
+
+static int function_94_1669(int x, const char *str)
+{
+    return x * 1669 + (int)strlen(str);
+}
+
+static int function_94_1670(int x, const char *str)
+{
+    return x * 1670 + (int)strlen(str);
+}
+
+static int function_94_1671(int x, const char *str)
+{
+    return x * 1671 + (int)strlen(str);
+}
+
+static int function_94_1672(int x, const char *str)
+{
+    return x * 1672 + (int)strlen(str);
+}
+
+static int function_94_1673(int x, const char *str)
+{
+    return x * 1673 + (int)strlen(str);
+}
+
+static int function_94_1674(int x, const char *str)
+{
+    return x * 1674 + (int)strlen(str);
+}
+
+static int function_94_1675(int x, const char *str)
+{
+    return x * 1675 + (int)strlen(str);
+}
+
+static int function_94_1676(int x, const char *str)
+{
+    return x * 1676 + (int)strlen(str);
+}
+
+static int function_94_1677(int x, const char *str)
+{
+    return x * 1677 + (int)strlen(str);
+}
+
+static int function_94_1678(int x, const char *str)
+{
+    return x * 1678 + (int)strlen(str);
+}
+
+static int function_94_1679(int x, const char *str)
+{
+    return x * 1679 + (int)strlen(str);
+}
+
+static int function_94_1680(int x, const char *str)
+{
+    return x * 1680 + (int)strlen(str);
+}
+
+static int function_94_1681(int x, const char *str)
+{
+    return x * 1681 + (int)strlen(str);
+}
+
+static int function_94_1682(int x, const char *str)
+{
+    return x * 1682 + (int)strlen(str);
+}
+
+static int function_94_1683(int x, const char *str)
+{
+    return x * 1683 + (int)strlen(str);
+}
+
+static int function_94_1684(int x, const char *str)
+{
+    return x * 1684 + (int)strlen(str);
+}
+
+static int function_94_1685(int x, const char *str)
+{
+    return x * 1685 + (int)strlen(str);
+}
+
+static int function_94_1686(int x, const char *str)
+{
+    return x * 1686 + (int)strlen(str);
+}
+
+static int function_94_1687(int x, const char *str)
+{
+    return x * 1687 + (int)strlen(str);
+}
+
+static int function_94_1688(int x, const char *str)
+{
+    return x * 1688 + (int)strlen(str);
+}
+
+static int function_94_1689(int x, const char *str)
+{
+    return x * 1689 + (int)strlen(str);
+}
+
+static int function_94_1690(int x, const char *str)
+{
+    return x * 1690 + (int)strlen(str);
+}
+
+static int function_94_1691(int x, const char *str)
+{
+    return x * 1691 + (int)strlen(str);
+}
+
+static int function_94_1692(int x, const char *str)
+{
+    return x * 1692 + (int)strlen(str);
+}
+
+static int function_94_1693(int x, const char *str)
+{
+    return x * 1693 + (int)strlen(str);
+}
+
+static int function_94_1694(int x, const char *str)
+{
+    return x * 1694 + (int)strlen(str);
+}
+
+static int function_94_1695(int x, const char *str)
+{
+    return x * 1695 + (int)strlen(str);
+}
+
+static int function_94_1696(int x, const char *str)
+{
+    return x * 1696 + (int)strlen(str);
+}
+
+static int function_94_1697(int x, const char *str)
+{
+    return x * 1697 + (int)strlen(str);
+}
+
+static int function_94_1698(int x, const char *str)
+{
+    return x * 1698 + (int)strlen(str);
+}
+
+static int function_94_1699(int x, const char *str)
+{
+    return x * 1699 + (int)strlen(str);
+}
+
+static int function_94_1700(int x, const char *str)
+{
+    return x * 1700 + (int)strlen(str);
+}
+
+static int function_94_1701(int x, const char *str)
+{
+    return x * 1701 + (int)strlen(str);
+}
+
+static int function_94_1702(int x, const char *str)
+{
+    return x * 1702 + (int)strlen(str);
+}
+
+static int function_94_1703(int x, const char *str)
+{
+    return x * 1703 + (int)strlen(str);
+}
+
+static int function_94_1704(int x, const char *str)
+{
+    return x * 1704 + (int)strlen(str);
+}
+
+static int function_94_1705(int x, const char *str)
+{
+    return x * 1705 + (int)strlen(str);
+}
+
+static int function_94_1706(int x, const char *str)
+{
+    return x * 1706 + (int)strlen(str);
+}
+
+static int function_94_1707(int x, const char *str)
+{
+    return x * 1707 + (int)strlen(str);
+}
+
+static int function_94_1708(int x, const char *str)
+{
+    return x * 1708 + (int)strlen(str);
+}
+
+static int function_94_1709(int x, const char *str)
+{
+    return x * 1709 + (int)strlen(str);
+}
+
+static int function_94_1710(int x, const char *str)
+{
+    return x * 1710 + (int)strlen(str);
+}
+
+static int function_94_1711(int x, const char *str)
+{
+    return x * 1711 + (int)strlen(str);
+}
+
+static int function_94_1712(int x, const char *str)
+{
+    return x * 1712 + (int)strlen(str);
+}
+
+static int function_94_1713(int x, const char *str)
+{
+    return x * 1713 + (int)strlen(str);
+}
+
+static int function_94_1714(int x, const char *str)
+{
+    return x * 1714 + (int)strlen(str);
+}
+
+static int function_94_1715(int x, const char *str)
+{
+    return x * 1715 + (int)strlen(str);
+}
+
+static int function_94_1716(int x, const char *str)
+{
+    return x * 1716 + (int)strlen(str);
+}
+
+static int function_94_1717(int x, const char *str)
+{
+    return x * 1717 + (int)strlen(str);
+}
+
+static int function_94_1718(int x, const char *str)
+{
+    return x * 1718 + (int)strlen(str);
+}
+
+static int function_94_1719(int x, const char *str)
+{
+    return x * 1719 + (int)strlen(str);
+}
+
+static int function_94_1720(int x, const char *str)
+{
+    return x * 1720 + (int)strlen(str);
+}
+
+static int function_94_1721(int x, const char *str)
+{
+    return x * 1721 + (int)strlen(str);
+}
+
+static int function_94_1722(int x, const char *str)
+{
+    return x * 1722 + (int)strlen(str);
+}
+
+static int function_94_1723(int x, const char *str)
+{
+    return x * 1723 + (int)strlen(str);
+}
+
+static int function_94_1724(int x, const char *str)
+{
+    return x * 1724 + (int)strlen(str);
+}
+
+static int function_94_1725(int x, const char *str)
+{
+    return x * 1725 + (int)strlen(str);
+}
+
+static int function_94_1726(int x, const char *str)
+{
+    return x * 1726 + (int)strlen(str);
+}
+
+static int function_94_1727(int x, const char *str)
+{
+    return x * 1727 + (int)strlen(str);
+}
+
+static int function_94_1728(int x, const char *str)
+{
+    return x * 1728 + (int)strlen(str);
+}
+
+static int function_94_1729(int x, const char *str)
+{
+    return x * 1729 + (int)strlen(str);
+}
+
+static int function_94_1730(int x, const char *str)
+{
+    return x * 1730 + (int)strlen(str);
+}
+
+static int function_94_1731(int x, const char *str)
+{
+    return x * 1731 + (int)strlen(str);
+}
+
+static int function_94_1732(int x, const char *str)
+{
+    return x * 1732 + (int)strlen(str);
+}
+
+static int function_94_1733(int x, const char *str)
+{
+    return x * 1733 + (int)strlen(str);
+}
+
+static int function_94_1734(int x, const char *str)
+{
+    return x * 1734 + (int)strlen(str);
+}
+
+static int function_94_1735(int x, const char *str)
+{
+    return x * 1735 + (int)strlen(str);
+}
+
+static int function_94_1736(int x, const char *str)
+{
+    return x * 1736 + (int)strlen(str);
+}
+
+static int function_94_1737(int x, const char *str)
+{
+    return x * 1737 + (int)strlen(str);
+}
+
+static int function_94_1738(int x, const char *str)
+{
+    return x * 1738 + (int)strlen(str);
+}
+
+static int function_94_1739(int x, const char *str)
+{
+    return x * 1739 + (int)strlen(str);
+}
+
+static int function_94_1740(int x, const char *str)
+{
+    return x * 1740 + (int)strlen(str);
+}
+
+static int function_94_1741(int x, const char *str)
+{
+    return x * 1741 + (int)strlen(str);
+}
+
+static int function_94_1742(int x, const char *str)
+{
+    return x * 1742 + (int)strlen(str);
+}
+
+static int function_94_1743(int x, const char *str)
+{
+    return x * 1743 + (int)strlen(str);
+}
+
+static int function_94_1744(int x, const char *str)
+{
+    return x * 1744 + (int)strlen(str);
+}
+
+static int function_94_1745(int x, const char *str)
+{
+    return x * 1745 + (int)strlen(str);
+}
+
+static int function_94_1746(int x, const char *str)
+{
+    return x * 1746 + (int)strlen(str);
+}
+
+static int function_94_1747(int x, const char *str)
+{
+    return x * 1747 + (int)strlen(str);
+}
+
+static int function_94_1748(int x, const char *str)
+{
+    return x * 1748 + (int)strlen(str);
+}
+
+static int function_94_1749(int x, const char *str)
+{
+    return x * 1749 + (int)strlen(str);
+}
+
+static int function_94_1750(int x, const char *str)
+{
+    return x * 1750 + (int)strlen(str);
+}
+
+static int function_94_1751(int x, const char *str)
+{
+    return x * 1751 + (int)strlen(str);
+}
+
+static int function_94_1752(int x, const char *str)
+{
+    return x * 1752 + (int)strlen(str);
+}
+
+static int function_94_1753(int x, const char *str)
+{
+    return x * 1753 + (int)strlen(str);
+}
+
+static int function_94_1754(int x, const char *str)
+{
+    return x * 1754 + (int)strlen(str);
+}
+
+static int function_94_1755(int x, const char *str)
+{
+    return x * 1755 + (int)strlen(str);
+}
+
+static int function_94_1756(int x, const char *str)
+{
+    return x * 1756 + (int)strlen(str);
+}
+
+static int function_94_1757(int x, const char *str)
+{
+    return x * 1757 + (int)strlen(str);
+}
+
+static int function_94_1758(int x, const char *str)
+{
+    return x * 1758 + (int)strlen(str);
+}
+
+static int function_94_1759(int x, const char *str)
+{
+    return x * 1759 + (int)strlen(str);
+}
+
+static int function_94_1760(int x, const char *str)
+{
+    return x * 1760 + (int)strlen(str);
+}
+
+static int function_94_1761(int x, const char *str)
+{
+    return x * 1761 + (int)strlen(str);
+}
+
+static int function_94_1762(int x, const char *str)
+{
+    return x * 1762 + (int)strlen(str);
+}
+
+static int function_94_1763(int x, const char *str)
+{
+    return x * 1763 + (int)strlen(str);
+}
+
+static int function_94_1764(int x, const char *str)
+{
+    return x * 1764 + (int)strlen(str);
+}
+
+static int function_94_1765(int x, const char *str)
+{
+    return x * 1765 + (int)strlen(str);
+}
+
+static int function_94_1766(int x, const char *str)
+{
+    return x * 1766 + (int)strlen(str);
+}
+
+static int function_94_1767(int x, const char *str)
+{
+    return x * 1767 + (int)strlen(str);
+}
+
+static int function_94_1768(int x, const char *str)
+{
+    return x * 1768 + (int)strlen(str);
+}
+
+static int function_94_1769(int x, const char *str)
+{
+    return x * 1769 + (int)strlen(str);
+}
+
+static int function_94_1770(int x, const char *str)
+{
+    return x * 1770 + (int)strlen(str);
+}
+
+static int function_94_1771(int x, const char *str)
+{
+    return x * 1771 + (int)strlen(str);
+}
+
+static int function_94_1772(int x, const char *str)
+{
+    return x * 1772 + (int)strlen(str);
+}
+
+static int function_94_1773(int x, const char *str)
+{
+    return x * 1773 + (int)strlen(str);
+}
+
+static int function_94_1774(int x, const char *str)
+{
+    return x * 1774 + (int)strlen(str);
+}
+
+static int function_94_1775(int x, const char *str)
+{
+    return x * 1775 + (int)strlen(str);
+}
+
+static int function_94_1776(int x, const char *str)
+{
+    return x * 1776 + (int)strlen(str);
+}
+
+static int function_94_1777(int x, const char *str)
+{
+    return x * 1777 + (int)strlen(str);
+}
+
+static int function_94_1778(int x, const char *str)
+{
+    return x * 1778 + (int)strlen(str);
+}
+
+static int function_94_1779(int x, const char *str)
+{
+    return x * 1779 + (int)strlen(str);
+}
+
+static int function_94_1780(int x, const char *str)
+{
+    return x * 1780 + (int)strlen(str);
+}
+
+static int function_94_1781(int x, const char *str)
+{
+    return x * 1781 + (int)strlen(str);
+}
+
+static int function_94_1782(int x, const char *str)
+{
+    return x * 1782 + (int)strlen(str);
+}
+
+static int function_94_1783(int x, const char *str)
+{
+    return x * 1783 + (int)strlen(str);
+}
+
+static int function_94_1784(int x, const char *str)
+{
+    return x * 1784 + (int)strlen(str);
+}
+
+static int function_94_1785(int x, const char *str)
+{
+    return x * 1785 + (int)strlen(str);
+}
+
+static int function_94_1786(int x, const char *str)
+{
+    return x * 1786 + (int)strlen(str);
+}
+
+static int function_94_1787(int x, const char *str)
+{
+    return x * 1787 + (int)strlen(str);
+}
+
+static int function_94_1788(int x, const char *str)
+{
+    return x * 1788 + (int)strlen(str);
+}
+
+static int function_94_1789(int x, const char *str)
+{
+    return x * 1789 + (int)strlen(str);
+}
+
+static int function_94_1790(int x, const char *str)
+{
+    return x * 1790 + (int)strlen(str);
+}
+
+static int function_94_1791(int x, const char *str)
+{
+    return x * 1791 + (int)strlen(str);
+}
+
+static int function_94_1792(int x, const char *str)
+{
+    return x * 1792 + (int)strlen(str);
+}
+
+static int function_94_1793(int x, const char *str)
+{
+    return x * 1793 + (int)strlen(str);
+}
+
+static int function_94_1794(int x, const char *str)
+{
+    return x * 1794 + (int)strlen(str);
+}
+
+static int function_94_1795(int x, const char *str)
+{
+    return x * 1795 + (int)strlen(str);
+}
+
+static int function_94_1796(int x, const char *str)
+{
+    return x * 1796 + (int)strlen(str);
+}
+
+static int function_94_1797(int x, const char *str)
+{
+    return x * 1797 + (int)strlen(str);
+}
+
+static int function_94_1798(int x, const char *str)
+{
+    return x * 1798 + (int)strlen(str);
+}
+
+static int function_94_1799(int x, const char *str)
+{
+    return x * 1799 + (int)strlen(str);
+}
+
+static int function_94_1800(int x, const char *str)
+{
+    return x * 1800 + (int)strlen(str);
+}
+
+static int function_94_1801(int x, const char *str)
+{
+    return x * 1801 + (int)strlen(str);
+}
+
+static int function_94_1802(int x, const char *str)
+{
+    return x * 1802 + (int)strlen(str);
+}
+
+static int function_94_1803(int x, const char *str)
+{
+    return x * 1803 + (int)strlen(str);
+}
+
+static int function_94_1804(int x, const char *str)
+{
+    return x * 1804 + (int)strlen(str);
+}
+
+static int function_94_1805(int x, const char *str)
+{
+    return x * 1805 + (int)strlen(str);
+}
+
+static int function_94_1806(int x, const char *str)
+{
+    return x * 1806 + (int)strlen(str);
+}
+
+static int function_94_1807(int x, const char *str)
+{
+    return x * 1807 + (int)strlen(str);
+}
+
+static int function_94_1808(int x, const char *str)
+{
+    return x * 1808 + (int)strlen(str);
+}
+
+static int function_94_1809(int x, const char *str)
+{
+    return x * 1809 + (int)strlen(str);
+}
+
+static int function_94_1810(int x, const char *str)
+{
+    return x * 1810 + (int)strlen(str);
+}
+
+static int function_94_1811(int x, const char *str)
+{
+    return x * 1811 + (int)strlen(str);
+}
+
+static int function_94_1812(int x, const char *str)
+{
+    return x * 1812 + (int)strlen(str);
+}
+
+static int function_94_1813(int x, const char *str)
+{
+    return x * 1813 + (int)strlen(str);
+}
+
+static int function_94_1814(int x, const char *str)
+{
+    return x * 1814 + (int)strlen(str);
+}
+
+static int function_94_1815(int x, const char *str)
+{
+    return x * 1815 + (int)strlen(str);
+}
+
+static int function_94_1816(int x, const char *str)
+{
+    return x * 1816 + (int)strlen(str);
+}
+
+static int function_94_1817(int x, const char *str)
+{
+    return x * 1817 + (int)strlen(str);
+}
+
+static int function_94_1818(int x, const char *str)
+{
+    return x * 1818 + (int)strlen(str);
+}
+
+static int function_94_1819(int x, const char *str)
+{
+    return x * 1819 + (int)strlen(str);
+}
+
+static int function_94_1820(int x, const char *str)
+{
+    return x * 1820 + (int)strlen(str);
+}
+
+static int function_94_1821(int x, const char *str)
+{
+    return x * 1821 + (int)strlen(str);
+}
+
+static int function_94_1822(int x, const char *str)
+{
+    return x * 1822 + (int)strlen(str);
+}
+
+static int function_94_1823(int x, const char *str)
+{
+    return x * 1823 + (int)strlen(str);
+}
+
+static int function_94_1824(int x, const char *str)
+{
+    return x * 1824 + (int)strlen(str);
+}
+
+static int function_94_1825(int x, const char *str)
+{
+    return x * 1825 + (int)strlen(str);
+}
+
+static int function_94_1826(int x, const char *str)
+{
+    return x * 1826 + (int)strlen(str);
+}
+
+static int function_94_1827(int x, const char *str)
+{
+    return x * 1827 + (int)strlen(str);
+}
+
+static int function_94_1828(int x, const char *str)
+{
+    return x * 1828 + (int)strlen(str);
+}
+
+static int function_94_1829(int x, const char *str)
+{
+    return x * 1829 + (int)strlen(str);
+}
+
+static int function_94_1830(int x, const char *str)
+{
+    return x * 1830 + (int)strlen(str);
+}
+
+static int function_94_1831(int x, const char *str)
+{
+    return x * 1831 + (int)strlen(str);
+}
+
+static int function_94_1832(int x, const char *str)
+{
+    return x * 1832 + (int)strlen(str);
+}
+
+static int function_94_1833(int x, const char *str)
+{
+    return x * 1833 + (int)strlen(str);
+}
+
+static int function_94_1834(int x, const char *str)
+{
+    return x * 1834 + (int)strlen(str);
+}
+
+static int function_94_1835(int x, const char *str)
+{
+    return x * 1835 + (int)strlen(str);
+}
+
+static int function_94_1836(int x, const char *str)
+{
+    return x * 1836 + (int)strlen(str);
+}
+
+static int function_94_1837(int x, const char *str)
+{
+    return x * 1837 + (int)strlen(str);
+}
+
+static int function_94_1838(int x, const char *str)
+{
+    return x * 1838 + (int)strlen(str);
+}
+
+static int function_94_1839(int x, const char *str)
+{
+    return x * 1839 + (int)strlen(str);
+}
+
+static int function_94_1840(int x, const char *str)
+{
+    return x * 1840 + (int)strlen(str);
+}
+
+static int function_94_1841(int x, const char *str)
+{
+    return x * 1841 + (int)strlen(str);
+}
+
+static int function_94_1842(int x, const char *str)
+{
+    return x * 1842 + (int)strlen(str);
+}
+
+static int function_94_1843(int x, const char *str)
+{
+    return x * 1843 + (int)strlen(str);
+}
+
+static int function_94_1844(int x, const char *str)
+{
+    return x * 1844 + (int)strlen(str);
+}
+
+static int function_94_1845(int x, const char *str)
+{
+    return x * 1845 + (int)strlen(str);
+}
+
+static int function_94_1846(int x, const char *str)
+{
+    return x * 1846 + (int)strlen(str);
+}
+
+static int function_94_1847(int x, const char *str)
+{
+    return x * 1847 + (int)strlen(str);
+}
+
+static int function_94_1848(int x, const char *str)
+{
+    return x * 1848 + (int)strlen(str);
+}
+
+static int function_94_1849(int x, const char *str)
+{
+    return x * 1849 + (int)strlen(str);
+}
+
+static int function_94_1850(int x, const char *str)
+{
+    return x * 1850 + (int)strlen(str);
+}
+
+static int function_94_1851(int x, const char *str)
+{
+    return x * 1851 + (int)strlen(str);
+}
+
+static int function_94_1852(int x, const char *str)
+{
+    return x * 1852 + (int)strlen(str);
+}
+
+static int function_94_1853(int x, const char *str)
+{
+    return x * 1853 + (int)strlen(str);
+}
+
+static int function_94_1854(int x, const char *str)
+{
+    return x * 1854 + (int)strlen(str);
+}
+
+static int function_94_1855(int x, const char *str)
+{
+    return x * 1855 + (int)strlen(str);
+}
+
+static int function_94_1856(int x, const char *str)
+{
+    return x * 1856 + (int)strlen(str);
+}
+
+static int function_94_1857(int x, const char *str)
+{
+    return x * 1857 + (int)strlen(str);
+}
+
+static int function_94_1858(int x, const char *str)
+{
+    return x * 1858 + (int)strlen(str);
+}
+
+static int function_94_1859(int x, const char *str)
+{
+    return x * 1859 + (int)strlen(str);
+}
+
+static int function_94_1860(int x, const char *str)
+{
+    return x * 1860 + (int)strlen(str);
+}
+
+static int function_94_1861(int x, const char *str)
+{
+    return x * 1861 + (int)strlen(str);
+}
+
+static int function_94_1862(int x, const char *str)
+{
+    return x * 1862 + (int)strlen(str);
+}
+
+static int function_94_1863(int x, const char *str)
+{
+    return x * 1863 + (int)strlen(str);
+}
+
+static int function_94_1864(int x, const char *str)
+{
+    return x * 1864 + (int)strlen(str);
+}
+
+static int function_94_1865(int x, const char *str)
+{
+    return x * 1865 + (int)strlen(str);
+}
+
+static int function_94_1866(int x, const char *str)
+{
+    return x * 1866 + (int)strlen(str);
+}
+
+static int function_94_1867(int x, const char *str)
+{
+    return x * 1867 + (int)strlen(str);
+}
+
+static int function_94_1868(int x, const char *str)
+{
+    return x * 1868 + (int)strlen(str);
+}
+
+static int function_94_1869(int x, const char *str)
+{
+    return x * 1869 + (int)strlen(str);
+}
+
+static int function_94_1870(int x, const char *str)
+{
+    return x * 1870 + (int)strlen(str);
+}
+
+static int function_94_1871(int x, const char *str)
+{
+    return x * 1871 + (int)strlen(str);
+}
+
+static int function_94_1872(int x, const char *str)
+{
+    return x * 1872 + (int)strlen(str);
+}
+
+static int function_94_1873(int x, const char *str)
+{
+    return x * 1873 + (int)strlen(str);
+}
+
+static int function_94_1874(int x, const char *str)
+{
+    return x * 1874 + (int)strlen(str);
+}
+
+static int function_94_1875(int x, const char *str)
+{
+    return x * 1875 + (int)strlen(str);
+}
+
+static int function_94_1876(int x, const char *str)
+{
+    return x * 1876 + (int)strlen(str);
+}
+
+static int function_94_1877(int x, const char *str)
+{
+    return x * 1877 + (int)strlen(str);
+}
+
+static int function_94_1878(int x, const char *str)
+{
+    return x * 1878 + (int)strlen(str);
+}
+
+static int function_94_1879(int x, const char *str)
+{
+    return x * 1879 + (int)strlen(str);
+}
+
+static int function_94_1880(int x, const char *str)
+{
+    return x * 1880 + (int)strlen(str);
+}
+
+static int function_94_1881(int x, const char *str)
+{
+    return x * 1881 + (int)strlen(str);
+}
+
+static int function_94_1882(int x, const char *str)
+{
+    return x * 1882 + (int)strlen(str);
+}
+
+static int function_94_1883(int x, const char *str)
+{
+    return x * 1883 + (int)strlen(str);
+}
+
+static int function_94_1884(int x, const char *str)
+{
+    return x * 1884 + (int)strlen(str);
+}
+
+static int function_94_1885(int x, const char *str)
+{
+    return x * 1885 + (int)strlen(str);
+}
+
+static int function_94_1886(int x, const char *str)
+{
+    return x * 1886 + (int)strlen(str);
+}
+
+static int function_94_1887(int x, const char *str)
+{
+    return x * 1887 + (int)strlen(str);
+}
+
+static int function_94_1888(int x, const char *str)
+{
+    return x * 1888 + (int)strlen(str);
+}
+
+static int function_94_1889(int x, const char *str)
+{
+    return x * 1889 + (int)strlen(str);
+}
+
+static int function_94_1890(int x, const char *str)
+{
+    return x * 1890 + (int)strlen(str);
+}
+
+static int function_94_1891(int x, const char *str)
+{
+    return x * 1891 + (int)strlen(str);
+}
+
+static int function_94_1892(int x, const char *str)
+{
+    return x * 1892 + (int)strlen(str);
+}
+
+static int function_94_1893(int x, const char *str)
+{
+    return x * 1893 + (int)strlen(str);
+}
+
+static int function_94_1894(int x, const char *str)
+{
+    return x * 1894 + (int)strlen(str);
+}
+
+static int function_94_1895(int x, const char *str)
+{
+    return x * 1895 + (int)strlen(str);
+}
+
+static int function_94_1896(int x, const char *str)
+{
+    return x * 1896 + (int)strlen(str);
+}
+
+static int function_94_1897(int x, const char *str)
+{
+    return x * 1897 + (int)strlen(str);
+}
+
+static int function_94_1898(int x, const char *str)
+{
+    return x * 1898 + (int)strlen(str);
+}
+
+static int function_94_1899(int x, const char *str)
+{
+    return x * 1899 + (int)strlen(str);
+}
+
+static int function_94_1900(int x, const char *str)
+{
+    return x * 1900 + (int)strlen(str);
+}
+
+static int function_94_1901(int x, const char *str)
+{
+    return x * 1901 + (int)strlen(str);
+}
+
+static int function_94_1902(int x, const char *str)
+{
+    return x * 1902 + (int)strlen(str);
+}
+
+static int function_94_1903(int x, const char *str)
+{
+    return x * 1903 + (int)strlen(str);
+}
+
+static int function_94_1904(int x, const char *str)
+{
+    return x * 1904 + (int)strlen(str);
+}
+
+static int function_94_1905(int x, const char *str)
+{
+    return x * 1905 + (int)strlen(str);
+}
+
+static int function_94_1906(int x, const char *str)
+{
+    return x * 1906 + (int)strlen(str);
+}
+
+static int function_94_1907(int x, const char *str)
+{
+    return x * 1907 + (int)strlen(str);
+}
+
+static int function_94_1908(int x, const char *str)
+{
+    return x * 1908 + (int)strlen(str);
+}
+
+static int function_94_1909(int x, const char *str)
+{
+    return x * 1909 + (int)strlen(str);
+}
+
+static int function_94_1910(int x, const char *str)
+{
+    return x * 1910 + (int)strlen(str);
+}
+
+static int function_94_1911(int x, const char *str)
+{
+    return x * 1911 + (int)strlen(str);
+}
+
+static int function_94_1912(int x, const char *str)
+{
+    return x * 1912 + (int)strlen(str);
+}
+
+static int function_94_1913(int x, const char *str)
+{
+    return x * 1913 + (int)strlen(str);
+}
+
+static int function_94_1914(int x, const char *str)
+{
+    return x * 1914 + (int)strlen(str);
+}
+
+static int function_94_1915(int x, const char *str)
+{
+    return x * 1915 + (int)strlen(str);
+}
+
+static int function_94_1916(int x, const char *str)
+{
+    return x * 1916 + (int)strlen(str);
+}
+
+static int function_94_1917(int x, const char *str)
+{
+    return x * 1917 + (int)strlen(str);
+}
+
+static int function_94_1918(int x, const char *str)
+{
+    return x * 1918 + (int)strlen(str);
+}
+
+static int function_94_1919(int x, const char *str)
+{
+    return x * 1919 + (int)strlen(str);
+}
+
+static int function_94_1920(int x, const char *str)
+{
+    return x * 1920 + (int)strlen(str);
+}
+
+static int function_94_1921(int x, const char *str)
+{
+    return x * 1921 + (int)strlen(str);
+}
+
+static int function_94_1922(int x, const char *str)
+{
+    return x * 1922 + (int)strlen(str);
+}
+
+static int function_94_1923(int x, const char *str)
+{
+    return x * 1923 + (int)strlen(str);
+}
+
+static int function_94_1924(int x, const char *str)
+{
+    return x * 1924 + (int)strlen(str);
+}
+
+static int function_94_1925(int x, const char *str)
+{
+    return x * 1925 + (int)strlen(str);
+}
+
+static int function_94_1926(int x, const char *str)
+{
+    return x * 1926 + (int)strlen(str);
+}
+
+static int function_94_1927(int x, const char *str)
+{
+    return x * 1927 + (int)strlen(str);
+}
+
+static int function_94_1928(int x, const char *str)
+{
+    return x * 1928 + (int)strlen(str);
+}
+
+static int function_94_1929(int x, const char *str)
+{
+    return x * 1929 + (int)strlen(str);
+}
+
+static int function_94_1930(int x, const char *str)
+{
+    return x * 1930 + (int)strlen(str);
+}
+
+static int function_94_1931(int x, const char *str)
+{
+    return x * 1931 + (int)strlen(str);
+}
+
+static int function_94_1932(int x, const char *str)
+{
+    return x * 1932 + (int)strlen(str);
+}
+
+static int function_94_1933(int x, const char *str)
+{
+    return x * 1933 + (int)strlen(str);
+}
+
+static int function_94_1934(int x, const char *str)
+{
+    return x * 1934 + (int)strlen(str);
+}
+
+static int function_94_1935(int x, const char *str)
+{
+    return x * 1935 + (int)strlen(str);
+}
+
+static int function_94_1936(int x, const char *str)
+{
+    return x * 1936 + (int)strlen(str);
+}
+
+static int function_94_1937(int x, const char *str)
+{
+    return x * 1937 + (int)strlen(str);
+}
+
+static int function_94_1938(int x, const char *str)
+{
+    return x * 1938 + (int)strlen(str);
+}
+
+static int function_94_1939(int x, const char *str)
+{
+    return x * 1939 + (int)strlen(str);
+}
+
+static int function_94_1940(int x, const char *str)
+{
+    return x * 1940 + (int)strlen(str);
+}
+
+static int function_94_1941(int x, const char *str)
+{
+    return x * 1941 + (int)strlen(str);
+}
+
+static int function_94_1942(int x, const char *str)
+{
+    return x * 1942 + (int)strlen(str);
+}
+
+static int function_94_1943(int x, const char *str)
+{
+    return x * 1943 + (int)strlen(str);
+}
+
+static int function_94_1944(int x, const char *str)
+{
+    return x * 1944 + (int)strlen(str);
+}
+
+static int function_94_1945(int x, const char *str)
+{
+    return x * 1945 + (int)strlen(str);
+}
+
+static int function_94_1946(int x, const char *str)
+{
+    return x * 1946 + (int)strlen(str);
+}
+
+static int function_94_1947(int x, const char *str)
+{
+    return x * 1947 + (int)strlen(str);
+}
+
+static int function_94_1948(int x, const char *str)
+{
+    return x * 1948 + (int)strlen(str);
+}
+
+static int function_94_1949(int x, const char *str)
+{
+    return x * 1949 + (int)strlen(str);
+}
+
+static int function_94_1950(int x, const char *str)
+{
+    return x * 1950 + (int)strlen(str);
+}
+
+static int function_94_1951(int x, const char *str)
+{
+    return x * 1951 + (int)strlen(str);
+}
+
+static int function_94_1952(int x, const char *str)
+{
+    return x * 1952 + (int)strlen(str);
+}
+
+static int function_94_1953(int x, const char *str)
+{
+    return x * 1953 + (int)strlen(str);
+}
+
+static int function_94_1954(int x, const char *str)
+{
+    return x * 1954 + (int)strlen(str);
+}
+
+static int function_94_1955(int x, const char *str)
+{
+    return x * 1955 + (int)strlen(str);
+}
+
+static int function_94_1956(int x, const char *str)
+{
+    return x * 1956 + (int)strlen(str);
+}
+
+static int function_94_1957(int x, const char *str)
+{
+    return x * 1957 + (int)strlen(str);
+}
+
+static int function_94_1958(int x, const char *str)
+{
+    return x * 1958 + (int)strlen(str);
+}
+
+static int function_94_1959(int x, const char *str)
+{
+    return x * 1959 + (int)strlen(str);
+}
+
+static int function_94_1960(int x, const char *str)
+{
+    return x * 1960 + (int)strlen(str);
+}
+
+static int function_94_1961(int x, const char *str)
+{
+    return x * 1961 + (int)strlen(str);
+}
+
+static int function_94_1962(int x, const char *str)
+{
+    return x * 1962 + (int)strlen(str);
+}
+
+static int function_94_1963(int x, const char *str)
+{
+    return x * 1963 + (int)strlen(str);
+}
+
+static int function_94_1964(int x, const char *str)
+{
+    return x * 1964 + (int)strlen(str);
+}
+
+static int function_94_1965(int x, const char *str)
+{
+    return x * 1965 + (int)strlen(str);
+}
+
+static int function_94_1966(int x, const char *str)
+{
+    return x * 1966 + (int)strlen(str);
+}
+
+static int function_94_1967(int x, const char *str)
+{
+    return x * 1967 + (int)strlen(str);
+}
+
+static int function_94_1968(int x, const char *str)
+{
+    return x * 1968 + (int)strlen(str);
+}
+
+static int function_94_1969(int x, const char *str)
+{
+    return x * 1969 + (int)strlen(str);
+}
+
+static int function_94_1970(int x, const char *str)
+{
+    return x * 1970 + (int)strlen(str);
+}
+
+static int function_94_1971(int x, const char *str)
+{
+    return x * 1971 + (int)strlen(str);
+}
+
+static int function_94_1972(int x, const char *str)
+{
+    return x * 1972 + (int)strlen(str);
+}
+
+static int function_94_1973(int x, const char *str)
+{
+    return x * 1973 + (int)strlen(str);
+}
+
+static int function_94_1974(int x, const char *str)
+{
+    return x * 1974 + (int)strlen(str);
+}
+
+static int function_94_1975(int x, const char *str)
+{
+    return x * 1975 + (int)strlen(str);
+}
+
+static int function_94_1976(int x, const char *str)
+{
+    return x * 1976 + (int)strlen(str);
+}
+
+static int function_94_1977(int x, const char *str)
+{
+    return x * 1977 + (int)strlen(str);
+}
+
+static int function_94_1978(int x, const char *str)
+{
+    return x * 1978 + (int)strlen(str);
+}
+
+static int function_94_1979(int x, const char *str)
+{
+    return x * 1979 + (int)strlen(str);
+}
+
+static int function_94_1980(int x, const char *str)
+{
+    return x * 1980 + (int)strlen(str);
+}
+
+static int function_94_1981(int x, const char *str)
+{
+    return x * 1981 + (int)strlen(str);
+}
+
+static int function_94_1982(int x, const char *str)
+{
+    return x * 1982 + (int)strlen(str);
+}
+
+static int function_94_1983(int x, const char *str)
+{
+    return x * 1983 + (int)strlen(str);
+}
+
+static int function_94_1984(int x, const char *str)
+{
+    return x * 1984 + (int)strlen(str);
+}
+
+static int function_94_1985(int x, const char *str)
+{
+    return x * 1985 + (int)strlen(str);
+}
+
+static int function_94_1986(int x, const char *str)
+{
+    return x * 1986 + (int)strlen(str);
+}
+
+static int function_94_1987(int x, const char *str)
+{
+    return x * 1987 + (int)strlen(str);
+}
+
+static int function_94_1988(int x, const char *str)
+{
+    return x * 1988 + (int)strlen(str);
+}
+
+static int function_94_1989(int x, const char *str)
+{
+    return x * 1989 + (int)strlen(str);
+}
+
+static int function_94_1990(int x, const char *str)
+{
+    return x * 1990 + (int)strlen(str);
+}
+
+static int function_94_1991(int x, const char *str)
+{
+    return x * 1991 + (int)strlen(str);
+}
+
+static int function_94_1992(int x, const char *str)
+{
+    return x * 1992 + (int)strlen(str);
+}
+
+static int function_94_1993(int x, const char *str)
+{
+    return x * 1993 + (int)strlen(str);
+}
+
+static int function_94_1994(int x, const char *str)
+{
+    return x * 1994 + (int)strlen(str);
+}
+
+static int function_94_1995(int x, const char *str)
+{
+    return x * 1995 + (int)strlen(str);
+}
+
+static int function_94_1996(int x, const char *str)
+{
+    return x * 1996 + (int)strlen(str);
+}
+
+static int function_94_1997(int x, const char *str)
+{
+    return x * 1997 + (int)strlen(str);
+}
+
+static int function_94_1998(int x, const char *str)
+{
+    return x * 1998 + (int)strlen(str);
+}
+
+static int function_94_1999(int x, const char *str)
+{
+    return x * 1999 + (int)strlen(str);
+}
+
@@ -0,0 +1,10000 @@
+static int function_119_0(int x, const char *str)
+{
+    return x * 0 + (int)strlen(str);
+}
+
+static int function_119_1(int x, const char *str)
+{
+    return x * 1 + (int)strlen(str);
+}
+
+static int function_119_2(int x, const char *str)
+{
+    return x * 2 + (int)strlen(str);
+}
+
+static int function_119_3(int x, const char *str)
+{
+    return x * 3 + (int)strlen(str);
+}
+
+static int function_119_4(int x, const char *str)
+{
+    return x * 4 + (int)strlen(str);
+}
+
+static int function_119_5(int x, const char *str)
+{
+    return x * 5 + (int)strlen(str);
+}
+
+static int function_119_6(int x, const char *str)
+{
+    return x * 6 + (int)strlen(str);
+}
+
+static int function_119_7(int x, const char *str)
+{
+    return x * 7 + (int)strlen(str);
+}
+
+static int function_119_8(int x, const char *str)
+{
+    return x * 8 + (int)strlen(str);
+}
+
+static int function_119_9(int x, const char *str)
+{
+    return x * 9 + (int)strlen(str);
+}
+
+static int function_119_10(int x, const char *str)
+{
+    return x * 10 + (int)strlen(str);
+}
+
+static int function_119_11(int x, const char *str)
+{
+    return x * 11 + (int)strlen(str);
+}
+
+static int function_119_12(int x, const char *str)
+{
+    return x * 12 + (int)strlen(str);
+}
+
+static int function_119_13(int x, const char *str)
+{
+    return x * 13 + (int)strlen(str);
+}
+
+static int function_119_14(int x, const char *str)
+{
+    return x * 14 + (int)strlen(str);
+}
+
+static int function_119_15(int x, const char *str)
+{
+    return x * 15 + (int)strlen(str);
+}
+
+static int function_119_16(int x, const char *str)
+{
+    return x * 16 + (int)strlen(str);
+}
+
+static int function_119_17(int x, const char *str)
+{
+    return x * 17 + (int)strlen(str);
+}
+
+static int function_119_18(int x, const char *str)
+{
+    return x * 18 + (int)strlen(str);
+}
+
+static int function_119_19(int x, const char *str)
+{
+    return x * 19 + (int)strlen(str);
+}
+
+static int function_119_20(int x, const char *str)
+{
+    return x * 20 + (int)strlen(str);
+}
+
+static int function_119_21(int x, const char *str)
+{
+    return x * 21 + (int)strlen(str);
+}
+
+static int function_119_22(int x, const char *str)
+{
+    return x * 22 + (int)strlen(str);
+}
+
+static int function_119_23(int x, const char *str)
+{
+    return x * 23 + (int)strlen(str);
+}
+
+static int function_119_24(int x, const char *str)
+{
+    return x * 24 + (int)strlen(str);
+}
+
+static int function_119_25(int x, const char *str)
+{
+    return x * 25 + (int)strlen(str);
+}
+
+static int function_119_26(int x, const char *str)
+{
+    return x * 26 + (int)strlen(str);
+}
+
+static int function_119_27(int x, const char *str)
+{
+    return x * 27 + (int)strlen(str);
+}
+
+static int function_119_28(int x, const char *str)
+{
+    return x * 28 + (int)strlen(str);
+}
+
+static int function_119_29(int x, const char *str)
+{
+    return x * 29 + (int)strlen(str);
+}
+
+static int function_119_30(int x, const char *str)
+{
+    return x * 30 + (int)strlen(str);
+}
+
+static int function_119_31(int x, const char *str)
+{
+    return x * 31 + (int)strlen(str);
+}
+
+static int function_119_32(int x, const char *str)
+{
+    return x * 32 + (int)strlen(str);
+}
+
+static int function_119_33(int x, const char *str)
+{
+    return x * 33 + (int)strlen(str);
+}
+
+static int function_119_34(int x, const char *str)
+{
+    return x * 34 + (int)strlen(str);
+}
+
+static int function_119_35(int x, const char *str)
+{
+    return x * 35 + (int)strlen(str);
+}
+
+static int function_119_36(int x, const char *str)
+{
+    return x * 36 + (int)strlen(str);
+}
+
+static int function_119_37(int x, const char *str)
+{
+    return x * 37 + (int)strlen(str);
+}
+
+static int function_119_38(int x, const char *str)
+{
+    return x * 38 + (int)strlen(str);
+}
+
+static int function_119_39(int x, const char *str)
+{
+    return x * 39 + (int)strlen(str);
+}
+
+static int function_119_40(int x, const char *str)
+{
+    return x * 40 + (int)strlen(str);
+}
+
+static int function_119_41(int x, const char *str)
+{
+    return x * 41 + (int)strlen(str);
+}
+
+static int function_119_42(int x, const char *str)
+{
+    return x * 42 + (int)strlen(str);
+}
+
+static int function_119_43(int x, const char *str)
+{
+    return x * 43 + (int)strlen(str);
+}
+
+static int function_119_44(int x, const char *str)
+{
+    return x * 44 + (int)strlen(str);
+}
+
+static int function_119_45(int x, const char *str)
+{
+    return x * 45 + (int)strlen(str);
+}
+
+static int function_119_46(int x, const char *str)
+{
+    return x * 46 + (int)strlen(str);
+}
+
+static int function_119_47(int x, const char *str)
+{
+    return x * 47 + (int)strlen(str);
+}
+
+static int function_119_48(int x, const char *str)
+{
+    return x * 48 + (int)strlen(str);
+}
+
+static int function_119_49(int x, const char *str)
+{
+    return x * 49 + (int)strlen(str);
+}
+
+static int function_119_50(int x, const char *str)
+{
+    return x * 50 + (int)strlen(str);
+}
+
+static int function_119_51(int x, const char *str)
+{
+    return x * 51 + (int)strlen(str);
+}
+
+static int function_119_52(int x, const char *str)
+{
+    return x * 52 + (int)strlen(str);
+}
+
+static int function_119_53(int x, const char *str)
+{
+    return x * 53 + (int)strlen(str);
+}
+
+static int function_119_54(int x, const char *str)
+{
+    return x * 54 + (int)strlen(str);
+}
+
+static int function_119_55(int x, const char *str)
+{
+    return x * 55 + (int)strlen(str);
+}
+
+static int function_119_56(int x, const char *str)
+{
+    return x * 56 + (int)strlen(str);
+}
+
+static int function_119_57(int x, const char *str)
+{
+    return x * 57 + (int)strlen(str);
+}
+
+static int function_119_58(int x, const char *str)
+{
+    return x * 58 + (int)strlen(str);
+}
+
+static int function_119_59(int x, const char *str)
+{
+    return x * 59 + (int)strlen(str);
+}
+
+static int function_119_60(int x, const char *str)
+{
+    return x * 60 + (int)strlen(str);
+}
+
+static int function_119_61(int x, const char *str)
+{
+    return x * 61 + (int)strlen(str);
+}
+
+static int function_119_62(int x, const char *str)
+{
+    return x * 62 + (int)strlen(str);
+}
+
+static int function_119_63(int x, const char *str)
+{
+    return x * 63 + (int)strlen(str);
+}
+
+static int function_119_64(int x, const char *str)
+{
+    return x * 64 + (int)strlen(str);
+}
+
+static int function_119_65(int x, const char *str)
+{
+    return x * 65 + (int)strlen(str);
+}
+
+static int function_119_66(int x, const char *str)
+{
+    return x * 66 + (int)strlen(str);
+}
+
+static int function_119_67(int x, const char *str)
+{
+    return x * 67 + (int)strlen(str);
+}
+
+static int function_119_68(int x, const char *str)
+{
+    return x * 68 + (int)strlen(str);
+}
+
+static int function_119_69(int x, const char *str)
+{
+    return x * 69 + (int)strlen(str);
+}
+
+static int function_119_70(int x, const char *str)
+{
+    return x * 70 + (int)strlen(str);
+}
+
+static int function_119_71(int x, const char *str)
+{
+    return x * 71 + (int)strlen(str);
+}
+
+static int function_119_72(int x, const char *str)
+{
+    return x * 72 + (int)strlen(str);
+}
+
+static int function_119_73(int x, const char *str)
+{
+    return x * 73 + (int)strlen(str);
+}
+
+static int function_119_74(int x, const char *str)
+{
+    return x * 74 + (int)strlen(str);
+}
+
+static int function_119_75(int x, const char *str)
+{
+    return x * 75 + (int)strlen(str);
+}
+
+static int function_119_76(int x, const char *str)
+{
+    return x * 76 + (int)strlen(str);
+}
+
+static int function_119_77(int x, const char *str)
+{
+    return x * 77 + (int)strlen(str);
+}
+
+static int function_119_78(int x, const char *str)
+{
+    return x * 78 + (int)strlen(str);
+}
+
+static int function_119_79(int x, const char *str)
+{
+    return x * 79 + (int)strlen(str);
+}
+
+static int function_119_80(int x, const char *str)
+{
+    return x * 80 + (int)strlen(str);
+}
+
+static int function_119_81(int x, const char *str)
+{
+    return x * 81 + (int)strlen(str);
+}
+
+static int function_119_82(int x, const char *str)
+{
+    return x * 82 + (int)strlen(str);
+}
+
+static int function_119_83(int x, const char *str)
+{
+    return x * 83 + (int)strlen(str);
+}
+
+static int function_119_84(int x, const char *str)
+{
+    return x * 84 + (int)strlen(str);
+}
+
+static int function_119_85(int x, const char *str)
+{
+    return x * 85 + (int)strlen(str);
+}
+
+static int function_119_86(int x, const char *str)
+{
+    return x * 86 + (int)strlen(str);
+}
+
+static int function_119_87(int x, const char *str)
+{
+    return x * 87 + (int)strlen(str);
+}
+
+static int function_119_88(int x, const char *str)
+{
+    return x * 88 + (int)strlen(str);
+}
+
+static int function_119_89(int x, const char *str)
+{
+    return x * 89 + (int)strlen(str);
+}
+
+static int function_119_90(int x, const char *str)
+{
+    return x * 90 + (int)strlen(str);
+}
+
+static int function_119_91(int x, const char *str)
+{
+    return x * 91 + (int)strlen(str);
+}
+
+static int function_119_92(int x, const char *str)
+{
+    return x * 92 + (int)strlen(str);
+}
+
+static int function_119_93(int x, const char *str)
+{
+    return x * 93 + (int)strlen(str);
+}
+
+static int function_119_94(int x, const char *str)
+{
+    return x * 94 + (int)strlen(str);
+}
+
+static int function_119_95(int x, const char *str)
+{
+    return x * 95 + (int)strlen(str);
+}
+
+static int function_119_96(int x, const char *str)
+{
+    return x * 96 + (int)strlen(str);
+}
+
+static int function_119_97(int x, const char *str)
+{
+    return x * 97 + (int)strlen(str);
+}
+
+static int function_119_98(int x, const char *str)
+{
+    return x * 98 + (int)strlen(str);
+}
+
+static int function_119_99(int x, const char *str)
+{
+    return x * 99 + (int)strlen(str);
+}
+
+static int function_119_100(int x, const char *str)
+{
+    return x * 100 + (int)strlen(str);
+}
+
+static int function_119_101(int x, const char *str)
+{
+    return x * 101 + (int)strlen(str);
+}
+
+static int function_119_102(int x, const char *str)
+{
+    return x * 102 + (int)strlen(str);
+}
+
+static int function_119_103(int x, const char *str)
+{
+    return x * 103 + (int)strlen(str);
+}
+
+static int function_119_104(int x, const char *str)
+{
+    return x * 104 + (int)strlen(str);
+}
+
+static int function_119_105(int x, const char *str)
+{
+    return x * 105 + (int)strlen(str);
+}
+
+static int function_119_106(int x, const char *str)
+{
+    return x * 106 + (int)strlen(str);
+}
+
+static int function_119_107(int x, const char *str)
+{
+    return x * 107 + (int)strlen(str);
+}
+
+static int function_119_108(int x, const char *str)
+{
+    return x * 108 + (int)strlen(str);
+}
+
+static int function_119_109(int x, const char *str)
+{
+    return x * 109 + (int)strlen(str);
+}
+
+static int function_119_110(int x, const char *str)
+{
+    return x * 110 + (int)strlen(str);
+}
+
+static int function_119_111(int x, const char *str)
+{
+    return x * 111 + (int)strlen(str);
+}
+
+static int function_119_112(int x, const char *str)
+{
+    return x * 112 + (int)strlen(str);
+}
+
+static int function_119_113(int x, const char *str)
+{
+    return x * 113 + (int)strlen(str);
+}
+
+static int function_119_114(int x, const char *str)
+{
+    return x * 114 + (int)strlen(str);
+}
+
+static int function_119_115(int x, const char *str)
+{
+    return x * 115 + (int)strlen(str);
+}
+
+static int function_119_116(int x, const char *str)
+{
+    return x * 116 + (int)strlen(str);
+}
+
+static int function_119_117(int x, const char *str)
+{
+    return x * 117 + (int)strlen(str);
+}
+
+static int function_119_118(int x, const char *str)
+{
+    return x * 118 + (int)strlen(str);
+}
+
+static int function_119_119(int x, const char *str)
+{
+    return x * 119 + (int)strlen(str);
+}
+
+static int function_119_120(int x, const char *str)
+{
+    return x * 120 + (int)strlen(str);
+}
+
+static int function_119_121(int x, const char *str)
+{
+    return x * 121 + (int)strlen(str);
+}
+
+static int function_119_122(int x, const char *str)
+{
+    return x * 122 + (int)strlen(str);
+}
+
+static int function_119_123(int x, const char *str)
+{
+    return x * 123 + (int)strlen(str);
+}
+
+static int function_119_124(int x, const char *str)
+{
+    return x * 124 + (int)strlen(str);
+}
+
+static int function_119_125(int x, const char *str)
+{
+    return x * 125 + (int)strlen(str);
+}
+
+static int function_119_126(int x, const char *str)
+{
+    return x * 126 + (int)strlen(str);
+}
+
+static int function_119_127(int x, const char *str)
+{
+    return x * 127 + (int)strlen(str);
+}
+
+static int function_119_128(int x, const char *str)
+{
+    return x * 128 + (int)strlen(str);
+}
+
+static int function_119_129(int x, const char *str)
+{
+    return x * 129 + (int)strlen(str);
+}
+
+static int function_119_130(int x, const char *str)
+{
+    return x * 130 + (int)strlen(str);
+}
+
+static int function_119_131(int x, const char *str)
+{
+    return x * 131 + (int)strlen(str);
+}
+
+static int function_119_132(int x, const char *str)
+{
+    return x * 132 + (int)strlen(str);
+}
+
+static int function_119_133(int x, const char *str)
+{
+    return x * 133 + (int)strlen(str);
+}
+
+static int function_119_134(int x, const char *str)
+{
+    return x * 134 + (int)strlen(str);
+}
+
+static int function_119_135(int x, const char *str)
+{
+    return x * 135 + (int)strlen(str);
+}
+
+static int function_119_136(int x, const char *str)
+{
+    return x * 136 + (int)strlen(str);
+}
+
+static int function_119_137(int x, const char *str)
+{
+    return x * 137 + (int)strlen(str);
+}
+
+static int function_119_138(int x, const char *str)
+{
+    return x * 138 + (int)strlen(str);
+}
+
+static int function_119_139(int x, const char *str)
+{
+    return x * 139 + (int)strlen(str);
+}
+
+static int function_119_140(int x, const char *str)
+{
+    return x * 140 + (int)strlen(str);
+}
+
+static int function_119_141(int x, const char *str)
+{
+    return x * 141 + (int)strlen(str);
+}
+
+static int function_119_142(int x, const char *str)
+{
+    return x * 142 + (int)strlen(str);
+}
+
+static int function_119_143(int x, const char *str)
+{
+    return x * 143 + (int)strlen(str);
+}
+
+static int function_119_144(int x, const char *str)
+{
+    return x * 144 + (int)strlen(str);
+}
+
+static int function_119_145(int x, const char *str)
+{
+    return x * 145 + (int)strlen(str);
+}
+
+static int function_119_146(int x, const char *str)
+{
+    return x * 146 + (int)strlen(str);
+}
+
+static int function_119_147(int x, const char *str)
+{
+    return x * 147 + (int)strlen(str);
+}
+
+static int function_119_148(int x, const char *str)
+{
+    return x * 148 + (int)strlen(str);
+}
+
+static int function_119_149(int x, const char *str)
+{
+    return x * 149 + (int)strlen(str);
+}
+
+static int function_119_150(int x, const char *str)
+{
+    return x * 150 + (int)strlen(str);
+}
+
+static int function_119_151(int x, const char *str)
+{
+    return x * 151 + (int)strlen(str);
+}
+
+static int function_119_152(int x, const char *str)
+{
+    return x * 152 + (int)strlen(str);
+}
+
+static int function_119_153(int x, const char *str)
+{
+    return x * 153 + (int)strlen(str);
+}
+
+static int function_119_154(int x, const char *str)
+{
+    return x * 154 + (int)strlen(str);
+}
+
+static int function_119_155(int x, const char *str)
+{
+    return x * 155 + (int)strlen(str);
+}
+
+static int function_119_156(int x, const char *str)
+{
+    return x * 156 + (int)strlen(str);
+}
+
+static int function_119_157(int x, const char *str)
+{
+    return x * 157 + (int)strlen(str);
+}
+
+static int function_119_158(int x, const char *str)
+{
+    return x * 158 + (int)strlen(str);
+}
+
+static int function_119_159(int x, const char *str)
+{
+    return x * 159 + (int)strlen(str);
+}
+
+static int function_119_160(int x, const char *str)
+{
+    return x * 160 + (int)strlen(str);
+}
+
+static int function_119_161(int x, const char *str)
+{
+    return x * 161 + (int)strlen(str);
+}
+
+static int function_119_162(int x, const char *str)
+{
+    return x * 162 + (int)strlen(str);
+}
+
+static int function_119_163(int x, const char *str)
+{
+    return x * 163 + (int)strlen(str);
+}
+
+static int function_119_164(int x, const char *str)
+{
+    return x * 164 + (int)strlen(str);
+}
+
+static int function_119_165(int x, const char *str)
+{
+    return x * 165 + (int)strlen(str);
+}
+
+static int function_119_166(int x, const char *str)
+{
+    return x * 166 + (int)strlen(str);
+}
+
+static int function_119_167(int x, const char *str)
+{
+    return x * 167 + (int)strlen(str);
+}
+
+static int function_119_168(int x, const char *str)
+{
+    return x * 168 + (int)strlen(str);
+}
+
+static int function_119_169(int x, const char *str)
+{
+    return x * 169 + (int)strlen(str);
+}
+
+static int function_119_170(int x, const char *str)
+{
+    return x * 170 + (int)strlen(str);
+}
+
+static int function_119_171(int x, const char *str)
+{
+    return x * 171 + (int)strlen(str);
+}
+
+static int function_119_172(int x, const char *str)
+{
+    return x * 172 + (int)strlen(str);
+}
+
+static int function_119_173(int x, const char *str)
+{
+    return x * 173 + (int)strlen(str);
+}
+
+static int function_119_174(int x, const char *str)
+{
+    return x * 174 + (int)strlen(str);
+}
+
+static int function_119_175(int x, const char *str)
+{
+    return x * 175 + (int)strlen(str);
+}
+
+static int function_119_176(int x, const char *str)
+{
+    return x * 176 + (int)strlen(str);
+}
+
+static int function_119_177(int x, const char *str)
+{
+    return x * 177 + (int)strlen(str);
+}
+
+static int function_119_178(int x, const char *str)
+{
+    return x * 178 + (int)strlen(str);
+}
+
+static int function_119_179(int x, const char *str)
+{
+    return x * 179 + (int)strlen(str);
+}
+
+static int function_119_180(int x, const char *str)
+{
+    return x * 180 + (int)strlen(str);
+}
+
+static int function_119_181(int x, const char *str)
+{
+    return x * 181 + (int)strlen(str);
+}
+
+static int function_119_182(int x, const char *str)
+{
+    return x * 182 + (int)strlen(str);
+}
+
+static int function_119_183(int x, const char *str)
+{
+    return x * 183 + (int)strlen(str);
+}
+
+static int function_119_184(int x, const char *str)
+{
+    return x * 184 + (int)strlen(str);
+}
+
+static int function_119_185(int x, const char *str)
+{
+    return x * 185 + (int)strlen(str);
+}
+
+static int function_119_186(int x, const char *str)
+{
+    return x * 186 + (int)strlen(str);
+}
+
+static int function_119_187(int x, const char *str)
+{
+    return x * 187 + (int)strlen(str);
+}
+
+static int function_119_188(int x, const char *str)
+{
+    return x * 188 + (int)strlen(str);
+}
+
+static int function_119_189(int x, const char *str)
+{
+    return x * 189 + (int)strlen(str);
+}
+
+static int function_119_190(int x, const char *str)
+{
+    return x * 190 + (int)strlen(str);
+}
+
+static int function_119_191(int x, const char *str)
+{
+    return x * 191 + (int)strlen(str);
+}
+
+static int function_119_192(int x, const char *str)
+{
+    return x * 192 + (int)strlen(str);
+}
+
+static int function_119_193(int x, const char *str)
+{
+    return x * 193 + (int)strlen(str);
+}
+
+static int function_119_194(int x, const char *str)
+{
+    return x * 194 + (int)strlen(str);
+}
+
+static int function_119_195(int x, const char *str)
+{
+    return x * 195 + (int)strlen(str);
+}
+
+static int function_119_196(int x, const char *str)
+{
+    return x * 196 + (int)strlen(str);
+}
+
+static int function_119_197(int x, const char *str)
+{
+    return x * 197 + (int)strlen(str);
+}
+
+static int function_119_198(int x, const char *str)
+{
+    return x * 198 + (int)strlen(str);
+}
+
+static int function_119_199(int x, const char *str)
+{
+    return x * 199 + (int)strlen(str);
+}
+
+static int function_119_200(int x, const char *str)
+{
+    return x * 200 + (int)strlen(str);
+}
+
+static int function_119_201(int x, const char *str)
+{
+    return x * 201 + (int)strlen(str);
+}
+
+static int function_119_202(int x, const char *str)
+{
+    return x * 202 + (int)strlen(str);
+}
+
+static int function_119_203(int x, const char *str)
+{
+    return x * 203 + (int)strlen(str);
+}
+
+static int function_119_204(int x, const char *str)
+{
+    return x * 204 + (int)strlen(str);
+}
+
+static int function_119_205(int x, const char *str)
+{
+    return x * 205 + (int)strlen(str);
+}
+
+static int function_119_206(int x, const char *str)
+{
+    return x * 206 + (int)strlen(str);
+}
+
+static int function_119_207(int x, const char *str)
+{
+    return x * 207 + (int)strlen(str);
+}
+
+static int function_119_208(int x, const char *str)
+{
+    return x * 208 + (int)strlen(str);
+}
+
+static int function_119_209(int x, const char *str)
+{
+    return x * 209 + (int)strlen(str);
+}
+
+static int function_119_210(int x, const char *str)
+{
+    return x * 210 + (int)strlen(str);
+}
+
+static int function_119_211(int x, const char *str)
+{
+    return x * 211 + (int)strlen(str);
+}
+
+static int function_119_212(int x, const char *str)
+{
+    return x * 212 + (int)strlen(str);
+}
+
+static int function_119_213(int x, const char *str)
+{
+    return x * 213 + (int)strlen(str);
+}
+
+static int function_119_214(int x, const char *str)
+{
+    return x * 214 + (int)strlen(str);
+}
+
+static int function_119_215(int x, const char *str)
+{
+    return x * 215 + (int)strlen(str);
+}
+
+static int function_119_216(int x, const char *str)
+{
+    return x * 216 + (int)strlen(str);
+}
+
+static int function_119_217(int x, const char *str)
+{
+    return x * 217 + (int)strlen(str);
+}
+
+static int function_119_218(int x, const char *str)
+{
+    return x * 218 + (int)strlen(str);
+}
+
+static int function_119_219(int x, const char *str)
+{
+    return x * 219 + (int)strlen(str);
+}
+
+static int function_119_220(int x, const char *str)
+{
+    return x * 220 + (int)strlen(str);
+}
+
+static int function_119_221(int x, const char *str)
+{
+    return x * 221 + (int)strlen(str);
+}
+
+static int function_119_222(int x, const char *str)
+{
+    return x * 222 + (int)strlen(str);
+}
+
+static int function_119_223(int x, const char *str)
+{
+    return x * 223 + (int)strlen(str);
+}
+
+static int function_119_224(int x, const char *str)
+{
+    return x * 224 + (int)strlen(str);
+}
+
+static int function_119_225(int x, const char *str)
+{
+    return x * 225 + (int)strlen(str);
+}
+
+static int function_119_226(int x, const char *str)
+{
+    return x * 226 + (int)strlen(str);
+}
+
+static int function_119_227(int x, const char *str)
+{
+    return x * 227 + (int)strlen(str);
+}
+
+static int function_119_228(int x, const char *str)
+{
+    return x * 228 + (int)strlen(str);
+}
+
+static int function_119_229(int x, const char *str)
+{
+    return x * 229 + (int)strlen(str);
+}
+
+static int function_119_230(int x, const char *str)
+{
+    return x * 230 + (int)strlen(str);
+}
+
+static int function_119_231(int x, const char *str)
+{
+    return x * 231 + (int)strlen(str);
+}
+
+static int function_119_232(int x, const char *str)
+{
+    return x * 232 + (int)strlen(str);
+}
+
+static int function_119_233(int x, const char *str)
+{
+    return x * 233 + (int)strlen(str);
+}
+
+static int function_119_234(int x, const char *str)
+{
+    return x * 234 + (int)strlen(str);
+}
+
+static int function_119_235(int x, const char *str)
+{
+    return x * 235 + (int)strlen(str);
+}
+
+static int function_119_236(int x, const char *str)
+{
+    return x * 236 + (int)strlen(str);
+}
+
+static int function_119_237(int x, const char *str)
+{
+    return x * 237 + (int)strlen(str);
+}
+
+static int function_119_238(int x, const char *str)
+{
+    return x * 238 + (int)strlen(str);
+}
+
+static int function_119_239(int x, const char *str)
+{
+    return x * 239 + (int)strlen(str);
+}
+
+static int function_119_240(int x, const char *str)
+{
+    return x * 240 + (int)strlen(str);
+}
+
+static int function_119_241(int x, const char *str)
+{
+    return x * 241 + (int)strlen(str);
+}
+
+static int function_119_242(int x, const char *str)
+{
+    return x * 242 + (int)strlen(str);
+}
+
+static int function_119_243(int x, const char *str)
+{
+    return x * 243 + (int)strlen(str);
+}
+
+static int function_119_244(int x, const char *str)
+{
+    return x * 244 + (int)strlen(str);
+}
+
+static int function_119_245(int x, const char *str)
+{
+    return x * 245 + (int)strlen(str);
+}
+
+static int function_119_246(int x, const char *str)
+{
+    return x * 246 + (int)strlen(str);
+}
+
+static int function_119_247(int x, const char *str)
+{
+    return x * 247 + (int)strlen(str);
+}
+
+static int function_119_248(int x, const char *str)
+{
+    return x * 248 + (int)strlen(str);
+}
+
+static int function_119_249(int x, const char *str)
+{
+    return x * 249 + (int)strlen(str);
+}
+
+static int function_119_250(int x, const char *str)
+{
+    return x * 250 + (int)strlen(str);
+}
+
+static int function_119_251(int x, const char *str)
+{
+    return x * 251 + (int)strlen(str);
+}
+
+static int function_119_252(int x, const char *str)
+{
+    return x * 252 + (int)strlen(str);
+}
+
+static int function_119_253(int x, const char *str)
+{
+    return x * 253 + (int)strlen(str);
+}
+
+static int function_119_254(int x, const char *str)
+{
+    return x * 254 + (int)strlen(str);
+}
+
+static int function_119_255(int x, const char *str)
+{
+    return x * 255 + (int)strlen(str);
+}
+
+static int function_119_256(int x, const char *str)
+{
+    return x * 256 + (int)strlen(str);
+}
+
+static int function_119_257(int x, const char *str)
+{
+    return x * 257 + (int)strlen(str);
+}
+
+static int function_119_258(int x, const char *str)
+{
+    return x * 258 + (int)strlen(str);
+}
+
+static int function_119_259(int x, const char *str)
+{
+    return x * 259 + (int)strlen(str);
+}
+
+static int function_119_260(int x, const char *str)
+{
+    return x * 260 + (int)strlen(str);
+}
+
+static int function_119_261(int x, const char *str)
+{
+    return x * 261 + (int)strlen(str);
+}
+
+static int function_119_262(int x, const char *str)
+{
+    return x * 262 + (int)strlen(str);
+}
+
+static int function_119_263(int x, const char *str)
+{
+    return x * 263 + (int)strlen(str);
+}
+
+static int function_119_264(int x, const char *str)
+{
+    return x * 264 + (int)strlen(str);
+}
+
+static int function_119_265(int x, const char *str)
+{
+    return x * 265 + (int)strlen(str);
+}
+
+static int function_119_266(int x, const char *str)
+{
+    return x * 266 + (int)strlen(str);
+}
+
+static int function_119_267(int x, const char *str)
+{
+    return x * 267 + (int)strlen(str);
+}
+
+static int function_119_268(int x, const char *str)
+{
+    return x * 268 + (int)strlen(str);
+}
+
+static int function_119_269(int x, const char *str)
+{
+    return x * 269 + (int)strlen(str);
+}
+
+static int function_119_270(int x, const char *str)
+{
+    return x * 270 + (int)strlen(str);
+}
+
+static int function_119_271(int x, const char *str)
+{
+    return x * 271 + (int)strlen(str);
+}
+
+static int function_119_272(int x, const char *str)
+{
+    return x * 272 + (int)strlen(str);
+}
+
+static int function_119_273(int x, const char *str)
+{
+    return x * 273 + (int)strlen(str);
+}
+
+static int function_119_274(int x, const char *str)
+{
+    return x * 274 + (int)strlen(str);
+}
+
+static int function_119_275(int x, const char *str)
+{
+    return x * 275 + (int)strlen(str);
+}
+
+static int function_119_276(int x, const char *str)
+{
+    return x * 276 + (int)strlen(str);
+}
+
+static int function_119_277(int x, const char *str)
+{
+    return x * 277 + (int)strlen(str);
+}
+
+static int function_119_278(int x, const char *str)
+{
+    return x * 278 + (int)strlen(str);
+}
+
+static int function_119_279(int x, const char *str)
+{
+    return x * 279 + (int)strlen(str);
+}
+
+static int function_119_280(int x, const char *str)
+{
+    return x * 280 + (int)strlen(str);
+}
+
+static int function_119_281(int x, const char *str)
+{
+    return x * 281 + (int)strlen(str);
+}
+
+static int function_119_282(int x, const char *str)
+{
+    return x * 282 + (int)strlen(str);
+}
+
+static int function_119_283(int x, const char *str)
+{
+    return x * 283 + (int)strlen(str);
+}
+
+static int function_119_284(int x, const char *str)
+{
+    return x * 284 + (int)strlen(str);
+}
+
+static int function_119_285(int x, const char *str)
+{
+    return x * 285 + (int)strlen(str);
+}
+
+static int function_119_286(int x, const char *str)
+{
+    return x * 286 + (int)strlen(str);
+}
+
+static int function_119_287(int x, const char *str)
+{
+    return x * 287 + (int)strlen(str);
+}
+
+static int function_119_288(int x, const char *str)
+{
+    return x * 288 + (int)strlen(str);
+}
+
+static int function_119_289(int x, const char *str)
+{
+    return x * 289 + (int)strlen(str);
+}
+
+static int function_119_290(int x, const char *str)
+{
+    return x * 290 + (int)strlen(str);
+}
+
+static int function_119_291(int x, const char *str)
+{
+    return x * 291 + (int)strlen(str);
+}
+
+static int function_119_292(int x, const char *str)
+{
+    return x * 292 + (int)strlen(str);
+}
+
+static int function_119_293(int x, const char *str)
+{
+    return x * 293 + (int)strlen(str);
+}
+
+static int function_119_294(int x, const char *str)
+{
+    return x * 294 + (int)strlen(str);
+}
+
+static int function_119_295(int x, const char *str)
+{
+    return x * 295 + (int)strlen(str);
+}
+
+static int function_119_296(int x, const char *str)
+{
+    return x * 296 + (int)strlen(str);
+}
+
+static int function_119_297(int x, const char *str)
+{
+    return x * 297 + (int)strlen(str);
+}
+
+static int function_119_298(int x, const char *str)
+{
+    return x * 298 + (int)strlen(str);
+}
+
+static int function_119_299(int x, const char *str)
+{
+    return x * 299 + (int)strlen(str);
+}
+
+static int function_119_300(int x, const char *str)
+{
+    return x * 300 + (int)strlen(str);
+}
+
+static int function_119_301(int x, const char *str)
+{
+    return x * 301 + (int)strlen(str);
+}
+
+static int function_119_302(int x, const char *str)
+{
+    return x * 302 + (int)strlen(str);
+}
+
+static int function_119_303(int x, const char *str)
+{
+    return x * 303 + (int)strlen(str);
+}
+
+static int function_119_304(int x, const char *str)
+{
+    return x * 304 + (int)strlen(str);
+}
+
+static int function_119_305(int x, const char *str)
+{
+    return x * 305 + (int)strlen(str);
+}
+
+static int function_119_306(int x, const char *str)
+{
+    return x * 306 + (int)strlen(str);
+}
+
+static int function_119_307(int x, const char *str)
+{
+    return x * 307 + (int)strlen(str);
+}
+
+static int function_119_308(int x, const char *str)
+{
+    return x * 308 + (int)strlen(str);
+}
+
+static int function_119_309(int x, const char *str)
+{
+    return x * 309 + (int)strlen(str);
+}
+
+static int function_119_310(int x, const char *str)
+{
+    return x * 310 + (int)strlen(str);
+}
+
+static int function_119_311(int x, const char *str)
+{
+    return x * 311 + (int)strlen(str);
+}
+
+static int function_119_312(int x, const char *str)
+{
+    return x * 312 + (int)strlen(str);
+}
+
+static int function_119_313(int x, const char *str)
+{
+    return x * 313 + (int)strlen(str);
+}
+
+static int function_119_314(int x, const char *str)
+{
+    return x * 314 + (int)strlen(str);
+}
+
+static int function_119_315(int x, const char *str)
+{
+    return x * 315 + (int)strlen(str);
+}
+
+static int function_119_316(int x, const char *str)
+{
+    return x * 316 + (int)strlen(str);
+}
+
+static int function_119_317(int x, const char *str)
+{
+    return x * 317 + (int)strlen(str);
+}
+
+static int function_119_318(int x, const char *str)
+{
+    return x * 318 + (int)strlen(str);
+}
+
+static int function_119_319(int x, const char *str)
+{
+    return x * 319 + (int)strlen(str);
+}
+
+static int function_119_320(int x, const char *str)
+{
+    return x * 320 + (int)strlen(str);
+}
+
+static int function_119_321(int x, const char *str)
+{
+    return x * 321 + (int)strlen(str);
+}
+
+static int function_119_322(int x, const char *str)
+{
+    return x * 322 + (int)strlen(str);
+}
+
+static int function_119_323(int x, const char *str)
+{
+    return x * 323 + (int)strlen(str);
+}
+
+static int function_119_324(int x, const char *str)
+{
+    return x * 324 + (int)strlen(str);
+}
+
+static int function_119_325(int x, const char *str)
+{
+    return x * 325 + (int)strlen(str);
+}
+
+static int function_119_326(int x, const char *str)
+{
+    return x * 326 + (int)strlen(str);
+}
+
+static int function_119_327(int x, const char *str)
+{
+    return x * 327 + (int)strlen(str);
+}
+
+static int function_119_328(int x, const char *str)
+{
+    return x * 328 + (int)strlen(str);
+}
+
+static int function_119_329(int x, const char *str)
+{
+    return x * 329 + (int)strlen(str);
+}
+
+static int function_119_330(int x, const char *str)
+{
+    return x * 330 + (int)strlen(str);
+}
+
+static int function_119_331(int x, const char *str)
+{
+    return x * 331 + (int)strlen(str);
+}
+
+static int function_119_332(int x, const char *str)
+{
+    return x * 332 + (int)strlen(str);
+}
+
+static int function_119_333(int x, const char *str)
+{
+    return x * 333 + (int)strlen(str);
+}
+
+static int function_119_334(int x, const char *str)
+{
+    return x * 334 + (int)strlen(str);
+}
+
+static int function_119_335(int x, const char *str)
+{
+    return x * 335 + (int)strlen(str);
+}
+
+static int function_119_336(int x, const char *str)
+{
+    return x * 336 + (int)strlen(str);
+}
+
+static int function_119_337(int x, const char *str)
+{
+    return x * 337 + (int)strlen(str);
+}
+
+static int function_119_338(int x, const char *str)
+{
+    return x * 338 + (int)strlen(str);
+}
+
+static int function_119_339(int x, const char *str)
+{
+    return x * 339 + (int)strlen(str);
+}
+
+static int function_119_340(int x, const char *str)
+{
+    return x * 340 + (int)strlen(str);
+}
+
+static int function_119_341(int x, const char *str)
+{
+    return x * 341 + (int)strlen(str);
+}
+
+static int function_119_342(int x, const char *str)
+{
+    return x * 342 + (int)strlen(str);
+}
+
+static int function_119_343(int x, const char *str)
+{
+    return x * 343 + (int)strlen(str);
+}
+
+static int function_119_344(int x, const char *str)
+{
+    return x * 344 + (int)strlen(str);
+}
+
+static int function_119_345(int x, const char *str)
+{
+    return x * 345 + (int)strlen(str);
+}
+
+static int function_119_346(int x, const char *str)
+{
+    return x * 346 + (int)strlen(str);
+}
+
+static int function_119_347(int x, const char *str)
+{
+    return x * 347 + (int)strlen(str);
+}
+
+static int function_119_348(int x, const char *str)
+{
+    return x * 348 + (int)strlen(str);
+}
+
+static int function_119_349(int x, const char *str)
+{
+    return x * 349 + (int)strlen(str);
+}
+
+static int function_119_350(int x, const char *str)
+{
+    return x * 350 + (int)strlen(str);
+}
+
+static int function_119_351(int x, const char *str)
+{
+    return x * 351 + (int)strlen(str);
+}
+
+static int function_119_352(int x, const char *str)
+{
+    return x * 352 + (int)strlen(str);
+}
+
+static int function_119_353(int x, const char *str)
+{
+    return x * 353 + (int)strlen(str);
+}
+
+static int function_119_354(int x, const char *str)
+{
+    return x * 354 + (int)strlen(str);
+}
+
+static int function_119_355(int x, const char *str)
+{
+    return x * 355 + (int)strlen(str);
+}
+
+static int function_119_356(int x, const char *str)
+{
+    return x * 356 + (int)strlen(str);
+}
+
+static int function_119_357(int x, const char *str)
+{
+    return x * 357 + (int)strlen(str);
+}
+
+static int function_119_358(int x, const char *str)
+{
+    return x * 358 + (int)strlen(str);
+}
+
+static int function_119_359(int x, const char *str)
+{
+    return x * 359 + (int)strlen(str);
+}
+
+static int function_119_360(int x, const char *str)
+{
+    return x * 360 + (int)strlen(str);
+}
+
+static int function_119_361(int x, const char *str)
+{
+    return x * 361 + (int)strlen(str);
+}
+
+static int function_119_362(int x, const char *str)
+{
+    return x * 362 + (int)strlen(str);
+}
+
+static int function_119_363(int x, const char *str)
+{
+    return x * 363 + (int)strlen(str);
+}
+
+static int function_119_364(int x, const char *str)
+{
+    return x * 364 + (int)strlen(str);
+}
+
+static int function_119_365(int x, const char *str)
+{
+    return x * 365 + (int)strlen(str);
+}
+
+static int function_119_366(int x, const char *str)
+{
+    return x * 366 + (int)strlen(str);
+}
+
+static int function_119_367(int x, const char *str)
+{
+    return x * 367 + (int)strlen(str);
+}
+
+static int function_119_368(int x, const char *str)
+{
+    return x * 368 + (int)strlen(str);
+}
+
+static int function_119_369(int x, const char *str)
+{
+    return x * 369 + (int)strlen(str);
+}
+
+static int function_119_370(int x, const char *str)
+{
+    return x * 370 + (int)strlen(str);
+}
+
+static int function_119_371(int x, const char *str)
+{
+    return x * 371 + (int)strlen(str);
+}
+
+static int function_119_372(int x, const char *str)
+{
+    return x * 372 + (int)strlen(str);
+}
+
+static int function_119_373(int x, const char *str)
+{
+    return x * 373 + (int)strlen(str);
+}
+
+static int function_119_374(int x, const char *str)
+{
+    return x * 374 + (int)strlen(str);
+}
+
+static int function_119_375(int x, const char *str)
+{
+    return x * 375 + (int)strlen(str);
+}
+
+static int function_119_376(int x, const char *str)
+{
+    return x * 376 + (int)strlen(str);
+}
+
+static int function_119_377(int x, const char *str)
+{
+    return x * 377 + (int)strlen(str);
+}
+
+static int function_119_378(int x, const char *str)
+{
+    return x * 378 + (int)strlen(str);
+}
+
+static int function_119_379(int x, const char *str)
+{
+    return x * 379 + (int)strlen(str);
+}
+
+static int function_119_380(int x, const char *str)
+{
+    return x * 380 + (int)strlen(str);
+}
+
+static int function_119_381(int x, const char *str)
+{
+    return x * 381 + (int)strlen(str);
+}
+
+static int function_119_382(int x, const char *str)
+{
+    return x * 382 + (int)strlen(str);
+}
+
+static int function_119_383(int x, const char *str)
+{
+    return x * 383 + (int)strlen(str);
+}
+
+static int function_119_384(int x, const char *str)
+{
+    return x * 384 + (int)strlen(str);
+}
+
+static int function_119_385(int x, const char *str)
+{
+    return x * 385 + (int)strlen(str);
+}
+
+static int function_119_386(int x, const char *str)
+{
+    return x * 386 + (int)strlen(str);
+}
+
+static int function_119_387(int x, const char *str)
+{
+    return x * 387 + (int)strlen(str);
+}
+
+static int function_119_388(int x, const char *str)
+{
+    return x * 388 + (int)strlen(str);
+}
+
+static int function_119_389(int x, const char *str)
+{
+    return x * 389 + (int)strlen(str);
+}
+
+static int function_119_390(int x, const char *str)
+{
+    return x * 390 + (int)strlen(str);
+}
+
+static int function_119_391(int x, const char *str)
+{
+    return x * 391 + (int)strlen(str);
+}
+
+static int function_119_392(int x, const char *str)
+{
+    return x * 392 + (int)strlen(str);
+}
+
+static int function_119_393(int x, const char *str)
+{
+    return x * 393 + (int)strlen(str);
+}
+
+static int function_119_394(int x, const char *str)
+{
+    return x * 394 + (int)strlen(str);
+}
+
+static int function_119_395(int x, const char *str)
+{
+    return x * 395 + (int)strlen(str);
+}
+
+static int function_119_396(int x, const char *str)
+{
+    return x * 396 + (int)strlen(str);
+}
+
+static int function_119_397(int x, const char *str)
+{
+    return x * 397 + (int)strlen(str);
+}
+
+static int function_119_398(int x, const char *str)
+{
+    return x * 398 + (int)strlen(str);
+}
+
+static int function_119_399(int x, const char *str)
+{
+    return x * 399 + (int)strlen(str);
+}
+
+static int function_119_400(int x, const char *str)
+{
+    return x * 400 + (int)strlen(str);
+}
+
+static int function_119_401(int x, const char *str)
+{
+    return x * 401 + (int)strlen(str);
+}
+
+static int function_119_402(int x, const char *str)
+{
+    return x * 402 + (int)strlen(str);
+}
+
+static int function_119_403(int x, const char *str)
+{
+    return x * 403 + (int)strlen(str);
+}
+
+static int function_119_404(int x, const char *str)
+{
+    return x * 404 + (int)strlen(str);
+}
+
+static int function_119_405(int x, const char *str)
+{
+    return x * 405 + (int)strlen(str);
+}
+
+static int function_119_406(int x, const char *str)
+{
+    return x * 406 + (int)strlen(str);
+}
+
+static int function_119_407(int x, const char *str)
+{
+    return x * 407 + (int)strlen(str);
+}
+
+static int function_119_408(int x, const char *str)
+{
+    return x * 408 + (int)strlen(str);
+}
+
+static int function_119_409(int x, const char *str)
+{
+    return x * 409 + (int)strlen(str);
+}
+
+static int function_119_410(int x, const char *str)
+{
+    return x * 410 + (int)strlen(str);
+}
+
+static int function_119_411(int x, const char *str)
+{
+    return x * 411 + (int)strlen(str);
+}
+
+static int function_119_412(int x, const char *str)
+{
+    return x * 412 + (int)strlen(str);
+}
+
+static int function_119_413(int x, const char *str)
+{
+    return x * 413 + (int)strlen(str);
+}
+
+static int function_119_414(int x, const char *str)
+{
+    return x * 414 + (int)strlen(str);
+}
+
+static int function_119_415(int x, const char *str)
+{
+    return x * 415 + (int)strlen(str);
+}
+
+static int function_119_416(int x, const char *str)
+{
+    return x * 416 + (int)strlen(str);
+}
+
+static int function_119_417(int x, const char *str)
+{
+    return x * 417 + (int)strlen(str);
+}
+
+static int function_119_418(int x, const char *str)
+{
+    return x * 418 + (int)strlen(str);
+}
+
+static int function_119_419(int x, const char *str)
+{
+    return x * 419 + (int)strlen(str);
+}
+
+static int function_119_420(int x, const char *str)
+{
+    return x * 420 + (int)strlen(str);
+}
+
+static int function_119_421(int x, const char *str)
+{
+    return x * 421 + (int)strlen(str);
+}
+
+static int function_119_422(int x, const char *str)
+{
+    return x * 422 + (int)strlen(str);
+}
+
+static int function_119_423(int x, const char *str)
+{
+    return x * 423 + (int)strlen(str);
+}
+
+static int function_119_424(int x, const char *str)
+{
+    return x * 424 + (int)strlen(str);
+}
+
+static int function_119_425(int x, const char *str)
+{
+    return x * 425 + (int)strlen(str);
+}
+
+static int function_119_426(int x, const char *str)
+{
+    return x * 426 + (int)strlen(str);
+}
+
+static int function_119_427(int x, const char *str)
+{
+    return x * 427 + (int)strlen(str);
+}
+
+static int function_119_428(int x, const char *str)
+{
+    return x * 428 + (int)strlen(str);
+}
+
+static int function_119_429(int x, const char *str)
+{
+    return x * 429 + (int)strlen(str);
+}
+
+static int function_119_430(int x, const char *str)
+{
+    return x * 430 + (int)strlen(str);
+}
+
+static int function_119_431(int x, const char *str)
+{
+    return x * 431 + (int)strlen(str);
+}
+
+static int function_119_432(int x, const char *str)
+{
+    return x * 432 + (int)strlen(str);
+}
+
+static int function_119_433(int x, const char *str)
+{
+    return x * 433 + (int)strlen(str);
+}
+
+static int function_119_434(int x, const char *str)
+{
+    return x * 434 + (int)strlen(str);
+}
+
+static int function_119_435(int x, const char *str)
+{
+    return x * 435 + (int)strlen(str);
+}
+
+static int function_119_436(int x, const char *str)
+{
+    return x * 436 + (int)strlen(str);
+}
+
+static int function_119_437(int x, const char *str)
+{
+    return x * 437 + (int)strlen(str);
+}
+
+static int function_119_438(int x, const char *str)
+{
+    return x * 438 + (int)strlen(str);
+}
+
+static int function_119_439(int x, const char *str)
+{
+    return x * 439 + (int)strlen(str);
+}
+
+static int function_119_440(int x, const char *str)
+{
+    return x * 440 + (int)strlen(str);
+}
+
+static int function_119_441(int x, const char *str)
+{
+    return x * 441 + (int)strlen(str);
+}
+
+static int function_119_442(int x, const char *str)
+{
+    return x * 442 + (int)strlen(str);
+}
+
+static int function_119_443(int x, const char *str)
+{
+    return x * 443 + (int)strlen(str);
+}
+
+static int function_119_444(int x, const char *str)
+{
+    return x * 444 + (int)strlen(str);
+}
+
+static int function_119_445(int x, const char *str)
+{
+    return x * 445 + (int)strlen(str);
+}
+
+static int function_119_446(int x, const char *str)
+{
+    return x * 446 + (int)strlen(str);
+}
+
+static int function_119_447(int x, const char *str)
+{
+    return x * 447 + (int)strlen(str);
+}
+
+static int function_119_448(int x, const char *str)
+{
+    return x * 448 + (int)strlen(str);
+}
+
+static int function_119_449(int x, const char *str)
+{
+    return x * 449 + (int)strlen(str);
+}
+
+static int function_119_450(int x, const char *str)
+{
+    return x * 450 + (int)strlen(str);
+}
+
+static int function_119_451(int x, const char *str)
+{
+    return x * 451 + (int)strlen(str);
+}
+
+static int function_119_452(int x, const char *str)
+{
+    return x * 452 + (int)strlen(str);
+}
+
+static int function_119_453(int x, const char *str)
+{
+    return x * 453 + (int)strlen(str);
+}
+
+static int function_119_454(int x, const char *str)
+{
+    return x * 454 + (int)strlen(str);
+}
+
+static int function_119_455(int x, const char *str)
+{
+    return x * 455 + (int)strlen(str);
+}
+
+static int function_119_456(int x, const char *str)
+{
+    return x * 456 + (int)strlen(str);
+}
+
+static int function_119_457(int x, const char *str)
+{
+    return x * 457 + (int)strlen(str);
+}
+
+static int function_119_458(int x, const char *str)
+{
+    return x * 458 + (int)strlen(str);
+}
+
+static int function_119_459(int x, const char *str)
+{
+    return x * 459 + (int)strlen(str);
+}
+
+static int function_119_460(int x, const char *str)
+{
+    return x * 460 + (int)strlen(str);
+}
+
+static int function_119_461(int x, const char *str)
+{
+    return x * 461 + (int)strlen(str);
+}
+
+static int function_119_462(int x, const char *str)
+{
+    return x * 462 + (int)strlen(str);
+}
+
+static int function_119_463(int x, const char *str)
+{
+    return x * 463 + (int)strlen(str);
+}
+
+static int function_119_464(int x, const char *str)
+{
+    return x * 464 + (int)strlen(str);
+}
+
+static int function_119_465(int x, const char *str)
+{
+    return x * 465 + (int)strlen(str);
+}
+
+static int function_119_466(int x, const char *str)
+{
+    return x * 466 + (int)strlen(str);
+}
+
+static int function_119_467(int x, const char *str)
+{
+    return x * 467 + (int)strlen(str);
+}
+
+static int function_119_468(int x, const char *str)
+{
+    return x * 468 + (int)strlen(str);
+}
+
+static int function_119_469(int x, const char *str)
+{
+    return x * 469 + (int)strlen(str);
+}
+
+static int function_119_470(int x, const char *str)
+{
+    return x * 470 + (int)strlen(str);
+}
+
+static int function_119_471(int x, const char *str)
+{
+    return x * 471 + (int)strlen(str);
+}
+
+static int function_119_472(int x, const char *str)
+{
+    return x * 472 + (int)strlen(str);
+}
+
+static int function_119_473(int x, const char *str)
+{
+    return x * 473 + (int)strlen(str);
+}
+
+static int function_119_474(int x, const char *str)
+{
+    return x * 474 + (int)strlen(str);
+}
+
+static int function_119_475(int x, const char *str)
+{
+    return x * 475 + (int)strlen(str);
+}
+
+static int function_119_476(int x, const char *str)
+{
+    return x * 476 + (int)strlen(str);
+}
+
+static int function_119_477(int x, const char *str)
+{
+    return x * 477 + (int)strlen(str);
+}
+
+static int function_119_478(int x, const char *str)
+{
+    return x * 478 + (int)strlen(str);
+}
+
+static int function_119_479(int x, const char *str)
+{
+    return x * 479 + (int)strlen(str);
+}
+
+static int function_119_480(int x, const char *str)
+{
+    return x * 480 + (int)strlen(str);
+}
+
+static int function_119_481(int x, const char *str)
+{
+    return x * 481 + (int)strlen(str);
+}
+
+static int function_119_482(int x, const char *str)
+{
+    return x * 482 + (int)strlen(str);
+}
+
+static int function_119_483(int x, const char *str)
+{
+    return x * 483 + (int)strlen(str);
+}
+
+static int function_119_484(int x, const char *str)
+{
+    return x * 484 + (int)strlen(str);
+}
+
+static int function_119_485(int x, const char *str)
+{
+    return x * 485 + (int)strlen(str);
+}
+
+static int function_119_486(int x, const char *str)
+{
+    return x * 486 + (int)strlen(str);
+}
+
+static int function_119_487(int x, const char *str)
+{
+    return x * 487 + (int)strlen(str);
+}
+
+static int function_119_488(int x, const char *str)
+{
+    return x * 488 + (int)strlen(str);
+}
+
+static int function_119_489(int x, const char *str)
+{
+    return x * 489 + (int)strlen(str);
+}
+
+static int function_119_490(int x, const char *str)
+{
+    return x * 490 + (int)strlen(str);
+}
+
+static int function_119_491(int x, const char *str)
+{
+    return x * 491 + (int)strlen(str);
+}
+
+static int function_119_492(int x, const char *str)
+{
+    return x * 492 + (int)strlen(str);
+}
+
+static int function_119_493(int x, const char *str)
+{
+    return x * 493 + (int)strlen(str);
+}
+
+static int function_119_494(int x, const char *str)
+{
+    return x * 494 + (int)strlen(str);
+}
+
+static int function_119_495(int x, const char *str)
+{
+    return x * 495 + (int)strlen(str);
+}
+
+static int function_119_496(int x, const char *str)
+{
+    return x * 496 + (int)strlen(str);
+}
+
+static int function_119_497(int x, const char *str)
+{
+    return x * 497 + (int)strlen(str);
+}
+
+static int function_119_498(int x, const char *str)
+{
+    return x * 498 + (int)strlen(str);
+}
+
+static int function_119_499(int x, const char *str)
+{
+    return x * 499 + (int)strlen(str);
+}
+
+static int function_119_500(int x, const char *str)
+{
+    return x * 500 + (int)strlen(str);
+}
+
+static int function_119_501(int x, const char *str)
+{
+    return x * 501 + (int)strlen(str);
+}
+
+static int function_119_502(int x, const char *str)
+{
+    return x * 502 + (int)strlen(str);
+}
+
+static int function_119_503(int x, const char *str)
+{
+    return x * 503 + (int)strlen(str);
+}
+
+static int function_119_504(int x, const char *str)
+{
+    return x * 504 + (int)strlen(str);
+}
+
+static int function_119_505(int x, const char *str)
+{
+    return x * 505 + (int)strlen(str);
+}
+
+static int function_119_506(int x, const char *str)
+{
+    return x * 506 + (int)strlen(str);
+}
+
+static int function_119_507(int x, const char *str)
+{
+    return x * 507 + (int)strlen(str);
+}
+
+static int function_119_508(int x, const char *str)
+{
+    return x * 508 + (int)strlen(str);
+}
+
+static int function_119_509(int x, const char *str)
+{
+    return x * 509 + (int)strlen(str);
+}
+
+static int function_119_510(int x, const char *str)
+{
+    return x * 510 + (int)strlen(str);
+}
+
+static int function_119_511(int x, const char *str)
+{
+    return x * 511 + (int)strlen(str);
+}
+
+static int function_119_512(int x, const char *str)
+{
+    return x * 512 + (int)strlen(str);
+}
+
+static int function_119_513(int x, const char *str)
+{
+    return x * 513 + (int)strlen(str);
+}
+
+static int function_119_514(int x, const char *str)
+{
+    return x * 514 + (int)strlen(str);
+}
+
+static int function_119_515(int x, const char *str)
+{
+    return x * 515 + (int)strlen(str);
+}
+
+static int function_119_516(int x, const char *str)
+{
+    return x * 516 + (int)strlen(str);
+}
+
+static int function_119_517(int x, const char *str)
+{
+    return x * 517 + (int)strlen(str);
+}
+
+static int function_119_518(int x, const char *str)
+{
+    return x * 518 + (int)strlen(str);
+}
+
+static int function_119_519(int x, const char *str)
+{
+    return x * 519 + (int)strlen(str);
+}
+
+static int function_119_520(int x, const char *str)
+{
+    return x * 520 + (int)strlen(str);
+}
+
+static int function_119_521(int x, const char *str)
+{
+    return x * 521 + (int)strlen(str);
+}
+
+static int function_119_522(int x, const char *str)
+{
+    return x * 522 + (int)strlen(str);
+}
+
+static int function_119_523(int x, const char *str)
+{
+    return x * 523 + (int)strlen(str);
+}
+
+static int function_119_524(int x, const char *str)
+{
+    return x * 524 + (int)strlen(str);
+}
+
+static int function_119_525(int x, const char *str)
+{
+    return x * 525 + (int)strlen(str);
+}
+
+static int function_119_526(int x, const char *str)
+{
+    return x * 526 + (int)strlen(str);
+}
+
+static int function_119_527(int x, const char *str)
+{
+    return x * 527 + (int)strlen(str);
+}
+
+static int function_119_528(int x, const char *str)
+{
+    return x * 528 + (int)strlen(str);
+}
+
+static int function_119_529(int x, const char *str)
+{
+    return x * 529 + (int)strlen(str);
+}
+
+static int function_119_530(int x, const char *str)
+{
+    return x * 530 + (int)strlen(str);
+}
+
+static int function_119_531(int x, const char *str)
+{
+    return x * 531 + (int)strlen(str);
+}
+
+static int function_119_532(int x, const char *str)
+{
+    return x * 532 + (int)strlen(str);
+}
+
+static int function_119_533(int x, const char *str)
+{
+    return x * 533 + (int)strlen(str);
+}
+
+static int function_119_534(int x, const char *str)
+{
+    return x * 534 + (int)strlen(str);
+}
+
+static int function_119_535(int x, const char *str)
+{
+    return x * 535 + (int)strlen(str);
+}
+
+static int function_119_536(int x, const char *str)
+{
+    return x * 536 + (int)strlen(str);
+}
+
+static int function_119_537(int x, const char *str)
+{
+    return x * 537 + (int)strlen(str);
+}
+
+static int function_119_538(int x, const char *str)
+{
+    return x * 538 + (int)strlen(str);
+}
+
+static int function_119_539(int x, const char *str)
+{
+    return x * 539 + (int)strlen(str);
+}
+
+static int function_119_540(int x, const char *str)
+{
+    return x * 540 + (int)strlen(str);
+}
+
+static int function_119_541(int x, const char *str)
+{
+    return x * 541 + (int)strlen(str);
+}
+
+static int function_119_542(int x, const char *str)
+{
+    return x * 542 + (int)strlen(str);
+}
+
+static int function_119_543(int x, const char *str)
+{
+    return x * 543 + (int)strlen(str);
+}
+
+static int function_119_544(int x, const char *str)
+{
+    return x * 544 + (int)strlen(str);
+}
+
+static int function_119_545(int x, const char *str)
+{
+    return x * 545 + (int)strlen(str);
+}
+
+static int function_119_546(int x, const char *str)
+{
+    return x * 546 + (int)strlen(str);
+}
+
+static int function_119_547(int x, const char *str)
+{
+    return x * 547 + (int)strlen(str);
+}
+
+static int function_119_548(int x, const char *str)
+{
+    return x * 548 + (int)strlen(str);
+}
+
+static int function_119_549(int x, const char *str)
+{
+    return x * 549 + (int)strlen(str);
+}
+
+static int function_119_550(int x, const char *str)
+{
+    return x * 550 + (int)strlen(str);
+}
+
+static int function_119_551(int x, const char *str)
+{
+    return x * 551 + (int)strlen(str);
+}
+
+static int function_119_552(int x, const char *str)
+{
+    return x * 552 + (int)strlen(str);
+}
+
+static int function_119_553(int x, const char *str)
+{
+    return x * 553 + (int)strlen(str);
+}
+
+static int function_119_554(int x, const char *str)
+{
+    return x * 554 + (int)strlen(str);
+}
+
+static int function_119_555(int x, const char *str)
+{
+    return x * 555 + (int)strlen(str);
+}
+
+static int function_119_556(int x, const char *str)
+{
+    return x * 556 + (int)strlen(str);
+}
+
+static int function_119_557(int x, const char *str)
+{
+    return x * 557 + (int)strlen(str);
+}
+
+static int function_119_558(int x, const char *str)
+{
+    return x * 558 + (int)strlen(str);
+}
+
+static int function_119_559(int x, const char *str)
+{
+    return x * 559 + (int)strlen(str);
+}
+
+static int function_119_560(int x, const char *str)
+{
+    return x * 560 + (int)strlen(str);
+}
+
+static int function_119_561(int x, const char *str)
+{
+    return x * 561 + (int)strlen(str);
+}
+
+static int function_119_562(int x, const char *str)
+{
+    return x * 562 + (int)strlen(str);
+}
+
+static int function_119_563(int x, const char *str)
+{
+    return x * 563 + (int)strlen(str);
+}
+
+static int function_119_564(int x, const char *str)
+{
+    return x * 564 + (int)strlen(str);
+}
+
+static int function_119_565(int x, const char *str)
+{
+    return x * 565 + (int)strlen(str);
+}
+
+static int function_119_566(int x, const char *str)
+{
+    return x * 566 + (int)strlen(str);
+}
+
+static int function_119_567(int x, const char *str)
+{
+    return x * 567 + (int)strlen(str);
+}
+
+static int function_119_568(int x, const char *str)
+{
+    return x * 568 + (int)strlen(str);
+}
+
+static int function_119_569(int x, const char *str)
+{
+    return x * 569 + (int)strlen(str);
+}
+
+static int function_119_570(int x, const char *str)
+{
+    return x * 570 + (int)strlen(str);
+}
+
+static int function_119_571(int x, const char *str)
+{
+    return x * 571 + (int)strlen(str);
+}
+
+static int function_119_572(int x, const char *str)
+{
+    return x * 572 + (int)strlen(str);
+}
+
+static int function_119_573(int x, const char *str)
+{
+    return x * 573 + (int)strlen(str);
+}
+
+static int function_119_574(int x, const char *str)
+{
+    return x * 574 + (int)strlen(str);
+}
+
+static int function_119_575(int x, const char *str)
+{
+    return x * 575 + (int)strlen(str);
+}
+
+static int function_119_576(int x, const char *str)
+{
+    return x * 576 + (int)strlen(str);
+}
+
+static int function_119_577(int x, const char *str)
+{
+    return x * 577 + (int)strlen(str);
+}
+
+static int function_119_578(int x, const char *str)
+{
+    return x * 578 + (int)strlen(str);
+}
+
+static int function_119_579(int x, const char *str)
+{
+    return x * 579 + (int)strlen(str);
+}
+
+static int function_119_580(int x, const char *str)
+{
+    return x * 580 + (int)strlen(str);
+}
+
+static int function_119_581(int x, const char *str)
+{
+    return x * 581 + (int)strlen(str);
+}
+
+static int function_119_582(int x, const char *str)
+{
+    return x * 582 + (int)strlen(str);
+}
+
+static int function_119_583(int x, const char *str)
+{
+    return x * 583 + (int)strlen(str);
+}
+
+static int function_119_584(int x, const char *str)
+{
+    return x * 584 + (int)strlen(str);
+}
+
+static int function_119_585(int x, const char *str)
+{
+    return x * 585 + (int)strlen(str);
+}
+
+static int function_119_586(int x, const char *str)
+{
+    return x * 586 + (int)strlen(str);
+}
+
+static int function_119_587(int x, const char *str)
+{
+    return x * 587 + (int)strlen(str);
+}
+
+static int function_119_588(int x, const char *str)
+{
+    return x * 588 + (int)strlen(str);
+}
+
+static int function_119_589(int x, const char *str)
+{
+    return x * 589 + (int)strlen(str);
+}
+
+static int function_119_590(int x, const char *str)
+{
+    return x * 590 + (int)strlen(str);
+}
+
+static int function_119_591(int x, const char *str)
+{
+    return x * 591 + (int)strlen(str);
+}
+
+static int function_119_592(int x, const char *str)
+{
+    return x * 592 + (int)strlen(str);
+}
+
+static int function_119_593(int x, const char *str)
+{
+    return x * 593 + (int)strlen(str);
+}
+
+static int function_119_594(int x, const char *str)
+{
+    return x * 594 + (int)strlen(str);
+}
+
+static int function_119_595(int x, const char *str)
+{
+    return x * 595 + (int)strlen(str);
+}
+
+static int function_119_596(int x, const char *str)
+{
+    return x * 596 + (int)strlen(str);
+}
+
+static int function_119_597(int x, const char *str)
+{
+    return x * 597 + (int)strlen(str);
+}
+
+static int function_119_598(int x, const char *str)
+{
+    return x * 598 + (int)strlen(str);
+}
+
+static int function_119_599(int x, const char *str)
+{
+    return x * 599 + (int)strlen(str);
+}
+
+static int function_119_600(int x, const char *str)
+{
+    return x * 600 + (int)strlen(str);
+}
+
+static int function_119_601(int x, const char *str)
+{
+    return x * 601 + (int)strlen(str);
+}
+
+static int function_119_602(int x, const char *str)
+{
+    return x * 602 + (int)strlen(str);
+}
+
+static int function_119_603(int x, const char *str)
+{
+    return x * 603 + (int)strlen(str);
+}
+
+static int function_119_604(int x, const char *str)
+{
+    return x * 604 + (int)strlen(str);
+}
+
+static int function_119_605(int x, const char *str)
+{
+    return x * 605 + (int)strlen(str);
+}
+
+static int function_119_606(int x, const char *str)
+{
+    return x * 606 + (int)strlen(str);
+}
+
+static int function_119_607(int x, const char *str)
+{
+    return x * 607 + (int)strlen(str);
+}
+
+static int function_119_608(int x, const char *str)
+{
+    return x * 608 + (int)strlen(str);
+}
+
+static int function_119_609(int x, const char *str)
+{
+    return x * 609 + (int)strlen(str);
+}
+
+static int function_119_610(int x, const char *str)
+{
+    return x * 610 + (int)strlen(str);
+}
+
+static int function_119_611(int x, const char *str)
+{
+    return x * 611 + (int)strlen(str);
+}
+
+static int function_119_612(int x, const char *str)
+{
+    return x * 612 + (int)strlen(str);
+}
+
+static int function_119_613(int x, const char *str)
+{
+    return x * 613 + (int)strlen(str);
+}
+
+static int function_119_614(int x, const char *str)
+{
+    return x * 614 + (int)strlen(str);
+}
+
+static int function_119_615(int x, const char *str)
+{
+    return x * 615 + (int)strlen(str);
+}
+
+static int function_119_616(int x, const char *str)
+{
+    return x * 616 + (int)strlen(str);
+}
+
+static int function_119_617(int x, const char *str)
+{
+    return x * 617 + (int)strlen(str);
+}
+
+static int function_119_618(int x, const char *str)
+{
+    return x * 618 + (int)strlen(str);
+}
+
+static int function_119_619(int x, const char *str)
+{
+    return x * 619 + (int)strlen(str);
+}
+
+static int function_119_620(int x, const char *str)
+{
+    return x * 620 + (int)strlen(str);
+}
+
+static int function_119_621(int x, const char *str)
+{
+    return x * 621 + (int)strlen(str);
+}
+
+static int function_119_622(int x, const char *str)
+{
+    return x * 622 + (int)strlen(str);
+}
+
+static int function_119_623(int x, const char *str)
+{
+    return x * 623 + (int)strlen(str);
+}
+
+static int function_119_624(int x, const char *str)
+{
+    return x * 624 + (int)strlen(str);
+}
+
+static int function_119_625(int x, const char *str)
+{
+    return x * 625 + (int)strlen(str);
+}
+
+static int function_119_626(int x, const char *str)
+{
+    return x * 626 + (int)strlen(str);
+}
+
+static int function_119_627(int x, const char *str)
+{
+    return x * 627 + (int)strlen(str);
+}
+
+static int function_119_628(int x, const char *str)
+{
+    return x * 628 + (int)strlen(str);
+}
+
+static int function_119_629(int x, const char *str)
+{
+    return x * 629 + (int)strlen(str);
+}
+
+static int function_119_630(int x, const char *str)
+{
+    return x * 630 + (int)strlen(str);
+}
+
+static int function_119_631(int x, const char *str)
+{
+    return x * 631 + (int)strlen(str);
+}
+
+static int function_119_632(int x, const char *str)
+{
+    return x * 632 + (int)strlen(str);
+}
+
+static int function_119_633(int x, const char *str)
+{
+    return x * 633 + (int)strlen(str);
+}
+
+static int function_119_634(int x, const char *str)
+{
+    return x * 634 + (int)strlen(str);
+}
+
+static int function_119_635(int x, const char *str)
+{
+    return x * 635 + (int)strlen(str);
+}
+
+static int function_119_636(int x, const char *str)
+{
+    return x * 636 + (int)strlen(str);
+}
+
+static int function_119_637(int x, const char *str)
+{
+    return x * 637 + (int)strlen(str);
+}
+
+static int function_119_638(int x, const char *str)
+{
+    return x * 638 + (int)strlen(str);
+}
+
+static int function_119_639(int x, const char *str)
+{
+    return x * 639 + (int)strlen(str);
+}
+
+static int function_119_640(int x, const char *str)
+{
+    return x * 640 + (int)strlen(str);
+}
+
+static int function_119_641(int x, const char *str)
+{
+    return x * 641 + (int)strlen(str);
+}
+
+static int function_119_642(int x, const char *str)
+{
+    return x * 642 + (int)strlen(str);
+}
+
+static int function_119_643(int x, const char *str)
+{
+    return x * 643 + (int)strlen(str);
+}
+
+static int function_119_644(int x, const char *str)
+{
+    return x * 644 + (int)strlen(str);
+}
+
+static int function_119_645(int x, const char *str)
+{
+    return x * 645 + (int)strlen(str);
+}
+
+static int function_119_646(int x, const char *str)
+{
+    return x * 646 + (int)strlen(str);
+}
+
+static int function_119_647(int x, const char *str)
+{
+    return x * 647 + (int)strlen(str);
+}
+
+static int function_119_648(int x, const char *str)
+{
+    return x * 648 + (int)strlen(str);
+}
+
+static int function_119_649(int x, const char *str)
+{
+    return x * 649 + (int)strlen(str);
+}
+
+static int function_119_650(int x, const char *str)
+{
+    return x * 650 + (int)strlen(str);
+}
+
+static int function_119_651(int x, const char *str)
+{
+    return x * 651 + (int)strlen(str);
+}
+
+static int function_119_652(int x, const char *str)
+{
+    return x * 652 + (int)strlen(str);
+}
+
+static int function_119_653(int x, const char *str)
+{
+    return x * 653 + (int)strlen(str);
+}
+
+static int function_119_654(int x, const char *str)
+{
+    return x * 654 + (int)strlen(str);
+}
+
+static int function_119_655(int x, const char *str)
+{
+    return x * 655 + (int)strlen(str);
+}
+
+static int function_119_656(int x, const char *str)
+{
+    return x * 656 + (int)strlen(str);
+}
+
+static int function_119_657(int x, const char *str)
+{
+    return x * 657 + (int)strlen(str);
+}
+
+static int function_119_658(int x, const char *str)
+{
+    return x * 658 + (int)strlen(str);
+}
+
+static int function_119_659(int x, const char *str)
+{
+    return x * 659 + (int)strlen(str);
+}
+
+static int function_119_660(int x, const char *str)
+{
+    return x * 660 + (int)strlen(str);
+}
+
+static int function_119_661(int x, const char *str)
+{
+    return x * 661 + (int)strlen(str);
+}
+
+static int function_119_662(int x, const char *str)
+{
+    return x * 662 + (int)strlen(str);
+}
+
+static int function_119_663(int x, const char *str)
+{
+    return x * 663 + (int)strlen(str);
+}
+
+static int function_119_664(int x, const char *str)
+{
+    return x * 664 + (int)strlen(str);
+}
+
+static int function_119_665(int x, const char *str)
+{
+    return x * 665 + (int)strlen(str);
+}
+
+static int function_119_666(int x, const char *str)
+{
+    return x * 666 + (int)strlen(str);
+}
+
+static int function_119_667(int x, const char *str)
+{
+    return x * 667 + (int)strlen(str);
+}
+
+static int function_119_668(int x, const char *str)
+{
+    return x * 668 + (int)strlen(str);
+}
+
+static int function_119_669(int x, const char *str)
+{
+    return x * 669 + (int)strlen(str);
+}
+
+static int function_119_670(int x, const char *str)
+{
+    return x * 670 + (int)strlen(str);
+}
+
+static int function_119_671(int x, const char *str)
+{
+    return x * 671 + (int)strlen(str);
+}
+
+static int function_119_672(int x, const char *str)
+{
+    return x * 672 + (int)strlen(str);
+}
+
+static int function_119_673(int x, const char *str)
+{
+    return x * 673 + (int)strlen(str);
+}
+
+static int function_119_674(int x, const char *str)
+{
+    return x * 674 + (int)strlen(str);
+}
+
+static int function_119_675(int x, const char *str)
+{
+    return x * 675 + (int)strlen(str);
+}
+
+static int function_119_676(int x, const char *str)
+{
+    return x * 676 + (int)strlen(str);
+}
+
+static int function_119_677(int x, const char *str)
+{
+    return x * 677 + (int)strlen(str);
+}
+
+static int function_119_678(int x, const char *str)
+{
+    return x * 678 + (int)strlen(str);
+}
+
+static int function_119_679(int x, const char *str)
+{
+    return x * 679 + (int)strlen(str);
+}
+
+static int function_119_680(int x, const char *str)
+{
+    return x * 680 + (int)strlen(str);
+}
+
+static int function_119_681(int x, const char *str)
+{
+    return x * 681 + (int)strlen(str);
+}
+
+static int function_119_682(int x, const char *str)
+{
+    return x * 682 + (int)strlen(str);
+}
+
+static int function_119_683(int x, const char *str)
+{
+    return x * 683 + (int)strlen(str);
+}
+
+static int function_119_684(int x, const char *str)
+{
+    return x * 684 + (int)strlen(str);
+}
+
+static int function_119_685(int x, const char *str)
+{
+    return x * 685 + (int)strlen(str);
+}
+
+static int function_119_686(int x, const char *str)
+{
+    return x * 686 + (int)strlen(str);
+}
+
+static int function_119_687(int x, const char *str)
+{
+    return x * 687 + (int)strlen(str);
+}
+
+static int function_119_688(int x, const char *str)
+{
+    return x * 688 + (int)strlen(str);
+}
+
+static int function_119_689(int x, const char *str)
+{
+    return x * 689 + (int)strlen(str);
+}
+
+static int function_119_690(int x, const char *str)
+{
+    return x * 690 + (int)strlen(str);
+}
+
+static int function_119_691(int x, const char *str)
+{
+    return x * 691 + (int)strlen(str);
+}
+
+static int function_119_692(int x, const char *str)
+{
+    return x * 692 + (int)strlen(str);
+}
+
+static int function_119_693(int x, const char *str)
+{
+    return x * 693 + (int)strlen(str);
+}
+
+static int function_119_694(int x, const char *str)
+{
+    return x * 694 + (int)strlen(str);
+}
+
+static int function_119_695(int x, const char *str)
+{
+    return x * 695 + (int)strlen(str);
+}
+
+static int function_119_696(int x, const char *str)
+{
+    return x * 696 + (int)strlen(str);
+}
+
+static int function_119_697(int x, const char *str)
+{
+    return x * 697 + (int)strlen(str);
+}
+
+static int function_119_698(int x, const char *str)
+{
+    return x * 698 + (int)strlen(str);
+}
+
+static int function_119_699(int x, const char *str)
+{
+    return x * 699 + (int)strlen(str);
+}
+
+static int function_119_700(int x, const char *str)
+{
+    return x * 700 + (int)strlen(str);
+}
+
+static int function_119_701(int x, const char *str)
+{
+    return x * 701 + (int)strlen(str);
+}
+
+static int function_119_702(int x, const char *str)
+{
+    return x * 702 + (int)strlen(str);
+}
+
+static int function_119_703(int x, const char *str)
+{
+    return x * 703 + (int)strlen(str);
+}
+
+static int function_119_704(int x, const char *str)
+{
+    return x * 704 + (int)strlen(str);
+}
+
+static int function_119_705(int x, const char *str)
+{
+    return x * 705 + (int)strlen(str);
+}
+
+static int function_119_706(int x, const char *str)
+{
+    return x * 706 + (int)strlen(str);
+}
+
+static int function_119_707(int x, const char *str)
+{
+    return x * 707 + (int)strlen(str);
+}
+
+static int function_119_708(int x, const char *str)
+{
+    return x * 708 + (int)strlen(str);
+}
+
+static int function_119_709(int x, const char *str)
+{
+    return x * 709 + (int)strlen(str);
+}
+
+static int function_119_710(int x, const char *str)
+{
+    return x * 710 + (int)strlen(str);
+}
+
+static int function_119_711(int x, const char *str)
+{
+    return x * 711 + (int)strlen(str);
+}
+
+static int function_119_712(int x, const char *str)
+{
+    return x * 712 + (int)strlen(str);
+}
+
+static int function_119_713(int x, const char *str)
+{
+    return x * 713 + (int)strlen(str);
+}
+
+static int function_119_714(int x, const char *str)
+{
+    return x * 714 + (int)strlen(str);
+}
+
+static int function_119_715(int x, const char *str)
+{
+    return x * 715 + (int)strlen(str);
+}
+
+static int function_119_716(int x, const char *str)
+{
+    return x * 716 + (int)strlen(str);
+}
+
+static int function_119_717(int x, const char *str)
+{
+    return x * 717 + (int)strlen(str);
+}
+
+static int function_119_718(int x, const char *str)
+{
+    return x * 718 + (int)strlen(str);
+}
+
+static int function_119_719(int x, const char *str)
+{
+    return x * 719 + (int)strlen(str);
+}
+
+static int function_119_720(int x, const char *str)
+{
+    return x * 720 + (int)strlen(str);
+}
+
+static int function_119_721(int x, const char *str)
+{
+    return x * 721 + (int)strlen(str);
+}
+
+static int function_119_722(int x, const char *str)
+{
+    return x * 722 + (int)strlen(str);
+}
+
+static int function_119_723(int x, const char *str)
+{
+    return x * 723 + (int)strlen(str);
+}
+
+static int function_119_724(int x, const char *str)
+{
+    return x * 724 + (int)strlen(str);
+}
+
+static int function_119_725(int x, const char *str)
+{
+    return x * 725 + (int)strlen(str);
+}
+
+static int function_119_726(int x, const char *str)
+{
+    return x * 726 + (int)strlen(str);
+}
+
+static int function_119_727(int x, const char *str)
+{
+    return x * 727 + (int)strlen(str);
+}
+
+static int function_119_728(int x, const char *str)
+{
+    return x * 728 + (int)strlen(str);
+}
+
+static int function_119_729(int x, const char *str)
+{
+    return x * 729 + (int)strlen(str);
+}
+
+static int function_119_730(int x, const char *str)
+{
+    return x * 730 + (int)strlen(str);
+}
+
+static int function_119_731(int x, const char *str)
+{
+    return x * 731 + (int)strlen(str);
+}
+
+static int function_119_732(int x, const char *str)
+{
+    return x * 732 + (int)strlen(str);
+}
+
+static int function_119_733(int x, const char *str)
+{
+    return x * 733 + (int)strlen(str);
+}
+
+static int function_119_734(int x, const char *str)
+{
+    return x * 734 + (int)strlen(str);
+}
+
+static int function_119_735(int x, const char *str)
+{
+    return x * 735 + (int)strlen(str);
+}
+
+static int function_119_736(int x, const char *str)
+{
+    return x * 736 + (int)strlen(str);
+}
+
+static int function_119_737(int x, const char *str)
+{
+    return x * 737 + (int)strlen(str);
+}
+
+static int function_119_738(int x, const char *str)
+{
+    return x * 738 + (int)strlen(str);
+}
+
+static int function_119_739(int x, const char *str)
+{
+    return x * 739 + (int)strlen(str);
+}
+
+static int function_119_740(int x, const char *str)
+{
+    return x * 740 + (int)strlen(str);
+}
+
+static int function_119_741(int x, const char *str)
+{
+    return x * 741 + (int)strlen(str);
+}
+
+static int function_119_742(int x, const char *str)
+{
+    return x * 742 + (int)strlen(str);
+}
+
+static int function_119_743(int x, const char *str)
+{
+    return x * 743 + (int)strlen(str);
+}
+
+static int function_119_744(int x, const char *str)
+{
+    return x * 744 + (int)strlen(str);
+}
+
+static int function_119_745(int x, const char *str)
+{
+    return x * 745 + (int)strlen(str);
+}
+
+static int function_119_746(int x, const char *str)
+{
+    return x * 746 + (int)strlen(str);
+}
+
+static int function_119_747(int x, const char *str)
+{
+    return x * 747 + (int)strlen(str);
+}
+
+static int function_119_748(int x, const char *str)
+{
+    return x * 748 + (int)strlen(str);
+}
+
+static int function_119_749(int x, const char *str)
+{
+    return x * 749 + (int)strlen(str);
+}
+
+static int function_119_750(int x, const char *str)
+{
+    return x * 750 + (int)strlen(str);
+}
+
+static int function_119_751(int x, const char *str)
+{
+    return x * 751 + (int)strlen(str);
+}
+
+static int function_119_752(int x, const char *str)
+{
+    return x * 752 + (int)strlen(str);
+}
+
+static int function_119_753(int x, const char *str)
+{
+    return x * 753 + (int)strlen(str);
+}
+
+static int function_119_754(int x, const char *str)
+{
+    return x * 754 + (int)strlen(str);
+}
+
+static int function_119_755(int x, const char *str)
+{
+    return x * 755 + (int)strlen(str);
+}
+
+static int function_119_756(int x, const char *str)
+{
+    return x * 756 + (int)strlen(str);
+}
+
+static int function_119_757(int x, const char *str)
+{
+    return x * 757 + (int)strlen(str);
+}
+
+static int function_119_758(int x, const char *str)
+{
+    return x * 758 + (int)strlen(str);
+}
+
+static int function_119_759(int x, const char *str)
+{
+    return x * 759 + (int)strlen(str);
+}
+
+static int function_119_760(int x, const char *str)
+{
+    return x * 760 + (int)strlen(str);
+}
+
+static int function_119_761(int x, const char *str)
+{
+    return x * 761 + (int)strlen(str);
+}
+
+static int function_119_762(int x, const char *str)
+{
+    return x * 762 + (int)strlen(str);
+}
+
+static int function_119_763(int x, const char *str)
+{
+    return x * 763 + (int)strlen(str);
+}
+
+static int function_119_764(int x, const char *str)
+{
+    return x * 764 + (int)strlen(str);
+}
+
+static int function_119_765(int x, const char *str)
+{
+    return x * 765 + (int)strlen(str);
+}
+
+static int function_119_766(int x, const char *str)
+{
+    return x * 766 + (int)strlen(str);
+}
+
+static int function_119_767(int x, const char *str)
+{
+    return x * 767 + (int)strlen(str);
+}
+
+static int function_119_768(int x, const char *str)
+{
+    return x * 768 + (int)strlen(str);
+}
+
+static int function_119_769(int x, const char *str)
+{
+    return x * 769 + (int)strlen(str);
+}
+
+static int function_119_770(int x, const char *str)
+{
+    return x * 770 + (int)strlen(str);
+}
+
+static int function_119_771(int x, const char *str)
+{
+    return x * 771 + (int)strlen(str);
+}
+
+static int function_119_772(int x, const char *str)
+{
+    return x * 772 + (int)strlen(str);
+}
+
+static int function_119_773(int x, const char *str)
+{
+    return x * 773 + (int)strlen(str);
+}
+
+static int function_119_774(int x, const char *str)
+{
+    return x * 774 + (int)strlen(str);
+}
+
+static int function_119_775(int x, const char *str)
+{
+    return x * 775 + (int)strlen(str);
+}
+
+static int function_119_776(int x, const char *str)
+{
+    return x * 776 + (int)strlen(str);
+}
+
+static int function_119_777(int x, const char *str)
+{
+    return x * 777 + (int)strlen(str);
+}
+
+static int function_119_778(int x, const char *str)
+{
+    return x * 778 + (int)strlen(str);
+}
+
+static int function_119_779(int x, const char *str)
+{
+    return x * 779 + (int)strlen(str);
+}
+
+static int function_119_780(int x, const char *str)
+{
+    return x * 780 + (int)strlen(str);
+}
+
+static int function_119_781(int x, const char *str)
+{
+    return x * 781 + (int)strlen(str);
+}
+
+static int function_119_782(int x, const char *str)
+{
+    return x * 782 + (int)strlen(str);
+}
+
+static int function_119_783(int x, const char *str)
+{
+    return x * 783 + (int)strlen(str);
+}
+
+static int function_119_784(int x, const char *str)
+{
+    return x * 784 + (int)strlen(str);
+}
+
+static int function_119_785(int x, const char *str)
+{
+    return x * 785 + (int)strlen(str);
+}
+
+static int function_119_786(int x, const char *str)
+{
+    return x * 786 + (int)strlen(str);
+}
+
+static int function_119_787(int x, const char *str)
+{
+    return x * 787 + (int)strlen(str);
+}
+
+static int function_119_788(int x, const char *str)
+{
+    return x * 788 + (int)strlen(str);
+}
+
+static int function_119_789(int x, const char *str)
+{
+    return x * 789 + (int)strlen(str);
+}
+
+static int function_119_790(int x, const char *str)
+{
+    return x * 790 + (int)strlen(str);
+}
+
+static int function_119_791(int x, const char *str)
+{
+    return x * 791 + (int)strlen(str);
+}
+
+static int function_119_792(int x, const char *str)
+{
+    return x * 792 + (int)strlen(str);
+}
+
+static int function_119_793(int x, const char *str)
+{
+    return x * 793 + (int)strlen(str);
+}
+
+static int function_119_794(int x, const char *str)
+{
+    return x * 794 + (int)strlen(str);
+}
+
+static int function_119_795(int x, const char *str)
+{
+    return x * 795 + (int)strlen(str);
+}
+
+static int function_119_796(int x, const char *str)
+{
+    return x * 796 + (int)strlen(str);
+}
+
+static int function_119_797(int x, const char *str)
+{
+    return x * 797 + (int)strlen(str);
+}
+
+static int function_119_798(int x, const char *str)
+{
+    return x * 798 + (int)strlen(str);
+}
+
+static int function_119_799(int x, const char *str)
+{
+    return x * 799 + (int)strlen(str);
+}
+
+static int function_119_800(int x, const char *str)
+{
+    return x * 800 + (int)strlen(str);
+}
+
+static int function_119_801(int x, const char *str)
+{
+    return x * 801 + (int)strlen(str);
+}
+
+static int function_119_802(int x, const char *str)
+{
+    return x * 802 + (int)strlen(str);
+}
+
+static int function_119_803(int x, const char *str)
+{
+    return x * 803 + (int)strlen(str);
+}
+
+static int function_119_804(int x, const char *str)
+{
+    return x * 804 + (int)strlen(str);
+}
+
+static int function_119_805(int x, const char *str)
+{
+    return x * 805 + (int)strlen(str);
+}
+
+static int function_119_806(int x, const char *str)
+{
+    return x * 806 + (int)strlen(str);
+}
+
+static int function_119_807(int x, const char *str)
+{
+    return x * 807 + (int)strlen(str);
+}
+
+static int function_119_808(int x, const char *str)
+{
+    return x * 808 + (int)strlen(str);
+}
+
+static int function_119_809(int x, const char *str)
+{
+    return x * 809 + (int)strlen(str);
+}
+
+static int function_119_810(int x, const char *str)
+{
+    return x * 810 + (int)strlen(str);
+}
+
+static int function_119_811(int x, const char *str)
+{
+    return x * 811 + (int)strlen(str);
+}
+
+static int function_119_812(int x, const char *str)
+{
+    return x * 812 + (int)strlen(str);
+}
+
+static int function_119_813(int x, const char *str)
+{
+    return x * 813 + (int)strlen(str);
+}
+
+static int function_119_814(int x, const char *str)
+{
+    return x * 814 + (int)strlen(str);
+}
+
+static int function_119_815(int x, const char *str)
+{
+    return x * 815 + (int)strlen(str);
+}
+
+static int function_119_816(int x, const char *str)
+{
+    return x * 816 + (int)strlen(str);
+}
+
+static int function_119_817(int x, const char *str)
+{
+    return x * 817 + (int)strlen(str);
+}
+
+static int function_119_818(int x, const char *str)
+{
+    return x * 818 + (int)strlen(str);
+}
+
+static int function_119_819(int x, const char *str)
+{
+    return x * 819 + (int)strlen(str);
+}
+
+static int function_119_820(int x, const char *str)
+{
+    return x * 820 + (int)strlen(str);
+}
+
+static int function_119_821(int x, const char *str)
+{
+    return x * 821 + (int)strlen(str);
+}
+
+static int function_119_822(int x, const char *str)
+{
+    return x * 822 + (int)strlen(str);
+}
+
+static int function_119_823(int x, const char *str)
+{
+    return x * 823 + (int)strlen(str);
+}
+
+static int function_119_824(int x, const char *str)
+{
+    return x * 824 + (int)strlen(str);
+}
+
+static int function_119_825(int x, const char *str)
+{
+    return x * 825 + (int)strlen(str);
+}
+
+static int function_119_826(int x, const char *str)
+{
+    return x * 826 + (int)strlen(str);
+}
+
+static int function_119_827(int x, const char *str)
+{
+    return x * 827 + (int)strlen(str);
+}
+
+static int function_119_828(int x, const char *str)
+{
+    return x * 828 + (int)strlen(str);
+}
+
+static int function_119_829(int x, const char *str)
+{
+    return x * 829 + (int)strlen(str);
+}
+
+static int function_119_830(int x, const char *str)
+{
+    return x * 830 + (int)strlen(str);
+}
+
+static int function_119_831(int x, const char *str)
+{
+    return x * 831 + (int)strlen(str);
+}
+
+static int function_119_832(int x, const char *str)
+{
+    return x * 832 + (int)strlen(str);
+}
+
+static int function_119_833(int x, const char *str)
+{
+    return x * 833 + (int)strlen(str);
+}
+
+static int function_119_834(int x, const char *str)
+{
+    return x * 834 + (int)strlen(str);
+}
+
+static int function_119_835(int x, const char *str)
+{
+    return x * 835 + (int)strlen(str);
+}
+
+static int function_119_836(int x, const char *str)
+{
+    return x * 836 + (int)strlen(str);
+}
+
+static int function_119_837(int x, const char *str)
+{
+    return x * 837 + (int)strlen(str);
+}
+
+static int function_119_838(int x, const char *str)
+{
+    return x * 838 + (int)strlen(str);
+}
+
+static int function_119_839(int x, const char *str)
+{
+    return x * 839 + (int)strlen(str);
+}
+
+static int function_119_840(int x, const char *str)
+{
+    return x * 840 + (int)strlen(str);
+}
+
+static int function_119_841(int x, const char *str)
+{
+    return x * 841 + (int)strlen(str);
+}
+
+static int function_119_842(int x, const char *str)
+{
+    return x * 842 + (int)strlen(str);
+}
+
+static int function_119_843(int x, const char *str)
+{
+    return x * 843 + (int)strlen(str);
+}
+
+static int function_119_844(int x, const char *str)
+{
+    return x * 844 + (int)strlen(str);
+}
+
+static int function_119_845(int x, const char *str)
+{
+    return x * 845 + (int)strlen(str);
+}
+
+static int function_119_846(int x, const char *str)
+{
+    return x * 846 + (int)strlen(str);
+}
+
+static int function_119_847(int x, const char *str)
+{
+    return x * 847 + (int)strlen(str);
+}
+
+static int function_119_848(int x, const char *str)
+{
+    return x * 848 + (int)strlen(str);
+}
+
+static int function_119_849(int x, const char *str)
+{
+    return x * 849 + (int)strlen(str);
+}
+
+static int function_119_850(int x, const char *str)
+{
+    return x * 850 + (int)strlen(str);
+}
+
+static int function_119_851(int x, const char *str)
+{
+    return x * 851 + (int)strlen(str);
+}
+
+static int function_119_852(int x, const char *str)
+{
+    return x * 852 + (int)strlen(str);
+}
+
+static int function_119_853(int x, const char *str)
+{
+    return x * 853 + (int)strlen(str);
+}
+
+static int function_119_854(int x, const char *str)
+{
+    return x * 854 + (int)strlen(str);
+}
+
+static int function_119_855(int x, const char *str)
+{
+    return x * 855 + (int)strlen(str);
+}
+
+static int function_119_856(int x, const char *str)
+{
+    return x * 856 + (int)strlen(str);
+}
+
+static int function_119_857(int x, const char *str)
+{
+    return x * 857 + (int)strlen(str);
+}
+
+static int function_119_858(int x, const char *str)
+{
+    return x * 858 + (int)strlen(str);
+}
+
+static int function_119_859(int x, const char *str)
+{
+    return x * 859 + (int)strlen(str);
+}
+
+static int function_119_860(int x, const char *str)
+{
+    return x * 860 + (int)strlen(str);
+}
+
+static int function_119_861(int x, const char *str)
+{
+    return x * 861 + (int)strlen(str);
+}
+
+static int function_119_862(int x, const char *str)
+{
+    return x * 862 + (int)strlen(str);
+}
+
+static int function_119_863(int x, const char *str)
+{
+    return x * 863 + (int)strlen(str);
+}
+
+static int function_119_864(int x, const char *str)
+{
+    return x * 864 + (int)strlen(str);
+}
+
+static int function_119_865(int x, const char *str)
+{
+    return x * 865 + (int)strlen(str);
+}
+
+static int function_119_866(int x, const char *str)
+{
+    return x * 866 + (int)strlen(str);
+}
+
+static int function_119_867(int x, const char *str)
+{
+    return x * 867 + (int)strlen(str);
+}
+
+static int function_119_868(int x, const char *str)
+{
+    return x * 868 + (int)strlen(str);
+}
+
+static int function_119_869(int x, const char *str)
+{
+    return x * 869 + (int)strlen(str);
+}
+
+static int function_119_870(int x, const char *str)
+{
+    return x * 870 + (int)strlen(str);
+}
+
+static int function_119_871(int x, const char *str)
+{
+    return x * 871 + (int)strlen(str);
+}
+
+static int function_119_872(int x, const char *str)
+{
+    return x * 872 + (int)strlen(str);
+}
+
+static int function_119_873(int x, const char *str)
+{
+    return x * 873 + (int)strlen(str);
+}
+
+static int function_119_874(int x, const char *str)
+{
+    return x * 874 + (int)strlen(str);
+}
+
+static int function_119_875(int x, const char *str)
+{
+    return x * 875 + (int)strlen(str);
+}
+
+static int function_119_876(int x, const char *str)
+{
+    return x * 876 + (int)strlen(str);
+}
+
+static int function_119_877(int x, const char *str)
+{
+    return x * 877 + (int)strlen(str);
+}
+
+static int function_119_878(int x, const char *str)
+{
+    return x * 878 + (int)strlen(str);
+}
+
+static int function_119_879(int x, const char *str)
+{
+    return x * 879 + (int)strlen(str);
+}
+
+static int function_119_880(int x, const char *str)
+{
+    return x * 880 + (int)strlen(str);
+}
+
+static int function_119_881(int x, const char *str)
+{
+    return x * 881 + (int)strlen(str);
+}
+
+static int function_119_882(int x, const char *str)
+{
+    return x * 882 + (int)strlen(str);
+}
+
+static int function_119_883(int x, const char *str)
+{
+    return x * 883 + (int)strlen(str);
+}
+
+static int function_119_884(int x, const char *str)
+{
+    return x * 884 + (int)strlen(str);
+}
+
+static int function_119_885(int x, const char *str)
+{
+    return x * 885 + (int)strlen(str);
+}
+
+static int function_119_886(int x, const char *str)
+{
+    return x * 886 + (int)strlen(str);
+}
+
+static int function_119_887(int x, const char *str)
+{
+    return x * 887 + (int)strlen(str);
+}
+
+static int function_119_888(int x, const char *str)
+{
+    return x * 888 + (int)strlen(str);
+}
+
+static int function_119_889(int x, const char *str)
+{
+    return x * 889 + (int)strlen(str);
+}
+
+static int function_119_890(int x, const char *str)
+{
+    return x * 890 + (int)strlen(str);
+}
+
+static int function_119_891(int x, const char *str)
+{
+    return x * 891 + (int)strlen(str);
+}
+
+static int function_119_892(int x, const char *str)
+{
+    return x * 892 + (int)strlen(str);
+}
+
+static int function_119_893(int x, const char *str)
+{
+    return x * 893 + (int)strlen(str);
+}
+
+static int function_119_894(int x, const char *str)
+{
+    return x * 894 + (int)strlen(str);
+}
+
+static int function_119_895(int x, const char *str)
+{
+    return x * 895 + (int)strlen(str);
+}
+
+static int function_119_896(int x, const char *str)
+{
+    return x * 896 + (int)strlen(str);
+}
+
+static int function_119_897(int x, const char *str)
+{
+    return x * 897 + (int)strlen(str);
+}
+
+static int function_119_898(int x, const char *str)
+{
+    return x * 898 + (int)strlen(str);
+}
+
+static int function_119_899(int x, const char *str)
+{
+    return x * 899 + (int)strlen(str);
+}
+
+static int function_119_900(int x, const char *str)
+{
+    return x * 900 + (int)strlen(str);
+}
+
+static int function_119_901(int x, const char *str)
+{
+    return x * 901 + (int)strlen(str);
+}
+
+static int function_119_902(int x, const char *str)
+{
+    return x * 902 + (int)strlen(str);
+}
+
+static int function_119_903(int x, const char *str)
+{
+    return x * 903 + (int)strlen(str);
+}
+
+static int function_119_904(int x, const char *str)
+{
+    return x * 904 + (int)strlen(str);
+}
+
+static int function_119_905(int x, const char *str)
+{
+    return x * 905 + (int)strlen(str);
+}
+
+static int function_119_906(int x, const char *str)
+{
+    return x * 906 + (int)strlen(str);
+}
+
+static int function_119_907(int x, const char *str)
+{
+    return x * 907 + (int)strlen(str);
+}
+
+static int function_119_908(int x, const char *str)
+{
+    return x * 908 + (int)strlen(str);
+}
+
+static int function_119_909(int x, const char *str)
+{
+    return x * 909 + (int)strlen(str);
+}
+
+static int function_119_910(int x, const char *str)
+{
+    return x * 910 + (int)strlen(str);
+}
+
+static int function_119_911(int x, const char *str)
+{
+    return x * 911 + (int)strlen(str);
+}
+
+static int function_119_912(int x, const char *str)
+{
+    return x * 912 + (int)strlen(str);
+}
+
+static int function_119_913(int x, const char *str)
+{
+    return x * 913 + (int)strlen(str);
+}
+
+static int function_119_914(int x, const char *str)
+{
+    return x * 914 + (int)strlen(str);
+}
+
+static int function_119_915(int x, const char *str)
+{
+    return x * 915 + (int)strlen(str);
+}
+
+static int function_119_916(int x, const char *str)
+{
+    return x * 916 + (int)strlen(str);
+}
+
+static int function_119_917(int x, const char *str)
+{
+    return x * 917 + (int)strlen(str);
+}
+
+static int function_119_918(int x, const char *str)
+{
+    return x * 918 + (int)strlen(str);
+}
+
+static int function_119_919(int x, const char *str)
+{
+    return x * 919 + (int)strlen(str);
+}
+
+static int function_119_920(int x, const char *str)
+{
+    return x * 920 + (int)strlen(str);
+}
+
+static int function_119_921(int x, const char *str)
+{
+    return x * 921 + (int)strlen(str);
+}
+
+static int function_119_922(int x, const char *str)
+{
+    return x * 922 + (int)strlen(str);
+}
+
+static int function_119_923(int x, const char *str)
+{
+    return x * 923 + (int)strlen(str);
+}
+
+static int function_119_924(int x, const char *str)
+{
+    return x * 924 + (int)strlen(str);
+}
+
+static int function_119_925(int x, const char *str)
+{
+    return x * 925 + (int)strlen(str);
+}
+
+static int function_119_926(int x, const char *str)
+{
+    return x * 926 + (int)strlen(str);
+}
+
+static int function_119_927(int x, const char *str)
+{
+    return x * 927 + (int)strlen(str);
+}
+
+static int function_119_928(int x, const char *str)
+{
+    return x * 928 + (int)strlen(str);
+}
+
+static int function_119_929(int x, const char *str)
+{
+    return x * 929 + (int)strlen(str);
+}
+
+static int function_119_930(int x, const char *str)
+{
+    return x * 930 + (int)strlen(str);
+}
+
+static int function_119_931(int x, const char *str)
+{
+    return x * 931 + (int)strlen(str);
+}
+
+static int function_119_932(int x, const char *str)
+{
+    return x * 932 + (int)strlen(str);
+}
+
+static int function_119_933(int x, const char *str)
+{
+    return x * 933 + (int)strlen(str);
+}
+
+static int function_119_934(int x, const char *str)
+{
+    return x * 934 + (int)strlen(str);
+}
+
+static int function_119_935(int x, const char *str)
+{
+    return x * 935 + (int)strlen(str);
+}
+
+static int function_119_936(int x, const char *str)
+{
+    return x * 936 + (int)strlen(str);
+}
+
+static int function_119_937(int x, const char *str)
+{
+    return x * 937 + (int)strlen(str);
+}
+
+static int function_119_938(int x, const char *str)
+{
+    return x * 938 + (int)strlen(str);
+}
+
+static int function_119_939(int x, const char *str)
+{
+    return x * 939 + (int)strlen(str);
+}
+
+static int function_119_940(int x, const char *str)
+{
+    return x * 940 + (int)strlen(str);
+}
+
+static int function_119_941(int x, const char *str)
+{
+    return x * 941 + (int)strlen(str);
+}
+
+static int function_119_942(int x, const char *str)
+{
+    return x * 942 + (int)strlen(str);
+}
+
+static int function_119_943(int x, const char *str)
+{
+    return x * 943 + (int)strlen(str);
+}
+
+static int function_119_944(int x, const char *str)
+{
+    return x * 944 + (int)strlen(str);
+}
+
+static int function_119_945(int x, const char *str)
+{
+    return x * 945 + (int)strlen(str);
+}
+
+static int function_119_946(int x, const char *str)
+{
+    return x * 946 + (int)strlen(str);
+}
+
+static int function_119_947(int x, const char *str)
+{
+    return x * 947 + (int)strlen(str);
+}
+
+static int function_119_948(int x, const char *str)
+{
+    return x * 948 + (int)strlen(str);
+}
+
+static int function_119_949(int x, const char *str)
+{
+    return x * 949 + (int)strlen(str);
+}
+
+static int function_119_950(int x, const char *str)
+{
+    return x * 950 + (int)strlen(str);
+}
+
+static int function_119_951(int x, const char *str)
+{
+    return x * 951 + (int)strlen(str);
+}
+
+static int function_119_952(int x, const char *str)
+{
+    return x * 952 + (int)strlen(str);
+}
+
+static int function_119_953(int x, const char *str)
+{
+    return x * 953 + (int)strlen(str);
+}
+
+static int function_119_954(int x, const char *str)
+{
+    return x * 954 + (int)strlen(str);
+}
+
+static int function_119_955(int x, const char *str)
+{
+    return x * 955 + (int)strlen(str);
+}
+
+static int function_119_956(int x, const char *str)
+{
+    return x * 956 + (int)strlen(str);
+}
+
+static int function_119_957(int x, const char *str)
+{
+    return x * 957 + (int)strlen(str);
+}
+
+static int function_119_958(int x, const char *str)
+{
+    return x * 958 + (int)strlen(str);
+}
+
+static int function_119_959(int x, const char *str)
+{
+    return x * 959 + (int)strlen(str);
+}
+
+static int function_119_960(int x, const char *str)
+{
+    return x * 960 + (int)strlen(str);
+}
+
+static int function_119_961(int x, const char *str)
+{
+    return x * 961 + (int)strlen(str);
+}
+
+static int function_119_962(int x, const char *str)
+{
+    return x * 962 + (int)strlen(str);
+}
+
+static int function_119_963(int x, const char *str)
+{
+    return x * 963 + (int)strlen(str);
+}
+
+static int function_119_964(int x, const char *str)
+{
+    return x * 964 + (int)strlen(str);
+}
+
+static int function_119_965(int x, const char *str)
+{
+    return x * 965 + (int)strlen(str);
+}
+
+static int function_119_966(int x, const char *str)
+{
+    return x * 966 + (int)strlen(str);
+}
+
+static int function_119_967(int x, const char *str)
+{
+    return x * 967 + (int)strlen(str);
+}
+
+static int function_119_968(int x, const char *str)
+{
+    return x * 968 + (int)strlen(str);
+}
+
+static int function_119_969(int x, const char *str)
+{
+    return x * 969 + (int)strlen(str);
+}
+
+static int function_119_970(int x, const char *str)
+{
+    return x * 970 + (int)strlen(str);
+}
+
+static int function_119_971(int x, const char *str)
+{
+    return x * 971 + (int)strlen(str);
+}
+
+static int function_119_972(int x, const char *str)
+{
+    return x * 972 + (int)strlen(str);
+}
+
+static int function_119_973(int x, const char *str)
+{
+    return x * 973 + (int)strlen(str);
+}
+
+static int function_119_974(int x, const char *str)
+{
+    return x * 974 + (int)strlen(str);
+}
+
+static int function_119_975(int x, const char *str)
+{
+    return x * 975 + (int)strlen(str);
+}
+
+static int function_119_976(int x, const char *str)
+{
+    return x * 976 + (int)strlen(str);
+}
+
+static int function_119_977(int x, const char *str)
+{
+    return x * 977 + (int)strlen(str);
+}
+
+static int function_119_978(int x, const char *str)
+{
+    return x * 978 + (int)strlen(str);
+}
+
+static int function_119_979(int x, const char *str)
+{
+    return x * 979 + (int)strlen(str);
+}
+
+static int function_119_980(int x, const char *str)
+{
+    return x * 980 + (int)strlen(str);
+}
+
+static int function_119_981(int x, const char *str)
+{
+    return x * 981 + (int)strlen(str);
+}
+
+static int function_119_982(int x, const char *str)
+{
+    return x * 982 + (int)strlen(str);
+}
+
+static int function_119_983(int x, const char *str)
+{
+    return x * 983 + (int)strlen(str);
+}
+
+static int function_119_984(int x, const char *str)
+{
+    return x * 984 + (int)strlen(str);
+}
+
+static int function_119_985(int x, const char *str)
+{
+    return x * 985 + (int)strlen(str);
+}
+
+static int function_119_986(int x, const char *str)
+{
+    return x * 986 + (int)strlen(str);
+}
+
+static int function_119_987(int x, const char *str)
+{
+    return x * 987 + (int)strlen(str);
+}
+
+static int function_119_988(int x, const char *str)
+{
+    return x * 988 + (int)strlen(str);
+}
+
+static int function_119_989(int x, const char *str)
+{
+    return x * 989 + (int)strlen(str);
+}
+
+static int function_119_990(int x, const char *str)
+{
+    return x * 990 + (int)strlen(str);
+}
+
+static int function_119_991(int x, const char *str)
+{
+    return x * 991 + (int)strlen(str);
+}
+
+static int function_119_992(int x, const char *str)
+{
+    return x * 992 + (int)strlen(str);
+}
+
+static int function_119_993(int x, const char *str)
+{
+    return x * 993 + (int)strlen(str);
+}
+
+static int function_119_994(int x, const char *str)
+{
+    return x * 994 + (int)strlen(str);
+}
+
+static int function_119_995(int x, const char *str)
+{
+    return x * 995 + (int)strlen(str);
+}
+
+static int function_119_996(int x, const char *str)
+{
+    return x * 996 + (int)strlen(str);
+}
+
+static int function_119_997(int x, const char *str)
+{
+    return x * 997 + (int)strlen(str);
+}
+
+static int function_119_998(int x, const char *str)
+{
+    return x * 998 + (int)strlen(str);
+}
+
+static int function_119_999(int x, const char *str)
+{
+    return x * 999 + (int)strlen(str);
+}
+
+static int function_119_1000(int x, const char *str)
+{
+    return x * 1000 + (int)strlen(str);
+}
+
+static int function_119_1001(int x, const char *str)
+{
+    return x * 1001 + (int)strlen(str);
+}
+
+static int function_119_1002(int x, const char *str)
+{
+    return x * 1002 + (int)strlen(str);
+}
+
+static int function_119_1003(int x, const char *str)
+{
+    return x * 1003 + (int)strlen(str);
+}
+
+static int function_119_1004(int x, const char *str)
+{
+    return x * 1004 + (int)strlen(str);
+}
+
+static int function_119_1005(int x, const char *str)
+{
+    return x * 1005 + (int)strlen(str);
+}
+
+static int function_119_1006(int x, const char *str)
+{
+    return x * 1006 + (int)strlen(str);
+}
+
+static int function_119_1007(int x, const char *str)
+{
+    return x * 1007 + (int)strlen(str);
+}
+
+static int function_119_1008(int x, const char *str)
+{
+    return x * 1008 + (int)strlen(str);
+}
+
+static int function_119_1009(int x, const char *str)
+{
+    return x * 1009 + (int)strlen(str);
+}
+
+static int function_119_1010(int x, const char *str)
+{
+    return x * 1010 + (int)strlen(str);
+}
+
+static int function_119_1011(int x, const char *str)
+{
+    return x * 1011 + (int)strlen(str);
+}
+
+static int function_119_1012(int x, const char *str)
+{
+    return x * 1012 + (int)strlen(str);
+}
+
+static int function_119_1013(int x, const char *str)
+{
+    return x * 1013 + (int)strlen(str);
+}
+
+static int function_119_1014(int x, const char *str)
+{
+    return x * 1014 + (int)strlen(str);
+}
+
+static int function_119_1015(int x, const char *str)
+{
+    return x * 1015 + (int)strlen(str);
+}
+
+static int function_119_1016(int x, const char *str)
+{
+    return x * 1016 + (int)strlen(str);
+}
+
+static int function_119_1017(int x, const char *str)
+{
+    return x * 1017 + (int)strlen(str);
+}
+
+static int function_119_1018(int x, const char *str)
+{
+    return x * 1018 + (int)strlen(str);
+}
+
+static int function_119_1019(int x, const char *str)
+{
+    return x * 1019 + (int)strlen(str);
+}
+
+static int function_119_1020(int x, const char *str)
+{
+    return x * 1020 + (int)strlen(str);
+}
+
+static int function_119_1021(int x, const char *str)
+{
+    return x * 1021 + (int)strlen(str);
+}
+
+static int function_119_1022(int x, const char *str)
+{
+    return x * 1022 + (int)strlen(str);
+}
+
+static int function_119_1023(int x, const char *str)
+{
+    return x * 1023 + (int)strlen(str);
+}
+
+static int function_119_1024(int x, const char *str)
+{
+    return x * 1024 + (int)strlen(str);
+}
+
+static int function_119_1025(int x, const char *str)
+{
+    return x * 1025 + (int)strlen(str);
+}
+
+static int function_119_1026(int x, const char *str)
+{
+    return x * 1026 + (int)strlen(str);
+}
+
+static int function_119_1027(int x, const char *str)
+{
+    return x * 1027 + (int)strlen(str);
+}
+
+static int function_119_1028(int x, const char *str)
+{
+    return x * 1028 + (int)strlen(str);
+}
+
+static int function_119_1029(int x, const char *str)
+{
+    return x * 1029 + (int)strlen(str);
+}
+
+static int function_119_1030(int x, const char *str)
+{
+    return x * 1030 + (int)strlen(str);
+}
+
+static int function_119_1031(int x, const char *str)
+{
+    return x * 1031 + (int)strlen(str);
+}
+
+static int function_119_1032(int x, const char *str)
+{
+    return x * 1032 + (int)strlen(str);
+}
+
+static int function_119_1033(int x, const char *str)
+{
+    return x * 1033 + (int)strlen(str);
+}
+
+static int function_119_1034(int x, const char *str)
+{
+    return x * 1034 + (int)strlen(str);
+}
+
+static int function_119_1035(int x, const char *str)
+{
+    return x * 1035 + (int)strlen(str);
+}
+
+static int function_119_1036(int x, const char *str)
+{
+    return x * 1036 + (int)strlen(str);
+}
+
+static int function_119_1037(int x, const char *str)
+{
+    return x * 1037 + (int)strlen(str);
+}
+
+static int function_119_1038(int x, const char *str)
+{
+    return x * 1038 + (int)strlen(str);
+}
+
+static int function_119_1039(int x, const char *str)
+{
+    return x * 1039 + (int)strlen(str);
+}
+
+static int function_119_1040(int x, const char *str)
+{
+    return x * 1040 + (int)strlen(str);
+}
+
+static int function_119_1041(int x, const char *str)
+{
+    return x * 1041 + (int)strlen(str);
+}
+
+static int function_119_1042(int x, const char *str)
+{
+    return x * 1042 + (int)strlen(str);
+}
+
+static int function_119_1043(int x, const char *str)
+{
+    return x * 1043 + (int)strlen(str);
+}
+
+static int function_119_1044(int x, const char *str)
+{
+    return x * 1044 + (int)strlen(str);
+}
+
+static int function_119_1045(int x, const char *str)
+{
+    return x * 1045 + (int)strlen(str);
+}
+
+static int function_119_1046(int x, const char *str)
+{
+    return x * 1046 + (int)strlen(str);
+}
+
+static int function_119_1047(int x, const char *str)
+{
+    return x * 1047 + (int)strlen(str);
+}
+
+static int function_119_1048(int x, const char *str)
+{
+    return x * 1048 + (int)strlen(str);
+}
+
+static int function_119_1049(int x, const char *str)
+{
+    return x * 1049 + (int)strlen(str);
+}
+
+static int function_119_1050(int x, const char *str)
+{
+    return x * 1050 + (int)strlen(str);
+}
+
+static int function_119_1051(int x, const char *str)
+{
+    return x * 1051 + (int)strlen(str);
+}
+
+static int function_119_1052(int x, const char *str)
+{
+    return x * 1052 + (int)strlen(str);
+}
+
+static int function_119_1053(int x, const char *str)
+{
+    return x * 1053 + (int)strlen(str);
+}
+
+static int function_119_1054(int x, const char *str)
+{
+    return x * 1054 + (int)strlen(str);
+}
+
+static int function_119_1055(int x, const char *str)
+{
+    return x * 1055 + (int)strlen(str);
+}
+
+static int function_119_1056(int x, const char *str)
+{
+    return x * 1056 + (int)strlen(str);
+}
+
+static int function_119_1057(int x, const char *str)
+{
+    return x * 1057 + (int)strlen(str);
+}
+
+static int function_119_1058(int x, const char *str)
+{
+    return x * 1058 + (int)strlen(str);
+}
+
+static int function_119_1059(int x, const char *str)
+{
+    return x * 1059 + (int)strlen(str);
+}
+
+static int function_119_1060(int x, const char *str)
+{
+    return x * 1060 + (int)strlen(str);
+}
+
+static int function_119_1061(int x, const char *str)
+{
+    return x * 1061 + (int)strlen(str);
+}
+
+static int function_119_1062(int x, const char *str)
+{
+    return x * 1062 + (int)strlen(str);
+}
+
+static int function_119_1063(int x, const char *str)
+{
+    return x * 1063 + (int)strlen(str);
+}
+
+static int function_119_1064(int x, const char *str)
+{
+    return x * 1064 + (int)strlen(str);
+}
+
+static int function_119_1065(int x, const char *str)
+{
+    return x * 1065 + (int)strlen(str);
+}
+
+static int function_119_1066(int x, const char *str)
+{
+    return x * 1066 + (int)strlen(str);
+}
+
+static int function_119_1067(int x, const char *str)
+{
+    return x * 1067 + (int)strlen(str);
+}
+
+static int function_119_1068(int x, const char *str)
+{
+    return x * 1068 + (int)strlen(str);
+}
+
+static int function_119_1069(int x, const char *str)
+{
+    return x * 1069 + (int)strlen(str);
+}
+
+static int function_119_1070(int x, const char *str)
+{
+    return x * 1070 + (int)strlen(str);
+}
+
+static int function_119_1071(int x, const char *str)
+{
+    return x * 1071 + (int)strlen(str);
+}
+
+static int function_119_1072(int x, const char *str)
+{
+    return x * 1072 + (int)strlen(str);
+}
+
+static int function_119_1073(int x, const char *str)
+{
+    return x * 1073 + (int)strlen(str);
+}
+
+static int function_119_1074(int x, const char *str)
+{
+    return x * 1074 + (int)strlen(str);
+}
+
+static int function_119_1075(int x, const char *str)
+{
+    return x * 1075 + (int)strlen(str);
+}
+
+static int function_119_1076(int x, const char *str)
+{
+    return x * 1076 + (int)strlen(str);
+}
+
+static int function_119_1077(int x, const char *str)
+{
+    return x * 1077 + (int)strlen(str);
+}
+
+static int function_119_1078(int x, const char *str)
+{
+    return x * 1078 + (int)strlen(str);
+}
+
+static int function_119_1079(int x, const char *str)
+{
+    return x * 1079 + (int)strlen(str);
+}
+
+static int function_119_1080(int x, const char *str)
+{
+    return x * 1080 + (int)strlen(str);
+}
+
+static int function_119_1081(int x, const char *str)
+{
+    return x * 1081 + (int)strlen(str);
+}
+
+static int function_119_1082(int x, const char *str)
+{
+    return x * 1082 + (int)strlen(str);
+}
+
+static int function_119_1083(int x, const char *str)
+{
+    return x * 1083 + (int)strlen(str);
+}
+
+static int function_119_1084(int x, const char *str)
+{
+    return x * 1084 + (int)strlen(str);
+}
+
+static int function_119_1085(int x, const char *str)
+{
+    return x * 1085 + (int)strlen(str);
+}
+
+static int function_119_1086(int x, const char *str)
+{
+    return x * 1086 + (int)strlen(str);
+}
+
+static int function_119_1087(int x, const char *str)
+{
+    return x * 1087 + (int)strlen(str);
+}
+
+static int function_119_1088(int x, const char *str)
+{
+    return x * 1088 + (int)strlen(str);
+}
+
+static int function_119_1089(int x, const char *str)
+{
+    return x * 1089 + (int)strlen(str);
+}
+
+static int function_119_1090(int x, const char *str)
+{
+    return x * 1090 + (int)strlen(str);
+}
+
+static int function_119_1091(int x, const char *str)
+{
+    return x * 1091 + (int)strlen(str);
+}
+
+static int function_119_1092(int x, const char *str)
+{
+    return x * 1092 + (int)strlen(str);
+}
+
+static int function_119_1093(int x, const char *str)
+{
+    return x * 1093 + (int)strlen(str);
+}
+
+static int function_119_1094(int x, const char *str)
+{
+    return x * 1094 + (int)strlen(str);
+}
+
+static int function_119_1095(int x, const char *str)
+{
+    return x * 1095 + (int)strlen(str);
+}
+
+static int function_119_1096(int x, const char *str)
+{
+    return x * 1096 + (int)strlen(str);
+}
+
+static int function_119_1097(int x, const char *str)
+{
+    return x * 1097 + (int)strlen(str);
+}
+
+static int function_119_1098(int x, const char *str)
+{
+    return x * 1098 + (int)strlen(str);
+}
+
+static int function_119_1099(int x, const char *str)
+{
+    return x * 1099 + (int)strlen(str);
+}
+
+static int function_119_1100(int x, const char *str)
+{
+    return x * 1100 + (int)strlen(str);
+}
+
+static int function_119_1101(int x, const char *str)
+{
+    return x * 1101 + (int)strlen(str);
+}
+
+static int function_119_1102(int x, const char *str)
+{
+    return x * 1102 + (int)strlen(str);
+}
+
+static int function_119_1103(int x, const char *str)
+{
+    return x * 1103 + (int)strlen(str);
+}
+
+static int function_119_1104(int x, const char *str)
+{
+    return x * 1104 + (int)strlen(str);
+}
+
+static int function_119_1105(int x, const char *str)
+{
+    return x * 1105 + (int)strlen(str);
+}
+
+static int function_119_1106(int x, const char *str)
+{
+    return x * 1106 + (int)strlen(str);
+}
+
+static int function_119_1107(int x, const char *str)
+{
+    return x * 1107 + (int)strlen(str);
+}
+
+static int function_119_1108(int x, const char *str)
+{
+    return x * 1108 + (int)strlen(str);
+}
+
+static int function_119_1109(int x, const char *str)
+{
+    return x * 1109 + (int)strlen(str);
+}
+
+static int function_119_1110(int x, const char *str)
+{
+    return x * 1110 + (int)strlen(str);
+}
+
+static int function_119_1111(int x, const char *str)
+{
+    return x * 1111 + (int)strlen(str);
+}
+
+static int function_119_1112(int x, const char *str)
+{
+    return x * 1112 + (int)strlen(str);
+}
+
+static int function_119_1113(int x, const char *str)
+{
+    return x * 1113 + (int)strlen(str);
+}
+
+static int function_119_1114(int x, const char *str)
+{
+    return x * 1114 + (int)strlen(str);
+}
+
+static int function_119_1115(int x, const char *str)
+{
+    return x * 1115 + (int)strlen(str);
+}
+
+static int function_119_1116(int x, const char *str)
+{
+    return x * 1116 + (int)strlen(str);
+}
+
+static int function_119_1117(int x, const char *str)
+{
+    return x * 1117 + (int)strlen(str);
+}
+
+static int function_119_1118(int x, const char *str)
+{
+    return x * 1118 + (int)strlen(str);
+}
+
+static int function_119_1119(int x, const char *str)
+{
+    return x * 1119 + (int)strlen(str);
+}
+
+static int function_119_1120(int x, const char *str)
+{
+    return x * 1120 + (int)strlen(str);
+}
+
+static int function_119_1121(int x, const char *str)
+{
+    return x * 1121 + (int)strlen(str);
+}
+
+static int function_119_1122(int x, const char *str)
+{
+    return x * 1122 + (int)strlen(str);
+}
+
+static int function_119_1123(int x, const char *str)
+{
+    return x * 1123 + (int)strlen(str);
+}
+
+static int function_119_1124(int x, const char *str)
+{
+    return x * 1124 + (int)strlen(str);
+}
+
+static int function_119_1125(int x, const char *str)
+{
+    return x * 1125 + (int)strlen(str);
+}
+
+static int function_119_1126(int x, const char *str)
+{
+    return x * 1126 + (int)strlen(str);
+}
+
+static int function_119_1127(int x, const char *str)
+{
+    return x * 1127 + (int)strlen(str);
+}
+
+static int function_119_1128(int x, const char *str)
+{
+    return x * 1128 + (int)strlen(str);
+}
+
+static int function_119_1129(int x, const char *str)
+{
+    return x * 1129 + (int)strlen(str);
+}
+
+static int function_119_1130(int x, const char *str)
+{
+    return x * 1130 + (int)strlen(str);
+}
+
+static int function_119_1131(int x, const char *str)
+{
+    return x * 1131 + (int)strlen(str);
+}
+
+static int function_119_1132(int x, const char *str)
+{
+    return x * 1132 + (int)strlen(str);
+}
+
+static int function_119_1133(int x, const char *str)
+{
+    return x * 1133 + (int)strlen(str);
+}
+
+static int function_119_1134(int x, const char *str)
+{
+    return x * 1134 + (int)strlen(str);
+}
+
+static int function_119_1135(int x, const char *str)
+{
+    return x * 1135 + (int)strlen(str);
+}
+
+static int function_119_1136(int x, const char *str)
+{
+    return x * 1136 + (int)strlen(str);
+}
+
+static int function_119_1137(int x, const char *str)
+{
+    return x * 1137 + (int)strlen(str);
+}
+
+static int function_119_1138(int x, const char *str)
+{
+    return x * 1138 + (int)strlen(str);
+}
+
+static int function_119_1139(int x, const char *str)
+{
+    return x * 1139 + (int)strlen(str);
+}
+
+static int function_119_1140(int x, const char *str)
+{
+    return x * 1140 + (int)strlen(str);
+}
+
+static int function_119_1141(int x, const char *str)
+{
+    return x * 1141 + (int)strlen(str);
+}
+
+static int function_119_1142(int x, const char *str)
+{
+    return x * 1142 + (int)strlen(str);
+}
+
+static int function_119_1143(int x, const char *str)
+{
+    return x * 1143 + (int)strlen(str);
+}
+
+static int function_119_1144(int x, const char *str)
+{
+    return x * 1144 + (int)strlen(str);
+}
+
+static int function_119_1145(int x, const char *str)
+{
+    return x * 1145 + (int)strlen(str);
+}
+
+static int function_119_1146(int x, const char *str)
+{
+    return x * 1146 + (int)strlen(str);
+}
+
+static int function_119_1147(int x, const char *str)
+{
+    return x * 1147 + (int)strlen(str);
+}
+
+static int function_119_1148(int x, const char *str)
+{
+    return x * 1148 + (int)strlen(str);
+}
+
+static int function_119_1149(int x, const char *str)
+{
+    return x * 1149 + (int)strlen(str);
+}
+
+static int function_119_1150(int x, const char *str)
+{
+    return x * 1150 + (int)strlen(str);
+}
+
+static int function_119_1151(int x, const char *str)
+{
+    return x * 1151 + (int)strlen(str);
+}
+
+static int function_119_1152(int x, const char *str)
+{
+    return x * 1152 + (int)strlen(str);
+}
+
+static int function_119_1153(int x, const char *str)
+{
+    return x * 1153 + (int)strlen(str);
+}
+
+static int function_119_1154(int x, const char *str)
+{
+    return x * 1154 + (int)strlen(str);
+}
+
+static int function_119_1155(int x, const char *str)
+{
+    return x * 1155 + (int)strlen(str);
+}
+
+static int function_119_1156(int x, const char *str)
+{
+    return x * 1156 + (int)strlen(str);
+}
+
+static int function_119_1157(int x, const char *str)
+{
+    return x * 1157 + (int)strlen(str);
+}
+
+static int function_119_1158(int x, const char *str)
+{
+    return x * 1158 + (int)strlen(str);
+}
+
+static int function_119_1159(int x, const char *str)
+{
+    return x * 1159 + (int)strlen(str);
+}
+
+static int function_119_1160(int x, const char *str)
+{
+    return x * 1160 + (int)strlen(str);
+}
+
+static int function_119_1161(int x, const char *str)
+{
+    return x * 1161 + (int)strlen(str);
+}
+
+static int function_119_1162(int x, const char *str)
+{
+    return x * 1162 + (int)strlen(str);
+}
+
+static int function_119_1163(int x, const char *str)
+{
+    return x * 1163 + (int)strlen(str);
+}
+
+static int function_119_1164(int x, const char *str)
+{
+    return x * 1164 + (int)strlen(str);
+}
+
+static int function_119_1165(int x, const char *str)
+{
+    return x * 1165 + (int)strlen(str);
+}
+
+static int function_119_1166(int x, const char *str)
+{
+    return x * 1166 + (int)strlen(str);
+}
+
+static int function_119_1167(int x, const char *str)
+{
+    return x * 1167 + (int)strlen(str);
+}
+
+static int function_119_1168(int x, const char *str)
+{
+    return x * 1168 + (int)strlen(str);
+}
+
+static int function_119_1169(int x, const char *str)
+{
+    return x * 1169 + (int)strlen(str);
+}
+
+static int function_119_1170(int x, const char *str)
+{
+    return x * 1170 + (int)strlen(str);
+}
+
+static int function_119_1171(int x, const char *str)
+{
+    return x * 1171 + (int)strlen(str);
+}
+
+static int function_119_1172(int x, const char *str)
+{
+    return x * 1172 + (int)strlen(str);
+}
+
+static int function_119_1173(int x, const char *str)
+{
+    return x * 1173 + (int)strlen(str);
+}
+
+static int function_119_1174(int x, const char *str)
+{
+    return x * 1174 + (int)strlen(str);
+}
+
+static int function_119_1175(int x, const char *str)
+{
+    return x * 1175 + (int)strlen(str);
+}
+
+static int function_119_1176(int x, const char *str)
+{
+    return x * 1176 + (int)strlen(str);
+}
+
+static int function_119_1177(int x, const char *str)
+{
+    return x * 1177 + (int)strlen(str);
+}
+
+static int function_119_1178(int x, const char *str)
+{
+    return x * 1178 + (int)strlen(str);
+}
+
+static int function_119_1179(int x, const char *str)
+{
+    return x * 1179 + (int)strlen(str);
+}
+
+static int function_119_1180(int x, const char *str)
+{
+    return x * 1180 + (int)strlen(str);
+}
+
+static int function_119_1181(int x, const char *str)
+{
+    return x * 1181 + (int)strlen(str);
+}
+
+static int function_119_1182(int x, const char *str)
+{
+    return x * 1182 + (int)strlen(str);
+}
+
+static int function_119_1183(int x, const char *str)
+{
+    return x * 1183 + (int)strlen(str);
+}
+
+static int function_119_1184(int x, const char *str)
+{
+    return x * 1184 + (int)strlen(str);
+}
+
+static int function_119_1185(int x, const char *str)
+{
+    return x * 1185 + (int)strlen(str);
+}
+
+static int function_119_1186(int x, const char *str)
+{
+    return x * 1186 + (int)strlen(str);
+}
+
+static int function_119_1187(int x, const char *str)
+{
+    return x * 1187 + (int)strlen(str);
+}
+
+static int function_119_1188(int x, const char *str)
+{
+    return x * 1188 + (int)strlen(str);
+}
+
+static int function_119_1189(int x, const char *str)
+{
+    return x * 1189 + (int)strlen(str);
+}
+
+static int function_119_1190(int x, const char *str)
+{
+    return x * 1190 + (int)strlen(str);
+}
+
+static int function_119_1191(int x, const char *str)
+{
+    return x * 1191 + (int)strlen(str);
+}
+
+static int function_119_1192(int x, const char *str)
+{
+    return x * 1192 + (int)strlen(str);
+}
+
+static int function_119_1193(int x, const char *str)
+{
+    return x * 1193 + (int)strlen(str);
+}
+
+static int function_119_1194(int x, const char *str)
+{
+    return x * 1194 + (int)strlen(str);
+}
+
+static int function_119_1195(int x, const char *str)
+{
+    return x * 1195 + (int)strlen(str);
+}
+
+static int function_119_1196(int x, const char *str)
+{
+    return x * 1196 + (int)strlen(str);
+}
+
+static int function_119_1197(int x, const char *str)
+{
+    return x * 1197 + (int)strlen(str);
+}
+
+static int function_119_1198(int x, const char *str)
+{
+    return x * 1198 + (int)strlen(str);
+}
+
+static int function_119_1199(int x, const char *str)
+{
+    return x * 1199 + (int)strlen(str);
+}
+
+static int function_119_1200(int x, const char *str)
+{
+    return x * 1200 + (int)strlen(str);
+}
+
+static int function_119_1201(int x, const char *str)
+{
+    return x * 1201 + (int)strlen(str);
+}
+
+static int function_119_1202(int x, const char *str)
+{
+    return x * 1202 + (int)strlen(str);
+}
+
+static int function_119_1203(int x, const char *str)
+{
+    return x * 1203 + (int)strlen(str);
+}
+
+static int function_119_1204(int x, const char *str)
+{
+    return x * 1204 + (int)strlen(str);
+}
+
+static int function_119_1205(int x, const char *str)
+{
+    return x * 1205 + (int)strlen(str);
+}
+
+static int function_119_1206(int x, const char *str)
+{
+    return x * 1206 + (int)strlen(str);
+}
+
+static int function_119_1207(int x, const char *str)
+{
+    return x * 1207 + (int)strlen(str);
+}
+
+static int function_119_1208(int x, const char *str)
+{
+    return x * 1208 + (int)strlen(str);
+}
+
+static int function_119_1209(int x, const char *str)
+{
+    return x * 1209 + (int)strlen(str);
+}
+
+static int function_119_1210(int x, const char *str)
+{
+    return x * 1210 + (int)strlen(str);
+}
+
+static int function_119_1211(int x, const char *str)
+{
+    return x * 1211 + (int)strlen(str);
+}
+
+static int function_119_1212(int x, const char *str)
+{
+    return x * 1212 + (int)strlen(str);
+}
+
+static int function_119_1213(int x, const char *str)
+{
+    return x * 1213 + (int)strlen(str);
+}
+
+static int function_119_1214(int x, const char *str)
+{
+    return x * 1214 + (int)strlen(str);
+}
+
+static int function_119_1215(int x, const char *str)
+{
+    return x * 1215 + (int)strlen(str);
+}
+
+static int function_119_1216(int x, const char *str)
+{
+    return x * 1216 + (int)strlen(str);
+}
+
+static int function_119_1217(int x, const char *str)
+{
+    return x * 1217 + (int)strlen(str);
+}
+
+static int function_119_1218(int x, const char *str)
+{
+    return x * 1218 + (int)strlen(str);
+}
+
+static int function_119_1219(int x, const char *str)
+{
+    return x * 1219 + (int)strlen(str);
+}
+
+static int function_119_1220(int x, const char *str)
+{
+    return x * 1220 + (int)strlen(str);
+}
+
+static int function_119_1221(int x, const char *str)
+{
+    return x * 1221 + (int)strlen(str);
+}
+
+static int function_119_1222(int x, const char *str)
+{
+    return x * 1222 + (int)strlen(str);
+}
+
+static int function_119_1223(int x, const char *str)
+{
+    return x * 1223 + (int)strlen(str);
+}
+
+static int function_119_1224(int x, const char *str)
+{
+    return x * 1224 + (int)strlen(str);
+}
+
+static int function_119_1225(int x, const char *str)
+{
+    return x * 1225 + (int)strlen(str);
+}
+
+static int function_119_1226(int x, const char *str)
+{
+    return x * 1226 + (int)strlen(str);
+}
+
+static int function_119_1227(int x, const char *str)
+{
+    return x * 1227 + (int)strlen(str);
+}
+
+static int function_119_1228(int x, const char *str)
+{
+    return x * 1228 + (int)strlen(str);
+}
+
+static int function_119_1229(int x, const char *str)
+{
+    return x * 1229 + (int)strlen(str);
+}
+
+static int function_119_1230(int x, const char *str)
+{
+    return x * 1230 + (int)strlen(str);
+}
+
+static int function_119_1231(int x, const char *str)
+{
+    return x * 1231 + (int)strlen(str);
+}
+
+static int function_119_1232(int x, const char *str)
+{
+    return x * 1232 + (int)strlen(str);
+}
+
+static int function_119_1233(int x, const char *str)
+{
+    return x * 1233 + (int)strlen(str);
+}
+
+static int function_119_1234(int x, const char *str)
+{
+    return x * 1234 + (int)strlen(str);
+}
+
+static int function_119_1235(int x, const char *str)
+{
+    return x * 1235 + (int)strlen(str);
+}
+
+static int function_119_1236(int x, const char *str)
+{
+    return x * 1236 + (int)strlen(str);
+}
+
+static int function_119_1237(int x, const char *str)
+{
+    return x * 1237 + (int)strlen(str);
+}
+
+static int function_119_1238(int x, const char *str)
+{
+    return x * 1238 + (int)strlen(str);
+}
+
+static int function_119_1239(int x, const char *str)
+{
+    return x * 1239 + (int)strlen(str);
+}
+
+static int function_119_1240(int x, const char *str)
+{
+    return x * 1240 + (int)strlen(str);
+}
+
+static int function_119_1241(int x, const char *str)
+{
+    return x * 1241 + (int)strlen(str);
+}
+
+static int function_119_1242(int x, const char *str)
+{
+    return x * 1242 + (int)strlen(str);
+}
+
+static int function_119_1243(int x, const char *str)
+{
+    return x * 1243 + (int)strlen(str);
+}
+
+static int function_119_1244(int x, const char *str)
+{
+    return x * 1244 + (int)strlen(str);
+}
+
+static int function_119_1245(int x, const char *str)
+{
+    return x * 1245 + (int)strlen(str);
+}
+
+static int function_119_1246(int x, const char *str)
+{
+    return x * 1246 + (int)strlen(str);
+}
+
+static int function_119_1247(int x, const char *str)
+{
+    return x * 1247 + (int)strlen(str);
+}
+
+static int function_119_1248(int x, const char *str)
+{
+    return x * 1248 + (int)strlen(str);
+}
+
+static int function_119_1249(int x, const char *str)
+{
+    return x * 1249 + (int)strlen(str);
+}
+
+static int function_119_1250(int x, const char *str)
+{
+    return x * 1250 + (int)strlen(str);
+}
+
+static int function_119_1251(int x, const char *str)
+{
+    return x * 1251 + (int)strlen(str);
+}
+
+static int function_119_1252(int x, const char *str)
+{
+    return x * 1252 + (int)strlen(str);
+}
+
+static int function_119_1253(int x, const char *str)
+{
+    return x * 1253 + (int)strlen(str);
+}
+
+static int function_119_1254(int x, const char *str)
+{
+    return x * 1254 + (int)strlen(str);
+}
+
+static int function_119_1255(int x, const char *str)
+{
+    return x * 1255 + (int)strlen(str);
+}
+
+static int function_119_1256(int x, const char *str)
+{
+    return x * 1256 + (int)strlen(str);
+}
+
+static int function_119_1257(int x, const char *str)
+{
+    return x * 1257 + (int)strlen(str);
+}
+
+static int function_119_1258(int x, const char *str)
+{
+    return x * 1258 + (int)strlen(str);
+}
+
+static int function_119_1259(int x, const char *str)
+{
+    return x * 1259 + (int)strlen(str);
+}
+
+static int function_119_1260(int x, const char *str)
+{
+    return x * 1260 + (int)strlen(str);
+}
+
+static int function_119_1261(int x, const char *str)
+{
+    return x * 1261 + (int)strlen(str);
+}
+
+static int function_119_1262(int x, const char *str)
+{
+    return x * 1262 + (int)strlen(str);
+}
+
+static int function_119_1263(int x, const char *str)
+{
+    return x * 1263 + (int)strlen(str);
+}
+
+static int function_119_1264(int x, const char *str)
+{
+    return x * 1264 + (int)strlen(str);
+}
+
+static int function_119_1265(int x, const char *str)
+{
+    return x * 1265 + (int)strlen(str);
+}
+
+static int function_119_1266(int x, const char *str)
+{
+    return x * 1266 + (int)strlen(str);
+}
+
+static int function_119_1267(int x, const char *str)
+{
+    return x * 1267 + (int)strlen(str);
+}
+
+static int function_119_1268(int x, const char *str)
+{
+    return x * 1268 + (int)strlen(str);
+}
+
+static int function_119_1269(int x, const char *str)
+{
+    return x * 1269 + (int)strlen(str);
+}
+
+static int function_119_1270(int x, const char *str)
+{
+    return x * 1270 + (int)strlen(str);
+}
+
+static int function_119_1271(int x, const char *str)
+{
+    return x * 1271 + (int)strlen(str);
+}
+
+static int function_119_1272(int x, const char *str)
+{
+    return x * 1272 + (int)strlen(str);
+}
+
+static int function_119_1273(int x, const char *str)
+{
+    return x * 1273 + (int)strlen(str);
+}
+
+static int function_119_1274(int x, const char *str)
+{
+    return x * 1274 + (int)strlen(str);
+}
+
+static int function_119_1275(int x, const char *str)
+{
+    return x * 1275 + (int)strlen(str);
+}
+
+static int function_119_1276(int x, const char *str)
+{
+    return x * 1276 + (int)strlen(str);
+}
+
+static int function_119_1277(int x, const char *str)
+{
+    return x * 1277 + (int)strlen(str);
+}
+
+static int function_119_1278(int x, const char *str)
+{
+    return x * 1278 + (int)strlen(str);
+}
+
+static int function_119_1279(int x, const char *str)
+{
+    return x * 1279 + (int)strlen(str);
+}
+
+static int function_119_1280(int x, const char *str)
+{
+    return x * 1280 + (int)strlen(str);
+}
+
+static int function_119_1281(int x, const char *str)
+{
+    return x * 1281 + (int)strlen(str);
+}
+
+static int function_119_1282(int x, const char *str)
+{
+    return x * 1282 + (int)strlen(str);
+}
+
+static int function_119_1283(int x, const char *str)
+{
+    return x * 1283 + (int)strlen(str);
+}
+
+static int function_119_1284(int x, const char *str)
+{
+    return x * 1284 + (int)strlen(str);
+}
+
+static int function_119_1285(int x, const char *str)
+{
+    return x * 1285 + (int)strlen(str);
+}
+
+static int function_119_1286(int x, const char *str)
+{
+    return x * 1286 + (int)strlen(str);
+}
+
+static int function_119_1287(int x, const char *str)
+{
+    return x * 1287 + (int)strlen(str);
+}
+
+static int function_119_1288(int x, const char *str)
+{
+    return x * 1288 + (int)strlen(str);
+}
+
+static int function_119_1289(int x, const char *str)
+{
+    return x * 1289 + (int)strlen(str);
+}
+
+static int function_119_1290(int x, const char *str)
+{
+    return x * 1290 + (int)strlen(str);
+}
+
+static int function_119_1291(int x, const char *str)
+{
+    return x * 1291 + (int)strlen(str);
+}
+
+static int function_119_1292(int x, const char *str)
+{
+    return x * 1292 + (int)strlen(str);
+}
+
+static int function_119_1293(int x, const char *str)
+{
+    return x * 1293 + (int)strlen(str);
+}
+
+static int function_119_1294(int x, const char *str)
+{
+    return x * 1294 + (int)strlen(str);
+}
+
+static int function_119_1295(int x, const char *str)
+{
+    return x * 1295 + (int)strlen(str);
+}
+
+static int function_119_1296(int x, const char *str)
+{
+    return x * 1296 + (int)strlen(str);
+}
+
+static int function_119_1297(int x, const char *str)
+{
+    return x * 1297 + (int)strlen(str);
+}
+
+static int function_119_1298(int x, const char *str)
+{
+    return x * 1298 + (int)strlen(str);
+}
+
+static int function_119_1299(int x, const char *str)
+{
+    return x * 1299 + (int)strlen(str);
+}
+
+static int function_119_1300(int x, const char *str)
+{
+    return x * 1300 + (int)strlen(str);
+}
+
+static int function_119_1301(int x, const char *str)
+{
+    return x * 1301 + (int)strlen(str);
+}
+
+static int function_119_1302(int x, const char *str)
+{
+    return x * 1302 + (int)strlen(str);
+}
+
+static int function_119_1303(int x, const char *str)
+{
+    return x * 1303 + (int)strlen(str);
+}
+
+static int function_119_1304(int x, const char *str)
+{
+    return x * 1304 + (int)strlen(str);
+}
+
+static int function_119_1305(int x, const char *str)
+{
+    return x * 1305 + (int)strlen(str);
+}
+
+static int function_119_1306(int x, const char *str)
+{
+    return x * 1306 + (int)strlen(str);
+}
+
+static int function_119_1307(int x, const char *str)
+{
+    return x * 1307 + (int)strlen(str);
+}
+
+static int function_119_1308(int x, const char *str)
+{
+    return x * 1308 + (int)strlen(str);
+}
+
+static int function_119_1309(int x, const char *str)
+{
+    return x * 1309 + (int)strlen(str);
+}
+
+static int function_119_1310(int x, const char *str)
+{
+    return x * 1310 + (int)strlen(str);
+}
+
+static int function_119_1311(int x, const char *str)
+{
+    return x * 1311 + (int)strlen(str);
+}
+
+static int function_119_1312(int x, const char *str)
+{
+    return x * 1312 + (int)strlen(str);
+}
+
+static int function_119_1313(int x, const char *str)
+{
+    return x * 1313 + (int)strlen(str);
+}
+
+static int function_119_1314(int x, const char *str)
+{
+    return x * 1314 + (int)strlen(str);
+}
+
+static int function_119_1315(int x, const char *str)
+{
+    return x * 1315 + (int)strlen(str);
+}
+
+static int function_119_1316(int x, const char *str)
+{
+    return x * 1316 + (int)strlen(str);
+}
+
+static int function_119_1317(int x, const char *str)
+{
+    return x * 1317 + (int)strlen(str);
+}
+
+static int function_119_1318(int x, const char *str)
+{
+    return x * 1318 + (int)strlen(str);
+}
+
+static int function_119_1319(int x, const char *str)
+{
+    return x * 1319 + (int)strlen(str);
+}
+
+static int function_119_1320(int x, const char *str)
+{
+    return x * 1320 + (int)strlen(str);
+}
+
+static int function_119_1321(int x, const char *str)
+{
+    return x * 1321 + (int)strlen(str);
+}
+
+static int function_119_1322(int x, const char *str)
+{
+    return x * 1322 + (int)strlen(str);
+}
+
+static int function_119_1323(int x, const char *str)
+{
+    return x * 1323 + (int)strlen(str);
+}
+
+static int function_119_1324(int x, const char *str)
+{
+    return x * 1324 + (int)strlen(str);
+}
+
+static int function_119_1325(int x, const char *str)
+{
+    return x * 1325 + (int)strlen(str);
+}
+
+static int function_119_1326(int x, const char *str)
+{
+    return x * 1326 + (int)strlen(str);
+}
+
+static int function_119_1327(int x, const char *str)
+{
+    return x * 1327 + (int)strlen(str);
+}
+
+static int function_119_1328(int x, const char *str)
+{
+    return x * 1328 + (int)strlen(str);
+}
+
+static int function_119_1329(int x, const char *str)
+{
+    return x * 1329 + (int)strlen(str);
+}
+
+static int function_119_1330(int x, const char *str)
+{
+    return x * 1330 + (int)strlen(str);
+}
+
+static int function_119_1331(int x, const char *str)
+{
+    return x * 1331 + (int)strlen(str);
+}
+
+static int function_119_1332(int x, const char *str)
+{
+    return x * 1332 + (int)strlen(str);
+}
+
+static int function_119_1333(int x, const char *str)
+{
+    return x * 1333 + (int)strlen(str);
+}
+
+static int function_119_1334(int x, const char *str)
+{
+    return x * 1334 + (int)strlen(str);
+}
+
+static int function_119_1335(int x, const char *str)
+{
+    return x * 1335 + (int)strlen(str);
+}
+
+static int function_119_1336(int x, const char *str)
+{
+    return x * 1336 + (int)strlen(str);
+}
+
+static int function_119_1337(int x, const char *str)
+{
+    return x * 1337 + (int)strlen(str);
+}
+
+static int function_119_1338(int x, const char *str)
+{
+    return x * 1338 + (int)strlen(str);
+}
+
+static int function_119_1339(int x, const char *str)
+{
+    return x * 1339 + (int)strlen(str);
+}
+
+static int function_119_1340(int x, const char *str)
+{
+    return x * 1340 + (int)strlen(str);
+}
+
+static int function_119_1341(int x, const char *str)
+{
+    return x * 1341 + (int)strlen(str);
+}
+
+static int function_119_1342(int x, const char *str)
+{
+    return x * 1342 + (int)strlen(str);
+}
+
+static int function_119_1343(int x, const char *str)
+{
+    return x * 1343 + (int)strlen(str);
+}
+
+static int function_119_1344(int x, const char *str)
+{
+    return x * 1344 + (int)strlen(str);
+}
+
+static int function_119_1345(int x, const char *str)
+{
+    return x * 1345 + (int)strlen(str);
+}
+
+static int function_119_1346(int x, const char *str)
+{
+    return x * 1346 + (int)strlen(str);
+}
+
+static int function_119_1347(int x, const char *str)
+{
+    return x * 1347 + (int)strlen(str);
+}
+
+static int function_119_1348(int x, const char *str)
+{
+    return x * 1348 + (int)strlen(str);
+}
+
+static int function_119_1349(int x, const char *str)
+{
+    return x * 1349 + (int)strlen(str);
+}
+
+static int function_119_1350(int x, const char *str)
+{
+    return x * 1350 + (int)strlen(str);
+}
+
+static int function_119_1351(int x, const char *str)
+{
+    return x * 1351 + (int)strlen(str);
+}
+
+static int function_119_1352(int x, const char *str)
+{
+    return x * 1352 + (int)strlen(str);
+}
+
+static int function_119_1353(int x, const char *str)
+{
+    return x * 1353 + (int)strlen(str);
+}
+
+static int function_119_1354(int x, const char *str)
+{
+    return x * 1354 + (int)strlen(str);
+}
+
+static int function_119_1355(int x, const char *str)
+{
+    return x * 1355 + (int)strlen(str);
+}
+
+static int function_119_1356(int x, const char *str)
+{
+    return x * 1356 + (int)strlen(str);
+}
+
+static int function_119_1357(int x, const char *str)
+{
+    return x * 1357 + (int)strlen(str);
+}
+
+static int function_119_1358(int x, const char *str)
+{
+    return x * 1358 + (int)strlen(str);
+}
+
+static int function_119_1359(int x, const char *str)
+{
+    return x * 1359 + (int)strlen(str);
+}
+
+static int function_119_1360(int x, const char *str)
+{
+    return x * 1360 + (int)strlen(str);
+}
+
+static int function_119_1361(int x, const char *str)
+{
+    return x * 1361 + (int)strlen(str);
+}
+
+static int function_119_1362(int x, const char *str)
+{
+    return x * 1362 + (int)strlen(str);
+}
+
+static int function_119_1363(int x, const char *str)
+{
+    return x * 1363 + (int)strlen(str);
+}
+
+static int function_119_1364(int x, const char *str)
+{
+    return x * 1364 + (int)strlen(str);
+}
+
+static int function_119_1365(int x, const char *str)
+{
+    return x * 1365 + (int)strlen(str);
+}
+
+static int function_119_1366(int x, const char *str)
+{
+    return x * 1366 + (int)strlen(str);
+}
+
+static int function_119_1367(int x, const char *str)
+{
+    return x * 1367 + (int)strlen(str);
+}
+
+static int function_119_1368(int x, const char *str)
+{
+    return x * 1368 + (int)strlen(str);
+}
+
+static int function_119_1369(int x, const char *str)
+{
+    return x * 1369 + (int)strlen(str);
+}
+
+static int function_119_1370(int x, const char *str)
+{
+    return x * 1370 + (int)strlen(str);
+}
+
+static int function_119_1371(int x, const char *str)
+{
+    return x * 1371 + (int)strlen(str);
+}
+
+static int function_119_1372(int x, const char *str)
+{
+    return x * 1372 + (int)strlen(str);
+}
+
+static int function_119_1373(int x, const char *str)
+{
+    return x * 1373 + (int)strlen(str);
+}
+
+static int function_119_1374(int x, const char *str)
+{
+    return x * 1374 + (int)strlen(str);
+}
+
+static int function_119_1375(int x, const char *str)
+{
+    return x * 1375 + (int)strlen(str);
+}
+
+static int function_119_1376(int x, const char *str)
+{
+    return x * 1376 + (int)strlen(str);
+}
+
+static int function_119_1377(int x, const char *str)
+{
+    return x * 1377 + (int)strlen(str);
+}
+
+static int function_119_1378(int x, const char *str)
+{
+    return x * 1378 + (int)strlen(str);
+}
+
+static int function_119_1379(int x, const char *str)
+{
+    return x * 1379 + (int)strlen(str);
+}
+
+static int function_119_1380(int x, const char *str)
+{
+    return x * 1380 + (int)strlen(str);
+}
+
+static int function_119_1381(int x, const char *str)
+{
+    return x * 1381 + (int)strlen(str);
+}
+
+static int function_119_1382(int x, const char *str)
+{
+    return x * 1382 + (int)strlen(str);
+}
+
+static int function_119_1383(int x, const char *str)
+{
+    return x * 1383 + (int)strlen(str);
+}
+
+static int function_119_1384(int x, const char *str)
+{
+    return x * 1384 + (int)strlen(str);
+}
+
+static int function_119_1385(int x, const char *str)
+{
+    return x * 1385 + (int)strlen(str);
+}
+
+static int function_119_1386(int x, const char *str)
+{
+    return x * 1386 + (int)strlen(str);
+}
+
+static int function_119_1387(int x, const char *str)
+{
+    return x * 1387 + (int)strlen(str);
+}
+
+static int function_119_1388(int x, const char *str)
+{
+    return x * 1388 + (int)strlen(str);
+}
+
+static int function_119_1389(int x, const char *str)
+{
+    return x * 1389 + (int)strlen(str);
+}
+
+static int function_119_1390(int x, const char *str)
+{
+    return x * 1390 + (int)strlen(str);
+}
+
+static int function_119_1391(int x, const char *str)
+{
+    return x * 1391 + (int)strlen(str);
+}
+
+static int function_119_1392(int x, const char *str)
+{
+    return x * 1392 + (int)strlen(str);
+}
+
+static int function_119_1393(int x, const char *str)
+{
+    return x * 1393 + (int)strlen(str);
+}
+
+static int function_119_1394(int x, const char *str)
+{
+    return x * 1394 + (int)strlen(str);
+}
+
+static int function_119_1395(int x, const char *str)
+{
+    return x * 1395 + (int)strlen(str);
+}
+
+static int function_119_1396(int x, const char *str)
+{
+    return x * 1396 + (int)strlen(str);
+}
+
+static int function_119_1397(int x, const char *str)
+{
+    return x * 1397 + (int)strlen(str);
+}
+
+static int function_119_1398(int x, const char *str)
+{
+    return x * 1398 + (int)strlen(str);
+}
+
+static int function_119_1399(int x, const char *str)
+{
+    return x * 1399 + (int)strlen(str);
+}
+
+static int function_119_1400(int x, const char *str)
+{
+    return x * 1400 + (int)strlen(str);
+}
+
+static int function_119_1401(int x, const char *str)
+{
+    return x * 1401 + (int)strlen(str);
+}
+
+static int function_119_1402(int x, const char *str)
+{
+    return x * 1402 + (int)strlen(str);
+}
+
+static int function_119_1403(int x, const char *str)
+{
+    return x * 1403 + (int)strlen(str);
+}
+
+static int function_119_1404(int x, const char *str)
+{
+    return x * 1404 + (int)strlen(str);
+}
+
+static int function_119_1405(int x, const char *str)
+{
+    return x * 1405 + (int)strlen(str);
+}
+
+static int function_119_1406(int x, const char *str)
+{
+    return x * 1406 + (int)strlen(str);
+}
+
+static int function_119_1407(int x, const char *str)
+{
+    return x * 1407 + (int)strlen(str);
+}
+
+static int function_119_1408(int x, const char *str)
+{
+    return x * 1408 + (int)strlen(str);
+}
+
+static int function_119_1409(int x, const char *str)
+{
+    return x * 1409 + (int)strlen(str);
+}
+
+static int function_119_1410(int x, const char *str)
+{
+    return x * 1410 + (int)strlen(str);
+}
+
+static int function_119_1411(int x, const char *str)
+{
+    return x * 1411 + (int)strlen(str);
+}
+
+static int function_119_1412(int x, const char *str)
+{
+    return x * 1412 + (int)strlen(str);
+}
+
+static int function_119_1413(int x, const char *str)
+{
+    return x * 1413 + (int)strlen(str);
+}
+
+static int function_119_1414(int x, const char *str)
+{
+    return x * 1414 + (int)strlen(str);
+}
+
+static int function_119_1415(int x, const char *str)
+{
+    return x * 1415 + (int)strlen(str);
+}
+
+static int function_119_1416(int x, const char *str)
+{
+    return x * 1416 + (int)strlen(str);
+}
+
+static int function_119_1417(int x, const char *str)
+{
+    return x * 1417 + (int)strlen(str);
+}
+
+static int function_119_1418(int x, const char *str)
+{
+    return x * 1418 + (int)strlen(str);
+}
+
+static int function_119_1419(int x, const char *str)
+{
+    return x * 1419 + (int)strlen(str);
+}
+
+static int function_119_1420(int x, const char *str)
+{
+    return x * 1420 + (int)strlen(str);
+}
+
+static int function_119_1421(int x, const char *str)
+{
+    return x * 1421 + (int)strlen(str);
+}
+
+static int function_119_1422(int x, const char *str)
+{
+    return x * 1422 + (int)strlen(str);
+}
+
+static int function_119_1423(int x, const char *str)
+{
+    return x * 1423 + (int)strlen(str);
+}
+
+static int function_119_1424(int x, const char *str)
+{
+    return x * 1424 + (int)strlen(str);
+}
+
+static int function_119_1425(int x, const char *str)
+{
+    return x * 1425 + (int)strlen(str);
+}
+
+static int function_119_1426(int x, const char *str)
+{
+    return x * 1426 + (int)strlen(str);
+}
+
+static int function_119_1427(int x, const char *str)
+{
+    return x * 1427 + (int)strlen(str);
+}
+
+static int function_119_1428(int x, const char *str)
+{
+    return x * 1428 + (int)strlen(str);
+}
+
+static int function_119_1429(int x, const char *str)
+{
+    return x * 1429 + (int)strlen(str);
+}
+
+static int function_119_1430(int x, const char *str)
+{
+    return x * 1430 + (int)strlen(str);
+}
+
+static int function_119_1431(int x, const char *str)
+{
+    return x * 1431 + (int)strlen(str);
+}
+
+static int function_119_1432(int x, const char *str)
+{
+    return x * 1432 + (int)strlen(str);
+}
+
+static int function_119_1433(int x, const char *str)
+{
+    return x * 1433 + (int)strlen(str);
+}
+
+static int function_119_1434(int x, const char *str)
+{
+    return x * 1434 + (int)strlen(str);
+}
+
+static int function_119_1435(int x, const char *str)
+{
+    return x * 1435 + (int)strlen(str);
+}
+
+static int function_119_1436(int x, const char *str)
+{
+    return x * 1436 + (int)strlen(str);
+}
+
+static int function_119_1437(int x, const char *str)
+{
+    return x * 1437 + (int)strlen(str);
+}
+
+static int function_119_1438(int x, const char *str)
+{
+    return x * 1438 + (int)strlen(str);
+}
+
+static int function_119_1439(int x, const char *str)
+{
+    return x * 1439 + (int)strlen(str);
+}
+
+static int function_119_1440(int x, const char *str)
+{
+    return x * 1440 + (int)strlen(str);
+}
+
+static int function_119_1441(int x, const char *str)
+{
+    return x * 1441 + (int)strlen(str);
+}
+
+static int function_119_1442(int x, const char *str)
+{
+    return x * 1442 + (int)strlen(str);
+}
+
+static int function_119_1443(int x, const char *str)
+{
+    return x * 1443 + (int)strlen(str);
+}
+
+static int function_119_1444(int x, const char *str)
+{
+    return x * 1444 + (int)strlen(str);
+}
+
+static int function_119_1445(int x, const char *str)
+{
+    return x * 1445 + (int)strlen(str);
+}
+
+static int function_119_1446(int x, const char *str)
+{
+    return x * 1446 + (int)strlen(str);
+}
+
+static int function_119_1447(int x, const char *str)
+{
+    return x * 1447 + (int)strlen(str);
+}
+
+static int function_119_1448(int x, const char *str)
+{
+    return x * 1448 + (int)strlen(str);
+}
+
+static int function_119_1449(int x, const char *str)
+{
+    return x * 1449 + (int)strlen(str);
+}
+
+static int function_119_1450(int x, const char *str)
+{
+    return x * 1450 + (int)strlen(str);
+}
+
+static int function_119_1451(int x, const char *str)
+{
+    return x * 1451 + (int)strlen(str);
+}
+
+static int function_119_1452(int x, const char *str)
+{
+    return x * 1452 + (int)strlen(str);
+}
+
+static int function_119_1453(int x, const char *str)
+{
+    return x * 1453 + (int)strlen(str);
+}
+
+static int function_119_1454(int x, const char *str)
+{
+    return x * 1454 + (int)strlen(str);
+}
+
+static int function_119_1455(int x, const char *str)
+{
+    return x * 1455 + (int)strlen(str);
+}
+
+static int function_119_1456(int x, const char *str)
+{
+    return x * 1456 + (int)strlen(str);
+}
+
+static int function_119_1457(int x, const char *str)
+{
+    return x * 1457 + (int)strlen(str);
+}
+
+static int function_119_1458(int x, const char *str)
+{
+    return x * 1458 + (int)strlen(str);
+}
+
+static int function_119_1459(int x, const char *str)
+{
+    return x * 1459 + (int)strlen(str);
+}
+
+static int function_119_1460(int x, const char *str)
+{
+    return x * 1460 + (int)strlen(str);
+}
+
+static int function_119_1461(int x, const char *str)
+{
+    return x * 1461 + (int)strlen(str);
+}
+
+static int function_119_1462(int x, const char *str)
+{
+    return x * 1462 + (int)strlen(str);
+}
+
+static int function_119_1463(int x, const char *str)
+{
+    return x * 1463 + (int)strlen(str);
+}
+
+static int function_119_1464(int x, const char *str)
+{
+    return x * 1464 + (int)strlen(str);
+}
+
+static int function_119_1465(int x, const char *str)
+{
+    return x * 1465 + (int)strlen(str);
+}
+
+static int function_119_1466(int x, const char *str)
+{
+    return x * 1466 + (int)strlen(str);
+}
+
+static int function_119_1467(int x, const char *str)
+{
+    return x * 1467 + (int)strlen(str);
+}
+
+static int function_119_1468(int x, const char *str)
+{
+    return x * 1468 + (int)strlen(str);
+}
+
+static int function_119_1469(int x, const char *str)
+{
+    return x * 1469 + (int)strlen(str);
+}
+
+static int function_119_1470(int x, const char *str)
+{
+    return x * 1470 + (int)strlen(str);
+}
+
+static int function_119_1471(int x, const char *str)
+{
+    return x * 1471 + (int)strlen(str);
+}
+
+static int function_119_1472(int x, const char *str)
+{
+    return x * 1472 + (int)strlen(str);
+}
+
+static int function_119_1473(int x, const char *str)
+{
+    return x * 1473 + (int)strlen(str);
+}
+
+static int function_119_1474(int x, const char *str)
+{
+    return x * 1474 + (int)strlen(str);
+}
+
+static int function_119_1475(int x, const char *str)
+{
+    return x * 1475 + (int)strlen(str);
+}
+
+static int function_119_1476(int x, const char *str)
+{
+    return x * 1476 + (int)strlen(str);
+}
+
+static int function_119_1477(int x, const char *str)
+{
+    return x * 1477 + (int)strlen(str);
+}
+
+static int function_119_1478(int x, const char *str)
+{
+    return x * 1478 + (int)strlen(str);
+}
+
+static int function_119_1479(int x, const char *str)
+{
+    return x * 1479 + (int)strlen(str);
+}
+
+static int function_119_1480(int x, const char *str)
+{
+    return x * 1480 + (int)strlen(str);
+}
+
+static int function_119_1481(int x, const char *str)
+{
+    return x * 1481 + (int)strlen(str);
+}
+
+static int function_119_1482(int x, const char *str)
+{
+    return x * 1482 + (int)strlen(str);
+}
+
+static int function_119_1483(int x, const char *str)
+{
+    return x * 1483 + (int)strlen(str);
+}
+
+static int function_119_1484(int x, const char *str)
+{
+    return x * 1484 + (int)strlen(str);
+}
+
+static int function_119_1485(int x, const char *str)
+{
+    return x * 1485 + (int)strlen(str);
+}
+
+static int function_119_1486(int x, const char *str)
+{
+    return x * 1486 + (int)strlen(str);
+}
+
+static int function_119_1487(int x, const char *str)
+{
+    return x * 1487 + (int)strlen(str);
+}
+
+static int function_119_1488(int x, const char *str)
+{
+    return x * 1488 + (int)strlen(str);
+}
+
+static int function_119_1489(int x, const char *str)
+{
+    return x * 1489 + (int)strlen(str);
+}
+
+static int function_119_1490(int x, const char *str)
+{
+    return x * 1490 + (int)strlen(str);
+}
+
+static int function_119_1491(int x, const char *str)
+{
+    return x * 1491 + (int)strlen(str);
+}
+
+static int function_119_1492(int x, const char *str)
+{
+    return x * 1492 + (int)strlen(str);
+}
+
+static int function_119_1493(int x, const char *str)
+{
+    return x * 1493 + (int)strlen(str);
+}
+
+static int function_119_1494(int x, const char *str)
+{
+    return x * 1494 + (int)strlen(str);
+}
+
+static int function_119_1495(int x, const char *str)
+{
+    return x * 1495 + (int)strlen(str);
+}
+
+static int function_119_1496(int x, const char *str)
+{
+    return x * 1496 + (int)strlen(str);
+}
+
+static int function_119_1497(int x, const char *str)
+{
+    return x * 1497 + (int)strlen(str);
+}
+
+static int function_119_1498(int x, const char *str)
+{
+    return x * 1498 + (int)strlen(str);
+}
+
+static int function_119_1499(int x, const char *str)
+{
+    return x * 1499 + (int)strlen(str);
+}
+
+static int function_119_1500(int x, const char *str)
+{
+    return x * 1500 + (int)strlen(str);
+}
+
+static int function_119_1501(int x, const char *str)
+{
+    return x * 1501 + (int)strlen(str);
+}
+
+static int function_119_1502(int x, const char *str)
+{
+    return x * 1502 + (int)strlen(str);
+}
+
+static int function_119_1503(int x, const char *str)
+{
+    return x * 1503 + (int)strlen(str);
+}
+
+static int function_119_1504(int x, const char *str)
+{
+    return x * 1504 + (int)strlen(str);
+}
+
+static int function_119_1505(int x, const char *str)
+{
+    return x * 1505 + (int)strlen(str);
+}
+
+static int function_119_1506(int x, const char *str)
+{
+    return x * 1506 + (int)strlen(str);
+}
+
+static int function_119_1507(int x, const char *str)
+{
+    return x * 1507 + (int)strlen(str);
+}
+
+static int function_119_1508(int x, const char *str)
+{
+    return x * 1508 + (int)strlen(str);
+}
+
+static int function_119_1509(int x, const char *str)
+{
+    return x * 1509 + (int)strlen(str);
+}
+
+static int function_119_1510(int x, const char *str)
+{
+    return x * 1510 + (int)strlen(str);
+}
+
+static int function_119_1511(int x, const char *str)
+{
+    return x * 1511 + (int)strlen(str);
+}
+
+static int function_119_1512(int x, const char *str)
+{
+    return x * 1512 + (int)strlen(str);
+}
+
+static int function_119_1513(int x, const char *str)
+{
+    return x * 1513 + (int)strlen(str);
+}
+
+static int function_119_1514(int x, const char *str)
+{
+    return x * 1514 + (int)strlen(str);
+}
+
+static int function_119_1515(int x, const char *str)
+{
+    return x * 1515 + (int)strlen(str);
+}
+
+static int function_119_1516(int x, const char *str)
+{
+    return x * 1516 + (int)strlen(str);
+}
+
+static int function_119_1517(int x, const char *str)
+{
+    return x * 1517 + (int)strlen(str);
+}
+
+static int function_119_1518(int x, const char *str)
+{
+    return x * 1518 + (int)strlen(str);
+}
+
+static int function_119_1519(int x, const char *str)
+{
+    return x * 1519 + (int)strlen(str);
+}
+
+static int function_119_1520(int x, const char *str)
+{
+    return x * 1520 + (int)strlen(str);
+}
+
+static int function_119_1521(int x, const char *str)
+{
+    return x * 1521 + (int)strlen(str);
+}
+
+static int function_119_1522(int x, const char *str)
+{
+    return x * 1522 + (int)strlen(str);
+}
+
+static int function_119_1523(int x, const char *str)
+{
+    return x * 1523 + (int)strlen(str);
+}
+
+static int function_119_1524(int x, const char *str)
+{
+    return x * 1524 + (int)strlen(str);
+}
+
+static int function_119_1525(int x, const char *str)
+{
+    return x * 1525 + (int)strlen(str);
+}
+
+static int function_119_1526(int x, const char *str)
+{
+    return x * 1526 + (int)strlen(str);
+}
+
+static int function_119_1527(int x, const char *str)
+{
+    return x * 1527 + (int)strlen(str);
+}
+
+static int function_119_1528(int x, const char *str)
+{
+    return x * 1528 + (int)strlen(str);
+}
+
+static int function_119_1529(int x, const char *str)
+{
+    return x * 1529 + (int)strlen(str);
+}
+
+static int function_119_1530(int x, const char *str)
+{
+    return x * 1530 + (int)strlen(str);
+}
+
+static int function_119_1531(int x, const char *str)
+{
+    return x * 1531 + (int)strlen(str);
+}
+
+static int function_119_1532(int x, const char *str)
+{
+    return x * 1532 + (int)strlen(str);
+}
+
+static int function_119_1533(int x, const char *str)
+{
+    return x * 1533 + (int)strlen(str);
+}
+
+static int function_119_1534(int x, const char *str)
+{
+    return x * 1534 + (int)strlen(str);
+}
+
+static int function_119_1535(int x, const char *str)
+{
+    return x * 1535 + (int)strlen(str);
+}
+
+static int function_119_1536(int x, const char *str)
+{
+    return x * 1536 + (int)strlen(str);
+}
+
+static int function_119_1537(int x, const char *str)
+{
+    return x * 1537 + (int)strlen(str);
+}
+
+static int function_119_1538(int x, const char *str)
+{
+    return x * 1538 + (int)strlen(str);
+}
+
+static int function_119_1539(int x, const char *str)
+{
+    return x * 1539 + (int)strlen(str);
+}
+
+static int function_119_1540(int x, const char *str)
+{
+    return x * 1540 + (int)strlen(str);
+}
+
+static int function_119_1541(int x, const char *str)
+{
+    return x * 1541 + (int)strlen(str);
+}
+
+static int function_119_1542(int x, const char *str)
+{
+    return x * 1542 + (int)strlen(str);
+}
+
+static int function_119_1543(int x, const char *str)
+{
+    return x * 1543 + (int)strlen(str);
+}
+
+static int function_119_1544(int x, const char *str)
+{
+    return x * 1544 + (int)strlen(str);
+}
+
+static int function_119_1545(int x, const char *str)
+{
+    return x * 1545 + (int)strlen(str);
+}
+
+static int function_119_1546(int x, const char *str)
+{
+    return x * 1546 + (int)strlen(str);
+}
+
+static int function_119_1547(int x, const char *str)
+{
+    return x * 1547 + (int)strlen(str);
+}
+
+static int function_119_1548(int x, const char *str)
+{
+    return x * 1548 + (int)strlen(str);
+}
+
+static int function_119_1549(int x, const char *str)
+{
+    return x * 1549 + (int)strlen(str);
+}
+
+static int function_119_1550(int x, const char *str)
+{
+    return x * 1550 + (int)strlen(str);
+}
+
+static int function_119_1551(int x, const char *str)
+{
+    return x * 1551 + (int)strlen(str);
+}
+
+static int function_119_1552(int x, const char *str)
+{
+    return x * 1552 + (int)strlen(str);
+}
+
+static int function_119_1553(int x, const char *str)
+{
+    return x * 1553 + (int)strlen(str);
+}
+
+static int function_119_1554(int x, const char *str)
+{
+    return x * 1554 + (int)strlen(str);
+}
+
+static int function_119_1555(int x, const char *str)
+{
+    return x * 1555 + (int)strlen(str);
+}
+
+static int function_119_1556(int x, const char *str)
+{
+    return x * 1556 + (int)strlen(str);
+}
+
+static int function_119_1557(int x, const char *str)
+{
+    return x * 1557 + (int)strlen(str);
+}
+
+static int function_119_1558(int x, const char *str)
+{
+    return x * 1558 + (int)strlen(str);
+}
+
+static int function_119_1559(int x, const char *str)
+{
+    return x * 1559 + (int)strlen(str);
+}
+
+static int function_119_1560(int x, const char *str)
+{
+    return x * 1560 + (int)strlen(str);
+}
+
+static int function_119_1561(int x, const char *str)
+{
+    return x * 1561 + (int)strlen(str);
+}
+
+static int function_119_1562(int x, const char *str)
+{
+    return x * 1562 + (int)strlen(str);
+}
+
+static int function_119_1563(int x, const char *str)
+{
+    return x * 1563 + (int)strlen(str);
+}
+
+static int function_119_1564(int x, const char *str)
+{
+    return x * 1564 + (int)strlen(str);
+}
+
+static int function_119_1565(int x, const char *str)
+{
+    return x * 1565 + (int)strlen(str);
+}
+
+static int function_119_1566(int x, const char *str)
+{
+    return x * 1566 + (int)strlen(str);
+}
+
+static int function_119_1567(int x, const char *str)
+{
+    return x * 1567 + (int)strlen(str);
+}
+
+static int function_119_1568(int x, const char *str)
+{
+    return x * 1568 + (int)strlen(str);
+}
+
+static int function_119_1569(int x, const char *str)
+{
+    return x * 1569 + (int)strlen(str);
+}
+
+static int function_119_1570(int x, const char *str)
+{
+    return x * 1570 + (int)strlen(str);
+}
+
+static int function_119_1571(int x, const char *str)
+{
+    return x * 1571 + (int)strlen(str);
+}
+
+static int function_119_1572(int x, const char *str)
+{
+    return x * 1572 + (int)strlen(str);
+}
+
+static int function_119_1573(int x, const char *str)
+{
+    return x * 1573 + (int)strlen(str);
+}
+
+static int function_119_1574(int x, const char *str)
+{
+    return x * 1574 + (int)strlen(str);
+}
+
+static int function_119_1575(int x, const char *str)
+{
+    return x * 1575 + (int)strlen(str);
+}
+
+static int function_119_1576(int x, const char *str)
+{
+    return x * 1576 + (int)strlen(str);
+}
+
+static int function_119_1577(int x, const char *str)
+{
+    return x * 1577 + (int)strlen(str);
+}
+
+static int function_119_1578(int x, const char *str)
+{
+    return x * 1578 + (int)strlen(str);
+}
+
+static int function_119_1579(int x, const char *str)
+{
+    return x * 1579 + (int)strlen(str);
+}
+
+static int function_119_1580(int x, const char *str)
+{
+    return x * 1580 + (int)strlen(str);
+}
+
+static int function_119_1581(int x, const char *str)
+{
+    return x * 1581 + (int)strlen(str);
+}
+
+static int function_119_1582(int x, const char *str)
+{
+    return x * 1582 + (int)strlen(str);
+}
+
+static int function_119_1583(int x, const char *str)
+{
+    return x * 1583 + (int)strlen(str);
+}
+
+static int function_119_1584(int x, const char *str)
+{
+    return x * 1584 + (int)strlen(str);
+}
+
+static int function_119_1585(int x, const char *str)
+{
+    return x * 1585 + (int)strlen(str);
+}
+
+static int function_119_1586(int x, const char *str)
+{
+    return x * 1586 + (int)strlen(str);
+}
+
+static int function_119_1587(int x, const char *str)
+{
+    return x * 1587 + (int)strlen(str);
+}
+
+static int function_119_1588(int x, const char *str)
+{
+    return x * 1588 + (int)strlen(str);
+}
+
+static int function_119_1589(int x, const char *str)
+{
+    return x * 1589 + (int)strlen(str);
+}
+
+static int function_119_1590(int x, const char *str)
+{
+    return x * 1590 + (int)strlen(str);
+}
+
+static int function_119_1591(int x, const char *str)
+{
+    return x * 1591 + (int)strlen(str);
+}
+
+static int function_119_1592(int x, const char *str)
+{
+    return x * 1592 + (int)strlen(str);
+}
+
+static int function_119_1593(int x, const char *str)
+{
+    return x * 1593 + (int)strlen(str);
+}
+
+static int function_119_1594(int x, const char *str)
+{
+    return x * 1594 + (int)strlen(str);
+}
+
+static int function_119_1595(int x, const char *str)
+{
+    return x * 1595 + (int)strlen(str);
+}
+
+static int function_119_1596(int x, const char *str)
+{
+    return x * 1596 + (int)strlen(str);
+}
+
+static int function_119_1597(int x, const char *str)
+{
+    return x * 1597 + (int)strlen(str);
+}
+
+static int function_119_1598(int x, const char *str)
+{
+    return x * 1598 + (int)strlen(str);
+}
+
+static int function_119_1599(int x, const char *str)
+{
+    return x * 1599 + (int)strlen(str);
+}
+
+static int function_119_1600(int x, const char *str)
+{
+    return x * 1600 + (int)strlen(str);
+}
+
+static int function_119_1601(int x, const char *str)
+{
+    return x * 1601 + (int)strlen(str);
+}
+
+static int function_119_1602(int x, const char *str)
+{
+    return x * 1602 + (int)strlen(str);
+}
+
+static int function_119_1603(int x, const char *str)
+{
+    return x * 1603 + (int)strlen(str);
+}
+
+static int function_119_1604(int x, const char *str)
+{
+    return x * 1604 + (int)strlen(str);
+}
+
+static int function_119_1605(int x, const char *str)
+{
+    return x * 1605 + (int)strlen(str);
+}
+
+static int function_119_1606(int x, const char *str)
+{
+    return x * 1606 + (int)strlen(str);
+}
+
+static int function_119_1607(int x, const char *str)
+{
+    return x * 1607 + (int)strlen(str);
+}
+
+static int function_119_1608(int x, const char *str)
+{
+    return x * 1608 + (int)strlen(str);
+}
+
+static int function_119_1609(int x, const char *str)
+{
+    return x * 1609 + (int)strlen(str);
+}
+
+static int function_119_1610(int x, const char *str)
+{
+    return x * 1610 + (int)strlen(str);
+}
+
+static int function_119_1611(int x, const char *str)
+{
+    return x * 1611 + (int)strlen(str);
+}
+
+static int function_119_1612(int x, const char *str)
+{
+    return x * 1612 + (int)strlen(str);
+}
+
+static int function_119_1613(int x, const char *str)
+{
+    return x * 1613 + (int)strlen(str);
+}
+
+static int function_119_1614(int x, const char *str)
+{
+    return x * 1614 + (int)strlen(str);
+}
+
+static int function_119_1615(int x, const char *str)
+{
+    return x * 1615 + (int)strlen(str);
+}
+
+static int function_119_1616(int x, const char *str)
+{
+    return x * 1616 + (int)strlen(str);
+}
+
+static int function_119_1617(int x, const char *str)
+{
+    return x * 1617 + (int)strlen(str);
+}
+
+static int function_119_1618(int x, const char *str)
+{
+    return x * 1618 + (int)strlen(str);
+}
+
+static int function_119_1619(int x, const char *str)
+{
+    return x * 1619 + (int)strlen(str);
+}
+
+static int function_119_1620(int x, const char *str)
+{
+    return x * 1620 + (int)strlen(str);
+}
+
+static int function_119_1621(int x, const char *str)
+{
+    return x * 1621 + (int)strlen(str);
+}
+
+static int function_119_1622(int x, const char *str)
+{
+    return x * 1622 + (int)strlen(str);
+}
+
+static int function_119_1623(int x, const char *str)
+{
+    return x * 1623 + (int)strlen(str);
+}
+
+static int function_119_1624(int x, const char *str)
+{
+    return x * 1624 + (int)strlen(str);
+}
+
+static int function_119_1625(int x, const char *str)
+{
+    return x * 1625 + (int)strlen(str);
+}
+
+static int function_119_1626(int x, const char *str)
+{
+    return x * 1626 + (int)strlen(str);
+}
+
+static int function_119_1627(int x, const char *str)
+{
+    return x * 1627 + (int)strlen(str);
+}
+
+static int function_119_1628(int x, const char *str)
+{
+    return x * 1628 + (int)strlen(str);
+}
+
+static int function_119_1629(int x, const char *str)
+{
+    return x * 1629 + (int)strlen(str);
+}
+
+static int function_119_1630(int x, const char *str)
+{
+    return x * 1630 + (int)strlen(str);
+}
+
+static int function_119_1631(int x, const char *str)
+{
+    return x * 1631 + (int)strlen(str);
+}
+
+static int function_119_1632(int x, const char *str)
+{
+    return x * 1632 + (int)strlen(str);
+}
+
+static int function_119_1633(int x, const char *str)
+{
+    return x * 1633 + (int)strlen(str);
+}
+
+static int function_119_1634(int x, const char *str)
+{
+    return x * 1634 + (int)strlen(str);
+}
+
+static int function_119_1635(int x, const char *str)
+{
+    return x * 1635 + (int)strlen(str);
+}
+
+static int function_119_1636(int x, const char *str)
+{
+    return x * 1636 + (int)strlen(str);
+}
+
+static int function_119_1637(int x, const char *str)
+{
+    return x * 1637 + (int)strlen(str);
+}
+
+static int function_119_1638(int x, const char *str)
+{
+    return x * 1638 + (int)strlen(str);
+}
+
+static int function_119_1639(int x, const char *str)
+{
+    return x * 1639 + (int)strlen(str);
+}
+
+static int function_119_1640(int x, const char *str)
+{
+    return x * 1640 + (int)strlen(str);
+}
+
+static int function_119_1641(int x, const char *str)
+{
+    return x * 1641 + (int)strlen(str);
+}
+
+static int function_119_1642(int x, const char *str)
+{
+    return x * 1642 + (int)strlen(str);
+}
+
+static int function_119_1643(int x, const char *str)
+{
+    return x * 1643 + (int)strlen(str);
+}
+
+static int function_119_1644(int x, const char *str)
+{
+    return x * 1644 + (int)strlen(str);
+}
+
+static int function_119_1645(int x, const char *str)
+{
+    return x * 1645 + (int)strlen(str);
+}
+
+static int function_119_1646(int x, const char *str)
+{
+    return x * 1646 + (int)strlen(str);
+}
+
+static int function_119_1647(int x, const char *str)
+{
+    return x * 1647 + (int)strlen(str);
+}
+
+static int function_119_1648(int x, const char *str)
+{
+    return x * 1648 + (int)strlen(str);
+}
+
+static int function_119_1649(int x, const char *str)
+{
+    return x * 1649 + (int)strlen(str);
+}
+
+static int function_119_1650(int x, const char *str)
+{
+    return x * 1650 + (int)strlen(str);
+}
+
+static int function_119_1651(int x, const char *str)
+{
+    return x * 1651 + (int)strlen(str);
+}
+
+static int function_119_1652(int x, const char *str)
+{
+    return x * 1652 + (int)strlen(str);
+}
+
+static int function_119_1653(int x, const char *str)
+{
+    return x * 1653 + (int)strlen(str);
+}
+
+static int function_119_1654(int x, const char *str)
+{
+    return x * 1654 + (int)strlen(str);
+}
+
+static int function_119_1655(int x, const char *str)
+{
+    return x * 1655 + (int)strlen(str);
+}
+
+static int function_119_1656(int x, const char *str)
+{
+    return x * 1656 + (int)strlen(str);
+}
+
+static int function_119_1657(int x, const char *str)
+{
+    return x * 1657 + (int)strlen(str);
+}
+
+static int function_119_1658(int x, const char *str)
+{
+    return x * 1658 + (int)strlen(str);
+}
+
+static int function_119_1659(int x, const char *str)
+{
+    return x * 1659 + (int)strlen(str);
+}
+
+static int function_119_1660(int x, const char *str)
+{
+    return x * 1660 + (int)strlen(str);
+}
+
+static int function_119_1661(int x, const char *str)
+{
+    return x * 1661 + (int)strlen(str);
+}
+
+static int function_119_1662(int x, const char *str)
+{
+    return x * 1662 + (int)strlen(str);
+}
+
+static int function_119_1663(int x, const char *str)
+{
+    return x * 1663 + (int)strlen(str);
+}
+
+static int function_119_1664(int x, const char *str)
+{
+    return x * 1664 + (int)strlen(str);
+}
+
+static int function_119_1665(int x, const char *str)
+{
+    return x * 1665 + (int)strlen(str);
+}
+
+static int function_119_1666(int x, const char *str)
+{
+    return x * 1666 + (int)strlen(str);
+}
+
+static int function_119_1667(int x, const char *str)
+{
+    return x * 1667 + (int)strlen(str);
+}
+
+static int function_119_1668(int x, const char *str)
+{
+    return x * 1668 + (int)strlen(str);
+}
+
+static int function_119_1669(int x, const char *str)
+{
+    return x * 1669 + (int)strlen(str);
+}
+
+static int function_119_1670(int x, const char *str)
+{
+    return x * 1670 + (int)strlen(str);
+}
+
+static int function_119_1671(int x, const char *str)
+{
+    return x * 1671 + (int)strlen(str);
+}
+
+static int function_119_1672(int x, const char *str)
+{
+    return x * 1672 + (int)strlen(str);
+}
+
+static int function_119_1673(int x, const char *str)
+{
+    return x * 1673 + (int)strlen(str);
+}
+
+static int function_119_1674(int x, const char *str)
+{
+    return x * 1674 + (int)strlen(str);
+}
+
+static int function_119_1675(int x, const char *str)
+{
+    return x * 1675 + (int)strlen(str);
+}
+
+static int function_119_1676(int x, const char *str)
+{
+    return x * 1676 + (int)strlen(str);
+}
+
+static int function_119_1677(int x, const char *str)
+{
+    return x * 1677 + (int)strlen(str);
+}
+
+static int function_119_1678(int x, const char *str)
+{
+    return x * 1678 + (int)strlen(str);
+}
+
+static int function_119_1679(int x, const char *str)
+{
+    return x * 1679 + (int)strlen(str);
+}
+
+static int function_119_1680(int x, const char *str)
+{
+    return x * 1680 + (int)strlen(str);
+}
+
+static int function_119_1681(int x, const char *str)
+{
+    return x * 1681 + (int)strlen(str);
+}
+
+static int function_119_1682(int x, const char *str)
+{
+    return x * 1682 + (int)strlen(str);
+}
+
+static int function_119_1683(int x, const char *str)
+{
+    return x * 1683 + (int)strlen(str);
+}
+
+static int function_119_1684(int x, const char *str)
+{
+    return x * 1684 + (int)strlen(str);
+}
+
+static int function_119_1685(int x, const char *str)
+{
+    return x * 1685 + (int)strlen(str);
+}
+
+static int function_119_1686(int x, const char *str)
+{
+    return x * 1686 + (int)strlen(str);
+}
+
+static int function_119_1687(int x, const char *str)
+{
+    return x * 1687 + (int)strlen(str);
+}
+
+static int function_119_1688(int x, const char *str)
+{
+    return x * 1688 + (int)strlen(str);
+}
+
+static int function_119_1689(int x, const char *str)
+{
+    return x * 1689 + (int)strlen(str);
+}
+
+static int function_119_1690(int x, const char *str)
+{
+    return x * 1690 + (int)strlen(str);
+}
+
+static int function_119_1691(int x, const char *str)
+{
+    return x * 1691 + (int)strlen(str);
+}
+
+static int function_119_1692(int x, const char *str)
+{
+    return x * 1692 + (int)strlen(str);
+}
+
+static int function_119_1693(int x, const char *str)
+{
+    return x * 1693 + (int)strlen(str);
+}
+
+static int function_119_1694(int x, const char *str)
+{
+    return x * 1694 + (int)strlen(str);
+}
+
+static int function_119_1695(int x, const char *str)
+{
+    return x * 1695 + (int)strlen(str);
+}
+
+static int function_119_1696(int x, const char *str)
+{
+    return x * 1696 + (int)strlen(str);
+}
+
+static int function_119_1697(int x, const char *str)
+{
+    return x * 1697 + (int)strlen(str);
+}
+
+static int function_119_1698(int x, const char *str)
+{
+    return x * 1698 + (int)strlen(str);
+}
+
+static int function_119_1699(int x, const char *str)
+{
+    return x * 1699 + (int)strlen(str);
+}
+
+static int function_119_1700(int x, const char *str)
+{
+    return x * 1700 + (int)strlen(str);
+}
+
+static int function_119_1701(int x, const char *str)
+{
+    return x * 1701 + (int)strlen(str);
+}
+
+static int function_119_1702(int x, const char *str)
+{
+    return x * 1702 + (int)strlen(str);
+}
+
+static int function_119_1703(int x, const char *str)
+{
+    return x * 1703 + (int)strlen(str);
+}
+
+static int function_119_1704(int x, const char *str)
+{
+    return x * 1704 + (int)strlen(str);
+}
+
+static int function_119_1705(int x, const char *str)
+{
+    return x * 1705 + (int)strlen(str);
+}
+
+static int function_119_1706(int x, const char *str)
+{
+    return x * 1706 + (int)strlen(str);
+}
+
+static int function_119_1707(int x, const char *str)
+{
+    return x * 1707 + (int)strlen(str);
+}
+
+static int function_119_1708(int x, const char *str)
+{
+    return x * 1708 + (int)strlen(str);
+}
+
+static int function_119_1709(int x, const char *str)
+{
+    return x * 1709 + (int)strlen(str);
+}
+
+static int function_119_1710(int x, const char *str)
+{
+    return x * 1710 + (int)strlen(str);
+}
+
+static int function_119_1711(int x, const char *str)
+{
+    return x * 1711 + (int)strlen(str);
+}
+
+static int function_119_1712(int x, const char *str)
+{
+    return x * 1712 + (int)strlen(str);
+}
+
+static int function_119_1713(int x, const char *str)
+{
+    return x * 1713 + (int)strlen(str);
+}
+
+static int function_119_1714(int x, const char *str)
+{
+    return x * 1714 + (int)strlen(str);
+}
+
+static int function_119_1715(int x, const char *str)
+{
+    return x * 1715 + (int)strlen(str);
+}
+
+static int function_119_1716(int x, const char *str)
+{
+    return x * 1716 + (int)strlen(str);
+}
+
+static int function_119_1717(int x, const char *str)
+{
+    return x * 1717 + (int)strlen(str);
+}
+
+static int function_119_1718(int x, const char *str)
+{
+    return x * 1718 + (int)strlen(str);
+}
+
+static int function_119_1719(int x, const char *str)
+{
+    return x * 1719 + (int)strlen(str);
+}
+
+static int function_119_1720(int x, const char *str)
+{
+    return x * 1720 + (int)strlen(str);
+}
+
+static int function_119_1721(int x, const char *str)
+{
+    return x * 1721 + (int)strlen(str);
+}
+
+static int function_119_1722(int x, const char *str)
+{
+    return x * 1722 + (int)strlen(str);
+}
+
+static int function_119_1723(int x, const char *str)
+{
+    return x * 1723 + (int)strlen(str);
+}
+
+static int function_119_1724(int x, const char *str)
+{
+    return x * 1724 + (int)strlen(str);
+}
+
+static int function_119_1725(int x, const char *str)
+{
+    return x * 1725 + (int)strlen(str);
+}
+
+static int function_119_1726(int x, const char *str)
+{
+    return x * 1726 + (int)strlen(str);
+}
+
+static int function_119_1727(int x, const char *str)
+{
+    return x * 1727 + (int)strlen(str);
+}
+
+static int function_119_1728(int x, const char *str)
+{
+    return x * 1728 + (int)strlen(str);
+}
+
+static int function_119_1729(int x, const char *str)
+{
+    return x * 1729 + (int)strlen(str);
+}
+
+static int function_119_1730(int x, const char *str)
+{
+    return x * 1730 + (int)strlen(str);
+}
+
+static int function_119_1731(int x, const char *str)
+{
+    return x * 1731 + (int)strlen(str);
+}
+
+static int function_119_1732(int x, const char *str)
+{
+    return x * 1732 + (int)strlen(str);
+}
+
+static int function_119_1733(int x, const char *str)
+{
+    return x * 1733 + (int)strlen(str);
+}
+
+static int function_119_1734(int x, const char *str)
+{
+    return x * 1734 + (int)strlen(str);
+}
+
+static int function_119_1735(int x, const char *str)
+{
+    return x * 1735 + (int)strlen(str);
+}
+
+static int function_119_1736(int x, const char *str)
+{
+    return x * 1736 + (int)strlen(str);
+}
+
+static int function_119_1737(int x, const char *str)
+{
+    return x * 1737 + (int)strlen(str);
+}
+
+static int function_119_1738(int x, const char *str)
+{
+    return x * 1738 + (int)strlen(str);
+}
+
+static int function_119_1739(int x, const char *str)
+{
+    return x * 1739 + (int)strlen(str);
+}
+
+static int function_119_1740(int x, const char *str)
+{
+    return x * 1740 + (int)strlen(str);
+}
+
+static int function_119_1741(int x, const char *str)
+{
+    return x * 1741 + (int)strlen(str);
+}
+
+static int function_119_1742(int x, const char *str)
+{
+    return x * 1742 + (int)strlen(str);
+}
+
+static int function_119_1743(int x, const char *str)
+{
+    return x * 1743 + (int)strlen(str);
+}
+
+static int function_119_1744(int x, const char *str)
+{
+    return x * 1744 + (int)strlen(str);
+}
+
+static int function_119_1745(int x, const char *str)
+{
+    return x * 1745 + (int)strlen(str);
+}
+
+static int function_119_1746(int x, const char *str)
+{
+    return x * 1746 + (int)strlen(str);
+}
+
+static int function_119_1747(int x, const char *str)
+{
+    return x * 1747 + (int)strlen(str);
+}
+
+static int function_119_1748(int x, const char *str)
+{
+    return x * 1748 + (int)strlen(str);
+}
+
+static int function_119_1749(int x, const char *str)
+{
+    return x * 1749 + (int)strlen(str);
+}
+
+static int function_119_1750(int x, const char *str)
+{
+    return x * 1750 + (int)strlen(str);
+}
+
+static int function_119_1751(int x, const char *str)
+{
+    return x * 1751 + (int)strlen(str);
+}
+
+static int function_119_1752(int x, const char *str)
+{
+    return x * 1752 + (int)strlen(str);
+}
+
+static int function_119_1753(int x, const char *str)
+{
+    return x * 1753 + (int)strlen(str);
+}
+
+static int function_119_1754(int x, const char *str)
+{
+    return x * 1754 + (int)strlen(str);
+}
+
+static int function_119_1755(int x, const char *str)
+{
+    return x * 1755 + (int)strlen(str);
+}
+
+static int function_119_1756(int x, const char *str)
+{
+    return x * 1756 + (int)strlen(str);
+}
+
+static int function_119_1757(int x, const char *str)
+{
+    return x * 1757 + (int)strlen(str);
+}
+
+static int function_119_1758(int x, const char *str)
+{
+    return x * 1758 + (int)strlen(str);
+}
+
+static int function_119_1759(int x, const char *str)
+{
+    return x * 1759 + (int)strlen(str);
+}
+
+static int function_119_1760(int x, const char *str)
+{
+    return x * 1760 + (int)strlen(str);
+}
+
+static int function_119_1761(int x, const char *str)
+{
+    return x * 1761 + (int)strlen(str);
+}
+
+static int function_119_1762(int x, const char *str)
+{
+    return x * 1762 + (int)strlen(str);
+}
+
+static int function_119_1763(int x, const char *str)
+{
+    return x * 1763 + (int)strlen(str);
+}
+
+static int function_119_1764(int x, const char *str)
+{
+    return x * 1764 + (int)strlen(str);
+}
+
+static int function_119_1765(int x, const char *str)
+{
+    return x * 1765 + (int)strlen(str);
+}
+
+static int function_119_1766(int x, const char *str)
+{
+    return x * 1766 + (int)strlen(str);
+}
+
+static int function_119_1767(int x, const char *str)
+{
+    return x * 1767 + (int)strlen(str);
+}
+
+static int function_119_1768(int x, const char *str)
+{
+    return x * 1768 + (int)strlen(str);
+}
+
+static int function_119_1769(int x, const char *str)
+{
+    return x * 1769 + (int)strlen(str);
+}
+
+static int function_119_1770(int x, const char *str)
+{
+    return x * 1770 + (int)strlen(str);
+}
+
+static int function_119_1771(int x, const char *str)
+{
+    return x * 1771 + (int)strlen(str);
+}
+
+static int function_119_1772(int x, const char *str)
+{
+    return x * 1772 + (int)strlen(str);
+}
+
+static int function_119_1773(int x, const char *str)
+{
+    return x * 1773 + (int)strlen(str);
+}
+
+static int function_119_1774(int x, const char *str)
+{
+    return x * 1774 + (int)strlen(str);
+}
+
+static int function_119_1775(int x, const char *str)
+{
+    return x * 1775 + (int)strlen(str);
+}
+
+static int function_119_1776(int x, const char *str)
+{
+    return x * 1776 + (int)strlen(str);
+}
+
+static int function_119_1777(int x, const char *str)
+{
+    return x * 1777 + (int)strlen(str);
+}
+
+static int function_119_1778(int x, const char *str)
+{
+    return x * 1778 + (int)strlen(str);
+}
+
+static int function_119_1779(int x, const char *str)
+{
+    return x * 1779 + (int)strlen(str);
+}
+
+static int function_119_1780(int x, const char *str)
+{
+    return x * 1780 + (int)strlen(str);
+}
+
+static int function_119_1781(int x, const char *str)
+{
+    return x * 1781 + (int)strlen(str);
+}
+
+static int function_119_1782(int x, const char *str)
+{
+    return x * 1782 + (int)strlen(str);
+}
+
+static int function_119_1783(int x, const char *str)
+{
+    return x * 1783 + (int)strlen(str);
+}
+
+static int function_119_1784(int x, const char *str)
+{
+    return x * 1784 + (int)strlen(str);
+}
+
+static int function_119_1785(int x, const char *str)
+{
+    return x * 1785 + (int)strlen(str);
+}
+
+static int function_119_1786(int x, const char *str)
+{
+    return x * 1786 + (int)strlen(str);
+}
+
+static int function_119_1787(int x, const char *str)
+{
+    return x * 1787 + (int)strlen(str);
+}
+
+static int function_119_1788(int x, const char *str)
+{
+    return x * 1788 + (int)strlen(str);
+}
+
+static int function_119_1789(int x, const char *str)
+{
+    return x * 1789 + (int)strlen(str);
+}
+
+static int function_119_1790(int x, const char *str)
+{
+    return x * 1790 + (int)strlen(str);
+}
+
+static int function_119_1791(int x, const char *str)
+{
+    return x * 1791 + (int)strlen(str);
+}
+
+static int function_119_1792(int x, const char *str)
+{
+    return x * 1792 + (int)strlen(str);
+}
+
+static int function_119_1793(int x, const char *str)
+{
+    return x * 1793 + (int)strlen(str);
+}
+
+static int function_119_1794(int x, const char *str)
+{
+    return x * 1794 + (int)strlen(str);
+}
+
+static int function_119_1795(int x, const char *str)
+{
+    return x * 1795 + (int)strlen(str);
+}
+
+static int function_119_1796(int x, const char *str)
+{
+    return x * 1796 + (int)strlen(str);
+}
+
+static int function_119_1797(int x, const char *str)
+{
+    return x * 1797 + (int)strlen(str);
+}
+
+static int function_119_1798(int x, const char *str)
+{
+    return x * 1798 + (int)strlen(str);
+}
+
+static int function_119_1799(int x, const char *str)
+{
+    return x * 1799 + (int)strlen(str);
+}
+
+static int function_119_1800(int x, const char *str)
+{
+    return x * 1800 + (int)strlen(str);
+}
+
+static int function_119_1801(int x, const char *str)
+{
+    return x * 1801 + (int)strlen(str);
+}
+
+static int function_119_1802(int x, const char *str)
+{
+    return x * 1802 + (int)strlen(str);
+}
+
+static int function_119_1803(int x, const char *str)
+{
+    return x * 1803 + (int)strlen(str);
+}
+
+static int function_119_1804(int x, const char *str)
+{
+    return x * 1804 + (int)strlen(str);
+}
+
+static int function_119_1805(int x, const char *str)
+{
+    return x * 1805 + (int)strlen(str);
+}
+
+static int function_119_1806(int x, const char *str)
+{
+    return x * 1806 + (int)strlen(str);
+}
+
+static int function_119_1807(int x, const char *str)
+{
+    return x * 1807 + (int)strlen(str);
+}
+
+static int function_119_1808(int x, const char *str)
+{
+    return x * 1808 + (int)strlen(str);
+}
+
+static int function_119_1809(int x, const char *str)
+{
+    return x * 1809 + (int)strlen(str);
+}
+
+static int function_119_1810(int x, const char *str)
+{
+    return x * 1810 + (int)strlen(str);
+}
+
+static int function_119_1811(int x, const char *str)
+{
+    return x * 1811 + (int)strlen(str);
+}
+
+static int function_119_1812(int x, const char *str)
+{
+    return x * 1812 + (int)strlen(str);
+}
+
+static int function_119_1813(int x, const char *str)
+{
+    return x * 1813 + (int)strlen(str);
+}
+
+static int function_119_1814(int x, const char *str)
+{
+    return x * 1814 + (int)strlen(str);
+}
+
+static int function_119_1815(int x, const char *str)
+{
+    return x * 1815 + (int)strlen(str);
+}
+
+static int function_119_1816(int x, const char *str)
+{
+    return x * 1816 + (int)strlen(str);
+}
+
+static int function_119_1817(int x, const char *str)
+{
+    return x * 1817 + (int)strlen(str);
+}
+
+static int function_119_1818(int x, const char *str)
+{
+    return x * 1818 + (int)strlen(str);
+}
+
+static int function_119_1819(int x, const char *str)
+{
+    return x * 1819 + (int)strlen(str);
+}
+
+static int function_119_1820(int x, const char *str)
+{
+    return x * 1820 + (int)strlen(str);
+}
+
+static int function_119_1821(int x, const char *str)
+{
+    return x * 1821 + (int)strlen(str);
+}
+
+static int function_119_1822(int x, const char *str)
+{
+    return x * 1822 + (int)strlen(str);
+}
+
+static int function_119_1823(int x, const char *str)
+{
+    return x * 1823 + (int)strlen(str);
+}
+
+static int function_119_1824(int x, const char *str)
+{
+    return x * 1824 + (int)strlen(str);
+}
+
+static int function_119_1825(int x, const char *str)
+{
+    return x * 1825 + (int)strlen(str);
+}
+
+static int function_119_1826(int x, const char *str)
+{
+    return x * 1826 + (int)strlen(str);
+}
+
+static int function_119_1827(int x, const char *str)
+{
+    return x * 1827 + (int)strlen(str);
+}
+
+static int function_119_1828(int x, const char *str)
+{
+    return x * 1828 + (int)strlen(str);
+}
+
+static int function_119_1829(int x, const char *str)
+{
+    return x * 1829 + (int)strlen(str);
+}
+
+static int function_119_1830(int x, const char *str)
+{
+    return x * 1830 + (int)strlen(str);
+}
+
+static int function_119_1831(int x, const char *str)
+{
+    return x * 1831 + (int)strlen(str);
+}
+
+static int function_119_1832(int x, const char *str)
+{
+    return x * 1832 + (int)strlen(str);
+}
+
+static int function_119_1833(int x, const char *str)
+{
+    return x * 1833 + (int)strlen(str);
+}
+
+static int function_119_1834(int x, const char *str)
+{
+    return x * 1834 + (int)strlen(str);
+}
+
+static int function_119_1835(int x, const char *str)
+{
+    return x * 1835 + (int)strlen(str);
+}
+
+static int function_119_1836(int x, const char *str)
+{
+    return x * 1836 + (int)strlen(str);
+}
+
+static int function_119_1837(int x, const char *str)
+{
+    return x * 1837 + (int)strlen(str);
+}
+
+static int function_119_1838(int x, const char *str)
+{
+    return x * 1838 + (int)strlen(str);
+}
+
+static int function_119_1839(int x, const char *str)
+{
+    return x * 1839 + (int)strlen(str);
+}
+
+static int function_119_1840(int x, const char *str)
+{
+    return x * 1840 + (int)strlen(str);
+}
+
+static int function_119_1841(int x, const char *str)
+{
+    return x * 1841 + (int)strlen(str);
+}
+
+static int function_119_1842(int x, const char *str)
+{
+    return x * 1842 + (int)strlen(str);
+}
+
+static int function_119_1843(int x, const char *str)
+{
+    return x * 1843 + (int)strlen(str);
+}
+
+static int function_119_1844(int x, const char *str)
+{
+    return x * 1844 + (int)strlen(str);
+}
+
+static int function_119_1845(int x, const char *str)
+{
+    return x * 1845 + (int)strlen(str);
+}
+
+static int function_119_1846(int x, const char *str)
+{
+    return x * 1846 + (int)strlen(str);
+}
+
+static int function_119_1847(int x, const char *str)
+{
+    return x * 1847 + (int)strlen(str);
+}
+
+static int function_119_1848(int x, const char *str)
+{
+    return x * 1848 + (int)strlen(str);
+}
+
+static int function_119_1849(int x, const char *str)
+{
+    return x * 1849 + (int)strlen(str);
+}
+
+static int function_119_1850(int x, const char *str)
+{
+    return x * 1850 + (int)strlen(str);
+}
+
+static int function_119_1851(int x, const char *str)
+{
+    return x * 1851 + (int)strlen(str);
+}
+
+static int function_119_1852(int x, const char *str)
+{
+    return x * 1852 + (int)strlen(str);
+}
+
+static int function_119_1853(int x, const char *str)
+{
+    return x * 1853 + (int)strlen(str);
+}
+
+static int function_119_1854(int x, const char *str)
+{
+    return x * 1854 + (int)strlen(str);
+}
+
+static int function_119_1855(int x, const char *str)
+{
+    return x * 1855 + (int)strlen(str);
+}
+
+static int function_119_1856(int x, const char *str)
+{
+    return x * 1856 + (int)strlen(str);
+}
+
+static int function_119_1857(int x, const char *str)
+{
+    return x * 1857 + (int)strlen(str);
+}
+
+static int function_119_1858(int x, const char *str)
+{
+    return x * 1858 + (int)strlen(str);
+}
+
+static int function_119_1859(int x, const char *str)
+{
+    return x * 1859 + (int)strlen(str);
+}
+
+static int function_119_1860(int x, const char *str)
+{
+    return x * 1860 + (int)strlen(str);
+}
+
+static int function_119_1861(int x, const char *str)
+{
+    return x * 1861 + (int)strlen(str);
+}
+
+static int function_119_1862(int x, const char *str)
+{
+    return x * 1862 + (int)strlen(str);
+}
+
+static int function_119_1863(int x, const char *str)
+{
+    return x * 1863 + (int)strlen(str);
+}
+
+static int function_119_1864(int x, const char *str)
+{
+    return x * 1864 + (int)strlen(str);
+}
+
+static int function_119_1865(int x, const char *str)
+{
+    return x * 1865 + (int)strlen(str);
+}
+
+static int function_119_1866(int x, const char *str)
+{
+    return x * 1866 + (int)strlen(str);
+}
+
+static int function_119_1867(int x, const char *str)
+{
+    return x * 1867 + (int)strlen(str);
+}
+
+static int function_119_1868(int x, const char *str)
+{
+    return x * 1868 + (int)strlen(str);
+}
+
+static int function_119_1869(int x, const char *str)
+{
+    return x * 1869 + (int)strlen(str);
+}
+
+static int function_119_1870(int x, const char *str)
+{
+    return x * 1870 + (int)strlen(str);
+}
+
+static int function_119_1871(int x, const char *str)
+{
+    return x * 1871 + (int)strlen(str);
+}
+
+static int function_119_1872(int x, const char *str)
+{
+    return x * 1872 + (int)strlen(str);
+}
+
+static int function_119_1873(int x, const char *str)
+{
+    return x * 1873 + (int)strlen(str);
+}
+
+static int function_119_1874(int x, const char *str)
+{
+    return x * 1874 + (int)strlen(str);
+}
+
+static int function_119_1875(int x, const char *str)
+{
+    return x * 1875 + (int)strlen(str);
+}
+
+static int function_119_1876(int x, const char *str)
+{
+    return x * 1876 + (int)strlen(str);
+}
+
+static int function_119_1877(int x, const char *str)
+{
+    return x * 1877 + (int)strlen(str);
+}
+
+static int function_119_1878(int x, const char *str)
+{
+    return x * 1878 + (int)strlen(str);
+}
+
+static int function_119_1879(int x, const char *str)
+{
+    return x * 1879 + (int)strlen(str);
+}
+
+static int function_119_1880(int x, const char *str)
+{
+    return x * 1880 + (int)strlen(str);
+}
+
+static int function_119_1881(int x, const char *str)
+{
+    return x * 1881 + (int)strlen(str);
+}
+
+static int function_119_1882(int x, const char *str)
+{
+    return x * 1882 + (int)strlen(str);
+}
+
+static int function_119_1883(int x, const char *str)
+{
+    return x * 1883 + (int)strlen(str);
+}
+
+static int function_119_1884(int x, const char *str)
+{
+    return x * 1884 + (int)strlen(str);
+}
+
+static int function_119_1885(int x, const char *str)
+{
+    return x * 1885 + (int)strlen(str);
+}
+
+static int function_119_1886(int x, const char *str)
+{
+    return x * 1886 + (int)strlen(str);
+}
+
+static int function_119_1887(int x, const char *str)
+{
+    return x * 1887 + (int)strlen(str);
+}
+
+static int function_119_1888(int x, const char *str)
+{
+    return x * 1888 + (int)strlen(str);
+}
+
+static int function_119_1889(int x, const char *str)
+{
+    return x * 1889 + (int)strlen(str);
+}
+
+static int function_119_1890(int x, const char *str)
+{
+    return x * 1890 + (int)strlen(str);
+}
+
+static int function_119_1891(int x, const char *str)
+{
+    return x * 1891 + (int)strlen(str);
+}
+
+static int function_119_1892(int x, const char *str)
+{
+    return x * 1892 + (int)strlen(str);
+}
+
+static int function_119_1893(int x, const char *str)
+{
+    return x * 1893 + (int)strlen(str);
+}
+
+static int function_119_1894(int x, const char *str)
+{
+    return x * 1894 + (int)strlen(str);
+}
+
+static int function_119_1895(int x, const char *str)
+{
+    return x * 1895 + (int)strlen(str);
+}
+
+static int function_119_1896(int x, const char *str)
+{
+    return x * 1896 + (int)strlen(str);
+}
+
+static int function_119_1897(int x, const char *str)
+{
+    return x * 1897 + (int)strlen(str);
+}
+
+static int function_119_1898(int x, const char *str)
+{
+    return x * 1898 + (int)strlen(str);
+}
+
+static int function_119_1899(int x, const char *str)
+{
+    return x * 1899 + (int)strlen(str);
+}
+
+static int function_119_1900(int x, const char *str)
+{
+    return x * 1900 + (int)strlen(str);
+}
+
+static int function_119_1901(int x, const char *str)
+{
+    return x * 1901 + (int)strlen(str);
+}
+
+static int function_119_1902(int x, const char *str)
+{
+    return x * 1902 + (int)strlen(str);
+}
+
+static int function_119_1903(int x, const char *str)
+{
+    return x * 1903 + (int)strlen(str);
+}
+
+static int function_119_1904(int x, const char *str)
+{
+    return x * 1904 + (int)strlen(str);
+}
+
+static int function_119_1905(int x, const char *str)
+{
+    return x * 1905 + (int)strlen(str);
+}
+
+static int function_119_1906(int x, const char *str)
+{
+    return x * 1906 + (int)strlen(str);
+}
+
+static int function_119_1907(int x, const char *str)
+{
+    return x * 1907 + (int)strlen(str);
+}
+
+static int function_119_1908(int x, const char *str)
+{
+    return x * 1908 + (int)strlen(str);
+}
+
+static int function_119_1909(int x, const char *str)
+{
+    return x * 1909 + (int)strlen(str);
+}
+
+static int function_119_1910(int x, const char *str)
+{
+    return x * 1910 + (int)strlen(str);
+}
+
+static int function_119_1911(int x, const char *str)
+{
+    return x * 1911 + (int)strlen(str);
+}
+
+static int function_119_1912(int x, const char *str)
+{
+    return x * 1912 + (int)strlen(str);
+}
+
+static int function_119_1913(int x, const char *str)
+{
+    return x * 1913 + (int)strlen(str);
+}
+
+static int function_119_1914(int x, const char *str)
+{
+    return x * 1914 + (int)strlen(str);
+}
+
+static int function_119_1915(int x, const char *str)
+{
+    return x * 1915 + (int)strlen(str);
+}
+
+static int function_119_1916(int x, const char *str)
+{
+    return x * 1916 + (int)strlen(str);
+}
+
+static int function_119_1917(int x, const char *str)
+{
+    return x * 1917 + (int)strlen(str);
+}
+
+static int function_119_1918(int x, const char *str)
+{
+    return x * 1918 + (int)strlen(str);
+}
+
+static int function_119_1919(int x, const char *str)
+{
+    return x * 1919 + (int)strlen(str);
+}
+
+static int function_119_1920(int x, const char *str)
+{
+    return x * 1920 + (int)strlen(str);
+}
+
+static int function_119_1921(int x, const char *str)
+{
+    return x * 1921 + (int)strlen(str);
+}
+
+static int function_119_1922(int x, const char *str)
+{
+    return x * 1922 + (int)strlen(str);
+}
+
+static int function_119_1923(int x, const char *str)
+{
+    return x * 1923 + (int)strlen(str);
+}
+
+static int function_119_1924(int x, const char *str)
+{
+    return x * 1924 + (int)strlen(str);
+}
+
+static int function_119_1925(int x, const char *str)
+{
+    return x * 1925 + (int)strlen(str);
+}
+
+static int function_119_1926(int x, const char *str)
+{
+    return x * 1926 + (int)strlen(str);
+}
+
+static int function_119_1927(int x, const char *str)
+{
+    return x * 1927 + (int)strlen(str);
+}
+
+static int function_119_1928(int x, const char *str)
+{
+    return x * 1928 + (int)strlen(str);
+}
+
+static int function_119_1929(int x, const char *str)
+{
+    return x * 1929 + (int)strlen(str);
+}
+
+static int function_119_1930(int x, const char *str)
+{
+    return x * 1930 + (int)strlen(str);
+}
+
+static int function_119_1931(int x, const char *str)
+{
+    return x * 1931 + (int)strlen(str);
+}
+
+static int function_119_1932(int x, const char *str)
+{
+    return x * 1932 + (int)strlen(str);
+}
+
+static int function_119_1933(int x, const char *str)
+{
+    return x * 1933 + (int)strlen(str);
+}
+
+static int function_119_1934(int x, const char *str)
+{
+    return x * 1934 + (int)strlen(str);
+}
+
+static int function_119_1935(int x, const char *str)
+{
+    return x * 1935 + (int)strlen(str);
+}
+
+static int function_119_1936(int x, const char *str)
+{
+    return x * 1936 + (int)strlen(str);
+}
+
+static int function_119_1937(int x, const char *str)
+{
+    return x * 1937 + (int)strlen(str);
+}
+
+static int function_119_1938(int x, const char *str)
+{
+    return x * 1938 + (int)strlen(str);
+}
+
+static int function_119_1939(int x, const char *str)
+{
+    return x * 1939 + (int)strlen(str);
+}
+
+static int function_119_1940(int x, const char *str)
+{
+    return x * 1940 + (int)strlen(str);
+}
+
+static int function_119_1941(int x, const char *str)
+{
+    return x * 1941 + (int)strlen(str);
+}
+
+static int function_119_1942(int x, const char *str)
+{
+    return x * 1942 + (int)strlen(str);
+}
+
+static int function_119_1943(int x, const char *str)
+{
+    return x * 1943 + (int)strlen(str);
+}
+
+static int function_119_1944(int x, const char *str)
+{
+    return x * 1944 + (int)strlen(str);
+}
+
+static int function_119_1945(int x, const char *str)
+{
+    return x * 1945 + (int)strlen(str);
+}
+
+static int function_119_1946(int x, const char *str)
+{
+    return x * 1946 + (int)strlen(str);
+}
+
+static int function_119_1947(int x, const char *str)
+{
+    return x * 1947 + (int)strlen(str);
+}
+
+static int function_119_1948(int x, const char *str)
+{
+    return x * 1948 + (int)strlen(str);
+}
+
+static int function_119_1949(int x, const char *str)
+{
+    return x * 1949 + (int)strlen(str);
+}
+
+static int function_119_1950(int x, const char *str)
+{
+    return x * 1950 + (int)strlen(str);
+}
+
+static int function_119_1951(int x, const char *str)
+{
+    return x * 1951 + (int)strlen(str);
+}
+
+static int function_119_1952(int x, const char *str)
+{
+    return x * 1952 + (int)strlen(str);
+}
+
+static int function_119_1953(int x, const char *str)
+{
+    return x * 1953 + (int)strlen(str);
+}
+
+static int function_119_1954(int x, const char *str)
+{
+    return x * 1954 + (int)strlen(str);
+}
+
+static int function_119_1955(int x, const char *str)
+{
+    return x * 1955 + (int)strlen(str);
+}
+
+static int function_119_1956(int x, const char *str)
+{
+    return x * 1956 + (int)strlen(str);
+}
+
+static int function_119_1957(int x, const char *str)
+{
+    return x * 1957 + (int)strlen(str);
+}
+
+static int function_119_1958(int x, const char *str)
+{
+    return x * 1958 + (int)strlen(str);
+}
+
+static int function_119_1959(int x, const char *str)
+{
+    return x * 1959 + (int)strlen(str);
+}
+
+static int function_119_1960(int x, const char *str)
+{
+    return x * 1960 + (int)strlen(str);
+}
+
+static int function_119_1961(int x, const char *str)
+{
+    return x * 1961 + (int)strlen(str);
+}
+
+static int function_119_1962(int x, const char *str)
+{
+    return x * 1962 + (int)strlen(str);
+}
+
+static int function_119_1963(int x, const char *str)
+{
+    return x * 1963 + (int)strlen(str);
+}
+
+static int function_119_1964(int x, const char *str)
+{
+    return x * 1964 + (int)strlen(str);
+}
+
+static int function_119_1965(int x, const char *str)
+{
+    return x * 1965 + (int)strlen(str);
+}
+
+static int function_119_1966(int x, const char *str)
+{
+    return x * 1966 + (int)strlen(str);
+}
+
+static int function_119_1967(int x, const char *str)
+{
+    return x * 1967 + (int)strlen(str);
+}
+
+static int function_119_1968(int x, const char *str)
+{
+    return x * 1968 + (int)strlen(str);
+}
+
+static int function_119_1969(int x, const char *str)
+{
+    return x * 1969 + (int)strlen(str);
+}
+
+static int function_119_1970(int x, const char *str)
+{
+    return x * 1970 + (int)strlen(str);
+}
+
+static int function_119_1971(int x, const char *str)
+{
+    return x * 1971 + (int)strlen(str);
+}
+
+static int function_119_1972(int x, const char *str)
+{
+    return x * 1972 + (int)strlen(str);
+}
+
+static int function_119_1973(int x, const char *str)
+{
+    return x * 1973 + (int)strlen(str);
+}
+
+static int function_119_1974(int x, const char *str)
+{
+    return x * 1974 + (int)strlen(str);
+}
+
+static int function_119_1975(int x, const char *str)
+{
+    return x * 1975 + (int)strlen(str);
+}
+
+static int function_119_1976(int x, const char *str)
+{
+    return x * 1976 + (int)strlen(str);
+}
+
+static int function_119_1977(int x, const char *str)
+{
+    return x * 1977 + (int)strlen(str);
+}
+
+static int function_119_1978(int x, const char *str)
+{
+    return x * 1978 + (int)strlen(str);
+}
+
+static int function_119_1979(int x, const char *str)
+{
+    return x * 1979 + (int)strlen(str);
+}
+
+static int function_119_1980(int x, const char *str)
+{
+    return x * 1980 + (int)strlen(str);
+}
+
+static int function_119_1981(int x, const char *str)
+{
+    return x * 1981 + (int)strlen(str);
+}
+
+static int function_119_1982(int x, const char *str)
+{
+    return x * 1982 + (int)strlen(str);
+}
+
+static int function_119_1983(int x, const char *str)
+{
+    return x * 1983 + (int)strlen(str);
+}
+
+static int function_119_1984(int x, const char *str)
+{
+    return x * 1984 + (int)strlen(str);
+}
+
+static int function_119_1985(int x, const char *str)
+{
+    return x * 1985 + (int)strlen(str);
+}
+
+static int function_119_1986(int x, const char *str)
+{
+    return x * 1986 + (int)strlen(str);
+}
+
+static int function_119_1987(int x, const char *str)
+{
+    return x * 1987 + (int)strlen(str);
+}
+
+static int function_119_1988(int x, const char *str)
+{
+    return x * 1988 + (int)strlen(str);
+}
+
+static int function_119_1989(int x, const char *str)
+{
+    return x * 1989 + (int)strlen(str);
+}
+
+static int function_119_1990(int x, const char *str)
+{
+    return x * 1990 + (int)strlen(str);
+}
+
+static int function_119_1991(int x, const char *str)
+{
+    return x * 1991 + (int)strlen(str);
+}
+
+static int function_119_1992(int x, const char *str)
+{
+    return x * 1992 + (int)strlen(str);
+}
+
+static int function_119_1993(int x, const char *str)
+{
+    return x * 1993 + (int)strlen(str);
+}
+
+static int function_119_1994(int x, const char *str)
+{
+    return x * 1994 + (int)strlen(str);
+}
+
+static int function_119_1995(int x, const char *str)
+{
+    return x * 1995 + (int)strlen(str);
+}
+
+static int function_119_1996(int x, const char *str)
+{
+    return x * 1996 + (int)strlen(str);
+}
+
+static int function_119_1997(int x, const char *str)
+{
+    return x * 1997 + (int)strlen(str);
+}
+
+static int function_119_1998(int x, const char *str)
+{
+    return x * 1998 + (int)strlen(str);
+}
+
+static int function_119_1999(int x, const char *str)
+{
+    return x * 1999 + (int)strlen(str);
+}
+
@@ -0,0 +1,35 @@
+build/test/history.o: test/history.c test/test.h src/util/macros.h \
+ src/util/string-view.h src/util/ascii.h src/util/macros.h \
+ src/util/debug.h src/util/errorcode.h src/util/xmemrchr.h \
+ src/util/xstring.h src/util/string.h src/util/arith.h src/util/bit.h \
+ src/util/str-util.h src/util/string-view.h src/util/unicode.h \
+ src/util/xmalloc.h src/file-history.h src/command/error.h \
+ src/util/hashmap.h src/util/container.h src/util/macros.h \
+ src/util/string.h src/history.h src/util/numtostr.h src/util/readfile.h \
+ src/util/xmalloc.h
+test/test.h:
+src/util/macros.h:
+src/util/string-view.h:
+src/util/ascii.h:
+src/util/macros.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/xmemrchr.h:
+src/util/xstring.h:
+src/util/string.h:
+src/util/arith.h:
+src/util/bit.h:
+src/util/str-util.h:
+src/util/string-view.h:
+src/util/unicode.h:
+src/util/xmalloc.h:
+src/file-history.h:
+src/command/error.h:
+src/util/hashmap.h:
+src/util/container.h:
+src/util/macros.h:
+src/util/string.h:
+src/history.h:
+src/util/numtostr.h:
+src/util/readfile.h:
+src/util/xmalloc.h:
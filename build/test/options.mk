@@ -0,0 +1,33 @@
+build/test/options.o: test/options.c test/test.h src/util/macros.h \
+ src/util/string-view.h src/util/ascii.h src/util/macros.h \
+ src/util/debug.h src/util/errorcode.h src/util/xmemrchr.h \
+ src/util/xstring.h src/util/string.h src/util/arith.h src/util/bit.h \
+ src/util/str-util.h src/util/string-view.h src/util/unicode.h \
+ src/util/xmalloc.h src/options.h src/command/error.h src/regexp.h \
+ src/util/macros.h src/util/string-view.h src/util/string.h \
+ src/util/debug.h src/util/ptr-array.h src/util/container.h
+test/test.h:
+src/util/macros.h:
+src/util/string-view.h:
+src/util/ascii.h:
+src/util/macros.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/xmemrchr.h:
+src/util/xstring.h:
+src/util/string.h:
+src/util/arith.h:
+src/util/bit.h:
+src/util/str-util.h:
+src/util/string-view.h:
+src/util/unicode.h:
+src/util/xmalloc.h:
+src/options.h:
+src/command/error.h:
+src/regexp.h:
+src/util/macros.h:
+src/util/string-view.h:
+src/util/string.h:
+src/util/debug.h:
+src/util/ptr-array.h:
+src/util/container.h:
@@ -0,0 +1,100 @@
+x0 = f(y, "000"); /* c */ x0 = f(y, "001"); /* c */ x0 = f(y, "002"); /* c */ x0 = f(y, "003"); /* c */ x0 = f(y, "004"); /* c */ x0 = f(y, "005"); /* c */ x0 = f(y, "006"); /* c */ x0 = f(y, "007"); /* c */ x0 = f(y, "008"); /* c */ x0 = f(y, "009"); /* c */ x0 = f(y, "010"); /* c */ x0 = f(y, "011"); /* c */ x0 = f(y, "012"); /* c */ x0 = f(y, "013"); /* c */ x0 = f(y, "014"); /* c */ x0 = f(y, "015"); /* c */ x0 = f(y, "016"); /* c */ x0 = f(y, "017"); /* c */ x0 = f(y, "018"); /* c */ x0 = f(y, "019"); /* c */ x0 = f(y, "020"); /* c */ x0 = f(y, "021"); /* c */ x0 = f(y, "022"); /* c */ x0 = f(y, "023"); /* c */ x0 = f(y, "024"); /* c */ x0 = f(y, "025"); /* c */ x0 = f(y, "026"); /* c */ x0 = f(y, "027"); /* c */ x0 = f(y, "028"); /* c */ x0 = f(y, "029"); /* c */ x0 = f(y, "030"); /* c */ x0 = f(y, "031"); /* c */ x0 = f(y, "032"); /* c */ x0 = f(y, "033"); /* c */ x0 = f(y, "034"); /* c */ x0 = f(y, "035"); /* c */ x0 = f(y, "036"); /* c */ x0 = f(y, "037"); /* c */ x0 = f(y, "038"); /* c */ x0 = f(y, "039"); /* c */ x0 = f(y, "040"); /* c */ x0 = f(y, "041"); /* c */ x0 = f(y, "042"); /* c */ x0 = f(y, "043"); /* c */ x0 = f(y, "044"); /* c */ x0 = f(y, "045"); /* c */ x0 = f(y, "046"); /* c */ x0 = f(y, "047"); /* c */ x0 = f(y, "048"); /* c */ x0 = f(y, "049"); /* c */ x0 = f(y, "050"); /* c */ x0 = f(y, "051"); /* c */ x0 = f(y, "052"); /* c */ x0 = f(y, "053"); /* c */ x0 = f(y, "054"); /* c */ x0 = f(y, "055"); /* c */ x0 = f(y, "056"); /* c */ x0 = f(y, "057"); /* c */ x0 = f(y, "058"); /* c */ x0 = f(y, "059"); /* c */ x0 = f(y, "060"); /* c */ x0 = f(y, "061"); /* c */ x0 = f(y, "062"); /* c */ x0 = f(y, "063"); /* c */ x0 = f(y, "064"); /* c */ x0 = f(y, "065"); /* c */ x0 = f(y, "066"); /* c */ x0 = f(y, "067"); /* c */ x0 = f(y, "068"); /* c */ x0 = f(y, "069"); /* c */ x0 = f(y, "070"); /* c */ x0 = f(y, "071"); /* c */ x0 = f(y, "072"); /* c */ x0 = f(y, "073"); /* c */ x0 = f(y, "074"); /* c */ x0 = f(y, "075"); /* c */ x0 = f(y, "076"); /* c */ x0 = f(y, "077"); /* c */ x0 = f(y, "078"); /* c */ x0 = f(y, "079"); /* c */ x0 = f(y, "080"); /* c */ x0 = f(y, "081"); /* c */ x0 = f(y, "082"); /* c */ x0 = f(y, "083"); /* c */ x0 = f(y, "084"); /* c */ x0 = f(y, "085"); /* c */ x0 = f(y, "086"); /* c */ x0 = f(y, "087"); /* c */ x0 = f(y, "088"); /* c */ x0 = f(y, "089"); /* c */ x0 = f(y, "090"); /* c */ x0 = f(y, "091"); /* c */ x0 = f(y, "092"); /* c */ x0 = f(y, "093"); /* c */ x0 = f(y, "094"); /* c */ x0 = f(y, "095"); /* c */ x0 = f(y, "096"); /* c */ x0 = f(y, "097"); /* c */ x0 = f(y, "098"); /* c */ x0 = f(y, "099"); /* c */ x0 = f(y, "100"); /* c */ x0 = f(y, "101"); /* c */ x0 = f(y, "102"); /* c */ x0 = f(y, "103"); /* c */ x0 = f(y, "104"); /* c */ x0 = f(y, "105"); /* c */ x0 = f(y, "106"); /* c */ x0 = f(y, "107"); /* c */ x0 = f(y, "108"); /* c */ x0 = f(y, "109"); /* c */ x0 = f(y, "110"); /* c */ x0 = f(y, "111"); /* c */ x0 = f(y, "112"); /* c */ x0 = f(y, "113"); /* c */ x0 = f(y, "114"); /* c */ x0 = f(y, "115"); /* c */ x0 = f(y, "116"); /* c */ x0 = f(y, "117"); /* c */ x0 = f(y, "118"); /* c */ x0 = f(y, "119"); /* c */ x0 = f(y, "120"); /* c */ x0 = f(y, "121"); /* c */ x0 = f(y, "122"); /* c */ x0 = f(y, "123"); /* c */ x0 = f(y, "124"); /* c */ x0 = f(y, "125"); /* c */ x0 = f(y, "126"); /* c */ x0 = f(y, "127"); /* c */ x0 = f(y, "128"); /* c */ x0 = f(y, "129"); /* c */ x0 = f(y, "130"); /* c */ x0 = f(y, "131"); /* c */ x0 = f(y, "132"); /* c */ x0 = f(y, "133"); /* c */ x0 = f(y, "134"); /* c */ x0 = f(y, "135"); /* c */ x0 = f(y, "136"); /* c */ x0 = f(y, "137"); /* c */ x0 = f(y, "138"); /* c */ x0 = f(y, "139"); /* c */ x0 = f(y, "140"); /* c */ x0 = f(y, "141"); /* c */ x0 = f(y, "142"); /* c */ x0 = f(y, "143"); /* c */ x0 = f(y, "144"); /* c */ x0 = f(y, "145"); /* c */ x0 = f(y, "146"); /* c */ x0 = f(y, "147"); /* c */ x0 = f(y, "148"); /* c */ x0 = f(y, "149"); /* c */ x0 = f(y, "150"); /* c */ x0 = f(y, "151"); /* c */ x0 = f(y, "152"); /* c */ x0 = f(y, "153"); /* c */ x0 = f(y, "154"); /* c */ x0 = f(y, "155"); /* c */ x0 = f(y, "156"); /* c */ x0 = f(y, "157"); /* c */ x0 = f(y, "158"); /* c */ x0 = f(y, "159"); /* c */ x0 = f(y, "160"); /* c */ x0 = f(y, "161"); /* c */ x0 = f(y, "162"); /* c */ x0 = f(y, "163"); /* c */ x0 = f(y, "164"); /* c */ x0 = f(y, "165"); /* c */ x0 = f(y, "166"); /* c */ x0 = f(y, "167"); /* c */ x0 = f(y, "168"); /* c */ x0 = f(y, "169"); /* c */ x0 = f(y, "170"); /* c */ x0 = f(y, "171"); /* c */ x0 = f(y, "172"); /* c */ x0 = f(y, "173"); /* c */ x0 = f(y, "174"); /* c */ x0 = f(y, "175"); /* c */ x0 = f(y, "176"); /* c */ x0 = f(y, "177"); /* c */ x0 = f(y, "178"); /* c */ x0 = f(y, "179"); /* c */ x0 = f(y, "180"); /* c */ x0 = f(y, "181"); /* c */ x0 = f(y, "182"); /* c */ x0 = f(y, "183"); /* c */ x0 = f(y, "184"); /* c */ x0 = f(y, "185"); /* c */ x0 = f(y, "186"); /* c */ x0 = f(y, "187"); /* c */ x0 = f(y, "188"); /* c */ x0 = f(y, "189"); /* c */ x0 = f(y, "190"); /* c */ x0 = f(y, "191"); /* c */ x0 = f(y, "192"); /* c */ x0 = f(y, "193"); /* c */ x0 = f(y, "194"); /* c */ x0 = f(y, "195"); /* c */ x0 = f(y, "196"); /* c */ x0 = f(y, "197"); /* c */ x0 = f(y, "198"); /* c */ x0 = f(y, "199"); /* c */ 
+x1 = f(y, "000"); /* c */ x1 = f(y, "001"); /* c */ x1 = f(y, "002"); /* c */ x1 = f(y, "003"); /* c */ x1 = f(y, "004"); /* c */ x1 = f(y, "005"); /* c */ x1 = f(y, "006"); /* c */ x1 = f(y, "007"); /* c */ x1 = f(y, "008"); /* c */ x1 = f(y, "009"); /* c */ x1 = f(y, "010"); /* c */ x1 = f(y, "011"); /* c */ x1 = f(y, "012"); /* c */ x1 = f(y, "013"); /* c */ x1 = f(y, "014"); /* c */ x1 = f(y, "015"); /* c */ x1 = f(y, "016"); /* c */ x1 = f(y, "017"); /* c */ x1 = f(y, "018"); /* c */ x1 = f(y, "019"); /* c */ x1 = f(y, "020"); /* c */ x1 = f(y, "021"); /* c */ x1 = f(y, "022"); /* c */ x1 = f(y, "023"); /* c */ x1 = f(y, "024"); /* c */ x1 = f(y, "025"); /* c */ x1 = f(y, "026"); /* c */ x1 = f(y, "027"); /* c */ x1 = f(y, "028"); /* c */ x1 = f(y, "029"); /* c */ x1 = f(y, "030"); /* c */ x1 = f(y, "031"); /* c */ x1 = f(y, "032"); /* c */ x1 = f(y, "033"); /* c */ x1 = f(y, "034"); /* c */ x1 = f(y, "035"); /* c */ x1 = f(y, "036"); /* c */ x1 = f(y, "037"); /* c */ x1 = f(y, "038"); /* c */ x1 = f(y, "039"); /* c */ x1 = f(y, "040"); /* c */ x1 = f(y, "041"); /* c */ x1 = f(y, "042"); /* c */ x1 = f(y, "043"); /* c */ x1 = f(y, "044"); /* c */ x1 = f(y, "045"); /* c */ x1 = f(y, "046"); /* c */ x1 = f(y, "047"); /* c */ x1 = f(y, "048"); /* c */ x1 = f(y, "049"); /* c */ x1 = f(y, "050"); /* c */ x1 = f(y, "051"); /* c */ x1 = f(y, "052"); /* c */ x1 = f(y, "053"); /* c */ x1 = f(y, "054"); /* c */ x1 = f(y, "055"); /* c */ x1 = f(y, "056"); /* c */ x1 = f(y, "057"); /* c */ x1 = f(y, "058"); /* c */ x1 = f(y, "059"); /* c */ x1 = f(y, "060"); /* c */ x1 = f(y, "061"); /* c */ x1 = f(y, "062"); /* c */ x1 = f(y, "063"); /* c */ x1 = f(y, "064"); /* c */ x1 = f(y, "065"); /* c */ x1 = f(y, "066"); /* c */ x1 = f(y, "067"); /* c */ x1 = f(y, "068"); /* c */ x1 = f(y, "069"); /* c */ x1 = f(y, "070"); /* c */ x1 = f(y, "071"); /* c */ x1 = f(y, "072"); /* c */ x1 = f(y, "073"); /* c */ x1 = f(y, "074"); /* c */ x1 = f(y, "075"); /* c */ x1 = f(y, "076"); /* c */ x1 = f(y, "077"); /* c */ x1 = f(y, "078"); /* c */ x1 = f(y, "079"); /* c */ x1 = f(y, "080"); /* c */ x1 = f(y, "081"); /* c */ x1 = f(y, "082"); /* c */ x1 = f(y, "083"); /* c */ x1 = f(y, "084"); /* c */ x1 = f(y, "085"); /* c */ x1 = f(y, "086"); /* c */ x1 = f(y, "087"); /* c */ x1 = f(y, "088"); /* c */ x1 = f(y, "089"); /* c */ x1 = f(y, "090"); /* c */ x1 = f(y, "091"); /* c */ x1 = f(y, "092"); /* c */ x1 = f(y, "093"); /* c */ x1 = f(y, "094"); /* c */ x1 = f(y, "095"); /* c */ x1 = f(y, "096"); /* c */ x1 = f(y, "097"); /* c */ x1 = f(y, "098"); /* c */ x1 = f(y, "099"); /* c */ x1 = f(y, "100"); /* c */ x1 = f(y, "101"); /* c */ x1 = f(y, "102"); /* c */ x1 = f(y, "103"); /* c */ x1 = f(y, "104"); /* c */ x1 = f(y, "105"); /* c */ x1 = f(y, "106"); /* c */ x1 = f(y, "107"); /* c */ x1 = f(y, "108"); /* c */ x1 = f(y, "109"); /* c */ x1 = f(y, "110"); /* c */ x1 = f(y, "111"); /* c */ x1 = f(y, "112"); /* c */ x1 = f(y, "113"); /* c */ x1 = f(y, "114"); /* c */ x1 = f(y, "115"); /* c */ x1 = f(y, "116"); /* c */ x1 = f(y, "117"); /* c */ x1 = f(y, "118"); /* c */ x1 = f(y, "119"); /* c */ x1 = f(y, "120"); /* c */ x1 = f(y, "121"); /* c */ x1 = f(y, "122"); /* c */ x1 = f(y, "123"); /* c */ x1 = f(y, "124"); /* c */ x1 = f(y, "125"); /* c */ x1 = f(y, "126"); /* c */ x1 = f(y, "127"); /* c */ x1 = f(y, "128"); /* c */ x1 = f(y, "129"); /* c */ x1 = f(y, "130"); /* c */ x1 = f(y, "131"); /* c */ x1 = f(y, "132"); /* c */ x1 = f(y, "133"); /* c */ x1 = f(y, "134"); /* c */ x1 = f(y, "135"); /* c */ x1 = f(y, "136"); /* c */ x1 = f(y, "137"); /* c */ x1 = f(y, "138"); /* c */ x1 = f(y, "139"); /* c */ x1 = f(y, "140"); /* c */ x1 = f(y, "141"); /* c */ x1 = f(y, "142"); /* c */ x1 = f(y, "143"); /* c */ x1 = f(y, "144"); /* c */ x1 = f(y, "145"); /* c */ x1 = f(y, "146"); /* c */ x1 = f(y, "147"); /* c */ x1 = f(y, "148"); /* c */ x1 = f(y, "149"); /* c */ x1 = f(y, "150"); /* c */ x1 = f(y, "151"); /* c */ x1 = f(y, "152"); /* c */ x1 = f(y, "153"); /* c */ x1 = f(y, "154"); /* c */ x1 = f(y, "155"); /* c */ x1 = f(y, "156"); /* c */ x1 = f(y, "157"); /* c */ x1 = f(y, "158"); /* c */ x1 = f(y, "159"); /* c */ x1 = f(y, "160"); /* c */ x1 = f(y, "161"); /* c */ x1 = f(y, "162"); /* c */ x1 = f(y, "163"); /* c */ x1 = f(y, "164"); /* c */ x1 = f(y, "165"); /* c */ x1 = f(y, "166"); /* c */ x1 = f(y, "167"); /* c */ x1 = f(y, "168"); /* c */ x1 = f(y, "169"); /* c */ x1 = f(y, "170"); /* c */ x1 = f(y, "171"); /* c */ x1 = f(y, "172"); /* c */ x1 = f(y, "173"); /* c */ x1 = f(y, "174"); /* c */ x1 = f(y, "175"); /* c */ x1 = f(y, "176"); /* c */ x1 = f(y, "177"); /* c */ x1 = f(y, "178"); /* c */ x1 = f(y, "179"); /* c */ x1 = f(y, "180"); /* c */ x1 = f(y, "181"); /* c */ x1 = f(y, "182"); /* c */ x1 = f(y, "183"); /* c */ x1 = f(y, "184"); /* c */ x1 = f(y, "185"); /* c */ x1 = f(y, "186"); /* c */ x1 = f(y, "187"); /* c */ x1 = f(y, "188"); /* c */ x1 = f(y, "189"); /* c */ x1 = f(y, "190"); /* c */ x1 = f(y, "191"); /* c */ x1 = f(y, "192"); /* c */ x1 = f(y, "193"); /* c */ x1 = f(y, "194"); /* c */ x1 = f(y, "195"); /* c */ x1 = f(y, "196"); /* c */ x1 = f(y, "197"); /* c */ x1 = f(y, "198"); /* c */ x1 = f(y, "199"); /* c */ 
+x2 = f(y, "000"); /* c */ x2 = f(y, "001"); /* c */ x2 = f(y, "002"); /* c */ x2 = f(y, "003"); /* c */ x2 = f(y, "004"); /* c */ x2 = f(y, "005"); /* c */ x2 = f(y, "006"); /* c */ x2 = f(y, "007"); /* c */ x2 = f(y, "008"); /* c */ x2 = f(y, "009"); /* c */ x2 = f(y, "010"); /* c */ x2 = f(y, "011"); /* c */ x2 = f(y, "012"); /* c */ x2 = f(y, "013"); /* c */ x2 = f(y, "014"); /* c */ x2 = f(y, "015"); /* c */ x2 = f(y, "016"); /* c */ x2 = f(y, "017"); /* c */ x2 = f(y, "018"); /* c */ x2 = f(y, "019"); /* c */ x2 = f(y, "020"); /* c */ x2 = f(y, "021"); /* c */ x2 = f(y, "022"); /* c */ x2 = f(y, "023"); /* c */ x2 = f(y, "024"); /* c */ x2 = f(y, "025"); /* c */ x2 = f(y, "026"); /* c */ x2 = f(y, "027"); /* c */ x2 = f(y, "028"); /* c */ x2 = f(y, "029"); /* c */ x2 = f(y, "030"); /* c */ x2 = f(y, "031"); /* c */ x2 = f(y, "032"); /* c */ x2 = f(y, "033"); /* c */ x2 = f(y, "034"); /* c */ x2 = f(y, "035"); /* c */ x2 = f(y, "036"); /* c */ x2 = f(y, "037"); /* c */ x2 = f(y, "038"); /* c */ x2 = f(y, "039"); /* c */ x2 = f(y, "040"); /* c */ x2 = f(y, "041"); /* c */ x2 = f(y, "042"); /* c */ x2 = f(y, "043"); /* c */ x2 = f(y, "044"); /* c */ x2 = f(y, "045"); /* c */ x2 = f(y, "046"); /* c */ x2 = f(y, "047"); /* c */ x2 = f(y, "048"); /* c */ x2 = f(y, "049"); /* c */ x2 = f(y, "050"); /* c */ x2 = f(y, "051"); /* c */ x2 = f(y, "052"); /* c */ x2 = f(y, "053"); /* c */ x2 = f(y, "054"); /* c */ x2 = f(y, "055"); /* c */ x2 = f(y, "056"); /* c */ x2 = f(y, "057"); /* c */ x2 = f(y, "058"); /* c */ x2 = f(y, "059"); /* c */ x2 = f(y, "060"); /* c */ x2 = f(y, "061"); /* c */ x2 = f(y, "062"); /* c */ x2 = f(y, "063"); /* c */ x2 = f(y, "064"); /* c */ x2 = f(y, "065"); /* c */ x2 = f(y, "066"); /* c */ x2 = f(y, "067"); /* c */ x2 = f(y, "068"); /* c */ x2 = f(y, "069"); /* c */ x2 = f(y, "070"); /* c */ x2 = f(y, "071"); /* c */ x2 = f(y, "072"); /* c */ x2 = f(y, "073"); /* c */ x2 = f(y, "074"); /* c */ x2 = f(y, "075"); /* c */ x2 = f(y, "076"); /* c */ x2 = f(y, "077"); /* c */ x2 = f(y, "078"); /* c */ x2 = f(y, "079"); /* c */ x2 = f(y, "080"); /* c */ x2 = f(y, "081"); /* c */ x2 = f(y, "082"); /* c */ x2 = f(y, "083"); /* c */ x2 = f(y, "084"); /* c */ x2 = f(y, "085"); /* c */ x2 = f(y, "086"); /* c */ x2 = f(y, "087"); /* c */ x2 = f(y, "088"); /* c */ x2 = f(y, "089"); /* c */ x2 = f(y, "090"); /* c */ x2 = f(y, "091"); /* c */ x2 = f(y, "092"); /* c */ x2 = f(y, "093"); /* c */ x2 = f(y, "094"); /* c */ x2 = f(y, "095"); /* c */ x2 = f(y, "096"); /* c */ x2 = f(y, "097"); /* c */ x2 = f(y, "098"); /* c */ x2 = f(y, "099"); /* c */ x2 = f(y, "100"); /* c */ x2 = f(y, "101"); /* c */ x2 = f(y, "102"); /* c */ x2 = f(y, "103"); /* c */ x2 = f(y, "104"); /* c */ x2 = f(y, "105"); /* c */ x2 = f(y, "106"); /* c */ x2 = f(y, "107"); /* c */ x2 = f(y, "108"); /* c */ x2 = f(y, "109"); /* c */ x2 = f(y, "110"); /* c */ x2 = f(y, "111"); /* c */ x2 = f(y, "112"); /* c */ x2 = f(y, "113"); /* c */ x2 = f(y, "114"); /* c */ x2 = f(y, "115"); /* c */ x2 = f(y, "116"); /* c */ x2 = f(y, "117"); /* c */ x2 = f(y, "118"); /* c */ x2 = f(y, "119"); /* c */ x2 = f(y, "120"); /* c */ x2 = f(y, "121"); /* c */ x2 = f(y, "122"); /* c */ x2 = f(y, "123"); /* c */ x2 = f(y, "124"); /* c */ x2 = f(y, "125"); /* c */ x2 = f(y, "126"); /* c */ x2 = f(y, "127"); /* c */ x2 = f(y, "128"); /* c */ x2 = f(y, "129"); /* c */ x2 = f(y, "130"); /* c */ x2 = f(y, "131"); /* c */ x2 = f(y, "132"); /* c */ x2 = f(y, "133"); /* c */ x2 = f(y, "134"); /* c */ x2 = f(y, "135"); /* c */ x2 = f(y, "136"); /* c */ x2 = f(y, "137"); /* c */ x2 = f(y, "138"); /* c */ x2 = f(y, "139"); /* c */ x2 = f(y, "140"); /* c */ x2 = f(y, "141"); /* c */ x2 = f(y, "142"); /* c */ x2 = f(y, "143"); /* c */ x2 = f(y, "144"); /* c */ x2 = f(y, "145"); /* c */ x2 = f(y, "146"); /* c */ x2 = f(y, "147"); /* c */ x2 = f(y, "148"); /* c */ x2 = f(y, "149"); /* c */ x2 = f(y, "150"); /* c */ x2 = f(y, "151"); /* c */ x2 = f(y, "152"); /* c */ x2 = f(y, "153"); /* c */ x2 = f(y, "154"); /* c */ x2 = f(y, "155"); /* c */ x2 = f(y, "156"); /* c */ x2 = f(y, "157"); /* c */ x2 = f(y, "158"); /* c */ x2 = f(y, "159"); /* c */ x2 = f(y, "160"); /* c */ x2 = f(y, "161"); /* c */ x2 = f(y, "162"); /* c */ x2 = f(y, "163"); /* c */ x2 = f(y, "164"); /* c */ x2 = f(y, "165"); /* c */ x2 = f(y, "166"); /* c */ x2 = f(y, "167"); /* c */ x2 = f(y, "168"); /* c */ x2 = f(y, "169"); /* c */ x2 = f(y, "170"); /* c */ x2 = f(y, "171"); /* c */ x2 = f(y, "172"); /* c */ x2 = f(y, "173"); /* c */ x2 = f(y, "174"); /* c */ x2 = f(y, "175"); /* c */ x2 = f(y, "176"); /* c */ x2 = f(y, "177"); /* c */ x2 = f(y, "178"); /* c */ x2 = f(y, "179"); /* c */ x2 = f(y, "180"); /* c */ x2 = f(y, "181"); /* c */ x2 = f(y, "182"); /* c */ x2 = f(y, "183"); /* c */ x2 = f(y, "184"); /* c */ x2 = f(y, "185"); /* c */ x2 = f(y, "186"); /* c */ x2 = f(y, "187"); /* c */ x2 = f(y, "188"); /* c */ x2 = f(y, "189"); /* c */ x2 = f(y, "190"); /* c */ x2 = f(y, "191"); /* c */ x2 = f(y, "192"); /* c */ x2 = f(y, "193"); /* c */ x2 = f(y, "194"); /* c */ x2 = f(y, "195"); /* c */ x2 = f(y, "196"); /* c */ x2 = f(y, "197"); /* c */ x2 = f(y, "198"); /* c */ x2 = f(y, "199"); /* c */ 
+x3 = f(y, "000"); /* c */ x3 = f(y, "001"); /* c */ x3 = f(y, "002"); /* c */ x3 = f(y, "003"); /* c */ x3 = f(y, "004"); /* c */ x3 = f(y, "005"); /* c */ x3 = f(y, "006"); /* c */ x3 = f(y, "007"); /* c */ x3 = f(y, "008"); /* c */ x3 = f(y, "009"); /* c */ x3 = f(y, "010"); /* c */ x3 = f(y, "011"); /* c */ x3 = f(y, "012"); /* c */ x3 = f(y, "013"); /* c */ x3 = f(y, "014"); /* c */ x3 = f(y, "015"); /* c */ x3 = f(y, "016"); /* c */ x3 = f(y, "017"); /* c */ x3 = f(y, "018"); /* c */ x3 = f(y, "019"); /* c */ x3 = f(y, "020"); /* c */ x3 = f(y, "021"); /* c */ x3 = f(y, "022"); /* c */ x3 = f(y, "023"); /* c */ x3 = f(y, "024"); /* c */ x3 = f(y, "025"); /* c */ x3 = f(y, "026"); /* c */ x3 = f(y, "027"); /* c */ x3 = f(y, "028"); /* c */ x3 = f(y, "029"); /* c */ x3 = f(y, "030"); /* c */ x3 = f(y, "031"); /* c */ x3 = f(y, "032"); /* c */ x3 = f(y, "033"); /* c */ x3 = f(y, "034"); /* c */ x3 = f(y, "035"); /* c */ x3 = f(y, "036"); /* c */ x3 = f(y, "037"); /* c */ x3 = f(y, "038"); /* c */ x3 = f(y, "039"); /* c */ x3 = f(y, "040"); /* c */ x3 = f(y, "041"); /* c */ x3 = f(y, "042"); /* c */ x3 = f(y, "043"); /* c */ x3 = f(y, "044"); /* c */ x3 = f(y, "045"); /* c */ x3 = f(y, "046"); /* c */ x3 = f(y, "047"); /* c */ x3 = f(y, "048"); /* c */ x3 = f(y, "049"); /* c */ x3 = f(y, "050"); /* c */ x3 = f(y, "051"); /* c */ x3 = f(y, "052"); /* c */ x3 = f(y, "053"); /* c */ x3 = f(y, "054"); /* c */ x3 = f(y, "055"); /* c */ x3 = f(y, "056"); /* c */ x3 = f(y, "057"); /* c */ x3 = f(y, "058"); /* c */ x3 = f(y, "059"); /* c */ x3 = f(y, "060"); /* c */ x3 = f(y, "061"); /* c */ x3 = f(y, "062"); /* c */ x3 = f(y, "063"); /* c */ x3 = f(y, "064"); /* c */ x3 = f(y, "065"); /* c */ x3 = f(y, "066"); /* c */ x3 = f(y, "067"); /* c */ x3 = f(y, "068"); /* c */ x3 = f(y, "069"); /* c */ x3 = f(y, "070"); /* c */ x3 = f(y, "071"); /* c */ x3 = f(y, "072"); /* c */ x3 = f(y, "073"); /* c */ x3 = f(y, "074"); /* c */ x3 = f(y, "075"); /* c */ x3 = f(y, "076"); /* c */ x3 = f(y, "077"); /* c */ x3 = f(y, "078"); /* c */ x3 = f(y, "079"); /* c */ x3 = f(y, "080"); /* c */ x3 = f(y, "081"); /* c */ x3 = f(y, "082"); /* c */ x3 = f(y, "083"); /* c */ x3 = f(y, "084"); /* c */ x3 = f(y, "085"); /* c */ x3 = f(y, "086"); /* c */ x3 = f(y, "087"); /* c */ x3 = f(y, "088"); /* c */ x3 = f(y, "089"); /* c */ x3 = f(y, "090"); /* c */ x3 = f(y, "091"); /* c */ x3 = f(y, "092"); /* c */ x3 = f(y, "093"); /* c */ x3 = f(y, "094"); /* c */ x3 = f(y, "095"); /* c */ x3 = f(y, "096"); /* c */ x3 = f(y, "097"); /* c */ x3 = f(y, "098"); /* c */ x3 = f(y, "099"); /* c */ x3 = f(y, "100"); /* c */ x3 = f(y, "101"); /* c */ x3 = f(y, "102"); /* c */ x3 = f(y, "103"); /* c */ x3 = f(y, "104"); /* c */ x3 = f(y, "105"); /* c */ x3 = f(y, "106"); /* c */ x3 = f(y, "107"); /* c */ x3 = f(y, "108"); /* c */ x3 = f(y, "109"); /* c */ x3 = f(y, "110"); /* c */ x3 = f(y, "111"); /* c */ x3 = f(y, "112"); /* c */ x3 = f(y, "113"); /* c */ x3 = f(y, "114"); /* c */ x3 = f(y, "115"); /* c */ x3 = f(y, "116"); /* c */ x3 = f(y, "117"); /* c */ x3 = f(y, "118"); /* c */ x3 = f(y, "119"); /* c */ x3 = f(y, "120"); /* c */ x3 = f(y, "121"); /* c */ x3 = f(y, "122"); /* c */ x3 = f(y, "123"); /* c */ x3 = f(y, "124"); /* c */ x3 = f(y, "125"); /* c */ x3 = f(y, "126"); /* c */ x3 = f(y, "127"); /* c */ x3 = f(y, "128"); /* c */ x3 = f(y, "129"); /* c */ x3 = f(y, "130"); /* c */ x3 = f(y, "131"); /* c */ x3 = f(y, "132"); /* c */ x3 = f(y, "133"); /* c */ x3 = f(y, "134"); /* c */ x3 = f(y, "135"); /* c */ x3 = f(y, "136"); /* c */ x3 = f(y, "137"); /* c */ x3 = f(y, "138"); /* c */ x3 = f(y, "139"); /* c */ x3 = f(y, "140"); /* c */ x3 = f(y, "141"); /* c */ x3 = f(y, "142"); /* c */ x3 = f(y, "143"); /* c */ x3 = f(y, "144"); /* c */ x3 = f(y, "145"); /* c */ x3 = f(y, "146"); /* c */ x3 = f(y, "147"); /* c */ x3 = f(y, "148"); /* c */ x3 = f(y, "149"); /* c */ x3 = f(y, "150"); /* c */ x3 = f(y, "151"); /* c */ x3 = f(y, "152"); /* c */ x3 = f(y, "153"); /* c */ x3 = f(y, "154"); /* c */ x3 = f(y, "155"); /* c */ x3 = f(y, "156"); /* c */ x3 = f(y, "157"); /* c */ x3 = f(y, "158"); /* c */ x3 = f(y, "159"); /* c */ x3 = f(y, "160"); /* c */ x3 = f(y, "161"); /* c */ x3 = f(y, "162"); /* c */ x3 = f(y, "163"); /* c */ x3 = f(y, "164"); /* c */ x3 = f(y, "165"); /* c */ x3 = f(y, "166"); /* c */ x3 = f(y, "167"); /* c */ x3 = f(y, "168"); /* c */ x3 = f(y, "169"); /* c */ x3 = f(y, "170"); /* c */ x3 = f(y, "171"); /* c */ x3 = f(y, "172"); /* c */ x3 = f(y, "173"); /* c */ x3 = f(y, "174"); /* c */ x3 = f(y, "175"); /* c */ x3 = f(y, "176"); /* c */ x3 = f(y, "177"); /* c */ x3 = f(y, "178"); /* c */ x3 = f(y, "179"); /* c */ x3 = f(y, "180"); /* c */ x3 = f(y, "181"); /* c */ x3 = f(y, "182"); /* c */ x3 = f(y, "183"); /* c */ x3 = f(y, "184"); /* c */ x3 = f(y, "185"); /* c */ x3 = f(y, "186"); /* c */ x3 = f(y, "187"); /* c */ x3 = f(y, "188"); /* c */ x3 = f(y, "189"); /* c */ x3 = f(y, "190"); /* c */ x3 = f(y, "191"); /* c */ x3 = f(y, "192"); /* c */ x3 = f(y, "193"); /* c */ x3 = f(y, "194"); /* c */ x3 = f(y, "195"); /* c */ x3 = f(y, "196"); /* c */ x3 = f(y, "197"); /* c */ x3 = f(y, "198"); /* c */ x3 = f(y, "199"); /* c */ 
+x4 = f(y, "000"); /* c */ x4 = f(y, "001"); /* c */ x4 = f(y, "002"); /* c */ x4 = f(y, "003"); /* c */ x4 = f(y, "004"); /* c */ x4 = f(y, "005"); /* c */ x4 = f(y, "006"); /* c */ x4 = f(y, "007"); /* c */ x4 = f(y, "008"); /* c */ x4 = f(y, "009"); /* c */ x4 = f(y, "010"); /* c */ x4 = f(y, "011"); /* c */ x4 = f(y, "012"); /* c */ x4 = f(y, "013"); /* c */ x4 = f(y, "014"); /* c */ x4 = f(y, "015"); /* c */ x4 = f(y, "016"); /* c */ x4 = f(y, "017"); /* c */ x4 = f(y, "018"); /* c */ x4 = f(y, "019"); /* c */ x4 = f(y, "020"); /* c */ x4 = f(y, "021"); /* c */ x4 = f(y, "022"); /* c */ x4 = f(y, "023"); /* c */ x4 = f(y, "024"); /* c */ x4 = f(y, "025"); /* c */ x4 = f(y, "026"); /* c */ x4 = f(y, "027"); /* c */ x4 = f(y, "028"); /* c */ x4 = f(y, "029"); /* c */ x4 = f(y, "030"); /* c */ x4 = f(y, "031"); /* c */ x4 = f(y, "032"); /* c */ x4 = f(y, "033"); /* c */ x4 = f(y, "034"); /* c */ x4 = f(y, "035"); /* c */ x4 = f(y, "036"); /* c */ x4 = f(y, "037"); /* c */ x4 = f(y, "038"); /* c */ x4 = f(y, "039"); /* c */ x4 = f(y, "040"); /* c */ x4 = f(y, "041"); /* c */ x4 = f(y, "042"); /* c */ x4 = f(y, "043"); /* c */ x4 = f(y, "044"); /* c */ x4 = f(y, "045"); /* c */ x4 = f(y, "046"); /* c */ x4 = f(y, "047"); /* c */ x4 = f(y, "048"); /* c */ x4 = f(y, "049"); /* c */ x4 = f(y, "050"); /* c */ x4 = f(y, "051"); /* c */ x4 = f(y, "052"); /* c */ x4 = f(y, "053"); /* c */ x4 = f(y, "054"); /* c */ x4 = f(y, "055"); /* c */ x4 = f(y, "056"); /* c */ x4 = f(y, "057"); /* c */ x4 = f(y, "058"); /* c */ x4 = f(y, "059"); /* c */ x4 = f(y, "060"); /* c */ x4 = f(y, "061"); /* c */ x4 = f(y, "062"); /* c */ x4 = f(y, "063"); /* c */ x4 = f(y, "064"); /* c */ x4 = f(y, "065"); /* c */ x4 = f(y, "066"); /* c */ x4 = f(y, "067"); /* c */ x4 = f(y, "068"); /* c */ x4 = f(y, "069"); /* c */ x4 = f(y, "070"); /* c */ x4 = f(y, "071"); /* c */ x4 = f(y, "072"); /* c */ x4 = f(y, "073"); /* c */ x4 = f(y, "074"); /* c */ x4 = f(y, "075"); /* c */ x4 = f(y, "076"); /* c */ x4 = f(y, "077"); /* c */ x4 = f(y, "078"); /* c */ x4 = f(y, "079"); /* c */ x4 = f(y, "080"); /* c */ x4 = f(y, "081"); /* c */ x4 = f(y, "082"); /* c */ x4 = f(y, "083"); /* c */ x4 = f(y, "084"); /* c */ x4 = f(y, "085"); /* c */ x4 = f(y, "086"); /* c */ x4 = f(y, "087"); /* c */ x4 = f(y, "088"); /* c */ x4 = f(y, "089"); /* c */ x4 = f(y, "090"); /* c */ x4 = f(y, "091"); /* c */ x4 = f(y, "092"); /* c */ x4 = f(y, "093"); /* c */ x4 = f(y, "094"); /* c */ x4 = f(y, "095"); /* c */ x4 = f(y, "096"); /* c */ x4 = f(y, "097"); /* c */ x4 = f(y, "098"); /* c */ x4 = f(y, "099"); /* c */ x4 = f(y, "100"); /* c */ x4 = f(y, "101"); /* c */ x4 = f(y, "102"); /* c */ x4 = f(y, "103"); /* c */ x4 = f(y, "104"); /* c */ x4 = f(y, "105"); /* c */ x4 = f(y, "106"); /* c */ x4 = f(y, "107"); /* c */ x4 = f(y, "108"); /* c */ x4 = f(y, "109"); /* c */ x4 = f(y, "110"); /* c */ x4 = f(y, "111"); /* c */ x4 = f(y, "112"); /* c */ x4 = f(y, "113"); /* c */ x4 = f(y, "114"); /* c */ x4 = f(y, "115"); /* c */ x4 = f(y, "116"); /* c */ x4 = f(y, "117"); /* c */ x4 = f(y, "118"); /* c */ x4 = f(y, "119"); /* c */ x4 = f(y, "120"); /* c */ x4 = f(y, "121"); /* c */ x4 = f(y, "122"); /* c */ x4 = f(y, "123"); /* c */ x4 = f(y, "124"); /* c */ x4 = f(y, "125"); /* c */ x4 = f(y, "126"); /* c */ x4 = f(y, "127"); /* c */ x4 = f(y, "128"); /* c */ x4 = f(y, "129"); /* c */ x4 = f(y, "130"); /* c */ x4 = f(y, "131"); /* c */ x4 = f(y, "132"); /* c */ x4 = f(y, "133"); /* c */ x4 = f(y, "134"); /* c */ x4 = f(y, "135"); /* c */ x4 = f(y, "136"); /* c */ x4 = f(y, "137"); /* c */ x4 = f(y, "138"); /* c */ x4 = f(y, "139"); /* c */ x4 = f(y, "140"); /* c */ x4 = f(y, "141"); /* c */ x4 = f(y, "142"); /* c */ x4 = f(y, "143"); /* c */ x4 = f(y, "144"); /* c */ x4 = f(y, "145"); /* c */ x4 = f(y, "146"); /* c */ x4 = f(y, "147"); /* c */ x4 = f(y, "148"); /* c */ x4 = f(y, "149"); /* c */ x4 = f(y, "150"); /* c */ x4 = f(y, "151"); /* c */ x4 = f(y, "152"); /* c */ x4 = f(y, "153"); /* c */ x4 = f(y, "154"); /* c */ x4 = f(y, "155"); /* c */ x4 = f(y, "156"); /* c */ x4 = f(y, "157"); /* c */ x4 = f(y, "158"); /* c */ x4 = f(y, "159"); /* c */ x4 = f(y, "160"); /* c */ x4 = f(y, "161"); /* c */ x4 = f(y, "162"); /* c */ x4 = f(y, "163"); /* c */ x4 = f(y, "164"); /* c */ x4 = f(y, "165"); /* c */ x4 = f(y, "166"); /* c */ x4 = f(y, "167"); /* c */ x4 = f(y, "168"); /* c */ x4 = f(y, "169"); /* c */ x4 = f(y, "170"); /* c */ x4 = f(y, "171"); /* c */ x4 = f(y, "172"); /* c */ x4 = f(y, "173"); /* c */ x4 = f(y, "174"); /* c */ x4 = f(y, "175"); /* c */ x4 = f(y, "176"); /* c */ x4 = f(y, "177"); /* c */ x4 = f(y, "178"); /* c */ x4 = f(y, "179"); /* c */ x4 = f(y, "180"); /* c */ x4 = f(y, "181"); /* c */ x4 = f(y, "182"); /* c */ x4 = f(y, "183"); /* c */ x4 = f(y, "184"); /* c */ x4 = f(y, "185"); /* c */ x4 = f(y, "186"); /* c */ x4 = f(y, "187"); /* c */ x4 = f(y, "188"); /* c */ x4 = f(y, "189"); /* c */ x4 = f(y, "190"); /* c */ x4 = f(y, "191"); /* c */ x4 = f(y, "192"); /* c */ x4 = f(y, "193"); /* c */ x4 = f(y, "194"); /* c */ x4 = f(y, "195"); /* c */ x4 = f(y, "196"); /* c */ x4 = f(y, "197"); /* c */ x4 = f(y, "198"); /* c */ x4 = f(y, "199"); /* c */ 
+x5 = f(y, "000"); /* c */ x5 = f(y, "001"); /* c */ x5 = f(y, "002"); /* c */ x5 = f(y, "003"); /* c */ x5 = f(y, "004"); /* c */ x5 = f(y, "005"); /* c */ x5 = f(y, "006"); /* c */ x5 = f(y, "007"); /* c */ x5 = f(y, "008"); /* c */ x5 = f(y, "009"); /* c */ x5 = f(y, "010"); /* c */ x5 = f(y, "011"); /* c */ x5 = f(y, "012"); /* c */ x5 = f(y, "013"); /* c */ x5 = f(y, "014"); /* c */ x5 = f(y, "015"); /* c */ x5 = f(y, "016"); /* c */ x5 = f(y, "017"); /* c */ x5 = f(y, "018"); /* c */ x5 = f(y, "019"); /* c */ x5 = f(y, "020"); /* c */ x5 = f(y, "021"); /* c */ x5 = f(y, "022"); /* c */ x5 = f(y, "023"); /* c */ x5 = f(y, "024"); /* c */ x5 = f(y, "025"); /* c */ x5 = f(y, "026"); /* c */ x5 = f(y, "027"); /* c */ x5 = f(y, "028"); /* c */ x5 = f(y, "029"); /* c */ x5 = f(y, "030"); /* c */ x5 = f(y, "031"); /* c */ x5 = f(y, "032"); /* c */ x5 = f(y, "033"); /* c */ x5 = f(y, "034"); /* c */ x5 = f(y, "035"); /* c */ x5 = f(y, "036"); /* c */ x5 = f(y, "037"); /* c */ x5 = f(y, "038"); /* c */ x5 = f(y, "039"); /* c */ x5 = f(y, "040"); /* c */ x5 = f(y, "041"); /* c */ x5 = f(y, "042"); /* c */ x5 = f(y, "043"); /* c */ x5 = f(y, "044"); /* c */ x5 = f(y, "045"); /* c */ x5 = f(y, "046"); /* c */ x5 = f(y, "047"); /* c */ x5 = f(y, "048"); /* c */ x5 = f(y, "049"); /* c */ x5 = f(y, "050"); /* c */ x5 = f(y, "051"); /* c */ x5 = f(y, "052"); /* c */ x5 = f(y, "053"); /* c */ x5 = f(y, "054"); /* c */ x5 = f(y, "055"); /* c */ x5 = f(y, "056"); /* c */ x5 = f(y, "057"); /* c */ x5 = f(y, "058"); /* c */ x5 = f(y, "059"); /* c */ x5 = f(y, "060"); /* c */ x5 = f(y, "061"); /* c */ x5 = f(y, "062"); /* c */ x5 = f(y, "063"); /* c */ x5 = f(y, "064"); /* c */ x5 = f(y, "065"); /* c */ x5 = f(y, "066"); /* c */ x5 = f(y, "067"); /* c */ x5 = f(y, "068"); /* c */ x5 = f(y, "069"); /* c */ x5 = f(y, "070"); /* c */ x5 = f(y, "071"); /* c */ x5 = f(y, "072"); /* c */ x5 = f(y, "073"); /* c */ x5 = f(y, "074"); /* c */ x5 = f(y, "075"); /* c */ x5 = f(y, "076"); /* c */ x5 = f(y, "077"); /* c */ x5 = f(y, "078"); /* c */ x5 = f(y, "079"); /* c */ x5 = f(y, "080"); /* c */ x5 = f(y, "081"); /* c */ x5 = f(y, "082"); /* c */ x5 = f(y, "083"); /* c */ x5 = f(y, "084"); /* c */ x5 = f(y, "085"); /* c */ x5 = f(y, "086"); /* c */ x5 = f(y, "087"); /* c */ x5 = f(y, "088"); /* c */ x5 = f(y, "089"); /* c */ x5 = f(y, "090"); /* c */ x5 = f(y, "091"); /* c */ x5 = f(y, "092"); /* c */ x5 = f(y, "093"); /* c */ x5 = f(y, "094"); /* c */ x5 = f(y, "095"); /* c */ x5 = f(y, "096"); /* c */ x5 = f(y, "097"); /* c */ x5 = f(y, "098"); /* c */ x5 = f(y, "099"); /* c */ x5 = f(y, "100"); /* c */ x5 = f(y, "101"); /* c */ x5 = f(y, "102"); /* c */ x5 = f(y, "103"); /* c */ x5 = f(y, "104"); /* c */ x5 = f(y, "105"); /* c */ x5 = f(y, "106"); /* c */ x5 = f(y, "107"); /* c */ x5 = f(y, "108"); /* c */ x5 = f(y, "109"); /* c */ x5 = f(y, "110"); /* c */ x5 = f(y, "111"); /* c */ x5 = f(y, "112"); /* c */ x5 = f(y, "113"); /* c */ x5 = f(y, "114"); /* c */ x5 = f(y, "115"); /* c */ x5 = f(y, "116"); /* c */ x5 = f(y, "117"); /* c */ x5 = f(y, "118"); /* c */ x5 = f(y, "119"); /* c */ x5 = f(y, "120"); /* c */ x5 = f(y, "121"); /* c */ x5 = f(y, "122"); /* c */ x5 = f(y, "123"); /* c */ x5 = f(y, "124"); /* c */ x5 = f(y, "125"); /* c */ x5 = f(y, "126"); /* c */ x5 = f(y, "127"); /* c */ x5 = f(y, "128"); /* c */ x5 = f(y, "129"); /* c */ x5 = f(y, "130"); /* c */ x5 = f(y, "131"); /* c */ x5 = f(y, "132"); /* c */ x5 = f(y, "133"); /* c */ x5 = f(y, "134"); /* c */ x5 = f(y, "135"); /* c */ x5 = f(y, "136"); /* c */ x5 = f(y, "137"); /* c */ x5 = f(y, "138"); /* c */ x5 = f(y, "139"); /* c */ x5 = f(y, "140"); /* c */ x5 = f(y, "141"); /* c */ x5 = f(y, "142"); /* c */ x5 = f(y, "143"); /* c */ x5 = f(y, "144"); /* c */ x5 = f(y, "145"); /* c */ x5 = f(y, "146"); /* c */ x5 = f(y, "147"); /* c */ x5 = f(y, "148"); /* c */ x5 = f(y, "149"); /* c */ x5 = f(y, "150"); /* c */ x5 = f(y, "151"); /* c */ x5 = f(y, "152"); /* c */ x5 = f(y, "153"); /* c */ x5 = f(y, "154"); /* c */ x5 = f(y, "155"); /* c */ x5 = f(y, "156"); /* c */ x5 = f(y, "157"); /* c */ x5 = f(y, "158"); /* c */ x5 = f(y, "159"); /* c */ x5 = f(y, "160"); /* c */ x5 = f(y, "161"); /* c */ x5 = f(y, "162"); /* c */ x5 = f(y, "163"); /* c */ x5 = f(y, "164"); /* c */ x5 = f(y, "165"); /* c */ x5 = f(y, "166"); /* c */ x5 = f(y, "167"); /* c */ x5 = f(y, "168"); /* c */ x5 = f(y, "169"); /* c */ x5 = f(y, "170"); /* c */ x5 = f(y, "171"); /* c */ x5 = f(y, "172"); /* c */ x5 = f(y, "173"); /* c */ x5 = f(y, "174"); /* c */ x5 = f(y, "175"); /* c */ x5 = f(y, "176"); /* c */ x5 = f(y, "177"); /* c */ x5 = f(y, "178"); /* c */ x5 = f(y, "179"); /* c */ x5 = f(y, "180"); /* c */ x5 = f(y, "181"); /* c */ x5 = f(y, "182"); /* c */ x5 = f(y, "183"); /* c */ x5 = f(y, "184"); /* c */ x5 = f(y, "185"); /* c */ x5 = f(y, "186"); /* c */ x5 = f(y, "187"); /* c */ x5 = f(y, "188"); /* c */ x5 = f(y, "189"); /* c */ x5 = f(y, "190"); /* c */ x5 = f(y, "191"); /* c */ x5 = f(y, "192"); /* c */ x5 = f(y, "193"); /* c */ x5 = f(y, "194"); /* c */ x5 = f(y, "195"); /* c */ x5 = f(y, "196"); /* c */ x5 = f(y, "197"); /* c */ x5 = f(y, "198"); /* c */ x5 = f(y, "199"); /* c */ 
+x6 = f(y, "000"); /* c */ x6 = f(y, "001"); /* c */ x6 = f(y, "002"); /* c */ x6 = f(y, "003"); /* c */ x6 = f(y, "004"); /* c */ x6 = f(y, "005"); /* c */ x6 = f(y, "006"); /* c */ x6 = f(y, "007"); /* c */ x6 = f(y, "008"); /* c */ x6 = f(y, "009"); /* c */ x6 = f(y, "010"); /* c */ x6 = f(y, "011"); /* c */ x6 = f(y, "012"); /* c */ x6 = f(y, "013"); /* c */ x6 = f(y, "014"); /* c */ x6 = f(y, "015"); /* c */ x6 = f(y, "016"); /* c */ x6 = f(y, "017"); /* c */ x6 = f(y, "018"); /* c */ x6 = f(y, "019"); /* c */ x6 = f(y, "020"); /* c */ x6 = f(y, "021"); /* c */ x6 = f(y, "022"); /* c */ x6 = f(y, "023"); /* c */ x6 = f(y, "024"); /* c */ x6 = f(y, "025"); /* c */ x6 = f(y, "026"); /* c */ x6 = f(y, "027"); /* c */ x6 = f(y, "028"); /* c */ x6 = f(y, "029"); /* c */ x6 = f(y, "030"); /* c */ x6 = f(y, "031"); /* c */ x6 = f(y, "032"); /* c */ x6 = f(y, "033"); /* c */ x6 = f(y, "034"); /* c */ x6 = f(y, "035"); /* c */ x6 = f(y, "036"); /* c */ x6 = f(y, "037"); /* c */ x6 = f(y, "038"); /* c */ x6 = f(y, "039"); /* c */ x6 = f(y, "040"); /* c */ x6 = f(y, "041"); /* c */ x6 = f(y, "042"); /* c */ x6 = f(y, "043"); /* c */ x6 = f(y, "044"); /* c */ x6 = f(y, "045"); /* c */ x6 = f(y, "046"); /* c */ x6 = f(y, "047"); /* c */ x6 = f(y, "048"); /* c */ x6 = f(y, "049"); /* c */ x6 = f(y, "050"); /* c */ x6 = f(y, "051"); /* c */ x6 = f(y, "052"); /* c */ x6 = f(y, "053"); /* c */ x6 = f(y, "054"); /* c */ x6 = f(y, "055"); /* c */ x6 = f(y, "056"); /* c */ x6 = f(y, "057"); /* c */ x6 = f(y, "058"); /* c */ x6 = f(y, "059"); /* c */ x6 = f(y, "060"); /* c */ x6 = f(y, "061"); /* c */ x6 = f(y, "062"); /* c */ x6 = f(y, "063"); /* c */ x6 = f(y, "064"); /* c */ x6 = f(y, "065"); /* c */ x6 = f(y, "066"); /* c */ x6 = f(y, "067"); /* c */ x6 = f(y, "068"); /* c */ x6 = f(y, "069"); /* c */ x6 = f(y, "070"); /* c */ x6 = f(y, "071"); /* c */ x6 = f(y, "072"); /* c */ x6 = f(y, "073"); /* c */ x6 = f(y, "074"); /* c */ x6 = f(y, "075"); /* c */ x6 = f(y, "076"); /* c */ x6 = f(y, "077"); /* c */ x6 = f(y, "078"); /* c */ x6 = f(y, "079"); /* c */ x6 = f(y, "080"); /* c */ x6 = f(y, "081"); /* c */ x6 = f(y, "082"); /* c */ x6 = f(y, "083"); /* c */ x6 = f(y, "084"); /* c */ x6 = f(y, "085"); /* c */ x6 = f(y, "086"); /* c */ x6 = f(y, "087"); /* c */ x6 = f(y, "088"); /* c */ x6 = f(y, "089"); /* c */ x6 = f(y, "090"); /* c */ x6 = f(y, "091"); /* c */ x6 = f(y, "092"); /* c */ x6 = f(y, "093"); /* c */ x6 = f(y, "094"); /* c */ x6 = f(y, "095"); /* c */ x6 = f(y, "096"); /* c */ x6 = f(y, "097"); /* c */ x6 = f(y, "098"); /* c */ x6 = f(y, "099"); /* c */ x6 = f(y, "100"); /* c */ x6 = f(y, "101"); /* c */ x6 = f(y, "102"); /* c */ x6 = f(y, "103"); /* c */ x6 = f(y, "104"); /* c */ x6 = f(y, "105"); /* c */ x6 = f(y, "106"); /* c */ x6 = f(y, "107"); /* c */ x6 = f(y, "108"); /* c */ x6 = f(y, "109"); /* c */ x6 = f(y, "110"); /* c */ x6 = f(y, "111"); /* c */ x6 = f(y, "112"); /* c */ x6 = f(y, "113"); /* c */ x6 = f(y, "114"); /* c */ x6 = f(y, "115"); /* c */ x6 = f(y, "116"); /* c */ x6 = f(y, "117"); /* c */ x6 = f(y, "118"); /* c */ x6 = f(y, "119"); /* c */ x6 = f(y, "120"); /* c */ x6 = f(y, "121"); /* c */ x6 = f(y, "122"); /* c */ x6 = f(y, "123"); /* c */ x6 = f(y, "124"); /* c */ x6 = f(y, "125"); /* c */ x6 = f(y, "126"); /* c */ x6 = f(y, "127"); /* c */ x6 = f(y, "128"); /* c */ x6 = f(y, "129"); /* c */ x6 = f(y, "130"); /* c */ x6 = f(y, "131"); /* c */ x6 = f(y, "132"); /* c */ x6 = f(y, "133"); /* c */ x6 = f(y, "134"); /* c */ x6 = f(y, "135"); /* c */ x6 = f(y, "136"); /* c */ x6 = f(y, "137"); /* c */ x6 = f(y, "138"); /* c */ x6 = f(y, "139"); /* c */ x6 = f(y, "140"); /* c */ x6 = f(y, "141"); /* c */ x6 = f(y, "142"); /* c */ x6 = f(y, "143"); /* c */ x6 = f(y, "144"); /* c */ x6 = f(y, "145"); /* c */ x6 = f(y, "146"); /* c */ x6 = f(y, "147"); /* c */ x6 = f(y, "148"); /* c */ x6 = f(y, "149"); /* c */ x6 = f(y, "150"); /* c */ x6 = f(y, "151"); /* c */ x6 = f(y, "152"); /* c */ x6 = f(y, "153"); /* c */ x6 = f(y, "154"); /* c */ x6 = f(y, "155"); /* c */ x6 = f(y, "156"); /* c */ x6 = f(y, "157"); /* c */ x6 = f(y, "158"); /* c */ x6 = f(y, "159"); /* c */ x6 = f(y, "160"); /* c */ x6 = f(y, "161"); /* c */ x6 = f(y, "162"); /* c */ x6 = f(y, "163"); /* c */ x6 = f(y, "164"); /* c */ x6 = f(y, "165"); /* c */ x6 = f(y, "166"); /* c */ x6 = f(y, "167"); /* c */ x6 = f(y, "168"); /* c */ x6 = f(y, "169"); /* c */ x6 = f(y, "170"); /* c */ x6 = f(y, "171"); /* c */ x6 = f(y, "172"); /* c */ x6 = f(y, "173"); /* c */ x6 = f(y, "174"); /* c */ x6 = f(y, "175"); /* c */ x6 = f(y, "176"); /* c */ x6 = f(y, "177"); /* c */ x6 = f(y, "178"); /* c */ x6 = f(y, "179"); /* c */ x6 = f(y, "180"); /* c */ x6 = f(y, "181"); /* c */ x6 = f(y, "182"); /* c */ x6 = f(y, "183"); /* c */ x6 = f(y, "184"); /* c */ x6 = f(y, "185"); /* c */ x6 = f(y, "186"); /* c */ x6 = f(y, "187"); /* c */ x6 = f(y, "188"); /* c */ x6 = f(y, "189"); /* c */ x6 = f(y, "190"); /* c */ x6 = f(y, "191"); /* c */ x6 = f(y, "192"); /* c */ x6 = f(y, "193"); /* c */ x6 = f(y, "194"); /* c */ x6 = f(y, "195"); /* c */ x6 = f(y, "196"); /* c */ x6 = f(y, "197"); /* c */ x6 = f(y, "198"); /* c */ x6 = f(y, "199"); /* c */ 
+x7 = f(y, "000"); /* c */ x7 = f(y, "001"); /* c */ x7 = f(y, "002"); /* c */ x7 = f(y, "003"); /* c */ x7 = f(y, "004"); /* c */ x7 = f(y, "005"); /* c */ x7 = f(y, "006"); /* c */ x7 = f(y, "007"); /* c */ x7 = f(y, "008"); /* c */ x7 = f(y, "009"); /* c */ x7 = f(y, "010"); /* c */ x7 = f(y, "011"); /* c */ x7 = f(y, "012"); /* c */ x7 = f(y, "013"); /* c */ x7 = f(y, "014"); /* c */ x7 = f(y, "015"); /* c */ x7 = f(y, "016"); /* c */ x7 = f(y, "017"); /* c */ x7 = f(y, "018"); /* c */ x7 = f(y, "019"); /* c */ x7 = f(y, "020"); /* c */ x7 = f(y, "021"); /* c */ x7 = f(y, "022"); /* c */ x7 = f(y, "023"); /* c */ x7 = f(y, "024"); /* c */ x7 = f(y, "025"); /* c */ x7 = f(y, "026"); /* c */ x7 = f(y, "027"); /* c */ x7 = f(y, "028"); /* c */ x7 = f(y, "029"); /* c */ x7 = f(y, "030"); /* c */ x7 = f(y, "031"); /* c */ x7 = f(y, "032"); /* c */ x7 = f(y, "033"); /* c */ x7 = f(y, "034"); /* c */ x7 = f(y, "035"); /* c */ x7 = f(y, "036"); /* c */ x7 = f(y, "037"); /* c */ x7 = f(y, "038"); /* c */ x7 = f(y, "039"); /* c */ x7 = f(y, "040"); /* c */ x7 = f(y, "041"); /* c */ x7 = f(y, "042"); /* c */ x7 = f(y, "043"); /* c */ x7 = f(y, "044"); /* c */ x7 = f(y, "045"); /* c */ x7 = f(y, "046"); /* c */ x7 = f(y, "047"); /* c */ x7 = f(y, "048"); /* c */ x7 = f(y, "049"); /* c */ x7 = f(y, "050"); /* c */ x7 = f(y, "051"); /* c */ x7 = f(y, "052"); /* c */ x7 = f(y, "053"); /* c */ x7 = f(y, "054"); /* c */ x7 = f(y, "055"); /* c */ x7 = f(y, "056"); /* c */ x7 = f(y, "057"); /* c */ x7 = f(y, "058"); /* c */ x7 = f(y, "059"); /* c */ x7 = f(y, "060"); /* c */ x7 = f(y, "061"); /* c */ x7 = f(y, "062"); /* c */ x7 = f(y, "063"); /* c */ x7 = f(y, "064"); /* c */ x7 = f(y, "065"); /* c */ x7 = f(y, "066"); /* c */ x7 = f(y, "067"); /* c */ x7 = f(y, "068"); /* c */ x7 = f(y, "069"); /* c */ x7 = f(y, "070"); /* c */ x7 = f(y, "071"); /* c */ x7 = f(y, "072"); /* c */ x7 = f(y, "073"); /* c */ x7 = f(y, "074"); /* c */ x7 = f(y, "075"); /* c */ x7 = f(y, "076"); /* c */ x7 = f(y, "077"); /* c */ x7 = f(y, "078"); /* c */ x7 = f(y, "079"); /* c */ x7 = f(y, "080"); /* c */ x7 = f(y, "081"); /* c */ x7 = f(y, "082"); /* c */ x7 = f(y, "083"); /* c */ x7 = f(y, "084"); /* c */ x7 = f(y, "085"); /* c */ x7 = f(y, "086"); /* c */ x7 = f(y, "087"); /* c */ x7 = f(y, "088"); /* c */ x7 = f(y, "089"); /* c */ x7 = f(y, "090"); /* c */ x7 = f(y, "091"); /* c */ x7 = f(y, "092"); /* c */ x7 = f(y, "093"); /* c */ x7 = f(y, "094"); /* c */ x7 = f(y, "095"); /* c */ x7 = f(y, "096"); /* c */ x7 = f(y, "097"); /* c */ x7 = f(y, "098"); /* c */ x7 = f(y, "099"); /* c */ x7 = f(y, "100"); /* c */ x7 = f(y, "101"); /* c */ x7 = f(y, "102"); /* c */ x7 = f(y, "103"); /* c */ x7 = f(y, "104"); /* c */ x7 = f(y, "105"); /* c */ x7 = f(y, "106"); /* c */ x7 = f(y, "107"); /* c */ x7 = f(y, "108"); /* c */ x7 = f(y, "109"); /* c */ x7 = f(y, "110"); /* c */ x7 = f(y, "111"); /* c */ x7 = f(y, "112"); /* c */ x7 = f(y, "113"); /* c */ x7 = f(y, "114"); /* c */ x7 = f(y, "115"); /* c */ x7 = f(y, "116"); /* c */ x7 = f(y, "117"); /* c */ x7 = f(y, "118"); /* c */ x7 = f(y, "119"); /* c */ x7 = f(y, "120"); /* c */ x7 = f(y, "121"); /* c */ x7 = f(y, "122"); /* c */ x7 = f(y, "123"); /* c */ x7 = f(y, "124"); /* c */ x7 = f(y, "125"); /* c */ x7 = f(y, "126"); /* c */ x7 = f(y, "127"); /* c */ x7 = f(y, "128"); /* c */ x7 = f(y, "129"); /* c */ x7 = f(y, "130"); /* c */ x7 = f(y, "131"); /* c */ x7 = f(y, "132"); /* c */ x7 = f(y, "133"); /* c */ x7 = f(y, "134"); /* c */ x7 = f(y, "135"); /* c */ x7 = f(y, "136"); /* c */ x7 = f(y, "137"); /* c */ x7 = f(y, "138"); /* c */ x7 = f(y, "139"); /* c */ x7 = f(y, "140"); /* c */ x7 = f(y, "141"); /* c */ x7 = f(y, "142"); /* c */ x7 = f(y, "143"); /* c */ x7 = f(y, "144"); /* c */ x7 = f(y, "145"); /* c */ x7 = f(y, "146"); /* c */ x7 = f(y, "147"); /* c */ x7 = f(y, "148"); /* c */ x7 = f(y, "149"); /* c */ x7 = f(y, "150"); /* c */ x7 = f(y, "151"); /* c */ x7 = f(y, "152"); /* c */ x7 = f(y, "153"); /* c */ x7 = f(y, "154"); /* c */ x7 = f(y, "155"); /* c */ x7 = f(y, "156"); /* c */ x7 = f(y, "157"); /* c */ x7 = f(y, "158"); /* c */ x7 = f(y, "159"); /* c */ x7 = f(y, "160"); /* c */ x7 = f(y, "161"); /* c */ x7 = f(y, "162"); /* c */ x7 = f(y, "163"); /* c */ x7 = f(y, "164"); /* c */ x7 = f(y, "165"); /* c */ x7 = f(y, "166"); /* c */ x7 = f(y, "167"); /* c */ x7 = f(y, "168"); /* c */ x7 = f(y, "169"); /* c */ x7 = f(y, "170"); /* c */ x7 = f(y, "171"); /* c */ x7 = f(y, "172"); /* c */ x7 = f(y, "173"); /* c */ x7 = f(y, "174"); /* c */ x7 = f(y, "175"); /* c */ x7 = f(y, "176"); /* c */ x7 = f(y, "177"); /* c */ x7 = f(y, "178"); /* c */ x7 = f(y, "179"); /* c */ x7 = f(y, "180"); /* c */ x7 = f(y, "181"); /* c */ x7 = f(y, "182"); /* c */ x7 = f(y, "183"); /* c */ x7 = f(y, "184"); /* c */ x7 = f(y, "185"); /* c */ x7 = f(y, "186"); /* c */ x7 = f(y, "187"); /* c */ x7 = f(y, "188"); /* c */ x7 = f(y, "189"); /* c */ x7 = f(y, "190"); /* c */ x7 = f(y, "191"); /* c */ x7 = f(y, "192"); /* c */ x7 = f(y, "193"); /* c */ x7 = f(y, "194"); /* c */ x7 = f(y, "195"); /* c */ x7 = f(y, "196"); /* c */ x7 = f(y, "197"); /* c */ x7 = f(y, "198"); /* c */ x7 = f(y, "199"); /* c */ 
+x8 = f(y, "000"); /* c */ x8 = f(y, "001"); /* c */ x8 = f(y, "002"); /* c */ x8 = f(y, "003"); /* c */ x8 = f(y, "004"); /* c */ x8 = f(y, "005"); /* c */ x8 = f(y, "006"); /* c */ x8 = f(y, "007"); /* c */ x8 = f(y, "008"); /* c */ x8 = f(y, "009"); /* c */ x8 = f(y, "010"); /* c */ x8 = f(y, "011"); /* c */ x8 = f(y, "012"); /* c */ x8 = f(y, "013"); /* c */ x8 = f(y, "014"); /* c */ x8 = f(y, "015"); /* c */ x8 = f(y, "016"); /* c */ x8 = f(y, "017"); /* c */ x8 = f(y, "018"); /* c */ x8 = f(y, "019"); /* c */ x8 = f(y, "020"); /* c */ x8 = f(y, "021"); /* c */ x8 = f(y, "022"); /* c */ x8 = f(y, "023"); /* c */ x8 = f(y, "024"); /* c */ x8 = f(y, "025"); /* c */ x8 = f(y, "026"); /* c */ x8 = f(y, "027"); /* c */ x8 = f(y, "028"); /* c */ x8 = f(y, "029"); /* c */ x8 = f(y, "030"); /* c */ x8 = f(y, "031"); /* c */ x8 = f(y, "032"); /* c */ x8 = f(y, "033"); /* c */ x8 = f(y, "034"); /* c */ x8 = f(y, "035"); /* c */ x8 = f(y, "036"); /* c */ x8 = f(y, "037"); /* c */ x8 = f(y, "038"); /* c */ x8 = f(y, "039"); /* c */ x8 = f(y, "040"); /* c */ x8 = f(y, "041"); /* c */ x8 = f(y, "042"); /* c */ x8 = f(y, "043"); /* c */ x8 = f(y, "044"); /* c */ x8 = f(y, "045"); /* c */ x8 = f(y, "046"); /* c */ x8 = f(y, "047"); /* c */ x8 = f(y, "048"); /* c */ x8 = f(y, "049"); /* c */ x8 = f(y, "050"); /* c */ x8 = f(y, "051"); /* c */ x8 = f(y, "052"); /* c */ x8 = f(y, "053"); /* c */ x8 = f(y, "054"); /* c */ x8 = f(y, "055"); /* c */ x8 = f(y, "056"); /* c */ x8 = f(y, "057"); /* c */ x8 = f(y, "058"); /* c */ x8 = f(y, "059"); /* c */ x8 = f(y, "060"); /* c */ x8 = f(y, "061"); /* c */ x8 = f(y, "062"); /* c */ x8 = f(y, "063"); /* c */ x8 = f(y, "064"); /* c */ x8 = f(y, "065"); /* c */ x8 = f(y, "066"); /* c */ x8 = f(y, "067"); /* c */ x8 = f(y, "068"); /* c */ x8 = f(y, "069"); /* c */ x8 = f(y, "070"); /* c */ x8 = f(y, "071"); /* c */ x8 = f(y, "072"); /* c */ x8 = f(y, "073"); /* c */ x8 = f(y, "074"); /* c */ x8 = f(y, "075"); /* c */ x8 = f(y, "076"); /* c */ x8 = f(y, "077"); /* c */ x8 = f(y, "078"); /* c */ x8 = f(y, "079"); /* c */ x8 = f(y, "080"); /* c */ x8 = f(y, "081"); /* c */ x8 = f(y, "082"); /* c */ x8 = f(y, "083"); /* c */ x8 = f(y, "084"); /* c */ x8 = f(y, "085"); /* c */ x8 = f(y, "086"); /* c */ x8 = f(y, "087"); /* c */ x8 = f(y, "088"); /* c */ x8 = f(y, "089"); /* c */ x8 = f(y, "090"); /* c */ x8 = f(y, "091"); /* c */ x8 = f(y, "092"); /* c */ x8 = f(y, "093"); /* c */ x8 = f(y, "094"); /* c */ x8 = f(y, "095"); /* c */ x8 = f(y, "096"); /* c */ x8 = f(y, "097"); /* c */ x8 = f(y, "098"); /* c */ x8 = f(y, "099"); /* c */ x8 = f(y, "100"); /* c */ x8 = f(y, "101"); /* c */ x8 = f(y, "102"); /* c */ x8 = f(y, "103"); /* c */ x8 = f(y, "104"); /* c */ x8 = f(y, "105"); /* c */ x8 = f(y, "106"); /* c */ x8 = f(y, "107"); /* c */ x8 = f(y, "108"); /* c */ x8 = f(y, "109"); /* c */ x8 = f(y, "110"); /* c */ x8 = f(y, "111"); /* c */ x8 = f(y, "112"); /* c */ x8 = f(y, "113"); /* c */ x8 = f(y, "114"); /* c */ x8 = f(y, "115"); /* c */ x8 = f(y, "116"); /* c */ x8 = f(y, "117"); /* c */ x8 = f(y, "118"); /* c */ x8 = f(y, "119"); /* c */ x8 = f(y, "120"); /* c */ x8 = f(y, "121"); /* c */ x8 = f(y, "122"); /* c */ x8 = f(y, "123"); /* c */ x8 = f(y, "124"); /* c */ x8 = f(y, "125"); /* c */ x8 = f(y, "126"); /* c */ x8 = f(y, "127"); /* c */ x8 = f(y, "128"); /* c */ x8 = f(y, "129"); /* c */ x8 = f(y, "130"); /* c */ x8 = f(y, "131"); /* c */ x8 = f(y, "132"); /* c */ x8 = f(y, "133"); /* c */ x8 = f(y, "134"); /* c */ x8 = f(y, "135"); /* c */ x8 = f(y, "136"); /* c */ x8 = f(y, "137"); /* c */ x8 = f(y, "138"); /* c */ x8 = f(y, "139"); /* c */ x8 = f(y, "140"); /* c */ x8 = f(y, "141"); /* c */ x8 = f(y, "142"); /* c */ x8 = f(y, "143"); /* c */ x8 = f(y, "144"); /* c */ x8 = f(y, "145"); /* c */ x8 = f(y, "146"); /* c */ x8 = f(y, "147"); /* c */ x8 = f(y, "148"); /* c */ x8 = f(y, "149"); /* c */ x8 = f(y, "150"); /* c */ x8 = f(y, "151"); /* c */ x8 = f(y, "152"); /* c */ x8 = f(y, "153"); /* c */ x8 = f(y, "154"); /* c */ x8 = f(y, "155"); /* c */ x8 = f(y, "156"); /* c */ x8 = f(y, "157"); /* c */ x8 = f(y, "158"); /* c */ x8 = f(y, "159"); /* c */ x8 = f(y, "160"); /* c */ x8 = f(y, "161"); /* c */ x8 = f(y, "162"); /* c */ x8 = f(y, "163"); /* c */ x8 = f(y, "164"); /* c */ x8 = f(y, "165"); /* c */ x8 = f(y, "166"); /* c */ x8 = f(y, "167"); /* c */ x8 = f(y, "168"); /* c */ x8 = f(y, "169"); /* c */ x8 = f(y, "170"); /* c */ x8 = f(y, "171"); /* c */ x8 = f(y, "172"); /* c */ x8 = f(y, "173"); /* c */ x8 = f(y, "174"); /* c */ x8 = f(y, "175"); /* c */ x8 = f(y, "176"); /* c */ x8 = f(y, "177"); /* c */ x8 = f(y, "178"); /* c */ x8 = f(y, "179"); /* c */ x8 = f(y, "180"); /* c */ x8 = f(y, "181"); /* c */ x8 = f(y, "182"); /* c */ x8 = f(y, "183"); /* c */ x8 = f(y, "184"); /* c */ x8 = f(y, "185"); /* c */ x8 = f(y, "186"); /* c */ x8 = f(y, "187"); /* c */ x8 = f(y, "188"); /* c */ x8 = f(y, "189"); /* c */ x8 = f(y, "190"); /* c */ x8 = f(y, "191"); /* c */ x8 = f(y, "192"); /* c */ x8 = f(y, "193"); /* c */ x8 = f(y, "194"); /* c */ x8 = f(y, "195"); /* c */ x8 = f(y, "196"); /* c */ x8 = f(y, "197"); /* c */ x8 = f(y, "198"); /* c */ x8 = f(y, "199"); /* c */ 
+x9 = f(y, "000"); /* c */ x9 = f(y, "001"); /* c */ x9 = f(y, "002"); /* c */ x9 = f(y, "003"); /* c */ x9 = f(y, "004"); /* c */ x9 = f(y, "005"); /* c */ x9 = f(y, "006"); /* c */ x9 = f(y, "007"); /* c */ x9 = f(y, "008"); /* c */ x9 = f(y, "009"); /* c */ x9 = f(y, "010"); /* c */ x9 = f(y, "011"); /* c */ x9 = f(y, "012"); /* c */ x9 = f(y, "013"); /* c */ x9 = f(y, "014"); /* c */ x9 = f(y, "015"); /* c */ x9 = f(y, "016"); /* c */ x9 = f(y, "017"); /* c */ x9 = f(y, "018"); /* c */ x9 = f(y, "019"); /* c */ x9 = f(y, "020"); /* c */ x9 = f(y, "021"); /* c */ x9 = f(y, "022"); /* c */ x9 = f(y, "023"); /* c */ x9 = f(y, "024"); /* c */ x9 = f(y, "025"); /* c */ x9 = f(y, "026"); /* c */ x9 = f(y, "027"); /* c */ x9 = f(y, "028"); /* c */ x9 = f(y, "029"); /* c */ x9 = f(y, "030"); /* c */ x9 = f(y, "031"); /* c */ x9 = f(y, "032"); /* c */ x9 = f(y, "033"); /* c */ x9 = f(y, "034"); /* c */ x9 = f(y, "035"); /* c */ x9 = f(y, "036"); /* c */ x9 = f(y, "037"); /* c */ x9 = f(y, "038"); /* c */ x9 = f(y, "039"); /* c */ x9 = f(y, "040"); /* c */ x9 = f(y, "041"); /* c */ x9 = f(y, "042"); /* c */ x9 = f(y, "043"); /* c */ x9 = f(y, "044"); /* c */ x9 = f(y, "045"); /* c */ x9 = f(y, "046"); /* c */ x9 = f(y, "047"); /* c */ x9 = f(y, "048"); /* c */ x9 = f(y, "049"); /* c */ x9 = f(y, "050"); /* c */ x9 = f(y, "051"); /* c */ x9 = f(y, "052"); /* c */ x9 = f(y, "053"); /* c */ x9 = f(y, "054"); /* c */ x9 = f(y, "055"); /* c */ x9 = f(y, "056"); /* c */ x9 = f(y, "057"); /* c */ x9 = f(y, "058"); /* c */ x9 = f(y, "059"); /* c */ x9 = f(y, "060"); /* c */ x9 = f(y, "061"); /* c */ x9 = f(y, "062"); /* c */ x9 = f(y, "063"); /* c */ x9 = f(y, "064"); /* c */ x9 = f(y, "065"); /* c */ x9 = f(y, "066"); /* c */ x9 = f(y, "067"); /* c */ x9 = f(y, "068"); /* c */ x9 = f(y, "069"); /* c */ x9 = f(y, "070"); /* c */ x9 = f(y, "071"); /* c */ x9 = f(y, "072"); /* c */ x9 = f(y, "073"); /* c */ x9 = f(y, "074"); /* c */ x9 = f(y, "075"); /* c */ x9 = f(y, "076"); /* c */ x9 = f(y, "077"); /* c */ x9 = f(y, "078"); /* c */ x9 = f(y, "079"); /* c */ x9 = f(y, "080"); /* c */ x9 = f(y, "081"); /* c */ x9 = f(y, "082"); /* c */ x9 = f(y, "083"); /* c */ x9 = f(y, "084"); /* c */ x9 = f(y, "085"); /* c */ x9 = f(y, "086"); /* c */ x9 = f(y, "087"); /* c */ x9 = f(y, "088"); /* c */ x9 = f(y, "089"); /* c */ x9 = f(y, "090"); /* c */ x9 = f(y, "091"); /* c */ x9 = f(y, "092"); /* c */ x9 = f(y, "093"); /* c */ x9 = f(y, "094"); /* c */ x9 = f(y, "095"); /* c */ x9 = f(y, "096"); /* c */ x9 = f(y, "097"); /* c */ x9 = f(y, "098"); /* c */ x9 = f(y, "099"); /* c */ x9 = f(y, "100"); /* c */ x9 = f(y, "101"); /* c */ x9 = f(y, "102"); /* c */ x9 = f(y, "103"); /* c */ x9 = f(y, "104"); /* c */ x9 = f(y, "105"); /* c */ x9 = f(y, "106"); /* c */ x9 = f(y, "107"); /* c */ x9 = f(y, "108"); /* c */ x9 = f(y, "109"); /* c */ x9 = f(y, "110"); /* c */ x9 = f(y, "111"); /* c */ x9 = f(y, "112"); /* c */ x9 = f(y, "113"); /* c */ x9 = f(y, "114"); /* c */ x9 = f(y, "115"); /* c */ x9 = f(y, "116"); /* c */ x9 = f(y, "117"); /* c */ x9 = f(y, "118"); /* c */ x9 = f(y, "119"); /* c */ x9 = f(y, "120"); /* c */ x9 = f(y, "121"); /* c */ x9 = f(y, "122"); /* c */ x9 = f(y, "123"); /* c */ x9 = f(y, "124"); /* c */ x9 = f(y, "125"); /* c */ x9 = f(y, "126"); /* c */ x9 = f(y, "127"); /* c */ x9 = f(y, "128"); /* c */ x9 = f(y, "129"); /* c */ x9 = f(y, "130"); /* c */ x9 = f(y, "131"); /* c */ x9 = f(y, "132"); /* c */ x9 = f(y, "133"); /* c */ x9 = f(y, "134"); /* c */ x9 = f(y, "135"); /* c */ x9 = f(y, "136"); /* c */ x9 = f(y, "137"); /* c */ x9 = f(y, "138"); /* c */ x9 = f(y, "139"); /* c */ x9 = f(y, "140"); /* c */ x9 = f(y, "141"); /* c */ x9 = f(y, "142"); /* c */ x9 = f(y, "143"); /* c */ x9 = f(y, "144"); /* c */ x9 = f(y, "145"); /* c */ x9 = f(y, "146"); /* c */ x9 = f(y, "147"); /* c */ x9 = f(y, "148"); /* c */ x9 = f(y, "149"); /* c */ x9 = f(y, "150"); /* c */ x9 = f(y, "151"); /* c */ x9 = f(y, "152"); /* c */ x9 = f(y, "153"); /* c */ x9 = f(y, "154"); /* c */ x9 = f(y, "155"); /* c */ x9 = f(y, "156"); /* c */ x9 = f(y, "157"); /* c */ x9 = f(y, "158"); /* c */ x9 = f(y, "159"); /* c */ x9 = f(y, "160"); /* c */ x9 = f(y, "161"); /* c */ x9 = f(y, "162"); /* c */ x9 = f(y, "163"); /* c */ x9 = f(y, "164"); /* c */ x9 = f(y, "165"); /* c */ x9 = f(y, "166"); /* c */ x9 = f(y, "167"); /* c */ x9 = f(y, "168"); /* c */ x9 = f(y, "169"); /* c */ x9 = f(y, "170"); /* c */ x9 = f(y, "171"); /* c */ x9 = f(y, "172"); /* c */ x9 = f(y, "173"); /* c */ x9 = f(y, "174"); /* c */ x9 = f(y, "175"); /* c */ x9 = f(y, "176"); /* c */ x9 = f(y, "177"); /* c */ x9 = f(y, "178"); /* c */ x9 = f(y, "179"); /* c */ x9 = f(y, "180"); /* c */ x9 = f(y, "181"); /* c */ x9 = f(y, "182"); /* c */ x9 = f(y, "183"); /* c */ x9 = f(y, "184"); /* c */ x9 = f(y, "185"); /* c */ x9 = f(y, "186"); /* c */ x9 = f(y, "187"); /* c */ x9 = f(y, "188"); /* c */ x9 = f(y, "189"); /* c */ x9 = f(y, "190"); /* c */ x9 = f(y, "191"); /* c */ x9 = f(y, "192"); /* c */ x9 = f(y, "193"); /* c */ x9 = f(y, "194"); /* c */ x9 = f(y, "195"); /* c */ x9 = f(y, "196"); /* c */ x9 = f(y, "197"); /* c */ x9 = f(y, "198"); /* c */ x9 = f(y, "199"); /* c */ 
+x10 = f(y, "000"); /* c */ x10 = f(y, "001"); /* c */ x10 = f(y, "002"); /* c */ x10 = f(y, "003"); /* c */ x10 = f(y, "004"); /* c */ x10 = f(y, "005"); /* c */ x10 = f(y, "006"); /* c */ x10 = f(y, "007"); /* c */ x10 = f(y, "008"); /* c */ x10 = f(y, "009"); /* c */ x10 = f(y, "010"); /* c */ x10 = f(y, "011"); /* c */ x10 = f(y, "012"); /* c */ x10 = f(y, "013"); /* c */ x10 = f(y, "014"); /* c */ x10 = f(y, "015"); /* c */ x10 = f(y, "016"); /* c */ x10 = f(y, "017"); /* c */ x10 = f(y, "018"); /* c */ x10 = f(y, "019"); /* c */ x10 = f(y, "020"); /* c */ x10 = f(y, "021"); /* c */ x10 = f(y, "022"); /* c */ x10 = f(y, "023"); /* c */ x10 = f(y, "024"); /* c */ x10 = f(y, "025"); /* c */ x10 = f(y, "026"); /* c */ x10 = f(y, "027"); /* c */ x10 = f(y, "028"); /* c */ x10 = f(y, "029"); /* c */ x10 = f(y, "030"); /* c */ x10 = f(y, "031"); /* c */ x10 = f(y, "032"); /* c */ x10 = f(y, "033"); /* c */ x10 = f(y, "034"); /* c */ x10 = f(y, "035"); /* c */ x10 = f(y, "036"); /* c */ x10 = f(y, "037"); /* c */ x10 = f(y, "038"); /* c */ x10 = f(y, "039"); /* c */ x10 = f(y, "040"); /* c */ x10 = f(y, "041"); /* c */ x10 = f(y, "042"); /* c */ x10 = f(y, "043"); /* c */ x10 = f(y, "044"); /* c */ x10 = f(y, "045"); /* c */ x10 = f(y, "046"); /* c */ x10 = f(y, "047"); /* c */ x10 = f(y, "048"); /* c */ x10 = f(y, "049"); /* c */ x10 = f(y, "050"); /* c */ x10 = f(y, "051"); /* c */ x10 = f(y, "052"); /* c */ x10 = f(y, "053"); /* c */ x10 = f(y, "054"); /* c */ x10 = f(y, "055"); /* c */ x10 = f(y, "056"); /* c */ x10 = f(y, "057"); /* c */ x10 = f(y, "058"); /* c */ x10 = f(y, "059"); /* c */ x10 = f(y, "060"); /* c */ x10 = f(y, "061"); /* c */ x10 = f(y, "062"); /* c */ x10 = f(y, "063"); /* c */ x10 = f(y, "064"); /* c */ x10 = f(y, "065"); /* c */ x10 = f(y, "066"); /* c */ x10 = f(y, "067"); /* c */ x10 = f(y, "068"); /* c */ x10 = f(y, "069"); /* c */ x10 = f(y, "070"); /* c */ x10 = f(y, "071"); /* c */ x10 = f(y, "072"); /* c */ x10 = f(y, "073"); /* c */ x10 = f(y, "074"); /* c */ x10 = f(y, "075"); /* c */ x10 = f(y, "076"); /* c */ x10 = f(y, "077"); /* c */ x10 = f(y, "078"); /* c */ x10 = f(y, "079"); /* c */ x10 = f(y, "080"); /* c */ x10 = f(y, "081"); /* c */ x10 = f(y, "082"); /* c */ x10 = f(y, "083"); /* c */ x10 = f(y, "084"); /* c */ x10 = f(y, "085"); /* c */ x10 = f(y, "086"); /* c */ x10 = f(y, "087"); /* c */ x10 = f(y, "088"); /* c */ x10 = f(y, "089"); /* c */ x10 = f(y, "090"); /* c */ x10 = f(y, "091"); /* c */ x10 = f(y, "092"); /* c */ x10 = f(y, "093"); /* c */ x10 = f(y, "094"); /* c */ x10 = f(y, "095"); /* c */ x10 = f(y, "096"); /* c */ x10 = f(y, "097"); /* c */ x10 = f(y, "098"); /* c */ x10 = f(y, "099"); /* c */ x10 = f(y, "100"); /* c */ x10 = f(y, "101"); /* c */ x10 = f(y, "102"); /* c */ x10 = f(y, "103"); /* c */ x10 = f(y, "104"); /* c */ x10 = f(y, "105"); /* c */ x10 = f(y, "106"); /* c */ x10 = f(y, "107"); /* c */ x10 = f(y, "108"); /* c */ x10 = f(y, "109"); /* c */ x10 = f(y, "110"); /* c */ x10 = f(y, "111"); /* c */ x10 = f(y, "112"); /* c */ x10 = f(y, "113"); /* c */ x10 = f(y, "114"); /* c */ x10 = f(y, "115"); /* c */ x10 = f(y, "116"); /* c */ x10 = f(y, "117"); /* c */ x10 = f(y, "118"); /* c */ x10 = f(y, "119"); /* c */ x10 = f(y, "120"); /* c */ x10 = f(y, "121"); /* c */ x10 = f(y, "122"); /* c */ x10 = f(y, "123"); /* c */ x10 = f(y, "124"); /* c */ x10 = f(y, "125"); /* c */ x10 = f(y, "126"); /* c */ x10 = f(y, "127"); /* c */ x10 = f(y, "128"); /* c */ x10 = f(y, "129"); /* c */ x10 = f(y, "130"); /* c */ x10 = f(y, "131"); /* c */ x10 = f(y, "132"); /* c */ x10 = f(y, "133"); /* c */ x10 = f(y, "134"); /* c */ x10 = f(y, "135"); /* c */ x10 = f(y, "136"); /* c */ x10 = f(y, "137"); /* c */ x10 = f(y, "138"); /* c */ x10 = f(y, "139"); /* c */ x10 = f(y, "140"); /* c */ x10 = f(y, "141"); /* c */ x10 = f(y, "142"); /* c */ x10 = f(y, "143"); /* c */ x10 = f(y, "144"); /* c */ x10 = f(y, "145"); /* c */ x10 = f(y, "146"); /* c */ x10 = f(y, "147"); /* c */ x10 = f(y, "148"); /* c */ x10 = f(y, "149"); /* c */ x10 = f(y, "150"); /* c */ x10 = f(y, "151"); /* c */ x10 = f(y, "152"); /* c */ x10 = f(y, "153"); /* c */ x10 = f(y, "154"); /* c */ x10 = f(y, "155"); /* c */ x10 = f(y, "156"); /* c */ x10 = f(y, "157"); /* c */ x10 = f(y, "158"); /* c */ x10 = f(y, "159"); /* c */ x10 = f(y, "160"); /* c */ x10 = f(y, "161"); /* c */ x10 = f(y, "162"); /* c */ x10 = f(y, "163"); /* c */ x10 = f(y, "164"); /* c */ x10 = f(y, "165"); /* c */ x10 = f(y, "166"); /* c */ x10 = f(y, "167"); /* c */ x10 = f(y, "168"); /* c */ x10 = f(y, "169"); /* c */ x10 = f(y, "170"); /* c */ x10 = f(y, "171"); /* c */ x10 = f(y, "172"); /* c */ x10 = f(y, "173"); /* c */ x10 = f(y, "174"); /* c */ x10 = f(y, "175"); /* c */ x10 = f(y, "176"); /* c */ x10 = f(y, "177"); /* c */ x10 = f(y, "178"); /* c */ x10 = f(y, "179"); /* c */ x10 = f(y, "180"); /* c */ x10 = f(y, "181"); /* c */ x10 = f(y, "182"); /* c */ x10 = f(y, "183"); /* c */ x10 = f(y, "184"); /* c */ x10 = f(y, "185"); /* c */ x10 = f(y, "186"); /* c */ x10 = f(y, "187"); /* c */ x10 = f(y, "188"); /* c */ x10 = f(y, "189"); /* c */ x10 = f(y, "190"); /* c */ x10 = f(y, "191"); /* c */ x10 = f(y, "192"); /* c */ x10 = f(y, "193"); /* c */ x10 = f(y, "194"); /* c */ x10 = f(y, "195"); /* c */ x10 = f(y, "196"); /* c */ x10 = f(y, "197"); /* c */ x10 = f(y, "198"); /* c */ x10 = f(y, "199"); /* c */ 
+x11 = f(y, "000"); /* c */ x11 = f(y, "001"); /* c */ x11 = f(y, "002"); /* c */ x11 = f(y, "003"); /* c */ x11 = f(y, "004"); /* c */ x11 = f(y, "005"); /* c */ x11 = f(y, "006"); /* c */ x11 = f(y, "007"); /* c */ x11 = f(y, "008"); /* c */ x11 = f(y, "009"); /* c */ x11 = f(y, "010"); /* c */ x11 = f(y, "011"); /* c */ x11 = f(y, "012"); /* c */ x11 = f(y, "013"); /* c */ x11 = f(y, "014"); /* c */ x11 = f(y, "015"); /* c */ x11 = f(y, "016"); /* c */ x11 = f(y, "017"); /* c */ x11 = f(y, "018"); /* c */ x11 = f(y, "019"); /* c */ x11 = f(y, "020"); /* c */ x11 = f(y, "021"); /* c */ x11 = f(y, "022"); /* c */ x11 = f(y, "023"); /* c */ x11 = f(y, "024"); /* c */ x11 = f(y, "025"); /* c */ x11 = f(y, "026"); /* c */ x11 = f(y, "027"); /* c */ x11 = f(y, "028"); /* c */ x11 = f(y, "029"); /* c */ x11 = f(y, "030"); /* c */ x11 = f(y, "031"); /* c */ x11 = f(y, "032"); /* c */ x11 = f(y, "033"); /* c */ x11 = f(y, "034"); /* c */ x11 = f(y, "035"); /* c */ x11 = f(y, "036"); /* c */ x11 = f(y, "037"); /* c */ x11 = f(y, "038"); /* c */ x11 = f(y, "039"); /* c */ x11 = f(y, "040"); /* c */ x11 = f(y, "041"); /* c */ x11 = f(y, "042"); /* c */ x11 = f(y, "043"); /* c */ x11 = f(y, "044"); /* c */ x11 = f(y, "045"); /* c */ x11 = f(y, "046"); /* c */ x11 = f(y, "047"); /* c */ x11 = f(y, "048"); /* c */ x11 = f(y, "049"); /* c */ x11 = f(y, "050"); /* c */ x11 = f(y, "051"); /* c */ x11 = f(y, "052"); /* c */ x11 = f(y, "053"); /* c */ x11 = f(y, "054"); /* c */ x11 = f(y, "055"); /* c */ x11 = f(y, "056"); /* c */ x11 = f(y, "057"); /* c */ x11 = f(y, "058"); /* c */ x11 = f(y, "059"); /* c */ x11 = f(y, "060"); /* c */ x11 = f(y, "061"); /* c */ x11 = f(y, "062"); /* c */ x11 = f(y, "063"); /* c */ x11 = f(y, "064"); /* c */ x11 = f(y, "065"); /* c */ x11 = f(y, "066"); /* c */ x11 = f(y, "067"); /* c */ x11 = f(y, "068"); /* c */ x11 = f(y, "069"); /* c */ x11 = f(y, "070"); /* c */ x11 = f(y, "071"); /* c */ x11 = f(y, "072"); /* c */ x11 = f(y, "073"); /* c */ x11 = f(y, "074"); /* c */ x11 = f(y, "075"); /* c */ x11 = f(y, "076"); /* c */ x11 = f(y, "077"); /* c */ x11 = f(y, "078"); /* c */ x11 = f(y, "079"); /* c */ x11 = f(y, "080"); /* c */ x11 = f(y, "081"); /* c */ x11 = f(y, "082"); /* c */ x11 = f(y, "083"); /* c */ x11 = f(y, "084"); /* c */ x11 = f(y, "085"); /* c */ x11 = f(y, "086"); /* c */ x11 = f(y, "087"); /* c */ x11 = f(y, "088"); /* c */ x11 = f(y, "089"); /* c */ x11 = f(y, "090"); /* c */ x11 = f(y, "091"); /* c */ x11 = f(y, "092"); /* c */ x11 = f(y, "093"); /* c */ x11 = f(y, "094"); /* c */ x11 = f(y, "095"); /* c */ x11 = f(y, "096"); /* c */ x11 = f(y, "097"); /* c */ x11 = f(y, "098"); /* c */ x11 = f(y, "099"); /* c */ x11 = f(y, "100"); /* c */ x11 = f(y, "101"); /* c */ x11 = f(y, "102"); /* c */ x11 = f(y, "103"); /* c */ x11 = f(y, "104"); /* c */ x11 = f(y, "105"); /* c */ x11 = f(y, "106"); /* c */ x11 = f(y, "107"); /* c */ x11 = f(y, "108"); /* c */ x11 = f(y, "109"); /* c */ x11 = f(y, "110"); /* c */ x11 = f(y, "111"); /* c */ x11 = f(y, "112"); /* c */ x11 = f(y, "113"); /* c */ x11 = f(y, "114"); /* c */ x11 = f(y, "115"); /* c */ x11 = f(y, "116"); /* c */ x11 = f(y, "117"); /* c */ x11 = f(y, "118"); /* c */ x11 = f(y, "119"); /* c */ x11 = f(y, "120"); /* c */ x11 = f(y, "121"); /* c */ x11 = f(y, "122"); /* c */ x11 = f(y, "123"); /* c */ x11 = f(y, "124"); /* c */ x11 = f(y, "125"); /* c */ x11 = f(y, "126"); /* c */ x11 = f(y, "127"); /* c */ x11 = f(y, "128"); /* c */ x11 = f(y, "129"); /* c */ x11 = f(y, "130"); /* c */ x11 = f(y, "131"); /* c */ x11 = f(y, "132"); /* c */ x11 = f(y, "133"); /* c */ x11 = f(y, "134"); /* c */ x11 = f(y, "135"); /* c */ x11 = f(y, "136"); /* c */ x11 = f(y, "137"); /* c */ x11 = f(y, "138"); /* c */ x11 = f(y, "139"); /* c */ x11 = f(y, "140"); /* c */ x11 = f(y, "141"); /* c */ x11 = f(y, "142"); /* c */ x11 = f(y, "143"); /* c */ x11 = f(y, "144"); /* c */ x11 = f(y, "145"); /* c */ x11 = f(y, "146"); /* c */ x11 = f(y, "147"); /* c */ x11 = f(y, "148"); /* c */ x11 = f(y, "149"); /* c */ x11 = f(y, "150"); /* c */ x11 = f(y, "151"); /* c */ x11 = f(y, "152"); /* c */ x11 = f(y, "153"); /* c */ x11 = f(y, "154"); /* c */ x11 = f(y, "155"); /* c */ x11 = f(y, "156"); /* c */ x11 = f(y, "157"); /* c */ x11 = f(y, "158"); /* c */ x11 = f(y, "159"); /* c */ x11 = f(y, "160"); /* c */ x11 = f(y, "161"); /* c */ x11 = f(y, "162"); /* c */ x11 = f(y, "163"); /* c */ x11 = f(y, "164"); /* c */ x11 = f(y, "165"); /* c */ x11 = f(y, "166"); /* c */ x11 = f(y, "167"); /* c */ x11 = f(y, "168"); /* c */ x11 = f(y, "169"); /* c */ x11 = f(y, "170"); /* c */ x11 = f(y, "171"); /* c */ x11 = f(y, "172"); /* c */ x11 = f(y, "173"); /* c */ x11 = f(y, "174"); /* c */ x11 = f(y, "175"); /* c */ x11 = f(y, "176"); /* c */ x11 = f(y, "177"); /* c */ x11 = f(y, "178"); /* c */ x11 = f(y, "179"); /* c */ x11 = f(y, "180"); /* c */ x11 = f(y, "181"); /* c */ x11 = f(y, "182"); /* c */ x11 = f(y, "183"); /* c */ x11 = f(y, "184"); /* c */ x11 = f(y, "185"); /* c */ x11 = f(y, "186"); /* c */ x11 = f(y, "187"); /* c */ x11 = f(y, "188"); /* c */ x11 = f(y, "189"); /* c */ x11 = f(y, "190"); /* c */ x11 = f(y, "191"); /* c */ x11 = f(y, "192"); /* c */ x11 = f(y, "193"); /* c */ x11 = f(y, "194"); /* c */ x11 = f(y, "195"); /* c */ x11 = f(y, "196"); /* c */ x11 = f(y, "197"); /* c */ x11 = f(y, "198"); /* c */ x11 = f(y, "199"); /* c */ 
+x12 = f(y, "000"); /* c */ x12 = f(y, "001"); /* c */ x12 = f(y, "002"); /* c */ x12 = f(y, "003"); /* c */ x12 = f(y, "004"); /* c */ x12 = f(y, "005"); /* c */ x12 = f(y, "006"); /* c */ x12 = f(y, "007"); /* c */ x12 = f(y, "008"); /* c */ x12 = f(y, "009"); /* c */ x12 = f(y, "010"); /* c */ x12 = f(y, "011"); /* c */ x12 = f(y, "012"); /* c */ x12 = f(y, "013"); /* c */ x12 = f(y, "014"); /* c */ x12 = f(y, "015"); /* c */ x12 = f(y, "016"); /* c */ x12 = f(y, "017"); /* c */ x12 = f(y, "018"); /* c */ x12 = f(y, "019"); /* c */ x12 = f(y, "020"); /* c */ x12 = f(y, "021"); /* c */ x12 = f(y, "022"); /* c */ x12 = f(y, "023"); /* c */ x12 = f(y, "024"); /* c */ x12 = f(y, "025"); /* c */ x12 = f(y, "026"); /* c */ x12 = f(y, "027"); /* c */ x12 = f(y, "028"); /* c */ x12 = f(y, "029"); /* c */ x12 = f(y, "030"); /* c */ x12 = f(y, "031"); /* c */ x12 = f(y, "032"); /* c */ x12 = f(y, "033"); /* c */ x12 = f(y, "034"); /* c */ x12 = f(y, "035"); /* c */ x12 = f(y, "036"); /* c */ x12 = f(y, "037"); /* c */ x12 = f(y, "038"); /* c */ x12 = f(y, "039"); /* c */ x12 = f(y, "040"); /* c */ x12 = f(y, "041"); /* c */ x12 = f(y, "042"); /* c */ x12 = f(y, "043"); /* c */ x12 = f(y, "044"); /* c */ x12 = f(y, "045"); /* c */ x12 = f(y, "046"); /* c */ x12 = f(y, "047"); /* c */ x12 = f(y, "048"); /* c */ x12 = f(y, "049"); /* c */ x12 = f(y, "050"); /* c */ x12 = f(y, "051"); /* c */ x12 = f(y, "052"); /* c */ x12 = f(y, "053"); /* c */ x12 = f(y, "054"); /* c */ x12 = f(y, "055"); /* c */ x12 = f(y, "056"); /* c */ x12 = f(y, "057"); /* c */ x12 = f(y, "058"); /* c */ x12 = f(y, "059"); /* c */ x12 = f(y, "060"); /* c */ x12 = f(y, "061"); /* c */ x12 = f(y, "062"); /* c */ x12 = f(y, "063"); /* c */ x12 = f(y, "064"); /* c */ x12 = f(y, "065"); /* c */ x12 = f(y, "066"); /* c */ x12 = f(y, "067"); /* c */ x12 = f(y, "068"); /* c */ x12 = f(y, "069"); /* c */ x12 = f(y, "070"); /* c */ x12 = f(y, "071"); /* c */ x12 = f(y, "072"); /* c */ x12 = f(y, "073"); /* c */ x12 = f(y, "074"); /* c */ x12 = f(y, "075"); /* c */ x12 = f(y, "076"); /* c */ x12 = f(y, "077"); /* c */ x12 = f(y, "078"); /* c */ x12 = f(y, "079"); /* c */ x12 = f(y, "080"); /* c */ x12 = f(y, "081"); /* c */ x12 = f(y, "082"); /* c */ x12 = f(y, "083"); /* c */ x12 = f(y, "084"); /* c */ x12 = f(y, "085"); /* c */ x12 = f(y, "086"); /* c */ x12 = f(y, "087"); /* c */ x12 = f(y, "088"); /* c */ x12 = f(y, "089"); /* c */ x12 = f(y, "090"); /* c */ x12 = f(y, "091"); /* c */ x12 = f(y, "092"); /* c */ x12 = f(y, "093"); /* c */ x12 = f(y, "094"); /* c */ x12 = f(y, "095"); /* c */ x12 = f(y, "096"); /* c */ x12 = f(y, "097"); /* c */ x12 = f(y, "098"); /* c */ x12 = f(y, "099"); /* c */ x12 = f(y, "100"); /* c */ x12 = f(y, "101"); /* c */ x12 = f(y, "102"); /* c */ x12 = f(y, "103"); /* c */ x12 = f(y, "104"); /* c */ x12 = f(y, "105"); /* c */ x12 = f(y, "106"); /* c */ x12 = f(y, "107"); /* c */ x12 = f(y, "108"); /* c */ x12 = f(y, "109"); /* c */ x12 = f(y, "110"); /* c */ x12 = f(y, "111"); /* c */ x12 = f(y, "112"); /* c */ x12 = f(y, "113"); /* c */ x12 = f(y, "114"); /* c */ x12 = f(y, "115"); /* c */ x12 = f(y, "116"); /* c */ x12 = f(y, "117"); /* c */ x12 = f(y, "118"); /* c */ x12 = f(y, "119"); /* c */ x12 = f(y, "120"); /* c */ x12 = f(y, "121"); /* c */ x12 = f(y, "122"); /* c */ x12 = f(y, "123"); /* c */ x12 = f(y, "124"); /* c */ x12 = f(y, "125"); /* c */ x12 = f(y, "126"); /* c */ x12 = f(y, "127"); /* c */ x12 = f(y, "128"); /* c */ x12 = f(y, "129"); /* c */ x12 = f(y, "130"); /* c */ x12 = f(y, "131"); /* c */ x12 = f(y, "132"); /* c */ x12 = f(y, "133"); /* c */ x12 = f(y, "134"); /* c */ x12 = f(y, "135"); /* c */ x12 = f(y, "136"); /* c */ x12 = f(y, "137"); /* c */ x12 = f(y, "138"); /* c */ x12 = f(y, "139"); /* c */ x12 = f(y, "140"); /* c */ x12 = f(y, "141"); /* c */ x12 = f(y, "142"); /* c */ x12 = f(y, "143"); /* c */ x12 = f(y, "144"); /* c */ x12 = f(y, "145"); /* c */ x12 = f(y, "146"); /* c */ x12 = f(y, "147"); /* c */ x12 = f(y, "148"); /* c */ x12 = f(y, "149"); /* c */ x12 = f(y, "150"); /* c */ x12 = f(y, "151"); /* c */ x12 = f(y, "152"); /* c */ x12 = f(y, "153"); /* c */ x12 = f(y, "154"); /* c */ x12 = f(y, "155"); /* c */ x12 = f(y, "156"); /* c */ x12 = f(y, "157"); /* c */ x12 = f(y, "158"); /* c */ x12 = f(y, "159"); /* c */ x12 = f(y, "160"); /* c */ x12 = f(y, "161"); /* c */ x12 = f(y, "162"); /* c */ x12 = f(y, "163"); /* c */ x12 = f(y, "164"); /* c */ x12 = f(y, "165"); /* c */ x12 = f(y, "166"); /* c */ x12 = f(y, "167"); /* c */ x12 = f(y, "168"); /* c */ x12 = f(y, "169"); /* c */ x12 = f(y, "170"); /* c */ x12 = f(y, "171"); /* c */ x12 = f(y, "172"); /* c */ x12 = f(y, "173"); /* c */ x12 = f(y, "174"); /* c */ x12 = f(y, "175"); /* c */ x12 = f(y, "176"); /* c */ x12 = f(y, "177"); /* c */ x12 = f(y, "178"); /* c */ x12 = f(y, "179"); /* c */ x12 = f(y, "180"); /* c */ x12 = f(y, "181"); /* c */ x12 = f(y, "182"); /* c */ x12 = f(y, "183"); /* c */ x12 = f(y, "184"); /* c */ x12 = f(y, "185"); /* c */ x12 = f(y, "186"); /* c */ x12 = f(y, "187"); /* c */ x12 = f(y, "188"); /* c */ x12 = f(y, "189"); /* c */ x12 = f(y, "190"); /* c */ x12 = f(y, "191"); /* c */ x12 = f(y, "192"); /* c */ x12 = f(y, "193"); /* c */ x12 = f(y, "194"); /* c */ x12 = f(y, "195"); /* c */ x12 = f(y, "196"); /* c */ x12 = f(y, "197"); /* c */ x12 = f(y, "198"); /* c */ x12 = f(y, "199"); /* c */ 
+x13 = f(y, "000"); /* c */ x13 = f(y, "001"); /* c */ x13 = f(y, "002"); /* c */ x13 = f(y, "003"); /* c */ x13 = f(y, "004"); /* c */ x13 = f(y, "005"); /* c */ x13 = f(y, "006"); /* c */ x13 = f(y, "007"); /* c */ x13 = f(y, "008"); /* c */ x13 = f(y, "009"); /* c */ x13 = f(y, "010"); /* c */ x13 = f(y, "011"); /* c */ x13 = f(y, "012"); /* c */ x13 = f(y, "013"); /* c */ x13 = f(y, "014"); /* c */ x13 = f(y, "015"); /* c */ x13 = f(y, "016"); /* c */ x13 = f(y, "017"); /* c */ x13 = f(y, "018"); /* c */ x13 = f(y, "019"); /* c */ x13 = f(y, "020"); /* c */ x13 = f(y, "021"); /* c */ x13 = f(y, "022"); /* c */ x13 = f(y, "023"); /* c */ x13 = f(y, "024"); /* c */ x13 = f(y, "025"); /* c */ x13 = f(y, "026"); /* c */ x13 = f(y, "027"); /* c */ x13 = f(y, "028"); /* c */ x13 = f(y, "029"); /* c */ x13 = f(y, "030"); /* c */ x13 = f(y, "031"); /* c */ x13 = f(y, "032"); /* c */ x13 = f(y, "033"); /* c */ x13 = f(y, "034"); /* c */ x13 = f(y, "035"); /* c */ x13 = f(y, "036"); /* c */ x13 = f(y, "037"); /* c */ x13 = f(y, "038"); /* c */ x13 = f(y, "039"); /* c */ x13 = f(y, "040"); /* c */ x13 = f(y, "041"); /* c */ x13 = f(y, "042"); /* c */ x13 = f(y, "043"); /* c */ x13 = f(y, "044"); /* c */ x13 = f(y, "045"); /* c */ x13 = f(y, "046"); /* c */ x13 = f(y, "047"); /* c */ x13 = f(y, "048"); /* c */ x13 = f(y, "049"); /* c */ x13 = f(y, "050"); /* c */ x13 = f(y, "051"); /* c */ x13 = f(y, "052"); /* c */ x13 = f(y, "053"); /* c */ x13 = f(y, "054"); /* c */ x13 = f(y, "055"); /* c */ x13 = f(y, "056"); /* c */ x13 = f(y, "057"); /* c */ x13 = f(y, "058"); /* c */ x13 = f(y, "059"); /* c */ x13 = f(y, "060"); /* c */ x13 = f(y, "061"); /* c */ x13 = f(y, "062"); /* c */ x13 = f(y, "063"); /* c */ x13 = f(y, "064"); /* c */ x13 = f(y, "065"); /* c */ x13 = f(y, "066"); /* c */ x13 = f(y, "067"); /* c */ x13 = f(y, "068"); /* c */ x13 = f(y, "069"); /* c */ x13 = f(y, "070"); /* c */ x13 = f(y, "071"); /* c */ x13 = f(y, "072"); /* c */ x13 = f(y, "073"); /* c */ x13 = f(y, "074"); /* c */ x13 = f(y, "075"); /* c */ x13 = f(y, "076"); /* c */ x13 = f(y, "077"); /* c */ x13 = f(y, "078"); /* c */ x13 = f(y, "079"); /* c */ x13 = f(y, "080"); /* c */ x13 = f(y, "081"); /* c */ x13 = f(y, "082"); /* c */ x13 = f(y, "083"); /* c */ x13 = f(y, "084"); /* c */ x13 = f(y, "085"); /* c */ x13 = f(y, "086"); /* c */ x13 = f(y, "087"); /* c */ x13 = f(y, "088"); /* c */ x13 = f(y, "089"); /* c */ x13 = f(y, "090"); /* c */ x13 = f(y, "091"); /* c */ x13 = f(y, "092"); /* c */ x13 = f(y, "093"); /* c */ x13 = f(y, "094"); /* c */ x13 = f(y, "095"); /* c */ x13 = f(y, "096"); /* c */ x13 = f(y, "097"); /* c */ x13 = f(y, "098"); /* c */ x13 = f(y, "099"); /* c */ x13 = f(y, "100"); /* c */ x13 = f(y, "101"); /* c */ x13 = f(y, "102"); /* c */ x13 = f(y, "103"); /* c */ x13 = f(y, "104"); /* c */ x13 = f(y, "105"); /* c */ x13 = f(y, "106"); /* c */ x13 = f(y, "107"); /* c */ x13 = f(y, "108"); /* c */ x13 = f(y, "109"); /* c */ x13 = f(y, "110"); /* c */ x13 = f(y, "111"); /* c */ x13 = f(y, "112"); /* c */ x13 = f(y, "113"); /* c */ x13 = f(y, "114"); /* c */ x13 = f(y, "115"); /* c */ x13 = f(y, "116"); /* c */ x13 = f(y, "117"); /* c */ x13 = f(y, "118"); /* c */ x13 = f(y, "119"); /* c */ x13 = f(y, "120"); /* c */ x13 = f(y, "121"); /* c */ x13 = f(y, "122"); /* c */ x13 = f(y, "123"); /* c */ x13 = f(y, "124"); /* c */ x13 = f(y, "125"); /* c */ x13 = f(y, "126"); /* c */ x13 = f(y, "127"); /* c */ x13 = f(y, "128"); /* c */ x13 = f(y, "129"); /* c */ x13 = f(y, "130"); /* c */ x13 = f(y, "131"); /* c */ x13 = f(y, "132"); /* c */ x13 = f(y, "133"); /* c */ x13 = f(y, "134"); /* c */ x13 = f(y, "135"); /* c */ x13 = f(y, "136"); /* c */ x13 = f(y, "137"); /* c */ x13 = f(y, "138"); /* c */ x13 = f(y, "139"); /* c */ x13 = f(y, "140"); /* c */ x13 = f(y, "141"); /* c */ x13 = f(y, "142"); /* c */ x13 = f(y, "143"); /* c */ x13 = f(y, "144"); /* c */ x13 = f(y, "145"); /* c */ x13 = f(y, "146"); /* c */ x13 = f(y, "147"); /* c */ x13 = f(y, "148"); /* c */ x13 = f(y, "149"); /* c */ x13 = f(y, "150"); /* c */ x13 = f(y, "151"); /* c */ x13 = f(y, "152"); /* c */ x13 = f(y, "153"); /* c */ x13 = f(y, "154"); /* c */ x13 = f(y, "155"); /* c */ x13 = f(y, "156"); /* c */ x13 = f(y, "157"); /* c */ x13 = f(y, "158"); /* c */ x13 = f(y, "159"); /* c */ x13 = f(y, "160"); /* c */ x13 = f(y, "161"); /* c */ x13 = f(y, "162"); /* c */ x13 = f(y, "163"); /* c */ x13 = f(y, "164"); /* c */ x13 = f(y, "165"); /* c */ x13 = f(y, "166"); /* c */ x13 = f(y, "167"); /* c */ x13 = f(y, "168"); /* c */ x13 = f(y, "169"); /* c */ x13 = f(y, "170"); /* c */ x13 = f(y, "171"); /* c */ x13 = f(y, "172"); /* c */ x13 = f(y, "173"); /* c */ x13 = f(y, "174"); /* c */ x13 = f(y, "175"); /* c */ x13 = f(y, "176"); /* c */ x13 = f(y, "177"); /* c */ x13 = f(y, "178"); /* c */ x13 = f(y, "179"); /* c */ x13 = f(y, "180"); /* c */ x13 = f(y, "181"); /* c */ x13 = f(y, "182"); /* c */ x13 = f(y, "183"); /* c */ x13 = f(y, "184"); /* c */ x13 = f(y, "185"); /* c */ x13 = f(y, "186"); /* c */ x13 = f(y, "187"); /* c */ x13 = f(y, "188"); /* c */ x13 = f(y, "189"); /* c */ x13 = f(y, "190"); /* c */ x13 = f(y, "191"); /* c */ x13 = f(y, "192"); /* c */ x13 = f(y, "193"); /* c */ x13 = f(y, "194"); /* c */ x13 = f(y, "195"); /* c */ x13 = f(y, "196"); /* c */ x13 = f(y, "197"); /* c */ x13 = f(y, "198"); /* c */ x13 = f(y, "199"); /* c */ 
+x14 = f(y, "000"); /* c */ x14 = f(y, "001"); /* c */ x14 = f(y, "002"); /* c */ x14 = f(y, "003"); /* c */ x14 = f(y, "004"); /* c */ x14 = f(y, "005"); /* c */ x14 = f(y, "006"); /* c */ x14 = f(y, "007"); /* c */ x14 = f(y, "008"); /* c */ x14 = f(y, "009"); /* c */ x14 = f(y, "010"); /* c */ x14 = f(y, "011"); /* c */ x14 = f(y, "012"); /* c */ x14 = f(y, "013"); /* c */ x14 = f(y, "014"); /* c */ x14 = f(y, "015"); /* c */ x14 = f(y, "016"); /* c */ x14 = f(y, "017"); /* c */ x14 = f(y, "018"); /* c */ x14 = f(y, "019"); /* c */ x14 = f(y, "020"); /* c */ x14 = f(y, "021"); /* c */ x14 = f(y, "022"); /* c */ x14 = f(y, "023"); /* c */ x14 = f(y, "024"); /* c */ x14 = f(y, "025"); /* c */ x14 = f(y, "026"); /* c */ x14 = f(y, "027"); /* c */ x14 = f(y, "028"); /* c */ x14 = f(y, "029"); /* c */ x14 = f(y, "030"); /* c */ x14 = f(y, "031"); /* c */ x14 = f(y, "032"); /* c */ x14 = f(y, "033"); /* c */ x14 = f(y, "034"); /* c */ x14 = f(y, "035"); /* c */ x14 = f(y, "036"); /* c */ x14 = f(y, "037"); /* c */ x14 = f(y, "038"); /* c */ x14 = f(y, "039"); /* c */ x14 = f(y, "040"); /* c */ x14 = f(y, "041"); /* c */ x14 = f(y, "042"); /* c */ x14 = f(y, "043"); /* c */ x14 = f(y, "044"); /* c */ x14 = f(y, "045"); /* c */ x14 = f(y, "046"); /* c */ x14 = f(y, "047"); /* c */ x14 = f(y, "048"); /* c */ x14 = f(y, "049"); /* c */ x14 = f(y, "050"); /* c */ x14 = f(y, "051"); /* c */ x14 = f(y, "052"); /* c */ x14 = f(y, "053"); /* c */ x14 = f(y, "054"); /* c */ x14 = f(y, "055"); /* c */ x14 = f(y, "056"); /* c */ x14 = f(y, "057"); /* c */ x14 = f(y, "058"); /* c */ x14 = f(y, "059"); /* c */ x14 = f(y, "060"); /* c */ x14 = f(y, "061"); /* c */ x14 = f(y, "062"); /* c */ x14 = f(y, "063"); /* c */ x14 = f(y, "064"); /* c */ x14 = f(y, "065"); /* c */ x14 = f(y, "066"); /* c */ x14 = f(y, "067"); /* c */ x14 = f(y, "068"); /* c */ x14 = f(y, "069"); /* c */ x14 = f(y, "070"); /* c */ x14 = f(y, "071"); /* c */ x14 = f(y, "072"); /* c */ x14 = f(y, "073"); /* c */ x14 = f(y, "074"); /* c */ x14 = f(y, "075"); /* c */ x14 = f(y, "076"); /* c */ x14 = f(y, "077"); /* c */ x14 = f(y, "078"); /* c */ x14 = f(y, "079"); /* c */ x14 = f(y, "080"); /* c */ x14 = f(y, "081"); /* c */ x14 = f(y, "082"); /* c */ x14 = f(y, "083"); /* c */ x14 = f(y, "084"); /* c */ x14 = f(y, "085"); /* c */ x14 = f(y, "086"); /* c */ x14 = f(y, "087"); /* c */ x14 = f(y, "088"); /* c */ x14 = f(y, "089"); /* c */ x14 = f(y, "090"); /* c */ x14 = f(y, "091"); /* c */ x14 = f(y, "092"); /* c */ x14 = f(y, "093"); /* c */ x14 = f(y, "094"); /* c */ x14 = f(y, "095"); /* c */ x14 = f(y, "096"); /* c */ x14 = f(y, "097"); /* c */ x14 = f(y, "098"); /* c */ x14 = f(y, "099"); /* c */ x14 = f(y, "100"); /* c */ x14 = f(y, "101"); /* c */ x14 = f(y, "102"); /* c */ x14 = f(y, "103"); /* c */ x14 = f(y, "104"); /* c */ x14 = f(y, "105"); /* c */ x14 = f(y, "106"); /* c */ x14 = f(y, "107"); /* c */ x14 = f(y, "108"); /* c */ x14 = f(y, "109"); /* c */ x14 = f(y, "110"); /* c */ x14 = f(y, "111"); /* c */ x14 = f(y, "112"); /* c */ x14 = f(y, "113"); /* c */ x14 = f(y, "114"); /* c */ x14 = f(y, "115"); /* c */ x14 = f(y, "116"); /* c */ x14 = f(y, "117"); /* c */ x14 = f(y, "118"); /* c */ x14 = f(y, "119"); /* c */ x14 = f(y, "120"); /* c */ x14 = f(y, "121"); /* c */ x14 = f(y, "122"); /* c */ x14 = f(y, "123"); /* c */ x14 = f(y, "124"); /* c */ x14 = f(y, "125"); /* c */ x14 = f(y, "126"); /* c */ x14 = f(y, "127"); /* c */ x14 = f(y, "128"); /* c */ x14 = f(y, "129"); /* c */ x14 = f(y, "130"); /* c */ x14 = f(y, "131"); /* c */ x14 = f(y, "132"); /* c */ x14 = f(y, "133"); /* c */ x14 = f(y, "134"); /* c */ x14 = f(y, "135"); /* c */ x14 = f(y, "136"); /* c */ x14 = f(y, "137"); /* c */ x14 = f(y, "138"); /* c */ x14 = f(y, "139"); /* c */ x14 = f(y, "140"); /* c */ x14 = f(y, "141"); /* c */ x14 = f(y, "142"); /* c */ x14 = f(y, "143"); /* c */ x14 = f(y, "144"); /* c */ x14 = f(y, "145"); /* c */ x14 = f(y, "146"); /* c */ x14 = f(y, "147"); /* c */ x14 = f(y, "148"); /* c */ x14 = f(y, "149"); /* c */ x14 = f(y, "150"); /* c */ x14 = f(y, "151"); /* c */ x14 = f(y, "152"); /* c */ x14 = f(y, "153"); /* c */ x14 = f(y, "154"); /* c */ x14 = f(y, "155"); /* c */ x14 = f(y, "156"); /* c */ x14 = f(y, "157"); /* c */ x14 = f(y, "158"); /* c */ x14 = f(y, "159"); /* c */ x14 = f(y, "160"); /* c */ x14 = f(y, "161"); /* c */ x14 = f(y, "162"); /* c */ x14 = f(y, "163"); /* c */ x14 = f(y, "164"); /* c */ x14 = f(y, "165"); /* c */ x14 = f(y, "166"); /* c */ x14 = f(y, "167"); /* c */ x14 = f(y, "168"); /* c */ x14 = f(y, "169"); /* c */ x14 = f(y, "170"); /* c */ x14 = f(y, "171"); /* c */ x14 = f(y, "172"); /* c */ x14 = f(y, "173"); /* c */ x14 = f(y, "174"); /* c */ x14 = f(y, "175"); /* c */ x14 = f(y, "176"); /* c */ x14 = f(y, "177"); /* c */ x14 = f(y, "178"); /* c */ x14 = f(y, "179"); /* c */ x14 = f(y, "180"); /* c */ x14 = f(y, "181"); /* c */ x14 = f(y, "182"); /* c */ x14 = f(y, "183"); /* c */ x14 = f(y, "184"); /* c */ x14 = f(y, "185"); /* c */ x14 = f(y, "186"); /* c */ x14 = f(y, "187"); /* c */ x14 = f(y, "188"); /* c */ x14 = f(y, "189"); /* c */ x14 = f(y, "190"); /* c */ x14 = f(y, "191"); /* c */ x14 = f(y, "192"); /* c */ x14 = f(y, "193"); /* c */ x14 = f(y, "194"); /* c */ x14 = f(y, "195"); /* c */ x14 = f(y, "196"); /* c */ x14 = f(y, "197"); /* c */ x14 = f(y, "198"); /* c */ x14 = f(y, "199"); /* c */ 
+x15 = f(y, "000"); /* c */ x15 = f(y, "001"); /* c */ x15 = f(y, "002"); /* c */ x15 = f(y, "003"); /* c */ x15 = f(y, "004"); /* c */ x15 = f(y, "005"); /* c */ x15 = f(y, "006"); /* c */ x15 = f(y, "007"); /* c */ x15 = f(y, "008"); /* c */ x15 = f(y, "009"); /* c */ x15 = f(y, "010"); /* c */ x15 = f(y, "011"); /* c */ x15 = f(y, "012"); /* c */ x15 = f(y, "013"); /* c */ x15 = f(y, "014"); /* c */ x15 = f(y, "015"); /* c */ x15 = f(y, "016"); /* c */ x15 = f(y, "017"); /* c */ x15 = f(y, "018"); /* c */ x15 = f(y, "019"); /* c */ x15 = f(y, "020"); /* c */ x15 = f(y, "021"); /* c */ x15 = f(y, "022"); /* c */ x15 = f(y, "023"); /* c */ x15 = f(y, "024"); /* c */ x15 = f(y, "025"); /* c */ x15 = f(y, "026"); /* c */ x15 = f(y, "027"); /* c */ x15 = f(y, "028"); /* c */ x15 = f(y, "029"); /* c */ x15 = f(y, "030"); /* c */ x15 = f(y, "031"); /* c */ x15 = f(y, "032"); /* c */ x15 = f(y, "033"); /* c */ x15 = f(y, "034"); /* c */ x15 = f(y, "035"); /* c */ x15 = f(y, "036"); /* c */ x15 = f(y, "037"); /* c */ x15 = f(y, "038"); /* c */ x15 = f(y, "039"); /* c */ x15 = f(y, "040"); /* c */ x15 = f(y, "041"); /* c */ x15 = f(y, "042"); /* c */ x15 = f(y, "043"); /* c */ x15 = f(y, "044"); /* c */ x15 = f(y, "045"); /* c */ x15 = f(y, "046"); /* c */ x15 = f(y, "047"); /* c */ x15 = f(y, "048"); /* c */ x15 = f(y, "049"); /* c */ x15 = f(y, "050"); /* c */ x15 = f(y, "051"); /* c */ x15 = f(y, "052"); /* c */ x15 = f(y, "053"); /* c */ x15 = f(y, "054"); /* c */ x15 = f(y, "055"); /* c */ x15 = f(y, "056"); /* c */ x15 = f(y, "057"); /* c */ x15 = f(y, "058"); /* c */ x15 = f(y, "059"); /* c */ x15 = f(y, "060"); /* c */ x15 = f(y, "061"); /* c */ x15 = f(y, "062"); /* c */ x15 = f(y, "063"); /* c */ x15 = f(y, "064"); /* c */ x15 = f(y, "065"); /* c */ x15 = f(y, "066"); /* c */ x15 = f(y, "067"); /* c */ x15 = f(y, "068"); /* c */ x15 = f(y, "069"); /* c */ x15 = f(y, "070"); /* c */ x15 = f(y, "071"); /* c */ x15 = f(y, "072"); /* c */ x15 = f(y, "073"); /* c */ x15 = f(y, "074"); /* c */ x15 = f(y, "075"); /* c */ x15 = f(y, "076"); /* c */ x15 = f(y, "077"); /* c */ x15 = f(y, "078"); /* c */ x15 = f(y, "079"); /* c */ x15 = f(y, "080"); /* c */ x15 = f(y, "081"); /* c */ x15 = f(y, "082"); /* c */ x15 = f(y, "083"); /* c */ x15 = f(y, "084"); /* c */ x15 = f(y, "085"); /* c */ x15 = f(y, "086"); /* c */ x15 = f(y, "087"); /* c */ x15 = f(y, "088"); /* c */ x15 = f(y, "089"); /* c */ x15 = f(y, "090"); /* c */ x15 = f(y, "091"); /* c */ x15 = f(y, "092"); /* c */ x15 = f(y, "093"); /* c */ x15 = f(y, "094"); /* c */ x15 = f(y, "095"); /* c */ x15 = f(y, "096"); /* c */ x15 = f(y, "097"); /* c */ x15 = f(y, "098"); /* c */ x15 = f(y, "099"); /* c */ x15 = f(y, "100"); /* c */ x15 = f(y, "101"); /* c */ x15 = f(y, "102"); /* c */ x15 = f(y, "103"); /* c */ x15 = f(y, "104"); /* c */ x15 = f(y, "105"); /* c */ x15 = f(y, "106"); /* c */ x15 = f(y, "107"); /* c */ x15 = f(y, "108"); /* c */ x15 = f(y, "109"); /* c */ x15 = f(y, "110"); /* c */ x15 = f(y, "111"); /* c */ x15 = f(y, "112"); /* c */ x15 = f(y, "113"); /* c */ x15 = f(y, "114"); /* c */ x15 = f(y, "115"); /* c */ x15 = f(y, "116"); /* c */ x15 = f(y, "117"); /* c */ x15 = f(y, "118"); /* c */ x15 = f(y, "119"); /* c */ x15 = f(y, "120"); /* c */ x15 = f(y, "121"); /* c */ x15 = f(y, "122"); /* c */ x15 = f(y, "123"); /* c */ x15 = f(y, "124"); /* c */ x15 = f(y, "125"); /* c */ x15 = f(y, "126"); /* c */ x15 = f(y, "127"); /* c */ x15 = f(y, "128"); /* c */ x15 = f(y, "129"); /* c */ x15 = f(y, "130"); /* c */ x15 = f(y, "131"); /* c */ x15 = f(y, "132"); /* c */ x15 = f(y, "133"); /* c */ x15 = f(y, "134"); /* c */ x15 = f(y, "135"); /* c */ x15 = f(y, "136"); /* c */ x15 = f(y, "137"); /* c */ x15 = f(y, "138"); /* c */ x15 = f(y, "139"); /* c */ x15 = f(y, "140"); /* c */ x15 = f(y, "141"); /* c */ x15 = f(y, "142"); /* c */ x15 = f(y, "143"); /* c */ x15 = f(y, "144"); /* c */ x15 = f(y, "145"); /* c */ x15 = f(y, "146"); /* c */ x15 = f(y, "147"); /* c */ x15 = f(y, "148"); /* c */ x15 = f(y, "149"); /* c */ x15 = f(y, "150"); /* c */ x15 = f(y, "151"); /* c */ x15 = f(y, "152"); /* c */ x15 = f(y, "153"); /* c */ x15 = f(y, "154"); /* c */ x15 = f(y, "155"); /* c */ x15 = f(y, "156"); /* c */ x15 = f(y, "157"); /* c */ x15 = f(y, "158"); /* c */ x15 = f(y, "159"); /* c */ x15 = f(y, "160"); /* c */ x15 = f(y, "161"); /* c */ x15 = f(y, "162"); /* c */ x15 = f(y, "163"); /* c */ x15 = f(y, "164"); /* c */ x15 = f(y, "165"); /* c */ x15 = f(y, "166"); /* c */ x15 = f(y, "167"); /* c */ x15 = f(y, "168"); /* c */ x15 = f(y, "169"); /* c */ x15 = f(y, "170"); /* c */ x15 = f(y, "171"); /* c */ x15 = f(y, "172"); /* c */ x15 = f(y, "173"); /* c */ x15 = f(y, "174"); /* c */ x15 = f(y, "175"); /* c */ x15 = f(y, "176"); /* c */ x15 = f(y, "177"); /* c */ x15 = f(y, "178"); /* c */ x15 = f(y, "179"); /* c */ x15 = f(y, "180"); /* c */ x15 = f(y, "181"); /* c */ x15 = f(y, "182"); /* c */ x15 = f(y, "183"); /* c */ x15 = f(y, "184"); /* c */ x15 = f(y, "185"); /* c */ x15 = f(y, "186"); /* c */ x15 = f(y, "187"); /* c */ x15 = f(y, "188"); /* c */ x15 = f(y, "189"); /* c */ x15 = f(y, "190"); /* c */ x15 = f(y, "191"); /* c */ x15 = f(y, "192"); /* c */ x15 = f(y, "193"); /* c */ x15 = f(y, "194"); /* c */ x15 = f(y, "195"); /* c */ x15 = f(y, "196"); /* c */ x15 = f(y, "197"); /* c */ x15 = f(y, "198"); /* c */ x15 = f(y, "199"); /* c */ 
+x16 = f(y, "000"); /* c */ x16 = f(y, "001"); /* c */ x16 = f(y, "002"); /* c */ x16 = f(y, "003"); /* c */ x16 = f(y, "004"); /* c */ x16 = f(y, "005"); /* c */ x16 = f(y, "006"); /* c */ x16 = f(y, "007"); /* c */ x16 = f(y, "008"); /* c */ x16 = f(y, "009"); /* c */ x16 = f(y, "010"); /* c */ x16 = f(y, "011"); /* c */ x16 = f(y, "012"); /* c */ x16 = f(y, "013"); /* c */ x16 = f(y, "014"); /* c */ x16 = f(y, "015"); /* c */ x16 = f(y, "016"); /* c */ x16 = f(y, "017"); /* c */ x16 = f(y, "018"); /* c */ x16 = f(y, "019"); /* c */ x16 = f(y, "020"); /* c */ x16 = f(y, "021"); /* c */ x16 = f(y, "022"); /* c */ x16 = f(y, "023"); /* c */ x16 = f(y, "024"); /* c */ x16 = f(y, "025"); /* c */ x16 = f(y, "026"); /* c */ x16 = f(y, "027"); /* c */ x16 = f(y, "028"); /* c */ x16 = f(y, "029"); /* c */ x16 = f(y, "030"); /* c */ x16 = f(y, "031"); /* c */ x16 = f(y, "032"); /* c */ x16 = f(y, "033"); /* c */ x16 = f(y, "034"); /* c */ x16 = f(y, "035"); /* c */ x16 = f(y, "036"); /* c */ x16 = f(y, "037"); /* c */ x16 = f(y, "038"); /* c */ x16 = f(y, "039"); /* c */ x16 = f(y, "040"); /* c */ x16 = f(y, "041"); /* c */ x16 = f(y, "042"); /* c */ x16 = f(y, "043"); /* c */ x16 = f(y, "044"); /* c */ x16 = f(y, "045"); /* c */ x16 = f(y, "046"); /* c */ x16 = f(y, "047"); /* c */ x16 = f(y, "048"); /* c */ x16 = f(y, "049"); /* c */ x16 = f(y, "050"); /* c */ x16 = f(y, "051"); /* c */ x16 = f(y, "052"); /* c */ x16 = f(y, "053"); /* c */ x16 = f(y, "054"); /* c */ x16 = f(y, "055"); /* c */ x16 = f(y, "056"); /* c */ x16 = f(y, "057"); /* c */ x16 = f(y, "058"); /* c */ x16 = f(y, "059"); /* c */ x16 = f(y, "060"); /* c */ x16 = f(y, "061"); /* c */ x16 = f(y, "062"); /* c */ x16 = f(y, "063"); /* c */ x16 = f(y, "064"); /* c */ x16 = f(y, "065"); /* c */ x16 = f(y, "066"); /* c */ x16 = f(y, "067"); /* c */ x16 = f(y, "068"); /* c */ x16 = f(y, "069"); /* c */ x16 = f(y, "070"); /* c */ x16 = f(y, "071"); /* c */ x16 = f(y, "072"); /* c */ x16 = f(y, "073"); /* c */ x16 = f(y, "074"); /* c */ x16 = f(y, "075"); /* c */ x16 = f(y, "076"); /* c */ x16 = f(y, "077"); /* c */ x16 = f(y, "078"); /* c */ x16 = f(y, "079"); /* c */ x16 = f(y, "080"); /* c */ x16 = f(y, "081"); /* c */ x16 = f(y, "082"); /* c */ x16 = f(y, "083"); /* c */ x16 = f(y, "084"); /* c */ x16 = f(y, "085"); /* c */ x16 = f(y, "086"); /* c */ x16 = f(y, "087"); /* c */ x16 = f(y, "088"); /* c */ x16 = f(y, "089"); /* c */ x16 = f(y, "090"); /* c */ x16 = f(y, "091"); /* c */ x16 = f(y, "092"); /* c */ x16 = f(y, "093"); /* c */ x16 = f(y, "094"); /* c */ x16 = f(y, "095"); /* c */ x16 = f(y, "096"); /* c */ x16 = f(y, "097"); /* c */ x16 = f(y, "098"); /* c */ x16 = f(y, "099"); /* c */ x16 = f(y, "100"); /* c */ x16 = f(y, "101"); /* c */ x16 = f(y, "102"); /* c */ x16 = f(y, "103"); /* c */ x16 = f(y, "104"); /* c */ x16 = f(y, "105"); /* c */ x16 = f(y, "106"); /* c */ x16 = f(y, "107"); /* c */ x16 = f(y, "108"); /* c */ x16 = f(y, "109"); /* c */ x16 = f(y, "110"); /* c */ x16 = f(y, "111"); /* c */ x16 = f(y, "112"); /* c */ x16 = f(y, "113"); /* c */ x16 = f(y, "114"); /* c */ x16 = f(y, "115"); /* c */ x16 = f(y, "116"); /* c */ x16 = f(y, "117"); /* c */ x16 = f(y, "118"); /* c */ x16 = f(y, "119"); /* c */ x16 = f(y, "120"); /* c */ x16 = f(y, "121"); /* c */ x16 = f(y, "122"); /* c */ x16 = f(y, "123"); /* c */ x16 = f(y, "124"); /* c */ x16 = f(y, "125"); /* c */ x16 = f(y, "126"); /* c */ x16 = f(y, "127"); /* c */ x16 = f(y, "128"); /* c */ x16 = f(y, "129"); /* c */ x16 = f(y, "130"); /* c */ x16 = f(y, "131"); /* c */ x16 = f(y, "132"); /* c */ x16 = f(y, "133"); /* c */ x16 = f(y, "134"); /* c */ x16 = f(y, "135"); /* c */ x16 = f(y, "136"); /* c */ x16 = f(y, "137"); /* c */ x16 = f(y, "138"); /* c */ x16 = f(y, "139"); /* c */ x16 = f(y, "140"); /* c */ x16 = f(y, "141"); /* c */ x16 = f(y, "142"); /* c */ x16 = f(y, "143"); /* c */ x16 = f(y, "144"); /* c */ x16 = f(y, "145"); /* c */ x16 = f(y, "146"); /* c */ x16 = f(y, "147"); /* c */ x16 = f(y, "148"); /* c */ x16 = f(y, "149"); /* c */ x16 = f(y, "150"); /* c */ x16 = f(y, "151"); /* c */ x16 = f(y, "152"); /* c */ x16 = f(y, "153"); /* c */ x16 = f(y, "154"); /* c */ x16 = f(y, "155"); /* c */ x16 = f(y, "156"); /* c */ x16 = f(y, "157"); /* c */ x16 = f(y, "158"); /* c */ x16 = f(y, "159"); /* c */ x16 = f(y, "160"); /* c */ x16 = f(y, "161"); /* c */ x16 = f(y, "162"); /* c */ x16 = f(y, "163"); /* c */ x16 = f(y, "164"); /* c */ x16 = f(y, "165"); /* c */ x16 = f(y, "166"); /* c */ x16 = f(y, "167"); /* c */ x16 = f(y, "168"); /* c */ x16 = f(y, "169"); /* c */ x16 = f(y, "170"); /* c */ x16 = f(y, "171"); /* c */ x16 = f(y, "172"); /* c */ x16 = f(y, "173"); /* c */ x16 = f(y, "174"); /* c */ x16 = f(y, "175"); /* c */ x16 = f(y, "176"); /* c */ x16 = f(y, "177"); /* c */ x16 = f(y, "178"); /* c */ x16 = f(y, "179"); /* c */ x16 = f(y, "180"); /* c */ x16 = f(y, "181"); /* c */ x16 = f(y, "182"); /* c */ x16 = f(y, "183"); /* c */ x16 = f(y, "184"); /* c */ x16 = f(y, "185"); /* c */ x16 = f(y, "186"); /* c */ x16 = f(y, "187"); /* c */ x16 = f(y, "188"); /* c */ x16 = f(y, "189"); /* c */ x16 = f(y, "190"); /* c */ x16 = f(y, "191"); /* c */ x16 = f(y, "192"); /* c */ x16 = f(y, "193"); /* c */ x16 = f(y, "194"); /* c */ x16 = f(y, "195"); /* c */ x16 = f(y, "196"); /* c */ x16 = f(y, "197"); /* c */ x16 = f(y, "198"); /* c */ x16 = f(y, "199"); /* c */ 
+x17 = f(y, "000"); /* c */ x17 = f(y, "001"); /* c */ x17 = f(y, "002"); /* c */ x17 = f(y, "003"); /* c */ x17 = f(y, "004"); /* c */ x17 = f(y, "005"); /* c */ x17 = f(y, "006"); /* c */ x17 = f(y, "007"); /* c */ x17 = f(y, "008"); /* c */ x17 = f(y, "009"); /* c */ x17 = f(y, "010"); /* c */ x17 = f(y, "011"); /* c */ x17 = f(y, "012"); /* c */ x17 = f(y, "013"); /* c */ x17 = f(y, "014"); /* c */ x17 = f(y, "015"); /* c */ x17 = f(y, "016"); /* c */ x17 = f(y, "017"); /* c */ x17 = f(y, "018"); /* c */ x17 = f(y, "019"); /* c */ x17 = f(y, "020"); /* c */ x17 = f(y, "021"); /* c */ x17 = f(y, "022"); /* c */ x17 = f(y, "023"); /* c */ x17 = f(y, "024"); /* c */ x17 = f(y, "025"); /* c */ x17 = f(y, "026"); /* c */ x17 = f(y, "027"); /* c */ x17 = f(y, "028"); /* c */ x17 = f(y, "029"); /* c */ x17 = f(y, "030"); /* c */ x17 = f(y, "031"); /* c */ x17 = f(y, "032"); /* c */ x17 = f(y, "033"); /* c */ x17 = f(y, "034"); /* c */ x17 = f(y, "035"); /* c */ x17 = f(y, "036"); /* c */ x17 = f(y, "037"); /* c */ x17 = f(y, "038"); /* c */ x17 = f(y, "039"); /* c */ x17 = f(y, "040"); /* c */ x17 = f(y, "041"); /* c */ x17 = f(y, "042"); /* c */ x17 = f(y, "043"); /* c */ x17 = f(y, "044"); /* c */ x17 = f(y, "045"); /* c */ x17 = f(y, "046"); /* c */ x17 = f(y, "047"); /* c */ x17 = f(y, "048"); /* c */ x17 = f(y, "049"); /* c */ x17 = f(y, "050"); /* c */ x17 = f(y, "051"); /* c */ x17 = f(y, "052"); /* c */ x17 = f(y, "053"); /* c */ x17 = f(y, "054"); /* c */ x17 = f(y, "055"); /* c */ x17 = f(y, "056"); /* c */ x17 = f(y, "057"); /* c */ x17 = f(y, "058"); /* c */ x17 = f(y, "059"); /* c */ x17 = f(y, "060"); /* c */ x17 = f(y, "061"); /* c */ x17 = f(y, "062"); /* c */ x17 = f(y, "063"); /* c */ x17 = f(y, "064"); /* c */ x17 = f(y, "065"); /* c */ x17 = f(y, "066"); /* c */ x17 = f(y, "067"); /* c */ x17 = f(y, "068"); /* c */ x17 = f(y, "069"); /* c */ x17 = f(y, "070"); /* c */ x17 = f(y, "071"); /* c */ x17 = f(y, "072"); /* c */ x17 = f(y, "073"); /* c */ x17 = f(y, "074"); /* c */ x17 = f(y, "075"); /* c */ x17 = f(y, "076"); /* c */ x17 = f(y, "077"); /* c */ x17 = f(y, "078"); /* c */ x17 = f(y, "079"); /* c */ x17 = f(y, "080"); /* c */ x17 = f(y, "081"); /* c */ x17 = f(y, "082"); /* c */ x17 = f(y, "083"); /* c */ x17 = f(y, "084"); /* c */ x17 = f(y, "085"); /* c */ x17 = f(y, "086"); /* c */ x17 = f(y, "087"); /* c */ x17 = f(y, "088"); /* c */ x17 = f(y, "089"); /* c */ x17 = f(y, "090"); /* c */ x17 = f(y, "091"); /* c */ x17 = f(y, "092"); /* c */ x17 = f(y, "093"); /* c */ x17 = f(y, "094"); /* c */ x17 = f(y, "095"); /* c */ x17 = f(y, "096"); /* c */ x17 = f(y, "097"); /* c */ x17 = f(y, "098"); /* c */ x17 = f(y, "099"); /* c */ x17 = f(y, "100"); /* c */ x17 = f(y, "101"); /* c */ x17 = f(y, "102"); /* c */ x17 = f(y, "103"); /* c */ x17 = f(y, "104"); /* c */ x17 = f(y, "105"); /* c */ x17 = f(y, "106"); /* c */ x17 = f(y, "107"); /* c */ x17 = f(y, "108"); /* c */ x17 = f(y, "109"); /* c */ x17 = f(y, "110"); /* c */ x17 = f(y, "111"); /* c */ x17 = f(y, "112"); /* c */ x17 = f(y, "113"); /* c */ x17 = f(y, "114"); /* c */ x17 = f(y, "115"); /* c */ x17 = f(y, "116"); /* c */ x17 = f(y, "117"); /* c */ x17 = f(y, "118"); /* c */ x17 = f(y, "119"); /* c */ x17 = f(y, "120"); /* c */ x17 = f(y, "121"); /* c */ x17 = f(y, "122"); /* c */ x17 = f(y, "123"); /* c */ x17 = f(y, "124"); /* c */ x17 = f(y, "125"); /* c */ x17 = f(y, "126"); /* c */ x17 = f(y, "127"); /* c */ x17 = f(y, "128"); /* c */ x17 = f(y, "129"); /* c */ x17 = f(y, "130"); /* c */ x17 = f(y, "131"); /* c */ x17 = f(y, "132"); /* c */ x17 = f(y, "133"); /* c */ x17 = f(y, "134"); /* c */ x17 = f(y, "135"); /* c */ x17 = f(y, "136"); /* c */ x17 = f(y, "137"); /* c */ x17 = f(y, "138"); /* c */ x17 = f(y, "139"); /* c */ x17 = f(y, "140"); /* c */ x17 = f(y, "141"); /* c */ x17 = f(y, "142"); /* c */ x17 = f(y, "143"); /* c */ x17 = f(y, "144"); /* c */ x17 = f(y, "145"); /* c */ x17 = f(y, "146"); /* c */ x17 = f(y, "147"); /* c */ x17 = f(y, "148"); /* c */ x17 = f(y, "149"); /* c */ x17 = f(y, "150"); /* c */ x17 = f(y, "151"); /* c */ x17 = f(y, "152"); /* c */ x17 = f(y, "153"); /* c */ x17 = f(y, "154"); /* c */ x17 = f(y, "155"); /* c */ x17 = f(y, "156"); /* c */ x17 = f(y, "157"); /* c */ x17 = f(y, "158"); /* c */ x17 = f(y, "159"); /* c */ x17 = f(y, "160"); /* c */ x17 = f(y, "161"); /* c */ x17 = f(y, "162"); /* c */ x17 = f(y, "163"); /* c */ x17 = f(y, "164"); /* c */ x17 = f(y, "165"); /* c */ x17 = f(y, "166"); /* c */ x17 = f(y, "167"); /* c */ x17 = f(y, "168"); /* c */ x17 = f(y, "169"); /* c */ x17 = f(y, "170"); /* c */ x17 = f(y, "171"); /* c */ x17 = f(y, "172"); /* c */ x17 = f(y, "173"); /* c */ x17 = f(y, "174"); /* c */ x17 = f(y, "175"); /* c */ x17 = f(y, "176"); /* c */ x17 = f(y, "177"); /* c */ x17 = f(y, "178"); /* c */ x17 = f(y, "179"); /* c */ x17 = f(y, "180"); /* c */ x17 = f(y, "181"); /* c */ x17 = f(y, "182"); /* c */ x17 = f(y, "183"); /* c */ x17 = f(y, "184"); /* c */ x17 = f(y, "185"); /* c */ x17 = f(y, "186"); /* c */ x17 = f(y, "187"); /* c */ x17 = f(y, "188"); /* c */ x17 = f(y, "189"); /* c */ x17 = f(y, "190"); /* c */ x17 = f(y, "191"); /* c */ x17 = f(y, "192"); /* c */ x17 = f(y, "193"); /* c */ x17 = f(y, "194"); /* c */ x17 = f(y, "195"); /* c */ x17 = f(y, "196"); /* c */ x17 = f(y, "197"); /* c */ x17 = f(y, "198"); /* c */ x17 = f(y, "199"); /* c */ 
+x18 = f(y, "000"); /* c */ x18 = f(y, "001"); /* c */ x18 = f(y, "002"); /* c */ x18 = f(y, "003"); /* c */ x18 = f(y, "004"); /* c */ x18 = f(y, "005"); /* c */ x18 = f(y, "006"); /* c */ x18 = f(y, "007"); /* c */ x18 = f(y, "008"); /* c */ x18 = f(y, "009"); /* c */ x18 = f(y, "010"); /* c */ x18 = f(y, "011"); /* c */ x18 = f(y, "012"); /* c */ x18 = f(y, "013"); /* c */ x18 = f(y, "014"); /* c */ x18 = f(y, "015"); /* c */ x18 = f(y, "016"); /* c */ x18 = f(y, "017"); /* c */ x18 = f(y, "018"); /* c */ x18 = f(y, "019"); /* c */ x18 = f(y, "020"); /* c */ x18 = f(y, "021"); /* c */ x18 = f(y, "022"); /* c */ x18 = f(y, "023"); /* c */ x18 = f(y, "024"); /* c */ x18 = f(y, "025"); /* c */ x18 = f(y, "026"); /* c */ x18 = f(y, "027"); /* c */ x18 = f(y, "028"); /* c */ x18 = f(y, "029"); /* c */ x18 = f(y, "030"); /* c */ x18 = f(y, "031"); /* c */ x18 = f(y, "032"); /* c */ x18 = f(y, "033"); /* c */ x18 = f(y, "034"); /* c */ x18 = f(y, "035"); /* c */ x18 = f(y, "036"); /* c */ x18 = f(y, "037"); /* c */ x18 = f(y, "038"); /* c */ x18 = f(y, "039"); /* c */ x18 = f(y, "040"); /* c */ x18 = f(y, "041"); /* c */ x18 = f(y, "042"); /* c */ x18 = f(y, "043"); /* c */ x18 = f(y, "044"); /* c */ x18 = f(y, "045"); /* c */ x18 = f(y, "046"); /* c */ x18 = f(y, "047"); /* c */ x18 = f(y, "048"); /* c */ x18 = f(y, "049"); /* c */ x18 = f(y, "050"); /* c */ x18 = f(y, "051"); /* c */ x18 = f(y, "052"); /* c */ x18 = f(y, "053"); /* c */ x18 = f(y, "054"); /* c */ x18 = f(y, "055"); /* c */ x18 = f(y, "056"); /* c */ x18 = f(y, "057"); /* c */ x18 = f(y, "058"); /* c */ x18 = f(y, "059"); /* c */ x18 = f(y, "060"); /* c */ x18 = f(y, "061"); /* c */ x18 = f(y, "062"); /* c */ x18 = f(y, "063"); /* c */ x18 = f(y, "064"); /* c */ x18 = f(y, "065"); /* c */ x18 = f(y, "066"); /* c */ x18 = f(y, "067"); /* c */ x18 = f(y, "068"); /* c */ x18 = f(y, "069"); /* c */ x18 = f(y, "070"); /* c */ x18 = f(y, "071"); /* c */ x18 = f(y, "072"); /* c */ x18 = f(y, "073"); /* c */ x18 = f(y, "074"); /* c */ x18 = f(y, "075"); /* c */ x18 = f(y, "076"); /* c */ x18 = f(y, "077"); /* c */ x18 = f(y, "078"); /* c */ x18 = f(y, "079"); /* c */ x18 = f(y, "080"); /* c */ x18 = f(y, "081"); /* c */ x18 = f(y, "082"); /* c */ x18 = f(y, "083"); /* c */ x18 = f(y, "084"); /* c */ x18 = f(y, "085"); /* c */ x18 = f(y, "086"); /* c */ x18 = f(y, "087"); /* c */ x18 = f(y, "088"); /* c */ x18 = f(y, "089"); /* c */ x18 = f(y, "090"); /* c */ x18 = f(y, "091"); /* c */ x18 = f(y, "092"); /* c */ x18 = f(y, "093"); /* c */ x18 = f(y, "094"); /* c */ x18 = f(y, "095"); /* c */ x18 = f(y, "096"); /* c */ x18 = f(y, "097"); /* c */ x18 = f(y, "098"); /* c */ x18 = f(y, "099"); /* c */ x18 = f(y, "100"); /* c */ x18 = f(y, "101"); /* c */ x18 = f(y, "102"); /* c */ x18 = f(y, "103"); /* c */ x18 = f(y, "104"); /* c */ x18 = f(y, "105"); /* c */ x18 = f(y, "106"); /* c */ x18 = f(y, "107"); /* c */ x18 = f(y, "108"); /* c */ x18 = f(y, "109"); /* c */ x18 = f(y, "110"); /* c */ x18 = f(y, "111"); /* c */ x18 = f(y, "112"); /* c */ x18 = f(y, "113"); /* c */ x18 = f(y, "114"); /* c */ x18 = f(y, "115"); /* c */ x18 = f(y, "116"); /* c */ x18 = f(y, "117"); /* c */ x18 = f(y, "118"); /* c */ x18 = f(y, "119"); /* c */ x18 = f(y, "120"); /* c */ x18 = f(y, "121"); /* c */ x18 = f(y, "122"); /* c */ x18 = f(y, "123"); /* c */ x18 = f(y, "124"); /* c */ x18 = f(y, "125"); /* c */ x18 = f(y, "126"); /* c */ x18 = f(y, "127"); /* c */ x18 = f(y, "128"); /* c */ x18 = f(y, "129"); /* c */ x18 = f(y, "130"); /* c */ x18 = f(y, "131"); /* c */ x18 = f(y, "132"); /* c */ x18 = f(y, "133"); /* c */ x18 = f(y, "134"); /* c */ x18 = f(y, "135"); /* c */ x18 = f(y, "136"); /* c */ x18 = f(y, "137"); /* c */ x18 = f(y, "138"); /* c */ x18 = f(y, "139"); /* c */ x18 = f(y, "140"); /* c */ x18 = f(y, "141"); /* c */ x18 = f(y, "142"); /* c */ x18 = f(y, "143"); /* c */ x18 = f(y, "144"); /* c */ x18 = f(y, "145"); /* c */ x18 = f(y, "146"); /* c */ x18 = f(y, "147"); /* c */ x18 = f(y, "148"); /* c */ x18 = f(y, "149"); /* c */ x18 = f(y, "150"); /* c */ x18 = f(y, "151"); /* c */ x18 = f(y, "152"); /* c */ x18 = f(y, "153"); /* c */ x18 = f(y, "154"); /* c */ x18 = f(y, "155"); /* c */ x18 = f(y, "156"); /* c */ x18 = f(y, "157"); /* c */ x18 = f(y, "158"); /* c */ x18 = f(y, "159"); /* c */ x18 = f(y, "160"); /* c */ x18 = f(y, "161"); /* c */ x18 = f(y, "162"); /* c */ x18 = f(y, "163"); /* c */ x18 = f(y, "164"); /* c */ x18 = f(y, "165"); /* c */ x18 = f(y, "166"); /* c */ x18 = f(y, "167"); /* c */ x18 = f(y, "168"); /* c */ x18 = f(y, "169"); /* c */ x18 = f(y, "170"); /* c */ x18 = f(y, "171"); /* c */ x18 = f(y, "172"); /* c */ x18 = f(y, "173"); /* c */ x18 = f(y, "174"); /* c */ x18 = f(y, "175"); /* c */ x18 = f(y, "176"); /* c */ x18 = f(y, "177"); /* c */ x18 = f(y, "178"); /* c */ x18 = f(y, "179"); /* c */ x18 = f(y, "180"); /* c */ x18 = f(y, "181"); /* c */ x18 = f(y, "182"); /* c */ x18 = f(y, "183"); /* c */ x18 = f(y, "184"); /* c */ x18 = f(y, "185"); /* c */ x18 = f(y, "186"); /* c */ x18 = f(y, "187"); /* c */ x18 = f(y, "188"); /* c */ x18 = f(y, "189"); /* c */ x18 = f(y, "190"); /* c */ x18 = f(y, "191"); /* c */ x18 = f(y, "192"); /* c */ x18 = f(y, "193"); /* c */ x18 = f(y, "194"); /* c */ x18 = f(y, "195"); /* c */ x18 = f(y, "196"); /* c */ x18 = f(y, "197"); /* c */ x18 = f(y, "198"); /* c */ x18 = f(y, "199"); /* c */ 
+x19 = f(y, "000"); /* c */ x19 = f(y, "001"); /* c */ x19 = f(y, "002"); /* c */ x19 = f(y, "003"); /* c */ x19 = f(y, "004"); /* c */ x19 = f(y, "005"); /* c */ x19 = f(y, "006"); /* c */ x19 = f(y, "007"); /* c */ x19 = f(y, "008"); /* c */ x19 = f(y, "009"); /* c */ x19 = f(y, "010"); /* c */ x19 = f(y, "011"); /* c */ x19 = f(y, "012"); /* c */ x19 = f(y, "013"); /* c */ x19 = f(y, "014"); /* c */ x19 = f(y, "015"); /* c */ x19 = f(y, "016"); /* c */ x19 = f(y, "017"); /* c */ x19 = f(y, "018"); /* c */ x19 = f(y, "019"); /* c */ x19 = f(y, "020"); /* c */ x19 = f(y, "021"); /* c */ x19 = f(y, "022"); /* c */ x19 = f(y, "023"); /* c */ x19 = f(y, "024"); /* c */ x19 = f(y, "025"); /* c */ x19 = f(y, "026"); /* c */ x19 = f(y, "027"); /* c */ x19 = f(y, "028"); /* c */ x19 = f(y, "029"); /* c */ x19 = f(y, "030"); /* c */ x19 = f(y, "031"); /* c */ x19 = f(y, "032"); /* c */ x19 = f(y, "033"); /* c */ x19 = f(y, "034"); /* c */ x19 = f(y, "035"); /* c */ x19 = f(y, "036"); /* c */ x19 = f(y, "037"); /* c */ x19 = f(y, "038"); /* c */ x19 = f(y, "039"); /* c */ x19 = f(y, "040"); /* c */ x19 = f(y, "041"); /* c */ x19 = f(y, "042"); /* c */ x19 = f(y, "043"); /* c */ x19 = f(y, "044"); /* c */ x19 = f(y, "045"); /* c */ x19 = f(y, "046"); /* c */ x19 = f(y, "047"); /* c */ x19 = f(y, "048"); /* c */ x19 = f(y, "049"); /* c */ x19 = f(y, "050"); /* c */ x19 = f(y, "051"); /* c */ x19 = f(y, "052"); /* c */ x19 = f(y, "053"); /* c */ x19 = f(y, "054"); /* c */ x19 = f(y, "055"); /* c */ x19 = f(y, "056"); /* c */ x19 = f(y, "057"); /* c */ x19 = f(y, "058"); /* c */ x19 = f(y, "059"); /* c */ x19 = f(y, "060"); /* c */ x19 = f(y, "061"); /* c */ x19 = f(y, "062"); /* c */ x19 = f(y, "063"); /* c */ x19 = f(y, "064"); /* c */ x19 = f(y, "065"); /* c */ x19 = f(y, "066"); /* c */ x19 = f(y, "067"); /* c */ x19 = f(y, "068"); /* c */ x19 = f(y, "069"); /* c */ x19 = f(y, "070"); /* c */ x19 = f(y, "071"); /* c */ x19 = f(y, "072"); /* c */ x19 = f(y, "073"); /* c */ x19 = f(y, "074"); /* c */ x19 = f(y, "075"); /* c */ x19 = f(y, "076"); /* c */ x19 = f(y, "077"); /* c */ x19 = f(y, "078"); /* c */ x19 = f(y, "079"); /* c */ x19 = f(y, "080"); /* c */ x19 = f(y, "081"); /* c */ x19 = f(y, "082"); /* c */ x19 = f(y, "083"); /* c */ x19 = f(y, "084"); /* c */ x19 = f(y, "085"); /* c */ x19 = f(y, "086"); /* c */ x19 = f(y, "087"); /* c */ x19 = f(y, "088"); /* c */ x19 = f(y, "089"); /* c */ x19 = f(y, "090"); /* c */ x19 = f(y, "091"); /* c */ x19 = f(y, "092"); /* c */ x19 = f(y, "093"); /* c */ x19 = f(y, "094"); /* c */ x19 = f(y, "095"); /* c */ x19 = f(y, "096"); /* c */ x19 = f(y, "097"); /* c */ x19 = f(y, "098"); /* c */ x19 = f(y, "099"); /* c */ x19 = f(y, "100"); /* c */ x19 = f(y, "101"); /* c */ x19 = f(y, "102"); /* c */ x19 = f(y, "103"); /* c */ x19 = f(y, "104"); /* c */ x19 = f(y, "105"); /* c */ x19 = f(y, "106"); /* c */ x19 = f(y, "107"); /* c */ x19 = f(y, "108"); /* c */ x19 = f(y, "109"); /* c */ x19 = f(y, "110"); /* c */ x19 = f(y, "111"); /* c */ x19 = f(y, "112"); /* c */ x19 = f(y, "113"); /* c */ x19 = f(y, "114"); /* c */ x19 = f(y, "115"); /* c */ x19 = f(y, "116"); /* c */ x19 = f(y, "117"); /* c */ x19 = f(y, "118"); /* c */ x19 = f(y, "119"); /* c */ x19 = f(y, "120"); /* c */ x19 = f(y, "121"); /* c */ x19 = f(y, "122"); /* c */ x19 = f(y, "123"); /* c */ x19 = f(y, "124"); /* c */ x19 = f(y, "125"); /* c */ x19 = f(y, "126"); /* c */ x19 = f(y, "127"); /* c */ x19 = f(y, "128"); /* c */ x19 = f(y, "129"); /* c */ x19 = f(y, "130"); /* c */ x19 = f(y, "131"); /* c */ x19 = f(y, "132"); /* c */ x19 = f(y, "133"); /* c */ x19 = f(y, "134"); /* c */ x19 = f(y, "135"); /* c */ x19 = f(y, "136"); /* c */ x19 = f(y, "137"); /* c */ x19 = f(y, "138"); /* c */ x19 = f(y, "139"); /* c */ x19 = f(y, "140"); /* c */ x19 = f(y, "141"); /* c */ x19 = f(y, "142"); /* c */ x19 = f(y, "143"); /* c */ x19 = f(y, "144"); /* c */ x19 = f(y, "145"); /* c */ x19 = f(y, "146"); /* c */ x19 = f(y, "147"); /* c */ x19 = f(y, "148"); /* c */ x19 = f(y, "149"); /* c */ x19 = f(y, "150"); /* c */ x19 = f(y, "151"); /* c */ x19 = f(y, "152"); /* c */ x19 = f(y, "153"); /* c */ x19 = f(y, "154"); /* c */ x19 = f(y, "155"); /* c */ x19 = f(y, "156"); /* c */ x19 = f(y, "157"); /* c */ x19 = f(y, "158"); /* c */ x19 = f(y, "159"); /* c */ x19 = f(y, "160"); /* c */ x19 = f(y, "161"); /* c */ x19 = f(y, "162"); /* c */ x19 = f(y, "163"); /* c */ x19 = f(y, "164"); /* c */ x19 = f(y, "165"); /* c */ x19 = f(y, "166"); /* c */ x19 = f(y, "167"); /* c */ x19 = f(y, "168"); /* c */ x19 = f(y, "169"); /* c */ x19 = f(y, "170"); /* c */ x19 = f(y, "171"); /* c */ x19 = f(y, "172"); /* c */ x19 = f(y, "173"); /* c */ x19 = f(y, "174"); /* c */ x19 = f(y, "175"); /* c */ x19 = f(y, "176"); /* c */ x19 = f(y, "177"); /* c */ x19 = f(y, "178"); /* c */ x19 = f(y, "179"); /* c */ x19 = f(y, "180"); /* c */ x19 = f(y, "181"); /* c */ x19 = f(y, "182"); /* c */ x19 = f(y, "183"); /* c */ x19 = f(y, "184"); /* c */ x19 = f(y, "185"); /* c */ x19 = f(y, "186"); /* c */ x19 = f(y, "187"); /* c */ x19 = f(y, "188"); /* c */ x19 = f(y, "189"); /* c */ x19 = f(y, "190"); /* c */ x19 = f(y, "191"); /* c */ x19 = f(y, "192"); /* c */ x19 = f(y, "193"); /* c */ x19 = f(y, "194"); /* c */ x19 = f(y, "195"); /* c */ x19 = f(y, "196"); /* c */ x19 = f(y, "197"); /* c */ x19 = f(y, "198"); /* c */ x19 = f(y, "199"); /* c */ 
+x20 = f(y, "000"); /* c */ x20 = f(y, "001"); /* c */ x20 = f(y, "002"); /* c */ x20 = f(y, "003"); /* c */ x20 = f(y, "004"); /* c */ x20 = f(y, "005"); /* c */ x20 = f(y, "006"); /* c */ x20 = f(y, "007"); /* c */ x20 = f(y, "008"); /* c */ x20 = f(y, "009"); /* c */ x20 = f(y, "010"); /* c */ x20 = f(y, "011"); /* c */ x20 = f(y, "012"); /* c */ x20 = f(y, "013"); /* c */ x20 = f(y, "014"); /* c */ x20 = f(y, "015"); /* c */ x20 = f(y, "016"); /* c */ x20 = f(y, "017"); /* c */ x20 = f(y, "018"); /* c */ x20 = f(y, "019"); /* c */ x20 = f(y, "020"); /* c */ x20 = f(y, "021"); /* c */ x20 = f(y, "022"); /* c */ x20 = f(y, "023"); /* c */ x20 = f(y, "024"); /* c */ x20 = f(y, "025"); /* c */ x20 = f(y, "026"); /* c */ x20 = f(y, "027"); /* c */ x20 = f(y, "028"); /* c */ x20 = f(y, "029"); /* c */ x20 = f(y, "030"); /* c */ x20 = f(y, "031"); /* c */ x20 = f(y, "032"); /* c */ x20 = f(y, "033"); /* c */ x20 = f(y, "034"); /* c */ x20 = f(y, "035"); /* c */ x20 = f(y, "036"); /* c */ x20 = f(y, "037"); /* c */ x20 = f(y, "038"); /* c */ x20 = f(y, "039"); /* c */ x20 = f(y, "040"); /* c */ x20 = f(y, "041"); /* c */ x20 = f(y, "042"); /* c */ x20 = f(y, "043"); /* c */ x20 = f(y, "044"); /* c */ x20 = f(y, "045"); /* c */ x20 = f(y, "046"); /* c */ x20 = f(y, "047"); /* c */ x20 = f(y, "048"); /* c */ x20 = f(y, "049"); /* c */ x20 = f(y, "050"); /* c */ x20 = f(y, "051"); /* c */ x20 = f(y, "052"); /* c */ x20 = f(y, "053"); /* c */ x20 = f(y, "054"); /* c */ x20 = f(y, "055"); /* c */ x20 = f(y, "056"); /* c */ x20 = f(y, "057"); /* c */ x20 = f(y, "058"); /* c */ x20 = f(y, "059"); /* c */ x20 = f(y, "060"); /* c */ x20 = f(y, "061"); /* c */ x20 = f(y, "062"); /* c */ x20 = f(y, "063"); /* c */ x20 = f(y, "064"); /* c */ x20 = f(y, "065"); /* c */ x20 = f(y, "066"); /* c */ x20 = f(y, "067"); /* c */ x20 = f(y, "068"); /* c */ x20 = f(y, "069"); /* c */ x20 = f(y, "070"); /* c */ x20 = f(y, "071"); /* c */ x20 = f(y, "072"); /* c */ x20 = f(y, "073"); /* c */ x20 = f(y, "074"); /* c */ x20 = f(y, "075"); /* c */ x20 = f(y, "076"); /* c */ x20 = f(y, "077"); /* c */ x20 = f(y, "078"); /* c */ x20 = f(y, "079"); /* c */ x20 = f(y, "080"); /* c */ x20 = f(y, "081"); /* c */ x20 = f(y, "082"); /* c */ x20 = f(y, "083"); /* c */ x20 = f(y, "084"); /* c */ x20 = f(y, "085"); /* c */ x20 = f(y, "086"); /* c */ x20 = f(y, "087"); /* c */ x20 = f(y, "088"); /* c */ x20 = f(y, "089"); /* c */ x20 = f(y, "090"); /* c */ x20 = f(y, "091"); /* c */ x20 = f(y, "092"); /* c */ x20 = f(y, "093"); /* c */ x20 = f(y, "094"); /* c */ x20 = f(y, "095"); /* c */ x20 = f(y, "096"); /* c */ x20 = f(y, "097"); /* c */ x20 = f(y, "098"); /* c */ x20 = f(y, "099"); /* c */ x20 = f(y, "100"); /* c */ x20 = f(y, "101"); /* c */ x20 = f(y, "102"); /* c */ x20 = f(y, "103"); /* c */ x20 = f(y, "104"); /* c */ x20 = f(y, "105"); /* c */ x20 = f(y, "106"); /* c */ x20 = f(y, "107"); /* c */ x20 = f(y, "108"); /* c */ x20 = f(y, "109"); /* c */ x20 = f(y, "110"); /* c */ x20 = f(y, "111"); /* c */ x20 = f(y, "112"); /* c */ x20 = f(y, "113"); /* c */ x20 = f(y, "114"); /* c */ x20 = f(y, "115"); /* c */ x20 = f(y, "116"); /* c */ x20 = f(y, "117"); /* c */ x20 = f(y, "118"); /* c */ x20 = f(y, "119"); /* c */ x20 = f(y, "120"); /* c */ x20 = f(y, "121"); /* c */ x20 = f(y, "122"); /* c */ x20 = f(y, "123"); /* c */ x20 = f(y, "124"); /* c */ x20 = f(y, "125"); /* c */ x20 = f(y, "126"); /* c */ x20 = f(y, "127"); /* c */ x20 = f(y, "128"); /* c */ x20 = f(y, "129"); /* c */ x20 = f(y, "130"); /* c */ x20 = f(y, "131"); /* c */ x20 = f(y, "132"); /* c */ x20 = f(y, "133"); /* c */ x20 = f(y, "134"); /* c */ x20 = f(y, "135"); /* c */ x20 = f(y, "136"); /* c */ x20 = f(y, "137"); /* c */ x20 = f(y, "138"); /* c */ x20 = f(y, "139"); /* c */ x20 = f(y, "140"); /* c */ x20 = f(y, "141"); /* c */ x20 = f(y, "142"); /* c */ x20 = f(y, "143"); /* c */ x20 = f(y, "144"); /* c */ x20 = f(y, "145"); /* c */ x20 = f(y, "146"); /* c */ x20 = f(y, "147"); /* c */ x20 = f(y, "148"); /* c */ x20 = f(y, "149"); /* c */ x20 = f(y, "150"); /* c */ x20 = f(y, "151"); /* c */ x20 = f(y, "152"); /* c */ x20 = f(y, "153"); /* c */ x20 = f(y, "154"); /* c */ x20 = f(y, "155"); /* c */ x20 = f(y, "156"); /* c */ x20 = f(y, "157"); /* c */ x20 = f(y, "158"); /* c */ x20 = f(y, "159"); /* c */ x20 = f(y, "160"); /* c */ x20 = f(y, "161"); /* c */ x20 = f(y, "162"); /* c */ x20 = f(y, "163"); /* c */ x20 = f(y, "164"); /* c */ x20 = f(y, "165"); /* c */ x20 = f(y, "166"); /* c */ x20 = f(y, "167"); /* c */ x20 = f(y, "168"); /* c */ x20 = f(y, "169"); /* c */ x20 = f(y, "170"); /* c */ x20 = f(y, "171"); /* c */ x20 = f(y, "172"); /* c */ x20 = f(y, "173"); /* c */ x20 = f(y, "174"); /* c */ x20 = f(y, "175"); /* c */ x20 = f(y, "176"); /* c */ x20 = f(y, "177"); /* c */ x20 = f(y, "178"); /* c */ x20 = f(y, "179"); /* c */ x20 = f(y, "180"); /* c */ x20 = f(y, "181"); /* c */ x20 = f(y, "182"); /* c */ x20 = f(y, "183"); /* c */ x20 = f(y, "184"); /* c */ x20 = f(y, "185"); /* c */ x20 = f(y, "186"); /* c */ x20 = f(y, "187"); /* c */ x20 = f(y, "188"); /* c */ x20 = f(y, "189"); /* c */ x20 = f(y, "190"); /* c */ x20 = f(y, "191"); /* c */ x20 = f(y, "192"); /* c */ x20 = f(y, "193"); /* c */ x20 = f(y, "194"); /* c */ x20 = f(y, "195"); /* c */ x20 = f(y, "196"); /* c */ x20 = f(y, "197"); /* c */ x20 = f(y, "198"); /* c */ x20 = f(y, "199"); /* c */ 
+x21 = f(y, "000"); /* c */ x21 = f(y, "001"); /* c */ x21 = f(y, "002"); /* c */ x21 = f(y, "003"); /* c */ x21 = f(y, "004"); /* c */ x21 = f(y, "005"); /* c */ x21 = f(y, "006"); /* c */ x21 = f(y, "007"); /* c */ x21 = f(y, "008"); /* c */ x21 = f(y, "009"); /* c */ x21 = f(y, "010"); /* c */ x21 = f(y, "011"); /* c */ x21 = f(y, "012"); /* c */ x21 = f(y, "013"); /* c */ x21 = f(y, "014"); /* c */ x21 = f(y, "015"); /* c */ x21 = f(y, "016"); /* c */ x21 = f(y, "017"); /* c */ x21 = f(y, "018"); /* c */ x21 = f(y, "019"); /* c */ x21 = f(y, "020"); /* c */ x21 = f(y, "021"); /* c */ x21 = f(y, "022"); /* c */ x21 = f(y, "023"); /* c */ x21 = f(y, "024"); /* c */ x21 = f(y, "025"); /* c */ x21 = f(y, "026"); /* c */ x21 = f(y, "027"); /* c */ x21 = f(y, "028"); /* c */ x21 = f(y, "029"); /* c */ x21 = f(y, "030"); /* c */ x21 = f(y, "031"); /* c */ x21 = f(y, "032"); /* c */ x21 = f(y, "033"); /* c */ x21 = f(y, "034"); /* c */ x21 = f(y, "035"); /* c */ x21 = f(y, "036"); /* c */ x21 = f(y, "037"); /* c */ x21 = f(y, "038"); /* c */ x21 = f(y, "039"); /* c */ x21 = f(y, "040"); /* c */ x21 = f(y, "041"); /* c */ x21 = f(y, "042"); /* c */ x21 = f(y, "043"); /* c */ x21 = f(y, "044"); /* c */ x21 = f(y, "045"); /* c */ x21 = f(y, "046"); /* c */ x21 = f(y, "047"); /* c */ x21 = f(y, "048"); /* c */ x21 = f(y, "049"); /* c */ x21 = f(y, "050"); /* c */ x21 = f(y, "051"); /* c */ x21 = f(y, "052"); /* c */ x21 = f(y, "053"); /* c */ x21 = f(y, "054"); /* c */ x21 = f(y, "055"); /* c */ x21 = f(y, "056"); /* c */ x21 = f(y, "057"); /* c */ x21 = f(y, "058"); /* c */ x21 = f(y, "059"); /* c */ x21 = f(y, "060"); /* c */ x21 = f(y, "061"); /* c */ x21 = f(y, "062"); /* c */ x21 = f(y, "063"); /* c */ x21 = f(y, "064"); /* c */ x21 = f(y, "065"); /* c */ x21 = f(y, "066"); /* c */ x21 = f(y, "067"); /* c */ x21 = f(y, "068"); /* c */ x21 = f(y, "069"); /* c */ x21 = f(y, "070"); /* c */ x21 = f(y, "071"); /* c */ x21 = f(y, "072"); /* c */ x21 = f(y, "073"); /* c */ x21 = f(y, "074"); /* c */ x21 = f(y, "075"); /* c */ x21 = f(y, "076"); /* c */ x21 = f(y, "077"); /* c */ x21 = f(y, "078"); /* c */ x21 = f(y, "079"); /* c */ x21 = f(y, "080"); /* c */ x21 = f(y, "081"); /* c */ x21 = f(y, "082"); /* c */ x21 = f(y, "083"); /* c */ x21 = f(y, "084"); /* c */ x21 = f(y, "085"); /* c */ x21 = f(y, "086"); /* c */ x21 = f(y, "087"); /* c */ x21 = f(y, "088"); /* c */ x21 = f(y, "089"); /* c */ x21 = f(y, "090"); /* c */ x21 = f(y, "091"); /* c */ x21 = f(y, "092"); /* c */ x21 = f(y, "093"); /* c */ x21 = f(y, "094"); /* c */ x21 = f(y, "095"); /* c */ x21 = f(y, "096"); /* c */ x21 = f(y, "097"); /* c */ x21 = f(y, "098"); /* c */ x21 = f(y, "099"); /* c */ x21 = f(y, "100"); /* c */ x21 = f(y, "101"); /* c */ x21 = f(y, "102"); /* c */ x21 = f(y, "103"); /* c */ x21 = f(y, "104"); /* c */ x21 = f(y, "105"); /* c */ x21 = f(y, "106"); /* c */ x21 = f(y, "107"); /* c */ x21 = f(y, "108"); /* c */ x21 = f(y, "109"); /* c */ x21 = f(y, "110"); /* c */ x21 = f(y, "111"); /* c */ x21 = f(y, "112"); /* c */ x21 = f(y, "113"); /* c */ x21 = f(y, "114"); /* c */ x21 = f(y, "115"); /* c */ x21 = f(y, "116"); /* c */ x21 = f(y, "117"); /* c */ x21 = f(y, "118"); /* c */ x21 = f(y, "119"); /* c */ x21 = f(y, "120"); /* c */ x21 = f(y, "121"); /* c */ x21 = f(y, "122"); /* c */ x21 = f(y, "123"); /* c */ x21 = f(y, "124"); /* c */ x21 = f(y, "125"); /* c */ x21 = f(y, "126"); /* c */ x21 = f(y, "127"); /* c */ x21 = f(y, "128"); /* c */ x21 = f(y, "129"); /* c */ x21 = f(y, "130"); /* c */ x21 = f(y, "131"); /* c */ x21 = f(y, "132"); /* c */ x21 = f(y, "133"); /* c */ x21 = f(y, "134"); /* c */ x21 = f(y, "135"); /* c */ x21 = f(y, "136"); /* c */ x21 = f(y, "137"); /* c */ x21 = f(y, "138"); /* c */ x21 = f(y, "139"); /* c */ x21 = f(y, "140"); /* c */ x21 = f(y, "141"); /* c */ x21 = f(y, "142"); /* c */ x21 = f(y, "143"); /* c */ x21 = f(y, "144"); /* c */ x21 = f(y, "145"); /* c */ x21 = f(y, "146"); /* c */ x21 = f(y, "147"); /* c */ x21 = f(y, "148"); /* c */ x21 = f(y, "149"); /* c */ x21 = f(y, "150"); /* c */ x21 = f(y, "151"); /* c */ x21 = f(y, "152"); /* c */ x21 = f(y, "153"); /* c */ x21 = f(y, "154"); /* c */ x21 = f(y, "155"); /* c */ x21 = f(y, "156"); /* c */ x21 = f(y, "157"); /* c */ x21 = f(y, "158"); /* c */ x21 = f(y, "159"); /* c */ x21 = f(y, "160"); /* c */ x21 = f(y, "161"); /* c */ x21 = f(y, "162"); /* c */ x21 = f(y, "163"); /* c */ x21 = f(y, "164"); /* c */ x21 = f(y, "165"); /* c */ x21 = f(y, "166"); /* c */ x21 = f(y, "167"); /* c */ x21 = f(y, "168"); /* c */ x21 = f(y, "169"); /* c */ x21 = f(y, "170"); /* c */ x21 = f(y, "171"); /* c */ x21 = f(y, "172"); /* c */ x21 = f(y, "173"); /* c */ x21 = f(y, "174"); /* c */ x21 = f(y, "175"); /* c */ x21 = f(y, "176"); /* c */ x21 = f(y, "177"); /* c */ x21 = f(y, "178"); /* c */ x21 = f(y, "179"); /* c */ x21 = f(y, "180"); /* c */ x21 = f(y, "181"); /* c */ x21 = f(y, "182"); /* c */ x21 = f(y, "183"); /* c */ x21 = f(y, "184"); /* c */ x21 = f(y, "185"); /* c */ x21 = f(y, "186"); /* c */ x21 = f(y, "187"); /* c */ x21 = f(y, "188"); /* c */ x21 = f(y, "189"); /* c */ x21 = f(y, "190"); /* c */ x21 = f(y, "191"); /* c */ x21 = f(y, "192"); /* c */ x21 = f(y, "193"); /* c */ x21 = f(y, "194"); /* c */ x21 = f(y, "195"); /* c */ x21 = f(y, "196"); /* c */ x21 = f(y, "197"); /* c */ x21 = f(y, "198"); /* c */ x21 = f(y, "199"); /* c */ 
+x22 = f(y, "000"); /* c */ x22 = f(y, "001"); /* c */ x22 = f(y, "002"); /* c */ x22 = f(y, "003"); /* c */ x22 = f(y, "004"); /* c */ x22 = f(y, "005"); /* c */ x22 = f(y, "006"); /* c */ x22 = f(y, "007"); /* c */ x22 = f(y, "008"); /* c */ x22 = f(y, "009"); /* c */ x22 = f(y, "010"); /* c */ x22 = f(y, "011"); /* c */ x22 = f(y, "012"); /* c */ x22 = f(y, "013"); /* c */ x22 = f(y, "014"); /* c */ x22 = f(y, "015"); /* c */ x22 = f(y, "016"); /* c */ x22 = f(y, "017"); /* c */ x22 = f(y, "018"); /* c */ x22 = f(y, "019"); /* c */ x22 = f(y, "020"); /* c */ x22 = f(y, "021"); /* c */ x22 = f(y, "022"); /* c */ x22 = f(y, "023"); /* c */ x22 = f(y, "024"); /* c */ x22 = f(y, "025"); /* c */ x22 = f(y, "026"); /* c */ x22 = f(y, "027"); /* c */ x22 = f(y, "028"); /* c */ x22 = f(y, "029"); /* c */ x22 = f(y, "030"); /* c */ x22 = f(y, "031"); /* c */ x22 = f(y, "032"); /* c */ x22 = f(y, "033"); /* c */ x22 = f(y, "034"); /* c */ x22 = f(y, "035"); /* c */ x22 = f(y, "036"); /* c */ x22 = f(y, "037"); /* c */ x22 = f(y, "038"); /* c */ x22 = f(y, "039"); /* c */ x22 = f(y, "040"); /* c */ x22 = f(y, "041"); /* c */ x22 = f(y, "042"); /* c */ x22 = f(y, "043"); /* c */ x22 = f(y, "044"); /* c */ x22 = f(y, "045"); /* c */ x22 = f(y, "046"); /* c */ x22 = f(y, "047"); /* c */ x22 = f(y, "048"); /* c */ x22 = f(y, "049"); /* c */ x22 = f(y, "050"); /* c */ x22 = f(y, "051"); /* c */ x22 = f(y, "052"); /* c */ x22 = f(y, "053"); /* c */ x22 = f(y, "054"); /* c */ x22 = f(y, "055"); /* c */ x22 = f(y, "056"); /* c */ x22 = f(y, "057"); /* c */ x22 = f(y, "058"); /* c */ x22 = f(y, "059"); /* c */ x22 = f(y, "060"); /* c */ x22 = f(y, "061"); /* c */ x22 = f(y, "062"); /* c */ x22 = f(y, "063"); /* c */ x22 = f(y, "064"); /* c */ x22 = f(y, "065"); /* c */ x22 = f(y, "066"); /* c */ x22 = f(y, "067"); /* c */ x22 = f(y, "068"); /* c */ x22 = f(y, "069"); /* c */ x22 = f(y, "070"); /* c */ x22 = f(y, "071"); /* c */ x22 = f(y, "072"); /* c */ x22 = f(y, "073"); /* c */ x22 = f(y, "074"); /* c */ x22 = f(y, "075"); /* c */ x22 = f(y, "076"); /* c */ x22 = f(y, "077"); /* c */ x22 = f(y, "078"); /* c */ x22 = f(y, "079"); /* c */ x22 = f(y, "080"); /* c */ x22 = f(y, "081"); /* c */ x22 = f(y, "082"); /* c */ x22 = f(y, "083"); /* c */ x22 = f(y, "084"); /* c */ x22 = f(y, "085"); /* c */ x22 = f(y, "086"); /* c */ x22 = f(y, "087"); /* c */ x22 = f(y, "088"); /* c */ x22 = f(y, "089"); /* c */ x22 = f(y, "090"); /* c */ x22 = f(y, "091"); /* c */ x22 = f(y, "092"); /* c */ x22 = f(y, "093"); /* c */ x22 = f(y, "094"); /* c */ x22 = f(y, "095"); /* c */ x22 = f(y, "096"); /* c */ x22 = f(y, "097"); /* c */ x22 = f(y, "098"); /* c */ x22 = f(y, "099"); /* c */ x22 = f(y, "100"); /* c */ x22 = f(y, "101"); /* c */ x22 = f(y, "102"); /* c */ x22 = f(y, "103"); /* c */ x22 = f(y, "104"); /* c */ x22 = f(y, "105"); /* c */ x22 = f(y, "106"); /* c */ x22 = f(y, "107"); /* c */ x22 = f(y, "108"); /* c */ x22 = f(y, "109"); /* c */ x22 = f(y, "110"); /* c */ x22 = f(y, "111"); /* c */ x22 = f(y, "112"); /* c */ x22 = f(y, "113"); /* c */ x22 = f(y, "114"); /* c */ x22 = f(y, "115"); /* c */ x22 = f(y, "116"); /* c */ x22 = f(y, "117"); /* c */ x22 = f(y, "118"); /* c */ x22 = f(y, "119"); /* c */ x22 = f(y, "120"); /* c */ x22 = f(y, "121"); /* c */ x22 = f(y, "122"); /* c */ x22 = f(y, "123"); /* c */ x22 = f(y, "124"); /* c */ x22 = f(y, "125"); /* c */ x22 = f(y, "126"); /* c */ x22 = f(y, "127"); /* c */ x22 = f(y, "128"); /* c */ x22 = f(y, "129"); /* c */ x22 = f(y, "130"); /* c */ x22 = f(y, "131"); /* c */ x22 = f(y, "132"); /* c */ x22 = f(y, "133"); /* c */ x22 = f(y, "134"); /* c */ x22 = f(y, "135"); /* c */ x22 = f(y, "136"); /* c */ x22 = f(y, "137"); /* c */ x22 = f(y, "138"); /* c */ x22 = f(y, "139"); /* c */ x22 = f(y, "140"); /* c */ x22 = f(y, "141"); /* c */ x22 = f(y, "142"); /* c */ x22 = f(y, "143"); /* c */ x22 = f(y, "144"); /* c */ x22 = f(y, "145"); /* c */ x22 = f(y, "146"); /* c */ x22 = f(y, "147"); /* c */ x22 = f(y, "148"); /* c */ x22 = f(y, "149"); /* c */ x22 = f(y, "150"); /* c */ x22 = f(y, "151"); /* c */ x22 = f(y, "152"); /* c */ x22 = f(y, "153"); /* c */ x22 = f(y, "154"); /* c */ x22 = f(y, "155"); /* c */ x22 = f(y, "156"); /* c */ x22 = f(y, "157"); /* c */ x22 = f(y, "158"); /* c */ x22 = f(y, "159"); /* c */ x22 = f(y, "160"); /* c */ x22 = f(y, "161"); /* c */ x22 = f(y, "162"); /* c */ x22 = f(y, "163"); /* c */ x22 = f(y, "164"); /* c */ x22 = f(y, "165"); /* c */ x22 = f(y, "166"); /* c */ x22 = f(y, "167"); /* c */ x22 = f(y, "168"); /* c */ x22 = f(y, "169"); /* c */ x22 = f(y, "170"); /* c */ x22 = f(y, "171"); /* c */ x22 = f(y, "172"); /* c */ x22 = f(y, "173"); /* c */ x22 = f(y, "174"); /* c */ x22 = f(y, "175"); /* c */ x22 = f(y, "176"); /* c */ x22 = f(y, "177"); /* c */ x22 = f(y, "178"); /* c */ x22 = f(y, "179"); /* c */ x22 = f(y, "180"); /* c */ x22 = f(y, "181"); /* c */ x22 = f(y, "182"); /* c */ x22 = f(y, "183"); /* c */ x22 = f(y, "184"); /* c */ x22 = f(y, "185"); /* c */ x22 = f(y, "186"); /* c */ x22 = f(y, "187"); /* c */ x22 = f(y, "188"); /* c */ x22 = f(y, "189"); /* c */ x22 = f(y, "190"); /* c */ x22 = f(y, "191"); /* c */ x22 = f(y, "192"); /* c */ x22 = f(y, "193"); /* c */ x22 = f(y, "194"); /* c */ x22 = f(y, "195"); /* c */ x22 = f(y, "196"); /* c */ x22 = f(y, "197"); /* c */ x22 = f(y, "198"); /* c */ x22 = f(y, "199"); /* c */ 
+x23 = f(y, "000"); /* c */ x23 = f(y, "001"); /* c */ x23 = f(y, "002"); /* c */ x23 = f(y, "003"); /* c */ x23 = f(y, "004"); /* c */ x23 = f(y, "005"); /* c */ x23 = f(y, "006"); /* c */ x23 = f(y, "007"); /* c */ x23 = f(y, "008"); /* c */ x23 = f(y, "009"); /* c */ x23 = f(y, "010"); /* c */ x23 = f(y, "011"); /* c */ x23 = f(y, "012"); /* c */ x23 = f(y, "013"); /* c */ x23 = f(y, "014"); /* c */ x23 = f(y, "015"); /* c */ x23 = f(y, "016"); /* c */ x23 = f(y, "017"); /* c */ x23 = f(y, "018"); /* c */ x23 = f(y, "019"); /* c */ x23 = f(y, "020"); /* c */ x23 = f(y, "021"); /* c */ x23 = f(y, "022"); /* c */ x23 = f(y, "023"); /* c */ x23 = f(y, "024"); /* c */ x23 = f(y, "025"); /* c */ x23 = f(y, "026"); /* c */ x23 = f(y, "027"); /* c */ x23 = f(y, "028"); /* c */ x23 = f(y, "029"); /* c */ x23 = f(y, "030"); /* c */ x23 = f(y, "031"); /* c */ x23 = f(y, "032"); /* c */ x23 = f(y, "033"); /* c */ x23 = f(y, "034"); /* c */ x23 = f(y, "035"); /* c */ x23 = f(y, "036"); /* c */ x23 = f(y, "037"); /* c */ x23 = f(y, "038"); /* c */ x23 = f(y, "039"); /* c */ x23 = f(y, "040"); /* c */ x23 = f(y, "041"); /* c */ x23 = f(y, "042"); /* c */ x23 = f(y, "043"); /* c */ x23 = f(y, "044"); /* c */ x23 = f(y, "045"); /* c */ x23 = f(y, "046"); /* c */ x23 = f(y, "047"); /* c */ x23 = f(y, "048"); /* c */ x23 = f(y, "049"); /* c */ x23 = f(y, "050"); /* c */ x23 = f(y, "051"); /* c */ x23 = f(y, "052"); /* c */ x23 = f(y, "053"); /* c */ x23 = f(y, "054"); /* c */ x23 = f(y, "055"); /* c */ x23 = f(y, "056"); /* c */ x23 = f(y, "057"); /* c */ x23 = f(y, "058"); /* c */ x23 = f(y, "059"); /* c */ x23 = f(y, "060"); /* c */ x23 = f(y, "061"); /* c */ x23 = f(y, "062"); /* c */ x23 = f(y, "063"); /* c */ x23 = f(y, "064"); /* c */ x23 = f(y, "065"); /* c */ x23 = f(y, "066"); /* c */ x23 = f(y, "067"); /* c */ x23 = f(y, "068"); /* c */ x23 = f(y, "069"); /* c */ x23 = f(y, "070"); /* c */ x23 = f(y, "071"); /* c */ x23 = f(y, "072"); /* c */ x23 = f(y, "073"); /* c */ x23 = f(y, "074"); /* c */ x23 = f(y, "075"); /* c */ x23 = f(y, "076"); /* c */ x23 = f(y, "077"); /* c */ x23 = f(y, "078"); /* c */ x23 = f(y, "079"); /* c */ x23 = f(y, "080"); /* c */ x23 = f(y, "081"); /* c */ x23 = f(y, "082"); /* c */ x23 = f(y, "083"); /* c */ x23 = f(y, "084"); /* c */ x23 = f(y, "085"); /* c */ x23 = f(y, "086"); /* c */ x23 = f(y, "087"); /* c */ x23 = f(y, "088"); /* c */ x23 = f(y, "089"); /* c */ x23 = f(y, "090"); /* c */ x23 = f(y, "091"); /* c */ x23 = f(y, "092"); /* c */ x23 = f(y, "093"); /* c */ x23 = f(y, "094"); /* c */ x23 = f(y, "095"); /* c */ x23 = f(y, "096"); /* c */ x23 = f(y, "097"); /* c */ x23 = f(y, "098"); /* c */ x23 = f(y, "099"); /* c */ x23 = f(y, "100"); /* c */ x23 = f(y, "101"); /* c */ x23 = f(y, "102"); /* c */ x23 = f(y, "103"); /* c */ x23 = f(y, "104"); /* c */ x23 = f(y, "105"); /* c */ x23 = f(y, "106"); /* c */ x23 = f(y, "107"); /* c */ x23 = f(y, "108"); /* c */ x23 = f(y, "109"); /* c */ x23 = f(y, "110"); /* c */ x23 = f(y, "111"); /* c */ x23 = f(y, "112"); /* c */ x23 = f(y, "113"); /* c */ x23 = f(y, "114"); /* c */ x23 = f(y, "115"); /* c */ x23 = f(y, "116"); /* c */ x23 = f(y, "117"); /* c */ x23 = f(y, "118"); /* c */ x23 = f(y, "119"); /* c */ x23 = f(y, "120"); /* c */ x23 = f(y, "121"); /* c */ x23 = f(y, "122"); /* c */ x23 = f(y, "123"); /* c */ x23 = f(y, "124"); /* c */ x23 = f(y, "125"); /* c */ x23 = f(y, "126"); /* c */ x23 = f(y, "127"); /* c */ x23 = f(y, "128"); /* c */ x23 = f(y, "129"); /* c */ x23 = f(y, "130"); /* c */ x23 = f(y, "131"); /* c */ x23 = f(y, "132"); /* c */ x23 = f(y, "133"); /* c */ x23 = f(y, "134"); /* c */ x23 = f(y, "135"); /* c */ x23 = f(y, "136"); /* c */ x23 = f(y, "137"); /* c */ x23 = f(y, "138"); /* c */ x23 = f(y, "139"); /* c */ x23 = f(y, "140"); /* c */ x23 = f(y, "141"); /* c */ x23 = f(y, "142"); /* c */ x23 = f(y, "143"); /* c */ x23 = f(y, "144"); /* c */ x23 = f(y, "145"); /* c */ x23 = f(y, "146"); /* c */ x23 = f(y, "147"); /* c */ x23 = f(y, "148"); /* c */ x23 = f(y, "149"); /* c */ x23 = f(y, "150"); /* c */ x23 = f(y, "151"); /* c */ x23 = f(y, "152"); /* c */ x23 = f(y, "153"); /* c */ x23 = f(y, "154"); /* c */ x23 = f(y, "155"); /* c */ x23 = f(y, "156"); /* c */ x23 = f(y, "157"); /* c */ x23 = f(y, "158"); /* c */ x23 = f(y, "159"); /* c */ x23 = f(y, "160"); /* c */ x23 = f(y, "161"); /* c */ x23 = f(y, "162"); /* c */ x23 = f(y, "163"); /* c */ x23 = f(y, "164"); /* c */ x23 = f(y, "165"); /* c */ x23 = f(y, "166"); /* c */ x23 = f(y, "167"); /* c */ x23 = f(y, "168"); /* c */ x23 = f(y, "169"); /* c */ x23 = f(y, "170"); /* c */ x23 = f(y, "171"); /* c */ x23 = f(y, "172"); /* c */ x23 = f(y, "173"); /* c */ x23 = f(y, "174"); /* c */ x23 = f(y, "175"); /* c */ x23 = f(y, "176"); /* c */ x23 = f(y, "177"); /* c */ x23 = f(y, "178"); /* c */ x23 = f(y, "179"); /* c */ x23 = f(y, "180"); /* c */ x23 = f(y, "181"); /* c */ x23 = f(y, "182"); /* c */ x23 = f(y, "183"); /* c */ x23 = f(y, "184"); /* c */ x23 = f(y, "185"); /* c */ x23 = f(y, "186"); /* c */ x23 = f(y, "187"); /* c */ x23 = f(y, "188"); /* c */ x23 = f(y, "189"); /* c */ x23 = f(y, "190"); /* c */ x23 = f(y, "191"); /* c */ x23 = f(y, "192"); /* c */ x23 = f(y, "193"); /* c */ x23 = f(y, "194"); /* c */ x23 = f(y, "195"); /* c */ x23 = f(y, "196"); /* c */ x23 = f(y, "197"); /* c */ x23 = f(y, "198"); /* c */ x23 = f(y, "199"); /* c */ 
+x24 = f(y, "000"); /* c */ x24 = f(y, "001"); /* c */ x24 = f(y, "002"); /* c */ x24 = f(y, "003"); /* c */ x24 = f(y, "004"); /* c */ x24 = f(y, "005"); /* c */ x24 = f(y, "006"); /* c */ x24 = f(y, "007"); /* c */ x24 = f(y, "008"); /* c */ x24 = f(y, "009"); /* c */ x24 = f(y, "010"); /* c */ x24 = f(y, "011"); /* c */ x24 = f(y, "012"); /* c */ x24 = f(y, "013"); /* c */ x24 = f(y, "014"); /* c */ x24 = f(y, "015"); /* c */ x24 = f(y, "016"); /* c */ x24 = f(y, "017"); /* c */ x24 = f(y, "018"); /* c */ x24 = f(y, "019"); /* c */ x24 = f(y, "020"); /* c */ x24 = f(y, "021"); /* c */ x24 = f(y, "022"); /* c */ x24 = f(y, "023"); /* c */ x24 = f(y, "024"); /* c */ x24 = f(y, "025"); /* c */ x24 = f(y, "026"); /* c */ x24 = f(y, "027"); /* c */ x24 = f(y, "028"); /* c */ x24 = f(y, "029"); /* c */ x24 = f(y, "030"); /* c */ x24 = f(y, "031"); /* c */ x24 = f(y, "032"); /* c */ x24 = f(y, "033"); /* c */ x24 = f(y, "034"); /* c */ x24 = f(y, "035"); /* c */ x24 = f(y, "036"); /* c */ x24 = f(y, "037"); /* c */ x24 = f(y, "038"); /* c */ x24 = f(y, "039"); /* c */ x24 = f(y, "040"); /* c */ x24 = f(y, "041"); /* c */ x24 = f(y, "042"); /* c */ x24 = f(y, "043"); /* c */ x24 = f(y, "044"); /* c */ x24 = f(y, "045"); /* c */ x24 = f(y, "046"); /* c */ x24 = f(y, "047"); /* c */ x24 = f(y, "048"); /* c */ x24 = f(y, "049"); /* c */ x24 = f(y, "050"); /* c */ x24 = f(y, "051"); /* c */ x24 = f(y, "052"); /* c */ x24 = f(y, "053"); /* c */ x24 = f(y, "054"); /* c */ x24 = f(y, "055"); /* c */ x24 = f(y, "056"); /* c */ x24 = f(y, "057"); /* c */ x24 = f(y, "058"); /* c */ x24 = f(y, "059"); /* c */ x24 = f(y, "060"); /* c */ x24 = f(y, "061"); /* c */ x24 = f(y, "062"); /* c */ x24 = f(y, "063"); /* c */ x24 = f(y, "064"); /* c */ x24 = f(y, "065"); /* c */ x24 = f(y, "066"); /* c */ x24 = f(y, "067"); /* c */ x24 = f(y, "068"); /* c */ x24 = f(y, "069"); /* c */ x24 = f(y, "070"); /* c */ x24 = f(y, "071"); /* c */ x24 = f(y, "072"); /* c */ x24 = f(y, "073"); /* c */ x24 = f(y, "074"); /* c */ x24 = f(y, "075"); /* c */ x24 = f(y, "076"); /* c */ x24 = f(y, "077"); /* c */ x24 = f(y, "078"); /* c */ x24 = f(y, "079"); /* c */ x24 = f(y, "080"); /* c */ x24 = f(y, "081"); /* c */ x24 = f(y, "082"); /* c */ x24 = f(y, "083"); /* c */ x24 = f(y, "084"); /* c */ x24 = f(y, "085"); /* c */ x24 = f(y, "086"); /* c */ x24 = f(y, "087"); /* c */ x24 = f(y, "088"); /* c */ x24 = f(y, "089"); /* c */ x24 = f(y, "090"); /* c */ x24 = f(y, "091"); /* c */ x24 = f(y, "092"); /* c */ x24 = f(y, "093"); /* c */ x24 = f(y, "094"); /* c */ x24 = f(y, "095"); /* c */ x24 = f(y, "096"); /* c */ x24 = f(y, "097"); /* c */ x24 = f(y, "098"); /* c */ x24 = f(y, "099"); /* c */ x24 = f(y, "100"); /* c */ x24 = f(y, "101"); /* c */ x24 = f(y, "102"); /* c */ x24 = f(y, "103"); /* c */ x24 = f(y, "104"); /* c */ x24 = f(y, "105"); /* c */ x24 = f(y, "106"); /* c */ x24 = f(y, "107"); /* c */ x24 = f(y, "108"); /* c */ x24 = f(y, "109"); /* c */ x24 = f(y, "110"); /* c */ x24 = f(y, "111"); /* c */ x24 = f(y, "112"); /* c */ x24 = f(y, "113"); /* c */ x24 = f(y, "114"); /* c */ x24 = f(y, "115"); /* c */ x24 = f(y, "116"); /* c */ x24 = f(y, "117"); /* c */ x24 = f(y, "118"); /* c */ x24 = f(y, "119"); /* c */ x24 = f(y, "120"); /* c */ x24 = f(y, "121"); /* c */ x24 = f(y, "122"); /* c */ x24 = f(y, "123"); /* c */ x24 = f(y, "124"); /* c */ x24 = f(y, "125"); /* c */ x24 = f(y, "126"); /* c */ x24 = f(y, "127"); /* c */ x24 = f(y, "128"); /* c */ x24 = f(y, "129"); /* c */ x24 = f(y, "130"); /* c */ x24 = f(y, "131"); /* c */ x24 = f(y, "132"); /* c */ x24 = f(y, "133"); /* c */ x24 = f(y, "134"); /* c */ x24 = f(y, "135"); /* c */ x24 = f(y, "136"); /* c */ x24 = f(y, "137"); /* c */ x24 = f(y, "138"); /* c */ x24 = f(y, "139"); /* c */ x24 = f(y, "140"); /* c */ x24 = f(y, "141"); /* c */ x24 = f(y, "142"); /* c */ x24 = f(y, "143"); /* c */ x24 = f(y, "144"); /* c */ x24 = f(y, "145"); /* c */ x24 = f(y, "146"); /* c */ x24 = f(y, "147"); /* c */ x24 = f(y, "148"); /* c */ x24 = f(y, "149"); /* c */ x24 = f(y, "150"); /* c */ x24 = f(y, "151"); /* c */ x24 = f(y, "152"); /* c */ x24 = f(y, "153"); /* c */ x24 = f(y, "154"); /* c */ x24 = f(y, "155"); /* c */ x24 = f(y, "156"); /* c */ x24 = f(y, "157"); /* c */ x24 = f(y, "158"); /* c */ x24 = f(y, "159"); /* c */ x24 = f(y, "160"); /* c */ x24 = f(y, "161"); /* c */ x24 = f(y, "162"); /* c */ x24 = f(y, "163"); /* c */ x24 = f(y, "164"); /* c */ x24 = f(y, "165"); /* c */ x24 = f(y, "166"); /* c */ x24 = f(y, "167"); /* c */ x24 = f(y, "168"); /* c */ x24 = f(y, "169"); /* c */ x24 = f(y, "170"); /* c */ x24 = f(y, "171"); /* c */ x24 = f(y, "172"); /* c */ x24 = f(y, "173"); /* c */ x24 = f(y, "174"); /* c */ x24 = f(y, "175"); /* c */ x24 = f(y, "176"); /* c */ x24 = f(y, "177"); /* c */ x24 = f(y, "178"); /* c */ x24 = f(y, "179"); /* c */ x24 = f(y, "180"); /* c */ x24 = f(y, "181"); /* c */ x24 = f(y, "182"); /* c */ x24 = f(y, "183"); /* c */ x24 = f(y, "184"); /* c */ x24 = f(y, "185"); /* c */ x24 = f(y, "186"); /* c */ x24 = f(y, "187"); /* c */ x24 = f(y, "188"); /* c */ x24 = f(y, "189"); /* c */ x24 = f(y, "190"); /* c */ x24 = f(y, "191"); /* c */ x24 = f(y, "192"); /* c */ x24 = f(y, "193"); /* c */ x24 = f(y, "194"); /* c */ x24 = f(y, "195"); /* c */ x24 = f(y, "196"); /* c */ x24 = f(y, "197"); /* c */ x24 = f(y, "198"); /* c */ x24 = f(y, "199"); /* c */ 
+x25 = f(y, "000"); /* c */ x25 = f(y, "001"); /* c */ x25 = f(y, "002"); /* c */ x25 = f(y, "003"); /* c */ x25 = f(y, "004"); /* c */ x25 = f(y, "005"); /* c */ x25 = f(y, "006"); /* c */ x25 = f(y, "007"); /* c */ x25 = f(y, "008"); /* c */ x25 = f(y, "009"); /* c */ x25 = f(y, "010"); /* c */ x25 = f(y, "011"); /* c */ x25 = f(y, "012"); /* c */ x25 = f(y, "013"); /* c */ x25 = f(y, "014"); /* c */ x25 = f(y, "015"); /* c */ x25 = f(y, "016"); /* c */ x25 = f(y, "017"); /* c */ x25 = f(y, "018"); /* c */ x25 = f(y, "019"); /* c */ x25 = f(y, "020"); /* c */ x25 = f(y, "021"); /* c */ x25 = f(y, "022"); /* c */ x25 = f(y, "023"); /* c */ x25 = f(y, "024"); /* c */ x25 = f(y, "025"); /* c */ x25 = f(y, "026"); /* c */ x25 = f(y, "027"); /* c */ x25 = f(y, "028"); /* c */ x25 = f(y, "029"); /* c */ x25 = f(y, "030"); /* c */ x25 = f(y, "031"); /* c */ x25 = f(y, "032"); /* c */ x25 = f(y, "033"); /* c */ x25 = f(y, "034"); /* c */ x25 = f(y, "035"); /* c */ x25 = f(y, "036"); /* c */ x25 = f(y, "037"); /* c */ x25 = f(y, "038"); /* c */ x25 = f(y, "039"); /* c */ x25 = f(y, "040"); /* c */ x25 = f(y, "041"); /* c */ x25 = f(y, "042"); /* c */ x25 = f(y, "043"); /* c */ x25 = f(y, "044"); /* c */ x25 = f(y, "045"); /* c */ x25 = f(y, "046"); /* c */ x25 = f(y, "047"); /* c */ x25 = f(y, "048"); /* c */ x25 = f(y, "049"); /* c */ x25 = f(y, "050"); /* c */ x25 = f(y, "051"); /* c */ x25 = f(y, "052"); /* c */ x25 = f(y, "053"); /* c */ x25 = f(y, "054"); /* c */ x25 = f(y, "055"); /* c */ x25 = f(y, "056"); /* c */ x25 = f(y, "057"); /* c */ x25 = f(y, "058"); /* c */ x25 = f(y, "059"); /* c */ x25 = f(y, "060"); /* c */ x25 = f(y, "061"); /* c */ x25 = f(y, "062"); /* c */ x25 = f(y, "063"); /* c */ x25 = f(y, "064"); /* c */ x25 = f(y, "065"); /* c */ x25 = f(y, "066"); /* c */ x25 = f(y, "067"); /* c */ x25 = f(y, "068"); /* c */ x25 = f(y, "069"); /* c */ x25 = f(y, "070"); /* c */ x25 = f(y, "071"); /* c */ x25 = f(y, "072"); /* c */ x25 = f(y, "073"); /* c */ x25 = f(y, "074"); /* c */ x25 = f(y, "075"); /* c */ x25 = f(y, "076"); /* c */ x25 = f(y, "077"); /* c */ x25 = f(y, "078"); /* c */ x25 = f(y, "079"); /* c */ x25 = f(y, "080"); /* c */ x25 = f(y, "081"); /* c */ x25 = f(y, "082"); /* c */ x25 = f(y, "083"); /* c */ x25 = f(y, "084"); /* c */ x25 = f(y, "085"); /* c */ x25 = f(y, "086"); /* c */ x25 = f(y, "087"); /* c */ x25 = f(y, "088"); /* c */ x25 = f(y, "089"); /* c */ x25 = f(y, "090"); /* c */ x25 = f(y, "091"); /* c */ x25 = f(y, "092"); /* c */ x25 = f(y, "093"); /* c */ x25 = f(y, "094"); /* c */ x25 = f(y, "095"); /* c */ x25 = f(y, "096"); /* c */ x25 = f(y, "097"); /* c */ x25 = f(y, "098"); /* c */ x25 = f(y, "099"); /* c */ x25 = f(y, "100"); /* c */ x25 = f(y, "101"); /* c */ x25 = f(y, "102"); /* c */ x25 = f(y, "103"); /* c */ x25 = f(y, "104"); /* c */ x25 = f(y, "105"); /* c */ x25 = f(y, "106"); /* c */ x25 = f(y, "107"); /* c */ x25 = f(y, "108"); /* c */ x25 = f(y, "109"); /* c */ x25 = f(y, "110"); /* c */ x25 = f(y, "111"); /* c */ x25 = f(y, "112"); /* c */ x25 = f(y, "113"); /* c */ x25 = f(y, "114"); /* c */ x25 = f(y, "115"); /* c */ x25 = f(y, "116"); /* c */ x25 = f(y, "117"); /* c */ x25 = f(y, "118"); /* c */ x25 = f(y, "119"); /* c */ x25 = f(y, "120"); /* c */ x25 = f(y, "121"); /* c */ x25 = f(y, "122"); /* c */ x25 = f(y, "123"); /* c */ x25 = f(y, "124"); /* c */ x25 = f(y, "125"); /* c */ x25 = f(y, "126"); /* c */ x25 = f(y, "127"); /* c */ x25 = f(y, "128"); /* c */ x25 = f(y, "129"); /* c */ x25 = f(y, "130"); /* c */ x25 = f(y, "131"); /* c */ x25 = f(y, "132"); /* c */ x25 = f(y, "133"); /* c */ x25 = f(y, "134"); /* c */ x25 = f(y, "135"); /* c */ x25 = f(y, "136"); /* c */ x25 = f(y, "137"); /* c */ x25 = f(y, "138"); /* c */ x25 = f(y, "139"); /* c */ x25 = f(y, "140"); /* c */ x25 = f(y, "141"); /* c */ x25 = f(y, "142"); /* c */ x25 = f(y, "143"); /* c */ x25 = f(y, "144"); /* c */ x25 = f(y, "145"); /* c */ x25 = f(y, "146"); /* c */ x25 = f(y, "147"); /* c */ x25 = f(y, "148"); /* c */ x25 = f(y, "149"); /* c */ x25 = f(y, "150"); /* c */ x25 = f(y, "151"); /* c */ x25 = f(y, "152"); /* c */ x25 = f(y, "153"); /* c */ x25 = f(y, "154"); /* c */ x25 = f(y, "155"); /* c */ x25 = f(y, "156"); /* c */ x25 = f(y, "157"); /* c */ x25 = f(y, "158"); /* c */ x25 = f(y, "159"); /* c */ x25 = f(y, "160"); /* c */ x25 = f(y, "161"); /* c */ x25 = f(y, "162"); /* c */ x25 = f(y, "163"); /* c */ x25 = f(y, "164"); /* c */ x25 = f(y, "165"); /* c */ x25 = f(y, "166"); /* c */ x25 = f(y, "167"); /* c */ x25 = f(y, "168"); /* c */ x25 = f(y, "169"); /* c */ x25 = f(y, "170"); /* c */ x25 = f(y, "171"); /* c */ x25 = f(y, "172"); /* c */ x25 = f(y, "173"); /* c */ x25 = f(y, "174"); /* c */ x25 = f(y, "175"); /* c */ x25 = f(y, "176"); /* c */ x25 = f(y, "177"); /* c */ x25 = f(y, "178"); /* c */ x25 = f(y, "179"); /* c */ x25 = f(y, "180"); /* c */ x25 = f(y, "181"); /* c */ x25 = f(y, "182"); /* c */ x25 = f(y, "183"); /* c */ x25 = f(y, "184"); /* c */ x25 = f(y, "185"); /* c */ x25 = f(y, "186"); /* c */ x25 = f(y, "187"); /* c */ x25 = f(y, "188"); /* c */ x25 = f(y, "189"); /* c */ x25 = f(y, "190"); /* c */ x25 = f(y, "191"); /* c */ x25 = f(y, "192"); /* c */ x25 = f(y, "193"); /* c */ x25 = f(y, "194"); /* c */ x25 = f(y, "195"); /* c */ x25 = f(y, "196"); /* c */ x25 = f(y, "197"); /* c */ x25 = f(y, "198"); /* c */ x25 = f(y, "199"); /* c */ 
+x26 = f(y, "000"); /* c */ x26 = f(y, "001"); /* c */ x26 = f(y, "002"); /* c */ x26 = f(y, "003"); /* c */ x26 = f(y, "004"); /* c */ x26 = f(y, "005"); /* c */ x26 = f(y, "006"); /* c */ x26 = f(y, "007"); /* c */ x26 = f(y, "008"); /* c */ x26 = f(y, "009"); /* c */ x26 = f(y, "010"); /* c */ x26 = f(y, "011"); /* c */ x26 = f(y, "012"); /* c */ x26 = f(y, "013"); /* c */ x26 = f(y, "014"); /* c */ x26 = f(y, "015"); /* c */ x26 = f(y, "016"); /* c */ x26 = f(y, "017"); /* c */ x26 = f(y, "018"); /* c */ x26 = f(y, "019"); /* c */ x26 = f(y, "020"); /* c */ x26 = f(y, "021"); /* c */ x26 = f(y, "022"); /* c */ x26 = f(y, "023"); /* c */ x26 = f(y, "024"); /* c */ x26 = f(y, "025"); /* c */ x26 = f(y, "026"); /* c */ x26 = f(y, "027"); /* c */ x26 = f(y, "028"); /* c */ x26 = f(y, "029"); /* c */ x26 = f(y, "030"); /* c */ x26 = f(y, "031"); /* c */ x26 = f(y, "032"); /* c */ x26 = f(y, "033"); /* c */ x26 = f(y, "034"); /* c */ x26 = f(y, "035"); /* c */ x26 = f(y, "036"); /* c */ x26 = f(y, "037"); /* c */ x26 = f(y, "038"); /* c */ x26 = f(y, "039"); /* c */ x26 = f(y, "040"); /* c */ x26 = f(y, "041"); /* c */ x26 = f(y, "042"); /* c */ x26 = f(y, "043"); /* c */ x26 = f(y, "044"); /* c */ x26 = f(y, "045"); /* c */ x26 = f(y, "046"); /* c */ x26 = f(y, "047"); /* c */ x26 = f(y, "048"); /* c */ x26 = f(y, "049"); /* c */ x26 = f(y, "050"); /* c */ x26 = f(y, "051"); /* c */ x26 = f(y, "052"); /* c */ x26 = f(y, "053"); /* c */ x26 = f(y, "054"); /* c */ x26 = f(y, "055"); /* c */ x26 = f(y, "056"); /* c */ x26 = f(y, "057"); /* c */ x26 = f(y, "058"); /* c */ x26 = f(y, "059"); /* c */ x26 = f(y, "060"); /* c */ x26 = f(y, "061"); /* c */ x26 = f(y, "062"); /* c */ x26 = f(y, "063"); /* c */ x26 = f(y, "064"); /* c */ x26 = f(y, "065"); /* c */ x26 = f(y, "066"); /* c */ x26 = f(y, "067"); /* c */ x26 = f(y, "068"); /* c */ x26 = f(y, "069"); /* c */ x26 = f(y, "070"); /* c */ x26 = f(y, "071"); /* c */ x26 = f(y, "072"); /* c */ x26 = f(y, "073"); /* c */ x26 = f(y, "074"); /* c */ x26 = f(y, "075"); /* c */ x26 = f(y, "076"); /* c */ x26 = f(y, "077"); /* c */ x26 = f(y, "078"); /* c */ x26 = f(y, "079"); /* c */ x26 = f(y, "080"); /* c */ x26 = f(y, "081"); /* c */ x26 = f(y, "082"); /* c */ x26 = f(y, "083"); /* c */ x26 = f(y, "084"); /* c */ x26 = f(y, "085"); /* c */ x26 = f(y, "086"); /* c */ x26 = f(y, "087"); /* c */ x26 = f(y, "088"); /* c */ x26 = f(y, "089"); /* c */ x26 = f(y, "090"); /* c */ x26 = f(y, "091"); /* c */ x26 = f(y, "092"); /* c */ x26 = f(y, "093"); /* c */ x26 = f(y, "094"); /* c */ x26 = f(y, "095"); /* c */ x26 = f(y, "096"); /* c */ x26 = f(y, "097"); /* c */ x26 = f(y, "098"); /* c */ x26 = f(y, "099"); /* c */ x26 = f(y, "100"); /* c */ x26 = f(y, "101"); /* c */ x26 = f(y, "102"); /* c */ x26 = f(y, "103"); /* c */ x26 = f(y, "104"); /* c */ x26 = f(y, "105"); /* c */ x26 = f(y, "106"); /* c */ x26 = f(y, "107"); /* c */ x26 = f(y, "108"); /* c */ x26 = f(y, "109"); /* c */ x26 = f(y, "110"); /* c */ x26 = f(y, "111"); /* c */ x26 = f(y, "112"); /* c */ x26 = f(y, "113"); /* c */ x26 = f(y, "114"); /* c */ x26 = f(y, "115"); /* c */ x26 = f(y, "116"); /* c */ x26 = f(y, "117"); /* c */ x26 = f(y, "118"); /* c */ x26 = f(y, "119"); /* c */ x26 = f(y, "120"); /* c */ x26 = f(y, "121"); /* c */ x26 = f(y, "122"); /* c */ x26 = f(y, "123"); /* c */ x26 = f(y, "124"); /* c */ x26 = f(y, "125"); /* c */ x26 = f(y, "126"); /* c */ x26 = f(y, "127"); /* c */ x26 = f(y, "128"); /* c */ x26 = f(y, "129"); /* c */ x26 = f(y, "130"); /* c */ x26 = f(y, "131"); /* c */ x26 = f(y, "132"); /* c */ x26 = f(y, "133"); /* c */ x26 = f(y, "134"); /* c */ x26 = f(y, "135"); /* c */ x26 = f(y, "136"); /* c */ x26 = f(y, "137"); /* c */ x26 = f(y, "138"); /* c */ x26 = f(y, "139"); /* c */ x26 = f(y, "140"); /* c */ x26 = f(y, "141"); /* c */ x26 = f(y, "142"); /* c */ x26 = f(y, "143"); /* c */ x26 = f(y, "144"); /* c */ x26 = f(y, "145"); /* c */ x26 = f(y, "146"); /* c */ x26 = f(y, "147"); /* c */ x26 = f(y, "148"); /* c */ x26 = f(y, "149"); /* c */ x26 = f(y, "150"); /* c */ x26 = f(y, "151"); /* c */ x26 = f(y, "152"); /* c */ x26 = f(y, "153"); /* c */ x26 = f(y, "154"); /* c */ x26 = f(y, "155"); /* c */ x26 = f(y, "156"); /* c */ x26 = f(y, "157"); /* c */ x26 = f(y, "158"); /* c */ x26 = f(y, "159"); /* c */ x26 = f(y, "160"); /* c */ x26 = f(y, "161"); /* c */ x26 = f(y, "162"); /* c */ x26 = f(y, "163"); /* c */ x26 = f(y, "164"); /* c */ x26 = f(y, "165"); /* c */ x26 = f(y, "166"); /* c */ x26 = f(y, "167"); /* c */ x26 = f(y, "168"); /* c */ x26 = f(y, "169"); /* c */ x26 = f(y, "170"); /* c */ x26 = f(y, "171"); /* c */ x26 = f(y, "172"); /* c */ x26 = f(y, "173"); /* c */ x26 = f(y, "174"); /* c */ x26 = f(y, "175"); /* c */ x26 = f(y, "176"); /* c */ x26 = f(y, "177"); /* c */ x26 = f(y, "178"); /* c */ x26 = f(y, "179"); /* c */ x26 = f(y, "180"); /* c */ x26 = f(y, "181"); /* c */ x26 = f(y, "182"); /* c */ x26 = f(y, "183"); /* c */ x26 = f(y, "184"); /* c */ x26 = f(y, "185"); /* c */ x26 = f(y, "186"); /* c */ x26 = f(y, "187"); /* c */ x26 = f(y, "188"); /* c */ x26 = f(y, "189"); /* c */ x26 = f(y, "190"); /* c */ x26 = f(y, "191"); /* c */ x26 = f(y, "192"); /* c */ x26 = f(y, "193"); /* c */ x26 = f(y, "194"); /* c */ x26 = f(y, "195"); /* c */ x26 = f(y, "196"); /* c */ x26 = f(y, "197"); /* c */ x26 = f(y, "198"); /* c */ x26 = f(y, "199"); /* c */ 
+x27 = f(y, "000"); /* c */ x27 = f(y, "001"); /* c */ x27 = f(y, "002"); /* c */ x27 = f(y, "003"); /* c */ x27 = f(y, "004"); /* c */ x27 = f(y, "005"); /* c */ x27 = f(y, "006"); /* c */ x27 = f(y, "007"); /* c */ x27 = f(y, "008"); /* c */ x27 = f(y, "009"); /* c */ x27 = f(y, "010"); /* c */ x27 = f(y, "011"); /* c */ x27 = f(y, "012"); /* c */ x27 = f(y, "013"); /* c */ x27 = f(y, "014"); /* c */ x27 = f(y, "015"); /* c */ x27 = f(y, "016"); /* c */ x27 = f(y, "017"); /* c */ x27 = f(y, "018"); /* c */ x27 = f(y, "019"); /* c */ x27 = f(y, "020"); /* c */ x27 = f(y, "021"); /* c */ x27 = f(y, "022"); /* c */ x27 = f(y, "023"); /* c */ x27 = f(y, "024"); /* c */ x27 = f(y, "025"); /* c */ x27 = f(y, "026"); /* c */ x27 = f(y, "027"); /* c */ x27 = f(y, "028"); /* c */ x27 = f(y, "029"); /* c */ x27 = f(y, "030"); /* c */ x27 = f(y, "031"); /* c */ x27 = f(y, "032"); /* c */ x27 = f(y, "033"); /* c */ x27 = f(y, "034"); /* c */ x27 = f(y, "035"); /* c */ x27 = f(y, "036"); /* c */ x27 = f(y, "037"); /* c */ x27 = f(y, "038"); /* c */ x27 = f(y, "039"); /* c */ x27 = f(y, "040"); /* c */ x27 = f(y, "041"); /* c */ x27 = f(y, "042"); /* c */ x27 = f(y, "043"); /* c */ x27 = f(y, "044"); /* c */ x27 = f(y, "045"); /* c */ x27 = f(y, "046"); /* c */ x27 = f(y, "047"); /* c */ x27 = f(y, "048"); /* c */ x27 = f(y, "049"); /* c */ x27 = f(y, "050"); /* c */ x27 = f(y, "051"); /* c */ x27 = f(y, "052"); /* c */ x27 = f(y, "053"); /* c */ x27 = f(y, "054"); /* c */ x27 = f(y, "055"); /* c */ x27 = f(y, "056"); /* c */ x27 = f(y, "057"); /* c */ x27 = f(y, "058"); /* c */ x27 = f(y, "059"); /* c */ x27 = f(y, "060"); /* c */ x27 = f(y, "061"); /* c */ x27 = f(y, "062"); /* c */ x27 = f(y, "063"); /* c */ x27 = f(y, "064"); /* c */ x27 = f(y, "065"); /* c */ x27 = f(y, "066"); /* c */ x27 = f(y, "067"); /* c */ x27 = f(y, "068"); /* c */ x27 = f(y, "069"); /* c */ x27 = f(y, "070"); /* c */ x27 = f(y, "071"); /* c */ x27 = f(y, "072"); /* c */ x27 = f(y, "073"); /* c */ x27 = f(y, "074"); /* c */ x27 = f(y, "075"); /* c */ x27 = f(y, "076"); /* c */ x27 = f(y, "077"); /* c */ x27 = f(y, "078"); /* c */ x27 = f(y, "079"); /* c */ x27 = f(y, "080"); /* c */ x27 = f(y, "081"); /* c */ x27 = f(y, "082"); /* c */ x27 = f(y, "083"); /* c */ x27 = f(y, "084"); /* c */ x27 = f(y, "085"); /* c */ x27 = f(y, "086"); /* c */ x27 = f(y, "087"); /* c */ x27 = f(y, "088"); /* c */ x27 = f(y, "089"); /* c */ x27 = f(y, "090"); /* c */ x27 = f(y, "091"); /* c */ x27 = f(y, "092"); /* c */ x27 = f(y, "093"); /* c */ x27 = f(y, "094"); /* c */ x27 = f(y, "095"); /* c */ x27 = f(y, "096"); /* c */ x27 = f(y, "097"); /* c */ x27 = f(y, "098"); /* c */ x27 = f(y, "099"); /* c */ x27 = f(y, "100"); /* c */ x27 = f(y, "101"); /* c */ x27 = f(y, "102"); /* c */ x27 = f(y, "103"); /* c */ x27 = f(y, "104"); /* c */ x27 = f(y, "105"); /* c */ x27 = f(y, "106"); /* c */ x27 = f(y, "107"); /* c */ x27 = f(y, "108"); /* c */ x27 = f(y, "109"); /* c */ x27 = f(y, "110"); /* c */ x27 = f(y, "111"); /* c */ x27 = f(y, "112"); /* c */ x27 = f(y, "113"); /* c */ x27 = f(y, "114"); /* c */ x27 = f(y, "115"); /* c */ x27 = f(y, "116"); /* c */ x27 = f(y, "117"); /* c */ x27 = f(y, "118"); /* c */ x27 = f(y, "119"); /* c */ x27 = f(y, "120"); /* c */ x27 = f(y, "121"); /* c */ x27 = f(y, "122"); /* c */ x27 = f(y, "123"); /* c */ x27 = f(y, "124"); /* c */ x27 = f(y, "125"); /* c */ x27 = f(y, "126"); /* c */ x27 = f(y, "127"); /* c */ x27 = f(y, "128"); /* c */ x27 = f(y, "129"); /* c */ x27 = f(y, "130"); /* c */ x27 = f(y, "131"); /* c */ x27 = f(y, "132"); /* c */ x27 = f(y, "133"); /* c */ x27 = f(y, "134"); /* c */ x27 = f(y, "135"); /* c */ x27 = f(y, "136"); /* c */ x27 = f(y, "137"); /* c */ x27 = f(y, "138"); /* c */ x27 = f(y, "139"); /* c */ x27 = f(y, "140"); /* c */ x27 = f(y, "141"); /* c */ x27 = f(y, "142"); /* c */ x27 = f(y, "143"); /* c */ x27 = f(y, "144"); /* c */ x27 = f(y, "145"); /* c */ x27 = f(y, "146"); /* c */ x27 = f(y, "147"); /* c */ x27 = f(y, "148"); /* c */ x27 = f(y, "149"); /* c */ x27 = f(y, "150"); /* c */ x27 = f(y, "151"); /* c */ x27 = f(y, "152"); /* c */ x27 = f(y, "153"); /* c */ x27 = f(y, "154"); /* c */ x27 = f(y, "155"); /* c */ x27 = f(y, "156"); /* c */ x27 = f(y, "157"); /* c */ x27 = f(y, "158"); /* c */ x27 = f(y, "159"); /* c */ x27 = f(y, "160"); /* c */ x27 = f(y, "161"); /* c */ x27 = f(y, "162"); /* c */ x27 = f(y, "163"); /* c */ x27 = f(y, "164"); /* c */ x27 = f(y, "165"); /* c */ x27 = f(y, "166"); /* c */ x27 = f(y, "167"); /* c */ x27 = f(y, "168"); /* c */ x27 = f(y, "169"); /* c */ x27 = f(y, "170"); /* c */ x27 = f(y, "171"); /* c */ x27 = f(y, "172"); /* c */ x27 = f(y, "173"); /* c */ x27 = f(y, "174"); /* c */ x27 = f(y, "175"); /* c */ x27 = f(y, "176"); /* c */ x27 = f(y, "177"); /* c */ x27 = f(y, "178"); /* c */ x27 = f(y, "179"); /* c */ x27 = f(y, "180"); /* c */ x27 = f(y, "181"); /* c */ x27 = f(y, "182"); /* c */ x27 = f(y, "183"); /* c */ x27 = f(y, "184"); /* c */ x27 = f(y, "185"); /* c */ x27 = f(y, "186"); /* c */ x27 = f(y, "187"); /* c */ x27 = f(y, "188"); /* c */ x27 = f(y, "189"); /* c */ x27 = f(y, "190"); /* c */ x27 = f(y, "191"); /* c */ x27 = f(y, "192"); /* c */ x27 = f(y, "193"); /* c */ x27 = f(y, "194"); /* c */ x27 = f(y, "195"); /* c */ x27 = f(y, "196"); /* c */ x27 = f(y, "197"); /* c */ x27 = f(y, "198"); /* c */ x27 = f(y, "199"); /* c */ 
+x28 = f(y, "000"); /* c */ x28 = f(y, "001"); /* c */ x28 = f(y, "002"); /* c */ x28 = f(y, "003"); /* c */ x28 = f(y, "004"); /* c */ x28 = f(y, "005"); /* c */ x28 = f(y, "006"); /* c */ x28 = f(y, "007"); /* c */ x28 = f(y, "008"); /* c */ x28 = f(y, "009"); /* c */ x28 = f(y, "010"); /* c */ x28 = f(y, "011"); /* c */ x28 = f(y, "012"); /* c */ x28 = f(y, "013"); /* c */ x28 = f(y, "014"); /* c */ x28 = f(y, "015"); /* c */ x28 = f(y, "016"); /* c */ x28 = f(y, "017"); /* c */ x28 = f(y, "018"); /* c */ x28 = f(y, "019"); /* c */ x28 = f(y, "020"); /* c */ x28 = f(y, "021"); /* c */ x28 = f(y, "022"); /* c */ x28 = f(y, "023"); /* c */ x28 = f(y, "024"); /* c */ x28 = f(y, "025"); /* c */ x28 = f(y, "026"); /* c */ x28 = f(y, "027"); /* c */ x28 = f(y, "028"); /* c */ x28 = f(y, "029"); /* c */ x28 = f(y, "030"); /* c */ x28 = f(y, "031"); /* c */ x28 = f(y, "032"); /* c */ x28 = f(y, "033"); /* c */ x28 = f(y, "034"); /* c */ x28 = f(y, "035"); /* c */ x28 = f(y, "036"); /* c */ x28 = f(y, "037"); /* c */ x28 = f(y, "038"); /* c */ x28 = f(y, "039"); /* c */ x28 = f(y, "040"); /* c */ x28 = f(y, "041"); /* c */ x28 = f(y, "042"); /* c */ x28 = f(y, "043"); /* c */ x28 = f(y, "044"); /* c */ x28 = f(y, "045"); /* c */ x28 = f(y, "046"); /* c */ x28 = f(y, "047"); /* c */ x28 = f(y, "048"); /* c */ x28 = f(y, "049"); /* c */ x28 = f(y, "050"); /* c */ x28 = f(y, "051"); /* c */ x28 = f(y, "052"); /* c */ x28 = f(y, "053"); /* c */ x28 = f(y, "054"); /* c */ x28 = f(y, "055"); /* c */ x28 = f(y, "056"); /* c */ x28 = f(y, "057"); /* c */ x28 = f(y, "058"); /* c */ x28 = f(y, "059"); /* c */ x28 = f(y, "060"); /* c */ x28 = f(y, "061"); /* c */ x28 = f(y, "062"); /* c */ x28 = f(y, "063"); /* c */ x28 = f(y, "064"); /* c */ x28 = f(y, "065"); /* c */ x28 = f(y, "066"); /* c */ x28 = f(y, "067"); /* c */ x28 = f(y, "068"); /* c */ x28 = f(y, "069"); /* c */ x28 = f(y, "070"); /* c */ x28 = f(y, "071"); /* c */ x28 = f(y, "072"); /* c */ x28 = f(y, "073"); /* c */ x28 = f(y, "074"); /* c */ x28 = f(y, "075"); /* c */ x28 = f(y, "076"); /* c */ x28 = f(y, "077"); /* c */ x28 = f(y, "078"); /* c */ x28 = f(y, "079"); /* c */ x28 = f(y, "080"); /* c */ x28 = f(y, "081"); /* c */ x28 = f(y, "082"); /* c */ x28 = f(y, "083"); /* c */ x28 = f(y, "084"); /* c */ x28 = f(y, "085"); /* c */ x28 = f(y, "086"); /* c */ x28 = f(y, "087"); /* c */ x28 = f(y, "088"); /* c */ x28 = f(y, "089"); /* c */ x28 = f(y, "090"); /* c */ x28 = f(y, "091"); /* c */ x28 = f(y, "092"); /* c */ x28 = f(y, "093"); /* c */ x28 = f(y, "094"); /* c */ x28 = f(y, "095"); /* c */ x28 = f(y, "096"); /* c */ x28 = f(y, "097"); /* c */ x28 = f(y, "098"); /* c */ x28 = f(y, "099"); /* c */ x28 = f(y, "100"); /* c */ x28 = f(y, "101"); /* c */ x28 = f(y, "102"); /* c */ x28 = f(y, "103"); /* c */ x28 = f(y, "104"); /* c */ x28 = f(y, "105"); /* c */ x28 = f(y, "106"); /* c */ x28 = f(y, "107"); /* c */ x28 = f(y, "108"); /* c */ x28 = f(y, "109"); /* c */ x28 = f(y, "110"); /* c */ x28 = f(y, "111"); /* c */ x28 = f(y, "112"); /* c */ x28 = f(y, "113"); /* c */ x28 = f(y, "114"); /* c */ x28 = f(y, "115"); /* c */ x28 = f(y, "116"); /* c */ x28 = f(y, "117"); /* c */ x28 = f(y, "118"); /* c */ x28 = f(y, "119"); /* c */ x28 = f(y, "120"); /* c */ x28 = f(y, "121"); /* c */ x28 = f(y, "122"); /* c */ x28 = f(y, "123"); /* c */ x28 = f(y, "124"); /* c */ x28 = f(y, "125"); /* c */ x28 = f(y, "126"); /* c */ x28 = f(y, "127"); /* c */ x28 = f(y, "128"); /* c */ x28 = f(y, "129"); /* c */ x28 = f(y, "130"); /* c */ x28 = f(y, "131"); /* c */ x28 = f(y, "132"); /* c */ x28 = f(y, "133"); /* c */ x28 = f(y, "134"); /* c */ x28 = f(y, "135"); /* c */ x28 = f(y, "136"); /* c */ x28 = f(y, "137"); /* c */ x28 = f(y, "138"); /* c */ x28 = f(y, "139"); /* c */ x28 = f(y, "140"); /* c */ x28 = f(y, "141"); /* c */ x28 = f(y, "142"); /* c */ x28 = f(y, "143"); /* c */ x28 = f(y, "144"); /* c */ x28 = f(y, "145"); /* c */ x28 = f(y, "146"); /* c */ x28 = f(y, "147"); /* c */ x28 = f(y, "148"); /* c */ x28 = f(y, "149"); /* c */ x28 = f(y, "150"); /* c */ x28 = f(y, "151"); /* c */ x28 = f(y, "152"); /* c */ x28 = f(y, "153"); /* c */ x28 = f(y, "154"); /* c */ x28 = f(y, "155"); /* c */ x28 = f(y, "156"); /* c */ x28 = f(y, "157"); /* c */ x28 = f(y, "158"); /* c */ x28 = f(y, "159"); /* c */ x28 = f(y, "160"); /* c */ x28 = f(y, "161"); /* c */ x28 = f(y, "162"); /* c */ x28 = f(y, "163"); /* c */ x28 = f(y, "164"); /* c */ x28 = f(y, "165"); /* c */ x28 = f(y, "166"); /* c */ x28 = f(y, "167"); /* c */ x28 = f(y, "168"); /* c */ x28 = f(y, "169"); /* c */ x28 = f(y, "170"); /* c */ x28 = f(y, "171"); /* c */ x28 = f(y, "172"); /* c */ x28 = f(y, "173"); /* c */ x28 = f(y, "174"); /* c */ x28 = f(y, "175"); /* c */ x28 = f(y, "176"); /* c */ x28 = f(y, "177"); /* c */ x28 = f(y, "178"); /* c */ x28 = f(y, "179"); /* c */ x28 = f(y, "180"); /* c */ x28 = f(y, "181"); /* c */ x28 = f(y, "182"); /* c */ x28 = f(y, "183"); /* c */ x28 = f(y, "184"); /* c */ x28 = f(y, "185"); /* c */ x28 = f(y, "186"); /* c */ x28 = f(y, "187"); /* c */ x28 = f(y, "188"); /* c */ x28 = f(y, "189"); /* c */ x28 = f(y, "190"); /* c */ x28 = f(y, "191"); /* c */ x28 = f(y, "192"); /* c */ x28 = f(y, "193"); /* c */ x28 = f(y, "194"); /* c */ x28 = f(y, "195"); /* c */ x28 = f(y, "196"); /* c */ x28 = f(y, "197"); /* c */ x28 = f(y, "198"); /* c */ x28 = f(y, "199"); /* c */ 
+x29 = f(y, "000"); /* c */ x29 = f(y, "001"); /* c */ x29 = f(y, "002"); /* c */ x29 = f(y, "003"); /* c */ x29 = f(y, "004"); /* c */ x29 = f(y, "005"); /* c */ x29 = f(y, "006"); /* c */ x29 = f(y, "007"); /* c */ x29 = f(y, "008"); /* c */ x29 = f(y, "009"); /* c */ x29 = f(y, "010"); /* c */ x29 = f(y, "011"); /* c */ x29 = f(y, "012"); /* c */ x29 = f(y, "013"); /* c */ x29 = f(y, "014"); /* c */ x29 = f(y, "015"); /* c */ x29 = f(y, "016"); /* c */ x29 = f(y, "017"); /* c */ x29 = f(y, "018"); /* c */ x29 = f(y, "019"); /* c */ x29 = f(y, "020"); /* c */ x29 = f(y, "021"); /* c */ x29 = f(y, "022"); /* c */ x29 = f(y, "023"); /* c */ x29 = f(y, "024"); /* c */ x29 = f(y, "025"); /* c */ x29 = f(y, "026"); /* c */ x29 = f(y, "027"); /* c */ x29 = f(y, "028"); /* c */ x29 = f(y, "029"); /* c */ x29 = f(y, "030"); /* c */ x29 = f(y, "031"); /* c */ x29 = f(y, "032"); /* c */ x29 = f(y, "033"); /* c */ x29 = f(y, "034"); /* c */ x29 = f(y, "035"); /* c */ x29 = f(y, "036"); /* c */ x29 = f(y, "037"); /* c */ x29 = f(y, "038"); /* c */ x29 = f(y, "039"); /* c */ x29 = f(y, "040"); /* c */ x29 = f(y, "041"); /* c */ x29 = f(y, "042"); /* c */ x29 = f(y, "043"); /* c */ x29 = f(y, "044"); /* c */ x29 = f(y, "045"); /* c */ x29 = f(y, "046"); /* c */ x29 = f(y, "047"); /* c */ x29 = f(y, "048"); /* c */ x29 = f(y, "049"); /* c */ x29 = f(y, "050"); /* c */ x29 = f(y, "051"); /* c */ x29 = f(y, "052"); /* c */ x29 = f(y, "053"); /* c */ x29 = f(y, "054"); /* c */ x29 = f(y, "055"); /* c */ x29 = f(y, "056"); /* c */ x29 = f(y, "057"); /* c */ x29 = f(y, "058"); /* c */ x29 = f(y, "059"); /* c */ x29 = f(y, "060"); /* c */ x29 = f(y, "061"); /* c */ x29 = f(y, "062"); /* c */ x29 = f(y, "063"); /* c */ x29 = f(y, "064"); /* c */ x29 = f(y, "065"); /* c */ x29 = f(y, "066"); /* c */ x29 = f(y, "067"); /* c */ x29 = f(y, "068"); /* c */ x29 = f(y, "069"); /* c */ x29 = f(y, "070"); /* c */ x29 = f(y, "071"); /* c */ x29 = f(y, "072"); /* c */ x29 = f(y, "073"); /* c */ x29 = f(y, "074"); /* c */ x29 = f(y, "075"); /* c */ x29 = f(y, "076"); /* c */ x29 = f(y, "077"); /* c */ x29 = f(y, "078"); /* c */ x29 = f(y, "079"); /* c */ x29 = f(y, "080"); /* c */ x29 = f(y, "081"); /* c */ x29 = f(y, "082"); /* c */ x29 = f(y, "083"); /* c */ x29 = f(y, "084"); /* c */ x29 = f(y, "085"); /* c */ x29 = f(y, "086"); /* c */ x29 = f(y, "087"); /* c */ x29 = f(y, "088"); /* c */ x29 = f(y, "089"); /* c */ x29 = f(y, "090"); /* c */ x29 = f(y, "091"); /* c */ x29 = f(y, "092"); /* c */ x29 = f(y, "093"); /* c */ x29 = f(y, "094"); /* c */ x29 = f(y, "095"); /* c */ x29 = f(y, "096"); /* c */ x29 = f(y, "097"); /* c */ x29 = f(y, "098"); /* c */ x29 = f(y, "099"); /* c */ x29 = f(y, "100"); /* c */ x29 = f(y, "101"); /* c */ x29 = f(y, "102"); /* c */ x29 = f(y, "103"); /* c */ x29 = f(y, "104"); /* c */ x29 = f(y, "105"); /* c */ x29 = f(y, "106"); /* c */ x29 = f(y, "107"); /* c */ x29 = f(y, "108"); /* c */ x29 = f(y, "109"); /* c */ x29 = f(y, "110"); /* c */ x29 = f(y, "111"); /* c */ x29 = f(y, "112"); /* c */ x29 = f(y, "113"); /* c */ x29 = f(y, "114"); /* c */ x29 = f(y, "115"); /* c */ x29 = f(y, "116"); /* c */ x29 = f(y, "117"); /* c */ x29 = f(y, "118"); /* c */ x29 = f(y, "119"); /* c */ x29 = f(y, "120"); /* c */ x29 = f(y, "121"); /* c */ x29 = f(y, "122"); /* c */ x29 = f(y, "123"); /* c */ x29 = f(y, "124"); /* c */ x29 = f(y, "125"); /* c */ x29 = f(y, "126"); /* c */ x29 = f(y, "127"); /* c */ x29 = f(y, "128"); /* c */ x29 = f(y, "129"); /* c */ x29 = f(y, "130"); /* c */ x29 = f(y, "131"); /* c */ x29 = f(y, "132"); /* c */ x29 = f(y, "133"); /* c */ x29 = f(y, "134"); /* c */ x29 = f(y, "135"); /* c */ x29 = f(y, "136"); /* c */ x29 = f(y, "137"); /* c */ x29 = f(y, "138"); /* c */ x29 = f(y, "139"); /* c */ x29 = f(y, "140"); /* c */ x29 = f(y, "141"); /* c */ x29 = f(y, "142"); /* c */ x29 = f(y, "143"); /* c */ x29 = f(y, "144"); /* c */ x29 = f(y, "145"); /* c */ x29 = f(y, "146"); /* c */ x29 = f(y, "147"); /* c */ x29 = f(y, "148"); /* c */ x29 = f(y, "149"); /* c */ x29 = f(y, "150"); /* c */ x29 = f(y, "151"); /* c */ x29 = f(y, "152"); /* c */ x29 = f(y, "153"); /* c */ x29 = f(y, "154"); /* c */ x29 = f(y, "155"); /* c */ x29 = f(y, "156"); /* c */ x29 = f(y, "157"); /* c */ x29 = f(y, "158"); /* c */ x29 = f(y, "159"); /* c */ x29 = f(y, "160"); /* c */ x29 = f(y, "161"); /* c */ x29 = f(y, "162"); /* c */ x29 = f(y, "163"); /* c */ x29 = f(y, "164"); /* c */ x29 = f(y, "165"); /* c */ x29 = f(y, "166"); /* c */ x29 = f(y, "167"); /* c */ x29 = f(y, "168"); /* c */ x29 = f(y, "169"); /* c */ x29 = f(y, "170"); /* c */ x29 = f(y, "171"); /* c */ x29 = f(y, "172"); /* c */ x29 = f(y, "173"); /* c */ x29 = f(y, "174"); /* c */ x29 = f(y, "175"); /* c */ x29 = f(y, "176"); /* c */ x29 = f(y, "177"); /* c */ x29 = f(y, "178"); /* c */ x29 = f(y, "179"); /* c */ x29 = f(y, "180"); /* c */ x29 = f(y, "181"); /* c */ x29 = f(y, "182"); /* c */ x29 = f(y, "183"); /* c */ x29 = f(y, "184"); /* c */ x29 = f(y, "185"); /* c */ x29 = f(y, "186"); /* c */ x29 = f(y, "187"); /* c */ x29 = f(y, "188"); /* c */ x29 = f(y, "189"); /* c */ x29 = f(y, "190"); /* c */ x29 = f(y, "191"); /* c */ x29 = f(y, "192"); /* c */ x29 = f(y, "193"); /* c */ x29 = f(y, "194"); /* c */ x29 = f(y, "195"); /* c */ x29 = f(y, "196"); /* c */ x29 = f(y, "197"); /* c */ x29 = f(y, "198"); /* c */ x29 = f(y, "199"); /* c */ 
+x30 = f(y, "000"); /* c */ x30 = f(y, "001"); /* c */ x30 = f(y, "002"); /* c */ x30 = f(y, "003"); /* c */ x30 = f(y, "004"); /* c */ x30 = f(y, "005"); /* c */ x30 = f(y, "006"); /* c */ x30 = f(y, "007"); /* c */ x30 = f(y, "008"); /* c */ x30 = f(y, "009"); /* c */ x30 = f(y, "010"); /* c */ x30 = f(y, "011"); /* c */ x30 = f(y, "012"); /* c */ x30 = f(y, "013"); /* c */ x30 = f(y, "014"); /* c */ x30 = f(y, "015"); /* c */ x30 = f(y, "016"); /* c */ x30 = f(y, "017"); /* c */ x30 = f(y, "018"); /* c */ x30 = f(y, "019"); /* c */ x30 = f(y, "020"); /* c */ x30 = f(y, "021"); /* c */ x30 = f(y, "022"); /* c */ x30 = f(y, "023"); /* c */ x30 = f(y, "024"); /* c */ x30 = f(y, "025"); /* c */ x30 = f(y, "026"); /* c */ x30 = f(y, "027"); /* c */ x30 = f(y, "028"); /* c */ x30 = f(y, "029"); /* c */ x30 = f(y, "030"); /* c */ x30 = f(y, "031"); /* c */ x30 = f(y, "032"); /* c */ x30 = f(y, "033"); /* c */ x30 = f(y, "034"); /* c */ x30 = f(y, "035"); /* c */ x30 = f(y, "036"); /* c */ x30 = f(y, "037"); /* c */ x30 = f(y, "038"); /* c */ x30 = f(y, "039"); /* c */ x30 = f(y, "040"); /* c */ x30 = f(y, "041"); /* c */ x30 = f(y, "042"); /* c */ x30 = f(y, "043"); /* c */ x30 = f(y, "044"); /* c */ x30 = f(y, "045"); /* c */ x30 = f(y, "046"); /* c */ x30 = f(y, "047"); /* c */ x30 = f(y, "048"); /* c */ x30 = f(y, "049"); /* c */ x30 = f(y, "050"); /* c */ x30 = f(y, "051"); /* c */ x30 = f(y, "052"); /* c */ x30 = f(y, "053"); /* c */ x30 = f(y, "054"); /* c */ x30 = f(y, "055"); /* c */ x30 = f(y, "056"); /* c */ x30 = f(y, "057"); /* c */ x30 = f(y, "058"); /* c */ x30 = f(y, "059"); /* c */ x30 = f(y, "060"); /* c */ x30 = f(y, "061"); /* c */ x30 = f(y, "062"); /* c */ x30 = f(y, "063"); /* c */ x30 = f(y, "064"); /* c */ x30 = f(y, "065"); /* c */ x30 = f(y, "066"); /* c */ x30 = f(y, "067"); /* c */ x30 = f(y, "068"); /* c */ x30 = f(y, "069"); /* c */ x30 = f(y, "070"); /* c */ x30 = f(y, "071"); /* c */ x30 = f(y, "072"); /* c */ x30 = f(y, "073"); /* c */ x30 = f(y, "074"); /* c */ x30 = f(y, "075"); /* c */ x30 = f(y, "076"); /* c */ x30 = f(y, "077"); /* c */ x30 = f(y, "078"); /* c */ x30 = f(y, "079"); /* c */ x30 = f(y, "080"); /* c */ x30 = f(y, "081"); /* c */ x30 = f(y, "082"); /* c */ x30 = f(y, "083"); /* c */ x30 = f(y, "084"); /* c */ x30 = f(y, "085"); /* c */ x30 = f(y, "086"); /* c */ x30 = f(y, "087"); /* c */ x30 = f(y, "088"); /* c */ x30 = f(y, "089"); /* c */ x30 = f(y, "090"); /* c */ x30 = f(y, "091"); /* c */ x30 = f(y, "092"); /* c */ x30 = f(y, "093"); /* c */ x30 = f(y, "094"); /* c */ x30 = f(y, "095"); /* c */ x30 = f(y, "096"); /* c */ x30 = f(y, "097"); /* c */ x30 = f(y, "098"); /* c */ x30 = f(y, "099"); /* c */ x30 = f(y, "100"); /* c */ x30 = f(y, "101"); /* c */ x30 = f(y, "102"); /* c */ x30 = f(y, "103"); /* c */ x30 = f(y, "104"); /* c */ x30 = f(y, "105"); /* c */ x30 = f(y, "106"); /* c */ x30 = f(y, "107"); /* c */ x30 = f(y, "108"); /* c */ x30 = f(y, "109"); /* c */ x30 = f(y, "110"); /* c */ x30 = f(y, "111"); /* c */ x30 = f(y, "112"); /* c */ x30 = f(y, "113"); /* c */ x30 = f(y, "114"); /* c */ x30 = f(y, "115"); /* c */ x30 = f(y, "116"); /* c */ x30 = f(y, "117"); /* c */ x30 = f(y, "118"); /* c */ x30 = f(y, "119"); /* c */ x30 = f(y, "120"); /* c */ x30 = f(y, "121"); /* c */ x30 = f(y, "122"); /* c */ x30 = f(y, "123"); /* c */ x30 = f(y, "124"); /* c */ x30 = f(y, "125"); /* c */ x30 = f(y, "126"); /* c */ x30 = f(y, "127"); /* c */ x30 = f(y, "128"); /* c */ x30 = f(y, "129"); /* c */ x30 = f(y, "130"); /* c */ x30 = f(y, "131"); /* c */ x30 = f(y, "132"); /* c */ x30 = f(y, "133"); /* c */ x30 = f(y, "134"); /* c */ x30 = f(y, "135"); /* c */ x30 = f(y, "136"); /* c */ x30 = f(y, "137"); /* c */ x30 = f(y, "138"); /* c */ x30 = f(y, "139"); /* c */ x30 = f(y, "140"); /* c */ x30 = f(y, "141"); /* c */ x30 = f(y, "142"); /* c */ x30 = f(y, "143"); /* c */ x30 = f(y, "144"); /* c */ x30 = f(y, "145"); /* c */ x30 = f(y, "146"); /* c */ x30 = f(y, "147"); /* c */ x30 = f(y, "148"); /* c */ x30 = f(y, "149"); /* c */ x30 = f(y, "150"); /* c */ x30 = f(y, "151"); /* c */ x30 = f(y, "152"); /* c */ x30 = f(y, "153"); /* c */ x30 = f(y, "154"); /* c */ x30 = f(y, "155"); /* c */ x30 = f(y, "156"); /* c */ x30 = f(y, "157"); /* c */ x30 = f(y, "158"); /* c */ x30 = f(y, "159"); /* c */ x30 = f(y, "160"); /* c */ x30 = f(y, "161"); /* c */ x30 = f(y, "162"); /* c */ x30 = f(y, "163"); /* c */ x30 = f(y, "164"); /* c */ x30 = f(y, "165"); /* c */ x30 = f(y, "166"); /* c */ x30 = f(y, "167"); /* c */ x30 = f(y, "168"); /* c */ x30 = f(y, "169"); /* c */ x30 = f(y, "170"); /* c */ x30 = f(y, "171"); /* c */ x30 = f(y, "172"); /* c */ x30 = f(y, "173"); /* c */ x30 = f(y, "174"); /* c */ x30 = f(y, "175"); /* c */ x30 = f(y, "176"); /* c */ x30 = f(y, "177"); /* c */ x30 = f(y, "178"); /* c */ x30 = f(y, "179"); /* c */ x30 = f(y, "180"); /* c */ x30 = f(y, "181"); /* c */ x30 = f(y, "182"); /* c */ x30 = f(y, "183"); /* c */ x30 = f(y, "184"); /* c */ x30 = f(y, "185"); /* c */ x30 = f(y, "186"); /* c */ x30 = f(y, "187"); /* c */ x30 = f(y, "188"); /* c */ x30 = f(y, "189"); /* c */ x30 = f(y, "190"); /* c */ x30 = f(y, "191"); /* c */ x30 = f(y, "192"); /* c */ x30 = f(y, "193"); /* c */ x30 = f(y, "194"); /* c */ x30 = f(y, "195"); /* c */ x30 = f(y, "196"); /* c */ x30 = f(y, "197"); /* c */ x30 = f(y, "198"); /* c */ x30 = f(y, "199"); /* c */ 
+x31 = f(y, "000"); /* c */ x31 = f(y, "001"); /* c */ x31 = f(y, "002"); /* c */ x31 = f(y, "003"); /* c */ x31 = f(y, "004"); /* c */ x31 = f(y, "005"); /* c */ x31 = f(y, "006"); /* c */ x31 = f(y, "007"); /* c */ x31 = f(y, "008"); /* c */ x31 = f(y, "009"); /* c */ x31 = f(y, "010"); /* c */ x31 = f(y, "011"); /* c */ x31 = f(y, "012"); /* c */ x31 = f(y, "013"); /* c */ x31 = f(y, "014"); /* c */ x31 = f(y, "015"); /* c */ x31 = f(y, "016"); /* c */ x31 = f(y, "017"); /* c */ x31 = f(y, "018"); /* c */ x31 = f(y, "019"); /* c */ x31 = f(y, "020"); /* c */ x31 = f(y, "021"); /* c */ x31 = f(y, "022"); /* c */ x31 = f(y, "023"); /* c */ x31 = f(y, "024"); /* c */ x31 = f(y, "025"); /* c */ x31 = f(y, "026"); /* c */ x31 = f(y, "027"); /* c */ x31 = f(y, "028"); /* c */ x31 = f(y, "029"); /* c */ x31 = f(y, "030"); /* c */ x31 = f(y, "031"); /* c */ x31 = f(y, "032"); /* c */ x31 = f(y, "033"); /* c */ x31 = f(y, "034"); /* c */ x31 = f(y, "035"); /* c */ x31 = f(y, "036"); /* c */ x31 = f(y, "037"); /* c */ x31 = f(y, "038"); /* c */ x31 = f(y, "039"); /* c */ x31 = f(y, "040"); /* c */ x31 = f(y, "041"); /* c */ x31 = f(y, "042"); /* c */ x31 = f(y, "043"); /* c */ x31 = f(y, "044"); /* c */ x31 = f(y, "045"); /* c */ x31 = f(y, "046"); /* c */ x31 = f(y, "047"); /* c */ x31 = f(y, "048"); /* c */ x31 = f(y, "049"); /* c */ x31 = f(y, "050"); /* c */ x31 = f(y, "051"); /* c */ x31 = f(y, "052"); /* c */ x31 = f(y, "053"); /* c */ x31 = f(y, "054"); /* c */ x31 = f(y, "055"); /* c */ x31 = f(y, "056"); /* c */ x31 = f(y, "057"); /* c */ x31 = f(y, "058"); /* c */ x31 = f(y, "059"); /* c */ x31 = f(y, "060"); /* c */ x31 = f(y, "061"); /* c */ x31 = f(y, "062"); /* c */ x31 = f(y, "063"); /* c */ x31 = f(y, "064"); /* c */ x31 = f(y, "065"); /* c */ x31 = f(y, "066"); /* c */ x31 = f(y, "067"); /* c */ x31 = f(y, "068"); /* c */ x31 = f(y, "069"); /* c */ x31 = f(y, "070"); /* c */ x31 = f(y, "071"); /* c */ x31 = f(y, "072"); /* c */ x31 = f(y, "073"); /* c */ x31 = f(y, "074"); /* c */ x31 = f(y, "075"); /* c */ x31 = f(y, "076"); /* c */ x31 = f(y, "077"); /* c */ x31 = f(y, "078"); /* c */ x31 = f(y, "079"); /* c */ x31 = f(y, "080"); /* c */ x31 = f(y, "081"); /* c */ x31 = f(y, "082"); /* c */ x31 = f(y, "083"); /* c */ x31 = f(y, "084"); /* c */ x31 = f(y, "085"); /* c */ x31 = f(y, "086"); /* c */ x31 = f(y, "087"); /* c */ x31 = f(y, "088"); /* c */ x31 = f(y, "089"); /* c */ x31 = f(y, "090"); /* c */ x31 = f(y, "091"); /* c */ x31 = f(y, "092"); /* c */ x31 = f(y, "093"); /* c */ x31 = f(y, "094"); /* c */ x31 = f(y, "095"); /* c */ x31 = f(y, "096"); /* c */ x31 = f(y, "097"); /* c */ x31 = f(y, "098"); /* c */ x31 = f(y, "099"); /* c */ x31 = f(y, "100"); /* c */ x31 = f(y, "101"); /* c */ x31 = f(y, "102"); /* c */ x31 = f(y, "103"); /* c */ x31 = f(y, "104"); /* c */ x31 = f(y, "105"); /* c */ x31 = f(y, "106"); /* c */ x31 = f(y, "107"); /* c */ x31 = f(y, "108"); /* c */ x31 = f(y, "109"); /* c */ x31 = f(y, "110"); /* c */ x31 = f(y, "111"); /* c */ x31 = f(y, "112"); /* c */ x31 = f(y, "113"); /* c */ x31 = f(y, "114"); /* c */ x31 = f(y, "115"); /* c */ x31 = f(y, "116"); /* c */ x31 = f(y, "117"); /* c */ x31 = f(y, "118"); /* c */ x31 = f(y, "119"); /* c */ x31 = f(y, "120"); /* c */ x31 = f(y, "121"); /* c */ x31 = f(y, "122"); /* c */ x31 = f(y, "123"); /* c */ x31 = f(y, "124"); /* c */ x31 = f(y, "125"); /* c */ x31 = f(y, "126"); /* c */ x31 = f(y, "127"); /* c */ x31 = f(y, "128"); /* c */ x31 = f(y, "129"); /* c */ x31 = f(y, "130"); /* c */ x31 = f(y, "131"); /* c */ x31 = f(y, "132"); /* c */ x31 = f(y, "133"); /* c */ x31 = f(y, "134"); /* c */ x31 = f(y, "135"); /* c */ x31 = f(y, "136"); /* c */ x31 = f(y, "137"); /* c */ x31 = f(y, "138"); /* c */ x31 = f(y, "139"); /* c */ x31 = f(y, "140"); /* c */ x31 = f(y, "141"); /* c */ x31 = f(y, "142"); /* c */ x31 = f(y, "143"); /* c */ x31 = f(y, "144"); /* c */ x31 = f(y, "145"); /* c */ x31 = f(y, "146"); /* c */ x31 = f(y, "147"); /* c */ x31 = f(y, "148"); /* c */ x31 = f(y, "149"); /* c */ x31 = f(y, "150"); /* c */ x31 = f(y, "151"); /* c */ x31 = f(y, "152"); /* c */ x31 = f(y, "153"); /* c */ x31 = f(y, "154"); /* c */ x31 = f(y, "155"); /* c */ x31 = f(y, "156"); /* c */ x31 = f(y, "157"); /* c */ x31 = f(y, "158"); /* c */ x31 = f(y, "159"); /* c */ x31 = f(y, "160"); /* c */ x31 = f(y, "161"); /* c */ x31 = f(y, "162"); /* c */ x31 = f(y, "163"); /* c */ x31 = f(y, "164"); /* c */ x31 = f(y, "165"); /* c */ x31 = f(y, "166"); /* c */ x31 = f(y, "167"); /* c */ x31 = f(y, "168"); /* c */ x31 = f(y, "169"); /* c */ x31 = f(y, "170"); /* c */ x31 = f(y, "171"); /* c */ x31 = f(y, "172"); /* c */ x31 = f(y, "173"); /* c */ x31 = f(y, "174"); /* c */ x31 = f(y, "175"); /* c */ x31 = f(y, "176"); /* c */ x31 = f(y, "177"); /* c */ x31 = f(y, "178"); /* c */ x31 = f(y, "179"); /* c */ x31 = f(y, "180"); /* c */ x31 = f(y, "181"); /* c */ x31 = f(y, "182"); /* c */ x31 = f(y, "183"); /* c */ x31 = f(y, "184"); /* c */ x31 = f(y, "185"); /* c */ x31 = f(y, "186"); /* c */ x31 = f(y, "187"); /* c */ x31 = f(y, "188"); /* c */ x31 = f(y, "189"); /* c */ x31 = f(y, "190"); /* c */ x31 = f(y, "191"); /* c */ x31 = f(y, "192"); /* c */ x31 = f(y, "193"); /* c */ x31 = f(y, "194"); /* c */ x31 = f(y, "195"); /* c */ x31 = f(y, "196"); /* c */ x31 = f(y, "197"); /* c */ x31 = f(y, "198"); /* c */ x31 = f(y, "199"); /* c */ 
+x32 = f(y, "000"); /* c */ x32 = f(y, "001"); /* c */ x32 = f(y, "002"); /* c */ x32 = f(y, "003"); /* c */ x32 = f(y, "004"); /* c */ x32 = f(y, "005"); /* c */ x32 = f(y, "006"); /* c */ x32 = f(y, "007"); /* c */ x32 = f(y, "008"); /* c */ x32 = f(y, "009"); /* c */ x32 = f(y, "010"); /* c */ x32 = f(y, "011"); /* c */ x32 = f(y, "012"); /* c */ x32 = f(y, "013"); /* c */ x32 = f(y, "014"); /* c */ x32 = f(y, "015"); /* c */ x32 = f(y, "016"); /* c */ x32 = f(y, "017"); /* c */ x32 = f(y, "018"); /* c */ x32 = f(y, "019"); /* c */ x32 = f(y, "020"); /* c */ x32 = f(y, "021"); /* c */ x32 = f(y, "022"); /* c */ x32 = f(y, "023"); /* c */ x32 = f(y, "024"); /* c */ x32 = f(y, "025"); /* c */ x32 = f(y, "026"); /* c */ x32 = f(y, "027"); /* c */ x32 = f(y, "028"); /* c */ x32 = f(y, "029"); /* c */ x32 = f(y, "030"); /* c */ x32 = f(y, "031"); /* c */ x32 = f(y, "032"); /* c */ x32 = f(y, "033"); /* c */ x32 = f(y, "034"); /* c */ x32 = f(y, "035"); /* c */ x32 = f(y, "036"); /* c */ x32 = f(y, "037"); /* c */ x32 = f(y, "038"); /* c */ x32 = f(y, "039"); /* c */ x32 = f(y, "040"); /* c */ x32 = f(y, "041"); /* c */ x32 = f(y, "042"); /* c */ x32 = f(y, "043"); /* c */ x32 = f(y, "044"); /* c */ x32 = f(y, "045"); /* c */ x32 = f(y, "046"); /* c */ x32 = f(y, "047"); /* c */ x32 = f(y, "048"); /* c */ x32 = f(y, "049"); /* c */ x32 = f(y, "050"); /* c */ x32 = f(y, "051"); /* c */ x32 = f(y, "052"); /* c */ x32 = f(y, "053"); /* c */ x32 = f(y, "054"); /* c */ x32 = f(y, "055"); /* c */ x32 = f(y, "056"); /* c */ x32 = f(y, "057"); /* c */ x32 = f(y, "058"); /* c */ x32 = f(y, "059"); /* c */ x32 = f(y, "060"); /* c */ x32 = f(y, "061"); /* c */ x32 = f(y, "062"); /* c */ x32 = f(y, "063"); /* c */ x32 = f(y, "064"); /* c */ x32 = f(y, "065"); /* c */ x32 = f(y, "066"); /* c */ x32 = f(y, "067"); /* c */ x32 = f(y, "068"); /* c */ x32 = f(y, "069"); /* c */ x32 = f(y, "070"); /* c */ x32 = f(y, "071"); /* c */ x32 = f(y, "072"); /* c */ x32 = f(y, "073"); /* c */ x32 = f(y, "074"); /* c */ x32 = f(y, "075"); /* c */ x32 = f(y, "076"); /* c */ x32 = f(y, "077"); /* c */ x32 = f(y, "078"); /* c */ x32 = f(y, "079"); /* c */ x32 = f(y, "080"); /* c */ x32 = f(y, "081"); /* c */ x32 = f(y, "082"); /* c */ x32 = f(y, "083"); /* c */ x32 = f(y, "084"); /* c */ x32 = f(y, "085"); /* c */ x32 = f(y, "086"); /* c */ x32 = f(y, "087"); /* c */ x32 = f(y, "088"); /* c */ x32 = f(y, "089"); /* c */ x32 = f(y, "090"); /* c */ x32 = f(y, "091"); /* c */ x32 = f(y, "092"); /* c */ x32 = f(y, "093"); /* c */ x32 = f(y, "094"); /* c */ x32 = f(y, "095"); /* c */ x32 = f(y, "096"); /* c */ x32 = f(y, "097"); /* c */ x32 = f(y, "098"); /* c */ x32 = f(y, "099"); /* c */ x32 = f(y, "100"); /* c */ x32 = f(y, "101"); /* c */ x32 = f(y, "102"); /* c */ x32 = f(y, "103"); /* c */ x32 = f(y, "104"); /* c */ x32 = f(y, "105"); /* c */ x32 = f(y, "106"); /* c */ x32 = f(y, "107"); /* c */ x32 = f(y, "108"); /* c */ x32 = f(y, "109"); /* c */ x32 = f(y, "110"); /* c */ x32 = f(y, "111"); /* c */ x32 = f(y, "112"); /* c */ x32 = f(y, "113"); /* c */ x32 = f(y, "114"); /* c */ x32 = f(y, "115"); /* c */ x32 = f(y, "116"); /* c */ x32 = f(y, "117"); /* c */ x32 = f(y, "118"); /* c */ x32 = f(y, "119"); /* c */ x32 = f(y, "120"); /* c */ x32 = f(y, "121"); /* c */ x32 = f(y, "122"); /* c */ x32 = f(y, "123"); /* c */ x32 = f(y, "124"); /* c */ x32 = f(y, "125"); /* c */ x32 = f(y, "126"); /* c */ x32 = f(y, "127"); /* c */ x32 = f(y, "128"); /* c */ x32 = f(y, "129"); /* c */ x32 = f(y, "130"); /* c */ x32 = f(y, "131"); /* c */ x32 = f(y, "132"); /* c */ x32 = f(y, "133"); /* c */ x32 = f(y, "134"); /* c */ x32 = f(y, "135"); /* c */ x32 = f(y, "136"); /* c */ x32 = f(y, "137"); /* c */ x32 = f(y, "138"); /* c */ x32 = f(y, "139"); /* c */ x32 = f(y, "140"); /* c */ x32 = f(y, "141"); /* c */ x32 = f(y, "142"); /* c */ x32 = f(y, "143"); /* c */ x32 = f(y, "144"); /* c */ x32 = f(y, "145"); /* c */ x32 = f(y, "146"); /* c */ x32 = f(y, "147"); /* c */ x32 = f(y, "148"); /* c */ x32 = f(y, "149"); /* c */ x32 = f(y, "150"); /* c */ x32 = f(y, "151"); /* c */ x32 = f(y, "152"); /* c */ x32 = f(y, "153"); /* c */ x32 = f(y, "154"); /* c */ x32 = f(y, "155"); /* c */ x32 = f(y, "156"); /* c */ x32 = f(y, "157"); /* c */ x32 = f(y, "158"); /* c */ x32 = f(y, "159"); /* c */ x32 = f(y, "160"); /* c */ x32 = f(y, "161"); /* c */ x32 = f(y, "162"); /* c */ x32 = f(y, "163"); /* c */ x32 = f(y, "164"); /* c */ x32 = f(y, "165"); /* c */ x32 = f(y, "166"); /* c */ x32 = f(y, "167"); /* c */ x32 = f(y, "168"); /* c */ x32 = f(y, "169"); /* c */ x32 = f(y, "170"); /* c */ x32 = f(y, "171"); /* c */ x32 = f(y, "172"); /* c */ x32 = f(y, "173"); /* c */ x32 = f(y, "174"); /* c */ x32 = f(y, "175"); /* c */ x32 = f(y, "176"); /* c */ x32 = f(y, "177"); /* c */ x32 = f(y, "178"); /* c */ x32 = f(y, "179"); /* c */ x32 = f(y, "180"); /* c */ x32 = f(y, "181"); /* c */ x32 = f(y, "182"); /* c */ x32 = f(y, "183"); /* c */ x32 = f(y, "184"); /* c */ x32 = f(y, "185"); /* c */ x32 = f(y, "186"); /* c */ x32 = f(y, "187"); /* c */ x32 = f(y, "188"); /* c */ x32 = f(y, "189"); /* c */ x32 = f(y, "190"); /* c */ x32 = f(y, "191"); /* c */ x32 = f(y, "192"); /* c */ x32 = f(y, "193"); /* c */ x32 = f(y, "194"); /* c */ x32 = f(y, "195"); /* c */ x32 = f(y, "196"); /* c */ x32 = f(y, "197"); /* c */ x32 = f(y, "198"); /* c */ x32 = f(y, "199"); /* c */ 
+x33 = f(y, "000"); /* c */ x33 = f(y, "001"); /* c */ x33 = f(y, "002"); /* c */ x33 = f(y, "003"); /* c */ x33 = f(y, "004"); /* c */ x33 = f(y, "005"); /* c */ x33 = f(y, "006"); /* c */ x33 = f(y, "007"); /* c */ x33 = f(y, "008"); /* c */ x33 = f(y, "009"); /* c */ x33 = f(y, "010"); /* c */ x33 = f(y, "011"); /* c */ x33 = f(y, "012"); /* c */ x33 = f(y, "013"); /* c */ x33 = f(y, "014"); /* c */ x33 = f(y, "015"); /* c */ x33 = f(y, "016"); /* c */ x33 = f(y, "017"); /* c */ x33 = f(y, "018"); /* c */ x33 = f(y, "019"); /* c */ x33 = f(y, "020"); /* c */ x33 = f(y, "021"); /* c */ x33 = f(y, "022"); /* c */ x33 = f(y, "023"); /* c */ x33 = f(y, "024"); /* c */ x33 = f(y, "025"); /* c */ x33 = f(y, "026"); /* c */ x33 = f(y, "027"); /* c */ x33 = f(y, "028"); /* c */ x33 = f(y, "029"); /* c */ x33 = f(y, "030"); /* c */ x33 = f(y, "031"); /* c */ x33 = f(y, "032"); /* c */ x33 = f(y, "033"); /* c */ x33 = f(y, "034"); /* c */ x33 = f(y, "035"); /* c */ x33 = f(y, "036"); /* c */ x33 = f(y, "037"); /* c */ x33 = f(y, "038"); /* c */ x33 = f(y, "039"); /* c */ x33 = f(y, "040"); /* c */ x33 = f(y, "041"); /* c */ x33 = f(y, "042"); /* c */ x33 = f(y, "043"); /* c */ x33 = f(y, "044"); /* c */ x33 = f(y, "045"); /* c */ x33 = f(y, "046"); /* c */ x33 = f(y, "047"); /* c */ x33 = f(y, "048"); /* c */ x33 = f(y, "049"); /* c */ x33 = f(y, "050"); /* c */ x33 = f(y, "051"); /* c */ x33 = f(y, "052"); /* c */ x33 = f(y, "053"); /* c */ x33 = f(y, "054"); /* c */ x33 = f(y, "055"); /* c */ x33 = f(y, "056"); /* c */ x33 = f(y, "057"); /* c */ x33 = f(y, "058"); /* c */ x33 = f(y, "059"); /* c */ x33 = f(y, "060"); /* c */ x33 = f(y, "061"); /* c */ x33 = f(y, "062"); /* c */ x33 = f(y, "063"); /* c */ x33 = f(y, "064"); /* c */ x33 = f(y, "065"); /* c */ x33 = f(y, "066"); /* c */ x33 = f(y, "067"); /* c */ x33 = f(y, "068"); /* c */ x33 = f(y, "069"); /* c */ x33 = f(y, "070"); /* c */ x33 = f(y, "071"); /* c */ x33 = f(y, "072"); /* c */ x33 = f(y, "073"); /* c */ x33 = f(y, "074"); /* c */ x33 = f(y, "075"); /* c */ x33 = f(y, "076"); /* c */ x33 = f(y, "077"); /* c */ x33 = f(y, "078"); /* c */ x33 = f(y, "079"); /* c */ x33 = f(y, "080"); /* c */ x33 = f(y, "081"); /* c */ x33 = f(y, "082"); /* c */ x33 = f(y, "083"); /* c */ x33 = f(y, "084"); /* c */ x33 = f(y, "085"); /* c */ x33 = f(y, "086"); /* c */ x33 = f(y, "087"); /* c */ x33 = f(y, "088"); /* c */ x33 = f(y, "089"); /* c */ x33 = f(y, "090"); /* c */ x33 = f(y, "091"); /* c */ x33 = f(y, "092"); /* c */ x33 = f(y, "093"); /* c */ x33 = f(y, "094"); /* c */ x33 = f(y, "095"); /* c */ x33 = f(y, "096"); /* c */ x33 = f(y, "097"); /* c */ x33 = f(y, "098"); /* c */ x33 = f(y, "099"); /* c */ x33 = f(y, "100"); /* c */ x33 = f(y, "101"); /* c */ x33 = f(y, "102"); /* c */ x33 = f(y, "103"); /* c */ x33 = f(y, "104"); /* c */ x33 = f(y, "105"); /* c */ x33 = f(y, "106"); /* c */ x33 = f(y, "107"); /* c */ x33 = f(y, "108"); /* c */ x33 = f(y, "109"); /* c */ x33 = f(y, "110"); /* c */ x33 = f(y, "111"); /* c */ x33 = f(y, "112"); /* c */ x33 = f(y, "113"); /* c */ x33 = f(y, "114"); /* c */ x33 = f(y, "115"); /* c */ x33 = f(y, "116"); /* c */ x33 = f(y, "117"); /* c */ x33 = f(y, "118"); /* c */ x33 = f(y, "119"); /* c */ x33 = f(y, "120"); /* c */ x33 = f(y, "121"); /* c */ x33 = f(y, "122"); /* c */ x33 = f(y, "123"); /* c */ x33 = f(y, "124"); /* c */ x33 = f(y, "125"); /* c */ x33 = f(y, "126"); /* c */ x33 = f(y, "127"); /* c */ x33 = f(y, "128"); /* c */ x33 = f(y, "129"); /* c */ x33 = f(y, "130"); /* c */ x33 = f(y, "131"); /* c */ x33 = f(y, "132"); /* c */ x33 = f(y, "133"); /* c */ x33 = f(y, "134"); /* c */ x33 = f(y, "135"); /* c */ x33 = f(y, "136"); /* c */ x33 = f(y, "137"); /* c */ x33 = f(y, "138"); /* c */ x33 = f(y, "139"); /* c */ x33 = f(y, "140"); /* c */ x33 = f(y, "141"); /* c */ x33 = f(y, "142"); /* c */ x33 = f(y, "143"); /* c */ x33 = f(y, "144"); /* c */ x33 = f(y, "145"); /* c */ x33 = f(y, "146"); /* c */ x33 = f(y, "147"); /* c */ x33 = f(y, "148"); /* c */ x33 = f(y, "149"); /* c */ x33 = f(y, "150"); /* c */ x33 = f(y, "151"); /* c */ x33 = f(y, "152"); /* c */ x33 = f(y, "153"); /* c */ x33 = f(y, "154"); /* c */ x33 = f(y, "155"); /* c */ x33 = f(y, "156"); /* c */ x33 = f(y, "157"); /* c */ x33 = f(y, "158"); /* c */ x33 = f(y, "159"); /* c */ x33 = f(y, "160"); /* c */ x33 = f(y, "161"); /* c */ x33 = f(y, "162"); /* c */ x33 = f(y, "163"); /* c */ x33 = f(y, "164"); /* c */ x33 = f(y, "165"); /* c */ x33 = f(y, "166"); /* c */ x33 = f(y, "167"); /* c */ x33 = f(y, "168"); /* c */ x33 = f(y, "169"); /* c */ x33 = f(y, "170"); /* c */ x33 = f(y, "171"); /* c */ x33 = f(y, "172"); /* c */ x33 = f(y, "173"); /* c */ x33 = f(y, "174"); /* c */ x33 = f(y, "175"); /* c */ x33 = f(y, "176"); /* c */ x33 = f(y, "177"); /* c */ x33 = f(y, "178"); /* c */ x33 = f(y, "179"); /* c */ x33 = f(y, "180"); /* c */ x33 = f(y, "181"); /* c */ x33 = f(y, "182"); /* c */ x33 = f(y, "183"); /* c */ x33 = f(y, "184"); /* c */ x33 = f(y, "185"); /* c */ x33 = f(y, "186"); /* c */ x33 = f(y, "187"); /* c */ x33 = f(y, "188"); /* c */ x33 = f(y, "189"); /* c */ x33 = f(y, "190"); /* c */ x33 = f(y, "191"); /* c */ x33 = f(y, "192"); /* c */ x33 = f(y, "193"); /* c */ x33 = f(y, "194"); /* c */ x33 = f(y, "195"); /* c */ x33 = f(y, "196"); /* c */ x33 = f(y, "197"); /* c */ x33 = f(y, "198"); /* c */ x33 = f(y, "199"); /* c */ 
+x34 = f(y, "000"); /* c */ x34 = f(y, "001"); /* c */ x34 = f(y, "002"); /* c */ x34 = f(y, "003"); /* c */ x34 = f(y, "004"); /* c */ x34 = f(y, "005"); /* c */ x34 = f(y, "006"); /* c */ x34 = f(y, "007"); /* c */ x34 = f(y, "008"); /* c */ x34 = f(y, "009"); /* c */ x34 = f(y, "010"); /* c */ x34 = f(y, "011"); /* c */ x34 = f(y, "012"); /* c */ x34 = f(y, "013"); /* c */ x34 = f(y, "014"); /* c */ x34 = f(y, "015"); /* c */ x34 = f(y, "016"); /* c */ x34 = f(y, "017"); /* c */ x34 = f(y, "018"); /* c */ x34 = f(y, "019"); /* c */ x34 = f(y, "020"); /* c */ x34 = f(y, "021"); /* c */ x34 = f(y, "022"); /* c */ x34 = f(y, "023"); /* c */ x34 = f(y, "024"); /* c */ x34 = f(y, "025"); /* c */ x34 = f(y, "026"); /* c */ x34 = f(y, "027"); /* c */ x34 = f(y, "028"); /* c */ x34 = f(y, "029"); /* c */ x34 = f(y, "030"); /* c */ x34 = f(y, "031"); /* c */ x34 = f(y, "032"); /* c */ x34 = f(y, "033"); /* c */ x34 = f(y, "034"); /* c */ x34 = f(y, "035"); /* c */ x34 = f(y, "036"); /* c */ x34 = f(y, "037"); /* c */ x34 = f(y, "038"); /* c */ x34 = f(y, "039"); /* c */ x34 = f(y, "040"); /* c */ x34 = f(y, "041"); /* c */ x34 = f(y, "042"); /* c */ x34 = f(y, "043"); /* c */ x34 = f(y, "044"); /* c */ x34 = f(y, "045"); /* c */ x34 = f(y, "046"); /* c */ x34 = f(y, "047"); /* c */ x34 = f(y, "048"); /* c */ x34 = f(y, "049"); /* c */ x34 = f(y, "050"); /* c */ x34 = f(y, "051"); /* c */ x34 = f(y, "052"); /* c */ x34 = f(y, "053"); /* c */ x34 = f(y, "054"); /* c */ x34 = f(y, "055"); /* c */ x34 = f(y, "056"); /* c */ x34 = f(y, "057"); /* c */ x34 = f(y, "058"); /* c */ x34 = f(y, "059"); /* c */ x34 = f(y, "060"); /* c */ x34 = f(y, "061"); /* c */ x34 = f(y, "062"); /* c */ x34 = f(y, "063"); /* c */ x34 = f(y, "064"); /* c */ x34 = f(y, "065"); /* c */ x34 = f(y, "066"); /* c */ x34 = f(y, "067"); /* c */ x34 = f(y, "068"); /* c */ x34 = f(y, "069"); /* c */ x34 = f(y, "070"); /* c */ x34 = f(y, "071"); /* c */ x34 = f(y, "072"); /* c */ x34 = f(y, "073"); /* c */ x34 = f(y, "074"); /* c */ x34 = f(y, "075"); /* c */ x34 = f(y, "076"); /* c */ x34 = f(y, "077"); /* c */ x34 = f(y, "078"); /* c */ x34 = f(y, "079"); /* c */ x34 = f(y, "080"); /* c */ x34 = f(y, "081"); /* c */ x34 = f(y, "082"); /* c */ x34 = f(y, "083"); /* c */ x34 = f(y, "084"); /* c */ x34 = f(y, "085"); /* c */ x34 = f(y, "086"); /* c */ x34 = f(y, "087"); /* c */ x34 = f(y, "088"); /* c */ x34 = f(y, "089"); /* c */ x34 = f(y, "090"); /* c */ x34 = f(y, "091"); /* c */ x34 = f(y, "092"); /* c */ x34 = f(y, "093"); /* c */ x34 = f(y, "094"); /* c */ x34 = f(y, "095"); /* c */ x34 = f(y, "096"); /* c */ x34 = f(y, "097"); /* c */ x34 = f(y, "098"); /* c */ x34 = f(y, "099"); /* c */ x34 = f(y, "100"); /* c */ x34 = f(y, "101"); /* c */ x34 = f(y, "102"); /* c */ x34 = f(y, "103"); /* c */ x34 = f(y, "104"); /* c */ x34 = f(y, "105"); /* c */ x34 = f(y, "106"); /* c */ x34 = f(y, "107"); /* c */ x34 = f(y, "108"); /* c */ x34 = f(y, "109"); /* c */ x34 = f(y, "110"); /* c */ x34 = f(y, "111"); /* c */ x34 = f(y, "112"); /* c */ x34 = f(y, "113"); /* c */ x34 = f(y, "114"); /* c */ x34 = f(y, "115"); /* c */ x34 = f(y, "116"); /* c */ x34 = f(y, "117"); /* c */ x34 = f(y, "118"); /* c */ x34 = f(y, "119"); /* c */ x34 = f(y, "120"); /* c */ x34 = f(y, "121"); /* c */ x34 = f(y, "122"); /* c */ x34 = f(y, "123"); /* c */ x34 = f(y, "124"); /* c */ x34 = f(y, "125"); /* c */ x34 = f(y, "126"); /* c */ x34 = f(y, "127"); /* c */ x34 = f(y, "128"); /* c */ x34 = f(y, "129"); /* c */ x34 = f(y, "130"); /* c */ x34 = f(y, "131"); /* c */ x34 = f(y, "132"); /* c */ x34 = f(y, "133"); /* c */ x34 = f(y, "134"); /* c */ x34 = f(y, "135"); /* c */ x34 = f(y, "136"); /* c */ x34 = f(y, "137"); /* c */ x34 = f(y, "138"); /* c */ x34 = f(y, "139"); /* c */ x34 = f(y, "140"); /* c */ x34 = f(y, "141"); /* c */ x34 = f(y, "142"); /* c */ x34 = f(y, "143"); /* c */ x34 = f(y, "144"); /* c */ x34 = f(y, "145"); /* c */ x34 = f(y, "146"); /* c */ x34 = f(y, "147"); /* c */ x34 = f(y, "148"); /* c */ x34 = f(y, "149"); /* c */ x34 = f(y, "150"); /* c */ x34 = f(y, "151"); /* c */ x34 = f(y, "152"); /* c */ x34 = f(y, "153"); /* c */ x34 = f(y, "154"); /* c */ x34 = f(y, "155"); /* c */ x34 = f(y, "156"); /* c */ x34 = f(y, "157"); /* c */ x34 = f(y, "158"); /* c */ x34 = f(y, "159"); /* c */ x34 = f(y, "160"); /* c */ x34 = f(y, "161"); /* c */ x34 = f(y, "162"); /* c */ x34 = f(y, "163"); /* c */ x34 = f(y, "164"); /* c */ x34 = f(y, "165"); /* c */ x34 = f(y, "166"); /* c */ x34 = f(y, "167"); /* c */ x34 = f(y, "168"); /* c */ x34 = f(y, "169"); /* c */ x34 = f(y, "170"); /* c */ x34 = f(y, "171"); /* c */ x34 = f(y, "172"); /* c */ x34 = f(y, "173"); /* c */ x34 = f(y, "174"); /* c */ x34 = f(y, "175"); /* c */ x34 = f(y, "176"); /* c */ x34 = f(y, "177"); /* c */ x34 = f(y, "178"); /* c */ x34 = f(y, "179"); /* c */ x34 = f(y, "180"); /* c */ x34 = f(y, "181"); /* c */ x34 = f(y, "182"); /* c */ x34 = f(y, "183"); /* c */ x34 = f(y, "184"); /* c */ x34 = f(y, "185"); /* c */ x34 = f(y, "186"); /* c */ x34 = f(y, "187"); /* c */ x34 = f(y, "188"); /* c */ x34 = f(y, "189"); /* c */ x34 = f(y, "190"); /* c */ x34 = f(y, "191"); /* c */ x34 = f(y, "192"); /* c */ x34 = f(y, "193"); /* c */ x34 = f(y, "194"); /* c */ x34 = f(y, "195"); /* c */ x34 = f(y, "196"); /* c */ x34 = f(y, "197"); /* c */ x34 = f(y, "198"); /* c */ x34 = f(y, "199"); /* c */ 
+x35 = f(y, "000"); /* c */ x35 = f(y, "001"); /* c */ x35 = f(y, "002"); /* c */ x35 = f(y, "003"); /* c */ x35 = f(y, "004"); /* c */ x35 = f(y, "005"); /* c */ x35 = f(y, "006"); /* c */ x35 = f(y, "007"); /* c */ x35 = f(y, "008"); /* c */ x35 = f(y, "009"); /* c */ x35 = f(y, "010"); /* c */ x35 = f(y, "011"); /* c */ x35 = f(y, "012"); /* c */ x35 = f(y, "013"); /* c */ x35 = f(y, "014"); /* c */ x35 = f(y, "015"); /* c */ x35 = f(y, "016"); /* c */ x35 = f(y, "017"); /* c */ x35 = f(y, "018"); /* c */ x35 = f(y, "019"); /* c */ x35 = f(y, "020"); /* c */ x35 = f(y, "021"); /* c */ x35 = f(y, "022"); /* c */ x35 = f(y, "023"); /* c */ x35 = f(y, "024"); /* c */ x35 = f(y, "025"); /* c */ x35 = f(y, "026"); /* c */ x35 = f(y, "027"); /* c */ x35 = f(y, "028"); /* c */ x35 = f(y, "029"); /* c */ x35 = f(y, "030"); /* c */ x35 = f(y, "031"); /* c */ x35 = f(y, "032"); /* c */ x35 = f(y, "033"); /* c */ x35 = f(y, "034"); /* c */ x35 = f(y, "035"); /* c */ x35 = f(y, "036"); /* c */ x35 = f(y, "037"); /* c */ x35 = f(y, "038"); /* c */ x35 = f(y, "039"); /* c */ x35 = f(y, "040"); /* c */ x35 = f(y, "041"); /* c */ x35 = f(y, "042"); /* c */ x35 = f(y, "043"); /* c */ x35 = f(y, "044"); /* c */ x35 = f(y, "045"); /* c */ x35 = f(y, "046"); /* c */ x35 = f(y, "047"); /* c */ x35 = f(y, "048"); /* c */ x35 = f(y, "049"); /* c */ x35 = f(y, "050"); /* c */ x35 = f(y, "051"); /* c */ x35 = f(y, "052"); /* c */ x35 = f(y, "053"); /* c */ x35 = f(y, "054"); /* c */ x35 = f(y, "055"); /* c */ x35 = f(y, "056"); /* c */ x35 = f(y, "057"); /* c */ x35 = f(y, "058"); /* c */ x35 = f(y, "059"); /* c */ x35 = f(y, "060"); /* c */ x35 = f(y, "061"); /* c */ x35 = f(y, "062"); /* c */ x35 = f(y, "063"); /* c */ x35 = f(y, "064"); /* c */ x35 = f(y, "065"); /* c */ x35 = f(y, "066"); /* c */ x35 = f(y, "067"); /* c */ x35 = f(y, "068"); /* c */ x35 = f(y, "069"); /* c */ x35 = f(y, "070"); /* c */ x35 = f(y, "071"); /* c */ x35 = f(y, "072"); /* c */ x35 = f(y, "073"); /* c */ x35 = f(y, "074"); /* c */ x35 = f(y, "075"); /* c */ x35 = f(y, "076"); /* c */ x35 = f(y, "077"); /* c */ x35 = f(y, "078"); /* c */ x35 = f(y, "079"); /* c */ x35 = f(y, "080"); /* c */ x35 = f(y, "081"); /* c */ x35 = f(y, "082"); /* c */ x35 = f(y, "083"); /* c */ x35 = f(y, "084"); /* c */ x35 = f(y, "085"); /* c */ x35 = f(y, "086"); /* c */ x35 = f(y, "087"); /* c */ x35 = f(y, "088"); /* c */ x35 = f(y, "089"); /* c */ x35 = f(y, "090"); /* c */ x35 = f(y, "091"); /* c */ x35 = f(y, "092"); /* c */ x35 = f(y, "093"); /* c */ x35 = f(y, "094"); /* c */ x35 = f(y, "095"); /* c */ x35 = f(y, "096"); /* c */ x35 = f(y, "097"); /* c */ x35 = f(y, "098"); /* c */ x35 = f(y, "099"); /* c */ x35 = f(y, "100"); /* c */ x35 = f(y, "101"); /* c */ x35 = f(y, "102"); /* c */ x35 = f(y, "103"); /* c */ x35 = f(y, "104"); /* c */ x35 = f(y, "105"); /* c */ x35 = f(y, "106"); /* c */ x35 = f(y, "107"); /* c */ x35 = f(y, "108"); /* c */ x35 = f(y, "109"); /* c */ x35 = f(y, "110"); /* c */ x35 = f(y, "111"); /* c */ x35 = f(y, "112"); /* c */ x35 = f(y, "113"); /* c */ x35 = f(y, "114"); /* c */ x35 = f(y, "115"); /* c */ x35 = f(y, "116"); /* c */ x35 = f(y, "117"); /* c */ x35 = f(y, "118"); /* c */ x35 = f(y, "119"); /* c */ x35 = f(y, "120"); /* c */ x35 = f(y, "121"); /* c */ x35 = f(y, "122"); /* c */ x35 = f(y, "123"); /* c */ x35 = f(y, "124"); /* c */ x35 = f(y, "125"); /* c */ x35 = f(y, "126"); /* c */ x35 = f(y, "127"); /* c */ x35 = f(y, "128"); /* c */ x35 = f(y, "129"); /* c */ x35 = f(y, "130"); /* c */ x35 = f(y, "131"); /* c */ x35 = f(y, "132"); /* c */ x35 = f(y, "133"); /* c */ x35 = f(y, "134"); /* c */ x35 = f(y, "135"); /* c */ x35 = f(y, "136"); /* c */ x35 = f(y, "137"); /* c */ x35 = f(y, "138"); /* c */ x35 = f(y, "139"); /* c */ x35 = f(y, "140"); /* c */ x35 = f(y, "141"); /* c */ x35 = f(y, "142"); /* c */ x35 = f(y, "143"); /* c */ x35 = f(y, "144"); /* c */ x35 = f(y, "145"); /* c */ x35 = f(y, "146"); /* c */ x35 = f(y, "147"); /* c */ x35 = f(y, "148"); /* c */ x35 = f(y, "149"); /* c */ x35 = f(y, "150"); /* c */ x35 = f(y, "151"); /* c */ x35 = f(y, "152"); /* c */ x35 = f(y, "153"); /* c */ x35 = f(y, "154"); /* c */ x35 = f(y, "155"); /* c */ x35 = f(y, "156"); /* c */ x35 = f(y, "157"); /* c */ x35 = f(y, "158"); /* c */ x35 = f(y, "159"); /* c */ x35 = f(y, "160"); /* c */ x35 = f(y, "161"); /* c */ x35 = f(y, "162"); /* c */ x35 = f(y, "163"); /* c */ x35 = f(y, "164"); /* c */ x35 = f(y, "165"); /* c */ x35 = f(y, "166"); /* c */ x35 = f(y, "167"); /* c */ x35 = f(y, "168"); /* c */ x35 = f(y, "169"); /* c */ x35 = f(y, "170"); /* c */ x35 = f(y, "171"); /* c */ x35 = f(y, "172"); /* c */ x35 = f(y, "173"); /* c */ x35 = f(y, "174"); /* c */ x35 = f(y, "175"); /* c */ x35 = f(y, "176"); /* c */ x35 = f(y, "177"); /* c */ x35 = f(y, "178"); /* c */ x35 = f(y, "179"); /* c */ x35 = f(y, "180"); /* c */ x35 = f(y, "181"); /* c */ x35 = f(y, "182"); /* c */ x35 = f(y, "183"); /* c */ x35 = f(y, "184"); /* c */ x35 = f(y, "185"); /* c */ x35 = f(y, "186"); /* c */ x35 = f(y, "187"); /* c */ x35 = f(y, "188"); /* c */ x35 = f(y, "189"); /* c */ x35 = f(y, "190"); /* c */ x35 = f(y, "191"); /* c */ x35 = f(y, "192"); /* c */ x35 = f(y, "193"); /* c */ x35 = f(y, "194"); /* c */ x35 = f(y, "195"); /* c */ x35 = f(y, "196"); /* c */ x35 = f(y, "197"); /* c */ x35 = f(y, "198"); /* c */ x35 = f(y, "199"); /* c */ 
+x36 = f(y, "000"); /* c */ x36 = f(y, "001"); /* c */ x36 = f(y, "002"); /* c */ x36 = f(y, "003"); /* c */ x36 = f(y, "004"); /* c */ x36 = f(y, "005"); /* c */ x36 = f(y, "006"); /* c */ x36 = f(y, "007"); /* c */ x36 = f(y, "008"); /* c */ x36 = f(y, "009"); /* c */ x36 = f(y, "010"); /* c */ x36 = f(y, "011"); /* c */ x36 = f(y, "012"); /* c */ x36 = f(y, "013"); /* c */ x36 = f(y, "014"); /* c */ x36 = f(y, "015"); /* c */ x36 = f(y, "016"); /* c */ x36 = f(y, "017"); /* c */ x36 = f(y, "018"); /* c */ x36 = f(y, "019"); /* c */ x36 = f(y, "020"); /* c */ x36 = f(y, "021"); /* c */ x36 = f(y, "022"); /* c */ x36 = f(y, "023"); /* c */ x36 = f(y, "024"); /* c */ x36 = f(y, "025"); /* c */ x36 = f(y, "026"); /* c */ x36 = f(y, "027"); /* c */ x36 = f(y, "028"); /* c */ x36 = f(y, "029"); /* c */ x36 = f(y, "030"); /* c */ x36 = f(y, "031"); /* c */ x36 = f(y, "032"); /* c */ x36 = f(y, "033"); /* c */ x36 = f(y, "034"); /* c */ x36 = f(y, "035"); /* c */ x36 = f(y, "036"); /* c */ x36 = f(y, "037"); /* c */ x36 = f(y, "038"); /* c */ x36 = f(y, "039"); /* c */ x36 = f(y, "040"); /* c */ x36 = f(y, "041"); /* c */ x36 = f(y, "042"); /* c */ x36 = f(y, "043"); /* c */ x36 = f(y, "044"); /* c */ x36 = f(y, "045"); /* c */ x36 = f(y, "046"); /* c */ x36 = f(y, "047"); /* c */ x36 = f(y, "048"); /* c */ x36 = f(y, "049"); /* c */ x36 = f(y, "050"); /* c */ x36 = f(y, "051"); /* c */ x36 = f(y, "052"); /* c */ x36 = f(y, "053"); /* c */ x36 = f(y, "054"); /* c */ x36 = f(y, "055"); /* c */ x36 = f(y, "056"); /* c */ x36 = f(y, "057"); /* c */ x36 = f(y, "058"); /* c */ x36 = f(y, "059"); /* c */ x36 = f(y, "060"); /* c */ x36 = f(y, "061"); /* c */ x36 = f(y, "062"); /* c */ x36 = f(y, "063"); /* c */ x36 = f(y, "064"); /* c */ x36 = f(y, "065"); /* c */ x36 = f(y, "066"); /* c */ x36 = f(y, "067"); /* c */ x36 = f(y, "068"); /* c */ x36 = f(y, "069"); /* c */ x36 = f(y, "070"); /* c */ x36 = f(y, "071"); /* c */ x36 = f(y, "072"); /* c */ x36 = f(y, "073"); /* c */ x36 = f(y, "074"); /* c */ x36 = f(y, "075"); /* c */ x36 = f(y, "076"); /* c */ x36 = f(y, "077"); /* c */ x36 = f(y, "078"); /* c */ x36 = f(y, "079"); /* c */ x36 = f(y, "080"); /* c */ x36 = f(y, "081"); /* c */ x36 = f(y, "082"); /* c */ x36 = f(y, "083"); /* c */ x36 = f(y, "084"); /* c */ x36 = f(y, "085"); /* c */ x36 = f(y, "086"); /* c */ x36 = f(y, "087"); /* c */ x36 = f(y, "088"); /* c */ x36 = f(y, "089"); /* c */ x36 = f(y, "090"); /* c */ x36 = f(y, "091"); /* c */ x36 = f(y, "092"); /* c */ x36 = f(y, "093"); /* c */ x36 = f(y, "094"); /* c */ x36 = f(y, "095"); /* c */ x36 = f(y, "096"); /* c */ x36 = f(y, "097"); /* c */ x36 = f(y, "098"); /* c */ x36 = f(y, "099"); /* c */ x36 = f(y, "100"); /* c */ x36 = f(y, "101"); /* c */ x36 = f(y, "102"); /* c */ x36 = f(y, "103"); /* c */ x36 = f(y, "104"); /* c */ x36 = f(y, "105"); /* c */ x36 = f(y, "106"); /* c */ x36 = f(y, "107"); /* c */ x36 = f(y, "108"); /* c */ x36 = f(y, "109"); /* c */ x36 = f(y, "110"); /* c */ x36 = f(y, "111"); /* c */ x36 = f(y, "112"); /* c */ x36 = f(y, "113"); /* c */ x36 = f(y, "114"); /* c */ x36 = f(y, "115"); /* c */ x36 = f(y, "116"); /* c */ x36 = f(y, "117"); /* c */ x36 = f(y, "118"); /* c */ x36 = f(y, "119"); /* c */ x36 = f(y, "120"); /* c */ x36 = f(y, "121"); /* c */ x36 = f(y, "122"); /* c */ x36 = f(y, "123"); /* c */ x36 = f(y, "124"); /* c */ x36 = f(y, "125"); /* c */ x36 = f(y, "126"); /* c */ x36 = f(y, "127"); /* c */ x36 = f(y, "128"); /* c */ x36 = f(y, "129"); /* c */ x36 = f(y, "130"); /* c */ x36 = f(y, "131"); /* c */ x36 = f(y, "132"); /* c */ x36 = f(y, "133"); /* c */ x36 = f(y, "134"); /* c */ x36 = f(y, "135"); /* c */ x36 = f(y, "136"); /* c */ x36 = f(y, "137"); /* c */ x36 = f(y, "138"); /* c */ x36 = f(y, "139"); /* c */ x36 = f(y, "140"); /* c */ x36 = f(y, "141"); /* c */ x36 = f(y, "142"); /* c */ x36 = f(y, "143"); /* c */ x36 = f(y, "144"); /* c */ x36 = f(y, "145"); /* c */ x36 = f(y, "146"); /* c */ x36 = f(y, "147"); /* c */ x36 = f(y, "148"); /* c */ x36 = f(y, "149"); /* c */ x36 = f(y, "150"); /* c */ x36 = f(y, "151"); /* c */ x36 = f(y, "152"); /* c */ x36 = f(y, "153"); /* c */ x36 = f(y, "154"); /* c */ x36 = f(y, "155"); /* c */ x36 = f(y, "156"); /* c */ x36 = f(y, "157"); /* c */ x36 = f(y, "158"); /* c */ x36 = f(y, "159"); /* c */ x36 = f(y, "160"); /* c */ x36 = f(y, "161"); /* c */ x36 = f(y, "162"); /* c */ x36 = f(y, "163"); /* c */ x36 = f(y, "164"); /* c */ x36 = f(y, "165"); /* c */ x36 = f(y, "166"); /* c */ x36 = f(y, "167"); /* c */ x36 = f(y, "168"); /* c */ x36 = f(y, "169"); /* c */ x36 = f(y, "170"); /* c */ x36 = f(y, "171"); /* c */ x36 = f(y, "172"); /* c */ x36 = f(y, "173"); /* c */ x36 = f(y, "174"); /* c */ x36 = f(y, "175"); /* c */ x36 = f(y, "176"); /* c */ x36 = f(y, "177"); /* c */ x36 = f(y, "178"); /* c */ x36 = f(y, "179"); /* c */ x36 = f(y, "180"); /* c */ x36 = f(y, "181"); /* c */ x36 = f(y, "182"); /* c */ x36 = f(y, "183"); /* c */ x36 = f(y, "184"); /* c */ x36 = f(y, "185"); /* c */ x36 = f(y, "186"); /* c */ x36 = f(y, "187"); /* c */ x36 = f(y, "188"); /* c */ x36 = f(y, "189"); /* c */ x36 = f(y, "190"); /* c */ x36 = f(y, "191"); /* c */ x36 = f(y, "192"); /* c */ x36 = f(y, "193"); /* c */ x36 = f(y, "194"); /* c */ x36 = f(y, "195"); /* c */ x36 = f(y, "196"); /* c */ x36 = f(y, "197"); /* c */ x36 = f(y, "198"); /* c */ x36 = f(y, "199"); /* c */ 
+x37 = f(y, "000"); /* c */ x37 = f(y, "001"); /* c */ x37 = f(y, "002"); /* c */ x37 = f(y, "003"); /* c */ x37 = f(y, "004"); /* c */ x37 = f(y, "005"); /* c */ x37 = f(y, "006"); /* c */ x37 = f(y, "007"); /* c */ x37 = f(y, "008"); /* c */ x37 = f(y, "009"); /* c */ x37 = f(y, "010"); /* c */ x37 = f(y, "011"); /* c */ x37 = f(y, "012"); /* c */ x37 = f(y, "013"); /* c */ x37 = f(y, "014"); /* c */ x37 = f(y, "015"); /* c */ x37 = f(y, "016"); /* c */ x37 = f(y, "017"); /* c */ x37 = f(y, "018"); /* c */ x37 = f(y, "019"); /* c */ x37 = f(y, "020"); /* c */ x37 = f(y, "021"); /* c */ x37 = f(y, "022"); /* c */ x37 = f(y, "023"); /* c */ x37 = f(y, "024"); /* c */ x37 = f(y, "025"); /* c */ x37 = f(y, "026"); /* c */ x37 = f(y, "027"); /* c */ x37 = f(y, "028"); /* c */ x37 = f(y, "029"); /* c */ x37 = f(y, "030"); /* c */ x37 = f(y, "031"); /* c */ x37 = f(y, "032"); /* c */ x37 = f(y, "033"); /* c */ x37 = f(y, "034"); /* c */ x37 = f(y, "035"); /* c */ x37 = f(y, "036"); /* c */ x37 = f(y, "037"); /* c */ x37 = f(y, "038"); /* c */ x37 = f(y, "039"); /* c */ x37 = f(y, "040"); /* c */ x37 = f(y, "041"); /* c */ x37 = f(y, "042"); /* c */ x37 = f(y, "043"); /* c */ x37 = f(y, "044"); /* c */ x37 = f(y, "045"); /* c */ x37 = f(y, "046"); /* c */ x37 = f(y, "047"); /* c */ x37 = f(y, "048"); /* c */ x37 = f(y, "049"); /* c */ x37 = f(y, "050"); /* c */ x37 = f(y, "051"); /* c */ x37 = f(y, "052"); /* c */ x37 = f(y, "053"); /* c */ x37 = f(y, "054"); /* c */ x37 = f(y, "055"); /* c */ x37 = f(y, "056"); /* c */ x37 = f(y, "057"); /* c */ x37 = f(y, "058"); /* c */ x37 = f(y, "059"); /* c */ x37 = f(y, "060"); /* c */ x37 = f(y, "061"); /* c */ x37 = f(y, "062"); /* c */ x37 = f(y, "063"); /* c */ x37 = f(y, "064"); /* c */ x37 = f(y, "065"); /* c */ x37 = f(y, "066"); /* c */ x37 = f(y, "067"); /* c */ x37 = f(y, "068"); /* c */ x37 = f(y, "069"); /* c */ x37 = f(y, "070"); /* c */ x37 = f(y, "071"); /* c */ x37 = f(y, "072"); /* c */ x37 = f(y, "073"); /* c */ x37 = f(y, "074"); /* c */ x37 = f(y, "075"); /* c */ x37 = f(y, "076"); /* c */ x37 = f(y, "077"); /* c */ x37 = f(y, "078"); /* c */ x37 = f(y, "079"); /* c */ x37 = f(y, "080"); /* c */ x37 = f(y, "081"); /* c */ x37 = f(y, "082"); /* c */ x37 = f(y, "083"); /* c */ x37 = f(y, "084"); /* c */ x37 = f(y, "085"); /* c */ x37 = f(y, "086"); /* c */ x37 = f(y, "087"); /* c */ x37 = f(y, "088"); /* c */ x37 = f(y, "089"); /* c */ x37 = f(y, "090"); /* c */ x37 = f(y, "091"); /* c */ x37 = f(y, "092"); /* c */ x37 = f(y, "093"); /* c */ x37 = f(y, "094"); /* c */ x37 = f(y, "095"); /* c */ x37 = f(y, "096"); /* c */ x37 = f(y, "097"); /* c */ x37 = f(y, "098"); /* c */ x37 = f(y, "099"); /* c */ x37 = f(y, "100"); /* c */ x37 = f(y, "101"); /* c */ x37 = f(y, "102"); /* c */ x37 = f(y, "103"); /* c */ x37 = f(y, "104"); /* c */ x37 = f(y, "105"); /* c */ x37 = f(y, "106"); /* c */ x37 = f(y, "107"); /* c */ x37 = f(y, "108"); /* c */ x37 = f(y, "109"); /* c */ x37 = f(y, "110"); /* c */ x37 = f(y, "111"); /* c */ x37 = f(y, "112"); /* c */ x37 = f(y, "113"); /* c */ x37 = f(y, "114"); /* c */ x37 = f(y, "115"); /* c */ x37 = f(y, "116"); /* c */ x37 = f(y, "117"); /* c */ x37 = f(y, "118"); /* c */ x37 = f(y, "119"); /* c */ x37 = f(y, "120"); /* c */ x37 = f(y, "121"); /* c */ x37 = f(y, "122"); /* c */ x37 = f(y, "123"); /* c */ x37 = f(y, "124"); /* c */ x37 = f(y, "125"); /* c */ x37 = f(y, "126"); /* c */ x37 = f(y, "127"); /* c */ x37 = f(y, "128"); /* c */ x37 = f(y, "129"); /* c */ x37 = f(y, "130"); /* c */ x37 = f(y, "131"); /* c */ x37 = f(y, "132"); /* c */ x37 = f(y, "133"); /* c */ x37 = f(y, "134"); /* c */ x37 = f(y, "135"); /* c */ x37 = f(y, "136"); /* c */ x37 = f(y, "137"); /* c */ x37 = f(y, "138"); /* c */ x37 = f(y, "139"); /* c */ x37 = f(y, "140"); /* c */ x37 = f(y, "141"); /* c */ x37 = f(y, "142"); /* c */ x37 = f(y, "143"); /* c */ x37 = f(y, "144"); /* c */ x37 = f(y, "145"); /* c */ x37 = f(y, "146"); /* c */ x37 = f(y, "147"); /* c */ x37 = f(y, "148"); /* c */ x37 = f(y, "149"); /* c */ x37 = f(y, "150"); /* c */ x37 = f(y, "151"); /* c */ x37 = f(y, "152"); /* c */ x37 = f(y, "153"); /* c */ x37 = f(y, "154"); /* c */ x37 = f(y, "155"); /* c */ x37 = f(y, "156"); /* c */ x37 = f(y, "157"); /* c */ x37 = f(y, "158"); /* c */ x37 = f(y, "159"); /* c */ x37 = f(y, "160"); /* c */ x37 = f(y, "161"); /* c */ x37 = f(y, "162"); /* c */ x37 = f(y, "163"); /* c */ x37 = f(y, "164"); /* c */ x37 = f(y, "165"); /* c */ x37 = f(y, "166"); /* c */ x37 = f(y, "167"); /* c */ x37 = f(y, "168"); /* c */ x37 = f(y, "169"); /* c */ x37 = f(y, "170"); /* c */ x37 = f(y, "171"); /* c */ x37 = f(y, "172"); /* c */ x37 = f(y, "173"); /* c */ x37 = f(y, "174"); /* c */ x37 = f(y, "175"); /* c */ x37 = f(y, "176"); /* c */ x37 = f(y, "177"); /* c */ x37 = f(y, "178"); /* c */ x37 = f(y, "179"); /* c */ x37 = f(y, "180"); /* c */ x37 = f(y, "181"); /* c */ x37 = f(y, "182"); /* c */ x37 = f(y, "183"); /* c */ x37 = f(y, "184"); /* c */ x37 = f(y, "185"); /* c */ x37 = f(y, "186"); /* c */ x37 = f(y, "187"); /* c */ x37 = f(y, "188"); /* c */ x37 = f(y, "189"); /* c */ x37 = f(y, "190"); /* c */ x37 = f(y, "191"); /* c */ x37 = f(y, "192"); /* c */ x37 = f(y, "193"); /* c */ x37 = f(y, "194"); /* c */ x37 = f(y, "195"); /* c */ x37 = f(y, "196"); /* c */ x37 = f(y, "197"); /* c */ x37 = f(y, "198"); /* c */ x37 = f(y, "199"); /* c */ 
+x38 = f(y, "000"); /* c */ x38 = f(y, "001"); /* c */ x38 = f(y, "002"); /* c */ x38 = f(y, "003"); /* c */ x38 = f(y, "004"); /* c */ x38 = f(y, "005"); /* c */ x38 = f(y, "006"); /* c */ x38 = f(y, "007"); /* c */ x38 = f(y, "008"); /* c */ x38 = f(y, "009"); /* c */ x38 = f(y, "010"); /* c */ x38 = f(y, "011"); /* c */ x38 = f(y, "012"); /* c */ x38 = f(y, "013"); /* c */ x38 = f(y, "014"); /* c */ x38 = f(y, "015"); /* c */ x38 = f(y, "016"); /* c */ x38 = f(y, "017"); /* c */ x38 = f(y, "018"); /* c */ x38 = f(y, "019"); /* c */ x38 = f(y, "020"); /* c */ x38 = f(y, "021"); /* c */ x38 = f(y, "022"); /* c */ x38 = f(y, "023"); /* c */ x38 = f(y, "024"); /* c */ x38 = f(y, "025"); /* c */ x38 = f(y, "026"); /* c */ x38 = f(y, "027"); /* c */ x38 = f(y, "028"); /* c */ x38 = f(y, "029"); /* c */ x38 = f(y, "030"); /* c */ x38 = f(y, "031"); /* c */ x38 = f(y, "032"); /* c */ x38 = f(y, "033"); /* c */ x38 = f(y, "034"); /* c */ x38 = f(y, "035"); /* c */ x38 = f(y, "036"); /* c */ x38 = f(y, "037"); /* c */ x38 = f(y, "038"); /* c */ x38 = f(y, "039"); /* c */ x38 = f(y, "040"); /* c */ x38 = f(y, "041"); /* c */ x38 = f(y, "042"); /* c */ x38 = f(y, "043"); /* c */ x38 = f(y, "044"); /* c */ x38 = f(y, "045"); /* c */ x38 = f(y, "046"); /* c */ x38 = f(y, "047"); /* c */ x38 = f(y, "048"); /* c */ x38 = f(y, "049"); /* c */ x38 = f(y, "050"); /* c */ x38 = f(y, "051"); /* c */ x38 = f(y, "052"); /* c */ x38 = f(y, "053"); /* c */ x38 = f(y, "054"); /* c */ x38 = f(y, "055"); /* c */ x38 = f(y, "056"); /* c */ x38 = f(y, "057"); /* c */ x38 = f(y, "058"); /* c */ x38 = f(y, "059"); /* c */ x38 = f(y, "060"); /* c */ x38 = f(y, "061"); /* c */ x38 = f(y, "062"); /* c */ x38 = f(y, "063"); /* c */ x38 = f(y, "064"); /* c */ x38 = f(y, "065"); /* c */ x38 = f(y, "066"); /* c */ x38 = f(y, "067"); /* c */ x38 = f(y, "068"); /* c */ x38 = f(y, "069"); /* c */ x38 = f(y, "070"); /* c */ x38 = f(y, "071"); /* c */ x38 = f(y, "072"); /* c */ x38 = f(y, "073"); /* c */ x38 = f(y, "074"); /* c */ x38 = f(y, "075"); /* c */ x38 = f(y, "076"); /* c */ x38 = f(y, "077"); /* c */ x38 = f(y, "078"); /* c */ x38 = f(y, "079"); /* c */ x38 = f(y, "080"); /* c */ x38 = f(y, "081"); /* c */ x38 = f(y, "082"); /* c */ x38 = f(y, "083"); /* c */ x38 = f(y, "084"); /* c */ x38 = f(y, "085"); /* c */ x38 = f(y, "086"); /* c */ x38 = f(y, "087"); /* c */ x38 = f(y, "088"); /* c */ x38 = f(y, "089"); /* c */ x38 = f(y, "090"); /* c */ x38 = f(y, "091"); /* c */ x38 = f(y, "092"); /* c */ x38 = f(y, "093"); /* c */ x38 = f(y, "094"); /* c */ x38 = f(y, "095"); /* c */ x38 = f(y, "096"); /* c */ x38 = f(y, "097"); /* c */ x38 = f(y, "098"); /* c */ x38 = f(y, "099"); /* c */ x38 = f(y, "100"); /* c */ x38 = f(y, "101"); /* c */ x38 = f(y, "102"); /* c */ x38 = f(y, "103"); /* c */ x38 = f(y, "104"); /* c */ x38 = f(y, "105"); /* c */ x38 = f(y, "106"); /* c */ x38 = f(y, "107"); /* c */ x38 = f(y, "108"); /* c */ x38 = f(y, "109"); /* c */ x38 = f(y, "110"); /* c */ x38 = f(y, "111"); /* c */ x38 = f(y, "112"); /* c */ x38 = f(y, "113"); /* c */ x38 = f(y, "114"); /* c */ x38 = f(y, "115"); /* c */ x38 = f(y, "116"); /* c */ x38 = f(y, "117"); /* c */ x38 = f(y, "118"); /* c */ x38 = f(y, "119"); /* c */ x38 = f(y, "120"); /* c */ x38 = f(y, "121"); /* c */ x38 = f(y, "122"); /* c */ x38 = f(y, "123"); /* c */ x38 = f(y, "124"); /* c */ x38 = f(y, "125"); /* c */ x38 = f(y, "126"); /* c */ x38 = f(y, "127"); /* c */ x38 = f(y, "128"); /* c */ x38 = f(y, "129"); /* c */ x38 = f(y, "130"); /* c */ x38 = f(y, "131"); /* c */ x38 = f(y, "132"); /* c */ x38 = f(y, "133"); /* c */ x38 = f(y, "134"); /* c */ x38 = f(y, "135"); /* c */ x38 = f(y, "136"); /* c */ x38 = f(y, "137"); /* c */ x38 = f(y, "138"); /* c */ x38 = f(y, "139"); /* c */ x38 = f(y, "140"); /* c */ x38 = f(y, "141"); /* c */ x38 = f(y, "142"); /* c */ x38 = f(y, "143"); /* c */ x38 = f(y, "144"); /* c */ x38 = f(y, "145"); /* c */ x38 = f(y, "146"); /* c */ x38 = f(y, "147"); /* c */ x38 = f(y, "148"); /* c */ x38 = f(y, "149"); /* c */ x38 = f(y, "150"); /* c */ x38 = f(y, "151"); /* c */ x38 = f(y, "152"); /* c */ x38 = f(y, "153"); /* c */ x38 = f(y, "154"); /* c */ x38 = f(y, "155"); /* c */ x38 = f(y, "156"); /* c */ x38 = f(y, "157"); /* c */ x38 = f(y, "158"); /* c */ x38 = f(y, "159"); /* c */ x38 = f(y, "160"); /* c */ x38 = f(y, "161"); /* c */ x38 = f(y, "162"); /* c */ x38 = f(y, "163"); /* c */ x38 = f(y, "164"); /* c */ x38 = f(y, "165"); /* c */ x38 = f(y, "166"); /* c */ x38 = f(y, "167"); /* c */ x38 = f(y, "168"); /* c */ x38 = f(y, "169"); /* c */ x38 = f(y, "170"); /* c */ x38 = f(y, "171"); /* c */ x38 = f(y, "172"); /* c */ x38 = f(y, "173"); /* c */ x38 = f(y, "174"); /* c */ x38 = f(y, "175"); /* c */ x38 = f(y, "176"); /* c */ x38 = f(y, "177"); /* c */ x38 = f(y, "178"); /* c */ x38 = f(y, "179"); /* c */ x38 = f(y, "180"); /* c */ x38 = f(y, "181"); /* c */ x38 = f(y, "182"); /* c */ x38 = f(y, "183"); /* c */ x38 = f(y, "184"); /* c */ x38 = f(y, "185"); /* c */ x38 = f(y, "186"); /* c */ x38 = f(y, "187"); /* c */ x38 = f(y, "188"); /* c */ x38 = f(y, "189"); /* c */ x38 = f(y, "190"); /* c */ x38 = f(y, "191"); /* c */ x38 = f(y, "192"); /* c */ x38 = f(y, "193"); /* c */ x38 = f(y, "194"); /* c */ x38 = f(y, "195"); /* c */ x38 = f(y, "196"); /* c */ x38 = f(y, "197"); /* c */ x38 = f(y, "198"); /* c */ x38 = f(y, "199"); /* c */ 
+x39 = f(y, "000"); /* c */ x39 = f(y, "001"); /* c */ x39 = f(y, "002"); /* c */ x39 = f(y, "003"); /* c */ x39 = f(y, "004"); /* c */ x39 = f(y, "005"); /* c */ x39 = f(y, "006"); /* c */ x39 = f(y, "007"); /* c */ x39 = f(y, "008"); /* c */ x39 = f(y, "009"); /* c */ x39 = f(y, "010"); /* c */ x39 = f(y, "011"); /* c */ x39 = f(y, "012"); /* c */ x39 = f(y, "013"); /* c */ x39 = f(y, "014"); /* c */ x39 = f(y, "015"); /* c */ x39 = f(y, "016"); /* c */ x39 = f(y, "017"); /* c */ x39 = f(y, "018"); /* c */ x39 = f(y, "019"); /* c */ x39 = f(y, "020"); /* c */ x39 = f(y, "021"); /* c */ x39 = f(y, "022"); /* c */ x39 = f(y, "023"); /* c */ x39 = f(y, "024"); /* c */ x39 = f(y, "025"); /* c */ x39 = f(y, "026"); /* c */ x39 = f(y, "027"); /* c */ x39 = f(y, "028"); /* c */ x39 = f(y, "029"); /* c */ x39 = f(y, "030"); /* c */ x39 = f(y, "031"); /* c */ x39 = f(y, "032"); /* c */ x39 = f(y, "033"); /* c */ x39 = f(y, "034"); /* c */ x39 = f(y, "035"); /* c */ x39 = f(y, "036"); /* c */ x39 = f(y, "037"); /* c */ x39 = f(y, "038"); /* c */ x39 = f(y, "039"); /* c */ x39 = f(y, "040"); /* c */ x39 = f(y, "041"); /* c */ x39 = f(y, "042"); /* c */ x39 = f(y, "043"); /* c */ x39 = f(y, "044"); /* c */ x39 = f(y, "045"); /* c */ x39 = f(y, "046"); /* c */ x39 = f(y, "047"); /* c */ x39 = f(y, "048"); /* c */ x39 = f(y, "049"); /* c */ x39 = f(y, "050"); /* c */ x39 = f(y, "051"); /* c */ x39 = f(y, "052"); /* c */ x39 = f(y, "053"); /* c */ x39 = f(y, "054"); /* c */ x39 = f(y, "055"); /* c */ x39 = f(y, "056"); /* c */ x39 = f(y, "057"); /* c */ x39 = f(y, "058"); /* c */ x39 = f(y, "059"); /* c */ x39 = f(y, "060"); /* c */ x39 = f(y, "061"); /* c */ x39 = f(y, "062"); /* c */ x39 = f(y, "063"); /* c */ x39 = f(y, "064"); /* c */ x39 = f(y, "065"); /* c */ x39 = f(y, "066"); /* c */ x39 = f(y, "067"); /* c */ x39 = f(y, "068"); /* c */ x39 = f(y, "069"); /* c */ x39 = f(y, "070"); /* c */ x39 = f(y, "071"); /* c */ x39 = f(y, "072"); /* c */ x39 = f(y, "073"); /* c */ x39 = f(y, "074"); /* c */ x39 = f(y, "075"); /* c */ x39 = f(y, "076"); /* c */ x39 = f(y, "077"); /* c */ x39 = f(y, "078"); /* c */ x39 = f(y, "079"); /* c */ x39 = f(y, "080"); /* c */ x39 = f(y, "081"); /* c */ x39 = f(y, "082"); /* c */ x39 = f(y, "083"); /* c */ x39 = f(y, "084"); /* c */ x39 = f(y, "085"); /* c */ x39 = f(y, "086"); /* c */ x39 = f(y, "087"); /* c */ x39 = f(y, "088"); /* c */ x39 = f(y, "089"); /* c */ x39 = f(y, "090"); /* c */ x39 = f(y, "091"); /* c */ x39 = f(y, "092"); /* c */ x39 = f(y, "093"); /* c */ x39 = f(y, "094"); /* c */ x39 = f(y, "095"); /* c */ x39 = f(y, "096"); /* c */ x39 = f(y, "097"); /* c */ x39 = f(y, "098"); /* c */ x39 = f(y, "099"); /* c */ x39 = f(y, "100"); /* c */ x39 = f(y, "101"); /* c */ x39 = f(y, "102"); /* c */ x39 = f(y, "103"); /* c */ x39 = f(y, "104"); /* c */ x39 = f(y, "105"); /* c */ x39 = f(y, "106"); /* c */ x39 = f(y, "107"); /* c */ x39 = f(y, "108"); /* c */ x39 = f(y, "109"); /* c */ x39 = f(y, "110"); /* c */ x39 = f(y, "111"); /* c */ x39 = f(y, "112"); /* c */ x39 = f(y, "113"); /* c */ x39 = f(y, "114"); /* c */ x39 = f(y, "115"); /* c */ x39 = f(y, "116"); /* c */ x39 = f(y, "117"); /* c */ x39 = f(y, "118"); /* c */ x39 = f(y, "119"); /* c */ x39 = f(y, "120"); /* c */ x39 = f(y, "121"); /* c */ x39 = f(y, "122"); /* c */ x39 = f(y, "123"); /* c */ x39 = f(y, "124"); /* c */ x39 = f(y, "125"); /* c */ x39 = f(y, "126"); /* c */ x39 = f(y, "127"); /* c */ x39 = f(y, "128"); /* c */ x39 = f(y, "129"); /* c */ x39 = f(y, "130"); /* c */ x39 = f(y, "131"); /* c */ x39 = f(y, "132"); /* c */ x39 = f(y, "133"); /* c */ x39 = f(y, "134"); /* c */ x39 = f(y, "135"); /* c */ x39 = f(y, "136"); /* c */ x39 = f(y, "137"); /* c */ x39 = f(y, "138"); /* c */ x39 = f(y, "139"); /* c */ x39 = f(y, "140"); /* c */ x39 = f(y, "141"); /* c */ x39 = f(y, "142"); /* c */ x39 = f(y, "143"); /* c */ x39 = f(y, "144"); /* c */ x39 = f(y, "145"); /* c */ x39 = f(y, "146"); /* c */ x39 = f(y, "147"); /* c */ x39 = f(y, "148"); /* c */ x39 = f(y, "149"); /* c */ x39 = f(y, "150"); /* c */ x39 = f(y, "151"); /* c */ x39 = f(y, "152"); /* c */ x39 = f(y, "153"); /* c */ x39 = f(y, "154"); /* c */ x39 = f(y, "155"); /* c */ x39 = f(y, "156"); /* c */ x39 = f(y, "157"); /* c */ x39 = f(y, "158"); /* c */ x39 = f(y, "159"); /* c */ x39 = f(y, "160"); /* c */ x39 = f(y, "161"); /* c */ x39 = f(y, "162"); /* c */ x39 = f(y, "163"); /* c */ x39 = f(y, "164"); /* c */ x39 = f(y, "165"); /* c */ x39 = f(y, "166"); /* c */ x39 = f(y, "167"); /* c */ x39 = f(y, "168"); /* c */ x39 = f(y, "169"); /* c */ x39 = f(y, "170"); /* c */ x39 = f(y, "171"); /* c */ x39 = f(y, "172"); /* c */ x39 = f(y, "173"); /* c */ x39 = f(y, "174"); /* c */ x39 = f(y, "175"); /* c */ x39 = f(y, "176"); /* c */ x39 = f(y, "177"); /* c */ x39 = f(y, "178"); /* c */ x39 = f(y, "179"); /* c */ x39 = f(y, "180"); /* c */ x39 = f(y, "181"); /* c */ x39 = f(y, "182"); /* c */ x39 = f(y, "183"); /* c */ x39 = f(y, "184"); /* c */ x39 = f(y, "185"); /* c */ x39 = f(y, "186"); /* c */ x39 = f(y, "187"); /* c */ x39 = f(y, "188"); /* c */ x39 = f(y, "189"); /* c */ x39 = f(y, "190"); /* c */ x39 = f(y, "191"); /* c */ x39 = f(y, "192"); /* c */ x39 = f(y, "193"); /* c */ x39 = f(y, "194"); /* c */ x39 = f(y, "195"); /* c */ x39 = f(y, "196"); /* c */ x39 = f(y, "197"); /* c */ x39 = f(y, "198"); /* c */ x39 = f(y, "199"); /* c */ 
+x40 = f(y, "000"); /* c */ x40 = f(y, "001"); /* c */ x40 = f(y, "002"); /* c */ x40 = f(y, "003"); /* c */ x40 = f(y, "004"); /* c */ x40 = f(y, "005"); /* c */ x40 = f(y, "006"); /* c */ x40 = f(y, "007"); /* c */ x40 = f(y, "008"); /* c */ x40 = f(y, "009"); /* c */ x40 = f(y, "010"); /* c */ x40 = f(y, "011"); /* c */ x40 = f(y, "012"); /* c */ x40 = f(y, "013"); /* c */ x40 = f(y, "014"); /* c */ x40 = f(y, "015"); /* c */ x40 = f(y, "016"); /* c */ x40 = f(y, "017"); /* c */ x40 = f(y, "018"); /* c */ x40 = f(y, "019"); /* c */ x40 = f(y, "020"); /* c */ x40 = f(y, "021"); /* c */ x40 = f(y, "022"); /* c */ x40 = f(y, "023"); /* c */ x40 = f(y, "024"); /* c */ x40 = f(y, "025"); /* c */ x40 = f(y, "026"); /* c */ x40 = f(y, "027"); /* c */ x40 = f(y, "028"); /* c */ x40 = f(y, "029"); /* c */ x40 = f(y, "030"); /* c */ x40 = f(y, "031"); /* c */ x40 = f(y, "032"); /* c */ x40 = f(y, "033"); /* c */ x40 = f(y, "034"); /* c */ x40 = f(y, "035"); /* c */ x40 = f(y, "036"); /* c */ x40 = f(y, "037"); /* c */ x40 = f(y, "038"); /* c */ x40 = f(y, "039"); /* c */ x40 = f(y, "040"); /* c */ x40 = f(y, "041"); /* c */ x40 = f(y, "042"); /* c */ x40 = f(y, "043"); /* c */ x40 = f(y, "044"); /* c */ x40 = f(y, "045"); /* c */ x40 = f(y, "046"); /* c */ x40 = f(y, "047"); /* c */ x40 = f(y, "048"); /* c */ x40 = f(y, "049"); /* c */ x40 = f(y, "050"); /* c */ x40 = f(y, "051"); /* c */ x40 = f(y, "052"); /* c */ x40 = f(y, "053"); /* c */ x40 = f(y, "054"); /* c */ x40 = f(y, "055"); /* c */ x40 = f(y, "056"); /* c */ x40 = f(y, "057"); /* c */ x40 = f(y, "058"); /* c */ x40 = f(y, "059"); /* c */ x40 = f(y, "060"); /* c */ x40 = f(y, "061"); /* c */ x40 = f(y, "062"); /* c */ x40 = f(y, "063"); /* c */ x40 = f(y, "064"); /* c */ x40 = f(y, "065"); /* c */ x40 = f(y, "066"); /* c */ x40 = f(y, "067"); /* c */ x40 = f(y, "068"); /* c */ x40 = f(y, "069"); /* c */ x40 = f(y, "070"); /* c */ x40 = f(y, "071"); /* c */ x40 = f(y, "072"); /* c */ x40 = f(y, "073"); /* c */ x40 = f(y, "074"); /* c */ x40 = f(y, "075"); /* c */ x40 = f(y, "076"); /* c */ x40 = f(y, "077"); /* c */ x40 = f(y, "078"); /* c */ x40 = f(y, "079"); /* c */ x40 = f(y, "080"); /* c */ x40 = f(y, "081"); /* c */ x40 = f(y, "082"); /* c */ x40 = f(y, "083"); /* c */ x40 = f(y, "084"); /* c */ x40 = f(y, "085"); /* c */ x40 = f(y, "086"); /* c */ x40 = f(y, "087"); /* c */ x40 = f(y, "088"); /* c */ x40 = f(y, "089"); /* c */ x40 = f(y, "090"); /* c */ x40 = f(y, "091"); /* c */ x40 = f(y, "092"); /* c */ x40 = f(y, "093"); /* c */ x40 = f(y, "094"); /* c */ x40 = f(y, "095"); /* c */ x40 = f(y, "096"); /* c */ x40 = f(y, "097"); /* c */ x40 = f(y, "098"); /* c */ x40 = f(y, "099"); /* c */ x40 = f(y, "100"); /* c */ x40 = f(y, "101"); /* c */ x40 = f(y, "102"); /* c */ x40 = f(y, "103"); /* c */ x40 = f(y, "104"); /* c */ x40 = f(y, "105"); /* c */ x40 = f(y, "106"); /* c */ x40 = f(y, "107"); /* c */ x40 = f(y, "108"); /* c */ x40 = f(y, "109"); /* c */ x40 = f(y, "110"); /* c */ x40 = f(y, "111"); /* c */ x40 = f(y, "112"); /* c */ x40 = f(y, "113"); /* c */ x40 = f(y, "114"); /* c */ x40 = f(y, "115"); /* c */ x40 = f(y, "116"); /* c */ x40 = f(y, "117"); /* c */ x40 = f(y, "118"); /* c */ x40 = f(y, "119"); /* c */ x40 = f(y, "120"); /* c */ x40 = f(y, "121"); /* c */ x40 = f(y, "122"); /* c */ x40 = f(y, "123"); /* c */ x40 = f(y, "124"); /* c */ x40 = f(y, "125"); /* c */ x40 = f(y, "126"); /* c */ x40 = f(y, "127"); /* c */ x40 = f(y, "128"); /* c */ x40 = f(y, "129"); /* c */ x40 = f(y, "130"); /* c */ x40 = f(y, "131"); /* c */ x40 = f(y, "132"); /* c */ x40 = f(y, "133"); /* c */ x40 = f(y, "134"); /* c */ x40 = f(y, "135"); /* c */ x40 = f(y, "136"); /* c */ x40 = f(y, "137"); /* c */ x40 = f(y, "138"); /* c */ x40 = f(y, "139"); /* c */ x40 = f(y, "140"); /* c */ x40 = f(y, "141"); /* c */ x40 = f(y, "142"); /* c */ x40 = f(y, "143"); /* c */ x40 = f(y, "144"); /* c */ x40 = f(y, "145"); /* c */ x40 = f(y, "146"); /* c */ x40 = f(y, "147"); /* c */ x40 = f(y, "148"); /* c */ x40 = f(y, "149"); /* c */ x40 = f(y, "150"); /* c */ x40 = f(y, "151"); /* c */ x40 = f(y, "152"); /* c */ x40 = f(y, "153"); /* c */ x40 = f(y, "154"); /* c */ x40 = f(y, "155"); /* c */ x40 = f(y, "156"); /* c */ x40 = f(y, "157"); /* c */ x40 = f(y, "158"); /* c */ x40 = f(y, "159"); /* c */ x40 = f(y, "160"); /* c */ x40 = f(y, "161"); /* c */ x40 = f(y, "162"); /* c */ x40 = f(y, "163"); /* c */ x40 = f(y, "164"); /* c */ x40 = f(y, "165"); /* c */ x40 = f(y, "166"); /* c */ x40 = f(y, "167"); /* c */ x40 = f(y, "168"); /* c */ x40 = f(y, "169"); /* c */ x40 = f(y, "170"); /* c */ x40 = f(y, "171"); /* c */ x40 = f(y, "172"); /* c */ x40 = f(y, "173"); /* c */ x40 = f(y, "174"); /* c */ x40 = f(y, "175"); /* c */ x40 = f(y, "176"); /* c */ x40 = f(y, "177"); /* c */ x40 = f(y, "178"); /* c */ x40 = f(y, "179"); /* c */ x40 = f(y, "180"); /* c */ x40 = f(y, "181"); /* c */ x40 = f(y, "182"); /* c */ x40 = f(y, "183"); /* c */ x40 = f(y, "184"); /* c */ x40 = f(y, "185"); /* c */ x40 = f(y, "186"); /* c */ x40 = f(y, "187"); /* c */ x40 = f(y, "188"); /* c */ x40 = f(y, "189"); /* c */ x40 = f(y, "190"); /* c */ x40 = f(y, "191"); /* c */ x40 = f(y, "192"); /* c */ x40 = f(y, "193"); /* c */ x40 = f(y, "194"); /* c */ x40 = f(y, "195"); /* c */ x40 = f(y, "196"); /* c */ x40 = f(y, "197"); /* c */ x40 = f(y, "198"); /* c */ x40 = f(y, "199"); /* c */ 
+x41 = f(y, "000"); /* c */ x41 = f(y, "001"); /* c */ x41 = f(y, "002"); /* c */ x41 = f(y, "003"); /* c */ x41 = f(y, "004"); /* c */ x41 = f(y, "005"); /* c */ x41 = f(y, "006"); /* c */ x41 = f(y, "007"); /* c */ x41 = f(y, "008"); /* c */ x41 = f(y, "009"); /* c */ x41 = f(y, "010"); /* c */ x41 = f(y, "011"); /* c */ x41 = f(y, "012"); /* c */ x41 = f(y, "013"); /* c */ x41 = f(y, "014"); /* c */ x41 = f(y, "015"); /* c */ x41 = f(y, "016"); /* c */ x41 = f(y, "017"); /* c */ x41 = f(y, "018"); /* c */ x41 = f(y, "019"); /* c */ x41 = f(y, "020"); /* c */ x41 = f(y, "021"); /* c */ x41 = f(y, "022"); /* c */ x41 = f(y, "023"); /* c */ x41 = f(y, "024"); /* c */ x41 = f(y, "025"); /* c */ x41 = f(y, "026"); /* c */ x41 = f(y, "027"); /* c */ x41 = f(y, "028"); /* c */ x41 = f(y, "029"); /* c */ x41 = f(y, "030"); /* c */ x41 = f(y, "031"); /* c */ x41 = f(y, "032"); /* c */ x41 = f(y, "033"); /* c */ x41 = f(y, "034"); /* c */ x41 = f(y, "035"); /* c */ x41 = f(y, "036"); /* c */ x41 = f(y, "037"); /* c */ x41 = f(y, "038"); /* c */ x41 = f(y, "039"); /* c */ x41 = f(y, "040"); /* c */ x41 = f(y, "041"); /* c */ x41 = f(y, "042"); /* c */ x41 = f(y, "043"); /* c */ x41 = f(y, "044"); /* c */ x41 = f(y, "045"); /* c */ x41 = f(y, "046"); /* c */ x41 = f(y, "047"); /* c */ x41 = f(y, "048"); /* c */ x41 = f(y, "049"); /* c */ x41 = f(y, "050"); /* c */ x41 = f(y, "051"); /* c */ x41 = f(y, "052"); /* c */ x41 = f(y, "053"); /* c */ x41 = f(y, "054"); /* c */ x41 = f(y, "055"); /* c */ x41 = f(y, "056"); /* c */ x41 = f(y, "057"); /* c */ x41 = f(y, "058"); /* c */ x41 = f(y, "059"); /* c */ x41 = f(y, "060"); /* c */ x41 = f(y, "061"); /* c */ x41 = f(y, "062"); /* c */ x41 = f(y, "063"); /* c */ x41 = f(y, "064"); /* c */ x41 = f(y, "065"); /* c */ x41 = f(y, "066"); /* c */ x41 = f(y, "067"); /* c */ x41 = f(y, "068"); /* c */ x41 = f(y, "069"); /* c */ x41 = f(y, "070"); /* c */ x41 = f(y, "071"); /* c */ x41 = f(y, "072"); /* c */ x41 = f(y, "073"); /* c */ x41 = f(y, "074"); /* c */ x41 = f(y, "075"); /* c */ x41 = f(y, "076"); /* c */ x41 = f(y, "077"); /* c */ x41 = f(y, "078"); /* c */ x41 = f(y, "079"); /* c */ x41 = f(y, "080"); /* c */ x41 = f(y, "081"); /* c */ x41 = f(y, "082"); /* c */ x41 = f(y, "083"); /* c */ x41 = f(y, "084"); /* c */ x41 = f(y, "085"); /* c */ x41 = f(y, "086"); /* c */ x41 = f(y, "087"); /* c */ x41 = f(y, "088"); /* c */ x41 = f(y, "089"); /* c */ x41 = f(y, "090"); /* c */ x41 = f(y, "091"); /* c */ x41 = f(y, "092"); /* c */ x41 = f(y, "093"); /* c */ x41 = f(y, "094"); /* c */ x41 = f(y, "095"); /* c */ x41 = f(y, "096"); /* c */ x41 = f(y, "097"); /* c */ x41 = f(y, "098"); /* c */ x41 = f(y, "099"); /* c */ x41 = f(y, "100"); /* c */ x41 = f(y, "101"); /* c */ x41 = f(y, "102"); /* c */ x41 = f(y, "103"); /* c */ x41 = f(y, "104"); /* c */ x41 = f(y, "105"); /* c */ x41 = f(y, "106"); /* c */ x41 = f(y, "107"); /* c */ x41 = f(y, "108"); /* c */ x41 = f(y, "109"); /* c */ x41 = f(y, "110"); /* c */ x41 = f(y, "111"); /* c */ x41 = f(y, "112"); /* c */ x41 = f(y, "113"); /* c */ x41 = f(y, "114"); /* c */ x41 = f(y, "115"); /* c */ x41 = f(y, "116"); /* c */ x41 = f(y, "117"); /* c */ x41 = f(y, "118"); /* c */ x41 = f(y, "119"); /* c */ x41 = f(y, "120"); /* c */ x41 = f(y, "121"); /* c */ x41 = f(y, "122"); /* c */ x41 = f(y, "123"); /* c */ x41 = f(y, "124"); /* c */ x41 = f(y, "125"); /* c */ x41 = f(y, "126"); /* c */ x41 = f(y, "127"); /* c */ x41 = f(y, "128"); /* c */ x41 = f(y, "129"); /* c */ x41 = f(y, "130"); /* c */ x41 = f(y, "131"); /* c */ x41 = f(y, "132"); /* c */ x41 = f(y, "133"); /* c */ x41 = f(y, "134"); /* c */ x41 = f(y, "135"); /* c */ x41 = f(y, "136"); /* c */ x41 = f(y, "137"); /* c */ x41 = f(y, "138"); /* c */ x41 = f(y, "139"); /* c */ x41 = f(y, "140"); /* c */ x41 = f(y, "141"); /* c */ x41 = f(y, "142"); /* c */ x41 = f(y, "143"); /* c */ x41 = f(y, "144"); /* c */ x41 = f(y, "145"); /* c */ x41 = f(y, "146"); /* c */ x41 = f(y, "147"); /* c */ x41 = f(y, "148"); /* c */ x41 = f(y, "149"); /* c */ x41 = f(y, "150"); /* c */ x41 = f(y, "151"); /* c */ x41 = f(y, "152"); /* c */ x41 = f(y, "153"); /* c */ x41 = f(y, "154"); /* c */ x41 = f(y, "155"); /* c */ x41 = f(y, "156"); /* c */ x41 = f(y, "157"); /* c */ x41 = f(y, "158"); /* c */ x41 = f(y, "159"); /* c */ x41 = f(y, "160"); /* c */ x41 = f(y, "161"); /* c */ x41 = f(y, "162"); /* c */ x41 = f(y, "163"); /* c */ x41 = f(y, "164"); /* c */ x41 = f(y, "165"); /* c */ x41 = f(y, "166"); /* c */ x41 = f(y, "167"); /* c */ x41 = f(y, "168"); /* c */ x41 = f(y, "169"); /* c */ x41 = f(y, "170"); /* c */ x41 = f(y, "171"); /* c */ x41 = f(y, "172"); /* c */ x41 = f(y, "173"); /* c */ x41 = f(y, "174"); /* c */ x41 = f(y, "175"); /* c */ x41 = f(y, "176"); /* c */ x41 = f(y, "177"); /* c */ x41 = f(y, "178"); /* c */ x41 = f(y, "179"); /* c */ x41 = f(y, "180"); /* c */ x41 = f(y, "181"); /* c */ x41 = f(y, "182"); /* c */ x41 = f(y, "183"); /* c */ x41 = f(y, "184"); /* c */ x41 = f(y, "185"); /* c */ x41 = f(y, "186"); /* c */ x41 = f(y, "187"); /* c */ x41 = f(y, "188"); /* c */ x41 = f(y, "189"); /* c */ x41 = f(y, "190"); /* c */ x41 = f(y, "191"); /* c */ x41 = f(y, "192"); /* c */ x41 = f(y, "193"); /* c */ x41 = f(y, "194"); /* c */ x41 = f(y, "195"); /* c */ x41 = f(y, "196"); /* c */ x41 = f(y, "197"); /* c */ x41 = f(y, "198"); /* c */ x41 = f(y, "199"); /* c */ 
+x42 = f(y, "000"); /* c */ x42 = f(y, "001"); /* c */ x42 = f(y, "002"); /* c */ x42 = f(y, "003"); /* c */ x42 = f(y, "004"); /* c */ x42 = f(y, "005"); /* c */ x42 = f(y, "006"); /* c */ x42 = f(y, "007"); /* c */ x42 = f(y, "008"); /* c */ x42 = f(y, "009"); /* c */ x42 = f(y, "010"); /* c */ x42 = f(y, "011"); /* c */ x42 = f(y, "012"); /* c */ x42 = f(y, "013"); /* c */ x42 = f(y, "014"); /* c */ x42 = f(y, "015"); /* c */ x42 = f(y, "016"); /* c */ x42 = f(y, "017"); /* c */ x42 = f(y, "018"); /* c */ x42 = f(y, "019"); /* c */ x42 = f(y, "020"); /* c */ x42 = f(y, "021"); /* c */ x42 = f(y, "022"); /* c */ x42 = f(y, "023"); /* c */ x42 = f(y, "024"); /* c */ x42 = f(y, "025"); /* c */ x42 = f(y, "026"); /* c */ x42 = f(y, "027"); /* c */ x42 = f(y, "028"); /* c */ x42 = f(y, "029"); /* c */ x42 = f(y, "030"); /* c */ x42 = f(y, "031"); /* c */ x42 = f(y, "032"); /* c */ x42 = f(y, "033"); /* c */ x42 = f(y, "034"); /* c */ x42 = f(y, "035"); /* c */ x42 = f(y, "036"); /* c */ x42 = f(y, "037"); /* c */ x42 = f(y, "038"); /* c */ x42 = f(y, "039"); /* c */ x42 = f(y, "040"); /* c */ x42 = f(y, "041"); /* c */ x42 = f(y, "042"); /* c */ x42 = f(y, "043"); /* c */ x42 = f(y, "044"); /* c */ x42 = f(y, "045"); /* c */ x42 = f(y, "046"); /* c */ x42 = f(y, "047"); /* c */ x42 = f(y, "048"); /* c */ x42 = f(y, "049"); /* c */ x42 = f(y, "050"); /* c */ x42 = f(y, "051"); /* c */ x42 = f(y, "052"); /* c */ x42 = f(y, "053"); /* c */ x42 = f(y, "054"); /* c */ x42 = f(y, "055"); /* c */ x42 = f(y, "056"); /* c */ x42 = f(y, "057"); /* c */ x42 = f(y, "058"); /* c */ x42 = f(y, "059"); /* c */ x42 = f(y, "060"); /* c */ x42 = f(y, "061"); /* c */ x42 = f(y, "062"); /* c */ x42 = f(y, "063"); /* c */ x42 = f(y, "064"); /* c */ x42 = f(y, "065"); /* c */ x42 = f(y, "066"); /* c */ x42 = f(y, "067"); /* c */ x42 = f(y, "068"); /* c */ x42 = f(y, "069"); /* c */ x42 = f(y, "070"); /* c */ x42 = f(y, "071"); /* c */ x42 = f(y, "072"); /* c */ x42 = f(y, "073"); /* c */ x42 = f(y, "074"); /* c */ x42 = f(y, "075"); /* c */ x42 = f(y, "076"); /* c */ x42 = f(y, "077"); /* c */ x42 = f(y, "078"); /* c */ x42 = f(y, "079"); /* c */ x42 = f(y, "080"); /* c */ x42 = f(y, "081"); /* c */ x42 = f(y, "082"); /* c */ x42 = f(y, "083"); /* c */ x42 = f(y, "084"); /* c */ x42 = f(y, "085"); /* c */ x42 = f(y, "086"); /* c */ x42 = f(y, "087"); /* c */ x42 = f(y, "088"); /* c */ x42 = f(y, "089"); /* c */ x42 = f(y, "090"); /* c */ x42 = f(y, "091"); /* c */ x42 = f(y, "092"); /* c */ x42 = f(y, "093"); /* c */ x42 = f(y, "094"); /* c */ x42 = f(y, "095"); /* c */ x42 = f(y, "096"); /* c */ x42 = f(y, "097"); /* c */ x42 = f(y, "098"); /* c */ x42 = f(y, "099"); /* c */ x42 = f(y, "100"); /* c */ x42 = f(y, "101"); /* c */ x42 = f(y, "102"); /* c */ x42 = f(y, "103"); /* c */ x42 = f(y, "104"); /* c */ x42 = f(y, "105"); /* c */ x42 = f(y, "106"); /* c */ x42 = f(y, "107"); /* c */ x42 = f(y, "108"); /* c */ x42 = f(y, "109"); /* c */ x42 = f(y, "110"); /* c */ x42 = f(y, "111"); /* c */ x42 = f(y, "112"); /* c */ x42 = f(y, "113"); /* c */ x42 = f(y, "114"); /* c */ x42 = f(y, "115"); /* c */ x42 = f(y, "116"); /* c */ x42 = f(y, "117"); /* c */ x42 = f(y, "118"); /* c */ x42 = f(y, "119"); /* c */ x42 = f(y, "120"); /* c */ x42 = f(y, "121"); /* c */ x42 = f(y, "122"); /* c */ x42 = f(y, "123"); /* c */ x42 = f(y, "124"); /* c */ x42 = f(y, "125"); /* c */ x42 = f(y, "126"); /* c */ x42 = f(y, "127"); /* c */ x42 = f(y, "128"); /* c */ x42 = f(y, "129"); /* c */ x42 = f(y, "130"); /* c */ x42 = f(y, "131"); /* c */ x42 = f(y, "132"); /* c */ x42 = f(y, "133"); /* c */ x42 = f(y, "134"); /* c */ x42 = f(y, "135"); /* c */ x42 = f(y, "136"); /* c */ x42 = f(y, "137"); /* c */ x42 = f(y, "138"); /* c */ x42 = f(y, "139"); /* c */ x42 = f(y, "140"); /* c */ x42 = f(y, "141"); /* c */ x42 = f(y, "142"); /* c */ x42 = f(y, "143"); /* c */ x42 = f(y, "144"); /* c */ x42 = f(y, "145"); /* c */ x42 = f(y, "146"); /* c */ x42 = f(y, "147"); /* c */ x42 = f(y, "148"); /* c */ x42 = f(y, "149"); /* c */ x42 = f(y, "150"); /* c */ x42 = f(y, "151"); /* c */ x42 = f(y, "152"); /* c */ x42 = f(y, "153"); /* c */ x42 = f(y, "154"); /* c */ x42 = f(y, "155"); /* c */ x42 = f(y, "156"); /* c */ x42 = f(y, "157"); /* c */ x42 = f(y, "158"); /* c */ x42 = f(y, "159"); /* c */ x42 = f(y, "160"); /* c */ x42 = f(y, "161"); /* c */ x42 = f(y, "162"); /* c */ x42 = f(y, "163"); /* c */ x42 = f(y, "164"); /* c */ x42 = f(y, "165"); /* c */ x42 = f(y, "166"); /* c */ x42 = f(y, "167"); /* c */ x42 = f(y, "168"); /* c */ x42 = f(y, "169"); /* c */ x42 = f(y, "170"); /* c */ x42 = f(y, "171"); /* c */ x42 = f(y, "172"); /* c */ x42 = f(y, "173"); /* c */ x42 = f(y, "174"); /* c */ x42 = f(y, "175"); /* c */ x42 = f(y, "176"); /* c */ x42 = f(y, "177"); /* c */ x42 = f(y, "178"); /* c */ x42 = f(y, "179"); /* c */ x42 = f(y, "180"); /* c */ x42 = f(y, "181"); /* c */ x42 = f(y, "182"); /* c */ x42 = f(y, "183"); /* c */ x42 = f(y, "184"); /* c */ x42 = f(y, "185"); /* c */ x42 = f(y, "186"); /* c */ x42 = f(y, "187"); /* c */ x42 = f(y, "188"); /* c */ x42 = f(y, "189"); /* c */ x42 = f(y, "190"); /* c */ x42 = f(y, "191"); /* c */ x42 = f(y, "192"); /* c */ x42 = f(y, "193"); /* c */ x42 = f(y, "194"); /* c */ x42 = f(y, "195"); /* c */ x42 = f(y, "196"); /* c */ x42 = f(y, "197"); /* c */ x42 = f(y, "198"); /* c */ x42 = f(y, "199"); /* c */ 
+x43 = f(y, "000"); /* c */ x43 = f(y, "001"); /* c */ x43 = f(y, "002"); /* c */ x43 = f(y, "003"); /* c */ x43 = f(y, "004"); /* c */ x43 = f(y, "005"); /* c */ x43 = f(y, "006"); /* c */ x43 = f(y, "007"); /* c */ x43 = f(y, "008"); /* c */ x43 = f(y, "009"); /* c */ x43 = f(y, "010"); /* c */ x43 = f(y, "011"); /* c */ x43 = f(y, "012"); /* c */ x43 = f(y, "013"); /* c */ x43 = f(y, "014"); /* c */ x43 = f(y, "015"); /* c */ x43 = f(y, "016"); /* c */ x43 = f(y, "017"); /* c */ x43 = f(y, "018"); /* c */ x43 = f(y, "019"); /* c */ x43 = f(y, "020"); /* c */ x43 = f(y, "021"); /* c */ x43 = f(y, "022"); /* c */ x43 = f(y, "023"); /* c */ x43 = f(y, "024"); /* c */ x43 = f(y, "025"); /* c */ x43 = f(y, "026"); /* c */ x43 = f(y, "027"); /* c */ x43 = f(y, "028"); /* c */ x43 = f(y, "029"); /* c */ x43 = f(y, "030"); /* c */ x43 = f(y, "031"); /* c */ x43 = f(y, "032"); /* c */ x43 = f(y, "033"); /* c */ x43 = f(y, "034"); /* c */ x43 = f(y, "035"); /* c */ x43 = f(y, "036"); /* c */ x43 = f(y, "037"); /* c */ x43 = f(y, "038"); /* c */ x43 = f(y, "039"); /* c */ x43 = f(y, "040"); /* c */ x43 = f(y, "041"); /* c */ x43 = f(y, "042"); /* c */ x43 = f(y, "043"); /* c */ x43 = f(y, "044"); /* c */ x43 = f(y, "045"); /* c */ x43 = f(y, "046"); /* c */ x43 = f(y, "047"); /* c */ x43 = f(y, "048"); /* c */ x43 = f(y, "049"); /* c */ x43 = f(y, "050"); /* c */ x43 = f(y, "051"); /* c */ x43 = f(y, "052"); /* c */ x43 = f(y, "053"); /* c */ x43 = f(y, "054"); /* c */ x43 = f(y, "055"); /* c */ x43 = f(y, "056"); /* c */ x43 = f(y, "057"); /* c */ x43 = f(y, "058"); /* c */ x43 = f(y, "059"); /* c */ x43 = f(y, "060"); /* c */ x43 = f(y, "061"); /* c */ x43 = f(y, "062"); /* c */ x43 = f(y, "063"); /* c */ x43 = f(y, "064"); /* c */ x43 = f(y, "065"); /* c */ x43 = f(y, "066"); /* c */ x43 = f(y, "067"); /* c */ x43 = f(y, "068"); /* c */ x43 = f(y, "069"); /* c */ x43 = f(y, "070"); /* c */ x43 = f(y, "071"); /* c */ x43 = f(y, "072"); /* c */ x43 = f(y, "073"); /* c */ x43 = f(y, "074"); /* c */ x43 = f(y, "075"); /* c */ x43 = f(y, "076"); /* c */ x43 = f(y, "077"); /* c */ x43 = f(y, "078"); /* c */ x43 = f(y, "079"); /* c */ x43 = f(y, "080"); /* c */ x43 = f(y, "081"); /* c */ x43 = f(y, "082"); /* c */ x43 = f(y, "083"); /* c */ x43 = f(y, "084"); /* c */ x43 = f(y, "085"); /* c */ x43 = f(y, "086"); /* c */ x43 = f(y, "087"); /* c */ x43 = f(y, "088"); /* c */ x43 = f(y, "089"); /* c */ x43 = f(y, "090"); /* c */ x43 = f(y, "091"); /* c */ x43 = f(y, "092"); /* c */ x43 = f(y, "093"); /* c */ x43 = f(y, "094"); /* c */ x43 = f(y, "095"); /* c */ x43 = f(y, "096"); /* c */ x43 = f(y, "097"); /* c */ x43 = f(y, "098"); /* c */ x43 = f(y, "099"); /* c */ x43 = f(y, "100"); /* c */ x43 = f(y, "101"); /* c */ x43 = f(y, "102"); /* c */ x43 = f(y, "103"); /* c */ x43 = f(y, "104"); /* c */ x43 = f(y, "105"); /* c */ x43 = f(y, "106"); /* c */ x43 = f(y, "107"); /* c */ x43 = f(y, "108"); /* c */ x43 = f(y, "109"); /* c */ x43 = f(y, "110"); /* c */ x43 = f(y, "111"); /* c */ x43 = f(y, "112"); /* c */ x43 = f(y, "113"); /* c */ x43 = f(y, "114"); /* c */ x43 = f(y, "115"); /* c */ x43 = f(y, "116"); /* c */ x43 = f(y, "117"); /* c */ x43 = f(y, "118"); /* c */ x43 = f(y, "119"); /* c */ x43 = f(y, "120"); /* c */ x43 = f(y, "121"); /* c */ x43 = f(y, "122"); /* c */ x43 = f(y, "123"); /* c */ x43 = f(y, "124"); /* c */ x43 = f(y, "125"); /* c */ x43 = f(y, "126"); /* c */ x43 = f(y, "127"); /* c */ x43 = f(y, "128"); /* c */ x43 = f(y, "129"); /* c */ x43 = f(y, "130"); /* c */ x43 = f(y, "131"); /* c */ x43 = f(y, "132"); /* c */ x43 = f(y, "133"); /* c */ x43 = f(y, "134"); /* c */ x43 = f(y, "135"); /* c */ x43 = f(y, "136"); /* c */ x43 = f(y, "137"); /* c */ x43 = f(y, "138"); /* c */ x43 = f(y, "139"); /* c */ x43 = f(y, "140"); /* c */ x43 = f(y, "141"); /* c */ x43 = f(y, "142"); /* c */ x43 = f(y, "143"); /* c */ x43 = f(y, "144"); /* c */ x43 = f(y, "145"); /* c */ x43 = f(y, "146"); /* c */ x43 = f(y, "147"); /* c */ x43 = f(y, "148"); /* c */ x43 = f(y, "149"); /* c */ x43 = f(y, "150"); /* c */ x43 = f(y, "151"); /* c */ x43 = f(y, "152"); /* c */ x43 = f(y, "153"); /* c */ x43 = f(y, "154"); /* c */ x43 = f(y, "155"); /* c */ x43 = f(y, "156"); /* c */ x43 = f(y, "157"); /* c */ x43 = f(y, "158"); /* c */ x43 = f(y, "159"); /* c */ x43 = f(y, "160"); /* c */ x43 = f(y, "161"); /* c */ x43 = f(y, "162"); /* c */ x43 = f(y, "163"); /* c */ x43 = f(y, "164"); /* c */ x43 = f(y, "165"); /* c */ x43 = f(y, "166"); /* c */ x43 = f(y, "167"); /* c */ x43 = f(y, "168"); /* c */ x43 = f(y, "169"); /* c */ x43 = f(y, "170"); /* c */ x43 = f(y, "171"); /* c */ x43 = f(y, "172"); /* c */ x43 = f(y, "173"); /* c */ x43 = f(y, "174"); /* c */ x43 = f(y, "175"); /* c */ x43 = f(y, "176"); /* c */ x43 = f(y, "177"); /* c */ x43 = f(y, "178"); /* c */ x43 = f(y, "179"); /* c */ x43 = f(y, "180"); /* c */ x43 = f(y, "181"); /* c */ x43 = f(y, "182"); /* c */ x43 = f(y, "183"); /* c */ x43 = f(y, "184"); /* c */ x43 = f(y, "185"); /* c */ x43 = f(y, "186"); /* c */ x43 = f(y, "187"); /* c */ x43 = f(y, "188"); /* c */ x43 = f(y, "189"); /* c */ x43 = f(y, "190"); /* c */ x43 = f(y, "191"); /* c */ x43 = f(y, "192"); /* c */ x43 = f(y, "193"); /* c */ x43 = f(y, "194"); /* c */ x43 = f(y, "195"); /* c */ x43 = f(y, "196"); /* c */ x43 = f(y, "197"); /* c */ x43 = f(y, "198"); /* c */ x43 = f(y, "199"); /* c */ 
+x44 = f(y, "000"); /* c */ x44 = f(y, "001"); /* c */ x44 = f(y, "002"); /* c */ x44 = f(y, "003"); /* c */ x44 = f(y, "004"); /* c */ x44 = f(y, "005"); /* c */ x44 = f(y, "006"); /* c */ x44 = f(y, "007"); /* c */ x44 = f(y, "008"); /* c */ x44 = f(y, "009"); /* c */ x44 = f(y, "010"); /* c */ x44 = f(y, "011"); /* c */ x44 = f(y, "012"); /* c */ x44 = f(y, "013"); /* c */ x44 = f(y, "014"); /* c */ x44 = f(y, "015"); /* c */ x44 = f(y, "016"); /* c */ x44 = f(y, "017"); /* c */ x44 = f(y, "018"); /* c */ x44 = f(y, "019"); /* c */ x44 = f(y, "020"); /* c */ x44 = f(y, "021"); /* c */ x44 = f(y, "022"); /* c */ x44 = f(y, "023"); /* c */ x44 = f(y, "024"); /* c */ x44 = f(y, "025"); /* c */ x44 = f(y, "026"); /* c */ x44 = f(y, "027"); /* c */ x44 = f(y, "028"); /* c */ x44 = f(y, "029"); /* c */ x44 = f(y, "030"); /* c */ x44 = f(y, "031"); /* c */ x44 = f(y, "032"); /* c */ x44 = f(y, "033"); /* c */ x44 = f(y, "034"); /* c */ x44 = f(y, "035"); /* c */ x44 = f(y, "036"); /* c */ x44 = f(y, "037"); /* c */ x44 = f(y, "038"); /* c */ x44 = f(y, "039"); /* c */ x44 = f(y, "040"); /* c */ x44 = f(y, "041"); /* c */ x44 = f(y, "042"); /* c */ x44 = f(y, "043"); /* c */ x44 = f(y, "044"); /* c */ x44 = f(y, "045"); /* c */ x44 = f(y, "046"); /* c */ x44 = f(y, "047"); /* c */ x44 = f(y, "048"); /* c */ x44 = f(y, "049"); /* c */ x44 = f(y, "050"); /* c */ x44 = f(y, "051"); /* c */ x44 = f(y, "052"); /* c */ x44 = f(y, "053"); /* c */ x44 = f(y, "054"); /* c */ x44 = f(y, "055"); /* c */ x44 = f(y, "056"); /* c */ x44 = f(y, "057"); /* c */ x44 = f(y, "058"); /* c */ x44 = f(y, "059"); /* c */ x44 = f(y, "060"); /* c */ x44 = f(y, "061"); /* c */ x44 = f(y, "062"); /* c */ x44 = f(y, "063"); /* c */ x44 = f(y, "064"); /* c */ x44 = f(y, "065"); /* c */ x44 = f(y, "066"); /* c */ x44 = f(y, "067"); /* c */ x44 = f(y, "068"); /* c */ x44 = f(y, "069"); /* c */ x44 = f(y, "070"); /* c */ x44 = f(y, "071"); /* c */ x44 = f(y, "072"); /* c */ x44 = f(y, "073"); /* c */ x44 = f(y, "074"); /* c */ x44 = f(y, "075"); /* c */ x44 = f(y, "076"); /* c */ x44 = f(y, "077"); /* c */ x44 = f(y, "078"); /* c */ x44 = f(y, "079"); /* c */ x44 = f(y, "080"); /* c */ x44 = f(y, "081"); /* c */ x44 = f(y, "082"); /* c */ x44 = f(y, "083"); /* c */ x44 = f(y, "084"); /* c */ x44 = f(y, "085"); /* c */ x44 = f(y, "086"); /* c */ x44 = f(y, "087"); /* c */ x44 = f(y, "088"); /* c */ x44 = f(y, "089"); /* c */ x44 = f(y, "090"); /* c */ x44 = f(y, "091"); /* c */ x44 = f(y, "092"); /* c */ x44 = f(y, "093"); /* c */ x44 = f(y, "094"); /* c */ x44 = f(y, "095"); /* c */ x44 = f(y, "096"); /* c */ x44 = f(y, "097"); /* c */ x44 = f(y, "098"); /* c */ x44 = f(y, "099"); /* c */ x44 = f(y, "100"); /* c */ x44 = f(y, "101"); /* c */ x44 = f(y, "102"); /* c */ x44 = f(y, "103"); /* c */ x44 = f(y, "104"); /* c */ x44 = f(y, "105"); /* c */ x44 = f(y, "106"); /* c */ x44 = f(y, "107"); /* c */ x44 = f(y, "108"); /* c */ x44 = f(y, "109"); /* c */ x44 = f(y, "110"); /* c */ x44 = f(y, "111"); /* c */ x44 = f(y, "112"); /* c */ x44 = f(y, "113"); /* c */ x44 = f(y, "114"); /* c */ x44 = f(y, "115"); /* c */ x44 = f(y, "116"); /* c */ x44 = f(y, "117"); /* c */ x44 = f(y, "118"); /* c */ x44 = f(y, "119"); /* c */ x44 = f(y, "120"); /* c */ x44 = f(y, "121"); /* c */ x44 = f(y, "122"); /* c */ x44 = f(y, "123"); /* c */ x44 = f(y, "124"); /* c */ x44 = f(y, "125"); /* c */ x44 = f(y, "126"); /* c */ x44 = f(y, "127"); /* c */ x44 = f(y, "128"); /* c */ x44 = f(y, "129"); /* c */ x44 = f(y, "130"); /* c */ x44 = f(y, "131"); /* c */ x44 = f(y, "132"); /* c */ x44 = f(y, "133"); /* c */ x44 = f(y, "134"); /* c */ x44 = f(y, "135"); /* c */ x44 = f(y, "136"); /* c */ x44 = f(y, "137"); /* c */ x44 = f(y, "138"); /* c */ x44 = f(y, "139"); /* c */ x44 = f(y, "140"); /* c */ x44 = f(y, "141"); /* c */ x44 = f(y, "142"); /* c */ x44 = f(y, "143"); /* c */ x44 = f(y, "144"); /* c */ x44 = f(y, "145"); /* c */ x44 = f(y, "146"); /* c */ x44 = f(y, "147"); /* c */ x44 = f(y, "148"); /* c */ x44 = f(y, "149"); /* c */ x44 = f(y, "150"); /* c */ x44 = f(y, "151"); /* c */ x44 = f(y, "152"); /* c */ x44 = f(y, "153"); /* c */ x44 = f(y, "154"); /* c */ x44 = f(y, "155"); /* c */ x44 = f(y, "156"); /* c */ x44 = f(y, "157"); /* c */ x44 = f(y, "158"); /* c */ x44 = f(y, "159"); /* c */ x44 = f(y, "160"); /* c */ x44 = f(y, "161"); /* c */ x44 = f(y, "162"); /* c */ x44 = f(y, "163"); /* c */ x44 = f(y, "164"); /* c */ x44 = f(y, "165"); /* c */ x44 = f(y, "166"); /* c */ x44 = f(y, "167"); /* c */ x44 = f(y, "168"); /* c */ x44 = f(y, "169"); /* c */ x44 = f(y, "170"); /* c */ x44 = f(y, "171"); /* c */ x44 = f(y, "172"); /* c */ x44 = f(y, "173"); /* c */ x44 = f(y, "174"); /* c */ x44 = f(y, "175"); /* c */ x44 = f(y, "176"); /* c */ x44 = f(y, "177"); /* c */ x44 = f(y, "178"); /* c */ x44 = f(y, "179"); /* c */ x44 = f(y, "180"); /* c */ x44 = f(y, "181"); /* c */ x44 = f(y, "182"); /* c */ x44 = f(y, "183"); /* c */ x44 = f(y, "184"); /* c */ x44 = f(y, "185"); /* c */ x44 = f(y, "186"); /* c */ x44 = f(y, "187"); /* c */ x44 = f(y, "188"); /* c */ x44 = f(y, "189"); /* c */ x44 = f(y, "190"); /* c */ x44 = f(y, "191"); /* c */ x44 = f(y, "192"); /* c */ x44 = f(y, "193"); /* c */ x44 = f(y, "194"); /* c */ x44 = f(y, "195"); /* c */ x44 = f(y, "196"); /* c */ x44 = f(y, "197"); /* c */ x44 = f(y, "198"); /* c */ x44 = f(y, "199"); /* c */ 
+x45 = f(y, "000"); /* c */ x45 = f(y, "001"); /* c */ x45 = f(y, "002"); /* c */ x45 = f(y, "003"); /* c */ x45 = f(y, "004"); /* c */ x45 = f(y, "005"); /* c */ x45 = f(y, "006"); /* c */ x45 = f(y, "007"); /* c */ x45 = f(y, "008"); /* c */ x45 = f(y, "009"); /* c */ x45 = f(y, "010"); /* c */ x45 = f(y, "011"); /* c */ x45 = f(y, "012"); /* c */ x45 = f(y, "013"); /* c */ x45 = f(y, "014"); /* c */ x45 = f(y, "015"); /* c */ x45 = f(y, "016"); /* c */ x45 = f(y, "017"); /* c */ x45 = f(y, "018"); /* c */ x45 = f(y, "019"); /* c */ x45 = f(y, "020"); /* c */ x45 = f(y, "021"); /* c */ x45 = f(y, "022"); /* c */ x45 = f(y, "023"); /* c */ x45 = f(y, "024"); /* c */ x45 = f(y, "025"); /* c */ x45 = f(y, "026"); /* c */ x45 = f(y, "027"); /* c */ x45 = f(y, "028"); /* c */ x45 = f(y, "029"); /* c */ x45 = f(y, "030"); /* c */ x45 = f(y, "031"); /* c */ x45 = f(y, "032"); /* c */ x45 = f(y, "033"); /* c */ x45 = f(y, "034"); /* c */ x45 = f(y, "035"); /* c */ x45 = f(y, "036"); /* c */ x45 = f(y, "037"); /* c */ x45 = f(y, "038"); /* c */ x45 = f(y, "039"); /* c */ x45 = f(y, "040"); /* c */ x45 = f(y, "041"); /* c */ x45 = f(y, "042"); /* c */ x45 = f(y, "043"); /* c */ x45 = f(y, "044"); /* c */ x45 = f(y, "045"); /* c */ x45 = f(y, "046"); /* c */ x45 = f(y, "047"); /* c */ x45 = f(y, "048"); /* c */ x45 = f(y, "049"); /* c */ x45 = f(y, "050"); /* c */ x45 = f(y, "051"); /* c */ x45 = f(y, "052"); /* c */ x45 = f(y, "053"); /* c */ x45 = f(y, "054"); /* c */ x45 = f(y, "055"); /* c */ x45 = f(y, "056"); /* c */ x45 = f(y, "057"); /* c */ x45 = f(y, "058"); /* c */ x45 = f(y, "059"); /* c */ x45 = f(y, "060"); /* c */ x45 = f(y, "061"); /* c */ x45 = f(y, "062"); /* c */ x45 = f(y, "063"); /* c */ x45 = f(y, "064"); /* c */ x45 = f(y, "065"); /* c */ x45 = f(y, "066"); /* c */ x45 = f(y, "067"); /* c */ x45 = f(y, "068"); /* c */ x45 = f(y, "069"); /* c */ x45 = f(y, "070"); /* c */ x45 = f(y, "071"); /* c */ x45 = f(y, "072"); /* c */ x45 = f(y, "073"); /* c */ x45 = f(y, "074"); /* c */ x45 = f(y, "075"); /* c */ x45 = f(y, "076"); /* c */ x45 = f(y, "077"); /* c */ x45 = f(y, "078"); /* c */ x45 = f(y, "079"); /* c */ x45 = f(y, "080"); /* c */ x45 = f(y, "081"); /* c */ x45 = f(y, "082"); /* c */ x45 = f(y, "083"); /* c */ x45 = f(y, "084"); /* c */ x45 = f(y, "085"); /* c */ x45 = f(y, "086"); /* c */ x45 = f(y, "087"); /* c */ x45 = f(y, "088"); /* c */ x45 = f(y, "089"); /* c */ x45 = f(y, "090"); /* c */ x45 = f(y, "091"); /* c */ x45 = f(y, "092"); /* c */ x45 = f(y, "093"); /* c */ x45 = f(y, "094"); /* c */ x45 = f(y, "095"); /* c */ x45 = f(y, "096"); /* c */ x45 = f(y, "097"); /* c */ x45 = f(y, "098"); /* c */ x45 = f(y, "099"); /* c */ x45 = f(y, "100"); /* c */ x45 = f(y, "101"); /* c */ x45 = f(y, "102"); /* c */ x45 = f(y, "103"); /* c */ x45 = f(y, "104"); /* c */ x45 = f(y, "105"); /* c */ x45 = f(y, "106"); /* c */ x45 = f(y, "107"); /* c */ x45 = f(y, "108"); /* c */ x45 = f(y, "109"); /* c */ x45 = f(y, "110"); /* c */ x45 = f(y, "111"); /* c */ x45 = f(y, "112"); /* c */ x45 = f(y, "113"); /* c */ x45 = f(y, "114"); /* c */ x45 = f(y, "115"); /* c */ x45 = f(y, "116"); /* c */ x45 = f(y, "117"); /* c */ x45 = f(y, "118"); /* c */ x45 = f(y, "119"); /* c */ x45 = f(y, "120"); /* c */ x45 = f(y, "121"); /* c */ x45 = f(y, "122"); /* c */ x45 = f(y, "123"); /* c */ x45 = f(y, "124"); /* c */ x45 = f(y, "125"); /* c */ x45 = f(y, "126"); /* c */ x45 = f(y, "127"); /* c */ x45 = f(y, "128"); /* c */ x45 = f(y, "129"); /* c */ x45 = f(y, "130"); /* c */ x45 = f(y, "131"); /* c */ x45 = f(y, "132"); /* c */ x45 = f(y, "133"); /* c */ x45 = f(y, "134"); /* c */ x45 = f(y, "135"); /* c */ x45 = f(y, "136"); /* c */ x45 = f(y, "137"); /* c */ x45 = f(y, "138"); /* c */ x45 = f(y, "139"); /* c */ x45 = f(y, "140"); /* c */ x45 = f(y, "141"); /* c */ x45 = f(y, "142"); /* c */ x45 = f(y, "143"); /* c */ x45 = f(y, "144"); /* c */ x45 = f(y, "145"); /* c */ x45 = f(y, "146"); /* c */ x45 = f(y, "147"); /* c */ x45 = f(y, "148"); /* c */ x45 = f(y, "149"); /* c */ x45 = f(y, "150"); /* c */ x45 = f(y, "151"); /* c */ x45 = f(y, "152"); /* c */ x45 = f(y, "153"); /* c */ x45 = f(y, "154"); /* c */ x45 = f(y, "155"); /* c */ x45 = f(y, "156"); /* c */ x45 = f(y, "157"); /* c */ x45 = f(y, "158"); /* c */ x45 = f(y, "159"); /* c */ x45 = f(y, "160"); /* c */ x45 = f(y, "161"); /* c */ x45 = f(y, "162"); /* c */ x45 = f(y, "163"); /* c */ x45 = f(y, "164"); /* c */ x45 = f(y, "165"); /* c */ x45 = f(y, "166"); /* c */ x45 = f(y, "167"); /* c */ x45 = f(y, "168"); /* c */ x45 = f(y, "169"); /* c */ x45 = f(y, "170"); /* c */ x45 = f(y, "171"); /* c */ x45 = f(y, "172"); /* c */ x45 = f(y, "173"); /* c */ x45 = f(y, "174"); /* c */ x45 = f(y, "175"); /* c */ x45 = f(y, "176"); /* c */ x45 = f(y, "177"); /* c */ x45 = f(y, "178"); /* c */ x45 = f(y, "179"); /* c */ x45 = f(y, "180"); /* c */ x45 = f(y, "181"); /* c */ x45 = f(y, "182"); /* c */ x45 = f(y, "183"); /* c */ x45 = f(y, "184"); /* c */ x45 = f(y, "185"); /* c */ x45 = f(y, "186"); /* c */ x45 = f(y, "187"); /* c */ x45 = f(y, "188"); /* c */ x45 = f(y, "189"); /* c */ x45 = f(y, "190"); /* c */ x45 = f(y, "191"); /* c */ x45 = f(y, "192"); /* c */ x45 = f(y, "193"); /* c */ x45 = f(y, "194"); /* c */ x45 = f(y, "195"); /* c */ x45 = f(y, "196"); /* c */ x45 = f(y, "197"); /* c */ x45 = f(y, "198"); /* c */ x45 = f(y, "199"); /* c */ 
+x46 = f(y, "000"); /* c */ x46 = f(y, "001"); /* c */ x46 = f(y, "002"); /* c */ x46 = f(y, "003"); /* c */ x46 = f(y, "004"); /* c */ x46 = f(y, "005"); /* c */ x46 = f(y, "006"); /* c */ x46 = f(y, "007"); /* c */ x46 = f(y, "008"); /* c */ x46 = f(y, "009"); /* c */ x46 = f(y, "010"); /* c */ x46 = f(y, "011"); /* c */ x46 = f(y, "012"); /* c */ x46 = f(y, "013"); /* c */ x46 = f(y, "014"); /* c */ x46 = f(y, "015"); /* c */ x46 = f(y, "016"); /* c */ x46 = f(y, "017"); /* c */ x46 = f(y, "018"); /* c */ x46 = f(y, "019"); /* c */ x46 = f(y, "020"); /* c */ x46 = f(y, "021"); /* c */ x46 = f(y, "022"); /* c */ x46 = f(y, "023"); /* c */ x46 = f(y, "024"); /* c */ x46 = f(y, "025"); /* c */ x46 = f(y, "026"); /* c */ x46 = f(y, "027"); /* c */ x46 = f(y, "028"); /* c */ x46 = f(y, "029"); /* c */ x46 = f(y, "030"); /* c */ x46 = f(y, "031"); /* c */ x46 = f(y, "032"); /* c */ x46 = f(y, "033"); /* c */ x46 = f(y, "034"); /* c */ x46 = f(y, "035"); /* c */ x46 = f(y, "036"); /* c */ x46 = f(y, "037"); /* c */ x46 = f(y, "038"); /* c */ x46 = f(y, "039"); /* c */ x46 = f(y, "040"); /* c */ x46 = f(y, "041"); /* c */ x46 = f(y, "042"); /* c */ x46 = f(y, "043"); /* c */ x46 = f(y, "044"); /* c */ x46 = f(y, "045"); /* c */ x46 = f(y, "046"); /* c */ x46 = f(y, "047"); /* c */ x46 = f(y, "048"); /* c */ x46 = f(y, "049"); /* c */ x46 = f(y, "050"); /* c */ x46 = f(y, "051"); /* c */ x46 = f(y, "052"); /* c */ x46 = f(y, "053"); /* c */ x46 = f(y, "054"); /* c */ x46 = f(y, "055"); /* c */ x46 = f(y, "056"); /* c */ x46 = f(y, "057"); /* c */ x46 = f(y, "058"); /* c */ x46 = f(y, "059"); /* c */ x46 = f(y, "060"); /* c */ x46 = f(y, "061"); /* c */ x46 = f(y, "062"); /* c */ x46 = f(y, "063"); /* c */ x46 = f(y, "064"); /* c */ x46 = f(y, "065"); /* c */ x46 = f(y, "066"); /* c */ x46 = f(y, "067"); /* c */ x46 = f(y, "068"); /* c */ x46 = f(y, "069"); /* c */ x46 = f(y, "070"); /* c */ x46 = f(y, "071"); /* c */ x46 = f(y, "072"); /* c */ x46 = f(y, "073"); /* c */ x46 = f(y, "074"); /* c */ x46 = f(y, "075"); /* c */ x46 = f(y, "076"); /* c */ x46 = f(y, "077"); /* c */ x46 = f(y, "078"); /* c */ x46 = f(y, "079"); /* c */ x46 = f(y, "080"); /* c */ x46 = f(y, "081"); /* c */ x46 = f(y, "082"); /* c */ x46 = f(y, "083"); /* c */ x46 = f(y, "084"); /* c */ x46 = f(y, "085"); /* c */ x46 = f(y, "086"); /* c */ x46 = f(y, "087"); /* c */ x46 = f(y, "088"); /* c */ x46 = f(y, "089"); /* c */ x46 = f(y, "090"); /* c */ x46 = f(y, "091"); /* c */ x46 = f(y, "092"); /* c */ x46 = f(y, "093"); /* c */ x46 = f(y, "094"); /* c */ x46 = f(y, "095"); /* c */ x46 = f(y, "096"); /* c */ x46 = f(y, "097"); /* c */ x46 = f(y, "098"); /* c */ x46 = f(y, "099"); /* c */ x46 = f(y, "100"); /* c */ x46 = f(y, "101"); /* c */ x46 = f(y, "102"); /* c */ x46 = f(y, "103"); /* c */ x46 = f(y, "104"); /* c */ x46 = f(y, "105"); /* c */ x46 = f(y, "106"); /* c */ x46 = f(y, "107"); /* c */ x46 = f(y, "108"); /* c */ x46 = f(y, "109"); /* c */ x46 = f(y, "110"); /* c */ x46 = f(y, "111"); /* c */ x46 = f(y, "112"); /* c */ x46 = f(y, "113"); /* c */ x46 = f(y, "114"); /* c */ x46 = f(y, "115"); /* c */ x46 = f(y, "116"); /* c */ x46 = f(y, "117"); /* c */ x46 = f(y, "118"); /* c */ x46 = f(y, "119"); /* c */ x46 = f(y, "120"); /* c */ x46 = f(y, "121"); /* c */ x46 = f(y, "122"); /* c */ x46 = f(y, "123"); /* c */ x46 = f(y, "124"); /* c */ x46 = f(y, "125"); /* c */ x46 = f(y, "126"); /* c */ x46 = f(y, "127"); /* c */ x46 = f(y, "128"); /* c */ x46 = f(y, "129"); /* c */ x46 = f(y, "130"); /* c */ x46 = f(y, "131"); /* c */ x46 = f(y, "132"); /* c */ x46 = f(y, "133"); /* c */ x46 = f(y, "134"); /* c */ x46 = f(y, "135"); /* c */ x46 = f(y, "136"); /* c */ x46 = f(y, "137"); /* c */ x46 = f(y, "138"); /* c */ x46 = f(y, "139"); /* c */ x46 = f(y, "140"); /* c */ x46 = f(y, "141"); /* c */ x46 = f(y, "142"); /* c */ x46 = f(y, "143"); /* c */ x46 = f(y, "144"); /* c */ x46 = f(y, "145"); /* c */ x46 = f(y, "146"); /* c */ x46 = f(y, "147"); /* c */ x46 = f(y, "148"); /* c */ x46 = f(y, "149"); /* c */ x46 = f(y, "150"); /* c */ x46 = f(y, "151"); /* c */ x46 = f(y, "152"); /* c */ x46 = f(y, "153"); /* c */ x46 = f(y, "154"); /* c */ x46 = f(y, "155"); /* c */ x46 = f(y, "156"); /* c */ x46 = f(y, "157"); /* c */ x46 = f(y, "158"); /* c */ x46 = f(y, "159"); /* c */ x46 = f(y, "160"); /* c */ x46 = f(y, "161"); /* c */ x46 = f(y, "162"); /* c */ x46 = f(y, "163"); /* c */ x46 = f(y, "164"); /* c */ x46 = f(y, "165"); /* c */ x46 = f(y, "166"); /* c */ x46 = f(y, "167"); /* c */ x46 = f(y, "168"); /* c */ x46 = f(y, "169"); /* c */ x46 = f(y, "170"); /* c */ x46 = f(y, "171"); /* c */ x46 = f(y, "172"); /* c */ x46 = f(y, "173"); /* c */ x46 = f(y, "174"); /* c */ x46 = f(y, "175"); /* c */ x46 = f(y, "176"); /* c */ x46 = f(y, "177"); /* c */ x46 = f(y, "178"); /* c */ x46 = f(y, "179"); /* c */ x46 = f(y, "180"); /* c */ x46 = f(y, "181"); /* c */ x46 = f(y, "182"); /* c */ x46 = f(y, "183"); /* c */ x46 = f(y, "184"); /* c */ x46 = f(y, "185"); /* c */ x46 = f(y, "186"); /* c */ x46 = f(y, "187"); /* c */ x46 = f(y, "188"); /* c */ x46 = f(y, "189"); /* c */ x46 = f(y, "190"); /* c */ x46 = f(y, "191"); /* c */ x46 = f(y, "192"); /* c */ x46 = f(y, "193"); /* c */ x46 = f(y, "194"); /* c */ x46 = f(y, "195"); /* c */ x46 = f(y, "196"); /* c */ x46 = f(y, "197"); /* c */ x46 = f(y, "198"); /* c */ x46 = f(y, "199"); /* c */ 
+x47 = f(y, "000"); /* c */ x47 = f(y, "001"); /* c */ x47 = f(y, "002"); /* c */ x47 = f(y, "003"); /* c */ x47 = f(y, "004"); /* c */ x47 = f(y, "005"); /* c */ x47 = f(y, "006"); /* c */ x47 = f(y, "007"); /* c */ x47 = f(y, "008"); /* c */ x47 = f(y, "009"); /* c */ x47 = f(y, "010"); /* c */ x47 = f(y, "011"); /* c */ x47 = f(y, "012"); /* c */ x47 = f(y, "013"); /* c */ x47 = f(y, "014"); /* c */ x47 = f(y, "015"); /* c */ x47 = f(y, "016"); /* c */ x47 = f(y, "017"); /* c */ x47 = f(y, "018"); /* c */ x47 = f(y, "019"); /* c */ x47 = f(y, "020"); /* c */ x47 = f(y, "021"); /* c */ x47 = f(y, "022"); /* c */ x47 = f(y, "023"); /* c */ x47 = f(y, "024"); /* c */ x47 = f(y, "025"); /* c */ x47 = f(y, "026"); /* c */ x47 = f(y, "027"); /* c */ x47 = f(y, "028"); /* c */ x47 = f(y, "029"); /* c */ x47 = f(y, "030"); /* c */ x47 = f(y, "031"); /* c */ x47 = f(y, "032"); /* c */ x47 = f(y, "033"); /* c */ x47 = f(y, "034"); /* c */ x47 = f(y, "035"); /* c */ x47 = f(y, "036"); /* c */ x47 = f(y, "037"); /* c */ x47 = f(y, "038"); /* c */ x47 = f(y, "039"); /* c */ x47 = f(y, "040"); /* c */ x47 = f(y, "041"); /* c */ x47 = f(y, "042"); /* c */ x47 = f(y, "043"); /* c */ x47 = f(y, "044"); /* c */ x47 = f(y, "045"); /* c */ x47 = f(y, "046"); /* c */ x47 = f(y, "047"); /* c */ x47 = f(y, "048"); /* c */ x47 = f(y, "049"); /* c */ x47 = f(y, "050"); /* c */ x47 = f(y, "051"); /* c */ x47 = f(y, "052"); /* c */ x47 = f(y, "053"); /* c */ x47 = f(y, "054"); /* c */ x47 = f(y, "055"); /* c */ x47 = f(y, "056"); /* c */ x47 = f(y, "057"); /* c */ x47 = f(y, "058"); /* c */ x47 = f(y, "059"); /* c */ x47 = f(y, "060"); /* c */ x47 = f(y, "061"); /* c */ x47 = f(y, "062"); /* c */ x47 = f(y, "063"); /* c */ x47 = f(y, "064"); /* c */ x47 = f(y, "065"); /* c */ x47 = f(y, "066"); /* c */ x47 = f(y, "067"); /* c */ x47 = f(y, "068"); /* c */ x47 = f(y, "069"); /* c */ x47 = f(y, "070"); /* c */ x47 = f(y, "071"); /* c */ x47 = f(y, "072"); /* c */ x47 = f(y, "073"); /* c */ x47 = f(y, "074"); /* c */ x47 = f(y, "075"); /* c */ x47 = f(y, "076"); /* c */ x47 = f(y, "077"); /* c */ x47 = f(y, "078"); /* c */ x47 = f(y, "079"); /* c */ x47 = f(y, "080"); /* c */ x47 = f(y, "081"); /* c */ x47 = f(y, "082"); /* c */ x47 = f(y, "083"); /* c */ x47 = f(y, "084"); /* c */ x47 = f(y, "085"); /* c */ x47 = f(y, "086"); /* c */ x47 = f(y, "087"); /* c */ x47 = f(y, "088"); /* c */ x47 = f(y, "089"); /* c */ x47 = f(y, "090"); /* c */ x47 = f(y, "091"); /* c */ x47 = f(y, "092"); /* c */ x47 = f(y, "093"); /* c */ x47 = f(y, "094"); /* c */ x47 = f(y, "095"); /* c */ x47 = f(y, "096"); /* c */ x47 = f(y, "097"); /* c */ x47 = f(y, "098"); /* c */ x47 = f(y, "099"); /* c */ x47 = f(y, "100"); /* c */ x47 = f(y, "101"); /* c */ x47 = f(y, "102"); /* c */ x47 = f(y, "103"); /* c */ x47 = f(y, "104"); /* c */ x47 = f(y, "105"); /* c */ x47 = f(y, "106"); /* c */ x47 = f(y, "107"); /* c */ x47 = f(y, "108"); /* c */ x47 = f(y, "109"); /* c */ x47 = f(y, "110"); /* c */ x47 = f(y, "111"); /* c */ x47 = f(y, "112"); /* c */ x47 = f(y, "113"); /* c */ x47 = f(y, "114"); /* c */ x47 = f(y, "115"); /* c */ x47 = f(y, "116"); /* c */ x47 = f(y, "117"); /* c */ x47 = f(y, "118"); /* c */ x47 = f(y, "119"); /* c */ x47 = f(y, "120"); /* c */ x47 = f(y, "121"); /* c */ x47 = f(y, "122"); /* c */ x47 = f(y, "123"); /* c */ x47 = f(y, "124"); /* c */ x47 = f(y, "125"); /* c */ x47 = f(y, "126"); /* c */ x47 = f(y, "127"); /* c */ x47 = f(y, "128"); /* c */ x47 = f(y, "129"); /* c */ x47 = f(y, "130"); /* c */ x47 = f(y, "131"); /* c */ x47 = f(y, "132"); /* c */ x47 = f(y, "133"); /* c */ x47 = f(y, "134"); /* c */ x47 = f(y, "135"); /* c */ x47 = f(y, "136"); /* c */ x47 = f(y, "137"); /* c */ x47 = f(y, "138"); /* c */ x47 = f(y, "139"); /* c */ x47 = f(y, "140"); /* c */ x47 = f(y, "141"); /* c */ x47 = f(y, "142"); /* c */ x47 = f(y, "143"); /* c */ x47 = f(y, "144"); /* c */ x47 = f(y, "145"); /* c */ x47 = f(y, "146"); /* c */ x47 = f(y, "147"); /* c */ x47 = f(y, "148"); /* c */ x47 = f(y, "149"); /* c */ x47 = f(y, "150"); /* c */ x47 = f(y, "151"); /* c */ x47 = f(y, "152"); /* c */ x47 = f(y, "153"); /* c */ x47 = f(y, "154"); /* c */ x47 = f(y, "155"); /* c */ x47 = f(y, "156"); /* c */ x47 = f(y, "157"); /* c */ x47 = f(y, "158"); /* c */ x47 = f(y, "159"); /* c */ x47 = f(y, "160"); /* c */ x47 = f(y, "161"); /* c */ x47 = f(y, "162"); /* c */ x47 = f(y, "163"); /* c */ x47 = f(y, "164"); /* c */ x47 = f(y, "165"); /* c */ x47 = f(y, "166"); /* c */ x47 = f(y, "167"); /* c */ x47 = f(y, "168"); /* c */ x47 = f(y, "169"); /* c */ x47 = f(y, "170"); /* c */ x47 = f(y, "171"); /* c */ x47 = f(y, "172"); /* c */ x47 = f(y, "173"); /* c */ x47 = f(y, "174"); /* c */ x47 = f(y, "175"); /* c */ x47 = f(y, "176"); /* c */ x47 = f(y, "177"); /* c */ x47 = f(y, "178"); /* c */ x47 = f(y, "179"); /* c */ x47 = f(y, "180"); /* c */ x47 = f(y, "181"); /* c */ x47 = f(y, "182"); /* c */ x47 = f(y, "183"); /* c */ x47 = f(y, "184"); /* c */ x47 = f(y, "185"); /* c */ x47 = f(y, "186"); /* c */ x47 = f(y, "187"); /* c */ x47 = f(y, "188"); /* c */ x47 = f(y, "189"); /* c */ x47 = f(y, "190"); /* c */ x47 = f(y, "191"); /* c */ x47 = f(y, "192"); /* c */ x47 = f(y, "193"); /* c */ x47 = f(y, "194"); /* c */ x47 = f(y, "195"); /* c */ x47 = f(y, "196"); /* c */ x47 = f(y, "197"); /* c */ x47 = f(y, "198"); /* c */ x47 = f(y, "199"); /* c */ 
+x48 = f(y, "000"); /* c */ x48 = f(y, "001"); /* c */ x48 = f(y, "002"); /* c */ x48 = f(y, "003"); /* c */ x48 = f(y, "004"); /* c */ x48 = f(y, "005"); /* c */ x48 = f(y, "006"); /* c */ x48 = f(y, "007"); /* c */ x48 = f(y, "008"); /* c */ x48 = f(y, "009"); /* c */ x48 = f(y, "010"); /* c */ x48 = f(y, "011"); /* c */ x48 = f(y, "012"); /* c */ x48 = f(y, "013"); /* c */ x48 = f(y, "014"); /* c */ x48 = f(y, "015"); /* c */ x48 = f(y, "016"); /* c */ x48 = f(y, "017"); /* c */ x48 = f(y, "018"); /* c */ x48 = f(y, "019"); /* c */ x48 = f(y, "020"); /* c */ x48 = f(y, "021"); /* c */ x48 = f(y, "022"); /* c */ x48 = f(y, "023"); /* c */ x48 = f(y, "024"); /* c */ x48 = f(y, "025"); /* c */ x48 = f(y, "026"); /* c */ x48 = f(y, "027"); /* c */ x48 = f(y, "028"); /* c */ x48 = f(y, "029"); /* c */ x48 = f(y, "030"); /* c */ x48 = f(y, "031"); /* c */ x48 = f(y, "032"); /* c */ x48 = f(y, "033"); /* c */ x48 = f(y, "034"); /* c */ x48 = f(y, "035"); /* c */ x48 = f(y, "036"); /* c */ x48 = f(y, "037"); /* c */ x48 = f(y, "038"); /* c */ x48 = f(y, "039"); /* c */ x48 = f(y, "040"); /* c */ x48 = f(y, "041"); /* c */ x48 = f(y, "042"); /* c */ x48 = f(y, "043"); /* c */ x48 = f(y, "044"); /* c */ x48 = f(y, "045"); /* c */ x48 = f(y, "046"); /* c */ x48 = f(y, "047"); /* c */ x48 = f(y, "048"); /* c */ x48 = f(y, "049"); /* c */ x48 = f(y, "050"); /* c */ x48 = f(y, "051"); /* c */ x48 = f(y, "052"); /* c */ x48 = f(y, "053"); /* c */ x48 = f(y, "054"); /* c */ x48 = f(y, "055"); /* c */ x48 = f(y, "056"); /* c */ x48 = f(y, "057"); /* c */ x48 = f(y, "058"); /* c */ x48 = f(y, "059"); /* c */ x48 = f(y, "060"); /* c */ x48 = f(y, "061"); /* c */ x48 = f(y, "062"); /* c */ x48 = f(y, "063"); /* c */ x48 = f(y, "064"); /* c */ x48 = f(y, "065"); /* c */ x48 = f(y, "066"); /* c */ x48 = f(y, "067"); /* c */ x48 = f(y, "068"); /* c */ x48 = f(y, "069"); /* c */ x48 = f(y, "070"); /* c */ x48 = f(y, "071"); /* c */ x48 = f(y, "072"); /* c */ x48 = f(y, "073"); /* c */ x48 = f(y, "074"); /* c */ x48 = f(y, "075"); /* c */ x48 = f(y, "076"); /* c */ x48 = f(y, "077"); /* c */ x48 = f(y, "078"); /* c */ x48 = f(y, "079"); /* c */ x48 = f(y, "080"); /* c */ x48 = f(y, "081"); /* c */ x48 = f(y, "082"); /* c */ x48 = f(y, "083"); /* c */ x48 = f(y, "084"); /* c */ x48 = f(y, "085"); /* c */ x48 = f(y, "086"); /* c */ x48 = f(y, "087"); /* c */ x48 = f(y, "088"); /* c */ x48 = f(y, "089"); /* c */ x48 = f(y, "090"); /* c */ x48 = f(y, "091"); /* c */ x48 = f(y, "092"); /* c */ x48 = f(y, "093"); /* c */ x48 = f(y, "094"); /* c */ x48 = f(y, "095"); /* c */ x48 = f(y, "096"); /* c */ x48 = f(y, "097"); /* c */ x48 = f(y, "098"); /* c */ x48 = f(y, "099"); /* c */ x48 = f(y, "100"); /* c */ x48 = f(y, "101"); /* c */ x48 = f(y, "102"); /* c */ x48 = f(y, "103"); /* c */ x48 = f(y, "104"); /* c */ x48 = f(y, "105"); /* c */ x48 = f(y, "106"); /* c */ x48 = f(y, "107"); /* c */ x48 = f(y, "108"); /* c */ x48 = f(y, "109"); /* c */ x48 = f(y, "110"); /* c */ x48 = f(y, "111"); /* c */ x48 = f(y, "112"); /* c */ x48 = f(y, "113"); /* c */ x48 = f(y, "114"); /* c */ x48 = f(y, "115"); /* c */ x48 = f(y, "116"); /* c */ x48 = f(y, "117"); /* c */ x48 = f(y, "118"); /* c */ x48 = f(y, "119"); /* c */ x48 = f(y, "120"); /* c */ x48 = f(y, "121"); /* c */ x48 = f(y, "122"); /* c */ x48 = f(y, "123"); /* c */ x48 = f(y, "124"); /* c */ x48 = f(y, "125"); /* c */ x48 = f(y, "126"); /* c */ x48 = f(y, "127"); /* c */ x48 = f(y, "128"); /* c */ x48 = f(y, "129"); /* c */ x48 = f(y, "130"); /* c */ x48 = f(y, "131"); /* c */ x48 = f(y, "132"); /* c */ x48 = f(y, "133"); /* c */ x48 = f(y, "134"); /* c */ x48 = f(y, "135"); /* c */ x48 = f(y, "136"); /* c */ x48 = f(y, "137"); /* c */ x48 = f(y, "138"); /* c */ x48 = f(y, "139"); /* c */ x48 = f(y, "140"); /* c */ x48 = f(y, "141"); /* c */ x48 = f(y, "142"); /* c */ x48 = f(y, "143"); /* c */ x48 = f(y, "144"); /* c */ x48 = f(y, "145"); /* c */ x48 = f(y, "146"); /* c */ x48 = f(y, "147"); /* c */ x48 = f(y, "148"); /* c */ x48 = f(y, "149"); /* c */ x48 = f(y, "150"); /* c */ x48 = f(y, "151"); /* c */ x48 = f(y, "152"); /* c */ x48 = f(y, "153"); /* c */ x48 = f(y, "154"); /* c */ x48 = f(y, "155"); /* c */ x48 = f(y, "156"); /* c */ x48 = f(y, "157"); /* c */ x48 = f(y, "158"); /* c */ x48 = f(y, "159"); /* c */ x48 = f(y, "160"); /* c */ x48 = f(y, "161"); /* c */ x48 = f(y, "162"); /* c */ x48 = f(y, "163"); /* c */ x48 = f(y, "164"); /* c */ x48 = f(y, "165"); /* c */ x48 = f(y, "166"); /* c */ x48 = f(y, "167"); /* c */ x48 = f(y, "168"); /* c */ x48 = f(y, "169"); /* c */ x48 = f(y, "170"); /* c */ x48 = f(y, "171"); /* c */ x48 = f(y, "172"); /* c */ x48 = f(y, "173"); /* c */ x48 = f(y, "174"); /* c */ x48 = f(y, "175"); /* c */ x48 = f(y, "176"); /* c */ x48 = f(y, "177"); /* c */ x48 = f(y, "178"); /* c */ x48 = f(y, "179"); /* c */ x48 = f(y, "180"); /* c */ x48 = f(y, "181"); /* c */ x48 = f(y, "182"); /* c */ x48 = f(y, "183"); /* c */ x48 = f(y, "184"); /* c */ x48 = f(y, "185"); /* c */ x48 = f(y, "186"); /* c */ x48 = f(y, "187"); /* c */ x48 = f(y, "188"); /* c */ x48 = f(y, "189"); /* c */ x48 = f(y, "190"); /* c */ x48 = f(y, "191"); /* c */ x48 = f(y, "192"); /* c */ x48 = f(y, "193"); /* c */ x48 = f(y, "194"); /* c */ x48 = f(y, "195"); /* c */ x48 = f(y, "196"); /* c */ x48 = f(y, "197"); /* c */ x48 = f(y, "198"); /* c */ x48 = f(y, "199"); /* c */ 
+x49 = f(y, "000"); /* c */ x49 = f(y, "001"); /* c */ x49 = f(y, "002"); /* c */ x49 = f(y, "003"); /* c */ x49 = f(y, "004"); /* c */ x49 = f(y, "005"); /* c */ x49 = f(y, "006"); /* c */ x49 = f(y, "007"); /* c */ x49 = f(y, "008"); /* c */ x49 = f(y, "009"); /* c */ x49 = f(y, "010"); /* c */ x49 = f(y, "011"); /* c */ x49 = f(y, "012"); /* c */ x49 = f(y, "013"); /* c */ x49 = f(y, "014"); /* c */ x49 = f(y, "015"); /* c */ x49 = f(y, "016"); /* c */ x49 = f(y, "017"); /* c */ x49 = f(y, "018"); /* c */ x49 = f(y, "019"); /* c */ x49 = f(y, "020"); /* c */ x49 = f(y, "021"); /* c */ x49 = f(y, "022"); /* c */ x49 = f(y, "023"); /* c */ x49 = f(y, "024"); /* c */ x49 = f(y, "025"); /* c */ x49 = f(y, "026"); /* c */ x49 = f(y, "027"); /* c */ x49 = f(y, "028"); /* c */ x49 = f(y, "029"); /* c */ x49 = f(y, "030"); /* c */ x49 = f(y, "031"); /* c */ x49 = f(y, "032"); /* c */ x49 = f(y, "033"); /* c */ x49 = f(y, "034"); /* c */ x49 = f(y, "035"); /* c */ x49 = f(y, "036"); /* c */ x49 = f(y, "037"); /* c */ x49 = f(y, "038"); /* c */ x49 = f(y, "039"); /* c */ x49 = f(y, "040"); /* c */ x49 = f(y, "041"); /* c */ x49 = f(y, "042"); /* c */ x49 = f(y, "043"); /* c */ x49 = f(y, "044"); /* c */ x49 = f(y, "045"); /* c */ x49 = f(y, "046"); /* c */ x49 = f(y, "047"); /* c */ x49 = f(y, "048"); /* c */ x49 = f(y, "049"); /* c */ x49 = f(y, "050"); /* c */ x49 = f(y, "051"); /* c */ x49 = f(y, "052"); /* c */ x49 = f(y, "053"); /* c */ x49 = f(y, "054"); /* c */ x49 = f(y, "055"); /* c */ x49 = f(y, "056"); /* c */ x49 = f(y, "057"); /* c */ x49 = f(y, "058"); /* c */ x49 = f(y, "059"); /* c */ x49 = f(y, "060"); /* c */ x49 = f(y, "061"); /* c */ x49 = f(y, "062"); /* c */ x49 = f(y, "063"); /* c */ x49 = f(y, "064"); /* c */ x49 = f(y, "065"); /* c */ x49 = f(y, "066"); /* c */ x49 = f(y, "067"); /* c */ x49 = f(y, "068"); /* c */ x49 = f(y, "069"); /* c */ x49 = f(y, "070"); /* c */ x49 = f(y, "071"); /* c */ x49 = f(y, "072"); /* c */ x49 = f(y, "073"); /* c */ x49 = f(y, "074"); /* c */ x49 = f(y, "075"); /* c */ x49 = f(y, "076"); /* c */ x49 = f(y, "077"); /* c */ x49 = f(y, "078"); /* c */ x49 = f(y, "079"); /* c */ x49 = f(y, "080"); /* c */ x49 = f(y, "081"); /* c */ x49 = f(y, "082"); /* c */ x49 = f(y, "083"); /* c */ x49 = f(y, "084"); /* c */ x49 = f(y, "085"); /* c */ x49 = f(y, "086"); /* c */ x49 = f(y, "087"); /* c */ x49 = f(y, "088"); /* c */ x49 = f(y, "089"); /* c */ x49 = f(y, "090"); /* c */ x49 = f(y, "091"); /* c */ x49 = f(y, "092"); /* c */ x49 = f(y, "093"); /* c */ x49 = f(y, "094"); /* c */ x49 = f(y, "095"); /* c */ x49 = f(y, "096"); /* c */ x49 = f(y, "097"); /* c */ x49 = f(y, "098"); /* c */ x49 = f(y, "099"); /* c */ x49 = f(y, "100"); /* c */ x49 = f(y, "101"); /* c */ x49 = f(y, "102"); /* c */ x49 = f(y, "103"); /* c */ x49 = f(y, "104"); /* c */ x49 = f(y, "105"); /* c */ x49 = f(y, "106"); /* c */ x49 = f(y, "107"); /* c */ x49 = f(y, "108"); /* c */ x49 = f(y, "109"); /* c */ x49 = f(y, "110"); /* c */ x49 = f(y, "111"); /* c */ x49 = f(y, "112"); /* c */ x49 = f(y, "113"); /* c */ x49 = f(y, "114"); /* c */ x49 = f(y, "115"); /* c */ x49 = f(y, "116"); /* c */ x49 = f(y, "117"); /* c */ x49 = f(y, "118"); /* c */ x49 = f(y, "119"); /* c */ x49 = f(y, "120"); /* c */ x49 = f(y, "121"); /* c */ x49 = f(y, "122"); /* c */ x49 = f(y, "123"); /* c */ x49 = f(y, "124"); /* c */ x49 = f(y, "125"); /* c */ x49 = f(y, "126"); /* c */ x49 = f(y, "127"); /* c */ x49 = f(y, "128"); /* c */ x49 = f(y, "129"); /* c */ x49 = f(y, "130"); /* c */ x49 = f(y, "131"); /* c */ x49 = f(y, "132"); /* c */ x49 = f(y, "133"); /* c */ x49 = f(y, "134"); /* c */ x49 = f(y, "135"); /* c */ x49 = f(y, "136"); /* c */ x49 = f(y, "137"); /* c */ x49 = f(y, "138"); /* c */ x49 = f(y, "139"); /* c */ x49 = f(y, "140"); /* c */ x49 = f(y, "141"); /* c */ x49 = f(y, "142"); /* c */ x49 = f(y, "143"); /* c */ x49 = f(y, "144"); /* c */ x49 = f(y, "145"); /* c */ x49 = f(y, "146"); /* c */ x49 = f(y, "147"); /* c */ x49 = f(y, "148"); /* c */ x49 = f(y, "149"); /* c */ x49 = f(y, "150"); /* c */ x49 = f(y, "151"); /* c */ x49 = f(y, "152"); /* c */ x49 = f(y, "153"); /* c */ x49 = f(y, "154"); /* c */ x49 = f(y, "155"); /* c */ x49 = f(y, "156"); /* c */ x49 = f(y, "157"); /* c */ x49 = f(y, "158"); /* c */ x49 = f(y, "159"); /* c */ x49 = f(y, "160"); /* c */ x49 = f(y, "161"); /* c */ x49 = f(y, "162"); /* c */ x49 = f(y, "163"); /* c */ x49 = f(y, "164"); /* c */ x49 = f(y, "165"); /* c */ x49 = f(y, "166"); /* c */ x49 = f(y, "167"); /* c */ x49 = f(y, "168"); /* c */ x49 = f(y, "169"); /* c */ x49 = f(y, "170"); /* c */ x49 = f(y, "171"); /* c */ x49 = f(y, "172"); /* c */ x49 = f(y, "173"); /* c */ x49 = f(y, "174"); /* c */ x49 = f(y, "175"); /* c */ x49 = f(y, "176"); /* c */ x49 = f(y, "177"); /* c */ x49 = f(y, "178"); /* c */ x49 = f(y, "179"); /* c */ x49 = f(y, "180"); /* c */ x49 = f(y, "181"); /* c */ x49 = f(y, "182"); /* c */ x49 = f(y, "183"); /* c */ x49 = f(y, "184"); /* c */ x49 = f(y, "185"); /* c */ x49 = f(y, "186"); /* c */ x49 = f(y, "187"); /* c */ x49 = f(y, "188"); /* c */ x49 = f(y, "189"); /* c */ x49 = f(y, "190"); /* c */ x49 = f(y, "191"); /* c */ x49 = f(y, "192"); /* c */ x49 = f(y, "193"); /* c */ x49 = f(y, "194"); /* c */ x49 = f(y, "195"); /* c */ x49 = f(y, "196"); /* c */ x49 = f(y, "197"); /* c */ x49 = f(y, "198"); /* c */ x49 = f(y, "199"); /* c */ 
+x50 = f(y, "000"); /* c */ x50 = f(y, "001"); /* c */ x50 = f(y, "002"); /* c */ x50 = f(y, "003"); /* c */ x50 = f(y, "004"); /* c */ x50 = f(y, "005"); /* c */ x50 = f(y, "006"); /* c */ x50 = f(y, "007"); /* c */ x50 = f(y, "008"); /* c */ x50 = f(y, "009"); /* c */ x50 = f(y, "010"); /* c */ x50 = f(y, "011"); /* c */ x50 = f(y, "012"); /* c */ x50 = f(y, "013"); /* c */ x50 = f(y, "014"); /* c */ x50 = f(y, "015"); /* c */ x50 = f(y, "016"); /* c */ x50 = f(y, "017"); /* c */ x50 = f(y, "018"); /* c */ x50 = f(y, "019"); /* c */ x50 = f(y, "020"); /* c */ x50 = f(y, "021"); /* c */ x50 = f(y, "022"); /* c */ x50 = f(y, "023"); /* c */ x50 = f(y, "024"); /* c */ x50 = f(y, "025"); /* c */ x50 = f(y, "026"); /* c */ x50 = f(y, "027"); /* c */ x50 = f(y, "028"); /* c */ x50 = f(y, "029"); /* c */ x50 = f(y, "030"); /* c */ x50 = f(y, "031"); /* c */ x50 = f(y, "032"); /* c */ x50 = f(y, "033"); /* c */ x50 = f(y, "034"); /* c */ x50 = f(y, "035"); /* c */ x50 = f(y, "036"); /* c */ x50 = f(y, "037"); /* c */ x50 = f(y, "038"); /* c */ x50 = f(y, "039"); /* c */ x50 = f(y, "040"); /* c */ x50 = f(y, "041"); /* c */ x50 = f(y, "042"); /* c */ x50 = f(y, "043"); /* c */ x50 = f(y, "044"); /* c */ x50 = f(y, "045"); /* c */ x50 = f(y, "046"); /* c */ x50 = f(y, "047"); /* c */ x50 = f(y, "048"); /* c */ x50 = f(y, "049"); /* c */ x50 = f(y, "050"); /* c */ x50 = f(y, "051"); /* c */ x50 = f(y, "052"); /* c */ x50 = f(y, "053"); /* c */ x50 = f(y, "054"); /* c */ x50 = f(y, "055"); /* c */ x50 = f(y, "056"); /* c */ x50 = f(y, "057"); /* c */ x50 = f(y, "058"); /* c */ x50 = f(y, "059"); /* c */ x50 = f(y, "060"); /* c */ x50 = f(y, "061"); /* c */ x50 = f(y, "062"); /* c */ x50 = f(y, "063"); /* c */ x50 = f(y, "064"); /* c */ x50 = f(y, "065"); /* c */ x50 = f(y, "066"); /* c */ x50 = f(y, "067"); /* c */ x50 = f(y, "068"); /* c */ x50 = f(y, "069"); /* c */ x50 = f(y, "070"); /* c */ x50 = f(y, "071"); /* c */ x50 = f(y, "072"); /* c */ x50 = f(y, "073"); /* c */ x50 = f(y, "074"); /* c */ x50 = f(y, "075"); /* c */ x50 = f(y, "076"); /* c */ x50 = f(y, "077"); /* c */ x50 = f(y, "078"); /* c */ x50 = f(y, "079"); /* c */ x50 = f(y, "080"); /* c */ x50 = f(y, "081"); /* c */ x50 = f(y, "082"); /* c */ x50 = f(y, "083"); /* c */ x50 = f(y, "084"); /* c */ x50 = f(y, "085"); /* c */ x50 = f(y, "086"); /* c */ x50 = f(y, "087"); /* c */ x50 = f(y, "088"); /* c */ x50 = f(y, "089"); /* c */ x50 = f(y, "090"); /* c */ x50 = f(y, "091"); /* c */ x50 = f(y, "092"); /* c */ x50 = f(y, "093"); /* c */ x50 = f(y, "094"); /* c */ x50 = f(y, "095"); /* c */ x50 = f(y, "096"); /* c */ x50 = f(y, "097"); /* c */ x50 = f(y, "098"); /* c */ x50 = f(y, "099"); /* c */ x50 = f(y, "100"); /* c */ x50 = f(y, "101"); /* c */ x50 = f(y, "102"); /* c */ x50 = f(y, "103"); /* c */ x50 = f(y, "104"); /* c */ x50 = f(y, "105"); /* c */ x50 = f(y, "106"); /* c */ x50 = f(y, "107"); /* c */ x50 = f(y, "108"); /* c */ x50 = f(y, "109"); /* c */ x50 = f(y, "110"); /* c */ x50 = f(y, "111"); /* c */ x50 = f(y, "112"); /* c */ x50 = f(y, "113"); /* c */ x50 = f(y, "114"); /* c */ x50 = f(y, "115"); /* c */ x50 = f(y, "116"); /* c */ x50 = f(y, "117"); /* c */ x50 = f(y, "118"); /* c */ x50 = f(y, "119"); /* c */ x50 = f(y, "120"); /* c */ x50 = f(y, "121"); /* c */ x50 = f(y, "122"); /* c */ x50 = f(y, "123"); /* c */ x50 = f(y, "124"); /* c */ x50 = f(y, "125"); /* c */ x50 = f(y, "126"); /* c */ x50 = f(y, "127"); /* c */ x50 = f(y, "128"); /* c */ x50 = f(y, "129"); /* c */ x50 = f(y, "130"); /* c */ x50 = f(y, "131"); /* c */ x50 = f(y, "132"); /* c */ x50 = f(y, "133"); /* c */ x50 = f(y, "134"); /* c */ x50 = f(y, "135"); /* c */ x50 = f(y, "136"); /* c */ x50 = f(y, "137"); /* c */ x50 = f(y, "138"); /* c */ x50 = f(y, "139"); /* c */ x50 = f(y, "140"); /* c */ x50 = f(y, "141"); /* c */ x50 = f(y, "142"); /* c */ x50 = f(y, "143"); /* c */ x50 = f(y, "144"); /* c */ x50 = f(y, "145"); /* c */ x50 = f(y, "146"); /* c */ x50 = f(y, "147"); /* c */ x50 = f(y, "148"); /* c */ x50 = f(y, "149"); /* c */ x50 = f(y, "150"); /* c */ x50 = f(y, "151"); /* c */ x50 = f(y, "152"); /* c */ x50 = f(y, "153"); /* c */ x50 = f(y, "154"); /* c */ x50 = f(y, "155"); /* c */ x50 = f(y, "156"); /* c */ x50 = f(y, "157"); /* c */ x50 = f(y, "158"); /* c */ x50 = f(y, "159"); /* c */ x50 = f(y, "160"); /* c */ x50 = f(y, "161"); /* c */ x50 = f(y, "162"); /* c */ x50 = f(y, "163"); /* c */ x50 = f(y, "164"); /* c */ x50 = f(y, "165"); /* c */ x50 = f(y, "166"); /* c */ x50 = f(y, "167"); /* c */ x50 = f(y, "168"); /* c */ x50 = f(y, "169"); /* c */ x50 = f(y, "170"); /* c */ x50 = f(y, "171"); /* c */ x50 = f(y, "172"); /* c */ x50 = f(y, "173"); /* c */ x50 = f(y, "174"); /* c */ x50 = f(y, "175"); /* c */ x50 = f(y, "176"); /* c */ x50 = f(y, "177"); /* c */ x50 = f(y, "178"); /* c */ x50 = f(y, "179"); /* c */ x50 = f(y, "180"); /* c */ x50 = f(y, "181"); /* c */ x50 = f(y, "182"); /* c */ x50 = f(y, "183"); /* c */ x50 = f(y, "184"); /* c */ x50 = f(y, "185"); /* c */ x50 = f(y, "186"); /* c */ x50 = f(y, "187"); /* c */ x50 = f(y, "188"); /* c */ x50 = f(y, "189"); /* c */ x50 = f(y, "190"); /* c */ x50 = f(y, "191"); /* c */ x50 = f(y, "192"); /* c */ x50 = f(y, "193"); /* c */ x50 = f(y, "194"); /* c */ x50 = f(y, "195"); /* c */ x50 = f(y, "196"); /* c */ x50 = f(y, "197"); /* c */ x50 = f(y, "198"); /* c */ x50 = f(y, "199"); /* c */ 
+x51 = f(y, "000"); /* c */ x51 = f(y, "001"); /* c */ x51 = f(y, "002"); /* c */ x51 = f(y, "003"); /* c */ x51 = f(y, "004"); /* c */ x51 = f(y, "005"); /* c */ x51 = f(y, "006"); /* c */ x51 = f(y, "007"); /* c */ x51 = f(y, "008"); /* c */ x51 = f(y, "009"); /* c */ x51 = f(y, "010"); /* c */ x51 = f(y, "011"); /* c */ x51 = f(y, "012"); /* c */ x51 = f(y, "013"); /* c */ x51 = f(y, "014"); /* c */ x51 = f(y, "015"); /* c */ x51 = f(y, "016"); /* c */ x51 = f(y, "017"); /* c */ x51 = f(y, "018"); /* c */ x51 = f(y, "019"); /* c */ x51 = f(y, "020"); /* c */ x51 = f(y, "021"); /* c */ x51 = f(y, "022"); /* c */ x51 = f(y, "023"); /* c */ x51 = f(y, "024"); /* c */ x51 = f(y, "025"); /* c */ x51 = f(y, "026"); /* c */ x51 = f(y, "027"); /* c */ x51 = f(y, "028"); /* c */ x51 = f(y, "029"); /* c */ x51 = f(y, "030"); /* c */ x51 = f(y, "031"); /* c */ x51 = f(y, "032"); /* c */ x51 = f(y, "033"); /* c */ x51 = f(y, "034"); /* c */ x51 = f(y, "035"); /* c */ x51 = f(y, "036"); /* c */ x51 = f(y, "037"); /* c */ x51 = f(y, "038"); /* c */ x51 = f(y, "039"); /* c */ x51 = f(y, "040"); /* c */ x51 = f(y, "041"); /* c */ x51 = f(y, "042"); /* c */ x51 = f(y, "043"); /* c */ x51 = f(y, "044"); /* c */ x51 = f(y, "045"); /* c */ x51 = f(y, "046"); /* c */ x51 = f(y, "047"); /* c */ x51 = f(y, "048"); /* c */ x51 = f(y, "049"); /* c */ x51 = f(y, "050"); /* c */ x51 = f(y, "051"); /* c */ x51 = f(y, "052"); /* c */ x51 = f(y, "053"); /* c */ x51 = f(y, "054"); /* c */ x51 = f(y, "055"); /* c */ x51 = f(y, "056"); /* c */ x51 = f(y, "057"); /* c */ x51 = f(y, "058"); /* c */ x51 = f(y, "059"); /* c */ x51 = f(y, "060"); /* c */ x51 = f(y, "061"); /* c */ x51 = f(y, "062"); /* c */ x51 = f(y, "063"); /* c */ x51 = f(y, "064"); /* c */ x51 = f(y, "065"); /* c */ x51 = f(y, "066"); /* c */ x51 = f(y, "067"); /* c */ x51 = f(y, "068"); /* c */ x51 = f(y, "069"); /* c */ x51 = f(y, "070"); /* c */ x51 = f(y, "071"); /* c */ x51 = f(y, "072"); /* c */ x51 = f(y, "073"); /* c */ x51 = f(y, "074"); /* c */ x51 = f(y, "075"); /* c */ x51 = f(y, "076"); /* c */ x51 = f(y, "077"); /* c */ x51 = f(y, "078"); /* c */ x51 = f(y, "079"); /* c */ x51 = f(y, "080"); /* c */ x51 = f(y, "081"); /* c */ x51 = f(y, "082"); /* c */ x51 = f(y, "083"); /* c */ x51 = f(y, "084"); /* c */ x51 = f(y, "085"); /* c */ x51 = f(y, "086"); /* c */ x51 = f(y, "087"); /* c */ x51 = f(y, "088"); /* c */ x51 = f(y, "089"); /* c */ x51 = f(y, "090"); /* c */ x51 = f(y, "091"); /* c */ x51 = f(y, "092"); /* c */ x51 = f(y, "093"); /* c */ x51 = f(y, "094"); /* c */ x51 = f(y, "095"); /* c */ x51 = f(y, "096"); /* c */ x51 = f(y, "097"); /* c */ x51 = f(y, "098"); /* c */ x51 = f(y, "099"); /* c */ x51 = f(y, "100"); /* c */ x51 = f(y, "101"); /* c */ x51 = f(y, "102"); /* c */ x51 = f(y, "103"); /* c */ x51 = f(y, "104"); /* c */ x51 = f(y, "105"); /* c */ x51 = f(y, "106"); /* c */ x51 = f(y, "107"); /* c */ x51 = f(y, "108"); /* c */ x51 = f(y, "109"); /* c */ x51 = f(y, "110"); /* c */ x51 = f(y, "111"); /* c */ x51 = f(y, "112"); /* c */ x51 = f(y, "113"); /* c */ x51 = f(y, "114"); /* c */ x51 = f(y, "115"); /* c */ x51 = f(y, "116"); /* c */ x51 = f(y, "117"); /* c */ x51 = f(y, "118"); /* c */ x51 = f(y, "119"); /* c */ x51 = f(y, "120"); /* c */ x51 = f(y, "121"); /* c */ x51 = f(y, "122"); /* c */ x51 = f(y, "123"); /* c */ x51 = f(y, "124"); /* c */ x51 = f(y, "125"); /* c */ x51 = f(y, "126"); /* c */ x51 = f(y, "127"); /* c */ x51 = f(y, "128"); /* c */ x51 = f(y, "129"); /* c */ x51 = f(y, "130"); /* c */ x51 = f(y, "131"); /* c */ x51 = f(y, "132"); /* c */ x51 = f(y, "133"); /* c */ x51 = f(y, "134"); /* c */ x51 = f(y, "135"); /* c */ x51 = f(y, "136"); /* c */ x51 = f(y, "137"); /* c */ x51 = f(y, "138"); /* c */ x51 = f(y, "139"); /* c */ x51 = f(y, "140"); /* c */ x51 = f(y, "141"); /* c */ x51 = f(y, "142"); /* c */ x51 = f(y, "143"); /* c */ x51 = f(y, "144"); /* c */ x51 = f(y, "145"); /* c */ x51 = f(y, "146"); /* c */ x51 = f(y, "147"); /* c */ x51 = f(y, "148"); /* c */ x51 = f(y, "149"); /* c */ x51 = f(y, "150"); /* c */ x51 = f(y, "151"); /* c */ x51 = f(y, "152"); /* c */ x51 = f(y, "153"); /* c */ x51 = f(y, "154"); /* c */ x51 = f(y, "155"); /* c */ x51 = f(y, "156"); /* c */ x51 = f(y, "157"); /* c */ x51 = f(y, "158"); /* c */ x51 = f(y, "159"); /* c */ x51 = f(y, "160"); /* c */ x51 = f(y, "161"); /* c */ x51 = f(y, "162"); /* c */ x51 = f(y, "163"); /* c */ x51 = f(y, "164"); /* c */ x51 = f(y, "165"); /* c */ x51 = f(y, "166"); /* c */ x51 = f(y, "167"); /* c */ x51 = f(y, "168"); /* c */ x51 = f(y, "169"); /* c */ x51 = f(y, "170"); /* c */ x51 = f(y, "171"); /* c */ x51 = f(y, "172"); /* c */ x51 = f(y, "173"); /* c */ x51 = f(y, "174"); /* c */ x51 = f(y, "175"); /* c */ x51 = f(y, "176"); /* c */ x51 = f(y, "177"); /* c */ x51 = f(y, "178"); /* c */ x51 = f(y, "179"); /* c */ x51 = f(y, "180"); /* c */ x51 = f(y, "181"); /* c */ x51 = f(y, "182"); /* c */ x51 = f(y, "183"); /* c */ x51 = f(y, "184"); /* c */ x51 = f(y, "185"); /* c */ x51 = f(y, "186"); /* c */ x51 = f(y, "187"); /* c */ x51 = f(y, "188"); /* c */ x51 = f(y, "189"); /* c */ x51 = f(y, "190"); /* c */ x51 = f(y, "191"); /* c */ x51 = f(y, "192"); /* c */ x51 = f(y, "193"); /* c */ x51 = f(y, "194"); /* c */ x51 = f(y, "195"); /* c */ x51 = f(y, "196"); /* c */ x51 = f(y, "197"); /* c */ x51 = f(y, "198"); /* c */ x51 = f(y, "199"); /* c */ 
+x52 = f(y, "000"); /* c */ x52 = f(y, "001"); /* c */ x52 = f(y, "002"); /* c */ x52 = f(y, "003"); /* c */ x52 = f(y, "004"); /* c */ x52 = f(y, "005"); /* c */ x52 = f(y, "006"); /* c */ x52 = f(y, "007"); /* c */ x52 = f(y, "008"); /* c */ x52 = f(y, "009"); /* c */ x52 = f(y, "010"); /* c */ x52 = f(y, "011"); /* c */ x52 = f(y, "012"); /* c */ x52 = f(y, "013"); /* c */ x52 = f(y, "014"); /* c */ x52 = f(y, "015"); /* c */ x52 = f(y, "016"); /* c */ x52 = f(y, "017"); /* c */ x52 = f(y, "018"); /* c */ x52 = f(y, "019"); /* c */ x52 = f(y, "020"); /* c */ x52 = f(y, "021"); /* c */ x52 = f(y, "022"); /* c */ x52 = f(y, "023"); /* c */ x52 = f(y, "024"); /* c */ x52 = f(y, "025"); /* c */ x52 = f(y, "026"); /* c */ x52 = f(y, "027"); /* c */ x52 = f(y, "028"); /* c */ x52 = f(y, "029"); /* c */ x52 = f(y, "030"); /* c */ x52 = f(y, "031"); /* c */ x52 = f(y, "032"); /* c */ x52 = f(y, "033"); /* c */ x52 = f(y, "034"); /* c */ x52 = f(y, "035"); /* c */ x52 = f(y, "036"); /* c */ x52 = f(y, "037"); /* c */ x52 = f(y, "038"); /* c */ x52 = f(y, "039"); /* c */ x52 = f(y, "040"); /* c */ x52 = f(y, "041"); /* c */ x52 = f(y, "042"); /* c */ x52 = f(y, "043"); /* c */ x52 = f(y, "044"); /* c */ x52 = f(y, "045"); /* c */ x52 = f(y, "046"); /* c */ x52 = f(y, "047"); /* c */ x52 = f(y, "048"); /* c */ x52 = f(y, "049"); /* c */ x52 = f(y, "050"); /* c */ x52 = f(y, "051"); /* c */ x52 = f(y, "052"); /* c */ x52 = f(y, "053"); /* c */ x52 = f(y, "054"); /* c */ x52 = f(y, "055"); /* c */ x52 = f(y, "056"); /* c */ x52 = f(y, "057"); /* c */ x52 = f(y, "058"); /* c */ x52 = f(y, "059"); /* c */ x52 = f(y, "060"); /* c */ x52 = f(y, "061"); /* c */ x52 = f(y, "062"); /* c */ x52 = f(y, "063"); /* c */ x52 = f(y, "064"); /* c */ x52 = f(y, "065"); /* c */ x52 = f(y, "066"); /* c */ x52 = f(y, "067"); /* c */ x52 = f(y, "068"); /* c */ x52 = f(y, "069"); /* c */ x52 = f(y, "070"); /* c */ x52 = f(y, "071"); /* c */ x52 = f(y, "072"); /* c */ x52 = f(y, "073"); /* c */ x52 = f(y, "074"); /* c */ x52 = f(y, "075"); /* c */ x52 = f(y, "076"); /* c */ x52 = f(y, "077"); /* c */ x52 = f(y, "078"); /* c */ x52 = f(y, "079"); /* c */ x52 = f(y, "080"); /* c */ x52 = f(y, "081"); /* c */ x52 = f(y, "082"); /* c */ x52 = f(y, "083"); /* c */ x52 = f(y, "084"); /* c */ x52 = f(y, "085"); /* c */ x52 = f(y, "086"); /* c */ x52 = f(y, "087"); /* c */ x52 = f(y, "088"); /* c */ x52 = f(y, "089"); /* c */ x52 = f(y, "090"); /* c */ x52 = f(y, "091"); /* c */ x52 = f(y, "092"); /* c */ x52 = f(y, "093"); /* c */ x52 = f(y, "094"); /* c */ x52 = f(y, "095"); /* c */ x52 = f(y, "096"); /* c */ x52 = f(y, "097"); /* c */ x52 = f(y, "098"); /* c */ x52 = f(y, "099"); /* c */ x52 = f(y, "100"); /* c */ x52 = f(y, "101"); /* c */ x52 = f(y, "102"); /* c */ x52 = f(y, "103"); /* c */ x52 = f(y, "104"); /* c */ x52 = f(y, "105"); /* c */ x52 = f(y, "106"); /* c */ x52 = f(y, "107"); /* c */ x52 = f(y, "108"); /* c */ x52 = f(y, "109"); /* c */ x52 = f(y, "110"); /* c */ x52 = f(y, "111"); /* c */ x52 = f(y, "112"); /* c */ x52 = f(y, "113"); /* c */ x52 = f(y, "114"); /* c */ x52 = f(y, "115"); /* c */ x52 = f(y, "116"); /* c */ x52 = f(y, "117"); /* c */ x52 = f(y, "118"); /* c */ x52 = f(y, "119"); /* c */ x52 = f(y, "120"); /* c */ x52 = f(y, "121"); /* c */ x52 = f(y, "122"); /* c */ x52 = f(y, "123"); /* c */ x52 = f(y, "124"); /* c */ x52 = f(y, "125"); /* c */ x52 = f(y, "126"); /* c */ x52 = f(y, "127"); /* c */ x52 = f(y, "128"); /* c */ x52 = f(y, "129"); /* c */ x52 = f(y, "130"); /* c */ x52 = f(y, "131"); /* c */ x52 = f(y, "132"); /* c */ x52 = f(y, "133"); /* c */ x52 = f(y, "134"); /* c */ x52 = f(y, "135"); /* c */ x52 = f(y, "136"); /* c */ x52 = f(y, "137"); /* c */ x52 = f(y, "138"); /* c */ x52 = f(y, "139"); /* c */ x52 = f(y, "140"); /* c */ x52 = f(y, "141"); /* c */ x52 = f(y, "142"); /* c */ x52 = f(y, "143"); /* c */ x52 = f(y, "144"); /* c */ x52 = f(y, "145"); /* c */ x52 = f(y, "146"); /* c */ x52 = f(y, "147"); /* c */ x52 = f(y, "148"); /* c */ x52 = f(y, "149"); /* c */ x52 = f(y, "150"); /* c */ x52 = f(y, "151"); /* c */ x52 = f(y, "152"); /* c */ x52 = f(y, "153"); /* c */ x52 = f(y, "154"); /* c */ x52 = f(y, "155"); /* c */ x52 = f(y, "156"); /* c */ x52 = f(y, "157"); /* c */ x52 = f(y, "158"); /* c */ x52 = f(y, "159"); /* c */ x52 = f(y, "160"); /* c */ x52 = f(y, "161"); /* c */ x52 = f(y, "162"); /* c */ x52 = f(y, "163"); /* c */ x52 = f(y, "164"); /* c */ x52 = f(y, "165"); /* c */ x52 = f(y, "166"); /* c */ x52 = f(y, "167"); /* c */ x52 = f(y, "168"); /* c */ x52 = f(y, "169"); /* c */ x52 = f(y, "170"); /* c */ x52 = f(y, "171"); /* c */ x52 = f(y, "172"); /* c */ x52 = f(y, "173"); /* c */ x52 = f(y, "174"); /* c */ x52 = f(y, "175"); /* c */ x52 = f(y, "176"); /* c */ x52 = f(y, "177"); /* c */ x52 = f(y, "178"); /* c */ x52 = f(y, "179"); /* c */ x52 = f(y, "180"); /* c */ x52 = f(y, "181"); /* c */ x52 = f(y, "182"); /* c */ x52 = f(y, "183"); /* c */ x52 = f(y, "184"); /* c */ x52 = f(y, "185"); /* c */ x52 = f(y, "186"); /* c */ x52 = f(y, "187"); /* c */ x52 = f(y, "188"); /* c */ x52 = f(y, "189"); /* c */ x52 = f(y, "190"); /* c */ x52 = f(y, "191"); /* c */ x52 = f(y, "192"); /* c */ x52 = f(y, "193"); /* c */ x52 = f(y, "194"); /* c */ x52 = f(y, "195"); /* c */ x52 = f(y, "196"); /* c */ x52 = f(y, "197"); /* c */ x52 = f(y, "198"); /* c */ x52 = f(y, "199"); /* c */ 
+x53 = f(y, "000"); /* c */ x53 = f(y, "001"); /* c */ x53 = f(y, "002"); /* c */ x53 = f(y, "003"); /* c */ x53 = f(y, "004"); /* c */ x53 = f(y, "005"); /* c */ x53 = f(y, "006"); /* c */ x53 = f(y, "007"); /* c */ x53 = f(y, "008"); /* c */ x53 = f(y, "009"); /* c */ x53 = f(y, "010"); /* c */ x53 = f(y, "011"); /* c */ x53 = f(y, "012"); /* c */ x53 = f(y, "013"); /* c */ x53 = f(y, "014"); /* c */ x53 = f(y, "015"); /* c */ x53 = f(y, "016"); /* c */ x53 = f(y, "017"); /* c */ x53 = f(y, "018"); /* c */ x53 = f(y, "019"); /* c */ x53 = f(y, "020"); /* c */ x53 = f(y, "021"); /* c */ x53 = f(y, "022"); /* c */ x53 = f(y, "023"); /* c */ x53 = f(y, "024"); /* c */ x53 = f(y, "025"); /* c */ x53 = f(y, "026"); /* c */ x53 = f(y, "027"); /* c */ x53 = f(y, "028"); /* c */ x53 = f(y, "029"); /* c */ x53 = f(y, "030"); /* c */ x53 = f(y, "031"); /* c */ x53 = f(y, "032"); /* c */ x53 = f(y, "033"); /* c */ x53 = f(y, "034"); /* c */ x53 = f(y, "035"); /* c */ x53 = f(y, "036"); /* c */ x53 = f(y, "037"); /* c */ x53 = f(y, "038"); /* c */ x53 = f(y, "039"); /* c */ x53 = f(y, "040"); /* c */ x53 = f(y, "041"); /* c */ x53 = f(y, "042"); /* c */ x53 = f(y, "043"); /* c */ x53 = f(y, "044"); /* c */ x53 = f(y, "045"); /* c */ x53 = f(y, "046"); /* c */ x53 = f(y, "047"); /* c */ x53 = f(y, "048"); /* c */ x53 = f(y, "049"); /* c */ x53 = f(y, "050"); /* c */ x53 = f(y, "051"); /* c */ x53 = f(y, "052"); /* c */ x53 = f(y, "053"); /* c */ x53 = f(y, "054"); /* c */ x53 = f(y, "055"); /* c */ x53 = f(y, "056"); /* c */ x53 = f(y, "057"); /* c */ x53 = f(y, "058"); /* c */ x53 = f(y, "059"); /* c */ x53 = f(y, "060"); /* c */ x53 = f(y, "061"); /* c */ x53 = f(y, "062"); /* c */ x53 = f(y, "063"); /* c */ x53 = f(y, "064"); /* c */ x53 = f(y, "065"); /* c */ x53 = f(y, "066"); /* c */ x53 = f(y, "067"); /* c */ x53 = f(y, "068"); /* c */ x53 = f(y, "069"); /* c */ x53 = f(y, "070"); /* c */ x53 = f(y, "071"); /* c */ x53 = f(y, "072"); /* c */ x53 = f(y, "073"); /* c */ x53 = f(y, "074"); /* c */ x53 = f(y, "075"); /* c */ x53 = f(y, "076"); /* c */ x53 = f(y, "077"); /* c */ x53 = f(y, "078"); /* c */ x53 = f(y, "079"); /* c */ x53 = f(y, "080"); /* c */ x53 = f(y, "081"); /* c */ x53 = f(y, "082"); /* c */ x53 = f(y, "083"); /* c */ x53 = f(y, "084"); /* c */ x53 = f(y, "085"); /* c */ x53 = f(y, "086"); /* c */ x53 = f(y, "087"); /* c */ x53 = f(y, "088"); /* c */ x53 = f(y, "089"); /* c */ x53 = f(y, "090"); /* c */ x53 = f(y, "091"); /* c */ x53 = f(y, "092"); /* c */ x53 = f(y, "093"); /* c */ x53 = f(y, "094"); /* c */ x53 = f(y, "095"); /* c */ x53 = f(y, "096"); /* c */ x53 = f(y, "097"); /* c */ x53 = f(y, "098"); /* c */ x53 = f(y, "099"); /* c */ x53 = f(y, "100"); /* c */ x53 = f(y, "101"); /* c */ x53 = f(y, "102"); /* c */ x53 = f(y, "103"); /* c */ x53 = f(y, "104"); /* c */ x53 = f(y, "105"); /* c */ x53 = f(y, "106"); /* c */ x53 = f(y, "107"); /* c */ x53 = f(y, "108"); /* c */ x53 = f(y, "109"); /* c */ x53 = f(y, "110"); /* c */ x53 = f(y, "111"); /* c */ x53 = f(y, "112"); /* c */ x53 = f(y, "113"); /* c */ x53 = f(y, "114"); /* c */ x53 = f(y, "115"); /* c */ x53 = f(y, "116"); /* c */ x53 = f(y, "117"); /* c */ x53 = f(y, "118"); /* c */ x53 = f(y, "119"); /* c */ x53 = f(y, "120"); /* c */ x53 = f(y, "121"); /* c */ x53 = f(y, "122"); /* c */ x53 = f(y, "123"); /* c */ x53 = f(y, "124"); /* c */ x53 = f(y, "125"); /* c */ x53 = f(y, "126"); /* c */ x53 = f(y, "127"); /* c */ x53 = f(y, "128"); /* c */ x53 = f(y, "129"); /* c */ x53 = f(y, "130"); /* c */ x53 = f(y, "131"); /* c */ x53 = f(y, "132"); /* c */ x53 = f(y, "133"); /* c */ x53 = f(y, "134"); /* c */ x53 = f(y, "135"); /* c */ x53 = f(y, "136"); /* c */ x53 = f(y, "137"); /* c */ x53 = f(y, "138"); /* c */ x53 = f(y, "139"); /* c */ x53 = f(y, "140"); /* c */ x53 = f(y, "141"); /* c */ x53 = f(y, "142"); /* c */ x53 = f(y, "143"); /* c */ x53 = f(y, "144"); /* c */ x53 = f(y, "145"); /* c */ x53 = f(y, "146"); /* c */ x53 = f(y, "147"); /* c */ x53 = f(y, "148"); /* c */ x53 = f(y, "149"); /* c */ x53 = f(y, "150"); /* c */ x53 = f(y, "151"); /* c */ x53 = f(y, "152"); /* c */ x53 = f(y, "153"); /* c */ x53 = f(y, "154"); /* c */ x53 = f(y, "155"); /* c */ x53 = f(y, "156"); /* c */ x53 = f(y, "157"); /* c */ x53 = f(y, "158"); /* c */ x53 = f(y, "159"); /* c */ x53 = f(y, "160"); /* c */ x53 = f(y, "161"); /* c */ x53 = f(y, "162"); /* c */ x53 = f(y, "163"); /* c */ x53 = f(y, "164"); /* c */ x53 = f(y, "165"); /* c */ x53 = f(y, "166"); /* c */ x53 = f(y, "167"); /* c */ x53 = f(y, "168"); /* c */ x53 = f(y, "169"); /* c */ x53 = f(y, "170"); /* c */ x53 = f(y, "171"); /* c */ x53 = f(y, "172"); /* c */ x53 = f(y, "173"); /* c */ x53 = f(y, "174"); /* c */ x53 = f(y, "175"); /* c */ x53 = f(y, "176"); /* c */ x53 = f(y, "177"); /* c */ x53 = f(y, "178"); /* c */ x53 = f(y, "179"); /* c */ x53 = f(y, "180"); /* c */ x53 = f(y, "181"); /* c */ x53 = f(y, "182"); /* c */ x53 = f(y, "183"); /* c */ x53 = f(y, "184"); /* c */ x53 = f(y, "185"); /* c */ x53 = f(y, "186"); /* c */ x53 = f(y, "187"); /* c */ x53 = f(y, "188"); /* c */ x53 = f(y, "189"); /* c */ x53 = f(y, "190"); /* c */ x53 = f(y, "191"); /* c */ x53 = f(y, "192"); /* c */ x53 = f(y, "193"); /* c */ x53 = f(y, "194"); /* c */ x53 = f(y, "195"); /* c */ x53 = f(y, "196"); /* c */ x53 = f(y, "197"); /* c */ x53 = f(y, "198"); /* c */ x53 = f(y, "199"); /* c */ 
+x54 = f(y, "000"); /* c */ x54 = f(y, "001"); /* c */ x54 = f(y, "002"); /* c */ x54 = f(y, "003"); /* c */ x54 = f(y, "004"); /* c */ x54 = f(y, "005"); /* c */ x54 = f(y, "006"); /* c */ x54 = f(y, "007"); /* c */ x54 = f(y, "008"); /* c */ x54 = f(y, "009"); /* c */ x54 = f(y, "010"); /* c */ x54 = f(y, "011"); /* c */ x54 = f(y, "012"); /* c */ x54 = f(y, "013"); /* c */ x54 = f(y, "014"); /* c */ x54 = f(y, "015"); /* c */ x54 = f(y, "016"); /* c */ x54 = f(y, "017"); /* c */ x54 = f(y, "018"); /* c */ x54 = f(y, "019"); /* c */ x54 = f(y, "020"); /* c */ x54 = f(y, "021"); /* c */ x54 = f(y, "022"); /* c */ x54 = f(y, "023"); /* c */ x54 = f(y, "024"); /* c */ x54 = f(y, "025"); /* c */ x54 = f(y, "026"); /* c */ x54 = f(y, "027"); /* c */ x54 = f(y, "028"); /* c */ x54 = f(y, "029"); /* c */ x54 = f(y, "030"); /* c */ x54 = f(y, "031"); /* c */ x54 = f(y, "032"); /* c */ x54 = f(y, "033"); /* c */ x54 = f(y, "034"); /* c */ x54 = f(y, "035"); /* c */ x54 = f(y, "036"); /* c */ x54 = f(y, "037"); /* c */ x54 = f(y, "038"); /* c */ x54 = f(y, "039"); /* c */ x54 = f(y, "040"); /* c */ x54 = f(y, "041"); /* c */ x54 = f(y, "042"); /* c */ x54 = f(y, "043"); /* c */ x54 = f(y, "044"); /* c */ x54 = f(y, "045"); /* c */ x54 = f(y, "046"); /* c */ x54 = f(y, "047"); /* c */ x54 = f(y, "048"); /* c */ x54 = f(y, "049"); /* c */ x54 = f(y, "050"); /* c */ x54 = f(y, "051"); /* c */ x54 = f(y, "052"); /* c */ x54 = f(y, "053"); /* c */ x54 = f(y, "054"); /* c */ x54 = f(y, "055"); /* c */ x54 = f(y, "056"); /* c */ x54 = f(y, "057"); /* c */ x54 = f(y, "058"); /* c */ x54 = f(y, "059"); /* c */ x54 = f(y, "060"); /* c */ x54 = f(y, "061"); /* c */ x54 = f(y, "062"); /* c */ x54 = f(y, "063"); /* c */ x54 = f(y, "064"); /* c */ x54 = f(y, "065"); /* c */ x54 = f(y, "066"); /* c */ x54 = f(y, "067"); /* c */ x54 = f(y, "068"); /* c */ x54 = f(y, "069"); /* c */ x54 = f(y, "070"); /* c */ x54 = f(y, "071"); /* c */ x54 = f(y, "072"); /* c */ x54 = f(y, "073"); /* c */ x54 = f(y, "074"); /* c */ x54 = f(y, "075"); /* c */ x54 = f(y, "076"); /* c */ x54 = f(y, "077"); /* c */ x54 = f(y, "078"); /* c */ x54 = f(y, "079"); /* c */ x54 = f(y, "080"); /* c */ x54 = f(y, "081"); /* c */ x54 = f(y, "082"); /* c */ x54 = f(y, "083"); /* c */ x54 = f(y, "084"); /* c */ x54 = f(y, "085"); /* c */ x54 = f(y, "086"); /* c */ x54 = f(y, "087"); /* c */ x54 = f(y, "088"); /* c */ x54 = f(y, "089"); /* c */ x54 = f(y, "090"); /* c */ x54 = f(y, "091"); /* c */ x54 = f(y, "092"); /* c */ x54 = f(y, "093"); /* c */ x54 = f(y, "094"); /* c */ x54 = f(y, "095"); /* c */ x54 = f(y, "096"); /* c */ x54 = f(y, "097"); /* c */ x54 = f(y, "098"); /* c */ x54 = f(y, "099"); /* c */ x54 = f(y, "100"); /* c */ x54 = f(y, "101"); /* c */ x54 = f(y, "102"); /* c */ x54 = f(y, "103"); /* c */ x54 = f(y, "104"); /* c */ x54 = f(y, "105"); /* c */ x54 = f(y, "106"); /* c */ x54 = f(y, "107"); /* c */ x54 = f(y, "108"); /* c */ x54 = f(y, "109"); /* c */ x54 = f(y, "110"); /* c */ x54 = f(y, "111"); /* c */ x54 = f(y, "112"); /* c */ x54 = f(y, "113"); /* c */ x54 = f(y, "114"); /* c */ x54 = f(y, "115"); /* c */ x54 = f(y, "116"); /* c */ x54 = f(y, "117"); /* c */ x54 = f(y, "118"); /* c */ x54 = f(y, "119"); /* c */ x54 = f(y, "120"); /* c */ x54 = f(y, "121"); /* c */ x54 = f(y, "122"); /* c */ x54 = f(y, "123"); /* c */ x54 = f(y, "124"); /* c */ x54 = f(y, "125"); /* c */ x54 = f(y, "126"); /* c */ x54 = f(y, "127"); /* c */ x54 = f(y, "128"); /* c */ x54 = f(y, "129"); /* c */ x54 = f(y, "130"); /* c */ x54 = f(y, "131"); /* c */ x54 = f(y, "132"); /* c */ x54 = f(y, "133"); /* c */ x54 = f(y, "134"); /* c */ x54 = f(y, "135"); /* c */ x54 = f(y, "136"); /* c */ x54 = f(y, "137"); /* c */ x54 = f(y, "138"); /* c */ x54 = f(y, "139"); /* c */ x54 = f(y, "140"); /* c */ x54 = f(y, "141"); /* c */ x54 = f(y, "142"); /* c */ x54 = f(y, "143"); /* c */ x54 = f(y, "144"); /* c */ x54 = f(y, "145"); /* c */ x54 = f(y, "146"); /* c */ x54 = f(y, "147"); /* c */ x54 = f(y, "148"); /* c */ x54 = f(y, "149"); /* c */ x54 = f(y, "150"); /* c */ x54 = f(y, "151"); /* c */ x54 = f(y, "152"); /* c */ x54 = f(y, "153"); /* c */ x54 = f(y, "154"); /* c */ x54 = f(y, "155"); /* c */ x54 = f(y, "156"); /* c */ x54 = f(y, "157"); /* c */ x54 = f(y, "158"); /* c */ x54 = f(y, "159"); /* c */ x54 = f(y, "160"); /* c */ x54 = f(y, "161"); /* c */ x54 = f(y, "162"); /* c */ x54 = f(y, "163"); /* c */ x54 = f(y, "164"); /* c */ x54 = f(y, "165"); /* c */ x54 = f(y, "166"); /* c */ x54 = f(y, "167"); /* c */ x54 = f(y, "168"); /* c */ x54 = f(y, "169"); /* c */ x54 = f(y, "170"); /* c */ x54 = f(y, "171"); /* c */ x54 = f(y, "172"); /* c */ x54 = f(y, "173"); /* c */ x54 = f(y, "174"); /* c */ x54 = f(y, "175"); /* c */ x54 = f(y, "176"); /* c */ x54 = f(y, "177"); /* c */ x54 = f(y, "178"); /* c */ x54 = f(y, "179"); /* c */ x54 = f(y, "180"); /* c */ x54 = f(y, "181"); /* c */ x54 = f(y, "182"); /* c */ x54 = f(y, "183"); /* c */ x54 = f(y, "184"); /* c */ x54 = f(y, "185"); /* c */ x54 = f(y, "186"); /* c */ x54 = f(y, "187"); /* c */ x54 = f(y, "188"); /* c */ x54 = f(y, "189"); /* c */ x54 = f(y, "190"); /* c */ x54 = f(y, "191"); /* c */ x54 = f(y, "192"); /* c */ x54 = f(y, "193"); /* c */ x54 = f(y, "194"); /* c */ x54 = f(y, "195"); /* c */ x54 = f(y, "196"); /* c */ x54 = f(y, "197"); /* c */ x54 = f(y, "198"); /* c */ x54 = f(y, "199"); /* c */ 
+x55 = f(y, "000"); /* c */ x55 = f(y, "001"); /* c */ x55 = f(y, "002"); /* c */ x55 = f(y, "003"); /* c */ x55 = f(y, "004"); /* c */ x55 = f(y, "005"); /* c */ x55 = f(y, "006"); /* c */ x55 = f(y, "007"); /* c */ x55 = f(y, "008"); /* c */ x55 = f(y, "009"); /* c */ x55 = f(y, "010"); /* c */ x55 = f(y, "011"); /* c */ x55 = f(y, "012"); /* c */ x55 = f(y, "013"); /* c */ x55 = f(y, "014"); /* c */ x55 = f(y, "015"); /* c */ x55 = f(y, "016"); /* c */ x55 = f(y, "017"); /* c */ x55 = f(y, "018"); /* c */ x55 = f(y, "019"); /* c */ x55 = f(y, "020"); /* c */ x55 = f(y, "021"); /* c */ x55 = f(y, "022"); /* c */ x55 = f(y, "023"); /* c */ x55 = f(y, "024"); /* c */ x55 = f(y, "025"); /* c */ x55 = f(y, "026"); /* c */ x55 = f(y, "027"); /* c */ x55 = f(y, "028"); /* c */ x55 = f(y, "029"); /* c */ x55 = f(y, "030"); /* c */ x55 = f(y, "031"); /* c */ x55 = f(y, "032"); /* c */ x55 = f(y, "033"); /* c */ x55 = f(y, "034"); /* c */ x55 = f(y, "035"); /* c */ x55 = f(y, "036"); /* c */ x55 = f(y, "037"); /* c */ x55 = f(y, "038"); /* c */ x55 = f(y, "039"); /* c */ x55 = f(y, "040"); /* c */ x55 = f(y, "041"); /* c */ x55 = f(y, "042"); /* c */ x55 = f(y, "043"); /* c */ x55 = f(y, "044"); /* c */ x55 = f(y, "045"); /* c */ x55 = f(y, "046"); /* c */ x55 = f(y, "047"); /* c */ x55 = f(y, "048"); /* c */ x55 = f(y, "049"); /* c */ x55 = f(y, "050"); /* c */ x55 = f(y, "051"); /* c */ x55 = f(y, "052"); /* c */ x55 = f(y, "053"); /* c */ x55 = f(y, "054"); /* c */ x55 = f(y, "055"); /* c */ x55 = f(y, "056"); /* c */ x55 = f(y, "057"); /* c */ x55 = f(y, "058"); /* c */ x55 = f(y, "059"); /* c */ x55 = f(y, "060"); /* c */ x55 = f(y, "061"); /* c */ x55 = f(y, "062"); /* c */ x55 = f(y, "063"); /* c */ x55 = f(y, "064"); /* c */ x55 = f(y, "065"); /* c */ x55 = f(y, "066"); /* c */ x55 = f(y, "067"); /* c */ x55 = f(y, "068"); /* c */ x55 = f(y, "069"); /* c */ x55 = f(y, "070"); /* c */ x55 = f(y, "071"); /* c */ x55 = f(y, "072"); /* c */ x55 = f(y, "073"); /* c */ x55 = f(y, "074"); /* c */ x55 = f(y, "075"); /* c */ x55 = f(y, "076"); /* c */ x55 = f(y, "077"); /* c */ x55 = f(y, "078"); /* c */ x55 = f(y, "079"); /* c */ x55 = f(y, "080"); /* c */ x55 = f(y, "081"); /* c */ x55 = f(y, "082"); /* c */ x55 = f(y, "083"); /* c */ x55 = f(y, "084"); /* c */ x55 = f(y, "085"); /* c */ x55 = f(y, "086"); /* c */ x55 = f(y, "087"); /* c */ x55 = f(y, "088"); /* c */ x55 = f(y, "089"); /* c */ x55 = f(y, "090"); /* c */ x55 = f(y, "091"); /* c */ x55 = f(y, "092"); /* c */ x55 = f(y, "093"); /* c */ x55 = f(y, "094"); /* c */ x55 = f(y, "095"); /* c */ x55 = f(y, "096"); /* c */ x55 = f(y, "097"); /* c */ x55 = f(y, "098"); /* c */ x55 = f(y, "099"); /* c */ x55 = f(y, "100"); /* c */ x55 = f(y, "101"); /* c */ x55 = f(y, "102"); /* c */ x55 = f(y, "103"); /* c */ x55 = f(y, "104"); /* c */ x55 = f(y, "105"); /* c */ x55 = f(y, "106"); /* c */ x55 = f(y, "107"); /* c */ x55 = f(y, "108"); /* c */ x55 = f(y, "109"); /* c */ x55 = f(y, "110"); /* c */ x55 = f(y, "111"); /* c */ x55 = f(y, "112"); /* c */ x55 = f(y, "113"); /* c */ x55 = f(y, "114"); /* c */ x55 = f(y, "115"); /* c */ x55 = f(y, "116"); /* c */ x55 = f(y, "117"); /* c */ x55 = f(y, "118"); /* c */ x55 = f(y, "119"); /* c */ x55 = f(y, "120"); /* c */ x55 = f(y, "121"); /* c */ x55 = f(y, "122"); /* c */ x55 = f(y, "123"); /* c */ x55 = f(y, "124"); /* c */ x55 = f(y, "125"); /* c */ x55 = f(y, "126"); /* c */ x55 = f(y, "127"); /* c */ x55 = f(y, "128"); /* c */ x55 = f(y, "129"); /* c */ x55 = f(y, "130"); /* c */ x55 = f(y, "131"); /* c */ x55 = f(y, "132"); /* c */ x55 = f(y, "133"); /* c */ x55 = f(y, "134"); /* c */ x55 = f(y, "135"); /* c */ x55 = f(y, "136"); /* c */ x55 = f(y, "137"); /* c */ x55 = f(y, "138"); /* c */ x55 = f(y, "139"); /* c */ x55 = f(y, "140"); /* c */ x55 = f(y, "141"); /* c */ x55 = f(y, "142"); /* c */ x55 = f(y, "143"); /* c */ x55 = f(y, "144"); /* c */ x55 = f(y, "145"); /* c */ x55 = f(y, "146"); /* c */ x55 = f(y, "147"); /* c */ x55 = f(y, "148"); /* c */ x55 = f(y, "149"); /* c */ x55 = f(y, "150"); /* c */ x55 = f(y, "151"); /* c */ x55 = f(y, "152"); /* c */ x55 = f(y, "153"); /* c */ x55 = f(y, "154"); /* c */ x55 = f(y, "155"); /* c */ x55 = f(y, "156"); /* c */ x55 = f(y, "157"); /* c */ x55 = f(y, "158"); /* c */ x55 = f(y, "159"); /* c */ x55 = f(y, "160"); /* c */ x55 = f(y, "161"); /* c */ x55 = f(y, "162"); /* c */ x55 = f(y, "163"); /* c */ x55 = f(y, "164"); /* c */ x55 = f(y, "165"); /* c */ x55 = f(y, "166"); /* c */ x55 = f(y, "167"); /* c */ x55 = f(y, "168"); /* c */ x55 = f(y, "169"); /* c */ x55 = f(y, "170"); /* c */ x55 = f(y, "171"); /* c */ x55 = f(y, "172"); /* c */ x55 = f(y, "173"); /* c */ x55 = f(y, "174"); /* c */ x55 = f(y, "175"); /* c */ x55 = f(y, "176"); /* c */ x55 = f(y, "177"); /* c */ x55 = f(y, "178"); /* c */ x55 = f(y, "179"); /* c */ x55 = f(y, "180"); /* c */ x55 = f(y, "181"); /* c */ x55 = f(y, "182"); /* c */ x55 = f(y, "183"); /* c */ x55 = f(y, "184"); /* c */ x55 = f(y, "185"); /* c */ x55 = f(y, "186"); /* c */ x55 = f(y, "187"); /* c */ x55 = f(y, "188"); /* c */ x55 = f(y, "189"); /* c */ x55 = f(y, "190"); /* c */ x55 = f(y, "191"); /* c */ x55 = f(y, "192"); /* c */ x55 = f(y, "193"); /* c */ x55 = f(y, "194"); /* c */ x55 = f(y, "195"); /* c */ x55 = f(y, "196"); /* c */ x55 = f(y, "197"); /* c */ x55 = f(y, "198"); /* c */ x55 = f(y, "199"); /* c */ 
+x56 = f(y, "000"); /* c */ x56 = f(y, "001"); /* c */ x56 = f(y, "002"); /* c */ x56 = f(y, "003"); /* c */ x56 = f(y, "004"); /* c */ x56 = f(y, "005"); /* c */ x56 = f(y, "006"); /* c */ x56 = f(y, "007"); /* c */ x56 = f(y, "008"); /* c */ x56 = f(y, "009"); /* c */ x56 = f(y, "010"); /* c */ x56 = f(y, "011"); /* c */ x56 = f(y, "012"); /* c */ x56 = f(y, "013"); /* c */ x56 = f(y, "014"); /* c */ x56 = f(y, "015"); /* c */ x56 = f(y, "016"); /* c */ x56 = f(y, "017"); /* c */ x56 = f(y, "018"); /* c */ x56 = f(y, "019"); /* c */ x56 = f(y, "020"); /* c */ x56 = f(y, "021"); /* c */ x56 = f(y, "022"); /* c */ x56 = f(y, "023"); /* c */ x56 = f(y, "024"); /* c */ x56 = f(y, "025"); /* c */ x56 = f(y, "026"); /* c */ x56 = f(y, "027"); /* c */ x56 = f(y, "028"); /* c */ x56 = f(y, "029"); /* c */ x56 = f(y, "030"); /* c */ x56 = f(y, "031"); /* c */ x56 = f(y, "032"); /* c */ x56 = f(y, "033"); /* c */ x56 = f(y, "034"); /* c */ x56 = f(y, "035"); /* c */ x56 = f(y, "036"); /* c */ x56 = f(y, "037"); /* c */ x56 = f(y, "038"); /* c */ x56 = f(y, "039"); /* c */ x56 = f(y, "040"); /* c */ x56 = f(y, "041"); /* c */ x56 = f(y, "042"); /* c */ x56 = f(y, "043"); /* c */ x56 = f(y, "044"); /* c */ x56 = f(y, "045"); /* c */ x56 = f(y, "046"); /* c */ x56 = f(y, "047"); /* c */ x56 = f(y, "048"); /* c */ x56 = f(y, "049"); /* c */ x56 = f(y, "050"); /* c */ x56 = f(y, "051"); /* c */ x56 = f(y, "052"); /* c */ x56 = f(y, "053"); /* c */ x56 = f(y, "054"); /* c */ x56 = f(y, "055"); /* c */ x56 = f(y, "056"); /* c */ x56 = f(y, "057"); /* c */ x56 = f(y, "058"); /* c */ x56 = f(y, "059"); /* c */ x56 = f(y, "060"); /* c */ x56 = f(y, "061"); /* c */ x56 = f(y, "062"); /* c */ x56 = f(y, "063"); /* c */ x56 = f(y, "064"); /* c */ x56 = f(y, "065"); /* c */ x56 = f(y, "066"); /* c */ x56 = f(y, "067"); /* c */ x56 = f(y, "068"); /* c */ x56 = f(y, "069"); /* c */ x56 = f(y, "070"); /* c */ x56 = f(y, "071"); /* c */ x56 = f(y, "072"); /* c */ x56 = f(y, "073"); /* c */ x56 = f(y, "074"); /* c */ x56 = f(y, "075"); /* c */ x56 = f(y, "076"); /* c */ x56 = f(y, "077"); /* c */ x56 = f(y, "078"); /* c */ x56 = f(y, "079"); /* c */ x56 = f(y, "080"); /* c */ x56 = f(y, "081"); /* c */ x56 = f(y, "082"); /* c */ x56 = f(y, "083"); /* c */ x56 = f(y, "084"); /* c */ x56 = f(y, "085"); /* c */ x56 = f(y, "086"); /* c */ x56 = f(y, "087"); /* c */ x56 = f(y, "088"); /* c */ x56 = f(y, "089"); /* c */ x56 = f(y, "090"); /* c */ x56 = f(y, "091"); /* c */ x56 = f(y, "092"); /* c */ x56 = f(y, "093"); /* c */ x56 = f(y, "094"); /* c */ x56 = f(y, "095"); /* c */ x56 = f(y, "096"); /* c */ x56 = f(y, "097"); /* c */ x56 = f(y, "098"); /* c */ x56 = f(y, "099"); /* c */ x56 = f(y, "100"); /* c */ x56 = f(y, "101"); /* c */ x56 = f(y, "102"); /* c */ x56 = f(y, "103"); /* c */ x56 = f(y, "104"); /* c */ x56 = f(y, "105"); /* c */ x56 = f(y, "106"); /* c */ x56 = f(y, "107"); /* c */ x56 = f(y, "108"); /* c */ x56 = f(y, "109"); /* c */ x56 = f(y, "110"); /* c */ x56 = f(y, "111"); /* c */ x56 = f(y, "112"); /* c */ x56 = f(y, "113"); /* c */ x56 = f(y, "114"); /* c */ x56 = f(y, "115"); /* c */ x56 = f(y, "116"); /* c */ x56 = f(y, "117"); /* c */ x56 = f(y, "118"); /* c */ x56 = f(y, "119"); /* c */ x56 = f(y, "120"); /* c */ x56 = f(y, "121"); /* c */ x56 = f(y, "122"); /* c */ x56 = f(y, "123"); /* c */ x56 = f(y, "124"); /* c */ x56 = f(y, "125"); /* c */ x56 = f(y, "126"); /* c */ x56 = f(y, "127"); /* c */ x56 = f(y, "128"); /* c */ x56 = f(y, "129"); /* c */ x56 = f(y, "130"); /* c */ x56 = f(y, "131"); /* c */ x56 = f(y, "132"); /* c */ x56 = f(y, "133"); /* c */ x56 = f(y, "134"); /* c */ x56 = f(y, "135"); /* c */ x56 = f(y, "136"); /* c */ x56 = f(y, "137"); /* c */ x56 = f(y, "138"); /* c */ x56 = f(y, "139"); /* c */ x56 = f(y, "140"); /* c */ x56 = f(y, "141"); /* c */ x56 = f(y, "142"); /* c */ x56 = f(y, "143"); /* c */ x56 = f(y, "144"); /* c */ x56 = f(y, "145"); /* c */ x56 = f(y, "146"); /* c */ x56 = f(y, "147"); /* c */ x56 = f(y, "148"); /* c */ x56 = f(y, "149"); /* c */ x56 = f(y, "150"); /* c */ x56 = f(y, "151"); /* c */ x56 = f(y, "152"); /* c */ x56 = f(y, "153"); /* c */ x56 = f(y, "154"); /* c */ x56 = f(y, "155"); /* c */ x56 = f(y, "156"); /* c */ x56 = f(y, "157"); /* c */ x56 = f(y, "158"); /* c */ x56 = f(y, "159"); /* c */ x56 = f(y, "160"); /* c */ x56 = f(y, "161"); /* c */ x56 = f(y, "162"); /* c */ x56 = f(y, "163"); /* c */ x56 = f(y, "164"); /* c */ x56 = f(y, "165"); /* c */ x56 = f(y, "166"); /* c */ x56 = f(y, "167"); /* c */ x56 = f(y, "168"); /* c */ x56 = f(y, "169"); /* c */ x56 = f(y, "170"); /* c */ x56 = f(y, "171"); /* c */ x56 = f(y, "172"); /* c */ x56 = f(y, "173"); /* c */ x56 = f(y, "174"); /* c */ x56 = f(y, "175"); /* c */ x56 = f(y, "176"); /* c */ x56 = f(y, "177"); /* c */ x56 = f(y, "178"); /* c */ x56 = f(y, "179"); /* c */ x56 = f(y, "180"); /* c */ x56 = f(y, "181"); /* c */ x56 = f(y, "182"); /* c */ x56 = f(y, "183"); /* c */ x56 = f(y, "184"); /* c */ x56 = f(y, "185"); /* c */ x56 = f(y, "186"); /* c */ x56 = f(y, "187"); /* c */ x56 = f(y, "188"); /* c */ x56 = f(y, "189"); /* c */ x56 = f(y, "190"); /* c */ x56 = f(y, "191"); /* c */ x56 = f(y, "192"); /* c */ x56 = f(y, "193"); /* c */ x56 = f(y, "194"); /* c */ x56 = f(y, "195"); /* c */ x56 = f(y, "196"); /* c */ x56 = f(y, "197"); /* c */ x56 = f(y, "198"); /* c */ x56 = f(y, "199"); /* c */ 
+x57 = f(y, "000"); /* c */ x57 = f(y, "001"); /* c */ x57 = f(y, "002"); /* c */ x57 = f(y, "003"); /* c */ x57 = f(y, "004"); /* c */ x57 = f(y, "005"); /* c */ x57 = f(y, "006"); /* c */ x57 = f(y, "007"); /* c */ x57 = f(y, "008"); /* c */ x57 = f(y, "009"); /* c */ x57 = f(y, "010"); /* c */ x57 = f(y, "011"); /* c */ x57 = f(y, "012"); /* c */ x57 = f(y, "013"); /* c */ x57 = f(y, "014"); /* c */ x57 = f(y, "015"); /* c */ x57 = f(y, "016"); /* c */ x57 = f(y, "017"); /* c */ x57 = f(y, "018"); /* c */ x57 = f(y, "019"); /* c */ x57 = f(y, "020"); /* c */ x57 = f(y, "021"); /* c */ x57 = f(y, "022"); /* c */ x57 = f(y, "023"); /* c */ x57 = f(y, "024"); /* c */ x57 = f(y, "025"); /* c */ x57 = f(y, "026"); /* c */ x57 = f(y, "027"); /* c */ x57 = f(y, "028"); /* c */ x57 = f(y, "029"); /* c */ x57 = f(y, "030"); /* c */ x57 = f(y, "031"); /* c */ x57 = f(y, "032"); /* c */ x57 = f(y, "033"); /* c */ x57 = f(y, "034"); /* c */ x57 = f(y, "035"); /* c */ x57 = f(y, "036"); /* c */ x57 = f(y, "037"); /* c */ x57 = f(y, "038"); /* c */ x57 = f(y, "039"); /* c */ x57 = f(y, "040"); /* c */ x57 = f(y, "041"); /* c */ x57 = f(y, "042"); /* c */ x57 = f(y, "043"); /* c */ x57 = f(y, "044"); /* c */ x57 = f(y, "045"); /* c */ x57 = f(y, "046"); /* c */ x57 = f(y, "047"); /* c */ x57 = f(y, "048"); /* c */ x57 = f(y, "049"); /* c */ x57 = f(y, "050"); /* c */ x57 = f(y, "051"); /* c */ x57 = f(y, "052"); /* c */ x57 = f(y, "053"); /* c */ x57 = f(y, "054"); /* c */ x57 = f(y, "055"); /* c */ x57 = f(y, "056"); /* c */ x57 = f(y, "057"); /* c */ x57 = f(y, "058"); /* c */ x57 = f(y, "059"); /* c */ x57 = f(y, "060"); /* c */ x57 = f(y, "061"); /* c */ x57 = f(y, "062"); /* c */ x57 = f(y, "063"); /* c */ x57 = f(y, "064"); /* c */ x57 = f(y, "065"); /* c */ x57 = f(y, "066"); /* c */ x57 = f(y, "067"); /* c */ x57 = f(y, "068"); /* c */ x57 = f(y, "069"); /* c */ x57 = f(y, "070"); /* c */ x57 = f(y, "071"); /* c */ x57 = f(y, "072"); /* c */ x57 = f(y, "073"); /* c */ x57 = f(y, "074"); /* c */ x57 = f(y, "075"); /* c */ x57 = f(y, "076"); /* c */ x57 = f(y, "077"); /* c */ x57 = f(y, "078"); /* c */ x57 = f(y, "079"); /* c */ x57 = f(y, "080"); /* c */ x57 = f(y, "081"); /* c */ x57 = f(y, "082"); /* c */ x57 = f(y, "083"); /* c */ x57 = f(y, "084"); /* c */ x57 = f(y, "085"); /* c */ x57 = f(y, "086"); /* c */ x57 = f(y, "087"); /* c */ x57 = f(y, "088"); /* c */ x57 = f(y, "089"); /* c */ x57 = f(y, "090"); /* c */ x57 = f(y, "091"); /* c */ x57 = f(y, "092"); /* c */ x57 = f(y, "093"); /* c */ x57 = f(y, "094"); /* c */ x57 = f(y, "095"); /* c */ x57 = f(y, "096"); /* c */ x57 = f(y, "097"); /* c */ x57 = f(y, "098"); /* c */ x57 = f(y, "099"); /* c */ x57 = f(y, "100"); /* c */ x57 = f(y, "101"); /* c */ x57 = f(y, "102"); /* c */ x57 = f(y, "103"); /* c */ x57 = f(y, "104"); /* c */ x57 = f(y, "105"); /* c */ x57 = f(y, "106"); /* c */ x57 = f(y, "107"); /* c */ x57 = f(y, "108"); /* c */ x57 = f(y, "109"); /* c */ x57 = f(y, "110"); /* c */ x57 = f(y, "111"); /* c */ x57 = f(y, "112"); /* c */ x57 = f(y, "113"); /* c */ x57 = f(y, "114"); /* c */ x57 = f(y, "115"); /* c */ x57 = f(y, "116"); /* c */ x57 = f(y, "117"); /* c */ x57 = f(y, "118"); /* c */ x57 = f(y, "119"); /* c */ x57 = f(y, "120"); /* c */ x57 = f(y, "121"); /* c */ x57 = f(y, "122"); /* c */ x57 = f(y, "123"); /* c */ x57 = f(y, "124"); /* c */ x57 = f(y, "125"); /* c */ x57 = f(y, "126"); /* c */ x57 = f(y, "127"); /* c */ x57 = f(y, "128"); /* c */ x57 = f(y, "129"); /* c */ x57 = f(y, "130"); /* c */ x57 = f(y, "131"); /* c */ x57 = f(y, "132"); /* c */ x57 = f(y, "133"); /* c */ x57 = f(y, "134"); /* c */ x57 = f(y, "135"); /* c */ x57 = f(y, "136"); /* c */ x57 = f(y, "137"); /* c */ x57 = f(y, "138"); /* c */ x57 = f(y, "139"); /* c */ x57 = f(y, "140"); /* c */ x57 = f(y, "141"); /* c */ x57 = f(y, "142"); /* c */ x57 = f(y, "143"); /* c */ x57 = f(y, "144"); /* c */ x57 = f(y, "145"); /* c */ x57 = f(y, "146"); /* c */ x57 = f(y, "147"); /* c */ x57 = f(y, "148"); /* c */ x57 = f(y, "149"); /* c */ x57 = f(y, "150"); /* c */ x57 = f(y, "151"); /* c */ x57 = f(y, "152"); /* c */ x57 = f(y, "153"); /* c */ x57 = f(y, "154"); /* c */ x57 = f(y, "155"); /* c */ x57 = f(y, "156"); /* c */ x57 = f(y, "157"); /* c */ x57 = f(y, "158"); /* c */ x57 = f(y, "159"); /* c */ x57 = f(y, "160"); /* c */ x57 = f(y, "161"); /* c */ x57 = f(y, "162"); /* c */ x57 = f(y, "163"); /* c */ x57 = f(y, "164"); /* c */ x57 = f(y, "165"); /* c */ x57 = f(y, "166"); /* c */ x57 = f(y, "167"); /* c */ x57 = f(y, "168"); /* c */ x57 = f(y, "169"); /* c */ x57 = f(y, "170"); /* c */ x57 = f(y, "171"); /* c */ x57 = f(y, "172"); /* c */ x57 = f(y, "173"); /* c */ x57 = f(y, "174"); /* c */ x57 = f(y, "175"); /* c */ x57 = f(y, "176"); /* c */ x57 = f(y, "177"); /* c */ x57 = f(y, "178"); /* c */ x57 = f(y, "179"); /* c */ x57 = f(y, "180"); /* c */ x57 = f(y, "181"); /* c */ x57 = f(y, "182"); /* c */ x57 = f(y, "183"); /* c */ x57 = f(y, "184"); /* c */ x57 = f(y, "185"); /* c */ x57 = f(y, "186"); /* c */ x57 = f(y, "187"); /* c */ x57 = f(y, "188"); /* c */ x57 = f(y, "189"); /* c */ x57 = f(y, "190"); /* c */ x57 = f(y, "191"); /* c */ x57 = f(y, "192"); /* c */ x57 = f(y, "193"); /* c */ x57 = f(y, "194"); /* c */ x57 = f(y, "195"); /* c */ x57 = f(y, "196"); /* c */ x57 = f(y, "197"); /* c */ x57 = f(y, "198"); /* c */ x57 = f(y, "199"); /* c */ 
+x58 = f(y, "000"); /* c */ x58 = f(y, "001"); /* c */ x58 = f(y, "002"); /* c */ x58 = f(y, "003"); /* c */ x58 = f(y, "004"); /* c */ x58 = f(y, "005"); /* c */ x58 = f(y, "006"); /* c */ x58 = f(y, "007"); /* c */ x58 = f(y, "008"); /* c */ x58 = f(y, "009"); /* c */ x58 = f(y, "010"); /* c */ x58 = f(y, "011"); /* c */ x58 = f(y, "012"); /* c */ x58 = f(y, "013"); /* c */ x58 = f(y, "014"); /* c */ x58 = f(y, "015"); /* c */ x58 = f(y, "016"); /* c */ x58 = f(y, "017"); /* c */ x58 = f(y, "018"); /* c */ x58 = f(y, "019"); /* c */ x58 = f(y, "020"); /* c */ x58 = f(y, "021"); /* c */ x58 = f(y, "022"); /* c */ x58 = f(y, "023"); /* c */ x58 = f(y, "024"); /* c */ x58 = f(y, "025"); /* c */ x58 = f(y, "026"); /* c */ x58 = f(y, "027"); /* c */ x58 = f(y, "028"); /* c */ x58 = f(y, "029"); /* c */ x58 = f(y, "030"); /* c */ x58 = f(y, "031"); /* c */ x58 = f(y, "032"); /* c */ x58 = f(y, "033"); /* c */ x58 = f(y, "034"); /* c */ x58 = f(y, "035"); /* c */ x58 = f(y, "036"); /* c */ x58 = f(y, "037"); /* c */ x58 = f(y, "038"); /* c */ x58 = f(y, "039"); /* c */ x58 = f(y, "040"); /* c */ x58 = f(y, "041"); /* c */ x58 = f(y, "042"); /* c */ x58 = f(y, "043"); /* c */ x58 = f(y, "044"); /* c */ x58 = f(y, "045"); /* c */ x58 = f(y, "046"); /* c */ x58 = f(y, "047"); /* c */ x58 = f(y, "048"); /* c */ x58 = f(y, "049"); /* c */ x58 = f(y, "050"); /* c */ x58 = f(y, "051"); /* c */ x58 = f(y, "052"); /* c */ x58 = f(y, "053"); /* c */ x58 = f(y, "054"); /* c */ x58 = f(y, "055"); /* c */ x58 = f(y, "056"); /* c */ x58 = f(y, "057"); /* c */ x58 = f(y, "058"); /* c */ x58 = f(y, "059"); /* c */ x58 = f(y, "060"); /* c */ x58 = f(y, "061"); /* c */ x58 = f(y, "062"); /* c */ x58 = f(y, "063"); /* c */ x58 = f(y, "064"); /* c */ x58 = f(y, "065"); /* c */ x58 = f(y, "066"); /* c */ x58 = f(y, "067"); /* c */ x58 = f(y, "068"); /* c */ x58 = f(y, "069"); /* c */ x58 = f(y, "070"); /* c */ x58 = f(y, "071"); /* c */ x58 = f(y, "072"); /* c */ x58 = f(y, "073"); /* c */ x58 = f(y, "074"); /* c */ x58 = f(y, "075"); /* c */ x58 = f(y, "076"); /* c */ x58 = f(y, "077"); /* c */ x58 = f(y, "078"); /* c */ x58 = f(y, "079"); /* c */ x58 = f(y, "080"); /* c */ x58 = f(y, "081"); /* c */ x58 = f(y, "082"); /* c */ x58 = f(y, "083"); /* c */ x58 = f(y, "084"); /* c */ x58 = f(y, "085"); /* c */ x58 = f(y, "086"); /* c */ x58 = f(y, "087"); /* c */ x58 = f(y, "088"); /* c */ x58 = f(y, "089"); /* c */ x58 = f(y, "090"); /* c */ x58 = f(y, "091"); /* c */ x58 = f(y, "092"); /* c */ x58 = f(y, "093"); /* c */ x58 = f(y, "094"); /* c */ x58 = f(y, "095"); /* c */ x58 = f(y, "096"); /* c */ x58 = f(y, "097"); /* c */ x58 = f(y, "098"); /* c */ x58 = f(y, "099"); /* c */ x58 = f(y, "100"); /* c */ x58 = f(y, "101"); /* c */ x58 = f(y, "102"); /* c */ x58 = f(y, "103"); /* c */ x58 = f(y, "104"); /* c */ x58 = f(y, "105"); /* c */ x58 = f(y, "106"); /* c */ x58 = f(y, "107"); /* c */ x58 = f(y, "108"); /* c */ x58 = f(y, "109"); /* c */ x58 = f(y, "110"); /* c */ x58 = f(y, "111"); /* c */ x58 = f(y, "112"); /* c */ x58 = f(y, "113"); /* c */ x58 = f(y, "114"); /* c */ x58 = f(y, "115"); /* c */ x58 = f(y, "116"); /* c */ x58 = f(y, "117"); /* c */ x58 = f(y, "118"); /* c */ x58 = f(y, "119"); /* c */ x58 = f(y, "120"); /* c */ x58 = f(y, "121"); /* c */ x58 = f(y, "122"); /* c */ x58 = f(y, "123"); /* c */ x58 = f(y, "124"); /* c */ x58 = f(y, "125"); /* c */ x58 = f(y, "126"); /* c */ x58 = f(y, "127"); /* c */ x58 = f(y, "128"); /* c */ x58 = f(y, "129"); /* c */ x58 = f(y, "130"); /* c */ x58 = f(y, "131"); /* c */ x58 = f(y, "132"); /* c */ x58 = f(y, "133"); /* c */ x58 = f(y, "134"); /* c */ x58 = f(y, "135"); /* c */ x58 = f(y, "136"); /* c */ x58 = f(y, "137"); /* c */ x58 = f(y, "138"); /* c */ x58 = f(y, "139"); /* c */ x58 = f(y, "140"); /* c */ x58 = f(y, "141"); /* c */ x58 = f(y, "142"); /* c */ x58 = f(y, "143"); /* c */ x58 = f(y, "144"); /* c */ x58 = f(y, "145"); /* c */ x58 = f(y, "146"); /* c */ x58 = f(y, "147"); /* c */ x58 = f(y, "148"); /* c */ x58 = f(y, "149"); /* c */ x58 = f(y, "150"); /* c */ x58 = f(y, "151"); /* c */ x58 = f(y, "152"); /* c */ x58 = f(y, "153"); /* c */ x58 = f(y, "154"); /* c */ x58 = f(y, "155"); /* c */ x58 = f(y, "156"); /* c */ x58 = f(y, "157"); /* c */ x58 = f(y, "158"); /* c */ x58 = f(y, "159"); /* c */ x58 = f(y, "160"); /* c */ x58 = f(y, "161"); /* c */ x58 = f(y, "162"); /* c */ x58 = f(y, "163"); /* c */ x58 = f(y, "164"); /* c */ x58 = f(y, "165"); /* c */ x58 = f(y, "166"); /* c */ x58 = f(y, "167"); /* c */ x58 = f(y, "168"); /* c */ x58 = f(y, "169"); /* c */ x58 = f(y, "170"); /* c */ x58 = f(y, "171"); /* c */ x58 = f(y, "172"); /* c */ x58 = f(y, "173"); /* c */ x58 = f(y, "174"); /* c */ x58 = f(y, "175"); /* c */ x58 = f(y, "176"); /* c */ x58 = f(y, "177"); /* c */ x58 = f(y, "178"); /* c */ x58 = f(y, "179"); /* c */ x58 = f(y, "180"); /* c */ x58 = f(y, "181"); /* c */ x58 = f(y, "182"); /* c */ x58 = f(y, "183"); /* c */ x58 = f(y, "184"); /* c */ x58 = f(y, "185"); /* c */ x58 = f(y, "186"); /* c */ x58 = f(y, "187"); /* c */ x58 = f(y, "188"); /* c */ x58 = f(y, "189"); /* c */ x58 = f(y, "190"); /* c */ x58 = f(y, "191"); /* c */ x58 = f(y, "192"); /* c */ x58 = f(y, "193"); /* c */ x58 = f(y, "194"); /* c */ x58 = f(y, "195"); /* c */ x58 = f(y, "196"); /* c */ x58 = f(y, "197"); /* c */ x58 = f(y, "198"); /* c */ x58 = f(y, "199"); /* c */ 
+x59 = f(y, "000"); /* c */ x59 = f(y, "001"); /* c */ x59 = f(y, "002"); /* c */ x59 = f(y, "003"); /* c */ x59 = f(y, "004"); /* c */ x59 = f(y, "005"); /* c */ x59 = f(y, "006"); /* c */ x59 = f(y, "007"); /* c */ x59 = f(y, "008"); /* c */ x59 = f(y, "009"); /* c */ x59 = f(y, "010"); /* c */ x59 = f(y, "011"); /* c */ x59 = f(y, "012"); /* c */ x59 = f(y, "013"); /* c */ x59 = f(y, "014"); /* c */ x59 = f(y, "015"); /* c */ x59 = f(y, "016"); /* c */ x59 = f(y, "017"); /* c */ x59 = f(y, "018"); /* c */ x59 = f(y, "019"); /* c */ x59 = f(y, "020"); /* c */ x59 = f(y, "021"); /* c */ x59 = f(y, "022"); /* c */ x59 = f(y, "023"); /* c */ x59 = f(y, "024"); /* c */ x59 = f(y, "025"); /* c */ x59 = f(y, "026"); /* c */ x59 = f(y, "027"); /* c */ x59 = f(y, "028"); /* c */ x59 = f(y, "029"); /* c */ x59 = f(y, "030"); /* c */ x59 = f(y, "031"); /* c */ x59 = f(y, "032"); /* c */ x59 = f(y, "033"); /* c */ x59 = f(y, "034"); /* c */ x59 = f(y, "035"); /* c */ x59 = f(y, "036"); /* c */ x59 = f(y, "037"); /* c */ x59 = f(y, "038"); /* c */ x59 = f(y, "039"); /* c */ x59 = f(y, "040"); /* c */ x59 = f(y, "041"); /* c */ x59 = f(y, "042"); /* c */ x59 = f(y, "043"); /* c */ x59 = f(y, "044"); /* c */ x59 = f(y, "045"); /* c */ x59 = f(y, "046"); /* c */ x59 = f(y, "047"); /* c */ x59 = f(y, "048"); /* c */ x59 = f(y, "049"); /* c */ x59 = f(y, "050"); /* c */ x59 = f(y, "051"); /* c */ x59 = f(y, "052"); /* c */ x59 = f(y, "053"); /* c */ x59 = f(y, "054"); /* c */ x59 = f(y, "055"); /* c */ x59 = f(y, "056"); /* c */ x59 = f(y, "057"); /* c */ x59 = f(y, "058"); /* c */ x59 = f(y, "059"); /* c */ x59 = f(y, "060"); /* c */ x59 = f(y, "061"); /* c */ x59 = f(y, "062"); /* c */ x59 = f(y, "063"); /* c */ x59 = f(y, "064"); /* c */ x59 = f(y, "065"); /* c */ x59 = f(y, "066"); /* c */ x59 = f(y, "067"); /* c */ x59 = f(y, "068"); /* c */ x59 = f(y, "069"); /* c */ x59 = f(y, "070"); /* c */ x59 = f(y, "071"); /* c */ x59 = f(y, "072"); /* c */ x59 = f(y, "073"); /* c */ x59 = f(y, "074"); /* c */ x59 = f(y, "075"); /* c */ x59 = f(y, "076"); /* c */ x59 = f(y, "077"); /* c */ x59 = f(y, "078"); /* c */ x59 = f(y, "079"); /* c */ x59 = f(y, "080"); /* c */ x59 = f(y, "081"); /* c */ x59 = f(y, "082"); /* c */ x59 = f(y, "083"); /* c */ x59 = f(y, "084"); /* c */ x59 = f(y, "085"); /* c */ x59 = f(y, "086"); /* c */ x59 = f(y, "087"); /* c */ x59 = f(y, "088"); /* c */ x59 = f(y, "089"); /* c */ x59 = f(y, "090"); /* c */ x59 = f(y, "091"); /* c */ x59 = f(y, "092"); /* c */ x59 = f(y, "093"); /* c */ x59 = f(y, "094"); /* c */ x59 = f(y, "095"); /* c */ x59 = f(y, "096"); /* c */ x59 = f(y, "097"); /* c */ x59 = f(y, "098"); /* c */ x59 = f(y, "099"); /* c */ x59 = f(y, "100"); /* c */ x59 = f(y, "101"); /* c */ x59 = f(y, "102"); /* c */ x59 = f(y, "103"); /* c */ x59 = f(y, "104"); /* c */ x59 = f(y, "105"); /* c */ x59 = f(y, "106"); /* c */ x59 = f(y, "107"); /* c */ x59 = f(y, "108"); /* c */ x59 = f(y, "109"); /* c */ x59 = f(y, "110"); /* c */ x59 = f(y, "111"); /* c */ x59 = f(y, "112"); /* c */ x59 = f(y, "113"); /* c */ x59 = f(y, "114"); /* c */ x59 = f(y, "115"); /* c */ x59 = f(y, "116"); /* c */ x59 = f(y, "117"); /* c */ x59 = f(y, "118"); /* c */ x59 = f(y, "119"); /* c */ x59 = f(y, "120"); /* c */ x59 = f(y, "121"); /* c */ x59 = f(y, "122"); /* c */ x59 = f(y, "123"); /* c */ x59 = f(y, "124"); /* c */ x59 = f(y, "125"); /* c */ x59 = f(y, "126"); /* c */ x59 = f(y, "127"); /* c */ x59 = f(y, "128"); /* c */ x59 = f(y, "129"); /* c */ x59 = f(y, "130"); /* c */ x59 = f(y, "131"); /* c */ x59 = f(y, "132"); /* c */ x59 = f(y, "133"); /* c */ x59 = f(y, "134"); /* c */ x59 = f(y, "135"); /* c */ x59 = f(y, "136"); /* c */ x59 = f(y, "137"); /* c */ x59 = f(y, "138"); /* c */ x59 = f(y, "139"); /* c */ x59 = f(y, "140"); /* c */ x59 = f(y, "141"); /* c */ x59 = f(y, "142"); /* c */ x59 = f(y, "143"); /* c */ x59 = f(y, "144"); /* c */ x59 = f(y, "145"); /* c */ x59 = f(y, "146"); /* c */ x59 = f(y, "147"); /* c */ x59 = f(y, "148"); /* c */ x59 = f(y, "149"); /* c */ x59 = f(y, "150"); /* c */ x59 = f(y, "151"); /* c */ x59 = f(y, "152"); /* c */ x59 = f(y, "153"); /* c */ x59 = f(y, "154"); /* c */ x59 = f(y, "155"); /* c */ x59 = f(y, "156"); /* c */ x59 = f(y, "157"); /* c */ x59 = f(y, "158"); /* c */ x59 = f(y, "159"); /* c */ x59 = f(y, "160"); /* c */ x59 = f(y, "161"); /* c */ x59 = f(y, "162"); /* c */ x59 = f(y, "163"); /* c */ x59 = f(y, "164"); /* c */ x59 = f(y, "165"); /* c */ x59 = f(y, "166"); /* c */ x59 = f(y, "167"); /* c */ x59 = f(y, "168"); /* c */ x59 = f(y, "169"); /* c */ x59 = f(y, "170"); /* c */ x59 = f(y, "171"); /* c */ x59 = f(y, "172"); /* c */ x59 = f(y, "173"); /* c */ x59 = f(y, "174"); /* c */ x59 = f(y, "175"); /* c */ x59 = f(y, "176"); /* c */ x59 = f(y, "177"); /* c */ x59 = f(y, "178"); /* c */ x59 = f(y, "179"); /* c */ x59 = f(y, "180"); /* c */ x59 = f(y, "181"); /* c */ x59 = f(y, "182"); /* c */ x59 = f(y, "183"); /* c */ x59 = f(y, "184"); /* c */ x59 = f(y, "185"); /* c */ x59 = f(y, "186"); /* c */ x59 = f(y, "187"); /* c */ x59 = f(y, "188"); /* c */ x59 = f(y, "189"); /* c */ x59 = f(y, "190"); /* c */ x59 = f(y, "191"); /* c */ x59 = f(y, "192"); /* c */ x59 = f(y, "193"); /* c */ x59 = f(y, "194"); /* c */ x59 = f(y, "195"); /* c */ x59 = f(y, "196"); /* c */ x59 = f(y, "197"); /* c */ x59 = f(y, "198"); /* c */ x59 = f(y, "199"); /* c */ 
+x60 = f(y, "000"); /* c */ x60 = f(y, "001"); /* c */ x60 = f(y, "002"); /* c */ x60 = f(y, "003"); /* c */ x60 = f(y, "004"); /* c */ x60 = f(y, "005"); /* c */ x60 = f(y, "006"); /* c */ x60 = f(y, "007"); /* c */ x60 = f(y, "008"); /* c */ x60 = f(y, "009"); /* c */ x60 = f(y, "010"); /* c */ x60 = f(y, "011"); /* c */ x60 = f(y, "012"); /* c */ x60 = f(y, "013"); /* c */ x60 = f(y, "014"); /* c */ x60 = f(y, "015"); /* c */ x60 = f(y, "016"); /* c */ x60 = f(y, "017"); /* c */ x60 = f(y, "018"); /* c */ x60 = f(y, "019"); /* c */ x60 = f(y, "020"); /* c */ x60 = f(y, "021"); /* c */ x60 = f(y, "022"); /* c */ x60 = f(y, "023"); /* c */ x60 = f(y, "024"); /* c */ x60 = f(y, "025"); /* c */ x60 = f(y, "026"); /* c */ x60 = f(y, "027"); /* c */ x60 = f(y, "028"); /* c */ x60 = f(y, "029"); /* c */ x60 = f(y, "030"); /* c */ x60 = f(y, "031"); /* c */ x60 = f(y, "032"); /* c */ x60 = f(y, "033"); /* c */ x60 = f(y, "034"); /* c */ x60 = f(y, "035"); /* c */ x60 = f(y, "036"); /* c */ x60 = f(y, "037"); /* c */ x60 = f(y, "038"); /* c */ x60 = f(y, "039"); /* c */ x60 = f(y, "040"); /* c */ x60 = f(y, "041"); /* c */ x60 = f(y, "042"); /* c */ x60 = f(y, "043"); /* c */ x60 = f(y, "044"); /* c */ x60 = f(y, "045"); /* c */ x60 = f(y, "046"); /* c */ x60 = f(y, "047"); /* c */ x60 = f(y, "048"); /* c */ x60 = f(y, "049"); /* c */ x60 = f(y, "050"); /* c */ x60 = f(y, "051"); /* c */ x60 = f(y, "052"); /* c */ x60 = f(y, "053"); /* c */ x60 = f(y, "054"); /* c */ x60 = f(y, "055"); /* c */ x60 = f(y, "056"); /* c */ x60 = f(y, "057"); /* c */ x60 = f(y, "058"); /* c */ x60 = f(y, "059"); /* c */ x60 = f(y, "060"); /* c */ x60 = f(y, "061"); /* c */ x60 = f(y, "062"); /* c */ x60 = f(y, "063"); /* c */ x60 = f(y, "064"); /* c */ x60 = f(y, "065"); /* c */ x60 = f(y, "066"); /* c */ x60 = f(y, "067"); /* c */ x60 = f(y, "068"); /* c */ x60 = f(y, "069"); /* c */ x60 = f(y, "070"); /* c */ x60 = f(y, "071"); /* c */ x60 = f(y, "072"); /* c */ x60 = f(y, "073"); /* c */ x60 = f(y, "074"); /* c */ x60 = f(y, "075"); /* c */ x60 = f(y, "076"); /* c */ x60 = f(y, "077"); /* c */ x60 = f(y, "078"); /* c */ x60 = f(y, "079"); /* c */ x60 = f(y, "080"); /* c */ x60 = f(y, "081"); /* c */ x60 = f(y, "082"); /* c */ x60 = f(y, "083"); /* c */ x60 = f(y, "084"); /* c */ x60 = f(y, "085"); /* c */ x60 = f(y, "086"); /* c */ x60 = f(y, "087"); /* c */ x60 = f(y, "088"); /* c */ x60 = f(y, "089"); /* c */ x60 = f(y, "090"); /* c */ x60 = f(y, "091"); /* c */ x60 = f(y, "092"); /* c */ x60 = f(y, "093"); /* c */ x60 = f(y, "094"); /* c */ x60 = f(y, "095"); /* c */ x60 = f(y, "096"); /* c */ x60 = f(y, "097"); /* c */ x60 = f(y, "098"); /* c */ x60 = f(y, "099"); /* c */ x60 = f(y, "100"); /* c */ x60 = f(y, "101"); /* c */ x60 = f(y, "102"); /* c */ x60 = f(y, "103"); /* c */ x60 = f(y, "104"); /* c */ x60 = f(y, "105"); /* c */ x60 = f(y, "106"); /* c */ x60 = f(y, "107"); /* c */ x60 = f(y, "108"); /* c */ x60 = f(y, "109"); /* c */ x60 = f(y, "110"); /* c */ x60 = f(y, "111"); /* c */ x60 = f(y, "112"); /* c */ x60 = f(y, "113"); /* c */ x60 = f(y, "114"); /* c */ x60 = f(y, "115"); /* c */ x60 = f(y, "116"); /* c */ x60 = f(y, "117"); /* c */ x60 = f(y, "118"); /* c */ x60 = f(y, "119"); /* c */ x60 = f(y, "120"); /* c */ x60 = f(y, "121"); /* c */ x60 = f(y, "122"); /* c */ x60 = f(y, "123"); /* c */ x60 = f(y, "124"); /* c */ x60 = f(y, "125"); /* c */ x60 = f(y, "126"); /* c */ x60 = f(y, "127"); /* c */ x60 = f(y, "128"); /* c */ x60 = f(y, "129"); /* c */ x60 = f(y, "130"); /* c */ x60 = f(y, "131"); /* c */ x60 = f(y, "132"); /* c */ x60 = f(y, "133"); /* c */ x60 = f(y, "134"); /* c */ x60 = f(y, "135"); /* c */ x60 = f(y, "136"); /* c */ x60 = f(y, "137"); /* c */ x60 = f(y, "138"); /* c */ x60 = f(y, "139"); /* c */ x60 = f(y, "140"); /* c */ x60 = f(y, "141"); /* c */ x60 = f(y, "142"); /* c */ x60 = f(y, "143"); /* c */ x60 = f(y, "144"); /* c */ x60 = f(y, "145"); /* c */ x60 = f(y, "146"); /* c */ x60 = f(y, "147"); /* c */ x60 = f(y, "148"); /* c */ x60 = f(y, "149"); /* c */ x60 = f(y, "150"); /* c */ x60 = f(y, "151"); /* c */ x60 = f(y, "152"); /* c */ x60 = f(y, "153"); /* c */ x60 = f(y, "154"); /* c */ x60 = f(y, "155"); /* c */ x60 = f(y, "156"); /* c */ x60 = f(y, "157"); /* c */ x60 = f(y, "158"); /* c */ x60 = f(y, "159"); /* c */ x60 = f(y, "160"); /* c */ x60 = f(y, "161"); /* c */ x60 = f(y, "162"); /* c */ x60 = f(y, "163"); /* c */ x60 = f(y, "164"); /* c */ x60 = f(y, "165"); /* c */ x60 = f(y, "166"); /* c */ x60 = f(y, "167"); /* c */ x60 = f(y, "168"); /* c */ x60 = f(y, "169"); /* c */ x60 = f(y, "170"); /* c */ x60 = f(y, "171"); /* c */ x60 = f(y, "172"); /* c */ x60 = f(y, "173"); /* c */ x60 = f(y, "174"); /* c */ x60 = f(y, "175"); /* c */ x60 = f(y, "176"); /* c */ x60 = f(y, "177"); /* c */ x60 = f(y, "178"); /* c */ x60 = f(y, "179"); /* c */ x60 = f(y, "180"); /* c */ x60 = f(y, "181"); /* c */ x60 = f(y, "182"); /* c */ x60 = f(y, "183"); /* c */ x60 = f(y, "184"); /* c */ x60 = f(y, "185"); /* c */ x60 = f(y, "186"); /* c */ x60 = f(y, "187"); /* c */ x60 = f(y, "188"); /* c */ x60 = f(y, "189"); /* c */ x60 = f(y, "190"); /* c */ x60 = f(y, "191"); /* c */ x60 = f(y, "192"); /* c */ x60 = f(y, "193"); /* c */ x60 = f(y, "194"); /* c */ x60 = f(y, "195"); /* c */ x60 = f(y, "196"); /* c */ x60 = f(y, "197"); /* c */ x60 = f(y, "198"); /* c */ x60 = f(y, "199"); /* c */ 
+x61 = f(y, "000"); /* c */ x61 = f(y, "001"); /* c */ x61 = f(y, "002"); /* c */ x61 = f(y, "003"); /* c */ x61 = f(y, "004"); /* c */ x61 = f(y, "005"); /* c */ x61 = f(y, "006"); /* c */ x61 = f(y, "007"); /* c */ x61 = f(y, "008"); /* c */ x61 = f(y, "009"); /* c */ x61 = f(y, "010"); /* c */ x61 = f(y, "011"); /* c */ x61 = f(y, "012"); /* c */ x61 = f(y, "013"); /* c */ x61 = f(y, "014"); /* c */ x61 = f(y, "015"); /* c */ x61 = f(y, "016"); /* c */ x61 = f(y, "017"); /* c */ x61 = f(y, "018"); /* c */ x61 = f(y, "019"); /* c */ x61 = f(y, "020"); /* c */ x61 = f(y, "021"); /* c */ x61 = f(y, "022"); /* c */ x61 = f(y, "023"); /* c */ x61 = f(y, "024"); /* c */ x61 = f(y, "025"); /* c */ x61 = f(y, "026"); /* c */ x61 = f(y, "027"); /* c */ x61 = f(y, "028"); /* c */ x61 = f(y, "029"); /* c */ x61 = f(y, "030"); /* c */ x61 = f(y, "031"); /* c */ x61 = f(y, "032"); /* c */ x61 = f(y, "033"); /* c */ x61 = f(y, "034"); /* c */ x61 = f(y, "035"); /* c */ x61 = f(y, "036"); /* c */ x61 = f(y, "037"); /* c */ x61 = f(y, "038"); /* c */ x61 = f(y, "039"); /* c */ x61 = f(y, "040"); /* c */ x61 = f(y, "041"); /* c */ x61 = f(y, "042"); /* c */ x61 = f(y, "043"); /* c */ x61 = f(y, "044"); /* c */ x61 = f(y, "045"); /* c */ x61 = f(y, "046"); /* c */ x61 = f(y, "047"); /* c */ x61 = f(y, "048"); /* c */ x61 = f(y, "049"); /* c */ x61 = f(y, "050"); /* c */ x61 = f(y, "051"); /* c */ x61 = f(y, "052"); /* c */ x61 = f(y, "053"); /* c */ x61 = f(y, "054"); /* c */ x61 = f(y, "055"); /* c */ x61 = f(y, "056"); /* c */ x61 = f(y, "057"); /* c */ x61 = f(y, "058"); /* c */ x61 = f(y, "059"); /* c */ x61 = f(y, "060"); /* c */ x61 = f(y, "061"); /* c */ x61 = f(y, "062"); /* c */ x61 = f(y, "063"); /* c */ x61 = f(y, "064"); /* c */ x61 = f(y, "065"); /* c */ x61 = f(y, "066"); /* c */ x61 = f(y, "067"); /* c */ x61 = f(y, "068"); /* c */ x61 = f(y, "069"); /* c */ x61 = f(y, "070"); /* c */ x61 = f(y, "071"); /* c */ x61 = f(y, "072"); /* c */ x61 = f(y, "073"); /* c */ x61 = f(y, "074"); /* c */ x61 = f(y, "075"); /* c */ x61 = f(y, "076"); /* c */ x61 = f(y, "077"); /* c */ x61 = f(y, "078"); /* c */ x61 = f(y, "079"); /* c */ x61 = f(y, "080"); /* c */ x61 = f(y, "081"); /* c */ x61 = f(y, "082"); /* c */ x61 = f(y, "083"); /* c */ x61 = f(y, "084"); /* c */ x61 = f(y, "085"); /* c */ x61 = f(y, "086"); /* c */ x61 = f(y, "087"); /* c */ x61 = f(y, "088"); /* c */ x61 = f(y, "089"); /* c */ x61 = f(y, "090"); /* c */ x61 = f(y, "091"); /* c */ x61 = f(y, "092"); /* c */ x61 = f(y, "093"); /* c */ x61 = f(y, "094"); /* c */ x61 = f(y, "095"); /* c */ x61 = f(y, "096"); /* c */ x61 = f(y, "097"); /* c */ x61 = f(y, "098"); /* c */ x61 = f(y, "099"); /* c */ x61 = f(y, "100"); /* c */ x61 = f(y, "101"); /* c */ x61 = f(y, "102"); /* c */ x61 = f(y, "103"); /* c */ x61 = f(y, "104"); /* c */ x61 = f(y, "105"); /* c */ x61 = f(y, "106"); /* c */ x61 = f(y, "107"); /* c */ x61 = f(y, "108"); /* c */ x61 = f(y, "109"); /* c */ x61 = f(y, "110"); /* c */ x61 = f(y, "111"); /* c */ x61 = f(y, "112"); /* c */ x61 = f(y, "113"); /* c */ x61 = f(y, "114"); /* c */ x61 = f(y, "115"); /* c */ x61 = f(y, "116"); /* c */ x61 = f(y, "117"); /* c */ x61 = f(y, "118"); /* c */ x61 = f(y, "119"); /* c */ x61 = f(y, "120"); /* c */ x61 = f(y, "121"); /* c */ x61 = f(y, "122"); /* c */ x61 = f(y, "123"); /* c */ x61 = f(y, "124"); /* c */ x61 = f(y, "125"); /* c */ x61 = f(y, "126"); /* c */ x61 = f(y, "127"); /* c */ x61 = f(y, "128"); /* c */ x61 = f(y, "129"); /* c */ x61 = f(y, "130"); /* c */ x61 = f(y, "131"); /* c */ x61 = f(y, "132"); /* c */ x61 = f(y, "133"); /* c */ x61 = f(y, "134"); /* c */ x61 = f(y, "135"); /* c */ x61 = f(y, "136"); /* c */ x61 = f(y, "137"); /* c */ x61 = f(y, "138"); /* c */ x61 = f(y, "139"); /* c */ x61 = f(y, "140"); /* c */ x61 = f(y, "141"); /* c */ x61 = f(y, "142"); /* c */ x61 = f(y, "143"); /* c */ x61 = f(y, "144"); /* c */ x61 = f(y, "145"); /* c */ x61 = f(y, "146"); /* c */ x61 = f(y, "147"); /* c */ x61 = f(y, "148"); /* c */ x61 = f(y, "149"); /* c */ x61 = f(y, "150"); /* c */ x61 = f(y, "151"); /* c */ x61 = f(y, "152"); /* c */ x61 = f(y, "153"); /* c */ x61 = f(y, "154"); /* c */ x61 = f(y, "155"); /* c */ x61 = f(y, "156"); /* c */ x61 = f(y, "157"); /* c */ x61 = f(y, "158"); /* c */ x61 = f(y, "159"); /* c */ x61 = f(y, "160"); /* c */ x61 = f(y, "161"); /* c */ x61 = f(y, "162"); /* c */ x61 = f(y, "163"); /* c */ x61 = f(y, "164"); /* c */ x61 = f(y, "165"); /* c */ x61 = f(y, "166"); /* c */ x61 = f(y, "167"); /* c */ x61 = f(y, "168"); /* c */ x61 = f(y, "169"); /* c */ x61 = f(y, "170"); /* c */ x61 = f(y, "171"); /* c */ x61 = f(y, "172"); /* c */ x61 = f(y, "173"); /* c */ x61 = f(y, "174"); /* c */ x61 = f(y, "175"); /* c */ x61 = f(y, "176"); /* c */ x61 = f(y, "177"); /* c */ x61 = f(y, "178"); /* c */ x61 = f(y, "179"); /* c */ x61 = f(y, "180"); /* c */ x61 = f(y, "181"); /* c */ x61 = f(y, "182"); /* c */ x61 = f(y, "183"); /* c */ x61 = f(y, "184"); /* c */ x61 = f(y, "185"); /* c */ x61 = f(y, "186"); /* c */ x61 = f(y, "187"); /* c */ x61 = f(y, "188"); /* c */ x61 = f(y, "189"); /* c */ x61 = f(y, "190"); /* c */ x61 = f(y, "191"); /* c */ x61 = f(y, "192"); /* c */ x61 = f(y, "193"); /* c */ x61 = f(y, "194"); /* c */ x61 = f(y, "195"); /* c */ x61 = f(y, "196"); /* c */ x61 = f(y, "197"); /* c */ x61 = f(y, "198"); /* c */ x61 = f(y, "199"); /* c */ 
+x62 = f(y, "000"); /* c */ x62 = f(y, "001"); /* c */ x62 = f(y, "002"); /* c */ x62 = f(y, "003"); /* c */ x62 = f(y, "004"); /* c */ x62 = f(y, "005"); /* c */ x62 = f(y, "006"); /* c */ x62 = f(y, "007"); /* c */ x62 = f(y, "008"); /* c */ x62 = f(y, "009"); /* c */ x62 = f(y, "010"); /* c */ x62 = f(y, "011"); /* c */ x62 = f(y, "012"); /* c */ x62 = f(y, "013"); /* c */ x62 = f(y, "014"); /* c */ x62 = f(y, "015"); /* c */ x62 = f(y, "016"); /* c */ x62 = f(y, "017"); /* c */ x62 = f(y, "018"); /* c */ x62 = f(y, "019"); /* c */ x62 = f(y, "020"); /* c */ x62 = f(y, "021"); /* c */ x62 = f(y, "022"); /* c */ x62 = f(y, "023"); /* c */ x62 = f(y, "024"); /* c */ x62 = f(y, "025"); /* c */ x62 = f(y, "026"); /* c */ x62 = f(y, "027"); /* c */ x62 = f(y, "028"); /* c */ x62 = f(y, "029"); /* c */ x62 = f(y, "030"); /* c */ x62 = f(y, "031"); /* c */ x62 = f(y, "032"); /* c */ x62 = f(y, "033"); /* c */ x62 = f(y, "034"); /* c */ x62 = f(y, "035"); /* c */ x62 = f(y, "036"); /* c */ x62 = f(y, "037"); /* c */ x62 = f(y, "038"); /* c */ x62 = f(y, "039"); /* c */ x62 = f(y, "040"); /* c */ x62 = f(y, "041"); /* c */ x62 = f(y, "042"); /* c */ x62 = f(y, "043"); /* c */ x62 = f(y, "044"); /* c */ x62 = f(y, "045"); /* c */ x62 = f(y, "046"); /* c */ x62 = f(y, "047"); /* c */ x62 = f(y, "048"); /* c */ x62 = f(y, "049"); /* c */ x62 = f(y, "050"); /* c */ x62 = f(y, "051"); /* c */ x62 = f(y, "052"); /* c */ x62 = f(y, "053"); /* c */ x62 = f(y, "054"); /* c */ x62 = f(y, "055"); /* c */ x62 = f(y, "056"); /* c */ x62 = f(y, "057"); /* c */ x62 = f(y, "058"); /* c */ x62 = f(y, "059"); /* c */ x62 = f(y, "060"); /* c */ x62 = f(y, "061"); /* c */ x62 = f(y, "062"); /* c */ x62 = f(y, "063"); /* c */ x62 = f(y, "064"); /* c */ x62 = f(y, "065"); /* c */ x62 = f(y, "066"); /* c */ x62 = f(y, "067"); /* c */ x62 = f(y, "068"); /* c */ x62 = f(y, "069"); /* c */ x62 = f(y, "070"); /* c */ x62 = f(y, "071"); /* c */ x62 = f(y, "072"); /* c */ x62 = f(y, "073"); /* c */ x62 = f(y, "074"); /* c */ x62 = f(y, "075"); /* c */ x62 = f(y, "076"); /* c */ x62 = f(y, "077"); /* c */ x62 = f(y, "078"); /* c */ x62 = f(y, "079"); /* c */ x62 = f(y, "080"); /* c */ x62 = f(y, "081"); /* c */ x62 = f(y, "082"); /* c */ x62 = f(y, "083"); /* c */ x62 = f(y, "084"); /* c */ x62 = f(y, "085"); /* c */ x62 = f(y, "086"); /* c */ x62 = f(y, "087"); /* c */ x62 = f(y, "088"); /* c */ x62 = f(y, "089"); /* c */ x62 = f(y, "090"); /* c */ x62 = f(y, "091"); /* c */ x62 = f(y, "092"); /* c */ x62 = f(y, "093"); /* c */ x62 = f(y, "094"); /* c */ x62 = f(y, "095"); /* c */ x62 = f(y, "096"); /* c */ x62 = f(y, "097"); /* c */ x62 = f(y, "098"); /* c */ x62 = f(y, "099"); /* c */ x62 = f(y, "100"); /* c */ x62 = f(y, "101"); /* c */ x62 = f(y, "102"); /* c */ x62 = f(y, "103"); /* c */ x62 = f(y, "104"); /* c */ x62 = f(y, "105"); /* c */ x62 = f(y, "106"); /* c */ x62 = f(y, "107"); /* c */ x62 = f(y, "108"); /* c */ x62 = f(y, "109"); /* c */ x62 = f(y, "110"); /* c */ x62 = f(y, "111"); /* c */ x62 = f(y, "112"); /* c */ x62 = f(y, "113"); /* c */ x62 = f(y, "114"); /* c */ x62 = f(y, "115"); /* c */ x62 = f(y, "116"); /* c */ x62 = f(y, "117"); /* c */ x62 = f(y, "118"); /* c */ x62 = f(y, "119"); /* c */ x62 = f(y, "120"); /* c */ x62 = f(y, "121"); /* c */ x62 = f(y, "122"); /* c */ x62 = f(y, "123"); /* c */ x62 = f(y, "124"); /* c */ x62 = f(y, "125"); /* c */ x62 = f(y, "126"); /* c */ x62 = f(y, "127"); /* c */ x62 = f(y, "128"); /* c */ x62 = f(y, "129"); /* c */ x62 = f(y, "130"); /* c */ x62 = f(y, "131"); /* c */ x62 = f(y, "132"); /* c */ x62 = f(y, "133"); /* c */ x62 = f(y, "134"); /* c */ x62 = f(y, "135"); /* c */ x62 = f(y, "136"); /* c */ x62 = f(y, "137"); /* c */ x62 = f(y, "138"); /* c */ x62 = f(y, "139"); /* c */ x62 = f(y, "140"); /* c */ x62 = f(y, "141"); /* c */ x62 = f(y, "142"); /* c */ x62 = f(y, "143"); /* c */ x62 = f(y, "144"); /* c */ x62 = f(y, "145"); /* c */ x62 = f(y, "146"); /* c */ x62 = f(y, "147"); /* c */ x62 = f(y, "148"); /* c */ x62 = f(y, "149"); /* c */ x62 = f(y, "150"); /* c */ x62 = f(y, "151"); /* c */ x62 = f(y, "152"); /* c */ x62 = f(y, "153"); /* c */ x62 = f(y, "154"); /* c */ x62 = f(y, "155"); /* c */ x62 = f(y, "156"); /* c */ x62 = f(y, "157"); /* c */ x62 = f(y, "158"); /* c */ x62 = f(y, "159"); /* c */ x62 = f(y, "160"); /* c */ x62 = f(y, "161"); /* c */ x62 = f(y, "162"); /* c */ x62 = f(y, "163"); /* c */ x62 = f(y, "164"); /* c */ x62 = f(y, "165"); /* c */ x62 = f(y, "166"); /* c */ x62 = f(y, "167"); /* c */ x62 = f(y, "168"); /* c */ x62 = f(y, "169"); /* c */ x62 = f(y, "170"); /* c */ x62 = f(y, "171"); /* c */ x62 = f(y, "172"); /* c */ x62 = f(y, "173"); /* c */ x62 = f(y, "174"); /* c */ x62 = f(y, "175"); /* c */ x62 = f(y, "176"); /* c */ x62 = f(y, "177"); /* c */ x62 = f(y, "178"); /* c */ x62 = f(y, "179"); /* c */ x62 = f(y, "180"); /* c */ x62 = f(y, "181"); /* c */ x62 = f(y, "182"); /* c */ x62 = f(y, "183"); /* c */ x62 = f(y, "184"); /* c */ x62 = f(y, "185"); /* c */ x62 = f(y, "186"); /* c */ x62 = f(y, "187"); /* c */ x62 = f(y, "188"); /* c */ x62 = f(y, "189"); /* c */ x62 = f(y, "190"); /* c */ x62 = f(y, "191"); /* c */ x62 = f(y, "192"); /* c */ x62 = f(y, "193"); /* c */ x62 = f(y, "194"); /* c */ x62 = f(y, "195"); /* c */ x62 = f(y, "196"); /* c */ x62 = f(y, "197"); /* c */ x62 = f(y, "198"); /* c */ x62 = f(y, "199"); /* c */ 
+x63 = f(y, "000"); /* c */ x63 = f(y, "001"); /* c */ x63 = f(y, "002"); /* c */ x63 = f(y, "003"); /* c */ x63 = f(y, "004"); /* c */ x63 = f(y, "005"); /* c */ x63 = f(y, "006"); /* c */ x63 = f(y, "007"); /* c */ x63 = f(y, "008"); /* c */ x63 = f(y, "009"); /* c */ x63 = f(y, "010"); /* c */ x63 = f(y, "011"); /* c */ x63 = f(y, "012"); /* c */ x63 = f(y, "013"); /* c */ x63 = f(y, "014"); /* c */ x63 = f(y, "015"); /* c */ x63 = f(y, "016"); /* c */ x63 = f(y, "017"); /* c */ x63 = f(y, "018"); /* c */ x63 = f(y, "019"); /* c */ x63 = f(y, "020"); /* c */ x63 = f(y, "021"); /* c */ x63 = f(y, "022"); /* c */ x63 = f(y, "023"); /* c */ x63 = f(y, "024"); /* c */ x63 = f(y, "025"); /* c */ x63 = f(y, "026"); /* c */ x63 = f(y, "027"); /* c */ x63 = f(y, "028"); /* c */ x63 = f(y, "029"); /* c */ x63 = f(y, "030"); /* c */ x63 = f(y, "031"); /* c */ x63 = f(y, "032"); /* c */ x63 = f(y, "033"); /* c */ x63 = f(y, "034"); /* c */ x63 = f(y, "035"); /* c */ x63 = f(y, "036"); /* c */ x63 = f(y, "037"); /* c */ x63 = f(y, "038"); /* c */ x63 = f(y, "039"); /* c */ x63 = f(y, "040"); /* c */ x63 = f(y, "041"); /* c */ x63 = f(y, "042"); /* c */ x63 = f(y, "043"); /* c */ x63 = f(y, "044"); /* c */ x63 = f(y, "045"); /* c */ x63 = f(y, "046"); /* c */ x63 = f(y, "047"); /* c */ x63 = f(y, "048"); /* c */ x63 = f(y, "049"); /* c */ x63 = f(y, "050"); /* c */ x63 = f(y, "051"); /* c */ x63 = f(y, "052"); /* c */ x63 = f(y, "053"); /* c */ x63 = f(y, "054"); /* c */ x63 = f(y, "055"); /* c */ x63 = f(y, "056"); /* c */ x63 = f(y, "057"); /* c */ x63 = f(y, "058"); /* c */ x63 = f(y, "059"); /* c */ x63 = f(y, "060"); /* c */ x63 = f(y, "061"); /* c */ x63 = f(y, "062"); /* c */ x63 = f(y, "063"); /* c */ x63 = f(y, "064"); /* c */ x63 = f(y, "065"); /* c */ x63 = f(y, "066"); /* c */ x63 = f(y, "067"); /* c */ x63 = f(y, "068"); /* c */ x63 = f(y, "069"); /* c */ x63 = f(y, "070"); /* c */ x63 = f(y, "071"); /* c */ x63 = f(y, "072"); /* c */ x63 = f(y, "073"); /* c */ x63 = f(y, "074"); /* c */ x63 = f(y, "075"); /* c */ x63 = f(y, "076"); /* c */ x63 = f(y, "077"); /* c */ x63 = f(y, "078"); /* c */ x63 = f(y, "079"); /* c */ x63 = f(y, "080"); /* c */ x63 = f(y, "081"); /* c */ x63 = f(y, "082"); /* c */ x63 = f(y, "083"); /* c */ x63 = f(y, "084"); /* c */ x63 = f(y, "085"); /* c */ x63 = f(y, "086"); /* c */ x63 = f(y, "087"); /* c */ x63 = f(y, "088"); /* c */ x63 = f(y, "089"); /* c */ x63 = f(y, "090"); /* c */ x63 = f(y, "091"); /* c */ x63 = f(y, "092"); /* c */ x63 = f(y, "093"); /* c */ x63 = f(y, "094"); /* c */ x63 = f(y, "095"); /* c */ x63 = f(y, "096"); /* c */ x63 = f(y, "097"); /* c */ x63 = f(y, "098"); /* c */ x63 = f(y, "099"); /* c */ x63 = f(y, "100"); /* c */ x63 = f(y, "101"); /* c */ x63 = f(y, "102"); /* c */ x63 = f(y, "103"); /* c */ x63 = f(y, "104"); /* c */ x63 = f(y, "105"); /* c */ x63 = f(y, "106"); /* c */ x63 = f(y, "107"); /* c */ x63 = f(y, "108"); /* c */ x63 = f(y, "109"); /* c */ x63 = f(y, "110"); /* c */ x63 = f(y, "111"); /* c */ x63 = f(y, "112"); /* c */ x63 = f(y, "113"); /* c */ x63 = f(y, "114"); /* c */ x63 = f(y, "115"); /* c */ x63 = f(y, "116"); /* c */ x63 = f(y, "117"); /* c */ x63 = f(y, "118"); /* c */ x63 = f(y, "119"); /* c */ x63 = f(y, "120"); /* c */ x63 = f(y, "121"); /* c */ x63 = f(y, "122"); /* c */ x63 = f(y, "123"); /* c */ x63 = f(y, "124"); /* c */ x63 = f(y, "125"); /* c */ x63 = f(y, "126"); /* c */ x63 = f(y, "127"); /* c */ x63 = f(y, "128"); /* c */ x63 = f(y, "129"); /* c */ x63 = f(y, "130"); /* c */ x63 = f(y, "131"); /* c */ x63 = f(y, "132"); /* c */ x63 = f(y, "133"); /* c */ x63 = f(y, "134"); /* c */ x63 = f(y, "135"); /* c */ x63 = f(y, "136"); /* c */ x63 = f(y, "137"); /* c */ x63 = f(y, "138"); /* c */ x63 = f(y, "139"); /* c */ x63 = f(y, "140"); /* c */ x63 = f(y, "141"); /* c */ x63 = f(y, "142"); /* c */ x63 = f(y, "143"); /* c */ x63 = f(y, "144"); /* c */ x63 = f(y, "145"); /* c */ x63 = f(y, "146"); /* c */ x63 = f(y, "147"); /* c */ x63 = f(y, "148"); /* c */ x63 = f(y, "149"); /* c */ x63 = f(y, "150"); /* c */ x63 = f(y, "151"); /* c */ x63 = f(y, "152"); /* c */ x63 = f(y, "153"); /* c */ x63 = f(y, "154"); /* c */ x63 = f(y, "155"); /* c */ x63 = f(y, "156"); /* c */ x63 = f(y, "157"); /* c */ x63 = f(y, "158"); /* c */ x63 = f(y, "159"); /* c */ x63 = f(y, "160"); /* c */ x63 = f(y, "161"); /* c */ x63 = f(y, "162"); /* c */ x63 = f(y, "163"); /* c */ x63 = f(y, "164"); /* c */ x63 = f(y, "165"); /* c */ x63 = f(y, "166"); /* c */ x63 = f(y, "167"); /* c */ x63 = f(y, "168"); /* c */ x63 = f(y, "169"); /* c */ x63 = f(y, "170"); /* c */ x63 = f(y, "171"); /* c */ x63 = f(y, "172"); /* c */ x63 = f(y, "173"); /* c */ x63 = f(y, "174"); /* c */ x63 = f(y, "175"); /* c */ x63 = f(y, "176"); /* c */ x63 = f(y, "177"); /* c */ x63 = f(y, "178"); /* c */ x63 = f(y, "179"); /* c */ x63 = f(y, "180"); /* c */ x63 = f(y, "181"); /* c */ x63 = f(y, "182"); /* c */ x63 = f(y, "183"); /* c */ x63 = f(y, "184"); /* c */ x63 = f(y, "185"); /* c */ x63 = f(y, "186"); /* c */ x63 = f(y, "187"); /* c */ x63 = f(y, "188"); /* c */ x63 = f(y, "189"); /* c */ x63 = f(y, "190"); /* c */ x63 = f(y, "191"); /* c */ x63 = f(y, "192"); /* c */ x63 = f(y, "193"); /* c */ x63 = f(y, "194"); /* c */ x63 = f(y, "195"); /* c */ x63 = f(y, "196"); /* c */ x63 = f(y, "197"); /* c */ x63 = f(y, "198"); /* c */ x63 = f(y, "199"); /* c */ 
+x64 = f(y, "000"); /* c */ x64 = f(y, "001"); /* c */ x64 = f(y, "002"); /* c */ x64 = f(y, "003"); /* c */ x64 = f(y, "004"); /* c */ x64 = f(y, "005"); /* c */ x64 = f(y, "006"); /* c */ x64 = f(y, "007"); /* c */ x64 = f(y, "008"); /* c */ x64 = f(y, "009"); /* c */ x64 = f(y, "010"); /* c */ x64 = f(y, "011"); /* c */ x64 = f(y, "012"); /* c */ x64 = f(y, "013"); /* c */ x64 = f(y, "014"); /* c */ x64 = f(y, "015"); /* c */ x64 = f(y, "016"); /* c */ x64 = f(y, "017"); /* c */ x64 = f(y, "018"); /* c */ x64 = f(y, "019"); /* c */ x64 = f(y, "020"); /* c */ x64 = f(y, "021"); /* c */ x64 = f(y, "022"); /* c */ x64 = f(y, "023"); /* c */ x64 = f(y, "024"); /* c */ x64 = f(y, "025"); /* c */ x64 = f(y, "026"); /* c */ x64 = f(y, "027"); /* c */ x64 = f(y, "028"); /* c */ x64 = f(y, "029"); /* c */ x64 = f(y, "030"); /* c */ x64 = f(y, "031"); /* c */ x64 = f(y, "032"); /* c */ x64 = f(y, "033"); /* c */ x64 = f(y, "034"); /* c */ x64 = f(y, "035"); /* c */ x64 = f(y, "036"); /* c */ x64 = f(y, "037"); /* c */ x64 = f(y, "038"); /* c */ x64 = f(y, "039"); /* c */ x64 = f(y, "040"); /* c */ x64 = f(y, "041"); /* c */ x64 = f(y, "042"); /* c */ x64 = f(y, "043"); /* c */ x64 = f(y, "044"); /* c */ x64 = f(y, "045"); /* c */ x64 = f(y, "046"); /* c */ x64 = f(y, "047"); /* c */ x64 = f(y, "048"); /* c */ x64 = f(y, "049"); /* c */ x64 = f(y, "050"); /* c */ x64 = f(y, "051"); /* c */ x64 = f(y, "052"); /* c */ x64 = f(y, "053"); /* c */ x64 = f(y, "054"); /* c */ x64 = f(y, "055"); /* c */ x64 = f(y, "056"); /* c */ x64 = f(y, "057"); /* c */ x64 = f(y, "058"); /* c */ x64 = f(y, "059"); /* c */ x64 = f(y, "060"); /* c */ x64 = f(y, "061"); /* c */ x64 = f(y, "062"); /* c */ x64 = f(y, "063"); /* c */ x64 = f(y, "064"); /* c */ x64 = f(y, "065"); /* c */ x64 = f(y, "066"); /* c */ x64 = f(y, "067"); /* c */ x64 = f(y, "068"); /* c */ x64 = f(y, "069"); /* c */ x64 = f(y, "070"); /* c */ x64 = f(y, "071"); /* c */ x64 = f(y, "072"); /* c */ x64 = f(y, "073"); /* c */ x64 = f(y, "074"); /* c */ x64 = f(y, "075"); /* c */ x64 = f(y, "076"); /* c */ x64 = f(y, "077"); /* c */ x64 = f(y, "078"); /* c */ x64 = f(y, "079"); /* c */ x64 = f(y, "080"); /* c */ x64 = f(y, "081"); /* c */ x64 = f(y, "082"); /* c */ x64 = f(y, "083"); /* c */ x64 = f(y, "084"); /* c */ x64 = f(y, "085"); /* c */ x64 = f(y, "086"); /* c */ x64 = f(y, "087"); /* c */ x64 = f(y, "088"); /* c */ x64 = f(y, "089"); /* c */ x64 = f(y, "090"); /* c */ x64 = f(y, "091"); /* c */ x64 = f(y, "092"); /* c */ x64 = f(y, "093"); /* c */ x64 = f(y, "094"); /* c */ x64 = f(y, "095"); /* c */ x64 = f(y, "096"); /* c */ x64 = f(y, "097"); /* c */ x64 = f(y, "098"); /* c */ x64 = f(y, "099"); /* c */ x64 = f(y, "100"); /* c */ x64 = f(y, "101"); /* c */ x64 = f(y, "102"); /* c */ x64 = f(y, "103"); /* c */ x64 = f(y, "104"); /* c */ x64 = f(y, "105"); /* c */ x64 = f(y, "106"); /* c */ x64 = f(y, "107"); /* c */ x64 = f(y, "108"); /* c */ x64 = f(y, "109"); /* c */ x64 = f(y, "110"); /* c */ x64 = f(y, "111"); /* c */ x64 = f(y, "112"); /* c */ x64 = f(y, "113"); /* c */ x64 = f(y, "114"); /* c */ x64 = f(y, "115"); /* c */ x64 = f(y, "116"); /* c */ x64 = f(y, "117"); /* c */ x64 = f(y, "118"); /* c */ x64 = f(y, "119"); /* c */ x64 = f(y, "120"); /* c */ x64 = f(y, "121"); /* c */ x64 = f(y, "122"); /* c */ x64 = f(y, "123"); /* c */ x64 = f(y, "124"); /* c */ x64 = f(y, "125"); /* c */ x64 = f(y, "126"); /* c */ x64 = f(y, "127"); /* c */ x64 = f(y, "128"); /* c */ x64 = f(y, "129"); /* c */ x64 = f(y, "130"); /* c */ x64 = f(y, "131"); /* c */ x64 = f(y, "132"); /* c */ x64 = f(y, "133"); /* c */ x64 = f(y, "134"); /* c */ x64 = f(y, "135"); /* c */ x64 = f(y, "136"); /* c */ x64 = f(y, "137"); /* c */ x64 = f(y, "138"); /* c */ x64 = f(y, "139"); /* c */ x64 = f(y, "140"); /* c */ x64 = f(y, "141"); /* c */ x64 = f(y, "142"); /* c */ x64 = f(y, "143"); /* c */ x64 = f(y, "144"); /* c */ x64 = f(y, "145"); /* c */ x64 = f(y, "146"); /* c */ x64 = f(y, "147"); /* c */ x64 = f(y, "148"); /* c */ x64 = f(y, "149"); /* c */ x64 = f(y, "150"); /* c */ x64 = f(y, "151"); /* c */ x64 = f(y, "152"); /* c */ x64 = f(y, "153"); /* c */ x64 = f(y, "154"); /* c */ x64 = f(y, "155"); /* c */ x64 = f(y, "156"); /* c */ x64 = f(y, "157"); /* c */ x64 = f(y, "158"); /* c */ x64 = f(y, "159"); /* c */ x64 = f(y, "160"); /* c */ x64 = f(y, "161"); /* c */ x64 = f(y, "162"); /* c */ x64 = f(y, "163"); /* c */ x64 = f(y, "164"); /* c */ x64 = f(y, "165"); /* c */ x64 = f(y, "166"); /* c */ x64 = f(y, "167"); /* c */ x64 = f(y, "168"); /* c */ x64 = f(y, "169"); /* c */ x64 = f(y, "170"); /* c */ x64 = f(y, "171"); /* c */ x64 = f(y, "172"); /* c */ x64 = f(y, "173"); /* c */ x64 = f(y, "174"); /* c */ x64 = f(y, "175"); /* c */ x64 = f(y, "176"); /* c */ x64 = f(y, "177"); /* c */ x64 = f(y, "178"); /* c */ x64 = f(y, "179"); /* c */ x64 = f(y, "180"); /* c */ x64 = f(y, "181"); /* c */ x64 = f(y, "182"); /* c */ x64 = f(y, "183"); /* c */ x64 = f(y, "184"); /* c */ x64 = f(y, "185"); /* c */ x64 = f(y, "186"); /* c */ x64 = f(y, "187"); /* c */ x64 = f(y, "188"); /* c */ x64 = f(y, "189"); /* c */ x64 = f(y, "190"); /* c */ x64 = f(y, "191"); /* c */ x64 = f(y, "192"); /* c */ x64 = f(y, "193"); /* c */ x64 = f(y, "194"); /* c */ x64 = f(y, "195"); /* c */ x64 = f(y, "196"); /* c */ x64 = f(y, "197"); /* c */ x64 = f(y, "198"); /* c */ x64 = f(y, "199"); /* c */ 
+x65 = f(y, "000"); /* c */ x65 = f(y, "001"); /* c */ x65 = f(y, "002"); /* c */ x65 = f(y, "003"); /* c */ x65 = f(y, "004"); /* c */ x65 = f(y, "005"); /* c */ x65 = f(y, "006"); /* c */ x65 = f(y, "007"); /* c */ x65 = f(y, "008"); /* c */ x65 = f(y, "009"); /* c */ x65 = f(y, "010"); /* c */ x65 = f(y, "011"); /* c */ x65 = f(y, "012"); /* c */ x65 = f(y, "013"); /* c */ x65 = f(y, "014"); /* c */ x65 = f(y, "015"); /* c */ x65 = f(y, "016"); /* c */ x65 = f(y, "017"); /* c */ x65 = f(y, "018"); /* c */ x65 = f(y, "019"); /* c */ x65 = f(y, "020"); /* c */ x65 = f(y, "021"); /* c */ x65 = f(y, "022"); /* c */ x65 = f(y, "023"); /* c */ x65 = f(y, "024"); /* c */ x65 = f(y, "025"); /* c */ x65 = f(y, "026"); /* c */ x65 = f(y, "027"); /* c */ x65 = f(y, "028"); /* c */ x65 = f(y, "029"); /* c */ x65 = f(y, "030"); /* c */ x65 = f(y, "031"); /* c */ x65 = f(y, "032"); /* c */ x65 = f(y, "033"); /* c */ x65 = f(y, "034"); /* c */ x65 = f(y, "035"); /* c */ x65 = f(y, "036"); /* c */ x65 = f(y, "037"); /* c */ x65 = f(y, "038"); /* c */ x65 = f(y, "039"); /* c */ x65 = f(y, "040"); /* c */ x65 = f(y, "041"); /* c */ x65 = f(y, "042"); /* c */ x65 = f(y, "043"); /* c */ x65 = f(y, "044"); /* c */ x65 = f(y, "045"); /* c */ x65 = f(y, "046"); /* c */ x65 = f(y, "047"); /* c */ x65 = f(y, "048"); /* c */ x65 = f(y, "049"); /* c */ x65 = f(y, "050"); /* c */ x65 = f(y, "051"); /* c */ x65 = f(y, "052"); /* c */ x65 = f(y, "053"); /* c */ x65 = f(y, "054"); /* c */ x65 = f(y, "055"); /* c */ x65 = f(y, "056"); /* c */ x65 = f(y, "057"); /* c */ x65 = f(y, "058"); /* c */ x65 = f(y, "059"); /* c */ x65 = f(y, "060"); /* c */ x65 = f(y, "061"); /* c */ x65 = f(y, "062"); /* c */ x65 = f(y, "063"); /* c */ x65 = f(y, "064"); /* c */ x65 = f(y, "065"); /* c */ x65 = f(y, "066"); /* c */ x65 = f(y, "067"); /* c */ x65 = f(y, "068"); /* c */ x65 = f(y, "069"); /* c */ x65 = f(y, "070"); /* c */ x65 = f(y, "071"); /* c */ x65 = f(y, "072"); /* c */ x65 = f(y, "073"); /* c */ x65 = f(y, "074"); /* c */ x65 = f(y, "075"); /* c */ x65 = f(y, "076"); /* c */ x65 = f(y, "077"); /* c */ x65 = f(y, "078"); /* c */ x65 = f(y, "079"); /* c */ x65 = f(y, "080"); /* c */ x65 = f(y, "081"); /* c */ x65 = f(y, "082"); /* c */ x65 = f(y, "083"); /* c */ x65 = f(y, "084"); /* c */ x65 = f(y, "085"); /* c */ x65 = f(y, "086"); /* c */ x65 = f(y, "087"); /* c */ x65 = f(y, "088"); /* c */ x65 = f(y, "089"); /* c */ x65 = f(y, "090"); /* c */ x65 = f(y, "091"); /* c */ x65 = f(y, "092"); /* c */ x65 = f(y, "093"); /* c */ x65 = f(y, "094"); /* c */ x65 = f(y, "095"); /* c */ x65 = f(y, "096"); /* c */ x65 = f(y, "097"); /* c */ x65 = f(y, "098"); /* c */ x65 = f(y, "099"); /* c */ x65 = f(y, "100"); /* c */ x65 = f(y, "101"); /* c */ x65 = f(y, "102"); /* c */ x65 = f(y, "103"); /* c */ x65 = f(y, "104"); /* c */ x65 = f(y, "105"); /* c */ x65 = f(y, "106"); /* c */ x65 = f(y, "107"); /* c */ x65 = f(y, "108"); /* c */ x65 = f(y, "109"); /* c */ x65 = f(y, "110"); /* c */ x65 = f(y, "111"); /* c */ x65 = f(y, "112"); /* c */ x65 = f(y, "113"); /* c */ x65 = f(y, "114"); /* c */ x65 = f(y, "115"); /* c */ x65 = f(y, "116"); /* c */ x65 = f(y, "117"); /* c */ x65 = f(y, "118"); /* c */ x65 = f(y, "119"); /* c */ x65 = f(y, "120"); /* c */ x65 = f(y, "121"); /* c */ x65 = f(y, "122"); /* c */ x65 = f(y, "123"); /* c */ x65 = f(y, "124"); /* c */ x65 = f(y, "125"); /* c */ x65 = f(y, "126"); /* c */ x65 = f(y, "127"); /* c */ x65 = f(y, "128"); /* c */ x65 = f(y, "129"); /* c */ x65 = f(y, "130"); /* c */ x65 = f(y, "131"); /* c */ x65 = f(y, "132"); /* c */ x65 = f(y, "133"); /* c */ x65 = f(y, "134"); /* c */ x65 = f(y, "135"); /* c */ x65 = f(y, "136"); /* c */ x65 = f(y, "137"); /* c */ x65 = f(y, "138"); /* c */ x65 = f(y, "139"); /* c */ x65 = f(y, "140"); /* c */ x65 = f(y, "141"); /* c */ x65 = f(y, "142"); /* c */ x65 = f(y, "143"); /* c */ x65 = f(y, "144"); /* c */ x65 = f(y, "145"); /* c */ x65 = f(y, "146"); /* c */ x65 = f(y, "147"); /* c */ x65 = f(y, "148"); /* c */ x65 = f(y, "149"); /* c */ x65 = f(y, "150"); /* c */ x65 = f(y, "151"); /* c */ x65 = f(y, "152"); /* c */ x65 = f(y, "153"); /* c */ x65 = f(y, "154"); /* c */ x65 = f(y, "155"); /* c */ x65 = f(y, "156"); /* c */ x65 = f(y, "157"); /* c */ x65 = f(y, "158"); /* c */ x65 = f(y, "159"); /* c */ x65 = f(y, "160"); /* c */ x65 = f(y, "161"); /* c */ x65 = f(y, "162"); /* c */ x65 = f(y, "163"); /* c */ x65 = f(y, "164"); /* c */ x65 = f(y, "165"); /* c */ x65 = f(y, "166"); /* c */ x65 = f(y, "167"); /* c */ x65 = f(y, "168"); /* c */ x65 = f(y, "169"); /* c */ x65 = f(y, "170"); /* c */ x65 = f(y, "171"); /* c */ x65 = f(y, "172"); /* c */ x65 = f(y, "173"); /* c */ x65 = f(y, "174"); /* c */ x65 = f(y, "175"); /* c */ x65 = f(y, "176"); /* c */ x65 = f(y, "177"); /* c */ x65 = f(y, "178"); /* c */ x65 = f(y, "179"); /* c */ x65 = f(y, "180"); /* c */ x65 = f(y, "181"); /* c */ x65 = f(y, "182"); /* c */ x65 = f(y, "183"); /* c */ x65 = f(y, "184"); /* c */ x65 = f(y, "185"); /* c */ x65 = f(y, "186"); /* c */ x65 = f(y, "187"); /* c */ x65 = f(y, "188"); /* c */ x65 = f(y, "189"); /* c */ x65 = f(y, "190"); /* c */ x65 = f(y, "191"); /* c */ x65 = f(y, "192"); /* c */ x65 = f(y, "193"); /* c */ x65 = f(y, "194"); /* c */ x65 = f(y, "195"); /* c */ x65 = f(y, "196"); /* c */ x65 = f(y, "197"); /* c */ x65 = f(y, "198"); /* c */ x65 = f(y, "199"); /* c */ 
+x66 = f(y, "000"); /* c */ x66 = f(y, "001"); /* c */ x66 = f(y, "002"); /* c */ x66 = f(y, "003"); /* c */ x66 = f(y, "004"); /* c */ x66 = f(y, "005"); /* c */ x66 = f(y, "006"); /* c */ x66 = f(y, "007"); /* c */ x66 = f(y, "008"); /* c */ x66 = f(y, "009"); /* c */ x66 = f(y, "010"); /* c */ x66 = f(y, "011"); /* c */ x66 = f(y, "012"); /* c */ x66 = f(y, "013"); /* c */ x66 = f(y, "014"); /* c */ x66 = f(y, "015"); /* c */ x66 = f(y, "016"); /* c */ x66 = f(y, "017"); /* c */ x66 = f(y, "018"); /* c */ x66 = f(y, "019"); /* c */ x66 = f(y, "020"); /* c */ x66 = f(y, "021"); /* c */ x66 = f(y, "022"); /* c */ x66 = f(y, "023"); /* c */ x66 = f(y, "024"); /* c */ x66 = f(y, "025"); /* c */ x66 = f(y, "026"); /* c */ x66 = f(y, "027"); /* c */ x66 = f(y, "028"); /* c */ x66 = f(y, "029"); /* c */ x66 = f(y, "030"); /* c */ x66 = f(y, "031"); /* c */ x66 = f(y, "032"); /* c */ x66 = f(y, "033"); /* c */ x66 = f(y, "034"); /* c */ x66 = f(y, "035"); /* c */ x66 = f(y, "036"); /* c */ x66 = f(y, "037"); /* c */ x66 = f(y, "038"); /* c */ x66 = f(y, "039"); /* c */ x66 = f(y, "040"); /* c */ x66 = f(y, "041"); /* c */ x66 = f(y, "042"); /* c */ x66 = f(y, "043"); /* c */ x66 = f(y, "044"); /* c */ x66 = f(y, "045"); /* c */ x66 = f(y, "046"); /* c */ x66 = f(y, "047"); /* c */ x66 = f(y, "048"); /* c */ x66 = f(y, "049"); /* c */ x66 = f(y, "050"); /* c */ x66 = f(y, "051"); /* c */ x66 = f(y, "052"); /* c */ x66 = f(y, "053"); /* c */ x66 = f(y, "054"); /* c */ x66 = f(y, "055"); /* c */ x66 = f(y, "056"); /* c */ x66 = f(y, "057"); /* c */ x66 = f(y, "058"); /* c */ x66 = f(y, "059"); /* c */ x66 = f(y, "060"); /* c */ x66 = f(y, "061"); /* c */ x66 = f(y, "062"); /* c */ x66 = f(y, "063"); /* c */ x66 = f(y, "064"); /* c */ x66 = f(y, "065"); /* c */ x66 = f(y, "066"); /* c */ x66 = f(y, "067"); /* c */ x66 = f(y, "068"); /* c */ x66 = f(y, "069"); /* c */ x66 = f(y, "070"); /* c */ x66 = f(y, "071"); /* c */ x66 = f(y, "072"); /* c */ x66 = f(y, "073"); /* c */ x66 = f(y, "074"); /* c */ x66 = f(y, "075"); /* c */ x66 = f(y, "076"); /* c */ x66 = f(y, "077"); /* c */ x66 = f(y, "078"); /* c */ x66 = f(y, "079"); /* c */ x66 = f(y, "080"); /* c */ x66 = f(y, "081"); /* c */ x66 = f(y, "082"); /* c */ x66 = f(y, "083"); /* c */ x66 = f(y, "084"); /* c */ x66 = f(y, "085"); /* c */ x66 = f(y, "086"); /* c */ x66 = f(y, "087"); /* c */ x66 = f(y, "088"); /* c */ x66 = f(y, "089"); /* c */ x66 = f(y, "090"); /* c */ x66 = f(y, "091"); /* c */ x66 = f(y, "092"); /* c */ x66 = f(y, "093"); /* c */ x66 = f(y, "094"); /* c */ x66 = f(y, "095"); /* c */ x66 = f(y, "096"); /* c */ x66 = f(y, "097"); /* c */ x66 = f(y, "098"); /* c */ x66 = f(y, "099"); /* c */ x66 = f(y, "100"); /* c */ x66 = f(y, "101"); /* c */ x66 = f(y, "102"); /* c */ x66 = f(y, "103"); /* c */ x66 = f(y, "104"); /* c */ x66 = f(y, "105"); /* c */ x66 = f(y, "106"); /* c */ x66 = f(y, "107"); /* c */ x66 = f(y, "108"); /* c */ x66 = f(y, "109"); /* c */ x66 = f(y, "110"); /* c */ x66 = f(y, "111"); /* c */ x66 = f(y, "112"); /* c */ x66 = f(y, "113"); /* c */ x66 = f(y, "114"); /* c */ x66 = f(y, "115"); /* c */ x66 = f(y, "116"); /* c */ x66 = f(y, "117"); /* c */ x66 = f(y, "118"); /* c */ x66 = f(y, "119"); /* c */ x66 = f(y, "120"); /* c */ x66 = f(y, "121"); /* c */ x66 = f(y, "122"); /* c */ x66 = f(y, "123"); /* c */ x66 = f(y, "124"); /* c */ x66 = f(y, "125"); /* c */ x66 = f(y, "126"); /* c */ x66 = f(y, "127"); /* c */ x66 = f(y, "128"); /* c */ x66 = f(y, "129"); /* c */ x66 = f(y, "130"); /* c */ x66 = f(y, "131"); /* c */ x66 = f(y, "132"); /* c */ x66 = f(y, "133"); /* c */ x66 = f(y, "134"); /* c */ x66 = f(y, "135"); /* c */ x66 = f(y, "136"); /* c */ x66 = f(y, "137"); /* c */ x66 = f(y, "138"); /* c */ x66 = f(y, "139"); /* c */ x66 = f(y, "140"); /* c */ x66 = f(y, "141"); /* c */ x66 = f(y, "142"); /* c */ x66 = f(y, "143"); /* c */ x66 = f(y, "144"); /* c */ x66 = f(y, "145"); /* c */ x66 = f(y, "146"); /* c */ x66 = f(y, "147"); /* c */ x66 = f(y, "148"); /* c */ x66 = f(y, "149"); /* c */ x66 = f(y, "150"); /* c */ x66 = f(y, "151"); /* c */ x66 = f(y, "152"); /* c */ x66 = f(y, "153"); /* c */ x66 = f(y, "154"); /* c */ x66 = f(y, "155"); /* c */ x66 = f(y, "156"); /* c */ x66 = f(y, "157"); /* c */ x66 = f(y, "158"); /* c */ x66 = f(y, "159"); /* c */ x66 = f(y, "160"); /* c */ x66 = f(y, "161"); /* c */ x66 = f(y, "162"); /* c */ x66 = f(y, "163"); /* c */ x66 = f(y, "164"); /* c */ x66 = f(y, "165"); /* c */ x66 = f(y, "166"); /* c */ x66 = f(y, "167"); /* c */ x66 = f(y, "168"); /* c */ x66 = f(y, "169"); /* c */ x66 = f(y, "170"); /* c */ x66 = f(y, "171"); /* c */ x66 = f(y, "172"); /* c */ x66 = f(y, "173"); /* c */ x66 = f(y, "174"); /* c */ x66 = f(y, "175"); /* c */ x66 = f(y, "176"); /* c */ x66 = f(y, "177"); /* c */ x66 = f(y, "178"); /* c */ x66 = f(y, "179"); /* c */ x66 = f(y, "180"); /* c */ x66 = f(y, "181"); /* c */ x66 = f(y, "182"); /* c */ x66 = f(y, "183"); /* c */ x66 = f(y, "184"); /* c */ x66 = f(y, "185"); /* c */ x66 = f(y, "186"); /* c */ x66 = f(y, "187"); /* c */ x66 = f(y, "188"); /* c */ x66 = f(y, "189"); /* c */ x66 = f(y, "190"); /* c */ x66 = f(y, "191"); /* c */ x66 = f(y, "192"); /* c */ x66 = f(y, "193"); /* c */ x66 = f(y, "194"); /* c */ x66 = f(y, "195"); /* c */ x66 = f(y, "196"); /* c */ x66 = f(y, "197"); /* c */ x66 = f(y, "198"); /* c */ x66 = f(y, "199"); /* c */ 
+x67 = f(y, "000"); /* c */ x67 = f(y, "001"); /* c */ x67 = f(y, "002"); /* c */ x67 = f(y, "003"); /* c */ x67 = f(y, "004"); /* c */ x67 = f(y, "005"); /* c */ x67 = f(y, "006"); /* c */ x67 = f(y, "007"); /* c */ x67 = f(y, "008"); /* c */ x67 = f(y, "009"); /* c */ x67 = f(y, "010"); /* c */ x67 = f(y, "011"); /* c */ x67 = f(y, "012"); /* c */ x67 = f(y, "013"); /* c */ x67 = f(y, "014"); /* c */ x67 = f(y, "015"); /* c */ x67 = f(y, "016"); /* c */ x67 = f(y, "017"); /* c */ x67 = f(y, "018"); /* c */ x67 = f(y, "019"); /* c */ x67 = f(y, "020"); /* c */ x67 = f(y, "021"); /* c */ x67 = f(y, "022"); /* c */ x67 = f(y, "023"); /* c */ x67 = f(y, "024"); /* c */ x67 = f(y, "025"); /* c */ x67 = f(y, "026"); /* c */ x67 = f(y, "027"); /* c */ x67 = f(y, "028"); /* c */ x67 = f(y, "029"); /* c */ x67 = f(y, "030"); /* c */ x67 = f(y, "031"); /* c */ x67 = f(y, "032"); /* c */ x67 = f(y, "033"); /* c */ x67 = f(y, "034"); /* c */ x67 = f(y, "035"); /* c */ x67 = f(y, "036"); /* c */ x67 = f(y, "037"); /* c */ x67 = f(y, "038"); /* c */ x67 = f(y, "039"); /* c */ x67 = f(y, "040"); /* c */ x67 = f(y, "041"); /* c */ x67 = f(y, "042"); /* c */ x67 = f(y, "043"); /* c */ x67 = f(y, "044"); /* c */ x67 = f(y, "045"); /* c */ x67 = f(y, "046"); /* c */ x67 = f(y, "047"); /* c */ x67 = f(y, "048"); /* c */ x67 = f(y, "049"); /* c */ x67 = f(y, "050"); /* c */ x67 = f(y, "051"); /* c */ x67 = f(y, "052"); /* c */ x67 = f(y, "053"); /* c */ x67 = f(y, "054"); /* c */ x67 = f(y, "055"); /* c */ x67 = f(y, "056"); /* c */ x67 = f(y, "057"); /* c */ x67 = f(y, "058"); /* c */ x67 = f(y, "059"); /* c */ x67 = f(y, "060"); /* c */ x67 = f(y, "061"); /* c */ x67 = f(y, "062"); /* c */ x67 = f(y, "063"); /* c */ x67 = f(y, "064"); /* c */ x67 = f(y, "065"); /* c */ x67 = f(y, "066"); /* c */ x67 = f(y, "067"); /* c */ x67 = f(y, "068"); /* c */ x67 = f(y, "069"); /* c */ x67 = f(y, "070"); /* c */ x67 = f(y, "071"); /* c */ x67 = f(y, "072"); /* c */ x67 = f(y, "073"); /* c */ x67 = f(y, "074"); /* c */ x67 = f(y, "075"); /* c */ x67 = f(y, "076"); /* c */ x67 = f(y, "077"); /* c */ x67 = f(y, "078"); /* c */ x67 = f(y, "079"); /* c */ x67 = f(y, "080"); /* c */ x67 = f(y, "081"); /* c */ x67 = f(y, "082"); /* c */ x67 = f(y, "083"); /* c */ x67 = f(y, "084"); /* c */ x67 = f(y, "085"); /* c */ x67 = f(y, "086"); /* c */ x67 = f(y, "087"); /* c */ x67 = f(y, "088"); /* c */ x67 = f(y, "089"); /* c */ x67 = f(y, "090"); /* c */ x67 = f(y, "091"); /* c */ x67 = f(y, "092"); /* c */ x67 = f(y, "093"); /* c */ x67 = f(y, "094"); /* c */ x67 = f(y, "095"); /* c */ x67 = f(y, "096"); /* c */ x67 = f(y, "097"); /* c */ x67 = f(y, "098"); /* c */ x67 = f(y, "099"); /* c */ x67 = f(y, "100"); /* c */ x67 = f(y, "101"); /* c */ x67 = f(y, "102"); /* c */ x67 = f(y, "103"); /* c */ x67 = f(y, "104"); /* c */ x67 = f(y, "105"); /* c */ x67 = f(y, "106"); /* c */ x67 = f(y, "107"); /* c */ x67 = f(y, "108"); /* c */ x67 = f(y, "109"); /* c */ x67 = f(y, "110"); /* c */ x67 = f(y, "111"); /* c */ x67 = f(y, "112"); /* c */ x67 = f(y, "113"); /* c */ x67 = f(y, "114"); /* c */ x67 = f(y, "115"); /* c */ x67 = f(y, "116"); /* c */ x67 = f(y, "117"); /* c */ x67 = f(y, "118"); /* c */ x67 = f(y, "119"); /* c */ x67 = f(y, "120"); /* c */ x67 = f(y, "121"); /* c */ x67 = f(y, "122"); /* c */ x67 = f(y, "123"); /* c */ x67 = f(y, "124"); /* c */ x67 = f(y, "125"); /* c */ x67 = f(y, "126"); /* c */ x67 = f(y, "127"); /* c */ x67 = f(y, "128"); /* c */ x67 = f(y, "129"); /* c */ x67 = f(y, "130"); /* c */ x67 = f(y, "131"); /* c */ x67 = f(y, "132"); /* c */ x67 = f(y, "133"); /* c */ x67 = f(y, "134"); /* c */ x67 = f(y, "135"); /* c */ x67 = f(y, "136"); /* c */ x67 = f(y, "137"); /* c */ x67 = f(y, "138"); /* c */ x67 = f(y, "139"); /* c */ x67 = f(y, "140"); /* c */ x67 = f(y, "141"); /* c */ x67 = f(y, "142"); /* c */ x67 = f(y, "143"); /* c */ x67 = f(y, "144"); /* c */ x67 = f(y, "145"); /* c */ x67 = f(y, "146"); /* c */ x67 = f(y, "147"); /* c */ x67 = f(y, "148"); /* c */ x67 = f(y, "149"); /* c */ x67 = f(y, "150"); /* c */ x67 = f(y, "151"); /* c */ x67 = f(y, "152"); /* c */ x67 = f(y, "153"); /* c */ x67 = f(y, "154"); /* c */ x67 = f(y, "155"); /* c */ x67 = f(y, "156"); /* c */ x67 = f(y, "157"); /* c */ x67 = f(y, "158"); /* c */ x67 = f(y, "159"); /* c */ x67 = f(y, "160"); /* c */ x67 = f(y, "161"); /* c */ x67 = f(y, "162"); /* c */ x67 = f(y, "163"); /* c */ x67 = f(y, "164"); /* c */ x67 = f(y, "165"); /* c */ x67 = f(y, "166"); /* c */ x67 = f(y, "167"); /* c */ x67 = f(y, "168"); /* c */ x67 = f(y, "169"); /* c */ x67 = f(y, "170"); /* c */ x67 = f(y, "171"); /* c */ x67 = f(y, "172"); /* c */ x67 = f(y, "173"); /* c */ x67 = f(y, "174"); /* c */ x67 = f(y, "175"); /* c */ x67 = f(y, "176"); /* c */ x67 = f(y, "177"); /* c */ x67 = f(y, "178"); /* c */ x67 = f(y, "179"); /* c */ x67 = f(y, "180"); /* c */ x67 = f(y, "181"); /* c */ x67 = f(y, "182"); /* c */ x67 = f(y, "183"); /* c */ x67 = f(y, "184"); /* c */ x67 = f(y, "185"); /* c */ x67 = f(y, "186"); /* c */ x67 = f(y, "187"); /* c */ x67 = f(y, "188"); /* c */ x67 = f(y, "189"); /* c */ x67 = f(y, "190"); /* c */ x67 = f(y, "191"); /* c */ x67 = f(y, "192"); /* c */ x67 = f(y, "193"); /* c */ x67 = f(y, "194"); /* c */ x67 = f(y, "195"); /* c */ x67 = f(y, "196"); /* c */ x67 = f(y, "197"); /* c */ x67 = f(y, "198"); /* c */ x67 = f(y, "199"); /* c */ 
+x68 = f(y, "000"); /* c */ x68 = f(y, "001"); /* c */ x68 = f(y, "002"); /* c */ x68 = f(y, "003"); /* c */ x68 = f(y, "004"); /* c */ x68 = f(y, "005"); /* c */ x68 = f(y, "006"); /* c */ x68 = f(y, "007"); /* c */ x68 = f(y, "008"); /* c */ x68 = f(y, "009"); /* c */ x68 = f(y, "010"); /* c */ x68 = f(y, "011"); /* c */ x68 = f(y, "012"); /* c */ x68 = f(y, "013"); /* c */ x68 = f(y, "014"); /* c */ x68 = f(y, "015"); /* c */ x68 = f(y, "016"); /* c */ x68 = f(y, "017"); /* c */ x68 = f(y, "018"); /* c */ x68 = f(y, "019"); /* c */ x68 = f(y, "020"); /* c */ x68 = f(y, "021"); /* c */ x68 = f(y, "022"); /* c */ x68 = f(y, "023"); /* c */ x68 = f(y, "024"); /* c */ x68 = f(y, "025"); /* c */ x68 = f(y, "026"); /* c */ x68 = f(y, "027"); /* c */ x68 = f(y, "028"); /* c */ x68 = f(y, "029"); /* c */ x68 = f(y, "030"); /* c */ x68 = f(y, "031"); /* c */ x68 = f(y, "032"); /* c */ x68 = f(y, "033"); /* c */ x68 = f(y, "034"); /* c */ x68 = f(y, "035"); /* c */ x68 = f(y, "036"); /* c */ x68 = f(y, "037"); /* c */ x68 = f(y, "038"); /* c */ x68 = f(y, "039"); /* c */ x68 = f(y, "040"); /* c */ x68 = f(y, "041"); /* c */ x68 = f(y, "042"); /* c */ x68 = f(y, "043"); /* c */ x68 = f(y, "044"); /* c */ x68 = f(y, "045"); /* c */ x68 = f(y, "046"); /* c */ x68 = f(y, "047"); /* c */ x68 = f(y, "048"); /* c */ x68 = f(y, "049"); /* c */ x68 = f(y, "050"); /* c */ x68 = f(y, "051"); /* c */ x68 = f(y, "052"); /* c */ x68 = f(y, "053"); /* c */ x68 = f(y, "054"); /* c */ x68 = f(y, "055"); /* c */ x68 = f(y, "056"); /* c */ x68 = f(y, "057"); /* c */ x68 = f(y, "058"); /* c */ x68 = f(y, "059"); /* c */ x68 = f(y, "060"); /* c */ x68 = f(y, "061"); /* c */ x68 = f(y, "062"); /* c */ x68 = f(y, "063"); /* c */ x68 = f(y, "064"); /* c */ x68 = f(y, "065"); /* c */ x68 = f(y, "066"); /* c */ x68 = f(y, "067"); /* c */ x68 = f(y, "068"); /* c */ x68 = f(y, "069"); /* c */ x68 = f(y, "070"); /* c */ x68 = f(y, "071"); /* c */ x68 = f(y, "072"); /* c */ x68 = f(y, "073"); /* c */ x68 = f(y, "074"); /* c */ x68 = f(y, "075"); /* c */ x68 = f(y, "076"); /* c */ x68 = f(y, "077"); /* c */ x68 = f(y, "078"); /* c */ x68 = f(y, "079"); /* c */ x68 = f(y, "080"); /* c */ x68 = f(y, "081"); /* c */ x68 = f(y, "082"); /* c */ x68 = f(y, "083"); /* c */ x68 = f(y, "084"); /* c */ x68 = f(y, "085"); /* c */ x68 = f(y, "086"); /* c */ x68 = f(y, "087"); /* c */ x68 = f(y, "088"); /* c */ x68 = f(y, "089"); /* c */ x68 = f(y, "090"); /* c */ x68 = f(y, "091"); /* c */ x68 = f(y, "092"); /* c */ x68 = f(y, "093"); /* c */ x68 = f(y, "094"); /* c */ x68 = f(y, "095"); /* c */ x68 = f(y, "096"); /* c */ x68 = f(y, "097"); /* c */ x68 = f(y, "098"); /* c */ x68 = f(y, "099"); /* c */ x68 = f(y, "100"); /* c */ x68 = f(y, "101"); /* c */ x68 = f(y, "102"); /* c */ x68 = f(y, "103"); /* c */ x68 = f(y, "104"); /* c */ x68 = f(y, "105"); /* c */ x68 = f(y, "106"); /* c */ x68 = f(y, "107"); /* c */ x68 = f(y, "108"); /* c */ x68 = f(y, "109"); /* c */ x68 = f(y, "110"); /* c */ x68 = f(y, "111"); /* c */ x68 = f(y, "112"); /* c */ x68 = f(y, "113"); /* c */ x68 = f(y, "114"); /* c */ x68 = f(y, "115"); /* c */ x68 = f(y, "116"); /* c */ x68 = f(y, "117"); /* c */ x68 = f(y, "118"); /* c */ x68 = f(y, "119"); /* c */ x68 = f(y, "120"); /* c */ x68 = f(y, "121"); /* c */ x68 = f(y, "122"); /* c */ x68 = f(y, "123"); /* c */ x68 = f(y, "124"); /* c */ x68 = f(y, "125"); /* c */ x68 = f(y, "126"); /* c */ x68 = f(y, "127"); /* c */ x68 = f(y, "128"); /* c */ x68 = f(y, "129"); /* c */ x68 = f(y, "130"); /* c */ x68 = f(y, "131"); /* c */ x68 = f(y, "132"); /* c */ x68 = f(y, "133"); /* c */ x68 = f(y, "134"); /* c */ x68 = f(y, "135"); /* c */ x68 = f(y, "136"); /* c */ x68 = f(y, "137"); /* c */ x68 = f(y, "138"); /* c */ x68 = f(y, "139"); /* c */ x68 = f(y, "140"); /* c */ x68 = f(y, "141"); /* c */ x68 = f(y, "142"); /* c */ x68 = f(y, "143"); /* c */ x68 = f(y, "144"); /* c */ x68 = f(y, "145"); /* c */ x68 = f(y, "146"); /* c */ x68 = f(y, "147"); /* c */ x68 = f(y, "148"); /* c */ x68 = f(y, "149"); /* c */ x68 = f(y, "150"); /* c */ x68 = f(y, "151"); /* c */ x68 = f(y, "152"); /* c */ x68 = f(y, "153"); /* c */ x68 = f(y, "154"); /* c */ x68 = f(y, "155"); /* c */ x68 = f(y, "156"); /* c */ x68 = f(y, "157"); /* c */ x68 = f(y, "158"); /* c */ x68 = f(y, "159"); /* c */ x68 = f(y, "160"); /* c */ x68 = f(y, "161"); /* c */ x68 = f(y, "162"); /* c */ x68 = f(y, "163"); /* c */ x68 = f(y, "164"); /* c */ x68 = f(y, "165"); /* c */ x68 = f(y, "166"); /* c */ x68 = f(y, "167"); /* c */ x68 = f(y, "168"); /* c */ x68 = f(y, "169"); /* c */ x68 = f(y, "170"); /* c */ x68 = f(y, "171"); /* c */ x68 = f(y, "172"); /* c */ x68 = f(y, "173"); /* c */ x68 = f(y, "174"); /* c */ x68 = f(y, "175"); /* c */ x68 = f(y, "176"); /* c */ x68 = f(y, "177"); /* c */ x68 = f(y, "178"); /* c */ x68 = f(y, "179"); /* c */ x68 = f(y, "180"); /* c */ x68 = f(y, "181"); /* c */ x68 = f(y, "182"); /* c */ x68 = f(y, "183"); /* c */ x68 = f(y, "184"); /* c */ x68 = f(y, "185"); /* c */ x68 = f(y, "186"); /* c */ x68 = f(y, "187"); /* c */ x68 = f(y, "188"); /* c */ x68 = f(y, "189"); /* c */ x68 = f(y, "190"); /* c */ x68 = f(y, "191"); /* c */ x68 = f(y, "192"); /* c */ x68 = f(y, "193"); /* c */ x68 = f(y, "194"); /* c */ x68 = f(y, "195"); /* c */ x68 = f(y, "196"); /* c */ x68 = f(y, "197"); /* c */ x68 = f(y, "198"); /* c */ x68 = f(y, "199"); /* c */ 
+x69 = f(y, "000"); /* c */ x69 = f(y, "001"); /* c */ x69 = f(y, "002"); /* c */ x69 = f(y, "003"); /* c */ x69 = f(y, "004"); /* c */ x69 = f(y, "005"); /* c */ x69 = f(y, "006"); /* c */ x69 = f(y, "007"); /* c */ x69 = f(y, "008"); /* c */ x69 = f(y, "009"); /* c */ x69 = f(y, "010"); /* c */ x69 = f(y, "011"); /* c */ x69 = f(y, "012"); /* c */ x69 = f(y, "013"); /* c */ x69 = f(y, "014"); /* c */ x69 = f(y, "015"); /* c */ x69 = f(y, "016"); /* c */ x69 = f(y, "017"); /* c */ x69 = f(y, "018"); /* c */ x69 = f(y, "019"); /* c */ x69 = f(y, "020"); /* c */ x69 = f(y, "021"); /* c */ x69 = f(y, "022"); /* c */ x69 = f(y, "023"); /* c */ x69 = f(y, "024"); /* c */ x69 = f(y, "025"); /* c */ x69 = f(y, "026"); /* c */ x69 = f(y, "027"); /* c */ x69 = f(y, "028"); /* c */ x69 = f(y, "029"); /* c */ x69 = f(y, "030"); /* c */ x69 = f(y, "031"); /* c */ x69 = f(y, "032"); /* c */ x69 = f(y, "033"); /* c */ x69 = f(y, "034"); /* c */ x69 = f(y, "035"); /* c */ x69 = f(y, "036"); /* c */ x69 = f(y, "037"); /* c */ x69 = f(y, "038"); /* c */ x69 = f(y, "039"); /* c */ x69 = f(y, "040"); /* c */ x69 = f(y, "041"); /* c */ x69 = f(y, "042"); /* c */ x69 = f(y, "043"); /* c */ x69 = f(y, "044"); /* c */ x69 = f(y, "045"); /* c */ x69 = f(y, "046"); /* c */ x69 = f(y, "047"); /* c */ x69 = f(y, "048"); /* c */ x69 = f(y, "049"); /* c */ x69 = f(y, "050"); /* c */ x69 = f(y, "051"); /* c */ x69 = f(y, "052"); /* c */ x69 = f(y, "053"); /* c */ x69 = f(y, "054"); /* c */ x69 = f(y, "055"); /* c */ x69 = f(y, "056"); /* c */ x69 = f(y, "057"); /* c */ x69 = f(y, "058"); /* c */ x69 = f(y, "059"); /* c */ x69 = f(y, "060"); /* c */ x69 = f(y, "061"); /* c */ x69 = f(y, "062"); /* c */ x69 = f(y, "063"); /* c */ x69 = f(y, "064"); /* c */ x69 = f(y, "065"); /* c */ x69 = f(y, "066"); /* c */ x69 = f(y, "067"); /* c */ x69 = f(y, "068"); /* c */ x69 = f(y, "069"); /* c */ x69 = f(y, "070"); /* c */ x69 = f(y, "071"); /* c */ x69 = f(y, "072"); /* c */ x69 = f(y, "073"); /* c */ x69 = f(y, "074"); /* c */ x69 = f(y, "075"); /* c */ x69 = f(y, "076"); /* c */ x69 = f(y, "077"); /* c */ x69 = f(y, "078"); /* c */ x69 = f(y, "079"); /* c */ x69 = f(y, "080"); /* c */ x69 = f(y, "081"); /* c */ x69 = f(y, "082"); /* c */ x69 = f(y, "083"); /* c */ x69 = f(y, "084"); /* c */ x69 = f(y, "085"); /* c */ x69 = f(y, "086"); /* c */ x69 = f(y, "087"); /* c */ x69 = f(y, "088"); /* c */ x69 = f(y, "089"); /* c */ x69 = f(y, "090"); /* c */ x69 = f(y, "091"); /* c */ x69 = f(y, "092"); /* c */ x69 = f(y, "093"); /* c */ x69 = f(y, "094"); /* c */ x69 = f(y, "095"); /* c */ x69 = f(y, "096"); /* c */ x69 = f(y, "097"); /* c */ x69 = f(y, "098"); /* c */ x69 = f(y, "099"); /* c */ x69 = f(y, "100"); /* c */ x69 = f(y, "101"); /* c */ x69 = f(y, "102"); /* c */ x69 = f(y, "103"); /* c */ x69 = f(y, "104"); /* c */ x69 = f(y, "105"); /* c */ x69 = f(y, "106"); /* c */ x69 = f(y, "107"); /* c */ x69 = f(y, "108"); /* c */ x69 = f(y, "109"); /* c */ x69 = f(y, "110"); /* c */ x69 = f(y, "111"); /* c */ x69 = f(y, "112"); /* c */ x69 = f(y, "113"); /* c */ x69 = f(y, "114"); /* c */ x69 = f(y, "115"); /* c */ x69 = f(y, "116"); /* c */ x69 = f(y, "117"); /* c */ x69 = f(y, "118"); /* c */ x69 = f(y, "119"); /* c */ x69 = f(y, "120"); /* c */ x69 = f(y, "121"); /* c */ x69 = f(y, "122"); /* c */ x69 = f(y, "123"); /* c */ x69 = f(y, "124"); /* c */ x69 = f(y, "125"); /* c */ x69 = f(y, "126"); /* c */ x69 = f(y, "127"); /* c */ x69 = f(y, "128"); /* c */ x69 = f(y, "129"); /* c */ x69 = f(y, "130"); /* c */ x69 = f(y, "131"); /* c */ x69 = f(y, "132"); /* c */ x69 = f(y, "133"); /* c */ x69 = f(y, "134"); /* c */ x69 = f(y, "135"); /* c */ x69 = f(y, "136"); /* c */ x69 = f(y, "137"); /* c */ x69 = f(y, "138"); /* c */ x69 = f(y, "139"); /* c */ x69 = f(y, "140"); /* c */ x69 = f(y, "141"); /* c */ x69 = f(y, "142"); /* c */ x69 = f(y, "143"); /* c */ x69 = f(y, "144"); /* c */ x69 = f(y, "145"); /* c */ x69 = f(y, "146"); /* c */ x69 = f(y, "147"); /* c */ x69 = f(y, "148"); /* c */ x69 = f(y, "149"); /* c */ x69 = f(y, "150"); /* c */ x69 = f(y, "151"); /* c */ x69 = f(y, "152"); /* c */ x69 = f(y, "153"); /* c */ x69 = f(y, "154"); /* c */ x69 = f(y, "155"); /* c */ x69 = f(y, "156"); /* c */ x69 = f(y, "157"); /* c */ x69 = f(y, "158"); /* c */ x69 = f(y, "159"); /* c */ x69 = f(y, "160"); /* c */ x69 = f(y, "161"); /* c */ x69 = f(y, "162"); /* c */ x69 = f(y, "163"); /* c */ x69 = f(y, "164"); /* c */ x69 = f(y, "165"); /* c */ x69 = f(y, "166"); /* c */ x69 = f(y, "167"); /* c */ x69 = f(y, "168"); /* c */ x69 = f(y, "169"); /* c */ x69 = f(y, "170"); /* c */ x69 = f(y, "171"); /* c */ x69 = f(y, "172"); /* c */ x69 = f(y, "173"); /* c */ x69 = f(y, "174"); /* c */ x69 = f(y, "175"); /* c */ x69 = f(y, "176"); /* c */ x69 = f(y, "177"); /* c */ x69 = f(y, "178"); /* c */ x69 = f(y, "179"); /* c */ x69 = f(y, "180"); /* c */ x69 = f(y, "181"); /* c */ x69 = f(y, "182"); /* c */ x69 = f(y, "183"); /* c */ x69 = f(y, "184"); /* c */ x69 = f(y, "185"); /* c */ x69 = f(y, "186"); /* c */ x69 = f(y, "187"); /* c */ x69 = f(y, "188"); /* c */ x69 = f(y, "189"); /* c */ x69 = f(y, "190"); /* c */ x69 = f(y, "191"); /* c */ x69 = f(y, "192"); /* c */ x69 = f(y, "193"); /* c */ x69 = f(y, "194"); /* c */ x69 = f(y, "195"); /* c */ x69 = f(y, "196"); /* c */ x69 = f(y, "197"); /* c */ x69 = f(y, "198"); /* c */ x69 = f(y, "199"); /* c */ 
+x70 = f(y, "000"); /* c */ x70 = f(y, "001"); /* c */ x70 = f(y, "002"); /* c */ x70 = f(y, "003"); /* c */ x70 = f(y, "004"); /* c */ x70 = f(y, "005"); /* c */ x70 = f(y, "006"); /* c */ x70 = f(y, "007"); /* c */ x70 = f(y, "008"); /* c */ x70 = f(y, "009"); /* c */ x70 = f(y, "010"); /* c */ x70 = f(y, "011"); /* c */ x70 = f(y, "012"); /* c */ x70 = f(y, "013"); /* c */ x70 = f(y, "014"); /* c */ x70 = f(y, "015"); /* c */ x70 = f(y, "016"); /* c */ x70 = f(y, "017"); /* c */ x70 = f(y, "018"); /* c */ x70 = f(y, "019"); /* c */ x70 = f(y, "020"); /* c */ x70 = f(y, "021"); /* c */ x70 = f(y, "022"); /* c */ x70 = f(y, "023"); /* c */ x70 = f(y, "024"); /* c */ x70 = f(y, "025"); /* c */ x70 = f(y, "026"); /* c */ x70 = f(y, "027"); /* c */ x70 = f(y, "028"); /* c */ x70 = f(y, "029"); /* c */ x70 = f(y, "030"); /* c */ x70 = f(y, "031"); /* c */ x70 = f(y, "032"); /* c */ x70 = f(y, "033"); /* c */ x70 = f(y, "034"); /* c */ x70 = f(y, "035"); /* c */ x70 = f(y, "036"); /* c */ x70 = f(y, "037"); /* c */ x70 = f(y, "038"); /* c */ x70 = f(y, "039"); /* c */ x70 = f(y, "040"); /* c */ x70 = f(y, "041"); /* c */ x70 = f(y, "042"); /* c */ x70 = f(y, "043"); /* c */ x70 = f(y, "044"); /* c */ x70 = f(y, "045"); /* c */ x70 = f(y, "046"); /* c */ x70 = f(y, "047"); /* c */ x70 = f(y, "048"); /* c */ x70 = f(y, "049"); /* c */ x70 = f(y, "050"); /* c */ x70 = f(y, "051"); /* c */ x70 = f(y, "052"); /* c */ x70 = f(y, "053"); /* c */ x70 = f(y, "054"); /* c */ x70 = f(y, "055"); /* c */ x70 = f(y, "056"); /* c */ x70 = f(y, "057"); /* c */ x70 = f(y, "058"); /* c */ x70 = f(y, "059"); /* c */ x70 = f(y, "060"); /* c */ x70 = f(y, "061"); /* c */ x70 = f(y, "062"); /* c */ x70 = f(y, "063"); /* c */ x70 = f(y, "064"); /* c */ x70 = f(y, "065"); /* c */ x70 = f(y, "066"); /* c */ x70 = f(y, "067"); /* c */ x70 = f(y, "068"); /* c */ x70 = f(y, "069"); /* c */ x70 = f(y, "070"); /* c */ x70 = f(y, "071"); /* c */ x70 = f(y, "072"); /* c */ x70 = f(y, "073"); /* c */ x70 = f(y, "074"); /* c */ x70 = f(y, "075"); /* c */ x70 = f(y, "076"); /* c */ x70 = f(y, "077"); /* c */ x70 = f(y, "078"); /* c */ x70 = f(y, "079"); /* c */ x70 = f(y, "080"); /* c */ x70 = f(y, "081"); /* c */ x70 = f(y, "082"); /* c */ x70 = f(y, "083"); /* c */ x70 = f(y, "084"); /* c */ x70 = f(y, "085"); /* c */ x70 = f(y, "086"); /* c */ x70 = f(y, "087"); /* c */ x70 = f(y, "088"); /* c */ x70 = f(y, "089"); /* c */ x70 = f(y, "090"); /* c */ x70 = f(y, "091"); /* c */ x70 = f(y, "092"); /* c */ x70 = f(y, "093"); /* c */ x70 = f(y, "094"); /* c */ x70 = f(y, "095"); /* c */ x70 = f(y, "096"); /* c */ x70 = f(y, "097"); /* c */ x70 = f(y, "098"); /* c */ x70 = f(y, "099"); /* c */ x70 = f(y, "100"); /* c */ x70 = f(y, "101"); /* c */ x70 = f(y, "102"); /* c */ x70 = f(y, "103"); /* c */ x70 = f(y, "104"); /* c */ x70 = f(y, "105"); /* c */ x70 = f(y, "106"); /* c */ x70 = f(y, "107"); /* c */ x70 = f(y, "108"); /* c */ x70 = f(y, "109"); /* c */ x70 = f(y, "110"); /* c */ x70 = f(y, "111"); /* c */ x70 = f(y, "112"); /* c */ x70 = f(y, "113"); /* c */ x70 = f(y, "114"); /* c */ x70 = f(y, "115"); /* c */ x70 = f(y, "116"); /* c */ x70 = f(y, "117"); /* c */ x70 = f(y, "118"); /* c */ x70 = f(y, "119"); /* c */ x70 = f(y, "120"); /* c */ x70 = f(y, "121"); /* c */ x70 = f(y, "122"); /* c */ x70 = f(y, "123"); /* c */ x70 = f(y, "124"); /* c */ x70 = f(y, "125"); /* c */ x70 = f(y, "126"); /* c */ x70 = f(y, "127"); /* c */ x70 = f(y, "128"); /* c */ x70 = f(y, "129"); /* c */ x70 = f(y, "130"); /* c */ x70 = f(y, "131"); /* c */ x70 = f(y, "132"); /* c */ x70 = f(y, "133"); /* c */ x70 = f(y, "134"); /* c */ x70 = f(y, "135"); /* c */ x70 = f(y, "136"); /* c */ x70 = f(y, "137"); /* c */ x70 = f(y, "138"); /* c */ x70 = f(y, "139"); /* c */ x70 = f(y, "140"); /* c */ x70 = f(y, "141"); /* c */ x70 = f(y, "142"); /* c */ x70 = f(y, "143"); /* c */ x70 = f(y, "144"); /* c */ x70 = f(y, "145"); /* c */ x70 = f(y, "146"); /* c */ x70 = f(y, "147"); /* c */ x70 = f(y, "148"); /* c */ x70 = f(y, "149"); /* c */ x70 = f(y, "150"); /* c */ x70 = f(y, "151"); /* c */ x70 = f(y, "152"); /* c */ x70 = f(y, "153"); /* c */ x70 = f(y, "154"); /* c */ x70 = f(y, "155"); /* c */ x70 = f(y, "156"); /* c */ x70 = f(y, "157"); /* c */ x70 = f(y, "158"); /* c */ x70 = f(y, "159"); /* c */ x70 = f(y, "160"); /* c */ x70 = f(y, "161"); /* c */ x70 = f(y, "162"); /* c */ x70 = f(y, "163"); /* c */ x70 = f(y, "164"); /* c */ x70 = f(y, "165"); /* c */ x70 = f(y, "166"); /* c */ x70 = f(y, "167"); /* c */ x70 = f(y, "168"); /* c */ x70 = f(y, "169"); /* c */ x70 = f(y, "170"); /* c */ x70 = f(y, "171"); /* c */ x70 = f(y, "172"); /* c */ x70 = f(y, "173"); /* c */ x70 = f(y, "174"); /* c */ x70 = f(y, "175"); /* c */ x70 = f(y, "176"); /* c */ x70 = f(y, "177"); /* c */ x70 = f(y, "178"); /* c */ x70 = f(y, "179"); /* c */ x70 = f(y, "180"); /* c */ x70 = f(y, "181"); /* c */ x70 = f(y, "182"); /* c */ x70 = f(y, "183"); /* c */ x70 = f(y, "184"); /* c */ x70 = f(y, "185"); /* c */ x70 = f(y, "186"); /* c */ x70 = f(y, "187"); /* c */ x70 = f(y, "188"); /* c */ x70 = f(y, "189"); /* c */ x70 = f(y, "190"); /* c */ x70 = f(y, "191"); /* c */ x70 = f(y, "192"); /* c */ x70 = f(y, "193"); /* c */ x70 = f(y, "194"); /* c */ x70 = f(y, "195"); /* c */ x70 = f(y, "196"); /* c */ x70 = f(y, "197"); /* c */ x70 = f(y, "198"); /* c */ x70 = f(y, "199"); /* c */ 
+x71 = f(y, "000"); /* c */ x71 = f(y, "001"); /* c */ x71 = f(y, "002"); /* c */ x71 = f(y, "003"); /* c */ x71 = f(y, "004"); /* c */ x71 = f(y, "005"); /* c */ x71 = f(y, "006"); /* c */ x71 = f(y, "007"); /* c */ x71 = f(y, "008"); /* c */ x71 = f(y, "009"); /* c */ x71 = f(y, "010"); /* c */ x71 = f(y, "011"); /* c */ x71 = f(y, "012"); /* c */ x71 = f(y, "013"); /* c */ x71 = f(y, "014"); /* c */ x71 = f(y, "015"); /* c */ x71 = f(y, "016"); /* c */ x71 = f(y, "017"); /* c */ x71 = f(y, "018"); /* c */ x71 = f(y, "019"); /* c */ x71 = f(y, "020"); /* c */ x71 = f(y, "021"); /* c */ x71 = f(y, "022"); /* c */ x71 = f(y, "023"); /* c */ x71 = f(y, "024"); /* c */ x71 = f(y, "025"); /* c */ x71 = f(y, "026"); /* c */ x71 = f(y, "027"); /* c */ x71 = f(y, "028"); /* c */ x71 = f(y, "029"); /* c */ x71 = f(y, "030"); /* c */ x71 = f(y, "031"); /* c */ x71 = f(y, "032"); /* c */ x71 = f(y, "033"); /* c */ x71 = f(y, "034"); /* c */ x71 = f(y, "035"); /* c */ x71 = f(y, "036"); /* c */ x71 = f(y, "037"); /* c */ x71 = f(y, "038"); /* c */ x71 = f(y, "039"); /* c */ x71 = f(y, "040"); /* c */ x71 = f(y, "041"); /* c */ x71 = f(y, "042"); /* c */ x71 = f(y, "043"); /* c */ x71 = f(y, "044"); /* c */ x71 = f(y, "045"); /* c */ x71 = f(y, "046"); /* c */ x71 = f(y, "047"); /* c */ x71 = f(y, "048"); /* c */ x71 = f(y, "049"); /* c */ x71 = f(y, "050"); /* c */ x71 = f(y, "051"); /* c */ x71 = f(y, "052"); /* c */ x71 = f(y, "053"); /* c */ x71 = f(y, "054"); /* c */ x71 = f(y, "055"); /* c */ x71 = f(y, "056"); /* c */ x71 = f(y, "057"); /* c */ x71 = f(y, "058"); /* c */ x71 = f(y, "059"); /* c */ x71 = f(y, "060"); /* c */ x71 = f(y, "061"); /* c */ x71 = f(y, "062"); /* c */ x71 = f(y, "063"); /* c */ x71 = f(y, "064"); /* c */ x71 = f(y, "065"); /* c */ x71 = f(y, "066"); /* c */ x71 = f(y, "067"); /* c */ x71 = f(y, "068"); /* c */ x71 = f(y, "069"); /* c */ x71 = f(y, "070"); /* c */ x71 = f(y, "071"); /* c */ x71 = f(y, "072"); /* c */ x71 = f(y, "073"); /* c */ x71 = f(y, "074"); /* c */ x71 = f(y, "075"); /* c */ x71 = f(y, "076"); /* c */ x71 = f(y, "077"); /* c */ x71 = f(y, "078"); /* c */ x71 = f(y, "079"); /* c */ x71 = f(y, "080"); /* c */ x71 = f(y, "081"); /* c */ x71 = f(y, "082"); /* c */ x71 = f(y, "083"); /* c */ x71 = f(y, "084"); /* c */ x71 = f(y, "085"); /* c */ x71 = f(y, "086"); /* c */ x71 = f(y, "087"); /* c */ x71 = f(y, "088"); /* c */ x71 = f(y, "089"); /* c */ x71 = f(y, "090"); /* c */ x71 = f(y, "091"); /* c */ x71 = f(y, "092"); /* c */ x71 = f(y, "093"); /* c */ x71 = f(y, "094"); /* c */ x71 = f(y, "095"); /* c */ x71 = f(y, "096"); /* c */ x71 = f(y, "097"); /* c */ x71 = f(y, "098"); /* c */ x71 = f(y, "099"); /* c */ x71 = f(y, "100"); /* c */ x71 = f(y, "101"); /* c */ x71 = f(y, "102"); /* c */ x71 = f(y, "103"); /* c */ x71 = f(y, "104"); /* c */ x71 = f(y, "105"); /* c */ x71 = f(y, "106"); /* c */ x71 = f(y, "107"); /* c */ x71 = f(y, "108"); /* c */ x71 = f(y, "109"); /* c */ x71 = f(y, "110"); /* c */ x71 = f(y, "111"); /* c */ x71 = f(y, "112"); /* c */ x71 = f(y, "113"); /* c */ x71 = f(y, "114"); /* c */ x71 = f(y, "115"); /* c */ x71 = f(y, "116"); /* c */ x71 = f(y, "117"); /* c */ x71 = f(y, "118"); /* c */ x71 = f(y, "119"); /* c */ x71 = f(y, "120"); /* c */ x71 = f(y, "121"); /* c */ x71 = f(y, "122"); /* c */ x71 = f(y, "123"); /* c */ x71 = f(y, "124"); /* c */ x71 = f(y, "125"); /* c */ x71 = f(y, "126"); /* c */ x71 = f(y, "127"); /* c */ x71 = f(y, "128"); /* c */ x71 = f(y, "129"); /* c */ x71 = f(y, "130"); /* c */ x71 = f(y, "131"); /* c */ x71 = f(y, "132"); /* c */ x71 = f(y, "133"); /* c */ x71 = f(y, "134"); /* c */ x71 = f(y, "135"); /* c */ x71 = f(y, "136"); /* c */ x71 = f(y, "137"); /* c */ x71 = f(y, "138"); /* c */ x71 = f(y, "139"); /* c */ x71 = f(y, "140"); /* c */ x71 = f(y, "141"); /* c */ x71 = f(y, "142"); /* c */ x71 = f(y, "143"); /* c */ x71 = f(y, "144"); /* c */ x71 = f(y, "145"); /* c */ x71 = f(y, "146"); /* c */ x71 = f(y, "147"); /* c */ x71 = f(y, "148"); /* c */ x71 = f(y, "149"); /* c */ x71 = f(y, "150"); /* c */ x71 = f(y, "151"); /* c */ x71 = f(y, "152"); /* c */ x71 = f(y, "153"); /* c */ x71 = f(y, "154"); /* c */ x71 = f(y, "155"); /* c */ x71 = f(y, "156"); /* c */ x71 = f(y, "157"); /* c */ x71 = f(y, "158"); /* c */ x71 = f(y, "159"); /* c */ x71 = f(y, "160"); /* c */ x71 = f(y, "161"); /* c */ x71 = f(y, "162"); /* c */ x71 = f(y, "163"); /* c */ x71 = f(y, "164"); /* c */ x71 = f(y, "165"); /* c */ x71 = f(y, "166"); /* c */ x71 = f(y, "167"); /* c */ x71 = f(y, "168"); /* c */ x71 = f(y, "169"); /* c */ x71 = f(y, "170"); /* c */ x71 = f(y, "171"); /* c */ x71 = f(y, "172"); /* c */ x71 = f(y, "173"); /* c */ x71 = f(y, "174"); /* c */ x71 = f(y, "175"); /* c */ x71 = f(y, "176"); /* c */ x71 = f(y, "177"); /* c */ x71 = f(y, "178"); /* c */ x71 = f(y, "179"); /* c */ x71 = f(y, "180"); /* c */ x71 = f(y, "181"); /* c */ x71 = f(y, "182"); /* c */ x71 = f(y, "183"); /* c */ x71 = f(y, "184"); /* c */ x71 = f(y, "185"); /* c */ x71 = f(y, "186"); /* c */ x71 = f(y, "187"); /* c */ x71 = f(y, "188"); /* c */ x71 = f(y, "189"); /* c */ x71 = f(y, "190"); /* c */ x71 = f(y, "191"); /* c */ x71 = f(y, "192"); /* c */ x71 = f(y, "193"); /* c */ x71 = f(y, "194"); /* c */ x71 = f(y, "195"); /* c */ x71 = f(y, "196"); /* c */ x71 = f(y, "197"); /* c */ x71 = f(y, "198"); /* c */ x71 = f(y, "199"); /* c */ 
+x72 = f(y, "000"); /* c */ x72 = f(y, "001"); /* c */ x72 = f(y, "002"); /* c */ x72 = f(y, "003"); /* c */ x72 = f(y, "004"); /* c */ x72 = f(y, "005"); /* c */ x72 = f(y, "006"); /* c */ x72 = f(y, "007"); /* c */ x72 = f(y, "008"); /* c */ x72 = f(y, "009"); /* c */ x72 = f(y, "010"); /* c */ x72 = f(y, "011"); /* c */ x72 = f(y, "012"); /* c */ x72 = f(y, "013"); /* c */ x72 = f(y, "014"); /* c */ x72 = f(y, "015"); /* c */ x72 = f(y, "016"); /* c */ x72 = f(y, "017"); /* c */ x72 = f(y, "018"); /* c */ x72 = f(y, "019"); /* c */ x72 = f(y, "020"); /* c */ x72 = f(y, "021"); /* c */ x72 = f(y, "022"); /* c */ x72 = f(y, "023"); /* c */ x72 = f(y, "024"); /* c */ x72 = f(y, "025"); /* c */ x72 = f(y, "026"); /* c */ x72 = f(y, "027"); /* c */ x72 = f(y, "028"); /* c */ x72 = f(y, "029"); /* c */ x72 = f(y, "030"); /* c */ x72 = f(y, "031"); /* c */ x72 = f(y, "032"); /* c */ x72 = f(y, "033"); /* c */ x72 = f(y, "034"); /* c */ x72 = f(y, "035"); /* c */ x72 = f(y, "036"); /* c */ x72 = f(y, "037"); /* c */ x72 = f(y, "038"); /* c */ x72 = f(y, "039"); /* c */ x72 = f(y, "040"); /* c */ x72 = f(y, "041"); /* c */ x72 = f(y, "042"); /* c */ x72 = f(y, "043"); /* c */ x72 = f(y, "044"); /* c */ x72 = f(y, "045"); /* c */ x72 = f(y, "046"); /* c */ x72 = f(y, "047"); /* c */ x72 = f(y, "048"); /* c */ x72 = f(y, "049"); /* c */ x72 = f(y, "050"); /* c */ x72 = f(y, "051"); /* c */ x72 = f(y, "052"); /* c */ x72 = f(y, "053"); /* c */ x72 = f(y, "054"); /* c */ x72 = f(y, "055"); /* c */ x72 = f(y, "056"); /* c */ x72 = f(y, "057"); /* c */ x72 = f(y, "058"); /* c */ x72 = f(y, "059"); /* c */ x72 = f(y, "060"); /* c */ x72 = f(y, "061"); /* c */ x72 = f(y, "062"); /* c */ x72 = f(y, "063"); /* c */ x72 = f(y, "064"); /* c */ x72 = f(y, "065"); /* c */ x72 = f(y, "066"); /* c */ x72 = f(y, "067"); /* c */ x72 = f(y, "068"); /* c */ x72 = f(y, "069"); /* c */ x72 = f(y, "070"); /* c */ x72 = f(y, "071"); /* c */ x72 = f(y, "072"); /* c */ x72 = f(y, "073"); /* c */ x72 = f(y, "074"); /* c */ x72 = f(y, "075"); /* c */ x72 = f(y, "076"); /* c */ x72 = f(y, "077"); /* c */ x72 = f(y, "078"); /* c */ x72 = f(y, "079"); /* c */ x72 = f(y, "080"); /* c */ x72 = f(y, "081"); /* c */ x72 = f(y, "082"); /* c */ x72 = f(y, "083"); /* c */ x72 = f(y, "084"); /* c */ x72 = f(y, "085"); /* c */ x72 = f(y, "086"); /* c */ x72 = f(y, "087"); /* c */ x72 = f(y, "088"); /* c */ x72 = f(y, "089"); /* c */ x72 = f(y, "090"); /* c */ x72 = f(y, "091"); /* c */ x72 = f(y, "092"); /* c */ x72 = f(y, "093"); /* c */ x72 = f(y, "094"); /* c */ x72 = f(y, "095"); /* c */ x72 = f(y, "096"); /* c */ x72 = f(y, "097"); /* c */ x72 = f(y, "098"); /* c */ x72 = f(y, "099"); /* c */ x72 = f(y, "100"); /* c */ x72 = f(y, "101"); /* c */ x72 = f(y, "102"); /* c */ x72 = f(y, "103"); /* c */ x72 = f(y, "104"); /* c */ x72 = f(y, "105"); /* c */ x72 = f(y, "106"); /* c */ x72 = f(y, "107"); /* c */ x72 = f(y, "108"); /* c */ x72 = f(y, "109"); /* c */ x72 = f(y, "110"); /* c */ x72 = f(y, "111"); /* c */ x72 = f(y, "112"); /* c */ x72 = f(y, "113"); /* c */ x72 = f(y, "114"); /* c */ x72 = f(y, "115"); /* c */ x72 = f(y, "116"); /* c */ x72 = f(y, "117"); /* c */ x72 = f(y, "118"); /* c */ x72 = f(y, "119"); /* c */ x72 = f(y, "120"); /* c */ x72 = f(y, "121"); /* c */ x72 = f(y, "122"); /* c */ x72 = f(y, "123"); /* c */ x72 = f(y, "124"); /* c */ x72 = f(y, "125"); /* c */ x72 = f(y, "126"); /* c */ x72 = f(y, "127"); /* c */ x72 = f(y, "128"); /* c */ x72 = f(y, "129"); /* c */ x72 = f(y, "130"); /* c */ x72 = f(y, "131"); /* c */ x72 = f(y, "132"); /* c */ x72 = f(y, "133"); /* c */ x72 = f(y, "134"); /* c */ x72 = f(y, "135"); /* c */ x72 = f(y, "136"); /* c */ x72 = f(y, "137"); /* c */ x72 = f(y, "138"); /* c */ x72 = f(y, "139"); /* c */ x72 = f(y, "140"); /* c */ x72 = f(y, "141"); /* c */ x72 = f(y, "142"); /* c */ x72 = f(y, "143"); /* c */ x72 = f(y, "144"); /* c */ x72 = f(y, "145"); /* c */ x72 = f(y, "146"); /* c */ x72 = f(y, "147"); /* c */ x72 = f(y, "148"); /* c */ x72 = f(y, "149"); /* c */ x72 = f(y, "150"); /* c */ x72 = f(y, "151"); /* c */ x72 = f(y, "152"); /* c */ x72 = f(y, "153"); /* c */ x72 = f(y, "154"); /* c */ x72 = f(y, "155"); /* c */ x72 = f(y, "156"); /* c */ x72 = f(y, "157"); /* c */ x72 = f(y, "158"); /* c */ x72 = f(y, "159"); /* c */ x72 = f(y, "160"); /* c */ x72 = f(y, "161"); /* c */ x72 = f(y, "162"); /* c */ x72 = f(y, "163"); /* c */ x72 = f(y, "164"); /* c */ x72 = f(y, "165"); /* c */ x72 = f(y, "166"); /* c */ x72 = f(y, "167"); /* c */ x72 = f(y, "168"); /* c */ x72 = f(y, "169"); /* c */ x72 = f(y, "170"); /* c */ x72 = f(y, "171"); /* c */ x72 = f(y, "172"); /* c */ x72 = f(y, "173"); /* c */ x72 = f(y, "174"); /* c */ x72 = f(y, "175"); /* c */ x72 = f(y, "176"); /* c */ x72 = f(y, "177"); /* c */ x72 = f(y, "178"); /* c */ x72 = f(y, "179"); /* c */ x72 = f(y, "180"); /* c */ x72 = f(y, "181"); /* c */ x72 = f(y, "182"); /* c */ x72 = f(y, "183"); /* c */ x72 = f(y, "184"); /* c */ x72 = f(y, "185"); /* c */ x72 = f(y, "186"); /* c */ x72 = f(y, "187"); /* c */ x72 = f(y, "188"); /* c */ x72 = f(y, "189"); /* c */ x72 = f(y, "190"); /* c */ x72 = f(y, "191"); /* c */ x72 = f(y, "192"); /* c */ x72 = f(y, "193"); /* c */ x72 = f(y, "194"); /* c */ x72 = f(y, "195"); /* c */ x72 = f(y, "196"); /* c */ x72 = f(y, "197"); /* c */ x72 = f(y, "198"); /* c */ x72 = f(y, "199"); /* c */ 
+x73 = f(y, "000"); /* c */ x73 = f(y, "001"); /* c */ x73 = f(y, "002"); /* c */ x73 = f(y, "003"); /* c */ x73 = f(y, "004"); /* c */ x73 = f(y, "005"); /* c */ x73 = f(y, "006"); /* c */ x73 = f(y, "007"); /* c */ x73 = f(y, "008"); /* c */ x73 = f(y, "009"); /* c */ x73 = f(y, "010"); /* c */ x73 = f(y, "011"); /* c */ x73 = f(y, "012"); /* c */ x73 = f(y, "013"); /* c */ x73 = f(y, "014"); /* c */ x73 = f(y, "015"); /* c */ x73 = f(y, "016"); /* c */ x73 = f(y, "017"); /* c */ x73 = f(y, "018"); /* c */ x73 = f(y, "019"); /* c */ x73 = f(y, "020"); /* c */ x73 = f(y, "021"); /* c */ x73 = f(y, "022"); /* c */ x73 = f(y, "023"); /* c */ x73 = f(y, "024"); /* c */ x73 = f(y, "025"); /* c */ x73 = f(y, "026"); /* c */ x73 = f(y, "027"); /* c */ x73 = f(y, "028"); /* c */ x73 = f(y, "029"); /* c */ x73 = f(y, "030"); /* c */ x73 = f(y, "031"); /* c */ x73 = f(y, "032"); /* c */ x73 = f(y, "033"); /* c */ x73 = f(y, "034"); /* c */ x73 = f(y, "035"); /* c */ x73 = f(y, "036"); /* c */ x73 = f(y, "037"); /* c */ x73 = f(y, "038"); /* c */ x73 = f(y, "039"); /* c */ x73 = f(y, "040"); /* c */ x73 = f(y, "041"); /* c */ x73 = f(y, "042"); /* c */ x73 = f(y, "043"); /* c */ x73 = f(y, "044"); /* c */ x73 = f(y, "045"); /* c */ x73 = f(y, "046"); /* c */ x73 = f(y, "047"); /* c */ x73 = f(y, "048"); /* c */ x73 = f(y, "049"); /* c */ x73 = f(y, "050"); /* c */ x73 = f(y, "051"); /* c */ x73 = f(y, "052"); /* c */ x73 = f(y, "053"); /* c */ x73 = f(y, "054"); /* c */ x73 = f(y, "055"); /* c */ x73 = f(y, "056"); /* c */ x73 = f(y, "057"); /* c */ x73 = f(y, "058"); /* c */ x73 = f(y, "059"); /* c */ x73 = f(y, "060"); /* c */ x73 = f(y, "061"); /* c */ x73 = f(y, "062"); /* c */ x73 = f(y, "063"); /* c */ x73 = f(y, "064"); /* c */ x73 = f(y, "065"); /* c */ x73 = f(y, "066"); /* c */ x73 = f(y, "067"); /* c */ x73 = f(y, "068"); /* c */ x73 = f(y, "069"); /* c */ x73 = f(y, "070"); /* c */ x73 = f(y, "071"); /* c */ x73 = f(y, "072"); /* c */ x73 = f(y, "073"); /* c */ x73 = f(y, "074"); /* c */ x73 = f(y, "075"); /* c */ x73 = f(y, "076"); /* c */ x73 = f(y, "077"); /* c */ x73 = f(y, "078"); /* c */ x73 = f(y, "079"); /* c */ x73 = f(y, "080"); /* c */ x73 = f(y, "081"); /* c */ x73 = f(y, "082"); /* c */ x73 = f(y, "083"); /* c */ x73 = f(y, "084"); /* c */ x73 = f(y, "085"); /* c */ x73 = f(y, "086"); /* c */ x73 = f(y, "087"); /* c */ x73 = f(y, "088"); /* c */ x73 = f(y, "089"); /* c */ x73 = f(y, "090"); /* c */ x73 = f(y, "091"); /* c */ x73 = f(y, "092"); /* c */ x73 = f(y, "093"); /* c */ x73 = f(y, "094"); /* c */ x73 = f(y, "095"); /* c */ x73 = f(y, "096"); /* c */ x73 = f(y, "097"); /* c */ x73 = f(y, "098"); /* c */ x73 = f(y, "099"); /* c */ x73 = f(y, "100"); /* c */ x73 = f(y, "101"); /* c */ x73 = f(y, "102"); /* c */ x73 = f(y, "103"); /* c */ x73 = f(y, "104"); /* c */ x73 = f(y, "105"); /* c */ x73 = f(y, "106"); /* c */ x73 = f(y, "107"); /* c */ x73 = f(y, "108"); /* c */ x73 = f(y, "109"); /* c */ x73 = f(y, "110"); /* c */ x73 = f(y, "111"); /* c */ x73 = f(y, "112"); /* c */ x73 = f(y, "113"); /* c */ x73 = f(y, "114"); /* c */ x73 = f(y, "115"); /* c */ x73 = f(y, "116"); /* c */ x73 = f(y, "117"); /* c */ x73 = f(y, "118"); /* c */ x73 = f(y, "119"); /* c */ x73 = f(y, "120"); /* c */ x73 = f(y, "121"); /* c */ x73 = f(y, "122"); /* c */ x73 = f(y, "123"); /* c */ x73 = f(y, "124"); /* c */ x73 = f(y, "125"); /* c */ x73 = f(y, "126"); /* c */ x73 = f(y, "127"); /* c */ x73 = f(y, "128"); /* c */ x73 = f(y, "129"); /* c */ x73 = f(y, "130"); /* c */ x73 = f(y, "131"); /* c */ x73 = f(y, "132"); /* c */ x73 = f(y, "133"); /* c */ x73 = f(y, "134"); /* c */ x73 = f(y, "135"); /* c */ x73 = f(y, "136"); /* c */ x73 = f(y, "137"); /* c */ x73 = f(y, "138"); /* c */ x73 = f(y, "139"); /* c */ x73 = f(y, "140"); /* c */ x73 = f(y, "141"); /* c */ x73 = f(y, "142"); /* c */ x73 = f(y, "143"); /* c */ x73 = f(y, "144"); /* c */ x73 = f(y, "145"); /* c */ x73 = f(y, "146"); /* c */ x73 = f(y, "147"); /* c */ x73 = f(y, "148"); /* c */ x73 = f(y, "149"); /* c */ x73 = f(y, "150"); /* c */ x73 = f(y, "151"); /* c */ x73 = f(y, "152"); /* c */ x73 = f(y, "153"); /* c */ x73 = f(y, "154"); /* c */ x73 = f(y, "155"); /* c */ x73 = f(y, "156"); /* c */ x73 = f(y, "157"); /* c */ x73 = f(y, "158"); /* c */ x73 = f(y, "159"); /* c */ x73 = f(y, "160"); /* c */ x73 = f(y, "161"); /* c */ x73 = f(y, "162"); /* c */ x73 = f(y, "163"); /* c */ x73 = f(y, "164"); /* c */ x73 = f(y, "165"); /* c */ x73 = f(y, "166"); /* c */ x73 = f(y, "167"); /* c */ x73 = f(y, "168"); /* c */ x73 = f(y, "169"); /* c */ x73 = f(y, "170"); /* c */ x73 = f(y, "171"); /* c */ x73 = f(y, "172"); /* c */ x73 = f(y, "173"); /* c */ x73 = f(y, "174"); /* c */ x73 = f(y, "175"); /* c */ x73 = f(y, "176"); /* c */ x73 = f(y, "177"); /* c */ x73 = f(y, "178"); /* c */ x73 = f(y, "179"); /* c */ x73 = f(y, "180"); /* c */ x73 = f(y, "181"); /* c */ x73 = f(y, "182"); /* c */ x73 = f(y, "183"); /* c */ x73 = f(y, "184"); /* c */ x73 = f(y, "185"); /* c */ x73 = f(y, "186"); /* c */ x73 = f(y, "187"); /* c */ x73 = f(y, "188"); /* c */ x73 = f(y, "189"); /* c */ x73 = f(y, "190"); /* c */ x73 = f(y, "191"); /* c */ x73 = f(y, "192"); /* c */ x73 = f(y, "193"); /* c */ x73 = f(y, "194"); /* c */ x73 = f(y, "195"); /* c */ x73 = f(y, "196"); /* c */ x73 = f(y, "197"); /* c */ x73 = f(y, "198"); /* c */ x73 = f(y, "199"); /* c */ 
+x74 = f(y, "000"); /* c */ x74 = f(y, "001"); /* c */ x74 = f(y, "002"); /* c */ x74 = f(y, "003"); /* c */ x74 = f(y, "004"); /* c */ x74 = f(y, "005"); /* c */ x74 = f(y, "006"); /* c */ x74 = f(y, "007"); /* c */ x74 = f(y, "008"); /* c */ x74 = f(y, "009"); /* c */ x74 = f(y, "010"); /* c */ x74 = f(y, "011"); /* c */ x74 = f(y, "012"); /* c */ x74 = f(y, "013"); /* c */ x74 = f(y, "014"); /* c */ x74 = f(y, "015"); /* c */ x74 = f(y, "016"); /* c */ x74 = f(y, "017"); /* c */ x74 = f(y, "018"); /* c */ x74 = f(y, "019"); /* c */ x74 = f(y, "020"); /* c */ x74 = f(y, "021"); /* c */ x74 = f(y, "022"); /* c */ x74 = f(y, "023"); /* c */ x74 = f(y, "024"); /* c */ x74 = f(y, "025"); /* c */ x74 = f(y, "026"); /* c */ x74 = f(y, "027"); /* c */ x74 = f(y, "028"); /* c */ x74 = f(y, "029"); /* c */ x74 = f(y, "030"); /* c */ x74 = f(y, "031"); /* c */ x74 = f(y, "032"); /* c */ x74 = f(y, "033"); /* c */ x74 = f(y, "034"); /* c */ x74 = f(y, "035"); /* c */ x74 = f(y, "036"); /* c */ x74 = f(y, "037"); /* c */ x74 = f(y, "038"); /* c */ x74 = f(y, "039"); /* c */ x74 = f(y, "040"); /* c */ x74 = f(y, "041"); /* c */ x74 = f(y, "042"); /* c */ x74 = f(y, "043"); /* c */ x74 = f(y, "044"); /* c */ x74 = f(y, "045"); /* c */ x74 = f(y, "046"); /* c */ x74 = f(y, "047"); /* c */ x74 = f(y, "048"); /* c */ x74 = f(y, "049"); /* c */ x74 = f(y, "050"); /* c */ x74 = f(y, "051"); /* c */ x74 = f(y, "052"); /* c */ x74 = f(y, "053"); /* c */ x74 = f(y, "054"); /* c */ x74 = f(y, "055"); /* c */ x74 = f(y, "056"); /* c */ x74 = f(y, "057"); /* c */ x74 = f(y, "058"); /* c */ x74 = f(y, "059"); /* c */ x74 = f(y, "060"); /* c */ x74 = f(y, "061"); /* c */ x74 = f(y, "062"); /* c */ x74 = f(y, "063"); /* c */ x74 = f(y, "064"); /* c */ x74 = f(y, "065"); /* c */ x74 = f(y, "066"); /* c */ x74 = f(y, "067"); /* c */ x74 = f(y, "068"); /* c */ x74 = f(y, "069"); /* c */ x74 = f(y, "070"); /* c */ x74 = f(y, "071"); /* c */ x74 = f(y, "072"); /* c */ x74 = f(y, "073"); /* c */ x74 = f(y, "074"); /* c */ x74 = f(y, "075"); /* c */ x74 = f(y, "076"); /* c */ x74 = f(y, "077"); /* c */ x74 = f(y, "078"); /* c */ x74 = f(y, "079"); /* c */ x74 = f(y, "080"); /* c */ x74 = f(y, "081"); /* c */ x74 = f(y, "082"); /* c */ x74 = f(y, "083"); /* c */ x74 = f(y, "084"); /* c */ x74 = f(y, "085"); /* c */ x74 = f(y, "086"); /* c */ x74 = f(y, "087"); /* c */ x74 = f(y, "088"); /* c */ x74 = f(y, "089"); /* c */ x74 = f(y, "090"); /* c */ x74 = f(y, "091"); /* c */ x74 = f(y, "092"); /* c */ x74 = f(y, "093"); /* c */ x74 = f(y, "094"); /* c */ x74 = f(y, "095"); /* c */ x74 = f(y, "096"); /* c */ x74 = f(y, "097"); /* c */ x74 = f(y, "098"); /* c */ x74 = f(y, "099"); /* c */ x74 = f(y, "100"); /* c */ x74 = f(y, "101"); /* c */ x74 = f(y, "102"); /* c */ x74 = f(y, "103"); /* c */ x74 = f(y, "104"); /* c */ x74 = f(y, "105"); /* c */ x74 = f(y, "106"); /* c */ x74 = f(y, "107"); /* c */ x74 = f(y, "108"); /* c */ x74 = f(y, "109"); /* c */ x74 = f(y, "110"); /* c */ x74 = f(y, "111"); /* c */ x74 = f(y, "112"); /* c */ x74 = f(y, "113"); /* c */ x74 = f(y, "114"); /* c */ x74 = f(y, "115"); /* c */ x74 = f(y, "116"); /* c */ x74 = f(y, "117"); /* c */ x74 = f(y, "118"); /* c */ x74 = f(y, "119"); /* c */ x74 = f(y, "120"); /* c */ x74 = f(y, "121"); /* c */ x74 = f(y, "122"); /* c */ x74 = f(y, "123"); /* c */ x74 = f(y, "124"); /* c */ x74 = f(y, "125"); /* c */ x74 = f(y, "126"); /* c */ x74 = f(y, "127"); /* c */ x74 = f(y, "128"); /* c */ x74 = f(y, "129"); /* c */ x74 = f(y, "130"); /* c */ x74 = f(y, "131"); /* c */ x74 = f(y, "132"); /* c */ x74 = f(y, "133"); /* c */ x74 = f(y, "134"); /* c */ x74 = f(y, "135"); /* c */ x74 = f(y, "136"); /* c */ x74 = f(y, "137"); /* c */ x74 = f(y, "138"); /* c */ x74 = f(y, "139"); /* c */ x74 = f(y, "140"); /* c */ x74 = f(y, "141"); /* c */ x74 = f(y, "142"); /* c */ x74 = f(y, "143"); /* c */ x74 = f(y, "144"); /* c */ x74 = f(y, "145"); /* c */ x74 = f(y, "146"); /* c */ x74 = f(y, "147"); /* c */ x74 = f(y, "148"); /* c */ x74 = f(y, "149"); /* c */ x74 = f(y, "150"); /* c */ x74 = f(y, "151"); /* c */ x74 = f(y, "152"); /* c */ x74 = f(y, "153"); /* c */ x74 = f(y, "154"); /* c */ x74 = f(y, "155"); /* c */ x74 = f(y, "156"); /* c */ x74 = f(y, "157"); /* c */ x74 = f(y, "158"); /* c */ x74 = f(y, "159"); /* c */ x74 = f(y, "160"); /* c */ x74 = f(y, "161"); /* c */ x74 = f(y, "162"); /* c */ x74 = f(y, "163"); /* c */ x74 = f(y, "164"); /* c */ x74 = f(y, "165"); /* c */ x74 = f(y, "166"); /* c */ x74 = f(y, "167"); /* c */ x74 = f(y, "168"); /* c */ x74 = f(y, "169"); /* c */ x74 = f(y, "170"); /* c */ x74 = f(y, "171"); /* c */ x74 = f(y, "172"); /* c */ x74 = f(y, "173"); /* c */ x74 = f(y, "174"); /* c */ x74 = f(y, "175"); /* c */ x74 = f(y, "176"); /* c */ x74 = f(y, "177"); /* c */ x74 = f(y, "178"); /* c */ x74 = f(y, "179"); /* c */ x74 = f(y, "180"); /* c */ x74 = f(y, "181"); /* c */ x74 = f(y, "182"); /* c */ x74 = f(y, "183"); /* c */ x74 = f(y, "184"); /* c */ x74 = f(y, "185"); /* c */ x74 = f(y, "186"); /* c */ x74 = f(y, "187"); /* c */ x74 = f(y, "188"); /* c */ x74 = f(y, "189"); /* c */ x74 = f(y, "190"); /* c */ x74 = f(y, "191"); /* c */ x74 = f(y, "192"); /* c */ x74 = f(y, "193"); /* c */ x74 = f(y, "194"); /* c */ x74 = f(y, "195"); /* c */ x74 = f(y, "196"); /* c */ x74 = f(y, "197"); /* c */ x74 = f(y, "198"); /* c */ x74 = f(y, "199"); /* c */ 
+x75 = f(y, "000"); /* c */ x75 = f(y, "001"); /* c */ x75 = f(y, "002"); /* c */ x75 = f(y, "003"); /* c */ x75 = f(y, "004"); /* c */ x75 = f(y, "005"); /* c */ x75 = f(y, "006"); /* c */ x75 = f(y, "007"); /* c */ x75 = f(y, "008"); /* c */ x75 = f(y, "009"); /* c */ x75 = f(y, "010"); /* c */ x75 = f(y, "011"); /* c */ x75 = f(y, "012"); /* c */ x75 = f(y, "013"); /* c */ x75 = f(y, "014"); /* c */ x75 = f(y, "015"); /* c */ x75 = f(y, "016"); /* c */ x75 = f(y, "017"); /* c */ x75 = f(y, "018"); /* c */ x75 = f(y, "019"); /* c */ x75 = f(y, "020"); /* c */ x75 = f(y, "021"); /* c */ x75 = f(y, "022"); /* c */ x75 = f(y, "023"); /* c */ x75 = f(y, "024"); /* c */ x75 = f(y, "025"); /* c */ x75 = f(y, "026"); /* c */ x75 = f(y, "027"); /* c */ x75 = f(y, "028"); /* c */ x75 = f(y, "029"); /* c */ x75 = f(y, "030"); /* c */ x75 = f(y, "031"); /* c */ x75 = f(y, "032"); /* c */ x75 = f(y, "033"); /* c */ x75 = f(y, "034"); /* c */ x75 = f(y, "035"); /* c */ x75 = f(y, "036"); /* c */ x75 = f(y, "037"); /* c */ x75 = f(y, "038"); /* c */ x75 = f(y, "039"); /* c */ x75 = f(y, "040"); /* c */ x75 = f(y, "041"); /* c */ x75 = f(y, "042"); /* c */ x75 = f(y, "043"); /* c */ x75 = f(y, "044"); /* c */ x75 = f(y, "045"); /* c */ x75 = f(y, "046"); /* c */ x75 = f(y, "047"); /* c */ x75 = f(y, "048"); /* c */ x75 = f(y, "049"); /* c */ x75 = f(y, "050"); /* c */ x75 = f(y, "051"); /* c */ x75 = f(y, "052"); /* c */ x75 = f(y, "053"); /* c */ x75 = f(y, "054"); /* c */ x75 = f(y, "055"); /* c */ x75 = f(y, "056"); /* c */ x75 = f(y, "057"); /* c */ x75 = f(y, "058"); /* c */ x75 = f(y, "059"); /* c */ x75 = f(y, "060"); /* c */ x75 = f(y, "061"); /* c */ x75 = f(y, "062"); /* c */ x75 = f(y, "063"); /* c */ x75 = f(y, "064"); /* c */ x75 = f(y, "065"); /* c */ x75 = f(y, "066"); /* c */ x75 = f(y, "067"); /* c */ x75 = f(y, "068"); /* c */ x75 = f(y, "069"); /* c */ x75 = f(y, "070"); /* c */ x75 = f(y, "071"); /* c */ x75 = f(y, "072"); /* c */ x75 = f(y, "073"); /* c */ x75 = f(y, "074"); /* c */ x75 = f(y, "075"); /* c */ x75 = f(y, "076"); /* c */ x75 = f(y, "077"); /* c */ x75 = f(y, "078"); /* c */ x75 = f(y, "079"); /* c */ x75 = f(y, "080"); /* c */ x75 = f(y, "081"); /* c */ x75 = f(y, "082"); /* c */ x75 = f(y, "083"); /* c */ x75 = f(y, "084"); /* c */ x75 = f(y, "085"); /* c */ x75 = f(y, "086"); /* c */ x75 = f(y, "087"); /* c */ x75 = f(y, "088"); /* c */ x75 = f(y, "089"); /* c */ x75 = f(y, "090"); /* c */ x75 = f(y, "091"); /* c */ x75 = f(y, "092"); /* c */ x75 = f(y, "093"); /* c */ x75 = f(y, "094"); /* c */ x75 = f(y, "095"); /* c */ x75 = f(y, "096"); /* c */ x75 = f(y, "097"); /* c */ x75 = f(y, "098"); /* c */ x75 = f(y, "099"); /* c */ x75 = f(y, "100"); /* c */ x75 = f(y, "101"); /* c */ x75 = f(y, "102"); /* c */ x75 = f(y, "103"); /* c */ x75 = f(y, "104"); /* c */ x75 = f(y, "105"); /* c */ x75 = f(y, "106"); /* c */ x75 = f(y, "107"); /* c */ x75 = f(y, "108"); /* c */ x75 = f(y, "109"); /* c */ x75 = f(y, "110"); /* c */ x75 = f(y, "111"); /* c */ x75 = f(y, "112"); /* c */ x75 = f(y, "113"); /* c */ x75 = f(y, "114"); /* c */ x75 = f(y, "115"); /* c */ x75 = f(y, "116"); /* c */ x75 = f(y, "117"); /* c */ x75 = f(y, "118"); /* c */ x75 = f(y, "119"); /* c */ x75 = f(y, "120"); /* c */ x75 = f(y, "121"); /* c */ x75 = f(y, "122"); /* c */ x75 = f(y, "123"); /* c */ x75 = f(y, "124"); /* c */ x75 = f(y, "125"); /* c */ x75 = f(y, "126"); /* c */ x75 = f(y, "127"); /* c */ x75 = f(y, "128"); /* c */ x75 = f(y, "129"); /* c */ x75 = f(y, "130"); /* c */ x75 = f(y, "131"); /* c */ x75 = f(y, "132"); /* c */ x75 = f(y, "133"); /* c */ x75 = f(y, "134"); /* c */ x75 = f(y, "135"); /* c */ x75 = f(y, "136"); /* c */ x75 = f(y, "137"); /* c */ x75 = f(y, "138"); /* c */ x75 = f(y, "139"); /* c */ x75 = f(y, "140"); /* c */ x75 = f(y, "141"); /* c */ x75 = f(y, "142"); /* c */ x75 = f(y, "143"); /* c */ x75 = f(y, "144"); /* c */ x75 = f(y, "145"); /* c */ x75 = f(y, "146"); /* c */ x75 = f(y, "147"); /* c */ x75 = f(y, "148"); /* c */ x75 = f(y, "149"); /* c */ x75 = f(y, "150"); /* c */ x75 = f(y, "151"); /* c */ x75 = f(y, "152"); /* c */ x75 = f(y, "153"); /* c */ x75 = f(y, "154"); /* c */ x75 = f(y, "155"); /* c */ x75 = f(y, "156"); /* c */ x75 = f(y, "157"); /* c */ x75 = f(y, "158"); /* c */ x75 = f(y, "159"); /* c */ x75 = f(y, "160"); /* c */ x75 = f(y, "161"); /* c */ x75 = f(y, "162"); /* c */ x75 = f(y, "163"); /* c */ x75 = f(y, "164"); /* c */ x75 = f(y, "165"); /* c */ x75 = f(y, "166"); /* c */ x75 = f(y, "167"); /* c */ x75 = f(y, "168"); /* c */ x75 = f(y, "169"); /* c */ x75 = f(y, "170"); /* c */ x75 = f(y, "171"); /* c */ x75 = f(y, "172"); /* c */ x75 = f(y, "173"); /* c */ x75 = f(y, "174"); /* c */ x75 = f(y, "175"); /* c */ x75 = f(y, "176"); /* c */ x75 = f(y, "177"); /* c */ x75 = f(y, "178"); /* c */ x75 = f(y, "179"); /* c */ x75 = f(y, "180"); /* c */ x75 = f(y, "181"); /* c */ x75 = f(y, "182"); /* c */ x75 = f(y, "183"); /* c */ x75 = f(y, "184"); /* c */ x75 = f(y, "185"); /* c */ x75 = f(y, "186"); /* c */ x75 = f(y, "187"); /* c */ x75 = f(y, "188"); /* c */ x75 = f(y, "189"); /* c */ x75 = f(y, "190"); /* c */ x75 = f(y, "191"); /* c */ x75 = f(y, "192"); /* c */ x75 = f(y, "193"); /* c */ x75 = f(y, "194"); /* c */ x75 = f(y, "195"); /* c */ x75 = f(y, "196"); /* c */ x75 = f(y, "197"); /* c */ x75 = f(y, "198"); /* c */ x75 = f(y, "199"); /* c */ 
+x76 = f(y, "000"); /* c */ x76 = f(y, "001"); /* c */ x76 = f(y, "002"); /* c */ x76 = f(y, "003"); /* c */ x76 = f(y, "004"); /* c */ x76 = f(y, "005"); /* c */ x76 = f(y, "006"); /* c */ x76 = f(y, "007"); /* c */ x76 = f(y, "008"); /* c */ x76 = f(y, "009"); /* c */ x76 = f(y, "010"); /* c */ x76 = f(y, "011"); /* c */ x76 = f(y, "012"); /* c */ x76 = f(y, "013"); /* c */ x76 = f(y, "014"); /* c */ x76 = f(y, "015"); /* c */ x76 = f(y, "016"); /* c */ x76 = f(y, "017"); /* c */ x76 = f(y, "018"); /* c */ x76 = f(y, "019"); /* c */ x76 = f(y, "020"); /* c */ x76 = f(y, "021"); /* c */ x76 = f(y, "022"); /* c */ x76 = f(y, "023"); /* c */ x76 = f(y, "024"); /* c */ x76 = f(y, "025"); /* c */ x76 = f(y, "026"); /* c */ x76 = f(y, "027"); /* c */ x76 = f(y, "028"); /* c */ x76 = f(y, "029"); /* c */ x76 = f(y, "030"); /* c */ x76 = f(y, "031"); /* c */ x76 = f(y, "032"); /* c */ x76 = f(y, "033"); /* c */ x76 = f(y, "034"); /* c */ x76 = f(y, "035"); /* c */ x76 = f(y, "036"); /* c */ x76 = f(y, "037"); /* c */ x76 = f(y, "038"); /* c */ x76 = f(y, "039"); /* c */ x76 = f(y, "040"); /* c */ x76 = f(y, "041"); /* c */ x76 = f(y, "042"); /* c */ x76 = f(y, "043"); /* c */ x76 = f(y, "044"); /* c */ x76 = f(y, "045"); /* c */ x76 = f(y, "046"); /* c */ x76 = f(y, "047"); /* c */ x76 = f(y, "048"); /* c */ x76 = f(y, "049"); /* c */ x76 = f(y, "050"); /* c */ x76 = f(y, "051"); /* c */ x76 = f(y, "052"); /* c */ x76 = f(y, "053"); /* c */ x76 = f(y, "054"); /* c */ x76 = f(y, "055"); /* c */ x76 = f(y, "056"); /* c */ x76 = f(y, "057"); /* c */ x76 = f(y, "058"); /* c */ x76 = f(y, "059"); /* c */ x76 = f(y, "060"); /* c */ x76 = f(y, "061"); /* c */ x76 = f(y, "062"); /* c */ x76 = f(y, "063"); /* c */ x76 = f(y, "064"); /* c */ x76 = f(y, "065"); /* c */ x76 = f(y, "066"); /* c */ x76 = f(y, "067"); /* c */ x76 = f(y, "068"); /* c */ x76 = f(y, "069"); /* c */ x76 = f(y, "070"); /* c */ x76 = f(y, "071"); /* c */ x76 = f(y, "072"); /* c */ x76 = f(y, "073"); /* c */ x76 = f(y, "074"); /* c */ x76 = f(y, "075"); /* c */ x76 = f(y, "076"); /* c */ x76 = f(y, "077"); /* c */ x76 = f(y, "078"); /* c */ x76 = f(y, "079"); /* c */ x76 = f(y, "080"); /* c */ x76 = f(y, "081"); /* c */ x76 = f(y, "082"); /* c */ x76 = f(y, "083"); /* c */ x76 = f(y, "084"); /* c */ x76 = f(y, "085"); /* c */ x76 = f(y, "086"); /* c */ x76 = f(y, "087"); /* c */ x76 = f(y, "088"); /* c */ x76 = f(y, "089"); /* c */ x76 = f(y, "090"); /* c */ x76 = f(y, "091"); /* c */ x76 = f(y, "092"); /* c */ x76 = f(y, "093"); /* c */ x76 = f(y, "094"); /* c */ x76 = f(y, "095"); /* c */ x76 = f(y, "096"); /* c */ x76 = f(y, "097"); /* c */ x76 = f(y, "098"); /* c */ x76 = f(y, "099"); /* c */ x76 = f(y, "100"); /* c */ x76 = f(y, "101"); /* c */ x76 = f(y, "102"); /* c */ x76 = f(y, "103"); /* c */ x76 = f(y, "104"); /* c */ x76 = f(y, "105"); /* c */ x76 = f(y, "106"); /* c */ x76 = f(y, "107"); /* c */ x76 = f(y, "108"); /* c */ x76 = f(y, "109"); /* c */ x76 = f(y, "110"); /* c */ x76 = f(y, "111"); /* c */ x76 = f(y, "112"); /* c */ x76 = f(y, "113"); /* c */ x76 = f(y, "114"); /* c */ x76 = f(y, "115"); /* c */ x76 = f(y, "116"); /* c */ x76 = f(y, "117"); /* c */ x76 = f(y, "118"); /* c */ x76 = f(y, "119"); /* c */ x76 = f(y, "120"); /* c */ x76 = f(y, "121"); /* c */ x76 = f(y, "122"); /* c */ x76 = f(y, "123"); /* c */ x76 = f(y, "124"); /* c */ x76 = f(y, "125"); /* c */ x76 = f(y, "126"); /* c */ x76 = f(y, "127"); /* c */ x76 = f(y, "128"); /* c */ x76 = f(y, "129"); /* c */ x76 = f(y, "130"); /* c */ x76 = f(y, "131"); /* c */ x76 = f(y, "132"); /* c */ x76 = f(y, "133"); /* c */ x76 = f(y, "134"); /* c */ x76 = f(y, "135"); /* c */ x76 = f(y, "136"); /* c */ x76 = f(y, "137"); /* c */ x76 = f(y, "138"); /* c */ x76 = f(y, "139"); /* c */ x76 = f(y, "140"); /* c */ x76 = f(y, "141"); /* c */ x76 = f(y, "142"); /* c */ x76 = f(y, "143"); /* c */ x76 = f(y, "144"); /* c */ x76 = f(y, "145"); /* c */ x76 = f(y, "146"); /* c */ x76 = f(y, "147"); /* c */ x76 = f(y, "148"); /* c */ x76 = f(y, "149"); /* c */ x76 = f(y, "150"); /* c */ x76 = f(y, "151"); /* c */ x76 = f(y, "152"); /* c */ x76 = f(y, "153"); /* c */ x76 = f(y, "154"); /* c */ x76 = f(y, "155"); /* c */ x76 = f(y, "156"); /* c */ x76 = f(y, "157"); /* c */ x76 = f(y, "158"); /* c */ x76 = f(y, "159"); /* c */ x76 = f(y, "160"); /* c */ x76 = f(y, "161"); /* c */ x76 = f(y, "162"); /* c */ x76 = f(y, "163"); /* c */ x76 = f(y, "164"); /* c */ x76 = f(y, "165"); /* c */ x76 = f(y, "166"); /* c */ x76 = f(y, "167"); /* c */ x76 = f(y, "168"); /* c */ x76 = f(y, "169"); /* c */ x76 = f(y, "170"); /* c */ x76 = f(y, "171"); /* c */ x76 = f(y, "172"); /* c */ x76 = f(y, "173"); /* c */ x76 = f(y, "174"); /* c */ x76 = f(y, "175"); /* c */ x76 = f(y, "176"); /* c */ x76 = f(y, "177"); /* c */ x76 = f(y, "178"); /* c */ x76 = f(y, "179"); /* c */ x76 = f(y, "180"); /* c */ x76 = f(y, "181"); /* c */ x76 = f(y, "182"); /* c */ x76 = f(y, "183"); /* c */ x76 = f(y, "184"); /* c */ x76 = f(y, "185"); /* c */ x76 = f(y, "186"); /* c */ x76 = f(y, "187"); /* c */ x76 = f(y, "188"); /* c */ x76 = f(y, "189"); /* c */ x76 = f(y, "190"); /* c */ x76 = f(y, "191"); /* c */ x76 = f(y, "192"); /* c */ x76 = f(y, "193"); /* c */ x76 = f(y, "194"); /* c */ x76 = f(y, "195"); /* c */ x76 = f(y, "196"); /* c */ x76 = f(y, "197"); /* c */ x76 = f(y, "198"); /* c */ x76 = f(y, "199"); /* c */ 
+x77 = f(y, "000"); /* c */ x77 = f(y, "001"); /* c */ x77 = f(y, "002"); /* c */ x77 = f(y, "003"); /* c */ x77 = f(y, "004"); /* c */ x77 = f(y, "005"); /* c */ x77 = f(y, "006"); /* c */ x77 = f(y, "007"); /* c */ x77 = f(y, "008"); /* c */ x77 = f(y, "009"); /* c */ x77 = f(y, "010"); /* c */ x77 = f(y, "011"); /* c */ x77 = f(y, "012"); /* c */ x77 = f(y, "013"); /* c */ x77 = f(y, "014"); /* c */ x77 = f(y, "015"); /* c */ x77 = f(y, "016"); /* c */ x77 = f(y, "017"); /* c */ x77 = f(y, "018"); /* c */ x77 = f(y, "019"); /* c */ x77 = f(y, "020"); /* c */ x77 = f(y, "021"); /* c */ x77 = f(y, "022"); /* c */ x77 = f(y, "023"); /* c */ x77 = f(y, "024"); /* c */ x77 = f(y, "025"); /* c */ x77 = f(y, "026"); /* c */ x77 = f(y, "027"); /* c */ x77 = f(y, "028"); /* c */ x77 = f(y, "029"); /* c */ x77 = f(y, "030"); /* c */ x77 = f(y, "031"); /* c */ x77 = f(y, "032"); /* c */ x77 = f(y, "033"); /* c */ x77 = f(y, "034"); /* c */ x77 = f(y, "035"); /* c */ x77 = f(y, "036"); /* c */ x77 = f(y, "037"); /* c */ x77 = f(y, "038"); /* c */ x77 = f(y, "039"); /* c */ x77 = f(y, "040"); /* c */ x77 = f(y, "041"); /* c */ x77 = f(y, "042"); /* c */ x77 = f(y, "043"); /* c */ x77 = f(y, "044"); /* c */ x77 = f(y, "045"); /* c */ x77 = f(y, "046"); /* c */ x77 = f(y, "047"); /* c */ x77 = f(y, "048"); /* c */ x77 = f(y, "049"); /* c */ x77 = f(y, "050"); /* c */ x77 = f(y, "051"); /* c */ x77 = f(y, "052"); /* c */ x77 = f(y, "053"); /* c */ x77 = f(y, "054"); /* c */ x77 = f(y, "055"); /* c */ x77 = f(y, "056"); /* c */ x77 = f(y, "057"); /* c */ x77 = f(y, "058"); /* c */ x77 = f(y, "059"); /* c */ x77 = f(y, "060"); /* c */ x77 = f(y, "061"); /* c */ x77 = f(y, "062"); /* c */ x77 = f(y, "063"); /* c */ x77 = f(y, "064"); /* c */ x77 = f(y, "065"); /* c */ x77 = f(y, "066"); /* c */ x77 = f(y, "067"); /* c */ x77 = f(y, "068"); /* c */ x77 = f(y, "069"); /* c */ x77 = f(y, "070"); /* c */ x77 = f(y, "071"); /* c */ x77 = f(y, "072"); /* c */ x77 = f(y, "073"); /* c */ x77 = f(y, "074"); /* c */ x77 = f(y, "075"); /* c */ x77 = f(y, "076"); /* c */ x77 = f(y, "077"); /* c */ x77 = f(y, "078"); /* c */ x77 = f(y, "079"); /* c */ x77 = f(y, "080"); /* c */ x77 = f(y, "081"); /* c */ x77 = f(y, "082"); /* c */ x77 = f(y, "083"); /* c */ x77 = f(y, "084"); /* c */ x77 = f(y, "085"); /* c */ x77 = f(y, "086"); /* c */ x77 = f(y, "087"); /* c */ x77 = f(y, "088"); /* c */ x77 = f(y, "089"); /* c */ x77 = f(y, "090"); /* c */ x77 = f(y, "091"); /* c */ x77 = f(y, "092"); /* c */ x77 = f(y, "093"); /* c */ x77 = f(y, "094"); /* c */ x77 = f(y, "095"); /* c */ x77 = f(y, "096"); /* c */ x77 = f(y, "097"); /* c */ x77 = f(y, "098"); /* c */ x77 = f(y, "099"); /* c */ x77 = f(y, "100"); /* c */ x77 = f(y, "101"); /* c */ x77 = f(y, "102"); /* c */ x77 = f(y, "103"); /* c */ x77 = f(y, "104"); /* c */ x77 = f(y, "105"); /* c */ x77 = f(y, "106"); /* c */ x77 = f(y, "107"); /* c */ x77 = f(y, "108"); /* c */ x77 = f(y, "109"); /* c */ x77 = f(y, "110"); /* c */ x77 = f(y, "111"); /* c */ x77 = f(y, "112"); /* c */ x77 = f(y, "113"); /* c */ x77 = f(y, "114"); /* c */ x77 = f(y, "115"); /* c */ x77 = f(y, "116"); /* c */ x77 = f(y, "117"); /* c */ x77 = f(y, "118"); /* c */ x77 = f(y, "119"); /* c */ x77 = f(y, "120"); /* c */ x77 = f(y, "121"); /* c */ x77 = f(y, "122"); /* c */ x77 = f(y, "123"); /* c */ x77 = f(y, "124"); /* c */ x77 = f(y, "125"); /* c */ x77 = f(y, "126"); /* c */ x77 = f(y, "127"); /* c */ x77 = f(y, "128"); /* c */ x77 = f(y, "129"); /* c */ x77 = f(y, "130"); /* c */ x77 = f(y, "131"); /* c */ x77 = f(y, "132"); /* c */ x77 = f(y, "133"); /* c */ x77 = f(y, "134"); /* c */ x77 = f(y, "135"); /* c */ x77 = f(y, "136"); /* c */ x77 = f(y, "137"); /* c */ x77 = f(y, "138"); /* c */ x77 = f(y, "139"); /* c */ x77 = f(y, "140"); /* c */ x77 = f(y, "141"); /* c */ x77 = f(y, "142"); /* c */ x77 = f(y, "143"); /* c */ x77 = f(y, "144"); /* c */ x77 = f(y, "145"); /* c */ x77 = f(y, "146"); /* c */ x77 = f(y, "147"); /* c */ x77 = f(y, "148"); /* c */ x77 = f(y, "149"); /* c */ x77 = f(y, "150"); /* c */ x77 = f(y, "151"); /* c */ x77 = f(y, "152"); /* c */ x77 = f(y, "153"); /* c */ x77 = f(y, "154"); /* c */ x77 = f(y, "155"); /* c */ x77 = f(y, "156"); /* c */ x77 = f(y, "157"); /* c */ x77 = f(y, "158"); /* c */ x77 = f(y, "159"); /* c */ x77 = f(y, "160"); /* c */ x77 = f(y, "161"); /* c */ x77 = f(y, "162"); /* c */ x77 = f(y, "163"); /* c */ x77 = f(y, "164"); /* c */ x77 = f(y, "165"); /* c */ x77 = f(y, "166"); /* c */ x77 = f(y, "167"); /* c */ x77 = f(y, "168"); /* c */ x77 = f(y, "169"); /* c */ x77 = f(y, "170"); /* c */ x77 = f(y, "171"); /* c */ x77 = f(y, "172"); /* c */ x77 = f(y, "173"); /* c */ x77 = f(y, "174"); /* c */ x77 = f(y, "175"); /* c */ x77 = f(y, "176"); /* c */ x77 = f(y, "177"); /* c */ x77 = f(y, "178"); /* c */ x77 = f(y, "179"); /* c */ x77 = f(y, "180"); /* c */ x77 = f(y, "181"); /* c */ x77 = f(y, "182"); /* c */ x77 = f(y, "183"); /* c */ x77 = f(y, "184"); /* c */ x77 = f(y, "185"); /* c */ x77 = f(y, "186"); /* c */ x77 = f(y, "187"); /* c */ x77 = f(y, "188"); /* c */ x77 = f(y, "189"); /* c */ x77 = f(y, "190"); /* c */ x77 = f(y, "191"); /* c */ x77 = f(y, "192"); /* c */ x77 = f(y, "193"); /* c */ x77 = f(y, "194"); /* c */ x77 = f(y, "195"); /* c */ x77 = f(y, "196"); /* c */ x77 = f(y, "197"); /* c */ x77 = f(y, "198"); /* c */ x77 = f(y, "199"); /* c */ 
+x78 = f(y, "000"); /* c */ x78 = f(y, "001"); /* c */ x78 = f(y, "002"); /* c */ x78 = f(y, "003"); /* c */ x78 = f(y, "004"); /* c */ x78 = f(y, "005"); /* c */ x78 = f(y, "006"); /* c */ x78 = f(y, "007"); /* c */ x78 = f(y, "008"); /* c */ x78 = f(y, "009"); /* c */ x78 = f(y, "010"); /* c */ x78 = f(y, "011"); /* c */ x78 = f(y, "012"); /* c */ x78 = f(y, "013"); /* c */ x78 = f(y, "014"); /* c */ x78 = f(y, "015"); /* c */ x78 = f(y, "016"); /* c */ x78 = f(y, "017"); /* c */ x78 = f(y, "018"); /* c */ x78 = f(y, "019"); /* c */ x78 = f(y, "020"); /* c */ x78 = f(y, "021"); /* c */ x78 = f(y, "022"); /* c */ x78 = f(y, "023"); /* c */ x78 = f(y, "024"); /* c */ x78 = f(y, "025"); /* c */ x78 = f(y, "026"); /* c */ x78 = f(y, "027"); /* c */ x78 = f(y, "028"); /* c */ x78 = f(y, "029"); /* c */ x78 = f(y, "030"); /* c */ x78 = f(y, "031"); /* c */ x78 = f(y, "032"); /* c */ x78 = f(y, "033"); /* c */ x78 = f(y, "034"); /* c */ x78 = f(y, "035"); /* c */ x78 = f(y, "036"); /* c */ x78 = f(y, "037"); /* c */ x78 = f(y, "038"); /* c */ x78 = f(y, "039"); /* c */ x78 = f(y, "040"); /* c */ x78 = f(y, "041"); /* c */ x78 = f(y, "042"); /* c */ x78 = f(y, "043"); /* c */ x78 = f(y, "044"); /* c */ x78 = f(y, "045"); /* c */ x78 = f(y, "046"); /* c */ x78 = f(y, "047"); /* c */ x78 = f(y, "048"); /* c */ x78 = f(y, "049"); /* c */ x78 = f(y, "050"); /* c */ x78 = f(y, "051"); /* c */ x78 = f(y, "052"); /* c */ x78 = f(y, "053"); /* c */ x78 = f(y, "054"); /* c */ x78 = f(y, "055"); /* c */ x78 = f(y, "056"); /* c */ x78 = f(y, "057"); /* c */ x78 = f(y, "058"); /* c */ x78 = f(y, "059"); /* c */ x78 = f(y, "060"); /* c */ x78 = f(y, "061"); /* c */ x78 = f(y, "062"); /* c */ x78 = f(y, "063"); /* c */ x78 = f(y, "064"); /* c */ x78 = f(y, "065"); /* c */ x78 = f(y, "066"); /* c */ x78 = f(y, "067"); /* c */ x78 = f(y, "068"); /* c */ x78 = f(y, "069"); /* c */ x78 = f(y, "070"); /* c */ x78 = f(y, "071"); /* c */ x78 = f(y, "072"); /* c */ x78 = f(y, "073"); /* c */ x78 = f(y, "074"); /* c */ x78 = f(y, "075"); /* c */ x78 = f(y, "076"); /* c */ x78 = f(y, "077"); /* c */ x78 = f(y, "078"); /* c */ x78 = f(y, "079"); /* c */ x78 = f(y, "080"); /* c */ x78 = f(y, "081"); /* c */ x78 = f(y, "082"); /* c */ x78 = f(y, "083"); /* c */ x78 = f(y, "084"); /* c */ x78 = f(y, "085"); /* c */ x78 = f(y, "086"); /* c */ x78 = f(y, "087"); /* c */ x78 = f(y, "088"); /* c */ x78 = f(y, "089"); /* c */ x78 = f(y, "090"); /* c */ x78 = f(y, "091"); /* c */ x78 = f(y, "092"); /* c */ x78 = f(y, "093"); /* c */ x78 = f(y, "094"); /* c */ x78 = f(y, "095"); /* c */ x78 = f(y, "096"); /* c */ x78 = f(y, "097"); /* c */ x78 = f(y, "098"); /* c */ x78 = f(y, "099"); /* c */ x78 = f(y, "100"); /* c */ x78 = f(y, "101"); /* c */ x78 = f(y, "102"); /* c */ x78 = f(y, "103"); /* c */ x78 = f(y, "104"); /* c */ x78 = f(y, "105"); /* c */ x78 = f(y, "106"); /* c */ x78 = f(y, "107"); /* c */ x78 = f(y, "108"); /* c */ x78 = f(y, "109"); /* c */ x78 = f(y, "110"); /* c */ x78 = f(y, "111"); /* c */ x78 = f(y, "112"); /* c */ x78 = f(y, "113"); /* c */ x78 = f(y, "114"); /* c */ x78 = f(y, "115"); /* c */ x78 = f(y, "116"); /* c */ x78 = f(y, "117"); /* c */ x78 = f(y, "118"); /* c */ x78 = f(y, "119"); /* c */ x78 = f(y, "120"); /* c */ x78 = f(y, "121"); /* c */ x78 = f(y, "122"); /* c */ x78 = f(y, "123"); /* c */ x78 = f(y, "124"); /* c */ x78 = f(y, "125"); /* c */ x78 = f(y, "126"); /* c */ x78 = f(y, "127"); /* c */ x78 = f(y, "128"); /* c */ x78 = f(y, "129"); /* c */ x78 = f(y, "130"); /* c */ x78 = f(y, "131"); /* c */ x78 = f(y, "132"); /* c */ x78 = f(y, "133"); /* c */ x78 = f(y, "134"); /* c */ x78 = f(y, "135"); /* c */ x78 = f(y, "136"); /* c */ x78 = f(y, "137"); /* c */ x78 = f(y, "138"); /* c */ x78 = f(y, "139"); /* c */ x78 = f(y, "140"); /* c */ x78 = f(y, "141"); /* c */ x78 = f(y, "142"); /* c */ x78 = f(y, "143"); /* c */ x78 = f(y, "144"); /* c */ x78 = f(y, "145"); /* c */ x78 = f(y, "146"); /* c */ x78 = f(y, "147"); /* c */ x78 = f(y, "148"); /* c */ x78 = f(y, "149"); /* c */ x78 = f(y, "150"); /* c */ x78 = f(y, "151"); /* c */ x78 = f(y, "152"); /* c */ x78 = f(y, "153"); /* c */ x78 = f(y, "154"); /* c */ x78 = f(y, "155"); /* c */ x78 = f(y, "156"); /* c */ x78 = f(y, "157"); /* c */ x78 = f(y, "158"); /* c */ x78 = f(y, "159"); /* c */ x78 = f(y, "160"); /* c */ x78 = f(y, "161"); /* c */ x78 = f(y, "162"); /* c */ x78 = f(y, "163"); /* c */ x78 = f(y, "164"); /* c */ x78 = f(y, "165"); /* c */ x78 = f(y, "166"); /* c */ x78 = f(y, "167"); /* c */ x78 = f(y, "168"); /* c */ x78 = f(y, "169"); /* c */ x78 = f(y, "170"); /* c */ x78 = f(y, "171"); /* c */ x78 = f(y, "172"); /* c */ x78 = f(y, "173"); /* c */ x78 = f(y, "174"); /* c */ x78 = f(y, "175"); /* c */ x78 = f(y, "176"); /* c */ x78 = f(y, "177"); /* c */ x78 = f(y, "178"); /* c */ x78 = f(y, "179"); /* c */ x78 = f(y, "180"); /* c */ x78 = f(y, "181"); /* c */ x78 = f(y, "182"); /* c */ x78 = f(y, "183"); /* c */ x78 = f(y, "184"); /* c */ x78 = f(y, "185"); /* c */ x78 = f(y, "186"); /* c */ x78 = f(y, "187"); /* c */ x78 = f(y, "188"); /* c */ x78 = f(y, "189"); /* c */ x78 = f(y, "190"); /* c */ x78 = f(y, "191"); /* c */ x78 = f(y, "192"); /* c */ x78 = f(y, "193"); /* c */ x78 = f(y, "194"); /* c */ x78 = f(y, "195"); /* c */ x78 = f(y, "196"); /* c */ x78 = f(y, "197"); /* c */ x78 = f(y, "198"); /* c */ x78 = f(y, "199"); /* c */ 
+x79 = f(y, "000"); /* c */ x79 = f(y, "001"); /* c */ x79 = f(y, "002"); /* c */ x79 = f(y, "003"); /* c */ x79 = f(y, "004"); /* c */ x79 = f(y, "005"); /* c */ x79 = f(y, "006"); /* c */ x79 = f(y, "007"); /* c */ x79 = f(y, "008"); /* c */ x79 = f(y, "009"); /* c */ x79 = f(y, "010"); /* c */ x79 = f(y, "011"); /* c */ x79 = f(y, "012"); /* c */ x79 = f(y, "013"); /* c */ x79 = f(y, "014"); /* c */ x79 = f(y, "015"); /* c */ x79 = f(y, "016"); /* c */ x79 = f(y, "017"); /* c */ x79 = f(y, "018"); /* c */ x79 = f(y, "019"); /* c */ x79 = f(y, "020"); /* c */ x79 = f(y, "021"); /* c */ x79 = f(y, "022"); /* c */ x79 = f(y, "023"); /* c */ x79 = f(y, "024"); /* c */ x79 = f(y, "025"); /* c */ x79 = f(y, "026"); /* c */ x79 = f(y, "027"); /* c */ x79 = f(y, "028"); /* c */ x79 = f(y, "029"); /* c */ x79 = f(y, "030"); /* c */ x79 = f(y, "031"); /* c */ x79 = f(y, "032"); /* c */ x79 = f(y, "033"); /* c */ x79 = f(y, "034"); /* c */ x79 = f(y, "035"); /* c */ x79 = f(y, "036"); /* c */ x79 = f(y, "037"); /* c */ x79 = f(y, "038"); /* c */ x79 = f(y, "039"); /* c */ x79 = f(y, "040"); /* c */ x79 = f(y, "041"); /* c */ x79 = f(y, "042"); /* c */ x79 = f(y, "043"); /* c */ x79 = f(y, "044"); /* c */ x79 = f(y, "045"); /* c */ x79 = f(y, "046"); /* c */ x79 = f(y, "047"); /* c */ x79 = f(y, "048"); /* c */ x79 = f(y, "049"); /* c */ x79 = f(y, "050"); /* c */ x79 = f(y, "051"); /* c */ x79 = f(y, "052"); /* c */ x79 = f(y, "053"); /* c */ x79 = f(y, "054"); /* c */ x79 = f(y, "055"); /* c */ x79 = f(y, "056"); /* c */ x79 = f(y, "057"); /* c */ x79 = f(y, "058"); /* c */ x79 = f(y, "059"); /* c */ x79 = f(y, "060"); /* c */ x79 = f(y, "061"); /* c */ x79 = f(y, "062"); /* c */ x79 = f(y, "063"); /* c */ x79 = f(y, "064"); /* c */ x79 = f(y, "065"); /* c */ x79 = f(y, "066"); /* c */ x79 = f(y, "067"); /* c */ x79 = f(y, "068"); /* c */ x79 = f(y, "069"); /* c */ x79 = f(y, "070"); /* c */ x79 = f(y, "071"); /* c */ x79 = f(y, "072"); /* c */ x79 = f(y, "073"); /* c */ x79 = f(y, "074"); /* c */ x79 = f(y, "075"); /* c */ x79 = f(y, "076"); /* c */ x79 = f(y, "077"); /* c */ x79 = f(y, "078"); /* c */ x79 = f(y, "079"); /* c */ x79 = f(y, "080"); /* c */ x79 = f(y, "081"); /* c */ x79 = f(y, "082"); /* c */ x79 = f(y, "083"); /* c */ x79 = f(y, "084"); /* c */ x79 = f(y, "085"); /* c */ x79 = f(y, "086"); /* c */ x79 = f(y, "087"); /* c */ x79 = f(y, "088"); /* c */ x79 = f(y, "089"); /* c */ x79 = f(y, "090"); /* c */ x79 = f(y, "091"); /* c */ x79 = f(y, "092"); /* c */ x79 = f(y, "093"); /* c */ x79 = f(y, "094"); /* c */ x79 = f(y, "095"); /* c */ x79 = f(y, "096"); /* c */ x79 = f(y, "097"); /* c */ x79 = f(y, "098"); /* c */ x79 = f(y, "099"); /* c */ x79 = f(y, "100"); /* c */ x79 = f(y, "101"); /* c */ x79 = f(y, "102"); /* c */ x79 = f(y, "103"); /* c */ x79 = f(y, "104"); /* c */ x79 = f(y, "105"); /* c */ x79 = f(y, "106"); /* c */ x79 = f(y, "107"); /* c */ x79 = f(y, "108"); /* c */ x79 = f(y, "109"); /* c */ x79 = f(y, "110"); /* c */ x79 = f(y, "111"); /* c */ x79 = f(y, "112"); /* c */ x79 = f(y, "113"); /* c */ x79 = f(y, "114"); /* c */ x79 = f(y, "115"); /* c */ x79 = f(y, "116"); /* c */ x79 = f(y, "117"); /* c */ x79 = f(y, "118"); /* c */ x79 = f(y, "119"); /* c */ x79 = f(y, "120"); /* c */ x79 = f(y, "121"); /* c */ x79 = f(y, "122"); /* c */ x79 = f(y, "123"); /* c */ x79 = f(y, "124"); /* c */ x79 = f(y, "125"); /* c */ x79 = f(y, "126"); /* c */ x79 = f(y, "127"); /* c */ x79 = f(y, "128"); /* c */ x79 = f(y, "129"); /* c */ x79 = f(y, "130"); /* c */ x79 = f(y, "131"); /* c */ x79 = f(y, "132"); /* c */ x79 = f(y, "133"); /* c */ x79 = f(y, "134"); /* c */ x79 = f(y, "135"); /* c */ x79 = f(y, "136"); /* c */ x79 = f(y, "137"); /* c */ x79 = f(y, "138"); /* c */ x79 = f(y, "139"); /* c */ x79 = f(y, "140"); /* c */ x79 = f(y, "141"); /* c */ x79 = f(y, "142"); /* c */ x79 = f(y, "143"); /* c */ x79 = f(y, "144"); /* c */ x79 = f(y, "145"); /* c */ x79 = f(y, "146"); /* c */ x79 = f(y, "147"); /* c */ x79 = f(y, "148"); /* c */ x79 = f(y, "149"); /* c */ x79 = f(y, "150"); /* c */ x79 = f(y, "151"); /* c */ x79 = f(y, "152"); /* c */ x79 = f(y, "153"); /* c */ x79 = f(y, "154"); /* c */ x79 = f(y, "155"); /* c */ x79 = f(y, "156"); /* c */ x79 = f(y, "157"); /* c */ x79 = f(y, "158"); /* c */ x79 = f(y, "159"); /* c */ x79 = f(y, "160"); /* c */ x79 = f(y, "161"); /* c */ x79 = f(y, "162"); /* c */ x79 = f(y, "163"); /* c */ x79 = f(y, "164"); /* c */ x79 = f(y, "165"); /* c */ x79 = f(y, "166"); /* c */ x79 = f(y, "167"); /* c */ x79 = f(y, "168"); /* c */ x79 = f(y, "169"); /* c */ x79 = f(y, "170"); /* c */ x79 = f(y, "171"); /* c */ x79 = f(y, "172"); /* c */ x79 = f(y, "173"); /* c */ x79 = f(y, "174"); /* c */ x79 = f(y, "175"); /* c */ x79 = f(y, "176"); /* c */ x79 = f(y, "177"); /* c */ x79 = f(y, "178"); /* c */ x79 = f(y, "179"); /* c */ x79 = f(y, "180"); /* c */ x79 = f(y, "181"); /* c */ x79 = f(y, "182"); /* c */ x79 = f(y, "183"); /* c */ x79 = f(y, "184"); /* c */ x79 = f(y, "185"); /* c */ x79 = f(y, "186"); /* c */ x79 = f(y, "187"); /* c */ x79 = f(y, "188"); /* c */ x79 = f(y, "189"); /* c */ x79 = f(y, "190"); /* c */ x79 = f(y, "191"); /* c */ x79 = f(y, "192"); /* c */ x79 = f(y, "193"); /* c */ x79 = f(y, "194"); /* c */ x79 = f(y, "195"); /* c */ x79 = f(y, "196"); /* c */ x79 = f(y, "197"); /* c */ x79 = f(y, "198"); /* c */ x79 = f(y, "199"); /* c */ 
+x80 = f(y, "000"); /* c */ x80 = f(y, "001"); /* c */ x80 = f(y, "002"); /* c */ x80 = f(y, "003"); /* c */ x80 = f(y, "004"); /* c */ x80 = f(y, "005"); /* c */ x80 = f(y, "006"); /* c */ x80 = f(y, "007"); /* c */ x80 = f(y, "008"); /* c */ x80 = f(y, "009"); /* c */ x80 = f(y, "010"); /* c */ x80 = f(y, "011"); /* c */ x80 = f(y, "012"); /* c */ x80 = f(y, "013"); /* c */ x80 = f(y, "014"); /* c */ x80 = f(y, "015"); /* c */ x80 = f(y, "016"); /* c */ x80 = f(y, "017"); /* c */ x80 = f(y, "018"); /* c */ x80 = f(y, "019"); /* c */ x80 = f(y, "020"); /* c */ x80 = f(y, "021"); /* c */ x80 = f(y, "022"); /* c */ x80 = f(y, "023"); /* c */ x80 = f(y, "024"); /* c */ x80 = f(y, "025"); /* c */ x80 = f(y, "026"); /* c */ x80 = f(y, "027"); /* c */ x80 = f(y, "028"); /* c */ x80 = f(y, "029"); /* c */ x80 = f(y, "030"); /* c */ x80 = f(y, "031"); /* c */ x80 = f(y, "032"); /* c */ x80 = f(y, "033"); /* c */ x80 = f(y, "034"); /* c */ x80 = f(y, "035"); /* c */ x80 = f(y, "036"); /* c */ x80 = f(y, "037"); /* c */ x80 = f(y, "038"); /* c */ x80 = f(y, "039"); /* c */ x80 = f(y, "040"); /* c */ x80 = f(y, "041"); /* c */ x80 = f(y, "042"); /* c */ x80 = f(y, "043"); /* c */ x80 = f(y, "044"); /* c */ x80 = f(y, "045"); /* c */ x80 = f(y, "046"); /* c */ x80 = f(y, "047"); /* c */ x80 = f(y, "048"); /* c */ x80 = f(y, "049"); /* c */ x80 = f(y, "050"); /* c */ x80 = f(y, "051"); /* c */ x80 = f(y, "052"); /* c */ x80 = f(y, "053"); /* c */ x80 = f(y, "054"); /* c */ x80 = f(y, "055"); /* c */ x80 = f(y, "056"); /* c */ x80 = f(y, "057"); /* c */ x80 = f(y, "058"); /* c */ x80 = f(y, "059"); /* c */ x80 = f(y, "060"); /* c */ x80 = f(y, "061"); /* c */ x80 = f(y, "062"); /* c */ x80 = f(y, "063"); /* c */ x80 = f(y, "064"); /* c */ x80 = f(y, "065"); /* c */ x80 = f(y, "066"); /* c */ x80 = f(y, "067"); /* c */ x80 = f(y, "068"); /* c */ x80 = f(y, "069"); /* c */ x80 = f(y, "070"); /* c */ x80 = f(y, "071"); /* c */ x80 = f(y, "072"); /* c */ x80 = f(y, "073"); /* c */ x80 = f(y, "074"); /* c */ x80 = f(y, "075"); /* c */ x80 = f(y, "076"); /* c */ x80 = f(y, "077"); /* c */ x80 = f(y, "078"); /* c */ x80 = f(y, "079"); /* c */ x80 = f(y, "080"); /* c */ x80 = f(y, "081"); /* c */ x80 = f(y, "082"); /* c */ x80 = f(y, "083"); /* c */ x80 = f(y, "084"); /* c */ x80 = f(y, "085"); /* c */ x80 = f(y, "086"); /* c */ x80 = f(y, "087"); /* c */ x80 = f(y, "088"); /* c */ x80 = f(y, "089"); /* c */ x80 = f(y, "090"); /* c */ x80 = f(y, "091"); /* c */ x80 = f(y, "092"); /* c */ x80 = f(y, "093"); /* c */ x80 = f(y, "094"); /* c */ x80 = f(y, "095"); /* c */ x80 = f(y, "096"); /* c */ x80 = f(y, "097"); /* c */ x80 = f(y, "098"); /* c */ x80 = f(y, "099"); /* c */ x80 = f(y, "100"); /* c */ x80 = f(y, "101"); /* c */ x80 = f(y, "102"); /* c */ x80 = f(y, "103"); /* c */ x80 = f(y, "104"); /* c */ x80 = f(y, "105"); /* c */ x80 = f(y, "106"); /* c */ x80 = f(y, "107"); /* c */ x80 = f(y, "108"); /* c */ x80 = f(y, "109"); /* c */ x80 = f(y, "110"); /* c */ x80 = f(y, "111"); /* c */ x80 = f(y, "112"); /* c */ x80 = f(y, "113"); /* c */ x80 = f(y, "114"); /* c */ x80 = f(y, "115"); /* c */ x80 = f(y, "116"); /* c */ x80 = f(y, "117"); /* c */ x80 = f(y, "118"); /* c */ x80 = f(y, "119"); /* c */ x80 = f(y, "120"); /* c */ x80 = f(y, "121"); /* c */ x80 = f(y, "122"); /* c */ x80 = f(y, "123"); /* c */ x80 = f(y, "124"); /* c */ x80 = f(y, "125"); /* c */ x80 = f(y, "126"); /* c */ x80 = f(y, "127"); /* c */ x80 = f(y, "128"); /* c */ x80 = f(y, "129"); /* c */ x80 = f(y, "130"); /* c */ x80 = f(y, "131"); /* c */ x80 = f(y, "132"); /* c */ x80 = f(y, "133"); /* c */ x80 = f(y, "134"); /* c */ x80 = f(y, "135"); /* c */ x80 = f(y, "136"); /* c */ x80 = f(y, "137"); /* c */ x80 = f(y, "138"); /* c */ x80 = f(y, "139"); /* c */ x80 = f(y, "140"); /* c */ x80 = f(y, "141"); /* c */ x80 = f(y, "142"); /* c */ x80 = f(y, "143"); /* c */ x80 = f(y, "144"); /* c */ x80 = f(y, "145"); /* c */ x80 = f(y, "146"); /* c */ x80 = f(y, "147"); /* c */ x80 = f(y, "148"); /* c */ x80 = f(y, "149"); /* c */ x80 = f(y, "150"); /* c */ x80 = f(y, "151"); /* c */ x80 = f(y, "152"); /* c */ x80 = f(y, "153"); /* c */ x80 = f(y, "154"); /* c */ x80 = f(y, "155"); /* c */ x80 = f(y, "156"); /* c */ x80 = f(y, "157"); /* c */ x80 = f(y, "158"); /* c */ x80 = f(y, "159"); /* c */ x80 = f(y, "160"); /* c */ x80 = f(y, "161"); /* c */ x80 = f(y, "162"); /* c */ x80 = f(y, "163"); /* c */ x80 = f(y, "164"); /* c */ x80 = f(y, "165"); /* c */ x80 = f(y, "166"); /* c */ x80 = f(y, "167"); /* c */ x80 = f(y, "168"); /* c */ x80 = f(y, "169"); /* c */ x80 = f(y, "170"); /* c */ x80 = f(y, "171"); /* c */ x80 = f(y, "172"); /* c */ x80 = f(y, "173"); /* c */ x80 = f(y, "174"); /* c */ x80 = f(y, "175"); /* c */ x80 = f(y, "176"); /* c */ x80 = f(y, "177"); /* c */ x80 = f(y, "178"); /* c */ x80 = f(y, "179"); /* c */ x80 = f(y, "180"); /* c */ x80 = f(y, "181"); /* c */ x80 = f(y, "182"); /* c */ x80 = f(y, "183"); /* c */ x80 = f(y, "184"); /* c */ x80 = f(y, "185"); /* c */ x80 = f(y, "186"); /* c */ x80 = f(y, "187"); /* c */ x80 = f(y, "188"); /* c */ x80 = f(y, "189"); /* c */ x80 = f(y, "190"); /* c */ x80 = f(y, "191"); /* c */ x80 = f(y, "192"); /* c */ x80 = f(y, "193"); /* c */ x80 = f(y, "194"); /* c */ x80 = f(y, "195"); /* c */ x80 = f(y, "196"); /* c */ x80 = f(y, "197"); /* c */ x80 = f(y, "198"); /* c */ x80 = f(y, "199"); /* c */ 
+x81 = f(y, "000"); /* c */ x81 = f(y, "001"); /* c */ x81 = f(y, "002"); /* c */ x81 = f(y, "003"); /* c */ x81 = f(y, "004"); /* c */ x81 = f(y, "005"); /* c */ x81 = f(y, "006"); /* c */ x81 = f(y, "007"); /* c */ x81 = f(y, "008"); /* c */ x81 = f(y, "009"); /* c */ x81 = f(y, "010"); /* c */ x81 = f(y, "011"); /* c */ x81 = f(y, "012"); /* c */ x81 = f(y, "013"); /* c */ x81 = f(y, "014"); /* c */ x81 = f(y, "015"); /* c */ x81 = f(y, "016"); /* c */ x81 = f(y, "017"); /* c */ x81 = f(y, "018"); /* c */ x81 = f(y, "019"); /* c */ x81 = f(y, "020"); /* c */ x81 = f(y, "021"); /* c */ x81 = f(y, "022"); /* c */ x81 = f(y, "023"); /* c */ x81 = f(y, "024"); /* c */ x81 = f(y, "025"); /* c */ x81 = f(y, "026"); /* c */ x81 = f(y, "027"); /* c */ x81 = f(y, "028"); /* c */ x81 = f(y, "029"); /* c */ x81 = f(y, "030"); /* c */ x81 = f(y, "031"); /* c */ x81 = f(y, "032"); /* c */ x81 = f(y, "033"); /* c */ x81 = f(y, "034"); /* c */ x81 = f(y, "035"); /* c */ x81 = f(y, "036"); /* c */ x81 = f(y, "037"); /* c */ x81 = f(y, "038"); /* c */ x81 = f(y, "039"); /* c */ x81 = f(y, "040"); /* c */ x81 = f(y, "041"); /* c */ x81 = f(y, "042"); /* c */ x81 = f(y, "043"); /* c */ x81 = f(y, "044"); /* c */ x81 = f(y, "045"); /* c */ x81 = f(y, "046"); /* c */ x81 = f(y, "047"); /* c */ x81 = f(y, "048"); /* c */ x81 = f(y, "049"); /* c */ x81 = f(y, "050"); /* c */ x81 = f(y, "051"); /* c */ x81 = f(y, "052"); /* c */ x81 = f(y, "053"); /* c */ x81 = f(y, "054"); /* c */ x81 = f(y, "055"); /* c */ x81 = f(y, "056"); /* c */ x81 = f(y, "057"); /* c */ x81 = f(y, "058"); /* c */ x81 = f(y, "059"); /* c */ x81 = f(y, "060"); /* c */ x81 = f(y, "061"); /* c */ x81 = f(y, "062"); /* c */ x81 = f(y, "063"); /* c */ x81 = f(y, "064"); /* c */ x81 = f(y, "065"); /* c */ x81 = f(y, "066"); /* c */ x81 = f(y, "067"); /* c */ x81 = f(y, "068"); /* c */ x81 = f(y, "069"); /* c */ x81 = f(y, "070"); /* c */ x81 = f(y, "071"); /* c */ x81 = f(y, "072"); /* c */ x81 = f(y, "073"); /* c */ x81 = f(y, "074"); /* c */ x81 = f(y, "075"); /* c */ x81 = f(y, "076"); /* c */ x81 = f(y, "077"); /* c */ x81 = f(y, "078"); /* c */ x81 = f(y, "079"); /* c */ x81 = f(y, "080"); /* c */ x81 = f(y, "081"); /* c */ x81 = f(y, "082"); /* c */ x81 = f(y, "083"); /* c */ x81 = f(y, "084"); /* c */ x81 = f(y, "085"); /* c */ x81 = f(y, "086"); /* c */ x81 = f(y, "087"); /* c */ x81 = f(y, "088"); /* c */ x81 = f(y, "089"); /* c */ x81 = f(y, "090"); /* c */ x81 = f(y, "091"); /* c */ x81 = f(y, "092"); /* c */ x81 = f(y, "093"); /* c */ x81 = f(y, "094"); /* c */ x81 = f(y, "095"); /* c */ x81 = f(y, "096"); /* c */ x81 = f(y, "097"); /* c */ x81 = f(y, "098"); /* c */ x81 = f(y, "099"); /* c */ x81 = f(y, "100"); /* c */ x81 = f(y, "101"); /* c */ x81 = f(y, "102"); /* c */ x81 = f(y, "103"); /* c */ x81 = f(y, "104"); /* c */ x81 = f(y, "105"); /* c */ x81 = f(y, "106"); /* c */ x81 = f(y, "107"); /* c */ x81 = f(y, "108"); /* c */ x81 = f(y, "109"); /* c */ x81 = f(y, "110"); /* c */ x81 = f(y, "111"); /* c */ x81 = f(y, "112"); /* c */ x81 = f(y, "113"); /* c */ x81 = f(y, "114"); /* c */ x81 = f(y, "115"); /* c */ x81 = f(y, "116"); /* c */ x81 = f(y, "117"); /* c */ x81 = f(y, "118"); /* c */ x81 = f(y, "119"); /* c */ x81 = f(y, "120"); /* c */ x81 = f(y, "121"); /* c */ x81 = f(y, "122"); /* c */ x81 = f(y, "123"); /* c */ x81 = f(y, "124"); /* c */ x81 = f(y, "125"); /* c */ x81 = f(y, "126"); /* c */ x81 = f(y, "127"); /* c */ x81 = f(y, "128"); /* c */ x81 = f(y, "129"); /* c */ x81 = f(y, "130"); /* c */ x81 = f(y, "131"); /* c */ x81 = f(y, "132"); /* c */ x81 = f(y, "133"); /* c */ x81 = f(y, "134"); /* c */ x81 = f(y, "135"); /* c */ x81 = f(y, "136"); /* c */ x81 = f(y, "137"); /* c */ x81 = f(y, "138"); /* c */ x81 = f(y, "139"); /* c */ x81 = f(y, "140"); /* c */ x81 = f(y, "141"); /* c */ x81 = f(y, "142"); /* c */ x81 = f(y, "143"); /* c */ x81 = f(y, "144"); /* c */ x81 = f(y, "145"); /* c */ x81 = f(y, "146"); /* c */ x81 = f(y, "147"); /* c */ x81 = f(y, "148"); /* c */ x81 = f(y, "149"); /* c */ x81 = f(y, "150"); /* c */ x81 = f(y, "151"); /* c */ x81 = f(y, "152"); /* c */ x81 = f(y, "153"); /* c */ x81 = f(y, "154"); /* c */ x81 = f(y, "155"); /* c */ x81 = f(y, "156"); /* c */ x81 = f(y, "157"); /* c */ x81 = f(y, "158"); /* c */ x81 = f(y, "159"); /* c */ x81 = f(y, "160"); /* c */ x81 = f(y, "161"); /* c */ x81 = f(y, "162"); /* c */ x81 = f(y, "163"); /* c */ x81 = f(y, "164"); /* c */ x81 = f(y, "165"); /* c */ x81 = f(y, "166"); /* c */ x81 = f(y, "167"); /* c */ x81 = f(y, "168"); /* c */ x81 = f(y, "169"); /* c */ x81 = f(y, "170"); /* c */ x81 = f(y, "171"); /* c */ x81 = f(y, "172"); /* c */ x81 = f(y, "173"); /* c */ x81 = f(y, "174"); /* c */ x81 = f(y, "175"); /* c */ x81 = f(y, "176"); /* c */ x81 = f(y, "177"); /* c */ x81 = f(y, "178"); /* c */ x81 = f(y, "179"); /* c */ x81 = f(y, "180"); /* c */ x81 = f(y, "181"); /* c */ x81 = f(y, "182"); /* c */ x81 = f(y, "183"); /* c */ x81 = f(y, "184"); /* c */ x81 = f(y, "185"); /* c */ x81 = f(y, "186"); /* c */ x81 = f(y, "187"); /* c */ x81 = f(y, "188"); /* c */ x81 = f(y, "189"); /* c */ x81 = f(y, "190"); /* c */ x81 = f(y, "191"); /* c */ x81 = f(y, "192"); /* c */ x81 = f(y, "193"); /* c */ x81 = f(y, "194"); /* c */ x81 = f(y, "195"); /* c */ x81 = f(y, "196"); /* c */ x81 = f(y, "197"); /* c */ x81 = f(y, "198"); /* c */ x81 = f(y, "199"); /* c */ 
+x82 = f(y, "000"); /* c */ x82 = f(y, "001"); /* c */ x82 = f(y, "002"); /* c */ x82 = f(y, "003"); /* c */ x82 = f(y, "004"); /* c */ x82 = f(y, "005"); /* c */ x82 = f(y, "006"); /* c */ x82 = f(y, "007"); /* c */ x82 = f(y, "008"); /* c */ x82 = f(y, "009"); /* c */ x82 = f(y, "010"); /* c */ x82 = f(y, "011"); /* c */ x82 = f(y, "012"); /* c */ x82 = f(y, "013"); /* c */ x82 = f(y, "014"); /* c */ x82 = f(y, "015"); /* c */ x82 = f(y, "016"); /* c */ x82 = f(y, "017"); /* c */ x82 = f(y, "018"); /* c */ x82 = f(y, "019"); /* c */ x82 = f(y, "020"); /* c */ x82 = f(y, "021"); /* c */ x82 = f(y, "022"); /* c */ x82 = f(y, "023"); /* c */ x82 = f(y, "024"); /* c */ x82 = f(y, "025"); /* c */ x82 = f(y, "026"); /* c */ x82 = f(y, "027"); /* c */ x82 = f(y, "028"); /* c */ x82 = f(y, "029"); /* c */ x82 = f(y, "030"); /* c */ x82 = f(y, "031"); /* c */ x82 = f(y, "032"); /* c */ x82 = f(y, "033"); /* c */ x82 = f(y, "034"); /* c */ x82 = f(y, "035"); /* c */ x82 = f(y, "036"); /* c */ x82 = f(y, "037"); /* c */ x82 = f(y, "038"); /* c */ x82 = f(y, "039"); /* c */ x82 = f(y, "040"); /* c */ x82 = f(y, "041"); /* c */ x82 = f(y, "042"); /* c */ x82 = f(y, "043"); /* c */ x82 = f(y, "044"); /* c */ x82 = f(y, "045"); /* c */ x82 = f(y, "046"); /* c */ x82 = f(y, "047"); /* c */ x82 = f(y, "048"); /* c */ x82 = f(y, "049"); /* c */ x82 = f(y, "050"); /* c */ x82 = f(y, "051"); /* c */ x82 = f(y, "052"); /* c */ x82 = f(y, "053"); /* c */ x82 = f(y, "054"); /* c */ x82 = f(y, "055"); /* c */ x82 = f(y, "056"); /* c */ x82 = f(y, "057"); /* c */ x82 = f(y, "058"); /* c */ x82 = f(y, "059"); /* c */ x82 = f(y, "060"); /* c */ x82 = f(y, "061"); /* c */ x82 = f(y, "062"); /* c */ x82 = f(y, "063"); /* c */ x82 = f(y, "064"); /* c */ x82 = f(y, "065"); /* c */ x82 = f(y, "066"); /* c */ x82 = f(y, "067"); /* c */ x82 = f(y, "068"); /* c */ x82 = f(y, "069"); /* c */ x82 = f(y, "070"); /* c */ x82 = f(y, "071"); /* c */ x82 = f(y, "072"); /* c */ x82 = f(y, "073"); /* c */ x82 = f(y, "074"); /* c */ x82 = f(y, "075"); /* c */ x82 = f(y, "076"); /* c */ x82 = f(y, "077"); /* c */ x82 = f(y, "078"); /* c */ x82 = f(y, "079"); /* c */ x82 = f(y, "080"); /* c */ x82 = f(y, "081"); /* c */ x82 = f(y, "082"); /* c */ x82 = f(y, "083"); /* c */ x82 = f(y, "084"); /* c */ x82 = f(y, "085"); /* c */ x82 = f(y, "086"); /* c */ x82 = f(y, "087"); /* c */ x82 = f(y, "088"); /* c */ x82 = f(y, "089"); /* c */ x82 = f(y, "090"); /* c */ x82 = f(y, "091"); /* c */ x82 = f(y, "092"); /* c */ x82 = f(y, "093"); /* c */ x82 = f(y, "094"); /* c */ x82 = f(y, "095"); /* c */ x82 = f(y, "096"); /* c */ x82 = f(y, "097"); /* c */ x82 = f(y, "098"); /* c */ x82 = f(y, "099"); /* c */ x82 = f(y, "100"); /* c */ x82 = f(y, "101"); /* c */ x82 = f(y, "102"); /* c */ x82 = f(y, "103"); /* c */ x82 = f(y, "104"); /* c */ x82 = f(y, "105"); /* c */ x82 = f(y, "106"); /* c */ x82 = f(y, "107"); /* c */ x82 = f(y, "108"); /* c */ x82 = f(y, "109"); /* c */ x82 = f(y, "110"); /* c */ x82 = f(y, "111"); /* c */ x82 = f(y, "112"); /* c */ x82 = f(y, "113"); /* c */ x82 = f(y, "114"); /* c */ x82 = f(y, "115"); /* c */ x82 = f(y, "116"); /* c */ x82 = f(y, "117"); /* c */ x82 = f(y, "118"); /* c */ x82 = f(y, "119"); /* c */ x82 = f(y, "120"); /* c */ x82 = f(y, "121"); /* c */ x82 = f(y, "122"); /* c */ x82 = f(y, "123"); /* c */ x82 = f(y, "124"); /* c */ x82 = f(y, "125"); /* c */ x82 = f(y, "126"); /* c */ x82 = f(y, "127"); /* c */ x82 = f(y, "128"); /* c */ x82 = f(y, "129"); /* c */ x82 = f(y, "130"); /* c */ x82 = f(y, "131"); /* c */ x82 = f(y, "132"); /* c */ x82 = f(y, "133"); /* c */ x82 = f(y, "134"); /* c */ x82 = f(y, "135"); /* c */ x82 = f(y, "136"); /* c */ x82 = f(y, "137"); /* c */ x82 = f(y, "138"); /* c */ x82 = f(y, "139"); /* c */ x82 = f(y, "140"); /* c */ x82 = f(y, "141"); /* c */ x82 = f(y, "142"); /* c */ x82 = f(y, "143"); /* c */ x82 = f(y, "144"); /* c */ x82 = f(y, "145"); /* c */ x82 = f(y, "146"); /* c */ x82 = f(y, "147"); /* c */ x82 = f(y, "148"); /* c */ x82 = f(y, "149"); /* c */ x82 = f(y, "150"); /* c */ x82 = f(y, "151"); /* c */ x82 = f(y, "152"); /* c */ x82 = f(y, "153"); /* c */ x82 = f(y, "154"); /* c */ x82 = f(y, "155"); /* c */ x82 = f(y, "156"); /* c */ x82 = f(y, "157"); /* c */ x82 = f(y, "158"); /* c */ x82 = f(y, "159"); /* c */ x82 = f(y, "160"); /* c */ x82 = f(y, "161"); /* c */ x82 = f(y, "162"); /* c */ x82 = f(y, "163"); /* c */ x82 = f(y, "164"); /* c */ x82 = f(y, "165"); /* c */ x82 = f(y, "166"); /* c */ x82 = f(y, "167"); /* c */ x82 = f(y, "168"); /* c */ x82 = f(y, "169"); /* c */ x82 = f(y, "170"); /* c */ x82 = f(y, "171"); /* c */ x82 = f(y, "172"); /* c */ x82 = f(y, "173"); /* c */ x82 = f(y, "174"); /* c */ x82 = f(y, "175"); /* c */ x82 = f(y, "176"); /* c */ x82 = f(y, "177"); /* c */ x82 = f(y, "178"); /* c */ x82 = f(y, "179"); /* c */ x82 = f(y, "180"); /* c */ x82 = f(y, "181"); /* c */ x82 = f(y, "182"); /* c */ x82 = f(y, "183"); /* c */ x82 = f(y, "184"); /* c */ x82 = f(y, "185"); /* c */ x82 = f(y, "186"); /* c */ x82 = f(y, "187"); /* c */ x82 = f(y, "188"); /* c */ x82 = f(y, "189"); /* c */ x82 = f(y, "190"); /* c */ x82 = f(y, "191"); /* c */ x82 = f(y, "192"); /* c */ x82 = f(y, "193"); /* c */ x82 = f(y, "194"); /* c */ x82 = f(y, "195"); /* c */ x82 = f(y, "196"); /* c */ x82 = f(y, "197"); /* c */ x82 = f(y, "198"); /* c */ x82 = f(y, "199"); /* c */ 
+x83 = f(y, "000"); /* c */ x83 = f(y, "001"); /* c */ x83 = f(y, "002"); /* c */ x83 = f(y, "003"); /* c */ x83 = f(y, "004"); /* c */ x83 = f(y, "005"); /* c */ x83 = f(y, "006"); /* c */ x83 = f(y, "007"); /* c */ x83 = f(y, "008"); /* c */ x83 = f(y, "009"); /* c */ x83 = f(y, "010"); /* c */ x83 = f(y, "011"); /* c */ x83 = f(y, "012"); /* c */ x83 = f(y, "013"); /* c */ x83 = f(y, "014"); /* c */ x83 = f(y, "015"); /* c */ x83 = f(y, "016"); /* c */ x83 = f(y, "017"); /* c */ x83 = f(y, "018"); /* c */ x83 = f(y, "019"); /* c */ x83 = f(y, "020"); /* c */ x83 = f(y, "021"); /* c */ x83 = f(y, "022"); /* c */ x83 = f(y, "023"); /* c */ x83 = f(y, "024"); /* c */ x83 = f(y, "025"); /* c */ x83 = f(y, "026"); /* c */ x83 = f(y, "027"); /* c */ x83 = f(y, "028"); /* c */ x83 = f(y, "029"); /* c */ x83 = f(y, "030"); /* c */ x83 = f(y, "031"); /* c */ x83 = f(y, "032"); /* c */ x83 = f(y, "033"); /* c */ x83 = f(y, "034"); /* c */ x83 = f(y, "035"); /* c */ x83 = f(y, "036"); /* c */ x83 = f(y, "037"); /* c */ x83 = f(y, "038"); /* c */ x83 = f(y, "039"); /* c */ x83 = f(y, "040"); /* c */ x83 = f(y, "041"); /* c */ x83 = f(y, "042"); /* c */ x83 = f(y, "043"); /* c */ x83 = f(y, "044"); /* c */ x83 = f(y, "045"); /* c */ x83 = f(y, "046"); /* c */ x83 = f(y, "047"); /* c */ x83 = f(y, "048"); /* c */ x83 = f(y, "049"); /* c */ x83 = f(y, "050"); /* c */ x83 = f(y, "051"); /* c */ x83 = f(y, "052"); /* c */ x83 = f(y, "053"); /* c */ x83 = f(y, "054"); /* c */ x83 = f(y, "055"); /* c */ x83 = f(y, "056"); /* c */ x83 = f(y, "057"); /* c */ x83 = f(y, "058"); /* c */ x83 = f(y, "059"); /* c */ x83 = f(y, "060"); /* c */ x83 = f(y, "061"); /* c */ x83 = f(y, "062"); /* c */ x83 = f(y, "063"); /* c */ x83 = f(y, "064"); /* c */ x83 = f(y, "065"); /* c */ x83 = f(y, "066"); /* c */ x83 = f(y, "067"); /* c */ x83 = f(y, "068"); /* c */ x83 = f(y, "069"); /* c */ x83 = f(y, "070"); /* c */ x83 = f(y, "071"); /* c */ x83 = f(y, "072"); /* c */ x83 = f(y, "073"); /* c */ x83 = f(y, "074"); /* c */ x83 = f(y, "075"); /* c */ x83 = f(y, "076"); /* c */ x83 = f(y, "077"); /* c */ x83 = f(y, "078"); /* c */ x83 = f(y, "079"); /* c */ x83 = f(y, "080"); /* c */ x83 = f(y, "081"); /* c */ x83 = f(y, "082"); /* c */ x83 = f(y, "083"); /* c */ x83 = f(y, "084"); /* c */ x83 = f(y, "085"); /* c */ x83 = f(y, "086"); /* c */ x83 = f(y, "087"); /* c */ x83 = f(y, "088"); /* c */ x83 = f(y, "089"); /* c */ x83 = f(y, "090"); /* c */ x83 = f(y, "091"); /* c */ x83 = f(y, "092"); /* c */ x83 = f(y, "093"); /* c */ x83 = f(y, "094"); /* c */ x83 = f(y, "095"); /* c */ x83 = f(y, "096"); /* c */ x83 = f(y, "097"); /* c */ x83 = f(y, "098"); /* c */ x83 = f(y, "099"); /* c */ x83 = f(y, "100"); /* c */ x83 = f(y, "101"); /* c */ x83 = f(y, "102"); /* c */ x83 = f(y, "103"); /* c */ x83 = f(y, "104"); /* c */ x83 = f(y, "105"); /* c */ x83 = f(y, "106"); /* c */ x83 = f(y, "107"); /* c */ x83 = f(y, "108"); /* c */ x83 = f(y, "109"); /* c */ x83 = f(y, "110"); /* c */ x83 = f(y, "111"); /* c */ x83 = f(y, "112"); /* c */ x83 = f(y, "113"); /* c */ x83 = f(y, "114"); /* c */ x83 = f(y, "115"); /* c */ x83 = f(y, "116"); /* c */ x83 = f(y, "117"); /* c */ x83 = f(y, "118"); /* c */ x83 = f(y, "119"); /* c */ x83 = f(y, "120"); /* c */ x83 = f(y, "121"); /* c */ x83 = f(y, "122"); /* c */ x83 = f(y, "123"); /* c */ x83 = f(y, "124"); /* c */ x83 = f(y, "125"); /* c */ x83 = f(y, "126"); /* c */ x83 = f(y, "127"); /* c */ x83 = f(y, "128"); /* c */ x83 = f(y, "129"); /* c */ x83 = f(y, "130"); /* c */ x83 = f(y, "131"); /* c */ x83 = f(y, "132"); /* c */ x83 = f(y, "133"); /* c */ x83 = f(y, "134"); /* c */ x83 = f(y, "135"); /* c */ x83 = f(y, "136"); /* c */ x83 = f(y, "137"); /* c */ x83 = f(y, "138"); /* c */ x83 = f(y, "139"); /* c */ x83 = f(y, "140"); /* c */ x83 = f(y, "141"); /* c */ x83 = f(y, "142"); /* c */ x83 = f(y, "143"); /* c */ x83 = f(y, "144"); /* c */ x83 = f(y, "145"); /* c */ x83 = f(y, "146"); /* c */ x83 = f(y, "147"); /* c */ x83 = f(y, "148"); /* c */ x83 = f(y, "149"); /* c */ x83 = f(y, "150"); /* c */ x83 = f(y, "151"); /* c */ x83 = f(y, "152"); /* c */ x83 = f(y, "153"); /* c */ x83 = f(y, "154"); /* c */ x83 = f(y, "155"); /* c */ x83 = f(y, "156"); /* c */ x83 = f(y, "157"); /* c */ x83 = f(y, "158"); /* c */ x83 = f(y, "159"); /* c */ x83 = f(y, "160"); /* c */ x83 = f(y, "161"); /* c */ x83 = f(y, "162"); /* c */ x83 = f(y, "163"); /* c */ x83 = f(y, "164"); /* c */ x83 = f(y, "165"); /* c */ x83 = f(y, "166"); /* c */ x83 = f(y, "167"); /* c */ x83 = f(y, "168"); /* c */ x83 = f(y, "169"); /* c */ x83 = f(y, "170"); /* c */ x83 = f(y, "171"); /* c */ x83 = f(y, "172"); /* c */ x83 = f(y, "173"); /* c */ x83 = f(y, "174"); /* c */ x83 = f(y, "175"); /* c */ x83 = f(y, "176"); /* c */ x83 = f(y, "177"); /* c */ x83 = f(y, "178"); /* c */ x83 = f(y, "179"); /* c */ x83 = f(y, "180"); /* c */ x83 = f(y, "181"); /* c */ x83 = f(y, "182"); /* c */ x83 = f(y, "183"); /* c */ x83 = f(y, "184"); /* c */ x83 = f(y, "185"); /* c */ x83 = f(y, "186"); /* c */ x83 = f(y, "187"); /* c */ x83 = f(y, "188"); /* c */ x83 = f(y, "189"); /* c */ x83 = f(y, "190"); /* c */ x83 = f(y, "191"); /* c */ x83 = f(y, "192"); /* c */ x83 = f(y, "193"); /* c */ x83 = f(y, "194"); /* c */ x83 = f(y, "195"); /* c */ x83 = f(y, "196"); /* c */ x83 = f(y, "197"); /* c */ x83 = f(y, "198"); /* c */ x83 = f(y, "199"); /* c */ 
+x84 = f(y, "000"); /* c */ x84 = f(y, "001"); /* c */ x84 = f(y, "002"); /* c */ x84 = f(y, "003"); /* c */ x84 = f(y, "004"); /* c */ x84 = f(y, "005"); /* c */ x84 = f(y, "006"); /* c */ x84 = f(y, "007"); /* c */ x84 = f(y, "008"); /* c */ x84 = f(y, "009"); /* c */ x84 = f(y, "010"); /* c */ x84 = f(y, "011"); /* c */ x84 = f(y, "012"); /* c */ x84 = f(y, "013"); /* c */ x84 = f(y, "014"); /* c */ x84 = f(y, "015"); /* c */ x84 = f(y, "016"); /* c */ x84 = f(y, "017"); /* c */ x84 = f(y, "018"); /* c */ x84 = f(y, "019"); /* c */ x84 = f(y, "020"); /* c */ x84 = f(y, "021"); /* c */ x84 = f(y, "022"); /* c */ x84 = f(y, "023"); /* c */ x84 = f(y, "024"); /* c */ x84 = f(y, "025"); /* c */ x84 = f(y, "026"); /* c */ x84 = f(y, "027"); /* c */ x84 = f(y, "028"); /* c */ x84 = f(y, "029"); /* c */ x84 = f(y, "030"); /* c */ x84 = f(y, "031"); /* c */ x84 = f(y, "032"); /* c */ x84 = f(y, "033"); /* c */ x84 = f(y, "034"); /* c */ x84 = f(y, "035"); /* c */ x84 = f(y, "036"); /* c */ x84 = f(y, "037"); /* c */ x84 = f(y, "038"); /* c */ x84 = f(y, "039"); /* c */ x84 = f(y, "040"); /* c */ x84 = f(y, "041"); /* c */ x84 = f(y, "042"); /* c */ x84 = f(y, "043"); /* c */ x84 = f(y, "044"); /* c */ x84 = f(y, "045"); /* c */ x84 = f(y, "046"); /* c */ x84 = f(y, "047"); /* c */ x84 = f(y, "048"); /* c */ x84 = f(y, "049"); /* c */ x84 = f(y, "050"); /* c */ x84 = f(y, "051"); /* c */ x84 = f(y, "052"); /* c */ x84 = f(y, "053"); /* c */ x84 = f(y, "054"); /* c */ x84 = f(y, "055"); /* c */ x84 = f(y, "056"); /* c */ x84 = f(y, "057"); /* c */ x84 = f(y, "058"); /* c */ x84 = f(y, "059"); /* c */ x84 = f(y, "060"); /* c */ x84 = f(y, "061"); /* c */ x84 = f(y, "062"); /* c */ x84 = f(y, "063"); /* c */ x84 = f(y, "064"); /* c */ x84 = f(y, "065"); /* c */ x84 = f(y, "066"); /* c */ x84 = f(y, "067"); /* c */ x84 = f(y, "068"); /* c */ x84 = f(y, "069"); /* c */ x84 = f(y, "070"); /* c */ x84 = f(y, "071"); /* c */ x84 = f(y, "072"); /* c */ x84 = f(y, "073"); /* c */ x84 = f(y, "074"); /* c */ x84 = f(y, "075"); /* c */ x84 = f(y, "076"); /* c */ x84 = f(y, "077"); /* c */ x84 = f(y, "078"); /* c */ x84 = f(y, "079"); /* c */ x84 = f(y, "080"); /* c */ x84 = f(y, "081"); /* c */ x84 = f(y, "082"); /* c */ x84 = f(y, "083"); /* c */ x84 = f(y, "084"); /* c */ x84 = f(y, "085"); /* c */ x84 = f(y, "086"); /* c */ x84 = f(y, "087"); /* c */ x84 = f(y, "088"); /* c */ x84 = f(y, "089"); /* c */ x84 = f(y, "090"); /* c */ x84 = f(y, "091"); /* c */ x84 = f(y, "092"); /* c */ x84 = f(y, "093"); /* c */ x84 = f(y, "094"); /* c */ x84 = f(y, "095"); /* c */ x84 = f(y, "096"); /* c */ x84 = f(y, "097"); /* c */ x84 = f(y, "098"); /* c */ x84 = f(y, "099"); /* c */ x84 = f(y, "100"); /* c */ x84 = f(y, "101"); /* c */ x84 = f(y, "102"); /* c */ x84 = f(y, "103"); /* c */ x84 = f(y, "104"); /* c */ x84 = f(y, "105"); /* c */ x84 = f(y, "106"); /* c */ x84 = f(y, "107"); /* c */ x84 = f(y, "108"); /* c */ x84 = f(y, "109"); /* c */ x84 = f(y, "110"); /* c */ x84 = f(y, "111"); /* c */ x84 = f(y, "112"); /* c */ x84 = f(y, "113"); /* c */ x84 = f(y, "114"); /* c */ x84 = f(y, "115"); /* c */ x84 = f(y, "116"); /* c */ x84 = f(y, "117"); /* c */ x84 = f(y, "118"); /* c */ x84 = f(y, "119"); /* c */ x84 = f(y, "120"); /* c */ x84 = f(y, "121"); /* c */ x84 = f(y, "122"); /* c */ x84 = f(y, "123"); /* c */ x84 = f(y, "124"); /* c */ x84 = f(y, "125"); /* c */ x84 = f(y, "126"); /* c */ x84 = f(y, "127"); /* c */ x84 = f(y, "128"); /* c */ x84 = f(y, "129"); /* c */ x84 = f(y, "130"); /* c */ x84 = f(y, "131"); /* c */ x84 = f(y, "132"); /* c */ x84 = f(y, "133"); /* c */ x84 = f(y, "134"); /* c */ x84 = f(y, "135"); /* c */ x84 = f(y, "136"); /* c */ x84 = f(y, "137"); /* c */ x84 = f(y, "138"); /* c */ x84 = f(y, "139"); /* c */ x84 = f(y, "140"); /* c */ x84 = f(y, "141"); /* c */ x84 = f(y, "142"); /* c */ x84 = f(y, "143"); /* c */ x84 = f(y, "144"); /* c */ x84 = f(y, "145"); /* c */ x84 = f(y, "146"); /* c */ x84 = f(y, "147"); /* c */ x84 = f(y, "148"); /* c */ x84 = f(y, "149"); /* c */ x84 = f(y, "150"); /* c */ x84 = f(y, "151"); /* c */ x84 = f(y, "152"); /* c */ x84 = f(y, "153"); /* c */ x84 = f(y, "154"); /* c */ x84 = f(y, "155"); /* c */ x84 = f(y, "156"); /* c */ x84 = f(y, "157"); /* c */ x84 = f(y, "158"); /* c */ x84 = f(y, "159"); /* c */ x84 = f(y, "160"); /* c */ x84 = f(y, "161"); /* c */ x84 = f(y, "162"); /* c */ x84 = f(y, "163"); /* c */ x84 = f(y, "164"); /* c */ x84 = f(y, "165"); /* c */ x84 = f(y, "166"); /* c */ x84 = f(y, "167"); /* c */ x84 = f(y, "168"); /* c */ x84 = f(y, "169"); /* c */ x84 = f(y, "170"); /* c */ x84 = f(y, "171"); /* c */ x84 = f(y, "172"); /* c */ x84 = f(y, "173"); /* c */ x84 = f(y, "174"); /* c */ x84 = f(y, "175"); /* c */ x84 = f(y, "176"); /* c */ x84 = f(y, "177"); /* c */ x84 = f(y, "178"); /* c */ x84 = f(y, "179"); /* c */ x84 = f(y, "180"); /* c */ x84 = f(y, "181"); /* c */ x84 = f(y, "182"); /* c */ x84 = f(y, "183"); /* c */ x84 = f(y, "184"); /* c */ x84 = f(y, "185"); /* c */ x84 = f(y, "186"); /* c */ x84 = f(y, "187"); /* c */ x84 = f(y, "188"); /* c */ x84 = f(y, "189"); /* c */ x84 = f(y, "190"); /* c */ x84 = f(y, "191"); /* c */ x84 = f(y, "192"); /* c */ x84 = f(y, "193"); /* c */ x84 = f(y, "194"); /* c */ x84 = f(y, "195"); /* c */ x84 = f(y, "196"); /* c */ x84 = f(y, "197"); /* c */ x84 = f(y, "198"); /* c */ x84 = f(y, "199"); /* c */ 
+x85 = f(y, "000"); /* c */ x85 = f(y, "001"); /* c */ x85 = f(y, "002"); /* c */ x85 = f(y, "003"); /* c */ x85 = f(y, "004"); /* c */ x85 = f(y, "005"); /* c */ x85 = f(y, "006"); /* c */ x85 = f(y, "007"); /* c */ x85 = f(y, "008"); /* c */ x85 = f(y, "009"); /* c */ x85 = f(y, "010"); /* c */ x85 = f(y, "011"); /* c */ x85 = f(y, "012"); /* c */ x85 = f(y, "013"); /* c */ x85 = f(y, "014"); /* c */ x85 = f(y, "015"); /* c */ x85 = f(y, "016"); /* c */ x85 = f(y, "017"); /* c */ x85 = f(y, "018"); /* c */ x85 = f(y, "019"); /* c */ x85 = f(y, "020"); /* c */ x85 = f(y, "021"); /* c */ x85 = f(y, "022"); /* c */ x85 = f(y, "023"); /* c */ x85 = f(y, "024"); /* c */ x85 = f(y, "025"); /* c */ x85 = f(y, "026"); /* c */ x85 = f(y, "027"); /* c */ x85 = f(y, "028"); /* c */ x85 = f(y, "029"); /* c */ x85 = f(y, "030"); /* c */ x85 = f(y, "031"); /* c */ x85 = f(y, "032"); /* c */ x85 = f(y, "033"); /* c */ x85 = f(y, "034"); /* c */ x85 = f(y, "035"); /* c */ x85 = f(y, "036"); /* c */ x85 = f(y, "037"); /* c */ x85 = f(y, "038"); /* c */ x85 = f(y, "039"); /* c */ x85 = f(y, "040"); /* c */ x85 = f(y, "041"); /* c */ x85 = f(y, "042"); /* c */ x85 = f(y, "043"); /* c */ x85 = f(y, "044"); /* c */ x85 = f(y, "045"); /* c */ x85 = f(y, "046"); /* c */ x85 = f(y, "047"); /* c */ x85 = f(y, "048"); /* c */ x85 = f(y, "049"); /* c */ x85 = f(y, "050"); /* c */ x85 = f(y, "051"); /* c */ x85 = f(y, "052"); /* c */ x85 = f(y, "053"); /* c */ x85 = f(y, "054"); /* c */ x85 = f(y, "055"); /* c */ x85 = f(y, "056"); /* c */ x85 = f(y, "057"); /* c */ x85 = f(y, "058"); /* c */ x85 = f(y, "059"); /* c */ x85 = f(y, "060"); /* c */ x85 = f(y, "061"); /* c */ x85 = f(y, "062"); /* c */ x85 = f(y, "063"); /* c */ x85 = f(y, "064"); /* c */ x85 = f(y, "065"); /* c */ x85 = f(y, "066"); /* c */ x85 = f(y, "067"); /* c */ x85 = f(y, "068"); /* c */ x85 = f(y, "069"); /* c */ x85 = f(y, "070"); /* c */ x85 = f(y, "071"); /* c */ x85 = f(y, "072"); /* c */ x85 = f(y, "073"); /* c */ x85 = f(y, "074"); /* c */ x85 = f(y, "075"); /* c */ x85 = f(y, "076"); /* c */ x85 = f(y, "077"); /* c */ x85 = f(y, "078"); /* c */ x85 = f(y, "079"); /* c */ x85 = f(y, "080"); /* c */ x85 = f(y, "081"); /* c */ x85 = f(y, "082"); /* c */ x85 = f(y, "083"); /* c */ x85 = f(y, "084"); /* c */ x85 = f(y, "085"); /* c */ x85 = f(y, "086"); /* c */ x85 = f(y, "087"); /* c */ x85 = f(y, "088"); /* c */ x85 = f(y, "089"); /* c */ x85 = f(y, "090"); /* c */ x85 = f(y, "091"); /* c */ x85 = f(y, "092"); /* c */ x85 = f(y, "093"); /* c */ x85 = f(y, "094"); /* c */ x85 = f(y, "095"); /* c */ x85 = f(y, "096"); /* c */ x85 = f(y, "097"); /* c */ x85 = f(y, "098"); /* c */ x85 = f(y, "099"); /* c */ x85 = f(y, "100"); /* c */ x85 = f(y, "101"); /* c */ x85 = f(y, "102"); /* c */ x85 = f(y, "103"); /* c */ x85 = f(y, "104"); /* c */ x85 = f(y, "105"); /* c */ x85 = f(y, "106"); /* c */ x85 = f(y, "107"); /* c */ x85 = f(y, "108"); /* c */ x85 = f(y, "109"); /* c */ x85 = f(y, "110"); /* c */ x85 = f(y, "111"); /* c */ x85 = f(y, "112"); /* c */ x85 = f(y, "113"); /* c */ x85 = f(y, "114"); /* c */ x85 = f(y, "115"); /* c */ x85 = f(y, "116"); /* c */ x85 = f(y, "117"); /* c */ x85 = f(y, "118"); /* c */ x85 = f(y, "119"); /* c */ x85 = f(y, "120"); /* c */ x85 = f(y, "121"); /* c */ x85 = f(y, "122"); /* c */ x85 = f(y, "123"); /* c */ x85 = f(y, "124"); /* c */ x85 = f(y, "125"); /* c */ x85 = f(y, "126"); /* c */ x85 = f(y, "127"); /* c */ x85 = f(y, "128"); /* c */ x85 = f(y, "129"); /* c */ x85 = f(y, "130"); /* c */ x85 = f(y, "131"); /* c */ x85 = f(y, "132"); /* c */ x85 = f(y, "133"); /* c */ x85 = f(y, "134"); /* c */ x85 = f(y, "135"); /* c */ x85 = f(y, "136"); /* c */ x85 = f(y, "137"); /* c */ x85 = f(y, "138"); /* c */ x85 = f(y, "139"); /* c */ x85 = f(y, "140"); /* c */ x85 = f(y, "141"); /* c */ x85 = f(y, "142"); /* c */ x85 = f(y, "143"); /* c */ x85 = f(y, "144"); /* c */ x85 = f(y, "145"); /* c */ x85 = f(y, "146"); /* c */ x85 = f(y, "147"); /* c */ x85 = f(y, "148"); /* c */ x85 = f(y, "149"); /* c */ x85 = f(y, "150"); /* c */ x85 = f(y, "151"); /* c */ x85 = f(y, "152"); /* c */ x85 = f(y, "153"); /* c */ x85 = f(y, "154"); /* c */ x85 = f(y, "155"); /* c */ x85 = f(y, "156"); /* c */ x85 = f(y, "157"); /* c */ x85 = f(y, "158"); /* c */ x85 = f(y, "159"); /* c */ x85 = f(y, "160"); /* c */ x85 = f(y, "161"); /* c */ x85 = f(y, "162"); /* c */ x85 = f(y, "163"); /* c */ x85 = f(y, "164"); /* c */ x85 = f(y, "165"); /* c */ x85 = f(y, "166"); /* c */ x85 = f(y, "167"); /* c */ x85 = f(y, "168"); /* c */ x85 = f(y, "169"); /* c */ x85 = f(y, "170"); /* c */ x85 = f(y, "171"); /* c */ x85 = f(y, "172"); /* c */ x85 = f(y, "173"); /* c */ x85 = f(y, "174"); /* c */ x85 = f(y, "175"); /* c */ x85 = f(y, "176"); /* c */ x85 = f(y, "177"); /* c */ x85 = f(y, "178"); /* c */ x85 = f(y, "179"); /* c */ x85 = f(y, "180"); /* c */ x85 = f(y, "181"); /* c */ x85 = f(y, "182"); /* c */ x85 = f(y, "183"); /* c */ x85 = f(y, "184"); /* c */ x85 = f(y, "185"); /* c */ x85 = f(y, "186"); /* c */ x85 = f(y, "187"); /* c */ x85 = f(y, "188"); /* c */ x85 = f(y, "189"); /* c */ x85 = f(y, "190"); /* c */ x85 = f(y, "191"); /* c */ x85 = f(y, "192"); /* c */ x85 = f(y, "193"); /* c */ x85 = f(y, "194"); /* c */ x85 = f(y, "195"); /* c */ x85 = f(y, "196"); /* c */ x85 = f(y, "197"); /* c */ x85 = f(y, "198"); /* c */ x85 = f(y, "199"); /* c */ 
+x86 = f(y, "000"); /* c */ x86 = f(y, "001"); /* c */ x86 = f(y, "002"); /* c */ x86 = f(y, "003"); /* c */ x86 = f(y, "004"); /* c */ x86 = f(y, "005"); /* c */ x86 = f(y, "006"); /* c */ x86 = f(y, "007"); /* c */ x86 = f(y, "008"); /* c */ x86 = f(y, "009"); /* c */ x86 = f(y, "010"); /* c */ x86 = f(y, "011"); /* c */ x86 = f(y, "012"); /* c */ x86 = f(y, "013"); /* c */ x86 = f(y, "014"); /* c */ x86 = f(y, "015"); /* c */ x86 = f(y, "016"); /* c */ x86 = f(y, "017"); /* c */ x86 = f(y, "018"); /* c */ x86 = f(y, "019"); /* c */ x86 = f(y, "020"); /* c */ x86 = f(y, "021"); /* c */ x86 = f(y, "022"); /* c */ x86 = f(y, "023"); /* c */ x86 = f(y, "024"); /* c */ x86 = f(y, "025"); /* c */ x86 = f(y, "026"); /* c */ x86 = f(y, "027"); /* c */ x86 = f(y, "028"); /* c */ x86 = f(y, "029"); /* c */ x86 = f(y, "030"); /* c */ x86 = f(y, "031"); /* c */ x86 = f(y, "032"); /* c */ x86 = f(y, "033"); /* c */ x86 = f(y, "034"); /* c */ x86 = f(y, "035"); /* c */ x86 = f(y, "036"); /* c */ x86 = f(y, "037"); /* c */ x86 = f(y, "038"); /* c */ x86 = f(y, "039"); /* c */ x86 = f(y, "040"); /* c */ x86 = f(y, "041"); /* c */ x86 = f(y, "042"); /* c */ x86 = f(y, "043"); /* c */ x86 = f(y, "044"); /* c */ x86 = f(y, "045"); /* c */ x86 = f(y, "046"); /* c */ x86 = f(y, "047"); /* c */ x86 = f(y, "048"); /* c */ x86 = f(y, "049"); /* c */ x86 = f(y, "050"); /* c */ x86 = f(y, "051"); /* c */ x86 = f(y, "052"); /* c */ x86 = f(y, "053"); /* c */ x86 = f(y, "054"); /* c */ x86 = f(y, "055"); /* c */ x86 = f(y, "056"); /* c */ x86 = f(y, "057"); /* c */ x86 = f(y, "058"); /* c */ x86 = f(y, "059"); /* c */ x86 = f(y, "060"); /* c */ x86 = f(y, "061"); /* c */ x86 = f(y, "062"); /* c */ x86 = f(y, "063"); /* c */ x86 = f(y, "064"); /* c */ x86 = f(y, "065"); /* c */ x86 = f(y, "066"); /* c */ x86 = f(y, "067"); /* c */ x86 = f(y, "068"); /* c */ x86 = f(y, "069"); /* c */ x86 = f(y, "070"); /* c */ x86 = f(y, "071"); /* c */ x86 = f(y, "072"); /* c */ x86 = f(y, "073"); /* c */ x86 = f(y, "074"); /* c */ x86 = f(y, "075"); /* c */ x86 = f(y, "076"); /* c */ x86 = f(y, "077"); /* c */ x86 = f(y, "078"); /* c */ x86 = f(y, "079"); /* c */ x86 = f(y, "080"); /* c */ x86 = f(y, "081"); /* c */ x86 = f(y, "082"); /* c */ x86 = f(y, "083"); /* c */ x86 = f(y, "084"); /* c */ x86 = f(y, "085"); /* c */ x86 = f(y, "086"); /* c */ x86 = f(y, "087"); /* c */ x86 = f(y, "088"); /* c */ x86 = f(y, "089"); /* c */ x86 = f(y, "090"); /* c */ x86 = f(y, "091"); /* c */ x86 = f(y, "092"); /* c */ x86 = f(y, "093"); /* c */ x86 = f(y, "094"); /* c */ x86 = f(y, "095"); /* c */ x86 = f(y, "096"); /* c */ x86 = f(y, "097"); /* c */ x86 = f(y, "098"); /* c */ x86 = f(y, "099"); /* c */ x86 = f(y, "100"); /* c */ x86 = f(y, "101"); /* c */ x86 = f(y, "102"); /* c */ x86 = f(y, "103"); /* c */ x86 = f(y, "104"); /* c */ x86 = f(y, "105"); /* c */ x86 = f(y, "106"); /* c */ x86 = f(y, "107"); /* c */ x86 = f(y, "108"); /* c */ x86 = f(y, "109"); /* c */ x86 = f(y, "110"); /* c */ x86 = f(y, "111"); /* c */ x86 = f(y, "112"); /* c */ x86 = f(y, "113"); /* c */ x86 = f(y, "114"); /* c */ x86 = f(y, "115"); /* c */ x86 = f(y, "116"); /* c */ x86 = f(y, "117"); /* c */ x86 = f(y, "118"); /* c */ x86 = f(y, "119"); /* c */ x86 = f(y, "120"); /* c */ x86 = f(y, "121"); /* c */ x86 = f(y, "122"); /* c */ x86 = f(y, "123"); /* c */ x86 = f(y, "124"); /* c */ x86 = f(y, "125"); /* c */ x86 = f(y, "126"); /* c */ x86 = f(y, "127"); /* c */ x86 = f(y, "128"); /* c */ x86 = f(y, "129"); /* c */ x86 = f(y, "130"); /* c */ x86 = f(y, "131"); /* c */ x86 = f(y, "132"); /* c */ x86 = f(y, "133"); /* c */ x86 = f(y, "134"); /* c */ x86 = f(y, "135"); /* c */ x86 = f(y, "136"); /* c */ x86 = f(y, "137"); /* c */ x86 = f(y, "138"); /* c */ x86 = f(y, "139"); /* c */ x86 = f(y, "140"); /* c */ x86 = f(y, "141"); /* c */ x86 = f(y, "142"); /* c */ x86 = f(y, "143"); /* c */ x86 = f(y, "144"); /* c */ x86 = f(y, "145"); /* c */ x86 = f(y, "146"); /* c */ x86 = f(y, "147"); /* c */ x86 = f(y, "148"); /* c */ x86 = f(y, "149"); /* c */ x86 = f(y, "150"); /* c */ x86 = f(y, "151"); /* c */ x86 = f(y, "152"); /* c */ x86 = f(y, "153"); /* c */ x86 = f(y, "154"); /* c */ x86 = f(y, "155"); /* c */ x86 = f(y, "156"); /* c */ x86 = f(y, "157"); /* c */ x86 = f(y, "158"); /* c */ x86 = f(y, "159"); /* c */ x86 = f(y, "160"); /* c */ x86 = f(y, "161"); /* c */ x86 = f(y, "162"); /* c */ x86 = f(y, "163"); /* c */ x86 = f(y, "164"); /* c */ x86 = f(y, "165"); /* c */ x86 = f(y, "166"); /* c */ x86 = f(y, "167"); /* c */ x86 = f(y, "168"); /* c */ x86 = f(y, "169"); /* c */ x86 = f(y, "170"); /* c */ x86 = f(y, "171"); /* c */ x86 = f(y, "172"); /* c */ x86 = f(y, "173"); /* c */ x86 = f(y, "174"); /* c */ x86 = f(y, "175"); /* c */ x86 = f(y, "176"); /* c */ x86 = f(y, "177"); /* c */ x86 = f(y, "178"); /* c */ x86 = f(y, "179"); /* c */ x86 = f(y, "180"); /* c */ x86 = f(y, "181"); /* c */ x86 = f(y, "182"); /* c */ x86 = f(y, "183"); /* c */ x86 = f(y, "184"); /* c */ x86 = f(y, "185"); /* c */ x86 = f(y, "186"); /* c */ x86 = f(y, "187"); /* c */ x86 = f(y, "188"); /* c */ x86 = f(y, "189"); /* c */ x86 = f(y, "190"); /* c */ x86 = f(y, "191"); /* c */ x86 = f(y, "192"); /* c */ x86 = f(y, "193"); /* c */ x86 = f(y, "194"); /* c */ x86 = f(y, "195"); /* c */ x86 = f(y, "196"); /* c */ x86 = f(y, "197"); /* c */ x86 = f(y, "198"); /* c */ x86 = f(y, "199"); /* c */ 
+x87 = f(y, "000"); /* c */ x87 = f(y, "001"); /* c */ x87 = f(y, "002"); /* c */ x87 = f(y, "003"); /* c */ x87 = f(y, "004"); /* c */ x87 = f(y, "005"); /* c */ x87 = f(y, "006"); /* c */ x87 = f(y, "007"); /* c */ x87 = f(y, "008"); /* c */ x87 = f(y, "009"); /* c */ x87 = f(y, "010"); /* c */ x87 = f(y, "011"); /* c */ x87 = f(y, "012"); /* c */ x87 = f(y, "013"); /* c */ x87 = f(y, "014"); /* c */ x87 = f(y, "015"); /* c */ x87 = f(y, "016"); /* c */ x87 = f(y, "017"); /* c */ x87 = f(y, "018"); /* c */ x87 = f(y, "019"); /* c */ x87 = f(y, "020"); /* c */ x87 = f(y, "021"); /* c */ x87 = f(y, "022"); /* c */ x87 = f(y, "023"); /* c */ x87 = f(y, "024"); /* c */ x87 = f(y, "025"); /* c */ x87 = f(y, "026"); /* c */ x87 = f(y, "027"); /* c */ x87 = f(y, "028"); /* c */ x87 = f(y, "029"); /* c */ x87 = f(y, "030"); /* c */ x87 = f(y, "031"); /* c */ x87 = f(y, "032"); /* c */ x87 = f(y, "033"); /* c */ x87 = f(y, "034"); /* c */ x87 = f(y, "035"); /* c */ x87 = f(y, "036"); /* c */ x87 = f(y, "037"); /* c */ x87 = f(y, "038"); /* c */ x87 = f(y, "039"); /* c */ x87 = f(y, "040"); /* c */ x87 = f(y, "041"); /* c */ x87 = f(y, "042"); /* c */ x87 = f(y, "043"); /* c */ x87 = f(y, "044"); /* c */ x87 = f(y, "045"); /* c */ x87 = f(y, "046"); /* c */ x87 = f(y, "047"); /* c */ x87 = f(y, "048"); /* c */ x87 = f(y, "049"); /* c */ x87 = f(y, "050"); /* c */ x87 = f(y, "051"); /* c */ x87 = f(y, "052"); /* c */ x87 = f(y, "053"); /* c */ x87 = f(y, "054"); /* c */ x87 = f(y, "055"); /* c */ x87 = f(y, "056"); /* c */ x87 = f(y, "057"); /* c */ x87 = f(y, "058"); /* c */ x87 = f(y, "059"); /* c */ x87 = f(y, "060"); /* c */ x87 = f(y, "061"); /* c */ x87 = f(y, "062"); /* c */ x87 = f(y, "063"); /* c */ x87 = f(y, "064"); /* c */ x87 = f(y, "065"); /* c */ x87 = f(y, "066"); /* c */ x87 = f(y, "067"); /* c */ x87 = f(y, "068"); /* c */ x87 = f(y, "069"); /* c */ x87 = f(y, "070"); /* c */ x87 = f(y, "071"); /* c */ x87 = f(y, "072"); /* c */ x87 = f(y, "073"); /* c */ x87 = f(y, "074"); /* c */ x87 = f(y, "075"); /* c */ x87 = f(y, "076"); /* c */ x87 = f(y, "077"); /* c */ x87 = f(y, "078"); /* c */ x87 = f(y, "079"); /* c */ x87 = f(y, "080"); /* c */ x87 = f(y, "081"); /* c */ x87 = f(y, "082"); /* c */ x87 = f(y, "083"); /* c */ x87 = f(y, "084"); /* c */ x87 = f(y, "085"); /* c */ x87 = f(y, "086"); /* c */ x87 = f(y, "087"); /* c */ x87 = f(y, "088"); /* c */ x87 = f(y, "089"); /* c */ x87 = f(y, "090"); /* c */ x87 = f(y, "091"); /* c */ x87 = f(y, "092"); /* c */ x87 = f(y, "093"); /* c */ x87 = f(y, "094"); /* c */ x87 = f(y, "095"); /* c */ x87 = f(y, "096"); /* c */ x87 = f(y, "097"); /* c */ x87 = f(y, "098"); /* c */ x87 = f(y, "099"); /* c */ x87 = f(y, "100"); /* c */ x87 = f(y, "101"); /* c */ x87 = f(y, "102"); /* c */ x87 = f(y, "103"); /* c */ x87 = f(y, "104"); /* c */ x87 = f(y, "105"); /* c */ x87 = f(y, "106"); /* c */ x87 = f(y, "107"); /* c */ x87 = f(y, "108"); /* c */ x87 = f(y, "109"); /* c */ x87 = f(y, "110"); /* c */ x87 = f(y, "111"); /* c */ x87 = f(y, "112"); /* c */ x87 = f(y, "113"); /* c */ x87 = f(y, "114"); /* c */ x87 = f(y, "115"); /* c */ x87 = f(y, "116"); /* c */ x87 = f(y, "117"); /* c */ x87 = f(y, "118"); /* c */ x87 = f(y, "119"); /* c */ x87 = f(y, "120"); /* c */ x87 = f(y, "121"); /* c */ x87 = f(y, "122"); /* c */ x87 = f(y, "123"); /* c */ x87 = f(y, "124"); /* c */ x87 = f(y, "125"); /* c */ x87 = f(y, "126"); /* c */ x87 = f(y, "127"); /* c */ x87 = f(y, "128"); /* c */ x87 = f(y, "129"); /* c */ x87 = f(y, "130"); /* c */ x87 = f(y, "131"); /* c */ x87 = f(y, "132"); /* c */ x87 = f(y, "133"); /* c */ x87 = f(y, "134"); /* c */ x87 = f(y, "135"); /* c */ x87 = f(y, "136"); /* c */ x87 = f(y, "137"); /* c */ x87 = f(y, "138"); /* c */ x87 = f(y, "139"); /* c */ x87 = f(y, "140"); /* c */ x87 = f(y, "141"); /* c */ x87 = f(y, "142"); /* c */ x87 = f(y, "143"); /* c */ x87 = f(y, "144"); /* c */ x87 = f(y, "145"); /* c */ x87 = f(y, "146"); /* c */ x87 = f(y, "147"); /* c */ x87 = f(y, "148"); /* c */ x87 = f(y, "149"); /* c */ x87 = f(y, "150"); /* c */ x87 = f(y, "151"); /* c */ x87 = f(y, "152"); /* c */ x87 = f(y, "153"); /* c */ x87 = f(y, "154"); /* c */ x87 = f(y, "155"); /* c */ x87 = f(y, "156"); /* c */ x87 = f(y, "157"); /* c */ x87 = f(y, "158"); /* c */ x87 = f(y, "159"); /* c */ x87 = f(y, "160"); /* c */ x87 = f(y, "161"); /* c */ x87 = f(y, "162"); /* c */ x87 = f(y, "163"); /* c */ x87 = f(y, "164"); /* c */ x87 = f(y, "165"); /* c */ x87 = f(y, "166"); /* c */ x87 = f(y, "167"); /* c */ x87 = f(y, "168"); /* c */ x87 = f(y, "169"); /* c */ x87 = f(y, "170"); /* c */ x87 = f(y, "171"); /* c */ x87 = f(y, "172"); /* c */ x87 = f(y, "173"); /* c */ x87 = f(y, "174"); /* c */ x87 = f(y, "175"); /* c */ x87 = f(y, "176"); /* c */ x87 = f(y, "177"); /* c */ x87 = f(y, "178"); /* c */ x87 = f(y, "179"); /* c */ x87 = f(y, "180"); /* c */ x87 = f(y, "181"); /* c */ x87 = f(y, "182"); /* c */ x87 = f(y, "183"); /* c */ x87 = f(y, "184"); /* c */ x87 = f(y, "185"); /* c */ x87 = f(y, "186"); /* c */ x87 = f(y, "187"); /* c */ x87 = f(y, "188"); /* c */ x87 = f(y, "189"); /* c */ x87 = f(y, "190"); /* c */ x87 = f(y, "191"); /* c */ x87 = f(y, "192"); /* c */ x87 = f(y, "193"); /* c */ x87 = f(y, "194"); /* c */ x87 = f(y, "195"); /* c */ x87 = f(y, "196"); /* c */ x87 = f(y, "197"); /* c */ x87 = f(y, "198"); /* c */ x87 = f(y, "199"); /* c */ 
+x88 = f(y, "000"); /* c */ x88 = f(y, "001"); /* c */ x88 = f(y, "002"); /* c */ x88 = f(y, "003"); /* c */ x88 = f(y, "004"); /* c */ x88 = f(y, "005"); /* c */ x88 = f(y, "006"); /* c */ x88 = f(y, "007"); /* c */ x88 = f(y, "008"); /* c */ x88 = f(y, "009"); /* c */ x88 = f(y, "010"); /* c */ x88 = f(y, "011"); /* c */ x88 = f(y, "012"); /* c */ x88 = f(y, "013"); /* c */ x88 = f(y, "014"); /* c */ x88 = f(y, "015"); /* c */ x88 = f(y, "016"); /* c */ x88 = f(y, "017"); /* c */ x88 = f(y, "018"); /* c */ x88 = f(y, "019"); /* c */ x88 = f(y, "020"); /* c */ x88 = f(y, "021"); /* c */ x88 = f(y, "022"); /* c */ x88 = f(y, "023"); /* c */ x88 = f(y, "024"); /* c */ x88 = f(y, "025"); /* c */ x88 = f(y, "026"); /* c */ x88 = f(y, "027"); /* c */ x88 = f(y, "028"); /* c */ x88 = f(y, "029"); /* c */ x88 = f(y, "030"); /* c */ x88 = f(y, "031"); /* c */ x88 = f(y, "032"); /* c */ x88 = f(y, "033"); /* c */ x88 = f(y, "034"); /* c */ x88 = f(y, "035"); /* c */ x88 = f(y, "036"); /* c */ x88 = f(y, "037"); /* c */ x88 = f(y, "038"); /* c */ x88 = f(y, "039"); /* c */ x88 = f(y, "040"); /* c */ x88 = f(y, "041"); /* c */ x88 = f(y, "042"); /* c */ x88 = f(y, "043"); /* c */ x88 = f(y, "044"); /* c */ x88 = f(y, "045"); /* c */ x88 = f(y, "046"); /* c */ x88 = f(y, "047"); /* c */ x88 = f(y, "048"); /* c */ x88 = f(y, "049"); /* c */ x88 = f(y, "050"); /* c */ x88 = f(y, "051"); /* c */ x88 = f(y, "052"); /* c */ x88 = f(y, "053"); /* c */ x88 = f(y, "054"); /* c */ x88 = f(y, "055"); /* c */ x88 = f(y, "056"); /* c */ x88 = f(y, "057"); /* c */ x88 = f(y, "058"); /* c */ x88 = f(y, "059"); /* c */ x88 = f(y, "060"); /* c */ x88 = f(y, "061"); /* c */ x88 = f(y, "062"); /* c */ x88 = f(y, "063"); /* c */ x88 = f(y, "064"); /* c */ x88 = f(y, "065"); /* c */ x88 = f(y, "066"); /* c */ x88 = f(y, "067"); /* c */ x88 = f(y, "068"); /* c */ x88 = f(y, "069"); /* c */ x88 = f(y, "070"); /* c */ x88 = f(y, "071"); /* c */ x88 = f(y, "072"); /* c */ x88 = f(y, "073"); /* c */ x88 = f(y, "074"); /* c */ x88 = f(y, "075"); /* c */ x88 = f(y, "076"); /* c */ x88 = f(y, "077"); /* c */ x88 = f(y, "078"); /* c */ x88 = f(y, "079"); /* c */ x88 = f(y, "080"); /* c */ x88 = f(y, "081"); /* c */ x88 = f(y, "082"); /* c */ x88 = f(y, "083"); /* c */ x88 = f(y, "084"); /* c */ x88 = f(y, "085"); /* c */ x88 = f(y, "086"); /* c */ x88 = f(y, "087"); /* c */ x88 = f(y, "088"); /* c */ x88 = f(y, "089"); /* c */ x88 = f(y, "090"); /* c */ x88 = f(y, "091"); /* c */ x88 = f(y, "092"); /* c */ x88 = f(y, "093"); /* c */ x88 = f(y, "094"); /* c */ x88 = f(y, "095"); /* c */ x88 = f(y, "096"); /* c */ x88 = f(y, "097"); /* c */ x88 = f(y, "098"); /* c */ x88 = f(y, "099"); /* c */ x88 = f(y, "100"); /* c */ x88 = f(y, "101"); /* c */ x88 = f(y, "102"); /* c */ x88 = f(y, "103"); /* c */ x88 = f(y, "104"); /* c */ x88 = f(y, "105"); /* c */ x88 = f(y, "106"); /* c */ x88 = f(y, "107"); /* c */ x88 = f(y, "108"); /* c */ x88 = f(y, "109"); /* c */ x88 = f(y, "110"); /* c */ x88 = f(y, "111"); /* c */ x88 = f(y, "112"); /* c */ x88 = f(y, "113"); /* c */ x88 = f(y, "114"); /* c */ x88 = f(y, "115"); /* c */ x88 = f(y, "116"); /* c */ x88 = f(y, "117"); /* c */ x88 = f(y, "118"); /* c */ x88 = f(y, "119"); /* c */ x88 = f(y, "120"); /* c */ x88 = f(y, "121"); /* c */ x88 = f(y, "122"); /* c */ x88 = f(y, "123"); /* c */ x88 = f(y, "124"); /* c */ x88 = f(y, "125"); /* c */ x88 = f(y, "126"); /* c */ x88 = f(y, "127"); /* c */ x88 = f(y, "128"); /* c */ x88 = f(y, "129"); /* c */ x88 = f(y, "130"); /* c */ x88 = f(y, "131"); /* c */ x88 = f(y, "132"); /* c */ x88 = f(y, "133"); /* c */ x88 = f(y, "134"); /* c */ x88 = f(y, "135"); /* c */ x88 = f(y, "136"); /* c */ x88 = f(y, "137"); /* c */ x88 = f(y, "138"); /* c */ x88 = f(y, "139"); /* c */ x88 = f(y, "140"); /* c */ x88 = f(y, "141"); /* c */ x88 = f(y, "142"); /* c */ x88 = f(y, "143"); /* c */ x88 = f(y, "144"); /* c */ x88 = f(y, "145"); /* c */ x88 = f(y, "146"); /* c */ x88 = f(y, "147"); /* c */ x88 = f(y, "148"); /* c */ x88 = f(y, "149"); /* c */ x88 = f(y, "150"); /* c */ x88 = f(y, "151"); /* c */ x88 = f(y, "152"); /* c */ x88 = f(y, "153"); /* c */ x88 = f(y, "154"); /* c */ x88 = f(y, "155"); /* c */ x88 = f(y, "156"); /* c */ x88 = f(y, "157"); /* c */ x88 = f(y, "158"); /* c */ x88 = f(y, "159"); /* c */ x88 = f(y, "160"); /* c */ x88 = f(y, "161"); /* c */ x88 = f(y, "162"); /* c */ x88 = f(y, "163"); /* c */ x88 = f(y, "164"); /* c */ x88 = f(y, "165"); /* c */ x88 = f(y, "166"); /* c */ x88 = f(y, "167"); /* c */ x88 = f(y, "168"); /* c */ x88 = f(y, "169"); /* c */ x88 = f(y, "170"); /* c */ x88 = f(y, "171"); /* c */ x88 = f(y, "172"); /* c */ x88 = f(y, "173"); /* c */ x88 = f(y, "174"); /* c */ x88 = f(y, "175"); /* c */ x88 = f(y, "176"); /* c */ x88 = f(y, "177"); /* c */ x88 = f(y, "178"); /* c */ x88 = f(y, "179"); /* c */ x88 = f(y, "180"); /* c */ x88 = f(y, "181"); /* c */ x88 = f(y, "182"); /* c */ x88 = f(y, "183"); /* c */ x88 = f(y, "184"); /* c */ x88 = f(y, "185"); /* c */ x88 = f(y, "186"); /* c */ x88 = f(y, "187"); /* c */ x88 = f(y, "188"); /* c */ x88 = f(y, "189"); /* c */ x88 = f(y, "190"); /* c */ x88 = f(y, "191"); /* c */ x88 = f(y, "192"); /* c */ x88 = f(y, "193"); /* c */ x88 = f(y, "194"); /* c */ x88 = f(y, "195"); /* c */ x88 = f(y, "196"); /* c */ x88 = f(y, "197"); /* c */ x88 = f(y, "198"); /* c */ x88 = f(y, "199"); /* c */ 
+x89 = f(y, "000"); /* c */ x89 = f(y, "001"); /* c */ x89 = f(y, "002"); /* c */ x89 = f(y, "003"); /* c */ x89 = f(y, "004"); /* c */ x89 = f(y, "005"); /* c */ x89 = f(y, "006"); /* c */ x89 = f(y, "007"); /* c */ x89 = f(y, "008"); /* c */ x89 = f(y, "009"); /* c */ x89 = f(y, "010"); /* c */ x89 = f(y, "011"); /* c */ x89 = f(y, "012"); /* c */ x89 = f(y, "013"); /* c */ x89 = f(y, "014"); /* c */ x89 = f(y, "015"); /* c */ x89 = f(y, "016"); /* c */ x89 = f(y, "017"); /* c */ x89 = f(y, "018"); /* c */ x89 = f(y, "019"); /* c */ x89 = f(y, "020"); /* c */ x89 = f(y, "021"); /* c */ x89 = f(y, "022"); /* c */ x89 = f(y, "023"); /* c */ x89 = f(y, "024"); /* c */ x89 = f(y, "025"); /* c */ x89 = f(y, "026"); /* c */ x89 = f(y, "027"); /* c */ x89 = f(y, "028"); /* c */ x89 = f(y, "029"); /* c */ x89 = f(y, "030"); /* c */ x89 = f(y, "031"); /* c */ x89 = f(y, "032"); /* c */ x89 = f(y, "033"); /* c */ x89 = f(y, "034"); /* c */ x89 = f(y, "035"); /* c */ x89 = f(y, "036"); /* c */ x89 = f(y, "037"); /* c */ x89 = f(y, "038"); /* c */ x89 = f(y, "039"); /* c */ x89 = f(y, "040"); /* c */ x89 = f(y, "041"); /* c */ x89 = f(y, "042"); /* c */ x89 = f(y, "043"); /* c */ x89 = f(y, "044"); /* c */ x89 = f(y, "045"); /* c */ x89 = f(y, "046"); /* c */ x89 = f(y, "047"); /* c */ x89 = f(y, "048"); /* c */ x89 = f(y, "049"); /* c */ x89 = f(y, "050"); /* c */ x89 = f(y, "051"); /* c */ x89 = f(y, "052"); /* c */ x89 = f(y, "053"); /* c */ x89 = f(y, "054"); /* c */ x89 = f(y, "055"); /* c */ x89 = f(y, "056"); /* c */ x89 = f(y, "057"); /* c */ x89 = f(y, "058"); /* c */ x89 = f(y, "059"); /* c */ x89 = f(y, "060"); /* c */ x89 = f(y, "061"); /* c */ x89 = f(y, "062"); /* c */ x89 = f(y, "063"); /* c */ x89 = f(y, "064"); /* c */ x89 = f(y, "065"); /* c */ x89 = f(y, "066"); /* c */ x89 = f(y, "067"); /* c */ x89 = f(y, "068"); /* c */ x89 = f(y, "069"); /* c */ x89 = f(y, "070"); /* c */ x89 = f(y, "071"); /* c */ x89 = f(y, "072"); /* c */ x89 = f(y, "073"); /* c */ x89 = f(y, "074"); /* c */ x89 = f(y, "075"); /* c */ x89 = f(y, "076"); /* c */ x89 = f(y, "077"); /* c */ x89 = f(y, "078"); /* c */ x89 = f(y, "079"); /* c */ x89 = f(y, "080"); /* c */ x89 = f(y, "081"); /* c */ x89 = f(y, "082"); /* c */ x89 = f(y, "083"); /* c */ x89 = f(y, "084"); /* c */ x89 = f(y, "085"); /* c */ x89 = f(y, "086"); /* c */ x89 = f(y, "087"); /* c */ x89 = f(y, "088"); /* c */ x89 = f(y, "089"); /* c */ x89 = f(y, "090"); /* c */ x89 = f(y, "091"); /* c */ x89 = f(y, "092"); /* c */ x89 = f(y, "093"); /* c */ x89 = f(y, "094"); /* c */ x89 = f(y, "095"); /* c */ x89 = f(y, "096"); /* c */ x89 = f(y, "097"); /* c */ x89 = f(y, "098"); /* c */ x89 = f(y, "099"); /* c */ x89 = f(y, "100"); /* c */ x89 = f(y, "101"); /* c */ x89 = f(y, "102"); /* c */ x89 = f(y, "103"); /* c */ x89 = f(y, "104"); /* c */ x89 = f(y, "105"); /* c */ x89 = f(y, "106"); /* c */ x89 = f(y, "107"); /* c */ x89 = f(y, "108"); /* c */ x89 = f(y, "109"); /* c */ x89 = f(y, "110"); /* c */ x89 = f(y, "111"); /* c */ x89 = f(y, "112"); /* c */ x89 = f(y, "113"); /* c */ x89 = f(y, "114"); /* c */ x89 = f(y, "115"); /* c */ x89 = f(y, "116"); /* c */ x89 = f(y, "117"); /* c */ x89 = f(y, "118"); /* c */ x89 = f(y, "119"); /* c */ x89 = f(y, "120"); /* c */ x89 = f(y, "121"); /* c */ x89 = f(y, "122"); /* c */ x89 = f(y, "123"); /* c */ x89 = f(y, "124"); /* c */ x89 = f(y, "125"); /* c */ x89 = f(y, "126"); /* c */ x89 = f(y, "127"); /* c */ x89 = f(y, "128"); /* c */ x89 = f(y, "129"); /* c */ x89 = f(y, "130"); /* c */ x89 = f(y, "131"); /* c */ x89 = f(y, "132"); /* c */ x89 = f(y, "133"); /* c */ x89 = f(y, "134"); /* c */ x89 = f(y, "135"); /* c */ x89 = f(y, "136"); /* c */ x89 = f(y, "137"); /* c */ x89 = f(y, "138"); /* c */ x89 = f(y, "139"); /* c */ x89 = f(y, "140"); /* c */ x89 = f(y, "141"); /* c */ x89 = f(y, "142"); /* c */ x89 = f(y, "143"); /* c */ x89 = f(y, "144"); /* c */ x89 = f(y, "145"); /* c */ x89 = f(y, "146"); /* c */ x89 = f(y, "147"); /* c */ x89 = f(y, "148"); /* c */ x89 = f(y, "149"); /* c */ x89 = f(y, "150"); /* c */ x89 = f(y, "151"); /* c */ x89 = f(y, "152"); /* c */ x89 = f(y, "153"); /* c */ x89 = f(y, "154"); /* c */ x89 = f(y, "155"); /* c */ x89 = f(y, "156"); /* c */ x89 = f(y, "157"); /* c */ x89 = f(y, "158"); /* c */ x89 = f(y, "159"); /* c */ x89 = f(y, "160"); /* c */ x89 = f(y, "161"); /* c */ x89 = f(y, "162"); /* c */ x89 = f(y, "163"); /* c */ x89 = f(y, "164"); /* c */ x89 = f(y, "165"); /* c */ x89 = f(y, "166"); /* c */ x89 = f(y, "167"); /* c */ x89 = f(y, "168"); /* c */ x89 = f(y, "169"); /* c */ x89 = f(y, "170"); /* c */ x89 = f(y, "171"); /* c */ x89 = f(y, "172"); /* c */ x89 = f(y, "173"); /* c */ x89 = f(y, "174"); /* c */ x89 = f(y, "175"); /* c */ x89 = f(y, "176"); /* c */ x89 = f(y, "177"); /* c */ x89 = f(y, "178"); /* c */ x89 = f(y, "179"); /* c */ x89 = f(y, "180"); /* c */ x89 = f(y, "181"); /* c */ x89 = f(y, "182"); /* c */ x89 = f(y, "183"); /* c */ x89 = f(y, "184"); /* c */ x89 = f(y, "185"); /* c */ x89 = f(y, "186"); /* c */ x89 = f(y, "187"); /* c */ x89 = f(y, "188"); /* c */ x89 = f(y, "189"); /* c */ x89 = f(y, "190"); /* c */ x89 = f(y, "191"); /* c */ x89 = f(y, "192"); /* c */ x89 = f(y, "193"); /* c */ x89 = f(y, "194"); /* c */ x89 = f(y, "195"); /* c */ x89 = f(y, "196"); /* c */ x89 = f(y, "197"); /* c */ x89 = f(y, "198"); /* c */ x89 = f(y, "199"); /* c */ 
+x90 = f(y, "000"); /* c */ x90 = f(y, "001"); /* c */ x90 = f(y, "002"); /* c */ x90 = f(y, "003"); /* c */ x90 = f(y, "004"); /* c */ x90 = f(y, "005"); /* c */ x90 = f(y, "006"); /* c */ x90 = f(y, "007"); /* c */ x90 = f(y, "008"); /* c */ x90 = f(y, "009"); /* c */ x90 = f(y, "010"); /* c */ x90 = f(y, "011"); /* c */ x90 = f(y, "012"); /* c */ x90 = f(y, "013"); /* c */ x90 = f(y, "014"); /* c */ x90 = f(y, "015"); /* c */ x90 = f(y, "016"); /* c */ x90 = f(y, "017"); /* c */ x90 = f(y, "018"); /* c */ x90 = f(y, "019"); /* c */ x90 = f(y, "020"); /* c */ x90 = f(y, "021"); /* c */ x90 = f(y, "022"); /* c */ x90 = f(y, "023"); /* c */ x90 = f(y, "024"); /* c */ x90 = f(y, "025"); /* c */ x90 = f(y, "026"); /* c */ x90 = f(y, "027"); /* c */ x90 = f(y, "028"); /* c */ x90 = f(y, "029"); /* c */ x90 = f(y, "030"); /* c */ x90 = f(y, "031"); /* c */ x90 = f(y, "032"); /* c */ x90 = f(y, "033"); /* c */ x90 = f(y, "034"); /* c */ x90 = f(y, "035"); /* c */ x90 = f(y, "036"); /* c */ x90 = f(y, "037"); /* c */ x90 = f(y, "038"); /* c */ x90 = f(y, "039"); /* c */ x90 = f(y, "040"); /* c */ x90 = f(y, "041"); /* c */ x90 = f(y, "042"); /* c */ x90 = f(y, "043"); /* c */ x90 = f(y, "044"); /* c */ x90 = f(y, "045"); /* c */ x90 = f(y, "046"); /* c */ x90 = f(y, "047"); /* c */ x90 = f(y, "048"); /* c */ x90 = f(y, "049"); /* c */ x90 = f(y, "050"); /* c */ x90 = f(y, "051"); /* c */ x90 = f(y, "052"); /* c */ x90 = f(y, "053"); /* c */ x90 = f(y, "054"); /* c */ x90 = f(y, "055"); /* c */ x90 = f(y, "056"); /* c */ x90 = f(y, "057"); /* c */ x90 = f(y, "058"); /* c */ x90 = f(y, "059"); /* c */ x90 = f(y, "060"); /* c */ x90 = f(y, "061"); /* c */ x90 = f(y, "062"); /* c */ x90 = f(y, "063"); /* c */ x90 = f(y, "064"); /* c */ x90 = f(y, "065"); /* c */ x90 = f(y, "066"); /* c */ x90 = f(y, "067"); /* c */ x90 = f(y, "068"); /* c */ x90 = f(y, "069"); /* c */ x90 = f(y, "070"); /* c */ x90 = f(y, "071"); /* c */ x90 = f(y, "072"); /* c */ x90 = f(y, "073"); /* c */ x90 = f(y, "074"); /* c */ x90 = f(y, "075"); /* c */ x90 = f(y, "076"); /* c */ x90 = f(y, "077"); /* c */ x90 = f(y, "078"); /* c */ x90 = f(y, "079"); /* c */ x90 = f(y, "080"); /* c */ x90 = f(y, "081"); /* c */ x90 = f(y, "082"); /* c */ x90 = f(y, "083"); /* c */ x90 = f(y, "084"); /* c */ x90 = f(y, "085"); /* c */ x90 = f(y, "086"); /* c */ x90 = f(y, "087"); /* c */ x90 = f(y, "088"); /* c */ x90 = f(y, "089"); /* c */ x90 = f(y, "090"); /* c */ x90 = f(y, "091"); /* c */ x90 = f(y, "092"); /* c */ x90 = f(y, "093"); /* c */ x90 = f(y, "094"); /* c */ x90 = f(y, "095"); /* c */ x90 = f(y, "096"); /* c */ x90 = f(y, "097"); /* c */ x90 = f(y, "098"); /* c */ x90 = f(y, "099"); /* c */ x90 = f(y, "100"); /* c */ x90 = f(y, "101"); /* c */ x90 = f(y, "102"); /* c */ x90 = f(y, "103"); /* c */ x90 = f(y, "104"); /* c */ x90 = f(y, "105"); /* c */ x90 = f(y, "106"); /* c */ x90 = f(y, "107"); /* c */ x90 = f(y, "108"); /* c */ x90 = f(y, "109"); /* c */ x90 = f(y, "110"); /* c */ x90 = f(y, "111"); /* c */ x90 = f(y, "112"); /* c */ x90 = f(y, "113"); /* c */ x90 = f(y, "114"); /* c */ x90 = f(y, "115"); /* c */ x90 = f(y, "116"); /* c */ x90 = f(y, "117"); /* c */ x90 = f(y, "118"); /* c */ x90 = f(y, "119"); /* c */ x90 = f(y, "120"); /* c */ x90 = f(y, "121"); /* c */ x90 = f(y, "122"); /* c */ x90 = f(y, "123"); /* c */ x90 = f(y, "124"); /* c */ x90 = f(y, "125"); /* c */ x90 = f(y, "126"); /* c */ x90 = f(y, "127"); /* c */ x90 = f(y, "128"); /* c */ x90 = f(y, "129"); /* c */ x90 = f(y, "130"); /* c */ x90 = f(y, "131"); /* c */ x90 = f(y, "132"); /* c */ x90 = f(y, "133"); /* c */ x90 = f(y, "134"); /* c */ x90 = f(y, "135"); /* c */ x90 = f(y, "136"); /* c */ x90 = f(y, "137"); /* c */ x90 = f(y, "138"); /* c */ x90 = f(y, "139"); /* c */ x90 = f(y, "140"); /* c */ x90 = f(y, "141"); /* c */ x90 = f(y, "142"); /* c */ x90 = f(y, "143"); /* c */ x90 = f(y, "144"); /* c */ x90 = f(y, "145"); /* c */ x90 = f(y, "146"); /* c */ x90 = f(y, "147"); /* c */ x90 = f(y, "148"); /* c */ x90 = f(y, "149"); /* c */ x90 = f(y, "150"); /* c */ x90 = f(y, "151"); /* c */ x90 = f(y, "152"); /* c */ x90 = f(y, "153"); /* c */ x90 = f(y, "154"); /* c */ x90 = f(y, "155"); /* c */ x90 = f(y, "156"); /* c */ x90 = f(y, "157"); /* c */ x90 = f(y, "158"); /* c */ x90 = f(y, "159"); /* c */ x90 = f(y, "160"); /* c */ x90 = f(y, "161"); /* c */ x90 = f(y, "162"); /* c */ x90 = f(y, "163"); /* c */ x90 = f(y, "164"); /* c */ x90 = f(y, "165"); /* c */ x90 = f(y, "166"); /* c */ x90 = f(y, "167"); /* c */ x90 = f(y, "168"); /* c */ x90 = f(y, "169"); /* c */ x90 = f(y, "170"); /* c */ x90 = f(y, "171"); /* c */ x90 = f(y, "172"); /* c */ x90 = f(y, "173"); /* c */ x90 = f(y, "174"); /* c */ x90 = f(y, "175"); /* c */ x90 = f(y, "176"); /* c */ x90 = f(y, "177"); /* c */ x90 = f(y, "178"); /* c */ x90 = f(y, "179"); /* c */ x90 = f(y, "180"); /* c */ x90 = f(y, "181"); /* c */ x90 = f(y, "182"); /* c */ x90 = f(y, "183"); /* c */ x90 = f(y, "184"); /* c */ x90 = f(y, "185"); /* c */ x90 = f(y, "186"); /* c */ x90 = f(y, "187"); /* c */ x90 = f(y, "188"); /* c */ x90 = f(y, "189"); /* c */ x90 = f(y, "190"); /* c */ x90 = f(y, "191"); /* c */ x90 = f(y, "192"); /* c */ x90 = f(y, "193"); /* c */ x90 = f(y, "194"); /* c */ x90 = f(y, "195"); /* c */ x90 = f(y, "196"); /* c */ x90 = f(y, "197"); /* c */ x90 = f(y, "198"); /* c */ x90 = f(y, "199"); /* c */ 
+x91 = f(y, "000"); /* c */ x91 = f(y, "001"); /* c */ x91 = f(y, "002"); /* c */ x91 = f(y, "003"); /* c */ x91 = f(y, "004"); /* c */ x91 = f(y, "005"); /* c */ x91 = f(y, "006"); /* c */ x91 = f(y, "007"); /* c */ x91 = f(y, "008"); /* c */ x91 = f(y, "009"); /* c */ x91 = f(y, "010"); /* c */ x91 = f(y, "011"); /* c */ x91 = f(y, "012"); /* c */ x91 = f(y, "013"); /* c */ x91 = f(y, "014"); /* c */ x91 = f(y, "015"); /* c */ x91 = f(y, "016"); /* c */ x91 = f(y, "017"); /* c */ x91 = f(y, "018"); /* c */ x91 = f(y, "019"); /* c */ x91 = f(y, "020"); /* c */ x91 = f(y, "021"); /* c */ x91 = f(y, "022"); /* c */ x91 = f(y, "023"); /* c */ x91 = f(y, "024"); /* c */ x91 = f(y, "025"); /* c */ x91 = f(y, "026"); /* c */ x91 = f(y, "027"); /* c */ x91 = f(y, "028"); /* c */ x91 = f(y, "029"); /* c */ x91 = f(y, "030"); /* c */ x91 = f(y, "031"); /* c */ x91 = f(y, "032"); /* c */ x91 = f(y, "033"); /* c */ x91 = f(y, "034"); /* c */ x91 = f(y, "035"); /* c */ x91 = f(y, "036"); /* c */ x91 = f(y, "037"); /* c */ x91 = f(y, "038"); /* c */ x91 = f(y, "039"); /* c */ x91 = f(y, "040"); /* c */ x91 = f(y, "041"); /* c */ x91 = f(y, "042"); /* c */ x91 = f(y, "043"); /* c */ x91 = f(y, "044"); /* c */ x91 = f(y, "045"); /* c */ x91 = f(y, "046"); /* c */ x91 = f(y, "047"); /* c */ x91 = f(y, "048"); /* c */ x91 = f(y, "049"); /* c */ x91 = f(y, "050"); /* c */ x91 = f(y, "051"); /* c */ x91 = f(y, "052"); /* c */ x91 = f(y, "053"); /* c */ x91 = f(y, "054"); /* c */ x91 = f(y, "055"); /* c */ x91 = f(y, "056"); /* c */ x91 = f(y, "057"); /* c */ x91 = f(y, "058"); /* c */ x91 = f(y, "059"); /* c */ x91 = f(y, "060"); /* c */ x91 = f(y, "061"); /* c */ x91 = f(y, "062"); /* c */ x91 = f(y, "063"); /* c */ x91 = f(y, "064"); /* c */ x91 = f(y, "065"); /* c */ x91 = f(y, "066"); /* c */ x91 = f(y, "067"); /* c */ x91 = f(y, "068"); /* c */ x91 = f(y, "069"); /* c */ x91 = f(y, "070"); /* c */ x91 = f(y, "071"); /* c */ x91 = f(y, "072"); /* c */ x91 = f(y, "073"); /* c */ x91 = f(y, "074"); /* c */ x91 = f(y, "075"); /* c */ x91 = f(y, "076"); /* c */ x91 = f(y, "077"); /* c */ x91 = f(y, "078"); /* c */ x91 = f(y, "079"); /* c */ x91 = f(y, "080"); /* c */ x91 = f(y, "081"); /* c */ x91 = f(y, "082"); /* c */ x91 = f(y, "083"); /* c */ x91 = f(y, "084"); /* c */ x91 = f(y, "085"); /* c */ x91 = f(y, "086"); /* c */ x91 = f(y, "087"); /* c */ x91 = f(y, "088"); /* c */ x91 = f(y, "089"); /* c */ x91 = f(y, "090"); /* c */ x91 = f(y, "091"); /* c */ x91 = f(y, "092"); /* c */ x91 = f(y, "093"); /* c */ x91 = f(y, "094"); /* c */ x91 = f(y, "095"); /* c */ x91 = f(y, "096"); /* c */ x91 = f(y, "097"); /* c */ x91 = f(y, "098"); /* c */ x91 = f(y, "099"); /* c */ x91 = f(y, "100"); /* c */ x91 = f(y, "101"); /* c */ x91 = f(y, "102"); /* c */ x91 = f(y, "103"); /* c */ x91 = f(y, "104"); /* c */ x91 = f(y, "105"); /* c */ x91 = f(y, "106"); /* c */ x91 = f(y, "107"); /* c */ x91 = f(y, "108"); /* c */ x91 = f(y, "109"); /* c */ x91 = f(y, "110"); /* c */ x91 = f(y, "111"); /* c */ x91 = f(y, "112"); /* c */ x91 = f(y, "113"); /* c */ x91 = f(y, "114"); /* c */ x91 = f(y, "115"); /* c */ x91 = f(y, "116"); /* c */ x91 = f(y, "117"); /* c */ x91 = f(y, "118"); /* c */ x91 = f(y, "119"); /* c */ x91 = f(y, "120"); /* c */ x91 = f(y, "121"); /* c */ x91 = f(y, "122"); /* c */ x91 = f(y, "123"); /* c */ x91 = f(y, "124"); /* c */ x91 = f(y, "125"); /* c */ x91 = f(y, "126"); /* c */ x91 = f(y, "127"); /* c */ x91 = f(y, "128"); /* c */ x91 = f(y, "129"); /* c */ x91 = f(y, "130"); /* c */ x91 = f(y, "131"); /* c */ x91 = f(y, "132"); /* c */ x91 = f(y, "133"); /* c */ x91 = f(y, "134"); /* c */ x91 = f(y, "135"); /* c */ x91 = f(y, "136"); /* c */ x91 = f(y, "137"); /* c */ x91 = f(y, "138"); /* c */ x91 = f(y, "139"); /* c */ x91 = f(y, "140"); /* c */ x91 = f(y, "141"); /* c */ x91 = f(y, "142"); /* c */ x91 = f(y, "143"); /* c */ x91 = f(y, "144"); /* c */ x91 = f(y, "145"); /* c */ x91 = f(y, "146"); /* c */ x91 = f(y, "147"); /* c */ x91 = f(y, "148"); /* c */ x91 = f(y, "149"); /* c */ x91 = f(y, "150"); /* c */ x91 = f(y, "151"); /* c */ x91 = f(y, "152"); /* c */ x91 = f(y, "153"); /* c */ x91 = f(y, "154"); /* c */ x91 = f(y, "155"); /* c */ x91 = f(y, "156"); /* c */ x91 = f(y, "157"); /* c */ x91 = f(y, "158"); /* c */ x91 = f(y, "159"); /* c */ x91 = f(y, "160"); /* c */ x91 = f(y, "161"); /* c */ x91 = f(y, "162"); /* c */ x91 = f(y, "163"); /* c */ x91 = f(y, "164"); /* c */ x91 = f(y, "165"); /* c */ x91 = f(y, "166"); /* c */ x91 = f(y, "167"); /* c */ x91 = f(y, "168"); /* c */ x91 = f(y, "169"); /* c */ x91 = f(y, "170"); /* c */ x91 = f(y, "171"); /* c */ x91 = f(y, "172"); /* c */ x91 = f(y, "173"); /* c */ x91 = f(y, "174"); /* c */ x91 = f(y, "175"); /* c */ x91 = f(y, "176"); /* c */ x91 = f(y, "177"); /* c */ x91 = f(y, "178"); /* c */ x91 = f(y, "179"); /* c */ x91 = f(y, "180"); /* c */ x91 = f(y, "181"); /* c */ x91 = f(y, "182"); /* c */ x91 = f(y, "183"); /* c */ x91 = f(y, "184"); /* c */ x91 = f(y, "185"); /* c */ x91 = f(y, "186"); /* c */ x91 = f(y, "187"); /* c */ x91 = f(y, "188"); /* c */ x91 = f(y, "189"); /* c */ x91 = f(y, "190"); /* c */ x91 = f(y, "191"); /* c */ x91 = f(y, "192"); /* c */ x91 = f(y, "193"); /* c */ x91 = f(y, "194"); /* c */ x91 = f(y, "195"); /* c */ x91 = f(y, "196"); /* c */ x91 = f(y, "197"); /* c */ x91 = f(y, "198"); /* c */ x91 = f(y, "199"); /* c */ 
+x92 = f(y, "000"); /* c */ x92 = f(y, "001"); /* c */ x92 = f(y, "002"); /* c */ x92 = f(y, "003"); /* c */ x92 = f(y, "004"); /* c */ x92 = f(y, "005"); /* c */ x92 = f(y, "006"); /* c */ x92 = f(y, "007"); /* c */ x92 = f(y, "008"); /* c */ x92 = f(y, "009"); /* c */ x92 = f(y, "010"); /* c */ x92 = f(y, "011"); /* c */ x92 = f(y, "012"); /* c */ x92 = f(y, "013"); /* c */ x92 = f(y, "014"); /* c */ x92 = f(y, "015"); /* c */ x92 = f(y, "016"); /* c */ x92 = f(y, "017"); /* c */ x92 = f(y, "018"); /* c */ x92 = f(y, "019"); /* c */ x92 = f(y, "020"); /* c */ x92 = f(y, "021"); /* c */ x92 = f(y, "022"); /* c */ x92 = f(y, "023"); /* c */ x92 = f(y, "024"); /* c */ x92 = f(y, "025"); /* c */ x92 = f(y, "026"); /* c */ x92 = f(y, "027"); /* c */ x92 = f(y, "028"); /* c */ x92 = f(y, "029"); /* c */ x92 = f(y, "030"); /* c */ x92 = f(y, "031"); /* c */ x92 = f(y, "032"); /* c */ x92 = f(y, "033"); /* c */ x92 = f(y, "034"); /* c */ x92 = f(y, "035"); /* c */ x92 = f(y, "036"); /* c */ x92 = f(y, "037"); /* c */ x92 = f(y, "038"); /* c */ x92 = f(y, "039"); /* c */ x92 = f(y, "040"); /* c */ x92 = f(y, "041"); /* c */ x92 = f(y, "042"); /* c */ x92 = f(y, "043"); /* c */ x92 = f(y, "044"); /* c */ x92 = f(y, "045"); /* c */ x92 = f(y, "046"); /* c */ x92 = f(y, "047"); /* c */ x92 = f(y, "048"); /* c */ x92 = f(y, "049"); /* c */ x92 = f(y, "050"); /* c */ x92 = f(y, "051"); /* c */ x92 = f(y, "052"); /* c */ x92 = f(y, "053"); /* c */ x92 = f(y, "054"); /* c */ x92 = f(y, "055"); /* c */ x92 = f(y, "056"); /* c */ x92 = f(y, "057"); /* c */ x92 = f(y, "058"); /* c */ x92 = f(y, "059"); /* c */ x92 = f(y, "060"); /* c */ x92 = f(y, "061"); /* c */ x92 = f(y, "062"); /* c */ x92 = f(y, "063"); /* c */ x92 = f(y, "064"); /* c */ x92 = f(y, "065"); /* c */ x92 = f(y, "066"); /* c */ x92 = f(y, "067"); /* c */ x92 = f(y, "068"); /* c */ x92 = f(y, "069"); /* c */ x92 = f(y, "070"); /* c */ x92 = f(y, "071"); /* c */ x92 = f(y, "072"); /* c */ x92 = f(y, "073"); /* c */ x92 = f(y, "074"); /* c */ x92 = f(y, "075"); /* c */ x92 = f(y, "076"); /* c */ x92 = f(y, "077"); /* c */ x92 = f(y, "078"); /* c */ x92 = f(y, "079"); /* c */ x92 = f(y, "080"); /* c */ x92 = f(y, "081"); /* c */ x92 = f(y, "082"); /* c */ x92 = f(y, "083"); /* c */ x92 = f(y, "084"); /* c */ x92 = f(y, "085"); /* c */ x92 = f(y, "086"); /* c */ x92 = f(y, "087"); /* c */ x92 = f(y, "088"); /* c */ x92 = f(y, "089"); /* c */ x92 = f(y, "090"); /* c */ x92 = f(y, "091"); /* c */ x92 = f(y, "092"); /* c */ x92 = f(y, "093"); /* c */ x92 = f(y, "094"); /* c */ x92 = f(y, "095"); /* c */ x92 = f(y, "096"); /* c */ x92 = f(y, "097"); /* c */ x92 = f(y, "098"); /* c */ x92 = f(y, "099"); /* c */ x92 = f(y, "100"); /* c */ x92 = f(y, "101"); /* c */ x92 = f(y, "102"); /* c */ x92 = f(y, "103"); /* c */ x92 = f(y, "104"); /* c */ x92 = f(y, "105"); /* c */ x92 = f(y, "106"); /* c */ x92 = f(y, "107"); /* c */ x92 = f(y, "108"); /* c */ x92 = f(y, "109"); /* c */ x92 = f(y, "110"); /* c */ x92 = f(y, "111"); /* c */ x92 = f(y, "112"); /* c */ x92 = f(y, "113"); /* c */ x92 = f(y, "114"); /* c */ x92 = f(y, "115"); /* c */ x92 = f(y, "116"); /* c */ x92 = f(y, "117"); /* c */ x92 = f(y, "118"); /* c */ x92 = f(y, "119"); /* c */ x92 = f(y, "120"); /* c */ x92 = f(y, "121"); /* c */ x92 = f(y, "122"); /* c */ x92 = f(y, "123"); /* c */ x92 = f(y, "124"); /* c */ x92 = f(y, "125"); /* c */ x92 = f(y, "126"); /* c */ x92 = f(y, "127"); /* c */ x92 = f(y, "128"); /* c */ x92 = f(y, "129"); /* c */ x92 = f(y, "130"); /* c */ x92 = f(y, "131"); /* c */ x92 = f(y, "132"); /* c */ x92 = f(y, "133"); /* c */ x92 = f(y, "134"); /* c */ x92 = f(y, "135"); /* c */ x92 = f(y, "136"); /* c */ x92 = f(y, "137"); /* c */ x92 = f(y, "138"); /* c */ x92 = f(y, "139"); /* c */ x92 = f(y, "140"); /* c */ x92 = f(y, "141"); /* c */ x92 = f(y, "142"); /* c */ x92 = f(y, "143"); /* c */ x92 = f(y, "144"); /* c */ x92 = f(y, "145"); /* c */ x92 = f(y, "146"); /* c */ x92 = f(y, "147"); /* c */ x92 = f(y, "148"); /* c */ x92 = f(y, "149"); /* c */ x92 = f(y, "150"); /* c */ x92 = f(y, "151"); /* c */ x92 = f(y, "152"); /* c */ x92 = f(y, "153"); /* c */ x92 = f(y, "154"); /* c */ x92 = f(y, "155"); /* c */ x92 = f(y, "156"); /* c */ x92 = f(y, "157"); /* c */ x92 = f(y, "158"); /* c */ x92 = f(y, "159"); /* c */ x92 = f(y, "160"); /* c */ x92 = f(y, "161"); /* c */ x92 = f(y, "162"); /* c */ x92 = f(y, "163"); /* c */ x92 = f(y, "164"); /* c */ x92 = f(y, "165"); /* c */ x92 = f(y, "166"); /* c */ x92 = f(y, "167"); /* c */ x92 = f(y, "168"); /* c */ x92 = f(y, "169"); /* c */ x92 = f(y, "170"); /* c */ x92 = f(y, "171"); /* c */ x92 = f(y, "172"); /* c */ x92 = f(y, "173"); /* c */ x92 = f(y, "174"); /* c */ x92 = f(y, "175"); /* c */ x92 = f(y, "176"); /* c */ x92 = f(y, "177"); /* c */ x92 = f(y, "178"); /* c */ x92 = f(y, "179"); /* c */ x92 = f(y, "180"); /* c */ x92 = f(y, "181"); /* c */ x92 = f(y, "182"); /* c */ x92 = f(y, "183"); /* c */ x92 = f(y, "184"); /* c */ x92 = f(y, "185"); /* c */ x92 = f(y, "186"); /* c */ x92 = f(y, "187"); /* c */ x92 = f(y, "188"); /* c */ x92 = f(y, "189"); /* c */ x92 = f(y, "190"); /* c */ x92 = f(y, "191"); /* c */ x92 = f(y, "192"); /* c */ x92 = f(y, "193"); /* c */ x92 = f(y, "194"); /* c */ x92 = f(y, "195"); /* c */ x92 = f(y, "196"); /* c */ x92 = f(y, "197"); /* c */ x92 = f(y, "198"); /* c */ x92 = f(y, "199"); /* c */ 
+x93 = f(y, "000"); /* c */ x93 = f(y, "001"); /* c */ x93 = f(y, "002"); /* c */ x93 = f(y, "003"); /* c */ x93 = f(y, "004"); /* c */ x93 = f(y, "005"); /* c */ x93 = f(y, "006"); /* c */ x93 = f(y, "007"); /* c */ x93 = f(y, "008"); /* c */ x93 = f(y, "009"); /* c */ x93 = f(y, "010"); /* c */ x93 = f(y, "011"); /* c */ x93 = f(y, "012"); /* c */ x93 = f(y, "013"); /* c */ x93 = f(y, "014"); /* c */ x93 = f(y, "015"); /* c */ x93 = f(y, "016"); /* c */ x93 = f(y, "017"); /* c */ x93 = f(y, "018"); /* c */ x93 = f(y, "019"); /* c */ x93 = f(y, "020"); /* c */ x93 = f(y, "021"); /* c */ x93 = f(y, "022"); /* c */ x93 = f(y, "023"); /* c */ x93 = f(y, "024"); /* c */ x93 = f(y, "025"); /* c */ x93 = f(y, "026"); /* c */ x93 = f(y, "027"); /* c */ x93 = f(y, "028"); /* c */ x93 = f(y, "029"); /* c */ x93 = f(y, "030"); /* c */ x93 = f(y, "031"); /* c */ x93 = f(y, "032"); /* c */ x93 = f(y, "033"); /* c */ x93 = f(y, "034"); /* c */ x93 = f(y, "035"); /* c */ x93 = f(y, "036"); /* c */ x93 = f(y, "037"); /* c */ x93 = f(y, "038"); /* c */ x93 = f(y, "039"); /* c */ x93 = f(y, "040"); /* c */ x93 = f(y, "041"); /* c */ x93 = f(y, "042"); /* c */ x93 = f(y, "043"); /* c */ x93 = f(y, "044"); /* c */ x93 = f(y, "045"); /* c */ x93 = f(y, "046"); /* c */ x93 = f(y, "047"); /* c */ x93 = f(y, "048"); /* c */ x93 = f(y, "049"); /* c */ x93 = f(y, "050"); /* c */ x93 = f(y, "051"); /* c */ x93 = f(y, "052"); /* c */ x93 = f(y, "053"); /* c */ x93 = f(y, "054"); /* c */ x93 = f(y, "055"); /* c */ x93 = f(y, "056"); /* c */ x93 = f(y, "057"); /* c */ x93 = f(y, "058"); /* c */ x93 = f(y, "059"); /* c */ x93 = f(y, "060"); /* c */ x93 = f(y, "061"); /* c */ x93 = f(y, "062"); /* c */ x93 = f(y, "063"); /* c */ x93 = f(y, "064"); /* c */ x93 = f(y, "065"); /* c */ x93 = f(y, "066"); /* c */ x93 = f(y, "067"); /* c */ x93 = f(y, "068"); /* c */ x93 = f(y, "069"); /* c */ x93 = f(y, "070"); /* c */ x93 = f(y, "071"); /* c */ x93 = f(y, "072"); /* c */ x93 = f(y, "073"); /* c */ x93 = f(y, "074"); /* c */ x93 = f(y, "075"); /* c */ x93 = f(y, "076"); /* c */ x93 = f(y, "077"); /* c */ x93 = f(y, "078"); /* c */ x93 = f(y, "079"); /* c */ x93 = f(y, "080"); /* c */ x93 = f(y, "081"); /* c */ x93 = f(y, "082"); /* c */ x93 = f(y, "083"); /* c */ x93 = f(y, "084"); /* c */ x93 = f(y, "085"); /* c */ x93 = f(y, "086"); /* c */ x93 = f(y, "087"); /* c */ x93 = f(y, "088"); /* c */ x93 = f(y, "089"); /* c */ x93 = f(y, "090"); /* c */ x93 = f(y, "091"); /* c */ x93 = f(y, "092"); /* c */ x93 = f(y, "093"); /* c */ x93 = f(y, "094"); /* c */ x93 = f(y, "095"); /* c */ x93 = f(y, "096"); /* c */ x93 = f(y, "097"); /* c */ x93 = f(y, "098"); /* c */ x93 = f(y, "099"); /* c */ x93 = f(y, "100"); /* c */ x93 = f(y, "101"); /* c */ x93 = f(y, "102"); /* c */ x93 = f(y, "103"); /* c */ x93 = f(y, "104"); /* c */ x93 = f(y, "105"); /* c */ x93 = f(y, "106"); /* c */ x93 = f(y, "107"); /* c */ x93 = f(y, "108"); /* c */ x93 = f(y, "109"); /* c */ x93 = f(y, "110"); /* c */ x93 = f(y, "111"); /* c */ x93 = f(y, "112"); /* c */ x93 = f(y, "113"); /* c */ x93 = f(y, "114"); /* c */ x93 = f(y, "115"); /* c */ x93 = f(y, "116"); /* c */ x93 = f(y, "117"); /* c */ x93 = f(y, "118"); /* c */ x93 = f(y, "119"); /* c */ x93 = f(y, "120"); /* c */ x93 = f(y, "121"); /* c */ x93 = f(y, "122"); /* c */ x93 = f(y, "123"); /* c */ x93 = f(y, "124"); /* c */ x93 = f(y, "125"); /* c */ x93 = f(y, "126"); /* c */ x93 = f(y, "127"); /* c */ x93 = f(y, "128"); /* c */ x93 = f(y, "129"); /* c */ x93 = f(y, "130"); /* c */ x93 = f(y, "131"); /* c */ x93 = f(y, "132"); /* c */ x93 = f(y, "133"); /* c */ x93 = f(y, "134"); /* c */ x93 = f(y, "135"); /* c */ x93 = f(y, "136"); /* c */ x93 = f(y, "137"); /* c */ x93 = f(y, "138"); /* c */ x93 = f(y, "139"); /* c */ x93 = f(y, "140"); /* c */ x93 = f(y, "141"); /* c */ x93 = f(y, "142"); /* c */ x93 = f(y, "143"); /* c */ x93 = f(y, "144"); /* c */ x93 = f(y, "145"); /* c */ x93 = f(y, "146"); /* c */ x93 = f(y, "147"); /* c */ x93 = f(y, "148"); /* c */ x93 = f(y, "149"); /* c */ x93 = f(y, "150"); /* c */ x93 = f(y, "151"); /* c */ x93 = f(y, "152"); /* c */ x93 = f(y, "153"); /* c */ x93 = f(y, "154"); /* c */ x93 = f(y, "155"); /* c */ x93 = f(y, "156"); /* c */ x93 = f(y, "157"); /* c */ x93 = f(y, "158"); /* c */ x93 = f(y, "159"); /* c */ x93 = f(y, "160"); /* c */ x93 = f(y, "161"); /* c */ x93 = f(y, "162"); /* c */ x93 = f(y, "163"); /* c */ x93 = f(y, "164"); /* c */ x93 = f(y, "165"); /* c */ x93 = f(y, "166"); /* c */ x93 = f(y, "167"); /* c */ x93 = f(y, "168"); /* c */ x93 = f(y, "169"); /* c */ x93 = f(y, "170"); /* c */ x93 = f(y, "171"); /* c */ x93 = f(y, "172"); /* c */ x93 = f(y, "173"); /* c */ x93 = f(y, "174"); /* c */ x93 = f(y, "175"); /* c */ x93 = f(y, "176"); /* c */ x93 = f(y, "177"); /* c */ x93 = f(y, "178"); /* c */ x93 = f(y, "179"); /* c */ x93 = f(y, "180"); /* c */ x93 = f(y, "181"); /* c */ x93 = f(y, "182"); /* c */ x93 = f(y, "183"); /* c */ x93 = f(y, "184"); /* c */ x93 = f(y, "185"); /* c */ x93 = f(y, "186"); /* c */ x93 = f(y, "187"); /* c */ x93 = f(y, "188"); /* c */ x93 = f(y, "189"); /* c */ x93 = f(y, "190"); /* c */ x93 = f(y, "191"); /* c */ x93 = f(y, "192"); /* c */ x93 = f(y, "193"); /* c */ x93 = f(y, "194"); /* c */ x93 = f(y, "195"); /* c */ x93 = f(y, "196"); /* c */ x93 = f(y, "197"); /* c */ x93 = f(y, "198"); /* c */ x93 = f(y, "199"); /* c */ 
+x94 = f(y, "000"); /* c */ x94 = f(y, "001"); /* c */ x94 = f(y, "002"); /* c */ x94 = f(y, "003"); /* c */ x94 = f(y, "004"); /* c */ x94 = f(y, "005"); /* c */ x94 = f(y, "006"); /* c */ x94 = f(y, "007"); /* c */ x94 = f(y, "008"); /* c */ x94 = f(y, "009"); /* c */ x94 = f(y, "010"); /* c */ x94 = f(y, "011"); /* c */ x94 = f(y, "012"); /* c */ x94 = f(y, "013"); /* c */ x94 = f(y, "014"); /* c */ x94 = f(y, "015"); /* c */ x94 = f(y, "016"); /* c */ x94 = f(y, "017"); /* c */ x94 = f(y, "018"); /* c */ x94 = f(y, "019"); /* c */ x94 = f(y, "020"); /* c */ x94 = f(y, "021"); /* c */ x94 = f(y, "022"); /* c */ x94 = f(y, "023"); /* c */ x94 = f(y, "024"); /* c */ x94 = f(y, "025"); /* c */ x94 = f(y, "026"); /* c */ x94 = f(y, "027"); /* c */ x94 = f(y, "028"); /* c */ x94 = f(y, "029"); /* c */ x94 = f(y, "030"); /* c */ x94 = f(y, "031"); /* c */ x94 = f(y, "032"); /* c */ x94 = f(y, "033"); /* c */ x94 = f(y, "034"); /* c */ x94 = f(y, "035"); /* c */ x94 = f(y, "036"); /* c */ x94 = f(y, "037"); /* c */ x94 = f(y, "038"); /* c */ x94 = f(y, "039"); /* c */ x94 = f(y, "040"); /* c */ x94 = f(y, "041"); /* c */ x94 = f(y, "042"); /* c */ x94 = f(y, "043"); /* c */ x94 = f(y, "044"); /* c */ x94 = f(y, "045"); /* c */ x94 = f(y, "046"); /* c */ x94 = f(y, "047"); /* c */ x94 = f(y, "048"); /* c */ x94 = f(y, "049"); /* c */ x94 = f(y, "050"); /* c */ x94 = f(y, "051"); /* c */ x94 = f(y, "052"); /* c */ x94 = f(y, "053"); /* c */ x94 = f(y, "054"); /* c */ x94 = f(y, "055"); /* c */ x94 = f(y, "056"); /* c */ x94 = f(y, "057"); /* c */ x94 = f(y, "058"); /* c */ x94 = f(y, "059"); /* c */ x94 = f(y, "060"); /* c */ x94 = f(y, "061"); /* c */ x94 = f(y, "062"); /* c */ x94 = f(y, "063"); /* c */ x94 = f(y, "064"); /* c */ x94 = f(y, "065"); /* c */ x94 = f(y, "066"); /* c */ x94 = f(y, "067"); /* c */ x94 = f(y, "068"); /* c */ x94 = f(y, "069"); /* c */ x94 = f(y, "070"); /* c */ x94 = f(y, "071"); /* c */ x94 = f(y, "072"); /* c */ x94 = f(y, "073"); /* c */ x94 = f(y, "074"); /* c */ x94 = f(y, "075"); /* c */ x94 = f(y, "076"); /* c */ x94 = f(y, "077"); /* c */ x94 = f(y, "078"); /* c */ x94 = f(y, "079"); /* c */ x94 = f(y, "080"); /* c */ x94 = f(y, "081"); /* c */ x94 = f(y, "082"); /* c */ x94 = f(y, "083"); /* c */ x94 = f(y, "084"); /* c */ x94 = f(y, "085"); /* c */ x94 = f(y, "086"); /* c */ x94 = f(y, "087"); /* c */ x94 = f(y, "088"); /* c */ x94 = f(y, "089"); /* c */ x94 = f(y, "090"); /* c */ x94 = f(y, "091"); /* c */ x94 = f(y, "092"); /* c */ x94 = f(y, "093"); /* c */ x94 = f(y, "094"); /* c */ x94 = f(y, "095"); /* c */ x94 = f(y, "096"); /* c */ x94 = f(y, "097"); /* c */ x94 = f(y, "098"); /* c */ x94 = f(y, "099"); /* c */ x94 = f(y, "100"); /* c */ x94 = f(y, "101"); /* c */ x94 = f(y, "102"); /* c */ x94 = f(y, "103"); /* c */ x94 = f(y, "104"); /* c */ x94 = f(y, "105"); /* c */ x94 = f(y, "106"); /* c */ x94 = f(y, "107"); /* c */ x94 = f(y, "108"); /* c */ x94 = f(y, "109"); /* c */ x94 = f(y, "110"); /* c */ x94 = f(y, "111"); /* c */ x94 = f(y, "112"); /* c */ x94 = f(y, "113"); /* c */ x94 = f(y, "114"); /* c */ x94 = f(y, "115"); /* c */ x94 = f(y, "116"); /* c */ x94 = f(y, "117"); /* c */ x94 = f(y, "118"); /* c */ x94 = f(y, "119"); /* c */ x94 = f(y, "120"); /* c */ x94 = f(y, "121"); /* c */ x94 = f(y, "122"); /* c */ x94 = f(y, "123"); /* c */ x94 = f(y, "124"); /* c */ x94 = f(y, "125"); /* c */ x94 = f(y, "126"); /* c */ x94 = f(y, "127"); /* c */ x94 = f(y, "128"); /* c */ x94 = f(y, "129"); /* c */ x94 = f(y, "130"); /* c */ x94 = f(y, "131"); /* c */ x94 = f(y, "132"); /* c */ x94 = f(y, "133"); /* c */ x94 = f(y, "134"); /* c */ x94 = f(y, "135"); /* c */ x94 = f(y, "136"); /* c */ x94 = f(y, "137"); /* c */ x94 = f(y, "138"); /* c */ x94 = f(y, "139"); /* c */ x94 = f(y, "140"); /* c */ x94 = f(y, "141"); /* c */ x94 = f(y, "142"); /* c */ x94 = f(y, "143"); /* c */ x94 = f(y, "144"); /* c */ x94 = f(y, "145"); /* c */ x94 = f(y, "146"); /* c */ x94 = f(y, "147"); /* c */ x94 = f(y, "148"); /* c */ x94 = f(y, "149"); /* c */ x94 = f(y, "150"); /* c */ x94 = f(y, "151"); /* c */ x94 = f(y, "152"); /* c */ x94 = f(y, "153"); /* c */ x94 = f(y, "154"); /* c */ x94 = f(y, "155"); /* c */ x94 = f(y, "156"); /* c */ x94 = f(y, "157"); /* c */ x94 = f(y, "158"); /* c */ x94 = f(y, "159"); /* c */ x94 = f(y, "160"); /* c */ x94 = f(y, "161"); /* c */ x94 = f(y, "162"); /* c */ x94 = f(y, "163"); /* c */ x94 = f(y, "164"); /* c */ x94 = f(y, "165"); /* c */ x94 = f(y, "166"); /* c */ x94 = f(y, "167"); /* c */ x94 = f(y, "168"); /* c */ x94 = f(y, "169"); /* c */ x94 = f(y, "170"); /* c */ x94 = f(y, "171"); /* c */ x94 = f(y, "172"); /* c */ x94 = f(y, "173"); /* c */ x94 = f(y, "174"); /* c */ x94 = f(y, "175"); /* c */ x94 = f(y, "176"); /* c */ x94 = f(y, "177"); /* c */ x94 = f(y, "178"); /* c */ x94 = f(y, "179"); /* c */ x94 = f(y, "180"); /* c */ x94 = f(y, "181"); /* c */ x94 = f(y, "182"); /* c */ x94 = f(y, "183"); /* c */ x94 = f(y, "184"); /* c */ x94 = f(y, "185"); /* c */ x94 = f(y, "186"); /* c */ x94 = f(y, "187"); /* c */ x94 = f(y, "188"); /* c */ x94 = f(y, "189"); /* c */ x94 = f(y, "190"); /* c */ x94 = f(y, "191"); /* c */ x94 = f(y, "192"); /* c */ x94 = f(y, "193"); /* c */ x94 = f(y, "194"); /* c */ x94 = f(y, "195"); /* c */ x94 = f(y, "196"); /* c */ x94 = f(y, "197"); /* c */ x94 = f(y, "198"); /* c */ x94 = f(y, "199"); /* c */ 
+x95 = f(y, "000"); /* c */ x95 = f(y, "001"); /* c */ x95 = f(y, "002"); /* c */ x95 = f(y, "003"); /* c */ x95 = f(y, "004"); /* c */ x95 = f(y, "005"); /* c */ x95 = f(y, "006"); /* c */ x95 = f(y, "007"); /* c */ x95 = f(y, "008"); /* c */ x95 = f(y, "009"); /* c */ x95 = f(y, "010"); /* c */ x95 = f(y, "011"); /* c */ x95 = f(y, "012"); /* c */ x95 = f(y, "013"); /* c */ x95 = f(y, "014"); /* c */ x95 = f(y, "015"); /* c */ x95 = f(y, "016"); /* c */ x95 = f(y, "017"); /* c */ x95 = f(y, "018"); /* c */ x95 = f(y, "019"); /* c */ x95 = f(y, "020"); /* c */ x95 = f(y, "021"); /* c */ x95 = f(y, "022"); /* c */ x95 = f(y, "023"); /* c */ x95 = f(y, "024"); /* c */ x95 = f(y, "025"); /* c */ x95 = f(y, "026"); /* c */ x95 = f(y, "027"); /* c */ x95 = f(y, "028"); /* c */ x95 = f(y, "029"); /* c */ x95 = f(y, "030"); /* c */ x95 = f(y, "031"); /* c */ x95 = f(y, "032"); /* c */ x95 = f(y, "033"); /* c */ x95 = f(y, "034"); /* c */ x95 = f(y, "035"); /* c */ x95 = f(y, "036"); /* c */ x95 = f(y, "037"); /* c */ x95 = f(y, "038"); /* c */ x95 = f(y, "039"); /* c */ x95 = f(y, "040"); /* c */ x95 = f(y, "041"); /* c */ x95 = f(y, "042"); /* c */ x95 = f(y, "043"); /* c */ x95 = f(y, "044"); /* c */ x95 = f(y, "045"); /* c */ x95 = f(y, "046"); /* c */ x95 = f(y, "047"); /* c */ x95 = f(y, "048"); /* c */ x95 = f(y, "049"); /* c */ x95 = f(y, "050"); /* c */ x95 = f(y, "051"); /* c */ x95 = f(y, "052"); /* c */ x95 = f(y, "053"); /* c */ x95 = f(y, "054"); /* c */ x95 = f(y, "055"); /* c */ x95 = f(y, "056"); /* c */ x95 = f(y, "057"); /* c */ x95 = f(y, "058"); /* c */ x95 = f(y, "059"); /* c */ x95 = f(y, "060"); /* c */ x95 = f(y, "061"); /* c */ x95 = f(y, "062"); /* c */ x95 = f(y, "063"); /* c */ x95 = f(y, "064"); /* c */ x95 = f(y, "065"); /* c */ x95 = f(y, "066"); /* c */ x95 = f(y, "067"); /* c */ x95 = f(y, "068"); /* c */ x95 = f(y, "069"); /* c */ x95 = f(y, "070"); /* c */ x95 = f(y, "071"); /* c */ x95 = f(y, "072"); /* c */ x95 = f(y, "073"); /* c */ x95 = f(y, "074"); /* c */ x95 = f(y, "075"); /* c */ x95 = f(y, "076"); /* c */ x95 = f(y, "077"); /* c */ x95 = f(y, "078"); /* c */ x95 = f(y, "079"); /* c */ x95 = f(y, "080"); /* c */ x95 = f(y, "081"); /* c */ x95 = f(y, "082"); /* c */ x95 = f(y, "083"); /* c */ x95 = f(y, "084"); /* c */ x95 = f(y, "085"); /* c */ x95 = f(y, "086"); /* c */ x95 = f(y, "087"); /* c */ x95 = f(y, "088"); /* c */ x95 = f(y, "089"); /* c */ x95 = f(y, "090"); /* c */ x95 = f(y, "091"); /* c */ x95 = f(y, "092"); /* c */ x95 = f(y, "093"); /* c */ x95 = f(y, "094"); /* c */ x95 = f(y, "095"); /* c */ x95 = f(y, "096"); /* c */ x95 = f(y, "097"); /* c */ x95 = f(y, "098"); /* c */ x95 = f(y, "099"); /* c */ x95 = f(y, "100"); /* c */ x95 = f(y, "101"); /* c */ x95 = f(y, "102"); /* c */ x95 = f(y, "103"); /* c */ x95 = f(y, "104"); /* c */ x95 = f(y, "105"); /* c */ x95 = f(y, "106"); /* c */ x95 = f(y, "107"); /* c */ x95 = f(y, "108"); /* c */ x95 = f(y, "109"); /* c */ x95 = f(y, "110"); /* c */ x95 = f(y, "111"); /* c */ x95 = f(y, "112"); /* c */ x95 = f(y, "113"); /* c */ x95 = f(y, "114"); /* c */ x95 = f(y, "115"); /* c */ x95 = f(y, "116"); /* c */ x95 = f(y, "117"); /* c */ x95 = f(y, "118"); /* c */ x95 = f(y, "119"); /* c */ x95 = f(y, "120"); /* c */ x95 = f(y, "121"); /* c */ x95 = f(y, "122"); /* c */ x95 = f(y, "123"); /* c */ x95 = f(y, "124"); /* c */ x95 = f(y, "125"); /* c */ x95 = f(y, "126"); /* c */ x95 = f(y, "127"); /* c */ x95 = f(y, "128"); /* c */ x95 = f(y, "129"); /* c */ x95 = f(y, "130"); /* c */ x95 = f(y, "131"); /* c */ x95 = f(y, "132"); /* c */ x95 = f(y, "133"); /* c */ x95 = f(y, "134"); /* c */ x95 = f(y, "135"); /* c */ x95 = f(y, "136"); /* c */ x95 = f(y, "137"); /* c */ x95 = f(y, "138"); /* c */ x95 = f(y, "139"); /* c */ x95 = f(y, "140"); /* c */ x95 = f(y, "141"); /* c */ x95 = f(y, "142"); /* c */ x95 = f(y, "143"); /* c */ x95 = f(y, "144"); /* c */ x95 = f(y, "145"); /* c */ x95 = f(y, "146"); /* c */ x95 = f(y, "147"); /* c */ x95 = f(y, "148"); /* c */ x95 = f(y, "149"); /* c */ x95 = f(y, "150"); /* c */ x95 = f(y, "151"); /* c */ x95 = f(y, "152"); /* c */ x95 = f(y, "153"); /* c */ x95 = f(y, "154"); /* c */ x95 = f(y, "155"); /* c */ x95 = f(y, "156"); /* c */ x95 = f(y, "157"); /* c */ x95 = f(y, "158"); /* c */ x95 = f(y, "159"); /* c */ x95 = f(y, "160"); /* c */ x95 = f(y, "161"); /* c */ x95 = f(y, "162"); /* c */ x95 = f(y, "163"); /* c */ x95 = f(y, "164"); /* c */ x95 = f(y, "165"); /* c */ x95 = f(y, "166"); /* c */ x95 = f(y, "167"); /* c */ x95 = f(y, "168"); /* c */ x95 = f(y, "169"); /* c */ x95 = f(y, "170"); /* c */ x95 = f(y, "171"); /* c */ x95 = f(y, "172"); /* c */ x95 = f(y, "173"); /* c */ x95 = f(y, "174"); /* c */ x95 = f(y, "175"); /* c */ x95 = f(y, "176"); /* c */ x95 = f(y, "177"); /* c */ x95 = f(y, "178"); /* c */ x95 = f(y, "179"); /* c */ x95 = f(y, "180"); /* c */ x95 = f(y, "181"); /* c */ x95 = f(y, "182"); /* c */ x95 = f(y, "183"); /* c */ x95 = f(y, "184"); /* c */ x95 = f(y, "185"); /* c */ x95 = f(y, "186"); /* c */ x95 = f(y, "187"); /* c */ x95 = f(y, "188"); /* c */ x95 = f(y, "189"); /* c */ x95 = f(y, "190"); /* c */ x95 = f(y, "191"); /* c */ x95 = f(y, "192"); /* c */ x95 = f(y, "193"); /* c */ x95 = f(y, "194"); /* c */ x95 = f(y, "195"); /* c */ x95 = f(y, "196"); /* c */ x95 = f(y, "197"); /* c */ x95 = f(y, "198"); /* c */ x95 = f(y, "199"); /* c */ 
+x96 = f(y, "000"); /* c */ x96 = f(y, "001"); /* c */ x96 = f(y, "002"); /* c */ x96 = f(y, "003"); /* c */ x96 = f(y, "004"); /* c */ x96 = f(y, "005"); /* c */ x96 = f(y, "006"); /* c */ x96 = f(y, "007"); /* c */ x96 = f(y, "008"); /* c */ x96 = f(y, "009"); /* c */ x96 = f(y, "010"); /* c */ x96 = f(y, "011"); /* c */ x96 = f(y, "012"); /* c */ x96 = f(y, "013"); /* c */ x96 = f(y, "014"); /* c */ x96 = f(y, "015"); /* c */ x96 = f(y, "016"); /* c */ x96 = f(y, "017"); /* c */ x96 = f(y, "018"); /* c */ x96 = f(y, "019"); /* c */ x96 = f(y, "020"); /* c */ x96 = f(y, "021"); /* c */ x96 = f(y, "022"); /* c */ x96 = f(y, "023"); /* c */ x96 = f(y, "024"); /* c */ x96 = f(y, "025"); /* c */ x96 = f(y, "026"); /* c */ x96 = f(y, "027"); /* c */ x96 = f(y, "028"); /* c */ x96 = f(y, "029"); /* c */ x96 = f(y, "030"); /* c */ x96 = f(y, "031"); /* c */ x96 = f(y, "032"); /* c */ x96 = f(y, "033"); /* c */ x96 = f(y, "034"); /* c */ x96 = f(y, "035"); /* c */ x96 = f(y, "036"); /* c */ x96 = f(y, "037"); /* c */ x96 = f(y, "038"); /* c */ x96 = f(y, "039"); /* c */ x96 = f(y, "040"); /* c */ x96 = f(y, "041"); /* c */ x96 = f(y, "042"); /* c */ x96 = f(y, "043"); /* c */ x96 = f(y, "044"); /* c */ x96 = f(y, "045"); /* c */ x96 = f(y, "046"); /* c */ x96 = f(y, "047"); /* c */ x96 = f(y, "048"); /* c */ x96 = f(y, "049"); /* c */ x96 = f(y, "050"); /* c */ x96 = f(y, "051"); /* c */ x96 = f(y, "052"); /* c */ x96 = f(y, "053"); /* c */ x96 = f(y, "054"); /* c */ x96 = f(y, "055"); /* c */ x96 = f(y, "056"); /* c */ x96 = f(y, "057"); /* c */ x96 = f(y, "058"); /* c */ x96 = f(y, "059"); /* c */ x96 = f(y, "060"); /* c */ x96 = f(y, "061"); /* c */ x96 = f(y, "062"); /* c */ x96 = f(y, "063"); /* c */ x96 = f(y, "064"); /* c */ x96 = f(y, "065"); /* c */ x96 = f(y, "066"); /* c */ x96 = f(y, "067"); /* c */ x96 = f(y, "068"); /* c */ x96 = f(y, "069"); /* c */ x96 = f(y, "070"); /* c */ x96 = f(y, "071"); /* c */ x96 = f(y, "072"); /* c */ x96 = f(y, "073"); /* c */ x96 = f(y, "074"); /* c */ x96 = f(y, "075"); /* c */ x96 = f(y, "076"); /* c */ x96 = f(y, "077"); /* c */ x96 = f(y, "078"); /* c */ x96 = f(y, "079"); /* c */ x96 = f(y, "080"); /* c */ x96 = f(y, "081"); /* c */ x96 = f(y, "082"); /* c */ x96 = f(y, "083"); /* c */ x96 = f(y, "084"); /* c */ x96 = f(y, "085"); /* c */ x96 = f(y, "086"); /* c */ x96 = f(y, "087"); /* c */ x96 = f(y, "088"); /* c */ x96 = f(y, "089"); /* c */ x96 = f(y, "090"); /* c */ x96 = f(y, "091"); /* c */ x96 = f(y, "092"); /* c */ x96 = f(y, "093"); /* c */ x96 = f(y, "094"); /* c */ x96 = f(y, "095"); /* c */ x96 = f(y, "096"); /* c */ x96 = f(y, "097"); /* c */ x96 = f(y, "098"); /* c */ x96 = f(y, "099"); /* c */ x96 = f(y, "100"); /* c */ x96 = f(y, "101"); /* c */ x96 = f(y, "102"); /* c */ x96 = f(y, "103"); /* c */ x96 = f(y, "104"); /* c */ x96 = f(y, "105"); /* c */ x96 = f(y, "106"); /* c */ x96 = f(y, "107"); /* c */ x96 = f(y, "108"); /* c */ x96 = f(y, "109"); /* c */ x96 = f(y, "110"); /* c */ x96 = f(y, "111"); /* c */ x96 = f(y, "112"); /* c */ x96 = f(y, "113"); /* c */ x96 = f(y, "114"); /* c */ x96 = f(y, "115"); /* c */ x96 = f(y, "116"); /* c */ x96 = f(y, "117"); /* c */ x96 = f(y, "118"); /* c */ x96 = f(y, "119"); /* c */ x96 = f(y, "120"); /* c */ x96 = f(y, "121"); /* c */ x96 = f(y, "122"); /* c */ x96 = f(y, "123"); /* c */ x96 = f(y, "124"); /* c */ x96 = f(y, "125"); /* c */ x96 = f(y, "126"); /* c */ x96 = f(y, "127"); /* c */ x96 = f(y, "128"); /* c */ x96 = f(y, "129"); /* c */ x96 = f(y, "130"); /* c */ x96 = f(y, "131"); /* c */ x96 = f(y, "132"); /* c */ x96 = f(y, "133"); /* c */ x96 = f(y, "134"); /* c */ x96 = f(y, "135"); /* c */ x96 = f(y, "136"); /* c */ x96 = f(y, "137"); /* c */ x96 = f(y, "138"); /* c */ x96 = f(y, "139"); /* c */ x96 = f(y, "140"); /* c */ x96 = f(y, "141"); /* c */ x96 = f(y, "142"); /* c */ x96 = f(y, "143"); /* c */ x96 = f(y, "144"); /* c */ x96 = f(y, "145"); /* c */ x96 = f(y, "146"); /* c */ x96 = f(y, "147"); /* c */ x96 = f(y, "148"); /* c */ x96 = f(y, "149"); /* c */ x96 = f(y, "150"); /* c */ x96 = f(y, "151"); /* c */ x96 = f(y, "152"); /* c */ x96 = f(y, "153"); /* c */ x96 = f(y, "154"); /* c */ x96 = f(y, "155"); /* c */ x96 = f(y, "156"); /* c */ x96 = f(y, "157"); /* c */ x96 = f(y, "158"); /* c */ x96 = f(y, "159"); /* c */ x96 = f(y, "160"); /* c */ x96 = f(y, "161"); /* c */ x96 = f(y, "162"); /* c */ x96 = f(y, "163"); /* c */ x96 = f(y, "164"); /* c */ x96 = f(y, "165"); /* c */ x96 = f(y, "166"); /* c */ x96 = f(y, "167"); /* c */ x96 = f(y, "168"); /* c */ x96 = f(y, "169"); /* c */ x96 = f(y, "170"); /* c */ x96 = f(y, "171"); /* c */ x96 = f(y, "172"); /* c */ x96 = f(y, "173"); /* c */ x96 = f(y, "174"); /* c */ x96 = f(y, "175"); /* c */ x96 = f(y, "176"); /* c */ x96 = f(y, "177"); /* c */ x96 = f(y, "178"); /* c */ x96 = f(y, "179"); /* c */ x96 = f(y, "180"); /* c */ x96 = f(y, "181"); /* c */ x96 = f(y, "182"); /* c */ x96 = f(y, "183"); /* c */ x96 = f(y, "184"); /* c */ x96 = f(y, "185"); /* c */ x96 = f(y, "186"); /* c */ x96 = f(y, "187"); /* c */ x96 = f(y, "188"); /* c */ x96 = f(y, "189"); /* c */ x96 = f(y, "190"); /* c */ x96 = f(y, "191"); /* c */ x96 = f(y, "192"); /* c */ x96 = f(y, "193"); /* c */ x96 = f(y, "194"); /* c */ x96 = f(y, "195"); /* c */ x96 = f(y, "196"); /* c */ x96 = f(y, "197"); /* c */ x96 = f(y, "198"); /* c */ x96 = f(y, "199"); /* c */ 
+x97 = f(y, "000"); /* c */ x97 = f(y, "001"); /* c */ x97 = f(y, "002"); /* c */ x97 = f(y, "003"); /* c */ x97 = f(y, "004"); /* c */ x97 = f(y, "005"); /* c */ x97 = f(y, "006"); /* c */ x97 = f(y, "007"); /* c */ x97 = f(y, "008"); /* c */ x97 = f(y, "009"); /* c */ x97 = f(y, "010"); /* c */ x97 = f(y, "011"); /* c */ x97 = f(y, "012"); /* c */ x97 = f(y, "013"); /* c */ x97 = f(y, "014"); /* c */ x97 = f(y, "015"); /* c */ x97 = f(y, "016"); /* c */ x97 = f(y, "017"); /* c */ x97 = f(y, "018"); /* c */ x97 = f(y, "019"); /* c */ x97 = f(y, "020"); /* c */ x97 = f(y, "021"); /* c */ x97 = f(y, "022"); /* c */ x97 = f(y, "023"); /* c */ x97 = f(y, "024"); /* c */ x97 = f(y, "025"); /* c */ x97 = f(y, "026"); /* c */ x97 = f(y, "027"); /* c */ x97 = f(y, "028"); /* c */ x97 = f(y, "029"); /* c */ x97 = f(y, "030"); /* c */ x97 = f(y, "031"); /* c */ x97 = f(y, "032"); /* c */ x97 = f(y, "033"); /* c */ x97 = f(y, "034"); /* c */ x97 = f(y, "035"); /* c */ x97 = f(y, "036"); /* c */ x97 = f(y, "037"); /* c */ x97 = f(y, "038"); /* c */ x97 = f(y, "039"); /* c */ x97 = f(y, "040"); /* c */ x97 = f(y, "041"); /* c */ x97 = f(y, "042"); /* c */ x97 = f(y, "043"); /* c */ x97 = f(y, "044"); /* c */ x97 = f(y, "045"); /* c */ x97 = f(y, "046"); /* c */ x97 = f(y, "047"); /* c */ x97 = f(y, "048"); /* c */ x97 = f(y, "049"); /* c */ x97 = f(y, "050"); /* c */ x97 = f(y, "051"); /* c */ x97 = f(y, "052"); /* c */ x97 = f(y, "053"); /* c */ x97 = f(y, "054"); /* c */ x97 = f(y, "055"); /* c */ x97 = f(y, "056"); /* c */ x97 = f(y, "057"); /* c */ x97 = f(y, "058"); /* c */ x97 = f(y, "059"); /* c */ x97 = f(y, "060"); /* c */ x97 = f(y, "061"); /* c */ x97 = f(y, "062"); /* c */ x97 = f(y, "063"); /* c */ x97 = f(y, "064"); /* c */ x97 = f(y, "065"); /* c */ x97 = f(y, "066"); /* c */ x97 = f(y, "067"); /* c */ x97 = f(y, "068"); /* c */ x97 = f(y, "069"); /* c */ x97 = f(y, "070"); /* c */ x97 = f(y, "071"); /* c */ x97 = f(y, "072"); /* c */ x97 = f(y, "073"); /* c */ x97 = f(y, "074"); /* c */ x97 = f(y, "075"); /* c */ x97 = f(y, "076"); /* c */ x97 = f(y, "077"); /* c */ x97 = f(y, "078"); /* c */ x97 = f(y, "079"); /* c */ x97 = f(y, "080"); /* c */ x97 = f(y, "081"); /* c */ x97 = f(y, "082"); /* c */ x97 = f(y, "083"); /* c */ x97 = f(y, "084"); /* c */ x97 = f(y, "085"); /* c */ x97 = f(y, "086"); /* c */ x97 = f(y, "087"); /* c */ x97 = f(y, "088"); /* c */ x97 = f(y, "089"); /* c */ x97 = f(y, "090"); /* c */ x97 = f(y, "091"); /* c */ x97 = f(y, "092"); /* c */ x97 = f(y, "093"); /* c */ x97 = f(y, "094"); /* c */ x97 = f(y, "095"); /* c */ x97 = f(y, "096"); /* c */ x97 = f(y, "097"); /* c */ x97 = f(y, "098"); /* c */ x97 = f(y, "099"); /* c */ x97 = f(y, "100"); /* c */ x97 = f(y, "101"); /* c */ x97 = f(y, "102"); /* c */ x97 = f(y, "103"); /* c */ x97 = f(y, "104"); /* c */ x97 = f(y, "105"); /* c */ x97 = f(y, "106"); /* c */ x97 = f(y, "107"); /* c */ x97 = f(y, "108"); /* c */ x97 = f(y, "109"); /* c */ x97 = f(y, "110"); /* c */ x97 = f(y, "111"); /* c */ x97 = f(y, "112"); /* c */ x97 = f(y, "113"); /* c */ x97 = f(y, "114"); /* c */ x97 = f(y, "115"); /* c */ x97 = f(y, "116"); /* c */ x97 = f(y, "117"); /* c */ x97 = f(y, "118"); /* c */ x97 = f(y, "119"); /* c */ x97 = f(y, "120"); /* c */ x97 = f(y, "121"); /* c */ x97 = f(y, "122"); /* c */ x97 = f(y, "123"); /* c */ x97 = f(y, "124"); /* c */ x97 = f(y, "125"); /* c */ x97 = f(y, "126"); /* c */ x97 = f(y, "127"); /* c */ x97 = f(y, "128"); /* c */ x97 = f(y, "129"); /* c */ x97 = f(y, "130"); /* c */ x97 = f(y, "131"); /* c */ x97 = f(y, "132"); /* c */ x97 = f(y, "133"); /* c */ x97 = f(y, "134"); /* c */ x97 = f(y, "135"); /* c */ x97 = f(y, "136"); /* c */ x97 = f(y, "137"); /* c */ x97 = f(y, "138"); /* c */ x97 = f(y, "139"); /* c */ x97 = f(y, "140"); /* c */ x97 = f(y, "141"); /* c */ x97 = f(y, "142"); /* c */ x97 = f(y, "143"); /* c */ x97 = f(y, "144"); /* c */ x97 = f(y, "145"); /* c */ x97 = f(y, "146"); /* c */ x97 = f(y, "147"); /* c */ x97 = f(y, "148"); /* c */ x97 = f(y, "149"); /* c */ x97 = f(y, "150"); /* c */ x97 = f(y, "151"); /* c */ x97 = f(y, "152"); /* c */ x97 = f(y, "153"); /* c */ x97 = f(y, "154"); /* c */ x97 = f(y, "155"); /* c */ x97 = f(y, "156"); /* c */ x97 = f(y, "157"); /* c */ x97 = f(y, "158"); /* c */ x97 = f(y, "159"); /* c */ x97 = f(y, "160"); /* c */ x97 = f(y, "161"); /* c */ x97 = f(y, "162"); /* c */ x97 = f(y, "163"); /* c */ x97 = f(y, "164"); /* c */ x97 = f(y, "165"); /* c */ x97 = f(y, "166"); /* c */ x97 = f(y, "167"); /* c */ x97 = f(y, "168"); /* c */ x97 = f(y, "169"); /* c */ x97 = f(y, "170"); /* c */ x97 = f(y, "171"); /* c */ x97 = f(y, "172"); /* c */ x97 = f(y, "173"); /* c */ x97 = f(y, "174"); /* c */ x97 = f(y, "175"); /* c */ x97 = f(y, "176"); /* c */ x97 = f(y, "177"); /* c */ x97 = f(y, "178"); /* c */ x97 = f(y, "179"); /* c */ x97 = f(y, "180"); /* c */ x97 = f(y, "181"); /* c */ x97 = f(y, "182"); /* c */ x97 = f(y, "183"); /* c */ x97 = f(y, "184"); /* c */ x97 = f(y, "185"); /* c */ x97 = f(y, "186"); /* c */ x97 = f(y, "187"); /* c */ x97 = f(y, "188"); /* c */ x97 = f(y, "189"); /* c */ x97 = f(y, "190"); /* c */ x97 = f(y, "191"); /* c */ x97 = f(y, "192"); /* c */ x97 = f(y, "193"); /* c */ x97 = f(y, "194"); /* c */ x97 = f(y, "195"); /* c */ x97 = f(y, "196"); /* c */ x97 = f(y, "197"); /* c */ x97 = f(y, "198"); /* c */ x97 = f(y, "199"); /* c */ 
+x98 = f(y, "000"); /* c */ x98 = f(y, "001"); /* c */ x98 = f(y, "002"); /* c */ x98 = f(y, "003"); /* c */ x98 = f(y, "004"); /* c */ x98 = f(y, "005"); /* c */ x98 = f(y, "006"); /* c */ x98 = f(y, "007"); /* c */ x98 = f(y, "008"); /* c */ x98 = f(y, "009"); /* c */ x98 = f(y, "010"); /* c */ x98 = f(y, "011"); /* c */ x98 = f(y, "012"); /* c */ x98 = f(y, "013"); /* c */ x98 = f(y, "014"); /* c */ x98 = f(y, "015"); /* c */ x98 = f(y, "016"); /* c */ x98 = f(y, "017"); /* c */ x98 = f(y, "018"); /* c */ x98 = f(y, "019"); /* c */ x98 = f(y, "020"); /* c */ x98 = f(y, "021"); /* c */ x98 = f(y, "022"); /* c */ x98 = f(y, "023"); /* c */ x98 = f(y, "024"); /* c */ x98 = f(y, "025"); /* c */ x98 = f(y, "026"); /* c */ x98 = f(y, "027"); /* c */ x98 = f(y, "028"); /* c */ x98 = f(y, "029"); /* c */ x98 = f(y, "030"); /* c */ x98 = f(y, "031"); /* c */ x98 = f(y, "032"); /* c */ x98 = f(y, "033"); /* c */ x98 = f(y, "034"); /* c */ x98 = f(y, "035"); /* c */ x98 = f(y, "036"); /* c */ x98 = f(y, "037"); /* c */ x98 = f(y, "038"); /* c */ x98 = f(y, "039"); /* c */ x98 = f(y, "040"); /* c */ x98 = f(y, "041"); /* c */ x98 = f(y, "042"); /* c */ x98 = f(y, "043"); /* c */ x98 = f(y, "044"); /* c */ x98 = f(y, "045"); /* c */ x98 = f(y, "046"); /* c */ x98 = f(y, "047"); /* c */ x98 = f(y, "048"); /* c */ x98 = f(y, "049"); /* c */ x98 = f(y, "050"); /* c */ x98 = f(y, "051"); /* c */ x98 = f(y, "052"); /* c */ x98 = f(y, "053"); /* c */ x98 = f(y, "054"); /* c */ x98 = f(y, "055"); /* c */ x98 = f(y, "056"); /* c */ x98 = f(y, "057"); /* c */ x98 = f(y, "058"); /* c */ x98 = f(y, "059"); /* c */ x98 = f(y, "060"); /* c */ x98 = f(y, "061"); /* c */ x98 = f(y, "062"); /* c */ x98 = f(y, "063"); /* c */ x98 = f(y, "064"); /* c */ x98 = f(y, "065"); /* c */ x98 = f(y, "066"); /* c */ x98 = f(y, "067"); /* c */ x98 = f(y, "068"); /* c */ x98 = f(y, "069"); /* c */ x98 = f(y, "070"); /* c */ x98 = f(y, "071"); /* c */ x98 = f(y, "072"); /* c */ x98 = f(y, "073"); /* c */ x98 = f(y, "074"); /* c */ x98 = f(y, "075"); /* c */ x98 = f(y, "076"); /* c */ x98 = f(y, "077"); /* c */ x98 = f(y, "078"); /* c */ x98 = f(y, "079"); /* c */ x98 = f(y, "080"); /* c */ x98 = f(y, "081"); /* c */ x98 = f(y, "082"); /* c */ x98 = f(y, "083"); /* c */ x98 = f(y, "084"); /* c */ x98 = f(y, "085"); /* c */ x98 = f(y, "086"); /* c */ x98 = f(y, "087"); /* c */ x98 = f(y, "088"); /* c */ x98 = f(y, "089"); /* c */ x98 = f(y, "090"); /* c */ x98 = f(y, "091"); /* c */ x98 = f(y, "092"); /* c */ x98 = f(y, "093"); /* c */ x98 = f(y, "094"); /* c */ x98 = f(y, "095"); /* c */ x98 = f(y, "096"); /* c */ x98 = f(y, "097"); /* c */ x98 = f(y, "098"); /* c */ x98 = f(y, "099"); /* c */ x98 = f(y, "100"); /* c */ x98 = f(y, "101"); /* c */ x98 = f(y, "102"); /* c */ x98 = f(y, "103"); /* c */ x98 = f(y, "104"); /* c */ x98 = f(y, "105"); /* c */ x98 = f(y, "106"); /* c */ x98 = f(y, "107"); /* c */ x98 = f(y, "108"); /* c */ x98 = f(y, "109"); /* c */ x98 = f(y, "110"); /* c */ x98 = f(y, "111"); /* c */ x98 = f(y, "112"); /* c */ x98 = f(y, "113"); /* c */ x98 = f(y, "114"); /* c */ x98 = f(y, "115"); /* c */ x98 = f(y, "116"); /* c */ x98 = f(y, "117"); /* c */ x98 = f(y, "118"); /* c */ x98 = f(y, "119"); /* c */ x98 = f(y, "120"); /* c */ x98 = f(y, "121"); /* c */ x98 = f(y, "122"); /* c */ x98 = f(y, "123"); /* c */ x98 = f(y, "124"); /* c */ x98 = f(y, "125"); /* c */ x98 = f(y, "126"); /* c */ x98 = f(y, "127"); /* c */ x98 = f(y, "128"); /* c */ x98 = f(y, "129"); /* c */ x98 = f(y, "130"); /* c */ x98 = f(y, "131"); /* c */ x98 = f(y, "132"); /* c */ x98 = f(y, "133"); /* c */ x98 = f(y, "134"); /* c */ x98 = f(y, "135"); /* c */ x98 = f(y, "136"); /* c */ x98 = f(y, "137"); /* c */ x98 = f(y, "138"); /* c */ x98 = f(y, "139"); /* c */ x98 = f(y, "140"); /* c */ x98 = f(y, "141"); /* c */ x98 = f(y, "142"); /* c */ x98 = f(y, "143"); /* c */ x98 = f(y, "144"); /* c */ x98 = f(y, "145"); /* c */ x98 = f(y, "146"); /* c */ x98 = f(y, "147"); /* c */ x98 = f(y, "148"); /* c */ x98 = f(y, "149"); /* c */ x98 = f(y, "150"); /* c */ x98 = f(y, "151"); /* c */ x98 = f(y, "152"); /* c */ x98 = f(y, "153"); /* c */ x98 = f(y, "154"); /* c */ x98 = f(y, "155"); /* c */ x98 = f(y, "156"); /* c */ x98 = f(y, "157"); /* c */ x98 = f(y, "158"); /* c */ x98 = f(y, "159"); /* c */ x98 = f(y, "160"); /* c */ x98 = f(y, "161"); /* c */ x98 = f(y, "162"); /* c */ x98 = f(y, "163"); /* c */ x98 = f(y, "164"); /* c */ x98 = f(y, "165"); /* c */ x98 = f(y, "166"); /* c */ x98 = f(y, "167"); /* c */ x98 = f(y, "168"); /* c */ x98 = f(y, "169"); /* c */ x98 = f(y, "170"); /* c */ x98 = f(y, "171"); /* c */ x98 = f(y, "172"); /* c */ x98 = f(y, "173"); /* c */ x98 = f(y, "174"); /* c */ x98 = f(y, "175"); /* c */ x98 = f(y, "176"); /* c */ x98 = f(y, "177"); /* c */ x98 = f(y, "178"); /* c */ x98 = f(y, "179"); /* c */ x98 = f(y, "180"); /* c */ x98 = f(y, "181"); /* c */ x98 = f(y, "182"); /* c */ x98 = f(y, "183"); /* c */ x98 = f(y, "184"); /* c */ x98 = f(y, "185"); /* c */ x98 = f(y, "186"); /* c */ x98 = f(y, "187"); /* c */ x98 = f(y, "188"); /* c */ x98 = f(y, "189"); /* c */ x98 = f(y, "190"); /* c */ x98 = f(y, "191"); /* c */ x98 = f(y, "192"); /* c */ x98 = f(y, "193"); /* c */ x98 = f(y, "194"); /* c */ x98 = f(y, "195"); /* c */ x98 = f(y, "196"); /* c */ x98 = f(y, "197"); /* c */ x98 = f(y, "198"); /* c */ x98 = f(y, "199"); /* c */ 
+x99 = f(y, "000"); /* c */ x99 = f(y, "001"); /* c */ x99 = f(y, "002"); /* c */ x99 = f(y, "003"); /* c */ x99 = f(y, "004"); /* c */ x99 = f(y, "005"); /* c */ x99 = f(y, "006"); /* c */ x99 = f(y, "007"); /* c */ x99 = f(y, "008"); /* c */ x99 = f(y, "009"); /* c */ x99 = f(y, "010"); /* c */ x99 = f(y, "011"); /* c */ x99 = f(y, "012"); /* c */ x99 = f(y, "013"); /* c */ x99 = f(y, "014"); /* c */ x99 = f(y, "015"); /* c */ x99 = f(y, "016"); /* c */ x99 = f(y, "017"); /* c */ x99 = f(y, "018"); /* c */ x99 = f(y, "019"); /* c */ x99 = f(y, "020"); /* c */ x99 = f(y, "021"); /* c */ x99 = f(y, "022"); /* c */ x99 = f(y, "023"); /* c */ x99 = f(y, "024"); /* c */ x99 = f(y, "025"); /* c */ x99 = f(y, "026"); /* c */ x99 = f(y, "027"); /* c */ x99 = f(y, "028"); /* c */ x99 = f(y, "029"); /* c */ x99 = f(y, "030"); /* c */ x99 = f(y, "031"); /* c */ x99 = f(y, "032"); /* c */ x99 = f(y, "033"); /* c */ x99 = f(y, "034"); /* c */ x99 = f(y, "035"); /* c */ x99 = f(y, "036"); /* c */ x99 = f(y, "037"); /* c */ x99 = f(y, "038"); /* c */ x99 = f(y, "039"); /* c */ x99 = f(y, "040"); /* c */ x99 = f(y, "041"); /* c */ x99 = f(y, "042"); /* c */ x99 = f(y, "043"); /* c */ x99 = f(y, "044"); /* c */ x99 = f(y, "045"); /* c */ x99 = f(y, "046"); /* c */ x99 = f(y, "047"); /* c */ x99 = f(y, "048"); /* c */ x99 = f(y, "049"); /* c */ x99 = f(y, "050"); /* c */ x99 = f(y, "051"); /* c */ x99 = f(y, "052"); /* c */ x99 = f(y, "053"); /* c */ x99 = f(y, "054"); /* c */ x99 = f(y, "055"); /* c */ x99 = f(y, "056"); /* c */ x99 = f(y, "057"); /* c */ x99 = f(y, "058"); /* c */ x99 = f(y, "059"); /* c */ x99 = f(y, "060"); /* c */ x99 = f(y, "061"); /* c */ x99 = f(y, "062"); /* c */ x99 = f(y, "063"); /* c */ x99 = f(y, "064"); /* c */ x99 = f(y, "065"); /* c */ x99 = f(y, "066"); /* c */ x99 = f(y, "067"); /* c */ x99 = f(y, "068"); /* c */ x99 = f(y, "069"); /* c */ x99 = f(y, "070"); /* c */ x99 = f(y, "071"); /* c */ x99 = f(y, "072"); /* c */ x99 = f(y, "073"); /* c */ x99 = f(y, "074"); /* c */ x99 = f(y, "075"); /* c */ x99 = f(y, "076"); /* c */ x99 = f(y, "077"); /* c */ x99 = f(y, "078"); /* c */ x99 = f(y, "079"); /* c */ x99 = f(y, "080"); /* c */ x99 = f(y, "081"); /* c */ x99 = f(y, "082"); /* c */ x99 = f(y, "083"); /* c */ x99 = f(y, "084"); /* c */ x99 = f(y, "085"); /* c */ x99 = f(y, "086"); /* c */ x99 = f(y, "087"); /* c */ x99 = f(y, "088"); /* c */ x99 = f(y, "089"); /* c */ x99 = f(y, "090"); /* c */ x99 = f(y, "091"); /* c */ x99 = f(y, "092"); /* c */ x99 = f(y, "093"); /* c */ x99 = f(y, "094"); /* c */ x99 = f(y, "095"); /* c */ x99 = f(y, "096"); /* c */ x99 = f(y, "097"); /* c */ x99 = f(y, "098"); /* c */ x99 = f(y, "099"); /* c */ x99 = f(y, "100"); /* c */ x99 = f(y, "101"); /* c */ x99 = f(y, "102"); /* c */ x99 = f(y, "103"); /* c */ x99 = f(y, "104"); /* c */ x99 = f(y, "105"); /* c */ x99 = f(y, "106"); /* c */ x99 = f(y, "107"); /* c */ x99 = f(y, "108"); /* c */ x99 = f(y, "109"); /* c */ x99 = f(y, "110"); /* c */ x99 = f(y, "111"); /* c */ x99 = f(y, "112"); /* c */ x99 = f(y, "113"); /* c */ x99 = f(y, "114"); /* c */ x99 = f(y, "115"); /* c */ x99 = f(y, "116"); /* c */ x99 = f(y, "117"); /* c */ x99 = f(y, "118"); /* c */ x99 = f(y, "119"); /* c */ x99 = f(y, "120"); /* c */ x99 = f(y, "121"); /* c */ x99 = f(y, "122"); /* c */ x99 = f(y, "123"); /* c */ x99 = f(y, "124"); /* c */ x99 = f(y, "125"); /* c */ x99 = f(y, "126"); /* c */ x99 = f(y, "127"); /* c */ x99 = f(y, "128"); /* c */ x99 = f(y, "129"); /* c */ x99 = f(y, "130"); /* c */ x99 = f(y, "131"); /* c */ x99 = f(y, "132"); /* c */ x99 = f(y, "133"); /* c */ x99 = f(y, "134"); /* c */ x99 = f(y, "135"); /* c */ x99 = f(y, "136"); /* c */ x99 = f(y, "137"); /* c */ x99 = f(y, "138"); /* c */ x99 = f(y, "139"); /* c */ x99 = f(y, "140"); /* c */ x99 = f(y, "141"); /* c */ x99 = f(y, "142"); /* c */ x99 = f(y, "143"); /* c */ x99 = f(y, "144"); /* c */ x99 = f(y, "145"); /* c */ x99 = f(y, "146"); /* c */ x99 = f(y, "147"); /* c */ x99 = f(y, "148"); /* c */ x99 = f(y, "149"); /* c */ x99 = f(y, "150"); /* c */ x99 = f(y, "151"); /* c */ x99 = f(y, "152"); /* c */ x99 = f(y, "153"); /* c */ x99 = f(y, "154"); /* c */ x99 = f(y, "155"); /* c */ x99 = f(y, "156"); /* c */ x99 = f(y, "157"); /* c */ x99 = f(y, "158"); /* c */ x99 = f(y, "159"); /* c */ x99 = f(y, "160"); /* c */ x99 = f(y, "161"); /* c */ x99 = f(y, "162"); /* c */ x99 = f(y, "163"); /* c */ x99 = f(y, "164"); /* c */ x99 = f(y, "165"); /* c */ x99 = f(y, "166"); /* c */ x99 = f(y, "167"); /* c */ x99 = f(y, "168"); /* c */ x99 = f(y, "169"); /* c */ x99 = f(y, "170"); /* c */ x99 = f(y, "171"); /* c */ x99 = f(y, "172"); /* c */ x99 = f(y, "173"); /* c */ x99 = f(y, "174"); /* c */ x99 = f(y, "175"); /* c */ x99 = f(y, "176"); /* c */ x99 = f(y, "177"); /* c */ x99 = f(y, "178"); /* c */ x99 = f(y, "179"); /* c */ x99 = f(y, "180"); /* c */ x99 = f(y, "181"); /* c */ x99 = f(y, "182"); /* c */ x99 = f(y, "183"); /* c */ x99 = f(y, "184"); /* c */ x99 = f(y, "185"); /* c */ x99 = f(y, "186"); /* c */ x99 = f(y, "187"); /* c */ x99 = f(y, "188"); /* c */ x99 = f(y, "189"); /* c */ x99 = f(y, "190"); /* c */ x99 = f(y, "191"); /* c */ x99 = f(y, "192"); /* c */ x99 = f(y, "193"); /* c */ x99 = f(y, "194"); /* c */ x99 = f(y, "195"); /* c */ x99 = f(y, "196"); /* c */ x99 = f(y, "197"); /* c */ x99 = f(y, "198"); /* c */ x99 = f(y, "199"); /* c */ 
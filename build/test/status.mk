@@ -0,0 +1,82 @@
+build/test/status.o: test/status.c test/test.h src/util/macros.h \
+ src/util/string-view.h src/util/ascii.h src/util/macros.h \
+ src/util/debug.h src/util/errorcode.h src/util/xmemrchr.h \
+ src/util/xstring.h src/util/string.h src/util/arith.h src/util/bit.h \
+ src/util/str-util.h src/util/string-view.h src/util/unicode.h \
+ src/util/xmalloc.h src/cmdline.h src/command/run.h src/command/error.h \
+ src/history.h src/command/error.h src/util/hashmap.h \
+ src/util/container.h src/util/macros.h src/util/string.h \
+ src/util/ptr-array.h src/util/string-view.h src/commands.h src/config.h \
+ src/util/align.h src/util/errorcode.h src/encoding.h src/search.h \
+ src/view.h src/block-iter.h src/block.h src/util/debug.h src/util/list.h \
+ src/util/unicode.h src/status.h src/mode.h src/terminal/key.h \
+ src/util/intmap.h src/options.h src/regexp.h src/window.h src/buffer.h \
+ src/change.h src/lock.h src/syntax/syntax.h src/command/error.h \
+ src/syntax/bitset.h src/util/debug.h src/syntax/color.h \
+ src/terminal/style.h src/terminal/color.h src/terminal/feature.h \
+ src/util/ptr-array.h src/util/hashmap.h src/util/hashset.h src/frame.h \
+ src/util/intern.h src/util/hashset.h src/util/utf8.h
+test/test.h:
+src/util/macros.h:
+src/util/string-view.h:
+src/util/ascii.h:
+src/util/macros.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/xmemrchr.h:
+src/util/xstring.h:
+src/util/string.h:
+src/util/arith.h:
+src/util/bit.h:
+src/util/str-util.h:
+src/util/string-view.h:
+src/util/unicode.h:
+src/util/xmalloc.h:
+src/cmdline.h:
+src/command/run.h:
+src/command/error.h:
+src/history.h:
+src/command/error.h:
+src/util/hashmap.h:
+src/util/container.h:
+src/util/macros.h:
+src/util/string.h:
+src/util/ptr-array.h:
+src/util/string-view.h:
+src/commands.h:
+src/config.h:
+src/util/align.h:
+src/util/errorcode.h:
+src/encoding.h:
+src/search.h:
+src/view.h:
+src/block-iter.h:
+src/block.h:
+src/util/debug.h:
+src/util/list.h:
+src/util/unicode.h:
+src/status.h:
+src/mode.h:
+src/terminal/key.h:
+src/util/intmap.h:
+src/options.h:
+src/regexp.h:
+src/window.h:
+src/buffer.h:
+src/change.h:
+src/lock.h:
+src/syntax/syntax.h:
+src/command/error.h:
+src/syntax/bitset.h:
+src/util/debug.h:
+src/syntax/color.h:
+src/terminal/style.h:
+src/terminal/color.h:
+src/terminal/feature.h:
+src/util/ptr-array.h:
+src/util/hashmap.h:
+src/util/hashset.h:
+src/frame.h:
+src/util/intern.h:
+src/util/hashset.h:
+src/util/utf8.h:
@@ -0,0 +1,100 @@
+build/test/terminal.o: test/terminal.c test/test.h src/util/macros.h \
+ src/util/string-view.h src/util/ascii.h src/util/macros.h \
+ src/util/debug.h src/util/errorcode.h src/util/xmemrchr.h \
+ src/util/xstring.h src/util/string.h src/util/arith.h src/util/bit.h \
+ src/util/str-util.h src/util/string-view.h src/util/unicode.h \
+ src/util/xmalloc.h src/terminal/color.h src/terminal/feature.h \
+ src/terminal/cursor.h src/terminal/terminal.h src/terminal/key.h \
+ src/terminal/style.h src/terminal/color.h src/util/ptr-array.h \
+ src/util/container.h src/terminal/feature.h src/terminal/input.h \
+ src/terminal/terminal.h src/terminal/key.h src/terminal/linux.h \
+ src/terminal/osc52.h src/terminal/output.h src/util/unicode.h \
+ src/terminal/parse.h src/terminal/rxvt.h src/terminal/style.h src/ui.h \
+ src/buffer.h src/block-iter.h src/block.h src/util/debug.h \
+ src/util/list.h src/util/macros.h src/util/string-view.h \
+ src/util/string.h src/util/unicode.h src/change.h src/command/error.h \
+ src/view.h src/lock.h src/options.h src/regexp.h src/util/ptr-array.h \
+ src/syntax/syntax.h src/command/error.h src/syntax/bitset.h \
+ src/util/debug.h src/syntax/color.h src/util/hashmap.h \
+ src/util/hashset.h src/cmdline.h src/command/run.h src/command/error.h \
+ src/history.h src/util/hashmap.h src/frame.h src/search.h \
+ src/syntax/color.h src/terminal/output.h src/terminal/terminal.h \
+ src/util/utf8.h src/window.h src/util/bit.h src/util/str-array.h \
+ src/util/utf8.h src/util/xmalloc.h src/util/xsnprintf.h
+test/test.h:
+src/util/macros.h:
+src/util/string-view.h:
+src/util/ascii.h:
+src/util/macros.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/xmemrchr.h:
+src/util/xstring.h:
+src/util/string.h:
+src/util/arith.h:
+src/util/bit.h:
+src/util/str-util.h:
+src/util/string-view.h:
+src/util/unicode.h:
+src/util/xmalloc.h:
+src/terminal/color.h:
+src/terminal/feature.h:
+src/terminal/cursor.h:
+src/terminal/terminal.h:
+src/terminal/key.h:
+src/terminal/style.h:
+src/terminal/color.h:
+src/util/ptr-array.h:
+src/util/container.h:
+src/terminal/feature.h:
+src/terminal/input.h:
+src/terminal/terminal.h:
+src/terminal/key.h:
+src/terminal/linux.h:
+src/terminal/osc52.h:
+src/terminal/output.h:
+src/util/unicode.h:
+src/terminal/parse.h:
+src/terminal/rxvt.h:
+src/terminal/style.h:
+src/ui.h:
+src/buffer.h:
+src/block-iter.h:
+src/block.h:
+src/util/debug.h:
+src/util/list.h:
+src/util/macros.h:
+src/util/string-view.h:
+src/util/string.h:
+src/util/unicode.h:
+src/change.h:
+src/command/error.h:
+src/view.h:
+src/lock.h:
+src/options.h:
+src/regexp.h:
+src/util/ptr-array.h:
+src/syntax/syntax.h:
+src/command/error.h:
+src/syntax/bitset.h:
+src/util/debug.h:
+src/syntax/color.h:
+src/util/hashmap.h:
+src/util/hashset.h:
+src/cmdline.h:
+src/command/run.h:
+src/command/error.h:
+src/history.h:
+src/util/hashmap.h:
+src/frame.h:
+src/search.h:
+src/syntax/color.h:
+src/terminal/output.h:
+src/terminal/terminal.h:
+src/util/utf8.h:
+src/window.h:
+src/util/bit.h:
+src/util/str-array.h:
+src/util/utf8.h:
+src/util/xmalloc.h:
+src/util/xsnprintf.h:
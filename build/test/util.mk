@@ -0,0 +1,70 @@
+build/test/util.o: test/util.c test/test.h src/util/macros.h \
+ src/util/string-view.h src/util/ascii.h src/util/macros.h \
+ src/util/debug.h src/util/errorcode.h src/util/xmemrchr.h \
+ src/util/xstring.h src/util/string.h src/util/arith.h src/util/bit.h \
+ src/util/str-util.h src/util/string-view.h src/util/unicode.h \
+ src/util/xmalloc.h src/util/arith.h src/util/array.h \
+ src/util/ptr-array.h src/util/container.h src/util/ascii.h \
+ src/util/base64.h src/util/bit.h src/util/fd.h src/util/fork-exec.h \
+ src/util/hashmap.h src/util/hashset.h src/util/intern.h \
+ src/util/hashset.h src/util/intmap.h src/util/list.h src/util/log.h \
+ src/util/numtostr.h src/util/path.h src/util/progname.h \
+ src/util/ptr-array.h src/util/readfile.h src/util/slab.h src/util/list.h \
+ src/util/str-array.h src/util/str-util.h src/util/strtonum.h \
+ src/util/time-util.h src/util/log.h src/util/unicode.h src/util/utf8.h \
+ src/util/xmalloc.h src/util/xmemmem.h src/util/xmemrchr.h \
+ src/util/xreadwrite.h src/util/xsnprintf.h src/util/xstdio.h \
+ src/util/xreadwrite.h
+test/test.h:
+src/util/macros.h:
+src/util/string-view.h:
+src/util/ascii.h:
+src/util/macros.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/xmemrchr.h:
+src/util/xstring.h:
+src/util/string.h:
+src/util/arith.h:
+src/util/bit.h:
+src/util/str-util.h:
+src/util/string-view.h:
+src/util/unicode.h:
+src/util/xmalloc.h:
+src/util/arith.h:
+src/util/array.h:
+src/util/ptr-array.h:
+src/util/container.h:
+src/util/ascii.h:
+src/util/base64.h:
+src/util/bit.h:
+src/util/fd.h:
+src/util/fork-exec.h:
+src/util/hashmap.h:
+src/util/hashset.h:
+src/util/intern.h:
+src/util/hashset.h:
+src/util/intmap.h:
+src/util/list.h:
+src/util/log.h:
+src/util/numtostr.h:
+src/util/path.h:
+src/util/progname.h:
+src/util/ptr-array.h:
+src/util/readfile.h:
+src/util/slab.h:
+src/util/list.h:
+src/util/str-array.h:
+src/util/str-util.h:
+src/util/strtonum.h:
+src/util/time-util.h:
+src/util/log.h:
+src/util/unicode.h:
+src/util/utf8.h:
+src/util/xmalloc.h:
+src/util/xmemmem.h:
+src/util/xmemrchr.h:
+src/util/xreadwrite.h:
+src/util/xsnprintf.h:
+src/util/xstdio.h:
+src/util/xreadwrite.h:
@@ -0,0 +1,30 @@
+build/timing.o: src/timing.c src/timing.h src/util/macros.h \
+ src/util/string.h src/util/arith.h src/util/debug.h src/util/errorcode.h \
+ src/util/macros.h src/util/bit.h src/util/str-util.h \
+ src/util/string-view.h src/util/ascii.h src/util/xmemrchr.h \
+ src/util/xstring.h src/util/unicode.h src/util/xmalloc.h \
+ src/util/arith.h src/util/array.h src/util/ptr-array.h \
+ src/util/container.h src/util/debug.h src/util/time-util.h \
+ src/util/log.h
+src/timing.h:
+src/util/macros.h:
+src/util/string.h:
+src/util/arith.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/macros.h:
+src/util/bit.h:
+src/util/str-util.h:
+src/util/string-view.h:
+src/util/ascii.h:
+src/util/xmemrchr.h:
+src/util/xstring.h:
+src/util/unicode.h:
+src/util/xmalloc.h:
+src/util/arith.h:
+src/util/array.h:
+src/util/ptr-array.h:
+src/util/container.h:
+src/util/debug.h:
+src/util/time-util.h:
+src/util/log.h:
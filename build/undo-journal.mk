@@ -0,0 +1,22 @@
+build/undo-journal.o: src/undo-journal.c src/undo-journal.h \
+ src/util/macros.h src/util/debug.h src/util/errorcode.h \
+ src/util/macros.h src/util/log.h src/util/debug.h src/util/path.h \
+ src/util/string-view.h src/util/ascii.h src/util/xmemrchr.h \
+ src/util/xstring.h src/util/xmalloc.h src/util/arith.h \
+ src/util/xreadwrite.h src/util/xsnprintf.h
+src/undo-journal.h:
+src/util/macros.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/macros.h:
+src/util/log.h:
+src/util/debug.h:
+src/util/path.h:
+src/util/string-view.h:
+src/util/ascii.h:
+src/util/xmemrchr.h:
+src/util/xstring.h:
+src/util/xmalloc.h:
+src/util/arith.h:
+src/util/xreadwrite.h:
+src/util/xsnprintf.h:
@@ -0,0 +1,10 @@
+build/util/debug.o: src/util/debug.c src/util/debug.h \
+ src/util/errorcode.h src/util/macros.h src/util/log.h \
+ src/terminal/mode.h src/util/macros.h src/util/xreadwrite.h
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/macros.h:
+src/util/log.h:
+src/terminal/mode.h:
+src/util/macros.h:
+src/util/xreadwrite.h:
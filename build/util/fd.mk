@@ -0,0 +1,9 @@
+build/util/fd.o: src/util/fd.c build/gen/build-defs.h src/util/fd.h \
+ src/util/macros.h src/util/debug.h src/util/errorcode.h \
+ src/util/xreadwrite.h
+build/gen/build-defs.h:
+src/util/fd.h:
+src/util/macros.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/xreadwrite.h:
@@ -0,0 +1,24 @@
+build/util/fork-exec.o: src/util/fork-exec.c build/gen/build-defs.h \
+ src/util/fork-exec.h src/util/macros.h src/util/debug.h \
+ src/util/errorcode.h src/util/environ.h src/util/fd.h src/util/log.h \
+ src/util/numtostr.h src/terminal/ioctl.h src/util/errorcode.h \
+ src/util/macros.h src/util/xmalloc.h src/util/arith.h src/util/xstring.h \
+ src/util/ascii.h src/util/xreadwrite.h src/util/xsnprintf.h
+build/gen/build-defs.h:
+src/util/fork-exec.h:
+src/util/macros.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/environ.h:
+src/util/fd.h:
+src/util/log.h:
+src/util/numtostr.h:
+src/terminal/ioctl.h:
+src/util/errorcode.h:
+src/util/macros.h:
+src/util/xmalloc.h:
+src/util/arith.h:
+src/util/xstring.h:
+src/util/ascii.h:
+src/util/xreadwrite.h:
+src/util/xsnprintf.h:
@@ -0,0 +1,13 @@
+build/util/intern.o: src/util/intern.c src/util/intern.h \
+ src/util/hashset.h src/util/macros.h src/util/string-view.h \
+ src/util/ascii.h src/util/debug.h src/util/errorcode.h \
+ src/util/xmemrchr.h src/util/xstring.h
+src/util/intern.h:
+src/util/hashset.h:
+src/util/macros.h:
+src/util/string-view.h:
+src/util/ascii.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/xmemrchr.h:
+src/util/xstring.h:
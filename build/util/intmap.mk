@@ -0,0 +1,10 @@
+build/util/intmap.o: src/util/intmap.c src/util/intmap.h \
+ src/util/container.h src/util/macros.h src/util/arith.h src/util/debug.h \
+ src/util/errorcode.h src/util/bit.h
+src/util/intmap.h:
+src/util/container.h:
+src/util/macros.h:
+src/util/arith.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/bit.h:
@@ -0,0 +1,15 @@
+build/util/path.o: src/util/path.c src/util/path.h src/util/debug.h \
+ src/util/errorcode.h src/util/macros.h src/util/string-view.h \
+ src/util/ascii.h src/util/xmemrchr.h src/util/xstring.h \
+ src/util/xmalloc.h src/util/arith.h src/util/str-util.h
+src/util/path.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/macros.h:
+src/util/string-view.h:
+src/util/ascii.h:
+src/util/xmemrchr.h:
+src/util/xstring.h:
+src/util/xmalloc.h:
+src/util/arith.h:
+src/util/str-util.h:
@@ -0,0 +1,6 @@
+build/util/readfile.o: src/util/readfile.c src/util/readfile.h \
+ src/util/macros.h src/util/xreadwrite.h src/util/errorcode.h
+src/util/readfile.h:
+src/util/macros.h:
+src/util/xreadwrite.h:
+src/util/errorcode.h:
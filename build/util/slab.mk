@@ -0,0 +1,10 @@
+build/util/slab.o: src/util/slab.c src/util/slab.h src/util/list.h \
+ src/util/macros.h src/util/align.h src/util/bit.h src/util/debug.h \
+ src/util/errorcode.h
+src/util/slab.h:
+src/util/list.h:
+src/util/macros.h:
+src/util/align.h:
+src/util/bit.h:
+src/util/debug.h:
+src/util/errorcode.h:
@@ -0,0 +1,9 @@
+build/util/time-util.o: src/util/time-util.c src/util/time-util.h \
+ src/util/debug.h src/util/errorcode.h src/util/macros.h src/util/log.h \
+ src/util/numtostr.h
+src/util/time-util.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/macros.h:
+src/util/log.h:
+src/util/numtostr.h:
@@ -0,0 +1,6 @@
+build/util/unicode.o: src/util/unicode.c src/util/unicode.h \
+ src/util/macros.h src/util/unidata.h src/util/ascii.h
+src/util/unicode.h:
+src/util/macros.h:
+src/util/unidata.h:
+src/util/ascii.h:
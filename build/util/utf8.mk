@@ -0,0 +1,14 @@
+build/util/utf8.o: src/util/utf8.c src/util/utf8.h src/util/debug.h \
+ src/util/errorcode.h src/util/macros.h src/util/string-view.h \
+ src/util/ascii.h src/util/xmemrchr.h src/util/xstring.h \
+ src/util/unicode.h src/util/numtostr.h
+src/util/utf8.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/macros.h:
+src/util/string-view.h:
+src/util/ascii.h:
+src/util/xmemrchr.h:
+src/util/xstring.h:
+src/util/unicode.h:
+src/util/numtostr.h:
@@ -0,0 +1,14 @@
+build/util/xdirent.o: src/util/xdirent.c build/gen/build-defs.h \
+ src/util/xdirent.h src/util/macros.h src/util/maybebool.h \
+ src/util/string-view.h src/util/ascii.h src/util/debug.h \
+ src/util/errorcode.h src/util/xmemrchr.h src/util/xstring.h
+build/gen/build-defs.h:
+src/util/xdirent.h:
+src/util/macros.h:
+src/util/maybebool.h:
+src/util/string-view.h:
+src/util/ascii.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/xmemrchr.h:
+src/util/xstring.h:
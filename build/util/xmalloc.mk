@@ -0,0 +1,11 @@
+build/util/xmalloc.o: src/util/xmalloc.c src/util/xmalloc.h \
+ src/util/arith.h src/util/debug.h src/util/errorcode.h src/util/macros.h \
+ src/util/xstring.h src/util/ascii.h src/util/xsnprintf.h
+src/util/xmalloc.h:
+src/util/arith.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/macros.h:
+src/util/xstring.h:
+src/util/ascii.h:
+src/util/xsnprintf.h:
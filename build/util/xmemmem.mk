@@ -0,0 +1,8 @@
+build/util/xmemmem.o: src/util/xmemmem.c build/gen/build-defs.h \
+ src/util/xmemmem.h src/util/macros.h src/util/debug.h \
+ src/util/errorcode.h
+build/gen/build-defs.h:
+src/util/xmemmem.h:
+src/util/macros.h:
+src/util/debug.h:
+src/util/errorcode.h:
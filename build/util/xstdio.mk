@@ -0,0 +1,7 @@
+build/util/xstdio.o: src/util/xstdio.c src/util/xstdio.h src/util/debug.h \
+ src/util/errorcode.h src/util/macros.h src/util/xreadwrite.h
+src/util/xstdio.h:
+src/util/debug.h:
+src/util/errorcode.h:
+src/util/macros.h:
+src/util/xreadwrite.h:
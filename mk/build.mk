@@ -36,7 +36,7 @@ CC_VERSION = $(or \
 util_objects := $(call prefix-obj, build/util/, \
     arith array ascii base64 debug exitcode fd fork-exec hashmap hashset \
     intern intmap log numtostr path ptr-array readfile string strtonum \
-    time-util unicode utf8 xadvise xdirent xmalloc xmemmem xmemrchr \
+    slab time-util unicode utf8 xadvise xdirent xmalloc xmemmem xmemrchr \
     xreadwrite xsnprintf xstdio )
 
 command_objects := $(call prefix-obj, build/command/, \
@@ -55,10 +55,10 @@ terminal_objects := $(call prefix-obj, build/terminal/, \
 editor_objects := $(call prefix-obj, build/, \
     bind block block-iter bookmark buffer case change cmdline commands \
     compat compiler completion config convert copy ctags delete edit \
-    editor encoding exec file-history file-option filetype frame history \
-    indent insert join load-save lock main mode move msg options palette \
-    regexp replace search selection show showkey signals spawn status \
-    tag trace vars view window wrap \
+    editor encoding exec file-history file-option filetype frame grep history \
+    indent insert job join load-save lock main mem-usage mode move msg \
+    options palette regexp replace search selection show showkey signals \
+    spawn status tag timing trace undo-journal vars view window wrap \
     $(addprefix ui-, cmdline prompt status tabbar view window) ui ) \
     $(command_objects) \
     $(editorconfig_objects) \
@@ -76,7 +76,7 @@ bench_objects := $(call prefix-obj, build/test/, benchmark)
 feature_tests := $(addprefix build/feature/, $(addsuffix .h, \
     dup3 embed pipe2 fsync memmem memrchr mkostemp sigisemptyset \
     dirent_d_type TIOCGWINSZ TIOCNOTTY tcgetwinsize posix_madvise \
-    qsort_r ))
+    qsort_r posix_spawn POSIX_SPAWN_SETSID ))
 
 cflags_names := $(addprefix warnings-, clang18 gcc14 gcc15 gcc4.8) sanitizer
 cflags_configs := $(foreach c, $(cflags_names), mk/cflags/$(c).txt)
@@ -127,7 +127,7 @@ ifeq "$(WERROR)" "1"
 endif
 
 BASIC_CPPFLAGS += -D_FILE_OFFSET_BITS=64
-$(all_objects): BASIC_CPPFLAGS += -Isrc -Ibuild/gen
+$(all_objects): BASIC_CPPFLAGS += $(CC_QUOTE_INCLUDE) src -Ibuild/gen
 
 # If "make install*" with no other named targets
 ifeq "" "$(filter-out install%,$(or $(MAKECMDGOALS),all))"
@@ -150,6 +150,7 @@ $(syntax_objects): | build/syntax/
 $(terminal_objects): | build/terminal/
 $(build_subdirs): | build/
 $(feature_tests): mk/feature-test/defs.h build/gen/all.cflags
+build/block.o: build/gen/buildvar-block-pool.h
 build/convert.o: build/gen/buildvar-iconv.h
 build/gen/builtin-config.h build/gen/builtin-config-embed.h: build/gen/builtin-config.mk
 build/gen/test-data.h build/gen/test-data-embed.h: build/gen/test-data.mk
@@ -159,7 +160,9 @@ build/main.o: build/gen/version.h
 build/editor.o: build/gen/version.h
 build/test/command.o: build/gen/version.h
 build/test/init.o: build/gen/version.h
-build/compat.o: build/gen/build-defs.h build/gen/buildvar-iconv.h
+build/test/benchmark.o: build/gen/buildvar-block-pool.h
+build/compat.o: build/gen/build-defs.h build/gen/buildvar-iconv.h build/gen/buildvar-block-pool.h
+build/grep.o: build/gen/build-defs.h
 build/load-save.o: build/gen/build-defs.h
 build/signals.o: build/gen/build-defs.h
 build/tag.o: build/gen/build-defs.h
@@ -206,6 +209,9 @@ build/gen/version.h: FORCE | build/gen/
 build/gen/buildvar-iconv.h: FORCE | build/gen/
 	@$(OPTCHECK) '$(HASH)define ICONV_DISABLE $(if $(call xstreq,$(ICONV_DISABLE),1),1,0)' $@
 
+build/gen/buildvar-block-pool.h: FORCE | build/gen/
+	@$(OPTCHECK) '$(HASH)define BLOCK_POOL_DISABLE $(if $(call xstreq,$(BLOCK_POOL_DISABLE),1),1,0)' $@
+
 build/gen/builtin-config.mk: FORCE | build/gen/
 	@$(OPTCHECK) '$(@:.mk=.h): $(BUILTIN_CONFIGS)' $@
 
@@ -100,6 +100,18 @@ else
     echo 'CC_DEPFLAGS =' # Avoid inheriting from environment variable
 fi
 
+# Using `-iquote` (instead of `-I`) for src/ prevents headers like
+# src/spawn.h from shadowing system headers of the same name (e.g.
+# <spawn.h>, as used by src/util/fork-exec.c). Compilers that don't
+# support it simply fail the mk/feature-test/posix_spawn.c test.
+# https://gcc.gnu.org/onlinedocs/gcc/Directory-Options.html#index-iquote
+# https://clang.llvm.org/docs/ClangCommandLineReference.html#cmdoption-clang-iquote-directory
+if cc_option -iquote src; then
+    echo 'CC_QUOTE_INCLUDE = -iquote'
+else
+    echo 'CC_QUOTE_INCLUDE = -I'
+fi
+
 # https://stackoverflow.com/questions/22017484/detect-if-a-compiler-is-using-ccache/61282413#61282413
 # https://ccache.dev/manual/latest.html#_extra_options
 if cc_option --ccache-skip -Dxyz=1; then
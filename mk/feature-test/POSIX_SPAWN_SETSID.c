@@ -0,0 +1,21 @@
+#include "defs.h"
+#include <spawn.h>
+
+/*
+ Testing for: POSIX_SPAWN_SETSID flag for posix_spawnattr_setflags()
+ Supported by: Linux (glibc 2.26+, musl 1.1.20+), FreeBSD 13.1+, macOS
+ Standardized by: POSIX 2024
+
+ See also:
+ • https://pubs.opengroup.org/onlinepubs/9799919799/functions/posix_spawnattr_getflags.html#:~:text=POSIX_SPAWN_SETSID
+ • https://austingroupbugs.net/view.php?id=1044
+ • https://man7.org/linux/man-pages/man3/posix_spawn.3.html#:~:text=POSIX_SPAWN_SETSID
+ • https://man.freebsd.org/cgi/man.cgi?query=posix_spawnattr_setflags#:~:text=POSIX_SPAWN_SETSID
+*/
+
+int main(void)
+{
+    posix_spawnattr_t attr;
+    int r = (posix_spawnattr_init)(&attr);
+    return r | (posix_spawnattr_setflags)(&attr, POSIX_SPAWN_SETSID);
+}
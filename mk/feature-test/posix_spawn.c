@@ -0,0 +1,31 @@
+#include <signal.h>
+#include <spawn.h>
+
+/*
+ Testing for: posix_spawnp() and POSIX_SPAWN_SETSIGDEF
+ Supported by: Linux, OpenBSD, FreeBSD, NetBSD, macOS
+ Standardized by: POSIX 2001 (Spawn option; "[SPN]")
+
+ See also:
+ • https://pubs.opengroup.org/onlinepubs/9799919799/functions/posix_spawn.html
+ • https://man7.org/linux/man-pages/man3/posix_spawn.3.html
+ • https://man.openbsd.org/posix_spawn#:~:text=int-,posix_spawnp
+ • https://man.freebsd.org/cgi/man.cgi?query=posix_spawn#:~:text=int-,posix_spawnp
+ • https://man.netbsd.org/posix_spawn.3#:~:text=int-,posix_spawnp
+*/
+
+int main(void)
+{
+    static char arg0[] = "true";
+    char *argv[] = {arg0, 0};
+    posix_spawnattr_t attr;
+    sigset_t set;
+    pid_t pid;
+    int r = (posix_spawnattr_init)(&attr);
+    r |= sigemptyset(&set);
+    r |= (posix_spawnattr_setsigdefault)(&attr, &set);
+    r |= (posix_spawnattr_setflags)(&attr, POSIX_SPAWN_SETSIGDEF);
+    r |= (posix_spawnp)(&pid, argv[0], 0, &attr, argv, argv + 1);
+    r |= (posix_spawnattr_destroy)(&attr);
+    return r;
+}
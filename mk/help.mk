@@ -10,7 +10,7 @@ USERVARS = \
     $(call echo-if-set, LC_CTYPE LC_ALL) \
     DEBUG AWK CC CFLAGS \
     $(call echo-if-set, CPPFLAGS LDFLAGS LDLIBS TESTFLAGS WERROR V) \
-    $(call echo-if-set, ICONV_DISABLE NO_DEPS NO_COLOR NO_CONFIG_MK)
+    $(call echo-if-set, ICONV_DISABLE BLOCK_POOL_DISABLE NO_DEPS NO_COLOR NO_CONFIG_MK)
 
 USERVARS_VERBOSE = \
     PANDOC LUA DESTDIR prefix bindir mandir \
@@ -74,6 +74,7 @@ ifeq "$(DEVMK)" "loaded"
 	$P pdf 'Generate PDF user manual from man pages'
 	$P coverage 'Generate HTML coverage report with gcovr(1) and open in $$BROWSER'
 	$P bench 'Run benchmarks for some utility functions'
+	$P bench-render 'Run only the screen rendering benchmarks'
 	$P gen-unidata 'Generate Unicode data tables'
 	$P dist 'Generate tarball for latest git commit'
 	$P dist-latest-release 'Generate tarball for latest release'
@@ -297,6 +297,37 @@ char *block_iter_get_bytes(BlockIter bi, size_t len)
     return buf;
 }
 
+// Like block_iter_get_bytes(), but instead of copying the bytes into a
+// new buffer, return an array of StringViews referring directly to the
+// Block::data of each Block spanned. The returned array must be freed
+// by the caller and is only valid until the Buffer is next modified.
+StringView *block_iter_get_segments(BlockIter bi, size_t len, size_t *nr_segments)
+{
+    BlockIter tmp = bi;
+    size_t n = 0;
+    for (size_t pos = 0; pos < len; n++) {
+        pos += tmp.blk->size - tmp.offset;
+        bool have_next_block = block_iter_next_block(&tmp);
+        BUG_ON(pos < len && !have_next_block);
+    }
+
+    *nr_segments = n;
+    if (n == 0) {
+        return NULL;
+    }
+
+    StringView *segments = xmallocarray(n, sizeof(*segments));
+    for (size_t i = 0, pos = 0; i < n; i++) {
+        const size_t avail = bi.blk->size - bi.offset;
+        size_t count = MIN(len - pos, avail);
+        segments[i] = string_view(bi.blk->data + bi.offset, count);
+        pos += count;
+        block_iter_next_block(&bi);
+    }
+
+    return segments;
+}
+
 // Return the contents of the line that extends from `bi`. Callers
 // should ensure `bi` is already at BOL, if whole lines are needed.
 StringView block_iter_get_line_with_nl(BlockIter *bi)
@@ -320,3 +351,56 @@ StringView block_iter_get_line_with_nl(BlockIter *bi)
     BUG_ON(!strview_has_suffix(line, "\n"));
     return line;
 }
+
+// Advance `*pos` past at most `nr_lines - *n` lines of `blk`, incrementing
+// `*n` for each one
+static void skip_block_lines(const Block *blk, size_t *pos, size_t *n, size_t nr_lines)
+{
+    while (*n < nr_lines && *pos < blk->size) {
+        const char *nl = memchr(blk->data + *pos, '\n', blk->size - *pos);
+        *pos = nl ? (size_t)(nl - blk->data) + 1 : blk->size; // No newline at EOF
+        *n += 1;
+    }
+}
+
+// Like block_iter_get_line(), but returning (up to) `nr_lines` lines of
+// text, with all newlines except the last one included. This is used for
+// matching patterns that can span multiple lines, with a lookahead that's
+// bounded by the pattern itself (see regexp_compile_multiline()). If EOF
+// is reached before `nr_lines` lines, the last newline is also included,
+// so that patterns ending with `\n` can still match on the last lines.
+// The returned text refers directly to the Block data when it's all
+// within the same Block and is otherwise copied into `buf`, which is
+// cleared first and must be freed by the caller.
+StringView block_iter_get_lines(BlockIter *bi, size_t nr_lines, String *buf)
+{
+    BUG_ON(nr_lines == 0);
+    block_iter_normalize(bi);
+
+    const Block *blk = bi->blk;
+    const size_t start = bi->offset;
+    size_t pos = start;
+    size_t n = 0;
+    skip_block_lines(blk, &pos, &n, nr_lines);
+
+    StringView text;
+    if (n == nr_lines || !block_has_next(blk, bi->head)) {
+        text = string_view(blk->data + start, pos - start);
+    } else {
+        // The lines span multiple Blocks
+        string_clear(buf);
+        string_append_buf(buf, blk->data + start, pos - start);
+        do {
+            blk = block_next(blk);
+            pos = 0;
+            skip_block_lines(blk, &pos, &n, nr_lines);
+            string_append_buf(buf, blk->data, pos);
+        } while (n < nr_lines && block_has_next(blk, bi->head));
+        text = strview_from_string(buf);
+    }
+
+    if (n == nr_lines) {
+        strview_remove_matching_suffix(&text, "\n"); // Trim the last newline
+    }
+    return text;
+}
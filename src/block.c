@@ -1,7 +1,150 @@
 #include <stdlib.h>
+#include <string.h>
 #include "block.h"
+#include "buildvar-block-pool.h" // BLOCK_POOL_DISABLE
+#include "util/arith.h"
+#include "util/array.h"
 #include "util/bit.h"
+#include "util/slab.h"
+#include "util/str-util.h"
 #include "util/xmalloc.h"
+#include "util/xmemrchr.h"
+
+enum {
+    // Preferred size of the Blocks filled by block_list_commit(), which
+    // is the same as used by file_decoder_read() when loading files
+    BLOCK_LIST_FILL_SIZE = 8192,
+};
+
+#if BLOCK_POOL_DISABLE == 0
+
+// Sizes of the pools used for Block::data allocations. Blocks created or
+// split by editing are usually no larger than BLOCK_EDIT_SIZE and it's
+// those that are allocated, grown and freed most frequently. Larger
+// allocations (e.g. the BLOCK_LIST_FILL_SIZE Blocks created when loading
+// files) are left to malloc(3).
+static const uint16_t data_size_classes[] = {
+    64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048, 3072, 4096
+};
+
+static SlabPool block_pool;
+static SlabPool data_pools[ARRAYLEN(data_size_classes)];
+static bool pools_initialized;
+
+UNITTEST {
+    BUG_ON(data_size_classes[0] != BLOCK_ALLOC_MULTIPLE);
+    for (size_t i = 1; i < ARRAYLEN(data_size_classes); i++) {
+        BUG_ON(data_size_classes[i] <= data_size_classes[i - 1]);
+    }
+}
+
+static void init_pools(void)
+{
+    slab_pool_init(&block_pool, sizeof(Block));
+    for (size_t i = 0; i < ARRAYLEN(data_pools); i++) {
+        slab_pool_init(&data_pools[i], data_size_classes[i]);
+    }
+    pools_initialized = true;
+}
+
+// Return the index of the smallest size class that can hold `size`
+// bytes, or ARRAYLEN(data_size_classes) if there's none
+static size_t size_class(size_t size)
+{
+    size_t i = 0;
+    while (i < ARRAYLEN(data_size_classes) && size > data_size_classes[i]) {
+        i++;
+    }
+    return i;
+}
+
+static size_t round_alloc_size(size_t size)
+{
+    size_t i = size_class(size);
+    bool pooled = (i < ARRAYLEN(data_size_classes));
+    return pooled ? data_size_classes[i] : next_multiple(size, BLOCK_ALLOC_MULTIPLE);
+}
+
+// Allocate `alloc` bytes, as previously returned by round_alloc_size()
+static char *data_alloc(size_t alloc)
+{
+    size_t i = size_class(alloc);
+    return (i < ARRAYLEN(data_pools)) ? slab_alloc(&data_pools[i]) : xmalloc(alloc);
+}
+
+static void data_free(char *data, size_t alloc)
+{
+    size_t i = size_class(alloc);
+    if (i < ARRAYLEN(data_pools)) {
+        slab_free(&data_pools[i], data);
+    } else {
+        free(data);
+    }
+}
+
+Block *block_new(size_t alloc)
+{
+    if (unlikely(!pools_initialized)) {
+        init_pools();
+    }
+
+    BUG_ON(alloc == 0);
+    Block *blk = slab_alloc(&block_pool);
+    alloc = round_alloc_size(alloc);
+    *blk = (Block) {
+        .data = data_alloc(alloc),
+        .alloc = alloc,
+    };
+    return blk;
+}
+
+void block_grow(Block *blk, size_t alloc)
+{
+    size_t old_alloc = blk->alloc;
+    if (alloc <= old_alloc) {
+        return;
+    }
+
+    alloc = round_alloc_size(alloc);
+    if (size_class(old_alloc) == ARRAYLEN(data_pools)) {
+        // Neither the old nor the new size is pooled
+        blk->data = xrealloc(blk->data, alloc);
+    } else {
+        char *data = data_alloc(alloc);
+        memcpy(data, blk->data, blk->size);
+        data_free(blk->data, old_alloc);
+        blk->data = data;
+    }
+    blk->alloc = alloc;
+}
+
+void block_free(Block *blk)
+{
+    list_remove(&blk->node);
+    data_free(blk->data, blk->alloc);
+    slab_free(&block_pool, blk);
+}
+
+static void add_pool_stats(BlockPoolStats *stats, const SlabPool *pool)
+{
+    stats->nr_objects += pool->nr_objects;
+    stats->object_bytes += pool->nr_objects * pool->obj_size;
+    stats->slab_bytes += pool->nr_slabs * SLAB_SIZE;
+}
+
+BlockPoolStats block_pool_stats(void)
+{
+    BlockPoolStats stats = {.nr_objects = 0};
+    if (pools_initialized) {
+        add_pool_stats(&stats, &block_pool);
+        for (size_t i = 0; i < ARRAYLEN(data_pools); i++) {
+            add_pool_stats(&stats, &data_pools[i]);
+        }
+    }
+    return stats;
+}
+
+#else // BLOCK_POOL_DISABLE == 1; use plain malloc(3) and free(3)
 
 Block *block_new(size_t alloc)
 {
@@ -26,3 +169,124 @@ void block_free(Block *blk)
     free(blk->data);
     free(blk);
 }
+
+BlockPoolStats block_pool_stats(void)
+{
+    return (BlockPoolStats){.nr_objects = 0};
+}
+
+#endif
+
+void block_list_init(BlockList *bl)
+{
+    list_init(&bl->blocks);
+    bl->size = 0;
+    bl->nl = 0;
+}
+
+// Return a pointer to the unused space at the end of the last Block in
+// `bl`, after ensuring that it's at least `min` bytes. The actual amount
+// of space available is stored in `*avail`. Any data written there must
+// then be accounted for by calling block_list_commit().
+char *block_list_reserve_space(BlockList *bl, size_t min, size_t *avail)
+{
+    Block *blk = list_empty(&bl->blocks) ? NULL : BLOCK(bl->blocks.prev);
+    bool full = blk && blk->size >= BLOCK_LIST_FILL_SIZE;
+    if (!blk || (full && blk->data[blk->size - 1] == '\n')) {
+        blk = block_new(MAX(min, BLOCK_LIST_FILL_SIZE));
+        list_insert_before(&blk->node, &bl->blocks);
+    } else if (blk->alloc - blk->size < min) {
+        // Grow by at least 50%, so that very long lines (which can't be
+        // split) don't incur quadratic reallocation costs
+        block_grow(blk, blk->size + MAX(min, blk->size / 2));
+    }
+
+    *avail = blk->alloc - blk->size;
+    return blk->data + blk->size;
+}
+
+// Account for `len` bytes written to the space returned by the last call
+// to block_list_reserve_space() and, once the last Block is full, move
+// any trailing partial line into a new Block. A `len` of 0 (e.g. at EOF)
+// discards the new Block that block_list_reserve_space() may have added.
+void block_list_commit(BlockList *bl, size_t len)
+{
+    BUG_ON(list_empty(&bl->blocks));
+    Block *blk = BLOCK(bl->blocks.prev);
+    BUG_ON(len > blk->alloc - blk->size);
+
+    if (len == 0) {
+        if (blk->size == 0) {
+            block_free(blk);
+        }
+        return;
+    }
+
+    size_t nl = count_nl(blk->data + blk->size, len);
+    blk->size += len;
+    blk->nl += nl;
+    bl->size += len;
+    bl->nl += nl;
+
+    size_t size = blk->size;
+    if (size < BLOCK_LIST_FILL_SIZE || blk->nl == 0 || blk->data[size - 1] == '\n') {
+        return;
+    }
+
+    const char *last_nl = xmemrchr(blk->data, '\n', size);
+    BUG_ON(!last_nl);
+    size_t keep = (size_t)(last_nl - blk->data) + 1;
+    size_t partial = size - keep;
+    Block *next = block_new(MAX(partial, BLOCK_LIST_FILL_SIZE));
+    memcpy(next->data, blk->data + keep, partial);
+    next->size = partial;
+    blk->size = keep;
+    list_insert_before(&next->node, &bl->blocks);
+}
+
+// Append `len` bytes of `text` to `bl` (see block_list_commit())
+void block_list_append(BlockList *bl, const char *text, size_t len)
+{
+    for (size_t pos = 0; pos < len; ) {
+        size_t avail;
+        char *buf = block_list_reserve_space(bl, 1, &avail);
+        size_t n = MIN(avail, len - pos);
+        memcpy(buf, text + pos, n);
+        block_list_commit(bl, n);
+        pos += n;
+    }
+}
+
+// Remove one trailing newline (or CRLF sequence), if present
+void block_list_strip_trailing_newline(BlockList *bl)
+{
+    if (list_empty(&bl->blocks)) {
+        return;
+    }
+
+    Block *blk = BLOCK(bl->blocks.prev);
+    size_t n = blk->size;
+    BUG_ON(n == 0);
+    if (blk->data[n - 1] != '\n') {
+        return;
+    }
+
+    n--;
+    n -= (n > 0 && blk->data[n - 1] == '\r');
+    bl->size -= blk->size - n;
+    bl->nl--;
+    blk->size = n;
+    blk->nl--;
+    if (n == 0) {
+        block_free(blk);
+    }
+}
+
+void block_list_free(BlockList *bl)
+{
+    while (!list_empty(&bl->blocks)) {
+        block_free(BLOCK(bl->blocks.next));
+    }
+    bl->size = 0;
+    bl->nl = 0;
+}
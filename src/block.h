@@ -17,6 +17,22 @@ typedef struct {
     size_t nl;
 } Block;
 
+// A list of Blocks that isn't (yet) part of a Buffer, e.g. for text
+// being read incrementally from a child process. All Blocks contain
+// whole lines, except for the last one.
+typedef struct {
+    ListHead blocks;
+    size_t size; // Total size of all Blocks
+    size_t nl; // Total number of newlines in all Blocks
+} BlockList;
+
+// Usage statistics for the slab pools used by block_new()
+typedef struct {
+    size_t nr_objects; // Number of Block headers and data allocations
+    size_t object_bytes; // Total size of those objects
+    size_t slab_bytes; // Total size of the slabs containing them
+} BlockPoolStats;
+
 enum {
     BLOCK_ALLOC_MULTIPLE = 64,
 };
@@ -74,5 +90,13 @@ static inline void block_sanity_check(const Block *blk)
 Block *block_new(size_t alloc) RETURNS_NONNULL WARN_UNUSED_RESULT;
 void block_grow(Block *blk, size_t alloc) NONNULL_ARGS;
 void block_free(Block *blk) NONNULL_ARGS;
+BlockPoolStats block_pool_stats(void) WARN_UNUSED_RESULT;
+
+void block_list_init(BlockList *bl) NONNULL_ARGS;
+char *block_list_reserve_space(BlockList *bl, size_t min, size_t *avail) NONNULL_ARGS_AND_RETURN WARN_UNUSED_RESULT;
+void block_list_commit(BlockList *bl, size_t len) NONNULL_ARGS;
+void block_list_append(BlockList *bl, const char *text, size_t len) NONNULL_ARG(1) NONNULL_ARG_IF_NONZERO_LENGTH(2, 3);
+void block_list_strip_trailing_newline(BlockList *bl) NONNULL_ARGS;
+void block_list_free(BlockList *bl) NONNULL_ARGS;
 
 #endif
@@ -99,9 +99,7 @@ void free_blocks(Buffer *buffer)
 {
     for (ListHead *head = &buffer->blocks, *item = head->next; item != head; ) {
         ListHead *next = item->next;
-        Block *blk = BLOCK(item);
-        free(blk->data);
-        free(blk);
+        block_free(BLOCK(item));
         item = next;
     }
 }
@@ -115,7 +113,7 @@ static void buffer_unlock_and_free (
         unlock_file(locks_ctx, ebuf, buffer->abs_filename);
     }
 
-    free_changes(&buffer->change_head);
+    free_changes(&buffer->change_head, &buffer->undo_arena);
     ptr_array_free_array(&buffer->line_start_states);
     ptr_array_free_array(&buffer->views);
     free(buffer->display_filename);
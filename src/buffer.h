@@ -46,6 +46,7 @@ typedef struct Buffer {
     Change change_head;
     Change *cur_change;
     Change *saved_change; // Used to determine if there are unsaved changes
+    UndoArena undo_arena; // Storage for all Changes except `change_head`
     FileInfo file; // File metadata, taken from the most recent stat(3) call
     unsigned long id; // Needed for identifying buffers whose filename is NULL
     size_t nl; // Total number of lines (sum of all Block::nl counts)
@@ -64,6 +65,9 @@ typedef struct Buffer {
     Syntax *syntax;
     long changed_line_min;
     long changed_line_max;
+    unsigned long edit_count; // Incremented by every edit (see edit.c)
+    unsigned long defrag_edit_count; // Value of `edit_count` after last defrag_blocks() call
+    Block *defrag_blk; // Where the next defrag_blocks() call resumes (NULL if finished)
     // Index 0 is always syn->states.ptrs[0].
     // Lowest bit of an invalidated value is 1.
     PointerArray line_start_states;
@@ -5,27 +5,337 @@
 #include "command/error.h"
 #include "edit.h"
 #include "editor.h"
+#include "util/align.h"
+#include "util/bit.h"
 #include "util/debug.h"
+#include "util/ptr-array.h"
 #include "util/xmalloc.h"
 #include "window.h"
 
+enum {
+    // Sizes of the chunks allocated by UndoArena (see change.h)
+    UNDO_RECORD_CHUNK_SIZE = 16 * 1024,
+    UNDO_PAYLOAD_CHUNK_SIZE = 64 * 1024,
+    // Payload chunks are only compacted once at least this many bytes
+    // (and more than are still in use) have been freed
+    UNDO_COMPACT_MIN = 256 * 1024,
+};
+
+#define UNDO_ALIGN ALIGNOF(union MaxAlign)
+
+struct UndoChunk {
+    UndoChunk *next;
+    size_t size; // Usable size of `data`
+    size_t used;
+    union MaxAlign data[];
+};
+
+// The header preceding each payload in a chunk, which allows the live
+// payloads to be found (and moved) by compact_payloads()
+typedef struct {
+    Change *owner; // Change whose `buf` follows this header (or NULL if freed)
+    size_t size;
+} PayloadHeader;
+
 static struct {
     ChangeMergeEnum merge;
     ChangeMergeEnum prev_merge;
     // This doesn't need to be local to Buffer, because commands are atomic
-    Change *barrier;
+    bool pending_barrier;
 } cs; // NOLINT(*-avoid-non-const-global-variables)
 
-static Change *alloc_change(void)
+static void *chunk_alloc(UndoArena *arena, UndoChunk **list, size_t size)
+{
+    size = next_multiple(size, UNDO_ALIGN);
+    UndoChunk *chunk = *list;
+    if (!chunk || chunk->size - chunk->used < size) {
+        size_t default_size = (list == &arena->records) ? UNDO_RECORD_CHUNK_SIZE : UNDO_PAYLOAD_CHUNK_SIZE;
+        size_t chunk_size = MAX(size, default_size);
+        chunk = xmalloc(sizeof(*chunk) + chunk_size);
+        chunk->next = *list;
+        chunk->size = chunk_size;
+        chunk->used = 0;
+        arena->chunk_bytes += chunk_size;
+        *list = chunk;
+    }
+
+    void *ptr = (char*)chunk->data + chunk->used;
+    chunk->used += size;
+    return ptr;
+}
+
+static void free_chunks(UndoArena *arena, UndoChunk *chunk)
+{
+    while (chunk) {
+        UndoChunk *next = chunk->next;
+        arena->chunk_bytes -= chunk->size;
+        free(chunk);
+        chunk = next;
+    }
+}
+
+static size_t payload_stride(size_t len)
+{
+    return next_multiple(sizeof(PayloadHeader) + len, UNDO_ALIGN);
+}
+
+static PayloadHeader *payload_header(char *buf)
+{
+    return (PayloadHeader*)buf - 1;
+}
+
+// Allocate space for a `len` byte payload, to be owned by `change`
+static char *payload_alloc(UndoArena *arena, Change *change, size_t len)
+{
+    BUG_ON(len == 0);
+    if (len >= UNDO_LARGE_PAYLOAD) {
+        arena->heap_bytes += len;
+        return xmalloc(len);
+    }
+
+    size_t stride = payload_stride(len);
+    PayloadHeader *hdr = chunk_alloc(arena, &arena->payloads, stride);
+    hdr->owner = change;
+    hdr->size = len;
+    arena->live_bytes += stride;
+    return (char*)(hdr + 1);
+}
+
+// Free a payload allocated by payload_alloc(). Note that the space isn't
+// actually reused until compact_payloads() is called.
+static void payload_free(UndoArena *arena, char *buf, size_t len)
+{
+    if (!buf) {
+        return;
+    }
+
+    if (len >= UNDO_LARGE_PAYLOAD) {
+        arena->heap_bytes -= len;
+        free(buf);
+        return;
+    }
+
+    PayloadHeader *hdr = payload_header(buf);
+    BUG_ON(hdr->size != len);
+    BUG_ON(!hdr->owner);
+    hdr->owner = NULL;
+    size_t stride = payload_stride(len);
+    arena->live_bytes -= stride;
+    arena->dead_bytes += stride;
+}
+
+// Make `buf` (a malloc'd buffer of `len` bytes, as returned by e.g.
+// do_delete()) the payload of `change`, by copying it into the arena
+// (and freeing it) or, if it's large, by simply taking ownership of it
+static void payload_adopt(UndoArena *arena, Change *change, char *buf, size_t len)
+{
+    if (!buf || len >= UNDO_LARGE_PAYLOAD) {
+        arena->heap_bytes += buf ? len : 0;
+        change->buf = buf;
+        return;
+    }
+
+    change->buf = payload_alloc(arena, change, len);
+    memcpy(change->buf, buf, len);
+    free(buf);
+}
+
+// Grow the payload of `change` from `old_len` to `new_len` bytes (keeping
+// the existing contents), which is done in place if it's the most recent
+// allocation and there's enough space left in its chunk
+static char *payload_grow(UndoArena *arena, Change *change, size_t old_len, size_t new_len)
+{
+    BUG_ON(new_len <= old_len);
+    char *buf = change->buf;
+    if (new_len < UNDO_LARGE_PAYLOAD) {
+        UndoChunk *chunk = arena->payloads;
+        size_t old_stride = payload_stride(old_len);
+        size_t extra = payload_stride(new_len) - old_stride;
+        char *end = (char*)chunk->data + chunk->used;
+        if (end == buf - sizeof(PayloadHeader) + old_stride && chunk->size - chunk->used >= extra) {
+            chunk->used += extra;
+            arena->live_bytes += extra;
+            payload_header(buf)->size = new_len;
+            return buf;
+        }
+    } else if (old_len >= UNDO_LARGE_PAYLOAD) {
+        arena->heap_bytes += new_len - old_len;
+        change->buf = xrealloc(buf, new_len);
+        return change->buf;
+    }
+
+    change->buf = payload_alloc(arena, change, new_len);
+    memcpy(change->buf, buf, old_len);
+    payload_free(arena, buf, old_len);
+    return change->buf;
+}
+
+// Move all live payloads into new chunks and free the old ones
+static void compact_payloads(UndoArena *arena)
+{
+    UndoChunk *chunks = arena->payloads;
+    arena->payloads = NULL;
+    arena->live_bytes = 0;
+    arena->dead_bytes = 0;
+
+    for (UndoChunk *chunk = chunks; chunk; chunk = chunk->next) {
+        for (size_t pos = 0; pos < chunk->used; ) {
+            PayloadHeader *hdr = (PayloadHeader*)((char*)chunk->data + pos);
+            Change *owner = hdr->owner;
+            size_t len = hdr->size;
+            if (owner) {
+                BUG_ON(owner->buf != (char*)(hdr + 1));
+                owner->buf = payload_alloc(arena, owner, len);
+                memcpy(owner->buf, hdr + 1, len);
+            }
+            pos += payload_stride(len);
+        }
+    }
+
+    free_chunks(arena, chunks);
+}
+
+// This must only be called when no pointers to payloads are held, other
+// than those in the Change records themselves
+static void maybe_compact_payloads(UndoArena *arena)
 {
-    return xcalloc1(sizeof(Change));
+    size_t dead = arena->dead_bytes;
+    if (dead >= UNDO_COMPACT_MIN && dead > arena->live_bytes) {
+        compact_payloads(arena);
+    }
+}
+
+// Move the payloads of the oldest Changes to the UndoJournal (or discard
+// them, if the `undo-journal` option is false), until the memory used by
+// payloads is no more than `target` bytes
+static void spill_payloads(Buffer *buffer, EditorState *e, size_t target)
+{
+    UndoArena *arena = &buffer->undo_arena;
+    UndoJournal *journal = &e->undo_journal;
+    bool drop = !e->options.undo_journal;
+    if (!drop && journal->failed) {
+        return;
+    }
+
+    // Walk the Change tree depth-first, starting from the root, so that
+    // each branch is visited in the order its changes were made
+    PointerArray stack = PTR_ARRAY_INIT;
+    ptr_array_append(&stack, &buffer->change_head);
+
+    while (stack.count && arena->live_bytes + arena->heap_bytes > target) {
+        Change *change = stack.ptrs[--stack.count];
+        for (unsigned long i = change->nr_prev; i > 0; i--) {
+            ptr_array_append(&stack, change->prev[i - 1]);
+        }
+
+        char *buf = change->buf;
+        size_t len = change->del_count;
+        if (!buf) {
+            continue;
+        }
+
+        if (drop) {
+            change->payload_dropped = true;
+            arena->dropped_bytes += len;
+        } else {
+            const char *dir = e->user_config_dir;
+            if (!undo_journal_append(journal, dir, buf, len, &change->journal_offset)) {
+                break;
+            }
+            arena->journal_bytes += len;
+        }
+
+        payload_free(arena, buf, len);
+        change->buf = NULL;
+    }
+
+    ptr_array_free_array(&stack);
+    if (arena->dead_bytes) {
+        compact_payloads(arena);
+    }
+}
+
+// Enforce the `undo-memory-limit` option, or otherwise just compact the
+// payload chunks, if worthwhile. Like maybe_compact_payloads(), this must
+// only be called when no pointers to payloads are held.
+static void trim_undo_memory(View *view)
+{
+    Buffer *buffer = view->buffer;
+    UndoArena *arena = &buffer->undo_arena;
+    EditorState *e = view->window->editor;
+    uint64_t limit = e->options.undo_memory_limit;
+
+    if (limit && arena->live_bytes + arena->heap_bytes > limit) {
+        // Spill down to half of the limit, so that it isn't done again
+        // until a significant amount of new history has accumulated
+        spill_payloads(buffer, e, limit / 2);
+    } else {
+        maybe_compact_payloads(arena);
+    }
+}
+
+// Read the payload of `change` back from the UndoJournal, if it was
+// previously moved there by spill_payloads()
+static bool load_payload(View *view, Change *change, ErrorBuffer *ebuf)
+{
+    size_t len = change->del_count;
+    if (change->buf || len == 0) {
+        return true;
+    }
+
+    if (change->payload_dropped) {
+        return error_msg(ebuf, "Undo history discarded (due to undo-memory-limit)");
+    }
+
+    UndoArena *arena = &view->buffer->undo_arena;
+    const UndoJournal *journal = &view->window->editor->undo_journal;
+    char *buf = payload_alloc(arena, change, len);
+    if (unlikely(!undo_journal_read(journal, change->journal_offset, buf, len))) {
+        payload_free(arena, buf, len);
+        return error_msg(ebuf, "Failed to read undo history from journal");
+    }
+
+    change->buf = buf;
+    arena->journal_bytes -= len;
+    return true;
+}
+
+static bool load_payloads(View *view, Change **changes, size_t n, ErrorBuffer *ebuf)
+{
+    for (size_t i = 0; i < n; i++) {
+        if (!load_payload(view, changes[i], ebuf)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static Change *alloc_change(UndoArena *arena)
+{
+    Change *change = chunk_alloc(arena, &arena->records, sizeof(*change));
+    *change = (Change){.next = NULL};
+    arena->nr_changes++;
+    return change;
 }
 
 static void add_change(Buffer *buffer, Change *change)
 {
     Change *head = buffer->cur_change;
     change->next = head;
-    head->prev = xrenew(head->prev, head->nr_prev + 1);
+
+    // The `prev` array is grown in powers of 2, since there's no way to
+    // grow an arena allocation in place
+    unsigned long n = head->nr_prev;
+    if (n == 0 || IS_POWER_OF_2(n)) {
+        UndoArena *arena = &buffer->undo_arena;
+        size_t size = (n ? 2 * n : 1) * sizeof(head->prev[0]);
+        Change **prev = chunk_alloc(arena, &arena->records, size);
+        if (n) {
+            memcpy(prev, head->prev, n * sizeof(head->prev[0]));
+        }
+        head->prev = prev;
+    }
+
     head->prev[head->nr_prev++] = change;
     buffer->cur_change = change;
 }
@@ -35,9 +345,13 @@ static bool is_change_chain_barrier(const Change *change)
     return !change->ins_count && !change->del_count;
 }
 
-static Change *new_change(Buffer *buffer)
+static Change *new_change(View *view)
 {
-    if (cs.barrier) {
+    trim_undo_memory(view);
+    Buffer *buffer = view->buffer;
+    UndoArena *arena = &buffer->undo_arena;
+
+    if (cs.pending_barrier) {
         /*
          * We are recording series of changes (:replace for example)
          * and now we have just made the first change so we have to
@@ -47,11 +361,11 @@ static Change *new_change(Buffer *buffer)
          * chain but then we may have ended up with an empty chain.
          * We don't want to record empty changes ever.
          */
-        add_change(buffer, cs.barrier);
-        cs.barrier = NULL;
+        add_change(buffer, alloc_change(arena));
+        cs.pending_barrier = false;
     }
 
-    Change *change = alloc_change();
+    Change *change = alloc_change(arena);
     add_change(buffer, change);
     return change;
 }
@@ -71,7 +385,7 @@ static void record_insert(View *view, size_t len)
         return;
     }
 
-    Change *change = new_change(view->buffer);
+    Change *change = new_change(view);
     change->offset = buffer_offset(view);
     change->ins_count = len;
 }
@@ -80,33 +394,35 @@ static void record_delete(View *view, char *buf, size_t len, bool move_after)
 {
     BUG_ON(!len);
     BUG_ON(!buf);
+    UndoArena *arena = &view->buffer->undo_arena;
     bool del = (cs.merge == CHANGE_MERGE_DELETE);
     bool erase = (cs.merge == CHANGE_MERGE_ERASE);
 
     // Consecutive DELETE or ERASE operations of the same type can be merged
-    // into the same Change entry. For matching DELETE operations, reallocate
+    // into the same Change entry. For matching DELETE operations, grow
     // `change->buf`, then append and free `buf`. For ERASE, do likewise but
-    // with the arguments reversed.
-    if (cs.merge == cs.prev_merge && (del || erase)) {
-        Change *change = view->buffer->cur_change;
-        char *left = del ? change->buf : buf; // Reallocated
-        char *right = del ? buf : change->buf; // Appended and freed
-        size_t left_len = del ? change->del_count : len;
-        size_t right_len = del ? len : change->del_count;
-        change->offset -= del ? 0 : len;
-
+    // prepend `buf` instead.
+    Change *change = view->buffer->cur_change;
+    if (cs.merge == cs.prev_merge && (del || erase) && load_payload(view, change, NULL)) {
+        size_t old_len = change->del_count;
+        char *ptr = payload_grow(arena, change, old_len, old_len + len);
+        if (del) {
+            memcpy(ptr + old_len, buf, len);
+        } else {
+            memmove(ptr + len, ptr, old_len);
+            memcpy(ptr, buf, len);
+            change->offset -= len;
+        }
         change->del_count += len;
-        change->buf = xrealloc(left, change->del_count);
-        memcpy(change->buf + left_len, right, right_len);
-        free(right);
+        free(buf);
         return;
     }
 
-    Change *change = new_change(view->buffer);
+    change = new_change(view);
     change->offset = buffer_offset(view);
     change->del_count = len;
     change->move_after = move_after;
-    change->buf = buf;
+    payload_adopt(arena, change, buf, len);
 }
 
 static void record_replace(View *view, char *deleted, size_t del_count, size_t ins_count)
@@ -115,11 +431,11 @@ static void record_replace(View *view, char *deleted, size_t del_count, size_t i
     BUG_ON(!del_count && deleted);
     BUG_ON(!del_count && !ins_count);
 
-    Change *change = new_change(view->buffer);
+    Change *change = new_change(view);
     change->offset = buffer_offset(view);
     change->ins_count = ins_count;
     change->del_count = del_count;
-    change->buf = deleted;
+    payload_adopt(&view->buffer->undo_arena, change, deleted, del_count);
 }
 
 void begin_change(ChangeMergeEnum m)
@@ -134,23 +450,23 @@ void end_change(void)
 
 void begin_change_chain(void)
 {
-    BUG_ON(cs.barrier);
+    BUG_ON(cs.pending_barrier);
 
-    // Allocate change chain barrier but add it to the change tree only if
-    // there will be any real changes
-    cs.barrier = alloc_change();
+    // Add a change chain barrier to the change tree, but only if (and
+    // when) there are any real changes (see new_change())
+    cs.pending_barrier = true;
     cs.merge = CHANGE_MERGE_NONE;
 }
 
 void end_change_chain(View *view)
 {
-    if (cs.barrier) {
+    if (cs.pending_barrier) {
         // There were no changes in this change chain
-        free(cs.barrier);
-        cs.barrier = NULL;
+        cs.pending_barrier = false;
     } else {
         // There were some changes; add end of chain marker
-        add_change(view->buffer, alloc_change());
+        Buffer *buffer = view->buffer;
+        add_change(buffer, alloc_change(&buffer->undo_arena));
     }
 }
 
@@ -175,6 +491,7 @@ static void reverse_change(View *view, Change *change)
     const size_t ins_count = change->ins_count;
     const size_t del_count = change->del_count;
     BUG_ON(!del_count && !ins_count);
+    UndoArena *arena = &view->buffer->undo_arena;
 
     if (view->buffer->views.count > 1) {
         // NOLINTNEXTLINE(readability-suspicious-call-argument)
@@ -191,14 +508,14 @@ static void reverse_change(View *view, Change *change)
         }
         change->ins_count = del_count;
         change->del_count = 0;
-        free(change->buf);
+        payload_free(arena, change->buf, del_count);
         change->buf = NULL;
         return;
     }
 
     if (del_count == 0) {
         // Convert insert to delete
-        change->buf = do_delete(view, ins_count, true);
+        payload_adopt(arena, change, do_delete(view, ins_count, true), ins_count);
         change->del_count = ins_count;
         change->ins_count = 0;
         return;
@@ -207,12 +524,94 @@ static void reverse_change(View *view, Change *change)
     // Reverse replace
     // NOLINTNEXTLINE(readability-suspicious-call-argument)
     char *buf = do_replace(view, ins_count, change->buf, del_count);
-    free(change->buf);
-    change->buf = buf;
+    payload_free(arena, change->buf, del_count);
+    payload_adopt(arena, change, buf, ins_count);
     change->ins_count = del_count;
     change->del_count = ins_count;
 }
 
+// Reverse all of the changes in a chain (in the given order) with a
+// single call to do_replace_ranges(), instead of one edit per change.
+// This is only possible when each change is entirely before (or after)
+// the text affected by the one before it, as is the case for e.g.
+// `replace -g`, and otherwise false is returned, without doing anything.
+static bool reverse_change_chain_batched(View *view, Change **changes, size_t n)
+{
+    BUG_ON(n < 2);
+    bool descending = true;
+    bool ascending = true;
+    for (size_t i = 0; i + 1 < n; i++) {
+        const Change *a = changes[i];
+        const Change *b = changes[i + 1];
+        descending &= (b->offset + b->ins_count <= a->offset);
+        ascending &= (b->offset >= a->offset + a->del_count);
+    }
+
+    if (!descending && !ascending) {
+        return false;
+    }
+
+    // Convert each offset to one relative to the current buffer contents
+    // and order the ranges by offset, as required by do_replace_ranges()
+    EditRange *ranges = xmallocarray(n, sizeof(ranges[0]));
+    size_t removed = 0;
+    size_t added = 0;
+    for (size_t i = 0; i < n; i++) {
+        const Change *c = changes[descending ? n - 1 - i : i];
+        ranges[i] = (EditRange) {
+            .offset = descending ? c->offset : c->offset + removed - added,
+            .del = c->ins_count,
+            .ins_buf = c->buf,
+            .ins = c->del_count,
+        };
+        removed += c->ins_count;
+        added += c->del_count;
+    }
+
+    if (view->buffer->views.count > 1) {
+        for (size_t i = 0; i < n; i++) {
+            const Change *c = changes[i];
+            // NOLINTNEXTLINE(readability-suspicious-call-argument)
+            fix_cursors(view, c->offset, c->ins_count, c->del_count);
+        }
+    }
+
+    do_replace_ranges(view, ranges, n);
+
+    // Leave the cursor where reverse_change() would have, for the last change
+    const Change *last = changes[n - 1];
+    size_t cursor = last->offset;
+    if (last->ins_count == 0 && last->move_after) {
+        cursor += last->del_count;
+    }
+    view->cursor.blk = buffer_get_first_block(view->buffer);
+    block_iter_goto_offset(&view->cursor, cursor);
+    view_update_cursor_y(view);
+
+    UndoArena *arena = &view->buffer->undo_arena;
+    for (size_t i = 0; i < n; i++) {
+        Change *c = changes[descending ? n - 1 - i : i];
+        size_t ins_count = c->ins_count;
+        payload_free(arena, c->buf, c->del_count);
+        payload_adopt(arena, c, ranges[i].deleted, ins_count);
+        c->ins_count = c->del_count;
+        c->del_count = ins_count;
+    }
+
+    free(ranges);
+    return true;
+}
+
+static void reverse_change_chain(View *view, Change **changes, size_t n)
+{
+    if (n >= 2 && reverse_change_chain_batched(view, changes, n)) {
+        return;
+    }
+    for (size_t i = 0; i < n; i++) {
+        reverse_change(view, changes[i]);
+    }
+}
+
 bool undo(View *view, ErrorBuffer *ebuf)
 {
     Change *change = view->buffer->cur_change;
@@ -222,23 +621,36 @@ bool undo(View *view, ErrorBuffer *ebuf)
     }
 
     if (is_change_chain_barrier(change)) {
-        unsigned long count = 0;
+        PointerArray chain = PTR_ARRAY_INIT;
         while (1) {
             change = change->next;
             if (is_change_chain_barrier(change)) {
                 break;
             }
-            reverse_change(view, change);
-            count++;
+            ptr_array_append(&chain, change);
+        }
+        size_t count = chain.count;
+        Change **changes = (Change**)chain.ptrs;
+        bool loaded = load_payloads(view, changes, count, ebuf);
+        if (loaded) {
+            reverse_change_chain(view, changes, count);
+        }
+        ptr_array_free_array(&chain);
+        if (!loaded) {
+            return false;
         }
         if (count > 1) {
-            info_msg(ebuf, "Undid %lu changes", count);
+            info_msg(ebuf, "Undid %zu changes", count);
         }
     } else {
+        if (!load_payload(view, change, ebuf)) {
+            return false;
+        }
         reverse_change(view, change);
     }
 
     view->buffer->cur_change = change->next;
+    trim_undo_memory(view);
     return true;
 }
 
@@ -274,28 +686,44 @@ bool redo(View *view, ErrorBuffer *ebuf, unsigned long change_id)
 
     change = change->prev[change_id];
     if (is_change_chain_barrier(change)) {
-        unsigned long count = 0;
+        PointerArray chain = PTR_ARRAY_INIT;
         while (1) {
             change = change->prev[change->nr_prev - 1];
             if (is_change_chain_barrier(change)) {
                 break;
             }
-            reverse_change(view, change);
-            count++;
+            ptr_array_append(&chain, change);
+        }
+        size_t count = chain.count;
+        Change **changes = (Change**)chain.ptrs;
+        bool loaded = load_payloads(view, changes, count, ebuf);
+        if (loaded) {
+            reverse_change_chain(view, changes, count);
+        }
+        ptr_array_free_array(&chain);
+        if (!loaded) {
+            return false;
         }
         if (count > 1) {
-            info_msg(ebuf, "Redid %lu changes", count);
+            info_msg(ebuf, "Redid %zu changes", count);
         }
     } else {
+        if (!load_payload(view, change, ebuf)) {
+            return false;
+        }
         reverse_change(view, change);
     }
 
     view->buffer->cur_change = change;
+    trim_undo_memory(view);
     return true;
 }
 
-void free_changes(Change *c)
+void free_changes(Change *head, UndoArena *arena)
 {
+    // Only large payloads need to be freed individually; everything else
+    // is freed along with the chunks
+    Change *c = head;
 top:
     while (c->nr_prev) {
         c = c->prev[c->nr_prev - 1];
@@ -303,18 +731,27 @@ top:
 
     // c is leaf now
     while (c->next) {
-        Change *next = c->next;
-        free(c->buf);
-        free(c);
+        if (c->del_count >= UNDO_LARGE_PAYLOAD) {
+            free(c->buf);
+        }
 
-        c = next;
+        c = c->next;
         if (--c->nr_prev) {
             goto top;
         }
-
-        // We have become leaf
-        free(c->prev);
     }
+
+    BUG_ON(c != head);
+    head->prev = NULL;
+    free_chunks(arena, arena->records);
+    free_chunks(arena, arena->payloads);
+    BUG_ON(arena->chunk_bytes != 0);
+    *arena = (UndoArena){.records = NULL};
+}
+
+size_t undo_memory_usage(const UndoArena *arena)
+{
+    return arena->chunk_bytes + arena->heap_bytes;
 }
 
 void buffer_insert_bytes(View *view, const char *buf, const size_t len)
@@ -421,3 +858,48 @@ void buffer_replace_bytes(View *view, size_t del_count, const char *ins, size_t
         fix_cursors(view, block_iter_get_offset(&view->cursor), del_count, ins_count);
     }
 }
+
+// Like buffer_replace_bytes(), but with the inserted text taken from
+// the Blocks in `bl`, which are linked directly into the buffer (see
+// do_insert_blocks()). This always creates a single Change, regardless
+// of how many Blocks are inserted.
+void buffer_replace_blocks(View *view, size_t del_count, BlockList *bl)
+{
+    size_t ins_count = bl->size;
+    if (ins_count == 0) {
+        buffer_delete_bytes(view, del_count);
+        return;
+    }
+
+    view_reset_preferred_x(view);
+    const Block *last = BLOCK(bl->blocks.prev);
+    bool nl_at_end = (last->data[last->size - 1] == '\n');
+
+    // Check if all newlines from EOF would be deleted
+    if (!nl_at_end && del_count && would_delete_last_bytes(view->cursor, del_count)) {
+        // Don't replace last newline
+        del_count--;
+    }
+
+    // See the comment about `sanity_check_newlines` in do_replace()
+    char *deleted = do_delete(view, del_count, false);
+
+    if (!nl_at_end && block_iter_is_eof(&view->cursor)) {
+        // Force newline at EOF
+        size_t avail;
+        *block_list_reserve_space(bl, 1, &avail) = '\n';
+        block_list_commit(bl, 1);
+        ins_count++;
+    }
+
+    do_insert_blocks(view, bl);
+    if (deleted) {
+        record_replace(view, deleted, del_count, ins_count);
+    } else {
+        record_insert(view, ins_count);
+    }
+
+    if (view->buffer->views.count > 1) {
+        fix_cursors(view, block_iter_get_offset(&view->cursor), del_count, ins_count);
+    }
+}
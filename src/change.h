@@ -3,6 +3,8 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
+#include "block.h"
 #include "command/error.h"
 #include "util/macros.h"
 #include "view.h"
@@ -19,22 +21,52 @@ typedef struct Change {
     struct Change **prev;
     unsigned long nr_prev;
     bool move_after; // Move after inserted text when undoing delete?
+    bool payload_dropped; // `buf` was discarded (see `undo-memory-limit`)
     size_t offset;
     size_t del_count;
     size_t ins_count;
     char *buf; // Deleted bytes (inserted bytes need not be saved)
+    uint64_t journal_offset; // Position of `buf` in UndoJournal, if moved there
 } Change;
 
+typedef struct UndoChunk UndoChunk;
+
+// Per-Buffer allocator for Change records and their deleted text, so
+// that long editing sessions don't end up with millions of individual
+// heap allocations. Records are never freed individually (only all at
+// once, by free_changes()), whereas payloads (Change::buf) are swapped
+// by every undo/redo and merged by consecutive deletions. The space
+// left by such payloads is reclaimed by compacting the payload chunks.
+// Payloads of UNDO_LARGE_PAYLOAD bytes or more are allocated separately
+// (or simply adopted, from do_delete() and friends), instead of copied.
+typedef struct {
+    UndoChunk *records; // Chunks holding Change records and `prev` arrays
+    UndoChunk *payloads; // Chunks holding payloads (most recent first)
+    size_t chunk_bytes; // Total size of all chunks
+    size_t live_bytes; // Payload bytes in use (including headers)
+    size_t dead_bytes; // Payload bytes freed, but not yet compacted
+    size_t heap_bytes; // Total size of large payloads
+    size_t nr_changes;
+    uint64_t journal_bytes; // Payload bytes moved to UndoJournal
+    uint64_t dropped_bytes; // Payload bytes discarded
+} UndoArena;
+
+enum {
+    UNDO_LARGE_PAYLOAD = 16 * 1024,
+};
+
 void begin_change(ChangeMergeEnum m);
 void end_change(void);
 void begin_change_chain(void);
 void end_change_chain(View *view) NONNULL_ARGS;
 bool undo(View *view, ErrorBuffer *ebuf) NONNULL_ARG(1) WARN_UNUSED_RESULT;
 bool redo(View *view, ErrorBuffer *ebuf, unsigned long change_id) NONNULL_ARG(1) WARN_UNUSED_RESULT;
-void free_changes(Change *c) NONNULL_ARGS;
+void free_changes(Change *head, UndoArena *arena) NONNULL_ARGS;
+size_t undo_memory_usage(const UndoArena *arena) NONNULL_ARGS;
 void buffer_insert_bytes(View *view, const char *buf, size_t len) NONNULL_ARG(1) NONNULL_ARG_IF_NONZERO_LENGTH(2, 3);
 void buffer_delete_bytes(View *view, size_t len) NONNULL_ARGS;
 void buffer_erase_bytes(View *view, size_t len) NONNULL_ARGS;
 void buffer_replace_bytes(View *view, size_t del_count, const char *ins, size_t ins_count) NONNULL_ARG(1) NONNULL_ARG_IF_NONZERO_LENGTH(3, 4);
+void buffer_replace_blocks(View *view, size_t del_count, BlockList *bl) NONNULL_ARGS;
 
 #endif
@@ -2,6 +2,7 @@
 #include "args.h"
 #include "parse.h"
 #include "change.h"
+#include "timing.h"
 #include "util/debug.h"
 #include "util/ptr-array.h"
 #include "util/xmalloc.h"
@@ -71,7 +72,10 @@ static bool run_command(CommandRunner *runner, char **av)
     begin_change(CHANGE_MERGE_NONE);
 
     CommandArgs a = cmdargs_new(av + 1);
-    bool r = likely(parse_args(cmd, &a, ebuf)) && command_func_call(e, ebuf, cmd, &a);
+    uint64_t start_time = timing_start();
+    bool parsed = parse_args(cmd, &a, ebuf);
+    timing_stop(TIMING_COMMAND, start_time);
+    bool r = likely(parsed) && command_func_call(e, ebuf, cmd, &a);
 
     end_change();
     return r;
@@ -124,7 +128,9 @@ bool handle_command(CommandRunner *runner, const char *cmd)
 {
     BUG_ON(runner->recursion_count != 0);
     PointerArray array = PTR_ARRAY_INIT;
+    uint64_t start_time = timing_start();
     CommandParseError err = parse_commands(runner, &array, cmd);
+    timing_stop(TIMING_COMMAND, start_time);
     bool r;
     if (likely(err == CMDERR_NONE)) {
         r = run_commands(runner, &array);
@@ -28,9 +28,11 @@
 #include "file-option.h"
 #include "filetype.h"
 #include "frame.h"
+#include "grep.h"
 #include "history.h"
 #include "indent.h"
 #include "insert.h"
+#include "job.h"
 #include "join.h"
 #include "load-save.h"
 #include "lock.h"
@@ -392,25 +394,34 @@ static bool cmd_compile(EditorState *e, const CommandArgs *a)
     }
 
     bool quiet = has_flag(a, 's');
-    if ((e->flags & EFLAG_HEADLESS) && !quiet) {
+    bool background = has_flag(a, 'b');
+    if ((e->flags & EFLAG_HEADLESS) && (background || !quiet)) {
         LOG_INFO("automatically added -s flag to compile command (headless mode)");
         quiet = true;
+        background = false;
     }
 
-    SpawnContext ctx = {
-        .argv = (const char **)a->args + 1,
-        .ebuf = &e->err,
-        .quiet = quiet,
-    };
-
+    const char **argv = (const char **)a->args + 1;
     char abc = cmdargs_pick_winning_flag(a, "ABC");
     size_t idx = abc ? abc - 'A' : e->options.msg_compile;
     MessageList *messages = &e->messages[idx];
     clear_messages(messages);
 
+    bool read_stdout = has_flag(a, '1');
+    if (background) {
+        // Messages are added as the output arrives (see job_list_wait())
+        const char *name = a->args[0];
+        return job_start(&e->jobs, &e->err, argv, read_stdout, name, messages);
+    }
+
+    SpawnContext ctx = {
+        .argv = argv,
+        .ebuf = &e->err,
+        .quiet = quiet,
+    };
+
     yield_terminal(e, quiet);
     bool prompt = has_flag(a, 'p');
-    bool read_stdout = has_flag(a, '1');
     bool spawned = spawn_compiler(&ctx, compiler, messages, read_stdout);
     resume_terminal(e, quiet, spawned && prompt);
 
@@ -781,15 +792,38 @@ static bool cmd_errorfmt(EditorState *e, const CommandArgs *a)
     return true;
 }
 
+// Background jobs have no access to the buffer or terminal, so only
+// discarding output (or reporting errors) is supported by `exec -b`
+static bool exec_background(EditorState *e, const char **argv, const ExecAction actions[3])
+{
+    for (size_t fd = 0; fd < 3; fd++) {
+        ExecAction action = actions[fd];
+        bool errmsg = (fd == STDERR_FILENO && action == EXEC_ERRMSG);
+        if (unlikely(action != EXEC_TTY && action != EXEC_NULL && !errmsg)) {
+            return error_msg(&e->err, "-b can only be used with 'null' (or 'errmsg' for -e) actions");
+        }
+    }
+
+    if (e->flags & EFLAG_HEADLESS) {
+        LOG_INFO("ignoring -b flag for exec command (headless mode)");
+        ExecAction null_actions[3] = {EXEC_NULL, EXEC_NULL, EXEC_ERRMSG};
+        return handle_exec(e, argv, null_actions, EXECFLAG_QUIET) >= 0;
+    }
+
+    return job_start(&e->jobs, &e->err, argv, false, NULL, NULL);
+}
+
 static bool cmd_exec(EditorState *e, const CommandArgs *a)
 {
     ExecAction actions[3] = {EXEC_TTY, EXEC_TTY, EXEC_TTY};
     ExecFlags exec_flags = 0;
     bool lflag = false;
     bool move_after_insert = false;
+    bool background = false;
 
     for (size_t i = 0, n = a->nr_flags, argidx = 0, fd; i < n; i++) {
         switch (a->flags[i]) {
+            case 'b': background = true; continue;
             case 'e': fd = STDERR_FILENO; break;
             case 'i': fd = STDIN_FILENO; break;
             case 'o': fd = STDOUT_FILENO; break;
@@ -814,12 +848,16 @@ static bool cmd_exec(EditorState *e, const CommandArgs *a)
         actions[STDIN_FILENO] = EXEC_LINE;
     }
 
+    const char **argv = (const char **)a->args + a->nr_flag_args;
+    if (background) {
+        return exec_background(e, argv, actions);
+    }
+
     if ((e->flags & EFLAG_HEADLESS) && !(exec_flags & EXECFLAG_QUIET)) {
         LOG_INFO("automatically added -s flag to exec command (headless mode)");
         exec_flags |= EXECFLAG_QUIET;
     }
 
-    const char **argv = (const char **)a->args + a->nr_flag_args;
     ssize_t outlen = handle_exec(e, argv, actions, exec_flags);
     if (outlen <= 0) {
         return outlen == 0;
@@ -859,6 +897,89 @@ static bool cmd_ft(EditorState *e, const CommandArgs *a)
     return nfailed == 0;
 }
 
+static bool cmd_grep(EditorState *e, const CommandArgs *a)
+{
+    const char *pattern = a->args[0];
+    ErrorBuffer *ebuf = &e->err;
+    char *escaped = has_flag(a, 'e') ? regexp_escape(pattern, strlen(pattern)) : NULL;
+    const char *re_str = escaped ? escaped : pattern;
+    int flags = DEFAULT_REGEX_FLAGS | REG_NEWLINE | (has_flag(a, 'i') ? REG_ICASE : 0);
+
+    // Any previous background search is cancelled, since it may be
+    // adding messages to the same list
+    background_grep_free(e->grep);
+    e->grep = NULL;
+
+    // A background search needs its own copy of the regex, since entries
+    // in the regexp cache can be evicted while it's running. This is
+    // compiled in the same way as by regexp_cache_lookup(), so that both
+    // paths expand `\n` escapes.
+    BackgroundGrep *bg = NULL;
+    const regex_t *re;
+    if (has_flag(a, 'b')) {
+        bg = xmalloc(sizeof(*bg));
+        size_t nr_lines;
+        if (!regexp_compile_multiline(ebuf, &bg->re, re_str, flags, &nr_lines)) {
+            free(bg);
+            free(escaped);
+            return false;
+        }
+        re = &bg->re;
+    } else {
+        const CachedRegexp *cr = regexp_cache_lookup(ebuf, re_str, flags);
+        if (!cr) {
+            free(escaped);
+            return false;
+        }
+        re = &cr->re;
+    }
+
+    free(escaped);
+    char abc = cmdargs_pick_winning_flag(a, "ABC");
+    size_t idx = abc ? abc - 'A' : e->options.msg_compile;
+    MessageList *msgs = &e->messages[idx];
+    clear_messages(msgs);
+
+    GrepContext ctx = {.re = re, .msgs = msgs, .pending = PTR_ARRAY_INIT};
+    size_t npaths = a->nr_args - 1;
+    bool failed = false;
+
+    for (size_t i = 0, n = MAX(npaths, 1); i < n; i++) {
+        const char *path = npaths ? a->args[i + 1] : ".";
+        if (!grep_add_path(&ctx, path)) {
+            error_msg(ebuf, "Unable to search '%s': %s", path, strerror(errno));
+            failed = true;
+        }
+    }
+
+    if (bg) {
+        if (ctx.pending.count == 0) {
+            regfree(&bg->re);
+            free(bg);
+            return false;
+        }
+        bg->ctx = ctx;
+        bg->pattern = xstrdup(pattern);
+        e->grep = bg;
+        return !failed;
+    }
+
+    while (!grep_step(&ctx, SIZE_MAX)) {
+        ;
+    }
+
+    grep_context_free(&ctx);
+    if (ctx.nr_matches == 0) {
+        if (failed) {
+            return false;
+        }
+        return error_msg(ebuf, "No matches for '%s' (%zu files searched)", pattern, ctx.nr_files);
+    }
+
+    activate_current_message_save(msgs, &e->bookmarks, e->view, ebuf);
+    return !failed;
+}
+
 static bool cmd_hi(EditorState *e, const CommandArgs *a)
 {
     if (unlikely(a->nr_args == 0)) {
@@ -931,6 +1052,11 @@ static bool cmd_join(EditorState *e, const CommandArgs *a)
     return true;
 }
 
+static bool cmd_kill_job(EditorState *e, const CommandArgs *a)
+{
+    return job_kill(&e->jobs, &e->err, a->args[0], has_flag(a, 'f'));
+}
+
 static bool cmd_left(EditorState *e, const CommandArgs *a)
 {
     handle_selection_flags(e->view, a);
@@ -2687,7 +2813,7 @@ static const Command cmds[] = {
     {"clear", "Ii", NA, 0, 0, cmd_clear},
     {"close", "fpqw", NA, 0, 0, cmd_close},
     {"command", "", NFAA, 0, 1, cmd_command},
-    {"compile", "1ABCps", NFAA, 2, -1, cmd_compile},
+    {"compile", "1ABCbps", NFAA, 2, -1, cmd_compile},
     {"copy", "bikp", NA, 0, 1, cmd_copy},
     {"cursor", "", RC, 0, 3, cmd_cursor},
     {"cut", "", NA, 0, 0, cmd_cut},
@@ -2704,13 +2830,15 @@ static const Command cmds[] = {
     {"erase-bol", "", NA, 0, 0, cmd_erase_bol},
     {"erase-word", "s", NA, 0, 0, cmd_erase_word},
     {"errorfmt", "ci", RC, 1, 2 + ERRORFMT_CAPTURE_MAX, cmd_errorfmt},
-    {"exec", "e=i=lmno=pst", NFAA, 1, -1, cmd_exec},
+    {"exec", "be=i=lmno=pst", NFAA, 1, -1, cmd_exec},
     {"ft", "bcfi", RC | NFAA, 2, -1, cmd_ft},
+    {"grep", "ABCbei", NA, 1, -1, cmd_grep},
     {"hi", "cq", RC | NFAA, 0, -1, cmd_hi},
     {"include", "bq", RC, 1, 1, cmd_include},
     {"indent", "r", NA, 0, 1, cmd_indent},
     {"insert", "km", NA, 1, 1, cmd_insert},
     {"join", "", NA, 0, 1, cmd_join},
+    {"kill-job", "f", NA, 0, 1, cmd_kill_job},
     {"left", "cl", NA, 0, 0, cmd_left},
     {"line", "cl", NA, 1, 1, cmd_line},
     {"macro", "", NA, 1, 1, cmd_macro},
@@ -1,5 +1,6 @@
 #include "build-defs.h" // HAVE_*
 #include <sys/stat.h> // S_ISVTX
+#include "buildvar-block-pool.h" // BLOCK_POOL_DISABLE
 #include "buildvar-iconv.h" // ICONV_DISABLE
 #include "compat.h"
 #include "regexp.h" // HAVE_REG_STARTEND, REG_ENHANCED (macOS)
@@ -52,6 +53,12 @@ const char buildvar_string[] =
 #if HAVE_POSIX_MADVISE
     " posix_madvise"
 #endif
+#if HAVE_POSIX_SPAWN
+    " posix_spawn"
+#endif
+#if HAVE_POSIX_SPAWN_SETSID
+    " POSIX_SPAWN_SETSID"
+#endif
 
 // Features detected via cpp(1) macros
 #if HAVE_REG_STARTEND
@@ -66,6 +73,9 @@ const char buildvar_string[] =
 #if ICONV_DISABLE == 1
     " ICONV_DISABLE"
 #endif
+#if BLOCK_POOL_DISABLE == 1
+    " BLOCK_POOL_DISABLE"
+#endif
 #ifdef SANE_WCTYPE
     " SANE_WCTYPE"
 #endif
@@ -55,13 +55,6 @@ static bool is_executable(int dir_fd, const char *filename)
     return faccessat(dir_fd, filename, X_OK, 0) == 0;
 }
 
-static bool is_ignored_dir_entry(StringView name)
-{
-    return unlikely(name.length == 0)
-        || strview_equal_cstring(name, ".")
-        || strview_equal_cstring(name, "..");
-}
-
 static bool do_collect_files (
     PointerArray *array,
     const char *dirname,
@@ -405,6 +398,13 @@ static void complete_ft(EditorState *e, const CommandArgs *a)
     }
 }
 
+static void complete_grep(EditorState *e, const CommandArgs *a)
+{
+    if (a->nr_args > 0) {
+        collect_files(e, &e->cmdline.completion, COLLECT_ALL);
+    }
+}
+
 static void complete_hi(EditorState *e, const CommandArgs *a)
 {
     CompletionState *cs = &e->cmdline.completion;
@@ -589,6 +589,7 @@ static const CompletionHandler completion_handlers[] = {
     {"errorfmt", complete_errorfmt},
     {"exec", complete_exec},
     {"ft", complete_ft},
+    {"grep", complete_grep},
     {"hi", complete_hi},
     {"include", complete_include},
     {"macro", complete_macro},
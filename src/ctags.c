@@ -1,4 +1,5 @@
 #include <stdlib.h>
+#include <string.h>
 #include "ctags.h"
 #include "util/arith.h"
 #include "util/ascii.h"
@@ -149,6 +150,197 @@ bool next_tag (
     return false;
 }
 
+// Find the TagSortOrder of a tags file, as indicated by the pseudo-tags
+// at the start of it (or TAGS_UNSORTED, if there's no indication)
+TagSortOrder get_tag_sort_order(const char *buf, size_t buf_len)
+{
+    const StringView sorted = STRING_VIEW("!_TAG_FILE_SORTED\t");
+    for (size_t pos = 0; pos < buf_len; ) {
+        StringView line = buf_slice_next_line(buf, &pos, buf_len);
+        if (!strview_has_prefix(line, "!_")) {
+            // Pseudo-tags always precede all other lines
+            break;
+        }
+        size_t n = sorted.length;
+        if (line.length > n && strview_has_sv_prefix(line, sorted)) {
+            char c = line.data[n];
+            return (c == '1') ? TAGS_SORTED : (c == '2' ? TAGS_FOLDCASE : TAGS_UNSORTED);
+        }
+    }
+    return TAGS_UNSORTED;
+}
+
+// Compare the start of `line` with `prefix`, in the same order as lines
+// were sorted by ctags(1). Note that the tab terminating each tag name
+// sorts before any of the (printable) characters allowed in names.
+static int line_prefix_cmp(StringView line, StringView prefix, bool foldcase)
+{
+    size_t n = MIN(line.length, prefix.length);
+    if (!foldcase) {
+        int r = memcmp(line.data, prefix.data, n);
+        if (r) {
+            return r;
+        }
+    } else {
+        for (size_t i = 0; i < n; i++) {
+            unsigned char a = ascii_toupper(line.data[i]);
+            unsigned char b = ascii_toupper(prefix.data[i]);
+            if (a != b) {
+                return (a < b) ? -1 : 1;
+            }
+        }
+    }
+    return (line.length < prefix.length) ? -1 : 0;
+}
+
+// Return the offset of the first line in the range [lo, hi) for which
+// line_prefix_cmp() returns a value of at least `min` (or `hi`, if no
+// such line exists). Both `lo` and `hi` must be offsets of line starts.
+static size_t bsearch_lines (
+    const char *buf,
+    size_t lo,
+    size_t hi,
+    StringView prefix,
+    bool foldcase,
+    int min
+) {
+    while (lo < hi) {
+        size_t start = lo + ((hi - lo) / 2);
+        while (start > lo && buf[start - 1] != '\n') {
+            start--;
+        }
+        size_t next = start;
+        StringView line = buf_slice_next_line(buf, &next, hi);
+        if (line_prefix_cmp(line, prefix, foldcase) < min) {
+            lo = next;
+        } else {
+            hi = start;
+        }
+    }
+    return lo;
+}
+
+// Find the range of `buf` containing all lines that may begin with
+// `prefix` and return its start offset (with the end offset stored in
+// `*endp`), so that next_tag() can be limited to it. The range is found
+// by binary search for sorted files (in O(log n) time) and is simply the
+// whole buffer otherwise. For TAGS_FOLDCASE files, the range also
+// includes lines that only match case-insensitively, which next_tag()
+// then skips as usual.
+size_t find_tag_range (
+    const char *buf,
+    size_t buf_len,
+    TagSortOrder order,
+    StringView prefix,
+    size_t *endp
+) {
+    if (order == TAGS_UNSORTED || prefix.length == 0) {
+        *endp = buf_len;
+        return 0;
+    }
+
+    // Skip the pseudo-tags, which aren't necessarily sorted
+    size_t start = 0;
+    while (start < buf_len && buf[start] == '!') {
+        buf_slice_next_line(buf, &start, buf_len);
+    }
+
+    bool foldcase = (order == TAGS_FOLDCASE);
+    start = bsearch_lines(buf, start, buf_len, prefix, foldcase, 0);
+    *endp = bsearch_lines(buf, start, buf_len, prefix, foldcase, 1);
+    return start;
+}
+
+static int name_cmp(const void *ap, const void *bp)
+{
+    const StringView *a = ap;
+    const StringView *b = bp;
+    int r = memcmp(a->data, b->data, MIN(a->length, b->length));
+    return r ? r : (a->length > b->length) - (a->length < b->length);
+}
+
+// Collect the names of all entries in `buf` into a sorted array without
+// duplicates, so that tag_name_index_find() can find all names with a
+// given prefix in O(log n) time. Lines are only split at the first tab
+// and not fully parsed, so this is a single (fast) pass over the buffer
+// for sorted files, with qsort(3) only being needed for other files.
+void tag_name_index_build(TagNameIndex *idx, const char *buf, size_t buf_len)
+{
+    size_t alloc = 1024;
+    size_t n = 0;
+    StringView *names = xmalloc(alloc * sizeof(names[0]));
+    bool sorted = true;
+
+    for (size_t pos = 0; pos < buf_len; ) {
+        StringView line = buf_slice_next_line(buf, &pos, buf_len);
+        const char *tab = line.length ? memchr(line.data, '\t', line.length) : NULL;
+        if (!tab || tab == line.data || line.data[0] == '!') {
+            // Empty name, invalid line or pseudo-tag
+            continue;
+        }
+
+        StringView name = string_view(line.data, tab - line.data);
+        if (n > 0) {
+            int r = name_cmp(&names[n - 1], &name);
+            if (r == 0) {
+                continue;
+            }
+            sorted &= (r < 0);
+        }
+
+        if (unlikely(n == alloc)) {
+            alloc = xmul(alloc, 2);
+            names = xrenew(names, alloc);
+        }
+        names[n++] = name;
+    }
+
+    if (!sorted) {
+        qsort(names, n, sizeof(names[0]), name_cmp);
+        size_t j = 0;
+        for (size_t i = 0; i < n; i++) {
+            if (j == 0 || name_cmp(&names[j - 1], &names[i]) != 0) {
+                names[j++] = names[i];
+            }
+        }
+        n = j;
+    }
+
+    idx->names = n ? xrenew(names, n) : names;
+    idx->count = n;
+}
+
+// Find the range of `idx->names` starting with `prefix` and return its
+// start index (with the end index stored in `*endp`)
+size_t tag_name_index_find(const TagNameIndex *idx, StringView prefix, size_t *endp)
+{
+    const StringView *names = idx->names;
+    size_t lo = 0;
+    size_t hi = idx->count;
+    while (lo < hi) {
+        size_t mid = lo + ((hi - lo) / 2);
+        if (name_cmp(&names[mid], &prefix) < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    size_t end = lo;
+    while (end < idx->count && strview_has_sv_prefix(names[end], prefix)) {
+        end++;
+    }
+
+    *endp = end;
+    return lo;
+}
+
+void tag_name_index_free(TagNameIndex *idx)
+{
+    free(idx->names);
+    *idx = (TagNameIndex){.names = NULL};
+}
+
 // NOTE: tag itself is not freed
 void free_tag(Tag *tag)
 {
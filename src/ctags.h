@@ -15,6 +15,19 @@ typedef struct {
     bool local; // Indicates if tag is local to file (e.g. "static" in C)
 } Tag;
 
+// Value of the "!_TAG_FILE_SORTED" pseudo-tag, as written by ctags(1)
+typedef enum {
+    TAGS_UNSORTED = 0,
+    TAGS_SORTED = 1, // Sorted by byte value (as with `LC_ALL=C sort`)
+    TAGS_FOLDCASE = 2, // Sorted case-insensitively (ASCII only)
+} TagSortOrder;
+
+// The distinct tag names of a tags file, sorted by byte value
+typedef struct {
+    StringView *names; // Pointing into the buffer given to tag_name_index_build()
+    size_t count;
+} TagNameIndex;
+
 NONNULL_ARGS WARN_UNUSED_RESULT READWRITE(3) WRITEONLY(6)
 bool next_tag (
     const char *buf,
@@ -25,6 +38,11 @@ bool next_tag (
     Tag *tag
 );
 
+TagSortOrder get_tag_sort_order(const char *buf, size_t buf_len) NONNULL_ARGS WARN_UNUSED_RESULT;
+size_t find_tag_range(const char *buf, size_t buf_len, TagSortOrder order, StringView prefix, size_t *endp) NONNULL_ARGS WARN_UNUSED_RESULT;
+void tag_name_index_build(TagNameIndex *idx, const char *buf, size_t buf_len) NONNULL_ARGS;
+size_t tag_name_index_find(const TagNameIndex *idx, StringView prefix, size_t *endp) NONNULL_ARGS WARN_UNUSED_RESULT;
+void tag_name_index_free(TagNameIndex *idx) NONNULL_ARGS;
 bool parse_ctags_line(Tag *t, const char *line, size_t line_len) NONNULL_ARG(1);
 void free_tag(Tag *t) NONNULL_ARGS;
 
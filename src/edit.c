@@ -5,6 +5,7 @@
 #include "syntax/highlight.h"
 #include "util/debug.h"
 #include "util/list.h"
+#include "util/str-util.h"
 #include "util/xmalloc.h"
 
 enum {
@@ -226,6 +227,59 @@ void do_insert(View *view, const char *buf, size_t len)
     Buffer *buffer = view->buffer;
     size_t nl = insert_bytes(&view->cursor, buf, len);
     buffer->nl += nl;
+    buffer->edit_count++;
+    sanity_check_blocks(view, true);
+
+    view_update_cursor_y(view);
+    buffer_mark_lines_changed(buffer, view->cy, nl ? LONG_MAX : view->cy);
+    if (buffer->syntax) {
+        hl_insert(&buffer->line_start_states, view->cy, nl);
+    }
+}
+
+// Insert the contents of `bl` at the cursor, by linking its Blocks into
+// the buffer instead of copying them (as do_insert() would). Only the
+// text before and after the cursor (in the current Block) is copied,
+// into the first and last new Blocks respectively, so that all Blocks
+// still contain whole lines. This leaves `bl` empty.
+void do_insert_blocks(View *view, BlockList *bl)
+{
+    BUG_ON(bl->size == 0);
+    block_iter_normalize(&view->cursor);
+
+    Buffer *buffer = view->buffer;
+    Block *blk = view->cursor.blk;
+    Block *first = BLOCK(bl->blocks.next);
+    Block *last = BLOCK(bl->blocks.prev);
+    size_t offset = view->cursor.offset;
+    size_t nl = bl->nl;
+
+    size_t tail = blk->size - offset;
+    size_t tail_nl = 0;
+    if (tail) {
+        block_grow(last, last->size + tail);
+        tail_nl = copy_count_nl(last->data + last->size, blk->data + offset, tail);
+        last->size += tail;
+        last->nl += tail_nl;
+    }
+
+    if (offset) {
+        block_grow(first, first->size + offset);
+        memmove(first->data + offset, first->data, first->size);
+        memcpy(first->data, blk->data, offset);
+        first->size += offset;
+        first->nl += blk->nl - tail_nl;
+    }
+
+    list_splice_before(&bl->blocks, &blk->node);
+    block_free(blk);
+    bl->size = 0;
+    bl->nl = 0;
+
+    view->cursor.blk = first;
+    view->cursor.offset = offset;
+    buffer->nl += nl;
+    buffer->edit_count++;
     sanity_check_blocks(view, true);
 
     view_update_cursor_y(view);
@@ -260,6 +314,7 @@ char *do_delete(View *view, size_t len, bool sanity_check_newlines)
     char *deleted = xmalloc(len);
     size_t pos = 0;
     size_t deleted_nl = 0;
+    buffer->edit_count++;
 
     while (pos < len) {
         ListHead *next = blk->node.next;
@@ -349,6 +404,7 @@ char *do_replace(View *view, size_t del, const char *buf, size_t ins)
 
     // Modification is limited to one block
     Buffer *buffer = view->buffer;
+    buffer->edit_count++;
     char *ptr = blk->data + offset;
     char *deleted = xmalloc(del);
     size_t del_nl = copy_count_nl(deleted, ptr, del);
@@ -387,3 +443,185 @@ slow:
     do_insert(view, buf, ins);
     return deleted;
 }
+
+// Make all of the replacements described by `ranges` (which must be
+// sorted by offset and not overlap) in a single pass over the buffer.
+// All offsets refer to the buffer as it was before any replacements
+// were made. Blocks that aren't touched by any range are left as they
+// are, but those that are get rebuilt into new Blocks, so the cost is
+// proportional to the size of the affected Blocks, instead of to the
+// number of ranges times the size of the buffer (as it would be with
+// repeated calls to do_replace()).
+void do_replace_ranges(View *view, EditRange *ranges, size_t nr_ranges)
+{
+    BUG_ON(nr_ranges == 0);
+    Buffer *buffer = view->buffer;
+    ListHead *head = &buffer->blocks;
+    EditRange *r = ranges;
+    const EditRange *end = ranges + nr_ranges;
+    size_t blk_start = 0;
+    size_t del_left = 0; // Bytes left to delete for the range at `r`
+    char *del_ptr = NULL; // Destination for the next deleted bytes
+    size_t ins_nl = 0;
+    size_t del_nl = 0;
+
+    // Rebuilt text, which is moved into the buffer whenever it ends
+    // with a whole line (i.e. at a Block boundary)
+    BlockList out;
+    block_list_init(&out);
+
+    for (ListHead *node = head->next; node != head; ) {
+        Block *blk = BLOCK(node);
+        ListHead *next = node->next;
+        size_t size = blk->size;
+        size_t blk_end = blk_start + size;
+        bool pending = del_left || !list_empty(&out.blocks);
+
+        if (!pending && (r == end || r->offset > blk_end)) {
+            if (r == end) {
+                break;
+            }
+            blk_start = blk_end;
+            node = next;
+            continue;
+        }
+
+        for (size_t pos = 0; ; ) {
+            if (del_left) {
+                size_t n = MIN(del_left, size - pos);
+                del_nl += copy_count_nl(del_ptr, blk->data + pos, n);
+                del_ptr += n;
+                del_left -= n;
+                pos += n;
+                if (del_left) {
+                    // Range continues into the next Block
+                    break;
+                }
+                r++;
+                continue;
+            }
+
+            size_t offset = blk_start + pos;
+            BUG_ON(r < end && r->offset < offset);
+            if (r < end && r->offset == offset) {
+                if (r->ins) {
+                    block_list_append(&out, r->ins_buf, r->ins);
+                    ins_nl += count_nl(r->ins_buf, r->ins);
+                }
+                r->deleted = r->del ? xmalloc(r->del) : NULL;
+                del_ptr = r->deleted;
+                del_left = r->del;
+                r += !del_left;
+                continue;
+            }
+
+            if (pos == size) {
+                break;
+            }
+
+            size_t stop = (r < end && r->offset < blk_end) ? r->offset - blk_start : size;
+            block_list_append(&out, blk->data + pos, stop - pos);
+            pos = stop;
+        }
+
+        block_free(blk);
+        blk_start = blk_end;
+        node = next;
+
+        const Block *last = list_empty(&out.blocks) ? NULL : BLOCK(out.blocks.prev);
+        if (!del_left && (!last || last->data[last->size - 1] == '\n')) {
+            list_splice_before(&out.blocks, next);
+            block_list_init(&out);
+        }
+    }
+
+    BUG_ON(r != end);
+    BUG_ON(del_left);
+
+    // Any remaining text belongs at the end of the buffer
+    list_splice_before(&out.blocks, head);
+    if (list_empty(head)) {
+        list_insert_before(&block_new(1)->node, head);
+    }
+
+    buffer->nl += ins_nl;
+    buffer->nl -= del_nl;
+    buffer->edit_count++;
+
+    view->cursor.blk = BLOCK(head->next);
+    block_iter_goto_offset(&view->cursor, ranges[0].offset);
+    sanity_check_blocks(view, true);
+
+    view_update_cursor_y(view);
+    buffer_mark_lines_changed(buffer, view->cy, LONG_MAX);
+    if (buffer->syntax) {
+        hl_truncate(&buffer->line_start_states, view->cy);
+    }
+}
+
+// Move the contents of `next` to the end of `blk` (which must precede it)
+// and then free it, updating any View cursors that pointed into it
+static void merge_blocks(Buffer *buffer, Block *blk, Block *next)
+{
+    size_t old_size = blk->size;
+    for (size_t i = 0, n = buffer->views.count; i < n; i++) {
+        View *view = buffer->views.ptrs[i];
+        if (view->cursor.blk == next) {
+            view->cursor.blk = blk;
+            view->cursor.offset += old_size;
+        }
+    }
+
+    block_grow(blk, old_size + next->size);
+    memcpy(blk->data + old_size, next->data, next->size);
+    blk->size += next->size;
+    blk->nl += next->nl;
+    block_free(next);
+}
+
+// Merge adjacent Blocks whose combined size is no more than BLOCK_EDIT_SIZE,
+// since editing (e.g. with do_delete() and split_and_insert()) tends to
+// leave many small Blocks behind, which slows down every linear walk of
+// the Block list. This is done incrementally (for use when the editor is
+// otherwise idle), by visiting no more than `max_blocks` Blocks per call
+// and then resuming from the same Block in the next call. Any edit can
+// free Blocks, so the walk is restarted from the first Block if the
+// buffer was edited in the meantime. The return value indicates whether
+// the whole buffer has been processed since the last edit, in which case
+// further calls do nothing.
+bool defrag_blocks(Buffer *buffer, size_t max_blocks)
+{
+    ListHead *head = &buffer->blocks;
+    Block *blk = buffer->defrag_blk;
+    if (buffer->defrag_edit_count != buffer->edit_count) {
+        blk = BLOCK(head->next);
+    } else if (!blk) {
+        return true;
+    }
+
+    size_t nr_merges = 0;
+    for (size_t i = 0; i < max_blocks && block_has_next(blk, head); i++) {
+        Block *next = block_next(blk);
+        if (blk->size + next->size > BLOCK_EDIT_SIZE) {
+            blk = next;
+            continue;
+        }
+        merge_blocks(buffer, blk, next);
+        nr_merges++;
+    }
+
+    // The data of merged Blocks has moved, so any caches keyed by the
+    // address of a line (e.g. ColumnCache) must be invalidated
+    buffer->edit_count += (nr_merges > 0);
+    buffer->defrag_edit_count = buffer->edit_count;
+
+    bool done = !block_has_next(blk, head);
+    buffer->defrag_blk = done ? NULL : blk;
+    if (done) {
+        for (size_t i = 0, n = buffer->views.count; i < n; i++) {
+            sanity_check_blocks(buffer->views.ptrs[i], true);
+        }
+    }
+    return done;
+}
+
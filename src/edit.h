@@ -3,11 +3,27 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include "block.h"
+#include "buffer.h"
 #include "util/macros.h"
 #include "view.h"
 
+// A replacement made by do_replace_ranges(), in which `del` bytes at
+// `offset` are replaced by the `ins` bytes at `ins_buf`. The removed
+// bytes are returned in `deleted` (which is NULL if `del` is 0).
+typedef struct {
+    size_t offset;
+    size_t del;
+    const char *ins_buf;
+    size_t ins;
+    char *deleted;
+} EditRange;
+
 void do_insert(View *view, const char *buf, size_t len) NONNULL_ARG(1);
+void do_insert_blocks(View *view, BlockList *bl) NONNULL_ARGS;
 char *do_delete(View *view, size_t len, bool sanity_check_newlines) NONNULL_ARGS;
 char *do_replace(View *view, size_t del, const char *buf, size_t ins) NONNULL_ARGS_AND_RETURN;
+void do_replace_ranges(View *view, EditRange *ranges, size_t nr_ranges) NONNULL_ARGS;
+bool defrag_blocks(Buffer *buffer, size_t max_blocks) NONNULL_ARGS;
 
 #endif
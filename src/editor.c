@@ -9,6 +9,7 @@
 #include "bind.h"
 #include "bookmark.h"
 #include "compiler.h"
+#include "edit.h"
 #include "encoding.h"
 #include "file-option.h"
 #include "filetype.h"
@@ -20,6 +21,7 @@
 #include "terminal/key.h"
 #include "terminal/output.h"
 #include "terminal/paste.h"
+#include "timing.h"
 #include "ui.h"
 #include "util/exitcode.h"
 #include "util/intern.h"
@@ -103,6 +105,7 @@ EditorState *init_editor_state(const char *home, const char *dte_home)
         .terminal = {
             .obuf = TERM_OUTPUT_INIT,
         },
+        .undo_journal = UNDO_JOURNAL_INIT,
         .cursor_styles = {
             [CURSOR_MODE_DEFAULT] = {.type = CURSOR_DEFAULT, .color = COLOR_DEFAULT},
             [CURSOR_MODE_INSERT] = {.type = CURSOR_KEEP, .color = COLOR_KEEP},
@@ -134,6 +137,7 @@ EditorState *init_editor_state(const char *home, const char *dte_home)
             .msg_compile = 0,
             .msg_tag = 0,
             .optimize_true_color = false,
+            .redraw_delay = 0,
             .scroll_margin = 0,
             .select_cursor_char = true,
             .set_window_title = false,
@@ -143,6 +147,8 @@ EditorState *init_editor_state(const char *home, const char *dte_home)
             .syntax_line_limit = 512ULL << 10, // 512KiB
             .syntax_size_limit = 100ULL << 20, // 100MiB
             .tab_bar = true,
+            .undo_journal = true,
+            .undo_memory_limit = 0, // Unlimited
             .utf8_bom = false,
             .window_separator = WINSEP_BAR,
         }
@@ -220,6 +226,7 @@ void free_editor_state(EditorState *e)
         LOG_DEBUG("%zu unprocessed bytes in terminal input buffer", n);
     }
 
+    job_list_free(&e->jobs);
     free(e->clipboard.buf);
     free_file_options(&e->file_options);
     free_filetypes(&e->filetypes);
@@ -228,11 +235,14 @@ void free_editor_state(EditorState *e)
     history_free(&e->command_history);
     history_free(&e->search_history);
     search_free_regexp(&e->search);
+    term_output_free(&e->terminal.obuf);
     clear_all_messages(e);
     cmdline_free(&e->cmdline);
     free_macro(&e->macro);
     tag_file_free(&e->tagfile);
+    background_grep_free(e->grep);
     free_buffers(&e->buffers, &e->err, &e->locks_ctx);
+    undo_journal_close(&e->undo_journal);
     free_file_locks_context(&e->locks_ctx);
 
     ptr_array_free_cb(&e->bookmarks, FREE_FUNC(file_location_free));
@@ -245,6 +255,7 @@ void free_editor_state(EditorState *e)
 
     free_interned_strings();
     free_interned_regexps();
+    free_cached_regexps();
     free(e);
 }
 
@@ -359,20 +370,136 @@ static ScreenState get_screen_state(const EditorState *e)
     };
 }
 
-static void log_timing_info(const struct timespec *start, bool enabled)
+enum {
+    // Maximum number of keys processed by main_loop() before the screen
+    // is updated, even when more input is pending
+    MAX_KEYS_PER_REDRAW = 256,
+    // Maximum number of Blocks visited (or merged) by each defrag_blocks()
+    // call in do_idle_work(), between checks for pending input
+    IDLE_DEFRAG_BLOCKS = 256,
+    // Number of files (or directories) searched by `grep -b` between
+    // checks for pending input
+    IDLE_GREP_PATHS = 8,
+};
+
+static void log_timing_info (
+    uint64_t start,
+    size_t nr_keys,
+    size_t nr_written,
+    size_t nr_flushes
+) {
+    if (likely(!start)) {
+        return;
+    }
+
+    // Record the timings for `show timing` and also log them, in a
+    // format that's easy to extract from the log file with e.g. awk(1)
+    const TimingSample *sample = timing_end_update(start);
+    if (!log_level_enabled(LOG_LEVEL_INFO)) {
+        return;
+    }
+
+    char buf[256];
+    size_t n = 0;
+    for (TimingStage i = 0; i < TIMING_TOTAL; i++) {
+        const char *name = timing_stage_name(i);
+        double ms = (double)sample->ns[i] / NS_PER_MS;
+        n += xsnprintf(buf + n, sizeof(buf) - n, " %s=%.3f", name, ms);
+    }
+
+    LOG_INFO (
+        "main loop time: %.3f ms (%zu keys, %zu bytes written in %zu flushes)%s",
+        (double)sample->ns[TIMING_TOTAL] / NS_PER_MS,
+        nr_keys, nr_written, nr_flushes, buf
+    );
+}
+
+// Continue the search started by `grep -b` (if any) and return true if
+// it finished, or false if interrupted by pending input
+static bool continue_background_grep(EditorState *e)
+{
+    BackgroundGrep *bg = e->grep;
+    if (!bg) {
+        return true;
+    }
+
+    GrepContext *ctx = &bg->ctx;
+    while (!grep_step(ctx, IDLE_GREP_PATHS)) {
+        if (resized || term_input_pending(&e->terminal, 0)) {
+            return false;
+        }
+    }
+
+    const ScreenState s = get_screen_state(e);
+    const char *pattern = bg->pattern;
+    size_t nfiles = ctx->nr_files;
+    if (ctx->nr_matches) {
+        info_msg(&e->err, "grep: %zu matches for '%s' (%zu files searched)", ctx->nr_matches, pattern, nfiles);
+    } else {
+        error_msg(&e->err, "No matches for '%s' (%zu files searched)", pattern, nfiles);
+    }
+
+    background_grep_free(bg);
+    e->grep = NULL;
+    update_screen(e, &s);
+    return true;
+}
+
+// Do housekeeping work that was deferred while editing, in small steps,
+// for as long as no input is pending
+static void do_idle_work(EditorState *e)
 {
-    struct timespec end;
-    if (likely(!enabled) || !xgettime(&end)) {
+    if (!continue_background_grep(e)) {
         return;
     }
 
-    double ms = timespec_to_fp_milliseconds(timespec_subtract(&end, start));
-    LOG_INFO("main loop time: %.3f ms", ms);
+    for (size_t i = 0, n = e->buffers.count; i < n; i++) {
+        Buffer *buffer = e->buffers.ptrs[i];
+        while (!defrag_blocks(buffer, IDLE_DEFRAG_BLOCKS)) {
+            if (resized || term_input_pending(&e->terminal, 0)) {
+                return;
+            }
+        }
+    }
+}
+
+// Wait for terminal input, while handling the output of background jobs
+// (and updating the screen to show any resulting messages) in the meantime
+static void wait_for_input(EditorState *e)
+{
+    while (e->jobs.jobs.count && !e->terminal.ibuf.len && !resized) {
+        const ScreenState s = get_screen_state(e);
+        if (job_list_wait(&e->jobs, STDIN_FILENO, &e->compilers, &e->err)) {
+            return;
+        }
+        update_screen(e, &s);
+    }
+}
+
+// Return the number of milliseconds remaining until `deadline` (rounded
+// up), or 0 if it has already passed
+static unsigned int ms_until(const struct timespec *deadline)
+{
+    struct timespec now;
+    if (unlikely(!xgettime(&now))) {
+        return 0;
+    }
+
+    struct timespec left = timespec_subtract(deadline, &now);
+    if (left.tv_sec < 0) {
+        return 0;
+    }
+
+    return (left.tv_sec * MS_PER_SECOND) + ((left.tv_nsec + NS_PER_MS - 1) / NS_PER_MS);
 }
 
 void main_loop(EditorState *e, unsigned int terminal_query_level, bool timing)
 {
     BUG_ON(e->flags & EFLAG_HEADLESS);
+    if (timing) {
+        timing_enable();
+    }
+
     ui_first_start(e, terminal_query_level);
 
     while (e->status == EDITOR_RUNNING) {
@@ -381,21 +508,63 @@ void main_loop(EditorState *e, unsigned int terminal_query_level, bool timing)
             ui_resize(e);
         }
 
+        do_idle_work(e);
+        wait_for_input(e);
         KeyCode key = term_read_input(&e->terminal, e->options.esc_timeout);
         if (unlikely(key == KEY_NONE)) {
             continue;
         }
 
-        struct timespec start;
-        timing = unlikely(timing) && xgettime(&start);
-
+        const uint64_t start = timing_start();
         const ScreenState s = get_screen_state(e);
+        const TermOutputBuffer *obuf = &e->terminal.obuf;
+        const size_t nr_written = obuf->nr_written;
+        const size_t nr_flushes = obuf->nr_flushes;
+
+        // The `redraw-delay` period is measured from the first key, so
+        // that a steady stream of input can't postpone the screen update
+        // for longer than that
+        const unsigned int redraw_delay = e->options.redraw_delay;
+        struct timespec deadline;
+        bool delay = redraw_delay && xgettime(&deadline);
+        if (delay) {
+            deadline = timespec_add_ms(deadline, redraw_delay);
+        }
+
+        // Errors are cleared once per screen update (instead of once per
+        // key), so that an error from any of the keys processed below is
+        // still displayed
         clear_error(&e->err);
         handle_input(e, key);
         sanity_check(e->view);
-        update_screen(e, &s);
 
-        log_timing_info(&start, timing);
+        // Process any further input that's already been received (e.g. due
+        // to key repeat or an undelimited paste) or that arrives within the
+        // `redraw-delay` period, before doing a single screen update for all
+        // of it. This keeps the editor from falling behind, when input
+        // arrives faster than the screen can be redrawn.
+        size_t nr_keys = 1;
+        while (
+            e->status == EDITOR_RUNNING
+            && nr_keys < MAX_KEYS_PER_REDRAW
+            && term_input_pending(&e->terminal, delay ? ms_until(&deadline) : 0)
+        ) {
+            key = term_read_input(&e->terminal, e->options.esc_timeout);
+            if (key == KEY_NONE) {
+                continue;
+            }
+            handle_input(e, key);
+            sanity_check(e->view);
+            nr_keys++;
+        }
+
+        update_screen(e, &s);
+        log_timing_info (
+            start,
+            nr_keys,
+            obuf->nr_written - nr_written,
+            obuf->nr_flushes - nr_flushes
+        );
     }
 
     BUG_ON(e->status < 0 || e->status > EDITOR_EXIT_MAX);
@@ -13,7 +13,9 @@
 #include "copy.h"
 #include "file-history.h"
 #include "frame.h"
+#include "grep.h"
 #include "history.h"
+#include "job.h"
 #include "lock.h"
 #include "mode.h"
 #include "msg.h"
@@ -25,6 +27,7 @@
 #include "tag.h"
 #include "terminal/cursor.h"
 #include "terminal/terminal.h"
+#include "undo-journal.h"
 #include "util/debug.h"
 #include "util/hashmap.h"
 #include "util/hashset.h"
@@ -90,6 +93,7 @@ typedef struct EditorState {
     bool session_leader;
     Clipboard clipboard;
     TagFile tagfile;
+    BackgroundGrep *grep; // Search started by `grep -b` (or NULL)
     HashMap aliases;
     HashMap compilers;
     HashMap modes;
@@ -110,6 +114,8 @@ typedef struct EditorState {
     PointerArray file_options;
     PointerArray bookmarks;
     MessageList messages[3];
+    JobList jobs;
+    UndoJournal undo_journal;
     FileHistory file_history;
     History search_history;
     History command_history;
@@ -189,13 +189,14 @@ static void parse_and_activate_tags(EditorState *e, const String *str, ExecActio
 
 static void insert_to_selection (
     View *view,
-    const String *output,
+    BlockList *output,
     const SelectionInfo *info
 ) {
     size_t del_count = info->eo - info->so;
-    buffer_replace_bytes(view, del_count, output->buffer, output->len);
+    size_t ins_count = output->size;
+    buffer_replace_blocks(view, del_count, output);
 
-    if (output->len == 0) {
+    if (ins_count == 0) {
         // If the selection was replaced with 0 bytes then there's nothing
         // new to select, so just unselect instead
         unselect(view);
@@ -204,7 +205,7 @@ static void insert_to_selection (
 
     // Keep the selection and adjust the size to the newly inserted text
     size_t so = info->so;
-    size_t eo = so + (output->len - 1);
+    size_t eo = so + (ins_count - 1);
     block_iter_goto_offset(&view->cursor, info->swapped ? so : eo);
     view->sel_so = info->swapped ? eo : so;
     view->sel_eo = SEL_EO_RECALC;
@@ -268,9 +269,16 @@ ssize_t handle_exec (
     bool replace_unselected_input = false;
     bool quiet = (exec_flags & EXECFLAG_QUIET);
 
+    // Output to the buffer is read directly into new Blocks, which are
+    // then linked into the buffer (see buffer_replace_blocks()), instead
+    // of being accumulated in a String and then copied
+    BlockList output_blocks;
+    block_list_init(&output_blocks);
+
     SpawnContext ctx = {
         .argv = argv,
         .outputs = {STRING_INIT, STRING_INIT},
+        .output_blocks = output_to_buffer ? &output_blocks : NULL,
         .quiet = quiet,
         .ebuf = &e->err,
         .lines = output_to_buffer ? view->window->edit_h : 0,
@@ -388,21 +396,28 @@ ssize_t handle_exec (
         }
     }
 
+    // Input from the buffer is written to the child directly from the
+    // Block::data of each Block, without first copying it into a single,
+    // contiguous allocation (which could be huge)
+    StringView *input_parts = NULL;
     if (input_from_buffer) {
-        alloc = block_iter_get_bytes(view->cursor, ctx.input.length);
-        ctx.input.data = alloc;
+        size_t len = ctx.input.length;
+        input_parts = block_iter_get_segments(view->cursor, len, &ctx.nr_input_parts);
+        ctx.input_parts = input_parts;
     }
 
     yield_terminal(e, quiet);
     int err = spawn(&ctx);
     bool prompt = (err >= 0) && (exec_flags & EXECFLAG_PROMPT);
     resume_terminal(e, quiet, prompt);
+    free(input_parts);
     free(alloc);
 
     if (err != 0) {
         show_spawn_error_msg(&e->err, &ctx.outputs[1], err);
         string_free(&ctx.outputs[0]);
         string_free(&ctx.outputs[1]);
+        block_list_free(&output_blocks);
         view->cursor = saved_cursor;
         return -1;
     }
@@ -410,18 +425,14 @@ ssize_t handle_exec (
     string_free(&ctx.outputs[1]);
     String *output = &ctx.outputs[0];
     bool strip_trailing_newline = (exec_flags & EXECFLAG_STRIP_NL);
-    if (
-        strip_trailing_newline
-        && output_to_buffer
-        && output->len > 0
-        && output->buffer[output->len - 1] == '\n'
-    ) {
-        output->len--;
-        if (output->len > 0 && output->buffer[output->len - 1] == '\r') {
-            output->len--;
-        }
+    if (strip_trailing_newline && output_to_buffer) {
+        block_list_strip_trailing_newline(&output_blocks);
     }
 
+    // This is saved here, because buffer_replace_blocks() empties the
+    // BlockList (and may also add a newline to it)
+    size_t output_len = output_to_buffer ? output_blocks.size : output->len;
+
     if (!output_to_buffer) {
         view->cursor = saved_cursor;
         view->sel_so = saved_sel_so;
@@ -433,10 +444,10 @@ ssize_t handle_exec (
     switch (out_action) {
     case EXEC_BUFFER:
         if (view->selection) {
-            insert_to_selection(view, output, &info);
+            insert_to_selection(view, &output_blocks, &info);
         } else {
             size_t del_count = replace_unselected_input ? ctx.input.length : 0;
-            buffer_replace_bytes(view, del_count, output->buffer, output->len);
+            buffer_replace_blocks(view, del_count, &output_blocks);
         }
         break;
     case EXEC_ECHO:
@@ -480,8 +491,8 @@ ssize_t handle_exec (
         return -1;
     }
 
-    size_t output_len = output->len;
     string_free(output);
+    block_list_free(&output_blocks);
     return output_len;
 }
 
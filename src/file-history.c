@@ -151,6 +151,12 @@ void file_history_free(FileHistory *history)
     history->last = NULL;
 }
 
+size_t file_history_memory_usage(const FileHistory *history)
+{
+    const HashMap *map = &history->entries;
+    return hashmap_memory_usage(map) + (map->count * sizeof(FileHistoryEntry));
+}
+
 String file_history_dump(const FileHistory *history)
 {
     size_t nr_entries = history->entries.count;
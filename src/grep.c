@@ -0,0 +1,313 @@
+#include "build-defs.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "grep.h"
+#include "bookmark.h"
+#include "regexp.h"
+#include "util/debug.h"
+#include "util/log.h"
+#include "util/path.h"
+#include "util/ptr-array.h"
+#include "util/str-util.h"
+#include "util/string-view.h"
+#include "util/utf8.h"
+#include "util/xdirent.h"
+#include "util/xmalloc.h"
+#include "util/xmemrchr.h"
+#include "util/xreadwrite.h"
+#include "util/xstring.h"
+
+enum {
+    // Files with a NUL byte in this many leading bytes are considered
+    // to be binary and skipped (as with `grep -I`)
+    BINARY_CHECK_LEN = 8192,
+    // Matched lines longer than this are truncated in Message::msg
+    MSG_MAX_LEN = 512,
+};
+
+static void add_match(GrepContext *ctx, const char *filename, StringView line, size_t line_nr, size_t col)
+{
+    size_t len = MIN(line.length, MSG_MAX_LEN);
+    Message *m = new_message(line.data, len);
+    strn_replace_byte(m->msg, len, '\t', ' ');
+    m->loc = new_file_location(xstrdup(filename), 0, line_nr, col);
+    add_message(ctx->msgs, m);
+    ctx->nr_matches++;
+}
+
+// Add a Message for every line of `text` that matches `ctx->re`. Each call
+// to regexec(3) scans forward to the next match (instead of being given
+// a single line at a time) and newlines are only counted for the regions
+// between matches, so the cost is linear in `size`.
+void grep_text(GrepContext *ctx, const char *filename, const char *text, size_t size)
+{
+    size_t line_nr = 1;
+    size_t counted = 0; // Offset up to which newlines have been counted
+
+    // Without REG_STARTEND, regexp_exec() would make a null-terminated
+    // copy of the remaining text for every match (making the cost
+    // quadratic in the number of matches), so a single copy is made here
+    // instead. As with regexp_exec(), searching stops at the first NUL
+    // byte in this case.
+    char *cstr = HAVE_REG_STARTEND ? NULL : xstrcut(text, size);
+
+    for (size_t pos = 0; pos < size; ) {
+        // Note that `pos` is always at the start of a line here, so there's
+        // no need for REG_NOTBOL (and REG_NEWLINE makes `^` match after
+        // every newline anyway)
+        regmatch_t m;
+        bool found = cstr
+            ? !regexec(ctx->re, cstr + pos, 1, &m, 0)
+            : regexp_exec(ctx->re, text + pos, size - pos, 1, &m, 0);
+        if (!found) {
+            break;
+        }
+
+        size_t match = pos + m.rm_so;
+        const char *nl = xmemrchr(text + pos, '\n', match - pos);
+        size_t bol = nl ? (size_t)(nl - text) + 1 : pos;
+        nl = memchr(text + match, '\n', size - match);
+        size_t eol = nl ? (size_t)(nl - text) : size;
+
+        line_nr += count_nl(text + counted, bol - counted);
+        counted = bol;
+
+        size_t col = 1;
+        for (size_t i = bol; i < match; col++) {
+            u_get_char(text, match, &i);
+        }
+
+        StringView line = string_view(text + bol, eol - bol);
+        strview_remove_matching_suffix(&line, "\r");
+        add_match(ctx, filename, line, line_nr, col);
+        pos = eol + 1;
+    }
+
+    free(cstr);
+}
+
+static void grep_file(GrepContext *ctx, const char *path)
+{
+    int fd = xopen(path, O_RDONLY | O_CLOEXEC | O_NOCTTY, 0);
+    if (unlikely(fd < 0)) {
+        LOG_WARNING("open '%s': %s", path, strerror(errno));
+        return;
+    }
+
+    struct stat st;
+    if (unlikely(fstat(fd, &st) != 0)) {
+        LOG_ERRNO("fstat");
+        xclose(fd);
+        return;
+    }
+
+    if (!S_ISREG(st.st_mode) || st.st_size <= 0 || (uintmax_t)st.st_size > SIZE_MAX) {
+        xclose(fd);
+        return;
+    }
+
+    // Note that the file is read instead of mapped with mmap(2), since
+    // files may be rewritten while being searched (e.g. by a concurrent
+    // `compile -b` job) and accessing a truncated mapping raises SIGBUS
+    size_t size = st.st_size;
+    if (size > ctx->bufsize) {
+        ctx->buf = xrealloc(ctx->buf, size);
+        ctx->bufsize = size;
+    }
+
+    ssize_t nread = xread_all(fd, ctx->buf, size);
+    if (unlikely(nread < 0)) {
+        LOG_WARNING("read '%s': %s", path, strerror(errno));
+        xclose(fd);
+        return;
+    }
+
+    xclose(fd);
+    const char *text = ctx->buf;
+    size = nread;
+    if (size && !memchr(text, '\0', MIN(size, BINARY_CHECK_LEN))) {
+        ctx->nr_files++;
+        grep_text(ctx, path, text, size);
+    }
+}
+
+// Like is_dir_or_symlink_to_dir(), but returning the S_IFMT bits for
+// `ent` without following symlinks (so as to avoid directory cycles
+// and duplicate matches)
+static mode_t get_dir_entry_type(const struct dirent *ent, int dir_fd)
+{
+#if HAVE_DIRENT_D_TYPE
+    switch (ent->d_type) {
+        case DT_UNKNOWN: break; // Extra syscall needed for type info
+        case DT_DIR: return S_IFDIR;
+        case DT_REG: return S_IFREG;
+        default: return 0; // Symlinks, FIFOs, sockets, devices, etc.
+    }
+#endif
+
+    struct stat st;
+    if (fstatat(dir_fd, ent->d_name, &st, AT_SYMLINK_NOFOLLOW) != 0) {
+        return 0;
+    }
+    return st.st_mode & S_IFMT;
+}
+
+static char *join_relative(const char *dir, const char *name)
+{
+    return streq(dir, ".") ? xstrdup(name) : path_join(dir, name);
+}
+
+static int path_ptr_cmp(const void *ap, const void *bp)
+{
+    const char *const *a = ap;
+    const char *const *b = bp;
+    return strcmp(*a, *b);
+}
+
+static GrepPath *new_grep_path(char *path, bool is_dir)
+{
+    size_t len = strlen(path);
+    GrepPath *gp = xmalloc(sizeof(*gp) + len + 1);
+    gp->is_dir = is_dir;
+    memcpy(gp->path, path, len + 1);
+    free(path);
+    return gp;
+}
+
+// Push the entries of `array` (which are freed) onto `ctx->pending`, in
+// reverse order, so that they're popped off by grep_step() in sorted order
+static void push_sorted_paths(GrepContext *ctx, PointerArray *array, bool is_dir)
+{
+    ptr_array_sort(array, path_ptr_cmp);
+    for (size_t i = array->count; i > 0; i--) {
+        ptr_array_append(&ctx->pending, new_grep_path(array->ptrs[i - 1], is_dir));
+    }
+    ptr_array_free_array(array);
+}
+
+// Read the entries of the directory at `path` and push them onto
+// `ctx->pending`, such that all files are searched before the contents
+// of any subdirectory
+static void read_grep_dir(GrepContext *ctx, const char *path)
+{
+    DIR *dir = xopendir(path);
+    if (!dir) {
+        LOG_WARNING("opendir '%s': %s", path, strerror(errno));
+        return;
+    }
+
+    const int dir_fd = dirfd(dir);
+    if (unlikely(dir_fd < 0)) {
+        LOG_ERRNO("dirfd");
+        xclosedir(dir);
+        return;
+    }
+
+    PointerArray files = PTR_ARRAY_INIT;
+    PointerArray subdirs = PTR_ARRAY_INIT;
+
+    for (const struct dirent *de; (de = xreaddir(dir)); ) {
+        const char *name = de->d_name;
+        if (is_ignored_dir_entry(strview(name)) || name[0] == '.') {
+            // Hidden files and directories (e.g. `.git`) are skipped, in
+            // the same way as for completions of an empty prefix
+            continue;
+        }
+        switch (get_dir_entry_type(de, dir_fd)) {
+        case S_IFREG:
+            ptr_array_append(&files, join_relative(path, name));
+            break;
+        case S_IFDIR:
+            ptr_array_append(&subdirs, join_relative(path, name));
+            break;
+        }
+    }
+
+    xclosedir(dir);
+
+    // Entries are sorted, so that Messages are in a predictable order
+    // (readdir(3) order is filesystem-specific)
+    push_sorted_paths(ctx, &subdirs, true);
+    push_sorted_paths(ctx, &files, false);
+}
+
+// Search (or read the entries of) up to `max_paths` of the files and
+// directories pending in `ctx` and return true if none remain. This
+// allows a search to be done incrementally (see `grep -b`), with matches
+// being added to `ctx->msgs` as they're found.
+bool grep_step(GrepContext *ctx, size_t max_paths)
+{
+    PointerArray *pending = &ctx->pending;
+    for (size_t i = 0; i < max_paths && pending->count; i++) {
+        GrepPath *gp = pending->ptrs[--pending->count];
+        if (gp->is_dir) {
+            read_grep_dir(ctx, gp->path);
+        } else {
+            grep_file(ctx, gp->path);
+        }
+        free(gp);
+    }
+    return pending->count == 0;
+}
+
+// Add the file or directory tree at `path` (which, unlike the entries
+// visited when recursing, is allowed to be a symlink) to the paths to be
+// searched by grep_step(), after any that were added previously
+bool grep_add_path(GrepContext *ctx, const char *path)
+{
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        return false;
+    }
+
+    bool is_dir = S_ISDIR(st.st_mode);
+    if (!is_dir && !S_ISREG(st.st_mode)) {
+        errno = EINVAL;
+        return false;
+    }
+
+    if (is_dir && access(path, R_OK | X_OK) != 0) {
+        // Reported here, since errors for subdirectories are only logged
+        return false;
+    }
+
+    // Inserted at the bottom of the stack, so as to be searched last
+    ptr_array_insert(&ctx->pending, new_grep_path(xstrdup(path), is_dir), 0);
+    return true;
+}
+
+// Search the file or directory tree at `path`, to completion
+bool grep_path(GrepContext *ctx, const char *path)
+{
+    if (!grep_add_path(ctx, path)) {
+        return false;
+    }
+    while (!grep_step(ctx, SIZE_MAX)) {
+        ;
+    }
+    return true;
+}
+
+void grep_context_free(GrepContext *ctx)
+{
+    ptr_array_free(&ctx->pending);
+    free(ctx->buf);
+    ctx->buf = NULL;
+    ctx->bufsize = 0;
+}
+
+void background_grep_free(BackgroundGrep *bg)
+{
+    if (!bg) {
+        return;
+    }
+    grep_context_free(&bg->ctx);
+    regfree(&bg->re);
+    free(bg->pattern);
+    free(bg);
+}
@@ -0,0 +1,41 @@
+#ifndef GREP_H
+#define GREP_H
+
+#include <regex.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "msg.h"
+#include "util/macros.h"
+#include "util/ptr-array.h"
+
+typedef struct {
+    bool is_dir;
+    char path[];
+} GrepPath;
+
+typedef struct {
+    const regex_t *re; // Compiled with REG_NEWLINE
+    MessageList *msgs; // Destination for matches (appended in file order)
+    size_t nr_files; // Number of files searched
+    size_t nr_matches; // Number of Messages added to `msgs`
+    PointerArray pending; // Stack of GrepPaths not yet searched (see grep_step())
+    char *buf; // Buffer for file contents, reused for each file (see grep_file())
+    size_t bufsize; // Allocated size of `buf`
+} GrepContext;
+
+// A search started by `grep -b`, which is continued by grep_step() in
+// between handling input (see do_idle_work())
+typedef struct {
+    GrepContext ctx;
+    regex_t re;
+    char *pattern;
+} BackgroundGrep;
+
+bool grep_add_path(GrepContext *ctx, const char *path) NONNULL_ARGS WARN_UNUSED_RESULT;
+bool grep_step(GrepContext *ctx, size_t max_paths) NONNULL_ARGS;
+bool grep_path(GrepContext *ctx, const char *path) NONNULL_ARGS;
+void grep_context_free(GrepContext *ctx) NONNULL_ARGS;
+void grep_text(GrepContext *ctx, const char *filename, const char *text, size_t size) NONNULL_ARGS;
+void background_grep_free(BackgroundGrep *bg);
+
+#endif
@@ -144,6 +144,12 @@ void history_free(History *history)
     history->last = NULL;
 }
 
+size_t history_memory_usage(const History *history)
+{
+    const HashMap *map = &history->entries;
+    return hashmap_memory_usage(map) + (map->count * sizeof(HistoryEntry));
+}
+
 String history_dump(const History *history)
 {
     const size_t nr_entries = history->entries.count;
@@ -33,6 +33,7 @@ bool history_search_backward(const History *history, const HistoryEntry **pos, c
 void history_load(History *history, ErrorBuffer *ebuf, char *filename, size_t size_limit) NONNULL_ARG(1, 3);
 void history_save(const History *history, ErrorBuffer *ebuf) NONNULL_ARG(1);
 void history_free(History *history) NONNULL_ARGS;
+size_t history_memory_usage(const History *history) NONNULL_ARGS WARN_UNUSED_RESULT;
 String history_dump(const History *history) NONNULL_ARGS;
 
 #endif
@@ -0,0 +1,299 @@
+#include <errno.h>
+#include <inttypes.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "job.h"
+#include "command/serialize.h"
+#include "compiler.h"
+#include "spawn.h"
+#include "util/debug.h"
+#include "util/fork-exec.h"
+#include "util/strtonum.h"
+#include "util/time-util.h"
+#include "util/xmalloc.h"
+#include "util/xreadwrite.h"
+#include "util/xsnprintf.h"
+
+enum {
+    // How often to check whether a job has exited, after it has closed
+    // its output pipe (which usually happens at the same time)
+    REAP_INTERVAL_MS = 50,
+    // Amount of output kept for jobs without a Compiler, for the
+    // error message shown by report_job_exit()
+    EXEC_OUTPUT_MAX = 512,
+};
+
+static char *join_args(const char **argv)
+{
+    String buf = string_new(128);
+    for (size_t i = 0; argv[i]; i++) {
+        if (i) {
+            string_append_byte(&buf, ' ');
+        }
+        string_append_escaped_arg(&buf, argv[i], false);
+    }
+    return string_steal_cstring(&buf);
+}
+
+static void free_job(Job *job)
+{
+    if (job->fd >= 0) {
+        xclose(job->fd);
+    }
+    string_free(&job->output);
+    free(job->command);
+    free(job->compiler);
+    free(job);
+}
+
+bool job_start (
+    JobList *jobs,
+    ErrorBuffer *ebuf,
+    const char **argv,
+    bool read_stdout,
+    const char *compiler,
+    MessageList *msgs
+) {
+    BUG_ON(compiler && !msgs);
+    if (unlikely(jobs->jobs.count >= JOBS_MAX)) {
+        return error_msg(ebuf, "Too many background jobs (maximum is %d)", JOBS_MAX);
+    }
+
+    SpawnContext ctx = {
+        .argv = argv,
+        .ebuf = ebuf,
+        .quiet = true,
+    };
+
+    int fd;
+    pid_t pid = spawn_background(&ctx, read_stdout, &fd);
+    if (pid == -1) {
+        return false;
+    }
+
+    Job *job = xmalloc(sizeof(*job));
+    *job = (Job) {
+        .id = ++jobs->next_id,
+        .pid = pid,
+        .fd = fd,
+        .command = join_args(argv),
+        .compiler = compiler ? xstrdup(compiler) : NULL,
+        .msgs = msgs,
+        .output = STRING_INIT,
+    };
+
+    if (unlikely(!xgettime(&job->start))) {
+        job->start = (struct timespec){0};
+    }
+
+    ptr_array_append(&jobs->jobs, job);
+    return info_msg(ebuf, "Started job %lu (pid %jd)", job->id, (intmax_t)pid);
+}
+
+// Parse each complete line in `job->output` into a Message and remove
+// it from the buffer, leaving only the trailing incomplete line (if any)
+static void parse_output_lines(Job *job, const Compiler *c, bool eof)
+{
+    String *buf = &job->output;
+    if (eof && buf->len && buf->buffer[buf->len - 1] != '\n') {
+        string_append_byte(buf, '\n');
+    }
+
+    size_t count = job->msgs->array.count;
+    size_t pos = 0;
+    for (const char *nl; pos < buf->len; ) {
+        char *line = buf->buffer + pos;
+        nl = memchr(line, '\n', buf->len - pos);
+        if (!nl) {
+            break;
+        }
+        size_t len = (size_t)(nl - line) + 1;
+        handle_error_msg(c, job->msgs, line, len);
+        pos += len;
+    }
+
+    job->nr_msgs += job->msgs->array.count - count;
+    string_remove(buf, 0, pos);
+}
+
+static void read_job_output(Job *job, const HashMap *compilers)
+{
+    String *buf = &job->output;
+    char *ptr = string_reserve_space(buf, 4096);
+    ssize_t rc = xread(job->fd, ptr, buf->alloc - buf->len);
+    if (rc < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+        return;
+    }
+
+    bool eof = (rc <= 0);
+    buf->len += eof ? 0 : rc;
+
+    if (!job->compiler) {
+        // Only the first line is needed by report_job_exit()
+        buf->len = MIN(buf->len, EXEC_OUTPUT_MAX);
+    } else {
+        // The Compiler is looked up by name each time, since it may have
+        // been removed (by `errorfmt -c`) while the job was running
+        const Compiler *c = find_compiler(compilers, job->compiler);
+        if (likely(c)) {
+            parse_output_lines(job, c, eof);
+        } else {
+            string_clear(buf);
+        }
+    }
+
+    if (eof) {
+        xclose(job->fd);
+        job->fd = -1;
+    }
+}
+
+static void report_job_exit(const Job *job, int status, ErrorBuffer *ebuf)
+{
+    char msgs[64] = "";
+    if (job->compiler) {
+        xsnprintf(msgs, sizeof msgs, " (%zu messages)", job->nr_msgs);
+    }
+
+    unsigned long id = job->id;
+    const char *cmd = job->command;
+    if (status < 0) {
+        error_msg(ebuf, "Job %lu (%s): waitpid: %s", id, cmd, strerror(-status));
+    } else if (status >= 256) {
+        int sig = status >> 8;
+        const char *str = strsignal(sig);
+        error_msg(ebuf, "Job %lu (%s) received signal %d (%s)%s", id, cmd, sig, str ? str : "??", msgs);
+    } else if (status) {
+        const String *out = &job->output;
+        if (!job->compiler && out->len) {
+            size_t pos = 0;
+            StringView line = buf_slice_next_line(out->buffer, &pos, out->len);
+            error_msg(ebuf, "Job %lu (%s) returned %d: \"%.*s\"", id, cmd, status, (int)line.length, line.data);
+        } else {
+            error_msg(ebuf, "Job %lu (%s) returned %d%s", id, cmd, status, msgs);
+        }
+    } else {
+        info_msg(ebuf, "Job %lu (%s) finished%s", id, cmd, msgs);
+    }
+}
+
+// Wait for `input_fd` to become readable, while reading the output of
+// any background jobs (and reaping them, once exited) in the meantime.
+// This returns true if `input_fd` is ready, or false if some job activity
+// occurred (or poll(3) was interrupted by a signal), in which case the
+// caller may want to update the screen before calling it again.
+bool job_list_wait(JobList *jobs, int input_fd, const HashMap *compilers, ErrorBuffer *ebuf)
+{
+    size_t n = jobs->jobs.count;
+    BUG_ON(n > JOBS_MAX);
+    struct pollfd fds[1 + JOBS_MAX];
+    fds[0] = (struct pollfd){.fd = input_fd, .events = POLLIN};
+    int timeout = -1;
+
+    for (size_t i = 0; i < n; i++) {
+        const Job *job = jobs->jobs.ptrs[i];
+        fds[i + 1] = (struct pollfd){.fd = job->fd, .events = POLLIN};
+        if (job->fd < 0) {
+            // Output closed, but process not yet reaped
+            timeout = REAP_INTERVAL_MS;
+        }
+    }
+
+    if (poll(fds, n + 1, timeout) < 0) {
+        // Usually EINTR (e.g. due to SIGWINCH), which the caller handles
+        return false;
+    }
+
+    // Iterate in reverse, so that jobs can be removed along the way
+    for (size_t i = n; i > 0; i--) {
+        Job *job = jobs->jobs.ptrs[i - 1];
+        if (fds[i].revents) {
+            read_job_output(job, compilers);
+        }
+        if (job->fd >= 0) {
+            continue;
+        }
+        int status = try_wait_child(job->pid);
+        if (status == -EAGAIN) {
+            continue;
+        }
+        report_job_exit(job, status, ebuf);
+        free_job(ptr_array_remove_index(&jobs->jobs, i - 1));
+    }
+
+    return fds[0].revents != 0;
+}
+
+// Send SIGTERM (or SIGKILL, if `force` is true) to the job with the
+// specified ID, or to the most recently started job if `id_str` is NULL.
+// The job is then reaped (and reported) as usual, by job_list_wait().
+// Jobs are started with `drop_ctty` set, so that fork_exec() puts them
+// in a new session and process group (with ID equal to the PID) and
+// thus the whole group can be signalled (e.g. all commands in a shell
+// pipeline).
+bool job_kill(JobList *jobs, ErrorBuffer *ebuf, const char *id_str, bool force)
+{
+    size_t n = jobs->jobs.count;
+    if (n == 0) {
+        return error_msg(ebuf, "No background jobs");
+    }
+
+    const Job *job = jobs->jobs.ptrs[n - 1];
+    if (id_str) {
+        unsigned long id;
+        if (unlikely(!str_to_ulong(id_str, &id))) {
+            return error_msg(ebuf, "Invalid job ID: '%s'", id_str);
+        }
+        for (size_t i = 0; i < n; i++) {
+            job = jobs->jobs.ptrs[i];
+            if (job->id == id) {
+                goto found;
+            }
+        }
+        return error_msg(ebuf, "No such job: %lu", id);
+    }
+
+found:
+    if (unlikely(kill(-job->pid, force ? SIGKILL : SIGTERM) != 0)) {
+        return error_msg_errno(ebuf, "kill");
+    }
+    return true;
+}
+
+// Terminate and free all jobs (without waiting for them to exit)
+void job_list_free(JobList *jobs)
+{
+    for (size_t i = 0, n = jobs->jobs.count; i < n; i++) {
+        Job *job = jobs->jobs.ptrs[i];
+        kill(-job->pid, SIGTERM);
+        free_job(job);
+    }
+    ptr_array_free_array(&jobs->jobs);
+}
+
+String dump_jobs(const JobList *jobs)
+{
+    struct timespec now;
+    if (unlikely(!xgettime(&now))) {
+        now = (struct timespec){0};
+    }
+
+    String buf = string_new(1024);
+    string_append_literal(&buf, "# id      pid  seconds  messages  command\n");
+
+    for (size_t i = 0, n = jobs->jobs.count; i < n; i++) {
+        const Job *job = jobs->jobs.ptrs[i];
+        struct timespec elapsed = timespec_subtract(&now, &job->start);
+        string_sprintf (
+            &buf,
+            "%4lu %8jd %8jd %9zu  %s\n",
+            job->id, (intmax_t)job->pid, (intmax_t)elapsed.tv_sec,
+            job->nr_msgs, job->command
+        );
+    }
+
+    return buf;
+}
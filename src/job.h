@@ -0,0 +1,54 @@
+#ifndef JOB_H
+#define JOB_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <sys/types.h>
+#include <time.h>
+#include "command/error.h"
+#include "msg.h"
+#include "util/hashmap.h"
+#include "util/macros.h"
+#include "util/ptr-array.h"
+#include "util/string.h"
+
+enum {
+    // Maximum number of concurrently running background jobs
+    JOBS_MAX = 16,
+};
+
+// A child process started by `compile -b` or `exec -b`, which runs
+// concurrently with the editor. Its output is read (and, for `compile`,
+// parsed into messages) by job_list_wait(), as it arrives.
+typedef struct {
+    unsigned long id;
+    pid_t pid;
+    int fd; // Read end of the pipe for stdout or stderr (or -1 after EOF)
+    char *command; // Command line (for display purposes)
+    char *compiler; // Name of errorfmt Compiler used to parse output (or NULL)
+    MessageList *msgs; // Destination for parsed messages (if `compiler` is set)
+    size_t nr_msgs; // Number of messages added to `msgs`
+    String output; // Incomplete line of output (or first line, if `compiler` is NULL)
+    struct timespec start;
+} Job;
+
+typedef struct {
+    PointerArray jobs;
+    unsigned long next_id;
+} JobList;
+
+bool job_start (
+    JobList *jobs,
+    ErrorBuffer *ebuf,
+    const char **argv,
+    bool read_stdout,
+    const char *compiler,
+    MessageList *msgs
+) NONNULL_ARG(1, 2, 3);
+
+bool job_list_wait(JobList *jobs, int input_fd, const HashMap *compilers, ErrorBuffer *ebuf) NONNULL_ARGS;
+bool job_kill(JobList *jobs, ErrorBuffer *ebuf, const char *id_str, bool force) NONNULL_ARG(1, 2);
+void job_list_free(JobList *jobs) NONNULL_ARGS;
+String dump_jobs(const JobList *jobs) NONNULL_ARGS;
+
+#endif
@@ -619,11 +619,12 @@ int main(int argc, char *argv[])
         clear_error(&e->err);
     }
 
-    // Enable main_loop() iteration timing if $DTE_LOG_TIMING is set
-    // and logging is enabled. In theory, this could be controlled by
+    // Enable main_loop() iteration timing if $DTE_LOG_TIMING is set.
+    // The timings are shown by `show timing` and also logged, if logging
+    // is enabled. In theory, this could be controlled by
     // `TraceLoggingFlags`, but trace logging is only enabled in debug
     // builds, whereas latency timing is most useful in release builds.
-    bool timing = log_level_enabled(LOG_LEVEL_INFO) && xgetenv("DTE_LOG_TIMING");
+    bool timing = !!xgetenv("DTE_LOG_TIMING");
 
     e->flags &= ~EFLAG_HEADLESS; // See comment for init_editor_state() call above
     main_loop(e, terminal_query_level, timing);
@@ -0,0 +1,195 @@
+#include <inttypes.h>
+#include <stdint.h>
+#include "mem-usage.h"
+#include "block.h"
+#include "buffer.h"
+#include "change.h"
+#include "syntax/syntax.h"
+#include "util/hashmap.h"
+#include "util/hashset.h"
+#include "util/intern.h"
+#include "util/xsnprintf.h"
+
+// A single row of the table produced by dump_memory_usage(). The `used`
+// column is the number of bytes of actual content and `alloc` is the
+// number of bytes allocated to hold it (including `used` and any
+// bookkeeping overhead). The meaning of `count` depends on the category.
+typedef struct {
+    size_t count;
+    uint64_t used;
+    uint64_t alloc;
+} MemoryUsage;
+
+typedef struct {
+    MemoryUsage blocks; // count = Blocks
+    MemoryUsage undo; // count = Changes
+    MemoryUsage line_start_states; // count = lines with a cached State
+} BufferMemoryUsage;
+
+static void add_usage(MemoryUsage *total, const MemoryUsage *u)
+{
+    total->count += u->count;
+    total->used += u->used;
+    total->alloc += u->alloc;
+}
+
+static void append_row(String *buf, const char *scope, const char *category, const MemoryUsage *u)
+{
+    string_sprintf (
+        buf,
+        "%-10s %-18s %9zu %12" PRIu64 " %12" PRIu64 "\n",
+        scope, category, u->count, u->used, u->alloc
+    );
+}
+
+static BufferMemoryUsage get_buffer_usage(const Buffer *buffer)
+{
+    BufferMemoryUsage bu = {.blocks = {.count = 0}};
+
+    const Block *blk;
+    block_for_each(blk, &buffer->blocks) {
+        bu.blocks.count++;
+        bu.blocks.used += blk->size;
+        bu.blocks.alloc += sizeof(*blk) + blk->alloc;
+    }
+
+    // The records and payloads share the same chunks, so only the
+    // payloads are counted as content
+    const UndoArena *arena = &buffer->undo_arena;
+    bu.undo = (MemoryUsage) {
+        .count = arena->nr_changes,
+        .used = arena->live_bytes + arena->heap_bytes,
+        .alloc = undo_memory_usage(arena),
+    };
+
+    const PointerArray *lss = &buffer->line_start_states;
+    bu.line_start_states = (MemoryUsage) {
+        .count = lss->count,
+        .used = lss->count * sizeof(lss->ptrs[0]),
+        .alloc = lss->alloc * sizeof(lss->ptrs[0]),
+    };
+
+    return bu;
+}
+
+static MemoryUsage get_syntax_usage(const HashMap *syntaxes)
+{
+    MemoryUsage u = {
+        .count = syntaxes->count,
+        .used = hashmap_memory_usage(syntaxes),
+    };
+    for (HashMapIter it = hashmap_iter(syntaxes); hashmap_next(&it); ) {
+        u.used += syntax_memory_usage(it.entry->value);
+    }
+    u.alloc = u.used;
+    return u;
+}
+
+static MemoryUsage get_intern_usage(void)
+{
+    const HashSet *set = get_interned_strings();
+    MemoryUsage u = {
+        .count = set->nr_entries,
+        .alloc = hashset_memory_usage(set),
+    };
+    for (HashSetIter it = hashset_iter(set); hashset_next(&it); ) {
+        u.used += it.entry->str_len;
+    }
+    return u;
+}
+
+static MemoryUsage get_history_usage(const History *history)
+{
+    size_t size = history_memory_usage(history);
+    return (MemoryUsage){.count = history->entries.count, .used = size, .alloc = size};
+}
+
+// Produce a table of (approximate) memory usage, for each Buffer and for
+// the editor as a whole. Lines not starting with '#' have exactly 5
+// whitespace-separated fields, so that the output is easy to parse with
+// tools like awk(1). Note that the `block-pool` row is just a different
+// view of the memory counted by the `blocks` rows (when block pooling is
+// enabled) and that `undo-journal` is disk space, not memory, so
+// neither is included in the `total` row (which has a `count` of 0,
+// since the counts of the other rows are of unrelated things).
+String dump_memory_usage(EditorState *e)
+{
+    String buf = string_new(4096);
+    string_append_literal (
+        &buf,
+        "# Memory usage (in bytes)\n"
+        "# scope    category               count         used        alloc\n"
+    );
+
+    BufferMemoryUsage totals = {.blocks = {.count = 0}};
+    char scope[32];
+    for (size_t i = 0, n = e->buffers.count; i < n; i++) {
+        const Buffer *buffer = e->buffers.ptrs[i];
+        BufferMemoryUsage bu = get_buffer_usage(buffer);
+        xsnprintf(scope, sizeof scope, "buffer:%lu", buffer->id);
+        append_row(&buf, scope, "blocks", &bu.blocks);
+        append_row(&buf, scope, "undo", &bu.undo);
+        append_row(&buf, scope, "line-start-states", &bu.line_start_states);
+        add_usage(&totals.blocks, &bu.blocks);
+        add_usage(&totals.undo, &bu.undo);
+        add_usage(&totals.line_start_states, &bu.line_start_states);
+    }
+
+    const BlockPoolStats ps = block_pool_stats();
+    const MemoryUsage block_pool = {
+        .count = ps.nr_objects,
+        .used = ps.object_bytes,
+        .alloc = ps.slab_bytes,
+    };
+
+    const TagFile *tf = &e->tagfile;
+    const MemoryUsage tags = {
+        .count = !!tf->buf,
+        .used = tf->size,
+        .alloc = tf->size,
+    };
+
+    const TagNameIndex *idx = &tf->names;
+    const MemoryUsage tag_names = {
+        .count = idx->count,
+        .used = idx->count * sizeof(idx->names[0]),
+        .alloc = idx->count * sizeof(idx->names[0]),
+    };
+
+    const UndoJournal *journal = &e->undo_journal;
+    const MemoryUsage undo_journal = {
+        .count = (journal->fd >= 0),
+        .used = journal->size,
+        .alloc = journal->size,
+    };
+
+    size_t fh_size = file_history_memory_usage(&e->file_history);
+    const struct {
+        const char *category;
+        MemoryUsage usage;
+    } globals[] = {
+        {"blocks", totals.blocks},
+        {"undo", totals.undo},
+        {"line-start-states", totals.line_start_states},
+        {"syntax", get_syntax_usage(&e->syntaxes)},
+        {"interned-strings", get_intern_usage()},
+        {"command-history", get_history_usage(&e->command_history)},
+        {"search-history", get_history_usage(&e->search_history)},
+        {"file-history", {e->file_history.entries.count, fh_size, fh_size}},
+        {"tag-file", tags},
+        {"tag-names", tag_names},
+    };
+
+    MemoryUsage total = {.count = 0};
+    for (size_t i = 0; i < ARRAYLEN(globals); i++) {
+        const MemoryUsage *u = &globals[i].usage;
+        append_row(&buf, "global", globals[i].category, u);
+        total.used += u->used;
+        total.alloc += u->alloc;
+    }
+
+    append_row(&buf, "global", "block-pool", &block_pool);
+    append_row(&buf, "global", "undo-journal", &undo_journal);
+    append_row(&buf, "global", "total", &total);
+    return buf;
+}
@@ -0,0 +1,10 @@
+#ifndef MEM_USAGE_H
+#define MEM_USAGE_H
+
+#include "editor.h"
+#include "util/macros.h"
+#include "util/string.h"
+
+String dump_memory_usage(EditorState *e) NONNULL_ARGS;
+
+#endif
@@ -9,6 +9,7 @@
 #include "indent.h"
 #include "insert.h"
 #include "terminal/paste.h"
+#include "timing.h"
 #include "util/debug.h"
 #include "util/unicode.h"
 #include "util/xmalloc.h"
@@ -135,7 +136,10 @@ void string_append_def_mode(String *buf, const ModeHandler *mode)
 
 bool handle_input(EditorState *e, KeyCode key)
 {
-    return handle_input_recursive(e, e->mode, key, 0);
+    uint64_t start_time = timing_start();
+    bool r = handle_input_recursive(e, e->mode, key, 0);
+    timing_stop(TIMING_INPUT, start_time);
+    return r;
 }
 
 void collect_modes(const HashMap *modes, PointerArray *a, const char *prefix)
@@ -497,6 +497,7 @@ static const OptionDesc option_desc[] = {
     ENUM_OPT("newline", G(crlf_newlines), newline_enum, NULL),
     BOOL_OPT("optimize-true-color", G(optimize_true_color), redraw_screen),
     BOOL_OPT("overwrite", C(overwrite), overwrite_changed),
+    UINT_OPT("redraw-delay", G(redraw_delay), 0, 100, NULL),
     ENUM_OPT("save-unmodified", C(save_unmodified), save_unmodified_enum, NULL),
     UINT8_OPT("scroll-margin", G(scroll_margin), 0, 100, redraw_screen),
     BOOL_OPT("select-cursor-char", G(select_cursor_char), redraw_screen),
@@ -510,6 +511,8 @@ static const OptionDesc option_desc[] = {
     BOOL_OPT("tab-bar", G(tab_bar), redraw_screen),
     UINT8_OPT("tab-width", C(tab_width), 1, TAB_WIDTH_MAX, redraw_buffer),
     UINT_OPT("text-width", C(text_width), 1, TEXT_WIDTH_MAX, NULL),
+    BOOL_OPT("undo-journal", G(undo_journal), NULL),
+    FSIZE_OPT("undo-memory-limit", G(undo_memory_limit), NULL),
     BOOL_OPT("utf8-bom", G(utf8_bom), NULL),
     ENUM_OPT("window-separator", G(window_separator), window_separator_enum, window_separator_changed),
     FLAG_OPT("ws-error", C(ws_error), ws_error_values, redraw_buffer),
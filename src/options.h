@@ -75,6 +75,7 @@ typedef struct {
     bool set_window_title;
     bool show_line_numbers;
     bool tab_bar;
+    bool undo_journal;
     bool utf8_bom; // Default value for new files
     uint8_t scroll_margin;
     uint8_t crlf_newlines; // Default value for new files
@@ -83,9 +84,11 @@ typedef struct {
     uint8_t msg_compile; // Default EditorState::messages[] index for `compile`
     uint8_t msg_tag; // Default EditorState::messages[] index for `tag`
     unsigned int esc_timeout; // See term_read_input()
+    unsigned int redraw_delay; // See main_loop()
     uint_least64_t filesize_limit; // Size limit imposed by load_buffer()
     uint_least64_t syntax_line_limit; // Line length at which LocalOptions::syntax is disabled
     uint_least64_t syntax_size_limit; // File size at which LocalOptions::syntax is disabled
+    uint_least64_t undo_memory_limit; // Size at which undo history is moved to UndoJournal
     const char *statusline_left;
     const char *statusline_right;
 } GlobalOptions;
@@ -1,17 +1,33 @@
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 #include "regexp.h"
 #include "util/arith.h"
 #include "util/ascii.h"
 #include "util/debug.h"
 #include "util/hashmap.h"
 #include "util/intern.h"
+#include "util/str-util.h"
 #include "util/xmalloc.h"
 #include "util/xstring.h"
 
+enum {
+    // Maximum number of entries kept by regexp_cache_lookup()
+    REGEXP_CACHE_SIZE = 16,
+};
+
+typedef struct {
+    CachedRegexp *entries[REGEXP_CACHE_SIZE]; // Most recently used first
+    size_t count;
+    RegexpCacheStats stats;
+} RegexpCache;
+
 // NOLINTNEXTLINE(*-avoid-non-const-global-variables)
 static HashMap interned_regexps = {.flags = HMAP_BORROWED_KEYS};
 
+// NOLINTNEXTLINE(*-avoid-non-const-global-variables)
+static RegexpCache regexp_cache;
+
 bool regexp_error_msg(ErrorBuffer *ebuf, const regex_t *re, const char *pattern, int err)
 {
     if (!ebuf) {
@@ -117,6 +133,80 @@ char *regexp_escape(const char *pattern, size_t len)
     return buf;
 }
 
+// Return the index just past the end of the bracket expression starting
+// at `pat[i]` (i.e. the index after the opening `[`)
+static size_t skip_bracket_expression(const char *pat, size_t i)
+{
+    i += (pat[i] == '^');
+    i += (pat[i] == ']'); // A leading `]` is literal
+    while (pat[i] && pat[i] != ']') {
+        char ch = pat[i++];
+        if (ch == '[' && (pat[i] == ':' || pat[i] == '.' || pat[i] == '=')) {
+            // Skip "[:class:]", "[.coll.]" and "[=equiv=]" (which may
+            // themselves contain `]`)
+            const char end[] = {pat[i], ']', '\0'};
+            const char *e = strstr(pat + i + 1, end);
+            if (!e) {
+                return i + strlen(pat + i);
+            }
+            i = (size_t)(e - pat) + 2;
+        }
+    }
+    return i + (pat[i] == ']');
+}
+
+// Replace each `\n` escape in `pattern` (outside of bracket expressions,
+// where backslash isn't special) with a literal newline, in place, and
+// return the total number of newlines in the result
+size_t regexp_expand_newline_escapes(char *pattern)
+{
+    size_t o = 0;
+    for (size_t i = 0; pattern[i]; ) {
+        char ch = pattern[i++];
+        if (ch == '[') {
+            size_t end = skip_bracket_expression(pattern, i);
+            pattern[o++] = ch;
+            memmove(pattern + o, pattern + i, end - i);
+            o += end - i;
+            i = end;
+            continue;
+        }
+        if (ch == '\\' && pattern[i] != '\0') {
+            if (pattern[i] == 'n') {
+                ch = '\n';
+                i++;
+            } else {
+                // Copy other escapes as-is (e.g. `\\n` remains a literal
+                // backslash followed by `n`)
+                pattern[o++] = ch;
+                ch = pattern[i++];
+            }
+        }
+        pattern[o++] = ch;
+    }
+    pattern[o] = '\0';
+    return count_nl(pattern, o);
+}
+
+// Like regexp_compile(), but with `\n` escapes in `pattern` expanded by
+// regexp_expand_newline_escapes() and with `flags` passed to regcomp(3)
+// as-is. The maximum number of lines that a match can span (1 plus the
+// number of newlines in the pattern) is stored in `*nr_lines`, for use
+// with block_iter_get_lines().
+bool regexp_compile_multiline (
+    ErrorBuffer *ebuf,
+    regex_t *re,
+    const char *pattern,
+    int flags,
+    size_t *nr_lines
+) {
+    char *expanded = xstrdup(pattern);
+    *nr_lines = regexp_expand_newline_escapes(expanded) + 1;
+    int err = regcomp(re, expanded, flags);
+    free(expanded);
+    return !err || regexp_error_msg(ebuf, re, pattern, err);
+}
+
 size_t string_append_escaped_regex(String *s, StringView pattern)
 {
     size_t bufsize = xmul(2, pattern.length) + 1;
@@ -171,3 +261,103 @@ void free_interned_regexps(void)
     BUG_ON(!(interned_regexps.flags & HMAP_BORROWED_KEYS));
     hashmap_free(&interned_regexps, FREE_FUNC(free_interned_regexp));
 }
+
+static void free_cached_regexp(CachedRegexp *cr)
+{
+    regfree(&cr->re);
+    free(cr->pattern);
+    free(cr);
+}
+
+// Find or compile (with regexp_compile_multiline()) the regex for
+// `pattern` and `flags`. Unlike regexp_intern(), the number of cached
+// entries is bounded (with the least recently used entry being evicted
+// when full), so this is suitable for patterns given by the user (e.g.
+// via the `search` and `replace` commands), where repeatedly searching
+// for the same pattern is common but the number of distinct patterns
+// is unbounded. The returned pointer is only valid until the next call
+// to this function.
+const CachedRegexp *regexp_cache_lookup(ErrorBuffer *ebuf, const char *pattern, int flags)
+{
+    RegexpCache *cache = &regexp_cache;
+    CachedRegexp **entries = cache->entries;
+
+    for (size_t i = 0, n = cache->count; i < n; i++) {
+        CachedRegexp *cr = entries[i];
+        if (cr->flags == flags && streq(cr->pattern, pattern)) {
+            // Move to front
+            memmove(entries + 1, entries, i * sizeof(entries[0]));
+            entries[0] = cr;
+            cache->stats.hits++;
+            return cr;
+        }
+    }
+
+    cache->stats.misses++;
+    CachedRegexp *cr = xmalloc(sizeof(*cr));
+    if (!regexp_compile_multiline(ebuf, &cr->re, pattern, flags, &cr->nr_lines)) {
+        free(cr);
+        return NULL;
+    }
+
+    cr->pattern = xstrdup(pattern);
+    cr->flags = flags;
+
+    if (cache->count == ARRAYLEN(cache->entries)) {
+        free_cached_regexp(entries[--cache->count]);
+        cache->stats.evictions++;
+    }
+
+    memmove(entries + 1, entries, cache->count * sizeof(entries[0]));
+    entries[0] = cr;
+    cache->count++;
+    return cr;
+}
+
+RegexpCacheStats regexp_cache_get_stats(void)
+{
+    return regexp_cache.stats;
+}
+
+String dump_regexp_cache(void)
+{
+    const RegexpCache *cache = &regexp_cache;
+    const RegexpCacheStats *stats = &cache->stats;
+    String buf = string_new(512);
+
+    string_sprintf (
+        &buf,
+        "%s %zu/%zu\n%s %zu\n%s %zu\n%s %zu\n",
+        "  Entries:", cache->count, ARRAYLEN(cache->entries),
+        "     Hits:", stats->hits,
+        "   Misses:", stats->misses,
+        "Evictions:", stats->evictions
+    );
+
+    if (cache->count == 0) {
+        return buf;
+    }
+
+    string_append_literal(&buf, "\nPatterns (most recently used first):\n");
+    for (size_t i = 0, n = cache->count; i < n; i++) {
+        const CachedRegexp *cr = cache->entries[i];
+        string_sprintf (
+            &buf,
+            "  %-5s %-5s %s\n",
+            (cr->flags & REG_EXTENDED) ? "ERE" : "BRE",
+            (cr->flags & REG_ICASE) ? "icase" : "-",
+            cr->pattern
+        );
+    }
+
+    return buf;
+}
+
+void free_cached_regexps(void)
+{
+    RegexpCache *cache = &regexp_cache;
+    for (size_t i = 0, n = cache->count; i < n; i++) {
+        free_cached_regexp(cache->entries[i]);
+    }
+    *cache = (RegexpCache){.count = 0};
+}
@@ -43,6 +43,20 @@ typedef struct {
     regex_t re; // regex(3) object, compiled with regcomp(3)
 } InternedRegexp;
 
+// An entry in the cache used by regexp_cache_lookup()
+typedef struct {
+    char *pattern; // Pattern string (before regexp_expand_newline_escapes())
+    int flags; // Flags passed to regcomp(3)
+    size_t nr_lines; // See regexp_compile_multiline()
+    regex_t re;
+} CachedRegexp;
+
+typedef struct {
+    size_t hits;
+    size_t misses;
+    size_t evictions;
+} RegexpCacheStats;
+
 // Platform-specific patterns for matching word boundaries, as detected
 // and initialized by regexp_get_word_boundary_tokens()
 typedef struct {
@@ -56,11 +70,18 @@ RegexpWordBoundaryTokens regexp_get_word_boundary_tokens(void);
 bool regexp_error_msg(ErrorBuffer *ebuf, const regex_t *re, const char *pattern, int err) NONNULL_ARG(2, 3);
 char *regexp_escape(const char *pattern, size_t len) NONNULL_ARGS WARN_UNUSED_RESULT;
 size_t string_append_escaped_regex(String *s, StringView pattern) NONNULL_ARGS;
+size_t regexp_expand_newline_escapes(char *pattern) NONNULL_ARGS;
+bool regexp_compile_multiline(ErrorBuffer *ebuf, regex_t *re, const char *pattern, int flags, size_t *nr_lines) NONNULL_ARG(2, 3, 5) WARN_UNUSED_RESULT;
 
 const InternedRegexp *regexp_intern(ErrorBuffer *ebuf, const char *pattern) NONNULL_ARG(2) WARN_UNUSED_RESULT;
 bool regexp_is_interned(const char *pattern) NONNULL_ARGS;
 void free_interned_regexps(void);
 
+const CachedRegexp *regexp_cache_lookup(ErrorBuffer *ebuf, const char *pattern, int flags) NONNULL_ARG(2) WARN_UNUSED_RESULT;
+RegexpCacheStats regexp_cache_get_stats(void);
+String dump_regexp_cache(void);
+void free_cached_regexps(void);
+
 WARN_UNUSED_RESULT NONNULL_ARG(1, 2) NONNULL_ARG_IF_NONZERO_LENGTH(5, 4)
 bool regexp_exec (
     const regex_t *re,
@@ -1,4 +1,5 @@
 #include <stdlib.h>
+#include <string.h>
 #include "replace.h"
 #include "buffer.h"
 #include "change.h"
@@ -28,7 +29,7 @@ static void build_replacement (
             }
             ch = format[i++];
             if (ch < '1' || ch > '9') {
-                string_append_byte(buf, ch);
+                string_append_byte(buf, (ch == 'n') ? '\n' : ch);
                 continue;
             }
             match_idx = ch - '0';
@@ -53,14 +54,22 @@ static void build_replacement (
  * -------------------------------------------
  * "foo abc bar abc baz" "foo abc bar abc baz"
  * "foo x bar abc baz"   " bar abc baz"
+ *
+ * For patterns that can span multiple lines, `line` also includes the
+ * lookahead lines returned by block_iter_get_lines(), but only matches
+ * that start within the first `line_len` bytes are replaced. The offset
+ * (relative to `line`) of the end of the last match is stored in `*endp`.
  */
 static unsigned int replace_on_line (
     EditorState *e,
     StringView line,
-    regex_t *re,
+    size_t line_len,
+    const regex_t *re,
     const char *format,
     BlockIter *bi,
-    ReplaceFlags *flagsp
+    ReplaceFlags *flagsp,
+    int eflags,
+    size_t *endp
 ) {
     if (!line.data) {
         BUG_ON(line.length);
@@ -73,7 +82,7 @@ static unsigned int replace_on_line (
     ReplaceFlags flags = *flagsp;
     regmatch_t matches[32];
     size_t pos = 0;
-    int eflags = 0;
+    size_t end = 0;
     unsigned int nr = 0;
 
     while (regexp_exec (
@@ -84,6 +93,11 @@ static unsigned int replace_on_line (
         matches,
         eflags
     )) {
+        if (pos + matches[0].rm_so > line_len) {
+            // Match starts on a later line
+            break;
+        }
+
         regoff_t match_len = matches[0].rm_eo - matches[0].rm_so;
         bool skip = false;
 
@@ -141,6 +155,7 @@ static unsigned int replace_on_line (
             string_free(&b);
         }
         *bi = view->cursor;
+        end = pos + matches[0].rm_so + match_len;
 
         if (!match_len) {
             break;
@@ -158,6 +173,7 @@ static unsigned int replace_on_line (
 
 out:
     free(alloc);
+    *endp = end;
     return nr;
 }
 
@@ -172,12 +188,14 @@ bool reg_replace(EditorState *e, const char *pattern, const char *format, Replac
     re_flags |= (flags & REPLACE_IGNORE_CASE) ? REG_ICASE : 0;
     re_flags |= (flags & REPLACE_BASIC) ? 0 : DEFAULT_REGEX_FLAGS;
 
-    regex_t re;
-    int err = regcomp(&re, pattern, re_flags);
-    if (unlikely(err)) {
-        return regexp_error_msg(ebuf, &re, pattern, err);
+    const CachedRegexp *cr = regexp_cache_lookup(ebuf, pattern, re_flags);
+    if (unlikely(!cr)) {
+        return false;
     }
 
+    const regex_t *re = &cr->re;
+    const size_t nr_lines = cr->nr_lines;
+
     View *view = e->view;
     size_t nr_bytes = 0;
     BlockIter bi;
@@ -204,46 +222,67 @@ bool reg_replace(EditorState *e, const char *pattern, const char *format, Replac
         begin_change_chain();
     }
 
+    String buf = STRING_INIT;
     unsigned int nr_substitutions = 0;
-    size_t nr_lines = 0;
+    size_t nr_lines_replaced = 0;
+    int eflags = 0;
     while (1) {
-        StringView line = block_iter_get_line(&bi);
+        StringView text = block_iter_get_lines(&bi, nr_lines, &buf);
+        const char *nl = (nr_lines > 1) ? memchr(text.data, '\n', text.length) : NULL;
 
         // Number of bytes to process
-        size_t count = line.length;
-        if (line.length > nr_bytes) {
+        size_t count = nl ? (size_t)(nl - text.data) : text.length;
+        if (text.length > nr_bytes) {
             // End of selection is not full line
-            line.length = nr_bytes;
+            text.length = nr_bytes;
         }
 
-        unsigned int nr = replace_on_line(e, line, &re, format, &bi, &flags);
+        size_t end;
+        size_t line_len = MIN(count, text.length);
+        unsigned int nr = replace_on_line(e, text, line_len, re, format, &bi, &flags, eflags, &end);
         if (nr) {
             nr_substitutions += nr;
-            nr_lines++;
+            nr_lines_replaced++;
         }
 
-        if (flags & REPLACE_CANCEL || count + 1 >= nr_bytes) {
+        if (flags & REPLACE_CANCEL) {
+            break;
+        }
+
+        if (end > count) {
+            // The last match spanned multiple lines, so continue from
+            // the end of it (which may be in the middle of a line)
+            if (end >= nr_bytes) {
+                break;
+            }
+            nr_bytes -= end;
+            eflags = block_iter_is_bol(&bi) ? 0 : REG_NOTBOL;
+            continue;
+        }
+
+        if (count + 1 >= nr_bytes) {
             break;
         }
 
         nr_bytes -= count + 1;
+        eflags = 0;
         block_iter_next_line(&bi);
     }
 
+    string_free(&buf);
+
     if (!(flags & REPLACE_CONFIRM)) {
         end_change_chain(view);
     }
 
-    regfree(&re);
-
     if (nr_substitutions) {
         info_msg (
             ebuf,
             "%u substitution%s on %zu line%s",
             nr_substitutions,
             (nr_substitutions > 1) ? "s" : "",
-            nr_lines,
-            (nr_lines > 1) ? "s" : ""
+            nr_lines_replaced,
+            (nr_lines_replaced > 1) ? "s" : ""
         );
     } else if (!(flags & REPLACE_CANCEL)) {
         error_msg(ebuf, "Pattern '%s' not found", pattern);
@@ -1,60 +1,75 @@
 #include <stdlib.h>
+#include <string.h>
 #include "search.h"
 #include "block-iter.h"
 #include "buffer.h"
 #include "editor.h"
 #include "regexp.h"
 #include "util/ascii.h"
+#include "util/string.h"
 #include "util/xmalloc.h"
 #include "window.h"
 
-// Recurses at most once
-// NOLINTNEXTLINE(misc-no-recursion)
-static bool do_search_fwd(View *view, regex_t *regex, BlockIter *bi, bool skip)
+// Search forwards from `bi` for a match of `regex`, which can span at
+// most `nr_lines` lines. Each iteration looks at the text starting from
+// the current line and extending `nr_lines - 1` lines beyond it, but
+// only accepts matches that start on the current line, so that matches
+// are always found in order and never truncated by the lookahead.
+static bool do_search_fwd(View *view, const regex_t *regex, size_t nr_lines, BlockIter *bi, bool skip)
 {
+    String buf = STRING_INIT;
     int flags = block_iter_is_bol(bi) ? 0 : REG_NOTBOL;
+    bool found = false;
 
-    do {
-        if (block_iter_is_eof(bi)) {
-            return false;
-        }
-
+    while (!block_iter_is_eof(bi)) {
         regmatch_t match;
-        StringView line = block_iter_get_line(bi);
-
-        // NOTE: If this is the first iteration then `line.data` contains
-        // a partial line (text starting from the cursor position) and if
-        // `match.rm_so` is 0 then the match is at the beginning of the
-        // text, which is the same as the cursor position.
-        if (regexp_exec(regex, line.data, line.length, 1, &match, flags)) {
+        StringView text = block_iter_get_lines(bi, nr_lines, &buf);
+
+        // NOTE: If this is the first iteration then `text.data` starts
+        // with a partial line (text starting from the cursor position)
+        // and if `match.rm_so` is 0 then the match is at the beginning
+        // of the text, which is the same as the cursor position.
+        if (
+            regexp_exec(regex, text.data, text.length, 1, &match, flags)
+            && (nr_lines == 1 || !memchr(text.data, '\n', match.rm_so))
+        ) {
             if (skip && match.rm_so == 0) {
                 // Ignore match at current cursor position
                 regoff_t count = match.rm_eo;
                 if (count == 0) {
                     // It is safe to skip one byte because every line
-                    // has one extra byte (newline) that is not in line.data
+                    // has one extra byte (newline) that is not in text.data
                     count = 1;
                 }
                 block_iter_skip_bytes(bi, (size_t)count);
-                return do_search_fwd(view, regex, bi, false);
+                flags = block_iter_is_bol(bi) ? 0 : REG_NOTBOL;
+                skip = false;
+                continue;
             }
 
             block_iter_skip_bytes(bi, match.rm_so);
             view->cursor = *bi;
             view->center_on_scroll = true;
             view_reset_preferred_x(view);
-            return true;
+            found = true;
+            break;
         }
 
         skip = false; // Not at cursor position any more
         flags = 0;
-    } while (block_iter_next_line(bi));
+        if (!block_iter_next_line(bi)) {
+            break;
+        }
+    }
 
-    return false;
+    string_free(&buf);
+    return found;
 }
 
-static bool do_search_bwd(View *view, regex_t *regex, BlockIter *bi, ssize_t cx, bool skip)
+static bool do_search_bwd(View *view, const regex_t *regex, size_t nr_lines, BlockIter *bi, ssize_t cx, bool skip)
 {
+    String buf = STRING_INIT;
+    bool found = false;
     if (block_iter_is_eof(bi)) {
         goto next;
     }
@@ -64,13 +79,19 @@ static bool do_search_bwd(View *view, regex_t *regex, BlockIter *bi, ssize_t cx,
         int flags = 0;
         regoff_t offset = -1;
         regoff_t pos = 0;
-        StringView line = block_iter_get_line(bi);
+        StringView text = block_iter_get_lines(bi, nr_lines, &buf);
+        const char *nl = (nr_lines > 1) ? memchr(text.data, '\n', text.length) : NULL;
+        regoff_t line_len = nl ? (regoff_t)(nl - text.data) : (regoff_t)text.length;
 
         while (
-            pos <= line.length
-            && regexp_exec(regex, line.data + pos, line.length - pos, 1, &match, flags)
+            pos <= line_len
+            && regexp_exec(regex, text.data + pos, text.length - pos, 1, &match, flags)
         ) {
             flags = REG_NOTBOL;
+            if (pos + match.rm_so > line_len) {
+                // Match starts on a later line
+                break;
+            }
             if (cx >= 0) {
                 if (pos + match.rm_so >= cx) {
                     // Ignore match at or after cursor
@@ -97,31 +118,29 @@ static bool do_search_bwd(View *view, regex_t *regex, BlockIter *bi, ssize_t cx,
             view->cursor = *bi;
             view->center_on_scroll = true;
             view_reset_preferred_x(view);
-            return true;
+            found = true;
+            break;
         }
 
         next:
         cx = -1;
     } while (block_iter_prev_line(bi));
 
-    return false;
+    string_free(&buf);
+    return found;
 }
 
 bool search_tag(View *view, ErrorBuffer *ebuf, const char *pattern)
 {
     // DEFAULT_REGEX_FLAGS is not used here because pattern has been
     // escaped by parse_ex_pattern() for use as a POSIX BRE
-    regex_t regex;
-    int err = regcomp(&regex, pattern, REG_NEWLINE);
-    if (unlikely(err)) {
-        regexp_error_msg(ebuf, &regex, pattern, err);
+    const CachedRegexp *cr = regexp_cache_lookup(ebuf, pattern, REG_NEWLINE);
+    if (unlikely(!cr)) {
+        return false;
     }
 
     BlockIter bi = block_iter(view->buffer);
-    bool found = do_search_fwd(view, &regex, &bi, false);
-    regfree(&regex);
-
-    if (!found) {
+    if (!do_search_fwd(view, &cr->re, cr->nr_lines, &bi, false)) {
         // Don't center view to cursor unnecessarily
         view->force_center = false;
         return error_msg(ebuf, "Tag not found");
@@ -136,35 +155,16 @@ static bool has_upper(const char *str)
     return strview_contains_char_type(strview(str), ASCII_UPPER);
 }
 
-static bool update_regex(SearchState *search, ErrorBuffer *ebuf, SearchCaseSensitivity cs)
+static const CachedRegexp *get_regex(const SearchState *search, ErrorBuffer *ebuf, SearchCaseSensitivity cs)
 {
     const char *pattern = search->pattern;
     bool icase = (cs == CSS_FALSE) || (cs == CSS_AUTO && !has_upper(pattern));
-    int flags = REG_NEWLINE | (icase ? REG_ICASE : 0);
-    if (flags == search->re_flags) {
-        return true;
-    }
-
-    if (search->re_flags) {
-        regfree(&search->regex);
-        search->re_flags = 0;
-    }
-
-    if (regexp_compile(ebuf, &search->regex, pattern, flags)) {
-        search->re_flags = flags;
-        return true;
-    }
-
-    regfree(&search->regex);
-    return false;
+    int flags = DEFAULT_REGEX_FLAGS | REG_NEWLINE | (icase ? REG_ICASE : 0);
+    return regexp_cache_lookup(ebuf, pattern, flags);
 }
 
 void search_free_regexp(SearchState *search)
 {
-    if (search->re_flags) {
-        regfree(&search->regex);
-        search->re_flags = 0;
-    }
     free(search->pattern);
 }
 
@@ -179,27 +179,29 @@ bool do_search_next(View *view, SearchState *search, ErrorBuffer *ebuf, SearchCa
     if (!search->pattern) {
         return error_msg(ebuf, "No previous search pattern");
     }
-    if (!update_regex(search, ebuf, cs)) {
+    const CachedRegexp *cr = get_regex(search, ebuf, cs);
+    if (!cr) {
         return false;
     }
 
     BlockIter bi = view->cursor;
-    regex_t *regex = &search->regex;
+    const regex_t *regex = &cr->re;
+    size_t nr_lines = cr->nr_lines;
     if (!search->reverse) {
-        if (do_search_fwd(view, regex, &bi, true)) {
+        if (do_search_fwd(view, regex, nr_lines, &bi, true)) {
             return true;
         }
         block_iter_bof(&bi);
-        if (do_search_fwd(view, regex, &bi, false)) {
+        if (do_search_fwd(view, regex, nr_lines, &bi, false)) {
             return info_msg(ebuf, "Continuing at top");
         }
     } else {
         size_t cursor_x = block_iter_bol(&bi);
-        if (do_search_bwd(view, regex, &bi, cursor_x, skip)) {
+        if (do_search_bwd(view, regex, nr_lines, &bi, cursor_x, skip)) {
             return true;
         }
         block_iter_eof(&bi);
-        if (do_search_bwd(view, regex, &bi, -1, false)) {
+        if (do_search_bwd(view, regex, nr_lines, &bi, -1, false)) {
             return info_msg(ebuf, "Continuing at bottom");
         }
     }
@@ -1,7 +1,6 @@
 #ifndef SEARCH_H
 #define SEARCH_H
 
-#include <regex.h>
 #include <stdbool.h>
 #include "command/error.h"
 #include "util/macros.h"
@@ -14,9 +13,7 @@ typedef enum {
 } SearchCaseSensitivity;
 
 typedef struct {
-    regex_t regex;
-    char *pattern;
-    int re_flags; // If zero, regex hasn't been compiled
+    char *pattern; // Compiled on demand, by regexp_cache_lookup()
     bool reverse;
 } SearchState;
 
@@ -18,12 +18,16 @@
 #include "file-option.h"
 #include "filetype.h"
 #include "frame.h"
+#include "job.h"
+#include "mem-usage.h"
 #include "mode.h"
 #include "msg.h"
 #include "options.h"
+#include "regexp.h"
 #include "syntax/color.h"
 #include "tag.h"
 #include "terminal/cursor.h"
+#include "timing.h"
 #include "terminal/key.h"
 #include "terminal/style.h"
 #include "util/array.h"
@@ -598,11 +602,14 @@ static String do_dump_builtin_configs(EditorState* UNUSED_ARG(e)) {return dump_b
 static String do_dump_hl_styles(EditorState *e) {return dump_hl_styles(&e->styles);}
 static String do_dump_filetypes(EditorState *e) {return dump_filetypes(&e->filetypes);}
 static String do_dump_messages_a(EditorState *e) {return dump_messages(&e->messages[0]);}
+static String do_dump_jobs(EditorState *e) {return dump_jobs(&e->jobs);}
 static String do_dump_macro(EditorState *e) {return dump_macro(&e->macro);}
 static String do_dump_buffer(EditorState *e) {return dump_buffer(e->view);}
 static String do_dump_tags(EditorState *e) {return dump_tags(&e->tagfile, &e->err);}
 static String dump_command_history(EditorState *e) {return history_dump(&e->command_history);}
+static String do_dump_regexp_cache(EditorState* UNUSED_ARG(e)) {return dump_regexp_cache();}
 static String dump_search_history(EditorState *e) {return history_dump(&e->search_history);}
+static String do_dump_timing(EditorState* UNUSED_ARG(e)) {return dump_timing();}
 static String dump_file_history(EditorState *e) {return file_history_dump(&e->file_history);}
 static String dump_show_subcmds(EditorState *e); // Forward declaration
 
@@ -620,16 +627,20 @@ static const ShowHandler show_handlers[] = {
     {"ft", DTERC, do_dump_filetypes, NULL, NULL},
     {"hi", DTERC, do_dump_hl_styles, show_color, collect_hl_styles},
     {"include", 0, do_dump_builtin_configs, show_builtin, do_collect_builtin_includes},
+    {"jobs", 0, do_dump_jobs, NULL, NULL},
     {"macro", DTERC, do_dump_macro, NULL, NULL},
+    {"memory", 0, dump_memory_usage, NULL, NULL},
     {"msg", MSGLINE, do_dump_messages_a, show_msg, collect_show_msg_args},
     {"open", LASTLINE, dump_file_history, NULL, NULL},
     {"option", DTERC, dump_options_and_fileopts, show_option, collect_all_options},
     {"paste", 0, dump_paste, NULL, NULL},
+    {"regex", 0, do_dump_regexp_cache, NULL, NULL},
     {"search", LASTLINE, dump_search_history, NULL, NULL},
     {"set", DTERC, do_dump_options, show_option, collect_all_options},
     {"setenv", DTERC, dump_setenv, show_env, do_collect_env},
     {"show", DTERC, dump_show_subcmds, NULL, NULL},
     {"tag", 0, do_dump_tags, NULL, NULL},
+    {"timing", 0, do_dump_timing, NULL, NULL},
     {"wsplit", 0, dump_frames, show_wsplit, NULL},
 };
 
@@ -56,6 +56,7 @@ ExitCode showkey_loop(unsigned int terminal_query_level)
 
     term_restore_private_modes(&term);
     term_output_flush(obuf);
+    term_output_free(obuf);
     term_cooked();
     return EC_OK;
 }
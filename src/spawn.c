@@ -3,6 +3,7 @@
 #include <stddef.h>
 #include <stdio.h>
 #include <string.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #include "spawn.h"
 #include "command/error.h"
@@ -21,9 +22,22 @@ enum {
     IN = STDIN_FILENO,
     OUT = STDOUT_FILENO,
     ERR = STDERR_FILENO,
+    // Maximum number of parts written by a single writev(3) call
+    // (POSIX only guarantees that _XOPEN_IOV_MAX, i.e. 16, is allowed)
+    MAX_WRITEV_PARTS = 16,
 };
 
-static void handle_error_msg (
+// The remaining (unwritten) parts of SpawnContext::input_parts
+typedef struct {
+    const StringView *parts;
+    size_t nr_parts;
+    size_t idx; // Index of the part to be written next
+    size_t offset; // Number of bytes of `parts[idx]` already written
+} PipeInput;
+
+// Parse a single line of `compile` output, according to the ErrorFormat
+// patterns of `c`, and add the resulting Message (if any) to `msgs`
+void handle_error_msg (
     const Compiler *c,
     MessageList *msgs,
     char *str,
@@ -114,6 +128,68 @@ static void read_errors(const Compiler *c, MessageList *msgs, int fd, bool quiet
     fclose(f);
 }
 
+static bool pipe_input_done(PipeInput *in)
+{
+    // Skip over any parts that are fully written (or empty)
+    while (in->idx < in->nr_parts && in->offset == in->parts[in->idx].length) {
+        in->idx++;
+        in->offset = 0;
+    }
+    return in->idx == in->nr_parts;
+}
+
+// Write as much of the remaining input as the pipe will accept, directly
+// from the memory referred to by each part (i.e. without first copying
+// them into a contiguous buffer)
+static ssize_t pipe_input_write(int fd, PipeInput *in)
+{
+    struct iovec iov[MAX_WRITEV_PARTS];
+    size_t n = 0;
+    for (size_t i = in->idx; i < in->nr_parts && n < ARRAYLEN(iov); i++) {
+        size_t skip = (i == in->idx) ? in->offset : 0;
+        StringView part = in->parts[i];
+        iov[n++] = (struct iovec) {
+            .iov_base = (char*)part.data + skip,
+            .iov_len = part.length - skip,
+        };
+    }
+
+    ssize_t rc = xwritev(fd, iov, (int)n);
+    for (size_t written = MAX(rc, 0); written > 0; ) {
+        BUG_ON(in->idx >= in->nr_parts);
+        size_t avail = in->parts[in->idx].length - in->offset;
+        if (written < avail) {
+            in->offset += written;
+            break;
+        }
+        written -= avail;
+        in->idx++;
+        in->offset = 0;
+    }
+
+    return rc;
+}
+
+// Read from the stdout (i=0) or stderr (i=1) pipe, appending directly
+// to the corresponding SpawnContext::outputs (or ::output_blocks) space
+static ssize_t read_output(int fd, SpawnContext *ctx, size_t i)
+{
+    BlockList *bl = ctx->output_blocks;
+    if (i == 0 && bl) {
+        size_t avail;
+        char *buf = block_list_reserve_space(bl, 4096, &avail);
+        ssize_t rc = xread(fd, buf, avail);
+        block_list_commit(bl, MAX(rc, 0));
+        return rc;
+    }
+
+    String *output = &ctx->outputs[i];
+    char *buf = string_reserve_space(output, 4096);
+    ssize_t rc = xread(fd, buf, output->alloc - output->len);
+    output->len += MAX(rc, 0);
+    return rc;
+}
+
 static void handle_piped_data(int f[3], SpawnContext *ctx)
 {
     BUG_ON(f[IN] < 0 && f[OUT] < 0 && f[ERR] < 0);
@@ -121,7 +197,12 @@ static void handle_piped_data(int f[3], SpawnContext *ctx)
     BUG_ON(IS_STD_FD(f[OUT]));
     BUG_ON(IS_STD_FD(f[ERR]));
 
-    if (ctx->input.length == 0) {
+    PipeInput in = {
+        .parts = ctx->input_parts ? ctx->input_parts : &ctx->input,
+        .nr_parts = ctx->input_parts ? ctx->nr_input_parts : 1,
+    };
+
+    if (pipe_input_done(&in)) {
         xclose(f[IN]);
         f[IN] = -1;
         if (f[OUT] < 0 && f[ERR] < 0) {
@@ -135,7 +216,6 @@ static void handle_piped_data(int f[3], SpawnContext *ctx)
         {.fd = f[ERR], .events = POLLIN},
     };
 
-    size_t wlen = 0;
     while (1) {
         if (unlikely(poll(fds, ARRAYLEN(fds), -1) < 0)) {
             if (errno == EINTR) {
@@ -148,9 +228,7 @@ static void handle_piped_data(int f[3], SpawnContext *ctx)
         for (size_t i = 0; i < ARRAYLEN(ctx->outputs); i++) {
             struct pollfd *pfd = fds + i + 1;
             if (pfd->revents & POLLIN) {
-                String *output = &ctx->outputs[i];
-                char *buf = string_reserve_space(output, 4096);
-                ssize_t rc = xread(pfd->fd, buf, output->alloc - output->len);
+                ssize_t rc = read_output(pfd->fd, ctx, i);
                 if (unlikely(rc < 0)) {
                     error_msg_errno(ctx->ebuf, "read");
                     return;
@@ -161,20 +239,17 @@ static void handle_piped_data(int f[3], SpawnContext *ctx)
                         return;
                     }
                     pfd->fd = -1;
-                    continue;
                 }
-                output->len += rc;
             }
         }
 
         if (fds[IN].revents & POLLOUT) {
-            ssize_t rc = xwrite(fds[IN].fd, ctx->input.data + wlen, ctx->input.length - wlen);
+            ssize_t rc = pipe_input_write(fds[IN].fd, &in);
             if (unlikely(rc < 0)) {
-                error_msg_errno(ctx->ebuf, "write");
+                error_msg_errno(ctx->ebuf, "writev");
                 return;
             }
-            wlen += (size_t) rc;
-            if (wlen == ctx->input.length) {
+            if (pipe_input_done(&in)) {
                 if (xclose(fds[IN].fd)) {
                     error_msg_errno(ctx->ebuf, "close");
                     return;
@@ -303,6 +378,57 @@ bool spawn_compiler(SpawnContext *ctx, const Compiler *c, MessageList *msgs, boo
     return (pid != -1);
 }
 
+// Spawn a child process without waiting for it to exit (i.e. for running
+// as a background job). Stdin and either stderr or stdout (depending on
+// `read_stdout`) are redirected to /dev/null and the other is redirected
+// to a non-blocking pipe, the read end of which is returned in `*fdp`.
+pid_t spawn_background(SpawnContext *ctx, bool read_stdout, int *fdp)
+{
+    BUG_ON(!ctx->argv);
+    BUG_ON(!ctx->argv[0]);
+
+    int dev_null = open_dev_null(ctx->ebuf, O_RDWR);
+    if (dev_null < 0) {
+        return -1;
+    }
+
+    int p[2];
+    if (!open_pipe(ctx->ebuf, p)) {
+        xclose(dev_null);
+        return -1;
+    }
+
+    int fd[3] = {
+        [IN] = dev_null,
+        [OUT] = read_stdout ? p[1] : dev_null,
+        [ERR] = read_stdout ? dev_null : p[1],
+    };
+
+    pid_t pid = -1;
+    if (unlikely(!fd_set_nonblock(p[0], true))) {
+        error_msg_errno(ctx->ebuf, "fcntl");
+        goto out;
+    }
+
+    // Note that the controlling terminal is always dropped here, since
+    // the child runs concurrently with the editor's use of it. This also
+    // puts the child in a new process group (see job_kill()).
+    pid = fork_exec(ctx->argv, fd, ctx->lines, ctx->columns, true);
+    if (pid == -1) {
+        exec_error(ctx);
+    }
+
+out:
+    xclose(p[1]);
+    xclose(dev_null);
+    if (pid == -1) {
+        xclose(p[0]);
+    } else {
+        *fdp = p[0];
+    }
+    return pid;
+}
+
 // Close each fd only if valid (positive) and not stdin/stdout/stderr
 static void safe_xclose_all(int fds[], size_t nr_fds)
 {
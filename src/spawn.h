@@ -2,6 +2,8 @@
 #define SPAWN_H
 
 #include <stdbool.h>
+#include <sys/types.h>
+#include "block.h"
 #include "compiler.h"
 #include "msg.h"
 #include "util/macros.h"
@@ -16,8 +18,11 @@ typedef enum {
 
 typedef struct {
     const char **argv;
-    StringView input;
+    StringView input; // Data written to stdin (if `input_parts` is NULL)
+    const StringView *input_parts; // Data written to stdin, in `nr_input_parts` parts
+    size_t nr_input_parts;
     String outputs[2]; // For stdout/stderr
+    BlockList *output_blocks; // For stdout, instead of `outputs[0]` (if non-NULL)
     SpawnAction actions[3];
     ErrorBuffer *ebuf;
     unsigned int lines;
@@ -27,5 +32,7 @@ typedef struct {
 
 int spawn(SpawnContext *ctx) NONNULL_ARGS WARN_UNUSED_RESULT;
 bool spawn_compiler(SpawnContext *ctx, const Compiler *c, MessageList *msgs, bool read_stdout) NONNULL_ARGS WARN_UNUSED_RESULT;
+pid_t spawn_background(SpawnContext *ctx, bool read_stdout, int *fdp) NONNULL_ARGS WARN_UNUSED_RESULT;
+void handle_error_msg(const Compiler *c, MessageList *msgs, char *str, size_t str_len) NONNULL_ARGS;
 
 #endif
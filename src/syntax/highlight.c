@@ -395,6 +395,14 @@ const TermStyle **hl_line (
     return styles;
 }
 
+// Called after changes spread over many lines (see do_replace_ranges()),
+// to discard the start states of every line after `first`
+void hl_truncate(PointerArray *line_start_states, size_t first)
+{
+    PointerArray *s = line_start_states;
+    s->count = MIN(s->count, first + 1);
+}
+
 // Called after text has been inserted to re-highlight changed lines
 void hl_insert(PointerArray *line_start_states, size_t first, size_t lines)
 {
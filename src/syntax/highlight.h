@@ -44,5 +44,6 @@ void hl_fill_start_states (
 
 void hl_insert(PointerArray *line_start_states, size_t first, size_t lines);
 void hl_delete(PointerArray *line_start_states, size_t first, size_t lines);
+void hl_truncate(PointerArray *line_start_states, size_t first);
 
 #endif
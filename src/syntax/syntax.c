@@ -71,6 +71,37 @@ static void free_syntax_contents(Syntax *syn)
     hashmap_free(&syn->default_styles, NULL);
 }
 
+static size_t state_memory_usage(const State *s)
+{
+    size_t size = sizeof(*s);
+    size += s->conds.alloc * sizeof(s->conds.ptrs[0]);
+    size += s->conds.count * sizeof(Condition);
+    size += s->heredoc.states.alloc * sizeof(s->heredoc.states.ptrs[0]);
+    size += s->heredoc.states.count * sizeof(HeredocState);
+    return size;
+}
+
+// Return the (approximate) number of bytes allocated for `syn`, in the
+// same structures as freed by free_syntax()
+size_t syntax_memory_usage(const Syntax *syn)
+{
+    size_t size = sizeof(*syn) + strlen(syn->name) + 1;
+    size += hashmap_memory_usage(&syn->states);
+    size += hashmap_memory_usage(&syn->string_lists);
+    size += hashmap_memory_usage(&syn->default_styles);
+
+    for (HashMapIter it = hashmap_iter(&syn->states); hashmap_next(&it); ) {
+        size += state_memory_usage(it.entry->value);
+    }
+
+    for (HashMapIter it = hashmap_iter(&syn->string_lists); hashmap_next(&it); ) {
+        const StringList *list = it.entry->value;
+        size += sizeof(*list) + hashset_memory_usage(&list->strings);
+    }
+
+    return size;
+}
+
 void free_syntax(Syntax *syn)
 {
     free_syntax_contents(syn);
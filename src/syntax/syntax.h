@@ -129,6 +129,7 @@ void update_syntax_styles(Syntax *syn, const StyleMap *styles);
 void update_all_syntax_styles(const HashMap *syntaxes, const StyleMap *styles);
 void find_unused_subsyntaxes(const HashMap *syntaxes, ErrorBuffer *ebuf);
 void free_syntaxes(HashMap *syntaxes);
+size_t syntax_memory_usage(const Syntax *syn) NONNULL_ARGS WARN_UNUSED_RESULT;
 void collect_syntax_emit_names(const Syntax *syntax, PointerArray *a, const char *prefix) NONNULL_ARGS;
 
 #endif
@@ -126,13 +126,21 @@ static bool tag_file_changed (
     const char *filename,
     const struct stat *st
 ) {
-    return tf->mtime != st->st_mtime || !streq(tf->filename, filename);
+    // The modification time alone isn't enough to detect e.g. a tags file
+    // being regenerated more than once per second, so this is checked in
+    // the same way as for buffers (see stat_changed() in commands.c)
+    return !timespecs_equal(get_stat_mtime(st), &tf->mtime)
+        || st->st_dev != tf->dev
+        || st->st_ino != tf->ino
+        || (uintmax_t)st->st_size != tf->size
+        || !streq(tf->filename, filename);
 }
 
 // Note: does not free `tf` itself
 void tag_file_free(TagFile *tf)
 {
     free(tf->filename);
+    tag_name_index_free(&tf->names);
     free(tf->buf);
     *tf = (TagFile){.filename = NULL};
 }
@@ -175,6 +183,9 @@ bool load_tag_file(TagFile *tf, ErrorBuffer *ebuf)
         BUG_ON(tf->filename);
     }
 
+    // Note that the file is read instead of mapped with mmap(2), since
+    // ctags(1) and sort(1) may rewrite it in place (e.g. during `exec -b
+    // ctags -R`) and accessing a truncated mapping raises SIGBUS
     char *buf = malloc(st.st_size);
     if (unlikely(!buf)) {
         xclose(fd);
@@ -194,7 +205,10 @@ bool load_tag_file(TagFile *tf, ErrorBuffer *ebuf)
         .dirname_len = (xstrrchr(path, '/') - path) + 1, // Includes last slash
         .buf = buf,
         .size = size,
-        .mtime = st.st_mtime,
+        .dev = st.st_dev,
+        .ino = st.st_ino,
+        .mtime = *get_stat_mtime(&st),
+        .sort_order = get_tag_sort_order(buf, size),
     };
 
     return true;
@@ -225,9 +239,10 @@ static void tag_file_find_tags (
     StringView name,
     PointerArray *tags
 ) {
+    size_t end;
+    size_t pos = find_tag_range(tf->buf, tf->size, tf->sort_order, name, &end);
     Tag *tag = xmalloc(sizeof(*tag));
-    size_t pos = 0;
-    while (next_tag(tf->buf, tf->size, &pos, name, true, tag)) {
+    while (next_tag(tf->buf, end, &pos, name, true, tag)) {
         ptr_array_append(tags, tag);
         tag = xmalloc(sizeof(*tag));
     }
@@ -326,16 +341,18 @@ void collect_tags(TagFile *tf, PointerArray *a, StringView prefix)
         return;
     }
 
-    Tag tag;
-    size_t pos = 0;
-    StringView prev = STRING_VIEW_INIT;
-    while (next_tag(tf->buf, tf->size, &pos, prefix, false, &tag)) {
-        BUG_ON(tag.name.length == 0);
-        if (prev.length == 0 || !strview_equal(tag.name, prev)) {
-            ptr_array_append(a, xstrcut(tag.name.data, tag.name.length));
-            prev = tag.name;
-        }
-        free_tag(&tag);
+    // The index is only built once for each version of the tags file,
+    // since load_tag_file() only replaces `tf` (and thereby frees the
+    // index) if tag_file_changed()
+    TagNameIndex *idx = &tf->names;
+    if (!idx->names) {
+        tag_name_index_build(idx, tf->buf, tf->size);
+    }
+
+    size_t end;
+    for (size_t i = tag_name_index_find(idx, prefix, &end); i < end; i++) {
+        StringView name = idx->names[i];
+        ptr_array_append(a, xstrcut(name.data, name.length));
     }
 }
 
@@ -345,7 +362,6 @@ String dump_tags(TagFile *tf, ErrorBuffer *ebuf)
         return string_new(0);
     }
 
-    const struct timespec ts = {.tv_sec = tf->mtime};
     char sizestr[FILESIZE_STR_MAX];
     char tstr[TIME_STR_BUFSIZE];
     String buf = string_new(tf->size);
@@ -355,7 +371,7 @@ String dump_tags(TagFile *tf, ErrorBuffer *ebuf)
         "Tags file\n---------\n\n"
         "%s %s\n%s %s\n%s %s",
         "     Path:", tf->filename,
-        " Modified:", timespec_to_str(&ts, tstr) ? tstr : "-",
+        " Modified:", timespec_to_str(&tf->mtime, tstr) ? tstr : "-",
         "     Size:", filesize_to_str(tf->size, sizestr)
     );
 
@@ -3,6 +3,7 @@
 
 #include <stdbool.h>
 #include <sys/types.h>
+#include <time.h>
 #include "ctags.h"
 #include "msg.h"
 #include "util/macros.h"
@@ -16,7 +17,11 @@ typedef struct {
     size_t dirname_len; // The length of the directory part of `filename` (including the last slash)
     char *buf; // The contents of the tags file
     size_t size; // The length of `buf`
-    time_t mtime; // The modification time of the tags file (when last loaded)
+    dev_t dev; // The device and inode numbers of the tags file (when last loaded)
+    ino_t ino;
+    struct timespec mtime; // The modification time of the tags file (when last loaded)
+    TagSortOrder sort_order; // Allows binary searching `buf` (see find_tag_range())
+    TagNameIndex names; // Built on demand by collect_tags() (and freed with `buf`)
 } TagFile;
 
 bool load_tag_file(TagFile *tf, ErrorBuffer *ebuf) NONNULL_ARG(1) WARN_UNUSED_RESULT;
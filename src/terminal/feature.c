@@ -38,6 +38,7 @@ enum {
     NCVUL = TFLAG_NCV_UNDERLINE,
     NCVDIM = TFLAG_NCV_DIM,
     NCVREV = TFLAG_NCV_REVERSE,
+    SCROLL = TFLAG_SCROLL_REGION,
 
     // Query-only flags (not used in terms[] entries)
     METAESC = TFLAG_META_ESC,
@@ -79,6 +80,7 @@ const char *term_feature_to_str(TermFeatureFlags flag)
     case TFLAG_NCV_UNDERLINE: return "NCVUL";
     case TFLAG_NCV_DIM: return "NCVDIM";
     case TFLAG_NCV_REVERSE: return "NCVREV";
+    case TFLAG_SCROLL_REGION: return "SCROLL";
     }
 
     return "??";
@@ -92,11 +94,11 @@ const char *term_feature_to_str(TermFeatureFlags flag)
 
 static const TermEntry terms[] = {
     t("Eterm", C8 | BCE),
-    t("alacritty", TC | BCE | REP | OSC52 | SYNC),
+    t("alacritty", TC | BCE | REP | OSC52 | SYNC | SCROLL),
     t("ansi", C8 | NCVUL),
     t("ansiterm", 0),
     t("aterm", C8 | BCE),
-    t("contour", TC | BCE | REP | TITLE | OSC52 | SYNC),
+    t("contour", TC | BCE | REP | TITLE | OSC52 | SYNC | SCROLL),
     t("cx", C8),
     t("cx100", C8),
     t("cygwin", C8),
@@ -107,44 +109,44 @@ static const TermEntry terms[] = {
     t("dtterm", C8),
     t("dvtm", C8 | BSCTRL),
     t("fbterm", C256 | BCE | NCVUL | NCVDIM),
-    t("foot", TC | BCE | REP | TITLE | OSC52 | KITTYKBD | SYNC),
-    t("ghostty", TC | BCE | REP | TITLE | OSC52 | KITTYKBD | SYNC),
+    t("foot", TC | BCE | REP | TITLE | OSC52 | KITTYKBD | SYNC | SCROLL),
+    t("ghostty", TC | BCE | REP | TITLE | OSC52 | KITTYKBD | SYNC | SCROLL),
     t("hurd", C8 | BCE | NCVUL | NCVDIM),
     t("iTerm.app", C256 | BCE),
-    t("iTerm2.app", C256 | BCE | TITLE | OSC52 | SYNC),
+    t("iTerm2.app", C256 | BCE | TITLE | OSC52 | SYNC | SCROLL),
     t("iterm", C256 | BCE),
-    t("iterm2", C256 | BCE | TITLE | OSC52 | SYNC),
+    t("iterm2", C256 | BCE | TITLE | OSC52 | SYNC | SCROLL),
     t("jfbterm", C8 | BCE | NCVUL | NCVDIM),
-    t("kitty", TC | TITLE | OSC52 | KITTYKBD | SYNC),
+    t("kitty", TC | TITLE | OSC52 | KITTYKBD | SYNC | SCROLL),
     t("kon", C8 | BCE | NCVUL | NCVDIM),
     t("kon2", C8 | BCE | NCVUL | NCVDIM),
     t("konsole", C8 | BCE),
     t("kterm", C8),
     t("linux", C8 | LINUX | BCE | NCVUL | NCVDIM),
     t("mgt", C8 | BCE),
-    t("mintty", C8 | BCE | REP | TITLE | OSC52 | SYNC),
+    t("mintty", C8 | BCE | REP | TITLE | OSC52 | SYNC | SCROLL),
     t("mlterm", C8 | TITLE),
     t("mlterm2", C8 | TITLE),
     t("mlterm3", C8 | TITLE),
     t("mrxvt", C8 | RXVT | BCE | TITLE | OSC52),
     t("pcansi", C8 | NCVUL),
     t("putty", C8 | BCE | NCVUL | NCVDIM | NCVREV), // TODO: BSCTRL?
-    t("rio", TC | BCE | REP | OSC52 | SYNC),
+    t("rio", TC | BCE | REP | OSC52 | SYNC | SCROLL),
     t("rxvt", C8 | RXVT | BCE | TITLE | OSC52 | BSCTRL),
     t("screen", C8 | TITLE | OSC52),
-    t("st", C8 | BCE | OSC52 | BSCTRL),
-    t("stterm", C8 | BCE | OSC52),
+    t("st", C8 | BCE | OSC52 | BSCTRL | SCROLL),
+    t("stterm", C8 | BCE | OSC52 | SCROLL),
     t("teken", C8 | BCE | NCVDIM | NCVREV),
     t("terminator", C256 | BCE | TITLE | BSCTRL),
     t("termite", C8 | TITLE),
-    t("tmux", C8 | TITLE | OSC52 | NOQUERY3 | BSCTRL), // See also: parse_xtversion_reply()
+    t("tmux", C8 | TITLE | OSC52 | NOQUERY3 | BSCTRL | SCROLL), // See also: parse_xtversion_reply()
     t("vt220", NOQUERY1), // Used by cu(1) and picocom(1), which wrongly handle queries
-    t("wezterm", TC | BCE | REP | TITLE | OSC52 | SYNC | BSCTRL), // See also: parse_xtversion_reply()
+    t("wezterm", TC | BCE | REP | TITLE | OSC52 | SYNC | BSCTRL | SCROLL), // See also: parse_xtversion_reply()
     t("xfce", C8 | BCE | TITLE),
     // The real xterm supports ECMA-48 REP, but TERM=xterm* is used by too
     // many other terminals to safely add it here.
     // See also: parse_xtgettcap_reply()
-    t("xterm", C8 | BCE | TITLE | OSC52),
+    t("xterm", C8 | BCE | TITLE | OSC52 | SCROLL),
     t("xterm.js", C8 | BCE),
 };
 
@@ -30,6 +30,7 @@ typedef enum {
     TFLAG_NCV_UNDERLINE = 1 << 21, // Colors can't be used with ATTR_UNDERLINE (see "ncv" in terminfo(5))
     TFLAG_NCV_DIM = 1 << 22, // Colors can't be used with ATTR_DIM
     TFLAG_NCV_REVERSE = 1 << 23, // Colors can't be used with ATTR_REVERSE
+    TFLAG_SCROLL_REGION = 1 << 24, // Supports DECSTBM scroll regions and ECMA-48 SU/SD (scroll up/down)
 } TermFeatureFlags;
 
 TermFeatureFlags term_get_features(const char *name, const char *colorterm);
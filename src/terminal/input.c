@@ -337,6 +337,14 @@ static KeyCode term_read_input_modern(Terminal *term)
     return (key == KEY_IGNORE) ? KEY_NONE : key;
 }
 
+// Check whether there's more input to be read by term_read_input(),
+// either already buffered or arriving within `timeout_ms` milliseconds
+bool term_input_pending(Terminal *term, unsigned int timeout_ms)
+{
+    TermInputBuffer *input = &term->ibuf;
+    return input->len || fill_buffer_timeout(input, timeout_ms);
+}
+
 KeyCode term_read_input(Terminal *term, unsigned int esc_timeout_ms)
 {
     if (term->features & TFLAG_KITTY_KEYBOARD) {
@@ -1,10 +1,12 @@
 #ifndef TERMINAL_INPUT_H
 #define TERMINAL_INPUT_H
 
+#include <stdbool.h>
 #include "key.h"
 #include "terminal.h"
 #include "util/macros.h"
 
 KeyCode term_read_input(Terminal *term, unsigned int esc_timeout_ms) NONNULL_ARGS;
+bool term_input_pending(Terminal *term, unsigned int timeout_ms) NONNULL_ARGS;
 
 #endif
@@ -28,14 +28,38 @@
 #include "util/numtostr.h"
 #include "util/str-util.h"
 #include "util/utf8.h"
+#include "util/xmalloc.h"
 #include "util/xreadwrite.h"
 
+// Grow the output buffer to make room for at least `count` more bytes.
+// The buffer is allowed to grow large enough to hold a whole screen
+// update, so that it can be written with a single term_output_flush()
+// call (even on very large terminals), but it's flushed early if that
+// would require growing beyond TERM_OUTBUF_MAX.
+NOINLINE
+static void obuf_grow(TermOutputBuffer *obuf, size_t count)
+{
+    size_t needed = obuf->count + count;
+    if (unlikely(needed > TERM_OUTBUF_MAX)) {
+        term_output_flush(obuf);
+        needed = count;
+    }
+
+    if (needed > obuf->alloc) {
+        static_assert(IS_POWER_OF_2(TERM_OUTBUF_MAX));
+        size_t alloc = MAX(next_pow2(needed), TERM_OUTBUF_SIZE);
+        obuf->buf = xrealloc(obuf->buf, alloc);
+        obuf->alloc = alloc;
+        LOG_DEBUG("terminal output buffer grown to %zu bytes", alloc);
+    }
+}
+
 char *term_output_reserve_space(TermOutputBuffer *obuf, size_t count)
 {
-    BUG_ON(count > TERM_OUTBUF_SIZE);
-    BUG_ON(obuf->count > TERM_OUTBUF_SIZE);
+    BUG_ON(count > TERM_OUTBUF_MAX);
+    BUG_ON(obuf->count > obuf->alloc);
     if (unlikely(obuf_avail(obuf) < count)) {
-        term_output_flush(obuf);
+        obuf_grow(obuf, count);
     }
     return obuf->buf + obuf->count;
 }
@@ -52,20 +76,228 @@ void term_output_reset(Terminal *term, size_t start_x, size_t width, size_t scro
 }
 
 // Write directly to the terminal, as done when e.g. flushing the output buffer
-static bool term_direct_write(const char *str, size_t count)
+static bool term_direct_write(TermOutputBuffer *obuf, const char *str, size_t count)
 {
-    bool ok = (xwrite_all(STDOUT_FILENO, str, count) == count);
-    LOG_ERRNO_ON(!ok, "write");
+    bool ok = true;
+    if (unlikely(obuf->sink)) {
+        // Capture output in memory (e.g. for benchmarking, without the
+        // cost of write(2))
+        string_append_buf(obuf->sink, str, count);
+    } else {
+        ok = (xwrite_all(STDOUT_FILENO, str, count) == count);
+        LOG_ERRNO_ON(!ok, "write");
+    }
+
+    obuf->nr_written += ok ? count : 0;
+    obuf->nr_flushes++;
     return ok;
 }
 
+static const char *cell_glyph(const TermCell *cell)
+{
+    return (cell->len > TERM_CELL_INLINE_MAX) ? cell->glyph.ptr : cell->glyph.bytes;
+}
+
+static void cell_free_glyph(TermCell *cell)
+{
+    if (cell->len > TERM_CELL_INLINE_MAX) {
+        free(cell->glyph.ptr);
+    }
+}
+
+static void cell_set (
+    TermCell *cell,
+    const char *glyph,
+    size_t len,
+    unsigned int width,
+    TermStyle style
+) {
+    BUG_ON(len > UINT8_MAX);
+    cell_free_glyph(cell);
+    cell->style = style;
+    cell->width = width;
+    cell->len = len;
+    if (len > TERM_CELL_INLINE_MAX) {
+        cell->glyph.ptr = xmemdup(glyph, len);
+    } else if (len) {
+        memcpy(cell->glyph.bytes, glyph, len);
+    }
+}
+
+static void cell_invalidate(TermCell *cell)
+{
+    cell_free_glyph(cell);
+    cell->width = TERM_CELL_INVALID;
+    cell->len = 0;
+}
+
+static bool cell_is_blank(const TermCell *cell)
+{
+    return cell->width == 1 && cell->len == 1 && cell->glyph.bytes[0] == ' ';
+}
+
+static bool cells_equal(const TermCell *a, const TermCell *b)
+{
+    return
+        a->width == b->width
+        && a->width != TERM_CELL_INVALID
+        && a->len == b->len
+        && same_style(&a->style, &b->style)
+        && mem_equal(cell_glyph(a), cell_glyph(b), a->len)
+    ;
+}
+
+// Return row `y` of the back buffer, after first initializing it with
+// the contents of the front buffer (if not yet done in this update)
+static TermCell *screen_touch_row(TermScreen *screen, unsigned int y)
+{
+    TermCell *row = screen->back[y];
+    if (screen->touched[y]) {
+        return row;
+    }
+
+    const TermCell *src = screen->front[y];
+    for (size_t x = 0, w = screen->width; x < w; x++) {
+        cell_free_glyph(&row[x]);
+        row[x] = src[x];
+        if (src[x].len > TERM_CELL_INLINE_MAX) {
+            row[x].glyph.ptr = xmemdup(src[x].glyph.ptr, src[x].len);
+        }
+    }
+
+    screen->touched[y] = true;
+    return row;
+}
+
+// Overwriting either half of a double-width glyph erases the other half,
+// as it would in the terminal
+static void screen_split_wide_glyph(TermCell *row, unsigned int x, unsigned int w)
+{
+    const TermCell *cell = &row[x];
+    if (cell->width == 0 && x > 0) {
+        cell_set(&row[x - 1], " ", 1, 1, row[x - 1].style);
+    } else if (cell->width == 2 && x + 1 < w) {
+        cell_set(&row[x + 1], " ", 1, 1, row[x + 1].style);
+    }
+}
+
+static void screen_put_glyph (
+    TermScreen *screen,
+    const char *glyph,
+    size_t len,
+    unsigned int width,
+    TermStyle style
+) {
+    const unsigned int x = screen->x;
+    const unsigned int y = screen->y;
+    const unsigned int w = screen->width;
+    if (unlikely(y >= screen->height)) {
+        return;
+    }
+
+    if (width == 0) {
+        // Append zero-width (e.g. combining) characters to the glyph
+        // in the previous cell
+        if (unlikely(x == 0 || x > w)) {
+            return;
+        }
+        TermCell *row = screen_touch_row(screen, y);
+        TermCell *base = &row[x - 1];
+        base -= (base->width == 0 && x >= 2);
+        size_t base_len = base->len;
+        if (base->width == TERM_CELL_INVALID || base_len + len > UINT8_MAX) {
+            return;
+        }
+        char tmp[UINT8_MAX];
+        memcpy(tmp, cell_glyph(base), base_len);
+        memcpy(tmp + base_len, glyph, len);
+        cell_set(base, tmp, base_len + len, base->width, base->style);
+        return;
+    }
+
+    screen->x += width;
+    if (unlikely(x + width > w)) {
+        return;
+    }
+
+    TermCell *row = screen_touch_row(screen, y);
+    screen_split_wide_glyph(row, x, w);
+    if (width == 2) {
+        screen_split_wide_glyph(row, x + 1, w);
+        cell_set(&row[x + 1], NULL, 0, 0, style);
+    }
+    cell_set(&row[x], glyph, len, width, style);
+}
+
+// Equivalent to calling screen_put_glyph() for each byte of `str`, but
+// touches the row and clips the run only once. All bytes must be
+// printable ASCII characters (see term_put_ascii()).
+static void screen_put_ascii(TermScreen *screen, const char *str, size_t n, TermStyle style)
+{
+    const unsigned int x = screen->x;
+    const unsigned int y = screen->y;
+    const unsigned int w = screen->width;
+    screen->x += n;
+    if (unlikely(y >= screen->height || x >= w)) {
+        return;
+    }
+
+    n = MIN(n, w - x);
+    if (unlikely(n == 0)) {
+        return;
+    }
+
+    // Only the double-width glyphs straddling either end of the run can
+    // be split; any others are overwritten entirely
+    TermCell *row = screen_touch_row(screen, y);
+    screen_split_wide_glyph(row, x, w);
+    screen_split_wide_glyph(row, x + n - 1, w);
+
+    for (size_t i = 0; i < n; i++) {
+        TermCell *cell = &row[x + i];
+        cell_free_glyph(cell);
+        cell->style = style;
+        cell->width = 1;
+        cell->len = 1;
+        cell->glyph.bytes[0] = str[i];
+    }
+}
+
+// Move the bytes appended to `obuf` since `start` (by put_char()) into
+// the TermScreen grid
+static void screen_capture(TermOutputBuffer *obuf, size_t start)
+{
+    if (unlikely(obuf->count < start)) {
+        // term_output_reserve_space() flushed the buffer before the
+        // new bytes were appended
+        start = 0;
+    }
+
+    const char *buf = obuf->buf;
+    for (size_t i = start, n = obuf->count; i < n; ) {
+        size_t pos = i;
+        CodePoint u = u_get_char(buf, n, &i);
+        unsigned int width = (u < 0x80) ? 1 : u_char_width(u);
+        screen_put_glyph(&obuf->screen, buf + pos, i - pos, width, obuf->style);
+    }
+
+    obuf->count = start;
+}
+
+static void screen_put_repeated(TermOutputBuffer *obuf, char ch, size_t count)
+{
+    while (count--) {
+        screen_put_glyph(&obuf->screen, &ch, 1, 1, obuf->style);
+    }
+}
+
 // NOTE: does not update `obuf.x`; see term_put_byte()
 void term_put_bytes(TermOutputBuffer *obuf, const char *str, size_t count)
 {
-    if (unlikely(count >= TERM_OUTBUF_SIZE)) {
+    if (unlikely(count >= TERM_OUTBUF_MAX)) {
         term_output_flush(obuf);
-        if (term_direct_write(str, count)) {
-            LOG_INFO("writing %zu bytes directly to terminal", count);
+        if (term_direct_write(obuf, str, count)) {
+            LOG_INFO("wrote %zu bytes directly to terminal", count);
         }
         return;
     }
@@ -77,7 +309,7 @@ void term_put_bytes(TermOutputBuffer *obuf, const char *str, size_t count)
 
 static void term_repeat_byte(TermOutputBuffer *obuf, char ch, size_t count)
 {
-    if (likely(count <= TERM_OUTBUF_SIZE)) {
+    if (likely(count <= TERM_OUTBUF_MAX)) {
         // Repeat count fits in buffer; reserve space and tail-call memset(3)
         char *buf = term_output_reserve_space(obuf, count);
         obuf->count += count;
@@ -85,14 +317,15 @@ static void term_repeat_byte(TermOutputBuffer *obuf, char ch, size_t count)
         return;
     }
 
-    // Repeat count greater than buffer size; fill buffer with `ch` and call
-    // write() repeatedly until `count` reaches zero
+    // Repeat count greater than maximum buffer size; fill buffer with `ch`
+    // and call write() repeatedly until `count` reaches zero
     term_output_flush(obuf);
-    memset(obuf->buf, ch, TERM_OUTBUF_SIZE);
+    char *buf = term_output_reserve_space(obuf, TERM_OUTBUF_SIZE);
+    memset(buf, ch, TERM_OUTBUF_SIZE);
     while (count) {
         size_t n = MIN(count, TERM_OUTBUF_SIZE);
         count -= n;
-        term_direct_write(obuf->buf, n);
+        term_direct_write(obuf, buf, n);
     }
 }
 
@@ -133,6 +366,11 @@ TermSetBytesMethod term_set_bytes(Terminal *term, char ch, size_t count)
     }
 
     obuf->x += count;
+    if (obuf->screen.active) {
+        screen_put_repeated(obuf, ch, count);
+        return TERM_SET_BYTES_MEMSET;
+    }
+
     if (term->features & TFLAG_ECMA48_REPEAT) {
         bool used_rep = ecma48_repeat_byte(obuf, ch, count);
         return used_rep ? TERM_SET_BYTES_REP : TERM_SET_BYTES_MEMSET;
@@ -255,6 +493,9 @@ static void term_put_level_3_queries(Terminal *term, bool emit_all)
     if (!(features & TFLAG_OSC52_COPY)) {
         term_put_literal(obuf, "\033P+q4D73\033\\"); // XTGETTCAP "Ms"
     }
+    if (!(features & TFLAG_SCROLL_REGION)) {
+        term_put_literal(obuf, "\033P+q696E646E\033\\"); // XTGETTCAP "indn"
+    }
 
     // Debug query responses are used purely for logging/informational purposes
     if (emit_all || log_level_debug_enabled()) {
@@ -341,7 +582,7 @@ void term_end_sync_update(Terminal *term)
     }
 }
 
-void term_move_cursor(TermOutputBuffer *obuf, unsigned int x, unsigned int y)
+static void put_cup(TermOutputBuffer *obuf, unsigned int x, unsigned int y)
 {
     // ECMA-48 CUP (CSI Pl ; Pc H)
     const size_t maxlen = STRLEN("E[;H") + (2 * DECIMAL_STR_MAX(x));
@@ -359,6 +600,17 @@ void term_move_cursor(TermOutputBuffer *obuf, unsigned int x, unsigned int y)
     obuf->count += i;
 }
 
+void term_move_cursor(TermOutputBuffer *obuf, unsigned int x, unsigned int y)
+{
+    TermScreen *screen = &obuf->screen;
+    if (screen->active) {
+        screen->x = x;
+        screen->y = y;
+        return;
+    }
+    put_cup(obuf, x, y);
+}
+
 // Save (push) window title on XTWINOPS stack
 // https://invisible-island.net/xterm/ctlseqs/ctlseqs.html#:~:text=Save%20xterm%20window%20title%20on%20stack
 void term_save_title(Terminal *term)
@@ -387,13 +639,20 @@ void term_restore_and_save_title(Terminal *term)
     }
 }
 
+// Whether cells erased by EL (or ED) appear the same as spaces drawn
+// with the given style
+static bool can_erase_with_style(const Terminal *term, const TermStyle *style)
+{
+    bool bce = !!(term->features & TFLAG_BACK_COLOR_ERASE);
+    bool rev = !!(style->attr & ATTR_REVERSE);
+    bool bg = (style->bg >= COLOR_BLACK);
+    return (bce || !bg) && !rev;
+}
+
 bool term_can_clear_eol_with_el_sequence(const Terminal *term)
 {
     const TermOutputBuffer *obuf = &term->obuf;
-    bool bce = !!(term->features & TFLAG_BACK_COLOR_ERASE);
-    bool rev = !!(obuf->style.attr & ATTR_REVERSE);
-    bool bg = (obuf->style.bg >= COLOR_BLACK);
-    return obuf->can_clear && (bce || !bg) && !rev;
+    return obuf->can_clear && can_erase_with_style(term, &obuf->style);
 }
 
 int term_clear_eol(Terminal *term)
@@ -405,7 +664,9 @@ int term_clear_eol(Terminal *term)
         return 0;
     }
 
-    if (term_can_clear_eol_with_el_sequence(term)) {
+    // Note that term_screen_end_update() takes care of using EL, when
+    // drawing to TermScreen (see screen_emit_erase())
+    if (!obuf->screen.active && term_can_clear_eol_with_el_sequence(term)) {
         obuf->x = end;
         term_put_literal(obuf, "\033[K"); // Erase to end of line (EL 0)
         static_assert(ECMA48_REP_MIN > -TERM_CLEAR_EOL_USED_EL);
@@ -431,6 +692,7 @@ int term_clear_eol(Terminal *term)
 
 void term_clear_screen(TermOutputBuffer *obuf)
 {
+    obuf->screen.invalid = true;
     term_put_literal (
         obuf,
         "\033[0m" // Reset colors and attributes (SGR 0)
@@ -443,12 +705,21 @@ void term_output_flush(TermOutputBuffer *obuf)
 {
     size_t n = obuf->count;
     if (n) {
-        BUG_ON(n > TERM_OUTBUF_SIZE);
+        BUG_ON(n > obuf->alloc);
         obuf->count = 0;
-        term_direct_write(obuf->buf, n);
+        term_direct_write(obuf, obuf->buf, n);
     }
 }
 
+void term_output_free(TermOutputBuffer *obuf)
+{
+    term_screen_free(&obuf->screen);
+    free(obuf->buf);
+    obuf->buf = NULL;
+    obuf->alloc = 0;
+    obuf->count = 0;
+}
+
 static const char *get_tab_str(TermTabOutputMode tab_mode)
 {
     static const char tabstr[][8] = {
@@ -509,7 +780,7 @@ static void buf_skip(TermOutputBuffer *obuf, CodePoint u)
     }
 }
 
-bool term_put_char(TermOutputBuffer *obuf, CodePoint u)
+static bool put_char(TermOutputBuffer *obuf, CodePoint u)
 {
     if (unlikely(obuf->x < obuf->scroll_x)) {
         // Scrolled, char (at least partially) invisible
@@ -568,6 +839,50 @@ bool term_put_char(TermOutputBuffer *obuf, CodePoint u)
     return true;
 }
 
+bool term_put_char(TermOutputBuffer *obuf, CodePoint u)
+{
+    if (likely(!obuf->screen.active)) {
+        return put_char(obuf, u);
+    }
+
+    // Let put_char() handle scrolling, clipping, tabs and special
+    // characters as usual, then move whatever it appended into the
+    // TermScreen grid
+    size_t start = obuf->count;
+    bool ret = put_char(obuf, u);
+    screen_capture(obuf, start);
+    return ret;
+}
+
+// Equivalent to calling term_put_char() for each byte of `str`, but
+// clips the whole run to the visible region at once and copies it with
+// a single memcpy(3) (or a single pass over the TermScreen row, when
+// drawing via update_screen()). All bytes must be printable ASCII
+// characters (0x20..0x7E), since each one is assumed to occupy exactly
+// 1 column.
+bool term_put_ascii(TermOutputBuffer *obuf, const char *str, size_t len)
+{
+    if (unlikely(obuf->x < obuf->scroll_x)) {
+        // Scrolled; skip the invisible part of the run
+        size_t skip = MIN(len, obuf->scroll_x - obuf->x);
+        obuf->x += skip;
+        str += skip;
+        len -= skip;
+    }
+
+    const size_t space = obuf->scroll_x + obuf->width - obuf->x;
+    const size_t n = MIN(len, space);
+    obuf->x += n;
+
+    if (likely(obuf->screen.active)) {
+        screen_put_ascii(&obuf->screen, str, n, obuf->style);
+    } else {
+        term_put_bytes(obuf, str, n);
+    }
+
+    return n == len;
+}
+
 static size_t color_to_sgr_param_suffix(char *buf, int32_t color)
 {
     BUG_ON(color < 0);
@@ -640,7 +955,7 @@ static void term_style_sanitize(TermStyle *style, unsigned int ncv_attrs)
     style->attr &= (have_color ? ~ncv_attrs : ~0u);
 }
 
-void term_set_style(Terminal *term, TermStyle style)
+static void put_sgr(TermOutputBuffer *obuf, TermStyle style)
 {
     static const struct {
         char code;
@@ -661,11 +976,9 @@ void term_set_style(Terminal *term, TermStyle style)
     // current state (i.e. without using `0` to reset or emitting
     // already active attributes/colors)
 
-    term_style_sanitize(&style, term->ncv_attributes);
-
     const size_t maxcolor = STRLEN(";38;2;255;255;255");
     const size_t maxlen = STRLEN("E[0m") + (2 * maxcolor) + (2 * ARRAYLEN(attr_map));
-    char *buf = term_output_reserve_space(&term->obuf, maxlen);
+    char *buf = term_output_reserve_space(obuf, maxlen);
     size_t pos = copyliteral(buf, "\033[0");
 
     for (size_t i = 0; i < ARRAYLEN(attr_map); i++) {
@@ -679,8 +992,319 @@ void term_set_style(Terminal *term, TermStyle style)
     pos += bg_color_to_sgr_param(buf + pos, style.bg);
     buf[pos++] = 'm';
     BUG_ON(pos > maxlen);
-    term->obuf.count += pos;
-    term->obuf.style = style;
+    obuf->count += pos;
+    obuf->style = style;
+}
+
+void term_set_style(Terminal *term, TermStyle style)
+{
+    term_style_sanitize(&style, term->ncv_attributes);
+    TermOutputBuffer *obuf = &term->obuf;
+    if (obuf->screen.active) {
+        // Just record the style to be used for subsequently drawn cells;
+        // term_screen_end_update() emits SGR sequences as needed
+        obuf->style = style;
+        return;
+    }
+    put_sgr(obuf, style);
+}
+
+typedef struct {
+    Terminal *term;
+    unsigned int x; // Column of the terminal cursor (or UINT_MAX, if unknown)
+    unsigned int y; // Row of the terminal cursor (or UINT_MAX, if unknown)
+} ScreenEmitter;
+
+static void screen_emit_style(ScreenEmitter *em, const TermStyle *style)
+{
+    TermOutputBuffer *obuf = &em->term->obuf;
+    if (!same_style(style, &obuf->style)) {
+        put_sgr(obuf, *style);
+    }
+}
+
+static void screen_emit_move(ScreenEmitter *em, const TermCell *row, unsigned int x, unsigned int y)
+{
+    TermOutputBuffer *obuf = &em->term->obuf;
+    if (em->y == y && em->x <= x) {
+        // Moving forwards on the same row; re-emit the (unchanged) cells
+        // in between instead of using CUP, if it takes no more bytes
+        const size_t max = STRLEN("E[;H") + 2;
+        size_t nbytes = 0;
+        unsigned int i;
+        for (i = em->x; i < x && nbytes <= max; i++) {
+            const TermCell *cell = &row[i];
+            if (cell->width != 1 || !same_style(&cell->style, &obuf->style)) {
+                break;
+            }
+            nbytes += cell->len;
+        }
+        if (i == x && nbytes <= max) {
+            for (i = em->x; i < x; i++) {
+                term_put_bytes(obuf, cell_glyph(&row[i]), row[i].len);
+            }
+            em->x = x;
+            return;
+        }
+    }
+
+    put_cup(obuf, x, y);
+    em->x = x;
+    em->y = y;
+}
+
+// Emit an EL sequence for a run of blank cells extending to the end
+// of the row, if doing so is shorter than emitting the spaces
+static bool screen_emit_erase(ScreenEmitter *em, const TermCell *row, unsigned int x, unsigned int y)
+{
+    const TermCell *cell = &row[x];
+    const unsigned int w = em->term->obuf.screen.width;
+    if (w - x <= STRLEN("E[K") || !cell_is_blank(cell)) {
+        return false;
+    }
+    if (!can_erase_with_style(em->term, &cell->style)) {
+        return false;
+    }
+
+    for (unsigned int i = x + 1; i < w; i++) {
+        if (!cell_is_blank(&row[i]) || !same_style(&row[i].style, &cell->style)) {
+            return false;
+        }
+    }
+
+    screen_emit_move(em, row, x, y);
+    screen_emit_style(em, &cell->style);
+    term_put_literal(&em->term->obuf, "\033[K"); // Erase to end of line (EL 0)
+    return true;
+}
+
+// Emit the glyph in cell `x` (or a REP sequence for a run of cells
+// identical to it) and return the number of columns drawn
+static unsigned int screen_emit_cells(ScreenEmitter *em, const TermCell *row, unsigned int x, unsigned int y)
+{
+    TermOutputBuffer *obuf = &em->term->obuf;
+    const TermCell *cell = &row[x];
+    const unsigned int w = obuf->screen.width;
+    screen_emit_move(em, row, x, y);
+    screen_emit_style(em, &cell->style);
+
+    unsigned int ncols = cell->width;
+    if (cell->len == 1 && (em->term->features & TFLAG_ECMA48_REPEAT)) {
+        unsigned int n = 1;
+        while (x + n < w && cells_equal(cell, &row[x + n])) {
+            n++;
+        }
+        if (n >= ECMA48_REP_MIN) {
+            ecma48_repeat_byte(obuf, cell->glyph.bytes[0], n);
+            ncols = n;
+        } else {
+            term_put_bytes(obuf, cell->glyph.bytes, 1);
+        }
+    } else {
+        term_put_bytes(obuf, cell_glyph(cell), cell->len);
+    }
+
+    // The cursor position is unknown after drawing to the last column,
+    // since terminals differ in how they handle the "pending wrap" state
+    em->x = (x + ncols < w) ? x + ncols : UINT_MAX;
+    return ncols;
+}
+
+static void screen_emit_row(ScreenEmitter *em, unsigned int y)
+{
+    const TermScreen *screen = &em->term->obuf.screen;
+    const TermCell *old = screen->front[y];
+    const TermCell *new = screen->back[y];
+
+    for (unsigned int x = 0, w = screen->width; x < w; ) {
+        const TermCell *cell = &new[x];
+        if (cell->width == 0 || cell->width == TERM_CELL_INVALID) {
+            // Right half of a double-width glyph (already handled along
+            // with the left half) or a cell that wasn't drawn to
+            x++;
+            continue;
+        }
+
+        bool wide = (cell->width == 2);
+        bool changed = !cells_equal(cell, &old[x]) || (wide && !cells_equal(&cell[1], &old[x + 1]));
+        if (!changed) {
+            x += cell->width;
+            continue;
+        }
+
+        if (screen_emit_erase(em, new, x, y)) {
+            break;
+        }
+
+        x += screen_emit_cells(em, new, x, y);
+    }
+}
+
+static void screen_free_cells(TermScreen *screen)
+{
+    size_t n = 2 * (size_t)screen->width * screen->height;
+    for (size_t i = 0; i < n; i++) {
+        cell_free_glyph(&screen->cells[i]);
+    }
+}
+
+void term_screen_free(TermScreen *screen)
+{
+    screen_free_cells(screen);
+    free(screen->cells);
+    free(screen->front);
+    free(screen->touched);
+    *screen = (TermScreen){.invalid = screen->invalid};
+}
+
+static void screen_resize(TermScreen *screen, unsigned int width, unsigned int height)
+{
+    term_screen_free(screen);
+    size_t ncells = (size_t)width * height;
+    TermCell *cells = xmallocarray(2 * ncells, sizeof(*cells));
+    TermCell **rows = xmallocarray(2 * height, sizeof(*rows));
+
+    for (size_t i = 0; i < 2 * ncells; i++) {
+        cells[i] = (TermCell){.width = TERM_CELL_INVALID};
+    }
+    for (size_t y = 0; y < 2 * height; y++) {
+        rows[y] = cells + (y * width);
+    }
+
+    screen->cells = cells;
+    screen->front = rows;
+    screen->back = rows + height;
+    screen->touched = xcalloc(height, sizeof(*screen->touched));
+    screen->width = width;
+    screen->height = height;
+    LOG_INFO("allocated %ux%u screen grid (%zu bytes)", width, height, 2 * ncells * sizeof(*cells));
+}
+
+/*
+ * Begin redirecting output from the text drawing functions (term_put_char(),
+ * term_set_bytes(), term_clear_eol(), etc.) into an in-memory grid of cells.
+ * Cursor movements and style changes made by term_move_cursor() and
+ * term_set_style() are likewise only recorded, until term_screen_end_update()
+ * compares the grid with the previous update and emits only the changes.
+ * Other sequences (e.g. term_hide_cursor()) are still written to the output
+ * buffer immediately.
+ */
+void term_screen_begin_update(Terminal *term)
+{
+    TermOutputBuffer *obuf = &term->obuf;
+    TermScreen *screen = &obuf->screen;
+    BUG_ON(screen->active);
+
+    if (screen->width != term->width || screen->height != term->height) {
+        screen_resize(screen, term->width, term->height);
+    } else if (screen->invalid) {
+        for (size_t y = 0, h = screen->height; y < h; y++) {
+            TermCell *row = screen->front[y];
+            for (size_t x = 0, w = screen->width; x < w; x++) {
+                cell_invalidate(&row[x]);
+            }
+        }
+    }
+
+    screen->invalid = false;
+    screen->active = true;
+    screen->x = 0;
+    screen->y = 0;
+    screen->style = obuf->style;
+}
+
+static void reverse_rows(TermCell **rows, size_t start, size_t end)
+{
+    while (start + 1 < end) {
+        TermCell *tmp = rows[start];
+        rows[start++] = rows[--end];
+        rows[end] = tmp;
+    }
+}
+
+/*
+ * Scroll the contents of terminal rows `top` to `bottom` (inclusive) by
+ * `delta` rows (positive values scroll towards the top), by emitting
+ * DECSTBM and SU/SD sequences. The TermScreen rows are shifted to match,
+ * so that only the newly exposed rows are subsequently emitted by
+ * term_screen_end_update(). This must be called before drawing anything
+ * in the affected rows. Returns false if the terminal doesn't support
+ * scrolling regions, in which case nothing is done.
+ */
+bool term_screen_scroll(Terminal *term, unsigned int top, unsigned int bottom, int delta)
+{
+    TermOutputBuffer *obuf = &term->obuf;
+    TermScreen *screen = &obuf->screen;
+    BUG_ON(!screen->active);
+    BUG_ON(top > bottom || bottom >= screen->height);
+
+    const unsigned int nrows = bottom - top + 1;
+    const unsigned int n = (delta < 0) ? -(unsigned int)delta : delta;
+    if (!(term->features & TFLAG_SCROLL_REGION) || n == 0 || n >= nrows) {
+        return false;
+    }
+
+    for (unsigned int y = top; y <= bottom; y++) {
+        BUG_ON(screen->touched[y]);
+    }
+
+    // ECMA-48 SU (CSI Pn S) or SD (CSI Pn T), within a region set by
+    // DECSTBM (CSI Pt ; Pb r), followed by DECSTBM without parameters
+    // to reset the region to the whole screen
+    const size_t maxlen = STRLEN("E[;rE[SE[r") + (3 * DECIMAL_STR_MAX(n));
+    char *buf = term_output_reserve_space(obuf, maxlen);
+    size_t i = copyliteral(buf, "\033[");
+    i += buf_uint_to_str(top + 1, buf + i);
+    buf[i++] = ';';
+    i += buf_uint_to_str(bottom + 1, buf + i);
+    i += copyliteral(buf + i, "r\033[");
+    i += buf_uint_to_str(n, buf + i);
+    buf[i++] = (delta > 0) ? 'S' : 'T';
+    i += copyliteral(buf + i, "\033[r");
+    BUG_ON(i > maxlen);
+    obuf->count += i;
+
+    // Rotate the rows in the region and invalidate the exposed rows
+    // (the terminal fills them with blanks, but possibly not in the
+    // style that would be used by screen_emit_erase())
+    TermCell **rows = screen->front;
+    unsigned int split = (delta > 0) ? top + n : bottom + 1 - n;
+    reverse_rows(rows, top, split);
+    reverse_rows(rows, split, bottom + 1);
+    reverse_rows(rows, top, bottom + 1);
+
+    unsigned int exposed = (delta > 0) ? bottom + 1 - n : top;
+    for (unsigned int y = exposed, end = exposed + n; y < end; y++) {
+        for (size_t x = 0, w = screen->width; x < w; x++) {
+            cell_invalidate(&rows[y][x]);
+        }
+    }
+
+    return true;
+}
+
+void term_screen_end_update(Terminal *term)
+{
+    TermOutputBuffer *obuf = &term->obuf;
+    TermScreen *screen = &obuf->screen;
+    BUG_ON(!screen->active);
+    screen->active = false;
+
+    // Restore the style actually active in the terminal, which is then
+    // kept updated by screen_emit_style() → put_sgr()
+    obuf->style = screen->style;
+
+    ScreenEmitter em = {.term = term, .x = UINT_MAX, .y = UINT_MAX};
+    for (size_t y = 0, h = screen->height; y < h; y++) {
+        if (!screen->touched[y]) {
+            continue;
+        }
+        screen_emit_row(&em, y);
+        TermCell *tmp = screen->front[y];
+        screen->front[y] = screen->back[y];
+        screen->back[y] = tmp;
+        screen->touched[y] = false;
+    }
 }
 
 static void cursor_style_normalize(TermCursorStyle *s)
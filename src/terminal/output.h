@@ -53,7 +53,7 @@ enum {
 
 static inline size_t obuf_avail(TermOutputBuffer *obuf)
 {
-    return TERM_OUTBUF_SIZE - obuf->count;
+    return obuf->alloc - obuf->count;
 }
 
 char *term_output_reserve_space(TermOutputBuffer *obuf, size_t count) NONNULL_ARGS_AND_RETURN WARN_UNUSED_RESULT;
@@ -77,9 +77,15 @@ bool term_can_clear_eol_with_el_sequence(const Terminal *term) NONNULL_ARGS;
 int term_clear_eol(Terminal *term) NONNULL_ARGS;
 void term_clear_screen(TermOutputBuffer *obuf) NONNULL_ARGS;
 void term_output_flush(TermOutputBuffer *obuf) NOINLINE NONNULL_ARGS;
+void term_output_free(TermOutputBuffer *obuf) NONNULL_ARGS;
 bool term_put_char(TermOutputBuffer *obuf, CodePoint u) NONNULL_ARGS;
+bool term_put_ascii(TermOutputBuffer *obuf, const char *str, size_t len) NONNULL_ARGS;
 void term_set_style(Terminal *term, TermStyle style) NONNULL_ARGS;
 void term_set_cursor_style(Terminal *term, TermCursorStyle style) NONNULL_ARGS;
+void term_screen_begin_update(Terminal *term) NONNULL_ARGS;
+void term_screen_end_update(Terminal *term) NONNULL_ARGS;
+bool term_screen_scroll(Terminal *term, unsigned int top, unsigned int bottom, int delta) NONNULL_ARGS;
+void term_screen_free(TermScreen *screen) NONNULL_ARGS;
 KeyCode term_handle_query_reply(Terminal *term, TermFeatureFlags detected) NONNULL_ARGS;
 
 #endif
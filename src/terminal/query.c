@@ -230,6 +230,11 @@ static KeyCode parse_xtgettcap_reply(StringView seq, bool valid_request)
         if (strview_equal_cstring(cap, "rep") && strview_has_suffix(val, "b")) {
             return tflag(TFLAG_ECMA48_REPEAT);
         }
+        if (strview_equal_cstring(cap, "indn") && strview_has_suffix(val, "S")) {
+            // Terminals with an ECMA-48 SU sequence for "indn" (scroll
+            // forward by N lines) also support DECSTBM ("csr")
+            return tflag(TFLAG_SCROLL_REGION);
+        }
         if (strview_equal_cstring(cap, "Ms") && val.length >= 6) {
             // All 71 entries with this cap in the ncurses terminfo database
             // use OSC 52, with only slight differences (BEL vs. ST), so
@@ -316,6 +321,7 @@ static KeyCode parse_xtversion_reply(StringView reply)
     if (strview_has_prefix(reply, "XTerm(")) {
         return tflag (
             TFLAG_QUERY_L3 | TFLAG_ECMA48_REPEAT | TFLAG_MODIFY_OTHER_KEYS
+            | TFLAG_SCROLL_REGION
         );
     }
 
@@ -330,7 +336,7 @@ static KeyCode parse_xtversion_reply(StringView reply)
         return tflag (
             TFLAG_TRUE_COLOR | TFLAG_BACK_COLOR_ERASE | TFLAG_ECMA48_REPEAT
             | TFLAG_SET_WINDOW_TITLE | TFLAG_OSC52_COPY | TFLAG_SYNC
-            | TFLAG_BS_CTRL_BACKSPACE
+            | TFLAG_BS_CTRL_BACKSPACE | TFLAG_SCROLL_REGION
         );
     }
 
@@ -348,7 +354,7 @@ static KeyCode parse_xtversion_reply(StringView reply)
         // TODO: Set TFLAG_SYNC for tmux 3.4+ (tmux doesn't support DECRQM)
         return tflag (
             TFLAG_NO_QUERY_L3 | TFLAG_ECMA48_REPEAT | TFLAG_MODIFY_OTHER_KEYS
-            | TFLAG_BS_CTRL_BACKSPACE
+            | TFLAG_BS_CTRL_BACKSPACE | TFLAG_SCROLL_REGION
         );
     }
 
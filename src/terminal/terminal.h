@@ -8,10 +8,14 @@
 #include "key.h"
 #include "style.h"
 #include "util/macros.h"
+#include "util/string.h"
 
 enum {
     TERM_INBUF_SIZE = 4096,
-    TERM_OUTBUF_SIZE = 8192,
+    TERM_OUTBUF_SIZE = 8192, // Initial size of TermOutputBuffer::buf
+    TERM_OUTBUF_MAX = 4 << 20, // Size at which TermOutputBuffer::buf is flushed early
+    TERM_CELL_INLINE_MAX = 16, // See TermCell::glyph
+    TERM_CELL_INVALID = 0xFF, // See TermCell::width
 };
 
 typedef enum {
@@ -37,12 +41,43 @@ typedef enum {
     TAB_CONTROL, // Render tabs like other control characters ("^I")
 } TermTabOutputMode;
 
+// A single character cell in a TermScreen grid. The UTF-8 bytes of the
+// whole glyph are stored (instead of a single codepoint), so that base
+// characters followed by combining characters can be reproduced exactly.
+typedef struct {
+    TermStyle style;
+    uint8_t width; // 1, 2, 0 (right half of a double-width glyph) or TERM_CELL_INVALID (unknown)
+    uint8_t len; // Number of bytes in `glyph`
+    union {
+        char bytes[TERM_CELL_INLINE_MAX]; // Used if `len <= TERM_CELL_INLINE_MAX`
+        char *ptr; // Used if `len > TERM_CELL_INLINE_MAX` (malloc'd)
+    } glyph;
+} TermCell;
+
+// A double-buffered grid of cells, used to compare each screen update
+// with the previous one and emit only the cells that changed (see
+// term_screen_begin_update() and term_screen_end_update())
+typedef struct {
+    TermCell **front; // Rows of cells currently displayed by the terminal
+    TermCell **back; // Rows of cells drawn during the current update
+    TermCell *cells; // Memory backing `front` and `back`
+    bool *touched; // Rows of `back` that were drawn to in the current update
+    unsigned int width;
+    unsigned int height;
+    unsigned int x; // Column of the next cell to be drawn to
+    unsigned int y; // Row of the next cell to be drawn to
+    bool active; // Whether drawing is currently redirected to `back`
+    bool invalid; // Whether `front` no longer reflects the terminal contents
+    TermStyle style; // The style active in the terminal, while `active` is true
+} TermScreen;
+
 typedef struct {
     // Current x position (tab: 1-8, double-width: 2, invalid UTF-8 byte: 4)
     // if smaller than scroll_x, printed characters are not visible
     size_t x;
     size_t scroll_x; // Number of characters scrolled (x direction)
     unsigned int count; // Number of buffered bytes (see term_output_flush())
+    unsigned int alloc; // Allocated size of `buf` (see term_output_reserve_space())
     unsigned int width; // Width of terminal area being written to (see term_output_reset())
     uint8_t tab_mode; // See TermTabOutputMode
     uint8_t tab_width; // See LocalOptions::tab_width
@@ -50,7 +85,11 @@ typedef struct {
     bool sync_pending; // See TFLAG_SYNC and term_end_sync_update()
     TermStyle style; // The style currently active in the terminal
     TermCursorStyle cursor_style; // The cursor style currently active in the terminal
-    char buf[TERM_OUTBUF_SIZE]; // Buffer contents
+    TermScreen screen; // See term_screen_begin_update()
+    String *sink; // If non-NULL, output is appended here instead of being written to stdout
+    size_t nr_written; // Total number of bytes written to the terminal
+    size_t nr_flushes; // Total number of writes to the terminal
+    char *buf; // Buffer contents
 } TermOutputBuffer;
 
 typedef struct {
@@ -0,0 +1,169 @@
+#include <inttypes.h>
+#include <stdlib.h>
+#include <time.h>
+#include "timing.h"
+#include "util/arith.h"
+#include "util/array.h"
+#include "util/debug.h"
+#include "util/time-util.h"
+
+enum {
+    // Number of main_loop() iterations kept for dump_timing()
+    TIMING_HISTORY_SIZE = 512,
+};
+
+typedef struct {
+    TimingSample current; // Iteration currently in progress
+    TimingSample history[TIMING_HISTORY_SIZE]; // Ring buffer of past iterations
+    size_t next; // Index of next `history` entry to be overwritten
+    size_t count; // Number of valid `history` entries
+} TimingState;
+
+// Upper bounds (in microseconds) of the histogram buckets shown by
+// dump_timing(), excluding the final (unbounded) bucket
+static const uint32_t bucket_limits[] = {10, 100, 1000, 10000, 100000};
+
+static const char bucket_labels[][8] = {
+    "<10us", "<100us", "<1ms", "<10ms", "<100ms", ">=100ms"
+};
+
+static_assert(ARRAYLEN(bucket_labels) == ARRAYLEN(bucket_limits) + 1);
+
+static const char stage_names[NR_TIMING_STAGES][10] = {
+    [TIMING_INPUT] = "input",
+    [TIMING_COMMAND] = "command",
+    [TIMING_HIGHLIGHT] = "highlight",
+    [TIMING_RENDER] = "render",
+    [TIMING_FLUSH] = "flush",
+    [TIMING_TOTAL] = "total",
+};
+
+UNITTEST {
+    CHECK_STRING_ARRAY(stage_names);
+}
+
+bool timing_enabled = false;
+static TimingState timing;
+
+void timing_enable(void)
+{
+    timing_enabled = true;
+}
+
+const char *timing_stage_name(TimingStage stage)
+{
+    BUG_ON(stage >= ARRAYLEN(stage_names));
+    return stage_names[stage];
+}
+
+uint64_t timing_now(void)
+{
+    struct timespec ts;
+    if (unlikely(!xgettime(&ts))) {
+        return 0;
+    }
+    return ((uint64_t)ts.tv_sec * NS_PER_SECOND) + (uint64_t)ts.tv_nsec;
+}
+
+void timing_add(TimingStage stage, uint64_t start)
+{
+    BUG_ON(stage >= NR_TIMING_STAGES);
+    uint64_t end = timing_now();
+    uint64_t ns = (end > start) ? end - start : 0;
+    uint32_t *total = &timing.current.ns[stage];
+    *total = MIN(*total + ns, UINT32_MAX);
+}
+
+const TimingSample *timing_end_update(uint64_t start)
+{
+    timing_add(TIMING_TOTAL, start);
+    TimingSample *sample = &timing.history[timing.next];
+    *sample = timing.current;
+    timing.current = (TimingSample){.ns = {0}};
+    timing.next = (timing.next + 1) % TIMING_HISTORY_SIZE;
+    timing.count = MIN(timing.count + 1, TIMING_HISTORY_SIZE);
+    return sample;
+}
+
+static int u32_cmp(const void *ap, const void *bp)
+{
+    const uint32_t *a = ap;
+    const uint32_t *b = bp;
+    return (*a > *b) - (*a < *b);
+}
+
+static uint32_t ns_to_us(uint64_t ns)
+{
+    return ns / 1000;
+}
+
+static void dump_stage(String *buf, TimingStage stage, uint32_t *values)
+{
+    size_t buckets[ARRAYLEN(bucket_labels)] = {0};
+    uint64_t sum = 0;
+    size_t n = 0;
+
+    for (size_t i = 0; i < timing.count; i++) {
+        uint32_t ns = timing.history[i].ns[stage];
+        if (ns == 0) {
+            // Stage didn't run during this iteration
+            continue;
+        }
+        uint32_t us = ns_to_us(ns);
+        size_t b = 0;
+        while (b < ARRAYLEN(bucket_limits) && us >= bucket_limits[b]) {
+            b++;
+        }
+        buckets[b]++;
+        values[n++] = ns;
+        sum += ns;
+    }
+
+    string_sprintf(buf, "%-10s %6zu", timing_stage_name(stage), n);
+    if (n == 0) {
+        string_append_literal(buf, "       -       -       -       -");
+    } else {
+        qsort(values, n, sizeof(values[0]), u32_cmp);
+        string_sprintf (
+            buf,
+            " %7" PRIu32 " %7" PRIu32 " %7" PRIu32 " %7" PRIu32,
+            ns_to_us(sum / n),
+            ns_to_us(values[(n - 1) * 50 / 100]),
+            ns_to_us(values[(n - 1) * 95 / 100]),
+            ns_to_us(values[n - 1])
+        );
+    }
+
+    for (size_t i = 0; i < ARRAYLEN(buckets); i++) {
+        string_sprintf(buf, " %7zu", buckets[i]);
+    }
+    string_append_byte(buf, '\n');
+}
+
+String dump_timing(void)
+{
+    String buf = string_new(2048);
+    if (!timing_enabled) {
+        string_append_literal(&buf, "Timing disabled (set $DTE_LOG_TIMING to enable)\n");
+        return buf;
+    }
+
+    string_sprintf (
+        &buf,
+        "Screen update timing (last %zu updates; times in microseconds)\n\n"
+        "# stage     count    mean     p50     p95     max",
+        timing.count
+    );
+
+    for (size_t i = 0; i < ARRAYLEN(bucket_labels); i++) {
+        string_sprintf(&buf, " %7s", bucket_labels[i]);
+    }
+    string_append_byte(&buf, '\n');
+
+    uint32_t values[TIMING_HISTORY_SIZE];
+    for (TimingStage stage = 0; stage < NR_TIMING_STAGES; stage++) {
+        dump_stage(&buf, stage, values);
+    }
+
+    return buf;
+}
@@ -0,0 +1,51 @@
+#ifndef TIMING_H
+#define TIMING_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "util/macros.h"
+#include "util/string.h"
+
+// Stages of a main_loop() iteration that are timed separately, when
+// timing is enabled. Some stages are nested within others (e.g. the
+// time spent in TIMING_COMMAND is also part of TIMING_INPUT and the
+// TIMING_HIGHLIGHT time is also part of TIMING_RENDER).
+typedef enum {
+    TIMING_INPUT, // handle_input()
+    TIMING_COMMAND, // parse_commands() and parse_args()
+    TIMING_HIGHLIGHT, // hl_fill_start_states()
+    TIMING_RENDER, // update_range()
+    TIMING_FLUSH, // term_output_flush() in end_update()
+    TIMING_TOTAL, // Whole main_loop() iteration
+    NR_TIMING_STAGES
+} TimingStage;
+
+// Nanoseconds spent in each TimingStage, for a single main_loop() iteration
+typedef struct {
+    uint32_t ns[NR_TIMING_STAGES];
+} TimingSample;
+
+extern bool timing_enabled;
+
+uint64_t timing_now(void);
+void timing_add(TimingStage stage, uint64_t start);
+void timing_enable(void);
+const TimingSample *timing_end_update(uint64_t start) RETURNS_NONNULL;
+const char *timing_stage_name(TimingStage stage) RETURNS_NONNULL;
+String dump_timing(void);
+
+// Returns a start time for timing_stop(), or 0 if timing is disabled.
+// The fast path costs only a (well predicted) branch when disabled.
+static inline uint64_t timing_start(void)
+{
+    return unlikely(timing_enabled) ? timing_now() : 0;
+}
+
+static inline void timing_stop(TimingStage stage, uint64_t start)
+{
+    if (unlikely(start)) {
+        timing_add(stage, start);
+    }
+}
+
+#endif
@@ -2,6 +2,7 @@
 #include "indent.h"
 #include "selection.h"
 #include "syntax/highlight.h"
+#include "timing.h"
 #include "util/ascii.h"
 #include "util/debug.h"
 #include "util/utf8.h"
@@ -21,6 +22,7 @@ typedef struct {
     size_t indent_size;
     size_t trailing_ws_offset;
     const TermStyle **styles;
+    ColumnCache *column_cache; // See skip_to_column_checkpoint()
 } LineInfo;
 
 static void mask_selection_and_current_line (
@@ -138,6 +140,58 @@ static CodePoint screen_next_char (
     return u;
 }
 
+// Return the length of the run of printable ASCII characters starting
+// at `info->pos` that can all be printed with the same style as the
+// first, without any per-character masking (i.e. no control characters,
+// no whitespace errors and no selection boundaries inside the run)
+static size_t ascii_run_length(const LineInfo *info)
+{
+    const char *line = info->line;
+    const TermStyle **styles = info->styles;
+    const size_t start = info->pos;
+    const size_t indent_end = info->indent_size;
+    size_t end = MIN(info->size, info->trailing_ws_offset);
+
+    ssize_t offset = info->offset;
+    if (offset < info->sel_so) {
+        end = MIN(end, start + (info->sel_so - offset));
+    } else if (offset < info->sel_eo) {
+        end = MIN(end, start + (info->sel_eo - offset));
+    }
+
+    const TermStyle *style = styles ? styles[start] : NULL;
+    size_t i = start;
+    for (; i < end; i++) {
+        unsigned char ch = line[i];
+        if (ch < 0x20 || ch >= 0x7F || (ch == ' ' && i < indent_end)) {
+            break;
+        }
+        if (styles && styles[i] != style) {
+            break;
+        }
+    }
+
+    return i - start;
+}
+
+// Print a run of characters found by ascii_run_length(), with a single
+// style change and a single copy into the output buffer
+static bool print_ascii_run (
+    Terminal *term,
+    LineInfo *info,
+    const StyleMap *styles,
+    size_t len
+) {
+    size_t pos = info->pos;
+    bool have_style = info->styles && info->styles[pos];
+    TermStyle style = have_style ? *info->styles[pos] : styles->builtin[BSE_DEFAULT];
+    mask_selection_and_current_line(styles, info, &style);
+    set_style(term, styles, &style);
+    info->pos += len;
+    info->offset += len;
+    return term_put_ascii(&term->obuf, info->line + pos, len);
+}
+
 static void screen_skip_char(TermOutputBuffer *obuf, LineInfo *info)
 {
     CodePoint u = (unsigned char)info->line[info->pos++];
@@ -161,6 +215,27 @@ static void screen_skip_char(TermOutputBuffer *obuf, LineInfo *info)
     info->offset += info->pos - pos;
 }
 
+// Jump directly to the last ColumnCheckpoint that's before the region
+// skipped by the screen_skip_char() loop in print_line(), instead of
+// decoding every character before it
+static void skip_to_column_checkpoint(TermOutputBuffer *obuf, LineInfo *info)
+{
+    BUG_ON(info->pos != 0);
+    BUG_ON(obuf->x != 0);
+    BUG_ON(obuf->tab_mode == TAB_CONTROL); // See advance_columns()
+
+    const Buffer *buffer = info->view->buffer;
+    StringView line = string_view(info->line, info->size);
+    long x = (long)obuf->scroll_x - 8;
+    ColumnCheckpoint cp = column_cache_find_column (
+        info->column_cache, line, buffer->edit_count, obuf->tab_width, x
+    );
+
+    info->pos = cp.offset;
+    info->offset += cp.offset;
+    obuf->x = cp.cx_display;
+}
+
 static bool is_notice(const char *word, size_t len)
 {
     switch (len) {
@@ -309,6 +384,10 @@ static void print_line (
     // There can be a wide character (tab, control code etc.) that is
     // partially visible and can't be skipped using screen_skip_char().
     TermOutputBuffer *obuf = &term->obuf;
+    if (info->column_cache && info->size >= COLUMN_CACHE_INTERVAL) {
+        skip_to_column_checkpoint(obuf, info);
+    }
+
     while (obuf->x + 8 < obuf->scroll_x && info->pos < info->size) {
         screen_skip_char(obuf, info);
     }
@@ -319,8 +398,15 @@ static void print_line (
 
     while (info->pos < info->size) {
         BUG_ON(obuf->x > obuf->scroll_x + obuf->width);
-        CodePoint u = screen_next_char(term, info, styles, display_special);
-        if (!term_put_char(obuf, u)) {
+        size_t run = ascii_run_length(info);
+        bool fits;
+        if (run > 1) {
+            fits = print_ascii_run(term, info, styles, run);
+        } else {
+            CodePoint u = screen_next_char(term, info, styles, display_special);
+            fits = term_put_char(obuf, u);
+        }
+        if (!fits) {
             // +1 for newline
             info->offset += info->size - info->pos + 1;
             return;
@@ -346,7 +432,7 @@ static void print_line (
 
 void update_range (
     Terminal *term,
-    const View *view,
+    View *view,
     const StyleMap *styles,
     long y1,
     long y2,
@@ -356,6 +442,7 @@ void update_range (
     const int edit_y = view->window->edit_y;
     const int edit_w = view->window->edit_w;
     const int edit_h = view->window->edit_h;
+    const uint64_t start_time = timing_start();
 
     TermOutputBuffer *obuf = &term->obuf;
     term_output_reset(term, edit_x, edit_w, view->vx);
@@ -380,7 +467,15 @@ void update_range (
     Syntax *syn = view->buffer->syntax;
     PointerArray *lss = &view->buffer->line_start_states;
     BlockIter tmp = block_iter(view->buffer);
+    uint64_t hl_start_time = timing_start();
     hl_fill_start_states(syn, lss, styles, &tmp, info.line_nr);
+    timing_stop(TIMING_HIGHLIGHT, hl_start_time);
+
+    // Skipping the invisible part of each line with screen_skip_char()
+    // is cheap if the view is only scrolled a little, but on very long
+    // lines scrolled far to the right it's better to start from a cached
+    // ColumnCheckpoint (see print_line())
+    const bool use_column_caches = (obuf->scroll_x >= COLUMN_CACHE_INTERVAL);
     long i;
 
     for (i = y1; got_line && i < y2; i++) {
@@ -391,6 +486,9 @@ void update_range (
         bool next_changed;
         const TermStyle **hlstyles = hl_line(syn, lss, styles, line, info.line_nr, &next_changed);
         line_info_set_line(&info, line, hlstyles);
+        if (use_column_caches) {
+            info.column_cache = view_get_line_column_cache(view, info.line_nr);
+        }
         print_line(term, &info, styles, display_special);
 
         got_line = !!block_iter_next_line(&bi);
@@ -423,4 +521,6 @@ void update_range (
         term_put_char(obuf, '~');
         term_clear_eol(term);
     }
+
+    timing_stop(TIMING_RENDER, start_time);
 }
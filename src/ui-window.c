@@ -14,8 +14,9 @@ static void print_separator(Window *window, void* UNUSED_ARG(ud))
 
     const char sep = (e->options.window_separator == WINSEP_BAR) ? '|' : ' ';
     for (unsigned int y = window->y, n = y + window->h; y < n; y++) {
+        term_output_reset(term, x, 1, 0);
         term_move_cursor(obuf, x, y);
-        term_put_byte(obuf, sep);
+        term_put_char(obuf, sep);
     }
 }
 
@@ -53,11 +54,11 @@ static void update_line_numbers (
     window->lineno_last = last;
 
     TermOutputBuffer *obuf = &term->obuf;
-    char buf[DECIMAL_STR_MAX(vy) + 1];
+    char buf[DECIMAL_STR_MAX(vy) + 2];
     size_t width = window->lineno_width;
-    BUG_ON(width > sizeof(buf));
+    BUG_ON(width >= sizeof(buf));
     BUG_ON(width < LINE_NUMBERS_MIN_WIDTH);
-    term_output_reset(term, window->x, window->w, 0);
+    buf[width] = '\0';
     set_builtin_style(term, styles, BSE_LINENUMBER);
 
     for (int y = 0, h = window->edit_h, edit_y = window->edit_y; y < h; y++) {
@@ -69,8 +70,9 @@ static void update_line_numbers (
                 buf[i--] = (line % 10) + '0';
             } while (line /= 10);
         }
+        term_output_reset(term, x, width, 0);
         term_move_cursor(obuf, x, edit_y + y);
-        term_put_bytes(obuf, buf, width);
+        term_put_str(obuf, buf);
     }
 }
 
@@ -114,7 +116,7 @@ static void update_window (
         print_tabbar(term, styles, window);
     }
 
-    const View *view = window->view;
+    View *view = window->view;
     const Buffer *buffer = view->buffer;
     if (options->show_line_numbers) {
         // Force updating line numbers if all lines changed
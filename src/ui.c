@@ -5,6 +5,7 @@
 #include "syntax/syntax.h"
 #include "terminal/cursor.h"
 #include "terminal/ioctl.h"
+#include "timing.h"
 #include "util/log.h"
 #include "util/str-util.h"
 
@@ -97,6 +98,27 @@ static void restore_cursor (
     term_move_cursor(&term->obuf, x, y);
 }
 
+// Scroll the existing contents of the window's edit area in the terminal,
+// so that redrawing it only requires emitting the newly exposed lines
+static void scroll_window(Terminal *term, const Window *window, long delta)
+{
+    if (window->x != 0 || window->w != term->width) {
+        // DECSTBM scrolling regions always span the full terminal width
+        return;
+    }
+
+    long h = window->edit_h;
+    if (h <= 1 || delta <= -h || delta >= h) {
+        return;
+    }
+
+    unsigned int top = window->edit_y;
+    unsigned int bottom = top + h - 1;
+    if (term_screen_scroll(term, top, bottom, delta)) {
+        LOG_DEBUG("scrolled window by %ld lines", delta);
+    }
+}
+
 static void clear_update_tabbar(Window *window, void* UNUSED_ARG(data))
 {
     window->update_tabbar = false;
@@ -105,7 +127,9 @@ static void clear_update_tabbar(Window *window, void* UNUSED_ARG(data))
 static void end_update(Terminal *term, Buffer *buffer, const Frame *root_frame)
 {
     term_end_sync_update(term);
+    uint64_t start_time = timing_start();
     term_output_flush(&term->obuf);
+    timing_stop(TIMING_FLUSH, start_time);
 
     buffer->changed_line_min = LONG_MAX;
     buffer->changed_line_max = -1;
@@ -122,6 +146,7 @@ static void start_update(Terminal *term)
 {
     term_begin_sync_update(term);
     term_hide_cursor(term);
+    term_screen_begin_update(term);
 }
 
 void update_window_sizes(Terminal *term, Frame *frame)
@@ -182,6 +207,9 @@ void update_screen(EditorState *e, const ScreenState *s)
         view_update(view);
         if (s->id == buffer->id) {
             if (s->vx != view->vx || s->vy != view->vy) {
+                if (s->vx == view->vx) {
+                    scroll_window(term, e->window, view->vy - s->vy);
+                }
                 mark_all_lines_changed(buffer);
             } else {
                 // Because of trailing whitespace highlighting and highlighting
@@ -226,7 +254,11 @@ void update_screen(EditorState *e, const ScreenState *s)
 
     if (unlikely(flags & UPDATE_DIALOG)) {
         show_dialog(term, styles, e->err.buf);
-    } else {
+    }
+
+    term_screen_end_update(term);
+
+    if (likely(!(flags & UPDATE_DIALOG))) {
         restore_cursor(term, view, is_normal_mode, cmdline_x);
         term_show_cursor(term);
     }
@@ -66,7 +66,7 @@ void update_status_line(const Window *window);
 // ui-view.c
 void update_range (
     Terminal *term,
-    const View *view,
+    View *view,
     const StyleMap *styles,
     long y1,
     long y2,
@@ -0,0 +1,96 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include "undo-journal.h"
+#include "util/debug.h"
+#include "util/log.h"
+#include "util/path.h"
+#include "util/xreadwrite.h"
+#include "util/xsnprintf.h"
+
+static bool open_journal(UndoJournal *journal, const char *dir)
+{
+    char name[64];
+    xsnprintf(name, sizeof name, "undo-journal.%jd", (intmax_t)getpid());
+    char *path = path_join(dir, name);
+
+    // Any existing file with this name was left behind by a process that
+    // no longer exists (or it'd have been unlinked), so it's simply
+    // truncated
+    int flags = O_RDWR | O_CREAT | O_TRUNC | O_APPEND | O_CLOEXEC;
+    int fd = xopen(path, flags, 0600);
+    if (unlikely(fd < 0)) {
+        LOG_ERRNO("undo journal open");
+        free(path);
+        return false;
+    }
+
+    if (unlikely(unlink(path) != 0)) {
+        LOG_ERRNO("undo journal unlink");
+    }
+
+    LOG_INFO("opened undo journal: %s", path);
+    free(path);
+    journal->fd = fd;
+    journal->size = 0;
+    return true;
+}
+
+// Append `len` bytes to the journal (opening it first, if needed) and
+// store the offset at which they were written in `*offset`
+bool undo_journal_append(UndoJournal *journal, const char *dir, const char *buf, size_t len, uint64_t *offset)
+{
+    BUG_ON(len == 0);
+    if (journal->failed) {
+        return false;
+    }
+
+    if (journal->fd < 0 && !open_journal(journal, dir)) {
+        journal->failed = true;
+        return false;
+    }
+
+    ssize_t n = xwrite_all(journal->fd, buf, len);
+    if (unlikely(n < 0 || (size_t)n != len)) {
+        LOG_ERRNO("undo journal write");
+        // Any partially written data is simply left unused
+        journal->size += MAX(n, 0);
+        journal->failed = true;
+        return false;
+    }
+
+    *offset = journal->size;
+    journal->size += len;
+    return true;
+}
+
+// Read `len` bytes at `offset`, as previously written by undo_journal_append()
+bool undo_journal_read(const UndoJournal *journal, uint64_t offset, char *buf, size_t len)
+{
+    BUG_ON(journal->fd < 0);
+    BUG_ON(offset + len > journal->size);
+
+    for (size_t pos = 0; pos < len; ) {
+        ssize_t n = pread(journal->fd, buf + pos, len - pos, (off_t)(offset + pos));
+        if (unlikely(n <= 0)) {
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            LOG_ERRNO("undo journal pread");
+            return false;
+        }
+        pos += n;
+    }
+
+    return true;
+}
+
+void undo_journal_close(UndoJournal *journal)
+{
+    if (journal->fd >= 0) {
+        xclose(journal->fd);
+    }
+    *journal = (UndoJournal)UNDO_JOURNAL_INIT;
+}
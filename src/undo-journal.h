@@ -0,0 +1,30 @@
+#ifndef UNDO_JOURNAL_H
+#define UNDO_JOURNAL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "util/macros.h"
+
+// An append-only file, to which the deleted text of old Changes is moved
+// once the `undo-memory-limit` option is exceeded, so that it can later
+// be read back by undo/redo. The file is created (in $DTE_HOME) on first
+// use and then immediately unlinked, so that it never outlives the
+// editor process, even if it crashes.
+typedef struct {
+    int fd; // File descriptor (or -1, if not yet opened)
+    bool failed; // Opening or writing the file failed (and won't be retried)
+    uint64_t size; // Number of bytes written to the file
+} UndoJournal;
+
+#define UNDO_JOURNAL_INIT { \
+    .fd = -1, \
+    .failed = false, \
+    .size = 0, \
+}
+
+bool undo_journal_append(UndoJournal *journal, const char *dir, const char *buf, size_t len, uint64_t *offset) NONNULL_ARGS WARN_UNUSED_RESULT;
+bool undo_journal_read(const UndoJournal *journal, uint64_t offset, char *buf, size_t len) NONNULL_ARGS WARN_UNUSED_RESULT;
+void undo_journal_close(UndoJournal *journal) NONNULL_ARGS;
+
+#endif
@@ -1,29 +1,39 @@
 #include "build-defs.h"
 #include <errno.h>
+#include <fcntl.h>
 #include <signal.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sys/wait.h>
 #include <unistd.h>
+#if HAVE_POSIX_SPAWN
+# include <spawn.h>
+#endif
 #include "fork-exec.h"
 #include "debug.h"
+#include "environ.h"
 #include "fd.h"
 #include "log.h"
 #include "numtostr.h"
 #include "terminal/ioctl.h"
+#include "xmalloc.h"
 #include "xreadwrite.h"
+#include "xsnprintf.h"
+
+// Signals ignored by set_basic_signal_dispositions(), which need to be
+// reset to SIG_DFL in child processes. Note that handled signals don't
+// need to be restored, since they're necessarily and automatically
+// reset after exec(3p).
+static const int ignored_signals[] = {
+    SIGINT, SIGQUIT, SIGTSTP,
+    SIGTTIN, SIGTTOU, SIGXFSZ,
+    SIGPIPE, SIGUSR1, SIGUSR2,
+};
 
 // Reset ignored signal dispositions (i.e. as originally set up by
 // set_basic_signal_dispositions()) to SIG_DFL
 static bool reset_ignored_signals(void)
 {
-    // Note that handled signals don't need to be restored here, since
-    // they're necessarily and automatically reset after exec(3p)
-    static const int ignored_signals[] = {
-        SIGINT, SIGQUIT, SIGTSTP,
-        SIGTTIN, SIGTTOU, SIGXFSZ,
-        SIGPIPE, SIGUSR1, SIGUSR2,
-    };
-
     struct sigaction action = {.sa_handler = SIG_DFL};
     if (unlikely(sigemptyset(&action.sa_mask) != 0)) {
         return false;
@@ -49,7 +59,13 @@ static noreturn void child_process_exec (
     bool drop_ctty
 ) {
     if (drop_ctty) {
-        term_drop_controlling_tty(STDIN_FILENO);
+        // Start a new session (and process group), which has no controlling
+        // terminal, as done by POSIX_SPAWN_SETSID in spawn_exec(). This can
+        // only fail if the caller is already a process group leader, which
+        // a newly forked child never is.
+        if (unlikely(setsid() == -1)) {
+            term_drop_controlling_tty(STDIN_FILENO);
+        }
     }
 
     for (int i = STDIN_FILENO; i <= STDERR_FILENO; i++) {
@@ -88,6 +104,153 @@ static pid_t xwaitpid(pid_t pid, int *status, int options)
     return ret;
 }
 
+// Check whether the posix_spawnp(3) path in spawn_exec() can be used
+// for the given arguments, or if fork_exec() must fall back to fork(3)
+static bool can_use_posix_spawn(const int fd[3], bool drop_ctty)
+{
+    if (!HAVE_POSIX_SPAWN || (drop_ctty && !HAVE_POSIX_SPAWN_SETSID)) {
+        return false;
+    }
+
+    for (int i = STDIN_FILENO; i <= STDERR_FILENO; i++) {
+        // Standard streams passed through unchanged are expected to not
+        // have FD_CLOEXEC set, since there's no portable file action for
+        // clearing it (see also: child_process_exec())
+        if (fd[i] == i) {
+            int flags = fcntl(i, F_GETFD);
+            if (unlikely(flags < 0 || (flags & FD_CLOEXEC))) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+// Copy environ(7) for passing to posix_spawnp(3), with each `VAR=value`
+// string in `vars` replacing any existing variable of the same name
+static char **new_child_environ(char *const *vars, size_t nr_vars)
+{
+    size_t n = 0;
+    while (environ[n]) {
+        n++;
+    }
+
+    char **env = xmallocarray(n + nr_vars + 1, sizeof(*env));
+    size_t j = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        char *var = environ[i];
+        bool replaced = false;
+        for (size_t k = 0; k < nr_vars && !replaced; k++) {
+            size_t name_len = strcspn(vars[k], "=") + 1;
+            replaced = (strncmp(var, vars[k], name_len) == 0);
+        }
+        if (!replaced) {
+            env[j++] = var;
+        }
+    }
+
+    for (size_t k = 0; k < nr_vars; k++) {
+        env[j++] = vars[k];
+    }
+
+    env[j] = NULL;
+    return env;
+}
+
+// Equivalent to the fork(3) path of fork_exec(), but using posix_spawnp(3),
+// which (on most platforms) avoids copying the page tables of the parent
+// process and so has much lower latency when the editor has a large RSS.
+// Pre-exec errors are returned directly by posix_spawnp(3), which takes
+// the place of the "error pipe" used by child_process_exec().
+static pid_t spawn_exec (
+    const char **argv,
+    const int fd[3],
+    unsigned int lines,
+    unsigned int columns,
+    bool drop_ctty
+) {
+#if HAVE_POSIX_SPAWN
+    char lines_var[32], columns_var[32];
+    char *vars[2];
+    size_t nr_vars = 0;
+    if (lines) {
+        xsnprintf(lines_var, sizeof lines_var, "LINES=%u", lines);
+        vars[nr_vars++] = lines_var;
+    }
+    if (columns) {
+        xsnprintf(columns_var, sizeof columns_var, "COLUMNS=%u", columns);
+        vars[nr_vars++] = columns_var;
+    }
+
+    posix_spawn_file_actions_t actions;
+    int err = posix_spawn_file_actions_init(&actions);
+    if (unlikely(err)) {
+        errno = err;
+        return -1;
+    }
+
+    posix_spawnattr_t attr;
+    err = posix_spawnattr_init(&attr);
+    if (unlikely(err)) {
+        posix_spawn_file_actions_destroy(&actions);
+        errno = err;
+        return -1;
+    }
+
+    // All fds other than the standard streams are opened with O_CLOEXEC,
+    // so only the remapping needs to be done here
+    for (int i = STDIN_FILENO; i <= STDERR_FILENO && !err; i++) {
+        if (fd[i] != i) {
+            err = posix_spawn_file_actions_adddup2(&actions, fd[i], i);
+        }
+    }
+
+    sigset_t sigdefault;
+    sigemptyset(&sigdefault);
+    for (size_t i = 0; i < ARRAYLEN(ignored_signals); i++) {
+        sigaddset(&sigdefault, ignored_signals[i]);
+    }
+
+    short flags = POSIX_SPAWN_SETSIGDEF;
+    #if HAVE_POSIX_SPAWN_SETSID
+        // A new session has no controlling terminal and also puts the
+        // child in a new process group, as with child_process_exec()
+        flags |= drop_ctty ? POSIX_SPAWN_SETSID : 0;
+    #endif
+
+    err = err ? err : posix_spawnattr_setsigdefault(&attr, &sigdefault);
+    err = err ? err : posix_spawnattr_setflags(&attr, flags);
+
+    pid_t pid = -1;
+    if (likely(!err)) {
+        char **env = nr_vars ? new_child_environ(vars, nr_vars) : environ;
+        err = posix_spawnp(&pid, argv[0], &actions, &attr, (char**)argv, env);
+        if (env != environ) {
+            free(env);
+        }
+    }
+
+    posix_spawnattr_destroy(&attr);
+    posix_spawn_file_actions_destroy(&actions);
+    if (unlikely(err)) {
+        errno = err;
+        return -1;
+    }
+    return pid;
+#endif
+
+    (void)argv;
+    (void)fd;
+    (void)lines;
+    (void)columns;
+    (void)drop_ctty;
+    (void)new_child_environ;
+    errno = ENOSYS;
+    return -1;
+}
+
 pid_t fork_exec (
     const char **argv,
     int fd[3],
@@ -95,6 +258,14 @@ pid_t fork_exec (
     unsigned int columns,
     bool drop_ctty
 ) {
+    BUG_ON(fd[0] <= STDERR_FILENO && fd[0] != 0);
+    BUG_ON(fd[1] <= STDERR_FILENO && fd[1] != 1);
+    BUG_ON(fd[2] <= STDERR_FILENO && fd[2] != 2);
+
+    if (can_use_posix_spawn(fd, drop_ctty)) {
+        return spawn_exec(argv, fd, lines, columns, drop_ctty);
+    }
+
     // Create an "error pipe" before forking, so that child_process_exec()
     // can signal pre-exec errors and allow the parent differentiate them
     // from a successful exec(3) with a non-zero exit status
@@ -105,9 +276,6 @@ pid_t fork_exec (
 
     BUG_ON(ep[0] <= STDERR_FILENO);
     BUG_ON(ep[1] <= STDERR_FILENO);
-    BUG_ON(fd[0] <= STDERR_FILENO && fd[0] != 0);
-    BUG_ON(fd[1] <= STDERR_FILENO && fd[1] != 1);
-    BUG_ON(fd[2] <= STDERR_FILENO && fd[2] != 2);
 
     const pid_t pid = fork();
     if (unlikely(pid == -1)) {
@@ -145,13 +313,8 @@ pid_t fork_exec (
     return -1;
 }
 
-int wait_child(pid_t pid)
+static int decode_wait_status(int status)
 {
-    int status;
-    if (unlikely(xwaitpid(pid, &status, 0) < 0)) {
-        return -errno;
-    }
-
     if (likely(WIFEXITED(status))) {
         return WEXITSTATUS(status) & 0xFF;
     }
@@ -163,3 +326,24 @@ int wait_child(pid_t pid)
     LOG_ERROR("unhandled waitpid() status: %d", status);
     return -EINVAL;
 }
+
+int wait_child(pid_t pid)
+{
+    int status;
+    if (unlikely(xwaitpid(pid, &status, 0) < 0)) {
+        return -errno;
+    }
+    return decode_wait_status(status);
+}
+
+// Like wait_child(), but return -EAGAIN immediately if the child
+// process hasn't exited yet
+int try_wait_child(pid_t pid)
+{
+    int status;
+    pid_t ret = xwaitpid(pid, &status, WNOHANG);
+    if (unlikely(ret < 0)) {
+        return -errno;
+    }
+    return (ret == 0) ? -EAGAIN : decode_wait_status(status);
+}
@@ -15,5 +15,6 @@ pid_t fork_exec (
 );
 
 int wait_child(pid_t pid) WARN_UNUSED_RESULT;
+int try_wait_child(pid_t pid) WARN_UNUSED_RESULT;
 
 #endif
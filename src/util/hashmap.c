@@ -253,3 +253,17 @@ void hashmap_free(HashMap *map, FreeFunction free_value)
     free(map->entries);
     *map = (HashMap){.flags = map->flags};
 }
+
+// Return the number of bytes allocated for the table and keys of `map`
+// (excluding borrowed keys and all values, which are owned by the caller)
+size_t hashmap_memory_usage(const HashMap *map)
+{
+    size_t size = map->entries ? (map->mask + 1) * sizeof(map->entries[0]) : 0;
+    if (map->flags & HMAP_BORROWED_KEYS) {
+        return size;
+    }
+    for (HashMapIter it = hashmap_iter(map); hashmap_next(&it); ) {
+        size += strlen(it.entry->key) + 1;
+    }
+    return size;
+}
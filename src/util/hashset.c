@@ -55,6 +55,16 @@ void hashset_free(HashSet *set)
     free(set->table);
 }
 
+// Return the number of bytes allocated for the table and entries of `set`
+size_t hashset_memory_usage(const HashSet *set)
+{
+    size_t size = set->table_size * sizeof(set->table[0]);
+    for (HashSetIter it = hashset_iter(set); hashset_next(&it); ) {
+        size += sizeof(HashSetEntry) + it.entry->str_len + 1;
+    }
+    return size;
+}
+
 static size_t get_slot(const HashSet *set, const char *str, size_t str_len)
 {
     const size_t hash = set->hash(str, str_len);
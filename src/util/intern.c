@@ -20,6 +20,11 @@ bool mem_is_intern(const void *data, size_t len)
     return entry && entry->str == data;
 }
 
+const HashSet *get_interned_strings(void)
+{
+    return &interned_strings;
+}
+
 void free_interned_strings(void)
 {
     hashset_free(&interned_strings);
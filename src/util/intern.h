@@ -4,11 +4,13 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include <string.h>
+#include "hashset.h"
 #include "macros.h"
 #include "string-view.h"
 
 const void *mem_intern(const void *data, size_t len) NONNULL_ARGS_AND_RETURN WARN_UNUSED_RESULT;
 bool mem_is_intern(const void *data, size_t len) WARN_UNUSED_RESULT;
+const HashSet *get_interned_strings(void) RETURNS_NONNULL;
 void free_interned_strings(void);
 
 static inline const char *str_intern(const char *str)
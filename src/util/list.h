@@ -45,4 +45,21 @@ static inline bool list_empty(const ListHead *head)
     return head->next == head;
 }
 
+// Move all entries of `list` to before `item` (in the same order),
+// leaving `list` empty
+static inline void list_splice_before(ListHead *list, ListHead *item)
+{
+    if (list_empty(list)) {
+        return;
+    }
+    ListHead *first = list->next;
+    ListHead *last = list->prev;
+    ListHead *prev = item->prev;
+    prev->next = first;
+    first->prev = prev;
+    last->next = item;
+    item->prev = last;
+    list_init(list);
+}
+
 #endif
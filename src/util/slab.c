@@ -0,0 +1,153 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "slab.h"
+#include "align.h"
+#include "bit.h"
+#include "debug.h"
+
+#if ASAN_ENABLED == 1
+    #include <sanitizer/asan_interface.h>
+    #define POISON(addr, size) ASAN_POISON_MEMORY_REGION(addr, size)
+    #define UNPOISON(addr, size) ASAN_UNPOISON_MEMORY_REGION(addr, size)
+#else
+    #define POISON(addr, size) ((void)(addr), (void)(size))
+    #define UNPOISON(addr, size) ((void)(addr), (void)(size))
+#endif
+
+typedef struct Slab {
+    ListHead node; // Link in SlabPool::partial (if not full or empty)
+    void *free; // Free list of previously used objects
+    char *unused; // Start of never used objects (at the end of the slab)
+    size_t nr_used; // Number of objects in use
+} Slab;
+
+#define SLAB_HEADER_SIZE next_multiple(sizeof(Slab), ALIGNOF(union MaxAlign))
+
+static_assert(IS_POWER_OF_2(SLAB_SIZE));
+static_assert(offsetof(Slab, node) == 0);
+
+static Slab *slab_of(const void *ptr)
+{
+    return (Slab*)((uintptr_t)ptr & ~(uintptr_t)(SLAB_SIZE - 1));
+}
+
+static char *slab_end(Slab *slab)
+{
+    return (char*)slab + SLAB_SIZE;
+}
+
+void slab_pool_init(SlabPool *pool, size_t obj_size)
+{
+    obj_size = next_multiple(MAX(obj_size, sizeof(void*)), ALIGNOF(union MaxAlign));
+    BUG_ON(obj_size > (SLAB_SIZE - SLAB_HEADER_SIZE) / 8);
+    list_init(&pool->partial);
+    pool->spare = NULL;
+    pool->obj_size = obj_size;
+    pool->nr_slabs = 0;
+    pool->nr_objects = 0;
+}
+
+// Number of objects that fit into each slab
+size_t slab_pool_capacity(const SlabPool *pool)
+{
+    return (SLAB_SIZE - SLAB_HEADER_SIZE) / pool->obj_size;
+}
+
+static Slab *new_slab(SlabPool *pool)
+{
+    void *mem;
+    int err = posix_memalign(&mem, SLAB_SIZE, SLAB_SIZE);
+    FATAL_ERROR_ON(err != 0, err);
+
+    Slab *slab = mem;
+    *slab = (Slab) {
+        .free = NULL,
+        .unused = (char*)slab + SLAB_HEADER_SIZE,
+        .nr_used = 0,
+    };
+
+    POISON(slab->unused, slab_end(slab) - slab->unused);
+    pool->nr_slabs++;
+    return slab;
+}
+
+static void free_slab(SlabPool *pool, Slab *slab)
+{
+    BUG_ON(slab->nr_used != 0);
+    UNPOISON(slab, SLAB_SIZE);
+    pool->nr_slabs--;
+    free(slab);
+}
+
+void *slab_alloc(SlabPool *pool)
+{
+    Slab *slab;
+    if (!list_empty(&pool->partial)) {
+        slab = (Slab*)pool->partial.next;
+    } else {
+        slab = pool->spare ? pool->spare : new_slab(pool);
+        pool->spare = NULL;
+        list_insert_after(&slab->node, &pool->partial);
+    }
+
+    size_t size = pool->obj_size;
+    void *obj = slab->free;
+    if (obj) {
+        UNPOISON(obj, size);
+        slab->free = *(void**)obj;
+    } else {
+        BUG_ON(slab->unused + size > slab_end(slab));
+        obj = slab->unused;
+        slab->unused += size;
+        UNPOISON(obj, size);
+    }
+
+    if (++slab->nr_used == slab_pool_capacity(pool)) {
+        // Slab is now full; remove it from the partial list until
+        // slab_free() is next called for one of its objects
+        list_remove(&slab->node);
+    }
+
+    pool->nr_objects++;
+    return obj;
+}
+
+void slab_free(SlabPool *pool, void *ptr)
+{
+    Slab *slab = slab_of(ptr);
+    BUG_ON(slab->nr_used == 0);
+    BUG_ON(pool->nr_objects == 0);
+    BUG_ON((char*)ptr < (char*)slab + SLAB_HEADER_SIZE || (char*)ptr >= slab->unused);
+
+    size_t size = pool->obj_size;
+    *(void**)ptr = slab->free;
+    slab->free = ptr;
+    POISON(ptr, size);
+    pool->nr_objects--;
+
+    if (slab->nr_used-- == slab_pool_capacity(pool)) {
+        // Slab was previously full
+        list_insert_after(&slab->node, &pool->partial);
+    }
+
+    if (slab->nr_used == 0) {
+        list_remove(&slab->node);
+        if (pool->spare) {
+            free_slab(pool, pool->spare);
+        }
+        pool->spare = slab;
+    }
+}
+
+// Free the spare slab of a pool in which all objects have been freed
+void slab_pool_free(SlabPool *pool)
+{
+    BUG_ON(pool->nr_objects != 0);
+    BUG_ON(!list_empty(&pool->partial));
+    if (pool->spare) {
+        free_slab(pool, pool->spare);
+        pool->spare = NULL;
+    }
+    BUG_ON(pool->nr_slabs != 0);
+}
@@ -0,0 +1,36 @@
+#ifndef UTIL_SLAB_H
+#define UTIL_SLAB_H
+
+#include <stddef.h>
+#include "list.h"
+#include "macros.h"
+
+enum {
+    // Size (and alignment) of each slab. This is kept below the default
+    // mmap(3) threshold of glibc malloc(3), so that slabs come from the
+    // heap instead of each being a separate mapping.
+    SLAB_SIZE = 64 * 1024,
+};
+
+// An allocator for objects of a fixed size, which are carved out of
+// SLAB_SIZE-aligned "slabs", so that the slab containing any object can
+// be found by simply masking its address. Each slab has its own free
+// list and slabs are returned to the system once they become empty
+// (except for one, which is kept to avoid thrashing). This packs many
+// small objects together and keeps the churn of allocating and freeing
+// them from fragmenting the general purpose heap.
+typedef struct {
+    ListHead partial; // Slabs with at least one free object
+    struct Slab *spare; // Empty slab kept for reuse (or NULL)
+    size_t obj_size; // Size of each object (including alignment padding)
+    size_t nr_slabs; // Number of slabs allocated (including `spare`)
+    size_t nr_objects; // Number of objects in use
+} SlabPool;
+
+void slab_pool_init(SlabPool *pool, size_t obj_size) NONNULL_ARGS;
+void *slab_alloc(SlabPool *pool) NONNULL_ARGS_AND_RETURN WARN_UNUSED_RESULT;
+void slab_free(SlabPool *pool, void *ptr) NONNULL_ARGS;
+void slab_pool_free(SlabPool *pool) NONNULL_ARGS;
+size_t slab_pool_capacity(const SlabPool *pool) NONNULL_ARGS;
+
+#endif
@@ -41,6 +41,18 @@ static inline struct timespec timespec_subtract (
     };
 }
 
+static inline struct timespec timespec_add_ms(struct timespec ts, unsigned long ms)
+{
+    BUG_ON(ts.tv_nsec >= NS_PER_SECOND);
+    ts.tv_sec += ms / MS_PER_SECOND;
+    ts.tv_nsec += (ms % MS_PER_SECOND) * NS_PER_MS;
+    if (ts.tv_nsec >= NS_PER_SECOND) {
+        ts.tv_sec++;
+        ts.tv_nsec -= NS_PER_SECOND;
+    }
+    return ts;
+}
+
 static inline double timespec_to_fp_milliseconds(struct timespec ts)
 {
     const double ms_per_s = MS_PER_SECOND;
@@ -3,27 +3,19 @@
 #include "unidata.h"
 #include "ascii.h"
 
-#define BISEARCH(u, arr) bisearch((u), (arr), ARRAYLEN(arr) - 1)
-
-static bool bisearch(CodePoint u, const CodepointRange *range, size_t max)
+// Look up the packed UPROP_* property bits for `u`, using the 3-stage
+// tables generated by unidata.lua. This is O(1), requiring just 3 loads.
+static unsigned int u_get_props(CodePoint u)
 {
-    if (u < range[0].first || u > range[max].last) {
-        return false;
-    }
-
-    size_t min = 0;
-    while (max >= min) {
-        const size_t mid = (min + max) / 2;
-        if (u > range[mid].last) {
-            min = mid + 1;
-        } else if (u < range[mid].first) {
-            max = mid - 1;
-        } else {
-            return true;
-        }
+    if (unlikely(!u_is_unicode(u))) {
+        return UPROP_UNPRINTABLE | 4;
     }
 
-    return false;
+    unsigned int mid = unidata_stage1[u >> UNIDATA_STAGE1_SHIFT];
+    unsigned int lo_mask = ARRAYLEN(unidata_stage3[0]) - 1;
+    unsigned int mid_mask = ARRAYLEN(unidata_stage2[0]) - 1;
+    unsigned int leaf = unidata_stage2[mid][(u >> UNIDATA_STAGE2_SHIFT) & mid_mask];
+    return unidata_stage3[leaf][u & lo_mask];
 }
 
 // Returns true for any whitespace character that isn't "non-breaking",
@@ -62,39 +54,27 @@ bool u_is_word_char(CodePoint u)
     return u >= 0x80 || is_alnum_or_underscore(u);
 }
 
-static bool u_is_default_ignorable(CodePoint u)
-{
-    return BISEARCH(u, default_ignorable);
-}
-
 bool u_is_unprintable(CodePoint u)
 {
-    return BISEARCH(u, unprintable) || !u_is_unicode(u);
+    return !!(u_get_props(u) & UPROP_UNPRINTABLE);
 }
 
 bool u_is_special_whitespace(CodePoint u)
 {
-    return BISEARCH(u, special_whitespace);
-}
-
-static bool u_is_nonspacing_mark(CodePoint u)
-{
-    return BISEARCH(u, nonspacing_mark);
+    return !!(u_get_props(u) & UPROP_SPECIAL_WHITESPACE);
 }
 
 bool u_is_zero_width(CodePoint u)
 {
-    return u_is_nonspacing_mark(u) || u_is_default_ignorable(u);
-}
-
-static bool u_is_double_width(CodePoint u)
-{
-    return BISEARCH(u, double_width);
+    return !!(u_get_props(u) & UPROP_ZERO_WIDTH);
 }
 
 // Get the display width of `u`, where "display width" means the number
 // of terminal columns occupied (either by the terminal's rendered font
-// glyph or our own multi-column rendering)
+// glyph or our own multi-column rendering). Zero width characters have
+// a width of 0, unprintable characters are rendered by u_set_char() as
+// <xx> (4 columns) and East Asian "wide" and "fullwidth" characters are
+// rendered by (modern) terminals as 2 column glyphs (e.g. 🎧).
 unsigned int u_char_width(CodePoint u)
 {
     if (likely(u < 0x80)) {
@@ -102,15 +82,6 @@ unsigned int u_char_width(CodePoint u)
             return 2; // Rendered by u_set_char() in caret notation (e.g. ^@)
         }
         return 1;
-    } else if (u_is_zero_width(u)) {
-        return 0;
-    } else if (u_is_unprintable(u)) {
-        return 4; // Rendered by u_set_char() as <xx>
-    } else if (u < 0x1100) {
-        return 1;
-    } else if (u_is_double_width(u)) {
-        return 2; // Rendered by (modern) terminals as a 2 column glyph (e.g. 🎧)
     }
-
-    return 1;
+    return u_get_props(u) & UPROP_WIDTH_MASK;
 }
@@ -19,11 +19,6 @@ function RangeTable:insert(min, max)
     self.n = n
 end
 
-function RangeTable:remove(index)
-    table.remove(self, index)
-    self.n = self.n - 1
-end
-
 function RangeTable:contains(codepoint)
     for i = 1, self.n do
         local range = self[i]
@@ -34,28 +29,6 @@ function RangeTable:contains(codepoint)
     return false
 end
 
-function RangeTable:merge_adjacent()
-    for i = self.n, 1, -1 do
-        local cur, prev = self[i], self[i - 1]
-        if prev and 1 + prev.max == cur.min then
-            prev.max = cur.max
-            self:remove(i)
-        end
-    end
-    return self
-end
-
-function RangeTable:print_ranges(name, output)
-    local n = assert(self.n)
-    output:write("static const CodepointRange ", name, "[] = {\n")
-    for i = 1, n do
-        local min = assert(self[i].min)
-        local max = assert(self[i].max)
-        output:write(("    {0x%04x, 0x%04x},\n"):format(min, max))
-    end
-    output:write("};\n\n")
-end
-
 local function read_ucd(path, pattern)
     assert(pattern)
     if not path then
@@ -167,10 +140,142 @@ for min, max in eaw:gmatch "\n(%x+)%.*(%x*) *; *[WF]" do
     double_width:insert(min, max or min)
 end
 
+-- Property bits packed into each entry of the lookup tables below. The
+-- lowest 3 bits hold the display width (as returned by u_char_width()),
+-- which is derived from the other properties.
+local UPROP_SPECIAL_WHITESPACE = 0x08
+local UPROP_UNPRINTABLE = 0x10
+local UPROP_ZERO_WIDTH = 0x20
+
+-- Shift amounts for the 3 table stages: bits 10..20 of the codepoint
+-- select a row of stage2, bits 4..9 select a row of stage3 and bits
+-- 0..3 select the entry
+local STAGE1_SHIFT = 10
+local STAGE2_SHIFT = 4
+local STAGE2_LEN = 64
+local STAGE3_LEN = 16
+local NCODEPOINTS = 0x110000
+assert(STAGE2_LEN == 2 ^ (STAGE1_SHIFT - STAGE2_SHIFT))
+assert(STAGE3_LEN == 2 ^ STAGE2_SHIFT)
+
+local function mark_ranges(flags, ranges)
+    for i = 1, ranges.n do
+        local r = ranges[i]
+        for u = r.min, r.max do
+            flags[u] = true
+        end
+    end
+    return flags
+end
+
+local function get_props()
+    local is_special_ws = mark_ranges({}, special_whitespace)
+    local is_unprintable = mark_ranges({}, unprintable)
+    local is_double_width = mark_ranges({}, double_width)
+    local is_zero_width = mark_ranges({}, nonspacing_mark)
+    mark_ranges(is_zero_width, default_ignorable)
+
+    local props = {}
+    for u = 0, NCODEPOINTS - 1 do
+        local p, width = 0, 1
+        if is_zero_width[u] then
+            p, width = p + UPROP_ZERO_WIDTH, 0
+        end
+        if is_unprintable[u] then
+            p = p + UPROP_UNPRINTABLE
+            width = (width == 0) and 0 or 4
+        end
+        if is_special_ws[u] then
+            p = p + UPROP_SPECIAL_WHITESPACE
+        end
+        if is_double_width[u] and width == 1 then
+            width = 2
+        end
+        props[u] = p + width
+    end
+    return props
+end
+
+-- Split `values` (a 0-indexed array of integers) into rows of `len`
+-- elements and de-duplicate them, returning the list of unique rows
+-- and a 0-indexed array mapping each row of `values` to its index
+-- in the former
+local function dedup_rows(values, nvalues, len)
+    local rows, index, map = {}, {}, {}
+    for i = 0, nvalues - 1, len do
+        local row = {}
+        for j = 0, len - 1 do
+            row[j + 1] = values[i + j]
+        end
+        local key = table.concat(row, ",")
+        local n = index[key]
+        if not n then
+            n = #rows
+            rows[n + 1] = row
+            index[key] = n
+        end
+        map[math.floor(i / len)] = n
+    end
+    return rows, map
+end
+
+-- Return the smallest C integer type for elements with values up to
+-- `max` and a matching printf(3) format for emitting them
+local function c_type(max)
+    if max <= 0xFF then
+        return "uint8_t", "0x%02x"
+    end
+    return "uint16_t", "0x%03x"
+end
+
+local function print_rows(output, name, rows, per_line, max)
+    local ctype, fmt = c_type(max)
+    local ncols = #rows[1]
+    output:write(("static const %s %s[%d][%d] = {\n"):format(ctype, name, #rows, ncols))
+    for _, row in ipairs(rows) do
+        for i = 1, ncols, per_line do
+            local line = {}
+            for j = i, math.min(i + per_line - 1, ncols) do
+                line[#line + 1] = fmt:format(row[j])
+            end
+            local open = (i == 1) and "{" or " "
+            local close = (i + per_line > ncols) and "}," or ","
+            output:write("    ", open, table.concat(line, ", "), close, "\n")
+        end
+    end
+    output:write("};\n\n")
+end
+
+local function print_stage1(output, map, n, max)
+    local ctype, fmt = c_type(max)
+    output:write(("static const %s unidata_stage1[%d] = {\n"):format(ctype, n))
+    for i = 0, n - 1, 16 do
+        local line = {}
+        for j = i, math.min(i + 15, n - 1) do
+            line[#line + 1] = fmt:format(map[j])
+        end
+        output:write("    ", table.concat(line, ", "), ",\n")
+    end
+    output:write("};\n\n")
+end
+
+local props = get_props()
+local stage3, stage3_map = dedup_rows(props, NCODEPOINTS, STAGE3_LEN)
+local stage2, stage1 = dedup_rows(stage3_map, NCODEPOINTS / STAGE3_LEN, STAGE2_LEN)
+local nstage1 = NCODEPOINTS / (STAGE2_LEN * STAGE3_LEN)
+
 local stdout = io.stdout
-stdout:write("typedef struct {CodePoint first, last;} CodepointRange;\n\n")
-special_whitespace:merge_adjacent():print_ranges("special_whitespace", stdout)
-default_ignorable:merge_adjacent():print_ranges("default_ignorable", stdout)
-nonspacing_mark:merge_adjacent():print_ranges("nonspacing_mark", stdout)
-double_width:merge_adjacent():print_ranges("double_width", stdout)
-unprintable:merge_adjacent():print_ranges("unprintable", stdout)
+stdout:write (
+    "enum {\n",
+    ("    UPROP_WIDTH_MASK = 0x%02x,\n"):format(0x07),
+    ("    UPROP_SPECIAL_WHITESPACE = 0x%02x,\n"):format(UPROP_SPECIAL_WHITESPACE),
+    ("    UPROP_UNPRINTABLE = 0x%02x,\n"):format(UPROP_UNPRINTABLE),
+    ("    UPROP_ZERO_WIDTH = 0x%02x,\n"):format(UPROP_ZERO_WIDTH),
+    ("    UNIDATA_STAGE1_SHIFT = %d,\n"):format(STAGE1_SHIFT),
+    ("    UNIDATA_STAGE2_SHIFT = %d,\n"):format(STAGE2_SHIFT),
+    "};\n\n"
+)
+
+print_stage1(stdout, stage1, nstage1, #stage2 - 1)
+print_rows(stdout, "unidata_stage2", stage2, 16, #stage3 - 1)
+print_rows(stdout, "unidata_stage3", stage3, 16, 0xFF)
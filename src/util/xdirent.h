@@ -3,9 +3,11 @@
 
 #include <dirent.h>
 #include <errno.h>
+#include <stdbool.h>
 #include <sys/types.h>
 #include "macros.h"
 #include "maybebool.h"
+#include "string-view.h"
 
 NONNULL_ARGS WARN_UNUSED_RESULT
 static inline DIR *xopendir(const char *path)
@@ -36,6 +38,13 @@ static inline int xclosedir(DIR *dir)
     return closedir(dir); // NOLINT(*-unsafe-functions)
 }
 
+static inline bool is_ignored_dir_entry(StringView name)
+{
+    return unlikely(name.length == 0)
+        || strview_equal_cstring(name, ".")
+        || strview_equal_cstring(name, "..");
+}
+
 MaybeBool is_dir_or_symlink_to_dir(const struct dirent *ent, int dir_fd) NONNULL_ARGS WARN_UNUSED_RESULT;
 
 #endif
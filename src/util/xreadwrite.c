@@ -46,6 +46,15 @@ ssize_t xwrite(int fd, const void *buf, size_t count)
     return r;
 }
 
+ssize_t xwritev(int fd, const struct iovec *iov, int iovcnt)
+{
+    ssize_t r;
+    do {
+        r = writev(fd, iov, iovcnt);
+    } while (unlikely(r < 0 && errno == EINTR));
+    return r;
+}
+
 ssize_t xread_all(int fd, void *buf, size_t count)
 {
     char *b = buf;
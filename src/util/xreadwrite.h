@@ -4,6 +4,7 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include "errorcode.h"
 #include "macros.h"
 
@@ -20,6 +21,7 @@ static inline int xopen(const char *path, int flags, mode_t mode)
 
 ssize_t xread(int fd, void *buf, size_t count) WRITEONLY(2, 3) NONNULL_ARGS WARN_UNUSED_RESULT;
 ssize_t xwrite(int fd, const void *buf, size_t count) READONLY(2, 3) NONNULL_ARGS WARN_UNUSED_RESULT;
+ssize_t xwritev(int fd, const struct iovec *iov, int iovcnt) NONNULL_ARGS WARN_UNUSED_RESULT;
 ssize_t xread_all(int fd, void *buf, size_t count) WRITEONLY(2, 3) NONNULL_ARGS WARN_UNUSED_RESULT;
 ssize_t xwrite_all(int fd, const void *buf, size_t count) READONLY(2, 3) NONNULL_ARGS WARN_UNUSED_RESULT;
 SystemErrno xclose(int fd);
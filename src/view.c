@@ -3,11 +3,13 @@
 #include "buffer.h"
 #include "indent.h"
 #include "util/ascii.h"
+#include "util/bit.h"
 #include "util/debug.h"
 #include "util/numtostr.h"
 #include "util/str-util.h"
 #include "util/time-util.h"
 #include "util/utf8.h"
+#include "util/xmalloc.h"
 #include "window.h"
 
 void view_update_cursor_y(View *view)
@@ -26,34 +28,190 @@ void view_update_cursor_y(View *view)
     BUG("unreachable");
 }
 
-static void view_update_cursor_x(View *view)
-{
-    const unsigned int tw = view->buffer->options.tab_width;
-    const CurrentLineRef lr = get_current_line_and_offset(view->cursor);
-    const size_t cx = lr.cursor_offset;
-    long cx_char = 0;
-    long w = 0;
+// Decode characters of `line`, starting from the position in `pos`,
+// until reaching a character boundary at or after byte offset `end`
+static ColumnCheckpoint advance_columns (
+    StringView line,
+    ColumnCheckpoint pos,
+    size_t end,
+    unsigned int tab_width
+) {
+    size_t idx = pos.offset;
+    long cx_char = pos.cx_char;
+    long w = pos.cx_display;
 
-    for (size_t idx = 0; idx < cx; cx_char++) {
-        unsigned char ch = lr.line.data[idx];
+    for (; idx < end; cx_char++) {
+        unsigned char ch = line.data[idx];
         if (likely(ch < 0x80)) {
             idx++;
             if (likely(!ascii_iscntrl(ch))) {
                 w++;
             } else if (ch == '\t') {
-                w = next_indent_width(w, tw);
+                w = next_indent_width(w, tab_width);
             } else {
                 w += 2;
             }
         } else {
-            CodePoint u = u_get_nonascii(lr.line.data, lr.line.length, &idx);
+            CodePoint u = u_get_nonascii(line.data, line.length, &idx);
             w += u_char_width(u);
         }
     }
 
+    return (ColumnCheckpoint) {
+        .offset = idx,
+        .cx_char = cx_char,
+        .cx_display = w,
+    };
+}
+
+// Make sure `cache` has room for at least `n` checkpoints
+static void column_cache_reserve(ColumnCache *cache, size_t n)
+{
+    if (n > cache->alloc) {
+        cache->alloc = next_multiple(n, 64);
+        cache->checkpoints = xrenew(cache->checkpoints, cache->alloc);
+    }
+}
+
+// Discard the contents of `cache`, unless they were built for the same
+// line, `edit_count` and `tab_width`
+static void column_cache_validate (
+    ColumnCache *cache,
+    StringView line,
+    unsigned long edit_count,
+    unsigned int tab_width
+) {
+    if (
+        cache->line != line.data
+        || cache->line_len != line.length
+        || cache->edit_count != edit_count
+        || cache->tab_width != tab_width
+        || cache->count == 0
+    ) {
+        column_cache_reserve(cache, 1);
+        cache->line = line.data;
+        cache->line_len = line.length;
+        cache->edit_count = edit_count;
+        cache->tab_width = tab_width;
+        cache->checkpoints[0] = (ColumnCheckpoint){.offset = 0};
+        cache->count = 1;
+    }
+}
+
+// Append checkpoints to `cache`, until it contains at least `n`
+static void column_cache_extend(ColumnCache *cache, StringView line, size_t n)
+{
+    column_cache_reserve(cache, n);
+    ColumnCheckpoint *cps = cache->checkpoints;
+    while (cache->count < n) {
+        size_t i = cache->count++;
+        size_t end = MIN(i * COLUMN_CACHE_INTERVAL, line.length);
+        cps[i] = advance_columns(line, cps[i - 1], end, cache->tab_width);
+    }
+}
+
+// Find the last checkpoint at or before byte offset `cx` in `line`,
+// (re)building View::column_cache as needed
+static ColumnCheckpoint column_cache_lookup (
+    View *view,
+    StringView line,
+    size_t cx,
+    unsigned int tab_width
+) {
+    ColumnCache *cache = &view->column_cache;
+    const size_t n = cx / COLUMN_CACHE_INTERVAL;
+    column_cache_validate(cache, line, view->buffer->edit_count, tab_width);
+    column_cache_extend(cache, line, n + 1);
+
+    // The checkpoint may be past `cx` if a multi-byte character straddles
+    // the checkpoint boundary, in which case the previous one is used
+    const ColumnCheckpoint *cps = cache->checkpoints;
+    size_t i = n;
+    while (cps[i].offset > cx) {
+        BUG_ON(i == 0);
+        i--;
+    }
+
+    return cps[i];
+}
+
+// Find the last checkpoint in `line` with a display column less than `x`
+// (or the start of the line, if there's no such checkpoint), extending
+// `cache` only as far as needed
+ColumnCheckpoint column_cache_find_column (
+    ColumnCache *cache,
+    StringView line,
+    unsigned long edit_count,
+    unsigned int tab_width,
+    long x
+) {
+    column_cache_validate(cache, line, edit_count, tab_width);
+    while (1) {
+        const ColumnCheckpoint *last = &cache->checkpoints[cache->count - 1];
+        if (last->cx_display >= x || last->offset >= line.length) {
+            break;
+        }
+        column_cache_extend(cache, line, cache->count + 1);
+    }
+
+    // Display columns increase monotonically with each checkpoint, so a
+    // binary search can be used (and checkpoint 0 is always at column 0)
+    const ColumnCheckpoint *cps = cache->checkpoints;
+    size_t lo = 0;
+    size_t hi = cache->count;
+    while (hi - lo > 1) {
+        size_t mid = lo + ((hi - lo) / 2);
+        if (cps[mid].cx_display < x) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return cps[lo];
+}
+
+ColumnCache *view_get_line_column_cache(View *view, long line_nr)
+{
+    BUG_ON(line_nr < 0);
+    size_t n = MAX(view->window->edit_h, 1);
+    if (n > view->nr_line_column_caches) {
+        size_t old = view->nr_line_column_caches;
+        view->line_column_caches = xrenew(view->line_column_caches, n);
+        memset(view->line_column_caches + old, 0, (n - old) * sizeof(ColumnCache));
+        view->nr_line_column_caches = n;
+    }
+
+    // Any `n` consecutive lines map to different entries, so there are
+    // no collisions between the lines visible in the Window (although
+    // entries are reused by other lines after scrolling vertically)
+    return &view->line_column_caches[line_nr % view->nr_line_column_caches];
+}
+
+void view_free_column_caches(View *view)
+{
+    free(view->column_cache.checkpoints);
+    for (size_t i = 0, n = view->nr_line_column_caches; i < n; i++) {
+        free(view->line_column_caches[i].checkpoints);
+    }
+    free(view->line_column_caches);
+}
+
+static void view_update_cursor_x(View *view)
+{
+    const unsigned int tw = view->buffer->options.tab_width;
+    const CurrentLineRef lr = get_current_line_and_offset(view->cursor);
+    const size_t cx = lr.cursor_offset;
+
+    ColumnCheckpoint pos = {.offset = 0};
+    if (cx >= COLUMN_CACHE_INTERVAL) {
+        pos = column_cache_lookup(view, lr.line, cx, tw);
+    }
+
+    pos = advance_columns(lr.line, pos, cx, tw);
     view->cx = cx;
-    view->cx_char = cx_char;
-    view->cx_display = w;
+    view->cx_char = pos.cx_char;
+    view->cx_display = pos.cx_display;
 }
 
 static bool view_is_cursor_visible(const View *v)
@@ -245,6 +403,24 @@ String dump_buffer(const View *view)
         string_sprintf(&buf, "    Views: %zu\n", buffer->views.count);
     }
 
+    const UndoArena *arena = &buffer->undo_arena;
+    if (arena->nr_changes) {
+        string_sprintf (
+            &buf,
+            "     Undo: %zu changes, %s\n",
+            arena->nr_changes,
+            filesize_to_str(undo_memory_usage(arena), sizestr)
+        );
+        if (arena->journal_bytes) {
+            const char *str = filesize_to_str(arena->journal_bytes, sizestr);
+            string_sprintf(&buf, "  Journal: %s\n", str);
+        }
+        if (arena->dropped_bytes) {
+            const char *str = filesize_to_str(arena->dropped_bytes, sizestr);
+            string_sprintf(&buf, "  Dropped: %s\n", str);
+        }
+    }
+
     if (buffer->abs_filename) {
         const FileInfo *file = &buffer->file;
         unsigned int perms = file->mode & 07777;
@@ -15,6 +15,37 @@ typedef enum {
     SELECT_LINES,
 } SelectionType;
 
+enum {
+    // Distance (in bytes) between the checkpoints in ColumnCache
+    COLUMN_CACHE_INTERVAL = 512,
+};
+
+// The cursor x position (in bytes, codepoints and terminal columns) at
+// some character boundary within a line
+typedef struct {
+    size_t offset; // Byte offset, relative to the start of the line
+    long cx_char;
+    long cx_display;
+} ColumnCheckpoint;
+
+// A lazily populated index of ColumnCheckpoints for a single line, so
+// that very long lines don't need to be decoded from the start on every
+// cursor movement (see view_update_cursor_x()) or every redraw of a
+// horizontally scrolled view (see print_line()). Checkpoint `i` is at
+// the first character boundary at or after `i * COLUMN_CACHE_INTERVAL`.
+// The cache is keyed by the address and length of the line, along with
+// Buffer::edit_count (which guards against stale addresses after edits)
+// and the `tab-width` used to calculate the display columns.
+typedef struct {
+    const char *line;
+    size_t line_len;
+    unsigned long edit_count;
+    unsigned int tab_width;
+    size_t count;
+    size_t alloc;
+    ColumnCheckpoint *checkpoints;
+} ColumnCache;
+
 /*
  * A view into a Buffer, with its own cursor position and selection.
  * Visually speaking, each tab in a Window corresponds to a View and
@@ -44,6 +75,10 @@ typedef struct View {
     // Used to save cursor state when multiple views share same buffer
     bool restore_cursor;
     size_t saved_cursor_offset;
+
+    ColumnCache column_cache; // See view_update_cursor_x()
+    ColumnCache *line_column_caches; // See view_get_line_column_cache()
+    size_t nr_line_column_caches;
 } View;
 
 typedef struct {
@@ -70,5 +105,15 @@ size_t view_remove(View *view) NONNULL_ARGS;
 StringView view_get_word_under_cursor(const View *view) NONNULL_ARGS;
 WordBounds get_bounds_for_word_under_cursor(CurrentLineRef lr);
 String dump_buffer(const View *view) NONNULL_ARGS;
+ColumnCache *view_get_line_column_cache(View *view, long line_nr) NONNULL_ARGS_AND_RETURN;
+void view_free_column_caches(View *view) NONNULL_ARGS;
+
+ColumnCheckpoint column_cache_find_column (
+    ColumnCache *cache,
+    StringView line,
+    unsigned long edit_count,
+    unsigned int tab_width,
+    long x
+) NONNULL_ARGS WARN_UNUSED_RESULT;
 
 #endif
@@ -184,6 +184,7 @@ void window_remove_view_at_index(Window *window, size_t view_idx)
     }
 
     window->update_tabbar = true;
+    view_free_column_caches(view);
     free(view);
 }
 
@@ -5,19 +5,38 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
 #include <time.h>
+#include <unistd.h>
+#include "buildvar-block-pool.h" // BLOCK_POOL_DISABLE
+#include "change.h"
 #include "command/serialize.h"
+#include "config.h"
+#include "edit.h"
+#include "editor.h"
 #include "filetype.h"
+#include "grep.h"
 #include "indent.h"
 #include "options.h"
+#include "regexp.h"
+#include "tag.h"
 #include "terminal/color.h"
+#include "terminal/output.h"
+#include "ui.h"
 #include "util/arith.h"
 #include "util/debug.h"
+#include "util/fd.h"
+#include "util/fork-exec.h"
 #include "util/macros.h"
 #include "util/numtostr.h"
+#include "util/path.h"
 #include "util/string-view.h"
+#include "util/strtonum.h"
 #include "util/time-util.h"
 #include "util/utf8.h"
+#include "util/xmalloc.h"
+#include "util/xreadwrite.h"
 #include "util/xsnprintf.h"
 
 COLD PRINTF(1)
@@ -263,6 +282,22 @@ static void bench_u_set_char_raw(void)
     report(&start, iterations, "u_set_char_raw()");
 }
 
+static void bench_u_char_width(void)
+{
+    unsigned int iterations = 250000;
+    unsigned int accum = 0;
+    struct timespec start = get_time();
+
+    // Spread the codepoints over the BMP and the SMP (emoji, etc.), with
+    // a stride that avoids only ever hitting the same table rows
+    for (unsigned int i = 0; i < iterations; i++) {
+        accum += u_char_width(0x80 + ((i * 7919) % 0x1FF80));
+    }
+
+    CHECK_RESULT(accum > iterations, true);
+    report(&start, iterations, "u_char_width()");
+}
+
 static void bench_human_readable_size(void)
 {
     static const uintmax_t sizes[] = {
@@ -288,8 +323,742 @@ static void bench_human_readable_size(void)
     report(&start, iterations, "human_readable_size()");
 }
 
-int main(void)
+// Draw a line of code with term_put_char() or term_put_ascii(), either
+// directly to the output buffer or (as done by update_screen()) into the
+// TermScreen grid, which is then diffed by term_screen_end_update()
+static void do_bench_term_put_line(bool ascii_runs, bool grid)
+{
+    static const char line[] =
+        "    for (size_t i = 0, n = array->count; i < n; i++) {"
+        " sum += array->items[i] * 3;";
+
+    static_assert(sizeof(line) - 1 <= 96);
+    Terminal term = {.width = 96, .height = 1, .obuf = TERM_OUTPUT_INIT};
+    TermOutputBuffer *obuf = &term.obuf;
+    const size_t len = sizeof(line) - 1;
+    unsigned int iterations = 100000;
+    size_t accum = 0;
+    struct timespec start = get_time();
+
+    for (unsigned int i = 0; i < iterations; i++) {
+        if (grid) {
+            term_screen_begin_update(&term);
+        }
+        term_output_reset(&term, 0, term.width, 0);
+        if (ascii_runs) {
+            term_put_ascii(obuf, line, len);
+        } else {
+            for (size_t j = 0; j < len; j++) {
+                term_put_char(obuf, line[j]);
+            }
+        }
+        accum += obuf->x;
+        if (grid) {
+            term_screen_end_update(&term);
+        }
+        obuf->count = 0;
+    }
+
+    term_output_free(obuf);
+    CHECK_RESULT(accum, iterations * len);
+    report (
+        &start, iterations, "%s <- 82 %s",
+        ascii_runs ? "term_put_ascii()" : "term_put_char()",
+        grid ? "(grid)" : "bytes"
+    );
+}
+
+static void bench_term_put_line(void)
+{
+    do_bench_term_put_line(false, false);
+    do_bench_term_put_line(true, false);
+    do_bench_term_put_line(false, true);
+    do_bench_term_put_line(true, true);
+}
+
+static void make_grep_fixture_file(const char *path, unsigned int seed)
+{
+    FILE *f = fopen(path, "w");
+    if (unlikely(!f)) {
+        perror_exit("fopen");
+    }
+
+    for (unsigned int i = 0; i < 2000; i++) {
+        fprintf (
+            f,
+            "static int function_%u_%u(int x, const char *str)\n"
+            "{\n    return x * %u + (int)strlen(str);\n}\n\n",
+            seed, i, i
+        );
+    }
+
+    if (unlikely(fclose(f) != 0)) {
+        perror_exit("fclose");
+    }
+}
+
+// Generate a source tree of 128 files (~20MiB in total), for use by
+// bench_grep_path()
+static void make_grep_fixture(const char *root)
+{
+    if (mkdir(root, 0777) != 0 && errno != EEXIST) {
+        perror_exit("mkdir");
+    }
+
+    char path[256];
+    for (unsigned int d = 0; d < 8; d++) {
+        xsnprintf(path, sizeof path, "%s/dir%u", root, d);
+        if (mkdir(path, 0777) != 0 && errno != EEXIST) {
+            perror_exit("mkdir");
+        }
+        for (unsigned int i = 0; i < 16; i++) {
+            xsnprintf(path, sizeof path, "%s/dir%u/file%u.c", root, d, i);
+            make_grep_fixture_file(path, (d * 16) + i);
+        }
+    }
+}
+
+static void bench_grep_path(void)
+{
+    static const char root[] = "build/test/grep-fixture";
+    make_grep_fixture(root);
+
+    regex_t re;
+    if (regcomp(&re, "return x \\* 1999 ", DEFAULT_REGEX_FLAGS | REG_NEWLINE) != 0) {
+        error_exit("regcomp() failed in %s()", __func__);
+    }
+
+    MessageList msgs = {.pos = 0};
+    GrepContext ctx = {.re = &re, .msgs = &msgs};
+    unsigned int iterations = 5;
+    struct timespec start = get_time();
+
+    for (unsigned int i = 0; i < iterations; i++) {
+        if (!grep_path(&ctx, root)) {
+            perror_exit("grep_path");
+        }
+        clear_messages(&msgs);
+    }
+
+    CHECK_RESULT(ctx.nr_files, iterations * 128);
+    CHECK_RESULT(ctx.nr_matches, iterations * 128);
+    report(&start, iterations, "grep_path() <- 128 files");
+    grep_context_free(&ctx);
+    regfree(&re);
+}
+
+static void make_long_lines_fixture(const char *path)
+{
+    FILE *f = fopen(path, "w");
+    if (unlikely(!f)) {
+        perror_exit("fopen");
+    }
+
+    for (unsigned int i = 0; i < 100; i++) {
+        for (unsigned int j = 0; j < 200; j++) {
+            fprintf(f, "x%u = f(y, \"%03u\"); /* c */ ", i, j);
+        }
+        fputc('\n', f);
+    }
+
+    if (unlikely(fclose(f) != 0)) {
+        perror_exit("fclose");
+    }
+}
+
+typedef struct {
+    const char *name;
+    const char *filename;
+    const char *setup; // Command to run (untimed) after opening `filename`
+    const char *cmd; // Command to run before each frame
+    bool full_redraw; // Invalidate the whole screen before each frame
+    unsigned int frames;
+} RenderScenario;
+
+typedef struct {
+    uintmax_t ns;
+    uintmax_t bytes;
+} RenderResult;
+
+static void render_cmd(EditorState *e, const char *cmd)
 {
+    if (unlikely(!handle_normal_command(e, cmd, false))) {
+        error_exit("%s(): command failed: %s", __func__, cmd);
+    }
+}
+
+// Render `s->frames` frames with update_screen(), as done by main_loop(),
+// with output going to the Terminal's usual output buffer and then to
+// the in-memory TermOutputBuffer::sink set up by bench_render()
+static RenderResult render_frames(EditorState *e, const RenderScenario *s, bool syntax)
+{
+    char cmd[256];
+    xsnprintf(cmd, sizeof cmd, "open %s", s->filename);
+    render_cmd(e, cmd);
+    render_cmd(e, syntax ? "set syntax true" : "set syntax false");
+    if (s->setup) {
+        render_cmd(e, s->setup);
+    }
+
+    Terminal *term = &e->terminal;
+    TermOutputBuffer *obuf = &term->obuf;
+    const ScreenState initial = {.id = 0};
+    term_clear_screen(obuf);
+    e->screen_update |= UPDATE_ALL;
+    update_screen(e, &initial);
+
+    const size_t nr_written = obuf->nr_written;
+    struct timespec start = get_time();
+
+    for (unsigned int i = 0; i < s->frames; i++) {
+        const View *view = e->view;
+        const ScreenState state = {
+            .is_modified = buffer_modified(view->buffer),
+            .set_window_title = e->options.set_window_title,
+            .id = view->buffer->id,
+            .cy = view->cy,
+            .vx = view->vx,
+            .vy = view->vy,
+        };
+        if (s->cmd) {
+            render_cmd(e, s->cmd);
+        }
+        if (s->full_redraw) {
+            term_clear_screen(obuf);
+            e->screen_update |= UPDATE_ALL;
+        }
+        update_screen(e, &state);
+        string_clear(obuf->sink);
+    }
+
+    struct timespec end = get_time();
+    struct timespec duration = timespec_subtract(&end, &start);
+    render_cmd(e, "close -f");
+
+    return (RenderResult) {
+        .ns = timespec_to_ns(&duration),
+        .bytes = obuf->nr_written - nr_written,
+    };
+}
+
+static void do_bench_render(EditorState *e, const RenderScenario *s)
+{
+    RenderResult with = render_frames(e, s, true);
+    RenderResult without = render_frames(e, s, false);
+    uintmax_t n = s->frames;
+    uintmax_t hl_ns = (with.ns > without.ns) ? with.ns - without.ns : 0;
+
+    fprintf (
+        stderr,
+        "   BENCH  render: %-21s  %9ju ns/frame  %6ju bytes/frame  %9ju ns/frame (highlighter)\n",
+        s->name, with.ns / n, with.bytes / n, hl_ns / n
+    );
+}
+
+// Drive update_screen() against a headless EditorState with a 120x40
+// xterm-256color Terminal, for some typical editing scenarios. The
+// "highlighter" time is the difference between rendering the same
+// frames with and without the `syntax` option enabled.
+static void bench_render(void)
+{
+    static const char home[] = "build/test/bench-home";
+    static const char code[] = "build/test/render-fixture.c";
+    static const char longlines[] = "build/test/render-long-lines.c";
+    if (mkdir(home, 0777) != 0 && errno != EEXIST) {
+        perror_exit("mkdir");
+    }
+
+    make_grep_fixture_file(code, 0);
+    make_long_lines_fixture(longlines);
+
+    char *abs_home = path_absolute(home);
+    if (unlikely(!abs_home)) {
+        perror_exit("path_absolute");
+    }
+
+    EditorState *e = init_editor_state(abs_home, abs_home);
+    free(abs_home);
+    exec_rc_files(e, NULL, false, false);
+    e->options.lock_files = false;
+    e->options.set_window_title = false;
+
+    // Capture terminal output in memory, so that the cost of write(2)
+    // isn't included (only the byte counts are reported)
+    String output = STRING_INIT;
+    Terminal *term = &e->terminal;
+    term_init(term, "xterm-256color", NULL);
+    term->width = 120;
+    term->height = 40;
+    term->obuf.sink = &output;
+
+    e->window = new_window(e);
+    e->root_frame = new_root_frame(e->window);
+    set_view(window_open_empty_buffer(e->window));
+    update_window_sizes(term, e->root_frame);
+    e->flags &= ~EFLAG_HEADLESS; // As done by main() before main_loop()
+
+    const RenderScenario scenarios[] = {
+        {"full redraw", code, NULL, NULL, true, 1000},
+        {"scroll", code, NULL, "scroll-down", false, 1000},
+        {"typing", code, "line 20; eol", "insert -k x", false, 1000},
+        {"horizontal scroll", longlines, NULL, "right; right; right; right; right; right; right; right", false, 500},
+        {"long lines", longlines, NULL, NULL, true, 500},
+        {"long lines (scrolled)", longlines, "eol", NULL, true, 500},
+    };
+
+    for (size_t i = 0; i < ARRAYLEN(scenarios); i++) {
+        do_bench_render(e, &scenarios[i]);
+    }
+
+    frame_remove(e, e->root_frame);
+    term->obuf.sink = NULL;
+    string_free(&output);
+    free_editor_state(e);
+}
+
+// Peak resident set size of the process so far, in KiB (on Linux and
+// most BSDs, although macOS reports it in bytes)
+static uintmax_t get_max_rss(void)
+{
+    struct rusage ru;
+    if (unlikely(getrusage(RUSAGE_SELF, &ru) != 0)) {
+        perror_exit("getrusage");
+    }
+    return ru.ru_maxrss;
+}
+
+static void do_bench_exec(EditorState *e, const char *name, const char *cmd, size_t size)
+{
+    struct timespec start = get_time();
+    render_cmd(e, cmd);
+    struct timespec end = get_time();
+    struct timespec duration = timespec_subtract(&end, &start);
+    uintmax_t ns = timespec_to_ns(&duration);
+
+    uintmax_t counts[2];
+    buffer_count_blocks_and_bytes(e->buffer, counts);
+    CHECK_RESULT(counts[1], size);
+
+    uintmax_t mib_per_sec = ns ? (uintmax_t)size * NS_PER_SECOND / ns >> 20 : 0;
+    fprintf (
+        stderr,
+        "   BENCH  exec: %-22s  %6ju MiB/s  %8ju blocks  %7ju KiB peak RSS\n",
+        name, mib_per_sec, counts[0], get_max_rss()
+    );
+}
+
+// Pipe `mib` MiB of child process output into a buffer (with "exec -o
+// buffer") and then filter the whole buffer through cat(1), so that the
+// throughput and peak memory usage of both directions can be measured.
+// Filtering needs the original text, the new text and the (undo) copy
+// of the deleted text all at once, so it's skipped for sizes over 1GiB.
+static EditorState *init_headless_editor(void)
+{
+    static const char home[] = "build/test/bench-home";
+    if (mkdir(home, 0777) != 0 && errno != EEXIST) {
+        perror_exit("mkdir");
+    }
+
+    char *abs_home = path_absolute(home);
+    if (unlikely(!abs_home)) {
+        perror_exit("path_absolute");
+    }
+
+    EditorState *e = init_editor_state(abs_home, abs_home);
+    free(abs_home);
+    e->flags |= EFLAG_HEADLESS;
+    e->options.lock_files = false;
+    e->window = new_window(e);
+    e->root_frame = new_root_frame(e->window);
+    set_view(window_open_empty_buffer(e->window));
+    return e;
+}
+
+static void bench_exec(size_t mib)
+{
+    EditorState *e = init_headless_editor();
+
+    // Each line is 64 bytes, so that `size` is always a whole number of lines
+    size_t size = mib << 20;
+    char cmd[256];
+    xsnprintf (
+        cmd, sizeof cmd,
+        "exec -s -o buffer sh -c 'yes %s | head -c %zu'",
+        "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_",
+        size
+    );
+
+    fprintf(stderr, "   BENCH  exec: %zu MiB (initial peak RSS %ju KiB)\n", mib, get_max_rss());
+    do_bench_exec(e, "output to buffer", cmd, size);
+    if (mib <= 1024) {
+        do_bench_exec(e, "filter buffer (cat)", "exec -s -i buffer -o buffer cat", size);
+    }
+
+    frame_remove(e, e->root_frame);
+    free_editor_state(e);
+}
+
+static void do_bench_undo(EditorState *e, const char *cmd, size_t size)
+{
+    struct timespec start = get_time();
+    render_cmd(e, cmd);
+    struct timespec end = get_time();
+    struct timespec duration = timespec_subtract(&end, &start);
+
+    uintmax_t counts[2];
+    buffer_count_blocks_and_bytes(e->buffer, counts);
+    CHECK_RESULT(counts[1], size);
+
+    uintmax_t ms = timespec_to_ns(&duration) / 1000000;
+    fprintf(stderr, "   BENCH  undo: %-10s  %8ju ms  %8ju blocks\n", cmd, ms, counts[0]);
+}
+
+// Make a substitution on every line of a `nr_lines` line buffer (with
+// "replace -g") and then undo and redo it, all of which should take
+// time roughly proportional to the size of the buffer
+static void bench_undo(size_t nr_lines)
+{
+    EditorState *e = init_headless_editor();
+    String text = string_new(nr_lines * 32);
+    for (size_t i = 0; i < nr_lines; i++) {
+        string_sprintf(&text, "%016zu abc %09zu\n", i, i);
+    }
+
+    buffer_insert_bytes(e->view, text.buffer, text.len);
+    size_t size = text.len;
+    string_free(&text);
+
+    fprintf(stderr, "   BENCH  undo: %zu lines\n", nr_lines);
+    do_bench_undo(e, "replace -g abc xy", size - nr_lines);
+    do_bench_undo(e, "undo", size);
+    do_bench_undo(e, "redo", size - nr_lines);
+    do_bench_undo(e, "undo", size);
+
+    frame_remove(e, e->root_frame);
+    free_editor_state(e);
+}
+
+// Make `nr_edits` small insertions and deletions at pseudo-random offsets
+// (in repeated passes over the buffer, since block_iter_goto_offset() is
+// O(n) in the number of Blocks) in a buffer of `nr_lines` lines, which
+// causes a lot of Block splitting and merging. Comparing the output of `make bench` with that of `make
+// bench BLOCK_POOL_DISABLE=1` shows the effect of the Block allocator.
+static void bench_blocks(size_t nr_lines, size_t nr_edits)
+{
+    EditorState *e = init_headless_editor();
+    View *view = e->view;
+    String text = string_new(nr_lines * 32);
+    for (size_t i = 0; i < nr_lines; i++) {
+        string_sprintf(&text, "%016zu abc %09zu\n", i, i);
+    }
+
+    buffer_insert_bytes(view, text.buffer, text.len);
+    size_t size = text.len;
+    string_free(&text);
+
+    static const char line[] = "inserted line of text\n";
+    const size_t len = sizeof(line) - 1;
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    size_t offset = 0;
+    block_iter_bof(&view->cursor);
+    struct timespec start = get_time();
+
+    for (size_t i = 0; i < nr_edits; i++) {
+        seed = (seed * 6364136223846793005ULL) + 1442695040888963407ULL;
+        size_t skip = (seed >> 33) % 512;
+        if (offset + skip < size) {
+            block_iter_skip_bytes(&view->cursor, skip);
+            offset += skip;
+        } else {
+            block_iter_bof(&view->cursor);
+            offset = 0;
+        }
+        if (i & 1) {
+            // The final newline is never deleted (see buffer_delete_bytes())
+            size_t n = MIN(len, size - offset - 1);
+            buffer_delete_bytes(view, n);
+            size -= n;
+        } else {
+            buffer_insert_bytes(view, line, len);
+            size += len;
+        }
+    }
+
+    struct timespec end = get_time();
+    struct timespec duration = timespec_subtract(&end, &start);
+    uintmax_t counts[2];
+    buffer_count_blocks_and_bytes(e->buffer, counts);
+    CHECK_RESULT(counts[1], size);
+    CHECK_RESULT(block_iter_get_offset(&view->cursor), offset);
+
+    fprintf (
+        stderr,
+        "   BENCH  blocks (%s): %zu edits  %8ju ms  %8ju blocks  %8ju KiB peak RSS\n",
+        BLOCK_POOL_DISABLE ? "malloc" : "pool",
+        nr_edits,
+        timespec_to_ns(&duration) / 1000000,
+        counts[0],
+        get_max_rss()
+    );
+
+    // Merge the small Blocks left behind by the edits above, as would
+    // be done incrementally by main_loop() while waiting for input
+    start = get_time();
+    while (!defrag_blocks(e->buffer, 64)) {
+        ;
+    }
+    end = get_time();
+    duration = timespec_subtract(&end, &start);
+    buffer_count_blocks_and_bytes(e->buffer, counts);
+    CHECK_RESULT(counts[1], size);
+    CHECK_RESULT(block_iter_get_offset(&view->cursor), offset);
+
+    fprintf (
+        stderr,
+        "   BENCH  blocks (%s): defrag  %8ju ms  %8ju blocks\n",
+        BLOCK_POOL_DISABLE ? "malloc" : "pool",
+        timespec_to_ns(&duration) / 1000000,
+        counts[0]
+    );
+
+    frame_remove(e, e->root_frame);
+    free_editor_state(e);
+}
+
+// Write a tags(5) file of `nr_tags` entries (sorted by name, with every
+// 8th name defined twice), as a stand-in for the tags file of a very
+// large project
+static void make_tags_fixture(const char *path, size_t nr_tags)
+{
+    FILE *f = fopen(path, "w");
+    if (unlikely(!f)) {
+        perror_exit("fopen");
+    }
+
+    fputs (
+        "!_TAG_FILE_FORMAT\t2\t/extended format/\n"
+        "!_TAG_FILE_SORTED\t1\t/0=unsorted, 1=sorted, 2=foldcase/\n",
+        f
+    );
+
+    for (size_t i = 0; i < nr_tags; i++) {
+        size_t n = (i % 8 == 0) ? 2 : 1;
+        for (size_t j = 0; j < n; j++) {
+            fprintf (
+                f,
+                "symbol_%08zu\tsrc/dir%zu/file%zu.c\t/^int symbol_%08zu(void)$/;\"\tf\n",
+                i, i % 64, (i / 64) % 128 + j, i
+            );
+        }
+    }
+
+    if (unlikely(fclose(f) != 0)) {
+        perror_exit("fclose");
+    }
+}
+
+static size_t do_bench_tag_lookup(TagFile *tf, size_t nr_tags, unsigned int iters)
+{
+    MessageList msgs = {.pos = 0};
+    ErrorBuffer ebuf = {.print_to_stderr = false};
+    size_t nr_found = 0;
+    char name[32];
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+
+    for (unsigned int i = 0; i < iters; i++) {
+        seed = (seed * 6364136223846793005ULL) + 1442695040888963407ULL;
+        size_t n = (seed >> 33) % nr_tags;
+        xsnprintf(name, sizeof name, "symbol_%08zu", n);
+        size_t count = tag_lookup(tf, &msgs, &ebuf, strview(name), NULL);
+        CHECK_RESULT(count, (n % 8 == 0) ? 2 : 1);
+        nr_found += count;
+        clear_messages(&msgs);
+    }
+
+    return nr_found;
+}
+
+// Look up tags in a file of `nr_tags` entries, first with the sorted
+// region of the file being binary searched and then (after marking the
+// file as unsorted) with the linear scan used for unsorted files
+static void bench_tags(size_t nr_tags)
+{
+    static const char dir[] = "build/test/tags-fixture";
+    if (mkdir(dir, 0777) != 0 && errno != EEXIST) {
+        perror_exit("mkdir");
+    }
+
+    char path[256];
+    xsnprintf(path, sizeof path, "%s/tags", dir);
+    make_tags_fixture(path, nr_tags);
+
+    char cwd[8192];
+    if (unlikely(!getcwd(cwd, sizeof cwd))) {
+        perror_exit("getcwd");
+    }
+    if (unlikely(chdir(dir) != 0)) {
+        perror_exit("chdir");
+    }
+
+    ErrorBuffer ebuf = {.print_to_stderr = true};
+    TagFile tf = {.filename = NULL};
+    struct timespec start = get_time();
+    if (unlikely(!load_tag_file(&tf, &ebuf))) {
+        error_exit("load_tag_file() failed: %s", ebuf.buf);
+    }
+    report(&start, 1, "load_tag_file() <- %zu", nr_tags);
+    CHECK_RESULT(tf.sort_order, TAGS_SORTED);
+
+    unsigned int iters = 10000;
+    start = get_time();
+    do_bench_tag_lookup(&tf, nr_tags, iters);
+    report(&start, iters, "tag_lookup() <- %zu (sorted)", nr_tags);
+
+    // The first call to collect_tags() also builds TagFile::names
+    PointerArray names = PTR_ARRAY_INIT;
+    start = get_time();
+    collect_tags(&tf, &names, strview("symbol_0000000"));
+    report(&start, 1, "collect_tags() <- %zu (first)", nr_tags);
+    CHECK_RESULT(names.count, MIN(nr_tags, 10));
+    ptr_array_free(&names);
+
+    // Complete 6-digit prefixes, each of which matches 100 names
+    iters = 10000;
+    size_t nr_prefixes = MAX(nr_tags / 100, 1);
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    start = get_time();
+    for (unsigned int i = 0; i < iters; i++) {
+        seed = (seed * 6364136223846793005ULL) + 1442695040888963407ULL;
+        char prefix[32];
+        size_t n = (seed >> 33) % nr_prefixes;
+        xsnprintf(prefix, sizeof prefix, "symbol_%06zu", n);
+        collect_tags(&tf, &names, strview(prefix));
+        CHECK_RESULT(names.count, MIN(nr_tags - (n * 100), 100));
+        ptr_array_free(&names);
+    }
+    report(&start, iters, "collect_tags() <- %zu", nr_tags);
+
+    // Force a linear scan, as would be done for an unsorted file
+    tf.sort_order = TAGS_UNSORTED;
+    iters = 5;
+    start = get_time();
+    do_bench_tag_lookup(&tf, nr_tags, iters);
+    report(&start, iters, "tag_lookup() <- %zu (unsorted)", nr_tags);
+
+    tag_file_free(&tf);
+    if (unlikely(chdir(cwd) != 0)) {
+        perror_exit("chdir");
+    }
+}
+
+// Spawn true(1) and wait for it to exit, either with fork_exec() or with
+// a plain fork(3) and execvp(3), as a baseline for comparison
+static void spawn_true(int fd[3], bool plain_fork)
+{
+    const char *argv[] = {"true", NULL};
+    if (!plain_fork) {
+        pid_t pid = fork_exec(argv, fd, 0, 0, true);
+        if (unlikely(pid == -1)) {
+            perror_exit("fork_exec");
+        }
+        CHECK_RESULT(wait_child(pid), 0);
+        return;
+    }
+
+    pid_t pid = fork();
+    if (unlikely(pid == -1)) {
+        perror_exit("fork");
+    }
+    if (pid == 0) {
+        for (int i = STDIN_FILENO; i <= STDERR_FILENO; i++) {
+            dup2(fd[i], i);
+        }
+        execvp(argv[0], (char**)argv);
+        _exit(127);
+    }
+    CHECK_RESULT(wait_child(pid), 0);
+}
+
+// Measure the latency of spawning a child process, with the resident
+// set size of the editor process grown in steps up to `max_mib` MiB
+// (since the cost of fork(3) grows with the size of the page tables
+// being copied, whereas posix_spawnp(3) is typically constant)
+static void bench_spawn(size_t max_mib)
+{
+    int dev_null = xopen("/dev/null", O_RDWR | O_CLOEXEC, 0);
+    if (dev_null < 0) {
+        perror_exit("open");
+    }
+
+    int fd[3] = {dev_null, dev_null, dev_null};
+    const unsigned int iters = 200;
+    char *mem = NULL;
+
+    for (size_t mib = 0; mib <= max_mib; mib = mib ? mib * 4 : 16) {
+        size_t size = mib << 20;
+        mem = xrealloc(mem, MAX(size, 1));
+        memset(mem, 'x', size); // Ensure pages are resident
+
+        uintmax_t us[2];
+        for (size_t i = 0; i < ARRAYLEN(us); i++) {
+            struct timespec start = get_time();
+            for (unsigned int j = 0; j < iters; j++) {
+                spawn_true(fd, i == 1);
+            }
+            struct timespec end = get_time();
+            struct timespec duration = timespec_subtract(&end, &start);
+            us[i] = timespec_to_ns(&duration) / iters / 1000;
+        }
+
+        fprintf (
+            stderr,
+            "   BENCH  spawn: %5zu MiB  %6ju us/fork_exec  %6ju us/fork  %8ju KiB peak RSS\n",
+            mib, us[0], us[1], get_max_rss()
+        );
+    }
+
+    free(mem);
+    xclose(dev_null);
+}
+
+// Fork a child process to run a benchmark that uses an EditorState,
+// returning true in the child and false in the parent (once the child
+// has exited successfully). This is needed when running more than one
+// such benchmark, since free_editor_state() also frees process-wide
+// state (e.g. the str_intern() table) that init_editor_state() doesn't
+// re-create. It also keeps get_max_rss() and chdir(2) local to each one.
+static bool fork_benchmark(void)
+{
+    fflush(NULL);
+    pid_t pid = fork();
+    if (unlikely(pid < 0)) {
+        perror_exit("fork");
+    }
+    if (pid == 0) {
+        return true;
+    }
+
+    int status = wait_child(pid);
+    if (unlikely(status < 0)) {
+        error_exit("waitpid: %s", strerror(-status));
+    }
+    if (unlikely(status >= 256)) {
+        error_exit("benchmark process killed by signal %d", status >> 8);
+    }
+    if (unlikely(status != 0)) {
+        error_exit("benchmark process exited with status %d", status);
+    }
+    return false;
+}
+
+int main(int argc, char *argv[])
+{
+    const bool render_only = (argc > 1 && streq(argv[1], "render"));
+    const bool exec_only = (argc > 1 && streq(argv[1], "exec"));
+    const bool spawn_only = (argc > 1 && streq(argv[1], "spawn"));
+    const bool undo_only = (argc > 1 && streq(argv[1], "undo"));
+    const bool blocks_only = (argc > 1 && streq(argv[1], "blocks"));
+    const bool tags_only = (argc > 1 && streq(argv[1], "tags"));
     struct timespec res;
     if (clock_getres(CLOCK_MONOTONIC, &res) != 0) {
         perror_exit("clock_getres");
@@ -303,12 +1072,92 @@ int main(void)
         fprintf(stderr, "%s:%d: timer resolution: %juns\n", __FILE__, __LINE__, res_ns);
     }
 
+    if (render_only) {
+        bench_render();
+        return 0;
+    }
+
+    if (exec_only) {
+        // Default to a multi-GiB run, unless a size (in MiB) is specified
+        unsigned int mib = 2048;
+        if (argc > 2 && !str_to_uint(argv[2], &mib)) {
+            error_exit("Invalid size: %s", argv[2]);
+        }
+        bench_exec(mib);
+        return 0;
+    }
+
+    if (spawn_only) {
+        unsigned int mib = 1024;
+        if (argc > 2 && !str_to_uint(argv[2], &mib)) {
+            error_exit("Invalid size: %s", argv[2]);
+        }
+        bench_spawn(mib);
+        return 0;
+    }
+
+    if (undo_only) {
+        unsigned int lines = 500000;
+        if (argc > 2 && !str_to_uint(argv[2], &lines)) {
+            error_exit("Invalid number of lines: %s", argv[2]);
+        }
+        bench_undo(lines);
+        return 0;
+    }
+
+    if (blocks_only) {
+        unsigned int edits = 200000;
+        if (argc > 2 && !str_to_uint(argv[2], &edits)) {
+            error_exit("Invalid number of edits: %s", argv[2]);
+        }
+        bench_blocks(50000, edits);
+        return 0;
+    }
+
+    if (tags_only) {
+        unsigned int nr_tags = 4000000;
+        if (argc > 2 && !str_to_uint(argv[2], &nr_tags)) {
+            error_exit("Invalid number of tags: %s", argv[2]);
+        }
+        bench_tags(nr_tags);
+        return 0;
+    }
+
     bench_find_ft();
     bench_get_indent();
     bench_parse_rgb();
     bench_string_append_escaped_arg();
     bench_u_set_char();
     bench_u_set_char_raw();
+    bench_u_char_width();
     bench_human_readable_size();
+    bench_term_put_line();
+    bench_grep_path();
+
+    if (fork_benchmark()) {
+        bench_render();
+        return 0;
+    }
+    if (fork_benchmark()) {
+        bench_exec(64);
+        return 0;
+    }
+    if (fork_benchmark()) {
+        bench_spawn(64);
+        return 0;
+    }
+    if (fork_benchmark()) {
+        bench_undo(20000);
+        return 0;
+    }
+    if (fork_benchmark()) {
+        bench_blocks(20000, 100000);
+        return 0;
+    }
+    if (fork_benchmark()) {
+        bench_tags(200000);
+        return 0;
+    }
+
     return 0;
 }
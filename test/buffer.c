@@ -1,8 +1,12 @@
 #include <stdlib.h>
+#include <string.h>
 #include "test.h"
 #include "buffer.h"
+#include "change.h"
+#include "edit.h"
 #include "editor.h"
 #include "indent.h"
+#include "move.h"
 #include "regexp.h"
 
 static void test_find_buffer_by_id(TestContext *ctx)
@@ -164,12 +168,597 @@ static void test_buffer_insert_bytes(TestContext *ctx)
     window_close_current_view(e->window);
 }
 
+static void test_view_update_cursor_x_long_line(TestContext *ctx)
+{
+    // Each repetition of "\xE6\xBC\xA2\xC3\xA9-" ("漢é-") is 6 bytes, 3
+    // codepoints and 4 columns wide. The checkpoint interval used by
+    // View::column_cache isn't a multiple of 6, so some checkpoints fall
+    // in the middle of multi-byte characters.
+    static const char unit[] = "\xE6\xBC\xA2\xC3\xA9-";
+    static_assert(sizeof(unit) - 1 == 6);
+    static_assert(COLUMN_CACHE_INTERVAL % 6 != 0);
+    const size_t n = 600;
+    const size_t len = 1 + (n * 6) + 1;
+    char *text = xmalloc(len);
+    text[0] = '\t';
+    for (size_t i = 0; i < n; i++) {
+        memcpy(text + 1 + (i * 6), unit, 6);
+    }
+    text[len - 1] = '\n';
+
+    EditorState *e = ctx->userdata;
+    View *view = window_open_empty_buffer(e->window);
+    Buffer *buffer = view->buffer;
+    ASSERT_EQ(buffer->options.tab_width, 8);
+    buffer_insert_bytes(view, text, len);
+    free(text);
+
+    static const size_t units[] = {500, 100, 599, 0, 86, 85, 300};
+    for (size_t i = 0; i < ARRAYLEN(units); i++) {
+        size_t k = units[i];
+        block_iter_goto_offset(&view->cursor, 1 + (k * 6));
+        view_update(view);
+        EXPECT_EQ(view->cx, 1 + (k * 6));
+        EXPECT_EQ(view->cx_char, 1 + (k * 3));
+        EXPECT_EQ(view->cx_display, 8 + (k * 4));
+    }
+
+    // Edits and `tab-width` changes must invalidate the cache
+    block_iter_goto_offset(&view->cursor, 0);
+    buffer_insert_bytes(view, "xx", 2);
+    block_iter_goto_offset(&view->cursor, 3 + (500 * 6));
+    view_update(view);
+    EXPECT_EQ(view->cx_char, 3 + (500 * 3));
+    EXPECT_EQ(view->cx_display, 8 + (500 * 4));
+
+    buffer->options.tab_width = 4;
+    view_update(view);
+    EXPECT_EQ(view->cx_char, 3 + (500 * 3));
+    EXPECT_EQ(view->cx_display, 4 + (500 * 4));
+    buffer->options.tab_width = 8;
+
+    window_close_current_view(e->window);
+}
+
+static void test_column_cache_find_column(TestContext *ctx)
+{
+    // See test_view_update_cursor_x_long_line() for the "漢é-" pattern
+    static const char unit[] = "\xE6\xBC\xA2\xC3\xA9-";
+    const size_t n = 600;
+    const size_t len = 1 + (n * 6);
+    char *text = xmalloc(len);
+    text[0] = '\t';
+    for (size_t i = 0; i < n; i++) {
+        memcpy(text + 1 + (i * 6), unit, 6);
+    }
+
+    // Display width of the first 0, 3 or 5 bytes of `unit`
+    static const uint8_t unit_prefix_width[6] = {0, 0, 0, 2, 0, 3};
+    const StringView line = string_view(text, len);
+    ColumnCache cache = {.count = 0};
+
+    // The cache should only be extended as far as needed
+    ColumnCheckpoint cp = column_cache_find_column(&cache, line, 0, 8, 100);
+    EXPECT_EQ(cp.offset, 0);
+    EXPECT_EQ(cp.cx_display, 0);
+    EXPECT_EQ(cache.count, 2);
+
+    static const long columns[] = {1, 8, 9, 400, 1000, 2407, 2408, 9999, 500};
+    for (size_t i = 0; i < ARRAYLEN(columns); i++) {
+        long x = columns[i];
+        cp = column_cache_find_column(&cache, line, 0, 8, x);
+        EXPECT_TRUE(cp.cx_display < x || cp.offset == 0);
+        EXPECT_TRUE(x - cp.cx_display <= COLUMN_CACHE_INTERVAL || cp.offset > len - COLUMN_CACHE_INTERVAL);
+        if (cp.offset == 0) {
+            EXPECT_EQ(cp.cx_display, 0);
+            continue;
+        }
+        size_t k = (cp.offset - 1) / 6;
+        size_t r = (cp.offset - 1) % 6;
+        EXPECT_EQ(cp.cx_display, 8 + (k * 4) + unit_prefix_width[r]);
+        EXPECT_EQ(cp.cx_char, 1 + (k * 3) + (r >= 3) + (r >= 5));
+    }
+
+    // A different `edit_count` or `tab_width` must invalidate the cache
+    cp = column_cache_find_column(&cache, line, 1, 4, 1000);
+    EXPECT_EQ(cp.cx_display, 4 + (((cp.offset - 1) / 6) * 4) + unit_prefix_width[(cp.offset - 1) % 6]);
+
+    free(cache.checkpoints);
+    free(text);
+}
+
+static void test_block_iter_get_segments(TestContext *ctx)
+{
+    EditorState *e = ctx->userdata;
+    View *view = window_open_empty_buffer(e->window);
+    Buffer *buffer = view->buffer;
+
+    // Insert enough lines to be split into many Blocks
+    String text = string_new(8192);
+    for (size_t i = 0; i < 400; i++) {
+        string_sprintf(&text, "line %zu\n", i);
+    }
+    buffer_insert_bytes(view, text.buffer, text.len);
+
+    const ListHead *head = &buffer->blocks;
+    ASSERT_TRUE(block_has_next(buffer_get_first_block(buffer), head));
+
+    static const size_t starts[] = {0, 1, 777, 2000};
+    for (size_t i = 0; i < ARRAYLEN(starts); i++) {
+        size_t start = starts[i];
+        size_t len = text.len - start - 3;
+        BlockIter bi = block_iter(buffer);
+        block_iter_goto_offset(&bi, start);
+
+        size_t n;
+        StringView *segments = block_iter_get_segments(bi, len, &n);
+        ASSERT_NONNULL(segments);
+        EXPECT_TRUE(n > 1);
+
+        String joined = string_new(len);
+        for (size_t j = 0; j < n; j++) {
+            string_append_strview(&joined, segments[j]);
+        }
+        EXPECT_EQ(joined.len, len);
+        EXPECT_MEMEQ(joined.buffer, joined.len, text.buffer + start, len);
+        string_free(&joined);
+        free(segments);
+    }
+
+    size_t n = 1;
+    EXPECT_NULL(block_iter_get_segments(block_iter(buffer), 0, &n));
+    EXPECT_EQ(n, 0);
+
+    string_free(&text);
+    window_close_current_view(e->window);
+}
+
+// Append `len` bytes to `bl` in small chunks, in the same way as
+// handle_piped_data() does when reading from a pipe
+static void append_in_chunks(BlockList *bl, const char *text, size_t len)
+{
+    for (size_t pos = 0; pos < len; ) {
+        size_t avail;
+        char *buf = block_list_reserve_space(bl, 100, &avail);
+        size_t n = MIN3(avail, len - pos, 1000);
+        memcpy(buf, text + pos, n);
+        block_list_commit(bl, n);
+        pos += n;
+    }
+}
+
+static void test_buffer_replace_blocks(TestContext *ctx)
+{
+    String text = string_new(64 * 1024);
+    for (size_t i = 0; i < 3000; i++) {
+        string_sprintf(&text, "line %zu\n", i);
+    }
+
+    // A line too long to fit in (or be split across) normal sized Blocks
+    string_append_memset(&text, 'x', 20000);
+    string_append_cstring(&text, "\nno newline");
+
+    BlockList bl;
+    block_list_init(&bl);
+    append_in_chunks(&bl, text.buffer, text.len);
+    EXPECT_EQ(bl.size, text.len);
+    EXPECT_EQ(bl.nl, 3001);
+
+    const Block *blk;
+    size_t nr_blocks = 0;
+    size_t total = 0;
+    block_for_each(blk, &bl.blocks) {
+        nr_blocks++;
+        total += blk->size;
+        if (block_has_next(blk, &bl.blocks)) {
+            EXPECT_EQ(blk->data[blk->size - 1], '\n');
+        }
+    }
+    EXPECT_TRUE(nr_blocks > 3);
+    EXPECT_EQ(total, text.len);
+
+    EditorState *e = ctx->userdata;
+    View *view = window_open_empty_buffer(e->window);
+    Buffer *buffer = view->buffer;
+    buffer_insert_bytes(view, "abc\ndef\n", 8);
+
+    // Replace the "e" in "def" with the contents of the BlockList
+    block_iter_goto_offset(&view->cursor, 5);
+    buffer_replace_blocks(view, 1, &bl);
+    EXPECT_EQ(bl.size, 0);
+    EXPECT_TRUE(list_empty(&bl.blocks));
+    EXPECT_EQ(block_iter_get_offset(&view->cursor), 5);
+    EXPECT_EQ(buffer->nl, 3003);
+
+    String expected = string_new(text.len + 8);
+    string_append_cstring(&expected, "abc\nd");
+    string_append_string(&expected, &text);
+    string_append_cstring(&expected, "f\n");
+
+    uintmax_t counts[2];
+    buffer_count_blocks_and_bytes(buffer, counts);
+    EXPECT_EQ(counts[1], expected.len);
+    char *buf = block_iter_get_bytes(block_iter(buffer), expected.len);
+    EXPECT_MEMEQ(buf, expected.len, expected.buffer, expected.len);
+    free(buf);
+
+    // The whole replacement should be undone as a single Change
+    ASSERT_TRUE(undo(view, &e->err));
+    EXPECT_EQ(buffer->nl, 2);
+    buffer_count_blocks_and_bytes(buffer, counts);
+    EXPECT_EQ(counts[0], 1);
+    EXPECT_EQ(counts[1], 8);
+    buf = block_iter_get_bytes(block_iter(buffer), 8);
+    EXPECT_MEMEQ(buf, 8, "abc\ndef\n", 8);
+    free(buf);
+
+    ASSERT_TRUE(redo(view, &e->err, 0));
+    EXPECT_EQ(buffer->nl, 3003);
+    buffer_count_blocks_and_bytes(buffer, counts);
+    EXPECT_EQ(counts[1], expected.len);
+
+    // Text inserted at EOF (without a trailing newline) gets one added
+    block_list_append(&bl, "xyz", 3);
+    move_eof(view);
+    buffer_replace_blocks(view, 0, &bl);
+    EXPECT_EQ(buffer->nl, 3004);
+    buffer_count_blocks_and_bytes(buffer, counts);
+    EXPECT_EQ(counts[1], expected.len + 4);
+
+    block_list_free(&bl);
+    string_free(&expected);
+    string_free(&text);
+    window_close_current_view(e->window);
+}
+
+static void replace_and_mirror(View *view, String *text, size_t offset, size_t del, const char *ins)
+{
+    size_t ins_len = strlen(ins);
+    block_iter_goto_offset(&view->cursor, offset);
+    buffer_replace_bytes(view, del, ins, ins_len);
+    string_remove(text, offset, del);
+    string_insert_buf(text, offset, ins, ins_len);
+}
+
+static void expect_buffer_text(TestContext *ctx, Buffer *buffer, const String *text)
+{
+    uintmax_t counts[2];
+    buffer_count_blocks_and_bytes(buffer, counts);
+    ASSERT_EQ(counts[1], text->len);
+    EXPECT_EQ(buffer->nl, count_nl(text->buffer, text->len));
+    char *buf = block_iter_get_bytes(block_iter(buffer), text->len);
+    EXPECT_MEMEQ(buf, text->len, text->buffer, text->len);
+    free(buf);
+}
+
+static void test_undo_change_chain(TestContext *ctx)
+{
+    String orig = string_new(32 * 1024);
+    for (size_t i = 0; i < 2000; i++) {
+        string_sprintf(&orig, "line %zu\n", i);
+    }
+
+    EditorState *e = ctx->userdata;
+    View *view = window_open_empty_buffer(e->window);
+    Buffer *buffer = view->buffer;
+    buffer_insert_bytes(view, orig.buffer, orig.len);
+
+    // A chain of changes in ascending order of offset, like those
+    // made by `replace -g`, including some that add or remove lines
+    String text = string_new(orig.len + 4096);
+    string_append_string(&text, &orig);
+    begin_change_chain();
+    for (size_t i = 0, pos = 0; i < 2000; i++) {
+        const char *eol = memchr(text.buffer + pos, '\n', text.len - pos);
+        size_t line_len = (size_t)(eol - (text.buffer + pos)) + 1;
+        switch (i % 7) {
+        case 0:
+            replace_and_mirror(view, &text, pos, 4, "LINE\n");
+            line_len += 1;
+            break;
+        case 3:
+            replace_and_mirror(view, &text, pos, line_len, "");
+            line_len = 0;
+            break;
+        case 5:
+            replace_and_mirror(view, &text, pos, 0, "new\n");
+            line_len += 4;
+            break;
+        }
+        pos += line_len;
+    }
+    end_change_chain(view);
+    expect_buffer_text(ctx, buffer, &text);
+
+    ASSERT_TRUE(undo(view, &e->err));
+    expect_buffer_text(ctx, buffer, &orig);
+    EXPECT_EQ(block_iter_get_offset(&view->cursor), 0);
+    ASSERT_TRUE(redo(view, &e->err, 0));
+    expect_buffer_text(ctx, buffer, &text);
+    ASSERT_TRUE(undo(view, &e->err));
+    expect_buffer_text(ctx, buffer, &orig);
+
+    // A chain in descending order of offset, ending with an insertion
+    // at the start of the buffer
+    string_clear(&text);
+    string_append_string(&text, &orig);
+    begin_change_chain();
+    for (size_t pos = orig.len - 1000; pos >= 1000; pos -= 1000) {
+        replace_and_mirror(view, &text, pos, 10, "x\ny\nz");
+    }
+    replace_and_mirror(view, &text, 0, 0, "first\n");
+    end_change_chain(view);
+    expect_buffer_text(ctx, buffer, &text);
+
+    ASSERT_TRUE(undo(view, &e->err));
+    expect_buffer_text(ctx, buffer, &orig);
+    ASSERT_TRUE(redo(view, &e->err, 0));
+    expect_buffer_text(ctx, buffer, &text);
+    EXPECT_EQ(block_iter_get_offset(&view->cursor), 0);
+    ASSERT_TRUE(undo(view, &e->err));
+    expect_buffer_text(ctx, buffer, &orig);
+
+    // A chain of overlapping changes, which can't be undone in one pass
+    string_clear(&text);
+    string_append_string(&text, &orig);
+    begin_change_chain();
+    replace_and_mirror(view, &text, 5000, 20, "abc");
+    replace_and_mirror(view, &text, 4990, 30, "\n\n");
+    replace_and_mirror(view, &text, 9000, 1, "");
+    end_change_chain(view);
+    expect_buffer_text(ctx, buffer, &text);
+
+    ASSERT_TRUE(undo(view, &e->err));
+    expect_buffer_text(ctx, buffer, &orig);
+    ASSERT_TRUE(redo(view, &e->err, 0));
+    expect_buffer_text(ctx, buffer, &text);
+
+    string_free(&text);
+    string_free(&orig);
+    window_close_current_view(e->window);
+}
+
+static void test_undo_arena(TestContext *ctx)
+{
+    String orig = string_new(64 * 1024);
+    for (size_t i = 0; i < 1000; i++) {
+        string_sprintf(&orig, "%04zu abcdefghijklmnopqrstuvwxyz\n", i);
+    }
+
+    EditorState *e = ctx->userdata;
+    View *view = window_open_empty_buffer(e->window);
+    Buffer *buffer = view->buffer;
+    const UndoArena *arena = &buffer->undo_arena;
+    buffer_insert_bytes(view, orig.buffer, orig.len);
+    EXPECT_EQ(arena->nr_changes, 1);
+    EXPECT_EQ(arena->heap_bytes, 0);
+
+    // Merged deletions, which grow the payload past UNDO_LARGE_PAYLOAD
+    // (and thus move it out of the arena)
+    String text = string_new(orig.len);
+    string_append_string(&text, &orig);
+    block_iter_goto_offset(&view->cursor, 100);
+    for (size_t i = 0; i < 200; i++) {
+        begin_change(CHANGE_MERGE_DELETE);
+        buffer_delete_bytes(view, 100);
+        end_change();
+        string_remove(&text, 100, 100);
+    }
+    EXPECT_EQ(arena->nr_changes, 2);
+    EXPECT_EQ(arena->heap_bytes, 200 * 100);
+    expect_buffer_text(ctx, buffer, &text);
+    ASSERT_TRUE(undo(view, &e->err));
+    EXPECT_EQ(arena->heap_bytes, 0);
+    expect_buffer_text(ctx, buffer, &orig);
+
+    // Merged erasures (as done by backspace), which prepend to the payload
+    string_clear(&text);
+    string_append_string(&text, &orig);
+    for (size_t i = 0; i < 50; i++) {
+        block_iter_goto_offset(&view->cursor, 500 - i - 1);
+        begin_change(CHANGE_MERGE_ERASE);
+        buffer_erase_bytes(view, 1);
+        end_change();
+        string_remove(&text, 500 - i - 1, 1);
+    }
+    expect_buffer_text(ctx, buffer, &text);
+    ASSERT_TRUE(undo(view, &e->err));
+    expect_buffer_text(ctx, buffer, &orig);
+    EXPECT_EQ(block_iter_get_offset(&view->cursor), 500);
+
+    // Each undo/redo frees one payload and allocates another, so this
+    // should trigger compaction (more than once) and leave no more than
+    // UNDO_COMPACT_MIN bytes of freed space in the arena
+    string_clear(&text);
+    string_append_string(&text, &orig);
+    begin_change(CHANGE_MERGE_NONE);
+    replace_and_mirror(view, &text, 1000, 2000, "x\ny\n");
+    bool ok = true;
+    for (size_t i = 0; i < 500; i++) {
+        ok = ok && undo(view, &e->err) && redo(view, &e->err, 0);
+    }
+    ASSERT_TRUE(ok);
+    expect_buffer_text(ctx, buffer, &text);
+    EXPECT_TRUE(arena->dead_bytes < 256 * 1024);
+    EXPECT_TRUE(undo_memory_usage(arena) < 512 * 1024);
+    ASSERT_TRUE(undo(view, &e->err));
+    expect_buffer_text(ctx, buffer, &orig);
+
+    string_free(&text);
+    string_free(&orig);
+    window_close_current_view(e->window);
+}
+
+static void test_undo_memory_limit(TestContext *ctx)
+{
+    String orig = string_new(64 * 1024);
+    for (size_t i = 0; i < 1000; i++) {
+        string_sprintf(&orig, "%04zu abcdefghijklmnopqrstuvwxyz\n", i);
+    }
+
+    EditorState *e = ctx->userdata;
+    GlobalOptions saved_options = e->options;
+    e->options.undo_memory_limit = 8 * 1024;
+    e->options.undo_journal = true;
+
+    View *view = window_open_empty_buffer(e->window);
+    Buffer *buffer = view->buffer;
+    const UndoArena *arena = &buffer->undo_arena;
+    buffer_insert_bytes(view, orig.buffer, orig.len);
+
+    // Each replacement records a 1KiB payload, so the oldest ones
+    // should be spilled to the journal as the limit is exceeded
+    String text = string_new(orig.len);
+    string_append_string(&text, &orig);
+    for (size_t i = 0; i < 20; i++) {
+        begin_change(CHANGE_MERGE_NONE);
+        replace_and_mirror(view, &text, i * 100, 1000, "x\n");
+        end_change();
+    }
+    expect_buffer_text(ctx, buffer, &text);
+    EXPECT_TRUE(arena->journal_bytes > 0);
+    EXPECT_EQ(arena->dropped_bytes, 0);
+    EXPECT_TRUE(arena->live_bytes <= 8 * 1024);
+
+    // Undoing everything should page the payloads back in, transparently
+    bool ok = true;
+    for (size_t i = 0; i < 20; i++) {
+        ok = ok && undo(view, &e->err);
+    }
+    ASSERT_TRUE(ok);
+    expect_buffer_text(ctx, buffer, &orig);
+
+    for (size_t i = 0; i < 20; i++) {
+        ok = ok && redo(view, &e->err, 0);
+    }
+    ASSERT_TRUE(ok);
+    expect_buffer_text(ctx, buffer, &text);
+    window_close_current_view(e->window);
+
+    // With `undo-journal` disabled, spilled payloads are discarded
+    // and undo stops at the first change that can't be reversed
+    e->options.undo_journal = false;
+    view = window_open_empty_buffer(e->window);
+    buffer = view->buffer;
+    arena = &buffer->undo_arena;
+    buffer_insert_bytes(view, orig.buffer, orig.len);
+    string_clear(&text);
+    string_append_string(&text, &orig);
+    for (size_t i = 0; i < 20; i++) {
+        begin_change(CHANGE_MERGE_NONE);
+        replace_and_mirror(view, &text, i * 100, 1000, "x\n");
+        end_change();
+    }
+    EXPECT_EQ(arena->journal_bytes, 0);
+    EXPECT_TRUE(arena->dropped_bytes > 0);
+
+    size_t nr_undone = 0;
+    while (undo(view, &e->err)) {
+        nr_undone++;
+    }
+    EXPECT_TRUE(nr_undone > 0);
+    EXPECT_TRUE(nr_undone < 20);
+    EXPECT_TRUE(str_has_prefix(e->err.buf, "Undo history discarded"));
+    clear_error(&e->err);
+
+    e->options = saved_options;
+    string_free(&text);
+    string_free(&orig);
+    window_close_current_view(e->window);
+}
+
+static void test_defrag_blocks(TestContext *ctx)
+{
+    EditorState *e = ctx->userdata;
+    View *view = window_open_empty_buffer(e->window);
+    Buffer *buffer = view->buffer;
+    ListHead *head = &buffer->blocks;
+    block_free(BLOCK(head->next));
+    ASSERT_TRUE(list_empty(head));
+
+    // Create a buffer with 1 line per Block
+    String text = string_new(64 * 1024);
+    const size_t nr_lines = 3000;
+    for (size_t i = 0; i < nr_lines; i++) {
+        size_t start = text.len;
+        string_sprintf(&text, "line %zu\n", i);
+        size_t len = text.len - start;
+        Block *blk = block_new(len);
+        memcpy(blk->data, text.buffer + start, len);
+        blk->size = len;
+        blk->nl = 1;
+        list_insert_before(&blk->node, head);
+        if (i == nr_lines / 2) {
+            view->cursor = (BlockIter){.blk = blk, .head = head, .offset = 3};
+        }
+    }
+
+    buffer->nl = nr_lines;
+    buffer->edit_count++;
+    size_t cursor_offset = block_iter_get_offset(&view->cursor);
+    expect_buffer_text(ctx, buffer, &text);
+
+    // Each call visits (or merges) at most 100 Blocks and then stops,
+    // with the next call resuming from where it left off
+    uintmax_t counts[2];
+    EXPECT_FALSE(defrag_blocks(buffer, 100));
+    buffer_count_blocks_and_bytes(buffer, counts);
+    EXPECT_TRUE(counts[0] < nr_lines);
+    EXPECT_TRUE(counts[0] >= nr_lines - 100);
+    EXPECT_NONNULL(buffer->defrag_blk);
+    EXPECT_EQ(buffer->defrag_edit_count, buffer->edit_count);
+
+    size_t nr_calls = 1;
+    while (!defrag_blocks(buffer, 100)) {
+        nr_calls++;
+    }
+    // Each of the `nr_lines - 1` adjacent pairs was visited exactly once,
+    // with the final call (which returned true) included
+    EXPECT_EQ(nr_calls + 1, (nr_lines - 1 + 99) / 100);
+    EXPECT_NULL(buffer->defrag_blk);
+    EXPECT_EQ(buffer->nl, nr_lines);
+    EXPECT_EQ(block_iter_get_offset(&view->cursor), cursor_offset);
+    expect_buffer_text(ctx, buffer, &text);
+
+    // No adjacent pair of Blocks should be small enough to merge
+    bool merged = true;
+    const Block *blk;
+    block_for_each(blk, head) {
+        bool last = !block_has_next(blk, head);
+        merged = merged && blk->nl == count_nl(blk->data, blk->size);
+        merged = merged && (last || blk->size + block_next(blk)->size > 512);
+    }
+    EXPECT_TRUE(merged);
+    buffer_count_blocks_and_bytes(buffer, counts);
+    EXPECT_TRUE(counts[0] < text.len / 256);
+
+    // Nothing more to do, until the next edit
+    unsigned long edit_count = buffer->edit_count;
+    EXPECT_TRUE(defrag_blocks(buffer, 100));
+    EXPECT_EQ(buffer->edit_count, edit_count);
+    buffer_insert_bytes(view, "x", 1);
+    EXPECT_NE(buffer->edit_count, buffer->defrag_edit_count);
+    EXPECT_TRUE(defrag_blocks(buffer, 100));
+    EXPECT_EQ(buffer->edit_count, buffer->defrag_edit_count);
+
+    string_free(&text);
+    window_close_current_view(e->window);
+}
+
 static const TestEntry tests[] = {
     TEST(test_find_buffer_by_id),
     TEST(test_buffer_mark_lines_changed),
     TEST(test_make_indent),
     TEST(test_get_indent_for_next_line),
     TEST(test_buffer_insert_bytes),
+    TEST(test_view_update_cursor_x_long_line),
+    TEST(test_column_cache_find_column),
+    TEST(test_block_iter_get_segments),
+    TEST(test_buffer_replace_blocks),
+    TEST(test_undo_change_chain),
+    TEST(test_undo_arena),
+    TEST(test_undo_memory_limit),
+    TEST(test_defrag_blocks),
 };
 
 const TestGroup buffer_tests = TEST_GROUP(tests);
@@ -430,7 +430,7 @@ static void test_complete_command(TestContext *ctx)
 
     cmdline_set_text(c, "exec -");
     complete_command_next(e);
-    EXPECT_STRING_EQ_CSTRING(&c->buf, "exec -e");
+    EXPECT_STRING_EQ_CSTRING(&c->buf, "exec -b");
     reset_completion(c);
 
     cmdline_set_text(c, "exec -o");
@@ -461,7 +461,7 @@ static void test_complete_command(TestContext *ctx)
 
     cmdline_set_text(c, "exec -s -i buffer -o buffer -");
     complete_command_next(e);
-    EXPECT_STRING_EQ_CSTRING(&c->buf, "exec -s -i buffer -o buffer -e");
+    EXPECT_STRING_EQ_CSTRING(&c->buf, "exec -s -i buffer -o buffer -b");
     reset_completion(c);
 
     cmdline_set_text(c, "exec -s -i buffer ls -");
@@ -3,6 +3,8 @@
 #include <unistd.h>
 #include "test.h"
 #include "config.h"
+#include "block-iter.h"
+#include "buffer.h"
 #include "command/macro.h"
 #include "commands.h"
 #include "convert.h"
@@ -334,6 +336,201 @@ static void test_macro_record(TestContext *ctx)
     EXPECT_EQ(m->prev_macro.count, 0);
 }
 
+static void test_grep(TestContext *ctx)
+{
+    EditorState *e = ctx->userdata;
+    const MessageList *msgs = &e->messages[2];
+    EXPECT_TRUE(handle_normal_command(e, "grep -C 'line #[23]' test/data/3lines.txt", false));
+    ASSERT_EQ(msgs->array.count, 2);
+    EXPECT_EQ(msgs->pos, 0);
+
+    const Message *m = msgs->array.ptrs[0];
+    ASSERT_NONNULL(m->loc);
+    EXPECT_STREQ(m->msg, " line #2");
+    EXPECT_STREQ(m->loc->filename, "test/data/3lines.txt");
+    EXPECT_EQ(m->loc->line, 2);
+    EXPECT_EQ(m->loc->column, 2);
+
+    // Last line has no trailing newline
+    m = msgs->array.ptrs[1];
+    ASSERT_NONNULL(m->loc);
+    EXPECT_STREQ(m->msg, "  line #3");
+    EXPECT_EQ(m->loc->line, 3);
+    EXPECT_EQ(m->loc->column, 3);
+
+    // The first match is activated (opening the file)
+    ASSERT_NONNULL(e->buffer->abs_filename);
+    EXPECT_TRUE(str_has_suffix(e->buffer->abs_filename, "/test/data/3lines.txt"));
+    EXPECT_TRUE(handle_normal_command(e, "close", false));
+
+    // Directory trees are searched recursively, in sorted order
+    EXPECT_TRUE(handle_normal_command(e, "grep -C -e 'c_syntax_test(int' test/data", false));
+    ASSERT_EQ(msgs->array.count, 3);
+    static const struct {
+        const char *filename;
+        unsigned long line;
+    } expected[] = {
+        {"test/data/tag.txt", 1},
+        {"test/data/tags", 1},
+        {"test/data/test.c", 3},
+    };
+    FOR_EACH_I(i, expected) {
+        m = msgs->array.ptrs[i];
+        ASSERT_NONNULL(m->loc);
+        IEXPECT_STREQ(m->loc->filename, expected[i].filename);
+        IEXPECT_EQ(m->loc->line, expected[i].line);
+    }
+
+    EXPECT_TRUE(handle_normal_command(e, "close", false));
+    EXPECT_FALSE(handle_normal_command(e, "grep -C zz_no_match_zz test/data/3lines.txt", false));
+    EXPECT_EQ(msgs->array.count, 0);
+
+    // Background searches are continued by grep_step() (as called by
+    // main_loop(), when idle) and add messages without activating them
+    EXPECT_TRUE(handle_normal_command(e, "grep -bC -e 'c_syntax_test(int' test/data", false));
+    ASSERT_NONNULL(e->grep);
+    EXPECT_EQ(msgs->array.count, 0);
+    size_t nr_steps = 1;
+    while (!grep_step(&e->grep->ctx, 1)) {
+        nr_steps++;
+    }
+    EXPECT_TRUE(nr_steps > 3);
+    EXPECT_EQ(e->grep->ctx.nr_matches, 3);
+    ASSERT_EQ(msgs->array.count, 3);
+    FOR_EACH_I(i, expected) {
+        m = msgs->array.ptrs[i];
+        ASSERT_NONNULL(m->loc);
+        IEXPECT_STREQ(m->loc->filename, expected[i].filename);
+    }
+
+    // Starting another search cancels the previous one
+    EXPECT_TRUE(handle_normal_command(e, "grep -bC xyz test/data", false));
+    ASSERT_NONNULL(e->grep);
+    EXPECT_EQ(msgs->array.count, 0);
+    EXPECT_FALSE(handle_normal_command(e, "grep -C zz_no_match_zz test/data/3lines.txt", false));
+    EXPECT_NULL(e->grep);
+    EXPECT_FALSE(handle_normal_command(e, "grep -bC xyz test/data/non-existent", false));
+    EXPECT_NULL(e->grep);
+
+    // `\n` escapes are expanded in the same way for background searches
+    static const char nl_pattern[] = "'#[12]\\n line' test/data/3lines.txt";
+    char cmd[128];
+    xsnprintf(cmd, sizeof cmd, "grep -C %s", nl_pattern);
+    EXPECT_TRUE(handle_normal_command(e, cmd, false));
+    ASSERT_EQ(msgs->array.count, 1);
+    m = msgs->array.ptrs[0];
+    ASSERT_NONNULL(m->loc);
+    EXPECT_EQ(m->loc->line, 1);
+    EXPECT_TRUE(handle_normal_command(e, "close", false));
+
+    xsnprintf(cmd, sizeof cmd, "grep -bC %s", nl_pattern);
+    EXPECT_TRUE(handle_normal_command(e, cmd, false));
+    ASSERT_NONNULL(e->grep);
+    while (!grep_step(&e->grep->ctx, 1)) {
+        ;
+    }
+    ASSERT_EQ(msgs->array.count, 1);
+    m = msgs->array.ptrs[0];
+    ASSERT_NONNULL(m->loc);
+    EXPECT_EQ(m->loc->line, 1);
+    background_grep_free(e->grep);
+    e->grep = NULL;
+}
+
+static char *get_buffer_text(Buffer *buffer)
+{
+    uintmax_t counts[2];
+    buffer_count_blocks_and_bytes(buffer, counts);
+    BlockIter bi = block_iter(buffer);
+    char *text = block_iter_get_bytes(bi, counts[1]);
+    text[counts[1]] = '\0'; // block_iter_get_bytes() allocates 1 extra byte
+    return text;
+}
+
+static void test_multiline_search_replace(TestContext *ctx)
+{
+    EditorState *e = ctx->userdata;
+    ASSERT_TRUE(handle_normal_command(e, "open", false));
+    View *view = e->view;
+
+    static const char text[] = "foo\nbar\nfoo\nbaz\nfoo\nbar\n";
+    insert_text(view, text, sizeof(text) - 1, false);
+    EXPECT_TRUE(handle_normal_command(e, "search -H 'foo\\nbar'", false));
+    EXPECT_EQ(block_iter_get_offset(&view->cursor), 16);
+    EXPECT_TRUE(handle_normal_command(e, "search -n", false));
+    EXPECT_EQ(block_iter_get_offset(&view->cursor), 0);
+    EXPECT_TRUE(handle_normal_command(e, "search -p", false));
+    EXPECT_EQ(block_iter_get_offset(&view->cursor), 16);
+
+    // Literal newlines are equivalent to `\n` escapes, but `\n` isn't
+    // special inside bracket expressions or after an escaped backslash
+    EXPECT_TRUE(handle_normal_command(e, "search -H -r \"o\\nba[z]\"", false));
+    EXPECT_EQ(block_iter_get_offset(&view->cursor), 10);
+    EXPECT_FALSE(handle_normal_command(e, "search -H 'o[\\n]b'", false));
+    EXPECT_FALSE(handle_normal_command(e, "search -H 'o\\\\nb'", false));
+
+    // Matches can't span more lines than there are newlines in the pattern
+    EXPECT_FALSE(handle_normal_command(e, "search -H 'r\\n[[:alnum:][:space:]]+z'", false));
+    EXPECT_TRUE(handle_normal_command(e, "search -H 'r\\n[a-z]+\\n[a-z]+z'", false));
+    EXPECT_EQ(block_iter_get_offset(&view->cursor), 6);
+
+    EXPECT_TRUE(handle_normal_command(e, "replace 'o\\nb(a[rz])' '\\1\\n'", false));
+    char *buf = get_buffer_text(e->buffer);
+    EXPECT_STREQ(buf, "foar\n\nfoaz\n\nfoar\n\n");
+    free(buf);
+
+    // The final newline in the buffer is included in the lookahead, when
+    // there are fewer lines left than the pattern can span
+    EXPECT_TRUE(handle_normal_command(e, "replace '\\n\\n' '\\n'", false));
+    buf = get_buffer_text(e->buffer);
+    EXPECT_STREQ(buf, "foar\nfoaz\nfoar\n");
+    free(buf);
+
+    // ...so patterns ending with `\n` can match on the last line
+    EXPECT_TRUE(handle_normal_command(e, "replace 'oar\\n' 'x\\n'", false));
+    buf = get_buffer_text(e->buffer);
+    EXPECT_STREQ(buf, "fx\nfoaz\nfx\n");
+    free(buf);
+    EXPECT_TRUE(handle_normal_command(e, "bof; search -H 'x\\n'", false));
+    EXPECT_EQ(block_iter_get_offset(&view->cursor), 1);
+    EXPECT_TRUE(handle_normal_command(e, "search -n", false));
+    EXPECT_EQ(block_iter_get_offset(&view->cursor), 9);
+    EXPECT_TRUE(handle_normal_command(e, "eof; search -p", false));
+    EXPECT_EQ(block_iter_get_offset(&view->cursor), 9);
+
+    // Matches can span Block boundaries (BLOCK_EDIT_SIZE is 512 bytes)
+    EXPECT_TRUE(handle_normal_command(e, "close -f; open", false));
+    view = e->view;
+    char line[16];
+    for (unsigned int i = 0; i < 200; i++) {
+        size_t n = xsnprintf(line, sizeof line, "line %u\n", i);
+        insert_text(view, line, n, true);
+    }
+
+    const Block *blk = BLOCK(e->buffer->blocks.next);
+    ASSERT_TRUE(block_has_next(blk, &e->buffer->blocks));
+    ASSERT_TRUE(blk->nl < 199);
+
+    // Search for the last line of the first Block and the line after it
+    const size_t nl = blk->nl;
+    const size_t offset = blk->size - 2 - (nl > 10) - (nl > 100);
+    xsnprintf(line, sizeof line, "%zu\\n", nl - 1);
+
+    EXPECT_TRUE(handle_normal_command(e, "bof", false));
+    char cmd[64];
+    xsnprintf(cmd, sizeof cmd, "search -H '%sline %zu$'", line, nl);
+    EXPECT_TRUE(handle_normal_command(e, cmd, false));
+    EXPECT_EQ(block_iter_get_offset(&view->cursor), offset);
+
+    xsnprintf(cmd, sizeof cmd, "replace 'line %sline' X", line);
+    EXPECT_TRUE(handle_normal_command(e, cmd, false));
+    xsnprintf(cmd, sizeof cmd, "\nX %zu\n", nl);
+    buf = get_buffer_text(e->buffer);
+    EXPECT_TRUE(strstr(buf, cmd) != NULL);
+    free(buf);
+    EXPECT_TRUE(handle_normal_command(e, "close -f", false));
+}
+
 static const TestEntry tests[] = {
     TEST(test_editor_state),
     TEST(test_handle_normal_command),
@@ -341,6 +538,8 @@ static const TestEntry tests[] = {
     TEST(test_exec_config),
     TEST(test_detect_indent),
     TEST(test_macro_record),
+    TEST(test_grep),
+    TEST(test_multiline_search_replace),
 };
 
 const TestGroup config_tests = TEST_GROUP(tests);
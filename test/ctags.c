@@ -106,9 +106,143 @@ static void test_next_tag(TestContext *ctx)
     free(buf);
 }
 
+static size_t count_tags_in_range(const char *buf, size_t len, TagSortOrder order, const char *prefix)
+{
+    size_t end;
+    StringView pfx = strview(prefix);
+    size_t pos = find_tag_range(buf, len, order, pfx, &end);
+    size_t n = 0;
+    Tag t;
+    while (next_tag(buf, end, &pos, pfx, false, &t)) {
+        free_tag(&t);
+        n++;
+    }
+    return n;
+}
+
+static void test_find_tag_range(TestContext *ctx)
+{
+    char *buf;
+    ssize_t len = read_file("test/data/ctags.txt", &buf, 8192);
+    ASSERT_TRUE(len >= 64);
+    EXPECT_EQ(get_tag_sort_order(buf, len), TAGS_SORTED);
+
+    size_t end;
+    size_t start = find_tag_range(buf, len, TAGS_SORTED, strview("hashmap_res"), &end);
+    EXPECT_TRUE(start < end);
+    EXPECT_TRUE(strview_has_prefix(string_view(buf + start, end - start), "hashmap_resize\t"));
+    EXPECT_EQ(end, len);
+
+    start = find_tag_range(buf, len, TAGS_SORTED, strview("hashmap_insert"), &end);
+    EXPECT_TRUE(strview_has_prefix(string_view(buf + start, end - start), "hashmap_insert\t"));
+    EXPECT_EQ(count_tags_in_range(buf, len, TAGS_SORTED, "hashmap_insert"), 2);
+
+    start = find_tag_range(buf, len, TAGS_SORTED, strview("zz"), &end);
+    EXPECT_EQ(start, len);
+    EXPECT_EQ(end, len);
+    start = find_tag_range(buf, len, TAGS_SORTED, strview("hashmap_a"), &end);
+    EXPECT_EQ(start, end);
+
+    EXPECT_EQ(count_tags_in_range(buf, len, TAGS_SORTED, ""), 12);
+    EXPECT_EQ(count_tags_in_range(buf, len, TAGS_SORTED, "hashmap_"), 10);
+    EXPECT_EQ(count_tags_in_range(buf, len, TAGS_SORTED, "hashmap_do_"), 2);
+    EXPECT_EQ(count_tags_in_range(buf, len, TAGS_SORTED, "MIN_SIZE"), 1);
+    EXPECT_EQ(count_tags_in_range(buf, len, TAGS_SORTED, "M"), 1);
+    EXPECT_EQ(count_tags_in_range(buf, len, TAGS_SORTED, "!_TAG"), 0);
+    EXPECT_EQ(count_tags_in_range(buf, len, TAGS_UNSORTED, "hashmap_"), 10);
+    free(buf);
+
+    static const char folded[] =
+        "!_TAG_FILE_FORMAT\t2\t/extended format/\n"
+        "!_TAG_FILE_SORTED\t2\t/0=unsorted, 1=sorted, 2=foldcase/\n"
+        "abc\ta.c\t1;\"\tf\n"
+        "ABCD\ta.c\t2;\"\tf\n"
+        "abcd\ta.c\t3;\"\tf\n"
+        "abc_x\ta.c\t4;\"\tf\n"
+        "Xyz\ta.c\t5;\"\tf\n"
+        "xyz\ta.c\t6;\"\tf\n";
+
+    len = sizeof(folded) - 1;
+    EXPECT_EQ(get_tag_sort_order(folded, len), TAGS_FOLDCASE);
+    EXPECT_EQ(count_tags_in_range(folded, len, TAGS_FOLDCASE, "abc"), 3);
+    EXPECT_EQ(count_tags_in_range(folded, len, TAGS_FOLDCASE, "ABC"), 1);
+    EXPECT_EQ(count_tags_in_range(folded, len, TAGS_FOLDCASE, "abc_"), 1);
+    EXPECT_EQ(count_tags_in_range(folded, len, TAGS_FOLDCASE, "xyz"), 1);
+    EXPECT_EQ(count_tags_in_range(folded, len, TAGS_FOLDCASE, "X"), 1);
+    EXPECT_EQ(count_tags_in_range(folded, len, TAGS_FOLDCASE, "b"), 0);
+
+    static const char unsorted[] = "!_TAG_FILE_SORTED\t0\t/0=unsorted/\nb\tb.c\t1\na\ta.c\t1\n";
+    EXPECT_EQ(get_tag_sort_order(unsorted, sizeof(unsorted) - 1), TAGS_UNSORTED);
+    EXPECT_EQ(get_tag_sort_order("", 0), TAGS_UNSORTED);
+    EXPECT_EQ(get_tag_sort_order("a\ta.c\t1\n", 8), TAGS_UNSORTED);
+}
+
+static void test_tag_name_index(TestContext *ctx)
+{
+    char *buf;
+    ssize_t len = read_file("test/data/ctags.txt", &buf, 8192);
+    ASSERT_TRUE(len >= 64);
+
+    TagNameIndex idx;
+    tag_name_index_build(&idx, buf, len);
+    ASSERT_EQ(idx.count, 12);
+    EXPECT_STRVIEW_EQ_CSTRING(idx.names[0], "MIN_SIZE");
+    EXPECT_STRVIEW_EQ_CSTRING(idx.names[11], "hashmap_resize");
+
+    size_t end;
+    size_t start = tag_name_index_find(&idx, strview(""), &end);
+    EXPECT_EQ(start, 0);
+    EXPECT_EQ(end, 12);
+    start = tag_name_index_find(&idx, strview("hashmap_"), &end);
+    EXPECT_EQ(start, 2);
+    EXPECT_EQ(end, 12);
+    start = tag_name_index_find(&idx, strview("hashmap_insert"), &end);
+    EXPECT_EQ(end - start, 2);
+    EXPECT_STRVIEW_EQ_CSTRING(idx.names[start], "hashmap_insert");
+    EXPECT_STRVIEW_EQ_CSTRING(idx.names[start + 1], "hashmap_insert_or_replace");
+    start = tag_name_index_find(&idx, strview("hashmap_a"), &end);
+    EXPECT_EQ(start, end);
+    start = tag_name_index_find(&idx, strview("zz"), &end);
+    EXPECT_EQ(start, 12);
+    EXPECT_EQ(end, 12);
+    tag_name_index_free(&idx);
+    EXPECT_NULL(idx.names);
+    free(buf);
+
+    static const char unsorted[] =
+        "!_TAG_FILE_SORTED\t0\t/0=unsorted/\n"
+        "b\tb.c\t1\n"
+        "a\ta.c\t1\n"
+        "b\tc.c\t1\n"
+        "\tno-name.c\t1\n"
+        "no-tab\n"
+        "\n"
+        "ab\ta.c\t2\n"
+        "a\tb.c\t3";
+
+    tag_name_index_build(&idx, unsorted, sizeof(unsorted) - 1);
+    ASSERT_EQ(idx.count, 3);
+    EXPECT_STRVIEW_EQ_CSTRING(idx.names[0], "a");
+    EXPECT_STRVIEW_EQ_CSTRING(idx.names[1], "ab");
+    EXPECT_STRVIEW_EQ_CSTRING(idx.names[2], "b");
+    start = tag_name_index_find(&idx, strview("a"), &end);
+    EXPECT_EQ(start, 0);
+    EXPECT_EQ(end, 2);
+    tag_name_index_free(&idx);
+
+    tag_name_index_build(&idx, "", 0);
+    EXPECT_EQ(idx.count, 0);
+    start = tag_name_index_find(&idx, strview("x"), &end);
+    EXPECT_EQ(start, 0);
+    EXPECT_EQ(end, 0);
+    tag_name_index_free(&idx);
+}
+
 static const TestEntry tests[] = {
     TEST(test_parse_ctags_line),
     TEST(test_next_tag),
+    TEST(test_find_tag_range),
+    TEST(test_tag_name_index),
 };
 
 const TestGroup ctags_tests = TEST_GROUP(tests);
@@ -4,6 +4,7 @@
 #include "editor.h"
 #include "show.h"
 #include "util/str-util.h"
+#include "util/xsnprintf.h"
 
 typedef enum {
     CHECK_NAME = 1u << 0, // Non-blank lines must begin with `name`
@@ -28,16 +29,20 @@ static const struct {
     {"ft", CHECK_NAME | CHECK_PARSE},
     {"hi", CHECK_NAME | CHECK_PARSE},
     {"include", 0},
+    {"jobs", 0},
     {"macro", 0},
+    {"memory", 0},
     {"msg", ALLOW_EMPTY},
     {"open", 0},
     {"paste", 0},
     {"option", CHECK_PARSE},
+    {"regex", 0},
     {"search", ALLOW_EMPTY},
     {"set", CHECK_NAME | CHECK_PARSE},
     {"setenv", CHECK_NAME | CHECK_PARSE},
     {"show", CHECK_NAME | CHECK_PARSE},
     // {"tag", 0}, // Depends on filesystem state not controlled by the test runner
+    {"timing", 0},
     {"wsplit", 0},
 };
 
@@ -130,8 +135,53 @@ static void test_dump_handlers(TestContext *ctx)
     }
 }
 
+static size_t count_fields(const char *line)
+{
+    size_t n = 0;
+    for (size_t i = 0; line[i]; i++) {
+        bool start = (line[i] != ' ') && (i == 0 || line[i - 1] == ' ');
+        n += start;
+    }
+    return n;
+}
+
+static void test_dump_memory_usage(TestContext *ctx)
+{
+    EditorState *e = ctx->userdata;
+    ASSERT_NONNULL(e);
+    ASSERT_NONNULL(e->buffer);
+
+    DumpFunc dump = get_dump_function("memory");
+    ASSERT_NONNULL(dump);
+    String str = dump(e);
+    ASSERT_TRUE(str.len > 0);
+    ASSERT_EQ(str.buffer[str.len - 1], '\n');
+
+    char scope[32];
+    xsnprintf(scope, sizeof scope, "buffer:%lu ", e->buffer->id);
+    size_t nr_buffer_rows = 0;
+    size_t nr_total_rows = 0;
+
+    for (size_t pos = 0, len = str.len; pos < len; ) {
+        const char *line = buf_next_line(str.buffer, &pos, len);
+        ASSERT_NONNULL(line);
+        if (line[0] == '#') {
+            continue;
+        }
+        // Every row must have exactly 5 fields, for the sake of scripts
+        EXPECT_EQ(count_fields(line), 5);
+        nr_buffer_rows += str_has_prefix(line, scope);
+        nr_total_rows += str_has_prefix(line, "global ") && strstr(line, " total ");
+    }
+
+    EXPECT_EQ(nr_buffer_rows, 3);
+    EXPECT_EQ(nr_total_rows, 1);
+    string_free(&str);
+}
+
 static const TestEntry tests[] = {
     TEST(test_dump_handlers),
+    TEST(test_dump_memory_usage),
 };
 
 const TestGroup dump_tests = TEST_GROUP(tests);
@@ -53,6 +53,7 @@ static void test_command_errors(TestContext *ctx)
         {"exec -s -o invalid true", "invalid action for -o: 'invalid'"},
         {"exec -s -e invalid true", "invalid action for -e: 'invalid'"},
         {"ft -- -name ext", "invalid filetype name"},
+        {"grep -C x /non-existent/dir/_x_29_", "unable to search"},
         {"hi xyz red green blue", "too many colors"},
         {"hi xyz _invalid_", "invalid color or attribute"},
         {"include -b nonexistent", "no built-in config with name 'nonexistent'"},
@@ -209,8 +209,8 @@ static void test_deinit(TestContext *ctx)
 
     // Make sure no terminal output was buffered
     const TermOutputBuffer *obuf = &term->obuf;
-    EXPECT_NONNULL(obuf->buf);
     EXPECT_EQ(obuf->count, 0);
+    EXPECT_TRUE(obuf->alloc == 0 || obuf->buf);
     EXPECT_EQ(obuf->scroll_x, 0);
     EXPECT_EQ(obuf->x, 0);
     EXPECT_EQ(obuf->width, 0);
@@ -1,6 +1,8 @@
 #include <stdlib.h>
+#include <string.h>
 #include "test.h"
 #include "regexp.h"
+#include "util/xsnprintf.h"
 
 static void test_regexp_escape(TestContext *ctx)
 {
@@ -17,8 +19,88 @@ static void test_regexp_escape(TestContext *ctx)
     regfree(&re);
 }
 
+static void test_regexp_expand_newline_escapes(TestContext *ctx)
+{
+    static const struct {
+        const char *pattern;
+        const char *expected;
+        size_t nr_newlines;
+    } tests[] = {
+        {"", "", 0},
+        {"abc", "abc", 0},
+        {"a\\nb", "a\nb", 1},
+        {"\\n\n\\n", "\n\n\n", 3},
+        {"a\\\\nb", "a\\\\nb", 0},
+        {"\\.\\n$", "\\.\n$", 1},
+        {"[\\n]\\n", "[\\n]\n", 1},
+        {"[]\\n]\\n", "[]\\n]\n", 1},
+        {"[^]\\n]", "[^]\\n]", 0},
+        {"[[:alpha:]\\n]+\\n", "[[:alpha:]\\n]+\n", 1},
+        {"[[.].]\\n]", "[[.].]\\n]", 0},
+        {"[a\\n", "[a\\n", 0},
+        {"x\\", "x\\", 0},
+    };
+
+    FOR_EACH_I(i, tests) {
+        char buf[64];
+        memcpy(buf, tests[i].pattern, strlen(tests[i].pattern) + 1);
+        IEXPECT_EQ(regexp_expand_newline_escapes(buf), tests[i].nr_newlines);
+        IEXPECT_STREQ(buf, tests[i].expected);
+    }
+}
+
+static void test_regexp_cache(TestContext *ctx)
+{
+    free_cached_regexps();
+    const int flags = DEFAULT_REGEX_FLAGS | REG_NEWLINE;
+    const CachedRegexp *cr = regexp_cache_lookup(NULL, "a\\nb", flags);
+    ASSERT_NONNULL(cr);
+    EXPECT_STREQ(cr->pattern, "a\\nb");
+    EXPECT_EQ(cr->flags, flags);
+    EXPECT_EQ(cr->nr_lines, 2);
+    EXPECT_TRUE(regexp_exec(&cr->re, "xa\nb", 4, 0, NULL, 0));
+
+    RegexpCacheStats stats = regexp_cache_get_stats();
+    EXPECT_EQ(stats.hits, 0);
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_PTREQ(regexp_cache_lookup(NULL, "a\\nb", flags), cr);
+    EXPECT_NULL(regexp_cache_lookup(NULL, "(", flags));
+    stats = regexp_cache_get_stats();
+    EXPECT_EQ(stats.hits, 1);
+    EXPECT_EQ(stats.misses, 2);
+
+    // Same pattern with different flags is a separate entry
+    const CachedRegexp *icase = regexp_cache_lookup(NULL, "a\\nb", flags | REG_ICASE);
+    ASSERT_NONNULL(icase);
+    EXPECT_FALSE(icase == cr);
+    EXPECT_TRUE(regexp_exec(&icase->re, "A\nB", 3, 0, NULL, 0));
+
+    // Least recently used entries are evicted when the cache is full
+    for (unsigned int i = 0; i < 16; i++) {
+        char pattern[8];
+        xsnprintf(pattern, sizeof pattern, "x%u", i);
+        ASSERT_NONNULL(regexp_cache_lookup(NULL, pattern, flags));
+    }
+
+    stats = regexp_cache_get_stats();
+    EXPECT_EQ(stats.hits, 1);
+    EXPECT_EQ(stats.misses, 19);
+    EXPECT_EQ(stats.evictions, 2);
+
+    String str = dump_regexp_cache();
+    const char *dump = string_borrow_cstring(&str);
+    EXPECT_TRUE(strstr(dump, "  Entries: 16/16\n") != NULL);
+    EXPECT_TRUE(strstr(dump, "Evictions: 2\n") != NULL);
+    EXPECT_TRUE(strstr(dump, "\n  ERE   -     x15\n  ERE   -     x14\n") != NULL);
+    EXPECT_NULL(strstr(dump, "a\\nb"));
+    string_free(&str);
+    free_cached_regexps();
+}
+
 static const TestEntry tests[] = {
     TEST(test_regexp_escape),
+    TEST(test_regexp_expand_newline_escapes),
+    TEST(test_regexp_cache),
 };
 
 const TestGroup regexp_tests = TEST_GROUP(tests);
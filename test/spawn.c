@@ -1,6 +1,11 @@
+#include <string.h>
+#include <time.h>
 #include <unistd.h>
 #include "test.h"
+#include "job.h"
+#include "regexp.h"
 #include "spawn.h"
+#include "util/xmalloc.h"
 
 static void test_spawn(TestContext *ctx)
 {
@@ -61,8 +66,212 @@ static void test_spawn(TestContext *ctx)
     string_free(err);
 }
 
+static void test_spawn_input_parts(TestContext *ctx)
+{
+    static const char *args[] = {"cat", NULL};
+
+    // Enough parts (and bytes) to require multiple writev(3) calls, with
+    // some of them only partially written
+    enum {NR_PARTS = 50, BIG_PART_SIZE = 16 * 1024};
+    char *big = xmalloc(BIG_PART_SIZE);
+    memset(big, 'x', BIG_PART_SIZE);
+
+    StringView parts[NR_PARTS];
+    String expected = string_new(NR_PARTS * BIG_PART_SIZE);
+    for (size_t i = 0; i < NR_PARTS; i++) {
+        switch (i % 3) {
+        case 0: parts[i] = strview("abc\n"); break;
+        case 1: parts[i] = string_view(big, BIG_PART_SIZE); break;
+        case 2: parts[i] = string_view("", 0); break;
+        }
+        string_append_buf(&expected, parts[i].data, parts[i].length);
+    }
+
+    SpawnContext sc = {
+        .argv = args,
+        .input_parts = parts,
+        .nr_input_parts = ARRAYLEN(parts),
+        .outputs = {STRING_INIT, STRING_INIT},
+        .quiet = true,
+        .actions = {
+            [STDIN_FILENO] = SPAWN_PIPE,
+            [STDOUT_FILENO] = SPAWN_PIPE,
+            [STDERR_FILENO] = SPAWN_NULL,
+        },
+    };
+
+    String *out = &sc.outputs[0];
+    EXPECT_EQ(spawn(&sc), 0);
+    EXPECT_EQ(out->len, expected.len);
+    EXPECT_TRUE(strview_equal(strview_from_string(out), strview_from_string(&expected)));
+
+    // Parts that are all empty should be equivalent to no input
+    EXPECT_EQ(string_clear(out), expected.len);
+    sc.nr_input_parts = 1;
+    sc.input_parts = parts + 2;
+    EXPECT_EQ(spawn(&sc), 0);
+    EXPECT_EQ(out->len, 0);
+
+    string_free(out);
+    string_free(&sc.outputs[1]);
+    string_free(&expected);
+    free(big);
+}
+
+static void test_spawn_output_blocks(TestContext *ctx)
+{
+    static const char *args[] = {"cat", NULL};
+    String text = string_new(128 * 1024);
+    for (size_t i = 0; i < 10000; i++) {
+        string_sprintf(&text, "%zu\n", i);
+    }
+
+    BlockList bl;
+    block_list_init(&bl);
+
+    SpawnContext sc = {
+        .argv = args,
+        .input = strview_from_string(&text),
+        .outputs = {STRING_INIT, STRING_INIT},
+        .output_blocks = &bl,
+        .quiet = true,
+        .actions = {
+            [STDIN_FILENO] = SPAWN_PIPE,
+            [STDOUT_FILENO] = SPAWN_PIPE,
+            [STDERR_FILENO] = SPAWN_NULL,
+        },
+    };
+
+    EXPECT_EQ(spawn(&sc), 0);
+    EXPECT_EQ(sc.outputs[0].len, 0);
+    EXPECT_EQ(bl.size, text.len);
+    EXPECT_EQ(bl.nl, 10000);
+
+    String joined = string_new(text.len);
+    const Block *blk;
+    block_for_each(blk, &bl.blocks) {
+        EXPECT_TRUE(blk->size > 0);
+        EXPECT_EQ(blk->data[blk->size - 1], '\n');
+        string_append_buf(&joined, blk->data, blk->size);
+    }
+    EXPECT_TRUE(strview_equal(strview_from_string(&joined), strview_from_string(&text)));
+
+    // No output should leave no (empty) Blocks
+    block_list_free(&bl);
+    sc.input.length = 0;
+    EXPECT_EQ(spawn(&sc), 0);
+    EXPECT_EQ(bl.size, 0);
+    EXPECT_TRUE(list_empty(&bl.blocks));
+
+    string_free(&joined);
+    string_free(&text);
+    string_free(&sc.outputs[0]);
+    string_free(&sc.outputs[1]);
+}
+
+static void wait_for_jobs(TestContext *ctx, JobList *jobs, const HashMap *compilers, ErrorBuffer *ebuf)
+{
+    // Each job should be reaped after a few iterations, but a limit is
+    // used here to avoid hanging the test runner if something goes wrong
+    for (size_t i = 0; jobs->jobs.count && i < 1000; i++) {
+        EXPECT_FALSE(job_list_wait(jobs, -1, compilers, ebuf));
+    }
+    EXPECT_EQ(jobs->jobs.count, 0);
+}
+
+static void test_job_list(TestContext *ctx)
+{
+    ErrorBuffer ebuf = {.print_to_stderr = false};
+    HashMap compilers = HASHMAP_INIT(HMAP_NO_FLAGS);
+    regex_t re;
+    ASSERT_TRUE(regexp_compile(&ebuf, &re, "^([^:]+):([0-9]+): (.*)$", 0));
+    int8_t indices[NR_ERRFMT_INDICES] = {
+        [ERRFMT_FILE] = 1,
+        [ERRFMT_LINE] = 2,
+        [ERRFMT_COLUMN] = -1,
+        [ERRFMT_MESSAGE] = 3,
+    };
+    add_error_fmt(&compilers, "test", "", &re, indices, false);
+
+    // Compile job, with messages parsed from stderr (including a final
+    // line without a newline terminator)
+    static const char *compile_args[] = {
+        "sh", "-c", "printf 'a.c:1: first\\nnoise\\nb.c:2: second' >&2; exit 3",
+        NULL
+    };
+
+    JobList jobs = {.next_id = 0};
+    MessageList msgs = {.pos = 0};
+    EXPECT_TRUE(job_start(&jobs, &ebuf, compile_args, false, "test", &msgs));
+    EXPECT_EQ(jobs.jobs.count, 1);
+    EXPECT_TRUE(str_has_prefix(ebuf.buf, "Started job 1 (pid "));
+    wait_for_jobs(ctx, &jobs, &compilers, &ebuf);
+    ASSERT_EQ(msgs.array.count, 3);
+    const Message *m = msgs.array.ptrs[0];
+    EXPECT_STREQ(m->msg, "first");
+    EXPECT_STREQ(m->loc->filename, "a.c");
+    EXPECT_EQ(m->loc->line, 1);
+    m = msgs.array.ptrs[1];
+    EXPECT_STREQ(m->msg, "noise");
+    m = msgs.array.ptrs[2];
+    EXPECT_STREQ(m->msg, "second");
+    EXPECT_STREQ(m->loc->filename, "b.c");
+    EXPECT_TRUE(ebuf.is_error);
+    EXPECT_NONNULL(strstr(ebuf.buf, ") returned 3 (3 messages)"));
+
+    // Exec job, with the first line of stderr included in the error message
+    static const char *exec_args[] = {"sh", "-c", "echo oops >&2; echo more >&2; exit 1", NULL};
+    EXPECT_TRUE(job_start(&jobs, &ebuf, exec_args, false, NULL, NULL));
+    wait_for_jobs(ctx, &jobs, &compilers, &ebuf);
+    EXPECT_NONNULL(strstr(ebuf.buf, ") returned 1: \"oops\""));
+
+    static const char *true_args[] = {"true", NULL};
+    EXPECT_TRUE(job_start(&jobs, &ebuf, true_args, false, NULL, NULL));
+    wait_for_jobs(ctx, &jobs, &compilers, &ebuf);
+    EXPECT_STREQ(ebuf.buf, "Job 3 (true) finished");
+    EXPECT_FALSE(ebuf.is_error);
+
+    // Killed job
+    EXPECT_FALSE(job_kill(&jobs, &ebuf, NULL, false));
+    EXPECT_STREQ(ebuf.buf, "No background jobs");
+    static const char *sleep_args[] = {"sleep", "10", NULL};
+    EXPECT_TRUE(job_start(&jobs, &ebuf, sleep_args, false, NULL, NULL));
+    EXPECT_FALSE(job_kill(&jobs, &ebuf, "99", false));
+    EXPECT_STREQ(ebuf.buf, "No such job: 99");
+    EXPECT_FALSE(job_kill(&jobs, &ebuf, "x", false));
+    EXPECT_STREQ(ebuf.buf, "Invalid job ID: 'x'");
+
+    String str = dump_jobs(&jobs);
+    EXPECT_TRUE(str_has_prefix(string_borrow_cstring(&str), "# id "));
+    EXPECT_NONNULL(strstr(string_borrow_cstring(&str), "  sleep 10\n"));
+    string_free(&str);
+
+    EXPECT_TRUE(job_kill(&jobs, &ebuf, "4", true));
+    wait_for_jobs(ctx, &jobs, &compilers, &ebuf);
+    EXPECT_STREQ(ebuf.buf, "Job 4 (sleep 10) received signal 9 (Killed)");
+
+    // The whole process group of the job is signalled, so that the output
+    // pipe is closed promptly (instead of when the `sleep` child exits)
+    static const char *group_args[] = {"sh", "-c", "sleep 10 & echo x >&2; wait", NULL};
+    EXPECT_TRUE(job_start(&jobs, &ebuf, group_args, false, NULL, NULL));
+    time_t start = time(NULL);
+    EXPECT_FALSE(job_list_wait(&jobs, -1, &compilers, &ebuf)); // Wait for "x"
+    EXPECT_EQ(jobs.jobs.count, 1);
+    EXPECT_TRUE(job_kill(&jobs, &ebuf, NULL, false));
+    wait_for_jobs(ctx, &jobs, &compilers, &ebuf);
+    EXPECT_TRUE(time(NULL) - start < 5);
+    EXPECT_TRUE(str_has_suffix(ebuf.buf, " received signal 15 (Terminated)"));
+
+    job_list_free(&jobs);
+    clear_messages(&msgs);
+    hashmap_free(&compilers, FREE_FUNC(free_compiler));
+}
+
 static const TestEntry tests[] = {
     TEST(test_spawn),
+    TEST(test_spawn_input_parts),
+    TEST(test_spawn_output_blocks),
+    TEST(test_job_list),
 };
 
 const TestGroup spawn_tests = TEST_GROUP(tests);
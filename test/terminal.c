@@ -16,6 +16,7 @@
 #include "util/str-array.h"
 #include "util/unicode.h"
 #include "util/utf8.h"
+#include "util/xmalloc.h"
 #include "util/xsnprintf.h"
 
 #define TFLAG(flags) (KEYCODE_QUERY_REPLY_BIT | (flags))
@@ -878,7 +879,7 @@ static void test_term_parse_sequence(TestContext *ctx)
     // XTVERSION replies
     const TermFeatureFlags tmuxflags = TFLAG (
         TFLAG_NO_QUERY_L3 | TFLAG_ECMA48_REPEAT | TFLAG_MODIFY_OTHER_KEYS
-        | TFLAG_BS_CTRL_BACKSPACE
+        | TFLAG_BS_CTRL_BACKSPACE | TFLAG_SCROLL_REGION
     );
     EXPECT_PARSE_SEQN("\033P>|tmux 3.2\033\\", 12, tmuxflags);
     EXPECT_PARSE_SEQN("\033P>|tmux 3.2a\033\\", 13, tmuxflags);
@@ -927,6 +928,8 @@ static void test_term_parse_sequence(TestContext *ctx)
     // XTGETTCAP replies
     EXPECT_PARSE_SEQN("\033P1+r626365\033\\", 11, TFLAG(TFLAG_BACK_COLOR_ERASE));
     EXPECT_PARSE_SEQN("\033P1+r74736C=1B5D323B\033\\", 20, TFLAG(TFLAG_SET_WINDOW_TITLE));
+    EXPECT_PARSE_SEQN("\033P1+r696E646E=1B5B25703125645\033\\", 29, KEY_IGNORE);
+    EXPECT_PARSE_SEQN("\033P1+r696E646E=1B5B257031256453\033\\", 30, TFLAG(TFLAG_SCROLL_REGION));
     EXPECT_PARSE_SEQN("\033P0+r\033\\", 5, KEY_IGNORE);
     EXPECT_PARSE_SEQN("\033P0+rbbccdd\033\\", 11, KEY_IGNORE);
 
@@ -1388,11 +1391,12 @@ static void test_parse_key_string(TestContext *ctx)
 
 static bool clear_obuf(TermOutputBuffer *obuf)
 {
-    if (unlikely(obuf_avail(obuf) <= 8)) {
+    size_t n = obuf->count + 8;
+    if (unlikely(n > TERM_OUTBUF_MAX)) {
         return false;
     }
-    memset(obuf->buf, '\0', obuf->count + 8);
     obuf->count = 0;
+    memset(term_output_reserve_space(obuf, n), '\0', n);
     obuf->x = 0;
     return true;
 }
@@ -1405,7 +1409,8 @@ static void test_term_init(TestContext *ctx)
         TFLAG_8_COLOR |
         TFLAG_BACK_COLOR_ERASE |
         TFLAG_SET_WINDOW_TITLE |
-        TFLAG_OSC52_COPY
+        TFLAG_OSC52_COPY |
+        TFLAG_SCROLL_REGION
     ;
 
     Terminal term = {.obuf = TERM_OUTPUT_INIT};
@@ -1426,6 +1431,13 @@ static void test_term_init(TestContext *ctx)
     EXPECT_EQ(term.height, 24);
     EXPECT_EQ(term.ncv_attributes, 0);
     EXPECT_EQ(term.features, 0);
+
+    // "stterm" is Debian's name for st(1)
+    term_init(&term, "st-256color", NULL);
+    EXPECT_TRUE(term.features & TFLAG_SCROLL_REGION);
+    term_init(&term, "stterm-256color", NULL);
+    EXPECT_TRUE(term.features & TFLAG_SCROLL_REGION);
+    term_output_free(&term.obuf);
 }
 
 static void test_term_put_str(TestContext *ctx)
@@ -1438,8 +1450,7 @@ static void test_term_put_str(TestContext *ctx)
 
     // Fill start of buffer with zeroes, to allow using EXPECT_STREQ() below
     TermOutputBuffer *obuf = &term.obuf;
-    ASSERT_TRUE(256 <= TERM_OUTBUF_SIZE);
-    memset(obuf->buf, 0, 256);
+    memset(term_output_reserve_space(obuf, 256), 0, 256);
 
     obuf->width = 0;
     term_put_str(obuf, "this should write nothing because obuf->width == 0");
@@ -1465,6 +1476,47 @@ static void test_term_put_str(TestContext *ctx)
     EXPECT_EQ(obuf->x, 21);
     EXPECT_STREQ(obuf->buf + 20, "<" "??" ">");
     ASSERT_TRUE(clear_obuf(obuf));
+    term_output_free(&term.obuf);
+}
+
+static void test_term_put_ascii(TestContext *ctx)
+{
+    Terminal term = {
+        .width = 80,
+        .height = 24,
+        .obuf = TERM_OUTPUT_INIT,
+    };
+
+    TermOutputBuffer *obuf = &term.obuf;
+    memset(term_output_reserve_space(obuf, 256), 0, 256);
+
+    term_output_reset(&term, 0, 10, 0);
+    EXPECT_TRUE(term_put_ascii(obuf, STRN("abc def")));
+    EXPECT_EQ(obuf->count, 7);
+    EXPECT_EQ(obuf->x, 7);
+    EXPECT_STREQ(obuf->buf, "abc def");
+
+    // Run clipped at the right edge
+    EXPECT_FALSE(term_put_ascii(obuf, STRN("ghijkl")));
+    EXPECT_EQ(obuf->count, 10);
+    EXPECT_EQ(obuf->x, 10);
+    EXPECT_STREQ(obuf->buf, "abc defghi");
+    EXPECT_FALSE(term_put_ascii(obuf, STRN("x")));
+    EXPECT_EQ(obuf->count, 10);
+    EXPECT_TRUE(term_put_ascii(obuf, "", 0));
+    ASSERT_TRUE(clear_obuf(obuf));
+
+    // Run partially scrolled out of view on the left
+    term_output_reset(&term, 0, 4, 3);
+    EXPECT_TRUE(term_put_ascii(obuf, STRN("ab")));
+    EXPECT_EQ(obuf->count, 0);
+    EXPECT_EQ(obuf->x, 2);
+    EXPECT_FALSE(term_put_ascii(obuf, STRN("cdefghij")));
+    EXPECT_EQ(obuf->count, 4);
+    EXPECT_EQ(obuf->x, 7);
+    EXPECT_STREQ(obuf->buf, "defg");
+    ASSERT_TRUE(clear_obuf(obuf));
+    term_output_free(&term.obuf);
 }
 
 static void test_term_clear_eol(TestContext *ctx)
@@ -1532,6 +1584,7 @@ static void test_term_clear_eol(TestContext *ctx)
     EXPECT_EQ(obuf->count, 0);
     EXPECT_EQ(obuf->x, 30);
     ASSERT_TRUE(clear_obuf(obuf));
+    term_output_free(&term.obuf);
 }
 
 static void test_term_move_cursor(TestContext *ctx)
@@ -1546,6 +1599,39 @@ static void test_term_move_cursor(TestContext *ctx)
     EXPECT_MEMEQ(obuf.buf, obuf.count, "\033[23H", 5);
     EXPECT_EQ(obuf.x, 0);
     ASSERT_TRUE(clear_obuf(&obuf));
+    term_output_free(&obuf);
+}
+
+static void test_term_output_reserve_space(TestContext *ctx)
+{
+    TermOutputBuffer obuf = TERM_OUTPUT_INIT;
+    EXPECT_NULL(obuf.buf);
+    EXPECT_EQ(obuf.alloc, 0);
+
+    char *buf = term_output_reserve_space(&obuf, 1);
+    ASSERT_NONNULL(buf);
+    EXPECT_PTREQ(buf, obuf.buf);
+    EXPECT_EQ(obuf.alloc, TERM_OUTBUF_SIZE);
+    EXPECT_EQ(obuf.count, 0);
+
+    // Output larger than TERM_OUTBUF_SIZE should grow the buffer,
+    // instead of being written to the terminal in several parts
+    const size_t n = 3 * TERM_OUTBUF_SIZE;
+    char *str = xmalloc(n);
+    memset(str, 'x', n);
+    term_put_bytes(&obuf, str, n);
+    term_put_bytes(&obuf, str, 10);
+    EXPECT_EQ(obuf.count, n + 10);
+    EXPECT_EQ(obuf.alloc, 4 * TERM_OUTBUF_SIZE);
+    EXPECT_EQ(obuf.nr_flushes, 0);
+    EXPECT_EQ(obuf.nr_written, 0);
+    EXPECT_MEMEQ(obuf.buf + n, 10, str, 10);
+    free(str);
+
+    obuf.count = 0;
+    term_output_free(&obuf);
+    EXPECT_NULL(obuf.buf);
+    EXPECT_EQ(obuf.alloc, 0);
 }
 
 static void test_term_set_bytes(TestContext *ctx)
@@ -1577,6 +1663,7 @@ static void test_term_set_bytes(TestContext *ctx)
     EXPECT_MEMEQ(obuf->buf, obuf->count, "\n\n\n\n\n\n\n\n", 8);
     EXPECT_EQ(obuf->x, 8);
     ASSERT_TRUE(clear_obuf(obuf));
+    term_output_free(&term.obuf);
 }
 
 static void test_term_set_style(TestContext *ctx)
@@ -1587,8 +1674,7 @@ static void test_term_set_style(TestContext *ctx)
     EXPECT_EQ(term.ncv_attributes, 0);
 
     TermOutputBuffer *obuf = &term.obuf;
-    ASSERT_TRUE(TERM_OUTBUF_SIZE >= 64);
-    memset(obuf->buf, '?', 64);
+    memset(term_output_reserve_space(obuf, 64), '?', 64);
 
     TermStyle style = {
         .fg = COLOR_RED,
@@ -1665,6 +1751,7 @@ static void test_term_set_style(TestContext *ctx)
     style.attr &= ~ATTR_DIM;
     EXPECT_TRUE(same_style(&obuf->style, &style));
     ASSERT_TRUE(clear_obuf(obuf));
+    term_output_free(&term.obuf);
 }
 
 static void test_term_osc52_copy(TestContext *ctx)
@@ -1687,6 +1774,7 @@ static void test_term_osc52_copy(TestContext *ctx)
     EXPECT_MEMEQ(obuf.buf, obuf.count, "\033]52;c;\033\\", 9);
     EXPECT_EQ(obuf.x, 0);
     ASSERT_TRUE(clear_obuf(&obuf));
+    term_output_free(&obuf);
 }
 
 static void test_term_set_cursor_style(TestContext *ctx)
@@ -1707,7 +1795,7 @@ static void test_term_set_cursor_style(TestContext *ctx)
     ASSERT_EQ(expected_len, 24);
 
     TermOutputBuffer *obuf = &term.obuf;
-    memset(obuf->buf, '@', expected_len + 16);
+    memset(term_output_reserve_space(obuf, expected_len + 16), '@', expected_len + 16);
 
     term_set_cursor_style(&term, style);
     EXPECT_MEMEQ(obuf->buf, obuf->count, expected, expected_len);
@@ -1715,6 +1803,7 @@ static void test_term_set_cursor_style(TestContext *ctx)
     EXPECT_EQ(obuf->cursor_style.type, style.type);
     EXPECT_EQ(obuf->cursor_style.color, style.color);
     ASSERT_TRUE(clear_obuf(obuf));
+    term_output_free(&term.obuf);
 }
 
 static void test_term_restore_cursor_style(TestContext *ctx)
@@ -1730,12 +1819,13 @@ static void test_term_restore_cursor_style(TestContext *ctx)
     ASSERT_EQ(expected_len, 12);
 
     TermOutputBuffer *obuf = &term.obuf;
-    memset(obuf->buf, '@', expected_len + 16);
+    memset(term_output_reserve_space(obuf, expected_len + 16), '@', expected_len + 16);
 
     term_restore_cursor_style(&term);
     EXPECT_MEMEQ(obuf->buf, obuf->count, expected, expected_len);
     EXPECT_EQ(obuf->x, 0);
     ASSERT_TRUE(clear_obuf(obuf));
+    term_output_free(&term.obuf);
 }
 
 static void test_term_begin_sync_update(TestContext *ctx)
@@ -1754,7 +1844,7 @@ static void test_term_begin_sync_update(TestContext *ctx)
     ;
 
     TermOutputBuffer *obuf = &term.obuf;
-    memset(obuf->buf, '.', 128);
+    memset(term_output_reserve_space(obuf, 128), '.', 128);
 
     term_begin_sync_update(&term);
     term_use_alt_screen_buffer(&term);
@@ -1765,6 +1855,182 @@ static void test_term_begin_sync_update(TestContext *ctx)
 
     EXPECT_MEMEQ(obuf->buf, obuf->count, expected, sizeof(expected) - 1);
     EXPECT_EQ(obuf->x, 0);
+    term_output_free(&term.obuf);
+}
+
+static void test_term_screen_update(TestContext *ctx)
+{
+    Terminal term = {
+        .width = 12,
+        .height = 3,
+        .obuf = TERM_OUTPUT_INIT,
+    };
+
+    TermOutputBuffer *obuf = &term.obuf;
+    const TermStyle red = {.fg = COLOR_RED, .bg = COLOR_DEFAULT};
+    const TermStyle def = {.fg = COLOR_DEFAULT, .bg = COLOR_DEFAULT};
+
+    // Initial update; only cells that were drawn are emitted
+    term_screen_begin_update(&term);
+    term_output_reset(&term, 0, term.width, 0);
+    term_move_cursor(obuf, 0, 0);
+    term_put_str(obuf, "abc");
+    term_output_reset(&term, 0, term.width, 0);
+    term_move_cursor(obuf, 0, 2);
+    term_put_str(obuf, "x\xE3\x81\x82y");
+    EXPECT_EQ(obuf->count, 0);
+    term_screen_end_update(&term);
+    static const char expected1[] = "\033[1Habc\033[3Hx\xE3\x81\x82y";
+    EXPECT_MEMEQ(obuf->buf, obuf->count, expected1, sizeof(expected1) - 1);
+    ASSERT_TRUE(clear_obuf(obuf));
+
+    // Only the changed cell is emitted
+    term_screen_begin_update(&term);
+    term_output_reset(&term, 0, term.width, 0);
+    term_move_cursor(obuf, 0, 0);
+    term_put_str(obuf, "abd");
+    term_screen_end_update(&term);
+    EXPECT_MEMEQ(obuf->buf, obuf->count, "\033[1;3Hd", 7);
+    ASSERT_TRUE(clear_obuf(obuf));
+
+    // Style changes are emitted only for changed cells
+    term_screen_begin_update(&term);
+    term_output_reset(&term, 0, term.width, 0);
+    term_move_cursor(obuf, 0, 0);
+    term_put_char(obuf, 'a');
+    term_set_style(&term, red);
+    term_put_char(obuf, 'b');
+    term_set_style(&term, def);
+    term_put_char(obuf, 'd');
+    term_screen_end_update(&term);
+    static const char expected3[] = "\033[1;2H\033[0;31mb";
+    EXPECT_MEMEQ(obuf->buf, obuf->count, expected3, sizeof(expected3) - 1);
+    EXPECT_TRUE(same_style(&obuf->style, &red));
+    ASSERT_TRUE(clear_obuf(obuf));
+
+    // Identical update; nothing emitted
+    term_screen_begin_update(&term);
+    term_output_reset(&term, 0, term.width, 0);
+    term_set_style(&term, def);
+    term_move_cursor(obuf, 0, 2);
+    term_put_str(obuf, "x\xE3\x81\x82y");
+    term_screen_end_update(&term);
+    EXPECT_EQ(obuf->count, 0);
+
+    // Clearing the screen invalidates all cells, so that they're all
+    // emitted again (with EL used for trailing blanks)
+    term_clear_screen(obuf);
+    ASSERT_TRUE(clear_obuf(obuf));
+    term_screen_begin_update(&term);
+    term_output_reset(&term, 0, term.width, 0);
+    term_move_cursor(obuf, 0, 0);
+    term_set_style(&term, def);
+    term_put_str(obuf, "abd");
+    term_clear_eol(&term);
+    term_screen_end_update(&term);
+    static const char expected5[] = "\033[1H\033[0mabd\033[K";
+    EXPECT_MEMEQ(obuf->buf, obuf->count, expected5, sizeof(expected5) - 1);
+    ASSERT_TRUE(clear_obuf(obuf));
+
+    term_screen_free(&obuf->screen);
+    term_output_free(&term.obuf);
+}
+
+static void test_term_screen_put_ascii(TestContext *ctx)
+{
+    Terminal term = {
+        .width = 8,
+        .height = 2,
+        .obuf = TERM_OUTPUT_INIT,
+    };
+
+    TermOutputBuffer *obuf = &term.obuf;
+    term_screen_begin_update(&term);
+    term_output_reset(&term, 0, term.width, 0);
+    term_move_cursor(obuf, 0, 0);
+    term_put_str(obuf, "a\xE3\x81\x82" "b\xE3\x81\x82");
+    term_screen_end_update(&term);
+    ASSERT_TRUE(clear_obuf(obuf));
+
+    // Overwriting half of a double-width glyph at either end of the run
+    // erases the other half, and runs are clipped to the screen width
+    term_screen_begin_update(&term);
+    term_output_reset(&term, 2, term.width - 2, 0);
+    term_move_cursor(obuf, 2, 0);
+    EXPECT_TRUE(term_put_ascii(obuf, STRN("xyz")));
+    term_output_reset(&term, 0, term.width, 0);
+    term_move_cursor(obuf, 0, 1);
+    EXPECT_FALSE(term_put_ascii(obuf, STRN("0123456789")));
+    EXPECT_EQ(obuf->x, 8);
+    EXPECT_EQ(obuf->count, 0);
+    term_screen_end_update(&term);
+    static const char expected[] = "\033[1;2H xyz \033[2H01234567";
+    EXPECT_MEMEQ(obuf->buf, obuf->count, expected, sizeof(expected) - 1);
+    ASSERT_TRUE(clear_obuf(obuf));
+
+    term_screen_free(&obuf->screen);
+    term_output_free(&term.obuf);
+}
+
+static void test_term_screen_scroll(TestContext *ctx)
+{
+    Terminal term = {
+        .width = 4,
+        .height = 5,
+        .obuf = TERM_OUTPUT_INIT,
+    };
+
+    TermOutputBuffer *obuf = &term.obuf;
+    static const char lines[][5] = {"aaaa", "bbbb", "cccc", "dddd", "eeee"};
+
+    term_screen_begin_update(&term);
+    for (unsigned int y = 0; y < 5; y++) {
+        term_output_reset(&term, 0, term.width, 0);
+        term_move_cursor(obuf, 0, y);
+        term_put_str(obuf, lines[y]);
+    }
+    term_screen_end_update(&term);
+    ASSERT_TRUE(clear_obuf(obuf));
+
+    // Scrolling isn't done without TFLAG_SCROLL_REGION
+    term_screen_begin_update(&term);
+    EXPECT_FALSE(term_screen_scroll(&term, 1, 3, 1));
+    EXPECT_EQ(obuf->count, 0);
+    term_screen_end_update(&term);
+
+    // Scroll rows 1-3 up by 1 line and then redraw them, which should only
+    // require emitting the newly exposed row
+    term.features = TFLAG_SCROLL_REGION;
+    term_screen_begin_update(&term);
+    EXPECT_FALSE(term_screen_scroll(&term, 1, 3, 3));
+    EXPECT_FALSE(term_screen_scroll(&term, 1, 3, 0));
+    EXPECT_TRUE(term_screen_scroll(&term, 1, 3, 1));
+    for (unsigned int y = 1; y <= 3; y++) {
+        term_output_reset(&term, 0, term.width, 0);
+        term_move_cursor(obuf, 0, y);
+        term_put_str(obuf, (y < 3) ? lines[y + 1] : "xxxx");
+    }
+    term_screen_end_update(&term);
+    static const char expected1[] = "\033[2;4r\033[1S\033[r\033[4Hxxxx";
+    EXPECT_MEMEQ(obuf->buf, obuf->count, expected1, sizeof(expected1) - 1);
+    ASSERT_TRUE(clear_obuf(obuf));
+
+    // Scroll rows 0-4 down by 2 lines
+    static const char scrolled[][5] = {"yyyy", "zzzz", "aaaa", "cccc", "dddd"};
+    term_screen_begin_update(&term);
+    EXPECT_TRUE(term_screen_scroll(&term, 0, 4, -2));
+    for (unsigned int y = 0; y < 5; y++) {
+        term_output_reset(&term, 0, term.width, 0);
+        term_move_cursor(obuf, 0, y);
+        term_put_str(obuf, scrolled[y]);
+    }
+    term_screen_end_update(&term);
+    static const char expected2[] = "\033[1;5r\033[2T\033[r\033[1Hyyyy\033[2Hzzzz";
+    EXPECT_MEMEQ(obuf->buf, obuf->count, expected2, sizeof(expected2) - 1);
+    ASSERT_TRUE(clear_obuf(obuf));
+
+    term_screen_free(&obuf->screen);
+    term_output_free(&term.obuf);
 }
 
 static void test_term_put_level_1_queries(TestContext *ctx)
@@ -1777,12 +2043,13 @@ static void test_term_put_level_1_queries(TestContext *ctx)
         C8 = TFLAG_8_COLOR,
         C16 = TFLAG_16_COLOR | C8,
         C256 = TFLAG_256_COLOR | C16,
+        SCROLL = TFLAG_SCROLL_REGION,
     };
 
     Terminal term = {.obuf = TERM_OUTPUT_INIT};
     TermOutputBuffer *obuf = &term.obuf;
     term_init(&term, "xterm-256color", NULL);
-    EXPECT_UINT_EQ(term.features, (C256 | BCE | TITLE | OSC52));
+    EXPECT_UINT_EQ(term.features, (C256 | BCE | TITLE | OSC52 | SCROLL));
     EXPECT_EQ(obuf->count, 0);
 
     // Basic level 1 queries
@@ -1818,6 +2085,7 @@ static void test_term_put_level_1_queries(TestContext *ctx)
         "\033P+q726570\033\\"
         "\033P+q74736C\033\\"
         "\033P+q4D73\033\\"
+        "\033P+q696E646E\033\\"
         // term_put_level_3_queries() debug
         "\033P+q71756572792d6f732d6e616d65\033\\"
         "\033P$q q\033\\"
@@ -1829,6 +2097,7 @@ static void test_term_put_level_1_queries(TestContext *ctx)
 
     EXPECT_EQ(obuf->scroll_x, 0);
     EXPECT_EQ(obuf->x, 0);
+    term_output_free(&term.obuf);
 }
 
 static void test_update_term_title(TestContext *ctx)
@@ -1865,6 +2134,7 @@ static void test_update_term_title(TestContext *ctx)
     EXPECT_MEMEQ(obuf.buf, plen, prefix, plen);
     EXPECT_MEMEQ(obuf.buf + plen, tlen, filename, tlen);
     EXPECT_MEMEQ(obuf.buf + plen + tlen, slen, suffix, slen);
+    term_output_free(&obuf);
 }
 
 static const TestEntry tests[] = {
@@ -1888,14 +2158,19 @@ static const TestEntry tests[] = {
     TEST(test_parse_key_string),
     TEST(test_term_init),
     TEST(test_term_put_str),
+    TEST(test_term_put_ascii),
     TEST(test_term_clear_eol),
     TEST(test_term_move_cursor),
+    TEST(test_term_output_reserve_space),
     TEST(test_term_set_bytes),
     TEST(test_term_set_style),
     TEST(test_term_osc52_copy),
     TEST(test_term_set_cursor_style),
     TEST(test_term_restore_cursor_style),
     TEST(test_term_begin_sync_update),
+    TEST(test_term_screen_update),
+    TEST(test_term_screen_put_ascii),
+    TEST(test_term_screen_scroll),
     TEST(test_term_put_level_1_queries),
     TEST(test_update_term_title),
 };
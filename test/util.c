@@ -26,6 +26,7 @@
 #include "util/progname.h"
 #include "util/ptr-array.h"
 #include "util/readfile.h"
+#include "util/slab.h"
 #include "util/str-array.h"
 #include "util/str-util.h"
 #include "util/string-view.h"
@@ -2706,6 +2707,61 @@ static void test_list(TestContext *ctx)
     EXPECT_NULL(b.prev);
 }
 
+static void test_slab_pool(TestContext *ctx)
+{
+    SlabPool pool;
+    slab_pool_init(&pool, 1000);
+    EXPECT_EQ(pool.obj_size % sizeof(void*), 0);
+    EXPECT_TRUE(pool.obj_size >= 1000);
+
+    size_t cap = slab_pool_capacity(&pool);
+    ASSERT_TRUE(cap >= 8);
+    EXPECT_EQ(pool.nr_slabs, 0);
+
+    char *objs[200];
+    size_t n = MIN(ARRAYLEN(objs), (cap * 3) + 1);
+    for (size_t i = 0; i < n; i++) {
+        objs[i] = slab_alloc(&pool);
+        memset(objs[i], (int)(i & 0xFF), 1000);
+    }
+    EXPECT_EQ(pool.nr_objects, n);
+    EXPECT_EQ(pool.nr_slabs, 4);
+
+    // Free every other object, then check the remaining ones are intact
+    for (size_t i = 0; i < n; i += 2) {
+        slab_free(&pool, objs[i]);
+    }
+    bool intact = true;
+    for (size_t i = 1; i < n; i += 2) {
+        intact = intact && objs[i][0] == (char)(i & 0xFF) && objs[i][999] == (char)(i & 0xFF);
+    }
+    EXPECT_TRUE(intact);
+    EXPECT_EQ(pool.nr_objects, n / 2);
+    EXPECT_EQ(pool.nr_slabs, 4);
+
+    // Freed objects should be reused, instead of allocating new slabs
+    for (size_t i = 0; i < n; i += 2) {
+        objs[i] = slab_alloc(&pool);
+    }
+    EXPECT_EQ(pool.nr_objects, n);
+    EXPECT_EQ(pool.nr_slabs, 4);
+
+    // Empty slabs should be freed, except for one spare
+    for (size_t i = 0; i < n; i++) {
+        slab_free(&pool, objs[i]);
+    }
+    EXPECT_EQ(pool.nr_objects, 0);
+    EXPECT_EQ(pool.nr_slabs, 1);
+    EXPECT_NONNULL(pool.spare);
+
+    objs[0] = slab_alloc(&pool);
+    EXPECT_EQ(pool.nr_slabs, 1);
+    EXPECT_NULL(pool.spare);
+    slab_free(&pool, objs[0]);
+    slab_pool_free(&pool);
+    EXPECT_EQ(pool.nr_slabs, 0);
+}
+
 static void test_hashmap(TestContext *ctx)
 {
     static const char strings[][8] = {
@@ -3815,6 +3871,32 @@ static void test_fork_exec(TestContext *ctx)
     EXPECT_TRUE(r >= 256);
     EXPECT_EQ(r >> 8, SIGINT);
 
+    // Pre-exec errors should be reported via errno (and not as a
+    // successful spawn, followed by a non-zero exit status)
+    argv[0] = "/non-existent/command";
+    argv[1] = NULL;
+    errno = 0;
+    EXPECT_EQ(fork_exec(argv, fd, 0, 0, true), -1);
+    EXPECT_EQ(errno, ENOENT);
+
+    // $LINES and $COLUMNS should replace any inherited values
+    int p[2];
+    ASSERT_EQ(xpipe2(p, O_CLOEXEC), 0);
+    ASSERT_EQ(setenv("LINES", "99", 1), 0);
+    fd[1] = p[1];
+    argv[0] = "sh";
+    argv[1] = "-c";
+    argv[2] = "printf \"$LINES $COLUMNS\"";
+    pid = fork_exec(argv, fd, 21, 83, true);
+    EXPECT_EQ(unsetenv("LINES"), 0);
+    EXPECT_EQ(xclose(p[1]), 0);
+    ASSERT_NE(pid, -1);
+    char buf[16];
+    ssize_t n = xread_all(p[0], buf, sizeof(buf));
+    EXPECT_EQ(wait_child(pid), 0);
+    EXPECT_MEMEQ(buf, n, "21 83", 5);
+    EXPECT_EQ(xclose(p[0]), 0);
+
     EXPECT_EQ(xclose(fd[0]), 0);
 }
 
@@ -3914,6 +3996,22 @@ static void test_timespec_subtract(TestContext *ctx)
     EXPECT_EQ(r.tv_nsec, 4996);
 }
 
+static void test_timespec_add_ms(TestContext *ctx)
+{
+    struct timespec ts = {.tv_sec = 3, .tv_nsec = NS_PER_SECOND - NS_PER_MS};
+    struct timespec r = timespec_add_ms(ts, 1);
+    EXPECT_EQ(r.tv_sec, 4);
+    EXPECT_EQ(r.tv_nsec, 0);
+
+    r = timespec_add_ms(ts, 2500);
+    EXPECT_EQ(r.tv_sec, 6);
+    EXPECT_EQ(r.tv_nsec, 499 * NS_PER_MS);
+
+    r = timespec_add_ms(r, 0);
+    EXPECT_EQ(r.tv_sec, 6);
+    EXPECT_EQ(r.tv_nsec, 499 * NS_PER_MS);
+}
+
 static void test_timespec_to_str(TestContext *ctx)
 {
     char buf[TIME_STR_BUFSIZE] = "";
@@ -4029,6 +4127,7 @@ static const TestEntry tests[] = {
     TEST(test_ptr_array_move),
     TEST(test_ptr_array_insert),
     TEST(test_list),
+    TEST(test_slab_pool),
     TEST(test_hashmap),
     TEST(test_hashset),
     TEST(test_intmap),
@@ -4072,6 +4171,7 @@ static const TestEntry tests[] = {
     TEST(test_log_level_from_str),
     TEST(test_log_level_to_str),
     TEST(test_timespec_subtract),
+    TEST(test_timespec_add_ms),
     TEST(test_timespec_to_str),
     TEST(test_progname),
 };
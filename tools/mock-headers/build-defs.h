@@ -13,4 +13,6 @@
 #define HAVE_TCGETWINSIZE 0
 #define HAVE_POSIX_MADVISE 0
 #define HAVE_QSORT_R 0
+#define HAVE_POSIX_SPAWN 0
+#define HAVE_POSIX_SPAWN_SETSID 0
 // NOLINTEND(modernize-macro-to-enum)